@@ -284,6 +284,13 @@ abstract class SettingsItem(
                     descriptionId = R.string.use_disk_shader_cache_description
                 )
             )
+            put(
+                SwitchSetting(
+                    BooleanSetting.RENDERER_USE_DISK_TEXTURE_CACHE,
+                    titleId = R.string.use_disk_texture_cache,
+                    descriptionId = R.string.use_disk_texture_cache_description
+                )
+            )
             put(
                 SwitchSetting(
                     BooleanSetting.RENDERER_FORCE_MAX_CLOCK,
@@ -491,6 +491,10 @@ class EmulationFragment : Fragment(), SurfaceHolder.Callback {
             val FPS = 1
             val FRAMETIME = 2
             val SPEED = 3
+            val VRAM_USAGE = 4
+            val VRAM_BUDGET = 5
+            val VRAM_EVICTION_RATE = 6
+            val AUDIO_LATENCY = 7
             perfStatsUpdater = {
                 if (emulationViewModel.emulationStarted.value &&
                     !emulationViewModel.isEmulationStopping.value
@@ -499,8 +503,26 @@ class EmulationFragment : Fragment(), SurfaceHolder.Callback {
                     val cpuBackend = NativeLibrary.getCpuBackend()
                     val gpuDriver = NativeLibrary.getGpuDriver()
                     if (_binding != null) {
-                        binding.showFpsText.text =
+                        var fpsText =
                             String.format("FPS: %.1f\n%s/%s", perfStats[FPS], cpuBackend, gpuDriver)
+                        if (perfStats[AUDIO_LATENCY] > 0) {
+                            fpsText = String.format(
+                                "%s\nAudio: %.1f ms",
+                                fpsText,
+                                perfStats[AUDIO_LATENCY]
+                            )
+                        }
+                        binding.showFpsText.text = if (perfStats[VRAM_BUDGET] > 0) {
+                            String.format(
+                                "%s\nVRAM: %.0f/%.0f MiB (%.1f MiB/s)",
+                                fpsText,
+                                perfStats[VRAM_USAGE],
+                                perfStats[VRAM_BUDGET],
+                                perfStats[VRAM_EVICTION_RATE]
+                            )
+                        } else {
+                            fpsText
+                        }
                     }
                     perfStatsUpdateHandler.postDelayed(perfStatsUpdater!!, 800)
                 }
@@ -58,6 +58,8 @@
 #include "hid_core/hid_core.h"
 #include "hid_core/hid_types.h"
 #include "jni/native.h"
+#include "video_core/gpu.h"
+#include "video_core/memory_stats.h"
 #include "video_core/renderer_base.h"
 #include "video_core/renderer_vulkan/renderer_vulkan.h"
 #include "video_core/vulkan_common/vulkan_instance.h"
@@ -590,16 +592,24 @@ void Java_org_yuzu_yuzu_1emu_NativeLibrary_initializeSystem(JNIEnv* env, jclass
 }
 
 jdoubleArray Java_org_yuzu_yuzu_1emu_NativeLibrary_getPerfStats(JNIEnv* env, jclass clazz) {
-    jdoubleArray j_stats = env->NewDoubleArray(4);
+    jdoubleArray j_stats = env->NewDoubleArray(8);
 
     if (EmulationSession::GetInstance().IsRunning()) {
         jconst results = EmulationSession::GetInstance().PerfStats();
+        auto& memory_stats = EmulationSession::GetInstance().System().GPU().MemoryStats();
 
         // Converting the structure into an array makes it easier to pass it to the frontend
-        double stats[4] = {results.system_fps, results.average_game_fps, results.frametime,
-                           results.emulation_speed};
-
-        env->SetDoubleArrayRegion(j_stats, 0, 4, stats);
+        constexpr double MiB = 1024.0 * 1024.0;
+        double stats[8] = {results.system_fps,
+                           results.average_game_fps,
+                           results.frametime,
+                           results.emulation_speed,
+                           static_cast<double>(memory_stats.Usage()) / MiB,
+                           static_cast<double>(memory_stats.Budget()) / MiB,
+                           memory_stats.GetAndResetEvictionRate() / MiB,
+                           results.audio_latency * 1000.0};
+
+        env->SetDoubleArrayRegion(j_stats, 0, 8, stats);
     }
 
     return j_stats;
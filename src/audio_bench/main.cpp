@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fmt/format.h>
+#include <getopt.h>
+
+#include "audio_core/renderer/render_capture.h"
+#include "common/common_types.h"
+#include "common/logging/backend.h"
+#include "common/logging/filter.h"
+#include "common/settings.h"
+#include "core/core.h"
+
+namespace {
+/// Parses the numeric argument of an option, values below one are raised to one
+std::optional<u32> ParseCount(const char* text) {
+    const char* const end = text + std::strlen(text);
+    u32 value{};
+    const auto [ptr, ec] = std::from_chars(text, end, value);
+    if (ec != std::errc{} || ptr != end) {
+        return std::nullopt;
+    }
+    return std::max(value, 1U);
+}
+
+void PrintHelp(const char* argv0) {
+    std::cout << "Usage: " << argv0
+              << " [options] <audio renderer capture>...\n"
+                 "-a, --no-adpcm-cache  Decode every ADPCM voice, without the decode cache\n"
+                 "-h, --help            Display this help and exit\n"
+                 "-n, --iterations      Number of times every capture is replayed\n"
+                 "-s, --serial          Decode the voices on the processing thread only\n";
+}
+
+double Milliseconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+void PrintStatistics(const AudioCore::Renderer::RenderCapture& capture,
+                     const AudioCore::Renderer::RenderReplayStats& stats) {
+    using namespace AudioCore::Renderer;
+
+    const double frames{static_cast<double>(std::max<size_t>(stats.frames, 1))};
+    const double audio_ms{static_cast<double>(stats.frames) * capture.params.sample_count *
+                          1000.0 / std::max<u32>(capture.params.sample_rate, 1)};
+    fmt::print("Frames: {} ({:.1f} ms of audio), updates: {}\n", stats.frames, audio_ms,
+               stats.updates);
+    fmt::print("{:<12}{:>12}{:>18}\n", "Step", "Total (ms)", "Per frame (us)");
+    const auto print_step{[&](std::string_view name, std::chrono::nanoseconds time) {
+        fmt::print("{:<12}{:>12.2f}{:>18.2f}\n", name, Milliseconds(time),
+                   Milliseconds(time) * 1000.0 / frames);
+    }};
+    print_step("Update", stats.update_time);
+    print_step("Generate", stats.generate_time);
+    print_step("Process", stats.process_time);
+    print_step("Voice runs", stats.voice_runs_time);
+    if (stats.process_time.count() > 0) {
+        fmt::print("Processing runs {:.1f}x faster than real time\n",
+                   audio_ms / Milliseconds(stats.process_time));
+    }
+
+    std::vector<size_t> order(stats.command_counts.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::ranges::sort(order, [&](size_t lhs, size_t rhs) {
+        return stats.command_times[lhs] > stats.command_times[rhs];
+    });
+    const auto total{std::accumulate(stats.command_times.begin(), stats.command_times.end(),
+                                     std::chrono::nanoseconds{})};
+
+    fmt::print("\n{:<28}{:>10}{:>12}{:>14}{:>8}\n", "Command", "Count", "Total (ms)",
+               "Average (us)", "Share");
+    for (const size_t index : order) {
+        const u64 count{stats.command_counts[index]};
+        if (count == 0) {
+            continue;
+        }
+        const auto time{stats.command_times[index]};
+        fmt::print("{:<28}{:>10}{:>12.2f}{:>14.2f}{:>7.1f}%\n",
+                   GetCommandName(static_cast<CommandId>(index)), count, Milliseconds(time),
+                   Milliseconds(time) * 1000.0 / static_cast<double>(count),
+                   total.count() > 0 ? 100.0 * static_cast<double>(time.count()) /
+                                           static_cast<double>(total.count())
+                                     : 0.0);
+    }
+}
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    Common::Log::Initialize();
+    Common::Log::SetColorConsoleBackendEnabled(true);
+    Common::Log::Start();
+
+    Common::Log::Filter filter;
+    filter.ParseFilterString("*:Error");
+    Common::Log::SetGlobalFilter(filter);
+
+    u32 iterations{1};
+
+    static struct option long_options[] = {
+        // clang-format off
+        {"no-adpcm-cache", no_argument, 0, 'a'},
+        {"help", no_argument, 0, 'h'},
+        {"iterations", required_argument, 0, 'n'},
+        {"serial", no_argument, 0, 's'},
+        {0, 0, 0, 0},
+        // clang-format on
+    };
+    int option_index = 0;
+    int arg;
+    while ((arg = getopt_long(argc, argv, "ahn:s", long_options, &option_index)) != -1) {
+        switch (static_cast<char>(arg)) {
+        case 'a':
+            Settings::values.adpcm_decode_cache = false;
+            break;
+        case 'h':
+            PrintHelp(argv[0]);
+            return 0;
+        case 'n': {
+            const std::optional<u32> count{ParseCount(optarg)};
+            if (!count) {
+                PrintHelp(argv[0]);
+                return 1;
+            }
+            iterations = *count;
+            break;
+        }
+        case 's':
+            Settings::values.parallel_voice_decoding = false;
+            break;
+        default:
+            PrintHelp(argv[0]);
+            return 1;
+        }
+    }
+    if (optind == argc) {
+        PrintHelp(argv[0]);
+        return 1;
+    }
+
+    // Nothing is booted, the system only backs the replayed memory, timing and sink stream
+    Core::System system{};
+    system.Initialize();
+
+    int result{0};
+    for (int index = optind; index < argc; ++index) {
+        const std::filesystem::path filename{argv[index]};
+        const auto capture{AudioCore::Renderer::LoadRenderCapture(filename)};
+        if (!capture) {
+            std::cerr << argv[index] << " is not an audio renderer capture\n";
+            result = 1;
+            continue;
+        }
+        const auto stats{AudioCore::Renderer::ReplayRenderCapture(system, *capture, iterations)};
+        if (!stats) {
+            std::cerr << "Failed to replay " << argv[index] << '\n';
+            result = 1;
+            continue;
+        }
+        fmt::print("{}: title {:016X}, session {}, {} voices\n", argv[index],
+                   capture->program_id, capture->session_id, capture->params.voices);
+        PrintStatistics(*capture, *stats);
+        fmt::print("\n");
+    }
+
+    Common::Log::Stop();
+    return result;
+}
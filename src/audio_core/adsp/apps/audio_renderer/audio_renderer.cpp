@@ -10,6 +10,7 @@
 #include "audio_core/sink/sink.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -119,6 +120,10 @@ u64 AudioRenderer::GetRenderingStartTick(s32 session_id) const noexcept {
     return (1000 * command_buffers[session_id].render_time_taken_us) + signalled_tick;
 }
 
+const CommandProfile& AudioRenderer::GetCommandProfile(s32 session_id) const noexcept {
+    return command_profiles[session_id];
+}
+
 void AudioRenderer::CreateSinkStreams() {
     u32 channels{sink.GetDeviceChannels()};
     for (u32 i = 0; i < MaxRendererSessions; i++) {
@@ -178,6 +183,11 @@ void AudioRenderer::Main(std::stop_token stop_token) {
                         command_list_processor.Initialize(system, *command_buffer.process,
                                                           command_buffer.buffer,
                                                           command_buffer.size, streams[index]);
+                        command_list_processor.adpcm_cache =
+                            Settings::values.adpcm_decode_cache ? &adpcm_cache : nullptr;
+                        command_list_processor.profile =
+                            Settings::values.measured_voice_drop ? &command_profiles[index]
+                                                                 : nullptr;
                     }
 
                     if (command_buffer.reset_buffer && !buffers_reset[index]) {
@@ -10,6 +10,7 @@
 #include "audio_core/adsp/apps/audio_renderer/command_buffer.h"
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/adsp/mailbox.h"
+#include "audio_core/renderer/command/data_source/adpcm_decode_cache.h"
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 #include "common/reader_writer_queue.h"
@@ -78,6 +79,7 @@ public:
     u32 GetRemainCommandCount(s32 session_id) const noexcept;
     void ClearRemainCommandCount(s32 session_id) noexcept;
     u64 GetRenderingStartTick(s32 session_id) const noexcept;
+    const CommandProfile& GetCommandProfile(s32 session_id) const noexcept;
 
 private:
     /**
@@ -108,6 +110,10 @@ private:
     std::array<CommandListProcessor, MaxRendererSessions> command_list_processors{};
     /// The streams which will receive the processed samples
     std::array<Sink::SinkStream*, MaxRendererSessions> streams{};
+    /// Measured processing times of each session's commands, when voices are dropped by them
+    std::array<CommandProfile, MaxRendererSessions> command_profiles{};
+    /// Decoded ADPCM samples, shared by the sessions
+    Renderer::AdpcmDecodeCache adpcm_cache{};
     /// CPU Tick when the DSP was signalled to process, uses time rather than tick
     u64 signalled_tick{0};
 };
@@ -1,23 +1,85 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
+#include <optional>
 #include <string>
 
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/renderer/command/command_list_header.h"
 #include "audio_core/renderer/command/commands.h"
 #include "common/settings.h"
+#include "common/task_pool.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/memory.h"
 
 namespace AudioCore::ADSP::AudioRenderer {
+namespace {
+
+Common::TaskGroup& GetWorkers() {
+    // The renderer waits for the voices to meet its deadline, spread over as many threads as the
+    // dedicated workers it used to have
+    static Common::TaskGroup workers{Common::TaskPriority::LatencyCritical, 3};
+    return workers;
+}
+
+/// Returns the mix buffer a data source command decodes into, or nullopt for other commands
+std::optional<s16> GetDataSourceOutput(const Renderer::ICommand& command) {
+    using namespace Renderer;
+    switch (command.type) {
+    case CommandId::DataSourcePcmInt16Version1:
+        return static_cast<const PcmInt16DataSourceVersion1Command&>(command).output_index;
+    case CommandId::DataSourcePcmInt16Version2:
+        return static_cast<const PcmInt16DataSourceVersion2Command&>(command).output_index;
+    case CommandId::DataSourcePcmFloatVersion1:
+        return static_cast<const PcmFloatDataSourceVersion1Command&>(command).output_index;
+    case CommandId::DataSourcePcmFloatVersion2:
+        return static_cast<const PcmFloatDataSourceVersion2Command&>(command).output_index;
+    case CommandId::DataSourceAdpcmVersion1:
+        return static_cast<const AdpcmDataSourceVersion1Command&>(command).output_index;
+    case CommandId::DataSourceAdpcmVersion2:
+        return static_cast<const AdpcmDataSourceVersion2Command&>(command).output_index;
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Returns true if the command only reads and writes the given mix buffer, like voice filters do
+bool ProcessesBufferInPlace(const Renderer::ICommand& command, s16 buffer_index) {
+    using namespace Renderer;
+    switch (command.type) {
+    case CommandId::BiquadFilter: {
+        const auto& biquad{static_cast<const BiquadFilterCommand&>(command)};
+        return biquad.input == buffer_index && biquad.output == buffer_index;
+    }
+    case CommandId::MultiTapBiquadFilter: {
+        const auto& biquad{static_cast<const MultiTapBiquadFilterCommand&>(command)};
+        return biquad.input == buffer_index && biquad.output == buffer_index;
+    }
+    case CommandId::VolumeRamp: {
+        const auto& volume{static_cast<const VolumeRampCommand&>(command)};
+        return volume.input_index == buffer_index && volume.output_index == buffer_index;
+    }
+    default:
+        return false;
+    }
+}
+
+} // Anonymous namespace
 
 void CommandListProcessor::Initialize(Core::System& system_, Kernel::KProcess& process,
                                       CpuAddr buffer, u64 size, Sink::SinkStream* stream_) {
+    Initialize(system_, process.GetMemory(), buffer, size, stream_);
+}
+
+void CommandListProcessor::Initialize(Core::System& system_, Core::Memory::Memory& memory_,
+                                      CpuAddr buffer, u64 size, Sink::SinkStream* stream_) {
     system = &system_;
-    memory = &process.GetMemory();
+    memory = &memory_;
     stream = stream_;
     header = reinterpret_cast<Renderer::CommandListHeader*>(buffer);
     commands = reinterpret_cast<u8*>(buffer + sizeof(Renderer::CommandListHeader));
@@ -53,6 +115,17 @@ u64 CommandListProcessor::Process(u32 session_id) {
         current_processing_time = 0;
     }
 
+    command_voice_runs.clear();
+    if (processed_command_count == 0 && Settings::values.parallel_voice_decoding) {
+        const auto voice_runs_start{std::chrono::steady_clock::now()};
+        ProcessVoiceRuns();
+        if (profile) {
+            profile->voice_runs_time += static_cast<u64>(
+                std::chrono::nanoseconds(std::chrono::steady_clock::now() - voice_runs_start)
+                    .count());
+        }
+    }
+
     std::string dump{fmt::format("\nSession {}\n", session_id)};
 
     for (u32 index = 0; index < command_count; index++) {
@@ -82,12 +155,22 @@ u64 CommandListProcessor::Process(u32 session_id) {
             break;
         }
 
+        const s32 voice_run{command_voice_runs.empty() ? -1 : command_voice_runs[index]};
         if (command.enabled) {
-            command.Process(*this);
+            if (voice_run < 0) {
+                ProcessCommand(command);
+            }
         } else {
             dump += fmt::format("\tDisabled!\n");
         }
 
+        if (voice_run >= 0 && voice_runs[voice_run].last_command == index) {
+            const auto& run{voice_runs[voice_run]};
+            std::ranges::copy(
+                std::span(voice_samples).subspan(run.samples_offset, sample_count),
+                mix_buffers.subspan(run.buffer_index * sample_count, sample_count).begin());
+        }
+
         processed_command_count++;
         commands += command.size;
     }
@@ -101,4 +184,106 @@ u64 CommandListProcessor::Process(u32 session_id) {
     return end_time - start_time_;
 }
 
+void CommandListProcessor::ProcessVoiceRuns() {
+    voice_runs.clear();
+    command_voice_runs.assign(command_count, -1);
+
+    // Stop where Process would, so no voice is decoded when the list doesn't reach it
+    const auto command_base{CpuAddr(commands)};
+    auto* command_ptr{commands};
+    bool run_open{false};
+    for (u32 index = 0; index < command_count; index++) {
+        auto& command{*reinterpret_cast<Renderer::ICommand*>(command_ptr)};
+        if (command.magic != Renderer::CommandMagic ||
+            CpuAddr(command_ptr) - command_base + command.size > commands_buffer_size ||
+            !command.Verify(*this)) {
+            break;
+        }
+        command_ptr += command.size;
+
+        if (const auto output{GetDataSourceOutput(command)};
+            output && *output >= 0 && command.enabled) {
+            voice_runs.push_back({
+                .commands{},
+                .last_command = index,
+                .buffer_index = *output,
+                .samples_offset = 0,
+            });
+            run_open = true;
+        } else if (command.type == Renderer::CommandId::Performance) {
+            // Timing the voice doesn't end its run, the command still runs in order
+            continue;
+        } else if (!run_open || !ProcessesBufferInPlace(command, voice_runs.back().buffer_index)) {
+            run_open = false;
+            continue;
+        }
+
+        auto& run{voice_runs.back()};
+        if (command.enabled) {
+            run.commands.push_back(&command);
+        }
+        run.last_command = index;
+        command_voice_runs[index] = static_cast<s32>(voice_runs.size() - 1);
+    }
+
+    if (voice_runs.size() < 2) {
+        voice_runs.clear();
+        command_voice_runs.clear();
+        return;
+    }
+
+    // Runs see their own buffer at the index they decode into. The rest of their view of the mix
+    // buffers overlaps the buffers of other runs, but they never touch it.
+    s16 max_buffer_index{0};
+    for (const auto& run : voice_runs) {
+        max_buffer_index = std::max(max_buffer_index, run.buffer_index);
+    }
+    voice_samples.resize((voice_runs.size() + max_buffer_index) * sample_count);
+    for (size_t i = 0; i < voice_runs.size(); i++) {
+        voice_runs[i].samples_offset = (i + max_buffer_index) * sample_count;
+    }
+
+    Common::ParallelForEach(GetWorkers(), voice_runs.size(), [this](size_t run_index) {
+        const auto& run{voice_runs[run_index]};
+        const auto view_offset{run.samples_offset - run.buffer_index * sample_count};
+
+        CommandListProcessor processor{};
+        processor.system = system;
+        processor.memory = memory;
+        processor.stream = stream;
+        processor.header = header;
+        processor.sample_count = sample_count;
+        processor.target_sample_rate = target_sample_rate;
+        processor.buffer_count = buffer_count;
+        processor.adpcm_cache = adpcm_cache;
+        processor.profile = profile;
+        processor.mix_buffers = std::span(voice_samples)
+                                    .subspan(view_offset, (run.buffer_index + 1) * sample_count);
+
+        // Data sources leave the buffer as is when their voice can't be decoded
+        std::ranges::fill(std::span(voice_samples).subspan(run.samples_offset, sample_count), 0);
+        for (auto* command : run.commands) {
+            processor.ProcessCommand(*command);
+        }
+    });
+}
+
+void CommandListProcessor::ProcessCommand(Renderer::ICommand& command) {
+    if (!profile) {
+        command.Process(*this);
+        return;
+    }
+
+    const auto start{std::chrono::steady_clock::now()};
+    command.Process(*this);
+    const auto time{std::chrono::nanoseconds(std::chrono::steady_clock::now() - start)};
+
+    const auto type{static_cast<size_t>(command.type)};
+    if (type < CommandIdCount) {
+        profile->counts[type]++;
+        profile->times[type] += static_cast<u64>(time.count());
+        profile->estimates[type] += command.estimated_process_time;
+    }
+}
+
 } // namespace AudioCore::ADSP::AudioRenderer
@@ -3,10 +3,15 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <span>
+#include <string>
+#include <vector>
 
 #include "audio_core/common/common.h"
 #include "audio_core/renderer/command/command_list_header.h"
+#include "audio_core/renderer/command/icommand.h"
 #include "common/common_types.h"
 
 namespace Core {
@@ -26,11 +31,31 @@ class SinkStream;
 }
 
 namespace Renderer {
+class AdpcmDecodeCache;
 struct CommandListHeader;
-}
+struct ICommand;
+} // namespace Renderer
 
 namespace ADSP::AudioRenderer {
 
+/// Number of command types
+constexpr size_t CommandIdCount{static_cast<size_t>(Renderer::CommandId::Compressor) + 1};
+
+/**
+ * Time spent processing each type of command, filled in by processors given one. Commands of
+ * voice runs are timed on the workers processing them, so their times add up across threads.
+ */
+struct CommandProfile {
+    /// Number of commands processed, by type
+    std::array<std::atomic<u64>, CommandIdCount> counts{};
+    /// Nanoseconds spent processing them, by type
+    std::array<std::atomic<u64>, CommandIdCount> times{};
+    /// Sum of the estimated processing times of those commands, by type
+    std::array<std::atomic<u64>, CommandIdCount> estimates{};
+    /// Nanoseconds spent waiting for the voice runs, processed ahead of the list
+    std::atomic<u64> voice_runs_time{};
+};
+
 /**
  * A processor for command lists given to the AudioRenderer.
  */
@@ -47,6 +72,19 @@ public:
     void Initialize(Core::System& system, Kernel::KProcess& process, CpuAddr buffer, u64 size,
                     Sink::SinkStream* stream);
 
+    /**
+     * Initialize the processor, reading and writing guest memory through the given memory
+     * rather than a process'.
+     *
+     * @param system - The core system.
+     * @param memory - Memory the commands access.
+     * @param buffer - The command buffer to process.
+     * @param size   - The size of the buffer.
+     * @param stream - The stream to be used for sending the samples.
+     */
+    void Initialize(Core::System& system, Core::Memory::Memory& memory, CpuAddr buffer, u64 size,
+                    Sink::SinkStream* stream);
+
     /**
      * Set the maximum processing time for this command list.
      *
@@ -111,6 +149,41 @@ public:
     u64 end_time{};
     /// Last command list string generated, used for dumping audio commands to console
     std::string last_dump{};
+    /// Cache of decoded ADPCM samples, null when disabled
+    Renderer::AdpcmDecodeCache* adpcm_cache{};
+    /// Times of the processed commands, null when not profiling
+    CommandProfile* profile{};
+
+private:
+    /// Process a single command, timing it when profiling
+    void ProcessCommand(Renderer::ICommand& command);
+
+    /// Commands processing one voice channel into its own mix buffer, before it's mixed
+    struct VoiceRun {
+        /// Enabled commands of the run, in order
+        std::vector<Renderer::ICommand*> commands;
+        /// Index of the last command of the run in the list
+        u32 last_command;
+        /// Mix buffer the voice channel is decoded into
+        s16 buffer_index;
+        /// Offset of the run's samples in voice_samples
+        size_t samples_offset;
+    };
+
+    /**
+     * Find the voice runs of the command list and process them in parallel, ahead of the rest of
+     * the list, each into its own buffer. Voice runs don't depend on each other, they only touch
+     * their voice's state and the mix buffer they decode into, which is copied into the mix
+     * buffers once the list reaches the end of the run.
+     */
+    void ProcessVoiceRuns();
+
+    /// Voice runs processed ahead of the command list
+    std::vector<VoiceRun> voice_runs{};
+    /// Index of the voice run each command belongs to, or -1. Empty when there are none.
+    std::vector<s32> command_voice_runs{};
+    /// Samples decoded by the voice runs
+    std::vector<s32> voice_samples{};
 };
 
 } // namespace ADSP::AudioRenderer
@@ -3,6 +3,9 @@
 
 #include <array>
 #include <chrono>
+#include <cstring>
+
+#include <fmt/format.h>
 
 #include "audio_core/adsp/apps/opus/opus_decode_object.h"
 #include "audio_core/adsp/apps/opus/opus_multistream_decode_object.h"
@@ -11,6 +14,7 @@
 #include "audio_core/common/common.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/swap.h"
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -21,6 +25,8 @@ namespace AudioCore::ADSP::OpusDecoder {
 
 namespace {
 constexpr size_t OpusStreamCountMax = 255;
+/// Packets of a batch are framed like hwopus input, a big endian size and final range first
+constexpr u64 OpusPacketHeaderSize = 8;
 
 bool IsValidChannelCount(u32 channel_count) {
     return channel_count == 1 || channel_count == 2;
@@ -34,6 +40,75 @@ bool IsValidMultiStreamStreamCounts(s32 total_stream_count, s32 stereo_stream_co
     return IsValidMultiStreamChannelCount(total_stream_count) && total_stream_count > 0 &&
            stereo_stream_count >= 0 && stereo_stream_count <= total_stream_count;
 }
+
+/*
+ * Decodes the packets of a batch one after the other into the output, in a single round trip
+ * with the host. The host has already checked the framing of every packet. When the output has no
+ * room left for the next packet, the batch ends early and the remaining packets are left for the
+ * next request. Running out of room before the first packet is an error, like a single decode.
+ */
+template <typename DecodeObject>
+void DecodeBatch(Core::System& system, SharedMemory& shared_memory) {
+    auto start_time = system.CoreTiming().GetGlobalTimeUs();
+
+    auto buffer = shared_memory.host_send_data[0];
+    auto input_data = shared_memory.host_send_data[1];
+    auto input_data_size = shared_memory.host_send_data[2];
+    auto output_data = shared_memory.host_send_data[3];
+    auto output_data_size = shared_memory.host_send_data[4];
+    auto packet_count = static_cast<u32>(shared_memory.host_send_data[5]);
+    auto reset_requested = shared_memory.host_send_data[6];
+    auto channel_count = shared_memory.host_send_data[7];
+
+    const u64 frame_size{channel_count * sizeof(s16)};
+    u64 input_offset{0};
+    u64 output_offset{0};
+    u32 decoded_packets{0};
+    u64 decoded_samples{0};
+
+    auto& decoder_object = DecodeObject::Initialize(buffer, buffer);
+    s32 error_code{OPUS_OK};
+    if (reset_requested) {
+        error_code = decoder_object.ResetDecoder();
+    }
+
+    while (error_code == OPUS_OK && decoded_packets < packet_count) {
+        u32 packet_size{};
+        std::memcpy(&packet_size, reinterpret_cast<const void*>(input_data + input_offset),
+                    sizeof(packet_size));
+        packet_size = Common::swap32(packet_size);
+        ASSERT(input_offset + OpusPacketHeaderSize + packet_size <= input_data_size);
+
+        const u64 output_frames{(output_data_size - output_offset) / frame_size};
+        if (output_frames == 0 && decoded_packets > 0) {
+            break;
+        }
+
+        // libopus checks the output has room for the packet before touching the decoder state
+        u32 packet_samples{0};
+        error_code = decoder_object.Decode(packet_samples, output_data + output_offset,
+                                           output_frames,
+                                           input_data + input_offset + OpusPacketHeaderSize,
+                                           packet_size);
+        if (error_code == OPUS_BUFFER_TOO_SMALL && decoded_packets > 0) {
+            error_code = OPUS_OK;
+            break;
+        }
+
+        if (error_code == OPUS_OK) {
+            input_offset += OpusPacketHeaderSize + packet_size;
+            output_offset += packet_samples * frame_size;
+            decoded_samples += packet_samples;
+            decoded_packets++;
+        }
+    }
+
+    auto end_time = system.CoreTiming().GetGlobalTimeUs();
+    shared_memory.dsp_return_data[0] = error_code;
+    shared_memory.dsp_return_data[1] = decoded_samples;
+    shared_memory.dsp_return_data[2] = (end_time - start_time).count();
+    shared_memory.dsp_return_data[3] = decoded_packets;
+}
 } // namespace
 
 OpusDecoder::OpusDecoder(Core::System& system_) : system{system_} {
@@ -46,22 +121,24 @@ OpusDecoder::~OpusDecoder() {
         return;
     }
 
-    // Shutdown the thread
-    Send(Direction::DSP, Message::Shutdown);
-    auto msg = Receive(Direction::Host);
-    ASSERT_MSG(msg == Message::ShutdownOK, "Expected Opus shutdown code {}, got {}",
-               Message::ShutdownOK, msg);
-    main_thread.request_stop();
-    main_thread.join();
+    // Shutdown the threads
+    for (size_t worker = 0; worker < DecodeWorkerCount; worker++) {
+        Send(Direction::DSP, Message::Shutdown, worker);
+        auto msg = Receive(Direction::Host, {}, worker);
+        ASSERT_MSG(msg == Message::ShutdownOK, "Expected Opus shutdown code {}, got {}",
+                   Message::ShutdownOK, msg);
+        main_threads[worker].request_stop();
+        main_threads[worker].join();
+    }
     running = false;
 }
 
-void OpusDecoder::Send(Direction dir, u32 message) {
-    mailbox.Send(dir, std::move(message));
+void OpusDecoder::Send(Direction dir, u32 message, size_t worker) {
+    mailboxes[worker].Send(dir, std::move(message));
 }
 
-u32 OpusDecoder::Receive(Direction dir, std::stop_token stop_token) {
-    return mailbox.Receive(dir, stop_token);
+u32 OpusDecoder::Receive(Direction dir, std::stop_token stop_token, size_t worker) {
+    return mailboxes[worker].Receive(dir, stop_token);
 }
 
 void OpusDecoder::Init(std::stop_token stop_token) {
@@ -72,19 +149,25 @@ void OpusDecoder::Init(std::stop_token stop_token) {
                   "DSP OpusDecoder failed to receive Start message. Opus initialization failed.");
         return;
     }
-    main_thread = std::jthread([this](std::stop_token st) { Main(st); });
+    for (size_t worker = 0; worker < DecodeWorkerCount; worker++) {
+        main_threads[worker] =
+            std::jthread([this, worker](std::stop_token st) { Main(st, worker); });
+    }
     running = true;
     Send(Direction::Host, Message::StartOK);
 }
 
-void OpusDecoder::Main(std::stop_token stop_token) {
-    Common::SetCurrentThreadName("DSP_OpusDecoder_Main");
+void OpusDecoder::Main(std::stop_token stop_token, size_t worker) {
+    const auto thread_name{fmt::format("DSP_OpusDecoder_Main{}", worker)};
+    Common::SetCurrentThreadName(thread_name.c_str());
+
+    auto* shared_memory = shared_memories[worker];
 
     while (!stop_token.stop_requested()) {
-        auto msg = Receive(Direction::DSP, stop_token);
+        auto msg = Receive(Direction::DSP, stop_token, worker);
         switch (msg) {
         case Shutdown:
-            Send(Direction::Host, Message::ShutdownOK);
+            Send(Direction::Host, Message::ShutdownOK, worker);
             return;
 
         case GetWorkBufferSize: {
@@ -93,7 +176,7 @@ void OpusDecoder::Main(std::stop_token stop_token) {
             ASSERT(IsValidChannelCount(channel_count));
 
             shared_memory->dsp_return_data[0] = OpusDecodeObject::GetWorkBufferSize(channel_count);
-            Send(Direction::Host, Message::GetWorkBufferSizeOK);
+            Send(Direction::Host, Message::GetWorkBufferSizeOK, worker);
         } break;
 
         case InitializeDecodeObject: {
@@ -110,7 +193,7 @@ void OpusDecoder::Main(std::stop_token stop_token) {
             shared_memory->dsp_return_data[0] =
                 decoder_object.InitializeDecoder(sample_rate, channel_count);
 
-            Send(Direction::Host, Message::InitializeDecodeObjectOK);
+            Send(Direction::Host, Message::InitializeDecodeObjectOK, worker);
         } break;
 
         case ShutdownDecodeObject: {
@@ -120,7 +203,7 @@ void OpusDecoder::Main(std::stop_token stop_token) {
             auto& decoder_object = OpusDecodeObject::Initialize(buffer, buffer);
             shared_memory->dsp_return_data[0] = decoder_object.Shutdown();
 
-            Send(Direction::Host, Message::ShutdownDecodeObjectOK);
+            Send(Direction::Host, Message::ShutdownDecodeObjectOK, worker);
         } break;
 
         case DecodeInterleaved: {
@@ -158,19 +241,19 @@ void OpusDecoder::Main(std::stop_token stop_token) {
             shared_memory->dsp_return_data[1] = decoded_samples;
             shared_memory->dsp_return_data[2] = (end_time - start_time).count();
 
-            Send(Direction::Host, Message::DecodeInterleavedOK);
+            Send(Direction::Host, Message::DecodeInterleavedOK, worker);
         } break;
 
         case MapMemory: {
             [[maybe_unused]] auto buffer = shared_memory->host_send_data[0];
             [[maybe_unused]] auto buffer_size = shared_memory->host_send_data[1];
-            Send(Direction::Host, Message::MapMemoryOK);
+            Send(Direction::Host, Message::MapMemoryOK, worker);
         } break;
 
         case UnmapMemory: {
             [[maybe_unused]] auto buffer = shared_memory->host_send_data[0];
             [[maybe_unused]] auto buffer_size = shared_memory->host_send_data[1];
-            Send(Direction::Host, Message::UnmapMemoryOK);
+            Send(Direction::Host, Message::UnmapMemoryOK, worker);
         } break;
 
         case GetWorkBufferSizeForMultiStream: {
@@ -181,7 +264,7 @@ void OpusDecoder::Main(std::stop_token stop_token) {
 
             shared_memory->dsp_return_data[0] = OpusMultiStreamDecodeObject::GetWorkBufferSize(
                 total_stream_count, stereo_stream_count);
-            Send(Direction::Host, Message::GetWorkBufferSizeForMultiStreamOK);
+            Send(Direction::Host, Message::GetWorkBufferSizeForMultiStreamOK, worker);
         } break;
 
         case InitializeMultiStreamDecodeObject: {
@@ -208,7 +291,7 @@ void OpusDecoder::Main(std::stop_token stop_token) {
             shared_memory->dsp_return_data[0] = decoder_object.InitializeDecoder(
                 sample_rate, total_stream_count, channel_count, stereo_stream_count, mappings);
 
-            Send(Direction::Host, Message::InitializeMultiStreamDecodeObjectOK);
+            Send(Direction::Host, Message::InitializeMultiStreamDecodeObjectOK, worker);
         } break;
 
         case ShutdownMultiStreamDecodeObject: {
@@ -218,7 +301,7 @@ void OpusDecoder::Main(std::stop_token stop_token) {
             auto& decoder_object = OpusMultiStreamDecodeObject::Initialize(buffer, buffer);
             shared_memory->dsp_return_data[0] = decoder_object.Shutdown();
 
-            Send(Direction::Host, Message::ShutdownMultiStreamDecodeObjectOK);
+            Send(Direction::Host, Message::ShutdownMultiStreamDecodeObjectOK, worker);
         } break;
 
         case DecodeInterleavedForMultiStream: {
@@ -256,7 +339,17 @@ void OpusDecoder::Main(std::stop_token stop_token) {
             shared_memory->dsp_return_data[1] = decoded_samples;
             shared_memory->dsp_return_data[2] = (end_time - start_time).count();
 
-            Send(Direction::Host, Message::DecodeInterleavedForMultiStreamOK);
+            Send(Direction::Host, Message::DecodeInterleavedForMultiStreamOK, worker);
+        } break;
+
+        case DecodeInterleavedBatch: {
+            DecodeBatch<OpusDecodeObject>(system, *shared_memory);
+            Send(Direction::Host, Message::DecodeInterleavedBatchOK, worker);
+        } break;
+
+        case DecodeInterleavedForMultiStreamBatch: {
+            DecodeBatch<OpusMultiStreamDecodeObject>(system, *shared_memory);
+            Send(Direction::Host, Message::DecodeInterleavedForMultiStreamBatchOK, worker);
         } break;
 
         default:
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <thread>
 
@@ -32,6 +33,8 @@ enum Message : u32 {
     InitializeMultiStreamDecodeObject = 28,
     ShutdownMultiStreamDecodeObject = 29,
     DecodeInterleavedForMultiStream = 30,
+    DecodeInterleavedBatch = 31,
+    DecodeInterleavedForMultiStreamBatch = 32,
 
     GetWorkBufferSizeOK = 41,
     InitializeDecodeObjectOK = 42,
@@ -43,8 +46,14 @@ enum Message : u32 {
     InitializeMultiStreamDecodeObjectOK = 48,
     ShutdownMultiStreamDecodeObjectOK = 49,
     DecodeInterleavedForMultiStreamOK = 50,
+    DecodeInterleavedBatchOK = 51,
+    DecodeInterleavedForMultiStreamBatchOK = 52,
 };
 
+/// Number of decode workers. Each one has its own mailbox, shared memory and thread, so decode
+/// objects driven through different workers are decoded at the same time.
+constexpr size_t DecodeWorkerCount = 4;
+
 /**
  * The AudioRenderer application running on the ADSP.
  */
@@ -57,11 +66,11 @@ public:
         return running;
     }
 
-    void Send(Direction dir, u32 message);
-    u32 Receive(Direction dir, std::stop_token stop_token = {});
+    void Send(Direction dir, u32 message, size_t worker = 0);
+    u32 Receive(Direction dir, std::stop_token stop_token = {}, size_t worker = 0);
 
-    void SetSharedMemory(SharedMemory& shared_memory_) {
-        shared_memory = &shared_memory_;
+    void SetSharedMemory(SharedMemory& shared_memory_, size_t worker = 0) {
+        shared_memories[worker] = &shared_memory_;
     }
 
 private:
@@ -70,23 +79,25 @@ private:
      */
     void Init(std::stop_token stop_token);
     /**
-     * Main OpusDecoder thread, responsible for processing the incoming Opus packets.
+     * Main thread of a decode worker, responsible for processing the incoming Opus packets.
+     *
+     * @param worker - Index of the worker, selects its mailbox and shared memory.
      */
-    void Main(std::stop_token stop_token);
+    void Main(std::stop_token stop_token, size_t worker);
 
     /// Core system
     Core::System& system;
-    /// Mailbox to communicate messages with the host, drives the main thread
-    Mailbox mailbox;
+    /// Mailboxes to communicate messages with the host, one per worker, drive the main threads
+    std::array<Mailbox, DecodeWorkerCount> mailboxes;
     /// Init thread
     std::jthread init_thread{};
-    /// Main thread
-    std::jthread main_thread{};
+    /// Main threads, one per worker
+    std::array<std::jthread, DecodeWorkerCount> main_threads{};
     /// The current state
     bool running{};
-    /// Structure shared with the host, input data set by the host before sending a mailbox message,
-    /// and the responses are written back by the OpusDecoder.
-    SharedMemory* shared_memory{};
+    /// Structures shared with the host, one per worker. Input data set by the host before sending
+    /// a mailbox message, and the responses are written back by the OpusDecoder.
+    std::array<SharedMemory*, DecodeWorkerCount> shared_memories{};
 };
 
 } // namespace AudioCore::ADSP::OpusDecoder
@@ -41,6 +41,8 @@ Result DeviceSession::Initialize(std::string_view name_, SampleFormat sample_for
     handle = handle_;
     handle->Open();
     applet_resource_user_id = applet_resource_user_id_;
+    stream_base_timestamp.reset();
+    in_place_end_timestamp = 0;
 
     if (type == Sink::StreamType::In) {
         sink = &system.AudioCore().GetInputSink();
@@ -93,16 +95,31 @@ void DeviceSession::AppendBuffers(std::span<const AudioBuffer> buffers) {
             .frames_played = 0,
             .tag = buffer.tag,
             .consumed = false,
+            .samples = nullptr,
         };
+        if (!stream_base_timestamp) {
+            stream_base_timestamp = buffer.start_timestamp;
+        }
 
-        tmp_samples.resize_destructive(buffer.size / sizeof(s16));
         if (type == Sink::StreamType::In) {
+            tmp_samples.resize_destructive(buffer.size / sizeof(s16));
             stream->AppendBuffer(new_buffer, tmp_samples);
-        } else {
-            Core::Memory::CpuGuestMemory<s16, Core::Memory::GuestMemoryFlags::UnsafeRead> samples(
-                handle->GetMemory(), buffer.samples, buffer.size / sizeof(s16));
-            stream->AppendBuffer(new_buffer, samples);
+            continue;
+        }
+
+        // Buffers contiguous in host memory are played straight from the guest's memory, which
+        // stays mapped while the session holds the process open
+        if (const u8* ptr{handle->GetMemory().GetSpan(buffer.samples, buffer.size)}) {
+            const std::span samples{reinterpret_cast<const s16*>(ptr), buffer.size / sizeof(s16)};
+            if (stream->AppendBufferInPlace(new_buffer, samples)) {
+                in_place_end_timestamp.store(buffer.end_timestamp, std::memory_order_release);
+                continue;
+            }
         }
+
+        Core::Memory::CpuGuestMemory<s16, Core::Memory::GuestMemoryFlags::UnsafeRead> samples(
+            handle->GetMemory(), buffer.samples, buffer.size / sizeof(s16));
+        stream->AppendBuffer(new_buffer, samples);
     }
 }
 
@@ -114,7 +131,16 @@ void DeviceSession::ReleaseBuffer(const AudioBuffer& buffer) const {
 }
 
 bool DeviceSession::IsBufferConsumed(const AudioBuffer& buffer) const {
-    return played_sample_count >= buffer.end_timestamp;
+    if (played_sample_count < buffer.end_timestamp) {
+        return false;
+    }
+
+    // The played sample count runs ahead of the sink, buffers it reads in place (and the ones
+    // queued before them) are only handed back once it has read them
+    if (buffer.end_timestamp > in_place_end_timestamp.load(std::memory_order_acquire)) {
+        return true;
+    }
+    return stream->GetReadFrameCount() >= buffer.end_timestamp - *stream_base_timestamp;
 }
 
 void DeviceSession::SetVolume(f32 volume) const {
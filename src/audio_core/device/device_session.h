@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <optional>
@@ -153,6 +154,10 @@ private:
     bool initialized{};
     /// Temporary sample buffer
     Common::ScratchBuffer<s16> tmp_samples{};
+    /// Timestamp of the first buffer appended to the stream, where its read frame count starts
+    std::optional<u64> stream_base_timestamp{};
+    /// End timestamp of the last buffer the stream reads in place, 0 if none
+    std::atomic<u64> in_place_end_timestamp{};
 };
 
 } // namespace AudioCore
@@ -5,6 +5,7 @@
 #include "audio_core/opus/hardware_opus.h"
 #include "audio_core/opus/parameters.h"
 #include "common/alignment.h"
+#include "common/logging/log.h"
 #include "common/swap.h"
 #include "core/core.h"
 
@@ -17,14 +18,25 @@ OpusPacketHeader ReverseHeader(OpusPacketHeader header) {
     out.final_range = Common::swap32(header.final_range);
     return out;
 }
+
+OpusPacketHeader ReadHeader(std::span<const u8> input_data, u64 offset) {
+    OpusPacketHeader header;
+    std::memcpy(&header, input_data.data() + offset, sizeof(OpusPacketHeader));
+    return ReverseHeader(header);
+}
 } // namespace
 
 OpusDecoder::OpusDecoder(Core::System& system_, HardwareOpus& hardware_opus_)
-    : system{system_}, hardware_opus{hardware_opus_} {}
+    : system{system_}, hardware_opus{hardware_opus_}, worker{hardware_opus.AcquireWorker()} {}
 
 OpusDecoder::~OpusDecoder() {
     if (decode_object_initialized) {
-        hardware_opus.ShutdownDecodeObject(shared_buffer.get(), shared_buffer_size);
+        hardware_opus.ShutdownDecodeObject(worker, shared_buffer.get(), shared_buffer_size);
+        LOG_DEBUG(Service_Audio, "Decoded {} packets, {} samples in {}us", statistics.packet_count,
+                  statistics.sample_count, statistics.time_taken);
+    }
+    if (shared_buffer) {
+        hardware_opus.ReleaseWorkBuffer(std::move(shared_buffer), shared_buffer_size);
     }
 }
 
@@ -32,7 +44,7 @@ Result OpusDecoder::Initialize(const OpusParametersEx& params,
                                Kernel::KTransferMemory* transfer_memory, u64 transfer_memory_size) {
     auto frame_size{params.use_large_frame_size ? 5760 : 1920};
     shared_buffer_size = transfer_memory_size;
-    shared_buffer = std::make_unique<u8[]>(shared_buffer_size);
+    shared_buffer = hardware_opus.AcquireWorkBuffer(shared_buffer_size);
     shared_memory_mapped = true;
 
     buffer_size =
@@ -45,11 +57,12 @@ Result OpusDecoder::Initialize(const OpusParametersEx& params,
     ON_RESULT_FAILURE {
         if (shared_memory_mapped) {
             shared_memory_mapped = false;
-            ASSERT(R_SUCCEEDED(hardware_opus.UnmapMemory(shared_buffer.get(), shared_buffer_size)));
+            ASSERT(R_SUCCEEDED(
+                hardware_opus.UnmapMemory(worker, shared_buffer.get(), shared_buffer_size)));
         }
     };
 
-    R_TRY(hardware_opus.InitializeDecodeObject(params.sample_rate, params.channel_count,
+    R_TRY(hardware_opus.InitializeDecodeObject(worker, params.sample_rate, params.channel_count,
                                                shared_buffer.get(), shared_buffer_size));
 
     sample_rate = params.sample_rate;
@@ -63,7 +76,7 @@ Result OpusDecoder::Initialize(const OpusMultiStreamParametersEx& params,
                                Kernel::KTransferMemory* transfer_memory, u64 transfer_memory_size) {
     auto frame_size{params.use_large_frame_size ? 5760 : 1920};
     shared_buffer_size = transfer_memory_size;
-    shared_buffer = std::make_unique<u8[]>(shared_buffer_size);
+    shared_buffer = hardware_opus.AcquireWorkBuffer(shared_buffer_size);
     shared_memory_mapped = true;
 
     buffer_size =
@@ -76,12 +89,13 @@ Result OpusDecoder::Initialize(const OpusMultiStreamParametersEx& params,
     ON_RESULT_FAILURE {
         if (shared_memory_mapped) {
             shared_memory_mapped = false;
-            ASSERT(R_SUCCEEDED(hardware_opus.UnmapMemory(shared_buffer.get(), shared_buffer_size)));
+            ASSERT(R_SUCCEEDED(
+                hardware_opus.UnmapMemory(worker, shared_buffer.get(), shared_buffer_size)));
         }
     };
 
     R_TRY(hardware_opus.InitializeMultiStreamDecodeObject(
-        params.sample_rate, params.channel_count, params.total_stream_count,
+        worker, params.sample_rate, params.channel_count, params.total_stream_count,
         params.stereo_stream_count, params.mappings.data(), shared_buffer.get(),
         shared_buffer_size));
 
@@ -110,15 +124,15 @@ Result OpusDecoder::DecodeInterleaved(u32* out_data_size, u64* out_time_taken,
              ResultBufferTooSmall);
 
     if (!shared_memory_mapped) {
-        R_TRY(hardware_opus.MapMemory(shared_buffer.get(), shared_buffer_size));
+        R_TRY(hardware_opus.MapMemory(worker, shared_buffer.get(), shared_buffer_size));
         shared_memory_mapped = true;
     }
 
     std::memcpy(in_data.data(), input_data.data() + sizeof(OpusPacketHeader), header.size);
 
-    R_TRY(hardware_opus.DecodeInterleaved(out_samples, out_data.data(), out_data.size_bytes(),
-                                          channel_count, in_data.data(), header.size,
-                                          shared_buffer.get(), time_taken, reset));
+    R_TRY(hardware_opus.DecodeInterleaved(worker, out_samples, out_data.data(),
+                                          out_data.size_bytes(), channel_count, in_data.data(),
+                                          header.size, shared_buffer.get(), time_taken, reset));
 
     std::memcpy(output_data.data(), out_data.data(), out_samples * channel_count * sizeof(s16));
 
@@ -127,13 +141,14 @@ Result OpusDecoder::DecodeInterleaved(u32* out_data_size, u64* out_time_taken,
     if (out_time_taken) {
         *out_time_taken = time_taken / 1000;
     }
+    AddStatistics(1, out_samples, time_taken / 1000);
     R_SUCCEED();
 }
 
 Result OpusDecoder::SetContext([[maybe_unused]] std::span<const u8> context) {
     R_SUCCEED_IF(shared_memory_mapped);
     shared_memory_mapped = true;
-    R_RETURN(hardware_opus.MapMemory(shared_buffer.get(), shared_buffer_size));
+    R_RETURN(hardware_opus.MapMemory(worker, shared_buffer.get(), shared_buffer_size));
 }
 
 Result OpusDecoder::DecodeInterleavedForMultiStream(u32* out_data_size, u64* out_time_taken,
@@ -156,14 +171,14 @@ Result OpusDecoder::DecodeInterleavedForMultiStream(u32* out_data_size, u64* out
              ResultBufferTooSmall);
 
     if (!shared_memory_mapped) {
-        R_TRY(hardware_opus.MapMemory(shared_buffer.get(), shared_buffer_size));
+        R_TRY(hardware_opus.MapMemory(worker, shared_buffer.get(), shared_buffer_size));
         shared_memory_mapped = true;
     }
 
     std::memcpy(in_data.data(), input_data.data() + sizeof(OpusPacketHeader), header.size);
 
     R_TRY(hardware_opus.DecodeInterleavedForMultiStream(
-        out_samples, out_data.data(), out_data.size_bytes(), channel_count, in_data.data(),
+        worker, out_samples, out_data.data(), out_data.size_bytes(), channel_count, in_data.data(),
         header.size, shared_buffer.get(), time_taken, reset));
 
     std::memcpy(output_data.data(), out_data.data(), out_samples * channel_count * sizeof(s16));
@@ -173,7 +188,92 @@ Result OpusDecoder::DecodeInterleavedForMultiStream(u32* out_data_size, u64* out
     if (out_time_taken) {
         *out_time_taken = time_taken / 1000;
     }
+    AddStatistics(1, out_samples, time_taken / 1000);
+    R_SUCCEED();
+}
+
+Result OpusDecoder::DecodeInterleavedBatch(u32* out_data_size, u64* out_time_taken,
+                                           u32* out_sample_count, u32* out_packet_count,
+                                           std::span<const u8> input_data,
+                                           std::span<u8> output_data, u32 max_packet_count,
+                                           bool reset) {
+    R_RETURN(DecodeBatch(false, out_data_size, out_time_taken, out_sample_count, out_packet_count,
+                         input_data, output_data, max_packet_count, reset));
+}
+
+Result OpusDecoder::DecodeInterleavedForMultiStreamBatch(u32* out_data_size, u64* out_time_taken,
+                                                         u32* out_sample_count,
+                                                         u32* out_packet_count,
+                                                         std::span<const u8> input_data,
+                                                         std::span<u8> output_data,
+                                                         u32 max_packet_count, bool reset) {
+    R_RETURN(DecodeBatch(true, out_data_size, out_time_taken, out_sample_count, out_packet_count,
+                         input_data, output_data, max_packet_count, reset));
+}
+
+Result OpusDecoder::DecodeBatch(bool multistream, u32* out_data_size, u64* out_time_taken,
+                                u32* out_sample_count, u32* out_packet_count,
+                                std::span<const u8> input_data, std::span<u8> output_data,
+                                u32 max_packet_count, bool reset) {
+    R_UNLESS(input_data.size_bytes() > sizeof(OpusPacketHeader), ResultInputDataTooSmall);
+
+    // Check the framing of every packet here, the DSP walks them without checking. A bad packet
+    // ends the batch, and fails the next one when it comes first.
+    u64 batch_size{0};
+    u32 packet_count{0};
+    while (packet_count < max_packet_count &&
+           input_data.size_bytes() - batch_size > sizeof(OpusPacketHeader)) {
+        const auto header{ReadHeader(input_data, batch_size)};
+        if (in_data.size_bytes() < header.size ||
+            batch_size + sizeof(OpusPacketHeader) + header.size > input_data.size_bytes()) {
+            break;
+        }
+        batch_size += sizeof(OpusPacketHeader) + header.size;
+        packet_count++;
+    }
+    R_UNLESS(packet_count > 0, ResultBufferTooSmall);
+
+    if (!shared_memory_mapped) {
+        R_TRY(hardware_opus.MapMemory(worker, shared_buffer.get(), shared_buffer_size));
+        shared_memory_mapped = true;
+    }
+
+    // The work buffer only has room for a single packet and frame, so the DSP reads and writes
+    // the caller's buffers directly rather than going through in_data and out_data.
+    u32 decoded_packets{};
+    u32 out_samples{};
+    u64 time_taken{};
+    if (multistream) {
+        R_TRY(hardware_opus.DecodeInterleavedForMultiStreamBatch(
+            worker, decoded_packets, out_samples, output_data.data(), output_data.size_bytes(),
+            channel_count, input_data.data(), batch_size, packet_count, shared_buffer.get(),
+            time_taken, reset));
+    } else {
+        R_TRY(hardware_opus.DecodeInterleavedBatch(
+            worker, decoded_packets, out_samples, output_data.data(), output_data.size_bytes(),
+            channel_count, input_data.data(), batch_size, packet_count, shared_buffer.get(),
+            time_taken, reset));
+    }
+
+    u64 consumed_size{0};
+    for (u32 i = 0; i < decoded_packets; i++) {
+        consumed_size += sizeof(OpusPacketHeader) + ReadHeader(input_data, consumed_size).size;
+    }
+
+    *out_data_size = static_cast<u32>(consumed_size);
+    *out_sample_count = out_samples;
+    *out_packet_count = decoded_packets;
+    if (out_time_taken) {
+        *out_time_taken = time_taken / 1000;
+    }
+    AddStatistics(decoded_packets, out_samples, time_taken / 1000);
     R_SUCCEED();
 }
 
+void OpusDecoder::AddStatistics(u32 packet_count, u32 sample_count, u64 time_taken) {
+    statistics.packet_count += packet_count;
+    statistics.sample_count += sample_count;
+    statistics.time_taken += time_taken;
+}
+
 } // namespace AudioCore::OpusDecoder
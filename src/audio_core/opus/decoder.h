@@ -17,6 +17,14 @@ class System;
 namespace AudioCore::OpusDecoder {
 class HardwareOpus;
 
+/// Totals over every decode of a session
+struct DecodeStatistics {
+    u64 packet_count{};
+    u64 sample_count{};
+    /// Time the DSP spent decoding, in microseconds
+    u64 time_taken{};
+};
+
 class OpusDecoder {
 public:
     explicit OpusDecoder(Core::System& system, HardwareOpus& hardware_opus_);
@@ -33,9 +41,43 @@ public:
                                            u32* out_sample_count, std::span<const u8> input_data,
                                            std::span<u8> output_data, bool reset);
 
+    /**
+     * Decode up to max_packet_count packets in one request. The input holds the packets back to
+     * back, framed like a single decode, and the samples are written back to back to the output.
+     * Decoding stops at the end of the input, or when the output has no room for the next packet.
+     *
+     * @param out_data_size    - Receives the number of input bytes consumed.
+     * @param out_time_taken   - Receives the decode time in microseconds, optional.
+     * @param out_sample_count - Receives the number of samples decoded per channel.
+     * @param out_packet_count - Receives the number of packets decoded.
+     * @param input_data       - Packets to decode.
+     * @param output_data      - Output for the interleaved samples.
+     * @param max_packet_count - Most packets to decode.
+     * @param reset            - Reset the decoder before the first packet.
+     */
+    Result DecodeInterleavedBatch(u32* out_data_size, u64* out_time_taken, u32* out_sample_count,
+                                  u32* out_packet_count, std::span<const u8> input_data,
+                                  std::span<u8> output_data, u32 max_packet_count, bool reset);
+    Result DecodeInterleavedForMultiStreamBatch(u32* out_data_size, u64* out_time_taken,
+                                                u32* out_sample_count, u32* out_packet_count,
+                                                std::span<const u8> input_data,
+                                                std::span<u8> output_data, u32 max_packet_count,
+                                                bool reset);
+
+    const DecodeStatistics& GetStatistics() const noexcept {
+        return statistics;
+    }
+
 private:
+    Result DecodeBatch(bool multistream, u32* out_data_size, u64* out_time_taken,
+                       u32* out_sample_count, u32* out_packet_count,
+                       std::span<const u8> input_data, std::span<u8> output_data,
+                       u32 max_packet_count, bool reset);
+    void AddStatistics(u32 packet_count, u32 sample_count, u64 time_taken);
+
     Core::System& system;
     HardwareOpus& hardware_opus;
+    u32 worker{};
     std::unique_ptr<u8[]> shared_buffer{};
     u64 shared_buffer_size;
     std::span<u8> in_data{};
@@ -48,6 +90,7 @@ private:
     s32 stereo_stream_count{};
     bool shared_memory_mapped{false};
     bool decode_object_initialized{false};
+    DecodeStatistics statistics{};
 };
 
 } // namespace AudioCore::OpusDecoder
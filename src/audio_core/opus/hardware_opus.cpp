@@ -1,7 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 
 #include "audio_core/audio_core.h"
 #include "audio_core/opus/hardware_opus.h"
@@ -39,13 +41,43 @@ static constexpr Result ResultCodeFromLibOpusErrorCode(u64 error_code) {
 
 HardwareOpus::HardwareOpus(Core::System& system_)
     : system{system_}, opus_decoder{system.AudioCore().ADSP().OpusDecoder()} {
-    opus_decoder.SetSharedMemory(shared_memory);
+    for (u32 worker = 0; worker < workers.size(); worker++) {
+        opus_decoder.SetSharedMemory(workers[worker].shared_memory, worker);
+    }
+}
+
+u32 HardwareOpus::AcquireWorker() {
+    return next_worker.fetch_add(1, std::memory_order_relaxed) % static_cast<u32>(workers.size());
+}
+
+std::unique_ptr<u8[]> HardwareOpus::AcquireWorkBuffer(u64 buffer_size) {
+    {
+        std::scoped_lock l{work_buffer_mutex};
+        const auto it = std::ranges::find(free_work_buffers, buffer_size,
+                                          &std::pair<u64, std::unique_ptr<u8[]>>::first);
+        if (it != free_work_buffers.end()) {
+            auto buffer{std::move(it->second)};
+            free_work_buffers.erase(it);
+            std::memset(buffer.get(), 0, buffer_size);
+            return buffer;
+        }
+    }
+    return std::make_unique<u8[]>(buffer_size);
+}
+
+void HardwareOpus::ReleaseWorkBuffer(std::unique_ptr<u8[]> buffer, u64 buffer_size) {
+    std::scoped_lock l{work_buffer_mutex};
+    if (!buffer || free_work_buffers.size() >= MaxFreeWorkBuffers) {
+        return;
+    }
+    free_work_buffers.emplace_back(buffer_size, std::move(buffer));
 }
 
 u32 HardwareOpus::GetWorkBufferSize(u32 channel) {
     if (!opus_decoder.IsRunning()) {
         return 0;
     }
+    auto& [mutex, shared_memory] = workers[0];
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = channel;
     opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::GetWorkBufferSize);
@@ -59,6 +91,7 @@ u32 HardwareOpus::GetWorkBufferSize(u32 channel) {
 }
 
 u32 HardwareOpus::GetWorkBufferSizeForMultiStream(u32 total_stream_count, u32 stereo_stream_count) {
+    auto& [mutex, shared_memory] = workers[0];
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = total_stream_count;
     shared_memory.host_send_data[1] = stereo_stream_count;
@@ -73,16 +106,18 @@ u32 HardwareOpus::GetWorkBufferSizeForMultiStream(u32 total_stream_count, u32 st
     return static_cast<u32>(shared_memory.dsp_return_data[0]);
 }
 
-Result HardwareOpus::InitializeDecodeObject(u32 sample_rate, u32 channel_count, void* buffer,
-                                            u64 buffer_size) {
+Result HardwareOpus::InitializeDecodeObject(u32 worker, u32 sample_rate, u32 channel_count,
+                                            void* buffer, u64 buffer_size) {
+    auto& [mutex, shared_memory] = workers[worker];
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = (u64)buffer;
     shared_memory.host_send_data[1] = buffer_size;
     shared_memory.host_send_data[2] = sample_rate;
     shared_memory.host_send_data[3] = channel_count;
 
-    opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::InitializeDecodeObject);
-    auto msg = opus_decoder.Receive(ADSP::Direction::Host);
+    opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::InitializeDecodeObject,
+                      worker);
+    auto msg = opus_decoder.Receive(ADSP::Direction::Host, {}, worker);
     if (msg != ADSP::OpusDecoder::Message::InitializeDecodeObjectOK) {
         LOG_ERROR(Service_Audio, "OpusDecoder returned invalid message. Expected {} got {}",
                   ADSP::OpusDecoder::Message::InitializeDecodeObjectOK, msg);
@@ -92,11 +127,12 @@ Result HardwareOpus::InitializeDecodeObject(u32 sample_rate, u32 channel_count,
     R_RETURN(ResultCodeFromLibOpusErrorCode(shared_memory.dsp_return_data[0]));
 }
 
-Result HardwareOpus::InitializeMultiStreamDecodeObject(u32 sample_rate, u32 channel_count,
-                                                       u32 total_stream_count,
+Result HardwareOpus::InitializeMultiStreamDecodeObject(u32 worker, u32 sample_rate,
+                                                       u32 channel_count, u32 total_stream_count,
                                                        u32 stereo_stream_count,
                                                        const void* mappings, void* buffer,
                                                        u64 buffer_size) {
+    auto& [mutex, shared_memory] = workers[worker];
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = (u64)buffer;
     shared_memory.host_send_data[1] = buffer_size;
@@ -109,8 +145,8 @@ Result HardwareOpus::InitializeMultiStreamDecodeObject(u32 sample_rate, u32 chan
     std::memcpy(shared_memory.channel_mapping.data(), mappings, channel_count * sizeof(u8));
 
     opus_decoder.Send(ADSP::Direction::DSP,
-                      ADSP::OpusDecoder::Message::InitializeMultiStreamDecodeObject);
-    auto msg = opus_decoder.Receive(ADSP::Direction::Host);
+                      ADSP::OpusDecoder::Message::InitializeMultiStreamDecodeObject, worker);
+    auto msg = opus_decoder.Receive(ADSP::Direction::Host, {}, worker);
     if (msg != ADSP::OpusDecoder::Message::InitializeMultiStreamDecodeObjectOK) {
         LOG_ERROR(Service_Audio, "OpusDecoder returned invalid message. Expected {} got {}",
                   ADSP::OpusDecoder::Message::InitializeMultiStreamDecodeObjectOK, msg);
@@ -120,13 +156,15 @@ Result HardwareOpus::InitializeMultiStreamDecodeObject(u32 sample_rate, u32 chan
     R_RETURN(ResultCodeFromLibOpusErrorCode(shared_memory.dsp_return_data[0]));
 }
 
-Result HardwareOpus::ShutdownDecodeObject(void* buffer, u64 buffer_size) {
+Result HardwareOpus::ShutdownDecodeObject(u32 worker, void* buffer, u64 buffer_size) {
+    auto& [mutex, shared_memory] = workers[worker];
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = (u64)buffer;
     shared_memory.host_send_data[1] = buffer_size;
 
-    opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::ShutdownDecodeObject);
-    auto msg = opus_decoder.Receive(ADSP::Direction::Host);
+    opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::ShutdownDecodeObject,
+                      worker);
+    auto msg = opus_decoder.Receive(ADSP::Direction::Host, {}, worker);
     ASSERT_MSG(msg == ADSP::OpusDecoder::Message::ShutdownDecodeObjectOK,
                "Expected Opus shutdown code {}, got {}",
                ADSP::OpusDecoder::Message::ShutdownDecodeObjectOK, msg);
@@ -134,14 +172,15 @@ Result HardwareOpus::ShutdownDecodeObject(void* buffer, u64 buffer_size) {
     R_RETURN(ResultCodeFromLibOpusErrorCode(shared_memory.dsp_return_data[0]));
 }
 
-Result HardwareOpus::ShutdownMultiStreamDecodeObject(void* buffer, u64 buffer_size) {
+Result HardwareOpus::ShutdownMultiStreamDecodeObject(u32 worker, void* buffer, u64 buffer_size) {
+    auto& [mutex, shared_memory] = workers[worker];
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = (u64)buffer;
     shared_memory.host_send_data[1] = buffer_size;
 
     opus_decoder.Send(ADSP::Direction::DSP,
-                      ADSP::OpusDecoder::Message::ShutdownMultiStreamDecodeObject);
-    auto msg = opus_decoder.Receive(ADSP::Direction::Host);
+                      ADSP::OpusDecoder::Message::ShutdownMultiStreamDecodeObject, worker);
+    auto msg = opus_decoder.Receive(ADSP::Direction::Host, {}, worker);
     ASSERT_MSG(msg == ADSP::OpusDecoder::Message::ShutdownMultiStreamDecodeObjectOK,
                "Expected Opus shutdown code {}, got {}",
                ADSP::OpusDecoder::Message::ShutdownMultiStreamDecodeObjectOK, msg);
@@ -149,10 +188,11 @@ Result HardwareOpus::ShutdownMultiStreamDecodeObject(void* buffer, u64 buffer_si
     R_RETURN(ResultCodeFromLibOpusErrorCode(shared_memory.dsp_return_data[0]));
 }
 
-Result HardwareOpus::DecodeInterleaved(u32& out_sample_count, void* output_data,
+Result HardwareOpus::DecodeInterleaved(u32 worker, u32& out_sample_count, void* output_data,
                                        u64 output_data_size, u32 channel_count, void* input_data,
                                        u64 input_data_size, void* buffer, u64& out_time_taken,
                                        bool reset) {
+    auto& [mutex, shared_memory] = workers[worker];
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = (u64)buffer;
     shared_memory.host_send_data[1] = (u64)input_data;
@@ -162,8 +202,8 @@ Result HardwareOpus::DecodeInterleaved(u32& out_sample_count, void* output_data,
     shared_memory.host_send_data[5] = 0;
     shared_memory.host_send_data[6] = reset;
 
-    opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::DecodeInterleaved);
-    auto msg = opus_decoder.Receive(ADSP::Direction::Host);
+    opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::DecodeInterleaved, worker);
+    auto msg = opus_decoder.Receive(ADSP::Direction::Host, {}, worker);
     if (msg != ADSP::OpusDecoder::Message::DecodeInterleavedOK) {
         LOG_ERROR(Service_Audio, "OpusDecoder returned invalid message. Expected {} got {}",
                   ADSP::OpusDecoder::Message::DecodeInterleavedOK, msg);
@@ -178,11 +218,12 @@ Result HardwareOpus::DecodeInterleaved(u32& out_sample_count, void* output_data,
     R_RETURN(ResultCodeFromLibOpusErrorCode(error_code));
 }
 
-Result HardwareOpus::DecodeInterleavedForMultiStream(u32& out_sample_count, void* output_data,
-                                                     u64 output_data_size, u32 channel_count,
-                                                     void* input_data, u64 input_data_size,
-                                                     void* buffer, u64& out_time_taken,
-                                                     bool reset) {
+Result HardwareOpus::DecodeInterleavedForMultiStream(u32 worker, u32& out_sample_count,
+                                                     void* output_data, u64 output_data_size,
+                                                     u32 channel_count, void* input_data,
+                                                     u64 input_data_size, void* buffer,
+                                                     u64& out_time_taken, bool reset) {
+    auto& [mutex, shared_memory] = workers[worker];
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = (u64)buffer;
     shared_memory.host_send_data[1] = (u64)input_data;
@@ -193,8 +234,8 @@ Result HardwareOpus::DecodeInterleavedForMultiStream(u32& out_sample_count, void
     shared_memory.host_send_data[6] = reset;
 
     opus_decoder.Send(ADSP::Direction::DSP,
-                      ADSP::OpusDecoder::Message::DecodeInterleavedForMultiStream);
-    auto msg = opus_decoder.Receive(ADSP::Direction::Host);
+                      ADSP::OpusDecoder::Message::DecodeInterleavedForMultiStream, worker);
+    auto msg = opus_decoder.Receive(ADSP::Direction::Host, {}, worker);
     if (msg != ADSP::OpusDecoder::Message::DecodeInterleavedForMultiStreamOK) {
         LOG_ERROR(Service_Audio, "OpusDecoder returned invalid message. Expected {} got {}",
                   ADSP::OpusDecoder::Message::DecodeInterleavedForMultiStreamOK, msg);
@@ -209,13 +250,72 @@ Result HardwareOpus::DecodeInterleavedForMultiStream(u32& out_sample_count, void
     R_RETURN(ResultCodeFromLibOpusErrorCode(error_code));
 }
 
-Result HardwareOpus::MapMemory(void* buffer, u64 buffer_size) {
+Result HardwareOpus::DecodeInterleavedBatch(u32 worker, u32& out_packet_count,
+                                            u32& out_sample_count, void* output_data,
+                                            u64 output_data_size, u32 channel_count,
+                                            const void* input_data, u64 input_data_size,
+                                            u32 packet_count, void* buffer, u64& out_time_taken,
+                                            bool reset) {
+    R_RETURN(DecodeBatch(worker, ADSP::OpusDecoder::Message::DecodeInterleavedBatch,
+                         ADSP::OpusDecoder::Message::DecodeInterleavedBatchOK, out_packet_count,
+                         out_sample_count, output_data, output_data_size, channel_count,
+                         input_data, input_data_size, packet_count, buffer, out_time_taken,
+                         reset));
+}
+
+Result HardwareOpus::DecodeInterleavedForMultiStreamBatch(
+    u32 worker, u32& out_packet_count, u32& out_sample_count, void* output_data,
+    u64 output_data_size, u32 channel_count, const void* input_data, u64 input_data_size,
+    u32 packet_count, void* buffer, u64& out_time_taken, bool reset) {
+    R_RETURN(DecodeBatch(worker, ADSP::OpusDecoder::Message::DecodeInterleavedForMultiStreamBatch,
+                         ADSP::OpusDecoder::Message::DecodeInterleavedForMultiStreamBatchOK,
+                         out_packet_count, out_sample_count, output_data, output_data_size,
+                         channel_count, input_data, input_data_size, packet_count, buffer,
+                         out_time_taken, reset));
+}
+
+Result HardwareOpus::DecodeBatch(u32 worker, ADSP::OpusDecoder::Message message,
+                                 ADSP::OpusDecoder::Message expected_message,
+                                 u32& out_packet_count, u32& out_sample_count, void* output_data,
+                                 u64 output_data_size, u32 channel_count, const void* input_data,
+                                 u64 input_data_size, u32 packet_count, void* buffer,
+                                 u64& out_time_taken, bool reset) {
+    auto& [mutex, shared_memory] = workers[worker];
+    std::scoped_lock l{mutex};
+    shared_memory.host_send_data[0] = (u64)buffer;
+    shared_memory.host_send_data[1] = (u64)input_data;
+    shared_memory.host_send_data[2] = input_data_size;
+    shared_memory.host_send_data[3] = (u64)output_data;
+    shared_memory.host_send_data[4] = output_data_size;
+    shared_memory.host_send_data[5] = packet_count;
+    shared_memory.host_send_data[6] = reset;
+    shared_memory.host_send_data[7] = channel_count;
+
+    opus_decoder.Send(ADSP::Direction::DSP, message, worker);
+    auto msg = opus_decoder.Receive(ADSP::Direction::Host, {}, worker);
+    if (msg != expected_message) {
+        LOG_ERROR(Service_Audio, "OpusDecoder returned invalid message. Expected {} got {}",
+                  expected_message, msg);
+        R_THROW(ResultInvalidOpusDSPReturnCode);
+    }
+
+    auto error_code{static_cast<s32>(shared_memory.dsp_return_data[0])};
+    if (error_code == OPUS_OK) {
+        out_sample_count = static_cast<u32>(shared_memory.dsp_return_data[1]);
+        out_time_taken = 1000 * shared_memory.dsp_return_data[2];
+        out_packet_count = static_cast<u32>(shared_memory.dsp_return_data[3]);
+    }
+    R_RETURN(ResultCodeFromLibOpusErrorCode(error_code));
+}
+
+Result HardwareOpus::MapMemory(u32 worker, void* buffer, u64 buffer_size) {
+    auto& [mutex, shared_memory] = workers[worker];
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = (u64)buffer;
     shared_memory.host_send_data[1] = buffer_size;
 
-    opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::MapMemory);
-    auto msg = opus_decoder.Receive(ADSP::Direction::Host);
+    opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::MapMemory, worker);
+    auto msg = opus_decoder.Receive(ADSP::Direction::Host, {}, worker);
     if (msg != ADSP::OpusDecoder::Message::MapMemoryOK) {
         LOG_ERROR(Service_Audio, "OpusDecoder returned invalid message. Expected {} got {}",
                   ADSP::OpusDecoder::Message::MapMemoryOK, msg);
@@ -224,13 +324,14 @@ Result HardwareOpus::MapMemory(void* buffer, u64 buffer_size) {
     R_SUCCEED();
 }
 
-Result HardwareOpus::UnmapMemory(void* buffer, u64 buffer_size) {
+Result HardwareOpus::UnmapMemory(u32 worker, void* buffer, u64 buffer_size) {
+    auto& [mutex, shared_memory] = workers[worker];
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = (u64)buffer;
     shared_memory.host_send_data[1] = buffer_size;
 
-    opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::UnmapMemory);
-    auto msg = opus_decoder.Receive(ADSP::Direction::Host);
+    opus_decoder.Send(ADSP::Direction::DSP, ADSP::OpusDecoder::Message::UnmapMemory, worker);
+    auto msg = opus_decoder.Receive(ADSP::Direction::Host, {}, worker);
     if (msg != ADSP::OpusDecoder::Message::UnmapMemoryOK) {
         LOG_ERROR(Service_Audio, "OpusDecoder returned invalid message. Expected {} got {}",
                   ADSP::OpusDecoder::Message::UnmapMemoryOK, msg);
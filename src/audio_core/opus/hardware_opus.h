@@ -3,7 +3,12 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 #include <opus.h>
 
 #include "audio_core/adsp/apps/opus/opus_decoder.h"
@@ -16,30 +21,88 @@ class HardwareOpus {
 public:
     HardwareOpus(Core::System& system);
 
+    /**
+     * Pick the DSP worker for a new decoder session. Sessions are spread over the workers
+     * round robin, sessions on different workers decode at the same time.
+     *
+     * @return Index of the worker to pass to the session calls.
+     */
+    u32 AcquireWorker();
+
+    /**
+     * Get a work buffer for a decoder session, reusing one released by an earlier session with
+     * the same size when there is one. The buffer is zeroed either way.
+     *
+     * @param buffer_size - Size of the buffer in bytes.
+     * @return The work buffer.
+     */
+    std::unique_ptr<u8[]> AcquireWorkBuffer(u64 buffer_size);
+
+    /**
+     * Return the work buffer of a decoder session which has been shut down, for reuse.
+     *
+     * @param buffer      - The work buffer.
+     * @param buffer_size - Size of the buffer in bytes, as given to AcquireWorkBuffer.
+     */
+    void ReleaseWorkBuffer(std::unique_ptr<u8[]> buffer, u64 buffer_size);
+
     u32 GetWorkBufferSize(u32 channel);
     u32 GetWorkBufferSizeForMultiStream(u32 total_stream_count, u32 stereo_stream_count);
 
-    Result InitializeDecodeObject(u32 sample_rate, u32 channel_count, void* buffer,
+    Result InitializeDecodeObject(u32 worker, u32 sample_rate, u32 channel_count, void* buffer,
                                   u64 buffer_size);
-    Result InitializeMultiStreamDecodeObject(u32 sample_rate, u32 channel_count,
+    Result InitializeMultiStreamDecodeObject(u32 worker, u32 sample_rate, u32 channel_count,
                                              u32 totaL_stream_count, u32 stereo_stream_count,
                                              const void* mappings, void* buffer, u64 buffer_size);
-    Result ShutdownDecodeObject(void* buffer, u64 buffer_size);
-    Result ShutdownMultiStreamDecodeObject(void* buffer, u64 buffer_size);
-    Result DecodeInterleaved(u32& out_sample_count, void* output_data, u64 output_data_size,
-                             u32 channel_count, void* input_data, u64 input_data_size, void* buffer,
-                             u64& out_time_taken, bool reset);
-    Result DecodeInterleavedForMultiStream(u32& out_sample_count, void* output_data,
+    Result ShutdownDecodeObject(u32 worker, void* buffer, u64 buffer_size);
+    Result ShutdownMultiStreamDecodeObject(u32 worker, void* buffer, u64 buffer_size);
+    Result DecodeInterleaved(u32 worker, u32& out_sample_count, void* output_data,
+                             u64 output_data_size, u32 channel_count, void* input_data,
+                             u64 input_data_size, void* buffer, u64& out_time_taken, bool reset);
+    Result DecodeInterleavedForMultiStream(u32 worker, u32& out_sample_count, void* output_data,
                                            u64 output_data_size, u32 channel_count,
                                            void* input_data, u64 input_data_size, void* buffer,
                                            u64& out_time_taken, bool reset);
-    Result MapMemory(void* buffer, u64 buffer_size);
-    Result UnmapMemory(void* buffer, u64 buffer_size);
+
+    /**
+     * Decode several packets in one request to the DSP. The input holds the packets back to back,
+     * each one with its OpusPacketHeader, and the samples are written back to back to the output.
+     * Stops early when the output is full, out_packet_count says how many packets were decoded.
+     */
+    Result DecodeInterleavedBatch(u32 worker, u32& out_packet_count, u32& out_sample_count,
+                                  void* output_data, u64 output_data_size, u32 channel_count,
+                                  const void* input_data, u64 input_data_size, u32 packet_count,
+                                  void* buffer, u64& out_time_taken, bool reset);
+    Result DecodeInterleavedForMultiStreamBatch(u32 worker, u32& out_packet_count,
+                                                u32& out_sample_count, void* output_data,
+                                                u64 output_data_size, u32 channel_count,
+                                                const void* input_data, u64 input_data_size,
+                                                u32 packet_count, void* buffer,
+                                                u64& out_time_taken, bool reset);
+
+    Result MapMemory(u32 worker, void* buffer, u64 buffer_size);
+    Result UnmapMemory(u32 worker, void* buffer, u64 buffer_size);
 
 private:
+    struct Worker {
+        std::mutex mutex;
+        ADSP::OpusDecoder::SharedMemory shared_memory;
+    };
+
+    Result DecodeBatch(u32 worker, ADSP::OpusDecoder::Message message,
+                       ADSP::OpusDecoder::Message expected_message, u32& out_packet_count,
+                       u32& out_sample_count, void* output_data, u64 output_data_size,
+                       u32 channel_count, const void* input_data, u64 input_data_size,
+                       u32 packet_count, void* buffer, u64& out_time_taken, bool reset);
+
+    /// Most work buffers kept around for reuse once their session is gone
+    static constexpr size_t MaxFreeWorkBuffers = 8;
+
     Core::System& system;
-    std::mutex mutex;
     ADSP::OpusDecoder::OpusDecoder& opus_decoder;
-    ADSP::OpusDecoder::SharedMemory shared_memory;
+    std::array<Worker, ADSP::OpusDecoder::DecodeWorkerCount> workers;
+    std::atomic<u32> next_worker{};
+    std::mutex work_buffer_mutex;
+    std::vector<std::pair<u64, std::unique_ptr<u8[]>>> free_work_buffers;
 };
 } // namespace AudioCore::OpusDecoder
@@ -42,6 +42,9 @@ template <typename T>
 void CommandBuffer::GenerateEnd(T& cmd) {
     cmd.estimated_process_time = time_estimator->Estimate(cmd);
     estimated_process_time += cmd.estimated_process_time;
+    if (measured_time_estimator) {
+        measured_process_time += measured_time_estimator->Estimate(cmd);
+    }
     size += sizeof(T);
     count++;
 }
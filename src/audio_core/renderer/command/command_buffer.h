@@ -15,6 +15,7 @@ struct UpsamplerInfo;
 struct VoiceState;
 class EffectInfoBase;
 class ICommandProcessingTimeEstimator;
+class MeasuredCommandProcessingTimeEstimator;
 class MixInfo;
 class MemoryPoolInfo;
 class SinkInfoBase;
@@ -455,6 +456,10 @@ public:
     MemoryPoolInfo* memory_pool{};
     /// Used for estimating command process times
     ICommandProcessingTimeEstimator* time_estimator{};
+    /// Current estimated processing time for all commands, from measured times
+    u32 measured_process_time{};
+    /// Used for estimating command process times from measured times, may be null
+    const MeasuredCommandProcessingTimeEstimator* measured_time_estimator{};
     /// Used to check which rendering features are currently enabled
     BehaviorInfo* behavior{};
 
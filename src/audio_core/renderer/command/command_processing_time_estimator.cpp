@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <limits>
+
 #include "audio_core/renderer/command/command_processing_time_estimator.h"
 
 namespace AudioCore::Renderer {
@@ -3617,4 +3620,38 @@ u32 CommandProcessingTimeEstimatorVersion5::Estimate(const CompressorCommand& co
     }
 }
 
+void MeasuredCommandProcessingTimeEstimator::Update(
+    const ADSP::AudioRenderer::CommandProfile& profile) {
+    // The DSP time limit is 2,880,000 for a 5ms frame
+    constexpr f32 UnitsPerNanosecond{2'880'000.0f / 5'000'000.0f};
+    // Weight of the latest measurements, smooths out frames the host was busy with other work
+    constexpr f32 LearningRate{0.125f};
+
+    for (size_t type = 0; type < scales.size(); type++) {
+        const u64 time{profile.times[type].load(std::memory_order_relaxed)};
+        const u64 estimate{profile.estimates[type].load(std::memory_order_relaxed)};
+        const u64 time_delta{time - last_times[type]};
+        const u64 estimate_delta{estimate - last_estimates[type]};
+        if (time_delta == 0 || estimate_delta == 0) {
+            continue;
+        }
+        last_times[type] = time;
+        last_estimates[type] = estimate;
+
+        const f32 scale{static_cast<f32>(time_delta) * UnitsPerNanosecond /
+                        static_cast<f32>(estimate_delta)};
+        scales[type] =
+            scales[type] == 0.0f ? scale : scales[type] + (scale - scales[type]) * LearningRate;
+    }
+}
+
+u32 MeasuredCommandProcessingTimeEstimator::Estimate(const ICommand& command) const {
+    const auto type{static_cast<size_t>(command.type)};
+    if (type >= scales.size() || scales[type] == 0.0f) {
+        return command.estimated_process_time;
+    }
+    const f64 estimate{static_cast<f64>(command.estimated_process_time) * scales[type]};
+    return static_cast<u32>(std::min<f64>(estimate, std::numeric_limits<u32>::max()));
+}
+
 } // namespace AudioCore::Renderer
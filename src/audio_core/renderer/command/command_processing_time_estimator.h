@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <array>
+
+#include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/renderer/command/commands.h"
 #include "common/common_types.h"
 
@@ -251,4 +254,37 @@ private:
     u32 buffer_count{};
 };
 
+/**
+ * Estimates the processing time of commands from how long the host actually takes to process
+ * them, for deciding which voices to drop. Every command type learns how its measured time
+ * compares to the HOS estimates, and a command's estimate is its HOS estimate scaled by that,
+ * in the same units as the DSP time limit. Until a type has been measured its HOS estimates are
+ * used as they are.
+ * Commands keep their HOS estimates, only the voice dropping uses these.
+ */
+class MeasuredCommandProcessingTimeEstimator {
+public:
+    /**
+     * Learn from the commands processed since the last update.
+     *
+     * @param profile - Running totals of the commands processed for this session.
+     */
+    void Update(const ADSP::AudioRenderer::CommandProfile& profile);
+
+    /**
+     * Estimate the processing time of a generated command.
+     *
+     * @param command - The command, with its HOS estimate already set.
+     * @return The estimated processing time.
+     */
+    u32 Estimate(const ICommand& command) const;
+
+private:
+    /// Measured time per unit of HOS estimate, by CommandId, 0 until measured
+    std::array<f32, ADSP::AudioRenderer::CommandIdCount> scales{};
+    /// Profile totals at the last update, by CommandId
+    std::array<u64, ADSP::AudioRenderer::CommandIdCount> last_times{};
+    std::array<u64, ADSP::AudioRenderer::CommandIdCount> last_estimates{};
+};
+
 } // namespace AudioCore::Renderer
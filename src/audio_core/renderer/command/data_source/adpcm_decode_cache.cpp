@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "audio_core/renderer/command/data_source/adpcm_decode_cache.h"
+
+namespace AudioCore::Renderer {
+
+bool AdpcmDecodeCache::Entry::Continues(u32 position,
+                                        const VoiceState::AdpcmContext& context) const {
+    if (position < segment.start_offset || position - segment.start_offset > DecodedCount()) {
+        return false;
+    }
+
+    const u32 index{position - segment.start_offset};
+    if (samples[index + 1] != context.yn0 || samples[index] != context.yn1) {
+        return false;
+    }
+
+    // At the start of a frame, the header is read from the frame
+    if (position % AdpcmSamplesPerFrame == 0) {
+        return true;
+    }
+    const auto frame{position / AdpcmSamplesPerFrame - segment.start_offset / AdpcmSamplesPerFrame};
+    return context.header == (index == 0 ? initial_context.header : headers[frame]);
+}
+
+u32 AdpcmDecodeCache::Read(const Segment& segment, u32 position, u32 count,
+                           std::span<const u8> frames, VoiceState::AdpcmContext& context,
+                           std::span<s16> output) {
+    std::scoped_lock l{mutex};
+
+    const u32 index{position - segment.start_offset};
+    const u32 base_frame{segment.start_offset / AdpcmSamplesPerFrame};
+    const u32 first_frame{position / AdpcmSamplesPerFrame};
+    u32 cached_count{};
+    u32 last_frame{};
+
+    auto it{entries.begin()};
+    while (it != entries.end()) {
+        if (!(it->segment == segment && it->Continues(position, context))) {
+            ++it;
+            continue;
+        }
+        cached_count = std::min(count, it->DecodedCount() - index);
+        if (cached_count == 0) {
+            return 0;
+        }
+
+        // The samples are only valid while the game hasn't written anything else over their
+        // frames
+        last_frame = (position + cached_count - 1) / AdpcmSamplesPerFrame;
+        const size_t frames_offset{(first_frame - base_frame) * AdpcmFrameSize};
+        const size_t frames_size{(last_frame - first_frame + 1) * AdpcmFrameSize};
+        if (frames.size() >= frames_size &&
+            std::memcmp(frames.data(), it->frames.data() + frames_offset, frames_size) == 0) {
+            break;
+        }
+        const auto stale{it++};
+        Evict(stale);
+    }
+    if (it == entries.end()) {
+        return 0;
+    }
+
+    std::memcpy(output.data(), it->samples.data() + index + 2, cached_count * sizeof(s16));
+    context.header = it->headers[last_frame - base_frame];
+    context.yn0 = it->samples[index + cached_count + 1];
+    context.yn1 = it->samples[index + cached_count];
+
+    entries.splice(entries.begin(), entries, it);
+    return cached_count;
+}
+
+void AdpcmDecodeCache::Write(const Segment& segment, u32 position, std::span<const u8> frames,
+                             const VoiceState::AdpcmContext& context,
+                             std::span<const s16> samples) {
+    if (samples.empty()) {
+        return;
+    }
+
+    std::scoped_lock l{mutex};
+
+    auto it{std::ranges::find_if(entries, [&](const Entry& entry) {
+        return entry.segment == segment &&
+               entry.segment.start_offset + entry.DecodedCount() == position &&
+               entry.Continues(position, context);
+    })};
+
+    if (it == entries.end()) {
+        if (position != segment.start_offset || segment.end_offset <= segment.start_offset) {
+            return;
+        }
+
+        const u64 sample_count{segment.end_offset - segment.start_offset + 2ULL};
+        const u64 frame_count{(segment.end_offset - 1) / AdpcmSamplesPerFrame -
+                              segment.start_offset / AdpcmSamplesPerFrame + 1};
+        const u64 size{sample_count * sizeof(s16) + frame_count * (AdpcmFrameSize + sizeof(u16))};
+        if (size > MaxEntrySize) {
+            return;
+        }
+
+        // Make room, dropping the oldest entry decoded from another context first
+        const auto same_segment{std::ranges::count_if(
+            entries, [&](const Entry& entry) { return entry.segment == segment; })};
+        if (same_segment >= static_cast<s64>(MaxEntriesPerSegment)) {
+            const auto oldest{std::ranges::find_if(entries.rbegin(), entries.rend(),
+                                                   [&](const Entry& entry) {
+                                                       return entry.segment == segment;
+                                                   })};
+            Evict(std::prev(oldest.base()));
+        }
+        while (!entries.empty() && (total_size + size > MaxSize || entries.size() >= MaxEntries)) {
+            Evict(std::prev(entries.end()));
+        }
+
+        auto& entry{entries.emplace_front()};
+        entry.segment = segment;
+        entry.initial_context = context;
+        entry.frames.reserve(frame_count * AdpcmFrameSize);
+        entry.headers.reserve(frame_count);
+        entry.samples.reserve(sample_count);
+        entry.samples.push_back(context.yn1);
+        entry.samples.push_back(context.yn0);
+        entry.size = size;
+        total_size += size;
+        it = entries.begin();
+    } else {
+        entries.splice(entries.begin(), entries, it);
+    }
+
+    // Frames the entry already has were copied when their first samples were written
+    auto& entry{*it};
+    const u32 base_frame{segment.start_offset / AdpcmSamplesPerFrame};
+    const u32 first_frame{position / AdpcmSamplesPerFrame};
+    const u32 last_frame{static_cast<u32>((position + samples.size() - 1) / AdpcmSamplesPerFrame)};
+    for (u32 frame = base_frame + static_cast<u32>(entry.headers.size()); frame <= last_frame;
+         frame++) {
+        const size_t offset{(frame - first_frame) * AdpcmFrameSize};
+        if (offset + AdpcmFrameSize > frames.size()) {
+            Evict(it);
+            return;
+        }
+        entry.frames.insert(entry.frames.end(), frames.begin() + offset,
+                            frames.begin() + offset + AdpcmFrameSize);
+        // A segment starting inside a frame decodes the rest of it with the given header
+        const bool inside_frame{frame == first_frame && position % AdpcmSamplesPerFrame != 0};
+        entry.headers.push_back(inside_frame ? context.header : frames[offset]);
+    }
+    entry.samples.insert(entry.samples.end(), samples.begin(), samples.end());
+}
+
+void AdpcmDecodeCache::Clear() {
+    std::scoped_lock l{mutex};
+    entries.clear();
+    total_size = 0;
+}
+
+void AdpcmDecodeCache::Evict(std::list<Entry>::iterator it) {
+    total_size -= it->size;
+    entries.erase(it);
+}
+
+} // namespace AudioCore::Renderer
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <list>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "audio_core/common/common.h"
+#include "audio_core/renderer/voice/voice_state.h"
+#include "common/common_types.h"
+#include "common/literals.h"
+
+namespace Core::Memory {
+class Memory;
+}
+
+namespace AudioCore::Renderer {
+using namespace Common::Literals;
+
+/// Samples in a DSP-ADPCM frame
+constexpr u32 AdpcmSamplesPerFrame = 14;
+/// Bytes in a DSP-ADPCM frame, a header byte followed by 14 nibbles
+constexpr u32 AdpcmFrameSize = 8;
+
+/**
+ * Cache of decoded ADPCM samples, so looping or replayed wave buffers are decoded once.
+ *
+ * An entry holds a segment of a wave buffer, decoded from its start offset, along with a copy of
+ * the frames it was decoded from. The cache only serves samples when the voice is at the exact
+ * decoder state the entry had at that position, and the frames still hold the same data, so the
+ * samples are the same as decoding them again. Frames rewritten by the game, as streaming voices
+ * do, fail that check and drop the entry. All calls are thread safe.
+ */
+class AdpcmDecodeCache {
+public:
+    /// A wave buffer decoded from start_offset, until end_offset
+    struct Segment {
+        const Core::Memory::Memory* memory;
+        CpuAddr buffer;
+        u64 buffer_size;
+        u32 start_offset;
+        u32 end_offset;
+        std::array<s16, 16> coefficients;
+
+        bool operator==(const Segment&) const = default;
+    };
+
+    /**
+     * Copy cached samples of a segment to the output, and advance the context past them.
+     *
+     * @param segment  - Segment being decoded.
+     * @param position - Sample of the wave buffer to start at.
+     * @param count    - Number of samples wanted.
+     * @param frames   - Frames of the wave buffer holding those samples, from the first one.
+     * @param context  - Decoder context of the voice at position, updated.
+     * @param output   - Output for the samples.
+     * @return Number of samples copied, from 0 to count.
+     */
+    u32 Read(const Segment& segment, u32 position, u32 count, std::span<const u8> frames,
+             VoiceState::AdpcmContext& context, std::span<s16> output);
+
+    /**
+     * Store freshly decoded samples of a segment. They continue the entry the voice was reading,
+     * or start a new entry when position is the start of the segment.
+     *
+     * @param segment  - Segment being decoded.
+     * @param position - Sample of the wave buffer the samples start at.
+     * @param frames   - Frames the samples were decoded from, from the first one.
+     * @param context  - Decoder context of the voice at position, before decoding.
+     * @param samples  - The decoded samples.
+     */
+    void Write(const Segment& segment, u32 position, std::span<const u8> frames,
+               const VoiceState::AdpcmContext& context, std::span<const s16> samples);
+
+    /// Drop every entry
+    void Clear();
+
+    /// Most bytes taken by the cached samples and frames
+    static constexpr u64 MaxSize = 64_MiB;
+    /// Most bytes a single segment may take, longer ones are never cached
+    static constexpr u64 MaxEntrySize = 16_MiB;
+
+private:
+    struct Entry {
+        Segment segment;
+        /// Context the segment was decoded from
+        VoiceState::AdpcmContext initial_context;
+        /// Copy of the frames decoded so far
+        std::vector<u8> frames;
+        /// Header each decoded frame was decoded with
+        std::vector<u16> headers;
+        /// Decoded samples, after the two history samples of the initial context
+        std::vector<s16> samples;
+        /// Bytes reserved for the whole segment
+        u64 size;
+
+        u32 DecodedCount() const {
+            return static_cast<u32>(samples.size() - 2);
+        }
+
+        bool Continues(u32 position, const VoiceState::AdpcmContext& context) const;
+    };
+
+    void Evict(std::list<Entry>::iterator it);
+
+    /// Most entries for a single segment, decoded from different contexts
+    static constexpr size_t MaxEntriesPerSegment = 2;
+    /// Most entries in the cache
+    static constexpr size_t MaxEntries = 512;
+
+    std::mutex mutex;
+    /// Entries, most recently used first
+    std::list<Entry> entries;
+    /// Bytes reserved by all entries
+    u64 total_size{};
+};
+
+} // namespace AudioCore::Renderer
@@ -4,6 +4,7 @@
 #include <array>
 #include <vector>
 
+#include "audio_core/renderer/command/data_source/adpcm_decode_cache.h"
 #include "audio_core/renderer/command/data_source/decode.h"
 #include "audio_core/renderer/command/resample/resample.h"
 #include "common/fixed_point.h"
@@ -91,17 +92,73 @@ static u32 DecodePcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
     return samples_to_decode;
 }
 
+/**
+ * Decode consecutive ADPCM samples.
+ *
+ * Works a frame at a time, taking the header once per frame and sign extending the nibbles in
+ * place rather than through a table. The predictor makes every sample depend on the two before
+ * it, so the samples of a frame can't be decoded in parallel.
+ *
+ * @param frames       - Frames holding the samples, from the one holding the first sample.
+ * @param position     - Sample of the wave buffer to start at.
+ * @param count        - Number of samples to decode.
+ * @param coefficients - Predictor coefficients of the wave buffer.
+ * @param context      - Decoder context at position, updated past the decoded samples.
+ * @param out_buffer   - Output for the samples.
+ */
+static void DecodeAdpcmSamples(std::span<const u8> frames, u32 position, u32 count,
+                               const std::array<s16, 16>& coefficients,
+                               VoiceState::AdpcmContext& context, std::span<s16> out_buffer) {
+    auto header{context.header};
+    s32 yn0{context.yn0};
+    s32 yn1{context.yn1};
+
+    const u8* frame{frames.data()};
+    u32 position_in_frame{position % AdpcmSamplesPerFrame};
+    u32 write_index{0};
+
+    while (write_index < count) {
+        // Are we at a new frame?
+        if (position_in_frame == 0) {
+            header = frame[0];
+        }
+        const u32 coeff_index{(header >> 4U) & 0xFU};
+        const s32 coeff0{coefficients[coeff_index * 2 + 0]};
+        const s32 coeff1{coefficients[coeff_index * 2 + 1]};
+        // Shifts the nibble up by the scale and the fixed point position
+        const s32 step{(1 << (header & 0xFU)) << 11};
+
+        const u32 end{std::min(AdpcmSamplesPerFrame, position_in_frame + count - write_index)};
+        for (u32 i = position_in_frame; i < end; i++) {
+            const auto byte{static_cast<s8>(frame[1 + i / 2])};
+            const s32 nibble{(i & 1) ? static_cast<s8>(byte << 4) >> 4 : byte >> 4};
+            const s32 sample{(nibble * step + 0x400 + coeff0 * yn0 + coeff1 * yn1) >> 11};
+            yn1 = yn0;
+            yn0 = std::clamp<s32>(sample, -0x8000, 0x7FFF);
+            out_buffer[write_index++] = static_cast<s16>(yn0);
+        }
+
+        position_in_frame = 0;
+        frame += AdpcmFrameSize;
+    }
+
+    context.header = header;
+    context.yn0 = static_cast<s16>(yn0);
+    context.yn1 = static_cast<s16>(yn1);
+}
+
 /**
  * Decode ADPCM data.
  *
  * @param memory     - Core memory for reading samples.
  * @param out_buffer - Output mix buffer to receive the samples.
  * @param req        - Information for how to decode.
+ * @param cache      - Cache of decoded samples to use, optional.
  * @return Number of samples decoded.
  */
 static u32 DecodeAdpcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
-                       const DecodeArg& req) {
-    constexpr u32 SamplesPerFrame{14};
+                       const DecodeArg& req, AdpcmDecodeCache* cache) {
+    constexpr u32 SamplesPerFrame{AdpcmSamplesPerFrame};
     constexpr u32 NibblesPerFrame{16};
 
     if (req.buffer == 0 || req.buffer_size == 0) {
@@ -130,93 +187,43 @@ static u32 DecodeAdpcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
         return 0;
     }
 
-    auto samples_to_read{samples_to_process};
-    auto samples_remaining_in_frame{start_pos % SamplesPerFrame};
-    auto position_in_frame{(start_pos / SamplesPerFrame) * NibblesPerFrame +
-                           samples_remaining_in_frame};
-
-    if (samples_remaining_in_frame) {
-        position_in_frame += 2;
-    }
-
-    const auto size{std::max((samples_to_process / 8U) * SamplesPerFrame, 8U)};
+    const auto first_frame{start_pos / SamplesPerFrame};
+    const auto last_frame{(start_pos + samples_to_process - 1) / SamplesPerFrame};
+    const auto frame_count{last_frame - first_frame + 1};
     Core::Memory::CpuGuestMemory<u8, Core::Memory::GuestMemoryFlags::UnsafeRead> wavebuffer(
-        memory, req.buffer + position_in_frame / 2, size);
-
-    auto context{req.adpcm_context};
-    auto header{context->header};
-    u8 coeff_index{static_cast<u8>((header >> 4U) & 0xFU)};
-    u8 scale{static_cast<u8>(header & 0xFU)};
-    s32 coeff0{req.coefficients[coeff_index * 2 + 0]};
-    s32 coeff1{req.coefficients[coeff_index * 2 + 1]};
-
-    auto yn0{context->yn0};
-    auto yn1{context->yn1};
-
-    static constexpr std::array<s32, 16> Steps{
-        0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1,
+        memory, req.buffer + first_frame * AdpcmFrameSize, frame_count * AdpcmFrameSize);
+    std::span<const u8> frames{wavebuffer.data(), wavebuffer.size()};
+
+    auto& context{*req.adpcm_context};
+    const AdpcmDecodeCache::Segment segment{
+        .memory = &memory,
+        .buffer = req.buffer,
+        .buffer_size = req.buffer_size,
+        .start_offset = req.start_offset,
+        .end_offset = req.end_offset,
+        .coefficients = req.coefficients,
     };
 
-    const auto decode_sample = [&](const s32 code) -> s16 {
-        const auto xn = code * (1 << scale);
-        const auto prediction = coeff0 * yn0 + coeff1 * yn1;
-        const auto sample = ((xn << 11) + 0x400 + prediction) >> 11;
-        const auto saturated = std::clamp<s32>(sample, -0x8000, 0x7FFF);
-        yn1 = yn0;
-        yn0 = static_cast<s16>(saturated);
-        return yn0;
-    };
-
-    u32 read_index{0};
-    u32 write_index{0};
-
-    while (samples_to_read > 0) {
-        // Are we at a new frame?
-        if ((position_in_frame % NibblesPerFrame) == 0) {
-            header = wavebuffer[read_index++];
-            coeff_index = (header >> 4) & 0xF;
-            scale = header & 0xF;
-            coeff0 = req.coefficients[coeff_index * 2 + 0];
-            coeff1 = req.coefficients[coeff_index * 2 + 1];
-            position_in_frame += 2;
-
-            // Can we consume all of this frame's samples?
-            if (samples_to_read >= SamplesPerFrame) {
-                // Can grab all samples until the next header
-                for (u32 i = 0; i < SamplesPerFrame / 2; i++) {
-                    auto code0{Steps[(wavebuffer[read_index] >> 4) & 0xF]};
-                    auto code1{Steps[wavebuffer[read_index] & 0xF]};
-                    read_index++;
-
-                    out_buffer[write_index++] = decode_sample(code0);
-                    out_buffer[write_index++] = decode_sample(code1);
-                }
-
-                position_in_frame += SamplesPerFrame;
-                samples_to_read -= SamplesPerFrame;
-                continue;
-            }
-        }
-
-        // Decode a single sample
-        auto code{wavebuffer[read_index]};
-        if (position_in_frame & 1) {
-            code &= 0xF;
-            read_index++;
-        } else {
-            code >>= 4;
+    u32 cached_count{0};
+    if (cache) {
+        cached_count = cache->Read(segment, start_pos, samples_to_process, frames, context,
+                                   out_buffer);
+        if (cached_count == samples_to_process) {
+            return samples_to_process;
         }
+    }
 
-        out_buffer[write_index++] = decode_sample(Steps[code]);
+    const auto position{start_pos + cached_count};
+    const auto count{samples_to_process - cached_count};
+    frames = frames.subspan((position / SamplesPerFrame - first_frame) * AdpcmFrameSize);
+    out_buffer = out_buffer.subspan(cached_count, count);
 
-        position_in_frame++;
-        samples_to_read--;
+    const auto initial_context{context};
+    DecodeAdpcmSamples(frames, position, count, req.coefficients, context, out_buffer);
+    if (cache) {
+        cache->Write(segment, position, frames, initial_context, out_buffer);
     }
 
-    context->header = header;
-    context->yn0 = yn0;
-    context->yn1 = yn1;
-
     return samples_to_process;
 }
 
@@ -350,7 +357,7 @@ void DecodeFromWaveBuffers(Core::Memory::Memory& memory, const DecodeFromWaveBuf
                 memory.ReadBlockUnsafe(args.data_address, &decode_arg.coefficients, args.data_size);
                 samples_decoded = DecodeAdpcm(
                     memory, {&temp_buffer[temp_buffer_pos], TempBufferSize - temp_buffer_pos},
-                    decode_arg);
+                    decode_arg, args.adpcm_cache);
             } break;
 
             default:
@@ -16,6 +16,7 @@ class Memory;
 }
 
 namespace AudioCore::Renderer {
+class AdpcmDecodeCache;
 
 struct DecodeFromWaveBuffersArgs {
     SampleFormat sample_format;
@@ -33,6 +34,7 @@ struct DecodeFromWaveBuffersArgs {
     u64 data_size;
     bool IsVoicePlayedSampleCountResetAtLoopPointSupported;
     bool IsVoicePitchAndSrcSkippedSupported;
+    AdpcmDecodeCache* adpcm_cache;
 };
 
 struct DecodeArg {
@@ -1,14 +1,19 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <numbers>
 
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/renderer/command/effect/i3dl2_reverb.h"
+#include "audio_core/renderer/command/effect/reverb_kernels.h"
 #include "common/polyfill_ranges.h"
 
 namespace AudioCore::Renderer {
 
+/// Number of samples the early reflections are done for before running the late reverb
+constexpr u32 I3dl2ReverbBlockSize = 64;
+
 constexpr std::array<f32, I3dl2ReverbInfo::MaxDelayLines> MinDelayLineTimes{
     5.0f,
     6.0f,
@@ -203,32 +208,6 @@ static void ApplyI3dl2ReverbEffectBypass(std::span<std::span<const s32>> inputs,
     }
 }
 
-/**
- * Tick the delay lines, reading and returning their current output, and writing a new decaying
- * sample (mix).
- *
- * @param decay0 - The first decay line.
- * @param decay1 - The second decay line.
- * @param fdn    - Feedback delay network.
- * @param mix    - The new calculated sample to be written and decayed.
- * @return The next delayed and decayed sample.
- */
-static Common::FixedPoint<50, 14> Axfx2AllPassTick(I3dl2ReverbInfo::I3dl2DelayLine& decay0,
-                                                   I3dl2ReverbInfo::I3dl2DelayLine& decay1,
-                                                   I3dl2ReverbInfo::I3dl2DelayLine& fdn,
-                                                   const Common::FixedPoint<50, 14> mix) {
-    auto val{decay0.Read()};
-    auto mixed{mix - (val * decay0.wet_gain)};
-    auto out{decay0.Tick(mixed) + (mixed * decay0.wet_gain)};
-
-    val = decay1.Read();
-    mixed = out - (val * decay1.wet_gain);
-    out = decay1.Tick(mixed) + (mixed * decay1.wet_gain);
-
-    fdn.Tick(out);
-    return out;
-}
-
 /**
  * Impl. Apply a I3DL2 reverb according to the current state, on the input mix buffers,
  * saving the results to the output mix buffers.
@@ -268,87 +247,87 @@ static void ApplyI3dl2ReverbEffect(I3dl2ReverbInfo::State& state,
         tap_indexes = OutTapIndexes6Ch;
     }
 
-    for (u32 sample_index = 0; sample_index < sample_count; sample_index++) {
-        Common::FixedPoint<50, 14> early_to_late_tap{
-            state.early_delay_line.TapOut(state.early_to_late_taps)};
-        std::array<Common::FixedPoint<50, 14>, NumChannels> output_samples{};
+    // The early reflections only depend on the input, so they're done for a whole block before
+    // running the feedback delay network over it
+    for (u32 block_start = 0; block_start < sample_count; block_start += I3dl2ReverbBlockSize) {
+        const u32 block_count{std::min(I3dl2ReverbBlockSize, sample_count - block_start)};
+        std::array<std::array<Common::FixedPoint<50, 14>, NumChannels>, I3dl2ReverbBlockSize>
+            early_samples{};
+        std::array<Common::FixedPoint<50, 14>, I3dl2ReverbBlockSize> late_samples{};
+        std::array<ReverbFdnSamples, I3dl2ReverbBlockSize> allpass_samples{};
 
-        for (u32 early_tap = 0; early_tap < I3dl2ReverbInfo::MaxDelayTaps; early_tap++) {
-            output_samples[tap_indexes[early_tap]] +=
-                state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
-                EarlyGains[early_tap];
-            if constexpr (NumChannels == 6) {
-                output_samples[static_cast<u32>(Channels::LFE)] +=
+        for (u32 block_index = 0; block_index < block_count; block_index++) {
+            const u32 sample_index{block_start + block_index};
+            auto& output_samples{early_samples[block_index]};
+
+            Common::FixedPoint<50, 14> early_to_late_tap{
+                state.early_delay_line.TapOut(state.early_to_late_taps)};
+
+            for (u32 early_tap = 0; early_tap < I3dl2ReverbInfo::MaxDelayTaps; early_tap++) {
+                output_samples[tap_indexes[early_tap]] +=
                     state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
                     EarlyGains[early_tap];
+                if constexpr (NumChannels == 6) {
+                    output_samples[static_cast<u32>(Channels::LFE)] +=
+                        state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
+                        EarlyGains[early_tap];
+                }
             }
-        }
-
-        Common::FixedPoint<50, 14> current_sample{};
-        for (u32 channel = 0; channel < NumChannels; channel++) {
-            current_sample += inputs[channel][sample_index];
-        }
 
-        state.lowpass_0 =
-            (current_sample * state.lowpass_2 + state.lowpass_0 * state.lowpass_1).to_float();
-        state.early_delay_line.Tick(state.lowpass_0);
+            Common::FixedPoint<50, 14> current_sample{};
+            for (u32 channel = 0; channel < NumChannels; channel++) {
+                current_sample += inputs[channel][sample_index];
+            }
 
-        for (u32 channel = 0; channel < NumChannels; channel++) {
-            output_samples[channel] *= state.early_gain;
-        }
+            state.lowpass_0 =
+                (current_sample * state.lowpass_2 + state.lowpass_0 * state.lowpass_1).to_float();
+            state.early_delay_line.Tick(state.lowpass_0);
 
-        std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> filtered_samples{};
-        for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
-            filtered_samples[delay_line] =
-                state.fdn_delay_lines[delay_line].Read() * state.lowpass_coeff[delay_line][0] +
-                state.shelf_filter[delay_line];
-            state.shelf_filter[delay_line] =
-                (filtered_samples[delay_line] * state.lowpass_coeff[delay_line][2] +
-                 state.fdn_delay_lines[delay_line].Read() * state.lowpass_coeff[delay_line][1])
-                    .to_float();
-        }
+            for (u32 channel = 0; channel < NumChannels; channel++) {
+                output_samples[channel] *= state.early_gain;
+            }
 
-        const std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> mix_matrix{
-            filtered_samples[1] + filtered_samples[2] + early_to_late_tap * state.late_gain,
-            -filtered_samples[0] - filtered_samples[3] + early_to_late_tap * state.late_gain,
-            filtered_samples[0] - filtered_samples[3] + early_to_late_tap * state.late_gain,
-            filtered_samples[1] - filtered_samples[2] + early_to_late_tap * state.late_gain,
-        };
-
-        std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> allpass_samples{};
-        for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
-            allpass_samples[delay_line] = Axfx2AllPassTick(
-                state.decay_delay_lines0[delay_line], state.decay_delay_lines1[delay_line],
-                state.fdn_delay_lines[delay_line], mix_matrix[delay_line]);
+            late_samples[block_index] = early_to_late_tap * state.late_gain;
         }
 
-        if constexpr (NumChannels == 6) {
-            const std::array<Common::FixedPoint<50, 14>, MaxChannels> allpass_outputs{
-                allpass_samples[0], allpass_samples[1], allpass_samples[2] - allpass_samples[3],
-                allpass_samples[3], allpass_samples[2], allpass_samples[3],
-            };
+        ProcessI3dl2ReverbFdn(state, std::span(late_samples).first(block_count),
+                              std::span(allpass_samples).first(block_count));
 
-            for (u32 channel = 0; channel < NumChannels; channel++) {
-                Common::FixedPoint<50, 14> allpass{};
+        for (u32 block_index = 0; block_index < block_count; block_index++) {
+            const u32 sample_index{block_start + block_index};
+            const auto& output_samples{early_samples[block_index]};
+            const auto& allpass_sample{allpass_samples[block_index]};
 
-                if (channel == static_cast<u32>(Channels::Center)) {
-                    allpass = state.center_delay_line.Tick(allpass_outputs[channel] * 0.5f);
-                } else {
-                    allpass = allpass_outputs[channel];
+            if constexpr (NumChannels == 6) {
+                const std::array<Common::FixedPoint<50, 14>, MaxChannels> allpass_outputs{
+                    allpass_sample[0], allpass_sample[1], allpass_sample[2] - allpass_sample[3],
+                    allpass_sample[3], allpass_sample[2], allpass_sample[3],
+                };
+
+                for (u32 channel = 0; channel < NumChannels; channel++) {
+                    Common::FixedPoint<50, 14> allpass{};
+
+                    if (channel == static_cast<u32>(Channels::Center)) {
+                        allpass = state.center_delay_line.Tick(allpass_outputs[channel] * 0.5f);
+                    } else {
+                        allpass = allpass_outputs[channel];
+                    }
+
+                    auto out_sample{output_samples[channel] + allpass +
+                                    state.dry_gain *
+                                        static_cast<f32>(inputs[channel][sample_index])};
+
+                    outputs[channel][sample_index] = static_cast<s32>(
+                        std::clamp(out_sample.to_float(), -8388600.0f, 8388600.0f));
+                }
+            } else {
+                for (u32 channel = 0; channel < NumChannels; channel++) {
+                    auto out_sample{output_samples[channel] + allpass_sample[channel] +
+                                    state.dry_gain *
+                                        static_cast<f32>(inputs[channel][sample_index])};
+                    outputs[channel][sample_index] = static_cast<s32>(
+                        std::clamp(out_sample.to_float(), -8388600.0f, 8388600.0f));
                 }
-
-                auto out_sample{output_samples[channel] + allpass +
-                                state.dry_gain * static_cast<f32>(inputs[channel][sample_index])};
-
-                outputs[channel][sample_index] =
-                    static_cast<s32>(std::clamp(out_sample.to_float(), -8388600.0f, 8388600.0f));
-            }
-        } else {
-            for (u32 channel = 0; channel < NumChannels; channel++) {
-                auto out_sample{output_samples[channel] + allpass_samples[channel] +
-                                state.dry_gain * static_cast<f32>(inputs[channel][sample_index])};
-                outputs[channel][sample_index] =
-                    static_cast<s32>(std::clamp(out_sample.to_float(), -8388600.0f, 8388600.0f));
             }
         }
     }
@@ -1,15 +1,20 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <numbers>
 #include <ranges>
 
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/renderer/command/effect/reverb.h"
+#include "audio_core/renderer/command/effect/reverb_kernels.h"
 #include "common/polyfill_ranges.h"
 
 namespace AudioCore::Renderer {
 
+/// Number of samples the early reflections are done for before running the late reverb
+constexpr u32 ReverbBlockSize = 64;
+
 constexpr std::array<f32, ReverbInfo::MaxDelayLines> FdnMaxDelayLineTimes = {
     53.9532470703125f,
     79.19256591796875f,
@@ -217,23 +222,14 @@ static void ApplyReverbEffectBypass(std::span<std::span<const s32>> inputs,
 }
 
 /**
- * Tick the delay lines, reading and returning their current output, and writing a new decaying
- * sample (mix).
+ * Divide a sample by 64, the same as FixedPoint division truncating towards zero, without going
+ * through a 128 bit division.
  *
- * @param decay  - The decay line.
- * @param fdn    - Feedback delay network.
- * @param mix    - The new calculated sample to be written and decayed.
- * @return The next delayed and decayed sample.
+ * @param sample - Sample to divide.
+ * @return The divided sample.
  */
-static Common::FixedPoint<50, 14> Axfx2AllPassTick(ReverbInfo::ReverbDelayLine& decay,
-                                                   ReverbInfo::ReverbDelayLine& fdn,
-                                                   const Common::FixedPoint<50, 14> mix) {
-    const auto val{decay.Read()};
-    const auto mixed{mix - (val * decay.decay)};
-    const auto out{decay.Tick(mixed) + (mixed * decay.decay)};
-
-    fdn.Tick(out);
-    return out;
+static Common::FixedPoint<50, 14> DivideBy64(const Common::FixedPoint<50, 14> sample) {
+    return Common::FixedPoint<50, 14>::from_base(sample.to_raw() / 64);
 }
 
 /**
@@ -276,82 +272,85 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
         tap_indexes = OutTapIndexes6Ch;
     }
 
-    for (u32 sample_index = 0; sample_index < sample_count; sample_index++) {
-        std::array<Common::FixedPoint<50, 14>, NumChannels> output_samples{};
+    const auto dry_gain{Common::FixedPoint<50, 14>::from_base(params.dry_gain)};
+    const auto wet_gain{Common::FixedPoint<50, 14>::from_base(params.wet_gain)};
+    const auto base_gain{Common::FixedPoint<50, 14>::from_base(params.base_gain)};
+    const auto late_gain{Common::FixedPoint<50, 14>::from_base(params.late_gain)};
+
+    // The early reflections only depend on the input, so they're done for a whole block before
+    // running the feedback delay network over it
+    for (u32 block_start = 0; block_start < sample_count; block_start += ReverbBlockSize) {
+        const u32 block_count{std::min(ReverbBlockSize, sample_count - block_start)};
+        std::array<std::array<Common::FixedPoint<50, 14>, NumChannels>, ReverbBlockSize>
+            early_samples{};
+        std::array<Common::FixedPoint<50, 14>, ReverbBlockSize> late_samples{};
+        std::array<ReverbFdnSamples, ReverbBlockSize> allpass_samples{};
+
+        for (u32 block_index = 0; block_index < block_count; block_index++) {
+            const u32 sample_index{block_start + block_index};
+            auto& output_samples{early_samples[block_index]};
+
+            for (u32 early_tap = 0; early_tap < ReverbInfo::MaxDelayTaps; early_tap++) {
+                const auto sample{
+                    state.pre_delay_line.TapOut(state.early_delay_times[early_tap]) *
+                    state.early_gains[early_tap]};
+                output_samples[tap_indexes[early_tap]] += sample;
+                if constexpr (NumChannels == 6) {
+                    output_samples[static_cast<u32>(Channels::LFE)] += sample;
+                }
+            }
 
-        for (u32 early_tap = 0; early_tap < ReverbInfo::MaxDelayTaps; early_tap++) {
-            const auto sample{state.pre_delay_line.TapOut(state.early_delay_times[early_tap]) *
-                              state.early_gains[early_tap]};
-            output_samples[tap_indexes[early_tap]] += sample;
             if constexpr (NumChannels == 6) {
-                output_samples[static_cast<u32>(Channels::LFE)] += sample;
+                output_samples[static_cast<u32>(Channels::LFE)] *= 0.2f;
             }
-        }
-
-        if constexpr (NumChannels == 6) {
-            output_samples[static_cast<u32>(Channels::LFE)] *= 0.2f;
-        }
 
-        Common::FixedPoint<50, 14> input_sample{};
-        for (u32 channel = 0; channel < NumChannels; channel++) {
-            input_sample += inputs[channel][sample_index];
-        }
+            Common::FixedPoint<50, 14> input_sample{};
+            for (u32 channel = 0; channel < NumChannels; channel++) {
+                input_sample += inputs[channel][sample_index];
+            }
 
-        input_sample *= 64;
-        input_sample *= Common::FixedPoint<50, 14>::from_base(params.base_gain);
-        state.pre_delay_line.Write(input_sample);
+            input_sample *= 64;
+            input_sample *= base_gain;
+            state.pre_delay_line.Write(input_sample);
 
-        for (u32 i = 0; i < ReverbInfo::MaxDelayLines; i++) {
-            state.prev_feedback_output[i] =
-                state.prev_feedback_output[i] * state.hf_decay_prev_gain[i] +
-                state.fdn_delay_lines[i].Read() * state.hf_decay_gain[i];
+            late_samples[block_index] =
+                state.pre_delay_line.TapOut(state.pre_delay_time) * late_gain;
         }
 
-        Common::FixedPoint<50, 14> pre_delay_sample{
-            state.pre_delay_line.TapOut(state.pre_delay_time) *
-            Common::FixedPoint<50, 14>::from_base(params.late_gain)};
-
-        std::array<Common::FixedPoint<50, 14>, ReverbInfo::MaxDelayLines> mix_matrix{
-            state.prev_feedback_output[2] + state.prev_feedback_output[1] + pre_delay_sample,
-            -state.prev_feedback_output[0] - state.prev_feedback_output[3] + pre_delay_sample,
-            state.prev_feedback_output[0] - state.prev_feedback_output[3] + pre_delay_sample,
-            state.prev_feedback_output[1] - state.prev_feedback_output[2] + pre_delay_sample,
-        };
-
-        std::array<Common::FixedPoint<50, 14>, ReverbInfo::MaxDelayLines> allpass_samples{};
-        for (u32 i = 0; i < ReverbInfo::MaxDelayLines; i++) {
-            allpass_samples[i] = Axfx2AllPassTick(state.decay_delay_lines[i],
-                                                  state.fdn_delay_lines[i], mix_matrix[i]);
-        }
+        ProcessReverbFdn(state, std::span(late_samples).first(block_count),
+                         std::span(allpass_samples).first(block_count));
 
-        const auto dry_gain{Common::FixedPoint<50, 14>::from_base(params.dry_gain)};
-        const auto wet_gain{Common::FixedPoint<50, 14>::from_base(params.wet_gain)};
+        for (u32 block_index = 0; block_index < block_count; block_index++) {
+            const u32 sample_index{block_start + block_index};
+            const auto& output_samples{early_samples[block_index]};
+            const auto& allpass_sample{allpass_samples[block_index]};
 
-        if constexpr (NumChannels == 6) {
-            const std::array<Common::FixedPoint<50, 14>, MaxChannels> allpass_outputs{
-                allpass_samples[0], allpass_samples[1], allpass_samples[2] - allpass_samples[3],
-                allpass_samples[3], allpass_samples[2], allpass_samples[3],
-            };
-
-            for (u32 channel = 0; channel < NumChannels; channel++) {
-                auto in_sample{inputs[channel][sample_index] * dry_gain};
-
-                Common::FixedPoint<50, 14> allpass{};
-                if (channel == static_cast<u32>(Channels::Center)) {
-                    allpass = state.center_delay_line.Tick(allpass_outputs[channel] * 0.5f);
-                } else {
-                    allpass = allpass_outputs[channel];
+            if constexpr (NumChannels == 6) {
+                const std::array<Common::FixedPoint<50, 14>, MaxChannels> allpass_outputs{
+                    allpass_sample[0], allpass_sample[1], allpass_sample[2] - allpass_sample[3],
+                    allpass_sample[3], allpass_sample[2], allpass_sample[3],
+                };
+
+                for (u32 channel = 0; channel < NumChannels; channel++) {
+                    auto in_sample{inputs[channel][sample_index] * dry_gain};
+
+                    Common::FixedPoint<50, 14> allpass{};
+                    if (channel == static_cast<u32>(Channels::Center)) {
+                        allpass = state.center_delay_line.Tick(allpass_outputs[channel] * 0.5f);
+                    } else {
+                        allpass = allpass_outputs[channel];
+                    }
+
+                    auto out_sample{DivideBy64((output_samples[channel] + allpass) * wet_gain)};
+                    outputs[channel][sample_index] = (in_sample + out_sample).to_int();
+                }
+            } else {
+                for (u32 channel = 0; channel < NumChannels; channel++) {
+                    auto in_sample{inputs[channel][sample_index] * dry_gain};
+                    auto out_sample{
+                        DivideBy64((output_samples[channel] + allpass_sample[channel]) * wet_gain)};
+                    outputs[channel][sample_index] = (in_sample + out_sample).to_int();
                 }
-
-                auto out_sample{((output_samples[channel] + allpass) * wet_gain) / 64};
-                outputs[channel][sample_index] = (in_sample + out_sample).to_int();
-            }
-        } else {
-            for (u32 channel = 0; channel < NumChannels; channel++) {
-                auto in_sample{inputs[channel][sample_index] * dry_gain};
-                auto out_sample{((output_samples[channel] + allpass_samples[channel]) * wet_gain) /
-                                64};
-                outputs[channel][sample_index] = (in_sample + out_sample).to_int();
             }
         }
     }
@@ -0,0 +1,511 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <limits>
+
+#include "audio_core/renderer/command/effect/reverb_kernels.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define VECTOR_TARGET __attribute__((target("avx2")))
+#else
+#define VECTOR_TARGET
+#endif
+
+namespace AudioCore::Renderer {
+namespace {
+
+using Sample = Common::FixedPoint<50, 14>;
+
+constexpr size_t FractionalBits = Sample::fractional_bits;
+
+/**
+ * Tick the delay lines, reading and returning their current output, and writing a new decaying
+ * sample (mix).
+ *
+ * @param decay  - The decay line.
+ * @param fdn    - Feedback delay network.
+ * @param mix    - The new calculated sample to be written and decayed.
+ * @return The next delayed and decayed sample.
+ */
+Sample Axfx2AllPassTick(ReverbInfo::ReverbDelayLine& decay, ReverbInfo::ReverbDelayLine& fdn,
+                        const Sample mix) {
+    const auto val{decay.Read()};
+    const auto mixed{mix - (val * decay.decay)};
+    const auto out{decay.Tick(mixed) + (mixed * decay.decay)};
+
+    fdn.Tick(out);
+    return out;
+}
+
+/**
+ * Tick the delay lines, reading and returning their current output, and writing a new decaying
+ * sample (mix).
+ *
+ * @param decay0 - The first decay line.
+ * @param decay1 - The second decay line.
+ * @param fdn    - Feedback delay network.
+ * @param mix    - The new calculated sample to be written and decayed.
+ * @return The next delayed and decayed sample.
+ */
+Sample Axfx2AllPassTick(I3dl2ReverbInfo::I3dl2DelayLine& decay0,
+                        I3dl2ReverbInfo::I3dl2DelayLine& decay1,
+                        I3dl2ReverbInfo::I3dl2DelayLine& fdn, const Sample mix) {
+    auto val{decay0.Read()};
+    auto mixed{mix - (val * decay0.wet_gain)};
+    auto out{decay0.Tick(mixed) + (mixed * decay0.wet_gain)};
+
+    val = decay1.Read();
+    mixed = out - (val * decay1.wet_gain);
+    out = decay1.Tick(mixed) + (mixed * decay1.wet_gain);
+
+    fdn.Tick(out);
+    return out;
+}
+
+void ProcessReverbFdnSample(ReverbInfo::State& state, const Sample input,
+                            ReverbFdnSamples& output) {
+    for (u32 i = 0; i < ReverbInfo::MaxDelayLines; i++) {
+        state.prev_feedback_output[i] =
+            state.prev_feedback_output[i] * state.hf_decay_prev_gain[i] +
+            state.fdn_delay_lines[i].Read() * state.hf_decay_gain[i];
+    }
+
+    const std::array<Sample, ReverbInfo::MaxDelayLines> mix_matrix{
+        state.prev_feedback_output[2] + state.prev_feedback_output[1] + input,
+        -state.prev_feedback_output[0] - state.prev_feedback_output[3] + input,
+        state.prev_feedback_output[0] - state.prev_feedback_output[3] + input,
+        state.prev_feedback_output[1] - state.prev_feedback_output[2] + input,
+    };
+
+    for (u32 i = 0; i < ReverbInfo::MaxDelayLines; i++) {
+        output[i] =
+            Axfx2AllPassTick(state.decay_delay_lines[i], state.fdn_delay_lines[i], mix_matrix[i]);
+    }
+}
+
+void ProcessI3dl2ReverbFdnSample(I3dl2ReverbInfo::State& state, const Sample input,
+                                 ReverbFdnSamples& output) {
+    std::array<Sample, I3dl2ReverbInfo::MaxDelayLines> filtered_samples{};
+    for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
+        filtered_samples[delay_line] =
+            state.fdn_delay_lines[delay_line].Read() * state.lowpass_coeff[delay_line][0] +
+            state.shelf_filter[delay_line];
+        state.shelf_filter[delay_line] =
+            (filtered_samples[delay_line] * state.lowpass_coeff[delay_line][2] +
+             state.fdn_delay_lines[delay_line].Read() * state.lowpass_coeff[delay_line][1])
+                .to_float();
+    }
+
+    const std::array<Sample, I3dl2ReverbInfo::MaxDelayLines> mix_matrix{
+        filtered_samples[1] + filtered_samples[2] + input,
+        -filtered_samples[0] - filtered_samples[3] + input,
+        filtered_samples[0] - filtered_samples[3] + input,
+        filtered_samples[1] - filtered_samples[2] + input,
+    };
+
+    for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
+        output[delay_line] = Axfx2AllPassTick(
+            state.decay_delay_lines0[delay_line], state.decay_delay_lines1[delay_line],
+            state.fdn_delay_lines[delay_line], mix_matrix[delay_line]);
+    }
+}
+
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+/*
+ * A lane holds the raw value of a sample for each delay line. Multiplying by a gain gives the low
+ * 64 bits of the product shifted right by the fractional bits, like FixedPoint does, by splitting
+ * the sample in two 32 bit halves: (high * gain << (32 - F)) + (low * gain >> F) is exact, as the
+ * unsigned low half times a 32 bit gain fits in 64 bits once corrected for negative gains.
+ *
+ * Conversions between samples and floats go through doubles, which hold every sample below
+ * ExactRange exactly, so the result is rounded once like the scalar conversions. The I3DL2 kernel
+ * falls back to the scalar one for a sample where a conversion is out of that range.
+ */
+
+using LaneArray = std::array<s64, ReverbFdnLineCount>;
+using FloatLaneArray = std::array<f32, ReverbFdnLineCount>;
+
+constexpr s64 ExactRange = s64{1} << 51;
+
+/// The vector kernels multiply by gains with 32 bit multiplies, larger ones use the scalar kernel
+bool FitsInS32(const Sample gain) {
+    return gain.to_raw() >= std::numeric_limits<s32>::min() &&
+           gain.to_raw() <= std::numeric_limits<s32>::max();
+}
+
+bool UseVectorKernel(MixKernelIsa isa) {
+#if defined(ARCHITECTURE_x86_64)
+    return isa == MixKernelIsa::Avx2;
+#else
+    return isa == MixKernelIsa::Neon;
+#endif
+}
+
+#if defined(ARCHITECTURE_x86_64)
+using Lanes = __m256i;
+using FloatLanes = __m128;
+
+/// Doubles in [2^52, 2^53) have integer steps, adding this takes integers in and out of them
+constexpr f64 IntegerMagic = 0x1.8p52;
+
+VECTOR_TARGET Lanes LoadLanes(const LaneArray& values) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data()));
+}
+
+VECTOR_TARGET void StoreLanes(LaneArray& values, Lanes lanes) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values.data()), lanes);
+}
+
+VECTOR_TARGET Lanes BroadcastLanes(s64 value) {
+    return _mm256_set1_epi64x(value);
+}
+
+VECTOR_TARGET Lanes AddLanes(Lanes lhs, Lanes rhs) {
+    return _mm256_add_epi64(lhs, rhs);
+}
+
+VECTOR_TARGET Lanes SubLanes(Lanes lhs, Lanes rhs) {
+    return _mm256_sub_epi64(lhs, rhs);
+}
+
+struct LaneGain {
+    Lanes value;
+    Lanes negative;
+};
+
+VECTOR_TARGET LaneGain MakeLaneGain(const LaneArray& gains) {
+    const Lanes value = LoadLanes(gains);
+    return {value, _mm256_cmpgt_epi64(_mm256_setzero_si256(), value)};
+}
+
+VECTOR_TARGET Lanes MultiplyLanes(Lanes samples, const LaneGain& gain) {
+    const __m256i high = _mm256_mul_epi32(_mm256_srli_epi64(samples, 32), gain.value);
+    const __m256i low = _mm256_sub_epi64(
+        _mm256_mul_epu32(samples, gain.value),
+        _mm256_and_si256(_mm256_slli_epi64(samples, 32), gain.negative));
+    // AVX2 has no 64 bit arithmetic shift, flip the shifted sign bit and subtract it to extend it
+    const __m256i sign = _mm256_set1_epi64x(s64{1} << (63 - FractionalBits));
+    const __m256i low_shifted =
+        _mm256_sub_epi64(_mm256_xor_si256(_mm256_srli_epi64(low, FractionalBits), sign), sign);
+    return _mm256_add_epi64(_mm256_slli_epi64(high, 32 - FractionalBits), low_shifted);
+}
+
+/// Mix the delay line outputs with the input: {o2 + o1, -o0 - o3, o0 - o3, o1 - o2} + input
+VECTOR_TARGET Lanes MixLanes(Lanes outputs, Lanes input) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lhs = _mm256_permute4x64_epi64(outputs, _MM_SHUFFLE(1, 0, 0, 2));
+    const __m256i rhs = _mm256_permute4x64_epi64(outputs, _MM_SHUFFLE(2, 3, 3, 1));
+    const __m256i lhs_signed = _mm256_blend_epi32(lhs, _mm256_sub_epi64(zero, lhs), 0x0C);
+    const __m256i rhs_signed = _mm256_blend_epi32(rhs, _mm256_sub_epi64(zero, rhs), 0xFC);
+    return _mm256_add_epi64(_mm256_add_epi64(lhs_signed, rhs_signed), input);
+}
+
+VECTOR_TARGET FloatLanes LoadFloatLanes(const FloatLaneArray& values) {
+    return _mm_loadu_ps(values.data());
+}
+
+VECTOR_TARGET void StoreFloatLanes(FloatLaneArray& values, FloatLanes lanes) {
+    _mm_storeu_ps(values.data(), lanes);
+}
+
+/// Convert floats to samples like Sample(f32), fails if one is out of the exact range
+VECTOR_TARGET bool FloatToSampleLanes(FloatLanes values, Lanes& samples) {
+    const __m256d scaled = _mm256_round_pd(
+        _mm256_cvtps_pd(_mm_mul_ps(values, _mm_set1_ps(static_cast<f32>(Sample::one)))),
+        _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m256d magnitude = _mm256_andnot_pd(_mm256_set1_pd(-0.0), scaled);
+    const __m256d in_range =
+        _mm256_cmp_pd(magnitude, _mm256_set1_pd(static_cast<f64>(ExactRange)), _CMP_LT_OQ);
+    if (_mm256_movemask_pd(in_range) != 0xF) {
+        return false;
+    }
+    const __m256d magic = _mm256_set1_pd(IntegerMagic);
+    samples = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(scaled, magic)),
+                               _mm256_castpd_si256(magic));
+    return true;
+}
+
+/// Convert samples to floats like Sample::to_float, fails if one is out of the exact range
+VECTOR_TARGET bool SampleToFloatLanes(Lanes samples, FloatLanes& values) {
+    const __m256i out_of_range =
+        _mm256_srli_epi64(_mm256_add_epi64(samples, _mm256_set1_epi64x(ExactRange)), 52);
+    if (!_mm256_testz_si256(out_of_range, out_of_range)) {
+        return false;
+    }
+    const __m256d magic = _mm256_set1_pd(IntegerMagic);
+    const __m256d exact = _mm256_sub_pd(
+        _mm256_castsi256_pd(_mm256_add_epi64(samples, _mm256_castpd_si256(magic))), magic);
+    values = _mm_div_ps(_mm256_cvtpd_ps(exact), _mm_set1_ps(static_cast<f32>(Sample::one)));
+    return true;
+}
+#elif defined(ARCHITECTURE_arm64)
+struct Lanes {
+    int64x2_t low;
+    int64x2_t high;
+};
+using FloatLanes = float32x4_t;
+
+Lanes LoadLanes(const LaneArray& values) {
+    return {vld1q_s64(values.data()), vld1q_s64(values.data() + 2)};
+}
+
+void StoreLanes(LaneArray& values, Lanes lanes) {
+    vst1q_s64(values.data(), lanes.low);
+    vst1q_s64(values.data() + 2, lanes.high);
+}
+
+Lanes BroadcastLanes(s64 value) {
+    return {vdupq_n_s64(value), vdupq_n_s64(value)};
+}
+
+Lanes AddLanes(Lanes lhs, Lanes rhs) {
+    return {vaddq_s64(lhs.low, rhs.low), vaddq_s64(lhs.high, rhs.high)};
+}
+
+Lanes SubLanes(Lanes lhs, Lanes rhs) {
+    return {vsubq_s64(lhs.low, rhs.low), vsubq_s64(lhs.high, rhs.high)};
+}
+
+struct LaneGain {
+    Lanes value;
+    Lanes negative;
+};
+
+LaneGain MakeLaneGain(const LaneArray& gains) {
+    const Lanes value = LoadLanes(gains);
+    return {value,
+            {vreinterpretq_s64_u64(vcltzq_s64(value.low)),
+             vreinterpretq_s64_u64(vcltzq_s64(value.high))}};
+}
+
+int64x2_t MultiplyHalf(int64x2_t samples, int64x2_t gain, int64x2_t negative) {
+    const int32x2_t gain_low = vmovn_s64(gain);
+    const int64x2_t high = vmull_s32(vshrn_n_s64(samples, 32), gain_low);
+    const uint64x2_t unsigned_low =
+        vmull_u32(vreinterpret_u32_s32(vmovn_s64(samples)), vreinterpret_u32_s32(gain_low));
+    const int64x2_t low = vsubq_s64(vreinterpretq_s64_u64(unsigned_low),
+                                    vandq_s64(vshlq_n_s64(samples, 32), negative));
+    return vaddq_s64(vshlq_n_s64(high, 32 - FractionalBits), vshrq_n_s64(low, FractionalBits));
+}
+
+Lanes MultiplyLanes(Lanes samples, const LaneGain& gain) {
+    return {MultiplyHalf(samples.low, gain.value.low, gain.negative.low),
+            MultiplyHalf(samples.high, gain.value.high, gain.negative.high)};
+}
+
+/// Mix the delay line outputs with the input: {o2 + o1, -o0 - o3, o0 - o3, o1 - o2} + input
+Lanes MixLanes(Lanes outputs, Lanes input) {
+    const int64x1_t o0 = vget_low_s64(outputs.low);
+    const int64x1_t o1 = vget_high_s64(outputs.low);
+    const int64x1_t o2 = vget_low_s64(outputs.high);
+    const int64x1_t o3 = vget_high_s64(outputs.high);
+    const int64x2_t low = vaddq_s64(vcombine_s64(o2, vneg_s64(o0)), vcombine_s64(o1, vneg_s64(o3)));
+    const int64x2_t high = vsubq_s64(outputs.low, vcombine_s64(o3, o2));
+    return {vaddq_s64(low, input.low), vaddq_s64(high, input.high)};
+}
+
+FloatLanes LoadFloatLanes(const FloatLaneArray& values) {
+    return vld1q_f32(values.data());
+}
+
+void StoreFloatLanes(FloatLaneArray& values, FloatLanes lanes) {
+    vst1q_f32(values.data(), lanes);
+}
+
+/// Convert floats to samples like Sample(f32), both truncate with the same instruction
+bool FloatToSampleLanes(FloatLanes values, Lanes& samples) {
+    const float32x4_t scaled = vmulq_n_f32(values, static_cast<f32>(Sample::one));
+    samples = {vcvtq_s64_f64(vcvt_f64_f32(vget_low_f32(scaled))),
+               vcvtq_s64_f64(vcvt_high_f64_f32(scaled))};
+    return true;
+}
+
+/// Convert samples to floats like Sample::to_float, fails if one is out of the exact range
+bool SampleToFloatLanes(Lanes samples, FloatLanes& values) {
+    const int64x2_t range = vdupq_n_s64(ExactRange);
+    const uint64x2_t out_of_range =
+        vorrq_u64(vshrq_n_u64(vreinterpretq_u64_s64(vaddq_s64(samples.low, range)), 52),
+                  vshrq_n_u64(vreinterpretq_u64_s64(vaddq_s64(samples.high, range)), 52));
+    if ((vgetq_lane_u64(out_of_range, 0) | vgetq_lane_u64(out_of_range, 1)) != 0) {
+        return false;
+    }
+    const float32x4_t converted = vcombine_f32(vcvt_f32_f64(vcvtq_f64_s64(samples.low)),
+                                               vcvt_f32_f64(vcvtq_f64_s64(samples.high)));
+    values = vdivq_f32(converted, vdupq_n_f32(static_cast<f32>(Sample::one)));
+    return true;
+}
+#endif
+
+VECTOR_TARGET void ProcessReverbFdnVector(ReverbInfo::State& state, std::span<const Sample> inputs,
+                                          std::span<ReverbFdnSamples> outputs) {
+    LaneArray prev_gains{};
+    LaneArray gains{};
+    LaneArray decays{};
+    LaneArray feedback_values{};
+    for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+        prev_gains[i] = state.hf_decay_prev_gain[i].to_raw();
+        gains[i] = state.hf_decay_gain[i].to_raw();
+        decays[i] = state.decay_delay_lines[i].decay.to_raw();
+        feedback_values[i] = state.prev_feedback_output[i].to_raw();
+    }
+    const LaneGain prev_gain = MakeLaneGain(prev_gains);
+    const LaneGain gain = MakeLaneGain(gains);
+    const LaneGain decay = MakeLaneGain(decays);
+    Lanes feedback = LoadLanes(feedback_values);
+
+    for (size_t sample = 0; sample < inputs.size(); sample++) {
+        LaneArray fdn_outputs;
+        LaneArray decay_outputs;
+        for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+            fdn_outputs[i] = state.fdn_delay_lines[i].Read().to_raw();
+            decay_outputs[i] = state.decay_delay_lines[i].Read().to_raw();
+        }
+
+        feedback = AddLanes(MultiplyLanes(feedback, prev_gain),
+                            MultiplyLanes(LoadLanes(fdn_outputs), gain));
+        const Lanes mix = MixLanes(feedback, BroadcastLanes(inputs[sample].to_raw()));
+        const Lanes decayed = LoadLanes(decay_outputs);
+        const Lanes mixed = SubLanes(mix, MultiplyLanes(decayed, decay));
+        const Lanes out = AddLanes(decayed, MultiplyLanes(mixed, decay));
+
+        LaneArray mixed_values;
+        LaneArray out_values;
+        StoreLanes(mixed_values, mixed);
+        StoreLanes(out_values, out);
+        for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+            state.decay_delay_lines[i].Tick(Sample::from_base(mixed_values[i]));
+            state.fdn_delay_lines[i].Tick(Sample::from_base(out_values[i]));
+            outputs[sample][i] = Sample::from_base(out_values[i]);
+        }
+    }
+
+    StoreLanes(feedback_values, feedback);
+    for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+        state.prev_feedback_output[i] = Sample::from_base(feedback_values[i]);
+    }
+}
+
+VECTOR_TARGET void ProcessI3dl2ReverbFdnVector(I3dl2ReverbInfo::State& state,
+                                               std::span<const Sample> inputs,
+                                               std::span<ReverbFdnSamples> outputs) {
+    std::array<LaneArray, 3> coeffs{};
+    LaneArray wet_gains0{};
+    LaneArray wet_gains1{};
+    for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+        for (u32 coeff = 0; coeff < coeffs.size(); coeff++) {
+            coeffs[coeff][i] = Sample{state.lowpass_coeff[i][coeff]}.to_raw();
+        }
+        wet_gains0[i] = Sample{state.decay_delay_lines0[i].wet_gain}.to_raw();
+        wet_gains1[i] = Sample{state.decay_delay_lines1[i].wet_gain}.to_raw();
+    }
+    const LaneGain coeff0 = MakeLaneGain(coeffs[0]);
+    const LaneGain coeff1 = MakeLaneGain(coeffs[1]);
+    const LaneGain coeff2 = MakeLaneGain(coeffs[2]);
+    const LaneGain wet_gain0 = MakeLaneGain(wet_gains0);
+    const LaneGain wet_gain1 = MakeLaneGain(wet_gains1);
+
+    for (size_t sample = 0; sample < inputs.size(); sample++) {
+        LaneArray fdn_outputs;
+        LaneArray decay0_outputs;
+        LaneArray decay1_outputs;
+        for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+            fdn_outputs[i] = state.fdn_delay_lines[i].Read().to_raw();
+            decay0_outputs[i] = state.decay_delay_lines0[i].Read().to_raw();
+            decay1_outputs[i] = state.decay_delay_lines1[i].Read().to_raw();
+        }
+
+        // Nothing is written before the conversions succeed, so the sample can be redone
+        const Lanes fdn = LoadLanes(fdn_outputs);
+        Lanes shelf;
+        FloatLanes next_shelf;
+        if (!FloatToSampleLanes(LoadFloatLanes(state.shelf_filter), shelf)) {
+            ProcessI3dl2ReverbFdnSample(state, inputs[sample], outputs[sample]);
+            continue;
+        }
+        const Lanes filtered = AddLanes(MultiplyLanes(fdn, coeff0), shelf);
+        if (!SampleToFloatLanes(
+                AddLanes(MultiplyLanes(filtered, coeff2), MultiplyLanes(fdn, coeff1)),
+                next_shelf)) {
+            ProcessI3dl2ReverbFdnSample(state, inputs[sample], outputs[sample]);
+            continue;
+        }
+        StoreFloatLanes(state.shelf_filter, next_shelf);
+
+        const Lanes mix = MixLanes(filtered, BroadcastLanes(inputs[sample].to_raw()));
+
+        // The I3DL2 delay lines write before reading, so ticking returns the value just written
+        // when the line has no delay
+        const Lanes decayed0 = LoadLanes(decay0_outputs);
+        const Lanes mixed0 = SubLanes(mix, MultiplyLanes(decayed0, wet_gain0));
+        LaneArray values;
+        StoreLanes(values, mixed0);
+        for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+            values[i] = state.decay_delay_lines0[i].Tick(Sample::from_base(values[i])).to_raw();
+        }
+        const Lanes out0 = AddLanes(LoadLanes(values), MultiplyLanes(mixed0, wet_gain0));
+
+        const Lanes decayed1 = LoadLanes(decay1_outputs);
+        const Lanes mixed1 = SubLanes(out0, MultiplyLanes(decayed1, wet_gain1));
+        StoreLanes(values, mixed1);
+        for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+            values[i] = state.decay_delay_lines1[i].Tick(Sample::from_base(values[i])).to_raw();
+        }
+        const Lanes out1 = AddLanes(LoadLanes(values), MultiplyLanes(mixed1, wet_gain1));
+
+        StoreLanes(values, out1);
+        for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+            state.fdn_delay_lines[i].Tick(Sample::from_base(values[i]));
+            outputs[sample][i] = Sample::from_base(values[i]);
+        }
+    }
+}
+#endif
+
+} // Anonymous namespace
+
+void ProcessReverbFdn(ReverbInfo::State& state, std::span<const Sample> inputs,
+                      std::span<ReverbFdnSamples> outputs, MixKernelIsa isa) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    bool gains_fit{true};
+    for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+        gains_fit &= FitsInS32(state.hf_decay_prev_gain[i]) && FitsInS32(state.hf_decay_gain[i]) &&
+                     FitsInS32(state.decay_delay_lines[i].decay);
+    }
+    if (UseVectorKernel(isa) && gains_fit) {
+        ProcessReverbFdnVector(state, inputs, outputs);
+        return;
+    }
+#endif
+    for (size_t sample = 0; sample < inputs.size(); sample++) {
+        ProcessReverbFdnSample(state, inputs[sample], outputs[sample]);
+    }
+}
+
+void ProcessI3dl2ReverbFdn(I3dl2ReverbInfo::State& state, std::span<const Sample> inputs,
+                           std::span<ReverbFdnSamples> outputs, MixKernelIsa isa) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    bool gains_fit{true};
+    for (u32 i = 0; i < ReverbFdnLineCount; i++) {
+        for (const auto coeff : state.lowpass_coeff[i]) {
+            gains_fit &= FitsInS32(Sample{coeff});
+        }
+        gains_fit &= FitsInS32(Sample{state.decay_delay_lines0[i].wet_gain}) &&
+                     FitsInS32(Sample{state.decay_delay_lines1[i].wet_gain});
+    }
+    if (UseVectorKernel(isa) && gains_fit) {
+        ProcessI3dl2ReverbFdnVector(state, inputs, outputs);
+        return;
+    }
+#endif
+    for (size_t sample = 0; sample < inputs.size(); sample++) {
+        ProcessI3dl2ReverbFdnSample(state, inputs[sample], outputs[sample]);
+    }
+}
+
+} // namespace AudioCore::Renderer
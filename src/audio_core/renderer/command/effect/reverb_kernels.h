@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <span>
+
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#include "audio_core/renderer/effect/i3dl2.h"
+#include "audio_core/renderer/effect/reverb.h"
+#include "common/common_types.h"
+#include "common/fixed_point.h"
+
+namespace AudioCore::Renderer {
+
+/// Number of delay lines in the feedback delay networks of the reverb effects
+constexpr size_t ReverbFdnLineCount = 4;
+static_assert(ReverbInfo::MaxDelayLines == ReverbFdnLineCount);
+static_assert(I3dl2ReverbInfo::MaxDelayLines == ReverbFdnLineCount);
+
+/// All-pass outputs of a feedback delay network for one sample, one per delay line
+using ReverbFdnSamples = std::array<Common::FixedPoint<50, 14>, ReverbFdnLineCount>;
+
+/*
+ * Late reverberation of the reverb effects. Each sample mixes the filtered outputs of the four
+ * delay lines with the late input, and feeds them back through the all-pass decay lines. The
+ * vector kernels run the four delay lines in parallel, and give the same results as the scalar
+ * kernel. Instruction sets without a vector kernel use the scalar one.
+ */
+
+/**
+ * Run the feedback delay network of a Reverb effect over a block of samples.
+ *
+ * @param state   - State of the effect, its delay lines are ticked once per sample.
+ * @param inputs  - Late input of each sample, the pre-delayed input with the late gain applied.
+ * @param outputs - Receives the all-pass outputs of each sample, same size as inputs.
+ * @param isa     - Instruction set to use, must be supported by the host.
+ */
+void ProcessReverbFdn(ReverbInfo::State& state,
+                      std::span<const Common::FixedPoint<50, 14>> inputs,
+                      std::span<ReverbFdnSamples> outputs,
+                      MixKernelIsa isa = GetBestMixKernelIsa());
+
+/**
+ * Run the feedback delay network of an I3DL2 reverb effect over a block of samples.
+ *
+ * @param state   - State of the effect, its delay lines are ticked once per sample.
+ * @param inputs  - Late input of each sample, the early to late tap with the late gain applied.
+ * @param outputs - Receives the all-pass outputs of each sample, same size as inputs.
+ * @param isa     - Instruction set to use, must be supported by the host.
+ */
+void ProcessI3dl2ReverbFdn(I3dl2ReverbInfo::State& state,
+                           std::span<const Common::FixedPoint<50, 14>> inputs,
+                           std::span<ReverbFdnSamples> outputs,
+                           MixKernelIsa isa = GetBestMixKernelIsa());
+
+} // namespace AudioCore::Renderer
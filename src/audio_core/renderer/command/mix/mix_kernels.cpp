@@ -0,0 +1,249 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <limits>
+
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define SSE41_TARGET __attribute__((target("sse4.1")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define SSE41_TARGET
+#define AVX2_TARGET
+#endif
+
+namespace AudioCore::Renderer {
+namespace {
+
+/*
+ * FixedPoint computes input * volume exactly in 64 bits, then to_int adds half of the fractional
+ * part before shifting it out. Mixing adds the output shifted up by Q bits first, which leaves
+ * the fraction alone, so the output can be added after rounding with the same 32 bit result.
+ *
+ * The vector kernels multiply 32 bit samples by 32 bit volumes, which covers every volume games
+ * use in practice. Ramps that leave that range go through the scalar kernel. Only the low 32 bits
+ * of the shifted products are kept, so logical shifts give the same result as arithmetic ones.
+ */
+
+template <size_t Q>
+constexpr s64 FractionMask = (s64{1} << Q) - 1;
+
+template <size_t Q>
+s32 RoundProduct(s32 sample, s64 volume) {
+    const u64 product = static_cast<u64>(s64{sample}) * static_cast<u64>(volume);
+    const u64 rounded = product + ((product & FractionMask<Q>) >> 1);
+    return static_cast<s32>(static_cast<s64>(rounded) >> Q);
+}
+
+s32 AddWrapping(s32 lhs, s32 rhs) {
+    return static_cast<s32>(static_cast<u32>(lhs) + static_cast<u32>(rhs));
+}
+
+bool FitsInS32(s64 value) {
+    return value >= std::numeric_limits<s32>::min() && value <= std::numeric_limits<s32>::max();
+}
+
+template <size_t Q, bool Accumulate>
+void ProcessScalar(s32* output, const s32* input, s64 volume, s64 ramp, u32 begin, u32 end) {
+    volume += static_cast<s64>(begin) * ramp;
+    for (u32 i = begin; i < end; i++) {
+        const s32 sample = RoundProduct<Q>(input[i], volume);
+        output[i] = Accumulate ? AddWrapping(output[i], sample) : sample;
+        volume += ramp;
+    }
+}
+
+#if defined(ARCHITECTURE_x86_64)
+template <size_t Q>
+SSE41_TARGET __m128i RoundProductsSse41(__m128i products) {
+    const __m128i fraction = _mm_and_si128(products, _mm_set1_epi64x(FractionMask<Q>));
+    return _mm_srli_epi64(_mm_add_epi64(products, _mm_srli_epi64(fraction, 1)), Q);
+}
+
+template <size_t Q, bool Accumulate>
+SSE41_TARGET u32 ProcessSse41(s32* output, const s32* input, s64 volume, s64 ramp, u32 count) {
+    const __m128i step = _mm_set1_epi64x(ramp * 4);
+    __m128i volume_even = _mm_set_epi64x(volume + ramp * 2, volume);
+    __m128i volume_odd = _mm_set_epi64x(volume + ramp * 3, volume + ramp);
+
+    u32 i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i even = RoundProductsSse41<Q>(_mm_mul_epi32(samples, volume_even));
+        const __m128i odd =
+            RoundProductsSse41<Q>(_mm_mul_epi32(_mm_srli_epi64(samples, 32), volume_odd));
+        __m128i result = _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+        if constexpr (Accumulate) {
+            result = _mm_add_epi32(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(output + i)), result);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), result);
+
+        volume_even = _mm_add_epi64(volume_even, step);
+        volume_odd = _mm_add_epi64(volume_odd, step);
+    }
+    return i;
+}
+
+template <size_t Q>
+AVX2_TARGET __m256i RoundProductsAvx2(__m256i products) {
+    const __m256i fraction = _mm256_and_si256(products, _mm256_set1_epi64x(FractionMask<Q>));
+    return _mm256_srli_epi64(_mm256_add_epi64(products, _mm256_srli_epi64(fraction, 1)), Q);
+}
+
+template <size_t Q, bool Accumulate>
+AVX2_TARGET u32 ProcessAvx2(s32* output, const s32* input, s64 volume, s64 ramp, u32 count) {
+    const __m256i step = _mm256_set1_epi64x(ramp * 8);
+    __m256i volume_even =
+        _mm256_set_epi64x(volume + ramp * 6, volume + ramp * 4, volume + ramp * 2, volume);
+    __m256i volume_odd = _mm256_set_epi64x(volume + ramp * 7, volume + ramp * 5,
+                                           volume + ramp * 3, volume + ramp);
+
+    u32 i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i samples = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        const __m256i even = RoundProductsAvx2<Q>(_mm256_mul_epi32(samples, volume_even));
+        const __m256i odd =
+            RoundProductsAvx2<Q>(_mm256_mul_epi32(_mm256_srli_epi64(samples, 32), volume_odd));
+        __m256i result = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+        if constexpr (Accumulate) {
+            result = _mm256_add_epi32(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(output + i)), result);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), result);
+
+        volume_even = _mm256_add_epi64(volume_even, step);
+        volume_odd = _mm256_add_epi64(volume_odd, step);
+    }
+    return i;
+}
+#elif defined(ARCHITECTURE_arm64)
+template <size_t Q>
+int32x2_t RoundProductsNeon(int64x2_t products) {
+    const uint64x2_t fraction =
+        vreinterpretq_u64_s64(vandq_s64(products, vdupq_n_s64(FractionMask<Q>)));
+    const int64x2_t round = vreinterpretq_s64_u64(vshrq_n_u64(fraction, 1));
+    return vshrn_n_s64(vaddq_s64(products, round), Q);
+}
+
+template <size_t Q, bool Accumulate>
+u32 ProcessNeon(s32* output, const s32* input, s64 volume, s64 ramp, u32 count) {
+    const int64x2_t step = vdupq_n_s64(ramp * 4);
+    const s64 low_volumes[2]{volume, volume + ramp};
+    const s64 high_volumes[2]{volume + ramp * 2, volume + ramp * 3};
+    int64x2_t volume_low = vld1q_s64(low_volumes);
+    int64x2_t volume_high = vld1q_s64(high_volumes);
+
+    u32 i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const int32x4_t samples = vld1q_s32(input + i);
+        const int64x2_t low = vmull_s32(vget_low_s32(samples), vmovn_s64(volume_low));
+        const int64x2_t high = vmull_s32(vget_high_s32(samples), vmovn_s64(volume_high));
+        int32x4_t result = vcombine_s32(RoundProductsNeon<Q>(low), RoundProductsNeon<Q>(high));
+        if constexpr (Accumulate) {
+            result = vaddq_s32(vld1q_s32(output + i), result);
+        }
+        vst1q_s32(output + i, result);
+
+        volume_low = vaddq_s64(volume_low, step);
+        volume_high = vaddq_s64(volume_high, step);
+    }
+    return i;
+}
+#endif
+
+template <size_t Q, bool Accumulate>
+void Process(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+             u32 sample_count, MixKernelIsa isa) {
+    s32* const out = output.data();
+    const s32* const in = input.data();
+
+    u32 processed = 0;
+    if (sample_count > 0 && FitsInS32(volume) &&
+        FitsInS32(volume + static_cast<s64>(sample_count - 1) * ramp)) {
+        switch (isa) {
+#if defined(ARCHITECTURE_x86_64)
+        case MixKernelIsa::Sse41:
+            processed = ProcessSse41<Q, Accumulate>(out, in, volume, ramp, sample_count);
+            break;
+        case MixKernelIsa::Avx2:
+            processed = ProcessAvx2<Q, Accumulate>(out, in, volume, ramp, sample_count);
+            break;
+#elif defined(ARCHITECTURE_arm64)
+        case MixKernelIsa::Neon:
+            processed = ProcessNeon<Q, Accumulate>(out, in, volume, ramp, sample_count);
+            break;
+#endif
+        default:
+            break;
+        }
+    }
+    ProcessScalar<Q, Accumulate>(out, in, volume, ramp, processed, sample_count);
+}
+
+} // Anonymous namespace
+
+MixKernelIsa GetBestMixKernelIsa() {
+#if defined(ARCHITECTURE_x86_64)
+    static const MixKernelIsa best = Common::GetCPUCaps().avx2     ? MixKernelIsa::Avx2
+                                     : Common::GetCPUCaps().sse4_1 ? MixKernelIsa::Sse41
+                                                                   : MixKernelIsa::Scalar;
+    return best;
+#elif defined(ARCHITECTURE_arm64)
+    // NEON is part of the base ARMv8 instruction set
+    return MixKernelIsa::Neon;
+#else
+    return MixKernelIsa::Scalar;
+#endif
+}
+
+std::vector<MixKernelIsa> GetSupportedMixKernelIsas() {
+    std::vector<MixKernelIsa> isas{MixKernelIsa::Scalar};
+#if defined(ARCHITECTURE_x86_64)
+    if (Common::GetCPUCaps().sse4_1) {
+        isas.push_back(MixKernelIsa::Sse41);
+    }
+    if (Common::GetCPUCaps().avx2) {
+        isas.push_back(MixKernelIsa::Avx2);
+    }
+#elif defined(ARCHITECTURE_arm64)
+    isas.push_back(MixKernelIsa::Neon);
+#endif
+    return isas;
+}
+
+template <size_t Q>
+s32 MixSamples(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+               u32 sample_count, MixKernelIsa isa) {
+    if (sample_count == 0) {
+        return 0;
+    }
+    // Taken before mixing, the output may alias the input
+    const s32 last_sample = RoundProduct<Q>(
+        input[sample_count - 1], volume + static_cast<s64>(sample_count - 1) * ramp);
+    Process<Q, true>(output, input, volume, ramp, sample_count, isa);
+    return last_sample;
+}
+
+template <size_t Q>
+void ScaleSamples(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+                  u32 sample_count, MixKernelIsa isa) {
+    Process<Q, false>(output, input, volume, ramp, sample_count, isa);
+}
+
+template s32 MixSamples<15>(std::span<s32>, std::span<const s32>, s64, s64, u32, MixKernelIsa);
+template s32 MixSamples<23>(std::span<s32>, std::span<const s32>, s64, s64, u32, MixKernelIsa);
+template void ScaleSamples<15>(std::span<s32>, std::span<const s32>, s64, s64, u32,
+                               MixKernelIsa);
+template void ScaleSamples<23>(std::span<s32>, std::span<const s32>, s64, s64, u32,
+                               MixKernelIsa);
+
+} // namespace AudioCore::Renderer
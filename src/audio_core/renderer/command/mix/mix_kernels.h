@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+
+/// Instruction sets the mix kernels can run with
+enum class MixKernelIsa {
+    Scalar,
+    Sse41,
+    Avx2,
+    Neon,
+};
+
+/// Returns the fastest instruction set supported by the host, used by default
+[[nodiscard]] MixKernelIsa GetBestMixKernelIsa();
+
+/// Returns every instruction set supported by the host, scalar first
+[[nodiscard]] std::vector<MixKernelIsa> GetSupportedMixKernelIsas();
+
+/*
+ * Sample loops of the mix and volume commands. Volumes are raw Common::FixedPoint<64 - Q, Q>
+ * values and every gained sample is rounded like FixedPoint::to_int, so the results are the same
+ * as doing each step with FixedPoint whatever instruction set is used.
+ */
+
+/**
+ * Mix input mix buffer into output mix buffer, with a volume ramp applied to the input.
+ *
+ * @tparam Q           - Number of bits for fixed point operations.
+ * @param output       - Output mix buffer.
+ * @param input        - Input mix buffer.
+ * @param volume       - Raw fixed point volume applied to the first sample.
+ * @param ramp         - Raw fixed point ramp added to the volume every sample.
+ * @param sample_count - Number of samples to process.
+ * @param isa          - Instruction set to use, must be supported by the host.
+ * @return The final gained input sample, zero when there are no samples.
+ */
+template <size_t Q>
+s32 MixSamples(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+               u32 sample_count, MixKernelIsa isa = GetBestMixKernelIsa());
+
+/**
+ * Apply a volume ramp to the input mix buffer, saving to the output buffer.
+ *
+ * @tparam Q           - Number of bits for fixed point operations.
+ * @param output       - Output mix buffer.
+ * @param input        - Input mix buffer.
+ * @param volume       - Raw fixed point volume applied to the first sample.
+ * @param ramp         - Raw fixed point ramp added to the volume every sample.
+ * @param sample_count - Number of samples to process.
+ * @param isa          - Instruction set to use, must be supported by the host.
+ */
+template <size_t Q>
+void ScaleSamples(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+                  u32 sample_count, MixKernelIsa isa = GetBestMixKernelIsa());
+
+} // namespace AudioCore::Renderer
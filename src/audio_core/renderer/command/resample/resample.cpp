@@ -1,8 +1,23 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+
 #include "audio_core/renderer/command/resample/resample.h"
 
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define SSE41_TARGET __attribute__((target("sse4.1")))
+#else
+#define SSE41_TARGET
+#endif
+
 namespace AudioCore::Renderer {
 
 static void ResampleLowQuality(std::span<s32> output, std::span<const s16> input,
@@ -23,6 +38,140 @@ static void ResampleLowQuality(std::span<s32> output, std::span<const s16> input
     }
 }
 
+/*
+ * The normal and high quality resamplers convert every tap product to 56.8 fixed point, truncating
+ * it towards zero, and floor the sum of them. Scaled products of 16 bit samples stay below 2^23, so
+ * 32 bit float to integer conversions truncate them exactly and their sum fits in 32 bits. The
+ * vector filters compute four output samples at once this way, with the same result as the scalar
+ * one. Only stepping through the input is sequential, it's done ahead of each group of samples.
+ */
+
+/// Output samples computed per iteration of the vector filters
+constexpr u32 FilterVectorWidth = 4;
+
+/// Scale of the 56.8 fixed point tap products, as a float
+constexpr f32 FilterProductScale = static_cast<f32>(Common::FixedPoint<56, 8>::one);
+
+struct FilterPosition {
+    u32 read_index;
+    u32 lut_index;
+};
+
+template <u32 NumTaps>
+static s32 FilterSample(const s16* input, const f32* taps) {
+    Common::FixedPoint<56, 8> sum{0};
+    for (u32 tap = 0; tap < NumTaps; tap++) {
+        sum += Common::FixedPoint<56, 8>{input[tap] * taps[tap]};
+    }
+    return sum.to_int_floor();
+}
+
+#if defined(ARCHITECTURE_x86_64)
+static bool HasVectorFilter() {
+    static const bool has_sse41 = Common::GetCPUCaps().sse4_1;
+    return has_sse41;
+}
+
+SSE41_TARGET static __m128i FilterFourTapsSse41(const s16* input, const f32* taps) {
+    const __m128i samples =
+        _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)));
+    const __m128 products = _mm_mul_ps(_mm_cvtepi32_ps(samples), _mm_loadu_ps(taps));
+    return _mm_cvttps_epi32(_mm_mul_ps(products, _mm_set1_ps(FilterProductScale)));
+}
+
+template <u32 NumTaps>
+SSE41_TARGET static __m128i FilterTapsSse41(const s16* input, const f32* taps) {
+    if constexpr (NumTaps == 4) {
+        return FilterFourTapsSse41(input, taps);
+    } else {
+        return _mm_add_epi32(FilterFourTapsSse41(input, taps),
+                             FilterFourTapsSse41(input + 4, taps + 4));
+    }
+}
+
+template <u32 NumTaps>
+SSE41_TARGET static void FilterSamples(
+    s32* output, const s16* input, const f32* lut,
+    const std::array<FilterPosition, FilterVectorWidth>& positions) {
+    __m128i products[FilterVectorWidth];
+    for (u32 i = 0; i < FilterVectorWidth; i++) {
+        products[i] = FilterTapsSse41<NumTaps>(input + positions[i].read_index,
+                                               lut + positions[i].lut_index);
+    }
+    const __m128i sums = _mm_hadd_epi32(_mm_hadd_epi32(products[0], products[1]),
+                                        _mm_hadd_epi32(products[2], products[3]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_srai_epi32(sums, 8));
+}
+#elif defined(ARCHITECTURE_arm64)
+static bool HasVectorFilter() {
+    // NEON is part of the base ARMv8 instruction set
+    return true;
+}
+
+static int32x4_t FilterFourTapsNeon(const s16* input, const f32* taps) {
+    const int32x4_t samples = vmovl_s16(vld1_s16(input));
+    const float32x4_t products = vmulq_f32(vcvtq_f32_s32(samples), vld1q_f32(taps));
+    return vcvtq_s32_f32(vmulq_n_f32(products, FilterProductScale));
+}
+
+template <u32 NumTaps>
+static int32x4_t FilterTapsNeon(const s16* input, const f32* taps) {
+    if constexpr (NumTaps == 4) {
+        return FilterFourTapsNeon(input, taps);
+    } else {
+        return vaddq_s32(FilterFourTapsNeon(input, taps), FilterFourTapsNeon(input + 4, taps + 4));
+    }
+}
+
+template <u32 NumTaps>
+static void FilterSamples(s32* output, const s16* input, const f32* lut,
+                          const std::array<FilterPosition, FilterVectorWidth>& positions) {
+    int32x4_t products[FilterVectorWidth];
+    for (u32 i = 0; i < FilterVectorWidth; i++) {
+        products[i] = FilterTapsNeon<NumTaps>(input + positions[i].read_index,
+                                              lut + positions[i].lut_index);
+    }
+    const int32x4_t sums =
+        vpaddq_s32(vpaddq_s32(products[0], products[1]), vpaddq_s32(products[2], products[3]));
+    vst1q_s32(output, vshrq_n_s32(sums, 8));
+}
+#endif
+
+template <u32 NumTaps>
+static void ResampleFiltered(std::span<s32> output, std::span<const s16> input,
+                             std::span<const f32> lut,
+                             const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                             Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write) {
+    u32 read_index{0};
+    const auto next_position = [&]() {
+        const FilterPosition position{
+            .read_index = read_index,
+            .lut_index = static_cast<u32>(fraction.get_frac() >> 8) * NumTaps,
+        };
+        fraction += sample_rate_ratio;
+        read_index += static_cast<u32>(fraction.to_int_floor());
+        fraction.clear_int();
+        return position;
+    };
+
+    u32 i{0};
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    if (HasVectorFilter()) {
+        std::array<FilterPosition, FilterVectorWidth> positions;
+        for (; i + FilterVectorWidth <= samples_to_write; i += FilterVectorWidth) {
+            for (auto& position : positions) {
+                position = next_position();
+            }
+            FilterSamples<NumTaps>(&output[i], input.data(), lut.data(), positions);
+        }
+    }
+#endif
+    for (; i < samples_to_write; i++) {
+        const auto position{next_position()};
+        output[i] = FilterSample<NumTaps>(&input[position.read_index], &lut[position.lut_index]);
+    }
+}
+
 static void ResampleNormalQuality(std::span<s32> output, std::span<const s16> input,
                                   const Common::FixedPoint<49, 15>& sample_rate_ratio,
                                   Common::FixedPoint<49, 15>& fraction,
@@ -292,19 +441,7 @@ static void ResampleNormalQuality(std::span<s32> output, std::span<const s16> in
         }
     };
 
-    auto lut{get_lut()};
-    u32 read_index{0};
-    for (u32 i = 0; i < samples_to_write; i++) {
-        const auto lut_index{(fraction.get_frac() >> 8) * 4};
-        const Common::FixedPoint<56, 8> sample0{input[read_index + 0] * lut[lut_index + 0]};
-        const Common::FixedPoint<56, 8> sample1{input[read_index + 1] * lut[lut_index + 1]};
-        const Common::FixedPoint<56, 8> sample2{input[read_index + 2] * lut[lut_index + 2]};
-        const Common::FixedPoint<56, 8> sample3{input[read_index + 3] * lut[lut_index + 3]};
-        output[i] = (sample0 + sample1 + sample2 + sample3).to_int_floor();
-        fraction += sample_rate_ratio;
-        read_index += static_cast<u32>(fraction.to_int_floor());
-        fraction.clear_int();
-    }
+    ResampleFiltered<4>(output, input, get_lut(), sample_rate_ratio, fraction, samples_to_write);
 }
 
 static void ResampleHighQuality(std::span<s32> output, std::span<const s16> input,
@@ -842,24 +979,7 @@ static void ResampleHighQuality(std::span<s32> output, std::span<const s16> inpu
         }
     };
 
-    auto lut{get_lut()};
-    u32 read_index{0};
-    for (u32 i = 0; i < samples_to_write; i++) {
-        const auto lut_index{(fraction.get_frac() >> 8) * 8};
-        const Common::FixedPoint<56, 8> sample0{input[read_index + 0] * lut[lut_index + 0]};
-        const Common::FixedPoint<56, 8> sample1{input[read_index + 1] * lut[lut_index + 1]};
-        const Common::FixedPoint<56, 8> sample2{input[read_index + 2] * lut[lut_index + 2]};
-        const Common::FixedPoint<56, 8> sample3{input[read_index + 3] * lut[lut_index + 3]};
-        const Common::FixedPoint<56, 8> sample4{input[read_index + 4] * lut[lut_index + 4]};
-        const Common::FixedPoint<56, 8> sample5{input[read_index + 5] * lut[lut_index + 5]};
-        const Common::FixedPoint<56, 8> sample6{input[read_index + 6] * lut[lut_index + 6]};
-        const Common::FixedPoint<56, 8> sample7{input[read_index + 7] * lut[lut_index + 7]};
-        output[i] = (sample0 + sample1 + sample2 + sample3 + sample4 + sample5 + sample6 + sample7)
-                        .to_int_floor();
-        fraction += sample_rate_ratio;
-        read_index += static_cast<u32>(fraction.to_int_floor());
-        fraction.clear_int();
-    }
+    ResampleFiltered<8>(output, input, get_lut(), sample_rate_ratio, fraction, samples_to_write);
 }
 
 void Resample(std::span<s32> output, std::span<const s16> input,
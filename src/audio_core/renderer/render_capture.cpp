@@ -0,0 +1,479 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "audio_core/renderer/command/command_list_header.h"
+#include "audio_core/renderer/command/commands.h"
+#include "audio_core/renderer/command/data_source/adpcm_decode_cache.h"
+#include "audio_core/renderer/effect/aux_.h"
+#include "audio_core/renderer/render_capture.h"
+#include "audio_core/renderer/system.h"
+#include "audio_core/sink/null_sink.h"
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
+#include "common/div_ceil.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/page_table.h"
+#include "common/settings.h"
+#include "common/virtual_buffer.h"
+#include "core/memory.h"
+
+namespace AudioCore::Renderer {
+
+namespace {
+
+constexpr u32 CaptureMagic = 0x43415559; // "YUAC"
+constexpr u32 CaptureVersion = 1;
+
+/// Address space width of the replayed memory, the one of 39-bit titles
+constexpr size_t ReplayAddressSpaceBits = 39;
+
+enum class RecordType : u32 {
+    Update = 0,
+    Memory = 1,
+    Render = 2,
+};
+
+struct FileHeader {
+    u32 magic;
+    u32 version;
+    u64 program_id;
+    s32 session_id;
+    s8 channel_count;
+    INSERT_PADDING_BYTES(3);
+    u64 workbuffer_size;
+    AudioRendererParameterInternal params;
+    INSERT_PADDING_BYTES(4);
+};
+static_assert(sizeof(FileHeader) == 0x58, "FileHeader has incorrect size");
+
+struct RecordHeader {
+    RecordType type;
+    INSERT_PADDING_BYTES(4);
+    /// Performance buffer size of an update, or address of a memory record
+    u64 argument0;
+    /// Output buffer size of an update
+    u64 argument1;
+    /// Size of the data following the header
+    u64 size;
+};
+static_assert(sizeof(RecordHeader) == 0x20, "RecordHeader has incorrect size");
+
+constexpr std::array<std::string_view, ADSP::AudioRenderer::CommandIdCount> CommandNames{
+    "Invalid",
+    "DataSourcePcmInt16Version1",
+    "DataSourcePcmInt16Version2",
+    "DataSourcePcmFloatVersion1",
+    "DataSourcePcmFloatVersion2",
+    "DataSourceAdpcmVersion1",
+    "DataSourceAdpcmVersion2",
+    "Volume",
+    "VolumeRamp",
+    "BiquadFilter",
+    "Mix",
+    "MixRamp",
+    "MixRampGrouped",
+    "DepopPrepare",
+    "DepopForMixBuffers",
+    "Delay",
+    "Upsample",
+    "DownMix6chTo2ch",
+    "Aux",
+    "DeviceSink",
+    "CircularBufferSink",
+    "Reverb",
+    "I3dl2Reverb",
+    "Performance",
+    "ClearMixBuffer",
+    "CopyMixBuffer",
+    "LightLimiterVersion1",
+    "LightLimiterVersion2",
+    "MultiTapBiquadFilter",
+    "Capture",
+    "Compressor",
+};
+
+/**
+ * Address space holding the captured memory, backed by host allocations. Every page any record
+ * touches is mapped, so the commands can also write where the DSP would.
+ */
+class ReplayMemory {
+public:
+    explicit ReplayMemory(Core::System& system, const RenderCapture& capture) : memory{system} {
+        constexpr u64 max_address{1ULL << ReplayAddressSpaceBits};
+
+        std::vector<std::pair<u64, u64>> runs;
+        for (const auto& frame : capture.frames) {
+            for (const auto& range : frame.memory) {
+                if (range.address + range.data.size() > max_address) {
+                    continue;
+                }
+                runs.emplace_back(range.address >> Core::Memory::YUZU_PAGEBITS,
+                                  Common::DivCeil(range.address + range.data.size(),
+                                                  Core::Memory::YUZU_PAGESIZE));
+            }
+        }
+        std::ranges::sort(runs);
+
+        page_table.Resize(ReplayAddressSpaceBits, Core::Memory::YUZU_PAGEBITS);
+        for (size_t i = 0; i < runs.size();) {
+            auto [first_page, end_page] = runs[i];
+            for (i++; i < runs.size() && runs[i].first <= end_page; i++) {
+                end_page = std::max(end_page, runs[i].second);
+            }
+            Map(first_page, end_page);
+        }
+        memory.SetCurrentPageTable(page_table);
+    }
+
+    void Write(const CapturedMemory& range) {
+        memory.WriteBlockUnsafe(range.address, range.data.data(), range.data.size());
+    }
+
+    Core::Memory::Memory& GetMemory() {
+        return memory;
+    }
+
+private:
+    void Map(u64 first_page, u64 end_page) {
+        auto& buffer{buffers.emplace_back((end_page - first_page) * Core::Memory::YUZU_PAGESIZE)};
+        const auto base{reinterpret_cast<uintptr_t>(buffer.data())};
+        for (u64 page = first_page; page < end_page; page++) {
+            const u64 address{page << Core::Memory::YUZU_PAGEBITS};
+            const uintptr_t host{base + (page - first_page) * Core::Memory::YUZU_PAGESIZE};
+            page_table.pointers[page].Store(host - address, Common::PageType::Memory);
+            page_table.blocks[page] = first_page << Core::Memory::YUZU_PAGEBITS;
+        }
+    }
+
+    Common::PageTable page_table;
+    std::vector<Common::VirtualBuffer<u8>> buffers;
+    Core::Memory::Memory memory;
+};
+
+} // Anonymous namespace
+
+RenderCaptureWriter::RenderCaptureWriter(const std::filesystem::path& path, u64 program_id,
+                                         s32 session_id,
+                                         const AudioRendererParameterInternal& params,
+                                         u64 workbuffer_size, s8 channel_count)
+    : file{path, Common::FS::FileAccessMode::Write, Common::FS::FileType::BinaryFile} {
+    if (!file.IsOpen()) {
+        LOG_ERROR(Common_Filesystem, "Unable to open or create file at {}",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    const FileHeader header{
+        .magic = CaptureMagic,
+        .version = CaptureVersion,
+        .program_id = program_id,
+        .session_id = session_id,
+        .channel_count = channel_count,
+        .workbuffer_size = workbuffer_size,
+        .params = params,
+    };
+    if (!file.WriteObject(header)) {
+        LOG_ERROR(Service_Audio, "Failed to write audio renderer capture header");
+        file.Close();
+    }
+}
+
+RenderCaptureWriter::~RenderCaptureWriter() = default;
+
+std::unique_ptr<RenderCaptureWriter> RenderCaptureWriter::Create(
+    u64 program_id, s32 session_id, const AudioRendererParameterInternal& params,
+    u64 workbuffer_size, s8 channel_count) {
+    const auto base_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::DumpDir)};
+    const auto capture_dir{base_dir / "audio_captures"};
+    if (!Common::FS::CreateDir(base_dir) || !Common::FS::CreateDir(capture_dir)) {
+        LOG_ERROR(Common_Filesystem, "Failed to create audio renderer capture directories");
+        return nullptr;
+    }
+    const auto name{capture_dir / fmt::format("{:016X}_{}.audcap", program_id, session_id)};
+    auto writer = std::make_unique<RenderCaptureWriter>(name, program_id, session_id, params,
+                                                        workbuffer_size, channel_count);
+    if (!writer->IsOpen()) {
+        return nullptr;
+    }
+    LOG_INFO(Service_Audio, "Capturing audio renderer session {} to {}", session_id,
+             Common::FS::PathToUTF8String(name));
+    return writer;
+}
+
+void RenderCaptureWriter::RecordUpdate(std::span<const u8> input, u64 performance_size,
+                                       u64 output_size) {
+    if (!file.IsOpen()) {
+        return;
+    }
+    WriteRecord(static_cast<u32>(RecordType::Update), performance_size, output_size, input);
+}
+
+void RenderCaptureWriter::RecordRender(Core::Memory::Memory& memory,
+                                       std::span<const u8> command_list) {
+    if (!file.IsOpen() || command_list.size() < sizeof(CommandListHeader)) {
+        return;
+    }
+
+    const auto& header{*reinterpret_cast<const CommandListHeader*>(command_list.data())};
+    size_t offset{sizeof(CommandListHeader)};
+    for (u32 i = 0; i < header.command_count; i++) {
+        if (offset + sizeof(ICommand) > command_list.size()) {
+            break;
+        }
+        const auto& command{*reinterpret_cast<const ICommand*>(command_list.data() + offset)};
+        if (command.magic != CommandMagic || offset + command.size > command_list.size()) {
+            break;
+        }
+        if (command.enabled) {
+            RecordCommandMemory(memory, command);
+        }
+        offset += command.size;
+    }
+
+    WriteRecord(static_cast<u32>(RecordType::Render), 0, 0, {});
+    (void)file.Flush();
+}
+
+void RenderCaptureWriter::RecordCommandMemory(Core::Memory::Memory& memory,
+                                              const ICommand& command) {
+    switch (command.type) {
+    case CommandId::DataSourcePcmInt16Version1:
+        RecordWaveBuffers(memory, static_cast<const PcmInt16DataSourceVersion1Command&>(command));
+        break;
+    case CommandId::DataSourcePcmInt16Version2:
+        RecordWaveBuffers(memory, static_cast<const PcmInt16DataSourceVersion2Command&>(command));
+        break;
+    case CommandId::DataSourcePcmFloatVersion1:
+        RecordWaveBuffers(memory, static_cast<const PcmFloatDataSourceVersion1Command&>(command));
+        break;
+    case CommandId::DataSourcePcmFloatVersion2:
+        RecordWaveBuffers(memory, static_cast<const PcmFloatDataSourceVersion2Command&>(command));
+        break;
+    case CommandId::DataSourceAdpcmVersion1: {
+        const auto& adpcm{static_cast<const AdpcmDataSourceVersion1Command&>(command)};
+        RecordWaveBuffers(memory, adpcm);
+        RecordMemory(memory, adpcm.data_address, adpcm.data_size);
+        break;
+    }
+    case CommandId::DataSourceAdpcmVersion2: {
+        const auto& adpcm{static_cast<const AdpcmDataSourceVersion2Command&>(command)};
+        RecordWaveBuffers(memory, adpcm);
+        RecordMemory(memory, adpcm.data_address, adpcm.data_size);
+        break;
+    }
+    case CommandId::Aux: {
+        const auto& aux{static_cast<const AuxCommand&>(command)};
+        RecordMemory(memory, aux.send_buffer_info, sizeof(AuxInfo::AuxInfoDsp));
+        RecordMemory(memory, aux.return_buffer_info, sizeof(AuxInfo::AuxInfoDsp));
+        RecordMemory(memory, aux.send_buffer, aux.count_max * sizeof(s32));
+        RecordMemory(memory, aux.return_buffer, aux.count_max * sizeof(s32));
+        break;
+    }
+    case CommandId::Capture: {
+        const auto& capture{static_cast<const CaptureCommand&>(command)};
+        RecordMemory(memory, capture.send_buffer_info, sizeof(AuxInfo::AuxInfoDsp));
+        RecordMemory(memory, capture.send_buffer, capture.count_max * sizeof(s32));
+        break;
+    }
+    case CommandId::CircularBufferSink: {
+        const auto& sink{static_cast<const CircularBufferSinkCommand&>(command)};
+        RecordMemory(memory, sink.address, sink.size);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+template <typename T>
+void RenderCaptureWriter::RecordWaveBuffers(Core::Memory::Memory& memory, const T& command) {
+    for (const auto& wave_buffer : command.wave_buffers) {
+        RecordMemory(memory, wave_buffer.buffer, wave_buffer.buffer_size);
+        RecordMemory(memory, wave_buffer.context, wave_buffer.context_size);
+    }
+}
+
+void RenderCaptureWriter::RecordMemory(Core::Memory::Memory& memory, CpuAddr address, u64 size) {
+    if (address == 0 || size == 0 || !memory.IsValidVirtualAddressRange(address, size)) {
+        return;
+    }
+
+    scratch.resize(size);
+    memory.ReadBlockUnsafe(address, scratch.data(), size);
+
+    // Wave buffers are usually left alone once written, only store them again when they change
+    const u64 hash{Common::CityHash64(reinterpret_cast<const char*>(scratch.data()), size)};
+    const auto [it, inserted] = recorded_hashes.try_emplace({address, size}, hash);
+    if (!inserted) {
+        if (it->second == hash) {
+            return;
+        }
+        it->second = hash;
+    }
+    WriteRecord(static_cast<u32>(RecordType::Memory), address, 0, scratch);
+}
+
+void RenderCaptureWriter::WriteRecord(u32 type, u64 argument0, u64 argument1,
+                                      std::span<const u8> data) {
+    const RecordHeader header{
+        .type = static_cast<RecordType>(type),
+        .argument0 = argument0,
+        .argument1 = argument1,
+        .size = data.size(),
+    };
+    if (!file.WriteObject(header) || file.WriteSpan(data) != data.size()) {
+        LOG_ERROR(Service_Audio, "Failed to write audio renderer capture record, stopping capture");
+        file.Close();
+    }
+}
+
+std::optional<RenderCapture> LoadRenderCapture(const std::filesystem::path& path) {
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Common_Filesystem, "Unable to open file at {}",
+                  Common::FS::PathToUTF8String(path));
+        return std::nullopt;
+    }
+    FileHeader header{};
+    if (!file.ReadObject(header) || header.magic != CaptureMagic) {
+        LOG_ERROR(Service_Audio, "{} is not an audio renderer capture",
+                  Common::FS::PathToUTF8String(path));
+        return std::nullopt;
+    }
+    if (header.version != CaptureVersion) {
+        LOG_ERROR(Service_Audio, "Unsupported audio renderer capture version {}", header.version);
+        return std::nullopt;
+    }
+
+    RenderCapture capture{
+        .program_id = header.program_id,
+        .session_id = header.session_id,
+        .params = header.params,
+        .workbuffer_size = header.workbuffer_size,
+        .channel_count = header.channel_count,
+    };
+    CapturedRenderFrame frame;
+    const u64 file_size = file.GetSize();
+    RecordHeader record{};
+    while (file.ReadObject(record)) {
+        if (record.size > file_size) {
+            LOG_ERROR(Service_Audio, "Truncated audio renderer capture record");
+            break;
+        }
+        std::vector<u8> data(record.size);
+        if (file.ReadSpan<u8>(data) != data.size()) {
+            LOG_ERROR(Service_Audio, "Truncated audio renderer capture record");
+            break;
+        }
+        switch (record.type) {
+        case RecordType::Update:
+            frame.updates.push_back({
+                .input = std::move(data),
+                .performance_size = record.argument0,
+                .output_size = record.argument1,
+            });
+            break;
+        case RecordType::Memory:
+            frame.memory.push_back({
+                .address = record.argument0,
+                .data = std::move(data),
+            });
+            break;
+        case RecordType::Render:
+            capture.frames.push_back(std::move(frame));
+            frame = {};
+            break;
+        default:
+            LOG_ERROR(Service_Audio, "Unknown audio renderer capture record type {}",
+                      static_cast<u32>(record.type));
+            return capture;
+        }
+    }
+    // Updates after the last frame never got rendered, they are left out
+    return capture;
+}
+
+std::string_view GetCommandName(CommandId id) {
+    const auto index{static_cast<size_t>(id)};
+    return index < CommandNames.size() ? CommandNames[index] : "Unknown";
+}
+
+std::optional<RenderReplayStats> ReplayRenderCapture(Core::System& system,
+                                                     const RenderCapture& capture,
+                                                     size_t iterations) {
+    using Clock = std::chrono::steady_clock;
+
+    ReplayMemory replay_memory{system, capture};
+    Sink::NullSink sink{""};
+    auto* stream{sink.AcquireSinkStream(system, static_cast<u32>(capture.channel_count),
+                                        "AudioRendererReplay", Sink::StreamType::Render)};
+    AdpcmDecodeCache adpcm_cache;
+    ADSP::AudioRenderer::CommandProfile profile;
+
+    RenderReplayStats stats{};
+    std::vector<u8> performance;
+    std::vector<u8> output;
+    for (size_t iteration = 0; iteration < iterations; ++iteration) {
+        // Every iteration starts from the state the game's session started with
+        System renderer{system};
+        if (renderer.InitializeOffline(capture.params, capture.workbuffer_size,
+                                       capture.channel_count)
+                .IsError()) {
+            LOG_ERROR(Service_Audio, "Failed to initialize the audio renderer for the replay");
+            return std::nullopt;
+        }
+        renderer.Start();
+        adpcm_cache.Clear();
+
+        for (const CapturedRenderFrame& frame : capture.frames) {
+            for (const CapturedUpdate& update : frame.updates) {
+                performance.assign(update.performance_size, 0);
+                output.assign(update.output_size, 0);
+                const auto start{Clock::now()};
+                // Updates the game got an error for fail the same way, and change nothing
+                (void)renderer.Update(update.input, performance, output);
+                stats.update_time += Clock::now() - start;
+                stats.updates++;
+            }
+            for (const CapturedMemory& range : frame.memory) {
+                replay_memory.Write(range);
+            }
+
+            const auto generate_start{Clock::now()};
+            const auto command_list{renderer.GenerateCommandList()};
+            stats.generate_time += Clock::now() - generate_start;
+
+            ADSP::AudioRenderer::CommandListProcessor processor{};
+            processor.Initialize(system, replay_memory.GetMemory(), CpuAddr(command_list.data()),
+                                 command_list.size(), stream);
+            processor.adpcm_cache = Settings::values.adpcm_decode_cache ? &adpcm_cache : nullptr;
+            processor.profile = &profile;
+            const auto process_start{Clock::now()};
+            processor.Process(capture.session_id);
+            stats.process_time += Clock::now() - process_start;
+            stats.frames++;
+        }
+        renderer.Finalize();
+    }
+
+    for (size_t i = 0; i < ADSP::AudioRenderer::CommandIdCount; i++) {
+        stats.command_counts[i] = profile.counts[i];
+        stats.command_times[i] = std::chrono::nanoseconds(profile.times[i]);
+    }
+    stats.voice_runs_time = std::chrono::nanoseconds(profile.voice_runs_time);
+
+    LOG_INFO(Service_Audio,
+             "Replayed {} frames ({} updates): update={:.3f} ms generate={:.3f} ms "
+             "process={:.3f} ms",
+             stats.frames, stats.updates, stats.update_time.count() / 1e6,
+             stats.generate_time.count() / 1e6, stats.process_time.count() / 1e6);
+    return stats;
+}
+
+} // namespace AudioCore::Renderer
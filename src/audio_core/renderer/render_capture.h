@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
+#include "audio_core/common/audio_renderer_parameter.h"
+#include "audio_core/common/common.h"
+#include "audio_core/renderer/command/icommand.h"
+#include "common/common_types.h"
+#include "common/fs/file.h"
+
+namespace Core {
+namespace Memory {
+class Memory;
+}
+class System;
+} // namespace Core
+
+namespace AudioCore::Renderer {
+
+/// Guest memory referenced by the commands of a frame, as it was when they were generated
+struct CapturedMemory {
+    CpuAddr address{};
+    std::vector<u8> data;
+};
+
+/// A RequestUpdate made by the game
+struct CapturedUpdate {
+    std::vector<u8> input;
+    u64 performance_size{};
+    u64 output_size{};
+};
+
+/// The updates made since the previous frame, and the guest memory the frame's commands read
+struct CapturedRenderFrame {
+    std::vector<CapturedUpdate> updates;
+    /// Only the ranges whose contents changed since they were last recorded
+    std::vector<CapturedMemory> memory;
+};
+
+struct RenderCapture {
+    u64 program_id{};
+    s32 session_id{};
+    AudioRendererParameterInternal params{};
+    u64 workbuffer_size{};
+    s8 channel_count{};
+    std::vector<CapturedRenderFrame> frames;
+};
+
+struct RenderReplayStats {
+    size_t frames{};
+    size_t updates{};
+    std::chrono::nanoseconds update_time{};
+    std::chrono::nanoseconds generate_time{};
+    std::chrono::nanoseconds process_time{};
+    /// Time the command lists waited on the voice runs processed on the workers
+    std::chrono::nanoseconds voice_runs_time{};
+    /// Commands processed, by CommandId
+    std::array<u64, ADSP::AudioRenderer::CommandIdCount> command_counts{};
+    /// Time spent processing them, by CommandId. Voice run commands add up across workers.
+    std::array<std::chrono::nanoseconds, ADSP::AudioRenderer::CommandIdCount> command_times{};
+};
+
+/**
+ * Records the updates of an audio renderer session, and the guest memory its command lists
+ * read when they are generated, into a capture file. The memory is copied out at generation
+ * time, so the capture can be replayed without the original title.
+ * Calls are made with the system's lock held.
+ */
+class RenderCaptureWriter {
+public:
+    explicit RenderCaptureWriter(const std::filesystem::path& path, u64 program_id,
+                                 s32 session_id, const AudioRendererParameterInternal& params,
+                                 u64 workbuffer_size, s8 channel_count);
+    ~RenderCaptureWriter();
+
+    RenderCaptureWriter(const RenderCaptureWriter&) = delete;
+    RenderCaptureWriter& operator=(const RenderCaptureWriter&) = delete;
+
+    /// Creates a writer for the given session in the dump directory, if it could be opened
+    static std::unique_ptr<RenderCaptureWriter> Create(
+        u64 program_id, s32 session_id, const AudioRendererParameterInternal& params,
+        u64 workbuffer_size, s8 channel_count);
+
+    [[nodiscard]] bool IsOpen() const {
+        return file.IsOpen();
+    }
+
+    /// Records a RequestUpdate, before it is applied
+    void RecordUpdate(std::span<const u8> input, u64 performance_size, u64 output_size);
+
+    /// Records the guest memory a generated command list reads, and marks the end of the frame
+    void RecordRender(Core::Memory::Memory& memory, std::span<const u8> command_list);
+
+private:
+    void RecordCommandMemory(Core::Memory::Memory& memory, const ICommand& command);
+
+    template <typename T>
+    void RecordWaveBuffers(Core::Memory::Memory& memory, const T& command);
+
+    void RecordMemory(Core::Memory::Memory& memory, CpuAddr address, u64 size);
+
+    void WriteRecord(u32 type, u64 argument0, u64 argument1, std::span<const u8> data);
+
+    Common::FS::IOFile file;
+    /// Hash of the contents last recorded for each address and size
+    std::map<std::pair<CpuAddr, u64>, u64> recorded_hashes;
+    std::vector<u8> scratch;
+};
+
+/// Loads a capture file written by RenderCaptureWriter
+[[nodiscard]] std::optional<RenderCapture> LoadRenderCapture(const std::filesystem::path& path);
+
+/// Name of a command type, for reports
+[[nodiscard]] std::string_view GetCommandName(CommandId id);
+
+/**
+ * Replays a capture through an offline renderer system, generating every frame's command list
+ * and processing it on the calling thread into a null sink, and measures how long each step
+ * and each type of command takes. The captured memory is mapped into an address space of its
+ * own, so no title has to be running.
+ *
+ * @param system     - The core system, doesn't need to be running.
+ * @param capture    - Capture to replay.
+ * @param iterations - Number of times the capture is replayed, each from a fresh system.
+ * @return Statistics of all the iterations, or nullopt if the system couldn't be initialized.
+ */
+[[nodiscard]] std::optional<RenderReplayStats> ReplayRenderCapture(Core::System& system,
+                                                                   const RenderCapture& capture,
+                                                                   size_t iterations = 1);
+
+} // namespace AudioCore::Renderer
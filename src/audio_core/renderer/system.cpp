@@ -22,6 +22,7 @@
 #include "audio_core/renderer/mix/mix_info.h"
 #include "audio_core/renderer/nodes/edge_matrix.h"
 #include "audio_core/renderer/nodes/node_states.h"
+#include "audio_core/renderer/render_capture.h"
 #include "audio_core/renderer/sink/sink_info_base.h"
 #include "audio_core/renderer/system.h"
 #include "audio_core/renderer/upsampler/upsampler_info.h"
@@ -29,6 +30,7 @@
 #include "audio_core/renderer/voice/voice_info.h"
 #include "audio_core/renderer/voice/voice_state.h"
 #include "common/alignment.h"
+#include "common/settings.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_event.h"
@@ -97,9 +99,13 @@ u64 System::GetWorkBufferSize(const AudioRendererParameterInternal& params) {
 }
 
 System::System(Core::System& core_, Kernel::KEvent* adsp_rendered_event_)
-    : core{core_}, audio_renderer{core.AudioCore().ADSP().AudioRenderer()},
+    : core{core_}, audio_renderer{&core.AudioCore().ADSP().AudioRenderer()},
       adsp_rendered_event{adsp_rendered_event_} {}
 
+System::System(Core::System& core_) : core{core_} {}
+
+System::~System() = default;
+
 Result System::Initialize(const AudioRendererParameterInternal& params,
                           Kernel::KTransferMemory* transfer_memory, u64 transfer_memory_size,
                           Kernel::KProcess* process_handle_, u64 applet_resource_user_id_,
@@ -116,12 +122,40 @@ Result System::Initialize(const AudioRendererParameterInternal& params,
         return Service::Audio::ResultInvalidHandle;
     }
 
-    behavior.SetUserLibRevision(params.revision);
-
     process_handle = process_handle_;
     applet_resource_user_id = applet_resource_user_id_;
     session_id = session_id_;
 
+    process_handle->GetMemory().ZeroBlock(transfer_memory->GetSourceAddress(),
+                                          transfer_memory_size);
+
+    const auto result{InitializeWorkbuffer(params, transfer_memory_size)};
+    if (result.IsSuccess() && Settings::values.capture_audio_renderer) {
+        capture = RenderCaptureWriter::Create(
+            core.GetApplicationProcessProgramID(), session_id, params, transfer_memory_size,
+            static_cast<s8>(core.AudioCore().GetOutputSink().GetDeviceChannels()));
+    }
+    return result;
+}
+
+Result System::InitializeOffline(const AudioRendererParameterInternal& params,
+                                 u64 workbuffer_size_, s8 channel_count) {
+    if (!CheckValidRevision(params.revision)) {
+        return Service::Audio::ResultInvalidRevision;
+    }
+
+    if (GetWorkBufferSize(params) > workbuffer_size_) {
+        return Service::Audio::ResultInsufficientBuffer;
+    }
+
+    offline_channel_count = channel_count;
+    return InitializeWorkbuffer(params, workbuffer_size_);
+}
+
+Result System::InitializeWorkbuffer(const AudioRendererParameterInternal& params,
+                                    u64 workbuffer_size_) {
+    behavior.SetUserLibRevision(params.revision);
+
     sample_rate = params.sample_rate;
     sample_count = params.sample_count;
     mix_buffer_count = static_cast<s16>(params.mixes);
@@ -131,13 +165,10 @@ Result System::Initialize(const AudioRendererParameterInternal& params,
     render_device = params.rendering_device;
     execution_mode = params.execution_mode;
 
-    process_handle->GetMemory().ZeroBlock(transfer_memory->GetSourceAddress(),
-                                          transfer_memory_size);
-
     // Note: We're not actually using the transfer memory because it's a pain to code for.
     // Allocate the memory normally instead and hope the game doesn't try to read anything back
-    workbuffer = std::make_unique<u8[]>(transfer_memory_size);
-    workbuffer_size = transfer_memory_size;
+    workbuffer = std::make_unique<u8[]>(workbuffer_size_);
+    workbuffer_size = workbuffer_size_;
 
     PoolMapper pool_mapper(process_handle, false);
     pool_mapper.InitializeSystemPool(memory_pool_info, workbuffer.get(), workbuffer_size);
@@ -359,6 +390,7 @@ Result System::Initialize(const AudioRendererParameterInternal& params,
     drop_voice = params.voice_drop_enabled && params.execution_mode == ExecutionMode::Auto;
     drop_voice_param = 1.0f;
     num_voices_dropped = 0;
+    measured_time_estimator = {};
 
     allocator.Align(0x40);
     command_workbuffer_size = allocator.GetRemainingSize();
@@ -440,7 +472,8 @@ void System::Stop() {
         active = false;
     }
 
-    if (execution_mode == ExecutionMode::Auto) {
+    // Offline systems have no AudioRenderer to signal the end of the last command list
+    if (execution_mode == ExecutionMode::Auto && audio_renderer) {
         terminate_event.Wait();
     }
 }
@@ -449,6 +482,9 @@ Result System::Update(std::span<const u8> input, std::span<u8> performance, std:
     std::scoped_lock l{lock};
 
     const auto start_time{core.CoreTiming().GetGlobalTimeNs().count()};
+    if (capture) {
+        capture->RecordUpdate(input, performance.size(), output.size());
+    }
     std::memset(output.data(), 0, output.size());
 
     InfoUpdater info_updater(input, output, process_handle, behavior);
@@ -537,7 +573,9 @@ Result System::Update(std::span<const u8> input, std::span<u8> performance, std:
         return result;
     }
 
-    adsp_rendered_event->Clear();
+    if (adsp_rendered_event) {
+        adsp_rendered_event->Clear();
+    }
     num_times_updated++;
 
     const auto end_time{core.CoreTiming().GetGlobalTimeNs().count()};
@@ -588,7 +626,7 @@ void System::SendCommandToDsp() {
     if (initialized) {
         if (active) {
             terminate_event.Reset();
-            const auto remaining_command_count{audio_renderer.GetRemainCommandCount(session_id)};
+            const auto remaining_command_count{audio_renderer->GetRemainCommandCount(session_id)};
             u64 command_size{0};
 
             if (remaining_command_count) {
@@ -615,16 +653,16 @@ void System::SendCommandToDsp() {
             auto time_limit{
                 static_cast<u64>((time_limit_percent / 100) * 2'880'000.0 *
                                  (static_cast<f32>(render_time_limit_percent) / 100.0f))};
-            audio_renderer.SetCommandBuffer(session_id, translated_addr, command_size, time_limit,
-                                            applet_resource_user_id, process_handle,
-                                            reset_command_buffers);
+            audio_renderer->SetCommandBuffer(session_id, translated_addr, command_size, time_limit,
+                                             applet_resource_user_id, process_handle,
+                                             reset_command_buffers);
             reset_command_buffers = false;
             command_buffer_size = command_size;
             if (remaining_command_count == 0) {
                 adsp_rendered_event->Signal();
             }
         } else {
-            audio_renderer.ClearRemainCommandCount(session_id);
+            audio_renderer->ClearRemainCommandCount(session_id);
             terminate_event.Set();
         }
     }
@@ -652,8 +690,12 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
 
     s8 channel_count{2};
     if (execution_mode == ExecutionMode::Auto) {
-        const auto& sink{core.AudioCore().GetOutputSink()};
-        channel_count = static_cast<s8>(sink.GetDeviceChannels());
+        if (audio_renderer) {
+            const auto& sink{core.AudioCore().GetOutputSink()};
+            channel_count = static_cast<s8>(sink.GetDeviceChannels());
+        } else {
+            channel_count = offline_channel_count;
+        }
     }
 
     AudioRendererSystemContext render_context{
@@ -666,6 +708,14 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
         .memory_pool_info{&memory_pool_info},
     };
 
+    // Voices are dropped by how long the host takes to process the commands, rather than the
+    // DSP, the commands still get the HOS estimates
+    const bool measured_voice_drop{drop_voice && audio_renderer &&
+                                   Settings::values.measured_voice_drop.GetValue()};
+    if (measured_voice_drop) {
+        measured_time_estimator.Update(audio_renderer->GetCommandProfile(session_id));
+    }
+
     CommandBuffer command_buffer{
         .command_list{in_command_buffer},
         .sample_count{sample_count},
@@ -675,8 +725,15 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
         .estimated_process_time{0},
         .memory_pool{&memory_pool_info},
         .time_estimator{command_processing_time_estimator.get()},
+        .measured_process_time{0},
+        .measured_time_estimator{measured_voice_drop ? &measured_time_estimator : nullptr},
         .behavior{&behavior},
     };
+    const auto get_estimated_time{[&] {
+        return drop_voice_param * static_cast<f32>(measured_voice_drop
+                                                       ? command_buffer.measured_process_time
+                                                       : command_buffer.estimated_process_time);
+    }};
 
     PerformanceManager* perf_manager{nullptr};
     if (performance_initialized) {
@@ -690,8 +747,7 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
     voice_context.SortInfo();
     command_generator.GenerateVoiceCommands();
 
-    const auto start_estimated_time{drop_voice_param *
-                                    static_cast<f32>(command_buffer.estimated_process_time)};
+    const auto start_estimated_time{get_estimated_time()};
 
     command_generator.GenerateSubMixCommands();
     command_generator.GenerateFinalMixCommands();
@@ -710,8 +766,7 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
             time_limit_percent = 70.0f;
         }
 
-        const auto end_estimated_time{drop_voice_param *
-                                      static_cast<f32>(command_buffer.estimated_process_time)};
+        const auto end_estimated_time{get_estimated_time()};
 
         const auto dsp_time_limit{((time_limit_percent / 100.0f) * 2'880'000.0f) *
                                   (static_cast<f32>(render_time_limit_percent) / 100.0f)};
@@ -726,6 +781,11 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
     command_list_header->buffer_size = command_buffer.size;
     command_list_header->command_count = command_buffer.count;
 
+    if (capture) {
+        capture->RecordRender(process_handle->GetMemory(),
+                              in_command_buffer.first(command_buffer.size));
+    }
+
     voice_context.UpdateStateByDspShared();
 
     if (render_context.behavior->IsEffectInfoVersion2Supported()) {
@@ -735,12 +795,19 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
     const auto end_time{core.CoreTiming().GetGlobalTimeNs().count()};
     total_ticks_elapsed += end_time - start_time;
     num_command_lists_generated++;
-    render_start_tick = audio_renderer.GetRenderingStartTick(session_id);
+    render_start_tick = audio_renderer ? audio_renderer->GetRenderingStartTick(session_id) : 0;
     frames_elapsed++;
 
     return command_buffer.size;
 }
 
+std::span<u8> System::GenerateCommandList() {
+    std::scoped_lock l{lock};
+    const auto size{GenerateCommand(command_workbuffer, command_workbuffer_size)};
+    command_buffer_size = size;
+    return command_workbuffer.first(size);
+}
+
 f32 System::GetVoiceDropParameter() const {
     return drop_voice_param;
 }
@@ -807,8 +874,11 @@ u32 System::DropVoices(CommandBuffer& command_buffer, u32 estimated_process_time
                 cmd->enabled = true;
             } else if (cmd->enabled && cmd->type != CommandId::Performance) {
                 cmd->enabled = false;
-                estimated_process_time -= static_cast<u32>(
-                    drop_voice_param * static_cast<f32>(cmd->estimated_process_time));
+                const auto command_time{command_buffer.measured_time_estimator
+                                            ? command_buffer.measured_time_estimator->Estimate(*cmd)
+                                            : cmd->estimated_process_time};
+                estimated_process_time -=
+                    static_cast<u32>(drop_voice_param * static_cast<f32>(command_time));
             }
             command_list += cmd->size;
             cmd = reinterpret_cast<ICommand*>(command_list);
@@ -45,6 +45,7 @@ class AudioRenderer;
 namespace Renderer {
 using namespace ::AudioCore::ADSP;
 class CommandBuffer;
+class RenderCaptureWriter;
 
 /**
  * Audio Renderer System, the main worker for audio rendering.
@@ -58,6 +59,16 @@ class System {
 public:
     explicit System(Core::System& core, Kernel::KEvent* adsp_rendered_event);
 
+    /**
+     * Create an offline system, not attached to the ADSP or a process. Its command lists are
+     * generated with GenerateCommandList, and processed by the caller.
+     *
+     * @param core - The core system.
+     */
+    explicit System(Core::System& core);
+
+    ~System();
+
     /**
      * Calculate the total size required for all audio render workbuffers.
      *
@@ -84,6 +95,17 @@ public:
                       Kernel::KProcess* process_handle, u64 applet_resource_user_id,
                       s32 session_id);
 
+    /**
+     * Initialize an offline renderer system, with a workbuffer of its own.
+     *
+     * @param params          - Input parameters to initialize the system with.
+     * @param workbuffer_size - Size of the workbuffer, as large as the game's transfer memory.
+     * @param channel_count   - Channel count of the output device the commands target.
+     * @return Result code.
+     */
+    Result InitializeOffline(const AudioRendererParameterInternal& params, u64 workbuffer_size,
+                             s8 channel_count);
+
     /**
      * Finalize the system.
      */
@@ -190,11 +212,20 @@ public:
      */
     u64 GenerateCommand(std::span<u8> command_buffer, u64 command_buffer_size);
 
+    /**
+     * Generate the command list for the next frame into the command workbuffer, for offline
+     * systems, which don't send their commands to the DSP.
+     *
+     * @return The command list, starting with its CommandListHeader.
+     */
+    std::span<u8> GenerateCommandList();
+
     /**
      * Try to drop some voices if the AudioRenderer fell behind.
      *
      * @param command_buffer         - Command buffer to drop voices from.
-     * @param estimated_process_time - Current estimated processing time of all commands.
+     * @param estimated_process_time - Current estimated processing time of all commands, measured
+     *                                 if the command buffer has a measured estimator.
      * @param time_limit             - Time limit for rendering, voices are dropped if estimated
      *                                 exceeds this.
      *
@@ -217,10 +248,20 @@ public:
     void SetVoiceDropParameter(f32 voice_drop);
 
 private:
+    /**
+     * Allocate the workbuffers and initialize everything to a default state.
+     *
+     * @param params          - Input parameters to initialize the system with.
+     * @param workbuffer_size - Size of the workbuffer to allocate.
+     * @return Result code.
+     */
+    Result InitializeWorkbuffer(const AudioRendererParameterInternal& params,
+                                u64 workbuffer_size);
+
     /// Core system
     Core::System& core;
-    /// Reference to the ADSP's AudioRenderer for communication
-    ::AudioCore::ADSP::AudioRenderer::AudioRenderer& audio_renderer;
+    /// The ADSP's AudioRenderer for communication, null for offline systems
+    ::AudioCore::ADSP::AudioRenderer::AudioRenderer* audio_renderer{};
     /// Is this system initialized?
     bool initialized{};
     /// Is this system currently active?
@@ -267,6 +308,8 @@ private:
     SplitterContext splitter_context{};
     /// Estimates the time taken for each command
     std::unique_ptr<ICommandProcessingTimeEstimator> command_processing_time_estimator{};
+    /// Estimates the time taken for each command from the host's measured times, for dropping
+    MeasuredCommandProcessingTimeEstimator measured_time_estimator{};
     /// Session id of this system
     s32 session_id{};
     /// Number of channels in use by voices
@@ -323,6 +366,10 @@ private:
     u64 render_start_tick{};
     /// Parameter to control the threshold for dropping voices if the audio graph gets too large
     f32 drop_voice_param{1.0f};
+    /// Channel count of the output device, for offline systems
+    s8 offline_channel_count{2};
+    /// Records the updates and command lists of this system, when capturing
+    std::unique_ptr<RenderCaptureWriter> capture{};
 };
 
 } // namespace Renderer
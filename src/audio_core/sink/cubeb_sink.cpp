@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <span>
 #include <vector>
 
@@ -70,7 +71,7 @@ public:
             minimum_latency = TargetSampleCount * 2;
         }
 
-        minimum_latency = std::max(minimum_latency, TargetSampleCount * 2);
+        minimum_latency = GetRequestedPeriod(minimum_latency);
 
         LOG_INFO(Service_Audio,
                  "Opening cubeb stream {} type {} with: rate {} channels {} (system channels {}) "
@@ -94,6 +95,8 @@ public:
             LOG_CRITICAL(Audio_Sink, "Error initializing cubeb stream, error: {}", init_error);
             return;
         }
+
+        SetDevicePeriod(minimum_latency);
     }
 
     /**
@@ -296,6 +299,14 @@ void CubebSink::SetSystemVolume(f32 volume) {
     }
 }
 
+std::chrono::microseconds CubebSink::GetOutputLatency() const {
+    std::chrono::microseconds latency{};
+    for (const auto& stream : sink_streams) {
+        latency = std::max(latency, stream->GetLatency());
+    }
+    return latency;
+}
+
 std::vector<std::string> ListCubebSinkDevices(bool capture) {
     std::vector<std::string> device_list;
     cubeb* ctx;
@@ -73,6 +73,14 @@ public:
      */
     void SetSystemVolume(f32 volume) override;
 
+    /**
+     * Get the output latency of the sink, from a sample being appended to a stream to it being
+     * played by the host.
+     *
+     * @return Highest latency of the output streams, zero when there are none.
+     */
+    std::chrono::microseconds GetOutputLatency() const override;
+
 private:
     /// Backend Cubeb context
     cubeb* ctx{};
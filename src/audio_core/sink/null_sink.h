@@ -21,6 +21,9 @@ public:
         : SinkStream{system_, type_} {}
     ~NullSinkStreamImpl() override {}
     void AppendBuffer(SinkBuffer&, std::span<s16>) override {}
+    bool AppendBufferInPlace(SinkBuffer&, std::span<const s16>) override {
+        return false;
+    }
     std::vector<s16> ReleaseBuffer(u64) override {
         return {};
     }
@@ -49,6 +52,9 @@ public:
     }
     void SetDeviceVolume(f32 volume) override {}
     void SetSystemVolume(f32 volume) override {}
+    std::chrono::microseconds GetOutputLatency() const override {
+        return {};
+    }
 
 private:
     SinkStreamPtr null_sink{};
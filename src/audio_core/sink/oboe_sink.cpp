@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <span>
 #include <vector>
 
@@ -163,7 +164,10 @@ private:
     bool SetStreamProperties() {
         ASSERT(m_stream);
 
-        m_stream->setBufferSizeInFrames(TargetSampleCount * 2);
+        // Two bursts is the smallest buffer Oboe recommends to avoid glitches
+        m_stream->setBufferSizeInFrames(
+            static_cast<s32>(GetRequestedPeriod(m_stream->getFramesPerBurst() * 2)));
+        SetDevicePeriod(static_cast<u32>(m_stream->getBufferSizeInFrames()));
         device_channels = m_stream->getChannelCount();
 
         const auto sample_rate = m_stream->getSampleRate();
@@ -224,4 +228,12 @@ void OboeSink::SetSystemVolume(f32 volume) {
     }
 }
 
+std::chrono::microseconds OboeSink::GetOutputLatency() const {
+    std::chrono::microseconds latency{};
+    for (const auto& stream : sink_streams) {
+        latency = std::max(latency, stream->GetLatency());
+    }
+    return latency;
+}
+
 } // namespace AudioCore::Sink
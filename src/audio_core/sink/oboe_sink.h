@@ -67,6 +67,14 @@ public:
      */
     void SetSystemVolume(f32 volume) override;
 
+    /**
+     * Get the output latency of the sink, from a sample being appended to a stream to it being
+     * played by the host.
+     *
+     * @return Highest latency of the output streams, zero when there are none.
+     */
+    std::chrono::microseconds GetOutputLatency() const override;
+
 private:
     /// List of streams managed by this sink
     std::list<SinkStreamPtr> sink_streams{};
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <span>
 #include <vector>
 #include <SDL.h>
@@ -39,7 +40,8 @@ public:
         spec.freq = TargetSampleRate;
         spec.channels = static_cast<u8>(device_channels);
         spec.format = AUDIO_S16SYS;
-        spec.samples = TargetSampleCount * 2;
+        // SDL can't report a minimum, a single ADSP frame is stable on every backend
+        spec.samples = static_cast<u16>(GetRequestedPeriod(TargetSampleCount));
         spec.callback = &SDLSinkStream::DataCallback;
         spec.userdata = this;
 
@@ -66,6 +68,7 @@ public:
                  "Opening SDL stream {} with: rate {} channels {} (system channels {}) "
                  " samples {}",
                  device, obtained.freq, obtained.channels, system_channels, obtained.samples);
+        SetDevicePeriod(obtained.samples);
     }
 
     /**
@@ -210,6 +213,14 @@ void SDLSink::SetSystemVolume(f32 volume) {
     }
 }
 
+std::chrono::microseconds SDLSink::GetOutputLatency() const {
+    std::chrono::microseconds latency{};
+    for (const auto& stream : sink_streams) {
+        latency = std::max(latency, stream->GetLatency());
+    }
+    return latency;
+}
+
 std::vector<std::string> ListSDLSinkDevices(bool capture) {
     std::vector<std::string> device_list;
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -85,6 +86,14 @@ public:
      */
     virtual void SetSystemVolume(f32 volume) = 0;
 
+    /**
+     * Get the output latency of the sink, from a sample being appended to a stream to it being
+     * played by the host.
+     *
+     * @return Highest latency of the output streams, zero when there are none.
+     */
+    virtual std::chrono::microseconds GetOutputLatency() const = 0;
+
     /**
      * Get the number of channels the game has set, can be different to the host hardware's support.
      * Either 2 or 6.
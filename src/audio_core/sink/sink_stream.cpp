@@ -1,8 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <span>
 #include <vector>
@@ -12,12 +16,165 @@
 #include "audio_core/sink/sink_stream.h"
 #include "common/common_types.h"
 #include "common/fixed_point.h"
+#include "common/logging/log.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 
 namespace AudioCore::Sink {
+namespace {
+
+/// Number of queued buffers the low latency mode starts rendering ahead with
+constexpr u32 InitialQueueDepth = 2;
+/// Fewest queued buffers the low latency mode renders ahead with
+constexpr u32 MinQueueDepth = 1;
+/// Frames to play without an underrun before the low latency mode shrinks the queue again
+constexpr u64 StableFrameCount = TargetSampleRate * 10;
+
+/**
+ * Stretch the first frames of a buffer over the whole of it, with linear interpolation.
+ *
+ * @param buffer     - Buffer of interleaved samples to stretch in place.
+ * @param scratch    - Scratch buffer for the original samples.
+ * @param frame_size - Number of samples per frame.
+ * @param src_frames - Number of frames to stretch, at least 2.
+ * @param dst_frames - Number of frames to stretch them over.
+ */
+void StretchFrames(std::span<s16> buffer, std::vector<s16>& scratch, size_t frame_size,
+                   size_t src_frames, size_t dst_frames) {
+    scratch.assign(buffer.begin(), buffer.begin() + src_frames * frame_size);
+    const f32 step{static_cast<f32>(src_frames - 1) / static_cast<f32>(dst_frames - 1)};
+    for (size_t frame = 0; frame < dst_frames; frame++) {
+        const f32 position{static_cast<f32>(frame) * step};
+        const size_t index{std::min(static_cast<size_t>(position), src_frames - 2)};
+        const f32 fraction{position - static_cast<f32>(index)};
+        for (size_t channel = 0; channel < frame_size; channel++) {
+            const auto current{static_cast<f32>(scratch[index * frame_size + channel])};
+            const auto next{static_cast<f32>(scratch[(index + 1) * frame_size + channel])};
+            buffer[frame * frame_size + channel] =
+                static_cast<s16>(current + (next - current) * fraction);
+        }
+    }
+}
+
+/**
+ * Get the volume samples are played at.
+ *
+ * @param system_volume - Volume set by the audio out system.
+ * @param device_volume - Volume set by the audio device.
+ * @return The volume to multiply the samples by.
+ */
+f32 GetOutputVolume(f32 system_volume, f32 device_volume) {
+    auto yuzu_volume{Settings::Volume()};
+    if (yuzu_volume > 1.0f) {
+        yuzu_volume = 0.6f + 20 * std::log10(yuzu_volume);
+    }
+    return system_volume * device_volume * yuzu_volume;
+}
+
+/**
+ * Convert interleaved frames to another channel layout and apply the volume, in one pass.
+ * 6 channels are downmixed to 2, 2 channels are played on the front channels of 6, and other
+ * layouts keep the channels both have.
+ *
+ * @param output          - Buffer for the converted frames.
+ * @param input           - Frames to convert.
+ * @param frames          - Number of frames to convert.
+ * @param input_channels  - Number of channels of the input frames.
+ * @param output_channels - Number of channels of the output frames.
+ * @param volume          - Volume to apply.
+ */
+void ConvertFrames(std::span<s16> output, std::span<const s16> input, size_t frames,
+                   u32 input_channels, u32 output_channels, f32 volume) {
+    static constexpr s32 min{std::numeric_limits<s16>::min()};
+    static constexpr s32 max{std::numeric_limits<s16>::max()};
+    const auto scale{[volume](f32 sample) {
+        return static_cast<s16>(std::clamp(static_cast<s32>(sample * volume), min, max));
+    }};
+
+    if (input_channels == output_channels && volume == 1.0f) {
+        std::memcpy(output.data(), input.data(), frames * input_channels * sizeof(s16));
+        return;
+    }
+
+    if (input_channels == 6 && output_channels == 2) {
+        // Front = 1.0, Center = 0.596, LFE = 0.354, Back = 0.707, as AppendBuffer downmixes
+        static constexpr std::array<f32, 4> down_mix_coeff{1.0, 0.596f, 0.354f, 0.707f};
+        for (size_t frame = 0; frame < frames; frame++) {
+            const auto* in{&input[frame * 6]};
+            const auto fl{static_cast<f32>(in[static_cast<u32>(Channels::FrontLeft)])};
+            const auto fr{static_cast<f32>(in[static_cast<u32>(Channels::FrontRight)])};
+            const auto c{static_cast<f32>(in[static_cast<u32>(Channels::Center)])};
+            const auto lfe{static_cast<f32>(in[static_cast<u32>(Channels::LFE)])};
+            const auto bl{static_cast<f32>(in[static_cast<u32>(Channels::BackLeft)])};
+            const auto br{static_cast<f32>(in[static_cast<u32>(Channels::BackRight)])};
+            const auto shared{c * down_mix_coeff[1] + lfe * down_mix_coeff[2]};
+            output[frame * 2 + static_cast<u32>(Channels::FrontLeft)] =
+                scale(fl * down_mix_coeff[0] + shared + bl * down_mix_coeff[3]);
+            output[frame * 2 + static_cast<u32>(Channels::FrontRight)] =
+                scale(fr * down_mix_coeff[0] + shared + br * down_mix_coeff[3]);
+        }
+        return;
+    }
+
+    const u32 shared_channels{std::min(input_channels, output_channels)};
+    for (size_t frame = 0; frame < frames; frame++) {
+        const auto* in{&input[frame * input_channels]};
+        auto* out{&output[frame * output_channels]};
+        for (u32 channel = 0; channel < shared_channels; channel++) {
+            out[channel] = scale(static_cast<f32>(in[channel]));
+        }
+        std::fill(out + shared_channels, out + output_channels, s16{0});
+    }
+}
+
+} // Anonymous namespace
+
+SinkStream::SinkStream(Core::System& system_, StreamType type_)
+    : system{system_}, type{type_},
+      low_latency{type_ != StreamType::In && Settings::values.audio_low_latency.GetValue()},
+      queue_depth{InitialQueueDepth} {}
+
+std::chrono::microseconds SinkStream::GetLatency() const {
+    if (type == StreamType::In) {
+        return {};
+    }
+    const u64 frames{static_cast<u64>(buffered_frames) + device_period};
+    return std::chrono::microseconds{frames * 1'000'000 / TargetSampleRate};
+}
+
+u32 SinkStream::GetRequestedPeriod(u32 minimum_period) const {
+    if (low_latency) {
+        return std::max(minimum_period, TargetSampleCount / 2);
+    }
+    return std::max(minimum_period, TargetSampleCount * 2);
+}
+
+u32 SinkStream::GetTargetQueueSize() const {
+    if (!low_latency) {
+        return max_queue_size;
+    }
+    return std::min(queue_depth.load(), max_queue_size);
+}
+
+void SinkStream::UpdateQueueDepth(size_t frames, bool underrun) {
+    if (underrun) {
+        frames_since_underrun = 0;
+        if (queue_depth < max_queue_size) {
+            ++queue_depth;
+            LOG_DEBUG(Audio_Sink, "Stream {} underran, rendering {} buffers ahead", name,
+                      queue_depth.load());
+        }
+        return;
+    }
+
+    frames_since_underrun += frames;
+    if (frames_since_underrun >= StableFrameCount && queue_depth > MinQueueDepth) {
+        frames_since_underrun = 0;
+        --queue_depth;
+    }
+}
 
 void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
     SCOPE_EXIT {
@@ -32,11 +189,7 @@ void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
     constexpr s32 min{std::numeric_limits<s16>::min()};
     constexpr s32 max{std::numeric_limits<s16>::max()};
 
-    auto yuzu_volume{Settings::Volume()};
-    if (yuzu_volume > 1.0f) {
-        yuzu_volume = 0.6f + 20 * std::log10(yuzu_volume);
-    }
-    auto volume{system_volume * device_volume * yuzu_volume};
+    auto volume{GetOutputVolume(system_volume, device_volume)};
 
     if (system_channels == 6 && device_channels == 2) {
         // We're given 6 channels, but our device only outputs 2, so downmix.
@@ -120,6 +273,17 @@ void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
     samples_buffer.Push(samples);
 }
 
+bool SinkStream::AppendBufferInPlace(SinkBuffer& buffer, std::span<const s16> samples) {
+    if (type != StreamType::Out || samples.size() < buffer.frames * system_channels) {
+        return false;
+    }
+
+    buffer.samples = samples.data();
+    queue.enqueue(buffer);
+    ++queued_buffers;
+    return true;
+}
+
 std::vector<s16> SinkStream::ReleaseBuffer(u64 num_samples) {
     constexpr s32 min = std::numeric_limits<s16>::min();
     constexpr s32 max = std::numeric_limits<s16>::max();
@@ -145,8 +309,14 @@ std::vector<s16> SinkStream::ReleaseBuffer(u64 num_samples) {
 
 void SinkStream::ClearQueue() {
     samples_buffer.Pop();
-    while (queue.pop()) {
+    // Cleared buffers count as read, their samples are no longer needed
+    u64 frames_cleared{
+        playing_buffer.consumed ? 0 : playing_buffer.frames - playing_buffer.frames_played};
+    SinkBuffer buffer{};
+    while (queue.try_dequeue(buffer)) {
+        frames_cleared += buffer.frames;
     }
+    frames_read += frames_cleared;
     queued_buffers = 0;
     playing_buffer = {};
     playing_buffer.consumed = true;
@@ -206,6 +376,7 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
     const std::size_t frame_size_bytes = frame_size * sizeof(s16);
     size_t frames_written{0};
     size_t actual_frames_written{0};
+    bool underrun{false};
 
     // If we're paused or going to shut down, we don't want to consume buffers as coretiming is
     // paused and we'll desync, so just play silence.
@@ -229,10 +400,20 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
         // If the playing buffer has been consumed or has no frames, we need a new one
         if (playing_buffer.consumed || playing_buffer.frames == 0) {
             if (!queue.try_dequeue(playing_buffer)) {
-                // If no buffer was available we've underrun, fill the remaining buffer with
-                // the last written frame and continue.
-                for (size_t i = frames_written; i < num_frames; i++) {
-                    std::memcpy(&output_buffer[i * frame_size], &last_frame[0], frame_size_bytes);
+                // Only count underruns once something played, not while the stream starts up
+                underrun = max_played_sample_count > 0 || actual_frames_written > 0;
+
+                // If no buffer was available we've underrun. In low latency mode, stretch the
+                // frames we got over the whole callback when that's most of it, instead of
+                // leaving a gap. Otherwise fill the remaining buffer with the last written frame.
+                if (low_latency && frames_written > 1 && frames_written * 4 >= num_frames * 3) {
+                    StretchFrames(output_buffer, stretch_buffer, frame_size, frames_written,
+                                  num_frames);
+                } else {
+                    for (size_t i = frames_written; i < num_frames; i++) {
+                        std::memcpy(&output_buffer[i * frame_size], &last_frame[0],
+                                    frame_size_bytes);
+                    }
                 }
                 frames_written = num_frames;
                 continue;
@@ -250,12 +431,22 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
         size_t frames_available{std::min<u64>(playing_buffer.frames - playing_buffer.frames_played,
                                               num_frames - frames_written)};
 
-        samples_buffer.Pop(&output_buffer[frames_written * frame_size],
-                           frames_available * frame_size);
+        if (playing_buffer.samples) {
+            const std::span<const s16> input{
+                playing_buffer.samples + playing_buffer.frames_played * system_channels,
+                frames_available * system_channels};
+            ConvertFrames(output_buffer.subspan(frames_written * frame_size), input,
+                          frames_available, system_channels, static_cast<u32>(num_channels),
+                          GetOutputVolume(system_volume, device_volume));
+        } else {
+            samples_buffer.Pop(&output_buffer[frames_written * frame_size],
+                               frames_available * frame_size);
+        }
 
         frames_written += frames_available;
         actual_frames_written += frames_available;
         playing_buffer.frames_played += frames_available;
+        frames_read += frames_available;
 
         // If that's all the frames in the current buffer, add its samples and mark it as
         // consumed
@@ -267,6 +458,11 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
     std::memcpy(&last_frame[0], &output_buffer[(frames_written - 1) * frame_size],
                 frame_size_bytes);
 
+    buffered_frames = static_cast<u32>(samples_buffer.Size() / frame_size);
+    if (low_latency) {
+        UpdateQueueDepth(num_frames, underrun);
+    }
+
     {
         std::scoped_lock lk{sample_count_lock};
         last_sample_count_update_time = system.CoreTiming().GetGlobalTimeNs();
@@ -289,10 +485,10 @@ u64 SinkStream::GetExpectedPlayedSampleCount() {
 void SinkStream::WaitFreeSpace(std::stop_token stop_token) {
     std::unique_lock lk{release_mutex};
     release_cv.wait_for(lk, std::chrono::milliseconds(5),
-                        [this]() { return paused || queued_buffers < max_queue_size; });
+                        [this]() { return paused || queued_buffers < GetTargetQueueSize(); });
     if (queued_buffers > max_queue_size + 3) {
         Common::CondvarWait(release_cv, lk, stop_token,
-                            [this] { return paused || queued_buffers < max_queue_size; });
+                            [this] { return paused || queued_buffers < GetTargetQueueSize(); });
     }
 }
 
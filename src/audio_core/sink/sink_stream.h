@@ -35,6 +35,8 @@ struct SinkBuffer {
     u64 frames_played;
     u64 tag;
     bool consumed;
+    /// Samples read in place while the buffer plays, null if they were queued in the ring buffer
+    const s16* samples{};
 };
 
 /**
@@ -55,7 +57,7 @@ struct SinkBuffer {
  */
 class SinkStream {
 public:
-    explicit SinkStream(Core::System& system_, StreamType type_) : system{system_}, type{type_} {}
+    explicit SinkStream(Core::System& system_, StreamType type_);
     virtual ~SinkStream() {}
 
     /**
@@ -164,6 +166,13 @@ public:
         max_queue_size = ring_size;
     }
 
+    /**
+     * Get the estimated time between a sample being appended and it being played by the host.
+     *
+     * @return The current output latency, zero for input streams.
+     */
+    std::chrono::microseconds GetLatency() const;
+
     /**
      * Append a new buffer and its samples to a waiting queue to play.
      *
@@ -172,6 +181,18 @@ public:
      */
     virtual void AppendBuffer(SinkBuffer& buffer, std::span<s16> samples);
 
+    /**
+     * Append a new buffer to play, whose samples are read in place by the host callback rather
+     * than copied into the ring buffer, converting them to the device's channels and applying
+     * the volume as they're played. Audio Out only.
+     * The samples must stay valid until GetReadFrameCount passes the end of the buffer.
+     *
+     * @param buffer  - Audio buffer information to be queued.
+     * @param samples - The s16 samples of the buffer, in the system's channel layout.
+     * @return True if the buffer was queued, false if the stream can't read samples in place.
+     */
+    virtual bool AppendBufferInPlace(SinkBuffer& buffer, std::span<const s16> samples);
+
     /**
      * Release a buffer. Audio In only, will fill a buffer with recorded samples.
      *
@@ -201,6 +222,15 @@ public:
      */
     void ProcessAudioOutAndRender(std::span<s16> output_buffer, std::size_t num_frames);
 
+    /**
+     * Get the number of frames of the appended buffers that have been played or cleared.
+     *
+     * @return The number of frames.
+     */
+    u64 GetReadFrameCount() const {
+        return frames_read.load();
+    }
+
     /**
      * Get the total number of samples expected to have been played by this stream.
      *
@@ -219,6 +249,23 @@ protected:
      */
     void SignalPause();
 
+    /**
+     * Set the number of frames the host backend buffers, which adds to the output latency.
+     *
+     * @param frames - Size of the host buffer in frames.
+     */
+    void SetDevicePeriod(u32 frames) {
+        device_period = frames;
+    }
+
+    /**
+     * Get the number of frames to ask the host backend to buffer.
+     *
+     * @param minimum_period - Smallest period the backend reports as stable, in frames.
+     * @return The period to request, in frames.
+     */
+    u32 GetRequestedPeriod(u32 minimum_period) const;
+
 protected:
     /// Core system
     Core::System& system;
@@ -232,8 +279,25 @@ protected:
     std::atomic<bool> paused{true};
     /// Name of this stream
     std::string name{};
+    /// Is the low latency mode enabled for this stream?
+    bool low_latency{};
 
 private:
+    /**
+     * Get the number of queued buffers the ADSP waits for before rendering more.
+     *
+     * @return The queue depth.
+     */
+    u32 GetTargetQueueSize() const;
+
+    /**
+     * Adjust the queue depth of the low latency mode after a callback.
+     *
+     * @param frames    - Number of frames requested by the host.
+     * @param underrun  - Whether the queue ran out of buffers during the callback.
+     */
+    void UpdateQueueDepth(size_t frames, bool underrun);
+
     /// Ring buffer of the samples waiting to be played or consumed
     Common::RingBuffer<s16, 0x10000> samples_buffer;
     /// Audio buffers queued and waiting to play
@@ -261,6 +325,18 @@ private:
     /// Signalled when ring buffer entries are consumed
     std::condition_variable_any release_cv;
     std::mutex release_mutex;
+    /// Frames buffered by the host backend
+    std::atomic<u32> device_period{};
+    /// Frames waiting in the sample ring buffer after the last callback
+    std::atomic<u32> buffered_frames{};
+    /// Number of queued buffers the ADSP renders ahead in low latency mode
+    std::atomic<u32> queue_depth{};
+    /// Frames played since the last underrun, or since the queue depth last shrank
+    u64 frames_since_underrun{};
+    /// Copy of the samples stretched over an underrunning callback
+    std::vector<s16> stretch_buffer{};
+    /// Frames of the appended buffers played or cleared so far
+    std::atomic<u64> frames_read{};
 };
 
 using SinkStreamPtr = std::unique_ptr<SinkStream>;
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "audio_core/common/common.h"
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#include "audio_core/renderer/command/resample/resample.h"
+#include "bench/bench.h"
+#include "common/fixed_point.h"
+
+namespace Bench {
+namespace {
+using AudioCore::SrcQuality;
+using AudioCore::TargetSampleCount;
+using AudioCore::Renderer::MixKernelIsa;
+
+/// Sample rate of the resampled voices, converted to the rate of the renderer
+constexpr f32 RESAMPLE_SOURCE_RATE = 32'000.0f;
+
+const char* IsaName(MixKernelIsa isa) {
+    switch (isa) {
+    case MixKernelIsa::Scalar:
+        return "scalar";
+    case MixKernelIsa::Sse41:
+        return "sse41";
+    case MixKernelIsa::Avx2:
+        return "avx2";
+    case MixKernelIsa::Neon:
+        return "neon";
+    }
+    return "unknown";
+}
+
+const char* QualityName(SrcQuality quality) {
+    switch (quality) {
+    case SrcQuality::Low:
+        return "low";
+    case SrcQuality::Medium:
+        return "medium";
+    case SrcQuality::High:
+        return "high";
+    }
+    return "unknown";
+}
+
+struct MixBuffers {
+    MixBuffers() : input(TargetSampleCount), output(TargetSampleCount) {
+        std::mt19937 rng{SEED};
+        for (s32& sample : input) {
+            sample = static_cast<s16>(rng());
+        }
+    }
+
+    std::vector<s32> input;
+    std::vector<s32> output;
+};
+
+struct ResampleBuffers {
+    // Twice the samples read by a frame, the high quality filter reads a few samples ahead
+    ResampleBuffers() : input(2 * TargetSampleCount), output(TargetSampleCount) {
+        std::mt19937 rng{SEED};
+        for (s16& sample : input) {
+            sample = static_cast<s16>(rng());
+        }
+    }
+
+    std::vector<s16> input;
+    std::vector<s32> output;
+};
+} // Anonymous namespace
+
+void AddAudioCoreBenchmarks(std::vector<Benchmark>& benchmarks) {
+    using namespace AudioCore::Renderer;
+
+    // A frame of a voice mixed with a volume ramp, as the mix ramp commands do
+    static constexpr s64 VOLUME = 1 << 14;
+    static constexpr s64 RAMP = -8;
+    for (const MixKernelIsa isa : GetSupportedMixKernelIsas()) {
+        benchmarks.push_back({
+            .name = fmt::format("audio_core/mix_ramp/{}", IsaName(isa)),
+            .bytes_per_run = TargetSampleCount * sizeof(s32),
+            .items_per_run = TargetSampleCount,
+            .run =
+                [isa, buffers = std::make_shared<MixBuffers>()] {
+                    Consume(static_cast<u64>(MixSamples<15>(
+                        buffers->output, buffers->input, VOLUME, RAMP, TargetSampleCount, isa)));
+                },
+        });
+        benchmarks.push_back({
+            .name = fmt::format("audio_core/volume_ramp/{}", IsaName(isa)),
+            .bytes_per_run = TargetSampleCount * sizeof(s32),
+            .items_per_run = TargetSampleCount,
+            .run =
+                [isa, buffers = std::make_shared<MixBuffers>()] {
+                    ScaleSamples<15>(buffers->output, buffers->input, VOLUME, RAMP,
+                                     TargetSampleCount, isa);
+                },
+        });
+    }
+
+    const Common::FixedPoint<49, 15> ratio{RESAMPLE_SOURCE_RATE /
+                                           static_cast<f32>(AudioCore::TargetSampleRate)};
+    for (const SrcQuality quality : {SrcQuality::Low, SrcQuality::Medium, SrcQuality::High}) {
+        benchmarks.push_back({
+            .name = fmt::format("audio_core/resample/{}", QualityName(quality)),
+            .bytes_per_run = TargetSampleCount * sizeof(s32),
+            .items_per_run = TargetSampleCount,
+            .run =
+                [quality, ratio, buffers = std::make_shared<ResampleBuffers>()] {
+                    Common::FixedPoint<49, 15> fraction{};
+                    Resample(buffers->output, buffers->input, ratio, fraction, TargetSampleCount,
+                             quality);
+                },
+        });
+    }
+}
+
+} // namespace Bench
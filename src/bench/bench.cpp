@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "bench/bench.h"
+#include "common/scm_rev.h"
+
+namespace Bench {
+namespace {
+using Clock = std::chrono::steady_clock;
+
+volatile u64 sink;
+
+f64 Nanoseconds(Clock::duration time) {
+    return std::chrono::duration<f64, std::nano>(time).count();
+}
+
+Clock::duration Measure(const Benchmark& benchmark, u64 runs) {
+    const auto start = Clock::now();
+    for (u64 run = 0; run < runs; ++run) {
+        benchmark.run();
+    }
+    return Clock::now() - start;
+}
+} // Anonymous namespace
+
+Result Run(const Benchmark& benchmark, const Options& options) {
+    // The first run faults in the inputs and builds the lazily initialized tables
+    benchmark.run();
+
+    u64 runs = 1;
+    while (Measure(benchmark, runs) < options.min_sample_time) {
+        runs *= 2;
+    }
+    std::vector<f64> samples(std::max<u32>(options.num_samples, 1));
+    for (f64& sample : samples) {
+        sample = Nanoseconds(Measure(benchmark, runs)) / static_cast<f64>(runs);
+    }
+    std::ranges::sort(samples);
+
+    const size_t middle = samples.size() / 2;
+    return Result{
+        .name = benchmark.name,
+        .bytes_per_run = benchmark.bytes_per_run,
+        .items_per_run = benchmark.items_per_run,
+        .runs_per_sample = runs,
+        .num_samples = static_cast<u32>(samples.size()),
+        .median_ns = samples.size() % 2 != 0 ? samples[middle]
+                                             : (samples[middle - 1] + samples[middle]) / 2.0,
+        .min_ns = samples.front(),
+        .max_ns = samples.back(),
+    };
+}
+
+std::string ToJson(std::span<const Result> results, const Options& options) {
+    nlohmann::json benchmarks = nlohmann::json::array();
+    for (const Result& result : results) {
+        nlohmann::json entry{
+            {"name", result.name},
+            {"runs_per_sample", result.runs_per_sample},
+            {"samples", result.num_samples},
+            {"median_ns", result.median_ns},
+            {"min_ns", result.min_ns},
+            {"max_ns", result.max_ns},
+        };
+        const f64 runs_per_second = result.median_ns > 0.0 ? 1e9 / result.median_ns : 0.0;
+        if (result.bytes_per_run != 0) {
+            entry["bytes_per_second"] = static_cast<f64>(result.bytes_per_run) * runs_per_second;
+        }
+        if (result.items_per_run != 0) {
+            entry["items_per_second"] = static_cast<f64>(result.items_per_run) * runs_per_second;
+        }
+        benchmarks.push_back(std::move(entry));
+    }
+    nlohmann::json root;
+    root["build"] = {
+        {"revision", std::string{Common::g_scm_rev}},
+        {"branch", std::string{Common::g_scm_branch}},
+        {"description", std::string{Common::g_scm_desc}},
+        {"date", std::string{Common::g_build_date}},
+    };
+    root["options"] = {
+        {"min_sample_time_ns", options.min_sample_time.count()},
+        {"samples", options.num_samples},
+    };
+    root["benchmarks"] = std::move(benchmarks);
+    return root.dump(4);
+}
+
+void Consume(u64 value) {
+    sink = value;
+}
+
+} // namespace Bench
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Bench {
+
+struct Benchmark {
+    std::string name;          ///< Subsystem and operation, e.g. "common/spsc_queue/push_pop"
+    u64 bytes_per_run{};       ///< Bytes processed by every run, zero when it is not a stream
+    u64 items_per_run{};       ///< Elements, samples or calls processed by every run
+    std::function<void()> run; ///< Measured operation, inputs are built before registering it
+};
+
+struct Options {
+    /// Shortest time of a sample, runs are repeated until a sample takes this long
+    std::chrono::nanoseconds min_sample_time{std::chrono::milliseconds{20}};
+    u32 num_samples{15};
+};
+
+struct Result {
+    std::string name;
+    u64 bytes_per_run{};
+    u64 items_per_run{};
+    u64 runs_per_sample{};
+    u32 num_samples{};
+    f64 median_ns{}; ///< Median time of a run
+    f64 min_ns{};
+    f64 max_ns{};
+};
+
+void AddCommonBenchmarks(std::vector<Benchmark>& benchmarks);
+void AddCoreBenchmarks(std::vector<Benchmark>& benchmarks);
+void AddAudioCoreBenchmarks(std::vector<Benchmark>& benchmarks);
+void AddVideoCoreBenchmarks(std::vector<Benchmark>& benchmarks);
+
+/// Calibrates the number of runs of a sample and measures every sample
+[[nodiscard]] Result Run(const Benchmark& benchmark, const Options& options);
+
+/// Serializes results with the build information, to compare them across commits
+[[nodiscard]] std::string ToJson(std::span<const Result> results, const Options& options);
+
+/// Keeps the compiler from dropping computations whose results are never read
+void Consume(u64 value);
+
+/// Seed of every random input, so runs of different builds measure the same data
+constexpr u32 SEED = 0x12345678;
+
+} // namespace Bench
@@ -0,0 +1,266 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "bench/bench.h"
+#include "common/lru_cache.h"
+#include "common/lz4_compression.h"
+#include "common/multi_level_page_table.h"
+#include "common/slot_vector.h"
+#include "common/threadsafe_queue.h"
+#include "common/zstd_compression.h"
+
+namespace Bench {
+namespace {
+constexpr size_t NUM_ELEMENTS = 4096;
+constexpr size_t COMPRESSION_SIZE = 1024 * 1024;
+
+struct LruTraits {
+    using ObjectType = u32;
+    using TickType = u64;
+};
+
+struct SlotObject {
+    u64 address;
+    u64 size;
+};
+
+/// Indices of every element in a shuffled order, to access them like a cache does
+std::vector<u32> ShuffledIndices(size_t count) {
+    std::vector<u32> indices(count);
+    std::iota(indices.begin(), indices.end(), 0U);
+    std::ranges::shuffle(indices, std::mt19937{SEED});
+    return indices;
+}
+
+/// Words of a small dictionary separated by some random bytes, so both codecs find matches
+std::vector<u8> MakeCompressibleData(size_t size) {
+    static constexpr std::array<std::string_view, 10> WORDS{
+        "yuzu",   "texture", "shader", "buffer", "render",
+        "sample", "kernel",  "thread", "memory", "\xff\xff\xff\xff",
+    };
+    std::mt19937 rng{SEED};
+    std::vector<u8> data;
+    data.reserve(size + 16);
+    while (data.size() < size) {
+        const std::string_view word = WORDS[rng() % WORDS.size()];
+        data.insert(data.end(), word.begin(), word.end());
+        data.push_back(static_cast<u8>(rng() % 4 == 0 ? rng() : ' '));
+    }
+    data.resize(size);
+    return data;
+}
+
+void AddQueueBenchmarks(std::vector<Benchmark>& benchmarks) {
+    benchmarks.push_back({
+        .name = "common/spsc_queue/push_pop",
+        .items_per_run = NUM_ELEMENTS,
+        .run =
+            [queue = std::make_shared<Common::SPSCQueue<u64>>()] {
+                for (u64 value = 0; value < NUM_ELEMENTS; ++value) {
+                    queue->Push(value);
+                }
+                u64 sum = 0;
+                for (u64 value; queue->Pop(value);) {
+                    sum += value;
+                }
+                Consume(sum);
+            },
+    });
+    benchmarks.push_back({
+        .name = "common/spsc_queue/threaded",
+        .items_per_run = NUM_ELEMENTS,
+        .run =
+            [queue = std::make_shared<Common::SPSCQueue<u64>>()] {
+                std::jthread producer{[&queue] {
+                    for (u64 value = 0; value < NUM_ELEMENTS; ++value) {
+                        queue->Push(value);
+                    }
+                }};
+                u64 sum = 0;
+                for (size_t index = 0; index < NUM_ELEMENTS; ++index) {
+                    sum += queue->PopWait();
+                }
+                Consume(sum);
+            },
+    });
+    benchmarks.push_back({
+        .name = "common/mpsc_queue/threaded",
+        .items_per_run = NUM_ELEMENTS,
+        .run =
+            [queue = std::make_shared<Common::MPSCQueue<u64>>()] {
+                static constexpr size_t NUM_PRODUCERS = 2;
+                std::array<std::jthread, NUM_PRODUCERS> producers;
+                for (std::jthread& producer : producers) {
+                    producer = std::jthread{[&queue] {
+                        for (u64 value = 0; value < NUM_ELEMENTS / NUM_PRODUCERS; ++value) {
+                            queue->Push(value);
+                        }
+                    }};
+                }
+                u64 sum = 0;
+                for (size_t index = 0; index < NUM_ELEMENTS; ++index) {
+                    sum += queue->PopWait();
+                }
+                Consume(sum);
+            },
+    });
+}
+
+void AddCacheBenchmarks(std::vector<Benchmark>& benchmarks) {
+    benchmarks.push_back({
+        .name = "common/slot_vector/insert_erase",
+        .items_per_run = NUM_ELEMENTS,
+        .run =
+            [slots = std::make_shared<Common::SlotVector<SlotObject>>(),
+             order = ShuffledIndices(NUM_ELEMENTS)] {
+                std::vector<Common::SlotId> ids(NUM_ELEMENTS);
+                for (size_t index = 0; index < NUM_ELEMENTS; ++index) {
+                    ids[index] = slots->insert(SlotObject{index * 0x1000, 0x1000});
+                }
+                for (const u32 index : order) {
+                    slots->erase(ids[index]);
+                }
+            },
+    });
+    auto slots = std::make_shared<Common::SlotVector<SlotObject>>();
+    std::vector<Common::SlotId> slot_ids;
+    for (size_t index = 0; index < NUM_ELEMENTS; ++index) {
+        slot_ids.push_back(slots->insert(SlotObject{index * 0x1000, 0x1000}));
+    }
+    std::ranges::shuffle(slot_ids, std::mt19937{SEED});
+    benchmarks.push_back({
+        .name = "common/slot_vector/lookup",
+        .items_per_run = NUM_ELEMENTS,
+        .run =
+            [slots, slot_ids] {
+                u64 sum = 0;
+                for (const Common::SlotId id : slot_ids) {
+                    sum += (*slots)[id].size;
+                }
+                Consume(sum);
+            },
+    });
+
+    // Every run touches all the objects once in a shuffled order and visits the older half
+    auto lru = std::make_shared<Common::LeastRecentlyUsedCache<LruTraits>>();
+    std::vector<size_t> lru_ids(NUM_ELEMENTS);
+    for (size_t index = 0; index < NUM_ELEMENTS; ++index) {
+        lru_ids[index] = lru->Insert(static_cast<u32>(index), 0);
+    }
+    benchmarks.push_back({
+        .name = "common/lru_cache/touch",
+        .items_per_run = NUM_ELEMENTS,
+        .run =
+            [lru, lru_ids, order = ShuffledIndices(NUM_ELEMENTS), tick = u64{0}]() mutable {
+                const u64 start_tick = tick;
+                for (const u32 index : order) {
+                    lru->Touch(lru_ids[index], ++tick);
+                }
+                u64 sum = 0;
+                lru->ForEachItemBelow(start_tick + NUM_ELEMENTS / 2,
+                                      [&sum](u32 object) { sum += object; });
+                Consume(sum);
+            },
+    });
+    benchmarks.push_back({
+        .name = "common/lru_cache/insert_free",
+        .items_per_run = NUM_ELEMENTS,
+        .run =
+            [lru = std::make_shared<Common::LeastRecentlyUsedCache<LruTraits>>(),
+             order = ShuffledIndices(NUM_ELEMENTS)] {
+                std::vector<size_t> ids(NUM_ELEMENTS);
+                for (size_t index = 0; index < NUM_ELEMENTS; ++index) {
+                    ids[index] = lru->Insert(static_cast<u32>(index), index);
+                }
+                for (const u32 index : order) {
+                    lru->Free(ids[index]);
+                }
+            },
+    });
+}
+
+void AddPageTableBenchmarks(std::vector<Benchmark>& benchmarks) {
+    // Same layout as the small page table of the GPU memory manager, with 256 MiB reserved
+    static constexpr size_t ADDRESS_SPACE_BITS = 40;
+    static constexpr size_t PAGE_BITS = 12;
+    static constexpr size_t FIRST_LEVEL_BITS = ADDRESS_SPACE_BITS + PAGE_BITS - 38;
+    static constexpr u64 RESERVED_SIZE = 256ULL << 20;
+    static constexpr size_t NUM_PAGES = RESERVED_SIZE >> PAGE_BITS;
+    auto table = std::make_shared<Common::MultiLevelPageTable<u32>>(ADDRESS_SPACE_BITS,
+                                                                     FIRST_LEVEL_BITS, PAGE_BITS);
+    table->ReserveRange(0, RESERVED_SIZE);
+    for (size_t page = 0; page < NUM_PAGES; ++page) {
+        (*table)[page] = static_cast<u32>(page);
+    }
+    benchmarks.push_back({
+        .name = "common/multi_level_page_table/lookup",
+        .items_per_run = NUM_PAGES,
+        .run =
+            [table, order = ShuffledIndices(NUM_PAGES)] {
+                u64 sum = 0;
+                for (const u32 page : order) {
+                    sum += (*table)[page];
+                }
+                Consume(sum);
+            },
+    });
+}
+
+void AddCompressionBenchmarks(std::vector<Benchmark>& benchmarks) {
+    using namespace Common::Compression;
+
+    const auto source = std::make_shared<const std::vector<u8>>(
+        MakeCompressibleData(COMPRESSION_SIZE));
+    const auto lz4 = std::make_shared<const std::vector<u8>>(
+        CompressDataLZ4(source->data(), source->size()));
+    const auto zstd = std::make_shared<const std::vector<u8>>(
+        CompressDataZSTDDefault(source->data(), source->size()));
+    const auto buffer = [] { return std::make_shared<std::vector<u8>>(2 * COMPRESSION_SIZE); };
+
+    benchmarks.push_back({
+        .name = "common/lz4/compress",
+        .bytes_per_run = COMPRESSION_SIZE,
+        .run = [source, output = buffer()] { Consume(*CompressDataLZ4(*output, *source)); },
+    });
+    benchmarks.push_back({
+        .name = "common/lz4/decompress",
+        .bytes_per_run = COMPRESSION_SIZE,
+        .run = [lz4, output = buffer()] { Consume(*DecompressDataLZ4(*output, *lz4)); },
+    });
+    for (const s32 level : {1, 3}) {
+        benchmarks.push_back({
+            .name = fmt::format("common/zstd/compress/level{}", level),
+            .bytes_per_run = COMPRESSION_SIZE,
+            .run =
+                [source, level, output = buffer()] {
+                    Consume(*CompressDataZSTD(*output, *source, level));
+                },
+        });
+    }
+    benchmarks.push_back({
+        .name = "common/zstd/decompress",
+        .bytes_per_run = COMPRESSION_SIZE,
+        .run = [zstd, output = buffer()] { Consume(*DecompressDataZSTD(*output, *zstd)); },
+    });
+}
+} // Anonymous namespace
+
+void AddCommonBenchmarks(std::vector<Benchmark>& benchmarks) {
+    AddQueueBenchmarks(benchmarks);
+    AddCacheBenchmarks(benchmarks);
+    AddPageTableBenchmarks(benchmarks);
+    AddCompressionBenchmarks(benchmarks);
+}
+
+} // namespace Bench
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "bench/bench.h"
+#include "core/crypto/aes_util.h"
+#include "core/crypto/key_manager.h"
+
+namespace Bench {
+namespace {
+using Core::Crypto::AESCipher;
+using Core::Crypto::Key128;
+using Core::Crypto::Key256;
+using Core::Crypto::Mode;
+using Core::Crypto::Op;
+
+/// Sector size of XTSEncryptionLayer, which reads the NAX0 containers and BIS partitions
+constexpr size_t XTS_SECTOR_SIZE = 0x4000;
+
+template <typename Key>
+Key MakeKey() {
+    std::mt19937 rng{SEED};
+    Key key;
+    for (u8& value : key) {
+        value = static_cast<u8>(rng());
+    }
+    return key;
+}
+
+struct Buffers {
+    explicit Buffers(size_t size) : input(size), output(size) {
+        std::mt19937 rng{SEED};
+        for (u8& value : input) {
+            value = static_cast<u8>(rng());
+        }
+    }
+
+    std::vector<u8> input;
+    std::vector<u8> output;
+};
+} // Anonymous namespace
+
+void AddCoreBenchmarks(std::vector<Benchmark>& benchmarks) {
+    // Small reads stay on the calling thread, large ones are split across the workers
+    for (const size_t size : {size_t{16} << 10, size_t{4} << 20}) {
+        const std::string suffix = fmt::format("{}KiB", size >> 10);
+        benchmarks.push_back({
+            .name = "core/crypto/aes128_ctr/" + suffix,
+            .bytes_per_run = size,
+            .run =
+                [cipher = std::make_shared<AESCipher<Key128>>(MakeKey<Key128>(), Mode::CTR),
+                 buffers = std::make_shared<Buffers>(size)] {
+                    static constexpr std::array<u8, 16> IV{};
+                    cipher->SetIV(IV);
+                    cipher->Transcode(buffers->input.data(), buffers->input.size(),
+                                      buffers->output.data(), Op::Decrypt);
+                },
+        });
+        benchmarks.push_back({
+            .name = "core/crypto/aes128_xts/" + suffix,
+            .bytes_per_run = size,
+            .run =
+                [cipher = std::make_shared<AESCipher<Key256>>(MakeKey<Key256>(), Mode::XTS),
+                 buffers = std::make_shared<Buffers>(size)] {
+                    cipher->XTSTranscode(buffers->input.data(), buffers->input.size(),
+                                         buffers->output.data(), 0, XTS_SECTOR_SIZE,
+                                         Op::Decrypt);
+                },
+        });
+    }
+}
+
+} // namespace Bench
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fmt/format.h>
+#include <getopt.h>
+
+#include "bench/bench.h"
+#include "common/common_types.h"
+#include "common/logging/backend.h"
+#include "common/logging/filter.h"
+
+namespace {
+/// Parses the numeric argument of an option, values below one are raised to one
+std::optional<u32> ParseCount(const char* text) {
+    const char* const end = text + std::strlen(text);
+    u32 value{};
+    const auto [ptr, ec] = std::from_chars(text, end, value);
+    if (ec != std::errc{} || ptr != end) {
+        return std::nullopt;
+    }
+    return std::max(value, 1U);
+}
+
+void PrintHelp(const char* argv0) {
+    std::cout << "Usage: " << argv0
+              << " [options]\n"
+                 "-f, --filter    Only run the benchmarks whose name contains the given text\n"
+                 "-h, --help      Display this help and exit\n"
+                 "-j, --json      Write the results as JSON to the given file, - for stdout\n"
+                 "-l, --list      List the benchmarks and exit\n"
+                 "-n, --samples   Number of measured samples of every benchmark\n"
+                 "-t, --min-time  Shortest time of a sample in milliseconds\n";
+}
+
+std::string FormatTime(f64 ns) {
+    if (ns >= 1e6) {
+        return fmt::format("{:.2f} ms", ns / 1e6);
+    }
+    if (ns >= 1e3) {
+        return fmt::format("{:.2f} us", ns / 1e3);
+    }
+    return fmt::format("{:.1f} ns", ns);
+}
+
+std::string FormatThroughput(const Bench::Result& result) {
+    const f64 runs_per_second = result.median_ns > 0.0 ? 1e9 / result.median_ns : 0.0;
+    if (result.bytes_per_run != 0) {
+        return fmt::format("{:.1f} MiB/s", static_cast<f64>(result.bytes_per_run) *
+                                               runs_per_second / (1024.0 * 1024.0));
+    }
+    if (result.items_per_run != 0) {
+        return fmt::format("{:.1f} M/s",
+                           static_cast<f64>(result.items_per_run) * runs_per_second / 1e6);
+    }
+    return {};
+}
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    Common::Log::Initialize();
+    Common::Log::SetColorConsoleBackendEnabled(true);
+    Common::Log::Start();
+
+    Common::Log::Filter filter;
+    filter.ParseFilterString("*:Error");
+    Common::Log::SetGlobalFilter(filter);
+
+    Bench::Options options;
+    std::string name_filter;
+    std::string json_path;
+    bool list = false;
+
+    static struct option long_options[] = {
+        // clang-format off
+        {"filter", required_argument, 0, 'f'},
+        {"help", no_argument, 0, 'h'},
+        {"json", required_argument, 0, 'j'},
+        {"list", no_argument, 0, 'l'},
+        {"samples", required_argument, 0, 'n'},
+        {"min-time", required_argument, 0, 't'},
+        {0, 0, 0, 0},
+        // clang-format on
+    };
+    int option_index = 0;
+    int arg;
+    while ((arg = getopt_long(argc, argv, "f:hj:ln:t:", long_options, &option_index)) != -1) {
+        switch (static_cast<char>(arg)) {
+        case 'f':
+            name_filter = optarg;
+            break;
+        case 'h':
+            PrintHelp(argv[0]);
+            return 0;
+        case 'j':
+            json_path = optarg;
+            break;
+        case 'l':
+            list = true;
+            break;
+        case 'n': {
+            const std::optional<u32> num_samples{ParseCount(optarg)};
+            if (!num_samples) {
+                PrintHelp(argv[0]);
+                return 1;
+            }
+            options.num_samples = *num_samples;
+            break;
+        }
+        case 't': {
+            const std::optional<u32> min_time{ParseCount(optarg)};
+            if (!min_time) {
+                PrintHelp(argv[0]);
+                return 1;
+            }
+            options.min_sample_time = std::chrono::milliseconds{*min_time};
+            break;
+        }
+        default:
+            PrintHelp(argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<Bench::Benchmark> benchmarks;
+    Bench::AddCommonBenchmarks(benchmarks);
+    Bench::AddCoreBenchmarks(benchmarks);
+    Bench::AddAudioCoreBenchmarks(benchmarks);
+    Bench::AddVideoCoreBenchmarks(benchmarks);
+    std::erase_if(benchmarks, [&](const Bench::Benchmark& benchmark) {
+        return benchmark.name.find(name_filter) == std::string::npos;
+    });
+    if (list) {
+        for (const Bench::Benchmark& benchmark : benchmarks) {
+            fmt::print("{}\n", benchmark.name);
+        }
+        return 0;
+    }
+
+    // Keep stdout clean for the JSON output
+    const bool quiet = json_path == "-";
+    if (!quiet) {
+        fmt::print("{:<44}{:>12}{:>12}{:>16}\n", "Benchmark", "Median", "Fastest", "Throughput");
+    }
+    std::vector<Bench::Result> results;
+    for (const Bench::Benchmark& benchmark : benchmarks) {
+        const Bench::Result& result = results.emplace_back(Bench::Run(benchmark, options));
+        if (!quiet) {
+            fmt::print("{:<44}{:>12}{:>12}{:>16}\n", result.name, FormatTime(result.median_ns),
+                       FormatTime(result.min_ns), FormatThroughput(result));
+        }
+    }
+
+    int exit_code = 0;
+    if (!json_path.empty()) {
+        const std::string json = Bench::ToJson(results, options);
+        if (quiet) {
+            std::cout << json << '\n';
+        } else {
+            std::ofstream file{json_path};
+            file << json << '\n';
+            if (!file) {
+                std::cerr << "Failed to write " << json_path << '\n';
+                exit_code = 1;
+            }
+        }
+    }
+
+    Common::Log::Stop();
+    return exit_code;
+}
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "bench/bench.h"
+#include "common/div_ceil.h"
+#include "video_core/surface.h"
+#include "video_core/texture_cache/decode_bc.h"
+#include "video_core/texture_cache/types.h"
+#include "video_core/textures/astc.h"
+#include "video_core/textures/decoders.h"
+
+namespace Bench {
+namespace {
+using VideoCore::Surface::PixelFormat;
+
+using AstcBlock = std::array<u8, 16>;
+
+struct SwizzleFormat {
+    u32 bytes_per_pixel;
+    u32 size;
+};
+
+struct BcFormat {
+    PixelFormat format;
+    const char* name;
+};
+
+/// Random bytes, every BCn block decodes to some color
+std::vector<u8> MakeRandomData(size_t size) {
+    std::mt19937 rng{SEED};
+    std::vector<u8> data(size);
+    for (u8& value : data) {
+        value = static_cast<u8>(rng());
+    }
+    return data;
+}
+
+/// Random single partition LDR blocks with a 4x4 weight grid, random data is rarely valid ASTC
+std::vector<u8> MakeAstcImage(u32 width, u32 height, u32 block_width, u32 block_height) {
+    static constexpr std::array<u32, 10> LDR_MODES{0, 1, 4, 5, 6, 8, 9, 10, 12, 13};
+    std::mt19937 rng{SEED};
+    const size_t num_blocks = static_cast<size_t>(Common::DivCeil(width, block_width)) *
+                              Common::DivCeil(height, block_height);
+    std::vector<u8> data(num_blocks * sizeof(AstcBlock));
+    for (size_t index = 0; index < num_blocks; ++index) {
+        AstcBlock block;
+        for (u8& value : block) {
+            value = static_cast<u8>(rng());
+        }
+        const u32 range = 2 + rng() % 6;
+        const u32 mode = LDR_MODES[rng() % LDR_MODES.size()];
+        // Block mode with the range in bits 0, 1 and 4, and the grid height minus two in bits 5
+        // and 6. Followed by the number of partitions minus one and the color endpoint mode.
+        const u32 header = (range >> 1) | ((range & 1) << 4) | (2 << 5) | (mode << 13);
+        block[0] = static_cast<u8>(header);
+        block[1] = static_cast<u8>(header >> 8);
+        block[2] = static_cast<u8>((block[2] & ~1) | (header >> 16));
+        std::memcpy(&data[index * sizeof(AstcBlock)], block.data(), sizeof(AstcBlock));
+    }
+    return data;
+}
+
+void AddSwizzleBenchmarks(std::vector<Benchmark>& benchmarks) {
+    // Render target sized textures, tiled like the guest driver does with 16 GOBs per block
+    static constexpr u32 BLOCK_HEIGHT = 4;
+    static constexpr u32 BLOCK_DEPTH = 0;
+    static constexpr std::array<SwizzleFormat, 2> FORMATS{{{4, 1024}, {16, 512}}};
+    for (const SwizzleFormat& swizzle_format : FORMATS) {
+        const u32 bytes_per_pixel = swizzle_format.bytes_per_pixel;
+        const u32 size = swizzle_format.size;
+        const size_t linear_size = static_cast<size_t>(size) * size * bytes_per_pixel;
+        const size_t tiled_size = Tegra::Texture::CalculateSize(true, bytes_per_pixel, size, size,
+                                                                1, BLOCK_HEIGHT, BLOCK_DEPTH);
+        const std::string suffix = fmt::format("{}bpp_{}x{}", bytes_per_pixel * 8, size, size);
+        benchmarks.push_back({
+            .name = "video_core/unswizzle/" + suffix,
+            .bytes_per_run = linear_size,
+            .run =
+                [bytes_per_pixel, size, input = MakeRandomData(tiled_size),
+                 output = std::make_shared<std::vector<u8>>(linear_size)] {
+                    Tegra::Texture::UnswizzleTexture(*output, input, bytes_per_pixel, size, size,
+                                                     1, BLOCK_HEIGHT, BLOCK_DEPTH);
+                },
+        });
+        benchmarks.push_back({
+            .name = "video_core/swizzle/" + suffix,
+            .bytes_per_run = linear_size,
+            .run =
+                [bytes_per_pixel, size, input = MakeRandomData(linear_size),
+                 output = std::make_shared<std::vector<u8>>(tiled_size)] {
+                    Tegra::Texture::SwizzleTexture(*output, input, bytes_per_pixel, size, size, 1,
+                                                   BLOCK_HEIGHT, BLOCK_DEPTH);
+                },
+        });
+    }
+}
+
+void AddDecodeBenchmarks(std::vector<Benchmark>& benchmarks) {
+    static constexpr u32 ASTC_SIZE = 256;
+    static constexpr size_t ASTC_OUTPUT_SIZE = static_cast<size_t>(ASTC_SIZE) * ASTC_SIZE * 4;
+    for (const u32 block_size : {4U, 8U}) {
+        benchmarks.push_back({
+            .name = fmt::format("video_core/astc/{}x{}", block_size, block_size),
+            .bytes_per_run = ASTC_OUTPUT_SIZE,
+            .items_per_run = static_cast<u64>(ASTC_SIZE) * ASTC_SIZE,
+            .run =
+                [block_size, input = MakeAstcImage(ASTC_SIZE, ASTC_SIZE, block_size, block_size),
+                 output = std::make_shared<std::vector<u8>>(ASTC_OUTPUT_SIZE)] {
+                    Tegra::Texture::ASTC::Decompress(input, ASTC_SIZE, ASTC_SIZE, 1, block_size,
+                                                     block_size, *output);
+                },
+        });
+    }
+
+    static constexpr u32 BC_SIZE = 512;
+    static constexpr std::array<BcFormat, 4> BC_FORMATS{{
+        {PixelFormat::BC1_RGBA_UNORM, "bc1"},
+        {PixelFormat::BC3_UNORM, "bc3"},
+        {PixelFormat::BC6H_UFLOAT, "bc6h"},
+        {PixelFormat::BC7_UNORM, "bc7"},
+    }};
+    for (const BcFormat& bc_format : BC_FORMATS) {
+        const PixelFormat format = bc_format.format;
+        const size_t input_size = static_cast<size_t>(BC_SIZE / 4) * (BC_SIZE / 4) *
+                                  VideoCore::Surface::BytesPerBlock(format);
+        const size_t output_size =
+            static_cast<size_t>(BC_SIZE) * BC_SIZE * VideoCommon::ConvertedBytesPerBlock(format);
+        benchmarks.push_back({
+            .name = fmt::format("video_core/bcn/{}", bc_format.name),
+            .bytes_per_run = output_size,
+            .items_per_run = static_cast<u64>(BC_SIZE) * BC_SIZE,
+            .run =
+                [format, input = MakeRandomData(input_size),
+                 output = std::make_shared<std::vector<u8>>(output_size)] {
+                    VideoCommon::BufferImageCopy copy{
+                        .buffer_offset = 0,
+                        .buffer_size = input.size(),
+                        .buffer_row_length = BC_SIZE,
+                        .buffer_image_height = BC_SIZE,
+                        .image_subresource = {},
+                        .image_offset = {},
+                        .image_extent = {BC_SIZE, BC_SIZE, 1},
+                    };
+                    VideoCommon::DecompressBCn(input, *output, copy, format);
+                },
+        });
+    }
+}
+} // Anonymous namespace
+
+void AddVideoCoreBenchmarks(std::vector<Benchmark>& benchmarks) {
+    AddSwizzleBenchmarks(benchmarks);
+    AddDecodeBenchmarks(benchmarks);
+}
+
+} // namespace Bench
@@ -93,6 +93,10 @@ static constexpr jint JNI_VERSION = JNI_VERSION_1_6;
 
 namespace Common::Android {
 
+JavaVM* GetJavaVM() {
+    return s_java_vm;
+}
+
 JNIEnv* GetEnvForThread() {
     thread_local static struct OwnedEnv {
         OwnedEnv() {
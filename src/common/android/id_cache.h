@@ -10,6 +10,8 @@
 
 namespace Common::Android {
 
+JavaVM* GetJavaVM();
+
 JNIEnv* GetEnvForThread();
 
 /**
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+
+#include <unistd.h>
+
+#include "common/android/performance_governor.h"
+#include "common/logging/log.h"
+#include "common/thread.h"
+
+namespace Common::Android {
+
+namespace {
+/// Headroom past which the device is about to throttle, 1.0 is where it throttles severely
+constexpr float ThrottlingHeadroom = 0.9f;
+
+/// How far ahead the thermal headroom is forecast
+constexpr int HeadroomForecastSeconds = 10;
+
+constexpr auto ThermalPollInterval = std::chrono::seconds{1};
+
+/// Target given to a new session until the first frame is reported, a frame at 60 FPS
+constexpr s64 DefaultTargetNs = 16'666'666;
+} // Anonymous namespace
+
+PerformanceGovernor::PerformanceGovernor() : library{"libandroid.so"} {
+    if (!library.IsOpen()) {
+        return;
+    }
+    GetManagerFn get_manager{};
+    if (library.GetSymbol("APerformanceHint_getManager", &get_manager) &&
+        library.GetSymbol("APerformanceHint_createSession", &create_session) &&
+        library.GetSymbol("APerformanceHint_updateTargetWorkDuration", &update_target_duration) &&
+        library.GetSymbol("APerformanceHint_reportActualWorkDuration", &report_actual_duration) &&
+        library.GetSymbol("APerformanceHint_closeSession", &close_session)) {
+        hint_manager = get_manager();
+    }
+    if (!hint_manager) {
+        LOG_INFO(Common, "Performance hints are not supported on this device");
+    }
+
+    AcquireThermalFn acquire_thermal{};
+    if (library.GetSymbol("AThermal_acquireManager", &acquire_thermal) &&
+        library.GetSymbol("AThermal_releaseManager", &release_thermal) &&
+        library.GetSymbol("AThermal_getThermalHeadroom", &get_thermal_headroom)) {
+        thermal_manager = acquire_thermal();
+    }
+    if (!thermal_manager) {
+        LOG_INFO(Common, "Thermal headroom is not supported on this device");
+        return;
+    }
+    thermal_thread = std::jthread([this](std::stop_token stop_token) { PollThermals(stop_token); });
+}
+
+PerformanceGovernor::~PerformanceGovernor() {
+    thermal_thread = {};
+    if (thermal_manager) {
+        release_thermal(thermal_manager);
+    }
+    if (session) {
+        close_session(session);
+    }
+}
+
+void PerformanceGovernor::RegisterThread() {
+    if (!hint_manager) {
+        return;
+    }
+    std::scoped_lock lock{session_mutex};
+    thread_ids.push_back(gettid());
+    RecreateSession();
+}
+
+void PerformanceGovernor::UnregisterThread() {
+    if (!hint_manager) {
+        return;
+    }
+    std::scoped_lock lock{session_mutex};
+    std::erase(thread_ids, gettid());
+    RecreateSession();
+}
+
+void PerformanceGovernor::ReportFrame(std::chrono::nanoseconds target,
+                                      std::chrono::nanoseconds actual) {
+    if (!hint_manager || actual.count() <= 0) {
+        return;
+    }
+    std::scoped_lock lock{session_mutex};
+    if (!session) {
+        return;
+    }
+    if (target.count() > 0 && target.count() != target_ns) {
+        target_ns = target.count();
+        update_target_duration(session, target_ns);
+    }
+    report_actual_duration(session, actual.count());
+}
+
+void PerformanceGovernor::RecreateSession() {
+    // The threads of a session are fixed on creation before Android 14
+    if (session) {
+        close_session(session);
+        session = nullptr;
+    }
+    if (thread_ids.empty()) {
+        return;
+    }
+    if (target_ns == 0) {
+        target_ns = DefaultTargetNs;
+    }
+    static_assert(sizeof(pid_t) == sizeof(s32));
+    session = create_session(hint_manager, reinterpret_cast<const s32*>(thread_ids.data()),
+                             thread_ids.size(), target_ns);
+    if (!session) {
+        LOG_WARNING(Common, "Failed to create a performance hint session for {} threads",
+                    thread_ids.size());
+    }
+}
+
+void PerformanceGovernor::PollThermals(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("ThermalGovernor");
+
+    std::mutex mutex;
+    std::condition_variable_any cv;
+    std::unique_lock lock{mutex};
+    while (!stop_token.stop_requested()) {
+        const float headroom = get_thermal_headroom(thermal_manager, HeadroomForecastSeconds);
+        // The headroom is NaN when it is polled too often or the device can't forecast it
+        if (!std::isnan(headroom)) {
+            const bool throttling = headroom >= ThrottlingHeadroom;
+            if (near_throttling.exchange(throttling, std::memory_order_relaxed) != throttling) {
+                LOG_INFO(Common, "Thermal headroom {:.2f}, {} boosting clocks", headroom,
+                         throttling ? "stopped" : "resumed");
+            }
+        }
+        cv.wait_for(lock, stop_token, ThermalPollInterval, [] { return false; });
+    }
+}
+
+PerformanceGovernor& GetPerformanceGovernor() {
+    static PerformanceGovernor governor;
+    return governor;
+}
+
+} // namespace Common::Android
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <sys/types.h>
+
+#include "common/common_types.h"
+#include "common/dynamic_library.h"
+
+struct APerformanceHintManager;
+struct APerformanceHintSession;
+struct AThermalManager;
+
+namespace Common::Android {
+
+/**
+ * Keeps the clocks of the device where the emulation needs them. The threads running the emulated
+ * CPU cores and the GPU are grouped in an ADPF hint session, which is told how long each frame
+ * took against its target so the system raises the clocks before frames are missed instead of
+ * after. The thermal headroom is polled in the background so that work which only exists to hold
+ * the clocks up, like turbo mode, can back off before the device throttles.
+ *
+ * When the device lacks ADPF or the thermal API the governor does nothing.
+ */
+class PerformanceGovernor {
+public:
+    PerformanceGovernor();
+    ~PerformanceGovernor();
+
+    PerformanceGovernor(const PerformanceGovernor&) = delete;
+    PerformanceGovernor& operator=(const PerformanceGovernor&) = delete;
+
+    /// Adds the calling thread to the hint session
+    void RegisterThread();
+
+    /// Removes the calling thread from the hint session
+    void UnregisterThread();
+
+    /// Reports how long the work of a frame took and how long it had to take
+    void ReportFrame(std::chrono::nanoseconds target, std::chrono::nanoseconds actual);
+
+    /// Returns true when the device is forecast to throttle soon
+    [[nodiscard]] bool IsNearThrottling() const {
+        return near_throttling.load(std::memory_order_relaxed);
+    }
+
+private:
+    void RecreateSession();
+    void PollThermals(std::stop_token stop_token);
+
+    using GetManagerFn = APerformanceHintManager* (*)();
+    using CreateSessionFn = APerformanceHintSession* (*)(APerformanceHintManager*, const s32*,
+                                                         size_t, s64);
+    using UpdateDurationFn = int (*)(APerformanceHintSession*, s64);
+    using CloseSessionFn = void (*)(APerformanceHintSession*);
+    using AcquireThermalFn = AThermalManager* (*)();
+    using ReleaseThermalFn = void (*)(AThermalManager*);
+    using GetHeadroomFn = float (*)(AThermalManager*, int);
+
+    /// ADPF and the thermal headroom are newer than our minimum API level, so they are loaded
+    /// at runtime
+    Common::DynamicLibrary library;
+    CreateSessionFn create_session{};
+    UpdateDurationFn update_target_duration{};
+    UpdateDurationFn report_actual_duration{};
+    CloseSessionFn close_session{};
+    ReleaseThermalFn release_thermal{};
+    GetHeadroomFn get_thermal_headroom{};
+
+    APerformanceHintManager* hint_manager{};
+    AThermalManager* thermal_manager{};
+
+    std::mutex session_mutex;
+    APerformanceHintSession* session{};
+    std::vector<pid_t> thread_ids;
+    s64 target_ns{};
+
+    std::atomic_bool near_throttling{};
+    std::jthread thermal_thread;
+};
+
+/// Returns the governor shared by the whole process
+[[nodiscard]] PerformanceGovernor& GetPerformanceGovernor();
+
+} // namespace Common::Android
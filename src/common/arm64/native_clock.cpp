@@ -18,6 +18,13 @@ u64 MultiplyHigh(u64 m, NativeClock::FactorType factor) {
     return static_cast<u64>((m * factor) >> 64);
 }
 
+HostTickScale ToHostTickScale(NativeClock::FactorType factor) {
+    return HostTickScale{
+        .factor_low = static_cast<u64>(factor),
+        .factor_high = static_cast<u64>(factor >> 64),
+    };
+}
+
 } // namespace
 
 NativeClock::NativeClock() {
@@ -50,18 +57,21 @@ s64 NativeClock::GetGPUTick() const {
 }
 
 s64 NativeClock::GetUptime() const {
-    s64 cntvct_el0 = 0;
-    asm volatile("dsb ish\n\t"
-                 "mrs %[cntvct_el0], cntvct_el0\n\t"
-                 "dsb ish\n\t"
-                 : [cntvct_el0] "=r"(cntvct_el0));
-    return cntvct_el0;
+    return static_cast<s64>(ReadNativeTicks());
 }
 
 bool NativeClock::IsNative() const {
     return true;
 }
 
+std::optional<HostTickScale> NativeClock::GetCNTPCTScale() const {
+    return ToHostTickScale(guest_cntfrq_factor);
+}
+
+std::optional<HostTickScale> NativeClock::GetGPUTickScale() const {
+    return ToHostTickScale(gputick_cntfrq_factor);
+}
+
 s64 NativeClock::GetHostCNTFRQ() {
     u64 cntfrq_el0 = 0;
     std::string_view board{""};
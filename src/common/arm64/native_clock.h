@@ -25,6 +25,10 @@ public:
 
     bool IsNative() const override;
 
+    std::optional<HostTickScale> GetCNTPCTScale() const override;
+
+    std::optional<HostTickScale> GetGPUTickScale() const override;
+
     static s64 GetHostCNTFRQ();
 
 public:
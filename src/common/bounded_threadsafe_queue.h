@@ -32,6 +32,32 @@ public:
         Emplace<PushMode::Wait>(std::forward<Args>(args)...);
     }
 
+    /// Moves every element of [first, last) into the queue and publishes them with a single
+    /// consumer wakeup. If the queue fills up midway, the elements written so far are published
+    /// early so the consumer can make room.
+    template <typename It>
+    void EmplaceRangeWait(It first, It last) {
+        size_t write_index = m_write_index.load(std::memory_order::relaxed);
+
+        for (; first != last; ++first) {
+            if ((write_index - m_read_index.load(std::memory_order::acquire)) == Capacity) {
+                // Publish what we have so far and wait for the consumer to free a slot.
+                Publish(write_index);
+
+                std::unique_lock lock{producer_cv_mutex};
+                producer_cv.wait(lock, [this, write_index] {
+                    return (write_index - m_read_index.load(std::memory_order::acquire)) <
+                           Capacity;
+                });
+            }
+
+            std::construct_at(std::addressof(m_data[write_index % Capacity]), std::move(*first));
+            ++write_index;
+        }
+
+        Publish(write_index);
+    }
+
     bool TryPop(T& t) {
         return Pop<PopMode::Try>(t);
     }
@@ -56,6 +82,12 @@ public:
         return t;
     }
 
+    /// Returns the number of elements published but not yet popped.
+    [[nodiscard]] size_t Size() const {
+        return m_write_index.load(std::memory_order::acquire) -
+               m_read_index.load(std::memory_order::acquire);
+    }
+
 private:
     enum class PushMode {
         Try,
@@ -149,6 +181,16 @@ private:
         return true;
     }
 
+    void Publish(size_t write_index) {
+        if (write_index == m_write_index.load(std::memory_order::relaxed)) {
+            return;
+        }
+        m_write_index.store(write_index, std::memory_order::release);
+
+        std::scoped_lock lock{consumer_cv_mutex};
+        consumer_cv.notify_one();
+    }
+
     alignas(128) std::atomic_size_t m_read_index{0};
     alignas(128) std::atomic_size_t m_write_index{0};
 
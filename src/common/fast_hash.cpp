@@ -0,0 +1,332 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <iterator>
+
+#include "common/fast_hash.h"
+#include "common/swap.h"
+#include "common/uint128.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AVX2_TARGET
+#endif
+
+namespace Common {
+namespace {
+
+// Constants and default secret of XXH3, see https://github.com/Cyan4973/xxHash
+constexpr u64 Prime32_1 = 0x9E3779B1U;
+constexpr u64 Prime32_2 = 0x85EBCA77U;
+constexpr u64 Prime32_3 = 0xC2B2AE3DU;
+constexpr u64 Prime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr u64 Prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr u64 Prime64_3 = 0x165667B19E3779F9ULL;
+constexpr u64 Prime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr u64 Prime64_5 = 0x27D4EB2F165667C5ULL;
+constexpr u64 PrimeMx1 = 0x165667919E3779F9ULL;
+constexpr u64 PrimeMx2 = 0x9FB21C651E98DF25ULL;
+
+constexpr std::size_t StripeSize = 64;
+constexpr std::size_t SecretSize = 192;
+constexpr std::size_t SecretConsumeRate = 8;
+constexpr std::size_t StripesPerBlock = (SecretSize - StripeSize) / SecretConsumeRate;
+constexpr std::size_t BlockSize = StripeSize * StripesPerBlock;
+constexpr std::size_t LastStripeSecretOffset = SecretSize - StripeSize - 7;
+constexpr std::size_t MergeSecretOffset = 11;
+
+alignas(64) constexpr std::array<u8, SecretSize> Secret{
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+using Accumulators = std::array<u64, 8>;
+
+u32 Read32(const u8* data) {
+    u32 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+u64 Read64(const u8* data) {
+    u64 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+u64 Multiply128Fold64(u64 lhs, u64 rhs) {
+    const u128 product = Multiply64Into128(lhs, rhs);
+    return product[0] ^ product[1];
+}
+
+u64 Avalanche(u64 hash) {
+    hash ^= hash >> 37;
+    hash *= PrimeMx1;
+    return hash ^ (hash >> 32);
+}
+
+u64 Xxh64Avalanche(u64 hash) {
+    hash ^= hash >> 33;
+    hash *= Prime64_2;
+    hash ^= hash >> 29;
+    hash *= Prime64_3;
+    return hash ^ (hash >> 32);
+}
+
+u64 Rrmxmx(u64 hash, std::size_t size) {
+    hash ^= std::rotl(hash, 49) ^ std::rotl(hash, 24);
+    hash *= PrimeMx2;
+    hash ^= (hash >> 35) + size;
+    hash *= PrimeMx2;
+    return hash ^ (hash >> 28);
+}
+
+u64 Mix16(const u8* data, const u8* secret) {
+    return Multiply128Fold64(Read64(data) ^ Read64(secret), Read64(data + 8) ^ Read64(secret + 8));
+}
+
+u64 Hash0To16(const u8* data, std::size_t size) {
+    const u8* const secret = Secret.data();
+    if (size > 8) {
+        const u64 low = Read64(data) ^ (Read64(secret + 24) ^ Read64(secret + 32));
+        const u64 high = Read64(data + size - 8) ^ (Read64(secret + 40) ^ Read64(secret + 48));
+        return Avalanche(size + swap64(low) + high + Multiply128Fold64(low, high));
+    }
+    if (size >= 4) {
+        const u64 input = Read32(data + size - 4) + (u64{Read32(data)} << 32);
+        return Rrmxmx(input ^ (Read64(secret + 8) ^ Read64(secret + 16)), size);
+    }
+    if (size > 0) {
+        const u32 combined = (u32{data[0]} << 16) | (u32{data[size >> 1]} << 24) |
+                             u32{data[size - 1]} | (static_cast<u32>(size) << 8);
+        return Xxh64Avalanche(combined ^ u64{Read32(secret) ^ Read32(secret + 4)});
+    }
+    return Xxh64Avalanche(Read64(secret + 56) ^ Read64(secret + 64));
+}
+
+u64 Hash17To128(const u8* data, std::size_t size) {
+    const u8* const secret = Secret.data();
+    u64 acc = size * Prime64_1;
+    if (size > 32) {
+        if (size > 64) {
+            if (size > 96) {
+                acc += Mix16(data + 48, secret + 96);
+                acc += Mix16(data + size - 64, secret + 112);
+            }
+            acc += Mix16(data + 32, secret + 64);
+            acc += Mix16(data + size - 48, secret + 80);
+        }
+        acc += Mix16(data + 16, secret + 32);
+        acc += Mix16(data + size - 32, secret + 48);
+    }
+    acc += Mix16(data, secret);
+    acc += Mix16(data + size - 16, secret + 16);
+    return Avalanche(acc);
+}
+
+u64 Hash129To240(const u8* data, std::size_t size) {
+    const u8* const secret = Secret.data();
+    u64 acc = size * Prime64_1;
+    for (std::size_t i = 0; i < 8; ++i) {
+        acc += Mix16(data + 16 * i, secret + 16 * i);
+    }
+    acc = Avalanche(acc);
+    const std::size_t rounds = size / 16;
+    for (std::size_t i = 8; i < rounds; ++i) {
+        acc += Mix16(data + 16 * i, secret + 16 * (i - 8) + 3);
+    }
+    acc += Mix16(data + size - 16, secret + 136 - 17);
+    return Avalanche(acc);
+}
+
+#if !defined(ARCHITECTURE_x86_64) && !defined(ARCHITECTURE_arm64)
+void AccumulateScalar(Accumulators& acc, const u8* data, const u8* secret, std::size_t stripes) {
+    for (std::size_t stripe = 0; stripe < stripes; ++stripe) {
+        const u8* const input = data + stripe * StripeSize;
+        const u8* const key = secret + stripe * SecretConsumeRate;
+        for (std::size_t i = 0; i < acc.size(); ++i) {
+            const u64 value = Read64(input + i * 8);
+            const u64 keyed = value ^ Read64(key + i * 8);
+            acc[i ^ 1] += value;
+            acc[i] += (keyed & 0xFFFFFFFF) * (keyed >> 32);
+        }
+    }
+}
+#endif
+
+#ifndef ARCHITECTURE_arm64
+void ScrambleScalar(Accumulators& acc, const u8* secret) {
+    for (std::size_t i = 0; i < acc.size(); ++i) {
+        u64 value = acc[i];
+        value ^= value >> 47;
+        value ^= Read64(secret + i * 8);
+        acc[i] = value * Prime32_1;
+    }
+}
+#endif
+
+#if defined(ARCHITECTURE_x86_64)
+void AccumulateSse2(Accumulators& acc, const u8* data, const u8* secret, std::size_t stripes) {
+    __m128i state[4];
+    for (std::size_t i = 0; i < std::size(state); ++i) {
+        state[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc.data() + i * 2));
+    }
+    for (std::size_t stripe = 0; stripe < stripes; ++stripe) {
+        const u8* const input = data + stripe * StripeSize;
+        const u8* const key = secret + stripe * SecretConsumeRate;
+        for (std::size_t i = 0; i < std::size(state); ++i) {
+            const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * 16));
+            const __m128i keyed = _mm_xor_si128(
+                value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(key + i * 16)));
+            const __m128i product = _mm_mul_epu32(keyed, _mm_srli_epi64(keyed, 32));
+            const __m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+            state[i] = _mm_add_epi64(product, _mm_add_epi64(state[i], swapped));
+        }
+    }
+    for (std::size_t i = 0; i < std::size(state); ++i) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc.data() + i * 2), state[i]);
+    }
+}
+
+AVX2_TARGET __m256i AccumulateLanesAvx2(__m256i acc, const u8* input, const u8* key) {
+    const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+    const __m256i keyed =
+        _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key)));
+    const __m256i product = _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+    const __m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+    return _mm256_add_epi64(product, _mm256_add_epi64(acc, swapped));
+}
+
+AVX2_TARGET void AccumulateAvx2(Accumulators& acc, const u8* data, const u8* secret,
+                                std::size_t stripes) {
+    __m256i acc_low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc.data()));
+    __m256i acc_high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc.data() + 4));
+    for (std::size_t stripe = 0; stripe < stripes; ++stripe) {
+        const u8* const input = data + stripe * StripeSize;
+        const u8* const key = secret + stripe * SecretConsumeRate;
+        acc_low = AccumulateLanesAvx2(acc_low, input, key);
+        acc_high = AccumulateLanesAvx2(acc_high, input + 32, key + 32);
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc.data()), acc_low);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc.data() + 4), acc_high);
+}
+
+AVX2_TARGET void ScrambleAvx2(Accumulators& acc, const u8* secret) {
+    const __m256i prime = _mm256_set1_epi32(static_cast<int>(Prime32_1));
+    for (std::size_t i = 0; i < acc.size(); i += 4) {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc.data() + i));
+        value = _mm256_xor_si256(value, _mm256_srli_epi64(value, 47));
+        value = _mm256_xor_si256(
+            value, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret + i * 8)));
+        const __m256i high = _mm256_shuffle_epi32(value, _MM_SHUFFLE(0, 3, 0, 1));
+        const __m256i product_low = _mm256_mul_epu32(value, prime);
+        const __m256i product_high = _mm256_mul_epu32(high, prime);
+        value = _mm256_add_epi64(product_low, _mm256_slli_epi64(product_high, 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc.data() + i), value);
+    }
+}
+#elif defined(ARCHITECTURE_arm64)
+void AccumulateNeon(Accumulators& acc, const u8* data, const u8* secret, std::size_t stripes) {
+    uint64x2_t state[4];
+    for (std::size_t i = 0; i < std::size(state); ++i) {
+        state[i] = vld1q_u64(acc.data() + i * 2);
+    }
+    for (std::size_t stripe = 0; stripe < stripes; ++stripe) {
+        const u8* const input = data + stripe * StripeSize;
+        const u8* const key = secret + stripe * SecretConsumeRate;
+        for (std::size_t i = 0; i < std::size(state); ++i) {
+            const uint64x2_t value = vreinterpretq_u64_u8(vld1q_u8(input + i * 16));
+            const uint64x2_t keyed =
+                veorq_u64(value, vreinterpretq_u64_u8(vld1q_u8(key + i * 16)));
+            state[i] = vaddq_u64(state[i], vextq_u64(value, value, 1));
+            state[i] = vmlal_u32(state[i], vmovn_u64(keyed), vshrn_n_u64(keyed, 32));
+        }
+    }
+    for (std::size_t i = 0; i < std::size(state); ++i) {
+        vst1q_u64(acc.data() + i * 2, state[i]);
+    }
+}
+
+void ScrambleNeon(Accumulators& acc, const u8* secret) {
+    const uint32x2_t prime = vdup_n_u32(static_cast<u32>(Prime32_1));
+    for (std::size_t i = 0; i < acc.size(); i += 2) {
+        uint64x2_t value = vld1q_u64(acc.data() + i);
+        value = veorq_u64(value, vshrq_n_u64(value, 47));
+        value = veorq_u64(value, vreinterpretq_u64_u8(vld1q_u8(secret + i * 8)));
+        const uint64x2_t product_high = vshlq_n_u64(vmull_u32(vshrn_n_u64(value, 32), prime), 32);
+        vst1q_u64(acc.data() + i, vmlal_u32(product_high, vmovn_u64(value), prime));
+    }
+}
+#endif
+
+using AccumulateFunc = void (*)(Accumulators&, const u8*, const u8*, std::size_t);
+using ScrambleFunc = void (*)(Accumulators&, const u8*);
+
+u64 HashLong(const u8* data, std::size_t size, AccumulateFunc accumulate, ScrambleFunc scramble) {
+    const u8* const secret = Secret.data();
+    Accumulators acc{Prime32_3, Prime64_1, Prime64_2, Prime64_3,
+                     Prime64_4, Prime32_2, Prime64_5, Prime32_1};
+    const std::size_t blocks = (size - 1) / BlockSize;
+    for (std::size_t block = 0; block < blocks; ++block) {
+        accumulate(acc, data + block * BlockSize, secret, StripesPerBlock);
+        scramble(acc, secret + SecretSize - StripeSize);
+    }
+    const std::size_t stripes = ((size - 1) - BlockSize * blocks) / StripeSize;
+    accumulate(acc, data + blocks * BlockSize, secret, stripes);
+    accumulate(acc, data + size - StripeSize, secret + LastStripeSecretOffset, 1);
+
+    u64 result = size * Prime64_1;
+    for (std::size_t i = 0; i < acc.size(); i += 2) {
+        const u8* const key = secret + MergeSecretOffset + i * 8;
+        result += Multiply128Fold64(acc[i] ^ Read64(key), acc[i + 1] ^ Read64(key + 8));
+    }
+    return Avalanche(result);
+}
+
+} // Anonymous namespace
+
+u64 FastHash64(const void* data, std::size_t size) {
+    const u8* const input = static_cast<const u8*>(data);
+    if (size <= 16) {
+        return Hash0To16(input, size);
+    }
+    if (size <= 128) {
+        return Hash17To128(input, size);
+    }
+    if (size <= 240) {
+        return Hash129To240(input, size);
+    }
+#if defined(ARCHITECTURE_x86_64)
+    if (GetCPUCaps().avx2) {
+        return HashLong(input, size, AccumulateAvx2, ScrambleAvx2);
+    }
+    return HashLong(input, size, AccumulateSse2, ScrambleScalar);
+#elif defined(ARCHITECTURE_arm64)
+    return HashLong(input, size, AccumulateNeon, ScrambleNeon);
+#else
+    return HashLong(input, size, AccumulateScalar, ScrambleScalar);
+#endif
+}
+
+} // namespace Common
@@ -1,78 +1,273 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <mutex>
+#include <utility>
+#include <vector>
 
+#include "common/alignment.h"
 #include "common/assert.h"
 #include "common/fiber.h"
+#include "common/spin_lock.h"
 #include "common/virtual_buffer.h"
 
+// Native context switches save the callee-saved registers of the host ABI and nothing else,
+// other targets use Boost.Context.
+#if (defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)) && !defined(_WIN32)
+#define USE_NATIVE_FIBER_CONTEXT 1
+#else
 #include <boost/context/detail/fcontext.hpp>
+#endif
+
+#ifdef USE_NATIVE_FIBER_CONTEXT
+
+#ifdef __APPLE__
+#define FIBER_SYMBOL(name) "_" #name
+#define FIBER_FUNCTION(name)                                                                       \
+    ".text\n.globl " FIBER_SYMBOL(name) "\n.private_extern " FIBER_SYMBOL(                         \
+        name) "\n.p2align 4\n" FIBER_SYMBOL(name) ":\n"
+#else
+#define FIBER_SYMBOL(name) #name
+#define FIBER_FUNCTION(name)                                                                       \
+    ".text\n.globl " FIBER_SYMBOL(name) "\n.hidden " FIBER_SYMBOL(                                 \
+        name) "\n.type " FIBER_SYMBOL(name) ", %function\n.p2align 4\n" FIBER_SYMBOL(name) ":\n"
+#endif
+
+extern "C" {
+/// Saves the current context to save, resumes the context 'to' and hands it data
+/// @returns The data given by the context that resumed this one
+void* YuzuSwitchFiberContext(void** save, void* to, void* data);
+
+/// First return address of a new context, calls the entry point stored in the context
+void YuzuFiberTrampoline();
+}
+
+#if defined(ARCHITECTURE_x86_64)
+// Frame: MXCSR and x87 control word, r15, r14, r13, r12, rbx, rbp, return address
+asm(FIBER_FUNCTION(YuzuSwitchFiberContext) //
+    "pushq %rbp\n"
+    "pushq %rbx\n"
+    "pushq %r12\n"
+    "pushq %r13\n"
+    "pushq %r14\n"
+    "pushq %r15\n"
+    "subq $8, %rsp\n"
+    "stmxcsr (%rsp)\n"
+    "fnstcw 4(%rsp)\n"
+    "movq %rsp, (%rdi)\n"
+    "movq %rsi, %rsp\n"
+    "ldmxcsr (%rsp)\n"
+    "fldcw 4(%rsp)\n"
+    "addq $8, %rsp\n"
+    "popq %r15\n"
+    "popq %r14\n"
+    "popq %r13\n"
+    "popq %r12\n"
+    "popq %rbx\n"
+    "popq %rbp\n"
+    "movq %rdx, %rax\n"
+    "ret\n" //
+    FIBER_FUNCTION(YuzuFiberTrampoline) //
+    "movq %rax, %rdi\n"
+    "callq *%r12\n"
+    "ud2\n");
+#elif defined(ARCHITECTURE_arm64)
+// Frame: d8-d15, x19-x28, x29, x30
+asm(FIBER_FUNCTION(YuzuSwitchFiberContext) //
+    "sub sp, sp, #0xa0\n"
+    "stp d8, d9, [sp, #0x00]\n"
+    "stp d10, d11, [sp, #0x10]\n"
+    "stp d12, d13, [sp, #0x20]\n"
+    "stp d14, d15, [sp, #0x30]\n"
+    "stp x19, x20, [sp, #0x40]\n"
+    "stp x21, x22, [sp, #0x50]\n"
+    "stp x23, x24, [sp, #0x60]\n"
+    "stp x25, x26, [sp, #0x70]\n"
+    "stp x27, x28, [sp, #0x80]\n"
+    "stp x29, x30, [sp, #0x90]\n"
+    "mov x9, sp\n"
+    "str x9, [x0]\n"
+    "mov sp, x1\n"
+    "ldp d8, d9, [sp, #0x00]\n"
+    "ldp d10, d11, [sp, #0x10]\n"
+    "ldp d12, d13, [sp, #0x20]\n"
+    "ldp d14, d15, [sp, #0x30]\n"
+    "ldp x19, x20, [sp, #0x40]\n"
+    "ldp x21, x22, [sp, #0x50]\n"
+    "ldp x23, x24, [sp, #0x60]\n"
+    "ldp x25, x26, [sp, #0x70]\n"
+    "ldp x27, x28, [sp, #0x80]\n"
+    "ldp x29, x30, [sp, #0x90]\n"
+    "add sp, sp, #0xa0\n"
+    "mov x0, x2\n"
+    "ret\n" //
+    FIBER_FUNCTION(YuzuFiberTrampoline) //
+    "blr x19\n"
+    "brk #0\n");
+#endif
+
+#endif
 
 namespace Common {
 
 constexpr std::size_t default_stack_size = 512 * 1024;
 
+namespace {
+#ifdef USE_NATIVE_FIBER_CONTEXT
+using Context = void*;
+
+void* SwitchContext(Context* save, Context to, void* data) {
+    return YuzuSwitchFiberContext(save, to, data);
+}
+
+template <void (*Entry)(void*)>
+Context MakeContext(u8* stack_base, [[maybe_unused]] std::size_t size) {
+    auto* const top =
+        reinterpret_cast<u64*>(AlignDown(reinterpret_cast<uintptr_t>(stack_base), 16));
+#if defined(ARCHITECTURE_x86_64)
+    u64* const frame = top - 8;
+    frame[0] = (u64{0x037F} << 32) | 0x1F80; // Default MXCSR and x87 control word
+    frame[1] = frame[2] = frame[3] = frame[5] = frame[6] = 0;
+    frame[4] = reinterpret_cast<u64>(Entry);
+    frame[7] = reinterpret_cast<u64>(&YuzuFiberTrampoline);
+#elif defined(ARCHITECTURE_arm64)
+    u64* const frame = top - 20;
+    std::fill(frame, top, u64{0});
+    frame[8] = reinterpret_cast<u64>(Entry);
+    frame[19] = reinterpret_cast<u64>(&YuzuFiberTrampoline);
+#endif
+    return frame;
+}
+#else
+using Context = boost::context::detail::fcontext_t;
+
+/// Boost resumes contexts without saving the suspended one, the resumed side saves it instead
+struct SwitchRecord {
+    Context* save;
+    void* data;
+};
+
+void* ReceiveSwitch(boost::context::detail::transfer_t transfer) {
+    const auto* const record = static_cast<const SwitchRecord*>(transfer.data);
+    *record->save = transfer.fctx;
+    return record->data;
+}
+
+void* SwitchContext(Context* save, Context to, void* data) {
+    SwitchRecord record{save, data};
+    return ReceiveSwitch(boost::context::detail::jump_fcontext(to, &record));
+}
+
+template <void (*Entry)(void*)>
+void ContextEntry(boost::context::detail::transfer_t transfer) {
+    Entry(ReceiveSwitch(transfer));
+}
+
+template <void (*Entry)(void*)>
+Context MakeContext(u8* stack_base, std::size_t size) {
+    return boost::context::detail::make_fcontext(stack_base, size, ContextEntry<Entry>);
+}
+#endif
+
+/// Keeps the stacks of destroyed fibers around, guest threads are created and destroyed often
+class StackPool {
+public:
+    VirtualBuffer<u8> Acquire() {
+        {
+            std::scoped_lock lock{mutex};
+            if (!stacks.empty()) {
+                VirtualBuffer<u8> stack{std::move(stacks.back())};
+                stacks.pop_back();
+                return stack;
+            }
+        }
+        return VirtualBuffer<u8>(default_stack_size);
+    }
+
+    void Release(VirtualBuffer<u8>&& stack) {
+        if (stack.size() == 0) {
+            return;
+        }
+        std::scoped_lock lock{mutex};
+        if (stacks.size() < max_pooled_stacks) {
+            stacks.push_back(std::move(stack));
+        }
+    }
+
+private:
+    static constexpr std::size_t max_pooled_stacks = 64;
+
+    std::mutex mutex;
+    std::vector<VirtualBuffer<u8>> stacks;
+};
+
+StackPool& GetStackPool() {
+    static StackPool pool;
+    return pool;
+}
+} // Anonymous namespace
+
 struct Fiber::FiberImpl {
-    FiberImpl() : stack{default_stack_size}, rewind_stack{default_stack_size} {}
+    ~FiberImpl() {
+        GetStackPool().Release(std::move(stack));
+        GetStackPool().Release(std::move(rewind_stack));
+    }
 
     VirtualBuffer<u8> stack;
     VirtualBuffer<u8> rewind_stack;
 
-    std::mutex guard;
+    /// Held while the fiber runs, only contended while it's being switched out on another thread
+    SpinLock guard;
     std::function<void()> entry_point;
     std::function<void()> rewind_point;
-    std::shared_ptr<Fiber> previous_fiber;
+    Fiber* previous_fiber{};
     bool is_thread_fiber{};
     bool released{};
 
-    u8* stack_limit{};
-    u8* rewind_stack_limit{};
-    boost::context::detail::fcontext_t context{};
-    boost::context::detail::fcontext_t rewind_context{};
+    Context context{};
+    Context rewind_context{};
 };
 
 void Fiber::SetRewindPoint(std::function<void()>&& rewind_func) {
     impl->rewind_point = std::move(rewind_func);
 }
 
-void Fiber::Start(boost::context::detail::transfer_t& transfer) {
+void Fiber::OnSwitchedTo() {
+    if (Fiber* const previous = std::exchange(impl->previous_fiber, nullptr)) {
+        previous->impl->guard.unlock();
+    }
+}
+
+void Fiber::Start() {
     ASSERT(impl->previous_fiber != nullptr);
-    impl->previous_fiber->impl->context = transfer.fctx;
-    impl->previous_fiber->impl->guard.unlock();
-    impl->previous_fiber.reset();
+    OnSwitchedTo();
     impl->entry_point();
     UNREACHABLE();
 }
 
-void Fiber::OnRewind([[maybe_unused]] boost::context::detail::transfer_t& transfer) {
+void Fiber::OnRewind() {
     ASSERT(impl->context != nullptr);
     impl->context = impl->rewind_context;
     impl->rewind_context = nullptr;
-    u8* tmp = impl->stack_limit;
-    impl->stack_limit = impl->rewind_stack_limit;
-    impl->rewind_stack_limit = tmp;
+    std::swap(impl->stack, impl->rewind_stack);
     impl->rewind_point();
     UNREACHABLE();
 }
 
-void Fiber::FiberStartFunc(boost::context::detail::transfer_t transfer) {
-    auto* fiber = static_cast<Fiber*>(transfer.data);
-    fiber->Start(transfer);
+void Fiber::FiberStartFunc(void* data) {
+    static_cast<Fiber*>(data)->Start();
 }
 
-void Fiber::RewindStartFunc(boost::context::detail::transfer_t transfer) {
-    auto* fiber = static_cast<Fiber*>(transfer.data);
-    fiber->OnRewind(transfer);
+void Fiber::RewindStartFunc(void* data) {
+    static_cast<Fiber*>(data)->OnRewind();
 }
 
 Fiber::Fiber(std::function<void()>&& entry_point_func) : impl{std::make_unique<FiberImpl>()} {
     impl->entry_point = std::move(entry_point_func);
-    impl->stack_limit = impl->stack.data();
-    impl->rewind_stack_limit = impl->rewind_stack.data();
-    u8* stack_base = impl->stack_limit + default_stack_size;
-    impl->context =
-        boost::context::detail::make_fcontext(stack_base, impl->stack.size(), FiberStartFunc);
+    impl->stack = GetStackPool().Acquire();
+    u8* stack_base = impl->stack.data() + impl->stack.size();
+    impl->context = MakeContext<FiberStartFunc>(stack_base, impl->stack.size());
 }
 
 Fiber::Fiber() : impl{std::make_unique<FiberImpl>()} {}
@@ -101,28 +296,32 @@ void Fiber::Exit() {
 void Fiber::Rewind() {
     ASSERT(impl->rewind_point);
     ASSERT(impl->rewind_context == nullptr);
-    u8* stack_base = impl->rewind_stack_limit + default_stack_size;
-    impl->rewind_context =
-        boost::context::detail::make_fcontext(stack_base, impl->stack.size(), RewindStartFunc);
-    boost::context::detail::jump_fcontext(impl->rewind_context, this);
+    // Only allocated when needed, most fibers never rewind
+    if (impl->rewind_stack.size() == 0) {
+        impl->rewind_stack = GetStackPool().Acquire();
+    }
+    u8* stack_base = impl->rewind_stack.data() + impl->rewind_stack.size();
+    impl->rewind_context = MakeContext<RewindStartFunc>(stack_base, impl->rewind_stack.size());
+    // The current stack is abandoned, its context is saved nowhere
+    Context discarded{};
+    SwitchContext(&discarded, impl->rewind_context, this);
 }
 
 void Fiber::YieldTo(std::weak_ptr<Fiber> weak_from, Fiber& to) {
+    // Not kept alive while suspended, holding a reference here would leak fibers never resumed
+    Fiber* const from = weak_from.lock().get();
+    ASSERT_MSG(from != nullptr, "Yielding from a destroyed fiber");
+    YieldTo(*from, to);
+}
+
+void Fiber::YieldTo(Fiber& from, Fiber& to) {
     to.impl->guard.lock();
-    to.impl->previous_fiber = weak_from.lock();
+    to.impl->previous_fiber = &from;
 
-    auto transfer = boost::context::detail::jump_fcontext(to.impl->context, &to);
+    SwitchContext(&from.impl->context, to.impl->context, &to);
 
-    // "from" might no longer be valid if the thread was killed
-    if (auto from = weak_from.lock()) {
-        if (from->impl->previous_fiber == nullptr) {
-            ASSERT_MSG(false, "previous_fiber is nullptr!");
-            return;
-        }
-        from->impl->previous_fiber->impl->context = transfer.fctx;
-        from->impl->previous_fiber->impl->guard.unlock();
-        from->impl->previous_fiber.reset();
-    }
+    // The fiber that switched back to us is released now that its context has been saved
+    from.OnSwitchedTo();
 }
 
 std::shared_ptr<Fiber> Fiber::ThreadToFiber() {
@@ -6,10 +6,6 @@
 #include <functional>
 #include <memory>
 
-namespace boost::context::detail {
-struct transfer_t;
-}
-
 namespace Common {
 
 /**
@@ -41,6 +37,9 @@ public:
     /// Yields control from Fiber 'from' to Fiber 'to'
     /// Fiber 'from' must be the currently running fiber.
     static void YieldTo(std::weak_ptr<Fiber> weak_from, Fiber& to);
+
+    /// Same as above without touching reference counts, preferred on hot paths
+    static void YieldTo(Fiber& from, Fiber& to);
     [[nodiscard]] static std::shared_ptr<Fiber> ThreadToFiber();
 
     void SetRewindPoint(std::function<void()>&& rewind_func);
@@ -53,10 +52,13 @@ public:
 private:
     Fiber();
 
-    void OnRewind(boost::context::detail::transfer_t& transfer);
-    void Start(boost::context::detail::transfer_t& transfer);
-    static void FiberStartFunc(boost::context::detail::transfer_t transfer);
-    static void RewindStartFunc(boost::context::detail::transfer_t transfer);
+    /// Releases the fiber that switched to this one, called after every switch
+    void OnSwitchedTo();
+
+    void OnRewind();
+    void Start();
+    static void FiberStartFunc(void* data);
+    static void RewindStartFunc(void* data);
 
     struct FiberImpl;
     std::unique_ptr<FiberImpl> impl;
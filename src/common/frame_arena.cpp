@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdint>
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/frame_arena.h"
+
+namespace Common {
+
+FrameArena::FrameArena(std::size_t initial_capacity) : buffer(initial_capacity) {}
+
+FrameArena::~FrameArena() = default;
+
+void* FrameArena::Allocate(std::size_t size, std::size_t alignment) {
+    ++live_allocations;
+    frame_bytes += size + alignment;
+    if (void* const pointer = Bump(buffer, offset, size, alignment)) {
+        return pointer;
+    }
+    if (!extra_blocks.empty()) {
+        if (void* const pointer = Bump(extra_blocks.back(), extra_offset, size, alignment)) {
+            return pointer;
+        }
+    }
+    // The arena is full for this frame, continue on a new block at least as large as the arena
+    extra_blocks.emplace_back(std::max(size + alignment, buffer.capacity()));
+    extra_offset = 0;
+    return Bump(extra_blocks.back(), extra_offset, size, alignment);
+}
+
+void FrameArena::Reset() {
+    ASSERT_MSG(live_allocations == 0, "{} frame allocations are still in use", live_allocations);
+    if (!extra_blocks.empty()) {
+        extra_blocks.clear();
+        buffer.resize_destructive(AlignUp(frame_bytes, 4096));
+    }
+    offset = 0;
+    extra_offset = 0;
+    frame_bytes = 0;
+}
+
+void* FrameArena::Bump(ScratchBuffer<u8>& block, std::size_t& used, std::size_t size,
+                       std::size_t alignment) {
+    const auto base = reinterpret_cast<std::uintptr_t>(block.data());
+    const std::size_t aligned = AlignUp(base + used, alignment) - base;
+    if (aligned + size > block.capacity()) {
+        return nullptr;
+    }
+    used = aligned + size;
+    return block.data() + aligned;
+}
+
+} // namespace Common
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "common/scratch_buffer.h"
+
+namespace Common {
+
+/**
+ * Bump allocator for containers that only live during a frame. Deallocating does nothing, the
+ * memory is reclaimed at once by Reset at the end of the frame. When a frame needs more than the
+ * arena holds, it takes extra blocks from the heap and grows to fit the whole frame on reset, so a
+ * steady workload stops touching the heap after a few frames.
+ *
+ * Not thread-safe, callers serialize access with the lock of the owner of the arena.
+ */
+class FrameArena {
+public:
+    static constexpr std::size_t DefaultCapacity = 64 * 1024;
+
+    explicit FrameArena(std::size_t initial_capacity = DefaultCapacity);
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment);
+
+    void Deallocate() noexcept {
+        --live_allocations;
+    }
+
+    /// Reclaims every allocation, none of them may be in use anymore
+    void Reset();
+
+    /// Returns the bytes held by the arena, not counting the extra blocks of the current frame
+    [[nodiscard]] std::size_t Capacity() const noexcept {
+        return buffer.capacity();
+    }
+
+private:
+    [[nodiscard]] static void* Bump(ScratchBuffer<u8>& block, std::size_t& used,
+                                    std::size_t size, std::size_t alignment);
+
+    ScratchBuffer<u8> buffer;
+    std::size_t offset{};
+    std::vector<ScratchBuffer<u8>> extra_blocks;
+    std::size_t extra_offset{};
+    /// Bytes requested during the frame, including alignment padding
+    std::size_t frame_bytes{};
+    std::size_t live_allocations{};
+};
+
+/// Allocator adapter for standard and boost containers that allocates from a FrameArena
+template <typename T>
+class FrameAllocator {
+public:
+    using value_type = T;
+
+    explicit FrameAllocator(FrameArena& arena_) noexcept : arena{&arena_} {}
+
+    template <typename U>
+    FrameAllocator(const FrameAllocator<U>& other) noexcept : arena{other.arena} {}
+
+    [[nodiscard]] T* allocate(std::size_t count) {
+        return static_cast<T*>(arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {
+        arena->Deallocate();
+    }
+
+    template <typename U>
+    bool operator==(const FrameAllocator<U>& other) const noexcept {
+        return arena == other.arena;
+    }
+
+private:
+    template <typename U>
+    friend class FrameAllocator;
+
+    FrameArena* arena;
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+/// Keeps up to N elements inline, more than that go to the arena instead of the heap
+template <typename T, std::size_t N>
+using FrameSmallVector = boost::container::small_vector<T, N, FrameAllocator<T>>;
+
+/// Returns an empty small vector allocating from the arena, boost wraps the allocator of small
+/// vectors so it can't be passed directly
+template <typename T, std::size_t N>
+[[nodiscard]] FrameSmallVector<T, N> MakeFrameSmallVector(FrameArena& arena) {
+    using Vector = FrameSmallVector<T, N>;
+    return Vector(typename Vector::allocator_type(FrameAllocator<T>{arena}));
+}
+
+} // namespace Common
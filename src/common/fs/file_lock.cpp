@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#include "common/fs/file_lock.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+
+namespace Common::FS {
+
+FileLock::FileLock(const std::filesystem::path& path, FileLockMode mode) {
+#ifdef _WIN32
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                    nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LOG_WARNING(Common_Filesystem, "Failed to open lock file {}, error {}",
+                    PathToUTF8String(path), GetLastError());
+        return;
+    }
+    const DWORD flags = mode == FileLockMode::Exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0;
+    OVERLAPPED overlapped{};
+    if (!LockFileEx(file, flags, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+        LOG_WARNING(Common_Filesystem, "Failed to lock {}, error {}", PathToUTF8String(path),
+                    GetLastError());
+        CloseHandle(file);
+        return;
+    }
+    handle = file;
+#else
+    const int file = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (file == -1) {
+        LOG_WARNING(Common_Filesystem, "Failed to open lock file {}, errno {}",
+                    PathToUTF8String(path), errno);
+        return;
+    }
+    const int operation = mode == FileLockMode::Exclusive ? LOCK_EX : LOCK_SH;
+    int result;
+    do {
+        result = flock(file, operation);
+    } while (result != 0 && errno == EINTR);
+    if (result != 0) {
+        LOG_WARNING(Common_Filesystem, "Failed to lock {}, errno {}", PathToUTF8String(path),
+                    errno);
+        close(file);
+        return;
+    }
+    fd = file;
+#endif
+}
+
+FileLock::~FileLock() {
+    if (!IsLocked()) {
+        return;
+    }
+    // Closing the last descriptor of the lock file releases the lock
+#ifdef _WIN32
+    CloseHandle(handle);
+#else
+    close(fd);
+#endif
+}
+
+std::filesystem::path FileLock::LockPathFor(const std::filesystem::path& path) {
+    std::filesystem::path lock_path{path};
+    lock_path += ".lock";
+    return lock_path;
+}
+
+} // namespace Common::FS
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+
+namespace Common::FS {
+
+enum class FileLockMode {
+    Shared,    ///< Any number of processes may hold the lock to read
+    Exclusive, ///< A single process holds the lock to modify
+};
+
+/**
+ * Advisory lock shared between processes, held while the object lives.
+ * The lock is taken on a separate lock file that is never deleted, so the locked file may be
+ * replaced, truncated or removed while the lock is held. Several instances of the emulator can then
+ * share a cache directory without interleaving their writes. Locking blocks until the lock is
+ * acquired. When the lock file can't be opened, the lock is not held and IsLocked returns false,
+ * callers carry on unlocked like a single instance would.
+ */
+class FileLock final {
+public:
+    /**
+     * Acquires the lock of a path.
+     *
+     * @param path Path of the lock file, it is created when it does not exist
+     * @param mode Whether other processes may hold the lock at the same time
+     */
+    explicit FileLock(const std::filesystem::path& path, FileLockMode mode);
+
+    ~FileLock();
+
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+
+    /// Returns true when the lock is held
+    [[nodiscard]] bool IsLocked() const noexcept {
+#ifdef _WIN32
+        return handle != nullptr;
+#else
+        return fd != -1;
+#endif
+    }
+
+    /// Returns the lock file path used for a file, next to the file itself
+    [[nodiscard]] static std::filesystem::path LockPathFor(const std::filesystem::path& path);
+
+private:
+#ifdef _WIN32
+    void* handle{};
+#else
+    int fd{-1};
+#endif
+};
+
+} // namespace Common::FS
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "common/fs/mapped_file.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+
+namespace Common::FS {
+
+MappedFile::MappedFile() = default;
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+    // Share writes and deletion, the owner of the file keeps appending to it while it's mapped
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ,
+                                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                    nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return;
+    }
+    mapping_handle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping_handle) {
+        LOG_ERROR(Common_Filesystem, "Failed to map file {}, error {}", PathToUTF8String(path),
+                  GetLastError());
+        return;
+    }
+    const void* const view = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        LOG_ERROR(Common_Filesystem, "Failed to map view of file {}, error {}",
+                  PathToUTF8String(path), GetLastError());
+        CloseHandle(mapping_handle);
+        mapping_handle = nullptr;
+        return;
+    }
+    base = static_cast<const u8*>(view);
+    size = static_cast<size_t>(file_size.QuadPart);
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return;
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        close(fd);
+        return;
+    }
+    const size_t file_size = static_cast<size_t>(file_stat.st_size);
+    void* const view = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        LOG_ERROR(Common_Filesystem, "Failed to map file {}, errno {}", PathToUTF8String(path),
+                  errno);
+        return;
+    }
+    base = static_cast<const u8*>(view);
+    size = file_size;
+#endif
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : base{std::exchange(other.base, nullptr)}, size{std::exchange(other.size, 0)} {
+#ifdef _WIN32
+    mapping_handle = std::exchange(other.mapping_handle, nullptr);
+#endif
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        base = std::exchange(other.base, nullptr);
+        size = std::exchange(other.size, 0);
+#ifdef _WIN32
+        mapping_handle = std::exchange(other.mapping_handle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+void MappedFile::Advise(MappedFileAccess access, size_t offset, size_t length) const {
+    if (!base || offset >= size) {
+        return;
+    }
+    length = std::min(length, size - offset);
+#ifdef _WIN32
+    // Windows has no access pattern hints for views, only prefetching
+    if (access == MappedFileAccess::Sequential || access == MappedFileAccess::WillNeed) {
+        WIN32_MEMORY_RANGE_ENTRY range{const_cast<u8*>(base + offset), length};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#else
+    int advice{};
+    switch (access) {
+    case MappedFileAccess::Normal:
+        advice = MADV_NORMAL;
+        break;
+    case MappedFileAccess::Random:
+        advice = MADV_RANDOM;
+        break;
+    case MappedFileAccess::Sequential:
+        advice = MADV_SEQUENTIAL;
+        break;
+    case MappedFileAccess::WillNeed:
+        advice = MADV_WILLNEED;
+        break;
+    }
+    static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t begin = offset & ~(page_size - 1);
+    void* const address = const_cast<u8*>(base + begin);
+    if (madvise(address, offset + length - begin, advice) != 0) {
+        LOG_DEBUG(Common_Filesystem, "madvise failed, errno {}", errno);
+    }
+#endif
+}
+
+void MappedFile::Close() {
+    if (!base) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(base);
+    CloseHandle(mapping_handle);
+    mapping_handle = nullptr;
+#else
+    munmap(const_cast<u8*>(base), size);
+#endif
+    base = nullptr;
+    size = 0;
+}
+
+} // namespace Common::FS
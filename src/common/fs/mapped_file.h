@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+
+#include "common/common_types.h"
+
+namespace Common::FS {
+
+/// Expected access pattern of a range of a mapped file
+enum class MappedFileAccess {
+    Normal,     ///< Default read ahead
+    Random,     ///< Scattered small reads, disables read ahead
+    Sequential, ///< Linear reads, read ahead aggressively
+    WillNeed,   ///< The range is about to be read, start reading it in the background
+};
+
+/**
+ * Read only view of a whole file mapped in the address space of the process.
+ * Pages are only read from disk when they are first accessed, so parsing a small part of a large
+ * file does not pay for the rest of it. The file may still be written through other handles
+ * while it is mapped.
+ */
+class MappedFile final {
+public:
+    MappedFile();
+
+    /**
+     * Maps a file for reading.
+     * On failure or when the file is empty, the view is left empty.
+     *
+     * @param path Filesystem path
+     */
+    explicit MappedFile(const std::filesystem::path& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /// Unmaps the file, the view is empty afterwards
+    void Close();
+
+    /// Returns true when the file is mapped
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return base != nullptr;
+    }
+
+    /**
+     * Hints the kernel about how a range of the file will be accessed.
+     * The range is widened to whole pages. Hints are ignored where they are not supported.
+     *
+     * @param access Expected access pattern
+     * @param offset Offset of the range in the file
+     * @param length Length of the range in bytes
+     */
+    void Advise(MappedFileAccess access, size_t offset, size_t length) const;
+
+    /// Returns the contents of the file at the time it was mapped
+    [[nodiscard]] std::span<const u8> Data() const noexcept {
+        return {base, size};
+    }
+
+private:
+    const u8* base{};
+    size_t size{};
+#ifdef _WIN32
+    void* mapping_handle{};
+#endif
+};
+
+} // namespace Common::FS
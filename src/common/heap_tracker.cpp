@@ -30,7 +30,15 @@ s64 GetMaxPermissibleResidentMapCount() {
 
 HeapTracker::HeapTracker(Common::HostMemory& buffer)
     : m_buffer(buffer), m_max_resident_map_count(GetMaxPermissibleResidentMapCount()) {}
-HeapTracker::~HeapTracker() = default;
+
+HeapTracker::~HeapTracker() {
+    LOG_INFO(HW_Memory,
+             "Separate heap: {} faults, {} evictions in {} rebuilds, {} merged mappings",
+             m_fault_count.load(std::memory_order_relaxed),
+             m_eviction_count.load(std::memory_order_relaxed),
+             m_rebuild_count.load(std::memory_order_relaxed),
+             m_merge_count.load(std::memory_order_relaxed));
+}
 
 void HeapTracker::Map(size_t virtual_offset, size_t host_offset, size_t length,
                       MemoryPermission perm, bool is_separate_heap) {
@@ -44,6 +52,13 @@ void HeapTracker::Map(size_t virtual_offset, size_t host_offset, size_t length,
         // We are mapping part of a separate heap.
         std::scoped_lock lk{m_lock};
 
+        // Heaps are usually mapped in pieces that continue each other. Joining them keeps the
+        // tracked count close to the host one, which joins them as well, so evictions and the
+        // faults after them become rarer.
+        if (this->TryMergeWithResidentLocked(virtual_offset, host_offset, length, perm)) {
+            return;
+        }
+
         auto* const map = new SeparateHeapMap{
             .vaddr = virtual_offset,
             .paddr = host_offset,
@@ -158,13 +173,69 @@ void HeapTracker::Protect(size_t virtual_offset, size_t size, MemoryPermission p
 }
 
 bool HeapTracker::DeferredMapSeparateHeap(u8* fault_address) {
-    if (m_buffer.IsInVirtualRange(fault_address)) {
-        return this->DeferredMapSeparateHeap(fault_address - m_buffer.VirtualBasePointer());
+    if (m_buffer.IsInVirtualRange(fault_address) &&
+        this->DeferredMapSeparateHeap(fault_address - m_buffer.VirtualBasePointer())) {
+        m_fault_count.fetch_add(1, std::memory_order_relaxed);
+        return true;
     }
 
     return false;
 }
 
+bool HeapTracker::TryMergeWithResidentLocked(VAddr virtual_offset, PAddr host_offset,
+                                             size_t length, MemoryPermission perm) {
+    const auto is_compatible = [&](const SeparateHeapMap& map) {
+        return map.is_resident && map.perm == perm &&
+               map.vaddr - virtual_offset == map.paddr - host_offset;
+    };
+
+    SeparateHeapMap* left{};
+    if (virtual_offset > 0) {
+        const auto it = this->GetNearestHeapMapLocked(virtual_offset - 1);
+        if (it != m_mappings.end() && it->vaddr + it->size == virtual_offset &&
+            is_compatible(*it)) {
+            left = std::addressof(*it);
+        }
+    }
+    SeparateHeapMap* right{};
+    {
+        const auto it = this->GetNearestHeapMapLocked(virtual_offset + length);
+        if (it != m_mappings.end() && it->vaddr == virtual_offset + length &&
+            is_compatible(*it)) {
+            right = std::addressof(*it);
+        }
+    }
+    if (!left && !right) {
+        return false;
+    }
+
+    // The joined mapping is resident, so the new range is mapped right away
+    m_buffer.Map(virtual_offset, host_offset, length, perm, false);
+    m_merge_count.fetch_add(1, std::memory_order_relaxed);
+
+    SeparateHeapMap* const merged = left ? left : right;
+    m_resident_mappings.erase(m_resident_mappings.iterator_to(*merged));
+    if (left && right) {
+        // The new range fills the gap between both neighbours, they become one mapping
+        ASSERT(--m_resident_map_count >= 0);
+        ASSERT(--m_map_count >= 0);
+        m_resident_mappings.erase(m_resident_mappings.iterator_to(*right));
+        m_mappings.erase(m_mappings.iterator_to(*right));
+        left->size += length + right->size;
+        delete right;
+    } else if (left) {
+        left->size += length;
+    } else {
+        // The address tree is ordered by start address, moving the start down keeps its place
+        right->vaddr = virtual_offset;
+        right->paddr = host_offset;
+        right->size += length;
+    }
+    merged->tick = m_tick++;
+    m_resident_mappings.insert(*merged);
+    return true;
+}
+
 bool HeapTracker::DeferredMapSeparateHeap(size_t virtual_offset) {
     bool rebuild_required = false;
 
@@ -216,7 +287,8 @@ void HeapTracker::RebuildSeparateHeapAddressSpace() {
     const size_t evict_count = m_resident_map_count - desired_count;
     auto it = m_resident_mappings.begin();
 
-    for (size_t i = 0; i < evict_count && it != m_resident_mappings.end(); i++) {
+    size_t evicted = 0;
+    for (; evicted < evict_count && it != m_resident_mappings.end(); evicted++) {
         // Unmark and unmap.
         it->is_resident = false;
         m_buffer.Unmap(it->vaddr, it->size, false);
@@ -225,6 +297,18 @@ void HeapTracker::RebuildSeparateHeapAddressSpace() {
         ASSERT(--m_resident_map_count >= 0);
         it = m_resident_mappings.erase(it);
     }
+
+    m_eviction_count.fetch_add(evicted, std::memory_order_relaxed);
+    m_rebuild_count.fetch_add(1, std::memory_order_relaxed);
+
+    // Frequent rebuilds with many faults in between mean the working set does not fit the limit
+    const auto now = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(now - m_last_rebuild_time).count();
+    const u64 faults = m_fault_count.load(std::memory_order_relaxed);
+    LOG_DEBUG(HW_Memory, "Evicted {} separate heap mappings, {:.1f} faults/s since last rebuild",
+              evicted, seconds > 0.0 ? (faults - m_faults_at_last_rebuild) / seconds : 0.0);
+    m_faults_at_last_rebuild = faults;
+    m_last_rebuild_time = now;
 }
 
 void HeapTracker::SplitHeapMap(VAddr offset, size_t size) {
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <set>
 #include <shared_mutex>
@@ -82,6 +83,9 @@ private:
 
     AddrTree::iterator GetNearestHeapMapLocked(VAddr offset);
 
+    bool TryMergeWithResidentLocked(VAddr virtual_offset, PAddr host_offset, size_t length,
+                                    MemoryPermission perm);
+
     void RebuildSeparateHeapAddressSpace();
 
 private:
@@ -93,6 +97,13 @@ private:
     s64 m_map_count{};
     s64 m_resident_map_count{};
     size_t m_tick{};
+
+    std::atomic<u64> m_fault_count{};    ///< Separate heap mappings made resident by a fault
+    std::atomic<u64> m_eviction_count{}; ///< Resident mappings unmapped to stay under the limit
+    std::atomic<u64> m_rebuild_count{};  ///< Times the resident mappings were trimmed
+    std::atomic<u64> m_merge_count{};    ///< Mappings joined into a resident neighbour
+    u64 m_faults_at_last_rebuild{};
+    std::chrono::steady_clock::time_point m_last_rebuild_time{std::chrono::steady_clock::now()};
 };
 
 } // namespace Common
@@ -25,6 +25,19 @@
 #define MAP_NORESERVE 0
 #endif
 
+#if defined(__linux__)
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+// Manually defined, linux/memfd.h conflicts with the libc definitions
+#if defined(MFD_HUGETLB) && !defined(MFD_HUGE_2MB)
+#define MFD_HUGE_2MB (21U << 26)
+#endif
+#endif
+
 #endif // ^^^ Linux ^^^
 
 #include <mutex>
@@ -79,6 +92,30 @@ using PFN_MapViewOfFile3 = _Ret_maybenull_ PVOID(WINAPI*)(
 using PFN_UnmapViewOfFile2 = BOOL(WINAPI*)(_In_ HANDLE Process, _In_ PVOID BaseAddress,
                                            _In_ ULONG UnmapFlags);
 
+#ifndef MEM_LARGE_PAGES
+#define MEM_LARGE_PAGES 0x20000000
+#endif
+
+/// Enables the privilege required to allocate large pages, granted by the "Lock pages in memory"
+/// user right
+static bool EnableLockMemoryPrivilege() {
+    HANDLE token{};
+    if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token)) {
+        return false;
+    }
+    TOKEN_PRIVILEGES privileges{};
+    privileges.PrivilegeCount = 1;
+    privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+    bool enabled = false;
+    if (LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid)) {
+        // Succeeds without assigning privileges the user doesn't hold, check the error instead
+        enabled = AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) &&
+                  GetLastError() == ERROR_SUCCESS;
+    }
+    CloseHandle(token);
+    return enabled;
+}
+
 template <typename T>
 static void GetFuncAddress(Common::DynamicLibrary& dll, const char* name, T& pfn) {
     if (!dll.GetSymbol(name, &pfn)) {
@@ -89,7 +126,7 @@ static void GetFuncAddress(Common::DynamicLibrary& dll, const char* name, T& pfn
 
 class HostMemory::Impl {
 public:
-    explicit Impl(size_t backing_size_, size_t virtual_size_)
+    explicit Impl(size_t backing_size_, size_t virtual_size_, HugePages huge_pages)
         : backing_size{backing_size_}, virtual_size{virtual_size_}, process{GetCurrentProcess()},
           kernelbase_dll("Kernelbase") {
         if (!kernelbase_dll.IsOpen()) {
@@ -101,6 +138,21 @@ public:
         GetFuncAddress(kernelbase_dll, "MapViewOfFile3", pfn_MapViewOfFile3);
         GetFuncAddress(kernelbase_dll, "UnmapViewOfFile2", pfn_UnmapViewOfFile2);
 
+        if (huge_pages == HugePages::Explicit) {
+            has_explicit_huge_pages = MapLargePageBacking();
+        }
+        if (has_explicit_huge_pages) {
+            LOG_INFO(HW_Memory,
+                     "Backing {} MiB of memory with large pages, fastmem is unavailable",
+                     backing_size >> 20);
+            // Large page views can't be placed in placeholders, skip the virtual range
+            return;
+        }
+        if (huge_pages != HugePages::Disabled) {
+            LOG_INFO(HW_Memory, "Memory is backed by regular pages, large pages on Windows must "
+                                "be reserved explicitly");
+        }
+
         // Allocate backing file map
         backing_handle =
             pfn_CreateFileMapping2(INVALID_HANDLE_VALUE, nullptr, FILE_MAP_WRITE | FILE_MAP_READ,
@@ -199,13 +251,54 @@ public:
         UNREACHABLE();
     }
 
+    void LogHugePageUsage() const {
+        if (has_explicit_huge_pages) {
+            LOG_INFO(HW_Memory, "Backing memory: {} MiB in large pages", backing_size >> 20);
+        }
+    }
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
     u8* backing_base{};
     u8* virtual_base{};
+    bool has_explicit_huge_pages{};
 
 private:
+    /// Backs the memory with a large page section, committed and locked as a whole
+    /// @returns True on success, false when large pages are unavailable
+    bool MapLargePageBacking() {
+        const size_t large_page_size = GetLargePageMinimum();
+        if (large_page_size == 0 || backing_size % large_page_size != 0) {
+            return false;
+        }
+        if (!EnableLockMemoryPrivilege()) {
+            LOG_WARNING(HW_Memory, "Large pages require the \"Lock pages in memory\" user right, "
+                                   "falling back to regular pages");
+            return false;
+        }
+        backing_handle = pfn_CreateFileMapping2(
+            INVALID_HANDLE_VALUE, nullptr, FILE_MAP_WRITE | FILE_MAP_READ, PAGE_READWRITE,
+            SEC_COMMIT | SEC_LARGE_PAGES, backing_size, nullptr, nullptr, 0);
+        if (backing_handle) {
+            backing_base = static_cast<u8*>(pfn_MapViewOfFile3(backing_handle, process, nullptr, 0,
+                                                               backing_size, MEM_LARGE_PAGES,
+                                                               PAGE_READWRITE, nullptr, 0));
+            if (backing_base) {
+                return true;
+            }
+        }
+        LOG_WARNING(HW_Memory,
+                    "Failed to allocate {} MiB of large pages (error {}), falling back to regular "
+                    "pages",
+                    backing_size >> 20, GetLastError());
+        if (backing_handle) {
+            CloseHandle(backing_handle);
+            backing_handle = nullptr;
+        }
+        return false;
+    }
+
     /// Release all resources in the object
     void Release() {
         if (!placeholders.empty()) {
@@ -222,7 +315,11 @@ private:
                 LOG_CRITICAL(HW_Memory, "Failed to free virtual memory");
             }
         }
-        if (backing_base) {
+        if (backing_base && has_explicit_huge_pages) {
+            if (!pfn_UnmapViewOfFile2(process, backing_base, 0)) {
+                LOG_CRITICAL(HW_Memory, "Failed to unmap backing memory");
+            }
+        } else if (backing_base) {
             if (!pfn_UnmapViewOfFile2(process, backing_base, MEM_PRESERVE_PLACEHOLDER)) {
                 LOG_CRITICAL(HW_Memory, "Failed to unmap backing memory placeholder");
             }
@@ -425,9 +522,73 @@ static void* ChooseVirtualBase(size_t virtual_size) {
 
 #endif
 
+#if defined(__linux__)
+/// Returns the selected value of a kernel option, like "advise" for "always [advise] never"
+static std::string ReadSelectedOption(const char* path) {
+    std::ifstream file{path};
+    std::string line;
+    std::getline(file, line);
+    const size_t begin = line.find('[');
+    const size_t end = line.find(']', begin);
+    if (begin == std::string::npos || end == std::string::npos) {
+        return line;
+    }
+    return line.substr(begin + 1, end - begin - 1);
+}
+
+struct HugePageUsage {
+    size_t resident{}; ///< Resident bytes, including huge pages
+    size_t huge{};     ///< Resident bytes mapped with huge pages
+};
+
+/// Sums the memory usage of the mappings overlapping a range of the address space
+static HugePageUsage QueryHugePageUsage(const u8* base, size_t size) {
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(base);
+    const uintptr_t end = begin + size;
+    HugePageUsage usage;
+    std::ifstream smaps{"/proc/self/smaps"};
+    std::string line;
+    bool in_range = false;
+    while (std::getline(smaps, line)) {
+        uintptr_t mapping_begin{};
+        uintptr_t mapping_end{};
+        if (std::sscanf(line.c_str(), "%" SCNxPTR "-%" SCNxPTR, &mapping_begin, &mapping_end) ==
+            2) {
+            in_range = mapping_begin < end && mapping_end > begin;
+            continue;
+        }
+        const size_t colon = line.find(':');
+        if (!in_range || colon == std::string::npos) {
+            continue;
+        }
+        const std::string_view key{line.data(), colon};
+        const size_t bytes = std::strtoull(line.c_str() + colon + 1, nullptr, 10) * 1024;
+        if (key == "Rss") {
+            usage.resident += bytes;
+        } else if (key == "AnonHugePages" || key == "ShmemPmdMapped" || key == "FilePmdMapped") {
+            usage.huge += bytes;
+        } else if (key == "Shared_Hugetlb" || key == "Private_Hugetlb") {
+            // Not included in the resident size
+            usage.resident += bytes;
+            usage.huge += bytes;
+        }
+    }
+    return usage;
+}
+
+static void LogRangeHugePageUsage(const char* name, const u8* base, size_t size) {
+    const HugePageUsage usage = QueryHugePageUsage(base, size);
+    const double percent = usage.resident == 0 ? 0.0
+                                               : static_cast<double>(usage.huge) * 100.0 /
+                                                     static_cast<double>(usage.resident);
+    LOG_INFO(HW_Memory, "{}: {} MiB resident, {} MiB ({:.1f}%) in huge pages", name,
+             usage.resident >> 20, usage.huge >> 20, percent);
+}
+#endif
+
 class HostMemory::Impl {
 public:
-    explicit Impl(size_t backing_size_, size_t virtual_size_)
+    explicit Impl(size_t backing_size_, size_t virtual_size_, HugePages huge_pages)
         : backing_size{backing_size_}, virtual_size{virtual_size_} {
         bool good = false;
         SCOPE_EXIT {
@@ -443,6 +604,22 @@ public:
         }
 
         // Backing memory initialization
+        if (huge_pages == HugePages::Explicit) {
+            has_explicit_huge_pages = MapHugeTlbBacking();
+        }
+        if (has_explicit_huge_pages) {
+            LOG_INFO(HW_Memory,
+                     "Backing {} MiB of memory with reserved huge pages, fastmem is unavailable",
+                     backing_size >> 20);
+            // Reserved huge pages can't be aliased at page granularity, skip the virtual range
+            virtual_base = nullptr;
+            good = true;
+            return;
+        }
+        if (huge_pages != HugePages::Disabled) {
+            LogTransparentHugePageSupport();
+        }
+
 #if defined(__FreeBSD__) && __FreeBSD__ < 13
         // XXX Drop after FreeBSD 12.* reaches EOL on 2024-06-30
         fd = shm_open(SHM_ANON, O_RDWR, 0600);
@@ -468,6 +645,11 @@ public:
             LOG_CRITICAL(HW_Memory, "mmap failed: {}", strerror(errno));
             throw std::bad_alloc{};
         }
+#if defined(__linux__)
+        // Pointers into the backing memory are used whenever fastmem isn't, like by the page
+        // table. Only honored when shmem huge pages are enabled on the host.
+        madvise(backing_base, backing_size, MADV_HUGEPAGE);
+#endif
 
         // Virtual memory initialization
         virtual_base = virtual_map_base = static_cast<u8*>(ChooseVirtualBase(virtual_size));
@@ -511,6 +693,14 @@ public:
         void* ret = mmap(virtual_base + virtual_offset, length, flags, MAP_SHARED | MAP_FIXED, fd,
                          host_offset);
         ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+
+#if defined(__linux__)
+        // The new mapping replaces the placeholder along with its huge page hint. Huge pages can
+        // only back it when the virtual and backing offsets are equally aligned.
+        if (length >= HugePageSize && (virtual_offset - host_offset) % HugePageSize == 0) {
+            madvise(ret, length, MADV_HUGEPAGE);
+        }
+#endif
     }
 
     void Unmap(size_t virtual_offset, size_t length) {
@@ -551,6 +741,11 @@ public:
 
     bool ClearBackingRegion(size_t physical_offset, size_t length) {
 #ifdef __linux__
+        if (has_explicit_huge_pages &&
+            (physical_offset % HugePageSize != 0 || length % HugePageSize != 0)) {
+            // Only whole huge pages can be removed from the backing file
+            return false;
+        }
         // Set MADV_REMOVE on backing map to destroy it instantly.
         // This also deletes the area from the backing file.
         int ret = madvise(backing_base + physical_offset, length, MADV_REMOVE);
@@ -566,14 +761,71 @@ public:
         virtual_base = nullptr;
     }
 
+    void LogHugePageUsage() const {
+#if defined(__linux__)
+        LogRangeHugePageUsage("Backing memory", backing_base, backing_size);
+        if (virtual_map_base != MAP_FAILED) {
+            LogRangeHugePageUsage("Fastmem arena", virtual_map_base, virtual_size);
+        }
+#endif
+    }
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
     u8* backing_base{reinterpret_cast<u8*>(MAP_FAILED)};
     u8* virtual_base{reinterpret_cast<u8*>(MAP_FAILED)};
     u8* virtual_map_base{reinterpret_cast<u8*>(MAP_FAILED)};
+    bool has_explicit_huge_pages{};
 
 private:
+    /// Backs the memory with pages from the host's huge page pool
+    /// @returns True on success, false when the pool can't hold the memory
+    bool MapHugeTlbBacking() {
+#if defined(__linux__) && defined(MFD_HUGETLB)
+        if (backing_size % HugePageSize != 0) {
+            return false;
+        }
+        fd = memfd_create("HostMemory", MFD_HUGETLB | MFD_HUGE_2MB);
+        if (fd < 0) {
+            LOG_WARNING(HW_Memory, "Huge page memfd_create failed: {}", strerror(errno));
+            return false;
+        }
+        // Huge pages are reserved when mapped, this fails when the pool is too small
+        if (ftruncate(fd, backing_size) == 0) {
+            backing_base = static_cast<u8*>(
+                mmap(nullptr, backing_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+            if (backing_base != MAP_FAILED) {
+                return true;
+            }
+        }
+        LOG_WARNING(HW_Memory,
+                    "Failed to reserve {} MiB of huge pages ({}), check vm.nr_hugepages. "
+                    "Falling back to transparent huge pages",
+                    backing_size >> 20, strerror(errno));
+        close(fd);
+        fd = -1;
+#endif
+        return false;
+    }
+
+    /// Logs whether madvise huge page hints on the backing memory are honored
+    static void LogTransparentHugePageSupport() {
+#if defined(__linux__)
+        const std::string mode =
+            ReadSelectedOption("/sys/kernel/mm/transparent_hugepage/shmem_enabled");
+        if (mode.empty() || mode == "never" || mode == "deny") {
+            LOG_WARNING(HW_Memory,
+                        "Transparent huge pages are disabled for shared memory (shmem_enabled: "
+                        "{}), memory is backed by regular pages",
+                        mode.empty() ? "unsupported" : mode);
+        } else {
+            LOG_INFO(HW_Memory, "Backing memory with transparent huge pages (shmem_enabled: {})",
+                     mode);
+        }
+#endif
+    }
+
     /// Release all resources in the object
     void Release() {
         if (virtual_map_base != MAP_FAILED) {
@@ -621,7 +873,7 @@ private:
 
 class HostMemory::Impl {
 public:
-    explicit Impl(size_t /*backing_size */, size_t /* virtual_size */) {
+    explicit Impl(size_t /*backing_size */, size_t /* virtual_size */, HugePages /* huge_pages */) {
         // This is just a place holder.
         // Please implement fastmem in a proper way on your platform.
         throw std::bad_alloc{};
@@ -639,20 +891,24 @@ public:
 
     void EnableDirectMappedAddress() {}
 
+    void LogHugePageUsage() const {}
+
     u8* backing_base{nullptr};
     u8* virtual_base{nullptr};
+    bool has_explicit_huge_pages{};
 };
 
 #endif // ^^^ Generic ^^^
 
-HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
+HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_, HugePages huge_pages)
     : backing_size(backing_size_), virtual_size(virtual_size_) {
     try {
         // Try to allocate a fastmem arena.
         // The implementation will fail with std::bad_alloc on errors.
         impl =
             std::make_unique<HostMemory::Impl>(AlignUp(backing_size, PageAlignment),
-                                               AlignUp(virtual_size, PageAlignment) + HugePageSize);
+                                               AlignUp(virtual_size, PageAlignment) + HugePageSize,
+                                               huge_pages);
         backing_base = impl->backing_base;
         virtual_base = impl->virtual_base;
 
@@ -720,6 +976,16 @@ void HostMemory::ClearBackingRegion(size_t physical_offset, size_t length, u32 f
     }
 }
 
+bool HostMemory::HasExplicitHugePages() const noexcept {
+    return impl && impl->has_explicit_huge_pages;
+}
+
+void HostMemory::LogHugePageUsage() const {
+    if (impl) {
+        impl->LogHugePageUsage();
+    }
+}
+
 void HostMemory::EnableDirectMappedAddress() {
     if (impl) {
         impl->EnableDirectMappedAddress();
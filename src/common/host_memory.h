@@ -18,13 +18,24 @@ enum class MemoryPermission : u32 {
 };
 DECLARE_ENUM_FLAG_OPERATORS(MemoryPermission)
 
+enum class HugePages : u32 {
+    /// Regular pages, hinted as huge page candidates where the host supports it
+    Disabled,
+    /// Same as disabled, reporting whether the host backs the memory with huge pages
+    Transparent,
+    /// Pages reserved by the host, falling back to transparent huge pages when none are available.
+    /// These can't be mapped at 4 KiB granularity, so no virtual range is allocated.
+    Explicit,
+};
+
 /**
  * A low level linear memory buffer, which supports multiple mappings
  * Its purpose is to rebuild a given sparse memory layout, including mirrors.
  */
 class HostMemory {
 public:
-    explicit HostMemory(size_t backing_size_, size_t virtual_size_);
+    explicit HostMemory(size_t backing_size_, size_t virtual_size_,
+                        HugePages huge_pages = HugePages::Disabled);
     ~HostMemory();
 
     /**
@@ -51,6 +62,12 @@ public:
 
     void ClearBackingRegion(size_t physical_offset, size_t length, u32 fill_value);
 
+    /// Returns true when the backing memory uses pages reserved by the host
+    [[nodiscard]] bool HasExplicitHugePages() const noexcept;
+
+    /// Logs how much of the resident memory is backed by huge pages
+    void LogHugePageUsage() const;
+
     [[nodiscard]] u8* BackingBasePointer() noexcept {
         return backing_base;
     }
@@ -58,6 +75,10 @@ public:
         return backing_base;
     }
 
+    [[nodiscard]] size_t BackingSize() const noexcept {
+        return backing_size;
+    }
+
     [[nodiscard]] u8* VirtualBasePointer() noexcept {
         return virtual_base;
     }
@@ -226,15 +226,25 @@ public:
         color_console_backend.SetEnabled(enabled);
     }
 
+    bool IsLogged(Class log_class, Level log_level) const {
+        return filter.CheckMessage(log_class, log_level);
+    }
+
     void PushEntry(Class log_class, Level log_level, const char* filename, unsigned int line_num,
                    const char* function, std::string&& message) {
-        if (!filter.CheckMessage(log_class, log_level)) {
-            return;
-        }
         message_queue.EmplaceWait(
             CreateEntry(log_class, log_level, filename, line_num, function, std::move(message)));
     }
 
+    void PushDeferredEntry(Class log_class, Level log_level, const char* filename,
+                           unsigned int line_num, const char* function, const char* format,
+                           const DeferredArgs& args) {
+        Entry entry = CreateEntry(log_class, log_level, filename, line_num, function, {});
+        entry.format = format;
+        entry.deferred_args = args;
+        message_queue.EmplaceWait(std::move(entry));
+    }
+
 private:
     Impl(const std::filesystem::path& file_backend_filename, const Filter& filter_)
         : filter{filter_}, file_backend{file_backend_filename} {}
@@ -246,6 +256,9 @@ private:
             Common::SetCurrentThreadName("Logger");
             Entry entry;
             const auto write_logs = [this, &entry]() {
+                if (entry.format != nullptr) {
+                    entry.message = FormatDeferredMessage(entry);
+                }
                 ForEachBackend([&entry](Backend& backend) { backend.Write(entry); });
             };
             while (!stop_token.stop_requested()) {
@@ -289,6 +302,15 @@ private:
         };
     }
 
+    static std::string FormatDeferredMessage(const Entry& entry) {
+        try {
+            return entry.deferred_args.formatter(entry.format, entry.deferred_args.data.data());
+        } catch (const fmt::format_error& error) {
+            // Don't take the logging thread down with a bad format string
+            return fmt::format("{} (format error: {})", entry.format, error.what());
+        }
+    }
+
     void ForEachBackend(auto lambda) {
         lambda(static_cast<Backend&>(debugger_backend));
         lambda(static_cast<Backend&>(color_console_backend));
@@ -345,9 +367,27 @@ void SetColorConsoleBackendEnabled(bool enabled) {
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
                        unsigned int line_num, const char* function, const char* format,
                        const fmt::format_args& args) {
-    if (!initialization_in_progress_suppress_logging) {
-        Impl::Instance().PushEntry(log_class, log_level, filename, line_num, function,
-                                   fmt::vformat(format, args));
+    if (initialization_in_progress_suppress_logging) {
+        return;
+    }
+    // Filtered messages are dropped before spending any time formatting them
+    auto& instance = Impl::Instance();
+    if (instance.IsLogged(log_class, log_level)) {
+        instance.PushEntry(log_class, log_level, filename, line_num, function,
+                           fmt::vformat(format, args));
+    }
+}
+
+void DeferredLogMessageImpl(Class log_class, Level log_level, const char* filename,
+                            unsigned int line_num, const char* function, const char* format,
+                            const DeferredArgs& args) {
+    if (initialization_in_progress_suppress_logging) {
+        return;
+    }
+    auto& instance = Impl::Instance();
+    if (instance.IsLogged(log_class, log_level)) {
+        instance.PushDeferredEntry(log_class, log_level, filename, line_num, function, format,
+                                   args);
     }
 }
 } // namespace Common::Log
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include <fmt/format.h>
+
+#include "common/logging/formatter.h"
+
+namespace Common::Log {
+
+/**
+ * Raw copies of the arguments of a log message, formatted on the logging thread instead of the
+ * thread that logged it. The formatter is instantiated for the argument types of the call, so it
+ * knows how to read them back from the data.
+ */
+struct DeferredArgs {
+    static constexpr std::size_t Capacity = 128;
+
+    using Formatter = std::string (*)(const char* format, const unsigned char* data);
+
+    Formatter formatter;
+    std::array<unsigned char, Capacity> data;
+};
+
+namespace Detail {
+
+/// Strings are copied into the data, prefixed by their size
+template <typename T>
+concept DeferrableString = std::same_as<T, std::string> || std::same_as<T, std::string_view> ||
+                           (std::is_array_v<T> && std::same_as<std::remove_extent_t<T>, char>);
+
+/// Arguments that format the same from a copy later on. Anything else, like pointers or types
+/// that refer to other objects, is formatted right away.
+template <typename T>
+concept Deferrable = std::is_arithmetic_v<T> || std::is_enum_v<T> || DeferrableString<T>;
+
+template <typename T>
+using DeferredType = std::conditional_t<DeferrableString<T>, std::string_view, T>;
+
+template <typename T>
+std::size_t DeferredSize(const T& value) {
+    if constexpr (DeferrableString<T>) {
+        return sizeof(std::size_t) + std::string_view{value}.size();
+    } else {
+        return sizeof(T);
+    }
+}
+
+template <typename T>
+unsigned char* DeferredWrite(unsigned char* out, const T& value) {
+    if constexpr (DeferrableString<T>) {
+        const std::string_view string{value};
+        const std::size_t size = string.size();
+        std::memcpy(out, &size, sizeof(size));
+        std::memcpy(out + sizeof(size), string.data(), size);
+        return out + sizeof(size) + size;
+    } else {
+        std::memcpy(out, &value, sizeof(T));
+        return out + sizeof(T);
+    }
+}
+
+template <typename T>
+DeferredType<T> DeferredRead(const unsigned char*& in) {
+    if constexpr (DeferrableString<T>) {
+        std::size_t size;
+        std::memcpy(&size, in, sizeof(size));
+        const std::string_view string{reinterpret_cast<const char*>(in + sizeof(size)), size};
+        in += sizeof(size) + size;
+        return string;
+    } else {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        in += sizeof(T);
+        return value;
+    }
+}
+
+template <typename... Args>
+std::string FormatDeferred(const char* format, [[maybe_unused]] const unsigned char* data) {
+    // Braced initialization reads the arguments in order
+    const std::tuple<DeferredType<Args>...> values{DeferredRead<Args>(data)...};
+    return std::apply(
+        [format](const auto&... args) {
+            return fmt::vformat(format, fmt::make_format_args(args...));
+        },
+        values);
+}
+
+/// Copies the arguments when every one of them can be deferred and they fit, returns false
+/// otherwise
+template <typename... Args>
+bool DeferArgs(DeferredArgs& deferred, const Args&... args) {
+    if constexpr ((Deferrable<Args> && ...)) {
+        if ((std::size_t{0} + ... + DeferredSize(args)) > DeferredArgs::Capacity) {
+            return false;
+        }
+        deferred.formatter = &FormatDeferred<Args...>;
+        [[maybe_unused]] unsigned char* out = deferred.data.data();
+        ((out = DeferredWrite(out, args)), ...);
+        return true;
+    } else {
+        return false;
+    }
+}
+
+} // namespace Detail
+
+} // namespace Common::Log
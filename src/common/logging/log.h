@@ -8,6 +8,7 @@
 
 #include <fmt/format.h>
 
+#include "common/logging/deferred_args.h"
 #include "common/logging/formatter.h"
 #include "common/logging/types.h"
 
@@ -27,9 +28,21 @@ void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
                        unsigned int line_num, const char* function, const char* format,
                        const fmt::format_args& args);
 
+/// Logs a message to the global logger, formatting its copied arguments on the logging thread
+void DeferredLogMessageImpl(Class log_class, Level log_level, const char* filename,
+                            unsigned int line_num, const char* function, const char* format,
+                            const DeferredArgs& args);
+
 template <typename... Args>
 void FmtLogMessage(Class log_class, Level log_level, const char* filename, unsigned int line_num,
                    const char* function, const char* format, const Args&... args) {
+    // Copying the arguments is cheaper than formatting them on the logging thread's behalf
+    DeferredArgs deferred;
+    if (Detail::DeferArgs(deferred, args...)) {
+        DeferredLogMessageImpl(log_class, log_level, filename, line_num, function, format,
+                               deferred);
+        return;
+    }
     FmtLogMessageImpl(log_class, log_level, filename, line_num, function, format,
                       fmt::make_format_args(args...));
 }
@@ -5,6 +5,7 @@
 
 #include <chrono>
 
+#include "common/logging/deferred_args.h"
 #include "common/logging/types.h"
 
 namespace Common::Log {
@@ -19,8 +20,12 @@ struct Entry {
     Level log_level{};
     const char* filename = nullptr;
     unsigned int line_num = 0;
-    std::string function;
+    const char* function = nullptr;
     std::string message;
+    /// Format string of a message whose arguments are formatted by the logging thread, null when
+    /// the message was formatted by the thread that logged it
+    const char* format = nullptr;
+    DeferredArgs deferred_args;
 };
 
 } // namespace Common::Log
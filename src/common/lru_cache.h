@@ -5,6 +5,7 @@
 
 #include <deque>
 #include <memory>
+#include <optional>
 #include <type_traits>
 
 #include "common/common_types.h"
@@ -57,6 +58,14 @@ public:
         free_items.push_back(id);
     }
 
+    /// Returns the tick of the least recently used item, or nothing when the cache is empty
+    [[nodiscard]] std::optional<TickType> OldestTick() const noexcept {
+        if (!first_item) {
+            return std::nullopt;
+        }
+        return first_item->tick;
+    }
+
     template <typename Func>
     void ForEachItemBelow(TickType tick, Func&& func) {
         static constexpr bool RETURNS_BOOL =
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <limits>
 #include <lz4hc.h>
 
 #include "common/assert.h"
@@ -9,6 +10,13 @@
 
 namespace Common::Compression {
 
+namespace {
+/// LZ4 takes int sizes, larger outputs are never filled past what an int can address
+int ClampOutputSize(std::span<const u8> output) {
+    return static_cast<int>(std::min<std::size_t>(output.size(), std::numeric_limits<int>::max()));
+}
+} // Anonymous namespace
+
 std::vector<u8> CompressDataLZ4(const u8* source, std::size_t source_size) {
     ASSERT_MSG(source_size <= LZ4_MAX_INPUT_SIZE, "Source size exceeds LZ4 maximum input size");
 
@@ -77,4 +85,48 @@ int DecompressDataLZ4(void* dst, size_t dst_size, const void* src, size_t src_si
                                static_cast<int>(src_size), static_cast<int>(dst_size));
 }
 
+std::size_t GetCompressBoundLZ4(std::size_t source_size) {
+    ASSERT_MSG(source_size <= LZ4_MAX_INPUT_SIZE, "Source size exceeds LZ4 maximum input size");
+    return static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(source_size)));
+}
+
+std::optional<std::size_t> CompressDataLZ4(std::span<u8> output, std::span<const u8> source) {
+    ASSERT_MSG(source.size() <= LZ4_MAX_INPUT_SIZE, "Source size exceeds LZ4 maximum input size");
+
+    const int compressed_size = LZ4_compress_default(
+        reinterpret_cast<const char*>(source.data()), reinterpret_cast<char*>(output.data()),
+        static_cast<int>(source.size()), ClampOutputSize(output));
+    if (compressed_size <= 0) {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(compressed_size);
+}
+
+std::optional<std::size_t> CompressDataLZ4HC(std::span<u8> output, std::span<const u8> source,
+                                             s32 compression_level) {
+    ASSERT_MSG(source.size() <= LZ4_MAX_INPUT_SIZE, "Source size exceeds LZ4 maximum input size");
+
+    compression_level = std::clamp(compression_level, LZ4HC_CLEVEL_MIN, LZ4HC_CLEVEL_MAX);
+
+    const int compressed_size = LZ4_compress_HC(
+        reinterpret_cast<const char*>(source.data()), reinterpret_cast<char*>(output.data()),
+        static_cast<int>(source.size()), ClampOutputSize(output), compression_level);
+    if (compressed_size <= 0) {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(compressed_size);
+}
+
+std::optional<std::size_t> DecompressDataLZ4(std::span<u8> output,
+                                             std::span<const u8> compressed) {
+    const int size = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed.data()),
+                                         reinterpret_cast<char*>(output.data()),
+                                         static_cast<int>(compressed.size()),
+                                         ClampOutputSize(output));
+    if (size < 0) {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(size);
+}
+
 } // namespace Common::Compression
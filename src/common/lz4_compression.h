@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <optional>
 #include <span>
 #include <vector>
 
@@ -58,4 +59,43 @@ namespace Common::Compression {
 
 [[nodiscard]] int DecompressDataLZ4(void* dst, size_t dst_size, const void* src, size_t src_size);
 
+/// Returns the largest compressed size of a source of the given size
+[[nodiscard]] std::size_t GetCompressBoundLZ4(std::size_t source_size);
+
+/**
+ * Compresses a source memory region with LZ4 into a caller provided buffer.
+ *
+ * @param output Destination of the compressed data. GetCompressBoundLZ4 bytes always fit.
+ * @param source The uncompressed source memory region.
+ *
+ * @return the compressed size, or std::nullopt when compression failed or the output is too small.
+ */
+[[nodiscard]] std::optional<std::size_t> CompressDataLZ4(std::span<u8> output,
+                                                         std::span<const u8> source);
+
+/**
+ * Compresses a source memory region with LZ4HC into a caller provided buffer.
+ *
+ * @param output            Destination of the compressed data.
+ * @param source            The uncompressed source memory region.
+ * @param compression_level The used compression level. Should be between 3 and 12.
+ *
+ * @return the compressed size, or std::nullopt when compression failed or the output is too small.
+ */
+[[nodiscard]] std::optional<std::size_t> CompressDataLZ4HC(std::span<u8> output,
+                                                           std::span<const u8> source,
+                                                           s32 compression_level);
+
+/**
+ * Decompresses a LZ4 block into a caller provided buffer, without allocating.
+ *
+ * @param output     Destination of the uncompressed data.
+ * @param compressed The compressed source memory region.
+ *
+ * @return the decompressed size, or std::nullopt when the data is corrupted or the output is too
+ *         small.
+ */
+[[nodiscard]] std::optional<std::size_t> DecompressDataLZ4(std::span<u8> output,
+                                                           std::span<const u8> compressed);
+
 } // namespace Common::Compression
@@ -18,4 +18,10 @@ struct MemoryInfo {
  */
 [[nodiscard]] const MemoryInfo& GetMemInfo();
 
+/**
+ * Gets the largest amount of memory the process has had resident so far
+ * @return Peak resident memory in bytes, 0 when the host doesn't report it
+ */
+[[nodiscard]] u64 GetPeakResidentMemory();
+
 } // namespace Common
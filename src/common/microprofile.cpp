@@ -4,3 +4,23 @@
 // Includes the MicroProfile implementation in this file for compilation
 #define MICROPROFILE_IMPL 1
 #include "common/microprofile.h"
+
+#if MICROPROFILE_ENABLED
+MicroProfileThreadLog* MicroProfileCreateTimeline(const char* name) {
+    MicroProfileInit();
+    std::lock_guard lock{MicroProfileMutex()};
+    MicroProfileThreadLog* const timeline = MicroProfileCreateThreadLog(name);
+    // Not owned by the thread creating it
+    timeline->nThreadId = 0;
+    return timeline;
+}
+
+void MicroProfileTimelineScope(MicroProfileThreadLog* timeline, MicroProfileToken token,
+                               int64_t begin, int64_t end) {
+    if ((MicroProfileGetGroupMask(token) & g_MicroProfile.nActiveGroup) == 0) {
+        return;
+    }
+    MicroProfileLogPut(token, static_cast<uint64_t>(begin), MP_LOG_ENTER, timeline);
+    MicroProfileLogPut(token, static_cast<uint64_t>(end), MP_LOG_LEAVE, timeline);
+}
+#endif
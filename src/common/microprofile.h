@@ -22,3 +22,13 @@ typedef void* HANDLE;
 #include <microprofile.h>
 
 #define MP_RGB(r, g, b) ((r) << 16 | (g) << 8 | (b) << 0)
+
+#if MICROPROFILE_ENABLED
+/// Creates a log holding scopes that were timed elsewhere than on the CPU threads, like GPU work
+/// read back from timestamp queries. It is shown and traced like the log of a thread.
+MicroProfileThreadLog* MicroProfileCreateTimeline(const char* name);
+
+/// Records a scope on a timeline, begin and end are CPU ticks and must not go back in time
+void MicroProfileTimelineScope(MicroProfileThreadLog* timeline, MicroProfileToken token,
+                               int64_t begin, int64_t end);
+#endif
@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/common_types.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/microprofile.h"
+#include "common/microprofile_trace.h"
+
+namespace Common {
+
+#if MICROPROFILE_ENABLED
+namespace {
+/// Escapes the characters of a name that would end its JSON string
+std::string EscapeJson(std::string_view name) {
+    std::string escaped;
+    escaped.reserve(name.size());
+    for (const char c : name) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+/**
+ * Reads the MicroProfile thread logs from where the previous frame left them and converts their
+ * entries to trace events. MicroProfile keeps the entries of the last flipped frames in the logs,
+ * so reading them right after a flip doesn't race with them being overwritten.
+ */
+class MicroProfileTrace {
+public:
+    explicit MicroProfileTrace(const std::filesystem::path& path)
+        : file{path, FS::FileAccessMode::Write, FS::FileType::TextFile},
+          base_tick{static_cast<u64>(MP_TICK())},
+          us_per_tick{1'000'000.0 / static_cast<double>(MicroProfileTicksPerSecondCpu())} {
+        // Only what is recorded from now on is traced
+        const MicroProfile& profile = *MicroProfileGet();
+        for (u32 index = 0; index < MICROPROFILE_MAX_THREADS; ++index) {
+            if (MicroProfileThreadLog* const log = profile.Pool[index]) {
+                threads[index] = {
+                    .log = log,
+                    .thread_id = log->nThreadId,
+                    .read = log->nPut.load(std::memory_order_acquire),
+                };
+            }
+        }
+        buffer = R"([{"name":"process_name","ph":"M","pid":0,"args":{"name":"yuzu"}})";
+    }
+
+    [[nodiscard]] bool IsOpen() const {
+        return file.IsOpen();
+    }
+
+    /// Appends the entries recorded since the previous call, the MicroProfile mutex must be held
+    void Collect() {
+        const MicroProfile& profile = *MicroProfileGet();
+        auto out = std::back_inserter(buffer);
+        for (u32 index = 0; index < MICROPROFILE_MAX_THREADS; ++index) {
+            MicroProfileThreadLog* const log = profile.Pool[index];
+            if (log == nullptr) {
+                continue;
+            }
+            ThreadState& thread = threads[index];
+            if (thread.log != log || thread.thread_id != log->nThreadId) {
+                // A thread created after the trace started, or a log reused by another thread
+                thread = {.log = log, .thread_id = log->nThreadId};
+            }
+            if (!thread.named) {
+                fmt::format_to(out,
+                               ",\n"
+                               R"({{"name":"thread_name","ph":"M","pid":0,"tid":{},)"
+                               R"("args":{{"name":"{}"}}}})",
+                               index, EscapeJson(log->ThreadName));
+                thread.named = true;
+            }
+            const u32 put = log->nPut.load(std::memory_order_acquire);
+            for (u32 pos = thread.read; pos != put; pos = (pos + 1) % MICROPROFILE_BUFFER_SIZE) {
+                const MicroProfileLogEntry entry = log->Log[pos];
+                const u64 timer = MicroProfileLogTimerIndex(entry);
+                switch (MicroProfileLogType(entry)) {
+                case MP_LOG_ENTER:
+                    thread.last_ts = ToMicroseconds(entry);
+                    ++thread.depth;
+                    fmt::format_to(out, ",\n{{{},\"ph\":\"B\",\"pid\":0,\"tid\":{},\"ts\":{:.3f}}}",
+                                   TimerName(profile, timer), index, thread.last_ts);
+                    break;
+                case MP_LOG_LEAVE:
+                    thread.last_ts = ToMicroseconds(entry);
+                    if (thread.depth == 0) {
+                        // The scope was entered before the trace started
+                        break;
+                    }
+                    --thread.depth;
+                    fmt::format_to(out, ",\n{{\"ph\":\"E\",\"pid\":0,\"tid\":{},\"ts\":{:.3f}}}",
+                                   index, thread.last_ts);
+                    break;
+                case MP_LOG_META:
+                    // The tick of a counter entry holds its value, it belongs to the open scope
+                    if (const char* const name = profile.MetaCounters[timer].pName) {
+                        fmt::format_to(out,
+                                       ",\n"
+                                       R"({{"name":"{}","ph":"C","pid":0,"ts":{:.3f},)"
+                                       R"("args":{{"value":{}}}}})",
+                                       EscapeJson(name), thread.last_ts,
+                                       MicroProfileLogGetTick(entry));
+                    }
+                    break;
+                default:
+                    // GPU timestamps, GPU timers are disabled
+                    break;
+                }
+            }
+            thread.read = put;
+        }
+        static_cast<void>(file.WriteString(buffer));
+        buffer.clear();
+    }
+
+    /// Writes the end of the trace
+    void Close() {
+        buffer += "\n]\n";
+        static_cast<void>(file.WriteString(buffer));
+        buffer.clear();
+        file.Close();
+    }
+
+private:
+    struct ThreadState {
+        MicroProfileThreadLog* log{};
+        ThreadIdType thread_id{};
+        u32 read{};
+        /// Scopes entered since the trace started and not left yet
+        u32 depth{};
+        double last_ts{};
+        bool named{};
+    };
+
+    double ToMicroseconds(MicroProfileLogEntry entry) const {
+        const u64 ticks = (static_cast<u64>(MicroProfileLogGetTick(entry)) - base_tick) &
+                          MP_LOG_TICK_MASK;
+        return static_cast<double>(ticks) * us_per_tick;
+    }
+
+    /// Returns the name and category fields of a timer's events
+    const std::string& TimerName(const MicroProfile& profile, u64 timer) {
+        if (timer >= timer_names.size()) {
+            timer_names.resize(timer + 1);
+        }
+        std::string& name = timer_names[timer];
+        if (name.empty()) {
+            const MicroProfileGroupInfo& group = profile.GroupInfo[profile.TimerToGroup[timer]];
+            name = fmt::format(R"("name":"{}","cat":"{}")",
+                               EscapeJson(profile.TimerInfo[timer].pName),
+                               EscapeJson(group.pName));
+        }
+        return name;
+    }
+
+    FS::IOFile file;
+    u64 base_tick;
+    double us_per_tick;
+    std::string buffer;
+    std::array<ThreadState, MICROPROFILE_MAX_THREADS> threads{};
+    std::vector<std::string> timer_names;
+};
+
+/// Recording state of MicroProfile before the trace started, restored when it stops
+struct SavedState {
+    bool force_enable;
+    bool all_groups;
+    bool force_meta_counters;
+};
+
+std::mutex trace_mutex;
+std::unique_ptr<MicroProfileTrace> active_trace;
+SavedState saved_state{};
+} // Anonymous namespace
+
+bool StartMicroProfileTrace(const std::filesystem::path& path) {
+    std::scoped_lock lock{trace_mutex};
+    if (active_trace) {
+        return true;
+    }
+    if (!FS::CreateParentDir(path)) {
+        return false;
+    }
+    std::scoped_lock profile_lock{MicroProfileGetMutex()};
+    auto trace = std::make_unique<MicroProfileTrace>(path);
+    if (!trace->IsOpen()) {
+        return false;
+    }
+    // Record every group and counter, the profiler UI may not even exist
+    saved_state = {
+        .force_enable = MicroProfileGetForceEnable(),
+        .all_groups = MicroProfileGetEnableAllGroups(),
+        .force_meta_counters = MicroProfileGetForceMetaCounters(),
+    };
+    MicroProfileSetForceEnable(true);
+    MicroProfileSetEnableAllGroups(true);
+    MicroProfileSetForceMetaCounters(true);
+    active_trace = std::move(trace);
+    return true;
+}
+
+void StopMicroProfileTrace() {
+    std::scoped_lock lock{trace_mutex};
+    if (!active_trace) {
+        return;
+    }
+    std::scoped_lock profile_lock{MicroProfileGetMutex()};
+    active_trace->Collect();
+    active_trace->Close();
+    active_trace.reset();
+    MicroProfileSetForceEnable(saved_state.force_enable);
+    MicroProfileSetEnableAllGroups(saved_state.all_groups);
+    MicroProfileSetForceMetaCounters(saved_state.force_meta_counters);
+}
+
+void FlipMicroProfile() {
+    MicroProfileFlip();
+
+    std::scoped_lock lock{trace_mutex};
+    if (active_trace) {
+        std::scoped_lock profile_lock{MicroProfileGetMutex()};
+        active_trace->Collect();
+    }
+}
+
+#else
+
+bool StartMicroProfileTrace(const std::filesystem::path&) {
+    return false;
+}
+
+void StopMicroProfileTrace() {}
+
+void FlipMicroProfile() {}
+
+#endif
+
+} // namespace Common
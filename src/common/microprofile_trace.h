@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+
+namespace Common {
+
+/**
+ * Starts streaming every MicroProfile scope, thread name and counter to a file as Chrome trace
+ * event JSON, which Perfetto and chrome://tracing open. The scopes recorded during a frame are
+ * written when it is flipped, so nothing needs the profiler UI to be open. Ignored when already
+ * tracing.
+ *
+ * @returns True when tracing to the file
+ */
+bool StartMicroProfileTrace(const std::filesystem::path& path);
+
+/// Writes what is left of the trace and closes the file
+void StopMicroProfileTrace();
+
+/// Flips the MicroProfile frame, then writes the scopes recorded during it when tracing
+void FlipMicroProfile();
+
+} // namespace Common
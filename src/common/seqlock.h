@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+#include "common/common_types.h"
+#include "common/div_ceil.h"
+
+namespace Common {
+
+/**
+ * Publishes a trivially copyable value to readers that never take a lock. Readers retry when the
+ * value changed while they were copying it, so the writer is never blocked by them.
+ *
+ * Only one thread may write at a time, callers serialize writes with their own lock.
+ */
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+    SeqLock() {
+        Write(T{});
+    }
+
+    void Write(const T& value) {
+        std::array<u64, NumWords> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        // An odd sequence tells readers the value is being written
+        const u64 sequence_start = sequence.load(std::memory_order_relaxed);
+        sequence.store(sequence_start + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < NumWords; ++i) {
+            data[i].store(words[i], std::memory_order_relaxed);
+        }
+        sequence.store(sequence_start + 2, std::memory_order_release);
+    }
+
+    [[nodiscard]] T Read() const {
+        std::array<u64, NumWords> words;
+        u64 sequence_start;
+        do {
+            sequence_start = sequence.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < NumWords; ++i) {
+                words[i] = data[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((sequence_start & 1) != 0 ||
+                 sequence_start != sequence.load(std::memory_order_relaxed));
+
+        T value;
+        std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+        return value;
+    }
+
+private:
+    static constexpr std::size_t NumWords = DivCeil(sizeof(T), sizeof(u64));
+
+    std::atomic<u64> sequence{};
+    std::array<std::atomic<u64>, NumWords> data{};
+};
+
+} // namespace Common
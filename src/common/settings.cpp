@@ -150,13 +150,22 @@ bool IsGPULevelHigh() {
            values.current_gpu_accuracy == GpuAccuracy::High;
 }
 
+static bool is_fastmem_supported = true;
+
 bool IsFastmemEnabled() {
+    if (!is_fastmem_supported) {
+        return false;
+    }
     if (values.cpu_debug_mode) {
         return static_cast<bool>(values.cpuopt_fastmem);
     }
     return true;
 }
 
+void SetFastmemSupported(bool is_supported) {
+    is_fastmem_supported = is_supported;
+}
+
 static bool is_nce_enabled = false;
 
 void SetNceEnabled(bool is_39bit) {
@@ -187,8 +187,18 @@ struct Values {
                                        true};
     Setting<bool, false> audio_muted{
         linkage, false, "audio_muted", Category::Audio, Specialization::Default, true, true};
+    // Requests the smallest stable host buffer and renders as few buffers ahead as underruns allow
+    Setting<bool> audio_low_latency{linkage, false, "audio_low_latency", Category::Audio};
+    // Decodes the voices of the audio renderer on worker threads, ahead of mixing them
+    Setting<bool> parallel_voice_decoding{linkage, true, "parallel_voice_decoding",
+                                          Category::Audio};
+    // Keeps decoded ADPCM samples, so looping and replayed sounds are only decoded once
+    Setting<bool> adpcm_decode_cache{linkage, true, "adpcm_decode_cache", Category::Audio};
+    Setting<bool> measured_voice_drop{linkage, false, "measured_voice_drop", Category::Audio};
     Setting<bool, false> dump_audio_commands{
         linkage, false, "dump_audio_commands", Category::Audio, Specialization::Default, false};
+    Setting<bool, false> capture_audio_renderer{linkage, false, "capture_audio_renderer",
+                                                Category::Audio, Specialization::Default, false};
 
     // Core
     SwitchableSetting<bool> use_multi_core{linkage, true, "use_multi_core", Category::Core};
@@ -198,6 +208,7 @@ struct Values {
                                                              MemoryLayout::Memory_8Gb,
                                                              "memory_layout_mode",
                                                              Category::Core};
+    Setting<bool> use_huge_pages{linkage, false, "use_huge_pages", Category::Core};
     SwitchableSetting<bool> use_speed_limit{
         linkage, true, "use_speed_limit", Category::Core, Specialization::Paired, false, true};
     SwitchableSetting<u16, true> speed_limit{linkage,
@@ -250,6 +261,8 @@ struct Values {
                                               Category::CpuDebug};
     Setting<bool> cpuopt_ignore_memory_aborts{linkage, true, "cpuopt_ignore_memory_aborts",
                                               Category::CpuDebug};
+    Setting<u32, true> jit_code_cache_size{linkage, 0, 0, 1024, "jit_code_cache_size",
+                                           Category::CpuDebug};
 
     SwitchableSetting<bool> cpuopt_unsafe_unfuse_fma{linkage, true, "cpuopt_unsafe_unfuse_fma",
                                                      Category::CpuUnsafe};
@@ -276,6 +289,8 @@ struct Values {
 
     SwitchableSetting<bool> use_disk_shader_cache{linkage, true, "use_disk_shader_cache",
                                                   Category::Renderer};
+    SwitchableSetting<bool> use_disk_texture_cache{linkage, true, "use_disk_texture_cache",
+                                                   Category::Renderer};
     SwitchableSetting<bool> use_asynchronous_gpu_emulation{
         linkage, true, "use_asynchronous_gpu_emulation", Category::Renderer};
     SwitchableSetting<AstcDecodeMode, true> accelerate_astc{linkage,
@@ -322,6 +337,23 @@ struct Values {
     ResolutionScalingInfo resolution_info{};
     SwitchableSetting<ResolutionSetup> resolution_setup{linkage, ResolutionSetup::Res1X,
                                                         "resolution_setup", Category::Renderer};
+    SwitchableSetting<bool> use_dynamic_resolution{linkage,
+                                                   false,
+                                                   "use_dynamic_resolution",
+                                                   Category::Renderer,
+                                                   Specialization::Paired,
+                                                   true,
+                                                   false};
+    SwitchableSetting<u16, true> dynamic_resolution_target{linkage,
+                                                           60,
+                                                           20,
+                                                           240,
+                                                           "dynamic_resolution_target",
+                                                           Category::Renderer,
+                                                           Specialization::Countable,
+                                                           true,
+                                                           true,
+                                                           &use_dynamic_resolution};
     SwitchableSetting<ScalingFilter> scaling_filter{linkage,
                                                     ScalingFilter::Bilinear,
                                                     "scaling_filter",
@@ -397,6 +429,17 @@ struct Values {
                                                false,
 #endif
                                                "async_presentation", Category::RendererAdvanced};
+    SwitchableSetting<bool> use_async_present_queue{linkage, true, "use_async_present_queue",
+                                                    Category::RendererAdvanced};
+    SwitchableSetting<bool> use_low_latency_mode{linkage, false, "use_low_latency_mode",
+                                                 Category::RendererAdvanced};
+    SwitchableSetting<u8, true> max_frames_in_flight{linkage,
+                                                     2,
+                                                     1,
+                                                     3,
+                                                     "max_frames_in_flight",
+                                                     Category::RendererAdvanced,
+                                                     Specialization::Countable};
     SwitchableSetting<bool> renderer_force_max_clock{linkage, false, "force_max_clock",
                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_reactive_flushing{linkage,
@@ -423,8 +466,20 @@ struct Values {
                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_video_framerate{linkage, false, "use_video_framerate",
                                                 Category::RendererAdvanced};
+    SwitchableSetting<bool> use_asynchronous_nvdec{linkage, true, "use_asynchronous_nvdec",
+                                                   Category::RendererAdvanced};
     SwitchableSetting<bool> barrier_feedback_loops{linkage, true, "barrier_feedback_loops",
                                                    Category::RendererAdvanced};
+    SwitchableSetting<bool> use_host_memory_import{linkage, false, "use_host_memory_import",
+                                                   Category::RendererAdvanced};
+    SwitchableSetting<bool> use_reserved_buffers{linkage, false, "use_reserved_buffers",
+                                                 Category::RendererAdvanced};
+    SwitchableSetting<bool> use_predicted_queries{linkage, false, "use_predicted_queries",
+                                                  Category::RendererAdvanced};
+    SwitchableSetting<bool> use_parallel_command_recording{
+        linkage, false, "use_parallel_command_recording", Category::RendererAdvanced};
+    SwitchableSetting<bool> use_storage_buffer_pointers{
+        linkage, false, "use_storage_buffer_pointers", Category::RendererAdvanced};
 
     Setting<bool> renderer_debug{linkage, false, "debug", Category::RendererDebug};
     Setting<bool> renderer_shader_feedback{linkage, false, "shader_feedback",
@@ -437,6 +492,8 @@ struct Values {
                                           Category::RendererDebug};
     Setting<bool> disable_buffer_reorder{linkage, false, "disable_buffer_reorder",
                                          Category::RendererDebug};
+    Setting<bool> gpu_pass_timestamps{linkage, false, "gpu_pass_timestamps",
+                                      Category::RendererDebug};
 
     // System
     SwitchableSetting<Language, true> language_index{linkage,
@@ -570,6 +627,19 @@ struct Values {
                                         Category::DataStorage};
     Setting<std::string> gamecard_path{linkage, std::string(), "gamecard_path",
                                        Category::DataStorage};
+    // Size in MiB of the cache of blocks read ahead from RomFS files, zero disables read ahead
+    Setting<u32, true> romfs_read_ahead_cache_size{
+        linkage, 64, 0, 1024, "romfs_read_ahead_cache_size", Category::DataStorage};
+    // Size in MiB of the cache of decompressed blocks of compressed NCA sections, zero disables it
+    Setting<u32, true> compressed_block_cache_size{
+        linkage, 32, 0, 1024, "compressed_block_cache_size", Category::DataStorage};
+    // Seconds without writes to a save before its pending writes are written back to the host,
+    // zero writes to save data straight to the host
+    Setting<u32, true> save_data_write_back_delay{
+        linkage, 2, 0, 60, "save_data_write_back_delay", Category::DataStorage};
+    // Hash RomFS and ExeFS blocks the first time they're read and log the ones that don't match
+    Setting<bool> verify_romfs_integrity{linkage, false, "verify_romfs_integrity",
+                                         Category::DataStorage};
 
     // Debugging
     bool record_frame_times;
@@ -583,6 +653,13 @@ struct Values {
         false};
     Setting<bool> dump_macros{
         linkage, false, "dump_macros", Category::DebuggingGraphics, Specialization::Default, false};
+    Setting<bool> profile_macros{linkage, false, "profile_macros", Category::DebuggingGraphics,
+                                 Specialization::Default, false};
+    Setting<bool> dump_texture_cache_stats{linkage, false, "dump_texture_cache_stats",
+                                           Category::DebuggingGraphics, Specialization::Default,
+                                           false};
+    Setting<bool> capture_gpu_commands{linkage, false, "capture_gpu_commands",
+                                       Category::DebuggingGraphics, Specialization::Default, false};
     Setting<bool> enable_fs_access_log{linkage, false, "enable_fs_access_log", Category::Debugging};
     Setting<bool> reporting_services{
         linkage, false, "reporting_services", Category::Debugging, Specialization::Default, false};
@@ -594,6 +671,16 @@ struct Values {
     Setting<bool> extended_logging{
         linkage, false, "extended_logging", Category::Debugging, Specialization::Default, false};
     Setting<bool> use_debug_asserts{linkage, false, "use_debug_asserts", Category::Debugging};
+    Setting<bool> record_scheduler_lock_stats{linkage, false, "record_scheduler_lock_stats",
+                                              Category::Debugging, Specialization::Default, false};
+    Setting<bool> record_svc_stats{linkage, false, "record_svc_stats", Category::Debugging,
+                                   Specialization::Default, false};
+    Setting<bool> record_kernel_trace{linkage, false, "record_kernel_trace", Category::Debugging,
+                                      Specialization::Default, false};
+    Setting<bool> record_microprofile_trace{linkage, false, "record_microprofile_trace",
+                                            Category::Debugging, Specialization::Default, false};
+    Setting<bool> record_input_latency{linkage, false, "record_input_latency",
+                                       Category::Debugging, Specialization::Default, false};
     Setting<bool> use_auto_stub{
         linkage, false, "use_auto_stub", Category::Debugging, Specialization::Default, false};
     Setting<bool> enable_all_controllers{linkage, false, "enable_all_controllers",
@@ -627,6 +714,7 @@ bool IsGPULevelExtreme();
 bool IsGPULevelHigh();
 
 bool IsFastmemEnabled();
+void SetFastmemSupported(bool is_supported);
 void SetNceEnabled(bool is_64bit);
 bool IsNceEnabled();
 
@@ -147,7 +147,7 @@ ENUM(ResolutionSetup, Res1_2X, Res3_4X, Res1X, Res3_2X, Res2X, Res3X, Res4X, Res
 
 ENUM(ScalingFilter, NearestNeighbor, Bilinear, Bicubic, Gaussian, ScaleForce, Fsr, MaxEnum);
 
-ENUM(AntiAliasing, None, Fxaa, Smaa, MaxEnum);
+ENUM(AntiAliasing, None, Fxaa, Smaa, Taa, MaxEnum);
 
 ENUM(AspectRatio, R16_9, R4_3, R21_9, R16_10, Stretch);
 
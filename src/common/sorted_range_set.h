@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Set of address ranges with the interface of RangeSet. Touching ranges are joined like in
+ * RangeSet.
+ *
+ * The ranges are kept sorted in blocks of contiguous memory, like the leaves of a B+ tree. Lookups
+ * are binary searches over the last range of each block and then inside a block, and insertions
+ * only move the ranges of one block. This avoids chasing and allocating a tree node per range.
+ */
+template <typename AddressType>
+class SortedRangeSet {
+public:
+    SortedRangeSet() = default;
+    ~SortedRangeSet() = default;
+
+    SortedRangeSet(SortedRangeSet const&) = delete;
+    SortedRangeSet& operator=(SortedRangeSet const&) = delete;
+
+    SortedRangeSet(SortedRangeSet&& other) noexcept = default;
+    SortedRangeSet& operator=(SortedRangeSet&& other) noexcept = default;
+
+    void Add(AddressType base_address, size_t size) {
+        if (size == 0) {
+            return;
+        }
+        const AddressType end_address = base_address + static_cast<AddressType>(size);
+        // Ranges touching the new one are joined with it
+        const Position first = FirstEndingAtOrAfter(base_address);
+        const Position last = FirstStartingAfter(first, end_address);
+        if (first == last) {
+            Insert(first, Range{base_address, end_address});
+            return;
+        }
+        Range& joined = At(first);
+        joined.begin = std::min(joined.begin, base_address);
+        joined.end = std::max(At(Previous(last)).end, end_address);
+        const Position next = Next(first);
+        if (next != last) {
+            Erase(next, last);
+        }
+    }
+
+    void Subtract(AddressType base_address, size_t size) {
+        if (size == 0) {
+            return;
+        }
+        const AddressType end_address = base_address + static_cast<AddressType>(size);
+        const Position first = FirstEndingAfter(base_address);
+        const Position last = FirstStartingAtOrAfter(first, end_address);
+        if (first == last) {
+            return;
+        }
+        const Range head{At(first).begin, base_address};
+        const Range tail{end_address, At(Previous(last)).end};
+        const bool keep_head = head.begin < head.end;
+        const bool keep_tail = tail.begin < tail.end;
+        if (keep_head && keep_tail && Next(first) == last) {
+            // Splits a single range in two
+            At(first).end = base_address;
+            Insert(last, tail);
+            return;
+        }
+        // Reuses the slots of the removed ranges for the parts left on each side
+        Position position = first;
+        if (keep_head) {
+            At(position) = head;
+            position = Next(position);
+        }
+        if (keep_tail) {
+            At(position) = tail;
+            position = Next(position);
+        }
+        if (position != last) {
+            Erase(position, last);
+        }
+    }
+
+    void Clear() {
+        blocks.clear();
+    }
+
+    [[nodiscard]] bool Empty() const {
+        return blocks.empty();
+    }
+
+    template <typename Func>
+    void ForEach(Func&& func) const {
+        for (const Block& block : blocks) {
+            for (const Range& range : block) {
+                func(range.begin, range.end);
+            }
+        }
+    }
+
+    template <typename Func>
+    void ForEachInRange(AddressType base_address, size_t size, Func&& func) const {
+        if (size == 0) {
+            return;
+        }
+        const AddressType end_address = base_address + static_cast<AddressType>(size);
+        auto block_it = std::ranges::partition_point(blocks, [base_address](const Block& block) {
+            return block.back().end <= base_address;
+        });
+        if (block_it == blocks.end()) {
+            return;
+        }
+        auto it = std::ranges::upper_bound(*block_it, base_address, {}, &Range::end);
+        while (it->begin < end_address) {
+            func(std::max(it->begin, base_address), std::min(it->end, end_address));
+            if (++it == block_it->end()) {
+                if (++block_it == blocks.end()) {
+                    return;
+                }
+                it = block_it->begin();
+            }
+        }
+    }
+
+private:
+    /// Ranges per block, a block is split in two when it grows past it
+    static constexpr size_t MaxBlockSize = 128;
+
+    struct Range {
+        AddressType begin;
+        AddressType end;
+    };
+    using Block = std::vector<Range>;
+
+    /// Location of a range, the end of the set is {blocks.size(), 0}
+    struct Position {
+        size_t block;
+        size_t index;
+
+        bool operator==(const Position&) const = default;
+    };
+
+    Range& At(Position position) {
+        return blocks[position.block][position.index];
+    }
+
+    Position Previous(Position position) const {
+        if (position.index > 0) {
+            return {position.block, position.index - 1};
+        }
+        return {position.block - 1, blocks[position.block - 1].size() - 1};
+    }
+
+    Position Next(Position position) const {
+        return Normalize({position.block, position.index + 1});
+    }
+
+    /// Moves a position past the end of its block to the start of the next one
+    Position Normalize(Position position) const {
+        if (position.block < blocks.size() && position.index == blocks[position.block].size()) {
+            return {position.block + 1, 0};
+        }
+        return position;
+    }
+
+    /// Returns the first range a predicate on the end of the ranges fails for
+    template <typename Pred>
+    Position FindByEnd(Pred&& is_before) {
+        const auto block_it = std::ranges::partition_point(
+            blocks, [&](const Block& block) { return is_before(block.back().end); });
+        if (block_it == blocks.end()) {
+            return {blocks.size(), 0};
+        }
+        const auto it = std::ranges::partition_point(
+            *block_it, [&](const Range& range) { return is_before(range.end); });
+        return {static_cast<size_t>(block_it - blocks.begin()),
+                static_cast<size_t>(it - block_it->begin())};
+    }
+
+    /// Returns the first range from a position a predicate on the start of the ranges fails for
+    template <typename Pred>
+    Position FindByBegin(Position from, Pred&& is_before) {
+        const auto block_it = std::partition_point(
+            blocks.begin() + from.block, blocks.end(),
+            [&](const Block& block) { return is_before(block.back().begin); });
+        if (block_it == blocks.end()) {
+            return {blocks.size(), 0};
+        }
+        const size_t block = static_cast<size_t>(block_it - blocks.begin());
+        const size_t start = block == from.block ? from.index : 0;
+        const auto it = std::partition_point(
+            block_it->begin() + start, block_it->end(),
+            [&](const Range& range) { return is_before(range.begin); });
+        return {block, static_cast<size_t>(it - block_it->begin())};
+    }
+
+    Position FirstEndingAtOrAfter(AddressType address) {
+        return FindByEnd([address](AddressType end) { return end < address; });
+    }
+
+    Position FirstEndingAfter(AddressType address) {
+        return FindByEnd([address](AddressType end) { return end <= address; });
+    }
+
+    Position FirstStartingAfter(Position from, AddressType address) {
+        return FindByBegin(from, [address](AddressType begin) { return begin <= address; });
+    }
+
+    Position FirstStartingAtOrAfter(Position from, AddressType address) {
+        return FindByBegin(from, [address](AddressType begin) { return begin < address; });
+    }
+
+    /// Inserts a range before a position
+    void Insert(Position position, const Range& range) {
+        if (blocks.empty()) {
+            blocks.emplace_back().push_back(range);
+            return;
+        }
+        if (position.block == blocks.size()) {
+            position = {blocks.size() - 1, blocks.back().size()};
+        }
+        Block& block = blocks[position.block];
+        block.insert(block.begin() + position.index, range);
+        if (block.size() > MaxBlockSize) {
+            const size_t half = block.size() / 2;
+            Block upper(block.begin() + half, block.end());
+            block.resize(half);
+            blocks.insert(blocks.begin() + position.block + 1, std::move(upper));
+        }
+    }
+
+    /// Erases the ranges between two different positions
+    void Erase(Position first, Position last) {
+        if (first.block == last.block) {
+            Block& block = blocks[first.block];
+            block.erase(block.begin() + first.index, block.begin() + last.index);
+        } else {
+            Block& first_block = blocks[first.block];
+            first_block.erase(first_block.begin() + first.index, first_block.end());
+            if (last.block < blocks.size()) {
+                Block& last_block = blocks[last.block];
+                last_block.erase(last_block.begin(), last_block.begin() + last.index);
+            }
+            blocks.erase(blocks.begin() + first.block + 1, blocks.begin() + last.block);
+        }
+        // Keeps blocks from emptying out, otherwise lookups degrade to one block per range
+        const size_t next = first.block + 1;
+        if (next < blocks.size() && blocks[first.block].size() + blocks[next].size() <=
+                                        MaxBlockSize / 2) {
+            Block& block = blocks[first.block];
+            block.insert(block.end(), blocks[next].begin(), blocks[next].end());
+            blocks.erase(blocks.begin() + next);
+        }
+        if (blocks[first.block].empty()) {
+            blocks.erase(blocks.begin() + first.block);
+        }
+    }
+
+    std::vector<Block> blocks;
+};
+
+} // namespace Common
@@ -0,0 +1,288 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "common/task_pool.h"
+#include "common/thread.h"
+
+namespace Common {
+
+struct TaskGroup::Shared {
+    std::mutex mutex;
+    std::condition_variable idle_condition;
+    std::deque<UniqueFunction<void>> tasks;
+    TaskPriority priority;
+    std::size_t max_concurrency;
+    /// Tasks being run by the pool or by a waiting thread
+    std::size_t running{};
+    /// Tickets of the group queued in the pool, each one lets a worker run one task
+    std::size_t tickets{};
+};
+
+namespace {
+
+using Ticket = std::shared_ptr<TaskGroup::Shared>;
+
+constexpr std::size_t NumPriorities = 3;
+constexpr std::size_t NotAWorker = std::numeric_limits<std::size_t>::max();
+
+/// Index of the pool worker running on this thread
+thread_local std::size_t current_worker = NotAWorker;
+
+std::size_t CalculatePoolSize() {
+    const std::size_t host_threads =
+        std::max<std::size_t>(static_cast<std::size_t>(std::thread::hardware_concurrency()), 2);
+#ifdef __ANDROID__
+    // Leave at least a few cores free in android
+    constexpr std::size_t reserved_threads = 4;
+#else
+    // The emulated CPU cores already compete for the rest of the host
+    constexpr std::size_t reserved_threads = 1;
+#endif
+    return host_threads > reserved_threads ? host_threads - reserved_threads : 1;
+}
+
+/// Returns whether the group has tasks that no queued ticket or running task will start, the
+/// group's mutex must be held
+bool NeedsTicket(const TaskGroup::Shared& group) {
+    return group.tasks.size() > group.tickets &&
+           group.running + group.tickets < group.max_concurrency;
+}
+
+class TaskPool {
+public:
+    static TaskPool& Instance() {
+        static TaskPool pool;
+        return pool;
+    }
+
+    TaskPool()
+        : num_workers{CalculatePoolSize()},
+          background_limit{std::max<std::size_t>(num_workers / 2, 1)}, queues(num_workers) {
+        threads.reserve(num_workers);
+        for (std::size_t index = 0; index < num_workers; ++index) {
+            threads.emplace_back([this, index](std::stop_token stop_token) {
+                WorkerLoop(stop_token, index);
+            });
+        }
+    }
+
+    ~TaskPool() {
+        for (auto& thread : threads) {
+            thread.request_stop();
+        }
+        threads.clear();
+    }
+
+    [[nodiscard]] std::size_t Size() const {
+        return num_workers;
+    }
+
+    /// Queues a ticket, workers push their own tickets to their own queue so they stay local
+    void Submit(Ticket ticket) {
+        const auto priority = static_cast<std::size_t>(ticket->priority);
+        const std::size_t index = current_worker != NotAWorker
+                                      ? current_worker
+                                      : next_queue.fetch_add(1, std::memory_order_relaxed) %
+                                            num_workers;
+        {
+            std::scoped_lock lock{queues[index].mutex};
+            queues[index].tickets[priority].push_back(std::move(ticket));
+        }
+        pending[priority].fetch_add(1, std::memory_order_release);
+        Wake();
+    }
+
+    /// Runs the next task of a group, the group's mutex must be held and it is held on return
+    void RunTask(const Ticket& group, std::unique_lock<std::mutex>& lock) {
+        UniqueFunction<void> task = std::move(group->tasks.front());
+        group->tasks.pop_front();
+        ++group->running;
+        lock.unlock();
+        task();
+        task = {};
+        lock.lock();
+        --group->running;
+        if (NeedsTicket(*group)) {
+            ++group->tickets;
+            Submit(group);
+        }
+        group->idle_condition.notify_all();
+    }
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::array<std::deque<Ticket>, NumPriorities> tickets;
+    };
+
+    void Wake() {
+        // Taking the mutex orders the wake up after a worker that is about to sleep checked the
+        // pending tickets
+        { std::scoped_lock lock{sleep_mutex}; }
+        sleep_condition.notify_one();
+    }
+
+    [[nodiscard]] bool HasRunnableTickets() const {
+        const auto count = [this](TaskPriority priority) {
+            return pending[static_cast<std::size_t>(priority)].load(std::memory_order_acquire);
+        };
+        return count(TaskPriority::LatencyCritical) > 0 || count(TaskPriority::Normal) > 0 ||
+               (count(TaskPriority::Background) > 0 &&
+                running_background.load(std::memory_order_relaxed) < background_limit);
+    }
+
+    /// Takes a ticket from the worker's own queue first, then steals from the others
+    Ticket TryPop(std::size_t worker) {
+        for (std::size_t priority = 0; priority < NumPriorities; ++priority) {
+            if (pending[priority].load(std::memory_order_acquire) == 0) {
+                continue;
+            }
+            const bool background = priority == static_cast<std::size_t>(TaskPriority::Background);
+            if (background && !ReserveBackgroundSlot()) {
+                continue;
+            }
+            for (std::size_t offset = 0; offset < num_workers; ++offset) {
+                WorkerQueue& queue = queues[(worker + offset) % num_workers];
+                std::scoped_lock lock{queue.mutex};
+                auto& tickets = queue.tickets[priority];
+                if (tickets.empty()) {
+                    continue;
+                }
+                Ticket ticket;
+                if (offset == 0) {
+                    ticket = std::move(tickets.back());
+                    tickets.pop_back();
+                } else {
+                    ticket = std::move(tickets.front());
+                    tickets.pop_front();
+                }
+                pending[priority].fetch_sub(1, std::memory_order_relaxed);
+                return ticket;
+            }
+            if (background) {
+                running_background.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+        return {};
+    }
+
+    bool ReserveBackgroundSlot() {
+        std::size_t running = running_background.load(std::memory_order_relaxed);
+        do {
+            if (running >= background_limit) {
+                return false;
+            }
+        } while (!running_background.compare_exchange_weak(running, running + 1,
+                                                           std::memory_order_relaxed));
+        return true;
+    }
+
+    void WorkerLoop(std::stop_token stop_token, std::size_t index) {
+        const std::string name = "TaskPool:" + std::to_string(index);
+        SetCurrentThreadName(name.c_str());
+        current_worker = index;
+
+        bool lowered_priority = false;
+        while (!stop_token.stop_requested()) {
+            Ticket ticket = TryPop(index);
+            if (!ticket) {
+                std::unique_lock lock{sleep_mutex};
+                CondvarWait(sleep_condition, lock, stop_token,
+                            [this] { return HasRunnableTickets(); });
+                continue;
+            }
+            const bool background = ticket->priority == TaskPriority::Background;
+            if (background != lowered_priority) {
+                SetCurrentThreadPriority(background ? ThreadPriority::Low : ThreadPriority::Normal);
+                lowered_priority = background;
+            }
+            {
+                std::unique_lock lock{ticket->mutex};
+                --ticket->tickets;
+                if (!ticket->tasks.empty() && ticket->running < ticket->max_concurrency) {
+                    RunTask(ticket, lock);
+                }
+            }
+            if (background) {
+                // A worker may be sleeping on background work that was over the limit
+                running_background.fetch_sub(1, std::memory_order_relaxed);
+                Wake();
+            }
+        }
+    }
+
+    const std::size_t num_workers;
+    const std::size_t background_limit;
+    std::vector<WorkerQueue> queues;
+    std::array<std::atomic<std::size_t>, NumPriorities> pending{};
+    std::atomic<std::size_t> running_background{};
+    std::atomic<std::size_t> next_queue{};
+
+    std::mutex sleep_mutex;
+    std::condition_variable_any sleep_condition;
+    std::vector<std::jthread> threads;
+};
+
+} // Anonymous namespace
+
+TaskGroup::TaskGroup(TaskPriority priority, std::size_t max_concurrency)
+    : shared{std::make_shared<Shared>()} {
+    shared->priority = priority;
+    shared->max_concurrency = std::max<std::size_t>(max_concurrency, 1);
+    // Constructs the pool before the group, so it outlives groups with static storage
+    TaskPool::Instance();
+}
+
+TaskGroup::~TaskGroup() {
+    std::deque<UniqueFunction<void>> dropped;
+    std::unique_lock lock{shared->mutex};
+    dropped.swap(shared->tasks);
+    shared->idle_condition.wait(lock, [this] { return shared->running == 0; });
+}
+
+void TaskGroup::QueueWork(UniqueFunction<void> task) {
+    std::scoped_lock lock{shared->mutex};
+    shared->tasks.push_back(std::move(task));
+    if (NeedsTicket(*shared)) {
+        ++shared->tickets;
+        TaskPool::Instance().Submit(shared);
+    }
+}
+
+void TaskGroup::WaitForRequests(std::stop_token stop_token) {
+    std::stop_callback callback(stop_token, [this] {
+        { std::scoped_lock lock{shared->mutex}; }
+        shared->idle_condition.notify_all();
+    });
+    std::deque<UniqueFunction<void>> dropped;
+    std::unique_lock lock{shared->mutex};
+    while (!shared->tasks.empty() || shared->running > 0) {
+        if (stop_token.stop_requested()) {
+            dropped.swap(shared->tasks);
+            shared->idle_condition.wait(lock, [this] { return shared->running == 0; });
+            break;
+        }
+        if (!shared->tasks.empty() && shared->running < shared->max_concurrency) {
+            TaskPool::Instance().RunTask(shared, lock);
+            continue;
+        }
+        shared->idle_condition.wait(lock);
+    }
+}
+
+std::size_t GetTaskPoolSize() {
+    return TaskPool::Instance().Size();
+}
+
+} // namespace Common
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+#include "common/common_types.h"
+#include "common/polyfill_thread.h"
+#include "common/unique_function.h"
+
+namespace Common {
+
+/// Order in which the shared pool runs the tasks queued to it
+enum class TaskPriority : u8 {
+    /// Work something is blocked on right now, like texture decoding or audio mixing
+    LatencyCritical,
+    /// Work needed soon, like building the pipelines of a draw
+    Normal,
+    /// Work nothing waits on. At most half of the pool runs it, at a lower thread priority.
+    Background,
+};
+
+/**
+ * Tasks of one user of the process-wide task pool. The pool has a single set of worker threads,
+ * sized to leave room for the emulated CPU and GPU threads, which steal work from each other so
+ * every user shares them instead of creating threads of its own.
+ *
+ * Tasks of a group start in the order they were queued, at most max_concurrency of them at once.
+ * The group has the interface of Common::ThreadWorker, so it can be used with ParallelForEach.
+ */
+class TaskGroup {
+public:
+    using State = void;
+
+    explicit TaskGroup(TaskPriority priority,
+                       std::size_t max_concurrency = std::numeric_limits<std::size_t>::max());
+
+    /// Drops the tasks that have not started and waits for the running ones
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    TaskGroup(TaskGroup&&) = delete;
+    TaskGroup& operator=(TaskGroup&&) = delete;
+
+    void QueueWork(UniqueFunction<void> task);
+
+    /**
+     * Waits until every queued task has finished. The calling thread runs tasks of the group that
+     * have not started, so it is safe to wait from inside a task of the pool. When stop is
+     * requested, the tasks that have not started are dropped.
+     */
+    void WaitForRequests(std::stop_token stop_token = {});
+
+    struct Shared;
+
+private:
+    std::shared_ptr<Shared> shared;
+};
+
+/// Returns the number of worker threads of the process-wide task pool
+[[nodiscard]] std::size_t GetTaskPoolSize();
+
+} // namespace Common
@@ -5,7 +5,9 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <exception>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -34,6 +36,8 @@ class StatefulThreadWorker {
     using StateMaker = std::conditional_t<with_state, std::function<StateType()>, DummyCallable>;
 
 public:
+    using State = StateType;
+
     explicit StatefulThreadWorker(size_t num_workers, std::string name, StateMaker func = {})
         : workers_queued{num_workers}, thread_name{std::move(name)} {
         const auto lambda = [this, func](std::stop_token stop_token) {
@@ -114,4 +118,59 @@ private:
 
 using ThreadWorker = StatefulThreadWorker<>;
 
+/// Runs func(index) for every index in [0, count) on the worker threads and the calling thread.
+/// Tasks no worker has started by the time the calling thread is done are run inline, so the
+/// caller never waits behind unrelated work and it is safe to call from a worker thread.
+/// The first exception thrown by func is rethrown once every task has finished.
+/// Worker is a StatefulThreadWorker or anything with the same QueueWork and State members.
+template <class Worker, typename Func>
+void ParallelForEach(Worker& worker, size_t count, Func&& func) {
+    using StateType = typename Worker::State;
+    struct State {
+        std::unique_ptr<std::atomic_bool[]> claimed;
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t remaining{};
+        std::exception_ptr exception;
+    };
+    const auto state{std::make_shared<State>()};
+    state->claimed = std::make_unique<std::atomic_bool[]>(count);
+    state->remaining = count;
+
+    // func is only referenced by claimed tasks, which the caller waits for before returning
+    const auto try_run{[&func](State& shared, size_t index) {
+        if (shared.claimed[index].exchange(true)) {
+            return;
+        }
+        std::exception_ptr exception;
+        try {
+            func(index);
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        std::scoped_lock lock{shared.mutex};
+        if (exception && !shared.exception) {
+            shared.exception = exception;
+        }
+        if (--shared.remaining == 0) {
+            shared.condition.notify_one();
+        }
+    }};
+    for (size_t index = 1; index < count; ++index) {
+        if constexpr (std::is_void_v<StateType>) {
+            worker.QueueWork([state, try_run, index] { try_run(*state, index); });
+        } else {
+            worker.QueueWork([state, try_run, index](StateType*) { try_run(*state, index); });
+        }
+    }
+    for (size_t index = 0; index < count; ++index) {
+        try_run(*state, index);
+    }
+    std::unique_lock lock{state->mutex};
+    state->condition.wait(lock, [&state] { return state->remaining == 0; });
+    if (state->exception) {
+        std::rethrow_exception(state->exception);
+    }
+}
+
 } // namespace Common
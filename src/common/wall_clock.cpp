@@ -52,6 +52,14 @@ public:
     bool IsNative() const override {
         return false;
     }
+
+    std::optional<HostTickScale> GetCNTPCTScale() const override {
+        return std::nullopt;
+    }
+
+    std::optional<HostTickScale> GetGPUTickScale() const override {
+        return std::nullopt;
+    }
 };
 
 std::unique_ptr<WallClock> CreateOptimalClock() {
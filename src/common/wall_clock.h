@@ -5,12 +5,46 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <ratio>
 
 #include "common/common_types.h"
+#include "common/uint128.h"
+
+#ifdef ARCHITECTURE_x86_64
+#include "common/x64/rdtsc.h"
+#endif
 
 namespace Common {
 
+/// Fixed point ratio from host timer ticks to a guest frequency. It has 64 fractional bits and 64
+/// integer bits, so host timers slower than the guest counter can be scaled too.
+struct HostTickScale {
+    u64 factor_low;
+    u64 factor_high;
+
+    [[nodiscard]] u64 Scale(u64 host_ticks) const {
+        return MultiplyHigh(host_ticks, factor_low) + host_ticks * factor_high;
+    }
+};
+
+/// @returns The raw ticks of the host timer, TSC on x86_64 and CNTVCT on arm64.
+/// Only meaningful when the clock in use is native.
+inline u64 ReadNativeTicks() {
+#if defined(ARCHITECTURE_x86_64)
+    return X64::FencedRDTSC();
+#elif defined(HAS_NCE)
+    u64 cntvct_el0 = 0;
+    asm volatile("dsb ish\n\t"
+                 "mrs %[cntvct_el0], cntvct_el0\n\t"
+                 "dsb ish\n\t"
+                 : [cntvct_el0] "=r"(cntvct_el0));
+    return cntvct_el0;
+#else
+    return 0;
+#endif
+}
+
 class WallClock {
 public:
     static constexpr u64 CNTFRQ = 19'200'000;         // CNTPCT_EL0 Frequency = 19.2 MHz
@@ -40,6 +74,13 @@ public:
     /// @returns Whether the clock directly uses the host's hardware clock.
     virtual bool IsNative() const = 0;
 
+    /// @returns The scale from ReadNativeTicks to CNTPCT ticks when the clock is native. Games poll
+    /// the timer in tight loops, callers can then read it inline instead of calling the clock.
+    virtual std::optional<HostTickScale> GetCNTPCTScale() const = 0;
+
+    /// @returns The scale from ReadNativeTicks to GPU ticks when the clock is native.
+    virtual std::optional<HostTickScale> GetGPUTickScale() const = 0;
+
     static inline u64 NSToCNTPCT(u64 ns) {
         return ns * NsToCNTPCTRatio::num / NsToCNTPCTRatio::den;
     }
@@ -43,4 +43,12 @@ bool NativeClock::IsNative() const {
     return true;
 }
 
+std::optional<HostTickScale> NativeClock::GetCNTPCTScale() const {
+    return HostTickScale{.factor_low = cntpct_rdtsc_factor, .factor_high = 0};
+}
+
+std::optional<HostTickScale> NativeClock::GetGPUTickScale() const {
+    return HostTickScale{.factor_low = gputick_rdtsc_factor, .factor_high = 0};
+}
+
 } // namespace Common::X64
@@ -25,6 +25,10 @@ public:
 
     bool IsNative() const override;
 
+    std::optional<HostTickScale> GetCNTPCTScale() const override;
+
+    std::optional<HostTickScale> GetGPUTickScale() const override;
+
 private:
     u64 rdtsc_frequency;
 
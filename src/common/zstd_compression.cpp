@@ -2,33 +2,65 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <thread>
+#include <zdict.h>
 #include <zstd.h>
 
+#include "common/literals.h"
 #include "common/zstd_compression.h"
 
 namespace Common::Compression {
 
+namespace {
+using namespace Common::Literals;
+
+/// Sources past this size are compressed with several threads
+constexpr std::size_t MULTITHREAD_THRESHOLD = 16_MiB;
+constexpr u32 MAX_WORKERS = 4;
+
+static_assert(DEFAULT_ZSTD_LEVEL == ZSTD_CLEVEL_DEFAULT);
+
+std::optional<std::size_t> ToOptional(std::size_t result) {
+    if (ZSTD_isError(result)) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+StreamStatus ToStatus(std::size_t result) {
+    if (ZSTD_isError(result)) {
+        return StreamStatus::Error;
+    }
+    return result == 0 ? StreamStatus::Done : StreamStatus::Pending;
+}
+} // Anonymous namespace
+
 std::vector<u8> CompressDataZSTD(const u8* source, std::size_t source_size, s32 compression_level) {
     compression_level = std::clamp(compression_level, 1, ZSTD_maxCLevel());
 
     const std::size_t max_compressed_size = ZSTD_compressBound(source_size);
     std::vector<u8> compressed(max_compressed_size);
 
-    const std::size_t compressed_size =
-        ZSTD_compress(compressed.data(), compressed.size(), source, source_size, compression_level);
+    u32 num_workers = 0;
+    if (source_size >= MULTITHREAD_THRESHOLD) {
+        num_workers = std::clamp(std::thread::hardware_concurrency() / 2, 1U, MAX_WORKERS);
+    }
+    ZstdEncoder encoder(compression_level, num_workers);
+    const std::optional<std::size_t> compressed_size =
+        encoder.Compress(compressed, {source, source_size});
 
-    if (ZSTD_isError(compressed_size)) {
+    if (!compressed_size) {
         // Compression failed
         return {};
     }
 
-    compressed.resize(compressed_size);
+    compressed.resize(*compressed_size);
 
     return compressed;
 }
 
 std::vector<u8> CompressDataZSTDDefault(const u8* source, std::size_t source_size) {
-    return CompressDataZSTD(source, source_size, ZSTD_CLEVEL_DEFAULT);
+    return CompressDataZSTD(source, source_size, DEFAULT_ZSTD_LEVEL);
 }
 
 std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed) {
@@ -46,4 +78,134 @@ std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed) {
     return decompressed;
 }
 
+std::optional<std::size_t> DecompressDataZSTD(std::span<u8> output,
+                                              std::span<const u8> compressed) {
+    return ToOptional(
+        ZSTD_decompress(output.data(), output.size(), compressed.data(), compressed.size()));
+}
+
+std::optional<std::size_t> CompressDataZSTD(std::span<u8> output, std::span<const u8> source,
+                                            s32 compression_level) {
+    compression_level = std::clamp(compression_level, 1, ZSTD_maxCLevel());
+    return ToOptional(ZSTD_compress(output.data(), output.size(), source.data(), source.size(),
+                                    compression_level));
+}
+
+std::size_t GetCompressBoundZSTD(std::size_t source_size) {
+    return ZSTD_compressBound(source_size);
+}
+
+ZstdDictionary::ZstdDictionary(std::span<const u8> content, s32 compression_level) {
+    if (ZDICT_getDictID(content.data(), content.size()) == 0) {
+        return;
+    }
+    compression_level = std::clamp(compression_level, 1, ZSTD_maxCLevel());
+    cdict = ZSTD_createCDict(content.data(), content.size(), compression_level);
+    ddict = ZSTD_createDDict(content.data(), content.size());
+}
+
+ZstdDictionary::~ZstdDictionary() {
+    ZSTD_freeCDict(cdict);
+    ZSTD_freeDDict(ddict);
+}
+
+std::vector<u8> ZstdDictionary::Train(std::span<const u8> samples,
+                                      std::span<const std::size_t> sample_sizes,
+                                      std::size_t max_size) {
+    std::vector<u8> content(max_size);
+    const std::size_t size =
+        ZDICT_trainFromBuffer(content.data(), content.size(), samples.data(), sample_sizes.data(),
+                              static_cast<unsigned>(sample_sizes.size()));
+    if (ZDICT_isError(size)) {
+        return {};
+    }
+    content.resize(size);
+    return content;
+}
+
+u32 ZstdDictionary::Id() const {
+    return ZSTD_getDictID_fromDDict(ddict);
+}
+
+ZstdEncoder::ZstdEncoder(s32 compression_level, u32 num_workers,
+                         const ZstdDictionary* dictionary)
+    : context{ZSTD_createCCtx()} {
+    compression_level = std::clamp(compression_level, 1, ZSTD_maxCLevel());
+    ZSTD_CCtx_setParameter(context, ZSTD_c_compressionLevel, compression_level);
+    if (num_workers > 0) {
+        // Fails when the library was built without threads, compression stays single threaded
+        ZSTD_CCtx_setParameter(context, ZSTD_c_nbWorkers, static_cast<int>(num_workers));
+    }
+    if (dictionary && dictionary->IsValid()) {
+        ZSTD_CCtx_refCDict(context, dictionary->cdict);
+    }
+}
+
+ZstdEncoder::~ZstdEncoder() {
+    ZSTD_freeCCtx(context);
+}
+
+std::optional<std::size_t> ZstdEncoder::Compress(std::span<u8> output,
+                                                 std::span<const u8> source) {
+    Reset();
+    return ToOptional(
+        ZSTD_compress2(context, output.data(), output.size(), source.data(), source.size()));
+}
+
+StreamStatus ZstdEncoder::CompressStream(std::span<const u8>& input, std::span<u8>& output,
+                                         bool finish) {
+    ZSTD_inBuffer in{input.data(), input.size(), 0};
+    ZSTD_outBuffer out{output.data(), output.size(), 0};
+    const ZSTD_EndDirective mode = finish ? ZSTD_e_end : ZSTD_e_continue;
+    std::size_t result;
+    do {
+        // Multithreaded compression may return before consuming the input or flushing the frame
+        result = ZSTD_compressStream2(context, &out, &in, mode);
+    } while (!ZSTD_isError(result) && out.pos < out.size &&
+             (finish ? result != 0 : in.pos < in.size));
+    input = input.subspan(in.pos);
+    output = output.subspan(out.pos);
+    if (ZSTD_isError(result)) {
+        return StreamStatus::Error;
+    }
+    if (!finish) {
+        return in.pos == in.size ? StreamStatus::Done : StreamStatus::Pending;
+    }
+    return ToStatus(result);
+}
+
+void ZstdEncoder::Reset() {
+    ZSTD_CCtx_reset(context, ZSTD_reset_session_only);
+}
+
+ZstdDecoder::ZstdDecoder(const ZstdDictionary* dictionary) : context{ZSTD_createDCtx()} {
+    if (dictionary && dictionary->IsValid()) {
+        ZSTD_DCtx_refDDict(context, dictionary->ddict);
+    }
+}
+
+ZstdDecoder::~ZstdDecoder() {
+    ZSTD_freeDCtx(context);
+}
+
+std::optional<std::size_t> ZstdDecoder::Decompress(std::span<u8> output,
+                                                   std::span<const u8> compressed) {
+    Reset();
+    return ToOptional(ZSTD_decompressDCtx(context, output.data(), output.size(),
+                                          compressed.data(), compressed.size()));
+}
+
+StreamStatus ZstdDecoder::DecompressStream(std::span<const u8>& input, std::span<u8>& output) {
+    ZSTD_inBuffer in{input.data(), input.size(), 0};
+    ZSTD_outBuffer out{output.data(), output.size(), 0};
+    const std::size_t result = ZSTD_decompressStream(context, &out, &in);
+    input = input.subspan(in.pos);
+    output = output.subspan(out.pos);
+    return ToStatus(result);
+}
+
+void ZstdDecoder::Reset() {
+    ZSTD_DCtx_reset(context, ZSTD_reset_session_only);
+}
+
 } // namespace Common::Compression
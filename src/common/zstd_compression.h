@@ -3,13 +3,22 @@
 
 #pragma once
 
+#include <optional>
 #include <span>
 #include <vector>
 
 #include "common/common_types.h"
 
+struct ZSTD_CCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_DDict_s;
+
 namespace Common::Compression {
 
+/// Level used by CompressDataZSTDDefault, a good balance between speed and ratio
+constexpr s32 DEFAULT_ZSTD_LEVEL = 3;
+
 /**
  * Compresses a source memory region with Zstandard and returns the compressed data in a vector.
  *
@@ -42,4 +51,165 @@ namespace Common::Compression {
  */
 [[nodiscard]] std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed);
 
+/**
+ * Decompresses a Zstandard frame into a caller provided buffer, without allocating.
+ *
+ * @param output     Destination of the uncompressed data.
+ * @param compressed The compressed source memory region.
+ *
+ * @return the decompressed size, or std::nullopt when decompression failed or the output is too
+ *         small.
+ */
+[[nodiscard]] std::optional<std::size_t> DecompressDataZSTD(std::span<u8> output,
+                                                            std::span<const u8> compressed);
+
+/**
+ * Compresses a source memory region with Zstandard into a caller provided buffer.
+ *
+ * @param output            Destination of the compressed data. GetCompressBoundZSTD bytes always
+ *                          fit the whole source.
+ * @param source            The uncompressed source memory region.
+ * @param compression_level The used compression level. Should be between 1 and 22.
+ *
+ * @return the compressed size, or std::nullopt when compression failed or the output is too small.
+ */
+[[nodiscard]] std::optional<std::size_t> CompressDataZSTD(std::span<u8> output,
+                                                          std::span<const u8> source,
+                                                          s32 compression_level);
+
+/// Returns the largest compressed size of a source of the given size
+[[nodiscard]] std::size_t GetCompressBoundZSTD(std::size_t source_size);
+
+/**
+ * Dictionary shared by many small and similar records, like the entries of the pipeline caches.
+ * Records compressed with a dictionary can only be decompressed with the same one.
+ */
+class ZstdDictionary {
+public:
+    /**
+     * @param content           Raw dictionary content, usually built by Train.
+     * @param compression_level Level the encoders using the dictionary compress with.
+     */
+    explicit ZstdDictionary(std::span<const u8> content, s32 compression_level);
+    ~ZstdDictionary();
+
+    ZstdDictionary(const ZstdDictionary&) = delete;
+    ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+
+    /**
+     * Builds a dictionary from sample records.
+     *
+     * @param samples      The sample records, one after another.
+     * @param sample_sizes The size of each record in samples.
+     * @param max_size     The largest dictionary size to build, around 100 KiB works well.
+     *
+     * @return the dictionary content, empty when there are too few samples to train with.
+     */
+    [[nodiscard]] static std::vector<u8> Train(std::span<const u8> samples,
+                                               std::span<const std::size_t> sample_sizes,
+                                               std::size_t max_size);
+
+    /// Returns false when the content is not a valid dictionary
+    [[nodiscard]] bool IsValid() const noexcept {
+        return cdict != nullptr && ddict != nullptr;
+    }
+
+    /// Returns the identifier stored in the frames compressed with the dictionary
+    [[nodiscard]] u32 Id() const;
+
+private:
+    friend class ZstdEncoder;
+    friend class ZstdDecoder;
+
+    ZSTD_CDict_s* cdict{};
+    ZSTD_DDict_s* ddict{};
+};
+
+enum class StreamStatus {
+    /// Input consumed and, when finishing, the frame is complete
+    Done,
+    /// The output is full, call again with more output space
+    Pending,
+    /// The data is corrupted or the stream was misused, the coder has to be reset
+    Error,
+};
+
+/**
+ * Reusable Zstandard compressor. Keeps the compression context and its buffers alive between
+ * frames, which saves hundreds of KiB of allocations per frame on small records.
+ */
+class ZstdEncoder {
+public:
+    /**
+     * @param compression_level The used compression level. Should be between 1 and 22.
+     * @param num_workers       Threads compressing in the background, 0 compresses in the caller.
+     *                          Only pays off on inputs of several MiB. Ignored when the library
+     *                          was built without threading support.
+     * @param dictionary        Optional dictionary, it has to outlive the encoder.
+     */
+    explicit ZstdEncoder(s32 compression_level, u32 num_workers = 0,
+                         const ZstdDictionary* dictionary = nullptr);
+    ~ZstdEncoder();
+
+    ZstdEncoder(const ZstdEncoder&) = delete;
+    ZstdEncoder& operator=(const ZstdEncoder&) = delete;
+
+    /**
+     * Compresses a whole frame into a caller provided buffer.
+     *
+     * @return the compressed size, or std::nullopt when compression failed or the output is too
+     *         small.
+     */
+    [[nodiscard]] std::optional<std::size_t> Compress(std::span<u8> output,
+                                                      std::span<const u8> source);
+
+    /**
+     * Compresses part of a frame. Both spans are advanced past the consumed input and the
+     * produced output.
+     *
+     * @param finish Ends the frame after the given input, keep calling with finish set until it
+     *               returns Done.
+     */
+    [[nodiscard]] StreamStatus CompressStream(std::span<const u8>& input, std::span<u8>& output,
+                                              bool finish);
+
+    /// Drops the frame in progress, the next call starts a new frame
+    void Reset();
+
+private:
+    ZSTD_CCtx_s* context;
+};
+
+/// Reusable Zstandard decompressor, the decompression counterpart of ZstdEncoder
+class ZstdDecoder {
+public:
+    /// @param dictionary Optional dictionary, it has to outlive the decoder.
+    explicit ZstdDecoder(const ZstdDictionary* dictionary = nullptr);
+    ~ZstdDecoder();
+
+    ZstdDecoder(const ZstdDecoder&) = delete;
+    ZstdDecoder& operator=(const ZstdDecoder&) = delete;
+
+    /**
+     * Decompresses a whole frame into a caller provided buffer.
+     *
+     * @return the decompressed size, or std::nullopt when decompression failed or the output is too
+     *         small.
+     */
+    [[nodiscard]] std::optional<std::size_t> Decompress(std::span<u8> output,
+                                                        std::span<const u8> compressed);
+
+    /**
+     * Decompresses part of a stream. Both spans are advanced past the consumed input and the
+     * produced output. Returns Done once a frame has been completely decompressed and flushed.
+     */
+    [[nodiscard]] StreamStatus DecompressStream(std::span<const u8>& input, std::span<u8>& output);
+
+    /// Drops the frame in progress, the next call starts a new frame
+    void Reset();
+
+private:
+    ZSTD_DCtx_s* context;
+};
+
 } // namespace Common::Compression
@@ -1,8 +1,13 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <cstddef>
+
 #include <dynarmic/interface/halt_reason.h>
 
+#include "common/literals.h"
+#include "common/settings.h"
 #include "core/arm/arm_interface.h"
 
 namespace Core {
@@ -26,6 +31,21 @@ constexpr HaltReason TranslateHaltReason(Dynarmic::HaltReason hr) {
     return static_cast<HaltReason>(hr);
 }
 
+/// Returns the code cache size of a JIT, set by jit_code_cache_size in MiB with 0 as the default
+inline std::size_t JitCodeCacheSize() {
+    using namespace Common::Literals;
+#ifdef ARCHITECTURE_arm64
+    // Emitted code must stay within the range of a branch
+    return 128_MiB;
+#else
+    const u32 size_mib = Settings::values.jit_code_cache_size.GetValue();
+    if (size_mib == 0) {
+        return 512_MiB;
+    }
+    return static_cast<std::size_t>(std::clamp<u32>(size_mib, 64, 1024)) * 1_MiB;
+#endif
+}
+
 #ifdef __linux__
 
 class ScopedJitExecution {
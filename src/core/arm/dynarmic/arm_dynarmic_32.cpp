@@ -6,6 +6,7 @@
 #include "core/arm/dynarmic/arm_dynarmic_32.h"
 #include "core/arm/dynarmic/dynarmic_cp15.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
+#include "core/arm/jit_cache_stats.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_process.h"
 
@@ -19,7 +20,8 @@ public:
         : m_parent{parent}, m_memory(process->GetMemory()),
           m_process(process), m_debugger_enabled{parent.m_system.DebuggerEnabled()},
           m_check_memory_access{m_debugger_enabled ||
-                                !Settings::values.cpuopt_ignore_memory_aborts.GetValue()} {}
+                                !Settings::values.cpuopt_ignore_memory_aborts.GetValue()},
+          m_jit_cache_counters{parent.m_system.GetJitCacheCounters()} {}
 
     u8 MemoryRead8(u32 vaddr) override {
         CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Read);
@@ -41,6 +43,9 @@ public:
         if (!m_memory.IsValidVirtualAddressRange(vaddr, sizeof(u32))) {
             return std::nullopt;
         }
+        // Code is only read while translating, a read not following the last one starts a block
+        m_jit_cache_counters.AddTranslatedInstruction(vaddr - m_last_code_vaddr > sizeof(u32));
+        m_last_code_vaddr = vaddr;
         return m_memory.Read32(vaddr);
     }
 
@@ -172,6 +177,8 @@ public:
     Kernel::KProcess* m_process{};
     const bool m_debugger_enabled{};
     const bool m_check_memory_access{};
+    Core::JitCacheCounters& m_jit_cache_counters;
+    u32 m_last_code_vaddr{};
     static constexpr u64 MinimumRunCycles = 10000U;
 };
 
@@ -207,11 +214,7 @@ std::shared_ptr<Dynarmic::A32::Jit> ArmDynarmic32::MakeJit(Common::PageTable* pa
     config.enable_cycle_counting = !m_uses_wall_clock;
 
     // Code cache size
-#ifdef ARCHITECTURE_arm64
-    config.code_cache_size = 128_MiB;
-#else
-    config.code_cache_size = 512_MiB;
-#endif
+    config.code_cache_size = JitCodeCacheSize();
 
     // Allow memory fault handling to work
     if (m_system.DebuggerEnabled()) {
@@ -222,6 +225,8 @@ std::shared_ptr<Dynarmic::A32::Jit> ArmDynarmic32::MakeJit(Common::PageTable* pa
     if (!page_table) {
         // Don't waste too much memory on null_jit
         config.code_cache_size = 8_MiB;
+    } else {
+        m_system.GetJitCacheCounters().SetCodeCacheSize(config.code_cache_size);
     }
 
     // Safe optimizations
@@ -437,10 +442,12 @@ void ArmDynarmic32::SignalInterrupt(Kernel::KThread* thread) {
 }
 
 void ArmDynarmic32::ClearInstructionCache() {
+    m_system.GetJitCacheCounters().AddCacheClear();
     m_jit->ClearCache();
 }
 
 void ArmDynarmic32::InvalidateCacheRange(u64 addr, std::size_t size) {
+    m_system.GetJitCacheCounters().AddInvalidation(size);
     m_jit->InvalidateCacheRange(static_cast<u32>(addr), size);
 }
 
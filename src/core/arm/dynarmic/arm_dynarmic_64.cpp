@@ -5,6 +5,7 @@
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/arm_dynarmic_64.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
+#include "core/arm/jit_cache_stats.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_process.h"
 
@@ -17,9 +18,11 @@ class DynarmicCallbacks64 : public Dynarmic::A64::UserCallbacks {
 public:
     explicit DynarmicCallbacks64(ArmDynarmic64& parent, Kernel::KProcess* process)
         : m_parent{parent}, m_memory(process->GetMemory()),
-          m_process(process), m_debugger_enabled{parent.m_system.DebuggerEnabled()},
+          m_core_timing{parent.m_system.CoreTiming()}, m_process(process),
+          m_debugger_enabled{parent.m_system.DebuggerEnabled()},
           m_check_memory_access{m_debugger_enabled ||
-                                !Settings::values.cpuopt_ignore_memory_aborts.GetValue()} {}
+                                !Settings::values.cpuopt_ignore_memory_aborts.GetValue()},
+          m_jit_cache_counters{parent.m_system.GetJitCacheCounters()} {}
 
     u8 MemoryRead8(u64 vaddr) override {
         CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Read);
@@ -45,6 +48,9 @@ public:
         if (!m_memory.IsValidVirtualAddressRange(vaddr, sizeof(u32))) {
             return std::nullopt;
         }
+        // Code is only read while translating, a read not following the last one starts a block
+        m_jit_cache_counters.AddTranslatedInstruction(vaddr - m_last_code_vaddr > sizeof(u32));
+        m_last_code_vaddr = vaddr;
         return m_memory.Read32(vaddr);
     }
 
@@ -167,17 +173,18 @@ public:
         // Always execute at least one tick.
         amortized_ticks = std::max<u64>(amortized_ticks, 1);
 
-        m_parent.m_system.CoreTiming().AddTicks(amortized_ticks);
+        m_core_timing.AddTicks(amortized_ticks);
     }
 
     u64 GetTicksRemaining() override {
         ASSERT_MSG(!m_parent.m_uses_wall_clock, "Dynarmic ticking disabled");
 
-        return std::max<s64>(m_parent.m_system.CoreTiming().GetDowncount(), 0);
+        return std::max<s64>(m_core_timing.GetDowncount(), 0);
     }
 
     u64 GetCNTPCT() override {
-        return m_parent.m_system.CoreTiming().GetClockTicks();
+        // Reads the host timer inline with native clocks
+        return m_core_timing.GetClockTicks();
     }
 
     bool CheckMemoryAccess(u64 addr, u64 size, Kernel::DebugWatchpointType type) {
@@ -214,11 +221,14 @@ public:
 
     ArmDynarmic64& m_parent;
     Core::Memory::Memory& m_memory;
+    Core::Timing::CoreTiming& m_core_timing;
     u64 m_tpidrro_el0{};
     u64 m_tpidr_el0{};
     Kernel::KProcess* m_process{};
     const bool m_debugger_enabled{};
     const bool m_check_memory_access{};
+    Core::JitCacheCounters& m_jit_cache_counters;
+    u64 m_last_code_vaddr{};
     static constexpr u64 MinimumRunCycles = 10000U;
 };
 
@@ -266,11 +276,7 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
     config.enable_cycle_counting = !m_uses_wall_clock;
 
     // Code cache size
-#ifdef ARCHITECTURE_arm64
-    config.code_cache_size = 128_MiB;
-#else
-    config.code_cache_size = 512_MiB;
-#endif
+    config.code_cache_size = JitCodeCacheSize();
 
     // Allow memory fault handling to work
     if (m_system.DebuggerEnabled()) {
@@ -281,6 +287,8 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
     if (!page_table) {
         // Don't waste too much memory on null_jit
         config.code_cache_size = 8_MiB;
+    } else {
+        m_system.GetJitCacheCounters().SetCodeCacheSize(config.code_cache_size);
     }
 
     // Safe optimizations
@@ -467,10 +475,12 @@ void ArmDynarmic64::SignalInterrupt(Kernel::KThread* thread) {
 }
 
 void ArmDynarmic64::ClearInstructionCache() {
+    m_system.GetJitCacheCounters().AddCacheClear();
     m_jit->ClearCache();
 }
 
 void ArmDynarmic64::InvalidateCacheRange(u64 addr, std::size_t size) {
+    m_system.GetJitCacheCounters().AddInvalidation(size);
     m_jit->InvalidateCacheRange(addr, size);
 }
 
@@ -1,30 +1,126 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <mutex>
+
+#include "common/logging/log.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
 #include "core/memory.h"
 
 namespace Core {
 
+namespace {
+template <typename T>
+T ReadMemory(Memory::Memory& memory, VAddr addr) {
+    if constexpr (sizeof(T) == 1) {
+        return memory.Read8(addr);
+    } else if constexpr (sizeof(T) == 2) {
+        return memory.Read16(addr);
+    } else if constexpr (sizeof(T) == 4) {
+        return memory.Read32(addr);
+    } else {
+        return memory.Read64(addr);
+    }
+}
+
+template <typename T>
+bool WriteMemoryExclusive(Memory::Memory& memory, VAddr addr, T value, T expected) {
+    if constexpr (sizeof(T) == 1) {
+        return memory.WriteExclusive8(addr, value, expected);
+    } else if constexpr (sizeof(T) == 2) {
+        return memory.WriteExclusive16(addr, value, expected);
+    } else if constexpr (sizeof(T) == 4) {
+        return memory.WriteExclusive32(addr, value, expected);
+    } else {
+        return memory.WriteExclusive64(addr, value, expected);
+    }
+}
+} // Anonymous namespace
+
 DynarmicExclusiveMonitor::DynarmicExclusiveMonitor(Memory::Memory& memory_, std::size_t core_count_)
-    : monitor{core_count_}, memory{memory_} {}
+    : monitor{core_count_}, memory{memory_}, core_count{core_count_},
+      reservations{std::make_unique<Reservation[]>(core_count_)} {}
+
+DynarmicExclusiveMonitor::~DynarmicExclusiveMonitor() {
+    u64 num_writes = 0;
+    u64 num_contended_writes = 0;
+    for (std::size_t core = 0; core < core_count; ++core) {
+        num_writes += reservations[core].num_writes;
+        num_contended_writes += reservations[core].num_contended_writes;
+    }
+    if (num_writes != 0) {
+        LOG_DEBUG(Core_ARM, "Kernel exclusive writes: {}, contended: {}", num_writes,
+                  num_contended_writes);
+    }
+}
 
-DynarmicExclusiveMonitor::~DynarmicExclusiveMonitor() = default;
+template <typename T>
+T DynarmicExclusiveMonitor::ExclusiveRead(std::size_t core_index, VAddr addr) {
+    const T value = ReadMemory<T>(memory, addr);
+    Reservation& reservation = reservations[core_index];
+    reservation.value = value;
+    reservation.address.store(addr, std::memory_order_release);
+    return value;
+}
+
+template <typename T>
+bool DynarmicExclusiveMonitor::ExclusiveWrite(std::size_t core_index, VAddr addr, T value) {
+    Reservation& reservation = reservations[core_index];
+    if (reservation.address.load(std::memory_order_acquire) != addr) {
+        return false;
+    }
+    const T expected = static_cast<T>(reservation.value);
+    ++reservation.num_writes;
+    if (!HasOverlappingReservation(core_index, addr)) {
+        reservation.address.store(InvalidAddress, std::memory_order_relaxed);
+        return WriteMemoryExclusive<T>(memory, addr, value, expected);
+    }
+    ++reservation.num_contended_writes;
+
+    std::scoped_lock lk{overlap_lock};
+    // Another core may have written the granule since, which cleared this reservation
+    VAddr reserved = addr;
+    if (!reservation.address.compare_exchange_strong(reserved, InvalidAddress)) {
+        return false;
+    }
+    if (!WriteMemoryExclusive<T>(memory, addr, value, expected)) {
+        return false;
+    }
+    // Clear the other reservations on the granule, like the hardware monitor does
+    for (std::size_t core = 0; core < core_count; ++core) {
+        VAddr other = reservations[core].address.load(std::memory_order_acquire);
+        if (core != core_index && ((other ^ addr) & GranuleMask) == 0) {
+            reservations[core].address.compare_exchange_strong(other, InvalidAddress);
+        }
+    }
+    return true;
+}
+
+bool DynarmicExclusiveMonitor::HasOverlappingReservation(std::size_t core_index,
+                                                         VAddr addr) const {
+    for (std::size_t core = 0; core < core_count; ++core) {
+        const VAddr other = reservations[core].address.load(std::memory_order_acquire);
+        if (core != core_index && ((other ^ addr) & GranuleMask) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
 
 u8 DynarmicExclusiveMonitor::ExclusiveRead8(std::size_t core_index, VAddr addr) {
-    return monitor.ReadAndMark<u8>(core_index, addr, [&]() -> u8 { return memory.Read8(addr); });
+    return ExclusiveRead<u8>(core_index, addr);
 }
 
 u16 DynarmicExclusiveMonitor::ExclusiveRead16(std::size_t core_index, VAddr addr) {
-    return monitor.ReadAndMark<u16>(core_index, addr, [&]() -> u16 { return memory.Read16(addr); });
+    return ExclusiveRead<u16>(core_index, addr);
 }
 
 u32 DynarmicExclusiveMonitor::ExclusiveRead32(std::size_t core_index, VAddr addr) {
-    return monitor.ReadAndMark<u32>(core_index, addr, [&]() -> u32 { return memory.Read32(addr); });
+    return ExclusiveRead<u32>(core_index, addr);
 }
 
 u64 DynarmicExclusiveMonitor::ExclusiveRead64(std::size_t core_index, VAddr addr) {
-    return monitor.ReadAndMark<u64>(core_index, addr, [&]() -> u64 { return memory.Read64(addr); });
+    return ExclusiveRead<u64>(core_index, addr);
 }
 
 u128 DynarmicExclusiveMonitor::ExclusiveRead128(std::size_t core_index, VAddr addr) {
@@ -37,31 +133,24 @@ u128 DynarmicExclusiveMonitor::ExclusiveRead128(std::size_t core_index, VAddr ad
 }
 
 void DynarmicExclusiveMonitor::ClearExclusive(std::size_t core_index) {
+    reservations[core_index].address.store(InvalidAddress, std::memory_order_relaxed);
     monitor.ClearProcessor(core_index);
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) {
-    return monitor.DoExclusiveOperation<u8>(core_index, vaddr, [&](u8 expected) -> bool {
-        return memory.WriteExclusive8(vaddr, value, expected);
-    });
+    return ExclusiveWrite<u8>(core_index, vaddr, value);
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite16(std::size_t core_index, VAddr vaddr, u16 value) {
-    return monitor.DoExclusiveOperation<u16>(core_index, vaddr, [&](u16 expected) -> bool {
-        return memory.WriteExclusive16(vaddr, value, expected);
-    });
+    return ExclusiveWrite<u16>(core_index, vaddr, value);
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite32(std::size_t core_index, VAddr vaddr, u32 value) {
-    return monitor.DoExclusiveOperation<u32>(core_index, vaddr, [&](u32 expected) -> bool {
-        return memory.WriteExclusive32(vaddr, value, expected);
-    });
+    return ExclusiveWrite<u32>(core_index, vaddr, value);
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite64(std::size_t core_index, VAddr vaddr, u64 value) {
-    return monitor.DoExclusiveOperation<u64>(core_index, vaddr, [&](u64 expected) -> bool {
-        return memory.WriteExclusive64(vaddr, value, expected);
-    });
+    return ExclusiveWrite<u64>(core_index, vaddr, value);
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite128(std::size_t core_index, VAddr vaddr, u128 value) {
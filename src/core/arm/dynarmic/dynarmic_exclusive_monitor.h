@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include <dynarmic/interface/exclusive_monitor.h>
 
 #include "common/common_types.h"
+#include "common/spin_lock.h"
 #include "core/arm/exclusive_monitor.h"
 
 namespace Core::Memory {
@@ -17,6 +21,13 @@ namespace Core {
 class ArmDynarmic32;
 class ArmDynarmic64;
 
+/**
+ * Exclusive monitor shared with the JIT. Accesses made by the kernel up to 64 bits wide keep
+ * their own per-core reservations and complete with a host compare-and-swap, only taking a lock
+ * when another core holds a reservation on the same granule. Guest code and 128-bit accesses go
+ * through the dynarmic monitor. Both sides compare against the reserved value when writing, so
+ * writes from either side fail the other's pending exclusive writes.
+ */
 class DynarmicExclusiveMonitor final : public ExclusiveMonitor {
 public:
     explicit DynarmicExclusiveMonitor(Memory::Memory& memory_, std::size_t core_count_);
@@ -38,8 +49,34 @@ public:
 private:
     friend class ArmDynarmic32;
     friend class ArmDynarmic64;
+
+    static constexpr VAddr InvalidAddress = ~VAddr{0};
+    static constexpr VAddr GranuleMask = ~VAddr{0xF};
+
+    struct alignas(64) Reservation {
+        std::atomic<VAddr> address{InvalidAddress};
+        u64 value{}; ///< Only accessed by the core holding the reservation
+
+        u64 num_writes{};
+        u64 num_contended_writes{};
+    };
+
+    template <typename T>
+    T ExclusiveRead(std::size_t core_index, VAddr addr);
+
+    template <typename T>
+    bool ExclusiveWrite(std::size_t core_index, VAddr addr, T value);
+
+    /// Returns true when another core holds a reservation on the granule of an address
+    [[nodiscard]] bool HasOverlappingReservation(std::size_t core_index, VAddr addr) const;
+
     Dynarmic::ExclusiveMonitor monitor;
     Core::Memory::Memory& memory;
+
+    std::size_t core_count;
+    std::unique_ptr<Reservation[]> reservations;
+    /// Orders writes to granules reserved by more than one core
+    Common::SpinLock overlap_lock;
 };
 
 } // namespace Core
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Core {
+
+/// Code cache activity of the CPU JITs, summed since the last reset
+struct JitCacheStats {
+    u64 code_cache_size{};         ///< Code cache of each JIT, in bytes
+    u64 translated_blocks{};       ///< Runs of guest code translated, retranslations included
+    u64 translated_instructions{}; ///< Guest instructions read to be translated
+    u64 invalidations{};           ///< Ranges invalidated by cache maintenance and code remaps
+    u64 invalidated_bytes{};       ///< Size of the invalidated ranges
+    u64 cache_clears{};            ///< Times a whole code cache was thrown away
+};
+
+/// Counts the code cache activity of every JIT. Lock-free, safe to call from any thread.
+class JitCacheCounters {
+public:
+    /// Records the code cache size the JITs were created with
+    void SetCodeCacheSize(std::size_t size) {
+        code_cache_size.store(size, std::memory_order_relaxed);
+    }
+
+    /// Records a guest instruction read to be translated, new_block when it doesn't follow the
+    /// instruction read before it
+    void AddTranslatedInstruction(bool new_block) {
+        translated_instructions.fetch_add(1, std::memory_order_relaxed);
+        if (new_block) {
+            translated_blocks.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void AddInvalidation(std::size_t size) {
+        invalidations.fetch_add(1, std::memory_order_relaxed);
+        invalidated_bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    void AddCacheClear() {
+        cache_clears.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Returns the activity since the last call
+    JitCacheStats GetAndReset() {
+        return {
+            .code_cache_size = code_cache_size.load(std::memory_order_relaxed),
+            .translated_blocks = translated_blocks.exchange(0, std::memory_order_relaxed),
+            .translated_instructions =
+                translated_instructions.exchange(0, std::memory_order_relaxed),
+            .invalidations = invalidations.exchange(0, std::memory_order_relaxed),
+            .invalidated_bytes = invalidated_bytes.exchange(0, std::memory_order_relaxed),
+            .cache_clears = cache_clears.exchange(0, std::memory_order_relaxed),
+        };
+    }
+
+private:
+    std::atomic<u64> code_cache_size{};
+    std::atomic<u64> translated_blocks{};
+    std::atomic<u64> translated_instructions{};
+    std::atomic<u64> invalidations{};
+    std::atomic<u64> invalidated_bytes{};
+    std::atomic<u64> cache_clears{};
+};
+
+} // namespace Core
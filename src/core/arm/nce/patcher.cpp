@@ -1,9 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+
 #include "common/arm64/native_clock.h"
 #include "common/bit_cast.h"
 #include "common/literals.h"
+#include "common/logging/log.h"
 #include "core/arm/nce/arm_nce.h"
 #include "core/arm/nce/guest_context.h"
 #include "core/arm/nce/instructions.h"
@@ -22,6 +25,11 @@ using NativeExecutionParameters = Kernel::KThread::NativeExecutionParameters;
 constexpr size_t MaxRelativeBranch = 128_MiB;
 constexpr u32 ModuleCodeIndex = 0x24 / sizeof(u32);
 
+/// Rejects most of the text with a single compare, SVC, MRS and MSR all live in 0xD4-0xD5
+constexpr bool MayNeedPatch(u32 inst) {
+    return (inst & 0xFE000000) == 0xD4000000 || Exclusive{inst}.Verify();
+}
+
 Patcher::Patcher() : c(m_patch_instructions) {
     // The first word of the patch section is always a branch to the first instruction of the
     // module.
@@ -46,6 +54,8 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
         return false;
     }
 
+    const auto start_time{std::chrono::steady_clock::now()};
+
     // Add a new module patch to our list
     modules.emplace_back();
     curr_patch = &modules.back();
@@ -62,6 +72,9 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
     // Loop through instructions, patching as needed.
     for (u32 i = ModuleCodeIndex; i < static_cast<u32>(text_words.size()); i++) {
         const u32 inst = text_words[i];
+        if (!MayNeedPatch(inst)) {
+            continue;
+        }
 
         const auto AddRelocations = [&] {
             const uintptr_t this_offset = i * sizeof(u32);
@@ -116,6 +129,12 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
     // Determine patching mode for the final relocation step
     total_program_size += image_size;
     this->mode = image_size > MaxRelativeBranch ? PatchMode::PreText : PatchMode::PostData;
+
+    const auto patch_time{std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time)};
+    LOG_INFO(Core_ARM, "Patched {} KiB of text in {} us, {} instructions rewritten",
+             text.size() / 1_KiB, patch_time.count(),
+             curr_patch->m_branch_to_patch_relocations.size());
     return true;
 }
 
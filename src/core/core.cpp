@@ -3,18 +3,23 @@
 
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <exception>
+#include <future>
 #include <memory>
 #include <utility>
 
 #include "audio_core/audio_core.h"
 #include "common/fs/fs.h"
+#include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/microprofile_trace.h"
 #include "common/settings.h"
 #include "common/settings_enums.h"
 #include "common/string_util.h"
 #include "core/arm/exclusive_monitor.h"
+#include "core/arm/jit_cache_stats.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
@@ -296,23 +301,62 @@ struct System::Impl {
         cpu_manager.Initialize();
     }
 
-    SystemResultStatus SetupForApplicationProcess(System& system, Frontend::EmuWindow& emu_window) {
-        /// Reset all glue registrations
-        arp_manager.ResetAll();
-
-        telemetry_session = std::make_unique<Core::TelemetrySession>();
-
+    /// Time taken by each step of a boot, the GPU is created while the program loads
+    struct BootTimes {
+        std::chrono::steady_clock::duration open;
+        std::chrono::steady_clock::duration kernel;
+        std::chrono::steady_clock::duration program;
+        std::chrono::steady_clock::duration gpu;
+        std::chrono::steady_clock::duration audio;
+        std::chrono::steady_clock::duration services;
+        std::chrono::steady_clock::duration start;
+    };
+
+    SystemResultStatus CreateGPU(System& system, Frontend::EmuWindow& emu_window) {
         host1x_core = std::make_unique<Tegra::Host1x::Host1x>(system);
         gpu_core = VideoCore::CreateGPU(emu_window, system);
         if (!gpu_core) {
             return SystemResultStatus::ErrorVideoCore;
         }
+        return SystemResultStatus::Success;
+    }
+
+    SystemResultStatus CreateGpuOffline(System& system, Frontend::EmuWindow& emu_window) {
+        // The renderers report to the telemetry session when they are created
+        telemetry_session = std::make_unique<Core::TelemetrySession>();
+        // Title ID 0 keeps the frame time recordings from being saved
+        perf_stats = std::make_unique<PerfStats>(0);
+        // The DMA pusher only processes command lists while the system is powered on
+        is_powered_on = true;
+        return CreateGPU(system, emu_window);
+    }
 
+    void ShutdownGpuOffline() {
+        if (gpu_core != nullptr) {
+            gpu_core->NotifyShutdown();
+        }
+        is_powered_on = false;
+        gpu_core.reset();
+        host1x_core.reset();
+        perf_stats.reset();
+        telemetry_session.reset();
+    }
+
+    SystemResultStatus SetupForApplicationProcess(System& system, BootTimes& boot_times) {
+        using Clock = std::chrono::steady_clock;
+
+        /// Reset all glue registrations
+        arp_manager.ResetAll();
+
+        const auto audio_start = Clock::now();
         audio_core = std::make_unique<AudioCore::AudioCore>(system);
+        const auto audio_end = Clock::now();
 
         service_manager = std::make_shared<Service::SM::ServiceManager>(kernel);
         services =
             std::make_unique<Service::Services>(service_manager, system, stop_event.get_token());
+        boot_times.audio = audio_end - audio_start;
+        boot_times.services = Clock::now() - audio_end;
 
         is_powered_on = true;
         exit_locked = false;
@@ -335,6 +379,10 @@ struct System::Impl {
     SystemResultStatus Load(System& system, Frontend::EmuWindow& emu_window,
                             const std::string& filepath,
                             Service::AM::FrontendAppletParameters& params) {
+        using Clock = std::chrono::steady_clock;
+        const auto boot_start = Clock::now();
+        BootTimes boot_times{};
+
         app_loader = Loader::GetLoader(system, GetGameFileFromPath(virtual_filesystem, filepath),
                                        params.program_id, params.program_index);
 
@@ -353,8 +401,26 @@ struct System::Impl {
         }
 
         LOG_INFO(Core, "Loading {} ({})", name, params.program_id);
+        const auto open_end = Clock::now();
+        boot_times.open = open_end - boot_start;
 
         InitializeKernel(system);
+        const auto kernel_end = Clock::now();
+        boot_times.kernel = kernel_end - open_end;
+
+        // The GPU doesn't depend on the program, so its renderer is brought up while the program
+        // loads. OpenGL contexts are bound to the thread that creates them, that backend keeps
+        // creating the GPU on this thread once the program is loaded.
+        telemetry_session = std::make_unique<Core::TelemetrySession>();
+        const bool create_gpu_concurrently =
+            Settings::values.renderer_backend.GetValue() != Settings::RendererBackend::OpenGL;
+        auto gpu_result = std::async(
+            create_gpu_concurrently ? std::launch::async : std::launch::deferred, [&] {
+                const auto gpu_start = Clock::now();
+                const SystemResultStatus result = CreateGPU(system, emu_window);
+                boot_times.gpu = Clock::now() - gpu_start;
+                return result;
+            });
 
         // Create the application process.
         auto main_process = Kernel::KProcess::Create(system.Kernel());
@@ -364,20 +430,28 @@ struct System::Impl {
         const auto [load_result, load_parameters] = app_loader->Load(*main_process, system);
         if (load_result != Loader::ResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to load ROM (Error {})!", load_result);
+            if (create_gpu_concurrently) {
+                gpu_result.wait();
+            }
             ShutdownMainProcess();
 
             return static_cast<SystemResultStatus>(
                 static_cast<u32>(SystemResultStatus::ErrorLoader) + static_cast<u32>(load_result));
         }
+        boot_times.program = Clock::now() - kernel_end;
 
         // Set up the rest of the system.
-        SystemResultStatus init_result{SetupForApplicationProcess(system, emu_window)};
+        SystemResultStatus init_result{gpu_result.get()};
+        if (init_result == SystemResultStatus::Success) {
+            init_result = SetupForApplicationProcess(system, boot_times);
+        }
         if (init_result != SystemResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to initialize system (Error {})!",
                          static_cast<int>(init_result));
             ShutdownMainProcess();
             return init_result;
         }
+        const auto setup_end = Clock::now();
 
         AddGlueRegistrationForProcess(*app_loader, *main_process);
         telemetry_session->AddInitialInfo(*app_loader, fs_controller, *content_provider);
@@ -410,6 +484,17 @@ struct System::Impl {
         GetAndResetPerfStats();
         perf_stats->BeginSystemFrame();
 
+        if (Settings::values.record_microprofile_trace.GetValue()) {
+            const auto path = Common::FS::GetYuzuPath(Common::FS::YuzuPath::LogDir) /
+                              "microprofile_trace.json";
+            if (Common::StartMicroProfileTrace(path)) {
+                LOG_INFO(Core, "Writing the MicroProfile trace to {}",
+                         Common::FS::PathToUTF8String(path));
+            } else {
+                LOG_ERROR(Core, "Failed to open the MicroProfile trace");
+            }
+        }
+
         std::string title_version;
         const FileSys::PatchManager pm(params.program_id, system.GetFileSystemController(),
                                        system.GetContentProvider());
@@ -425,6 +510,19 @@ struct System::Impl {
             room_member->SendGameInfo(game_info);
         }
 
+        const auto to_ms = [](Clock::duration duration) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+        };
+        const auto boot_end = Clock::now();
+        boot_times.start = boot_end - setup_end;
+        LOG_INFO(Core,
+                 "Booted in {} ms (opening {} ms, kernel {} ms, loading program {} ms, GPU {} "
+                 "ms{}, audio {} ms, services {} ms, starting {} ms)",
+                 to_ms(boot_end - boot_start), to_ms(boot_times.open), to_ms(boot_times.kernel),
+                 to_ms(boot_times.program), to_ms(boot_times.gpu),
+                 create_gpu_concurrently ? " in parallel" : "", to_ms(boot_times.audio),
+                 to_ms(boot_times.services), to_ms(boot_times.start));
+
         status = SystemResultStatus::Success;
         return status;
     }
@@ -473,6 +571,7 @@ struct System::Impl {
         gpu_core.reset();
         host1x_core.reset();
         perf_stats.reset();
+        Common::StopMicroProfileTrace();
         cpu_manager.Shutdown();
         debugger.reset();
         kernel.Shutdown();
@@ -534,7 +633,29 @@ struct System::Impl {
     }
 
     PerfStatsResults GetAndResetPerfStats() {
-        return perf_stats->GetAndResetStats(core_timing.GetGlobalTimeUs());
+        PerfStatsResults results = perf_stats->GetAndResetStats(core_timing.GetGlobalTimeUs());
+        if (gpu_core) {
+            results.texture_cache = gpu_core->TextureCacheStats().GetAndReset();
+            results.semaphore_wait = gpu_core->GetAndResetSemaphoreWaitStats();
+            results.gpu_thread_queue = gpu_core->GetAndResetGpuThreadQueueStats();
+        }
+        results.scheduler_lock = kernel.GlobalSchedulerContext().SchedulerLock().GetAndResetStats();
+        for (size_t core = 0; core < results.core_idle.size(); ++core) {
+            results.core_idle[core] = kernel.PhysicalCore(core).GetAndResetIdleStats();
+        }
+        if (host1x_core) {
+            results.syncpoint_wait = host1x_core->GetSyncpointManager().GetAndResetWaitStats();
+            results.video_pipeline = host1x_core->VideoStats().GetAndReset();
+        }
+        results.read_ahead = fs_controller.GetAndResetReadAheadStats();
+        results.compressed_block_cache = fs_controller.GetAndResetCompressedBlockCacheStats();
+        results.jit_cache = jit_cache_counters.GetAndReset();
+        if (audio_core) {
+            results.audio_latency = std::chrono::duration<double>(
+                                        audio_core->GetOutputSink().GetOutputLatency())
+                                        .count();
+        }
+        return results;
     }
 
     mutable std::mutex suspend_guard;
@@ -602,6 +723,7 @@ struct System::Impl {
 
     std::unique_ptr<Core::PerfStats> perf_stats;
     Core::SpeedLimiter speed_limiter;
+    Core::JitCacheCounters jit_cache_counters;
 
     bool is_multicore{};
     bool is_async_gpu{};
@@ -691,6 +813,14 @@ SystemResultStatus System::Load(Frontend::EmuWindow& emu_window, const std::stri
     return impl->Load(*this, emu_window, filepath, params);
 }
 
+SystemResultStatus System::CreateGpuOffline(Frontend::EmuWindow& emu_window) {
+    return impl->CreateGpuOffline(*this, emu_window);
+}
+
+void System::ShutdownGpuOffline() {
+    impl->ShutdownGpuOffline();
+}
+
 bool System::IsPoweredOn() const {
     return impl->is_powered_on.load(std::memory_order::relaxed);
 }
@@ -707,10 +837,12 @@ std::span<GPUDirtyMemoryManager> System::GetGPUDirtyMemoryManager() {
     return impl->gpu_dirty_memory_managers;
 }
 
-void System::GatherGPUDirtyMemory(std::function<void(PAddr, size_t)>& callback) {
+size_t System::GatherGPUDirtyMemory(std::span<GPUDirtyRange> out) {
+    size_t count = 0;
     for (auto& manager : impl->gpu_dirty_memory_managers) {
-        manager.Gather(callback);
+        count += manager.Gather(out.subspan(count));
     }
+    return count;
 }
 
 PerfStatsResults System::GetAndResetPerfStats() {
@@ -831,6 +963,10 @@ const Core::PerfStats& System::GetPerfStats() const {
     return *impl->perf_stats;
 }
 
+Core::JitCacheCounters& System::GetJitCacheCounters() {
+    return impl->jit_cache_counters;
+}
+
 Core::SpeedLimiter& System::SpeedLimiter() {
     return impl->speed_limiter;
 }
@@ -119,6 +119,8 @@ class Debugger;
 class DeviceMemory;
 class ExclusiveMonitor;
 class GPUDirtyMemoryManager;
+struct GPUDirtyRange;
+class JitCacheCounters;
 class PerfStats;
 class Reporter;
 class SpeedLimiter;
@@ -211,6 +213,16 @@ public:
                                           const std::string& filepath,
                                           Service::AM::FrontendAppletParameters& params);
 
+    /**
+     * Creates the GPU without loading an application, for tools that drive it directly.
+     * @param emu_window Reference to the host-system window used for video output.
+     * @returns SystemResultStatus code, indicating if the operation succeeded.
+     */
+    [[nodiscard]] SystemResultStatus CreateGpuOffline(Frontend::EmuWindow& emu_window);
+
+    /// Destroys the GPU created by CreateGpuOffline.
+    void ShutdownGpuOffline();
+
     /**
      * Indicates if the emulated system is powered on (all subsystems initialized and able to run an
      * application).
@@ -229,7 +241,9 @@ public:
 
     std::span<GPUDirtyMemoryManager> GetGPUDirtyMemoryManager();
 
-    void GatherGPUDirtyMemory(std::function<void(PAddr, size_t)>& callback);
+    /// Drains the ranges written by every core into out.
+    /// @returns Number of ranges written, zero once all cores are drained
+    size_t GatherGPUDirtyMemory(std::span<GPUDirtyRange> out);
 
     [[nodiscard]] size_t GetCurrentHostThreadID() const;
 
@@ -320,6 +334,9 @@ public:
     /// Provides a constant reference to the internal PerfStats instance.
     [[nodiscard]] const Core::PerfStats& GetPerfStats() const;
 
+    /// Provides a reference to the code cache counters of the CPU JITs.
+    [[nodiscard]] Core::JitCacheCounters& GetJitCacheCounters();
+
     /// Provides a reference to the speed limiter;
     [[nodiscard]] Core::SpeedLimiter& SpeedLimiter();
 
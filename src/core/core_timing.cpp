@@ -4,7 +4,7 @@
 #include <algorithm>
 #include <mutex>
 #include <string>
-#include <tuple>
+#include <utility>
 
 #ifdef _WIN32
 #include "common/windows/timer_resolution.h"
@@ -26,28 +26,24 @@ std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callbac
     return std::make_shared<EventType>(std::move(callback), std::move(name));
 }
 
-struct CoreTiming::Event {
-    s64 time;
-    u64 fifo_order;
+/// Pending event, sorted by time and then by the order it was added to the queue
+struct ScheduledEvent : TimingWheelNode {
     std::weak_ptr<EventType> type;
-    s64 reschedule_time;
-    heap_t::handle_type handle{};
+    s64 reschedule_time{};
 
-    // Sort by time, unless the times are the same, in which case sort by
-    // the order added to the queue
-    friend bool operator>(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
-    }
-
-    friend bool operator<(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
-    }
+    /// Siblings in the pending list of the event type, or the free list
+    ScheduledEvent* type_prev{};
+    ScheduledEvent* type_next{};
 };
 
-CoreTiming::CoreTiming() : clock{Common::CreateOptimalClock()} {}
+CoreTiming::CoreTiming()
+    : clock{Common::CreateOptimalClock()}, cntpct_scale{clock->GetCNTPCTScale()},
+      gpu_tick_scale{clock->GetGPUTickScale()} {}
 
 CoreTiming::~CoreTiming() {
     Reset();
+    // Event types can outlive core timing, don't leave them pointing to freed events
+    ClearEvents();
 }
 
 void CoreTiming::ThreadEntry(CoreTiming& instance) {
@@ -73,7 +69,7 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
 
 void CoreTiming::ClearPendingEvents() {
     std::scoped_lock lock{advance_lock, basic_lock};
-    event_queue.clear();
+    ClearEvents();
     event.Set();
 }
 
@@ -112,7 +108,7 @@ bool CoreTiming::IsRunning() const {
 
 bool CoreTiming::HasPendingEvents() const {
     std::scoped_lock lock{basic_lock};
-    return !(wait_set && event_queue.empty());
+    return !(wait_set && event_queue.Empty());
 }
 
 void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
@@ -121,8 +117,11 @@ void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
         std::scoped_lock scope{basic_lock};
         const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
 
-        auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
-        (*h).handle = h;
+        ScheduledEvent* const evt{AllocateEvent()};
+        evt->time = next_time.count();
+        evt->type = event_type;
+        evt->reschedule_time = 0;
+        QueueEvent(evt, *event_type);
     }
 
     event.Set();
@@ -136,9 +135,11 @@ void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
         std::scoped_lock scope{basic_lock};
         const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
 
-        auto h{event_queue.emplace(
-            Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
-        (*h).handle = h;
+        ScheduledEvent* const evt{AllocateEvent()};
+        evt->time = next_time.count();
+        evt->type = event_type;
+        evt->reschedule_time = resched_time.count();
+        QueueEvent(evt, *event_type);
     }
 
     event.Set();
@@ -149,16 +150,15 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
     {
         std::scoped_lock lk{basic_lock};
 
-        std::vector<heap_t::handle_type> to_remove;
-        for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
-            const Event& e = *itr;
-            if (e.type.lock().get() == event_type.get()) {
-                to_remove.push_back(itr->handle);
-            }
-        }
-
-        for (auto& h : to_remove) {
-            event_queue.erase(h);
+        ScheduledEvent* evt{std::exchange(event_type->scheduled, nullptr)};
+        while (evt) {
+            ScheduledEvent* const next{evt->type_next};
+            event_queue.Remove(evt);
+            evt->type.reset();
+            evt->type_prev = nullptr;
+            evt->type_next = free_events;
+            free_events = evt;
+            evt = next;
         }
 
         event_type->sequence_number++;
@@ -179,37 +179,39 @@ void CoreTiming::Idle() {
     cpu_ticks += 1000U;
 }
 
-void CoreTiming::ResetTicks() {
-    downcount = MAX_SLICE_LENGTH;
-}
-
-u64 CoreTiming::GetClockTicks() const {
-    if (is_multicore) [[likely]] {
-        return clock->GetCNTPCT();
-    }
-    return Common::WallClock::CPUTickToCNTPCT(cpu_ticks);
-}
-
-u64 CoreTiming::GetGPUTicks() const {
-    if (is_multicore) [[likely]] {
-        return clock->GetGPUTick();
+void CoreTiming::ResetTicks(u32 slice_scale) {
+    s64 slice_length = MAX_SLICE_LENGTH * slice_scale;
+    if (slice_scale > 1) {
+        std::scoped_lock lock{basic_lock};
+        if (const auto next_time = event_queue.NextTime()) {
+            const s64 time_left = std::max<s64>(*next_time - GetGlobalTimeNs().count(), 0);
+            const auto slice_ns = static_cast<s64>(
+                Common::WallClock::CPUTickToNS(static_cast<u64>(slice_length)));
+            if (time_left < slice_ns) {
+                slice_length = std::max(MAX_SLICE_LENGTH, slice_length * time_left / slice_ns);
+            }
+        }
     }
-    return Common::WallClock::CPUTickToGPUTick(cpu_ticks);
+    downcount = slice_length;
 }
 
 std::optional<s64> CoreTiming::Advance() {
     std::scoped_lock lock{advance_lock, basic_lock};
     global_timer = GetGlobalTimeNs().count();
 
-    while (!event_queue.empty() && event_queue.top().time <= global_timer) {
-        const Event& evt = event_queue.top();
+    while (auto* const evt = static_cast<ScheduledEvent*>(event_queue.PopExpired(global_timer))) {
+        const auto event_type{evt->type.lock()};
+        // Unlinked while the callback runs, unscheduling the type can't free it under us
+        UnlinkFromType(evt, event_type.get());
 
-        if (const auto event_type{evt.type.lock()}) {
-            const auto evt_time = evt.time;
+        if (event_type) {
+            const auto evt_time = evt->time;
             const auto evt_sequence_num = event_type->sequence_number;
 
-            if (evt.reschedule_time == 0) {
-                event_queue.pop();
+            if (evt->reschedule_time == 0) {
+                evt->type.reset();
+                evt->type_next = free_events;
+                free_events = evt;
 
                 basic_lock.unlock();
 
@@ -226,34 +228,38 @@ std::optional<s64> CoreTiming::Advance() {
                 basic_lock.lock();
 
                 if (evt_sequence_num != event_type->sequence_number) {
-                    // Heap handle is invalidated after external modification.
+                    // The event was unscheduled while its callback was running.
+                    evt->type.reset();
+                    evt->type_next = free_events;
+                    free_events = evt;
+                    global_timer = GetGlobalTimeNs().count();
                     continue;
                 }
 
                 const auto next_schedule_time{new_schedule_time.has_value()
                                                   ? new_schedule_time.value().count()
-                                                  : evt.reschedule_time};
+                                                  : evt->reschedule_time};
 
                 // If this event was scheduled into a pause, its time now is going to be way
                 // behind. Re-set this event to continue from the end of the pause.
-                auto next_time{evt.time + next_schedule_time};
-                if (evt.time < pause_end_time) {
+                auto next_time{evt->time + next_schedule_time};
+                if (evt->time < pause_end_time) {
                     next_time = pause_end_time + next_schedule_time;
                 }
 
-                event_queue.update(evt.handle, Event{next_time, event_fifo_id++, evt.type,
-                                                     next_schedule_time, evt.handle});
+                evt->time = next_time;
+                evt->reschedule_time = next_schedule_time;
+                QueueEvent(evt, *event_type);
             }
+        } else {
+            evt->type_next = free_events;
+            free_events = evt;
         }
 
         global_timer = GetGlobalTimeNs().count();
     }
 
-    if (!event_queue.empty()) {
-        return event_queue.top().time;
-    } else {
-        return std::nullopt;
-    }
+    return event_queue.NextTime();
 }
 
 void CoreTiming::ThreadLoop() {
@@ -313,6 +319,54 @@ void CoreTiming::Reset() {
     has_started = false;
 }
 
+ScheduledEvent* CoreTiming::AllocateEvent() {
+    if (ScheduledEvent* const evt = free_events) {
+        free_events = evt->type_next;
+        evt->type_next = nullptr;
+        return evt;
+    }
+    return event_storage.emplace_back(std::make_unique<ScheduledEvent>()).get();
+}
+
+void CoreTiming::QueueEvent(ScheduledEvent* evt, EventType& event_type) {
+    evt->fifo_order = event_fifo_id++;
+    event_queue.Insert(evt);
+
+    evt->type_prev = nullptr;
+    evt->type_next = event_type.scheduled;
+    if (event_type.scheduled) {
+        event_type.scheduled->type_prev = evt;
+    }
+    event_type.scheduled = evt;
+}
+
+void CoreTiming::UnlinkFromType(ScheduledEvent* evt, EventType* event_type) {
+    if (evt->type_prev) {
+        evt->type_prev->type_next = evt->type_next;
+    } else if (event_type) {
+        event_type->scheduled = evt->type_next;
+    }
+    if (evt->type_next) {
+        evt->type_next->type_prev = evt->type_prev;
+    }
+    evt->type_prev = nullptr;
+    evt->type_next = nullptr;
+}
+
+void CoreTiming::ClearEvents() {
+    event_queue.Clear();
+    free_events = nullptr;
+    for (const std::unique_ptr<ScheduledEvent>& evt : event_storage) {
+        if (const auto event_type{evt->type.lock()}) {
+            event_type->scheduled = nullptr;
+        }
+        evt->type.reset();
+        evt->type_prev = nullptr;
+        evt->type_next = free_events;
+        free_events = evt.get();
+    }
+}
+
 std::chrono::nanoseconds CoreTiming::GetGlobalTimeNs() const {
     if (is_multicore) [[likely]] {
         return clock->GetTimeNS();
@@ -11,15 +11,17 @@
 #include <optional>
 #include <string>
 #include <thread>
-
-#include <boost/heap/fibonacci_heap.hpp>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/thread.h"
 #include "common/wall_clock.h"
+#include "core/timing_wheel.h"
 
 namespace Core::Timing {
 
+struct ScheduledEvent;
+
 /// A callback that may be scheduled for a particular core timing event.
 using TimedCallback = std::function<std::optional<std::chrono::nanoseconds>(
     s64 time, std::chrono::nanoseconds ns_late)>;
@@ -36,6 +38,8 @@ struct EventType {
     /// A monotonic sequence number, incremented when this event is
     /// changed externally.
     size_t sequence_number;
+    /// Pending instances of this event, guarded by the core timing lock
+    ScheduledEvent* scheduled{};
 };
 
 enum class UnscheduleEventType {
@@ -111,7 +115,9 @@ public:
 
     void AddTicks(u64 ticks_to_add);
 
-    void ResetTicks();
+    /// Starts a new slice of slice_scale default slices. Slices longer than the default end at
+    /// the next scheduled event, so it isn't run late.
+    void ResetTicks(u32 slice_scale = 1);
 
     void Idle();
 
@@ -119,11 +125,27 @@ public:
         return downcount;
     }
 
-    /// Returns the current CNTPCT tick value.
-    u64 GetClockTicks() const;
+    /// Returns the current CNTPCT tick value. Inline, since games poll it in tight loops.
+    u64 GetClockTicks() const {
+        if (is_multicore) [[likely]] {
+            if (cntpct_scale) [[likely]] {
+                return cntpct_scale->Scale(Common::ReadNativeTicks());
+            }
+            return clock->GetCNTPCT();
+        }
+        return Common::WallClock::CPUTickToCNTPCT(cpu_ticks);
+    }
 
     /// Returns the current GPU tick value.
-    u64 GetGPUTicks() const;
+    u64 GetGPUTicks() const {
+        if (is_multicore) [[likely]] {
+            if (gpu_tick_scale) [[likely]] {
+                return gpu_tick_scale->Scale(Common::ReadNativeTicks());
+            }
+            return clock->GetGPUTick();
+        }
+        return Common::WallClock::CPUTickToGPUTick(cpu_ticks);
+    }
 
     /// Returns current time in microseconds.
     std::chrono::microseconds GetGlobalTimeUs() const;
@@ -139,14 +161,27 @@ public:
 #endif
 
 private:
-    struct Event;
-
     static void ThreadEntry(CoreTiming& instance);
     void ThreadLoop();
 
     void Reset();
 
+    /// Returns an unused event from the free list, allocating a new one when it's empty
+    ScheduledEvent* AllocateEvent();
+
+    /// Adds an event to the queue and to the pending list of its type
+    void QueueEvent(ScheduledEvent* evt, EventType& event_type);
+
+    /// Removes an event from the pending list of its type, the type may have been destroyed
+    void UnlinkFromType(ScheduledEvent* evt, EventType* event_type);
+
+    /// Removes every pending event, when holding both locks
+    void ClearEvents();
+
     std::unique_ptr<Common::WallClock> clock;
+    /// Scales from the host timer to guest ticks, only set with native clocks
+    std::optional<Common::HostTickScale> cntpct_scale;
+    std::optional<Common::HostTickScale> gpu_tick_scale;
 
     s64 global_timer = 0;
 
@@ -154,12 +189,13 @@ private:
     s64 timer_resolution_ns;
 #endif
 
-    using heap_t =
-        boost::heap::fibonacci_heap<CoreTiming::Event, boost::heap::compare<std::greater<>>>;
-
-    heap_t event_queue;
+    TimingWheel event_queue;
     u64 event_fifo_id = 0;
 
+    /// Storage of the events in the queue, unused ones are kept in a free list
+    std::vector<std::unique_ptr<ScheduledEvent>> event_storage;
+    ScheduledEvent* free_events{};
+
     Common::Event event{};
     Common::Event pause_event{};
     mutable std::mutex basic_lock;
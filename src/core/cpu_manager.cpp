@@ -1,6 +1,11 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
+#ifdef ANDROID
+#include "common/android/performance_governor.h"
+#endif
 #include "common/fiber.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
@@ -154,8 +159,11 @@ void CpuManager::PreemptSingleCore(bool from_running_environment) {
         system.CoreTiming().Advance();
         kernel.SetIsPhantomModeForSingleCore(false);
     }
+    if (from_running_environment) {
+        UpdateSingleCoreSlice();
+    }
     current_core.store((current_core + 1) % Core::Hardware::NUM_CPU_CORES);
-    system.CoreTiming().ResetTicks();
+    system.CoreTiming().ResetTicks(slice_scale);
     kernel.Scheduler(current_core).PreemptSingleCore();
 
     // We've now been scheduled again, and we may have exchanged schedulers.
@@ -165,6 +173,20 @@ void CpuManager::PreemptSingleCore(bool from_running_environment) {
     }
 }
 
+void CpuManager::UpdateSingleCoreSlice() {
+    // Switching to cores with nothing to run is wasted time, so the core that just ran gets
+    // longer slices while it is the only one with work. Any other core having work, like a thread
+    // woken up from WaitSynchronization, brings back the default slice.
+    auto& kernel = system.Kernel();
+    for (std::size_t core = 0; core < Core::Hardware::NUM_CPU_CORES; ++core) {
+        if (core != current_core && kernel.Scheduler(core).HasWork()) {
+            slice_scale = 1;
+            return;
+        }
+    }
+    slice_scale = std::min(slice_scale * 2, max_slice_scale);
+}
+
 void CpuManager::GuestActivate() {
     // Similar to the HorizonKernelMain callback in HOS
     auto& kernel = system.Kernel();
@@ -197,9 +219,15 @@ void CpuManager::RunThread(std::stop_token token, std::size_t core) {
     Common::SetCurrentThreadPriority(Common::ThreadPriority::Critical);
     auto& data = core_data[core];
     data.host_context = Common::Fiber::ThreadToFiber();
+#ifdef ANDROID
+    Common::Android::GetPerformanceGovernor().RegisterThread();
+#endif
 
     // Cleanup
     SCOPE_EXIT {
+#ifdef ANDROID
+        Common::Android::GetPerformanceGovernor().UnregisterThread();
+#endif
         data.host_context->Exit();
         MicroProfileOnThreadExit();
     };
@@ -83,6 +83,7 @@ private:
 
     void GuestActivate();
     void HandleInterrupt();
+    void UpdateSingleCoreSlice();
     void ShutdownThread();
     void RunThread(std::stop_token stop_token, std::size_t core);
 
@@ -98,6 +99,9 @@ private:
     bool is_multicore{};
     std::atomic<std::size_t> current_core{};
     std::size_t idle_count{};
+    /// Default slices a core runs at once in single core mode, grown while the others are idle
+    u32 slice_scale{1};
+    static constexpr u32 max_slice_scale = 8;
     std::size_t num_cores{};
     static constexpr std::size_t max_cycle_runs = 5;
 
@@ -0,0 +1,387 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/assert.h"
+#include "common/swap.h"
+#include "core/crypto/aes_hw.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+#endif
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define AES_HW_TARGET __attribute__((target("aes,sse2")))
+#elif defined(ARCHITECTURE_arm64) && defined(__clang__)
+#define AES_HW_TARGET __attribute__((target("aes")))
+#elif defined(ARCHITECTURE_arm64) && defined(__GNUC__)
+#define AES_HW_TARGET __attribute__((target("+crypto")))
+#else
+#define AES_HW_TARGET
+#endif
+
+namespace Core::Crypto::AesHw {
+namespace {
+constexpr u8 GfMultiply(u8 lhs, u8 rhs) {
+    u8 result = 0;
+    while (rhs != 0) {
+        if ((rhs & 1) != 0) {
+            result ^= lhs;
+        }
+        lhs = static_cast<u8>((lhs << 1) ^ ((lhs & 0x80) != 0 ? 0x1B : 0));
+        rhs >>= 1;
+    }
+    return result;
+}
+
+constexpr u8 RotateLeft(u8 value, int shift) {
+    return static_cast<u8>((value << shift) | (value >> (8 - shift)));
+}
+
+/// Builds the S-box walking the multiplicative group with generator 3 and its inverse
+constexpr std::array<u8, 256> MakeSbox() {
+    std::array<u8, 256> sbox{};
+    u8 p = 1;
+    u8 q = 1;
+    do {
+        p = GfMultiply(p, 3);
+        q = static_cast<u8>(q ^ (q << 1));
+        q = static_cast<u8>(q ^ (q << 2));
+        q = static_cast<u8>(q ^ (q << 4));
+        q = static_cast<u8>(q ^ ((q & 0x80) != 0 ? 0x09 : 0));
+        sbox[p] = static_cast<u8>(q ^ RotateLeft(q, 1) ^ RotateLeft(q, 2) ^ RotateLeft(q, 3) ^
+                                  RotateLeft(q, 4) ^ 0x63);
+    } while (p != 1);
+    sbox[0] = 0x63;
+    return sbox;
+}
+
+constexpr std::array<u8, 256> Sbox = MakeSbox();
+static_assert(Sbox[0x00] == 0x63 && Sbox[0x01] == 0x7C && Sbox[0x53] == 0xED &&
+              Sbox[0xFF] == 0x16);
+
+std::array<u8, 16> InvMixColumns(const std::array<u8, 16>& state) {
+    std::array<u8, 16> out{};
+    for (size_t column = 0; column < 16; column += 4) {
+        const u8 a0 = state[column + 0];
+        const u8 a1 = state[column + 1];
+        const u8 a2 = state[column + 2];
+        const u8 a3 = state[column + 3];
+        out[column + 0] = GfMultiply(a0, 14) ^ GfMultiply(a1, 11) ^ GfMultiply(a2, 13) ^
+                          GfMultiply(a3, 9);
+        out[column + 1] = GfMultiply(a0, 9) ^ GfMultiply(a1, 14) ^ GfMultiply(a2, 11) ^
+                          GfMultiply(a3, 13);
+        out[column + 2] = GfMultiply(a0, 13) ^ GfMultiply(a1, 9) ^ GfMultiply(a2, 14) ^
+                          GfMultiply(a3, 11);
+        out[column + 3] = GfMultiply(a0, 11) ^ GfMultiply(a1, 13) ^ GfMultiply(a2, 9) ^
+                          GfMultiply(a3, 14);
+    }
+    return out;
+}
+
+/// Big endian 128-bit counter split in halves
+struct Counter {
+    u64 hi;
+    u64 lo;
+
+    static Counter Load(const std::array<u8, 16>& bytes) {
+        u64 hi;
+        u64 lo;
+        std::memcpy(&hi, bytes.data(), sizeof(hi));
+        std::memcpy(&lo, bytes.data() + 8, sizeof(lo));
+        return {Common::swap64(hi), Common::swap64(lo)};
+    }
+
+    void Store(u8* bytes) const {
+        const u64 be_hi = Common::swap64(hi);
+        const u64 be_lo = Common::swap64(lo);
+        std::memcpy(bytes, &be_hi, sizeof(be_hi));
+        std::memcpy(bytes + 8, &be_lo, sizeof(be_lo));
+    }
+
+    void Add(u64 value) {
+        const u64 old_lo = lo;
+        lo += value;
+        hi += lo < old_lo ? 1 : 0;
+    }
+};
+
+/// Little endian XTS tweak, multiplied by x in GF(2^128) after every block
+struct Tweak {
+    u64 lo;
+    u64 hi;
+
+    void Store(u8* bytes) const {
+        std::memcpy(bytes, &lo, sizeof(lo));
+        std::memcpy(bytes + 8, &hi, sizeof(hi));
+    }
+
+    void MultiplyByX() {
+        const u64 carry = hi >> 63;
+        hi = (hi << 1) | (lo >> 63);
+        lo = (lo << 1) ^ (carry * 0x87);
+    }
+};
+
+/// Blocks processed together, enough to hide the latency of the AES instructions
+constexpr size_t Lanes = 8;
+
+#if defined(ARCHITECTURE_x86_64)
+using Vec = __m128i;
+
+AES_HW_TARGET inline Vec Load(const u8* data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+AES_HW_TARGET inline void Store(u8* data, Vec value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), value);
+}
+
+AES_HW_TARGET inline Vec Xor(Vec lhs, Vec rhs) {
+    return _mm_xor_si128(lhs, rhs);
+}
+
+template <size_t N>
+AES_HW_TARGET inline void EncryptBlocks(Vec (&blocks)[N], const Vec (&keys)[11]) {
+    for (size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_xor_si128(blocks[i], keys[0]);
+    }
+    for (size_t round = 1; round < 10; ++round) {
+        for (size_t i = 0; i < N; ++i) {
+            blocks[i] = _mm_aesenc_si128(blocks[i], keys[round]);
+        }
+    }
+    for (size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_aesenclast_si128(blocks[i], keys[10]);
+    }
+}
+
+template <size_t N>
+AES_HW_TARGET inline void DecryptBlocks(Vec (&blocks)[N], const Vec (&keys)[11]) {
+    for (size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_xor_si128(blocks[i], keys[0]);
+    }
+    for (size_t round = 1; round < 10; ++round) {
+        for (size_t i = 0; i < N; ++i) {
+            blocks[i] = _mm_aesdec_si128(blocks[i], keys[round]);
+        }
+    }
+    for (size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_aesdeclast_si128(blocks[i], keys[10]);
+    }
+}
+#elif defined(ARCHITECTURE_arm64)
+using Vec = uint8x16_t;
+
+AES_HW_TARGET inline Vec Load(const u8* data) {
+    return vld1q_u8(data);
+}
+
+AES_HW_TARGET inline void Store(u8* data, Vec value) {
+    vst1q_u8(data, value);
+}
+
+AES_HW_TARGET inline Vec Xor(Vec lhs, Vec rhs) {
+    return veorq_u8(lhs, rhs);
+}
+
+// AESE and AESD add the round key before substituting, so the last key is added on its own
+template <size_t N>
+AES_HW_TARGET inline void EncryptBlocks(Vec (&blocks)[N], const Vec (&keys)[11]) {
+    for (size_t round = 0; round < 9; ++round) {
+        for (size_t i = 0; i < N; ++i) {
+            blocks[i] = vaesmcq_u8(vaeseq_u8(blocks[i], keys[round]));
+        }
+    }
+    for (size_t i = 0; i < N; ++i) {
+        blocks[i] = veorq_u8(vaeseq_u8(blocks[i], keys[9]), keys[10]);
+    }
+}
+
+template <size_t N>
+AES_HW_TARGET inline void DecryptBlocks(Vec (&blocks)[N], const Vec (&keys)[11]) {
+    for (size_t round = 0; round < 9; ++round) {
+        for (size_t i = 0; i < N; ++i) {
+            blocks[i] = vaesimcq_u8(vaesdq_u8(blocks[i], keys[round]));
+        }
+    }
+    for (size_t i = 0; i < N; ++i) {
+        blocks[i] = veorq_u8(vaesdq_u8(blocks[i], keys[9]), keys[10]);
+    }
+}
+#endif
+
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+AES_HW_TARGET inline void LoadKeys(Vec (&out)[11],
+                                   const std::array<std::array<u8, 16>, 11>& keys) {
+    for (size_t round = 0; round < 11; ++round) {
+        out[round] = Load(keys[round].data());
+    }
+}
+
+AES_HW_TARGET void CtrTranscodeImpl(const KeySchedule& schedule, Counter counter, const u8* src,
+                                    u8* dest, size_t size) {
+    Vec keys[11];
+    LoadKeys(keys, schedule.encrypt);
+
+    alignas(16) u8 block_bytes[16 * Lanes];
+    for (; size >= 16 * Lanes; src += 16 * Lanes, dest += 16 * Lanes, size -= 16 * Lanes) {
+        Vec blocks[Lanes];
+        for (size_t i = 0; i < Lanes; ++i) {
+            counter.Store(block_bytes + i * 16);
+            counter.Add(1);
+            blocks[i] = Load(block_bytes + i * 16);
+        }
+        EncryptBlocks(blocks, keys);
+        for (size_t i = 0; i < Lanes; ++i) {
+            Store(dest + i * 16, Xor(Load(src + i * 16), blocks[i]));
+        }
+    }
+    for (; size > 0; src += 16, dest += 16, size -= std::min<size_t>(size, 16)) {
+        Vec blocks[1];
+        counter.Store(block_bytes);
+        counter.Add(1);
+        blocks[0] = Load(block_bytes);
+        EncryptBlocks(blocks, keys);
+        if (size >= 16) {
+            Store(dest, Xor(Load(src), blocks[0]));
+            continue;
+        }
+        Store(block_bytes, blocks[0]);
+        for (size_t i = 0; i < size; ++i) {
+            dest[i] = src[i] ^ block_bytes[i];
+        }
+    }
+}
+
+template <size_t N>
+AES_HW_TARGET inline void XtsBlocks(Tweak& tweak, const Vec (&keys)[11], const u8* src, u8* dest,
+                                    bool decrypt) {
+    alignas(16) u8 tweak_bytes[16 * N];
+    Vec tweaks[N];
+    Vec blocks[N];
+    for (size_t i = 0; i < N; ++i) {
+        tweak.Store(tweak_bytes + i * 16);
+        tweak.MultiplyByX();
+        tweaks[i] = Load(tweak_bytes + i * 16);
+        blocks[i] = Xor(Load(src + i * 16), tweaks[i]);
+    }
+    if (decrypt) {
+        DecryptBlocks(blocks, keys);
+    } else {
+        EncryptBlocks(blocks, keys);
+    }
+    for (size_t i = 0; i < N; ++i) {
+        Store(dest + i * 16, Xor(blocks[i], tweaks[i]));
+    }
+}
+
+AES_HW_TARGET void XtsTranscodeImpl(const KeySchedule& data_key, const KeySchedule& tweak_key,
+                                    const std::array<u8, 16>& initial_tweak, const u8* src,
+                                    u8* dest, size_t size, bool decrypt) {
+    Vec keys[11];
+    LoadKeys(keys, tweak_key.encrypt);
+    Vec encrypted_tweak[1]{Load(initial_tweak.data())};
+    EncryptBlocks(encrypted_tweak, keys);
+
+    alignas(16) u8 tweak_bytes[16];
+    Store(tweak_bytes, encrypted_tweak[0]);
+    Tweak tweak;
+    std::memcpy(&tweak.lo, tweak_bytes, sizeof(tweak.lo));
+    std::memcpy(&tweak.hi, tweak_bytes + 8, sizeof(tweak.hi));
+
+    LoadKeys(keys, decrypt ? data_key.decrypt : data_key.encrypt);
+    for (; size >= 16 * Lanes; src += 16 * Lanes, dest += 16 * Lanes, size -= 16 * Lanes) {
+        XtsBlocks<Lanes>(tweak, keys, src, dest, decrypt);
+    }
+    for (; size >= 16; src += 16, dest += 16, size -= 16) {
+        XtsBlocks<1>(tweak, keys, src, dest, decrypt);
+    }
+}
+#endif
+} // Anonymous namespace
+
+bool IsSupported() {
+#if defined(ARCHITECTURE_x86_64)
+    static const bool is_supported = Common::GetCPUCaps().aes && Common::GetCPUCaps().sse2;
+    return is_supported;
+#elif defined(ARCHITECTURE_arm64) && defined(__APPLE__)
+    // Every Apple ARM CPU has the cryptographic extension
+    return true;
+#elif defined(ARCHITECTURE_arm64) && defined(__linux__)
+    static const bool is_supported = (getauxval(AT_HWCAP) & HWCAP_AES) != 0;
+    return is_supported;
+#elif defined(ARCHITECTURE_arm64) && defined(_WIN32)
+    static const bool is_supported =
+        IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE) != 0;
+    return is_supported;
+#else
+    return false;
+#endif
+}
+
+void ExpandKey(KeySchedule& schedule, const u8* key) {
+    std::array<u8, 16 * 11> words{};
+    std::memcpy(words.data(), key, 16);
+    u8 round_constant = 1;
+    for (size_t i = 16; i < words.size(); i += 4) {
+        std::array<u8, 4> temp{words[i - 4], words[i - 3], words[i - 2], words[i - 1]};
+        if (i % 16 == 0) {
+            temp = {static_cast<u8>(Sbox[temp[1]] ^ round_constant), Sbox[temp[2]],
+                    Sbox[temp[3]], Sbox[temp[0]]};
+            round_constant = GfMultiply(round_constant, 2);
+        }
+        for (size_t j = 0; j < 4; ++j) {
+            words[i + j] = words[i + j - 16] ^ temp[j];
+        }
+    }
+    for (size_t round = 0; round < 11; ++round) {
+        std::memcpy(schedule.encrypt[round].data(), words.data() + round * 16, 16);
+    }
+    schedule.decrypt[0] = schedule.encrypt[10];
+    for (size_t round = 1; round < 10; ++round) {
+        schedule.decrypt[round] = InvMixColumns(schedule.encrypt[10 - round]);
+    }
+    schedule.decrypt[10] = schedule.encrypt[0];
+}
+
+void CtrTranscode(const KeySchedule& schedule, const std::array<u8, 16>& counter, const u8* src,
+                  u8* dest, std::size_t size) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    CtrTranscodeImpl(schedule, Counter::Load(counter), src, dest, size);
+#else
+    UNREACHABLE_MSG("AES instructions are not supported on this architecture");
+#endif
+}
+
+void XtsTranscode(const KeySchedule& data_key, const KeySchedule& tweak_key,
+                  const std::array<u8, 16>& tweak, const u8* src, u8* dest, std::size_t size,
+                  bool decrypt) {
+    ASSERT(size % 16 == 0);
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    XtsTranscodeImpl(data_key, tweak_key, tweak, src, dest, size, decrypt);
+#else
+    UNREACHABLE_MSG("AES instructions are not supported on this architecture");
+#endif
+}
+
+std::array<u8, 16> AddToCounter(const std::array<u8, 16>& counter, u64 blocks) {
+    Counter value = Counter::Load(counter);
+    value.Add(blocks);
+    std::array<u8, 16> out;
+    value.Store(out.data());
+    return out;
+}
+
+} // namespace Core::Crypto::AesHw
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Core::Crypto::AesHw {
+
+/// Round keys of AES-128, for the encryption and the equivalent inverse cipher
+struct KeySchedule {
+    alignas(16) std::array<std::array<u8, 16>, 11> encrypt;
+    alignas(16) std::array<std::array<u8, 16>, 11> decrypt;
+};
+
+/// Returns true when the host CPU has AES instructions usable by this module
+[[nodiscard]] bool IsSupported();
+
+/// Expands an AES-128 key
+void ExpandKey(KeySchedule& schedule, const u8* key);
+
+/**
+ * Encrypts or decrypts in CTR mode, the counter is a 128-bit big endian integer.
+ * A trailing partial block uses the start of its key stream.
+ *
+ * @param schedule Key
+ * @param counter Counter of the first block
+ * @param src Source data
+ * @param dest Destination, may be the same as src
+ * @param size Size in bytes
+ */
+void CtrTranscode(const KeySchedule& schedule, const std::array<u8, 16>& counter, const u8* src,
+                  u8* dest, std::size_t size);
+
+/**
+ * Encrypts or decrypts a single XTS data unit, without ciphertext stealing.
+ *
+ * @param data_key Key of the data
+ * @param tweak_key Key of the tweak
+ * @param tweak Tweak of the data unit before it's encrypted
+ * @param src Source data
+ * @param dest Destination, may be the same as src
+ * @param size Size in bytes, a multiple of 16
+ * @param decrypt True to decrypt, false to encrypt
+ */
+void XtsTranscode(const KeySchedule& data_key, const KeySchedule& tweak_key,
+                  const std::array<u8, 16>& tweak, const u8* src, u8* dest, std::size_t size,
+                  bool decrypt);
+
+/// Returns a counter advanced by a number of blocks
+[[nodiscard]] std::array<u8, 16> AddToCounter(const std::array<u8, 16>& counter, u64 blocks);
+
+} // namespace Core::Crypto::AesHw
@@ -1,17 +1,36 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <mbedtls/cipher.h>
 #include "common/assert.h"
+#include "common/div_ceil.h"
+#include "common/literals.h"
 #include "common/logging/log.h"
+#include "common/task_pool.h"
+#include "common/thread_worker.h"
+#include "core/crypto/aes_hw.h"
 #include "core/crypto/aes_util.h"
 #include "core/crypto/key_manager.h"
 
 namespace Core::Crypto {
 namespace {
+using namespace Common::Literals;
 using NintendoTweak = std::array<u8, 16>;
 
+/// Transcodes at least this large are split across the worker threads
+constexpr std::size_t ParallelThreshold = 256_KiB;
+
+/// Bytes transcoded by a single task when a transcode is split
+constexpr std::size_t TaskSize = 64_KiB;
+
+Common::TaskGroup& GetWorkers() {
+    static Common::TaskGroup workers{Common::TaskPriority::Normal};
+    return workers;
+}
+
 NintendoTweak CalculateNintendoTweak(std::size_t sector_id) {
     NintendoTweak out{};
     for (std::size_t i = 0xF; i <= 0xF; --i) {
@@ -36,6 +55,13 @@ static_assert(static_cast<std::size_t>(Mode::XTS) ==
 struct CipherContext {
     mbedtls_cipher_context_t encryption_context;
     mbedtls_cipher_context_t decryption_context;
+
+    // AES-128 CTR and XTS go through the AES instructions of the host when it has them
+    bool use_hw{};
+    Mode mode{};
+    AesHw::KeySchedule schedule{};
+    AesHw::KeySchedule tweak_schedule{};
+    std::array<u8, 16> iv{};
 };
 
 template <typename Key, std::size_t KeySize>
@@ -57,6 +83,18 @@ Crypto::AESCipher<Key, KeySize>::AESCipher(Key key, Mode mode)
     ASSERT(
         !mbedtls_cipher_setkey(&ctx->decryption_context, key.data(), KeySize * 8, MBEDTLS_DECRYPT));
     //"Failed to set key on mbedtls ciphers.");
+
+    ctx->mode = mode;
+    if (AesHw::IsSupported()) {
+        if (mode == Mode::CTR && KeySize == 0x10) {
+            AesHw::ExpandKey(ctx->schedule, key.data());
+            ctx->use_hw = true;
+        } else if (mode == Mode::XTS && KeySize == 0x20) {
+            AesHw::ExpandKey(ctx->schedule, key.data());
+            AesHw::ExpandKey(ctx->tweak_schedule, key.data() + 0x10);
+            ctx->use_hw = true;
+        }
+    }
 }
 
 template <typename Key, std::size_t KeySize>
@@ -67,6 +105,29 @@ AESCipher<Key, KeySize>::~AESCipher() {
 
 template <typename Key, std::size_t KeySize>
 void AESCipher<Key, KeySize>::Transcode(const u8* src, std::size_t size, u8* dest, Op op) const {
+    if (ctx->use_hw && ctx->mode == Mode::CTR) {
+        const std::array<u8, 16> counter = ctx->iv;
+        if (size < ParallelThreshold) {
+            AesHw::CtrTranscode(ctx->schedule, counter, src, dest, size);
+        } else {
+            Common::ParallelForEach(
+                GetWorkers(), Common::DivCeil(size, TaskSize), [&](std::size_t task) {
+                    const std::size_t offset = task * TaskSize;
+                    AesHw::CtrTranscode(ctx->schedule, AesHw::AddToCounter(counter, offset / 16),
+                                        src + offset, dest + offset,
+                                        std::min(TaskSize, size - offset));
+                });
+        }
+        // Like mbedtls, the counter carries on from the last block, partial or not
+        ctx->iv = AesHw::AddToCounter(counter, Common::DivCeil(size, std::size_t{16}));
+        return;
+    }
+    if (ctx->use_hw && ctx->mode == Mode::XTS && size % 16 == 0) {
+        AesHw::XtsTranscode(ctx->schedule, ctx->tweak_schedule, ctx->iv, src, dest, size,
+                            op == Op::Decrypt);
+        return;
+    }
+
     auto* const context = op == Op::Encrypt ? &ctx->encryption_context : &ctx->decryption_context;
 
     mbedtls_cipher_reset(context);
@@ -111,6 +172,31 @@ void AESCipher<Key, KeySize>::XTSTranscode(const u8* src, std::size_t size, u8*
                                            std::size_t sector_id, std::size_t sector_size, Op op) {
     ASSERT_MSG(size % sector_size == 0, "XTS decryption size must be a multiple of sector size.");
 
+    if (ctx->use_hw && sector_size % 16 == 0) {
+        const std::size_t num_sectors = size / sector_size;
+        const auto transcode_sectors = [&](std::size_t first, std::size_t count) {
+            for (std::size_t sector = first; sector < std::min(first + count, num_sectors);
+                 ++sector) {
+                const std::size_t offset = sector * sector_size;
+                AesHw::XtsTranscode(ctx->schedule, ctx->tweak_schedule,
+                                    CalculateNintendoTweak(sector_id + sector), src + offset,
+                                    dest + offset, sector_size, op == Op::Decrypt);
+            }
+        };
+        if (size < ParallelThreshold) {
+            transcode_sectors(0, num_sectors);
+        } else {
+            const std::size_t sectors_per_task = std::max<std::size_t>(TaskSize / sector_size, 1);
+            Common::ParallelForEach(GetWorkers(), Common::DivCeil(num_sectors, sectors_per_task),
+                                    [&](std::size_t task) {
+                                        transcode_sectors(task * sectors_per_task,
+                                                          sectors_per_task);
+                                    });
+        }
+        ctx->iv = CalculateNintendoTweak(sector_id + num_sectors - 1);
+        return;
+    }
+
     for (std::size_t i = 0; i < size; i += sector_size) {
         SetIV(CalculateNintendoTweak(sector_id++));
         Transcode(src + i, sector_size, dest + i, op);
@@ -119,6 +205,8 @@ void AESCipher<Key, KeySize>::XTSTranscode(const u8* src, std::size_t size, u8*
 
 template <typename Key, std::size_t KeySize>
 void AESCipher<Key, KeySize>::SetIV(std::span<const u8> data) {
+    ctx->iv = {};
+    std::memcpy(ctx->iv.data(), data.data(), std::min(data.size(), ctx->iv.size()));
     ASSERT_MSG((mbedtls_cipher_set_iv(&ctx->encryption_context, data.data(), data.size()) ||
                 mbedtls_cipher_set_iv(&ctx->decryption_context, data.data(), data.size())) == 0,
                "Failed to set IV on mbedtls ciphers.");
@@ -5,6 +5,7 @@
 #include <array>
 #include <bitset>
 #include <cctype>
+#include <cstring>
 #include <fstream>
 #include <locale>
 #include <map>
@@ -675,25 +676,32 @@ void KeyManager::LoadFromFile(const std::filesystem::path& file_path, bool is_ti
         return;
     }
 
-    std::ifstream file;
-    Common::FS::OpenFileStream(file, file_path, std::ios_base::in);
-
-    if (!file.is_open()) {
-        return;
+    // Title key files hold thousands of lines, reading them at once and splitting views avoids
+    // building a string stream for every line
+    const std::string contents =
+        Common::FS::ReadStringFromFile(file_path, Common::FS::FileType::TextFile);
+    if (is_title_keys) {
+        s128_keys.reserve(s128_keys.size() +
+                          static_cast<size_t>(std::ranges::count(contents, '\n')) + 1);
     }
 
-    std::string line;
-    while (std::getline(file, line)) {
-        std::vector<std::string> out;
-        std::stringstream stream(line);
-        std::string item;
-        while (std::getline(stream, item, '=')) {
-            out.push_back(std::move(item));
+    std::string_view remaining{contents};
+    while (!remaining.empty()) {
+        const size_t line_end = remaining.find('\n');
+        std::string_view line = remaining.substr(0, line_end);
+        remaining.remove_prefix(line_end == std::string_view::npos ? remaining.size()
+                                                                   : line_end + 1);
+        if (line.ends_with('\r')) {
+            line.remove_suffix(1);
         }
 
-        if (out.size() != 2) {
+        const size_t separator = line.find('=');
+        if (separator == std::string_view::npos || separator + 1 == line.size() ||
+            line.find('=', separator + 1) != std::string_view::npos) {
             continue;
         }
+        std::array<std::string, 2> out{std::string(line.substr(0, separator)),
+                                       std::string(line.substr(separator + 1))};
 
         out[0].erase(std::remove(out[0].begin(), out[0].end(), ' '), out[0].end());
         out[1].erase(std::remove(out[1].begin(), out[1].end(), ' '), out[1].end());
@@ -816,17 +824,19 @@ bool KeyManager::HasKey(S256KeyType id, u64 field1, u64 field2) const {
 }
 
 Key128 KeyManager::GetKey(S128KeyType id, u64 field1, u64 field2) const {
-    if (!HasKey(id, field1, field2)) {
+    const auto it = s128_keys.find({id, field1, field2});
+    if (it == s128_keys.end()) {
         return {};
     }
-    return s128_keys.at({id, field1, field2});
+    return it->second;
 }
 
 Key256 KeyManager::GetKey(S256KeyType id, u64 field1, u64 field2) const {
-    if (!HasKey(id, field1, field2)) {
+    const auto it = s256_keys.find({id, field1, field2});
+    if (it == s256_keys.end()) {
         return {};
     }
-    return s256_keys.at({id, field1, field2});
+    return it->second;
 }
 
 Key256 KeyManager::GetBISKey(u8 partition_id) const {
@@ -1356,10 +1366,16 @@ bool KeyManager::AddTicket(const Ticket& ticket) {
     const auto& rid = ticket.GetData().rights_id;
     u128 rights_id;
     std::memcpy(rights_id.data(), rid.data(), rid.size());
-    if (ticket.GetData().type == Core::Crypto::TitleKeyType::Common) {
-        common_tickets[rights_id] = ticket;
-    } else {
-        personal_tickets[rights_id] = ticket;
+    auto& tickets = ticket.GetData().type == Core::Crypto::TitleKeyType::Common
+                        ? common_tickets
+                        : personal_tickets;
+
+    // Containers add their tickets every time they're opened, leave a known ticket alone so
+    // opening an already seen container only reads from the key manager.
+    const auto it = tickets.find(rights_id);
+    if (it == tickets.end() ||
+        std::memcmp(&it->second.GetData(), &ticket.GetData(), sizeof(TicketData)) != 0) {
+        tickets.insert_or_assign(rights_id, ticket);
     }
 
     if (HasKey(S128KeyType::Titlekey, rights_id[1], rights_id[0])) {
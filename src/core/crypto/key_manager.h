@@ -9,6 +9,7 @@
 #include <optional>
 #include <span>
 #include <string>
+#include <unordered_map>
 
 #include <variant>
 #include <fmt/format.h>
@@ -249,6 +250,22 @@ bool operator<(const KeyIndex<KeyType>& lhs, const KeyIndex<KeyType>& rhs) {
     return std::tie(lhs.type, lhs.field1, lhs.field2) < std::tie(rhs.type, rhs.field1, rhs.field2);
 }
 
+template <typename KeyType>
+bool operator==(const KeyIndex<KeyType>& lhs, const KeyIndex<KeyType>& rhs) {
+    return std::tie(lhs.type, lhs.field1, lhs.field2) == std::tie(rhs.type, rhs.field1, rhs.field2);
+}
+
+struct KeyIndexHash {
+    template <typename KeyType>
+    size_t operator()(const KeyIndex<KeyType>& index) const noexcept {
+        // Title keys are indexed by rights IDs, both halves are needed to tell them apart
+        u64 hash = static_cast<u64>(index.type) * 0x9E3779B97F4A7C15ULL;
+        hash = (hash ^ index.field1) * 0xBF58476D1CE4E5B9ULL;
+        hash = (hash ^ index.field2) * 0x94D049BB133111EBULL;
+        return static_cast<size_t>(hash ^ (hash >> 31));
+    }
+};
+
 class KeyManager {
 public:
     static KeyManager& Instance() {
@@ -298,8 +315,9 @@ public:
 private:
     KeyManager();
 
-    std::map<KeyIndex<S128KeyType>, Key128> s128_keys;
-    std::map<KeyIndex<S256KeyType>, Key256> s256_keys;
+    // Every NCA opened queries these, title keys make up most of the entries
+    std::unordered_map<KeyIndex<S128KeyType>, Key128, KeyIndexHash> s128_keys;
+    std::unordered_map<KeyIndex<S256KeyType>, Key256, KeyIndexHash> s256_keys;
 
     // Map from rights ID to ticket
     std::map<u128, Ticket> common_tickets;
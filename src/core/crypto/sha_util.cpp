@@ -1,4 +1,275 @@
-// SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-namespace Crypto {} // namespace Crypto
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "core/crypto/sha_util.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+#endif
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define SHA_HW_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+#elif defined(ARCHITECTURE_arm64) && defined(__clang__)
+#define SHA_HW_TARGET __attribute__((target("sha2")))
+#elif defined(ARCHITECTURE_arm64) && defined(__GNUC__)
+#define SHA_HW_TARGET __attribute__((target("+crypto")))
+#else
+#define SHA_HW_TARGET
+#endif
+
+namespace Core::Crypto {
+namespace {
+constexpr size_t BlockSize = 64;
+
+constexpr std::array<u32, 8> InitialState{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+alignas(16) constexpr std::array<u32, 64> RoundConstants{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+u32 LoadBigEndian(const u8* data) {
+    return (u32{data[0]} << 24) | (u32{data[1]} << 16) | (u32{data[2]} << 8) | u32{data[3]};
+}
+
+void CompressSoftware(std::array<u32, 8>& state, const u8* data, size_t num_blocks) {
+    for (; num_blocks > 0; --num_blocks, data += BlockSize) {
+        std::array<u32, 64> w;
+        for (size_t i = 0; i < 16; ++i) {
+            w[i] = LoadBigEndian(data + i * 4);
+        }
+        for (size_t i = 16; i < 64; ++i) {
+            const u32 s0 =
+                std::rotr(w[i - 15], 7) ^ std::rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            const u32 s1 = std::rotr(w[i - 2], 17) ^ std::rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        u32 a = state[0], b = state[1], c = state[2], d = state[3];
+        u32 e = state[4], f = state[5], g = state[6], h = state[7];
+        for (size_t i = 0; i < 64; ++i) {
+            const u32 s1 = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+            const u32 choice = (e & f) ^ (~e & g);
+            const u32 temp1 = h + s1 + choice + RoundConstants[i] + w[i];
+            const u32 s0 = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+            const u32 majority = (a & b) ^ (a & c) ^ (b & c);
+            const u32 temp2 = s0 + majority;
+            h = g;
+            g = f;
+            f = e;
+            e = d + temp1;
+            d = c;
+            c = b;
+            b = a;
+            a = temp1 + temp2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+#if defined(ARCHITECTURE_x86_64)
+SHA_HW_TARGET void CompressHardware(std::array<u32, 8>& state, const u8* data,
+                                    size_t num_blocks) {
+    const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // The SHA extensions work on the state split as ABEF and CDGH
+    const __m128i dcba = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i*>(&state[0])),
+                                           0xb1);
+    const __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i*>(&state[4])),
+                                           0x1b);
+    __m128i abef = _mm_alignr_epi8(dcba, efgh, 8);
+    __m128i cdgh = _mm_blend_epi16(efgh, dcba, 0xf0);
+
+    for (; num_blocks > 0; --num_blocks, data += BlockSize) {
+        const __m128i abef_saved = abef;
+        const __m128i cdgh_saved = cdgh;
+
+        // Four rounds at a time, message words i - 4 to i - 1 stay in registers
+        __m128i msg[4];
+        for (size_t i = 0; i < 16; ++i) {
+            __m128i& words = msg[i % 4];
+            if (i < 4) {
+                words = _mm_shuffle_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)), byte_swap);
+            } else {
+                const __m128i& previous = msg[(i + 3) % 4];
+                words = _mm_add_epi32(_mm_sha256msg1_epu32(words, msg[(i + 1) % 4]),
+                                      _mm_alignr_epi8(previous, msg[(i + 2) % 4], 4));
+                words = _mm_sha256msg2_epu32(words, previous);
+            }
+            const __m128i round_input = _mm_add_epi32(
+                words, _mm_load_si128(reinterpret_cast<const __m128i*>(&RoundConstants[i * 4])));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, round_input);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(round_input, 0x0e));
+        }
+        abef = _mm_add_epi32(abef, abef_saved);
+        cdgh = _mm_add_epi32(cdgh, cdgh_saved);
+    }
+
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1b);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), _mm_alignr_epi8(dchg, feba, 8));
+}
+#elif defined(ARCHITECTURE_arm64)
+SHA_HW_TARGET void CompressHardware(std::array<u32, 8>& state, const u8* data,
+                                    size_t num_blocks) {
+    uint32x4_t abcd = vld1q_u32(&state[0]);
+    uint32x4_t efgh = vld1q_u32(&state[4]);
+
+    for (; num_blocks > 0; --num_blocks, data += BlockSize) {
+        const uint32x4_t abcd_saved = abcd;
+        const uint32x4_t efgh_saved = efgh;
+
+        // Four rounds at a time, message words i - 4 to i - 1 stay in registers
+        std::array<uint32x4_t, 4> msg;
+        for (size_t i = 0; i < 16; ++i) {
+            uint32x4_t& words = msg[i % 4];
+            if (i < 4) {
+                words = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + i * 16)));
+            } else {
+                words = vsha256su1q_u32(vsha256su0q_u32(words, msg[(i + 1) % 4]),
+                                        msg[(i + 2) % 4], msg[(i + 3) % 4]);
+            }
+            const uint32x4_t round_input = vaddq_u32(words, vld1q_u32(&RoundConstants[i * 4]));
+            const uint32x4_t abcd_previous = abcd;
+            abcd = vsha256hq_u32(abcd, efgh, round_input);
+            efgh = vsha256h2q_u32(efgh, abcd_previous, round_input);
+        }
+        abcd = vaddq_u32(abcd, abcd_saved);
+        efgh = vaddq_u32(efgh, efgh_saved);
+    }
+
+    vst1q_u32(&state[0], abcd);
+    vst1q_u32(&state[4], efgh);
+}
+#endif
+
+void Compress(std::array<u32, 8>& state, const u8* data, size_t num_blocks) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    if (IsSha256HardwareSupported()) {
+        CompressHardware(state, data, num_blocks);
+        return;
+    }
+#endif
+    CompressSoftware(state, data, num_blocks);
+}
+} // Anonymous namespace
+
+Sha256::Sha256() {
+    Reset();
+}
+
+void Sha256::Reset() {
+    state = InitialState;
+    buffer_size = 0;
+    total_size = 0;
+}
+
+void Sha256::Update(std::span<const u8> data) {
+    total_size += data.size();
+
+    if (buffer_size != 0) {
+        const size_t copy_size = std::min(data.size(), BlockSize - buffer_size);
+        std::memcpy(buffer.data() + buffer_size, data.data(), copy_size);
+        buffer_size += copy_size;
+        data = data.subspan(copy_size);
+        if (buffer_size < BlockSize) {
+            return;
+        }
+        Compress(state, buffer.data(), 1);
+        buffer_size = 0;
+    }
+
+    const size_t num_blocks = data.size() / BlockSize;
+    if (num_blocks != 0) {
+        Compress(state, data.data(), num_blocks);
+        data = data.subspan(num_blocks * BlockSize);
+    }
+
+    std::memcpy(buffer.data(), data.data(), data.size());
+    buffer_size = data.size();
+}
+
+SHA256Hash Sha256::Finish() {
+    const u64 total_bits = total_size * 8;
+
+    // Pad with a one bit and zeros up to the bit length at the end of a block
+    buffer[buffer_size++] = 0x80;
+    if (buffer_size > BlockSize - sizeof(total_bits)) {
+        std::fill(buffer.begin() + buffer_size, buffer.end(), u8{0});
+        Compress(state, buffer.data(), 1);
+        buffer_size = 0;
+    }
+    std::fill(buffer.begin() + buffer_size, buffer.end() - sizeof(total_bits), u8{0});
+    for (size_t i = 0; i < sizeof(total_bits); ++i) {
+        buffer[BlockSize - 1 - i] = static_cast<u8>(total_bits >> (i * 8));
+    }
+    Compress(state, buffer.data(), 1);
+    buffer_size = 0;
+
+    SHA256Hash hash;
+    for (size_t i = 0; i < state.size(); ++i) {
+        hash[i * 4 + 0] = static_cast<u8>(state[i] >> 24);
+        hash[i * 4 + 1] = static_cast<u8>(state[i] >> 16);
+        hash[i * 4 + 2] = static_cast<u8>(state[i] >> 8);
+        hash[i * 4 + 3] = static_cast<u8>(state[i]);
+    }
+    return hash;
+}
+
+SHA256Hash CalculateSha256(std::span<const u8> data) {
+    Sha256 sha;
+    sha.Update(data);
+    return sha.Finish();
+}
+
+bool IsSha256HardwareSupported() {
+#if defined(ARCHITECTURE_x86_64)
+    static const bool is_supported = Common::GetCPUCaps().sha && Common::GetCPUCaps().sse4_1 &&
+                                     Common::GetCPUCaps().ssse3;
+    return is_supported;
+#elif defined(ARCHITECTURE_arm64) && defined(__APPLE__)
+    // Every Apple ARM CPU has the cryptographic extension
+    return true;
+#elif defined(ARCHITECTURE_arm64) && defined(__linux__)
+    static const bool is_supported = (getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+    return is_supported;
+#elif defined(ARCHITECTURE_arm64) && defined(_WIN32)
+    static const bool is_supported =
+        IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE) != 0;
+    return is_supported;
+#else
+    return false;
+#endif
+}
+
+} // namespace Core::Crypto
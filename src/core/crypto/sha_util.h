@@ -1,19 +1,44 @@
-// SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
-#include "common/assert.h"
-#include "core/file_sys/vfs.h"
-#include "key_manager.h"
-#include "mbedtls/cipher.h"
+#include <array>
+#include <span>
 
-namespace Crypto {
-typedef std::array<u8, 0x20> SHA256Hash;
+#include "common/common_types.h"
+#include "core/crypto/key_manager.h"
 
-inline SHA256Hash operator"" _HASH(const char* data, size_t len) {
-    if (len != 0x40)
-        return {};
-}
+namespace Core::Crypto {
 
-} // namespace Crypto
+/**
+ * Streaming SHA-256, using the SHA extensions of x86-64 and ARMv8 when the host has them.
+ * Fills the same role as mbedtls_sha256 for hashing that's large enough to matter.
+ */
+class Sha256 {
+public:
+    explicit Sha256();
+
+    /// Hashes more data
+    void Update(std::span<const u8> data);
+
+    /// Returns the hash of all the data given to Update, the object must be reset to reuse it
+    [[nodiscard]] SHA256Hash Finish();
+
+    /// Starts a new hash
+    void Reset();
+
+private:
+    std::array<u32, 8> state;
+    std::array<u8, 64> buffer;
+    size_t buffer_size;
+    u64 total_size;
+};
+
+/// Returns the SHA-256 hash of data
+[[nodiscard]] SHA256Hash CalculateSha256(std::span<const u8> data);
+
+/// Returns true when hashing uses the SHA instructions of the host CPU
+[[nodiscard]] bool IsSha256HardwareSupported();
+
+} // namespace Core::Crypto
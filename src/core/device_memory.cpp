@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/settings.h"
 #include "core/device_memory.h"
 #include "hle/kernel/board/nintendo/nx/k_system_control.h"
 
@@ -12,10 +13,28 @@ constexpr size_t VirtualReserveSize = 1ULL << 38;
 constexpr size_t VirtualReserveSize = 1ULL << 39;
 #endif
 
+namespace {
+Common::HugePages SelectHugePages() {
+    if (!Settings::values.use_huge_pages) {
+        return Common::HugePages::Disabled;
+    }
+    // Fastmem aliases memory at 4 KiB granularity, only transparent huge pages allow that
+    return Settings::IsFastmemEnabled() ? Common::HugePages::Transparent
+                                        : Common::HugePages::Explicit;
+}
+} // Anonymous namespace
+
 DeviceMemory::DeviceMemory()
     : buffer{Kernel::Board::Nintendo::Nx::KSystemControl::Init::GetIntendedMemorySize(),
-             VirtualReserveSize} {}
+             VirtualReserveSize, SelectHugePages()} {
+    // Reserved huge pages leave no fastmem arena, keep fastmem off for the session
+    Settings::SetFastmemSupported(!buffer.HasExplicitHugePages());
+}
 
-DeviceMemory::~DeviceMemory() = default;
+DeviceMemory::~DeviceMemory() {
+    if (Settings::values.use_huge_pages) {
+        buffer.LogHugePageUsage();
+    }
+}
 
 } // namespace Core
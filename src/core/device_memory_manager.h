@@ -148,6 +148,10 @@ private:
     void WalkBlock(const DAddr addr, const std::size_t size, auto on_unmapped, auto on_memory,
                    auto increment);
 
+    /// Returns how many pages from a page are backed by contiguous host memory, or are all
+    /// unmapped. Stops once max_pages are covered, runs of tracked continuity may go past it.
+    size_t ContiguousPages(size_t page_index, size_t max_pages) const;
+
     void InnerGatherDeviceAddresses(Common::ScratchBuffer<u32>& buffer, PAddr address);
 
     std::unique_ptr<DeviceMemoryManagerAllocator<Traits>> impl;
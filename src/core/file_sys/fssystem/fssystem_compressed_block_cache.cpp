@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/literals.h"
+#include "common/settings.h"
+#include "core/file_sys/fssystem/fssystem_compressed_block_cache.h"
+
+namespace FileSys {
+
+using namespace Common::Literals;
+
+CompressedBlockCache& CompressedBlockCache::GetInstance() {
+    static CompressedBlockCache cache;
+    return cache;
+}
+
+CompressedBlockCache::CompressedBlockCache()
+    : m_workers{Common::TaskPriority::LatencyCritical} {}
+
+CompressedBlockCache::~CompressedBlockCache() = default;
+
+u64 CompressedBlockCache::RegisterStorage() {
+    return m_next_storage_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CompressedBlockCache::UnregisterStorage(u64 storage_id) {
+    std::scoped_lock lk{m_mutex};
+    const auto begin = m_blocks.lower_bound(Key{storage_id, 0});
+    auto it = begin;
+    for (; it != m_blocks.end() && it->first.first == storage_id; ++it) {
+        m_used_size -= it->second.data.size();
+        m_lru.erase(it->second.lru_it);
+    }
+    m_blocks.erase(begin, it);
+}
+
+bool CompressedBlockCache::Read(u64 storage_id, s64 block_offset, void* dst, size_t offset,
+                                size_t size) {
+    std::scoped_lock lk{m_mutex};
+    const auto it = m_blocks.find(Key{storage_id, block_offset});
+    if (it == m_blocks.end() || offset + size > it->second.data.size()) {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lru_it);
+    std::memcpy(dst, it->second.data.data() + offset, size);
+    m_hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void CompressedBlockCache::Insert(u64 storage_id, s64 block_offset, std::span<const u8> data) {
+    const size_t capacity =
+        static_cast<size_t>(Settings::values.compressed_block_cache_size.GetValue()) * 1_MiB;
+    if (data.size() > capacity) {
+        return;
+    }
+
+    std::scoped_lock lk{m_mutex};
+    const Key key{storage_id, block_offset};
+    if (m_blocks.contains(key)) {
+        return;
+    }
+
+    EvictLocked(capacity - data.size());
+
+    m_lru.push_front(key);
+    m_blocks.emplace(key, Block{
+                              .data = std::vector<u8>(data.begin(), data.end()),
+                              .lru_it = m_lru.begin(),
+                          });
+    m_used_size += data.size();
+}
+
+CompressedBlockCacheStats CompressedBlockCache::GetAndResetStats() {
+    return {
+        .hits = m_hits.exchange(0, std::memory_order_relaxed),
+        .misses = m_misses.exchange(0, std::memory_order_relaxed),
+        .parallel_blocks = m_parallel_blocks.exchange(0, std::memory_order_relaxed),
+    };
+}
+
+void CompressedBlockCache::EvictLocked(size_t capacity) {
+    while (m_used_size > capacity && !m_lru.empty()) {
+        const auto it = m_blocks.find(m_lru.back());
+        m_used_size -= it->second.data.size();
+        m_blocks.erase(it);
+        m_lru.pop_back();
+    }
+}
+
+} // namespace FileSys
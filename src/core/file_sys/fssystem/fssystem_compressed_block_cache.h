@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/task_pool.h"
+#include "core/file_sys/fssystem/fssystem_compressed_block_cache_stats.h"
+
+namespace FileSys {
+
+/**
+ * Decompressed blocks of every CompressedStorage, kept so reads that only cover part of a block
+ * don't decompress it again. The cache is shared by all the storages and holds at most
+ * compressed_block_cache_size MiB of blocks, evicted in LRU order.
+ */
+class CompressedBlockCache {
+public:
+    static CompressedBlockCache& GetInstance();
+
+    CompressedBlockCache();
+    ~CompressedBlockCache();
+
+    CompressedBlockCache(const CompressedBlockCache&) = delete;
+    CompressedBlockCache& operator=(const CompressedBlockCache&) = delete;
+
+    /// Returns an id to identify the blocks of a new storage with
+    [[nodiscard]] u64 RegisterStorage();
+
+    /// Drops every block of a storage
+    void UnregisterStorage(u64 storage_id);
+
+    /// Copies part of a cached block to dst, returns false when the block isn't cached
+    [[nodiscard]] bool Read(u64 storage_id, s64 block_offset, void* dst, size_t offset,
+                            size_t size);
+
+    /// Caches a decompressed block, evicting the least recently used ones to stay in budget
+    void Insert(u64 storage_id, s64 block_offset, std::span<const u8> data);
+
+    /// Threads decompressing the blocks of large reads
+    [[nodiscard]] Common::TaskGroup& GetWorkers() {
+        return m_workers;
+    }
+
+    void AddParallelBlocks(u64 count) {
+        m_parallel_blocks.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /// Returns the stats since the last call and resets them
+    [[nodiscard]] CompressedBlockCacheStats GetAndResetStats();
+
+private:
+    using Key = std::pair<u64, s64>;
+
+    struct Block {
+        std::vector<u8> data;
+        std::list<Key>::iterator lru_it;
+    };
+
+    void EvictLocked(size_t capacity);
+
+    std::mutex m_mutex;
+    std::map<Key, Block> m_blocks;
+    std::list<Key> m_lru; ///< Most recently used first
+    size_t m_used_size{};
+
+    std::atomic<u64> m_next_storage_id{1};
+    std::atomic<u64> m_hits{};
+    std::atomic<u64> m_misses{};
+    std::atomic<u64> m_parallel_blocks{};
+
+    Common::TaskGroup m_workers;
+};
+
+} // namespace FileSys
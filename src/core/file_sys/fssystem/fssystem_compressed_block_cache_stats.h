@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace FileSys {
+
+/// Lookups of the decompressed block cache of compressed NCA sections since the last reset
+struct CompressedBlockCacheStats {
+    u64 hits{};            ///< Partially read blocks found in the cache
+    u64 misses{};          ///< Partially read blocks that had to be decompressed
+    u64 parallel_blocks{}; ///< Blocks of large reads decompressed in parallel
+};
+
+} // namespace FileSys
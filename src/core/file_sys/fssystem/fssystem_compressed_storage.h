@@ -3,11 +3,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <vector>
+
 #include "common/literals.h"
+#include "common/thread_worker.h"
 
 #include "core/file_sys/errors.h"
 #include "core/file_sys/fssystem/fs_i_storage.h"
 #include "core/file_sys/fssystem/fssystem_bucket_tree.h"
+#include "core/file_sys/fssystem/fssystem_compressed_block_cache.h"
 #include "core/file_sys/fssystem/fssystem_compression_common.h"
 #include "core/file_sys/fssystem/fssystem_pooled_buffer.h"
 #include "core/file_sys/vfs/vfs.h"
@@ -650,7 +657,6 @@ private:
             R_SUCCEED();
         }
 
-    private:
         DecompressorFunction GetDecompressor(CompressionType type) const {
             // Check that we can get a decompressor for the type.
             if (CompressionTypeUtility::IsUnknownType(type)) {
@@ -661,6 +667,7 @@ private:
             return m_get_decompressor_function(type);
         }
 
+    private:
         bool IsInitialized() const {
             return m_table.IsInitialized();
         }
@@ -690,15 +697,33 @@ private:
         };
         static_assert(std::is_trivial_v<AccessRange>);
 
+        /// Reads at least this large decompress their blocks in parallel
+        static constexpr size_t ParallelReadSizeMin = 256_KiB;
+
+        /// Largest physical range read at once for decompressing in parallel
+        static constexpr size_t ParallelReadPhysicalSizeMax = 8_MiB;
+
     public:
         CacheManager() = default;
 
+        ~CacheManager() {
+            if (m_storage_id != 0) {
+                CompressedBlockCache::GetInstance().UnregisterStorage(m_storage_id);
+            }
+        }
+
     public:
         Result Initialize(s64 storage_size, size_t cache_size_0, size_t cache_size_1,
                           size_t max_cache_entries) {
             // Set our fields.
             m_storage_size = storage_size;
 
+            // Decompressed blocks are kept in the cache shared by every compressed storage, the
+            // per storage sizes are unused.
+            if (m_storage_id == 0) {
+                m_storage_id = CompressedBlockCache::GetInstance().RegisterStorage();
+            }
+
             R_SUCCEED();
         }
 
@@ -801,98 +826,199 @@ private:
                 }
             }();
 
-            // Determine start/end offsets.
-            const s64 start_offset =
-                head_range.is_block_alignment_required ? head_range.virtual_offset : cur_offset;
-            const s64 end_offset = tail_range.is_block_alignment_required
-                                       ? tail_range.GetEndVirtualOffset()
-                                       : cur_offset + cur_size;
+            // Read the blocks only partially covered by the read through the block cache.
+            if (head_unaligned) {
+                const size_t copy_size = std::min<size_t>(
+                    cur_size, head_range.GetEndVirtualOffset() - cur_offset);
+                R_TRY(this->ReadPartialBlock(core, head_range, cur_offset, cur_dst, copy_size));
 
-            // Perform the read.
-            bool is_burst_reading = false;
-            R_TRY(core.Read(
-                start_offset, end_offset - start_offset,
-                [&](size_t size_buffer_required,
-                    const CompressedStorageCore::ReadImplFunction& read_impl) -> Result {
-                    // Determine whether we're burst reading.
-                    const AccessRange* unaligned_range = nullptr;
-                    if (!is_burst_reading) {
-                        // Check whether we're using head, tail, or none as unaligned.
-                        if (head_unaligned && head_range.virtual_offset <= cur_offset &&
-                            cur_offset < head_range.GetEndVirtualOffset()) {
-                            unaligned_range = std::addressof(head_range);
-                        } else if (tail_unaligned && tail_range.virtual_offset <= cur_offset &&
-                                   cur_offset < tail_range.GetEndVirtualOffset()) {
-                            unaligned_range = std::addressof(tail_range);
-                        } else {
-                            is_burst_reading = true;
-                        }
-                    }
-                    ASSERT((is_burst_reading ^ (unaligned_range != nullptr)));
+                cur_dst += copy_size;
+                cur_offset += copy_size;
+                cur_size -= copy_size;
+            }
+            if (cur_size > 0 && tail_unaligned) {
+                ASSERT(cur_offset <= tail_range.virtual_offset);
+                const size_t skip_size = tail_range.virtual_offset - cur_offset;
+                R_TRY(this->ReadPartialBlock(core, tail_range, tail_range.virtual_offset,
+                                             cur_dst + skip_size, cur_size - skip_size));
 
-                    // Perform reading by burst, or not.
-                    if (is_burst_reading) {
-                        // Check that the access is valid for burst reading.
-                        ASSERT(size_buffer_required <= cur_size);
+                cur_size = skip_size;
+            }
 
-                        // Perform the read.
-                        Result rc = read_impl(cur_dst, size_buffer_required);
-                        if (R_FAILED(rc)) {
-                            R_THROW(rc);
-                        }
+            // Everything left starts and ends on block boundaries, read it straight into the
+            // destination.
+            R_SUCCEED_IF(cur_size == 0);
+            if (cur_size >= ParallelReadSizeMin) {
+                bool is_done = false;
+                R_TRY(this->ReadInParallel(std::addressof(is_done), core, cur_offset, cur_dst,
+                                           cur_size));
+                R_SUCCEED_IF(is_done);
+            }
 
-                        // Advance.
-                        cur_dst += size_buffer_required;
-                        cur_offset += size_buffer_required;
-                        cur_size -= size_buffer_required;
+            R_RETURN(core.Read(
+                cur_offset, cur_size,
+                [&](size_t size_buffer_required,
+                    const CompressedStorageCore::ReadImplFunction& read_impl) -> Result {
+                    // Check that the access is valid.
+                    ASSERT(size_buffer_required <= cur_size);
 
-                        // Determine whether we're going to continue burst reading.
-                        const s64 offset_aligned =
-                            tail_unaligned ? tail_range.virtual_offset : end_offset;
-                        ASSERT(cur_offset <= offset_aligned);
+                    // Perform the read.
+                    R_TRY(read_impl(cur_dst, size_buffer_required));
 
-                        if (offset_aligned <= cur_offset) {
-                            is_burst_reading = false;
-                        }
-                    } else {
-                        // We're not burst reading, so we have some unaligned range.
-                        ASSERT(unaligned_range != nullptr);
+                    // Advance.
+                    cur_dst += size_buffer_required;
+                    cur_size -= size_buffer_required;
+                    R_SUCCEED();
+                }));
+        }
 
-                        // Check that the size is correct.
-                        ASSERT(size_buffer_required ==
-                               static_cast<size_t>(unaligned_range->virtual_size));
+    private:
+        /// Copies part of a block, decompressing the whole block and caching it on a miss
+        Result ReadPartialBlock(CompressedStorageCore& core, const AccessRange& range,
+                                s64 offset, char* dst, size_t size) {
+            auto& cache = CompressedBlockCache::GetInstance();
+            const size_t skip_size = static_cast<size_t>(offset - range.virtual_offset);
+            R_SUCCEED_IF(cache.Read(m_storage_id, range.virtual_offset, dst, skip_size, size));
+
+            // Get a pooled buffer for our read.
+            const size_t block_size = static_cast<size_t>(range.virtual_size);
+            PooledBuffer pooled_buffer;
+            pooled_buffer.Allocate(block_size, block_size);
+
+            // Decompress the whole block.
+            size_t filled_size = 0;
+            R_TRY(core.Read(
+                range.virtual_offset, range.virtual_size,
+                [&](size_t size_buffer_required,
+                    const CompressedStorageCore::ReadImplFunction& read_impl) -> Result {
+                    ASSERT(filled_size + size_buffer_required <= block_size);
+                    R_TRY(read_impl(pooled_buffer.GetBuffer() + filled_size,
+                                    size_buffer_required));
+                    filled_size += size_buffer_required;
+                    R_SUCCEED();
+                }));
+            ASSERT(filled_size == block_size);
 
-                        // Get a pooled buffer for our read.
-                        PooledBuffer pooled_buffer;
-                        pooled_buffer.Allocate(size_buffer_required, size_buffer_required);
+            // Copy the data we read to the destination.
+            std::memcpy(dst, pooled_buffer.GetBuffer() + skip_size, size);
 
-                        // Perform read.
-                        Result rc = read_impl(pooled_buffer.GetBuffer(), size_buffer_required);
-                        if (R_FAILED(rc)) {
-                            R_THROW(rc);
-                        }
+            cache.Insert(m_storage_id, range.virtual_offset,
+                         std::span(reinterpret_cast<const u8*>(pooled_buffer.GetBuffer()),
+                                   block_size));
+            R_SUCCEED();
+        }
 
-                        // Copy the data we read to the destination.
-                        const size_t skip_size = cur_offset - unaligned_range->virtual_offset;
-                        const size_t copy_size = std::min<size_t>(
-                            cur_size, unaligned_range->GetEndVirtualOffset() - cur_offset);
+        /**
+         * Reads the physical data of a large read at once and decompresses its blocks on the
+         * block cache's workers. The data storage is only accessed by the calling thread, as
+         * the layers under it may not be reentrant.
+         *
+         * Sets out_done to false without reading anything when the read can't be done this way.
+         */
+        Result ReadInParallel(bool* out_done, CompressedStorageCore& core, s64 offset, char* dst,
+                              size_t size) {
+            struct Task {
+                CompressionType compression_type;
+                DecompressorFunction decompressor;
+                s64 physical_offset;
+                size_t physical_size;
+                size_t dst_offset;
+                size_t virtual_size;
+            };
+            std::vector<Task> tasks;
+            bool is_supported = true;
+            size_t dst_offset = 0;
+            s64 physical_begin = std::numeric_limits<s64>::max();
+            s64 physical_end = 0;
 
-                        std::memcpy(cur_dst, pooled_buffer.GetBuffer() + skip_size, copy_size);
+            R_TRY(core.OperatePerEntry(
+                offset, size,
+                [&](bool* out_continuous, const Entry& entry, s64 virtual_data_size,
+                    s64 data_offset, s64 data_read_size) -> Result {
+                    Task task{
+                        .compression_type = entry.compression_type,
+                        .decompressor = nullptr,
+                        .physical_offset = entry.phys_offset,
+                        .physical_size = 0,
+                        .dst_offset = dst_offset,
+                        .virtual_size = static_cast<size_t>(data_read_size),
+                    };
+                    switch (entry.compression_type) {
+                    case CompressionType::None:
+                        task.physical_offset = entry.phys_offset + data_offset;
+                        task.physical_size = static_cast<size_t>(data_read_size);
+                        break;
+                    case CompressionType::Zeros:
+                        break;
+                    default:
+                        task.decompressor = core.GetDecompressor(entry.compression_type);
+                        task.physical_size = static_cast<size_t>(entry.GetPhysicalSize());
+                        is_supported &= task.decompressor != nullptr && data_offset == 0 &&
+                                        data_read_size == virtual_data_size;
+                        break;
+                    }
 
-                        // Advance.
-                        cur_dst += copy_size;
-                        cur_offset += copy_size;
-                        cur_size -= copy_size;
+                    if (task.physical_size > 0) {
+                        physical_begin = std::min(physical_begin, task.physical_offset);
+                        physical_end = std::max<s64>(
+                            physical_end, task.physical_offset + task.physical_size);
                     }
+                    dst_offset += task.virtual_size;
+                    tasks.push_back(task);
 
+                    *out_continuous = is_supported;
                     R_SUCCEED();
                 }));
 
+            // Fall back to reading serially when the physical data isn't close together.
+            *out_done = false;
+            R_SUCCEED_IF(!is_supported || dst_offset != size);
+            const s64 physical_size =
+                physical_end > physical_begin ? physical_end - physical_begin : 0;
+            R_SUCCEED_IF(physical_size > static_cast<s64>(ParallelReadPhysicalSizeMax));
+
+            std::vector<u8> physical_data(static_cast<size_t>(physical_size));
+            if (physical_size > 0) {
+                const size_t read_physical_size = core.GetDataStorage()->Read(
+                    physical_data.data(), physical_data.size(), physical_begin);
+                R_UNLESS(read_physical_size == physical_data.size(),
+                         ResultUnexpectedInCompressedStorageC);
+            }
+
+            auto& cache = CompressedBlockCache::GetInstance();
+            std::vector<Result> results(tasks.size(), ResultSuccess);
+            const auto run_task = [&](size_t i) {
+                const Task& task = tasks[i];
+                u8* const src = physical_data.data() + (task.physical_offset - physical_begin);
+                switch (task.compression_type) {
+                case CompressionType::None:
+                    std::memcpy(dst + task.dst_offset, src, task.virtual_size);
+                    break;
+                case CompressionType::Zeros:
+                    std::memset(dst + task.dst_offset, 0, task.virtual_size);
+                    break;
+                default:
+                    results[i] = task.decompressor(dst + task.dst_offset, task.virtual_size, src,
+                                                   task.physical_size);
+                    break;
+                }
+            };
+            Common::ParallelForEach(cache.GetWorkers(), tasks.size(), run_task);
+            cache.AddParallelBlocks(std::ranges::count_if(tasks, [](const Task& task) {
+                return task.decompressor != nullptr;
+            }));
+
+            for (const Result result : results) {
+                R_TRY(result);
+            }
+
+            *out_done = true;
             R_SUCCEED();
         }
 
     private:
         s64 m_storage_size = 0;
+        u64 m_storage_id = 0;
     };
 
 public:
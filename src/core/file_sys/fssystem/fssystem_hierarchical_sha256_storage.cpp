@@ -1,8 +1,16 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "common/alignment.h"
+#include "common/div_ceil.h"
+#include "common/logging/log.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
+#include "core/crypto/sha_util.h"
 #include "core/file_sys/fssystem/fssystem_hierarchical_sha256_storage.h"
 
 namespace FileSys {
@@ -63,6 +71,19 @@ Result HierarchicalSha256Storage::Initialize(VirtualFile* base_storages, s32 lay
     base_storages[1]->Read(reinterpret_cast<u8*>(m_hash_buffer),
                            static_cast<size_t>(hash_storage_size), 0);
 
+    // Verify the hashes against the master hash and track the blocks already verified, when
+    // verification is enabled.
+    if (Settings::values.verify_romfs_integrity.GetValue()) {
+        const auto hash = Core::Crypto::CalculateSha256(
+            {reinterpret_cast<const u8*>(m_hash_buffer), static_cast<size_t>(hash_storage_size)});
+        if (hash != master_hash) {
+            LOG_ERROR(Service_FS, "Integrity verification failed for the hash table");
+        }
+        const size_t block_size = static_cast<size_t>(m_hash_target_block_size);
+        m_verified_blocks.Initialize(
+            Common::DivCeil(static_cast<size_t>(m_base_storage_size), block_size));
+    }
+
     R_SUCCEED();
 }
 
@@ -76,7 +97,51 @@ size_t HierarchicalSha256Storage::Read(u8* buffer, size_t size, size_t offset) c
     ASSERT(buffer != nullptr);
 
     // Read the data.
-    return m_base_storage->Read(buffer, size, offset);
+    const size_t read_size = m_base_storage->Read(buffer, size, offset);
+
+    // Verify the blocks read, when enabled.
+    if (m_verified_blocks.IsInitialized()) {
+        this->VerifyBlocks(buffer, offset, read_size);
+    }
+
+    return read_size;
+}
+
+void HierarchicalSha256Storage::VerifyBlocks(const u8* buffer, size_t offset, size_t size) const {
+    const size_t block_size = static_cast<size_t>(m_hash_target_block_size);
+    const size_t data_size = static_cast<size_t>(m_base_storage_size);
+    const size_t end_block =
+        std::min(Common::DivCeil(offset + size, block_size), m_verified_blocks.GetNumBlocks());
+
+    std::vector<u8> block_buffer;
+    for (size_t block = offset / block_size; block < end_block; ++block) {
+        if (m_verified_blocks.IsVerified(block)) {
+            continue;
+        }
+
+        // The last block is hashed without padding.
+        const size_t block_offset = block * block_size;
+        const size_t hashed_size = std::min(block_size, data_size - block_offset);
+        const u8* block_data;
+        if (block_offset >= offset && block_offset + hashed_size <= offset + size) {
+            block_data = buffer + (block_offset - offset);
+        } else {
+            block_buffer.resize(hashed_size);
+            if (m_base_storage->Read(block_buffer.data(), hashed_size, block_offset) !=
+                hashed_size) {
+                continue;
+            }
+            block_data = block_buffer.data();
+        }
+
+        // Corrupted blocks are marked too, so each one is only reported once.
+        const auto hash = Core::Crypto::CalculateSha256({block_data, hashed_size});
+        if (std::memcmp(hash.data(), m_hash_buffer + block * HashSize, HashSize) != 0) {
+            LOG_ERROR(Service_FS, "Integrity verification failed for block {} at offset {:#x}",
+                      block, block_offset);
+        }
+        m_verified_blocks.SetVerified(block);
+    }
 }
 
 } // namespace FileSys
@@ -7,6 +7,7 @@
 
 #include "core/file_sys/errors.h"
 #include "core/file_sys/fssystem/fs_i_storage.h"
+#include "core/file_sys/fssystem/fssystem_verified_block_bitmap.h"
 #include "core/file_sys/vfs/vfs.h"
 
 namespace FileSys {
@@ -31,6 +32,10 @@ public:
 
     virtual size_t Read(u8* buffer, size_t length, size_t offset) const override;
 
+private:
+    /// Checks the hashes of the blocks in a range that haven't been checked yet
+    void VerifyBlocks(const u8* buffer, size_t offset, size_t size) const;
+
 private:
     VirtualFile m_base_storage;
     s64 m_base_storage_size;
@@ -39,6 +44,7 @@ private:
     s32 m_hash_target_block_size;
     s32 m_log_size_ratio;
     std::mutex m_mutex;
+    mutable VerifiedBlockBitmap m_verified_blocks;
 };
 
 } // namespace FileSys
@@ -1,7 +1,13 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <vector>
+
 #include "common/alignment.h"
+#include "common/div_ceil.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "core/crypto/sha_util.h"
 #include "core/file_sys/fssystem/fssystem_integrity_verification_storage.h"
 
 namespace FileSys {
@@ -40,11 +46,18 @@ void IntegrityVerificationStorage::Initialize(VirtualFile hs, VirtualFile ds, s6
 
     // Set data.
     m_is_real_data = is_real_data;
+
+    // Track the blocks already verified, when verification is enabled.
+    if (Settings::values.verify_romfs_integrity.GetValue()) {
+        m_verified_blocks.Initialize(Common::DivCeil(
+            m_data_storage->GetSize(), static_cast<size_t>(m_verification_block_size)));
+    }
 }
 
 void IntegrityVerificationStorage::Finalize() {
     m_hash_storage = VirtualFile();
     m_data_storage = VirtualFile();
+    m_verified_blocks.Finalize();
 }
 
 size_t IntegrityVerificationStorage::Read(u8* buffer, size_t size, size_t offset) const {
@@ -81,7 +94,63 @@ size_t IntegrityVerificationStorage::Read(u8* buffer, size_t size, size_t offset
     }
 
     // Perform the read.
-    return m_data_storage->Read(buffer, read_size, offset);
+    const size_t result = m_data_storage->Read(buffer, read_size, offset);
+
+    // Verify the blocks read, when enabled.
+    if (m_verified_blocks.IsInitialized() && result == read_size) {
+        this->VerifyBlocks(buffer, offset, size);
+    }
+
+    return result;
+}
+
+void IntegrityVerificationStorage::VerifyBlocks(const u8* buffer, size_t offset,
+                                                size_t size) const {
+    const size_t block_size = static_cast<size_t>(m_verification_block_size);
+    const size_t data_size = static_cast<size_t>(m_data_storage->GetSize());
+    const size_t end_block =
+        std::min(Common::DivCeil(offset + size, block_size), m_verified_blocks.GetNumBlocks());
+
+    std::vector<u8> block_buffer;
+    for (size_t block = offset / block_size; block < end_block; ++block) {
+        if (m_verified_blocks.IsVerified(block)) {
+            continue;
+        }
+
+        // Hash blocks entirely within the read in place, read the others in full.
+        // Past the end of the data, blocks are hashed as if padded with zeros.
+        const size_t block_offset = block * block_size;
+        const u8* block_data;
+        if (block_offset >= offset && block_offset + block_size <= offset + size) {
+            block_data = buffer + (block_offset - offset);
+        } else {
+            block_buffer.assign(block_size, 0);
+            const size_t in_bounds_size = std::min(block_size, data_size - block_offset);
+            if (m_data_storage->Read(block_buffer.data(), in_bounds_size, block_offset) !=
+                in_bounds_size) {
+                continue;
+            }
+            block_data = block_buffer.data();
+        }
+
+        BlockHash expected_hash{};
+        if (m_hash_storage->Read(expected_hash.hash.data(), HashSize, block * HashSize) !=
+            HashSize) {
+            continue;
+        }
+
+        BlockHash hash{Core::Crypto::CalculateSha256({block_data, block_size})};
+        if (IsValidationBit(&expected_hash)) {
+            SetValidationBit(&hash);
+        }
+
+        // Corrupted blocks are marked too, so each one is only reported once.
+        if (hash.hash != expected_hash.hash) {
+            LOG_ERROR(Service_FS, "Integrity verification failed for block {} at offset {:#x}",
+                      block, block_offset);
+        }
+        m_verified_blocks.SetVerified(block);
+    }
 }
 
 size_t IntegrityVerificationStorage::GetSize() const {
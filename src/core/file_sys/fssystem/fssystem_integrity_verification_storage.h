@@ -7,6 +7,7 @@
 
 #include "core/file_sys/fssystem/fs_i_storage.h"
 #include "core/file_sys/fssystem/fs_types.h"
+#include "core/file_sys/fssystem/fssystem_verified_block_bitmap.h"
 
 namespace FileSys {
 
@@ -42,6 +43,9 @@ public:
     }
 
 private:
+    /// Checks the hashes of the blocks in a range that haven't been checked yet
+    void VerifyBlocks(const u8* buffer, size_t offset, size_t size) const;
+
     static void SetValidationBit(BlockHash* hash) {
         ASSERT(hash != nullptr);
         hash->hash[HashSize - 1] |= 0x80;
@@ -60,6 +64,7 @@ private:
     s64 m_upper_layer_verification_block_size;
     s64 m_upper_layer_verification_block_order;
     bool m_is_real_data;
+    mutable VerifiedBlockBitmap m_verified_blocks;
 };
 
 } // namespace FileSys
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "common/common_types.h"
+#include "common/div_ceil.h"
+
+namespace FileSys {
+
+/// Blocks of a storage whose hash has been checked, so reading them again never rehashes
+class VerifiedBlockBitmap {
+public:
+    void Initialize(size_t num_blocks) {
+        m_words = std::make_unique<std::atomic<u64>[]>(Common::DivCeil(num_blocks, size_t{64}));
+        m_num_blocks = num_blocks;
+    }
+
+    void Finalize() {
+        m_words.reset();
+        m_num_blocks = 0;
+    }
+
+    bool IsInitialized() const {
+        return m_words != nullptr;
+    }
+
+    bool IsVerified(size_t block) const {
+        return (m_words[block / 64].load(std::memory_order_acquire) & Bit(block)) != 0;
+    }
+
+    void SetVerified(size_t block) {
+        m_words[block / 64].fetch_or(Bit(block), std::memory_order_release);
+    }
+
+    size_t GetNumBlocks() const {
+        return m_num_blocks;
+    }
+
+private:
+    static u64 Bit(size_t block) {
+        return u64{1} << (block % 64);
+    }
+
+    std::unique_ptr<std::atomic<u64>[]> m_words;
+    size_t m_num_blocks{};
+};
+
+} // namespace FileSys
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <cstring>
 
+#include "common/fs/path_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
@@ -17,11 +18,14 @@
 #include "core/file_sys/common_funcs.h"
 #include "core/file_sys/content_archive.h"
 #include "core/file_sys/control_metadata.h"
+#include "core/file_sys/fsmitm_romfsbuild.h"
 #include "core/file_sys/ips_layer.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/romfs.h"
+#include "core/file_sys/romfs_build_cache.h"
 #include "core/file_sys/vfs/vfs_cached.h"
+#include "core/file_sys/vfs/vfs_concat.h"
 #include "core/file_sys/vfs/vfs_layered.h"
 #include "core/file_sys/vfs/vfs_vector.h"
 #include "core/hle/service/filesystem/filesystem.h"
@@ -377,16 +381,16 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
 
         auto romfs_dir = FindSubdirectoryCaseless(subdir, "romfs");
         if (romfs_dir != nullptr)
-            layers.emplace_back(std::make_shared<CachedVfsDirectory>(std::move(romfs_dir)));
+            layers.emplace_back(std::move(romfs_dir));
 
         auto ext_dir = FindSubdirectoryCaseless(subdir, "romfs_ext");
         if (ext_dir != nullptr)
-            layers_ext.emplace_back(std::make_shared<CachedVfsDirectory>(std::move(ext_dir)));
+            layers_ext.emplace_back(std::move(ext_dir));
 
         if (type == ContentRecordType::HtmlDocument) {
             auto manual_dir = FindSubdirectoryCaseless(subdir, "manual_html");
             if (manual_dir != nullptr)
-                layers.emplace_back(std::make_shared<CachedVfsDirectory>(std::move(manual_dir)));
+                layers.emplace_back(std::move(manual_dir));
         }
     }
 
@@ -395,21 +399,49 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
         return;
     }
 
+    // Reuse the layout of the last build when neither the RomFS nor the mods changed
+    const RomFSBuildCache cache{Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) /
+                                    "layeredfs" /
+                                    fmt::format("{:016X}_{}.bin", title_id, static_cast<u8>(type)),
+                                romfs, layers, layers_ext};
+    if (auto cached = cache.Load()) {
+        LOG_INFO(Loader, "    RomFS: LayeredFS patches applied from cache");
+        romfs = std::move(cached);
+        return;
+    }
+
     auto extracted = ExtractRomFS(romfs);
     if (extracted == nullptr) {
         return;
     }
 
-    layers.emplace_back(std::move(extracted));
+    std::vector<VirtualDir> cached_layers;
+    cached_layers.reserve(layers.size() + 1);
+    for (auto& layer : layers) {
+        cached_layers.emplace_back(std::make_shared<CachedVfsDirectory>(std::move(layer)));
+    }
+    const std::vector<VirtualDir> built_layers = cached_layers;
+    cached_layers.emplace_back(extracted);
+
+    std::vector<VirtualDir> cached_layers_ext;
+    cached_layers_ext.reserve(layers_ext.size());
+    for (auto& layer : layers_ext) {
+        cached_layers_ext.emplace_back(std::make_shared<CachedVfsDirectory>(std::move(layer)));
+    }
 
-    auto layered = LayeredVfsDirectory::MakeLayeredDirectory(std::move(layers));
+    auto layered = LayeredVfsDirectory::MakeLayeredDirectory(std::move(cached_layers));
     if (layered == nullptr) {
         return;
     }
 
-    auto layered_ext = LayeredVfsDirectory::MakeLayeredDirectory(std::move(layers_ext));
+    auto layered_ext = LayeredVfsDirectory::MakeLayeredDirectory(std::move(cached_layers_ext));
+
+    RomFSBuildContext ctx{layered, std::move(layered_ext)};
+    auto entries = ctx.Build();
+    cache.Save(entries, built_layers, extracted);
 
-    auto packed = CreateRomFS(std::move(layered), std::move(layered_ext));
+    auto packed = ConcatenatedVfsFile::MakeConcatenatedFile(0, layered->GetName(),
+                                                           std::move(entries));
     if (packed == nullptr) {
         return;
     }
@@ -4,8 +4,13 @@
 #include <algorithm>
 #include <random>
 #include <regex>
+#include <set>
 #include <mbedtls/sha256.h>
 #include "common/assert.h"
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
@@ -18,6 +23,8 @@
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/submission_package.h"
 #include "core/file_sys/vfs/vfs_concat.h"
+#include "core/file_sys/vfs/vfs_real.h"
+#include "core/file_sys/vfs/vfs_vector.h"
 #include "core/loader/loader.h"
 
 namespace FileSys {
@@ -25,6 +32,29 @@ namespace FileSys {
 // The size of blocks to use when vfs raw copying into nand.
 constexpr size_t VFS_RC_LARGE_COPY_BLOCK = 0x400000;
 
+constexpr u32 ContentIndexMagic = Common::MakeMagic('R', 'C', 'I', 'X');
+constexpr u32 ContentIndexVersion = 1;
+
+// CNMTs are a few hundred bytes, anything past this in the content index means it's corrupted
+constexpr u32 MaxIndexedCnmtSize = 0x100000;
+
+struct ContentIndexHeader {
+    u32 magic;
+    u32 version;
+    u64 num_entries;
+};
+static_assert(sizeof(ContentIndexHeader) == 0x10, "ContentIndexHeader has incorrect size.");
+
+struct ContentIndexEntry {
+    NcaID nca_id;
+    u64 modified_time;
+    u64 size;
+    u64 title_id;
+    u32 cnmt_size;
+    u32 is_meta;
+};
+static_assert(sizeof(ContentIndexEntry) == 0x30, "ContentIndexEntry has incorrect size.");
+
 std::string ContentProviderEntry::DebugInfo() const {
     return fmt::format("title_id={:016X}, content_type={:02X}", title_id, static_cast<u8>(type));
 }
@@ -376,11 +406,21 @@ std::optional<NcaID> RegisteredCache::GetNcaIDFromMetadata(u64 title_id,
     return CheckMapForContentRecord(meta, title_id, type);
 }
 
-std::vector<NcaID> RegisteredCache::AccumulateFiles() const {
-    std::vector<NcaID> ids;
+std::vector<RegisteredCache::FoundNca> RegisteredCache::AccumulateFiles() const {
+    std::vector<FoundNca> ncas;
+    // Directories of split NCAs are stamped with their own modification time only, NCAs are
+    // named after their hash so their contents changing without the name is only a safeguard
+    const auto add_nca = [&ncas](const VirtualDir& parent, const std::string& name, u64 size) {
+        ncas.push_back({
+            .id = Common::HexStringToArray<0x10, true>(name.substr(0, 0x20)),
+            .modified_time = parent->GetFileTimeStamp(name).modified,
+            .size = size,
+        });
+    };
+
     for (const auto& d2_dir : dir->GetSubdirectories()) {
         if (FollowsNcaIdFormat(d2_dir->GetName())) {
-            ids.push_back(Common::HexStringToArray<0x10, true>(d2_dir->GetName().substr(0, 0x20)));
+            add_nca(dir, d2_dir->GetName(), 0);
             continue;
         }
 
@@ -392,7 +432,7 @@ std::vector<NcaID> RegisteredCache::AccumulateFiles() const {
                 continue;
             }
 
-            ids.push_back(Common::HexStringToArray<0x10, true>(nca_dir->GetName().substr(0, 0x20)));
+            add_nca(d2_dir, nca_dir->GetName(), 0);
         }
 
         for (const auto& nca_file : d2_dir->GetFiles()) {
@@ -400,27 +440,52 @@ std::vector<NcaID> RegisteredCache::AccumulateFiles() const {
                 continue;
             }
 
-            ids.push_back(
-                Common::HexStringToArray<0x10, true>(nca_file->GetName().substr(0, 0x20)));
+            add_nca(d2_dir, nca_file->GetName(), nca_file->GetSize());
         }
     }
 
     for (const auto& d2_file : dir->GetFiles()) {
         if (FollowsNcaIdFormat(d2_file->GetName()))
-            ids.push_back(Common::HexStringToArray<0x10, true>(d2_file->GetName().substr(0, 0x20)));
+            add_nca(dir, d2_file->GetName(), d2_file->GetSize());
     }
-    return ids;
-}
+    return ncas;
+}
+
+void RegisteredCache::ProcessFiles(const std::vector<FoundNca>& ncas) {
+    for (const auto& found : ncas) {
+        const auto& id = found.id;
+        if (const auto it = index.find(id); it != index.end() &&
+                                            it->second.modified_time == found.modified_time &&
+                                            it->second.size == found.size) {
+            if (it->second.is_meta) {
+                meta.insert_or_assign(it->second.title_id,
+                                      CNMT(std::make_shared<VectorVfsFile>(it->second.cnmt)));
+                meta_id.insert_or_assign(it->second.title_id, id);
+            }
+            continue;
+        }
 
-void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
-    for (const auto& id : ids) {
         const auto file = GetFileAtID(id);
 
         if (file == nullptr)
             continue;
         const auto nca = std::make_shared<NCA>(parser(file, id));
-        if (nca->GetStatus() != Loader::ResultStatus::Success ||
-            nca->GetType() != NCAContentType::Meta || nca->GetSubdirectories().empty()) {
+        // NCAs that fail to parse may succeed once keys are added, they're never indexed
+        if (nca->GetStatus() != Loader::ResultStatus::Success) {
+            continue;
+        }
+
+        IndexedNca& indexed = index[id];
+        indexed = {
+            .modified_time = found.modified_time,
+            .size = found.size,
+            .is_meta = false,
+            .title_id = nca->GetTitleId(),
+            .cnmt = {},
+        };
+        index_dirty = true;
+
+        if (nca->GetType() != NCAContentType::Meta || nca->GetSubdirectories().empty()) {
             continue;
         }
 
@@ -430,13 +495,120 @@ void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
             if (section0_file->GetExtension() != "cnmt")
                 continue;
 
-            meta.insert_or_assign(nca->GetTitleId(), CNMT(section0_file));
+            indexed.is_meta = true;
+            indexed.cnmt = section0_file->ReadAllBytes();
+            meta.insert_or_assign(nca->GetTitleId(),
+                                  CNMT(std::make_shared<VectorVfsFile>(indexed.cnmt)));
             meta_id.insert_or_assign(nca->GetTitleId(), id);
             break;
         }
     }
 }
 
+void RegisteredCache::LoadIndex() {
+    index_loaded = true;
+    if (dynamic_cast<const RealVfsDirectory*>(dir.get()) == nullptr) {
+        return;
+    }
+
+    const auto dir_path = dir->GetFullPath();
+    index_path = Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "registered" /
+                 fmt::format("{:016X}.bin", Common::CityHash64(dir_path.data(), dir_path.size()));
+
+    const Common::FS::IOFile file{index_path, Common::FS::FileAccessMode::Read,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return;
+    }
+
+    ContentIndexHeader header{};
+    if (!file.ReadObject(header) || header.magic != ContentIndexMagic ||
+        header.version != ContentIndexVersion) {
+        return;
+    }
+
+    std::map<NcaID, IndexedNca> loaded;
+    for (u64 i = 0; i < header.num_entries; ++i) {
+        ContentIndexEntry entry{};
+        if (!file.ReadObject(entry) || entry.cnmt_size > MaxIndexedCnmtSize) {
+            LOG_WARNING(Loader, "Content index of {} is corrupted, rebuilding it", dir_path);
+            return;
+        }
+        std::vector<u8> cnmt(entry.cnmt_size);
+        if (file.ReadSpan<u8>(cnmt) != cnmt.size()) {
+            LOG_WARNING(Loader, "Content index of {} is corrupted, rebuilding it", dir_path);
+            return;
+        }
+        loaded.insert_or_assign(entry.nca_id, IndexedNca{
+                                                  .modified_time = entry.modified_time,
+                                                  .size = entry.size,
+                                                  .is_meta = entry.is_meta != 0,
+                                                  .title_id = entry.title_id,
+                                                  .cnmt = std::move(cnmt),
+                                              });
+    }
+    index = std::move(loaded);
+}
+
+void RegisteredCache::SaveIndex(const std::vector<FoundNca>& ncas) {
+    if (index_path.empty()) {
+        return;
+    }
+
+    // Drop the NCAs that were removed since the index was saved
+    std::set<NcaID> found_ids;
+    for (const auto& nca : ncas) {
+        found_ids.insert(nca.id);
+    }
+    for (auto it = index.begin(); it != index.end();) {
+        if (found_ids.contains(it->first)) {
+            ++it;
+        } else {
+            it = index.erase(it);
+            index_dirty = true;
+        }
+    }
+    if (!index_dirty) {
+        return;
+    }
+
+    std::vector<u8> data;
+    const auto append = [&data](const void* object, size_t size) {
+        const auto* const bytes = static_cast<const u8*>(object);
+        data.insert(data.end(), bytes, bytes + size);
+    };
+    const ContentIndexHeader header{
+        .magic = ContentIndexMagic,
+        .version = ContentIndexVersion,
+        .num_entries = index.size(),
+    };
+    append(&header, sizeof(header));
+    for (const auto& [id, indexed] : index) {
+        const ContentIndexEntry entry{
+            .nca_id = id,
+            .modified_time = indexed.modified_time,
+            .size = indexed.size,
+            .title_id = indexed.title_id,
+            .cnmt_size = static_cast<u32>(indexed.cnmt.size()),
+            .is_meta = static_cast<u32>(indexed.is_meta),
+        };
+        append(&entry, sizeof(entry));
+        append(indexed.cnmt.data(), indexed.cnmt.size());
+    }
+
+    if (!Common::FS::CreateParentDirs(index_path)) {
+        return;
+    }
+    const Common::FS::IOFile file{index_path, Common::FS::FileAccessMode::Write,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen() || file.WriteSpan<u8>(data) != data.size()) {
+        LOG_ERROR(Loader, "Failed to write the content index to {}",
+                  Common::FS::PathToUTF8String(index_path));
+        return;
+    }
+    index_dirty = false;
+}
+
 void RegisteredCache::AccumulateYuzuMeta() {
     const auto meta_dir = dir->GetSubdirectory("yuzu_meta");
     if (meta_dir == nullptr) {
@@ -458,9 +630,14 @@ void RegisteredCache::Refresh() {
         return;
     }
 
-    const auto ids = AccumulateFiles();
-    ProcessFiles(ids);
+    if (!index_loaded) {
+        LoadIndex();
+    }
+
+    const auto ncas = AccumulateFiles();
+    ProcessFiles(ncas);
     AccumulateYuzuMeta();
+    SaveIndex(ncas);
 }
 
 RegisteredCache::RegisteredCache(VirtualDir dir_, ContentProviderParsingFunction parsing_function)
@@ -4,7 +4,9 @@
 #pragma once
 
 #include <array>
+#include <filesystem>
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -178,13 +180,31 @@ public:
     bool RemoveExistingEntry(u64 title_id) const;
 
 private:
+    // NCA found in the directory, with the stamp of the file or directory holding it
+    struct FoundNca {
+        NcaID id;
+        u64 modified_time;
+        u64 size;
+    };
+
+    // Result of parsing an NCA, saved between boots in the content index
+    struct IndexedNca {
+        u64 modified_time;
+        u64 size;
+        bool is_meta;
+        u64 title_id;
+        std::vector<u8> cnmt;
+    };
+
     template <typename T>
     void IterateAllMetadata(std::vector<T>& out,
                             std::function<T(const CNMT&, const ContentRecord&)> proc,
                             std::function<bool(const CNMT&, const ContentRecord&)> filter) const;
-    std::vector<NcaID> AccumulateFiles() const;
-    void ProcessFiles(const std::vector<NcaID>& ids);
+    std::vector<FoundNca> AccumulateFiles() const;
+    void ProcessFiles(const std::vector<FoundNca>& ncas);
     void AccumulateYuzuMeta();
+    void LoadIndex();
+    void SaveIndex(const std::vector<FoundNca>& ncas);
     std::optional<NcaID> GetNcaIDFromMetadata(u64 title_id, ContentRecordType type) const;
     VirtualFile GetFileAtID(NcaID id) const;
     VirtualFile OpenFileOrDirectoryConcat(const VirtualDir& open_dir, std::string_view path) const;
@@ -201,6 +221,13 @@ private:
     std::map<u64, CNMT> meta;
     // maps tid -> meta for CNMT in yuzu_meta
     std::map<u64, CNMT> yuzu_meta;
+
+    // File the content index is saved to, empty when the directory isn't on the host
+    std::filesystem::path index_path;
+    // maps NcaID -> parsed metadata, reused while the stamp of the NCA doesn't change
+    std::map<NcaID, IndexedNca> index;
+    bool index_loaded{};
+    bool index_dirty{};
 };
 
 enum class ContentProviderUnionSlot {
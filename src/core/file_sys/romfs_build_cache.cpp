@@ -0,0 +1,313 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "core/file_sys/romfs_build_cache.h"
+#include "core/file_sys/vfs/vfs.h"
+#include "core/file_sys/vfs/vfs_concat.h"
+#include "core/file_sys/vfs/vfs_offset.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+
+namespace FileSys {
+namespace {
+using namespace Common::Literals;
+
+constexpr u32 CacheMagic = Common::MakeMagic('L', 'F', 'S', 'C');
+constexpr u32 CacheVersion = 1;
+
+/// Files that come from neither the base RomFS nor a layer, the built tables and IPS patched
+/// files, are saved in the cache up to this size. Anything bigger isn't worth caching.
+constexpr u64 MaxEmbeddedSize = 64_MiB;
+
+/// The metadata tables of the base RomFS are hashed into the fingerprint up to this size
+constexpr u64 MaxBaseMetadataSize = 64_MiB;
+
+constexpr u32 SourceBase = 0xFFFFFFFF;
+constexpr u32 SourceEmbedded = 0xFFFFFFFE;
+
+struct CacheHeader {
+    u32 magic;
+    u32 version;
+    u64 fingerprint;
+    u64 num_entries;
+};
+static_assert(sizeof(CacheHeader) == 0x18, "CacheHeader has incorrect size.");
+
+struct CacheEntry {
+    u64 offset;
+    u64 size;
+    u64 source_offset;
+    u32 source;
+    u32 path_size;
+};
+static_assert(sizeof(CacheEntry) == 0x20, "CacheEntry has incorrect size.");
+
+struct RomFSTableLocation {
+    u64 offset;
+    u64 size;
+};
+
+struct RomFSHeader {
+    u64 header_size;
+    std::array<RomFSTableLocation, 4> tables;
+    u64 data_offset;
+};
+static_assert(sizeof(RomFSHeader) == 0x50, "RomFSHeader has incorrect size.");
+
+template <typename T>
+void AppendObject(std::vector<u8>& key, const T& object) {
+    const size_t offset = key.size();
+    key.resize(offset + sizeof(T));
+    std::memcpy(key.data() + offset, &object, sizeof(T));
+}
+
+void AppendString(std::vector<u8>& key, std::string_view string) {
+    AppendObject(key, static_cast<u64>(string.size()));
+    key.insert(key.end(), string.begin(), string.end());
+}
+
+/// Appends the names, sizes and modification times of everything under a host directory
+bool AppendHostDirectory(std::vector<u8>& key, const std::filesystem::path& root) {
+    if (!Common::FS::IsDir(root)) {
+        return false;
+    }
+
+    std::vector<std::tuple<std::string, u64, s64>> entries;
+    Common::FS::IterateDirEntriesRecursively(
+        root,
+        [&](const std::filesystem::directory_entry& entry) {
+            std::error_code ec;
+            const bool is_file = entry.is_regular_file(ec);
+            const u64 size = is_file ? static_cast<u64>(entry.file_size(ec)) : ~u64{0};
+            const s64 time = static_cast<s64>(entry.last_write_time(ec).time_since_epoch().count());
+            entries.emplace_back(
+                Common::FS::PathToUTF8String(entry.path().lexically_relative(root)), size, time);
+            return true;
+        },
+        Common::FS::DirEntryFilter::All);
+
+    std::ranges::sort(entries);
+    AppendObject(key, static_cast<u64>(entries.size()));
+    for (const auto& [name, size, time] : entries) {
+        AppendString(key, name);
+        AppendObject(key, size);
+        AppendObject(key, time);
+    }
+    return true;
+}
+
+/// Maps the files of a directory tree to their paths relative to its root
+void MapFilePaths(const VirtualDir& dir, const std::string& prefix,
+                  std::unordered_map<const VfsFile*, std::string>& out) {
+    for (const auto& file : dir->GetFiles()) {
+        out.emplace(file.get(), prefix + file->GetName());
+    }
+    for (const auto& subdir : dir->GetSubdirectories()) {
+        MapFilePaths(subdir, prefix + subdir->GetName() + '/', out);
+    }
+}
+
+/// Maps the files of an extracted RomFS to their offsets in the RomFS
+void MapFileOffsets(const VirtualDir& dir, std::unordered_map<const VfsFile*, u64>& out) {
+    for (const auto& file : dir->GetFiles()) {
+        if (const auto* const offset_file = dynamic_cast<const OffsetVfsFile*>(file.get())) {
+            out.emplace(file.get(), offset_file->GetOffset());
+        }
+    }
+    for (const auto& subdir : dir->GetSubdirectories()) {
+        MapFileOffsets(subdir, out);
+    }
+}
+} // Anonymous namespace
+
+RomFSBuildCache::RomFSBuildCache(std::filesystem::path path_, VirtualFile base_,
+                                 std::vector<VirtualDir> layers_,
+                                 std::vector<VirtualDir> ext_layers_)
+    : path{std::move(path_)}, base{std::move(base_)}, layers{std::move(layers_)},
+      ext_layers{std::move(ext_layers_)}, fingerprint{CalculateFingerprint()} {}
+
+RomFSBuildCache::~RomFSBuildCache() = default;
+
+std::optional<u64> RomFSBuildCache::CalculateFingerprint() const {
+    if (base == nullptr) {
+        return std::nullopt;
+    }
+
+    std::vector<u8> key;
+
+    // Files from the base RomFS are referenced by offset, only its layout matters
+    RomFSHeader header{};
+    if (base->ReadObject(&header) != sizeof(RomFSHeader) ||
+        header.header_size != sizeof(RomFSHeader)) {
+        return std::nullopt;
+    }
+    u64 metadata_begin = ~u64{0};
+    u64 metadata_end = 0;
+    for (const auto& table : header.tables) {
+        metadata_begin = std::min(metadata_begin, table.offset);
+        metadata_end = std::max(metadata_end, table.offset + table.size);
+    }
+    if (metadata_end < metadata_begin || metadata_end - metadata_begin > MaxBaseMetadataSize) {
+        return std::nullopt;
+    }
+    AppendObject(key, static_cast<u64>(base->GetSize()));
+    AppendObject(key, header);
+    const auto metadata = base->ReadBytes(metadata_end - metadata_begin, metadata_begin);
+    key.insert(key.end(), metadata.begin(), metadata.end());
+
+    // Mods are only looked at on the host, they're opened again when the cache is loaded
+    for (const auto* const layer_list : {&layers, &ext_layers}) {
+        AppendObject(key, static_cast<u64>(layer_list->size()));
+        for (const auto& layer : *layer_list) {
+            const std::string layer_path = layer->GetFullPath();
+            AppendString(key, layer_path);
+            if (!AppendHostDirectory(key, Common::FS::ToU8String(layer_path))) {
+                return std::nullopt;
+            }
+        }
+    }
+
+    return Common::CityHash64(reinterpret_cast<const char*>(key.data()), key.size());
+}
+
+VirtualFile RomFSBuildCache::Load() const {
+    if (!fingerprint) {
+        return nullptr;
+    }
+
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return nullptr;
+    }
+
+    CacheHeader header{};
+    if (!file.ReadObject(header) || header.magic != CacheMagic ||
+        header.version != CacheVersion || header.fingerprint != *fingerprint) {
+        return nullptr;
+    }
+
+    std::vector<std::pair<u64, VirtualFile>> entries;
+    entries.reserve(header.num_entries);
+    for (u64 i = 0; i < header.num_entries; ++i) {
+        CacheEntry entry{};
+        if (!file.ReadObject(entry)) {
+            return nullptr;
+        }
+
+        VirtualFile source;
+        if (entry.source == SourceBase) {
+            source = std::make_shared<OffsetVfsFile>(base, entry.size, entry.source_offset);
+        } else if (entry.source == SourceEmbedded) {
+            if (entry.size > MaxEmbeddedSize) {
+                return nullptr;
+            }
+            std::vector<u8> data(entry.size);
+            if (file.ReadSpan<u8>(data) != data.size()) {
+                return nullptr;
+            }
+            source = std::make_shared<VectorVfsFile>(std::move(data));
+        } else {
+            std::string relative_path(entry.path_size, '\0');
+            if (entry.source >= layers.size() ||
+                file.ReadSpan<char>(relative_path) != relative_path.size()) {
+                return nullptr;
+            }
+            source = layers[entry.source]->GetFileRelative(relative_path);
+        }
+
+        if (source == nullptr || source->GetSize() != entry.size) {
+            LOG_WARNING(Loader, "LayeredFS cache is out of date, rebuilding");
+            return nullptr;
+        }
+        entries.emplace_back(entry.offset, std::move(source));
+    }
+
+    std::string name = layers.empty() ? std::string{} : layers.front()->GetName();
+    return ConcatenatedVfsFile::MakeConcatenatedFile(0, std::move(name), std::move(entries));
+}
+
+void RomFSBuildCache::Save(const std::vector<std::pair<u64, VirtualFile>>& entries,
+                           std::span<const VirtualDir> built_layers,
+                           const VirtualDir& extracted_base) const {
+    if (!fingerprint || built_layers.size() != layers.size()) {
+        return;
+    }
+
+    std::vector<std::unordered_map<const VfsFile*, std::string>> layer_paths(built_layers.size());
+    for (size_t i = 0; i < built_layers.size(); ++i) {
+        MapFilePaths(built_layers[i], "", layer_paths[i]);
+    }
+    std::unordered_map<const VfsFile*, u64> base_offsets;
+    MapFileOffsets(extracted_base, base_offsets);
+
+    // Serialize everything first, so a file that can't be described doesn't leave a broken cache
+    std::vector<u8> data;
+    AppendObject(data, CacheHeader{
+                           .magic = CacheMagic,
+                           .version = CacheVersion,
+                           .fingerprint = *fingerprint,
+                           .num_entries = entries.size(),
+                       });
+    for (const auto& [offset, source] : entries) {
+        CacheEntry entry{
+            .offset = offset,
+            .size = source->GetSize(),
+            .source_offset = 0,
+            .source = SourceEmbedded,
+            .path_size = 0,
+        };
+        std::string_view relative_path;
+        if (const auto it = base_offsets.find(source.get()); it != base_offsets.end()) {
+            entry.source = SourceBase;
+            entry.source_offset = it->second;
+        } else {
+            for (size_t i = 0; i < layer_paths.size(); ++i) {
+                if (const auto layer_it = layer_paths[i].find(source.get());
+                    layer_it != layer_paths[i].end()) {
+                    entry.source = static_cast<u32>(i);
+                    relative_path = layer_it->second;
+                    entry.path_size = static_cast<u32>(relative_path.size());
+                    break;
+                }
+            }
+        }
+
+        if (entry.source == SourceEmbedded && entry.size > MaxEmbeddedSize) {
+            LOG_DEBUG(Loader, "Not caching LayeredFS build with a large patched file");
+            return;
+        }
+
+        AppendObject(data, entry);
+        if (entry.source == SourceEmbedded) {
+            const auto contents = source->ReadAllBytes();
+            data.insert(data.end(), contents.begin(), contents.end());
+        } else {
+            data.insert(data.end(), relative_path.begin(), relative_path.end());
+        }
+    }
+
+    if (!Common::FS::CreateParentDirs(path)) {
+        return;
+    }
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen() || file.WriteSpan<u8>(data) != data.size()) {
+        LOG_ERROR(Loader, "Failed to write the LayeredFS cache to {}",
+                  Common::FS::PathToUTF8String(path));
+    }
+}
+
+} // namespace FileSys
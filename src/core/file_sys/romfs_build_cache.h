@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/file_sys/vfs/vfs_types.h"
+
+namespace FileSys {
+
+/**
+ * Layout of a LayeredFS RomFS saved between boots. When neither the base RomFS layout nor the
+ * names, sizes and modification times of the mod files changed, the RomFS is put back together
+ * from the saved tables without extracting the base RomFS or walking the mods through the VFS.
+ */
+class RomFSBuildCache {
+public:
+    /**
+     * @param path       File the layout is saved to
+     * @param base       Base RomFS the mods apply to
+     * @param layers     Host directories providing files, in priority order
+     * @param ext_layers Host directories providing stubs and IPS patches
+     */
+    explicit RomFSBuildCache(std::filesystem::path path, VirtualFile base,
+                             std::vector<VirtualDir> layers, std::vector<VirtualDir> ext_layers);
+    ~RomFSBuildCache();
+
+    /// Returns the RomFS built from the saved layout, or nullptr if its inputs changed
+    [[nodiscard]] VirtualFile Load() const;
+
+    /**
+     * Saves the layout of a RomFS built from the inputs.
+     *
+     * @param entries        Output of RomFSBuildContext::Build
+     * @param built_layers   Directories the RomFS was built from, one for every layer
+     * @param extracted_base Base RomFS extracted with ExtractRomFS
+     */
+    void Save(const std::vector<std::pair<u64, VirtualFile>>& entries,
+              std::span<const VirtualDir> built_layers, const VirtualDir& extracted_base) const;
+
+private:
+    [[nodiscard]] std::optional<u64> CalculateFingerprint() const;
+
+    std::filesystem::path path;
+    VirtualFile base;
+    std::vector<VirtualDir> layers;
+    std::vector<VirtualDir> ext_layers;
+    std::optional<u64> fingerprint;
+};
+
+} // namespace FileSys
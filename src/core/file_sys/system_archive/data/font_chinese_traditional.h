@@ -4,9 +4,12 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 222236> FONT_CHINESE_TRADITIONAL;
+/// Zstandard compressed font, decompressed when the system archive is synthesized
+extern const std::array<unsigned char, 75010> FONT_CHINESE_TRADITIONAL;
+constexpr std::size_t FONT_CHINESE_TRADITIONAL_SIZE{222236};
 
 } // namespace FileSys::SystemArchive::SharedFontData
@@ -4,9 +4,12 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 293516> FONT_EXTENDED_CHINESE_SIMPLIFIED;
+/// Zstandard compressed font, decompressed when the system archive is synthesized
+extern const std::array<unsigned char, 109826> FONT_EXTENDED_CHINESE_SIMPLIFIED;
+constexpr std::size_t FONT_EXTENDED_CHINESE_SIMPLIFIED_SIZE{293516};
 
 } // namespace FileSys::SystemArchive::SharedFontData
@@ -5,384 +5,231 @@
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-const std::array<unsigned char, 6024> FONT_NINTENDO_EXTENDED{{
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x00, 0x03, 0x00, 0x60, 0x4F, 0x53, 0x2F, 0x32,
-    0x34, 0x00, 0x1E, 0x26, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6D, 0x61, 0x70,
-    0xC1, 0xE7, 0xC8, 0xF3, 0x00, 0x00, 0x02, 0x0C, 0x00, 0x00, 0x01, 0x72, 0x63, 0x76, 0x74, 0x20,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x66, 0x70, 0x67, 0x6D,
-    0x06, 0x59, 0x9C, 0x37, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0x73, 0x67, 0x61, 0x73, 0x70,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x17, 0x80, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6C, 0x79, 0x66,
-    0x50, 0x0B, 0xEA, 0xFA, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0F, 0x04, 0x68, 0x65, 0x61, 0x64,
-    0x18, 0x65, 0x81, 0x09, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-    0x09, 0x88, 0x03, 0x86, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6D, 0x74, 0x78,
-    0x0A, 0xF0, 0x01, 0x94, 0x00, 0x00, 0x01, 0xC8, 0x00, 0x00, 0x00, 0x42, 0x6C, 0x6F, 0x63, 0x61,
-    0x34, 0x80, 0x30, 0x6E, 0x00, 0x00, 0x05, 0x14, 0x00, 0x00, 0x00, 0x3A, 0x6D, 0x61, 0x78, 0x70,
-    0x02, 0x2C, 0x00, 0x72, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x00, 0x20, 0x6E, 0x61, 0x6D, 0x65,
-    0xDB, 0xC5, 0x42, 0x4D, 0x00, 0x00, 0x14, 0x54, 0x00, 0x00, 0x01, 0xFE, 0x70, 0x6F, 0x73, 0x74,
-    0xF4, 0xB4, 0xAC, 0xAB, 0x00, 0x00, 0x16, 0x54, 0x00, 0x00, 0x01, 0x2A, 0x70, 0x72, 0x65, 0x70,
-    0x1C, 0xFC, 0x7D, 0x9C, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0xC9, 0x16, 0x5B, 0x71, 0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x0B, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xD9, 0x44, 0x2F, 0x5D, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x02, 0x0D, 0xA7,
-    0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x9A, 0xFF, 0x80, 0x02, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xEC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x71,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xC4, 0x01, 0x90, 0x00, 0x05,
-    0x00, 0x04, 0x00, 0xD2, 0x00, 0xD2, 0x00, 0x00, 0x01, 0x26, 0x00, 0xD2, 0x00, 0xD2, 0x00, 0x00,
-    0x03, 0xDA, 0x00, 0x68, 0x02, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0xC0, 0x00, 0x0D, 0xE0, 0xF0, 0x03, 0x9A, 0xFF, 0x80,
-    0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x02, 0xCD, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x04, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14,
-    0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14,
-    0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14,
-    0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x20, 0xE0, 0xA9, 0xE0, 0xB4,
-    0xE0, 0xE9, 0xE0, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x20, 0xE0, 0xA0,
-    0xE0, 0xB3, 0xE0, 0xE0, 0xE0, 0xEF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF5, 0xFF, 0xE3, 0x1F, 0x64,
-    0x1F, 0x5B, 0x1F, 0x30, 0x1F, 0x2B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x2C, 0x4B, 0xB8, 0x00, 0x09, 0x50, 0x58, 0xB1, 0x01, 0x01, 0x8E, 0x59, 0xB8,
-    0x01, 0xFF, 0x85, 0xB8, 0x00, 0x44, 0x1D, 0xB9, 0x00, 0x09, 0x00, 0x03, 0x5F, 0x5E, 0x2D, 0xB8,
-    0x00, 0x01, 0x2C, 0x20, 0x20, 0x45, 0x69, 0x44, 0xB0, 0x01, 0x60, 0x2D, 0xB8, 0x00, 0x02, 0x2C,
-    0xB8, 0x00, 0x01, 0x2A, 0x21, 0x2D, 0xB8, 0x00, 0x03, 0x2C, 0x20, 0x46, 0xB0, 0x03, 0x25, 0x46,
-    0x52, 0x58, 0x23, 0x59, 0x20, 0x8A, 0x20, 0x8A, 0x49, 0x64, 0x8A, 0x20, 0x46, 0x20, 0x68, 0x61,
-    0x64, 0xB0, 0x04, 0x25, 0x46, 0x20, 0x68, 0x61, 0x64, 0x52, 0x58, 0x23, 0x65, 0x8A, 0x59, 0x2F,
-    0x20, 0xB0, 0x00, 0x53, 0x58, 0x69, 0x20, 0xB0, 0x00, 0x54, 0x58, 0x21, 0xB0, 0x40, 0x59, 0x1B,
-    0x69, 0x20, 0xB0, 0x00, 0x54, 0x58, 0x21, 0xB0, 0x40, 0x65, 0x59, 0x59, 0x3A, 0x2D, 0xB8, 0x00,
-    0x04, 0x2C, 0x20, 0x46, 0xB0, 0x04, 0x25, 0x46, 0x52, 0x58, 0x23, 0x8A, 0x59, 0x20, 0x46, 0x20,
-    0x6A, 0x61, 0x64, 0xB0, 0x04, 0x25, 0x46, 0x20, 0x6A, 0x61, 0x64, 0x52, 0x58, 0x23, 0x8A, 0x59,
-    0x2F, 0xFD, 0x2D, 0xB8, 0x00, 0x05, 0x2C, 0x4B, 0x20, 0xB0, 0x03, 0x26, 0x50, 0x58, 0x51, 0x58,
-    0xB0, 0x80, 0x44, 0x1B, 0xB0, 0x40, 0x44, 0x59, 0x1B, 0x21, 0x21, 0x20, 0x45, 0xB0, 0xC0, 0x50,
-    0x58, 0xB0, 0xC0, 0x44, 0x1B, 0x21, 0x59, 0x59, 0x2D, 0xB8, 0x00, 0x06, 0x2C, 0x20, 0x20, 0x45,
-    0x69, 0x44, 0xB0, 0x01, 0x60, 0x20, 0x20, 0x45, 0x7D, 0x69, 0x18, 0x44, 0xB0, 0x01, 0x60, 0x2D,
-    0xB8, 0x00, 0x07, 0x2C, 0xB8, 0x00, 0x06, 0x2A, 0x2D, 0xB8, 0x00, 0x08, 0x2C, 0x4B, 0x20, 0xB0,
-    0x03, 0x26, 0x53, 0x58, 0xB0, 0x40, 0x1B, 0xB0, 0x00, 0x59, 0x8A, 0x8A, 0x20, 0xB0, 0x03, 0x26,
-    0x53, 0x58, 0x23, 0x21, 0xB0, 0x80, 0x8A, 0x8A, 0x1B, 0x8A, 0x23, 0x59, 0x20, 0xB0, 0x03, 0x26,
-    0x53, 0x58, 0x23, 0x21, 0xB8, 0x00, 0xC0, 0x8A, 0x8A, 0x1B, 0x8A, 0x23, 0x59, 0x20, 0xB0, 0x03,
-    0x26, 0x53, 0x58, 0x23, 0x21, 0xB8, 0x01, 0x00, 0x8A, 0x8A, 0x1B, 0x8A, 0x23, 0x59, 0x20, 0xB0,
-    0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xB8, 0x01, 0x40, 0x8A, 0x8A, 0x1B, 0x8A, 0x23, 0x59, 0x20,
-    0xB8, 0x00, 0x03, 0x26, 0x53, 0x58, 0xB0, 0x03, 0x25, 0x45, 0xB8, 0x01, 0x80, 0x50, 0x58, 0x23,
-    0x21, 0xB8, 0x01, 0x80, 0x23, 0x21, 0x1B, 0xB0, 0x03, 0x25, 0x45, 0x23, 0x21, 0x23, 0x21, 0x59,
-    0x1B, 0x21, 0x59, 0x44, 0x2D, 0xB8, 0x00, 0x09, 0x2C, 0x4B, 0x53, 0x58, 0x45, 0x44, 0x1B, 0x21,
-    0x21, 0x59, 0x2D, 0x00, 0xB8, 0x00, 0x00, 0x2B, 0x00, 0xBA, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07,
-    0x2B, 0xB8, 0x00, 0x00, 0x20, 0x45, 0x7D, 0x69, 0x18, 0x44, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x70,
-    0x00, 0xDC, 0x01, 0x34, 0x01, 0x7C, 0x01, 0xA2, 0x01, 0xF4, 0x02, 0x3C, 0x02, 0xA8, 0x03, 0x4C,
-    0x03, 0xE2, 0x04, 0x20, 0x04, 0x58, 0x04, 0x9A, 0x04, 0xEE, 0x05, 0x32, 0x05, 0x64, 0x05, 0x80,
-    0x05, 0xC6, 0x05, 0xF6, 0x06, 0x54, 0x06, 0xB2, 0x07, 0x38, 0x07, 0x60, 0x07, 0x82, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0xA4, 0xFF, 0xFF, 0x03, 0x5C, 0x03, 0x09, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
-    0x13, 0x11, 0x21, 0x11, 0x25, 0x21, 0x11, 0x21, 0xCD, 0x02, 0x66, 0xFD, 0x71, 0x02, 0xB8, 0xFD,
-    0x48, 0x02, 0xE0, 0xFD, 0x48, 0x02, 0xB8, 0x29, 0xFC, 0xF6, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14,
-    0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x39, 0x00, 0x00,
-    0x00, 0x22, 0x0E, 0x02, 0x14, 0x1E, 0x02, 0x32, 0x3E, 0x02, 0x34, 0x2E, 0x01, 0x24, 0x32, 0x1E,
-    0x02, 0x14, 0x0E, 0x02, 0x22, 0x2E, 0x02, 0x34, 0x3E, 0x01, 0x13, 0x12, 0x37, 0x33, 0x13, 0x12,
-    0x15, 0x16, 0x23, 0x2F, 0x01, 0x23, 0x07, 0x23, 0x22, 0x26, 0x25, 0x30, 0x27, 0x26, 0x2F, 0x01,
-    0x06, 0x07, 0x06, 0x32, 0x02, 0x5A, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77,
-    0x46, 0x46, 0x77, 0xFE, 0x9E, 0xC8, 0xB7, 0x83, 0x4E, 0x4E, 0x83, 0xB7, 0xC8, 0xB7, 0x83, 0x4E,
-    0x4E, 0x83, 0x23, 0x6C, 0x5E, 0x6D, 0x68, 0x68, 0x01, 0x39, 0x38, 0x2E, 0xD1, 0x2B, 0x37, 0x33,
-    0x04, 0x01, 0x48, 0x1D, 0x1C, 0x0A, 0x05, 0x01, 0x45, 0x01, 0x89, 0x03, 0x3F, 0x46, 0x77, 0xA4,
-    0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x4E, 0x83, 0xB7, 0xC8, 0xB7,
-    0x83, 0x4E, 0x4E, 0x83, 0xB7, 0xC8, 0xB7, 0x83, 0xFD, 0x64, 0x01, 0x1A, 0xEB, 0xFE, 0xFE, 0xFE,
-    0xFD, 0x03, 0x01, 0x01, 0x77, 0x78, 0x01, 0xCF, 0x4C, 0x4C, 0x1C, 0x0C, 0x02, 0xBE, 0x02, 0x00,
-    0x00, 0x05, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x2F,
-    0x00, 0x3A, 0x00, 0x44, 0x00, 0x00, 0x12, 0x14, 0x1E, 0x02, 0x32, 0x3E, 0x02, 0x34, 0x2E, 0x02,
-    0x22, 0x0E, 0x01, 0x02, 0x10, 0x3E, 0x01, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x26, 0x01,
-    0x16, 0x17, 0x14, 0x06, 0x07, 0x06, 0x2B, 0x01, 0x19, 0x01, 0x17, 0x32, 0x17, 0x16, 0x17, 0x16,
-    0x07, 0x06, 0x0F, 0x01, 0x36, 0x37, 0x34, 0x2E, 0x01, 0x27, 0x23, 0x15, 0x33, 0x32, 0x27, 0x32,
-    0x37, 0x36, 0x26, 0x27, 0x26, 0x2B, 0x01, 0x15, 0x45, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46,
-    0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE,
-    0xF4, 0xE2, 0x01, 0xF7, 0x61, 0x01, 0x4E, 0x3E, 0x29, 0xAF, 0x4E, 0x81, 0x8B, 0x1D, 0x3C, 0x1F,
-    0x19, 0x04, 0x06, 0x39, 0x57, 0x44, 0x01, 0x1B, 0x2D, 0x51, 0x46, 0x46, 0x47, 0x66, 0x70, 0x16,
-    0x1F, 0x01, 0x2C, 0x08, 0x4B, 0x4C, 0x01, 0xDE, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4,
-    0xA4, 0x77, 0x46, 0x46, 0x77, 0xFE, 0x7C, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2,
-    0x84, 0x84, 0x01, 0x6D, 0x21, 0x5B, 0x40, 0x50, 0x05, 0x03, 0x01, 0x03, 0x01, 0x05, 0x01, 0x05,
-    0x09, 0x30, 0x25, 0x29, 0x40, 0x21, 0xC2, 0x06, 0x3E, 0x1A, 0x21, 0x0B, 0x01, 0x8C, 0xE1, 0x0A,
-    0x0E, 0x54, 0x0B, 0x02, 0x79, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC,
-    0x03, 0x70, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x38, 0x00, 0x00, 0x12, 0x14, 0x1E, 0x02, 0x32, 0x3E,
-    0x02, 0x34, 0x2E, 0x02, 0x22, 0x0E, 0x01, 0x02, 0x10, 0x3E, 0x01, 0x20, 0x1E, 0x01, 0x10, 0x0E,
-    0x01, 0x20, 0x26, 0x36, 0x34, 0x3F, 0x01, 0x27, 0x26, 0x27, 0x33, 0x17, 0x16, 0x33, 0x36, 0x3F,
-    0x02, 0x32, 0x14, 0x06, 0x16, 0x12, 0x14, 0x2B, 0x01, 0x27, 0x26, 0x06, 0x0F, 0x01, 0x23, 0x45,
-    0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x84, 0xE2,
-    0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x7B, 0x58, 0x58, 0x4D, 0x4F, 0x05, 0x7A,
-    0x34, 0x34, 0x02, 0x01, 0x33, 0x32, 0x3C, 0x3C, 0xA1, 0x01, 0xB0, 0x3E, 0x3F, 0x39, 0x3B, 0x02,
-    0x3A, 0x38, 0x3F, 0x01, 0xDE, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46,
-    0x46, 0x77, 0xFE, 0x7C, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x60,
-    0x02, 0x87, 0x88, 0x79, 0x7A, 0x06, 0x54, 0x54, 0x01, 0x53, 0x53, 0x01, 0x01, 0xFB, 0x04, 0xFE,
-    0xF8, 0x02, 0x5B, 0x5A, 0x03, 0x59, 0x59, 0x00, 0x00, 0x03, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC,
-    0x03, 0x70, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x22, 0x0E, 0x02, 0x14, 0x1E,
-    0x02, 0x32, 0x3E, 0x02, 0x34, 0x2E, 0x01, 0x24, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E,
-    0x01, 0x10, 0x36, 0x01, 0x35, 0x27, 0x26, 0x34, 0x3B, 0x01, 0x17, 0x16, 0x36, 0x3F, 0x01, 0x33,
-    0x03, 0x15, 0x23, 0x02, 0x5A, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46,
-    0x46, 0x77, 0xFE, 0x7C, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x01,
-    0x36, 0x5E, 0x5F, 0x3C, 0x3D, 0x3D, 0x3D, 0x03, 0x3B, 0x3B, 0x77, 0xBE, 0x68, 0x03, 0x3F, 0x46,
-    0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x84, 0xE2, 0xFE,
-    0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFD, 0xF9, 0x6E, 0x96, 0x95, 0x01, 0x67, 0x67,
-    0x03, 0x66, 0x65, 0xFE, 0xD3, 0xDA, 0x00, 0x00, 0x00, 0x03, 0x00, 0x14, 0xFF, 0xBD, 0x03, 0xEC,
-    0x03, 0x4B, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x12, 0x00, 0x00, 0x01, 0x21, 0x22, 0x15, 0x30, 0x11,
-    0x21, 0x17, 0x21, 0x11, 0x10, 0x25, 0x21, 0x01, 0x11, 0x33, 0x11, 0x21, 0x15, 0x03, 0xBB, 0xFD,
-    0x77, 0xED, 0x03, 0x76, 0x31, 0xFC, 0x28, 0x01, 0x1E, 0x02, 0xBA, 0xFD, 0x5C, 0x68, 0x01, 0x08,
-    0x03, 0x1A, 0xEE, 0xFD, 0xC2, 0x31, 0x02, 0x6F, 0x01, 0x1E, 0x01, 0xFD, 0x36, 0x02, 0x07, 0xFE,
-    0x50, 0x57, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0xFF, 0xBD, 0x03, 0xEC, 0x03, 0x4B, 0x00, 0x06,
-    0x00, 0x0C, 0x00, 0x27, 0x00, 0x32, 0x00, 0x00, 0x05, 0x11, 0x34, 0x27, 0x30, 0x21, 0x11, 0x07,
-    0x11, 0x21, 0x20, 0x19, 0x01, 0x25, 0x11, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x07,
-    0x06, 0x07, 0x06, 0x07, 0x1E, 0x02, 0x15, 0x07, 0x23, 0x27, 0x2E, 0x01, 0x2F, 0x01, 0x15, 0x13,
-    0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x23, 0x15, 0x33, 0x36, 0x03, 0xBB, 0xED, 0xFD, 0x77, 0x31,
-    0x02, 0xBA, 0x01, 0x1E, 0xFD, 0x2A, 0x77, 0x76, 0x15, 0x49, 0x20, 0x35, 0x08, 0x04, 0x06, 0x13,
-    0x66, 0x0C, 0x01, 0x1F, 0x2E, 0x65, 0x3D, 0x3D, 0x2A, 0x56, 0x28, 0x2E, 0x19, 0x99, 0x3C, 0x20,
-    0x10, 0x56, 0x4F, 0x46, 0x47, 0x12, 0x02, 0x3E, 0xED, 0x01, 0xFC, 0xD4, 0x31, 0x03, 0x8E, 0xFE,
-    0xE1, 0xFD, 0x91, 0xC4, 0x02, 0x07, 0x01, 0x04, 0x13, 0x21, 0x44, 0x1D, 0x19, 0x58, 0x15, 0x02,
-    0x01, 0x13, 0x2D, 0xA2, 0x01, 0x01, 0x3D, 0x81, 0x1A, 0x01, 0x01, 0xDA, 0x01, 0x2D, 0x08, 0x3A,
-    0x29, 0x0F, 0x08, 0x01, 0x85, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0xFF, 0xF5, 0x03, 0xEC,
-    0x03, 0x13, 0x00, 0x09, 0x00, 0x11, 0x00, 0x26, 0x00, 0x32, 0x00, 0x00, 0x37, 0x21, 0x34, 0x10,
-    0x35, 0x34, 0x27, 0x21, 0x04, 0x11, 0x23, 0x10, 0x25, 0x21, 0x16, 0x15, 0x11, 0x21, 0x37, 0x35,
-    0x37, 0x36, 0x22, 0x2B, 0x01, 0x3D, 0x01, 0x3B, 0x01, 0x1D, 0x01, 0x0F, 0x01, 0x3B, 0x01, 0x1D,
-    0x01, 0x2B, 0x01, 0x25, 0x35, 0x3B, 0x01, 0x1D, 0x01, 0x3B, 0x01, 0x1D, 0x01, 0x2B, 0x01, 0x45,
-    0x03, 0x76, 0x45, 0xFE, 0x2D, 0xFE, 0xA2, 0x31, 0x01, 0x8F, 0x01, 0xD3, 0x76, 0xFC, 0x28, 0xA7,
-    0x68, 0x68, 0x01, 0x5B, 0x5D, 0x90, 0x91, 0x6C, 0x6D, 0x71, 0x70, 0xA0, 0xA0, 0x01, 0x75, 0x27,
-    0x28, 0x63, 0x63, 0x8B, 0x8A, 0x27, 0x69, 0x01, 0xA4, 0x69, 0x44, 0x01, 0x02, 0xFE, 0xA4, 0x01,
-    0x8C, 0x03, 0x01, 0x75, 0xFD, 0x58, 0xBB, 0x24, 0x80, 0x80, 0x21, 0x21, 0x1F, 0x1E, 0x85, 0x86,
-    0x20, 0x22, 0xC3, 0xC3, 0xA1, 0xA3, 0x20, 0x22, 0x00, 0x05, 0x00, 0x14, 0xFF, 0xF5, 0x03, 0xEC,
-    0x03, 0x13, 0x00, 0x08, 0x00, 0x10, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x44, 0x00, 0x00, 0x37, 0x21,
-    0x11, 0x10, 0x25, 0x30, 0x21, 0x06, 0x15, 0x03, 0x11, 0x34, 0x37, 0x21, 0x04, 0x19, 0x01, 0x01,
-    0x35, 0x17, 0x32, 0x17, 0x16, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x16, 0x23, 0x2F, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x15, 0x23, 0x37, 0x32, 0x36, 0x37, 0x36, 0x35,
-    0x26, 0x27, 0x26, 0x2B, 0x01, 0x15, 0x05, 0x35, 0x37, 0x36, 0x26, 0x2B, 0x01, 0x35, 0x21, 0x15,
-    0x03, 0x17, 0x15, 0x45, 0x03, 0x76, 0xFE, 0xA2, 0xFE, 0x2D, 0x45, 0x31, 0x76, 0x01, 0xD3, 0x01,
-    0x8F, 0xFE, 0x1E, 0x65, 0x6F, 0x15, 0x46, 0x10, 0x05, 0x04, 0x0D, 0x4F, 0x09, 0x09, 0x1F, 0x1D,
-    0x3A, 0x06, 0x01, 0x30, 0x2F, 0x22, 0x37, 0x1E, 0x29, 0x14, 0x4E, 0x82, 0x34, 0x19, 0x0E, 0x13,
-    0x0A, 0x22, 0x07, 0x38, 0x37, 0xFE, 0x3E, 0x68, 0x68, 0x01, 0x5C, 0x5C, 0x01, 0x20, 0xD8, 0xE1,
-    0x27, 0x01, 0x5D, 0x01, 0x5B, 0x03, 0x01, 0x44, 0xFD, 0x58, 0x02, 0xA8, 0x75, 0x01, 0x03, 0xFE,
-    0x74, 0xFE, 0x71, 0x01, 0x5C, 0xC5, 0x01, 0x04, 0x0C, 0x43, 0x15, 0x1D, 0x44, 0x10, 0x04, 0x06,
-    0x14, 0x2B, 0x56, 0x10, 0x01, 0x01, 0x34, 0x52, 0x1C, 0x01, 0x01, 0xA5, 0xE3, 0x04, 0x06, 0x0A,
-    0x20, 0x2C, 0x04, 0x01, 0x65, 0xE3, 0x47, 0x80, 0x80, 0x01, 0x42, 0x3D, 0xFE, 0xF5, 0x01, 0x41,
-    0x00, 0x04, 0x00, 0x14, 0x00, 0x52, 0x03, 0xEC, 0x02, 0xB6, 0x00, 0x08, 0x00, 0x16, 0x00, 0x64,
-    0x00, 0x70, 0x00, 0x00, 0x25, 0x11, 0x21, 0x22, 0x15, 0x30, 0x15, 0x14, 0x33, 0x11, 0x21, 0x32,
-    0x15, 0x11, 0x14, 0x27, 0x21, 0x22, 0x26, 0x3D, 0x01, 0x34, 0x36, 0x13, 0x26, 0x27, 0x26, 0x27,
-    0x26, 0x37, 0x33, 0x36, 0x37, 0x36, 0x33, 0x16, 0x17, 0x16, 0x17, 0x16, 0x37, 0x36, 0x37, 0x36,
-    0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x34, 0x37, 0x36, 0x37,
-    0x36, 0x37, 0x36, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x0F, 0x01, 0x22, 0x06, 0x23,
-    0x27, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16,
-    0x17, 0x16, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x27, 0x37, 0x35, 0x3B, 0x01, 0x1D, 0x01, 0x3B,
-    0x01, 0x1D, 0x01, 0x2B, 0x01, 0x03, 0xBB, 0xFD, 0x2A, 0xA0, 0xA0, 0x02, 0xEE, 0x19, 0x19, 0xFD,
-    0x12, 0x57, 0x7A, 0x7A, 0xCA, 0x38, 0x1D, 0x16, 0x08, 0x03, 0x01, 0x02, 0x0F, 0x0C, 0x1E, 0x01,
-    0x02, 0x04, 0x0C, 0x2B, 0x0F, 0x0E, 0x18, 0x0C, 0x09, 0x04, 0x15, 0x32, 0x23, 0x12, 0x1C, 0x0E,
-    0x09, 0x03, 0x01, 0x01, 0x09, 0x21, 0x0F, 0x14, 0x2E, 0x2A, 0x13, 0x0F, 0x0C, 0x08, 0x0B, 0x05,
-    0x02, 0x01, 0x02, 0x03, 0x36, 0x03, 0x02, 0x03, 0x08, 0x0D, 0x23, 0x16, 0x0E, 0x10, 0x01, 0x01,
-    0x07, 0x0B, 0x32, 0x25, 0x13, 0x26, 0x0F, 0x09, 0x01, 0x01, 0x0F, 0x11, 0x24, 0x21, 0x2A, 0xE3,
-    0x20, 0x20, 0x52, 0x50, 0x71, 0x71, 0x84, 0x02, 0x00, 0xAF, 0xA2, 0xAF, 0x02, 0x32, 0x19, 0xFD,
-    0xCE, 0x19, 0x01, 0x84, 0x5C, 0xA2, 0x5C, 0x85, 0xFE, 0x29, 0x04, 0x1E, 0x18, 0x26, 0x0F, 0x01,
-    0x02, 0x01, 0x03, 0x05, 0x0B, 0x29, 0x06, 0x02, 0x03, 0x04, 0x11, 0x0B, 0x0D, 0x0A, 0x06, 0x12,
-    0x0D, 0x0A, 0x07, 0x0C, 0x18, 0x0D, 0x10, 0x06, 0x18, 0x05, 0x27, 0x14, 0x09, 0x03, 0x0A, 0x0D,
-    0x06, 0x09, 0x09, 0x0D, 0x0F, 0x14, 0x0C, 0x06, 0x03, 0x02, 0x04, 0x10, 0x0A, 0x11, 0x08, 0x09,
-    0x0E, 0x0C, 0x07, 0x0C, 0x0C, 0x0A, 0x07, 0x0F, 0x20, 0x11, 0x18, 0x1E, 0x1A, 0x1E, 0x0C, 0x0B,
-    0x03, 0xAA, 0xA5, 0x89, 0x8A, 0x1C, 0x1B, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x53, 0x03, 0xEC,
-    0x02, 0xB6, 0x00, 0x08, 0x00, 0x16, 0x00, 0x2E, 0x00, 0x38, 0x00, 0x65, 0x00, 0x00, 0x01, 0x30,
-    0x21, 0x11, 0x21, 0x32, 0x3D, 0x01, 0x34, 0x27, 0x32, 0x16, 0x1D, 0x01, 0x14, 0x06, 0x23, 0x21,
-    0x26, 0x35, 0x11, 0x34, 0x33, 0x01, 0x11, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x07, 0x06, 0x07,
-    0x17, 0x1E, 0x01, 0x1F, 0x01, 0x23, 0x2A, 0x01, 0x2E, 0x01, 0x23, 0x27, 0x15, 0x37, 0x32, 0x37,
-    0x36, 0x27, 0x2E, 0x01, 0x2B, 0x01, 0x15, 0x05, 0x26, 0x27, 0x37, 0x32, 0x3F, 0x01, 0x16, 0x17,
-    0x1E, 0x01, 0x37, 0x36, 0x27, 0x2E, 0x04, 0x37, 0x3E, 0x01, 0x33, 0x32, 0x17, 0x16, 0x17, 0x14,
-    0x06, 0x27, 0x26, 0x27, 0x26, 0x0E, 0x01, 0x1E, 0x02, 0x17, 0x16, 0x06, 0x07, 0x06, 0x07, 0x06,
-    0x03, 0x1B, 0xFD, 0x2A, 0x02, 0xD6, 0xA0, 0xA0, 0x57, 0x7A, 0x7A, 0x57, 0xFD, 0x12, 0x19, 0x19,
-    0x01, 0xD3, 0x47, 0x44, 0x11, 0x3E, 0x18, 0x21, 0x0B, 0x0C, 0x43, 0x04, 0x17, 0x1C, 0x1E, 0x16,
-    0x26, 0x26, 0x03, 0x4D, 0x18, 0x1E, 0x11, 0x25, 0x3A, 0x0C, 0x22, 0x08, 0x03, 0x1B, 0x3E, 0x29,
-    0xFE, 0xAC, 0x0D, 0x04, 0x02, 0x02, 0x1E, 0x1D, 0x03, 0x02, 0x0C, 0x4C, 0x13, 0x20, 0x07, 0x04,
-    0x1B, 0x56, 0x2D, 0x1C, 0x01, 0x02, 0x44, 0x35, 0x49, 0x1F, 0x10, 0x03, 0x41, 0x01, 0x06, 0x0A,
-    0x16, 0x3C, 0x18, 0x0C, 0x16, 0x5D, 0x15, 0x33, 0x03, 0x2B, 0x1E, 0x34, 0x59, 0x02, 0x84, 0xFE,
-    0x00, 0xAF, 0xA2, 0xAF, 0x32, 0x85, 0x5C, 0xA2, 0x5C, 0x84, 0x01, 0x17, 0x02, 0x32, 0x19, 0xFE,
-    0x2F, 0x01, 0x45, 0x01, 0x02, 0x19, 0x22, 0x32, 0x39, 0x0B, 0x08, 0x0F, 0x27, 0x2F, 0x24, 0x75,
-    0x12, 0x01, 0x88, 0xBB, 0x04, 0x09, 0x2A, 0x0F, 0x0D, 0x53, 0x8A, 0x17, 0x1E, 0x04, 0x03, 0x03,
-    0x0C, 0x04, 0x26, 0x0E, 0x0C, 0x14, 0x1A, 0x0E, 0x0E, 0x16, 0x16, 0x2C, 0x1A, 0x2D, 0x2D, 0x2A,
-    0x16, 0x1D, 0x06, 0x04, 0x01, 0x1A, 0x09, 0x11, 0x09, 0x17, 0x18, 0x0D, 0x17, 0x0C, 0x1B, 0x71,
-    0x1B, 0x12, 0x01, 0x03, 0x00, 0x03, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0F,
-    0x00, 0x1B, 0x00, 0x27, 0x00, 0x00, 0x00, 0x22, 0x0E, 0x02, 0x14, 0x1E, 0x02, 0x32, 0x3E, 0x02,
-    0x34, 0x2E, 0x01, 0x24, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E, 0x01, 0x10, 0x36, 0x13,
-    0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x02, 0x5A, 0xB4, 0xA4, 0x77,
-    0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xFE, 0x7C, 0x01, 0x0C, 0xE2, 0x84,
-    0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x7C, 0xC5, 0x4E, 0xC5, 0xC4, 0x50, 0xC4, 0x03, 0x3F,
-    0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x84, 0xE2,
-    0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFE, 0xC0, 0xC4, 0xC5, 0x4E, 0xC5, 0xC5,
-    0x00, 0x03, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x22, 0x0E, 0x02, 0x14, 0x1E, 0x02, 0x32, 0x3E, 0x02, 0x34, 0x2E, 0x01, 0x24,
-    0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E, 0x01, 0x10, 0x36, 0x13, 0x35, 0x21, 0x15, 0x02,
-    0x5A, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xFE, 0x7C,
-    0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x7C, 0x01, 0xD8, 0x03, 0x3F,
-    0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x84, 0xE2,
-    0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFE, 0x71, 0x4E, 0x4E, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B, 0x00, 0x1B, 0x00, 0x25,
-    0x00, 0x00, 0x00, 0x20, 0x0E, 0x01, 0x10, 0x1E, 0x01, 0x20, 0x3E, 0x01, 0x10, 0x26, 0x01, 0x12,
-    0x37, 0x33, 0x13, 0x12, 0x15, 0x16, 0x23, 0x2F, 0x01, 0x23, 0x07, 0x23, 0x22, 0x26, 0x25, 0x30,
-    0x27, 0x26, 0x2F, 0x01, 0x06, 0x07, 0x06, 0x32, 0x02, 0x86, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2,
-    0x01, 0x0C, 0xE2, 0x84, 0x84, 0xFD, 0xA0, 0x6C, 0x5E, 0x6D, 0x68, 0x68, 0x01, 0x39, 0x38, 0x2E,
-    0xD1, 0x2B, 0x37, 0x33, 0x04, 0x01, 0x48, 0x1D, 0x1C, 0x0A, 0x05, 0x01, 0x45, 0x01, 0x89, 0x03,
-    0x70, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFD, 0x9A, 0x01, 0x1A,
-    0xEB, 0xFE, 0xFE, 0xFE, 0xFD, 0x03, 0x01, 0x01, 0x77, 0x78, 0x01, 0xCF, 0x4C, 0x4C, 0x1C, 0x0C,
-    0x02, 0xBE, 0x02, 0x00, 0x00, 0x04, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B,
-    0x00, 0x20, 0x00, 0x2B, 0x00, 0x35, 0x00, 0x00, 0x36, 0x10, 0x3E, 0x01, 0x20, 0x1E, 0x01, 0x10,
-    0x0E, 0x01, 0x20, 0x26, 0x01, 0x30, 0x37, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x26, 0x23, 0x27,
-    0x19, 0x01, 0x33, 0x32, 0x37, 0x3E, 0x01, 0x35, 0x26, 0x07, 0x06, 0x2B, 0x01, 0x35, 0x33, 0x1E,
-    0x02, 0x15, 0x06, 0x27, 0x23, 0x35, 0x33, 0x16, 0x17, 0x16, 0x14, 0x07, 0x06, 0x14, 0x84, 0xE2,
-    0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x01, 0xF7, 0x0A, 0x3A, 0x05, 0x04, 0x19,
-    0x20, 0x3B, 0x1D, 0x8B, 0x81, 0x4E, 0xAF, 0x29, 0x3E, 0x4E, 0x01, 0xAE, 0x0D, 0x47, 0x46, 0x46,
-    0x52, 0x2C, 0x1B, 0x01, 0xB7, 0x27, 0x4C, 0x4C, 0x07, 0x2C, 0x1E, 0x16, 0xFE, 0x01, 0x0C, 0xE2,
-    0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x01, 0x6D, 0x06, 0x21, 0x40, 0x2A, 0x24, 0x30,
-    0x09, 0x05, 0x01, 0xFE, 0xFB, 0xFE, 0xFD, 0x03, 0x05, 0x4F, 0x41, 0x5B, 0x9B, 0x01, 0x8C, 0x01,
-    0x0B, 0x21, 0x1A, 0x3E, 0xDA, 0x79, 0x01, 0x01, 0x0B, 0x54, 0x0E, 0x0A, 0x00, 0x02, 0x00, 0x14,
-    0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B, 0x00, 0x29, 0x00, 0x00, 0x36, 0x10, 0x3E, 0x01,
-    0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x26, 0x36, 0x14, 0x3B, 0x01, 0x37, 0x36, 0x37, 0x36,
-    0x1F, 0x01, 0x33, 0x32, 0x34, 0x02, 0x26, 0x36, 0x34, 0x23, 0x0F, 0x01, 0x06, 0x07, 0x22, 0x2F,
-    0x01, 0x23, 0x16, 0x1F, 0x01, 0x07, 0x14, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE,
-    0xF4, 0xE2, 0x7B, 0x3D, 0x3F, 0x38, 0x3A, 0x01, 0x02, 0x3A, 0x39, 0x3F, 0x3E, 0xB0, 0x01, 0xA1,
-    0x3C, 0x3C, 0x32, 0x33, 0x01, 0x02, 0x34, 0x34, 0x7A, 0x05, 0x4F, 0x4D, 0x58, 0xFE, 0x01, 0x0C,
-    0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x62, 0x02, 0x59, 0x59, 0x02, 0x01, 0x5A,
-    0x5B, 0x02, 0x01, 0x08, 0x04, 0xFB, 0x01, 0x01, 0x53, 0x53, 0x01, 0x54, 0x54, 0x06, 0x7A, 0x79,
-    0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B,
-    0x00, 0x1B, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E, 0x01, 0x10, 0x36,
-    0x01, 0x15, 0x33, 0x35, 0x13, 0x23, 0x07, 0x0E, 0x01, 0x2F, 0x01, 0x23, 0x22, 0x16, 0x1F, 0x01,
-    0x01, 0x7A, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x01, 0x36, 0x68,
-    0xBE, 0x77, 0x3B, 0x3C, 0x02, 0x3D, 0x3D, 0x3D, 0x3D, 0x01, 0x5F, 0x5E, 0x03, 0x70, 0x84, 0xE2,
-    0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFD, 0xF9, 0x6D, 0xDA, 0x01, 0x2D, 0x65,
-    0x66, 0x03, 0x67, 0x67, 0x01, 0x95, 0x96, 0x00, 0x00, 0x02, 0x00, 0x14, 0xFF, 0xBF, 0x03, 0xEC,
-    0x03, 0x4A, 0x00, 0x05, 0x00, 0x0B, 0x00, 0x00, 0x05, 0x21, 0x11, 0x10, 0x05, 0x21, 0x01, 0x21,
-    0x35, 0x21, 0x11, 0x23, 0x03, 0xEC, 0xFC, 0x28, 0x01, 0x14, 0x02, 0xC4, 0xFD, 0x5C, 0x01, 0x70,
-    0xFE, 0xF8, 0x68, 0x41, 0x02, 0x77, 0x01, 0x14, 0x01, 0xFD, 0x38, 0x57, 0x01, 0xB0, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x14, 0xFF, 0xBF, 0x03, 0xEC, 0x03, 0x49, 0x00, 0x05, 0x00, 0x20, 0x00, 0x2B,
-    0x00, 0x00, 0x17, 0x11, 0x21, 0x20, 0x19, 0x01, 0x25, 0x33, 0x35, 0x17, 0x1E, 0x01, 0x1F, 0x01,
-    0x33, 0x37, 0x2E, 0x02, 0x27, 0x34, 0x37, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26,
-    0x2B, 0x01, 0x05, 0x06, 0x2B, 0x01, 0x35, 0x33, 0x16, 0x17, 0x16, 0x15, 0x14, 0x14, 0x02, 0xC4,
-    0x01, 0x14, 0xFD, 0x2A, 0x69, 0x19, 0x2E, 0x28, 0x56, 0x2A, 0x3D, 0x3D, 0x01, 0x65, 0x2C, 0x20,
-    0x0D, 0x66, 0x13, 0x06, 0x04, 0x09, 0x34, 0x20, 0x49, 0x15, 0x76, 0x77, 0x01, 0x02, 0x0C, 0x47,
-    0x46, 0x4F, 0x56, 0x10, 0x20, 0x41, 0x03, 0x8A, 0xFE, 0xED, 0xFD, 0x89, 0xC2, 0xDA, 0x01, 0x01,
-    0x1A, 0x81, 0x3D, 0x01, 0x01, 0xA3, 0x2C, 0x13, 0x01, 0x02, 0x13, 0x5A, 0x1A, 0x1C, 0x44, 0x21,
-    0x13, 0x04, 0x01, 0xDA, 0x02, 0x85, 0x01, 0x08, 0x0F, 0x29, 0x3A, 0x00, 0x00, 0x03, 0x00, 0x14,
-    0xFF, 0xFB, 0x03, 0xEC, 0x03, 0x0E, 0x00, 0x08, 0x00, 0x15, 0x00, 0x1B, 0x00, 0x00, 0x05, 0x21,
-    0x11, 0x10, 0x21, 0x30, 0x21, 0x32, 0x15, 0x01, 0x21, 0x35, 0x23, 0x13, 0x35, 0x21, 0x15, 0x33,
-    0x32, 0x22, 0x0F, 0x01, 0x05, 0x21, 0x35, 0x23, 0x11, 0x23, 0x03, 0xEC, 0xFC, 0x28, 0x01, 0x8A,
-    0x01, 0xEC, 0x62, 0xFC, 0xCF, 0x01, 0x40, 0xE1, 0xD9, 0xFE, 0xDF, 0x5D, 0x5C, 0x01, 0x67, 0x68,
-    0x01, 0x75, 0x01, 0x15, 0xC6, 0x4F, 0x05, 0x01, 0x89, 0x01, 0x8A, 0x63, 0xFD, 0xE1, 0x42, 0x01,
-    0x0B, 0x3D, 0x42, 0x80, 0x80, 0x48, 0x42, 0x01, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14,
-    0xFF, 0xFB, 0x03, 0xEC, 0x03, 0x0E, 0x00, 0x07, 0x00, 0x22, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x00,
-    0x17, 0x11, 0x34, 0x37, 0x21, 0x20, 0x19, 0x01, 0x01, 0x15, 0x33, 0x35, 0x17, 0x1E, 0x01, 0x1F,
-    0x02, 0x32, 0x35, 0x26, 0x27, 0x26, 0x27, 0x26, 0x37, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x26,
-    0x23, 0x27, 0x17, 0x30, 0x23, 0x35, 0x33, 0x32, 0x17, 0x16, 0x17, 0x14, 0x07, 0x0E, 0x01, 0x05,
-    0x21, 0x35, 0x27, 0x13, 0x35, 0x21, 0x15, 0x33, 0x32, 0x14, 0x0F, 0x01, 0x14, 0x62, 0x01, 0xEC,
-    0x01, 0x8A, 0xFE, 0x1E, 0x4E, 0x14, 0x29, 0x1E, 0x37, 0x22, 0x2F, 0x2F, 0x06, 0x3A, 0x1D, 0x1F,
-    0x09, 0x09, 0x4E, 0x0E, 0x04, 0x05, 0x0F, 0x47, 0x15, 0x6F, 0x65, 0x82, 0x34, 0x37, 0x38, 0x07,
-    0x23, 0x09, 0x13, 0x0D, 0x1A, 0xFD, 0xD6, 0x01, 0x40, 0xE1, 0xD8, 0xFE, 0xE0, 0x5C, 0x5C, 0x67,
-    0x68, 0x05, 0x02, 0xB0, 0x62, 0x01, 0xFE, 0x76, 0xFE, 0x77, 0x01, 0x56, 0xC5, 0xA5, 0x01, 0x01,
-    0x1C, 0x52, 0x34, 0x01, 0x01, 0x0E, 0x58, 0x2C, 0x13, 0x06, 0x04, 0x0F, 0x45, 0x1E, 0x14, 0x42,
-    0x0D, 0x04, 0x01, 0xA7, 0x65, 0x01, 0x04, 0x2C, 0x21, 0x09, 0x07, 0x03, 0xE3, 0x41, 0x01, 0x01,
-    0x0B, 0x3D, 0x42, 0x01, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x14, 0x00, 0x5D, 0x03, 0xEC,
-    0x02, 0xAB, 0x00, 0x08, 0x00, 0x37, 0x00, 0x3D, 0x00, 0x00, 0x13, 0x30, 0x21, 0x11, 0x21, 0x22,
-    0x3D, 0x01, 0x34, 0x05, 0x37, 0x34, 0x27, 0x26, 0x27, 0x26, 0x07, 0x06, 0x07, 0x0E, 0x01, 0x17,
-    0x1E, 0x01, 0x17, 0x16, 0x14, 0x07, 0x06, 0x26, 0x27, 0x26, 0x27, 0x22, 0x06, 0x07, 0x22, 0x17,
-    0x1E, 0x01, 0x17, 0x16, 0x37, 0x36, 0x27, 0x26, 0x27, 0x2E, 0x02, 0x37, 0x36, 0x33, 0x32, 0x1F,
-    0x02, 0x33, 0x35, 0x23, 0x11, 0x23, 0xD6, 0x03, 0x16, 0xFC, 0xEA, 0xC2, 0x01, 0xC6, 0x02, 0x01,
-    0x0C, 0x3A, 0x2B, 0x2D, 0x13, 0x10, 0x2B, 0x01, 0x33, 0x17, 0x55, 0x15, 0x04, 0x09, 0x14, 0x58,
-    0x0C, 0x04, 0x02, 0x02, 0x26, 0x14, 0x01, 0x03, 0x08, 0x33, 0x38, 0x5F, 0x20, 0x10, 0x01, 0x03,
-    0x3C, 0x12, 0x59, 0x11, 0x01, 0x02, 0x39, 0x2C, 0x09, 0x02, 0x9D, 0xE2, 0xA2, 0x40, 0x02, 0xAB,
-    0xFD, 0xB2, 0xD2, 0xAA, 0xD2, 0xDC, 0x03, 0x07, 0x0B, 0x38, 0x10, 0x0C, 0x09, 0x04, 0x08, 0x19,
-    0x6C, 0x17, 0x0B, 0x17, 0x11, 0x07, 0x17, 0x0A, 0x1A, 0x0A, 0x29, 0x0C, 0x04, 0x04, 0x02, 0x10,
-    0x25, 0x37, 0x04, 0x06, 0x37, 0x1D, 0x1C, 0x3F, 0x19, 0x08, 0x16, 0x13, 0x0B, 0x1F, 0x2B, 0x04,
-    0xE9, 0x37, 0x01, 0x13, 0x00, 0x04, 0x00, 0x14, 0x00, 0x5D, 0x03, 0xEC, 0x02, 0xAB, 0x00, 0x07,
-    0x00, 0x1F, 0x00, 0x2A, 0x00, 0x58, 0x00, 0x00, 0x01, 0x32, 0x1D, 0x01, 0x14, 0x23, 0x21, 0x11,
-    0x01, 0x33, 0x35, 0x17, 0x1E, 0x03, 0x3B, 0x01, 0x27, 0x2E, 0x01, 0x2F, 0x01, 0x36, 0x37, 0x36,
-    0x27, 0x26, 0x27, 0x26, 0x2B, 0x01, 0x17, 0x30, 0x23, 0x35, 0x33, 0x32, 0x16, 0x17, 0x16, 0x07,
-    0x06, 0x05, 0x16, 0x37, 0x36, 0x37, 0x3E, 0x01, 0x27, 0x2E, 0x03, 0x3E, 0x01, 0x17, 0x16, 0x17,
-    0x30, 0x37, 0x36, 0x27, 0x26, 0x27, 0x26, 0x27, 0x22, 0x06, 0x07, 0x06, 0x1E, 0x03, 0x17, 0x16,
-    0x07, 0x06, 0x26, 0x27, 0x26, 0x27, 0x07, 0x06, 0x23, 0x07, 0x16, 0x03, 0x2A, 0xC2, 0xC2, 0xFC,
-    0xEA, 0x01, 0xEC, 0x41, 0x11, 0x1F, 0x17, 0x4D, 0x02, 0x27, 0x26, 0x16, 0x1E, 0x1C, 0x17, 0x04,
-    0x43, 0x0C, 0x0B, 0x21, 0x18, 0x3E, 0x0F, 0x46, 0x47, 0x66, 0x25, 0x29, 0x3E, 0x1B, 0x03, 0x08,
-    0x22, 0x0C, 0xFE, 0x4D, 0x22, 0x59, 0x34, 0x1E, 0x2B, 0x03, 0x33, 0x16, 0x5C, 0x16, 0x0C, 0x18,
-    0x3C, 0x16, 0x0B, 0x05, 0x22, 0x21, 0x01, 0x03, 0x10, 0x1F, 0x49, 0x36, 0x43, 0x02, 0x01, 0x1C,
-    0x2D, 0x56, 0x1B, 0x04, 0x07, 0x20, 0x13, 0x4B, 0x0D, 0x01, 0x04, 0x1D, 0x1E, 0x02, 0x02, 0x04,
-    0x02, 0xAB, 0xD2, 0xAA, 0xD2, 0x02, 0x4E, 0xFE, 0x39, 0x89, 0x01, 0x01, 0x11, 0x75, 0x01, 0x25,
-    0x2F, 0x27, 0x0F, 0x08, 0x0C, 0x38, 0x33, 0x21, 0x19, 0x02, 0x01, 0x8A, 0x53, 0x0D, 0x0F, 0x2A,
-    0x09, 0x04, 0x8A, 0x3A, 0x03, 0x01, 0x12, 0x1B, 0x71, 0x1B, 0x0C, 0x17, 0x0D, 0x18, 0x17, 0x09,
-    0x11, 0x09, 0x1A, 0x01, 0x01, 0x07, 0x1E, 0x15, 0x29, 0x01, 0x2D, 0x2D, 0x1A, 0x2C, 0x16, 0x16,
-    0x0D, 0x0F, 0x1A, 0x14, 0x0C, 0x0D, 0x27, 0x04, 0x0C, 0x03, 0x03, 0x04, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00,
-    0x00, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E, 0x01, 0x10, 0x36, 0x13, 0x15, 0x33, 0x15,
-    0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x15, 0x01, 0x7A, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2,
-    0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x7C, 0xC4, 0x50, 0xC4, 0xC5, 0x4E, 0x03, 0x70, 0x84, 0xE2, 0xFE,
-    0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFE, 0xC0, 0x4F, 0xC5, 0xC5, 0x4E, 0xC5, 0xC4,
-    0x00, 0x02, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E, 0x01, 0x10, 0x36, 0x13, 0x21, 0x35, 0x21,
-    0x01, 0x7A, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x7C, 0x01, 0xD8,
-    0xFE, 0x28, 0x03, 0x70, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFE,
-    0x71, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x64, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x85, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0xAF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x10, 0x00, 0xE2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0D,
-    0x01, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x10, 0x01, 0x3F, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x42, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0E,
-    0x00, 0x75, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x20, 0x00, 0x8D, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x20, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x05, 0x00, 0x1A, 0x00, 0xF3, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x20,
-    0x01, 0x1D, 0x00, 0x59, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x75, 0x00, 0x20, 0x00, 0x45, 0x00, 0x6D,
-    0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x20, 0x00, 0x50,
-    0x00, 0x72, 0x00, 0x6F, 0x00, 0x6A, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x00, 0x59, 0x75,
-    0x7A, 0x75, 0x20, 0x45, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x50, 0x72, 0x6F, 0x6A,
-    0x65, 0x63, 0x74, 0x00, 0x00, 0x59, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x75, 0x00, 0x4F, 0x00, 0x53,
-    0x00, 0x53, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x69,
-    0x00, 0x6F, 0x00, 0x6E, 0x00, 0x00, 0x59, 0x75, 0x7A, 0x75, 0x4F, 0x53, 0x53, 0x45, 0x78, 0x74,
-    0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00,
-    0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x00, 0x52, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x72, 0x00, 0x00,
-    0x59, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x75, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x53, 0x00, 0x45, 0x00,
-    0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00,
-    0x00, 0x59, 0x75, 0x7A, 0x75, 0x4F, 0x53, 0x53, 0x45, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F,
-    0x6E, 0x00, 0x00, 0x59, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x75, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x53,
-    0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F,
-    0x00, 0x6E, 0x00, 0x00, 0x59, 0x75, 0x7A, 0x75, 0x4F, 0x53, 0x53, 0x45, 0x78, 0x74, 0x65, 0x6E,
-    0x73, 0x69, 0x6F, 0x6E, 0x00, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00,
-    0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
-    0x00, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x31, 0x2E, 0x30, 0x30, 0x30, 0x00, 0x00,
-    0x59, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x75, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x53, 0x00, 0x45, 0x00,
-    0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00,
-    0x00, 0x59, 0x75, 0x7A, 0x75, 0x4F, 0x53, 0x53, 0x45, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F,
-    0x6E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB5, 0x00, 0x32,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x01, 0x02, 0x01, 0x03, 0x00, 0x03, 0x01, 0x04,
-    0x01, 0x05, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C,
-    0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14,
-    0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1A, 0x01, 0x1B, 0x07, 0x75,
-    0x6E, 0x69, 0x30, 0x30, 0x30, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30, 0x30, 0x44, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x41, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x41, 0x31, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x41, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x41, 0x33, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x41, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x41, 0x35, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x41, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x41, 0x37, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x41, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x41, 0x39, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x42, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x42, 0x34, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x45, 0x31, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x45, 0x33, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x45, 0x35, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x45, 0x37, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x45, 0x39, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x46, 0x30, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F,
+const std::array<unsigned char, 3580> FONT_NINTENDO_EXTENDED{{
+    0x28, 0xb5, 0x2f, 0xfd, 0x00, 0x68, 0x9d, 0x6f, 0x00, 0xaa, 0xc0, 0x84, 0x2a, 0x55, 0x40, 0xd4,
+    0x99, 0x49, 0x07, 0x40, 0x97, 0xf0, 0x00, 0xe0, 0xa3, 0x7b, 0xe2, 0xa8, 0xc6, 0xbb, 0x99, 0x47,
+    0x99, 0x81, 0x61, 0xdb, 0xe1, 0xfc, 0x5d, 0x61, 0xe0, 0x5a, 0x22, 0xf0, 0x94, 0x1b, 0x8f, 0xe6,
+    0xa8, 0x0e, 0xd1, 0xd6, 0x24, 0x18, 0x11, 0x58, 0x5f, 0xca, 0xfd, 0x0a, 0xdf, 0x6f, 0x5c, 0x3d,
+    0x60, 0x1c, 0xf6, 0x78, 0xfe, 0x33, 0x9b, 0xb6, 0x7c, 0xbb, 0xe4, 0xcb, 0x69, 0x81, 0xa1, 0xeb,
+    0x76, 0x1c, 0x8a, 0x2c, 0xfc, 0x6d, 0x89, 0x61, 0x14, 0xc3, 0x28, 0x80, 0x91, 0x25, 0x84, 0x90,
+    0xbd, 0x93, 0x0c, 0x95, 0x02, 0x98, 0x02, 0x96, 0x02, 0x3f, 0x0c, 0xd3, 0x3d, 0xbc, 0xb5, 0x1b,
+    0xdb, 0x80, 0x61, 0x33, 0x35, 0x6a, 0x00, 0x71, 0x25, 0x54, 0x7f, 0x96, 0x4e, 0xa7, 0x53, 0x28,
+    0x64, 0x1e, 0x44, 0x4a, 0x15, 0x94, 0xa1, 0xbc, 0xe8, 0xeb, 0xcb, 0x0c, 0x4d, 0x00, 0x57, 0x91,
+    0x4c, 0x62, 0x10, 0x38, 0x3b, 0x3c, 0x77, 0x72, 0x7a, 0x2a, 0x80, 0x08, 0x30, 0x06, 0x06, 0x8e,
+    0x8e, 0x18, 0x88, 0x61, 0x07, 0x10, 0xa6, 0x53, 0xa8, 0x8c, 0x8c, 0xa8, 0xa6, 0xb8, 0xb0, 0x03,
+    0x1f, 0xd9, 0x96, 0x7d, 0x4e, 0x50, 0x68, 0xac, 0x09, 0xfe, 0x80, 0x2d, 0xf0, 0x39, 0xc0, 0x1c,
+    0x0e, 0xc6, 0x86, 0x64, 0xc2, 0xd8, 0xde, 0x4c, 0x62, 0x9c, 0x1f, 0x96, 0xdd, 0x70, 0xef, 0xf8,
+    0xe2, 0x38, 0x49, 0xdc, 0x3c, 0xe2, 0xde, 0x0d, 0xcb, 0x7e, 0x3c, 0x9d, 0xd3, 0xbe, 0x9e, 0xa9,
+    0x58, 0x74, 0xb1, 0xb9, 0xc2, 0xc2, 0x01, 0x48, 0xaf, 0xb0, 0x11, 0xa9, 0x10, 0xec, 0xc3, 0x5b,
+    0x7b, 0x6b, 0x6a, 0x6f, 0xcd, 0xd6, 0xdd, 0x76, 0x6e, 0x57, 0x5e, 0xca, 0x59, 0x59, 0x53, 0x1a,
+    0x77, 0xf7, 0x02, 0xed, 0x8f, 0x76, 0xa7, 0x65, 0x81, 0xc5, 0xc1, 0x62, 0xb1, 0xea, 0xb0, 0x56,
+    0xad, 0x41, 0xd6, 0xe3, 0x2a, 0x85, 0xca, 0x81, 0xea, 0x54, 0x5d, 0x75, 0x4b, 0xae, 0x91, 0x4b,
+    0xc0, 0x3f, 0xd8, 0x8a, 0x4b, 0x79, 0x02, 0x4f, 0x3e, 0x89, 0x8e, 0xca, 0x75, 0x37, 0xb1, 0x7d,
+    0xcf, 0xd0, 0xc4, 0x9b, 0x27, 0x51, 0x91, 0x53, 0x89, 0x46, 0xd1, 0x45, 0xf4, 0x7c, 0x81, 0x2f,
+    0x90, 0xf7, 0x02, 0xab, 0x92, 0xaa, 0x7e, 0x55, 0xd4, 0x57, 0x42, 0xfd, 0x2a, 0x7d, 0x15, 0xe5,
+    0x45, 0xa3, 0x55, 0x56, 0x2f, 0x30, 0x1a, 0x7d, 0xb6, 0x15, 0x4f, 0xc8, 0xca, 0xa9, 0xd4, 0x1a,
+    0xb2, 0x6d, 0xcc, 0x10, 0x05, 0xd8, 0xe7, 0xf3, 0xe5, 0x11, 0x55, 0xb1, 0x72, 0x26, 0x55, 0xb1,
+    0x2a, 0x72, 0xdf, 0x97, 0xf7, 0x24, 0x12, 0xb2, 0xe2, 0x11, 0x55, 0x59, 0x39, 0x07, 0x70, 0x26,
+    0x05, 0xb3, 0x95, 0x4b, 0xa3, 0xb8, 0x4a, 0x0f, 0x38, 0xe0, 0x19, 0x55, 0xd5, 0x9e, 0xe7, 0x13,
+    0xca, 0x7b, 0x0a, 0x59, 0xbd, 0x4e, 0x1c, 0x43, 0x9c, 0x4a, 0x6d, 0xe5, 0xe6, 0x3c, 0xa3, 0xd0,
+    0x1a, 0xd5, 0x2a, 0x08, 0x93, 0x93, 0x6b, 0xe4, 0x46, 0x83, 0xcc, 0x88, 0xba, 0x51, 0xf7, 0x09,
+    0x74, 0xde, 0x30, 0xaa, 0xc9, 0x56, 0x46, 0x6e, 0x31, 0xbf, 0xc3, 0x22, 0xfe, 0x71, 0x2b, 0xa2,
+    0x21, 0x45, 0xae, 0x5b, 0x7c, 0x5f, 0xdd, 0x14, 0xe0, 0x23, 0xb7, 0xab, 0x65, 0xa0, 0x21, 0xea,
+    0xab, 0x27, 0x59, 0xbf, 0x7a, 0x4e, 0xf0, 0xaf, 0xe0, 0x4c, 0x72, 0xf5, 0x15, 0x8d, 0x62, 0xf7,
+    0x15, 0xc6, 0x6f, 0xf6, 0xfd, 0x26, 0xfa, 0x8c, 0x3e, 0x1e, 0xbe, 0x20, 0x3e, 0x26, 0xb2, 0xae,
+    0xc8, 0xfa, 0x14, 0x58, 0x58, 0x58, 0x2d, 0x60, 0x45, 0xc9, 0xca, 0xa2, 0x02, 0xcb, 0x09, 0x2c,
+    0x17, 0xb0, 0x4c, 0xc0, 0x72, 0x3b, 0xd6, 0xb4, 0xa4, 0x19, 0x22, 0x33, 0xb9, 0x6f, 0xfd, 0x29,
+    0x6f, 0x1f, 0x70, 0xab, 0xef, 0x4c, 0x05, 0x56, 0xac, 0xab, 0xb4, 0xdb, 0xb4, 0x37, 0x0c, 0x3b,
+    0x75, 0x96, 0x1c, 0x7c, 0x0b, 0xb1, 0x76, 0x05, 0xbf, 0x92, 0xd5, 0xee, 0x97, 0xb5, 0x8d, 0xf4,
+    0xcc, 0xda, 0x6f, 0x2e, 0xb9, 0x71, 0x55, 0x16, 0x07, 0x6f, 0xdc, 0x51, 0x99, 0x4b, 0xd6, 0x20,
+    0xeb, 0xd6, 0x24, 0xc4, 0x70, 0x12, 0xdd, 0x23, 0x87, 0xe8, 0x88, 0x56, 0x5f, 0x7d, 0xc5, 0xcf,
+    0xcc, 0x87, 0x11, 0x1e, 0x39, 0x1e, 0xda, 0x0a, 0xb5, 0xdb, 0x03, 0x05, 0xba, 0xcc, 0x44, 0x41,
+    0xa5, 0xa2, 0x86, 0xb9, 0x6e, 0x14, 0x52, 0x70, 0xc1, 0x0a, 0x24, 0x47, 0xa0, 0xa2, 0xa6, 0xef,
+    0xc6, 0x71, 0xeb, 0xb6, 0x31, 0x84, 0x05, 0x09, 0xe8, 0x13, 0x53, 0x11, 0x37, 0x00, 0xa9, 0x2e,
+    0xe2, 0x28, 0x25, 0x4c, 0x4f, 0x3d, 0xb7, 0xb5, 0xbb, 0x88, 0xb1, 0x2a, 0xc9, 0x04, 0x04, 0x8a,
+    0xc8, 0xd0, 0x0e, 0x17, 0x9c, 0x8a, 0x17, 0x25, 0x48, 0x9e, 0x9c, 0x5e, 0xbc, 0x78, 0x77, 0x03,
+    0xf9, 0x01, 0x97, 0xd3, 0xb2, 0xbb, 0xb9, 0x74, 0xb7, 0xab, 0x09, 0x34, 0x26, 0x08, 0x13, 0xd4,
+    0x49, 0x9d, 0x75, 0x27, 0x71, 0xf1, 0xc4, 0x2b, 0x49, 0xc8, 0x12, 0x22, 0x4d, 0xad, 0xd6, 0x75,
+    0xd3, 0xba, 0x3b, 0xea, 0x08, 0x53, 0xd3, 0x91, 0x77, 0x57, 0xe5, 0x6e, 0xa6, 0x07, 0x4f, 0xf6,
+    0xa9, 0x29, 0x4a, 0x08, 0xdb, 0x6b, 0xdf, 0xda, 0x45, 0x92, 0x04, 0x88, 0xd4, 0xbb, 0x61, 0xb8,
+    0xbb, 0x8a, 0x1d, 0x9a, 0xc0, 0x21, 0x8a, 0xe9, 0x09, 0xc8, 0x8f, 0xee, 0x76, 0x7a, 0x77, 0xb0,
+    0xd7, 0xc9, 0x63, 0x8e, 0x12, 0xd2, 0x8f, 0xce, 0x5d, 0xd5, 0xb2, 0xee, 0x7e, 0x07, 0x40, 0x20,
+    0xfb, 0xfb, 0x2c, 0xc9, 0x44, 0x22, 0x99, 0xc2, 0xa0, 0x6d, 0x99, 0x3c, 0x50, 0xf0, 0xf7, 0x0a,
+    0x6f, 0x35, 0xdc, 0xf1, 0x86, 0xab, 0xd5, 0x74, 0x47, 0x75, 0x90, 0xce, 0xc1, 0x80, 0xb9, 0xe4,
+    0x1b, 0x1d, 0xe3, 0x57, 0x4c, 0x81, 0x86, 0x5e, 0x55, 0x25, 0x83, 0x09, 0xe8, 0xd5, 0xa2, 0xfb,
+    0xc2, 0xaa, 0x4c, 0x8c, 0xf0, 0xcf, 0xdc, 0x48, 0xfe, 0xb4, 0x1c, 0xc4, 0x1b, 0xab, 0xd2, 0x88,
+    0x68, 0x70, 0x00, 0xc0, 0xd4, 0x63, 0x59, 0xba, 0x91, 0x29, 0x92, 0x69, 0xfe, 0x54, 0x09, 0xd8,
+    0x29, 0x25, 0x7a, 0xe6, 0xf1, 0x1e, 0x17, 0x6a, 0x31, 0xc2, 0xfd, 0xd2, 0x52, 0x73, 0xca, 0xdc,
+    0x69, 0x7f, 0x2f, 0x36, 0xd9, 0x2e, 0xb9, 0xc0, 0xd1, 0xcd, 0xa6, 0xc7, 0xfc, 0xe5, 0x18, 0xcf,
+    0xf6, 0xd0, 0xf8, 0x5c, 0x2e, 0xa4, 0x98, 0xba, 0xd2, 0x8c, 0x70, 0x50, 0xd0, 0xde, 0x94, 0x82,
+    0x0f, 0xf1, 0x24, 0x3a, 0x45, 0x37, 0x53, 0x29, 0x53, 0x9c, 0x4e, 0xb9, 0x2a, 0x97, 0xcc, 0xe5,
+    0x91, 0x09, 0x3c, 0xea, 0x94, 0xff, 0x4e, 0x7d, 0x99, 0xc9, 0x5a, 0xc6, 0xb1, 0xaf, 0x91, 0xc9,
+    0x6c, 0x62, 0xd3, 0xba, 0xb5, 0xf6, 0xcf, 0x15, 0x21, 0x84, 0x1c, 0x72, 0xf8, 0xb9, 0x0d, 0x3c,
+    0xe9, 0xf9, 0xde, 0xb7, 0xaa, 0xea, 0x05, 0x0d, 0x4e, 0xe9, 0xd4, 0x73, 0x04, 0x9f, 0x32, 0xc5,
+    0x27, 0x1a, 0x32, 0xe5, 0x43, 0x84, 0x51, 0x08, 0x80, 0x00, 0x81, 0x21, 0x9c, 0x7a, 0x94, 0x28,
+    0x51, 0x46, 0x9e, 0x88, 0x58, 0x50, 0x41, 0x0f, 0x1e, 0x24, 0xc0, 0xe8, 0x92, 0x64, 0x88, 0x53,
+    0x70, 0x1d, 0x29, 0xd3, 0x9b, 0x69, 0x51, 0x92, 0x5c, 0xa4, 0xac, 0x39, 0x71, 0x76, 0x9a, 0xfb,
+    0x1c, 0xe8, 0xc4, 0xdf, 0x92, 0xa9, 0x64, 0xbe, 0x35, 0x5c, 0x0e, 0x58, 0x53, 0x5f, 0x5a, 0xf2,
+    0x65, 0x06, 0xbb, 0xd6, 0xae, 0xb6, 0x5d, 0xf1, 0x27, 0x6f, 0xcd, 0x6c, 0x7a, 0x5a, 0x37, 0xcf,
+    0xf2, 0xcb, 0x34, 0x01, 0xfa, 0xa5, 0xdc, 0xd8, 0x8e, 0x71, 0xce, 0x1d, 0x0d, 0xd1, 0x6b, 0x53,
+    0xdf, 0xe2, 0x2b, 0x16, 0x48, 0xb5, 0x4c, 0x27, 0xc8, 0x3a, 0x44, 0x74, 0x79, 0x14, 0x4d, 0x0c,
+    0x23, 0xc3, 0x08, 0x29, 0x07, 0xcd, 0xfd, 0xd9, 0x60, 0x87, 0x03, 0x23, 0xc7, 0x10, 0x08, 0x08,
+    0x8a, 0xe3, 0x3b, 0x4c, 0x88, 0x8d, 0x55, 0x5b, 0x4a, 0x77, 0x06, 0x2e, 0x09, 0xd5, 0x50, 0xda,
+    0xfb, 0x0c, 0x58, 0x87, 0x4a, 0x1a, 0x05, 0x0d, 0x79, 0x19, 0x14, 0x26, 0x95, 0x4b, 0x1b, 0xee,
+    0x39, 0xc7, 0x11, 0x02, 0x5b, 0x1c, 0xee, 0x21, 0x6b, 0x35, 0xdf, 0xb9, 0x6f, 0xad, 0xad, 0xbd,
+    0x46, 0x61, 0xb2, 0xb6, 0x76, 0x1f, 0x5b, 0xa8, 0x76, 0xb7, 0x8e, 0xa4, 0x69, 0x8b, 0x97, 0xd2,
+    0xf7, 0x0e, 0x85, 0x75, 0xac, 0x48, 0xa5, 0x90, 0xc9, 0xad, 0x3b, 0x2d, 0x49, 0x67, 0xc0, 0xbd,
+    0xc3, 0xe8, 0xa2, 0x93, 0x24, 0x47, 0x41, 0x25, 0xa5, 0x21, 0xe3, 0xde, 0x1a, 0xb2, 0xf6, 0xb7,
+    0x86, 0x56, 0x7b, 0x75, 0x6f, 0xcd, 0x88, 0xfb, 0xbd, 0xef, 0x86, 0x69, 0x58, 0xb3, 0x4d, 0xa3,
+    0x86, 0x2c, 0x43, 0x4c, 0xa1, 0x42, 0x72, 0x53, 0xd3, 0x31, 0xc8, 0xa0, 0xc8, 0x16, 0x52, 0x27,
+    0x1b, 0xa8, 0x7c, 0x7c, 0x32, 0x10, 0x10, 0xd0, 0x8f, 0x8f, 0x02, 0x96, 0x3b, 0x30, 0x10, 0x97,
+    0x91, 0x0f, 0x5a, 0xe6, 0x74, 0xf7, 0x49, 0x06, 0x85, 0xca, 0x2f, 0x69, 0xc7, 0x21, 0x3e, 0x9f,
+    0x79, 0x07, 0x0f, 0xac, 0xc5, 0x54, 0xed, 0xe2, 0x57, 0x52, 0x3a, 0x0e, 0x1c, 0x2c, 0x93, 0x25,
+    0x0f, 0x38, 0x80, 0x7f, 0x04, 0xed, 0xf4, 0x60, 0x1f, 0x9e, 0xa0, 0xa6, 0xd5, 0x43, 0xf8, 0xf9,
+    0x39, 0x22, 0x8f, 0x93, 0x49, 0x26, 0x2b, 0x92, 0x0d, 0xa7, 0x13, 0x01, 0x20, 0xf1, 0x06, 0x93,
+    0x63, 0x6f, 0x47, 0x1c, 0xb4, 0x44, 0xe6, 0x74, 0x48, 0x61, 0x50, 0xf8, 0xa0, 0xe4, 0x72, 0x27,
+    0x77, 0x77, 0x2f, 0xc1, 0x2f, 0x1c, 0xb2, 0x17, 0x2d, 0x11, 0xfc, 0xf5, 0xca, 0x34, 0x59, 0x2b,
+    0xaf, 0x90, 0x4d, 0x8d, 0xd1, 0xb5, 0x7e, 0x7d, 0x7e, 0x5e, 0x93, 0x84, 0x78, 0xbc, 0x4f, 0x4f,
+    0x40, 0x89, 0xd7, 0xa0, 0xd1, 0x2a, 0xde, 0x97, 0x8b, 0x12, 0x22, 0xc3, 0xc8, 0x68, 0x80, 0x1b,
+    0xde, 0x89, 0x74, 0xf0, 0xb0, 0xea, 0xce, 0xf7, 0x43, 0x03, 0x41, 0x93, 0x23, 0x2a, 0x36, 0xcd,
+    0xa3, 0x33, 0x65, 0xf1, 0x2d, 0x56, 0x4c, 0xb7, 0x38, 0x71, 0xb2, 0x05, 0xf6, 0x2d, 0x4e, 0x8a,
+    0x70, 0x27, 0x06, 0x85, 0xc1, 0x25, 0xf3, 0x28, 0x3c, 0x22, 0x71, 0x40, 0x21, 0x73, 0xf9, 0x19,
+    0xdb, 0xe6, 0x74, 0x39, 0xdd, 0x51, 0xf7, 0xdd, 0x89, 0x37, 0x5d, 0xee, 0x41, 0xf7, 0x32, 0xda,
+    0x7b, 0xee, 0x9b, 0x34, 0x7c, 0x59, 0x38, 0xcb, 0x55, 0xdb, 0x4b, 0x34, 0x23, 0xb3, 0xc3, 0x86,
+    0x6f, 0x2b, 0x8a, 0xf0, 0x03, 0x35, 0x91, 0xf9, 0xb3, 0x58, 0x81, 0x22, 0x8d, 0x62, 0x1a, 0xcd,
+    0x31, 0x5c, 0x5a, 0x0e, 0x24, 0x23, 0x19, 0x30, 0x7c, 0xaa, 0x24, 0xb8, 0x19, 0x6e, 0xd2, 0xa5,
+    0xb2, 0x36, 0x21, 0x31, 0xb7, 0x08, 0x1d, 0xe6, 0x80, 0x81, 0xb3, 0x1b, 0x32, 0x94, 0xde, 0x7e,
+    0xc3, 0xad, 0x49, 0x21, 0xc6, 0x61, 0x22, 0x95, 0x48, 0x5d, 0xcf, 0xc8, 0xdd, 0x6d, 0x75, 0x1d,
+    0x3b, 0xd2, 0xdf, 0x4e, 0x85, 0x63, 0x38, 0x69, 0x31, 0x8d, 0xfa, 0x92, 0xf4, 0x0a, 0xbe, 0x71,
+    0xc9, 0xc0, 0xda, 0xab, 0x7c, 0xff, 0xae, 0x6b, 0xaf, 0x2d, 0xc0, 0x0d, 0x19, 0x60, 0xf0, 0xa6,
+    0xa6, 0x2c, 0x04, 0xfa, 0xb4, 0x45, 0x01, 0x3e, 0x0e, 0x84, 0x7f, 0x7c, 0xa8, 0x6c, 0x70, 0x62,
+    0xf2, 0xdf, 0x65, 0x2d, 0xd0, 0xa6, 0x44, 0xe2, 0xba, 0x71, 0x3f, 0xb0, 0x84, 0x09, 0x8b, 0x03,
+    0xc7, 0xbb, 0x50, 0x5b, 0xc7, 0x3c, 0x76, 0x1c, 0x3f, 0x9f, 0xd8, 0x00, 0xa7, 0x0d, 0xa4, 0x95,
+    0x49, 0x32, 0x89, 0x8f, 0x3c, 0xfe, 0xfc, 0x84, 0x70, 0xab, 0x66, 0x10, 0x4f, 0x0f, 0x7e, 0xcf,
+    0x4e, 0x10, 0x10, 0x02, 0xed, 0x7d, 0xb9, 0xdf, 0x0c, 0x88, 0x93, 0xbe, 0xfb, 0xdc, 0x96, 0x36,
+    0xb8, 0x5f, 0x64, 0x38, 0x5e, 0xff, 0x92, 0x2c, 0x4d, 0x99, 0xf7, 0xf5, 0x08, 0xde, 0x01, 0x8f,
+    0x18, 0x48, 0x6b, 0x17, 0xd3, 0xaf, 0x2e, 0xe3, 0x8b, 0xa1, 0xd0, 0xcb, 0x4e, 0x73, 0xbd, 0x62,
+    0x5b, 0xa3, 0x86, 0x30, 0x86, 0xf3, 0x8a, 0x37, 0x8c, 0x8c, 0x64, 0xc4, 0x54, 0xf8, 0x51, 0xd3,
+    0x86, 0xca, 0x51, 0x13, 0x08, 0x68, 0x7c, 0xdc, 0x9d, 0xba, 0xf6, 0xbc, 0xdc, 0xd8, 0xf6, 0xa6,
+    0x04, 0x0a, 0x59, 0xa4, 0x32, 0xa8, 0xdc, 0x09, 0x8d, 0xcb, 0x6e, 0x65, 0x13, 0xdb, 0x55, 0x39,
+    0x88, 0x8a, 0x22, 0x6d, 0xe0, 0x41, 0xda, 0x9b, 0xee, 0x7b, 0xb4, 0xcb, 0xdc, 0x9a, 0xd7, 0xd1,
+    0x91, 0x11, 0x23, 0xee, 0xc3, 0x72, 0xa5, 0xca, 0xf4, 0x4a, 0xd2, 0x15, 0x2c, 0x47, 0x58, 0x12,
+    0x50, 0x02, 0x71, 0x40, 0x1c, 0x12, 0x87, 0x54, 0x22, 0x6d, 0xc2, 0x7c, 0x18, 0x9e, 0x11, 0x1e,
+    0x4c, 0x17, 0x8b, 0xd1, 0xb9, 0x6a, 0x2e, 0x99, 0xab, 0x2c, 0x4d, 0x6e, 0x78, 0x73, 0x23, 0x53,
+    0xcc, 0xe5, 0x64, 0x32, 0x99, 0x1b, 0x4c, 0x16, 0x54, 0x61, 0x39, 0xab, 0x3d, 0x5d, 0x54, 0x29,
+    0x36, 0x1b, 0xba, 0x54, 0x1a, 0x1e, 0x38, 0xcc, 0xd4, 0x8b, 0x1c, 0xe1, 0xac, 0xf5, 0xe2, 0x39,
+    0xfe, 0x76, 0xf8, 0x45, 0xcf, 0x99, 0xea, 0xee, 0xe4, 0xc9, 0x71, 0xea, 0x04, 0x3f, 0x93, 0x3d,
+    0x62, 0x46, 0xe2, 0x7a, 0xe4, 0x60, 0x31, 0x3f, 0xb9, 0x17, 0xf6, 0x31, 0x32, 0xcd, 0x37, 0x43,
+    0x49, 0x84, 0x3f, 0x73, 0x93, 0x83, 0xa7, 0xb6, 0xae, 0xad, 0x06, 0x0c, 0x67, 0x9a, 0x1e, 0xc6,
+    0x6a, 0x2c, 0x85, 0xa9, 0x4d, 0x93, 0x97, 0x5b, 0x3f, 0x58, 0x4f, 0x4d, 0xad, 0x17, 0x63, 0x23,
+    0x07, 0x83, 0xb9, 0xde, 0x8c, 0x4e, 0x05, 0x00, 0xf6, 0x7a, 0x63, 0x9a, 0x35, 0x22, 0x19, 0x43,
+    0x7c, 0xb7, 0x83, 0x91, 0xea, 0x88, 0x12, 0xa5, 0x08, 0x3c, 0x94, 0xf2, 0x72, 0xcb, 0xe6, 0x74,
+    0x32, 0xf6, 0xf6, 0x26, 0x53, 0xcd, 0x3d, 0xe8, 0xc8, 0x14, 0x06, 0x57, 0x26, 0x4e, 0x08, 0x1c,
+    0x02, 0xef, 0x7b, 0x4f, 0x87, 0x4c, 0xd6, 0x94, 0xc1, 0x17, 0xc8, 0xde, 0x4e, 0x93, 0x3b, 0x0a,
+    0x5f, 0xe3, 0xbb, 0xa1, 0xbd, 0xd3, 0x38, 0x4a, 0xcd, 0x9b, 0x89, 0x42, 0x19, 0xe1, 0x84, 0xfc,
+    0x82, 0xf5, 0x64, 0x7a, 0x31, 0x35, 0x77, 0xd6, 0xbe, 0xc0, 0x60, 0x2d, 0x4c, 0xe6, 0x6a, 0xd5,
+    0x5e, 0x68, 0x2a, 0xce, 0x2c, 0xec, 0x36, 0x8b, 0xb9, 0x5c, 0x6c, 0xec, 0x25, 0xbb, 0x6e, 0xc2,
+    0x35, 0x86, 0xa5, 0xc5, 0x62, 0x60, 0xed, 0x4b, 0x0c, 0x86, 0x7d, 0x89, 0xbd, 0x6a, 0x6a, 0xc6,
+    0xac, 0xcd, 0x6b, 0xcd, 0xc7, 0x9f, 0x05, 0x63, 0x7a, 0xaa, 0xcd, 0xf4, 0xc9, 0x92, 0x94, 0x25,
+    0x27, 0xdf, 0xfd, 0x20, 0xdd, 0x1d, 0x31, 0x15, 0x29, 0x54, 0x1a, 0x3b, 0x31, 0x62, 0x24, 0xe9,
+    0x86, 0xeb, 0x32, 0x31, 0x7c, 0x5f, 0xd4, 0x66, 0xbf, 0x6b, 0x16, 0xb4, 0xd5, 0x1c, 0x5f, 0xad,
+    0x2c, 0x07, 0x8c, 0xb5, 0x32, 0xce, 0xcb, 0x8c, 0x8f, 0xd7, 0x57, 0x0b, 0x36, 0xb3, 0x0d, 0x71,
+    0x6e, 0xb3, 0xd7, 0xf5, 0x67, 0x97, 0x6c, 0x06, 0x06, 0x78, 0xc4, 0xa9, 0x2e, 0x58, 0x8c, 0x6c,
+    0x46, 0x84, 0xa9, 0xf8, 0x3d, 0xd8, 0x0c, 0x3f, 0xb7, 0x72, 0x34, 0x3b, 0x3d, 0x30, 0x61, 0xa2,
+    0x03, 0x46, 0xba, 0xdb, 0x49, 0x81, 0xa3, 0x44, 0x19, 0x32, 0x85, 0xbf, 0xb3, 0xce, 0xca, 0xba,
+    0xd1, 0xc8, 0x88, 0x67, 0x87, 0xb9, 0x54, 0x26, 0x91, 0x47, 0x1d, 0x63, 0x11, 0x72, 0x88, 0x67,
+    0x87, 0xb9, 0x54, 0x26, 0x91, 0x47, 0x1d, 0x63, 0x0c, 0x63, 0x11, 0x91, 0x71, 0x48, 0x91, 0xa9,
+    0x96, 0x77, 0x99, 0xef, 0x1e, 0x73, 0xdd, 0x73, 0xc7, 0xfd, 0x76, 0xdb, 0x61, 0x5e, 0x3b, 0xed,
+    0xb3, 0xcb, 0x1e, 0x3b, 0xec, 0xaf, 0xbf, 0xdc, 0xf5, 0xd6, 0xdb, 0xb3, 0x5f, 0xaf, 0x3e, 0x77,
+    0x3e, 0x7e, 0xf7, 0x4c, 0x1f, 0xfb, 0x85, 0x2c, 0xa3, 0xd1, 0x88, 0xa3, 0xe3, 0x4a, 0x41, 0x8d,
+    0x8d, 0xd3, 0x3a, 0xed, 0x4a, 0xe5, 0x90, 0x6a, 0x82, 0x4a, 0x35, 0xdd, 0x80, 0x1a, 0x72, 0xa4,
+    0x08, 0x14, 0x89, 0x92, 0x22, 0x25, 0x25, 0xa4, 0x22, 0x43, 0xfa, 0x48, 0x17, 0x41, 0xd2, 0x4a,
+    0xba, 0x48, 0xa9, 0x91, 0x80, 0x40, 0x0f, 0x80, 0x92, 0x4a, 0x72, 0xa5, 0xa0, 0x90, 0x30, 0x11,
+    0x99, 0x7a, 0x2a, 0x72, 0xa7, 0x98, 0x4c, 0x3d, 0x1b, 0x48, 0x43, 0xfb, 0x80, 0x86, 0x4a, 0x92,
+    0x6a, 0xa8, 0x46, 0xd2, 0x4c, 0x4d, 0xe4, 0xa9, 0x8b, 0xda, 0x65, 0xf2, 0x6c, 0x9a, 0xbb, 0xcd,
+    0x56, 0xd1, 0x32, 0xbd, 0x56, 0x51, 0x25, 0xc8, 0x53, 0x78, 0xa8, 0xdd, 0x61, 0x77, 0xbb, 0xd4,
+    0x07, 0x9d, 0xd6, 0xec, 0xec, 0xb1, 0x5e, 0xb7, 0xa8, 0x54, 0xf2, 0x13, 0x1c, 0xa4, 0x69, 0xfd,
+    0x62, 0xe3, 0xfa, 0xad, 0x42, 0xcb, 0x3a, 0x2a, 0xc3, 0x98, 0x1a, 0xf1, 0x19, 0x16, 0xa4, 0xa8,
+    0x9c, 0x74, 0x25, 0x01, 0x9c, 0xd2, 0xa6, 0xeb, 0xa9, 0x39, 0xc3, 0x54, 0x61, 0x0c, 0x76, 0x93,
+    0x99, 0xc5, 0x72, 0xb9, 0xa2, 0xcc, 0xcd, 0xcd, 0x6d, 0x70, 0xbd, 0xf6, 0x97, 0xd1, 0xc5, 0xc4,
+    0x74, 0x30, 0x98, 0xe7, 0x9e, 0xa8, 0xea, 0x1a, 0xce, 0x62, 0x4a, 0xd1, 0xe3, 0xdd, 0x8b, 0xdc,
+    0x81, 0xb5, 0x66, 0xc2, 0x9c, 0x9a, 0x4f, 0xd5, 0x7e, 0x28, 0x3c, 0xd3, 0x23, 0x8c, 0x02, 0x56,
+    0x31, 0xee, 0xd1, 0xa8, 0x8f, 0xd1, 0xb0, 0xb9, 0xad, 0xca, 0xcb, 0x71, 0x33, 0x73, 0x0c, 0xc0,
+    0x72, 0x86, 0x8f, 0x96, 0xff, 0xfe, 0xd6, 0x57, 0xee, 0x27, 0x06, 0x96, 0x5b, 0xca, 0x21, 0x33,
+    0xb1, 0x97, 0x7c, 0xfe, 0x6c, 0x4c, 0x61, 0xbf, 0x56, 0xe6, 0x35, 0x6d, 0x6a, 0x66, 0xcd, 0x98,
+    0xf7, 0x05, 0x03, 0x40, 0xd5, 0xcd, 0xf4, 0x72, 0x41, 0x21, 0xb6, 0xa1, 0xf3, 0xd5, 0x62, 0x70,
+    0xf9, 0x13, 0x5d, 0xac, 0x58, 0x19, 0xe6, 0x5c, 0x0b, 0x64, 0xdb, 0xdc, 0x63, 0x8d, 0x6f, 0xe6,
+    0x26, 0x73, 0x3d, 0xf1, 0x3e, 0xf9, 0xb5, 0x17, 0x78, 0x7c, 0xb7, 0xb3, 0x87, 0xed, 0xeb, 0x56,
+    0x6d, 0xdb, 0x99, 0x4e, 0xa8, 0x44, 0xdf, 0xcb, 0x96, 0x6b, 0xed, 0x82, 0x66, 0x68, 0x98, 0xac,
+    0xca, 0xac, 0xa1, 0x61, 0x55, 0x85, 0xd9, 0xbc, 0xc8, 0xbc, 0xe8, 0xda, 0x9a, 0xee, 0xa5, 0x23,
+    0xb2, 0x6b, 0xd1, 0x76, 0x5e, 0x6d, 0x4e, 0x42, 0x88, 0x13, 0x84, 0x60, 0x41, 0x8a, 0x02, 0x16,
+    0x92, 0xb2, 0xe5, 0x03, 0xec, 0x2a, 0xf2, 0xe0, 0xd7, 0x9e, 0x30, 0x3f, 0xf9, 0x34, 0xd7, 0xc7,
+    0x0e, 0xb2, 0x95, 0x7f, 0x0b, 0x62, 0xac, 0xc2, 0x9c, 0x37, 0x97, 0x8a, 0x23, 0x40, 0x87, 0x3c,
+    0x91, 0x66, 0xbb, 0x21, 0xf6, 0xc0, 0x8e, 0x75, 0xb8, 0x95, 0x27, 0xba, 0xe4, 0x72, 0x11, 0x48,
+    0xec, 0x3b, 0x62, 0x9c, 0x1f, 0xdb, 0x32, 0xd7, 0x9f, 0xad, 0x1b, 0xa8, 0x99, 0x28, 0xf4, 0xe8,
+    0xaa, 0xaa, 0x3f, 0x06, 0x13, 0xb9, 0x75, 0xbd, 0x45, 0xf5, 0x50, 0x12, 0xae, 0xc6, 0x86, 0x6e,
+    0xbd, 0xa2, 0x59, 0xd1, 0x29, 0xfb, 0x93, 0x37, 0x66, 0xfe, 0x11, 0xb0, 0xe4, 0x38, 0xd5, 0x34,
+    0xc9, 0xf4, 0x06, 0x58, 0xe1, 0xd5, 0xa9, 0x69, 0x69, 0x09, 0x6b, 0x6a, 0x44, 0x11, 0x52, 0x99,
+    0x98, 0xcd, 0x05, 0x6c, 0x77, 0x98, 0xc9, 0x05, 0xa0, 0x50, 0x38, 0x19, 0xb3, 0x55, 0x95, 0x1d,
+    0xb9, 0x5c, 0x3e, 0x9a, 0x1e, 0x36, 0x27, 0xe7, 0xc7, 0xec, 0xd9, 0xdc, 0x8e, 0x7a, 0xd3, 0xe8,
+    0xb9, 0xdc, 0x80, 0xdb, 0x67, 0x37, 0xa1, 0x12, 0x68, 0xd4, 0x29, 0x8f, 0x18, 0xe7, 0xfe, 0x74,
+    0x4e, 0xff, 0xba, 0x55, 0x9b, 0xe8, 0x43, 0x01, 0x54, 0x55, 0x0d, 0x01, 0xbd, 0x3e, 0xa4, 0x45,
+    0x0a, 0x24, 0x7a, 0x28, 0x5f, 0x91, 0x74, 0xc0, 0x7d, 0xea, 0x4e, 0x4d, 0x5f, 0xea, 0xb1, 0xc4,
+    0xf4, 0x08, 0x2d, 0x42, 0x07, 0xa2, 0x8b, 0x01, 0x5c, 0x1e, 0x5d, 0x3f, 0xfb, 0x1d, 0x91, 0x40,
+    0xe3, 0xcb, 0x6b, 0x5c, 0xb7, 0x5a, 0xd6, 0x45, 0x8f, 0xcd, 0xac, 0xf5, 0x27, 0x01, 0x81, 0x9d,
+    0xa8, 0xc1, 0x40, 0x88, 0x10, 0x12, 0x12, 0x11, 0x11, 0x11, 0x49, 0x92, 0x24, 0x1d, 0xd1, 0x90,
+    0x42, 0x4c, 0x29, 0xeb, 0xea, 0x36, 0x42, 0x6b, 0x92, 0x64, 0x1a, 0x46, 0x64, 0x88, 0x64, 0x94,
+    0x94, 0x14, 0x24, 0x49, 0xfd, 0x68, 0x33, 0x17, 0xe3, 0xd6, 0x45, 0x2b, 0x6d, 0xd6, 0xa4, 0x6c,
+    0x7a, 0xd9, 0x46, 0x72, 0xb7, 0xc1, 0x55, 0x67, 0xb5, 0xcc, 0xa4, 0x93, 0xb7, 0x55, 0x92, 0x4b,
+    0xc4, 0x60, 0x75, 0xc7, 0x28, 0x36, 0x51, 0xf3, 0x54, 0x86, 0x15, 0x08, 0xea, 0xf3, 0xed, 0x48,
+    0x28, 0xce, 0x9d, 0x68, 0x30, 0xb2, 0xa9, 0x1d, 0xce, 0x5a, 0x6c, 0x94, 0xc1, 0xb0, 0x95, 0x50,
+    0xa3, 0x1c, 0xb7, 0x55, 0x0a, 0xf6, 0xa8, 0xa9, 0x2b, 0xa6, 0xd8, 0x06, 0x75, 0xa2, 0x73, 0x27,
+    0x42, 0xca, 0x95, 0xaf, 0x17, 0xbc, 0x82, 0x50, 0x4d, 0x80, 0xaf, 0x8b, 0x92, 0x76, 0x07, 0x36,
+    0xcc, 0x15, 0x5d, 0x98, 0x5b, 0x68, 0xb8, 0x11, 0xc0, 0x61, 0x91, 0x10, 0x7e, 0x67, 0x1e, 0xe0,
+    0xf3, 0x2f, 0x58, 0x8f, 0x90, 0x2c, 0xbb, 0x77, 0xb1, 0x0c, 0x00, 0xa6, 0x6c, 0x37, 0x15, 0x71,
+    0x2a, 0x11, 0x04, 0xed, 0x29, 0x9c, 0x34, 0x2f, 0xd0, 0xfe, 0x94, 0x3a, 0x6a, 0xa3, 0x53, 0xd2,
+    0xdc, 0x6f, 0x3f, 0xb0, 0x9e, 0xd3, 0xa6, 0x11, 0xa3, 0x4c, 0xe1, 0x9c, 0x51, 0xf3, 0x47, 0x31,
+    0xee, 0xc8, 0x91, 0x7f, 0x70, 0xdf, 0x04, 0x44, 0x34, 0x36, 0x4e, 0x61, 0x85, 0xd5, 0x46, 0x10,
+    0x79, 0x57, 0x7c, 0x49, 0xe8, 0xb5, 0x7a, 0x40, 0x1c, 0xb6, 0xbb, 0xe3, 0x37, 0xfc, 0xc5, 0xd1,
+    0x7b, 0xfd, 0xe8, 0x53, 0x9b, 0x59, 0x93, 0xbd, 0x19, 0x9d, 0xc6, 0x74, 0x9c, 0x43, 0xd7, 0xc3,
+    0xa8, 0x1f, 0x25, 0xfe, 0x66, 0xc2, 0xea, 0x1e, 0x7c, 0x17, 0x26, 0x1c, 0xfa, 0xaa, 0xc2, 0x36,
+    0x9c, 0xa8, 0x39, 0x4b, 0x5d, 0x4a, 0x7e, 0x31, 0xe0, 0x17, 0xa4, 0x02, 0xe0, 0xa5, 0x56, 0xaa,
+    0x18, 0x31, 0xd6, 0xcb, 0xe8, 0x2a, 0x4f, 0xb6, 0x1d, 0xe2, 0xb3, 0x18, 0xeb, 0x3b, 0x90, 0x67,
+    0xa5, 0x05, 0x2d, 0x0e, 0x55, 0x98, 0xb4, 0x1c, 0x93, 0x35, 0x19, 0x46, 0x11, 0x7f, 0xb0, 0x6a,
+    0x72, 0xb8, 0x26, 0x27, 0xb6, 0x61, 0x7e, 0x07, 0x67, 0x82, 0x4d, 0x5f, 0xed, 0x44, 0xb6, 0x6d,
+    0xdf, 0xe1, 0x59, 0x9b, 0x15, 0xed, 0xf0, 0x89, 0xcf, 0xd0, 0xe4, 0xfc, 0x14, 0x85, 0x99, 0xcf,
+    0xad, 0xe4, 0xe6, 0x4e, 0xd0, 0x27, 0xd0, 0xf1, 0xf0, 0x91, 0x7e, 0xc9, 0xf5, 0x66, 0x28, 0xfc,
+    0x8c, 0xdd, 0xea, 0x07, 0x34, 0x29, 0x80, 0xa3, 0xfc, 0x94, 0xc5, 0x9e, 0xe3, 0xec, 0x18, 0x58,
+    0x79, 0x7c, 0x02, 0x65, 0x94, 0xeb, 0x94, 0xfa, 0x53, 0xa0, 0xb3, 0xd5, 0x4e, 0x25, 0x07, 0x77,
+    0xa5, 0x40, 0x5d, 0xa4, 0x83, 0xe7, 0x9d, 0xcf, 0xe8, 0x1f, 0x1d, 0x63, 0x41, 0x03, 0xce, 0xc9,
+    0x9a, 0x4b, 0x5b, 0xdf, 0xaf, 0xfb, 0x24, 0x30, 0x12, 0x1e, 0xd3, 0x61, 0x2c, 0xb8, 0xc2, 0x57,
+    0xde, 0x48, 0x63, 0x3e, 0x83, 0x42, 0x44, 0xdd, 0x2c, 0x23, 0x7c, 0x07, 0x55, 0xfc, 0x69, 0xdc,
+    0xb7, 0xa1, 0x9b, 0x2d, 0xec, 0xdb, 0x20, 0x9a, 0xe4, 0x27, 0xec, 0xbf, 0xee, 0xc9, 0xc6, 0x52,
+    0x95, 0x8e, 0x67, 0xab, 0x69, 0x5b, 0x07, 0x51, 0x7c, 0x35, 0x6b, 0x48, 0x5b, 0x0d, 0x28, 0xa9,
+    0x76, 0x54, 0xa5, 0x03, 0x75, 0x36, 0xe2, 0x03, 0x50, 0x29, 0xba, 0x25, 0xdd, 0x9c, 0x41, 0x58,
+    0xc8, 0xb5, 0xc2, 0xc9, 0xd6, 0xf8, 0x04, 0x23, 0x4c, 0xc1, 0x07, 0xb1, 0x19, 0x81, 0xd0, 0x3a,
+    0x52, 0x89, 0x25, 0xfc, 0x77, 0xef, 0xd6, 0x55, 0xd1, 0x1e, 0xdb, 0x75, 0x14, 0xa7, 0xfe, 0x16,
+    0x4b, 0xca, 0x24, 0xf4, 0xba, 0xee, 0xbc, 0xbc, 0x3b, 0xa9, 0x93, 0x8c, 0x96, 0x10, 0xdf, 0xb4,
+    0x5e, 0x99, 0xd2, 0x83, 0xd5, 0xb7, 0x12, 0xa0, 0xbd, 0x68, 0xb9, 0x65, 0x3a, 0xc6, 0x9a, 0x57,
+    0xa1, 0xb4, 0x4e, 0x79, 0xb6, 0x70, 0x8b, 0x77, 0xc2, 0x15, 0xf9, 0x9c, 0x3d, 0x2f, 0x29, 0xf2,
+    0x2e, 0x3a, 0xe9, 0xda, 0x31, 0x13, 0xf0, 0x95, 0x9b, 0x83, 0xf2, 0x9b, 0x30, 0x75, 0xeb, 0x90,
+    0x8f, 0xda, 0x6e, 0x19, 0xa1, 0x6e, 0x4f, 0x16, 0x04, 0x62, 0x37, 0x48, 0x77, 0x62, 0xa9, 0x7e,
+    0x09, 0x66, 0x54, 0x29, 0x91, 0x10, 0x8a, 0x0c, 0xb4, 0x78, 0x20, 0x58, 0x1b, 0x6a, 0x89, 0x75,
+    0x8a, 0x92, 0x72, 0x4b, 0x24, 0x19, 0x81, 0x91, 0xc3, 0x46, 0xaf, 0xc7, 0x93, 0x98, 0x99, 0x49,
+    0x5f, 0x60, 0xc2, 0x56, 0x2e, 0x5d, 0x8f, 0xad, 0x51, 0xb8, 0xca, 0xc1, 0xd8, 0xba, 0x87, 0x2d,
+    0x03, 0x98, 0xb5, 0x28, 0x78, 0xa8, 0x1e, 0x49, 0xf2, 0x5d, 0x89, 0x49, 0x04, 0x5b, 0x0e, 0x3d,
+    0x68, 0xc1, 0xc3, 0x5b, 0xd6, 0x90, 0xb5, 0x14, 0x1e, 0xd8, 0x4a, 0x3e, 0x62, 0xc9, 0x0a, 0x4a,
+    0x7a, 0x1c, 0x28, 0x4c, 0x45, 0xea, 0x7a, 0xd5, 0xeb, 0x0e, 0xea, 0x10, 0xe3, 0xc0, 0xa8, 0x81,
+    0x77, 0x07, 0x34, 0xc7, 0x27, 0x7e, 0xda, 0x41, 0x53, 0xec, 0x7e, 0x0d, 0xdb, 0x94, 0xd7, 0xd6,
+    0xc3, 0x51, 0x12, 0x67, 0x4c, 0xb0, 0xac, 0xe9, 0x31, 0x45, 0x62, 0x87, 0xe3, 0xea, 0x1b, 0xf7,
+    0x48, 0x6e, 0xf5, 0x62, 0x29, 0x03, 0x25, 0x35, 0x28, 0x8a, 0x2e, 0x16, 0xf9, 0xbb, 0x2d, 0x95,
+    0x09, 0x9f, 0x27, 0x0c, 0xc6, 0x6d, 0x19, 0x9b, 0xc6, 0x22, 0x9f, 0x0c, 0xf0, 0xfc, 0x2e, 0x55,
+    0xc7, 0x71, 0x12, 0x0e, 0xf1, 0x54, 0xf9, 0x85, 0xc0, 0xe2, 0xe5, 0x12, 0xaf, 0xea, 0x7f, 0xef,
+    0x29, 0xd3, 0xb2, 0x7b, 0x51, 0xfc, 0xbb, 0x7d, 0xa3, 0x3d, 0x1a, 0x4c, 0x3a, 0xec, 0x48, 0x02,
+    0xf3, 0x81, 0x4b, 0x48, 0x78, 0x90, 0x3d, 0xb1, 0x71, 0x60, 0xfb, 0x17, 0x16, 0x76, 0x82, 0xd4,
+    0xd8, 0x34, 0xc2, 0xc2, 0xaf, 0x50, 0x62, 0xed, 0x31, 0xb5, 0x32, 0x7e, 0x04, 0xc3, 0xe1, 0x33,
+    0xe2, 0x86, 0xe2, 0x9b, 0xde, 0xf7, 0x85, 0x5e, 0x1e, 0x5f, 0x04, 0x73, 0xd9, 0xc5, 0x59, 0x55,
+    0xfa, 0x3a, 0xea, 0xa7, 0x69, 0x28, 0xdc, 0x30, 0x3c, 0x11, 0x4c, 0x0d,
 }};
 
 } // namespace FileSys::SystemArchive::SharedFontData
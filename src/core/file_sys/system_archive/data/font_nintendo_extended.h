@@ -4,9 +4,12 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 6024> FONT_NINTENDO_EXTENDED;
+/// Zstandard compressed font, decompressed when the system archive is synthesized
+extern const std::array<unsigned char, 3580> FONT_NINTENDO_EXTENDED;
+constexpr std::size_t FONT_NINTENDO_EXTENDED_SIZE{6024};
 
 } // namespace FileSys::SystemArchive::SharedFontData
@@ -4,9 +4,12 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 217276> FONT_STANDARD;
+/// Zstandard compressed font, decompressed when the system archive is synthesized
+extern const std::array<unsigned char, 73537> FONT_STANDARD;
+constexpr std::size_t FONT_STANDARD_SIZE{217276};
 
 } // namespace FileSys::SystemArchive::SharedFontData
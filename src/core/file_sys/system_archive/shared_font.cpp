@@ -1,6 +1,10 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <span>
+
+#include "common/assert.h"
+#include "common/zstd_compression.h"
 #include "core/file_sys/system_archive/data/font_chinese_simplified.h"
 #include "core/file_sys/system_archive/data/font_chinese_traditional.h"
 #include "core/file_sys/system_archive/data/font_extended_chinese_simplified.h"
@@ -16,11 +20,14 @@ namespace FileSys::SystemArchive {
 namespace {
 
 template <std::size_t Size>
-VirtualFile PackBFTTF(const std::array<u8, Size>& data, const std::string& name) {
-    std::vector<u32> vec(Size / sizeof(u32));
-    std::memcpy(vec.data(), data.data(), vec.size() * sizeof(u32));
+VirtualFile PackBFTTF(const std::array<u8, Size>& compressed, std::size_t size,
+                      const std::string& name) {
+    std::vector<u32> vec(size / sizeof(u32));
+    const std::span<u8> output{reinterpret_cast<u8*>(vec.data()), vec.size() * sizeof(u32)};
+    const auto decompressed = Common::Compression::DecompressDataZSTD(output, compressed);
+    ASSERT_MSG(decompressed == size, "Failed to decompress embedded font {}", name);
 
-    std::vector<u8> bfttf(Size + sizeof(u64));
+    std::vector<u8> bfttf(size + sizeof(u64));
 
     size_t offset = 0;
     Service::NS::EncryptSharedFont(vec, bfttf, offset);
@@ -32,8 +39,10 @@ VirtualFile PackBFTTF(const std::array<u8, Size>& data, const std::string& name)
 VirtualDir FontNintendoExtension() {
     return std::make_shared<VectorVfsDirectory>(
         std::vector<VirtualFile>{
-            PackBFTTF(SharedFontData::FONT_NINTENDO_EXTENDED, "nintendo_ext_003.bfttf"),
-            PackBFTTF(SharedFontData::FONT_NINTENDO_EXTENDED, "nintendo_ext2_003.bfttf"),
+            PackBFTTF(SharedFontData::FONT_NINTENDO_EXTENDED,
+                      SharedFontData::FONT_NINTENDO_EXTENDED_SIZE, "nintendo_ext_003.bfttf"),
+            PackBFTTF(SharedFontData::FONT_NINTENDO_EXTENDED,
+                      SharedFontData::FONT_NINTENDO_EXTENDED_SIZE, "nintendo_ext2_003.bfttf"),
         },
         std::vector<VirtualDir>{});
 }
@@ -41,7 +50,8 @@ VirtualDir FontNintendoExtension() {
 VirtualDir FontStandard() {
     return std::make_shared<VectorVfsDirectory>(
         std::vector<VirtualFile>{
-            PackBFTTF(SharedFontData::FONT_STANDARD, "nintendo_udsg-r_std_003.bfttf"),
+            PackBFTTF(SharedFontData::FONT_STANDARD, SharedFontData::FONT_STANDARD_SIZE,
+                      "nintendo_udsg-r_std_003.bfttf"),
         },
         std::vector<VirtualDir>{});
 }
@@ -49,7 +59,8 @@ VirtualDir FontStandard() {
 VirtualDir FontKorean() {
     return std::make_shared<VectorVfsDirectory>(
         std::vector<VirtualFile>{
-            PackBFTTF(SharedFontData::FONT_KOREAN, "nintendo_udsg-r_ko_003.bfttf"),
+            PackBFTTF(SharedFontData::FONT_KOREAN, SharedFontData::FONT_KOREAN_SIZE,
+                      "nintendo_udsg-r_ko_003.bfttf"),
         },
         std::vector<VirtualDir>{});
 }
@@ -58,6 +69,7 @@ VirtualDir FontChineseTraditional() {
     return std::make_shared<VectorVfsDirectory>(
         std::vector<VirtualFile>{
             PackBFTTF(SharedFontData::FONT_CHINESE_TRADITIONAL,
+                      SharedFontData::FONT_CHINESE_TRADITIONAL_SIZE,
                       "nintendo_udjxh-db_zh-tw_003.bfttf"),
         },
         std::vector<VirtualDir>{});
@@ -67,8 +79,10 @@ VirtualDir FontChineseSimple() {
     return std::make_shared<VectorVfsDirectory>(
         std::vector<VirtualFile>{
             PackBFTTF(SharedFontData::FONT_CHINESE_SIMPLIFIED,
+                      SharedFontData::FONT_CHINESE_SIMPLIFIED_SIZE,
                       "nintendo_udsg-r_org_zh-cn_003.bfttf"),
             PackBFTTF(SharedFontData::FONT_EXTENDED_CHINESE_SIMPLIFIED,
+                      SharedFontData::FONT_EXTENDED_CHINESE_SIMPLIFIED_SIZE,
                       "nintendo_udsg-r_ext_zh-cn_003.bfttf"),
         },
         std::vector<VirtualDir>{});
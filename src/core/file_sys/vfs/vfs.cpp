@@ -162,6 +162,11 @@ std::string VfsFile::GetExtension() const {
 
 VfsDirectory::~VfsDirectory() = default;
 
+std::optional<std::span<const u8>> VfsFile::ReadDirect(std::size_t length,
+                                                      std::size_t offset) const {
+    return std::nullopt;
+}
+
 std::optional<u8> VfsFile::ReadByte(std::size_t offset) const {
     u8 out{};
     const std::size_t size = Read(&out, sizeof(u8), offset);
@@ -191,6 +196,10 @@ std::size_t VfsFile::WriteBytes(const std::vector<u8>& data, std::size_t offset)
     return Write(data.data(), data.size(), offset);
 }
 
+bool VfsFile::Commit() {
+    return true;
+}
+
 std::string VfsFile::GetFullPath() const {
     if (GetContainingDirectory() == nullptr)
         return '/' + GetName();
@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -110,6 +111,12 @@ public:
     // into file. Returns number of bytes successfully written.
     virtual std::size_t Write(const u8* data, std::size_t length, std::size_t offset = 0) = 0;
 
+    // Returns a view of up to length bytes starting at offset when the file is backed by memory
+    // that lives as long as the file, avoiding the copy made by Read. Returns std::nullopt when
+    // the file has no such backing, callers are expected to fall back to Read.
+    virtual std::optional<std::span<const u8>> ReadDirect(std::size_t length,
+                                                          std::size_t offset = 0) const;
+
     // Reads exactly one byte at the offset provided, returning std::nullopt on error.
     virtual std::optional<u8> ReadByte(std::size_t offset = 0) const;
     // Reads size bytes starting at offset in file into a vector.
@@ -174,6 +181,10 @@ public:
         return Write(reinterpret_cast<const u8*>(&data), sizeof(T), offset);
     }
 
+    // Writes any data buffered by the implementation to the underlying storage and waits until it
+    // is stored. Returns whether or not the operation was successful.
+    virtual bool Commit();
+
     // Renames the file to name. Returns whether or not the operation was successful.
     virtual bool Rename(std::string_view name) = 0;
 
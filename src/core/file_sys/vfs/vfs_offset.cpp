@@ -56,6 +56,11 @@ std::size_t OffsetVfsFile::Write(const u8* data, std::size_t length, std::size_t
     return file->Write(data, TrimToFit(length, r_offset), offset + r_offset);
 }
 
+std::optional<std::span<const u8>> OffsetVfsFile::ReadDirect(std::size_t length,
+                                                            std::size_t r_offset) const {
+    return file->ReadDirect(TrimToFit(length, r_offset), offset + r_offset);
+}
+
 std::optional<u8> OffsetVfsFile::ReadByte(std::size_t r_offset) const {
     if (r_offset >= size) {
         return std::nullopt;
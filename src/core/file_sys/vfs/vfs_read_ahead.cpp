@@ -0,0 +1,262 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "common/div_ceil.h"
+#include "core/file_sys/vfs/vfs_read_ahead.h"
+
+namespace FileSys {
+namespace {
+using Clock = std::chrono::steady_clock;
+
+u64 NanosecondsSince(Clock::time_point start) {
+    return static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+} // Anonymous namespace
+
+ReadAheadCache::ReadAheadCache(size_t capacity, size_t num_threads)
+    : max_blocks{std::max<size_t>(capacity / BlockSize, 1)}, workers{num_threads,
+                                                                      "RomFsReadAhead"} {}
+
+ReadAheadCache::~ReadAheadCache() = default;
+
+VirtualFile ReadAheadCache::Wrap(VirtualFile file) {
+    if (!file || file->IsWritable() || file->GetSize() <= BlockSize) {
+        return file;
+    }
+    // Memory backed files are read ahead by the host already
+    if (file->ReadDirect(0, 0)) {
+        return file;
+    }
+    return std::make_shared<ReadAheadVfsFile>(*this, std::move(file));
+}
+
+ReadAheadStats ReadAheadCache::GetAndResetStats() {
+    return {
+        .hits = hits.exchange(0, std::memory_order_relaxed),
+        .misses = misses.exchange(0, std::memory_order_relaxed),
+        .prefetches = prefetches.exchange(0, std::memory_order_relaxed),
+        .wait_ns = wait_ns.exchange(0, std::memory_order_relaxed),
+    };
+}
+
+bool ReadAheadCache::Contains(u64 file_id, size_t block_index) {
+    std::scoped_lock lk{mutex};
+    return blocks.contains(Key{file_id, block_index});
+}
+
+size_t ReadAheadCache::ReadBlock(const VirtualFile& backend, u64 file_id, size_t block_index,
+                                 u8* data, size_t length, size_t block_offset) {
+    const auto copy_out = [&](const std::vector<u8>& block) {
+        if (block_offset >= block.size()) {
+            return size_t{0};
+        }
+        const size_t copied = std::min(length, block.size() - block_offset);
+        std::memcpy(data, block.data() + block_offset, copied);
+        return copied;
+    };
+    const Key key{file_id, block_index};
+    {
+        std::unique_lock lk{mutex};
+        auto it = blocks.find(key);
+        if (it != blocks.end()) {
+            hits.fetch_add(1, std::memory_order_relaxed);
+            if (!it->second.ready) {
+                const auto start = Clock::now();
+                block_ready.wait(lk, [&] {
+                    it = blocks.find(key);
+                    return it == blocks.end() || it->second.ready;
+                });
+                AddWaitTime(NanosecondsSince(start));
+            }
+        }
+        if (it != blocks.end()) {
+            lru.splice(lru.begin(), lru, it->second.lru_it);
+            return copy_out(it->second.data);
+        }
+        misses.fetch_add(1, std::memory_order_relaxed);
+        blocks.emplace(key, Block{});
+    }
+    const auto start = Clock::now();
+    std::vector<u8> block = ReadBlockFromBackend(*backend, block_index);
+    AddWaitTime(NanosecondsSince(start));
+
+    const size_t copied = copy_out(block);
+    {
+        std::scoped_lock lk{mutex};
+        CompleteBlockLocked(key, std::move(block));
+    }
+    block_ready.notify_all();
+    return copied;
+}
+
+void ReadAheadCache::Prefetch(const VirtualFile& backend, u64 file_id, size_t first_block,
+                              size_t num_blocks) {
+    std::vector<size_t> queued;
+    {
+        std::scoped_lock lk{mutex};
+        for (size_t block_index = first_block; block_index < first_block + num_blocks;
+             ++block_index) {
+            if (blocks.try_emplace(Key{file_id, block_index}).second) {
+                queued.push_back(block_index);
+            }
+        }
+    }
+    for (const size_t block_index : queued) {
+        workers.QueueWork([this, backend, file_id, block_index] {
+            std::vector<u8> block = ReadBlockFromBackend(*backend, block_index);
+            {
+                std::scoped_lock lk{mutex};
+                prefetches.fetch_add(1, std::memory_order_relaxed);
+                CompleteBlockLocked(Key{file_id, block_index}, std::move(block));
+            }
+            block_ready.notify_all();
+        });
+    }
+}
+
+void ReadAheadCache::Invalidate(u64 file_id) {
+    std::scoped_lock lk{mutex};
+    auto it = blocks.lower_bound(Key{file_id, 0});
+    while (it != blocks.end() && it->first.first == file_id) {
+        if (it->second.ready) {
+            lru.erase(it->second.lru_it);
+        }
+        it = blocks.erase(it);
+    }
+}
+
+size_t ReadAheadCache::ReadFromBackend(const VfsFile& backend, u8* data, size_t length,
+                                       size_t offset) {
+    std::scoped_lock lk{io_mutex};
+    return backend.Read(data, length, offset);
+}
+
+std::vector<u8> ReadAheadCache::ReadBlockFromBackend(const VfsFile& backend, size_t block_index) {
+    std::vector<u8> block(BlockSize);
+    block.resize(ReadFromBackend(backend, block.data(), BlockSize, block_index * BlockSize));
+    return block;
+}
+
+void ReadAheadCache::CompleteBlockLocked(const Key& key, std::vector<u8>&& data) {
+    const auto it = blocks.find(key);
+    if (it == blocks.end() || it->second.ready) {
+        return;
+    }
+    it->second.data = std::move(data);
+    it->second.ready = true;
+    lru.push_front(key);
+    it->second.lru_it = lru.begin();
+    EvictLocked();
+}
+
+void ReadAheadCache::EvictLocked() {
+    while (lru.size() > max_blocks) {
+        blocks.erase(lru.back());
+        lru.pop_back();
+    }
+}
+
+ReadAheadVfsFile::ReadAheadVfsFile(ReadAheadCache& cache_, VirtualFile backend_)
+    : cache{cache_}, backend{std::move(backend_)},
+      file_id{cache.next_file_id.fetch_add(1, std::memory_order_relaxed)},
+      size{backend->GetSize()} {}
+
+ReadAheadVfsFile::~ReadAheadVfsFile() {
+    cache.Invalidate(file_id);
+}
+
+std::string ReadAheadVfsFile::GetName() const {
+    return backend->GetName();
+}
+
+std::size_t ReadAheadVfsFile::GetSize() const {
+    return size;
+}
+
+bool ReadAheadVfsFile::Resize(std::size_t new_size) {
+    return false;
+}
+
+VirtualDir ReadAheadVfsFile::GetContainingDirectory() const {
+    return backend->GetContainingDirectory();
+}
+
+bool ReadAheadVfsFile::IsWritable() const {
+    return false;
+}
+
+bool ReadAheadVfsFile::IsReadable() const {
+    return backend->IsReadable();
+}
+
+std::size_t ReadAheadVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    if (offset >= size) {
+        return 0;
+    }
+    length = std::min(length, size - offset);
+
+    // Large reads that nothing was prefetched for gain nothing from going through blocks
+    constexpr size_t BlockSize = ReadAheadCache::BlockSize;
+    if (length >= ReadAheadCache::BypassSize && !cache.Contains(file_id, offset / BlockSize)) {
+        const auto start = Clock::now();
+        const std::size_t read = cache.ReadFromBackend(*backend, data, length, offset);
+        cache.AddWaitTime(NanosecondsSince(start));
+        OnRead(offset, read);
+        return read;
+    }
+
+    std::size_t read = 0;
+    while (read < length) {
+        const std::size_t position = offset + read;
+        const std::size_t block_offset = position % BlockSize;
+        const std::size_t block_length = std::min(length - read, BlockSize - block_offset);
+        const std::size_t copied = cache.ReadBlock(backend, file_id, position / BlockSize,
+                                                   data + read, block_length, block_offset);
+        read += copied;
+        if (copied != block_length) {
+            break;
+        }
+    }
+    OnRead(offset, read);
+    return read;
+}
+
+std::size_t ReadAheadVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    return 0;
+}
+
+bool ReadAheadVfsFile::Rename(std::string_view name) {
+    return false;
+}
+
+std::string ReadAheadVfsFile::GetFullPath() const {
+    return backend->GetFullPath();
+}
+
+void ReadAheadVfsFile::OnRead(std::size_t offset, std::size_t length) const {
+    const std::size_t end = offset + length;
+    u32 streak = 0;
+    if (next_offset.exchange(end, std::memory_order_relaxed) == offset && length != 0) {
+        streak = sequential_reads.fetch_add(1, std::memory_order_relaxed) + 1;
+    } else {
+        sequential_reads.store(0, std::memory_order_relaxed);
+    }
+    if (streak < ReadAheadCache::SequentialThreshold || end >= size) {
+        return;
+    }
+    // Prefetch as far ahead as the guest reads per call, times the number of sequential reads
+    constexpr size_t BlockSize = ReadAheadCache::BlockSize;
+    const size_t blocks_per_read = Common::DivCeil(length, BlockSize);
+    const size_t first_block = end / BlockSize;
+    const size_t num_blocks =
+        std::min({ReadAheadCache::MaxPrefetchBlocks, blocks_per_read * streak,
+                  Common::DivCeil(size, BlockSize) - first_block});
+    cache.Prefetch(backend, file_id, first_block, num_blocks);
+}
+
+} // namespace FileSys
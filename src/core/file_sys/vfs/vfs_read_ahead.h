@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "common/thread_worker.h"
+#include "core/file_sys/vfs/vfs.h"
+#include "core/file_sys/vfs/vfs_read_ahead_stats.h"
+
+namespace FileSys {
+
+/**
+ * Cache of fixed size blocks of read only files shared by every file it wraps.
+ * Files read sequentially get the blocks following each read prefetched on a background thread,
+ * which also runs the decryption layers under the file. Blocks are evicted in LRU order.
+ *
+ * Storage layers like AesCtrStorage are not reentrant and are shared by every file opened from a
+ * RomFS, so all reads of backing files go through a single lock. Prefetching overlaps them with
+ * the guest running, not with each other.
+ */
+class ReadAheadCache {
+public:
+    /// 256 KiB, large enough for the AES-CTR and bucket tree layers to work in bulk
+    static constexpr size_t BlockSize = 0x40000;
+
+    /// Reads at least this large skip the cache and are read straight into the guest buffer
+    static constexpr size_t BypassSize = 4 * BlockSize;
+
+    /// Sequential reads of a file needed before blocks after them are prefetched
+    static constexpr u32 SequentialThreshold = 2;
+
+    /// Most blocks prefetched after a read, the window grows with every sequential read
+    static constexpr size_t MaxPrefetchBlocks = 16;
+
+    /**
+     * @param capacity Bytes of blocks kept in the cache
+     * @param num_threads Background threads prefetching blocks
+     */
+    explicit ReadAheadCache(size_t capacity, size_t num_threads = 1);
+    ~ReadAheadCache();
+
+    ReadAheadCache(const ReadAheadCache&) = delete;
+    ReadAheadCache& operator=(const ReadAheadCache&) = delete;
+
+    /// Wraps a file with the cache, files that are writable or backed by memory are returned as is
+    [[nodiscard]] VirtualFile Wrap(VirtualFile file);
+
+    /// Returns the stats since the last call and resets them
+    [[nodiscard]] ReadAheadStats GetAndResetStats();
+
+private:
+    friend class ReadAheadVfsFile;
+
+    using Key = std::pair<u64, size_t>;
+
+    struct Block {
+        std::vector<u8> data;
+        std::list<Key>::iterator lru_it{};
+        bool ready{};
+    };
+
+    /// Returns true when a block is cached or being prefetched
+    [[nodiscard]] bool Contains(u64 file_id, size_t block_index);
+
+    /// Copies part of a block to data, reading it from the backing file when it is not cached
+    /// @returns The number of bytes copied, less than length past the end of the backing file
+    [[nodiscard]] size_t ReadBlock(const VirtualFile& backend, u64 file_id, size_t block_index,
+                                   u8* data, size_t length, size_t block_offset);
+
+    /// Queues reading blocks that are not in the cache yet
+    void Prefetch(const VirtualFile& backend, u64 file_id, size_t first_block, size_t num_blocks);
+
+    /// Drops every block of a file
+    void Invalidate(u64 file_id);
+
+    /// Reads from a backing file while holding the I/O lock
+    size_t ReadFromBackend(const VfsFile& backend, u8* data, size_t length, size_t offset);
+
+    /// Reads a block from the backing file
+    std::vector<u8> ReadBlockFromBackend(const VfsFile& backend, size_t block_index);
+
+    /// Marks an in flight block as ready, discarding it when it was invalidated in the meantime
+    void CompleteBlockLocked(const Key& key, std::vector<u8>&& data);
+
+    /// Evicts ready blocks until the cache fits in its capacity
+    void EvictLocked();
+
+    void AddWaitTime(u64 ns) {
+        wait_ns.fetch_add(ns, std::memory_order_relaxed);
+    }
+
+    const size_t max_blocks;
+    std::atomic<u64> next_file_id{1};
+
+    std::mutex io_mutex;
+    std::mutex mutex;
+    std::condition_variable block_ready;
+    std::map<Key, Block> blocks;
+    std::list<Key> lru; ///< Ready blocks, most recently used first
+
+    std::atomic<u64> hits{};
+    std::atomic<u64> misses{};
+    std::atomic<u64> prefetches{};
+    std::atomic<u64> wait_ns{};
+
+    Common::ThreadWorker workers;
+};
+
+/// A read only VfsFile that reads another one through a ReadAheadCache
+class ReadAheadVfsFile : public VfsFile {
+public:
+    ReadAheadVfsFile(ReadAheadCache& cache, VirtualFile backend);
+    ~ReadAheadVfsFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    VirtualDir GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Rename(std::string_view name) override;
+    std::string GetFullPath() const override;
+
+private:
+    /// Tracks sequential reads and prefetches the blocks following the read
+    void OnRead(std::size_t offset, std::size_t length) const;
+
+    ReadAheadCache& cache;
+    VirtualFile backend;
+    const u64 file_id;
+    const std::size_t size;
+
+    mutable std::atomic<std::size_t> next_offset{};
+    mutable std::atomic<u32> sequential_reads{};
+};
+
+} // namespace FileSys
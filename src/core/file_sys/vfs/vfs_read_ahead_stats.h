@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace FileSys {
+
+/// Block lookups of the read ahead cache since the last reset
+struct ReadAheadStats {
+    u64 hits{};       ///< Blocks found in the cache, including ones still being prefetched
+    u64 misses{};     ///< Blocks read synchronously from the backing file
+    u64 prefetches{}; ///< Blocks read by the background threads
+    u64 wait_ns{};    ///< Host time guest reads spent waiting on the backing file
+};
+
+} // namespace FileSys
@@ -5,7 +5,9 @@
 #include <cstddef>
 #include <iterator>
 #include <utility>
+#include <cstring>
 #include "common/assert.h"
+#include "common/literals.h"
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
@@ -28,10 +30,18 @@ namespace FileSys {
 
 namespace FS = Common::FS;
 
+using namespace Common::Literals;
+
 namespace {
 
 constexpr size_t MaxOpenFiles = 512;
 
+// Read only files at least this large are mapped instead of read through a file handle
+constexpr u64 MinMappedFileSize = 64_MiB;
+
+// Reads at least this large on mapped files start reading the whole range ahead of the copy
+constexpr size_t MappedReadAheadSize = 1_MiB;
+
 constexpr FS::FileAccessMode ModeFlagsToFileAccessMode(OpenMode mode) {
     switch (mode) {
     case OpenMode::Read:
@@ -90,6 +100,11 @@ VirtualFile RealVfsFilesystem::OpenFileFromEntry(std::string_view path_, std::op
         return nullptr;
     }
 
+    if (auto file = this->TryOpenMappedFileLocked(path, size, perms); file) {
+        cache[path] = file;
+        return file;
+    }
+
     auto reference = std::make_unique<FileReference>();
     this->InsertReferenceIntoListLocked(*reference);
 
@@ -100,6 +115,37 @@ VirtualFile RealVfsFilesystem::OpenFileFromEntry(std::string_view path_, std::op
     return file;
 }
 
+VirtualFile RealVfsFilesystem::TryOpenMappedFileLocked(const std::string& path,
+                                                       std::optional<u64> size, OpenMode perms) {
+    // Mapping large files needs the address space of a 64-bit host
+    if constexpr (sizeof(void*) < 8) {
+        return nullptr;
+    }
+#ifdef ANDROID
+    // Content URIs are only reachable through file descriptors given by the frontend
+    if (path[0] != '/') {
+        return nullptr;
+    }
+#endif
+    if (perms != OpenMode::Read) {
+        return nullptr;
+    }
+    if (!size) {
+        size = FS::GetSize(path);
+    }
+    if (*size < MinMappedFileSize) {
+        return nullptr;
+    }
+    FS::MappedFile mapping{path};
+    if (!mapping.IsOpen()) {
+        return nullptr;
+    }
+    // Game images are read at scattered offsets, large reads ask for read ahead themselves
+    mapping.Advise(FS::MappedFileAccess::Random, 0, mapping.Data().size());
+    return std::shared_ptr<RealVfsMappedFile>(
+        new RealVfsMappedFile(*this, std::move(mapping), path));
+}
+
 VirtualFile RealVfsFilesystem::OpenFile(std::string_view path_, OpenMode perms) {
     return OpenFileFromEntry(path_, {}, perms);
 }
@@ -329,10 +375,76 @@ std::size_t RealVfsFile::Write(const u8* data, std::size_t length, std::size_t o
     return reference->file->WriteSpan(std::span{data, length});
 }
 
+bool RealVfsFile::Commit() {
+    auto lk = base.RefreshReference(path, perms, *reference);
+    return reference->file ? reference->file->Commit() : false;
+}
+
 bool RealVfsFile::Rename(std::string_view name) {
     return base.MoveFile(path, parent_path + '/' + std::string(name)) != nullptr;
 }
 
+RealVfsMappedFile::RealVfsMappedFile(RealVfsFilesystem& base_, FS::MappedFile&& mapping_,
+                                     const std::string& path_)
+    : base(base_), mapping(std::move(mapping_)), path(path_),
+      parent_path(FS::GetParentPath(path_)), path_components(FS::SplitPathComponentsCopy(path_)) {
+}
+
+RealVfsMappedFile::~RealVfsMappedFile() = default;
+
+std::string RealVfsMappedFile::GetName() const {
+    return path_components.empty() ? "" : std::string(path_components.back());
+}
+
+std::size_t RealVfsMappedFile::GetSize() const {
+    return mapping.Data().size();
+}
+
+bool RealVfsMappedFile::Resize(std::size_t new_size) {
+    return false;
+}
+
+VirtualDir RealVfsMappedFile::GetContainingDirectory() const {
+    return base.OpenDirectory(parent_path, OpenMode::Read);
+}
+
+bool RealVfsMappedFile::IsWritable() const {
+    return false;
+}
+
+bool RealVfsMappedFile::IsReadable() const {
+    return true;
+}
+
+std::size_t RealVfsMappedFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    const auto view = ReadDirect(length, offset);
+    if (view->empty()) {
+        return 0;
+    }
+    if (view->size() >= MappedReadAheadSize) {
+        mapping.Advise(FS::MappedFileAccess::WillNeed, offset, view->size());
+    }
+    std::memcpy(data, view->data(), view->size());
+    return view->size();
+}
+
+std::size_t RealVfsMappedFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    return 0;
+}
+
+std::optional<std::span<const u8>> RealVfsMappedFile::ReadDirect(std::size_t length,
+                                                                 std::size_t offset) const {
+    const std::span<const u8> contents = mapping.Data();
+    if (offset >= contents.size()) {
+        return std::span<const u8>{};
+    }
+    return contents.subspan(offset, std::min(length, contents.size() - offset));
+}
+
+bool RealVfsMappedFile::Rename(std::string_view name) {
+    return base.MoveFile(path, parent_path + '/' + std::string(name)) != nullptr;
+}
+
 // TODO(DarkLordZach): MSVC would not let me combine the following two functions using 'if
 // constexpr' because there is a compile error in the branch not used.
 
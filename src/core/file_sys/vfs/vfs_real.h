@@ -7,6 +7,7 @@
 #include <mutex>
 #include <optional>
 #include <string_view>
+#include "common/fs/mapped_file.h"
 #include "common/intrusive_list.h"
 #include "core/file_sys/fs_filesystem.h"
 #include "core/file_sys/vfs/vfs.h"
@@ -22,6 +23,7 @@ struct FileReference : public Common::IntrusiveListBaseNode<FileReference> {
 };
 
 class RealVfsFile;
+class RealVfsMappedFile;
 class RealVfsDirectory;
 
 class RealVfsFilesystem : public VfsFilesystem {
@@ -63,6 +65,8 @@ private:
     friend class RealVfsDirectory;
     VirtualFile OpenFileFromEntry(std::string_view path, std::optional<u64> size,
                                   OpenMode perms = OpenMode::Read);
+    VirtualFile TryOpenMappedFileLocked(const std::string& path, std::optional<u64> size,
+                                        OpenMode perms);
 
 private:
     void EvictSingleReferenceLocked();
@@ -86,6 +90,7 @@ public:
     bool IsReadable() const override;
     std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
     std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Commit() override;
     bool Rename(std::string_view name) override;
 
 private:
@@ -102,6 +107,38 @@ private:
     OpenMode perms;
 };
 
+// A read only VfsFile that maps a file on the user's computer in memory. Used for large game
+// images, reads are a copy from the mapping instead of a seek and a read through a cached handle,
+// and ReadDirect returns views of the mapping. The file must not shrink while it is mapped.
+class RealVfsMappedFile : public VfsFile {
+    friend class RealVfsFilesystem;
+
+public:
+    ~RealVfsMappedFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    VirtualDir GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    std::optional<std::span<const u8>> ReadDirect(std::size_t length,
+                                                  std::size_t offset) const override;
+    bool Rename(std::string_view name) override;
+
+private:
+    RealVfsMappedFile(RealVfsFilesystem& base, Common::FS::MappedFile&& mapping,
+                      const std::string& path);
+
+    RealVfsFilesystem& base;
+    Common::FS::MappedFile mapping;
+    std::string path;
+    std::string parent_path;
+    std::vector<std::string> path_components;
+};
+
 // An implementation of VfsDirectory that represents a directory on the user's computer.
 class RealVfsDirectory : public VfsDirectory {
     friend class RealVfsFilesystem;
@@ -50,6 +50,14 @@ public:
         return read;
     }
 
+    std::optional<std::span<const u8>> ReadDirect(std::size_t length,
+                                                  std::size_t offset) const override {
+        if (offset > size) {
+            return std::span<const u8>{};
+        }
+        return std::span<const u8>{data}.subspan(offset, std::min(length, size - offset));
+    }
+
     std::size_t Write(const u8* data_, std::size_t length, std::size_t offset) override {
         return 0;
     }
@@ -0,0 +1,583 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/polyfill_thread.h"
+#include "common/settings.h"
+#include "common/thread.h"
+#include "core/file_sys/vfs/vfs_real.h"
+#include "core/file_sys/vfs/vfs_write_back.h"
+
+namespace FileSys {
+namespace {
+using namespace std::chrono_literals;
+
+constexpr u32 JournalMagic = Common::MakeMagic('Y', 'S', 'W', 'J');
+constexpr u32 JournalVersion = 1;
+constexpr u64 JournalCommitMagic = 0x54494D4D4F434A57; // "WJCOMMIT"
+
+/// How often the flusher thread looks for saves that weren't written to for their delay
+constexpr auto FlushInterval = 250ms;
+
+struct JournalHeader {
+    u32 magic;
+    u32 version;
+    u64 num_entries;
+};
+static_assert(sizeof(JournalHeader) == 0x10, "JournalHeader has incorrect size.");
+
+struct JournalEntry {
+    u64 data_size;
+    u64 hash;
+    u32 path_size;
+    INSERT_PADDING_BYTES(4);
+};
+static_assert(sizeof(JournalEntry) == 0x18, "JournalEntry has incorrect size.");
+
+/// Written and synced after every entry, a journal without it was interrupted before any file
+/// was touched and is discarded
+struct JournalFooter {
+    u64 magic;
+    u64 checksum;
+};
+static_assert(sizeof(JournalFooter) == 0x10, "JournalFooter has incorrect size.");
+
+u64 HashEntry(std::string_view path, std::span<const u8> data) {
+    return Common::CityHash64WithSeed(reinterpret_cast<const char*>(data.data()), data.size(),
+                                      Common::CityHash64(path.data(), path.size()));
+}
+
+u64 AccumulateChecksum(u64 checksum, u64 hash) {
+    return Common::CityHash64WithSeed(reinterpret_cast<const char*>(&hash), sizeof(hash),
+                                      checksum);
+}
+
+/// Replaces the contents of a file and waits until they're stored
+bool WriteFileContents(VfsFile& file, std::span<const u8> data) {
+    return file.Resize(data.size()) && file.Write(data.data(), data.size(), 0) == data.size() &&
+           file.Commit();
+}
+
+struct Registry {
+    Registry() {
+        flusher = std::jthread([this](std::stop_token stop_token) { Run(stop_token); });
+    }
+
+    void Run(std::stop_token stop_token) {
+        Common::SetCurrentThreadName("SaveDataFlusher");
+        while (Common::StoppableTimedWait(stop_token, FlushInterval)) {
+            std::vector<std::weak_ptr<WriteBackSaveData>> open_saves;
+            {
+                std::scoped_lock lk{mutex};
+                for (const auto& [path, save] : saves) {
+                    open_saves.push_back(save);
+                }
+            }
+            for (const auto& weak_save : open_saves) {
+                if (const auto save = weak_save.lock()) {
+                    save->FlushIfIdle();
+                }
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable closed;
+    std::map<std::string, std::weak_ptr<WriteBackSaveData>, std::less<>> saves;
+    std::jthread flusher;
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+std::string NormalizePath(std::string_view path) {
+    return std::string(Common::FS::RemoveTrailingSlash(Common::FS::SanitizePath(path)));
+}
+} // Anonymous namespace
+
+VirtualDir WriteBackSaveData::Wrap(VirtualDir dir) {
+    const u32 delay_seconds = Settings::values.save_data_write_back_delay.GetValue();
+    if (dir == nullptr || delay_seconds == 0 || !dir->IsWritable() ||
+        dynamic_cast<RealVfsDirectory*>(dir.get()) == nullptr) {
+        return dir;
+    }
+
+    std::string root_path = NormalizePath(dir->GetFullPath());
+    auto& registry = GetRegistry();
+    std::unique_lock lk{registry.mutex};
+
+    std::shared_ptr<WriteBackSaveData> save;
+    while (true) {
+        const auto it = registry.saves.find(root_path);
+        if (it == registry.saves.end()) {
+            break;
+        }
+        save = it->second.lock();
+        if (save) {
+            break;
+        }
+        // The last wrapper of the directory is being destroyed, wait for it to write back
+        registry.closed.wait(lk);
+    }
+
+    if (!save) {
+        save = std::make_shared<WriteBackSaveData>(dir, root_path,
+                                                   std::chrono::seconds{delay_seconds});
+        save->ReplayJournal();
+        registry.saves.emplace(std::move(root_path), save);
+    }
+    return std::make_shared<WriteBackVfsDirectory>(std::move(save), std::move(dir));
+}
+
+bool WriteBackSaveData::Commit(const VirtualDir& dir) {
+    if (const auto* const write_back = dynamic_cast<const WriteBackVfsDirectory*>(dir.get())) {
+        return write_back->GetSaveData().Flush();
+    }
+    return true;
+}
+
+WriteBackSaveData::WriteBackSaveData(VirtualDir root_, std::string root_path_,
+                                     std::chrono::milliseconds delay_)
+    : root{std::move(root_)}, root_path{std::move(root_path_)},
+      journal_path{root_path + ".journal"}, delay{delay_} {}
+
+WriteBackSaveData::~WriteBackSaveData() {
+    auto& registry = GetRegistry();
+    {
+        std::scoped_lock lk{registry.mutex, mutex};
+        FlushLocked();
+        if (const auto it = registry.saves.find(root_path);
+            it != registry.saves.end() && it->second.expired()) {
+            registry.saves.erase(it);
+        }
+    }
+    registry.closed.notify_all();
+}
+
+bool WriteBackSaveData::Flush() {
+    std::scoped_lock lk{mutex};
+    return FlushLocked();
+}
+
+void WriteBackSaveData::FlushIfIdle() {
+    std::scoped_lock lk{mutex};
+    if (pending.empty() || flush_failed || Clock::now() - last_write < delay) {
+        return;
+    }
+    FlushLocked();
+}
+
+std::size_t WriteBackSaveData::GetSize(const VirtualFile& file, const std::string& path) {
+    std::scoped_lock lk{mutex};
+    if (const auto it = pending.find(path); it != pending.end()) {
+        return it->second.data.size();
+    }
+    return file->GetSize();
+}
+
+bool WriteBackSaveData::Resize(const VirtualFile& file, const std::string& path,
+                               std::size_t new_size) {
+    std::scoped_lock lk{mutex};
+    auto* const entry = GetPending(file, path, new_size);
+    if (entry == nullptr) {
+        return file->Resize(new_size);
+    }
+    pending_size = pending_size - entry->data.size() + new_size;
+    entry->data.resize(new_size);
+    last_write = Clock::now();
+    flush_failed = false;
+    return true;
+}
+
+std::size_t WriteBackSaveData::Read(const VirtualFile& file, const std::string& path, u8* data,
+                                    std::size_t length, std::size_t offset) {
+    std::scoped_lock lk{mutex};
+    const auto it = pending.find(path);
+    if (it == pending.end()) {
+        return file->Read(data, length, offset);
+    }
+    const auto& contents = it->second.data;
+    if (offset >= contents.size()) {
+        return 0;
+    }
+    const std::size_t read_size = std::min(length, contents.size() - offset);
+    std::memcpy(data, contents.data() + offset, read_size);
+    return read_size;
+}
+
+std::size_t WriteBackSaveData::Write(const VirtualFile& file, const std::string& path,
+                                     const u8* data, std::size_t length, std::size_t offset) {
+    std::scoped_lock lk{mutex};
+    auto* const entry = GetPending(file, path, offset + length);
+    if (entry == nullptr) {
+        return file->Write(data, length, offset);
+    }
+    if (entry->data.size() < offset + length) {
+        pending_size += offset + length - entry->data.size();
+        entry->data.resize(offset + length);
+    }
+    std::memcpy(entry->data.data() + offset, data, length);
+    last_write = Clock::now();
+    flush_failed = false;
+    return length;
+}
+
+WriteBackSaveData::PendingFile* WriteBackSaveData::GetPending(const VirtualFile& file,
+                                                              const std::string& path,
+                                                              std::size_t min_size) {
+    if (const auto it = pending.find(path); it != pending.end()) {
+        return &it->second;
+    }
+    // Reached through the parent of the save, it can't be stored in the journal
+    if (!path.starts_with(root_path) || path.size() <= root_path.size() ||
+        path[root_path.size()] != '/') {
+        return nullptr;
+    }
+
+    const std::size_t size = file->GetSize();
+    const std::size_t buffered_size = std::max(size, min_size);
+    if (pending_size + buffered_size > MaxPendingSize) {
+        FlushLocked();
+        if (buffered_size > MaxPendingSize) {
+            return nullptr;
+        }
+    }
+
+    PendingFile entry{
+        .file = file,
+        .data = file->ReadAllBytes(),
+    };
+    if (entry.data.size() != size) {
+        LOG_ERROR(Service_FS, "Failed to read {} to buffer its writes", path);
+        return nullptr;
+    }
+    pending_size += entry.data.size();
+    return &pending.emplace(path, std::move(entry)).first->second;
+}
+
+bool WriteBackSaveData::FlushLocked() {
+    if (pending.empty()) {
+        return true;
+    }
+
+    // Nothing was touched yet when the journal couldn't be written, try again later
+    if (!WriteJournal()) {
+        LOG_ERROR(Service_FS, "Failed to write the journal of save data {}", root_path);
+        flush_failed = true;
+        return false;
+    }
+
+    bool success = true;
+    for (const auto& [path, entry] : pending) {
+        if (!WriteFileContents(*entry.file, entry.data)) {
+            LOG_ERROR(Service_FS, "Failed to write back {}", path);
+            success = false;
+        }
+    }
+    // The journal is kept so the files are written again the next time the save is opened
+    if (!success) {
+        flush_failed = true;
+        return false;
+    }
+
+    void(Common::FS::RemoveFile(journal_path));
+    pending.clear();
+    pending_size = 0;
+    flush_failed = false;
+    return true;
+}
+
+bool WriteBackSaveData::WriteJournal() const {
+    const Common::FS::IOFile journal{journal_path, Common::FS::FileAccessMode::Write,
+                                     Common::FS::FileType::BinaryFile};
+    if (!journal.IsOpen()) {
+        return false;
+    }
+
+    const JournalHeader header{
+        .magic = JournalMagic,
+        .version = JournalVersion,
+        .num_entries = pending.size(),
+    };
+    if (!journal.WriteObject(header)) {
+        return false;
+    }
+
+    u64 checksum = 0;
+    for (const auto& [path, entry] : pending) {
+        const std::string_view relative_path = std::string_view{path}.substr(root_path.size() + 1);
+        const JournalEntry journal_entry{
+            .data_size = entry.data.size(),
+            .hash = HashEntry(relative_path, entry.data),
+            .path_size = static_cast<u32>(relative_path.size()),
+        };
+        if (!journal.WriteObject(journal_entry) ||
+            journal.WriteSpan<char>(relative_path) != relative_path.size() ||
+            journal.WriteSpan<u8>(entry.data) != entry.data.size()) {
+            return false;
+        }
+        checksum = AccumulateChecksum(checksum, journal_entry.hash);
+    }
+
+    // The footer must only reach the disk after the entries
+    if (!journal.Commit()) {
+        return false;
+    }
+    const JournalFooter footer{
+        .magic = JournalCommitMagic,
+        .checksum = checksum,
+    };
+    return journal.WriteObject(footer) && journal.Commit();
+}
+
+void WriteBackSaveData::ReplayJournal() const {
+    if (!Common::FS::Exists(journal_path)) {
+        return;
+    }
+
+    std::vector<std::pair<std::string, std::vector<u8>>> entries;
+    const bool complete = [&] {
+        const Common::FS::IOFile journal{journal_path, Common::FS::FileAccessMode::Read,
+                                         Common::FS::FileType::BinaryFile};
+        const u64 journal_size = journal.GetSize();
+
+        JournalHeader header{};
+        if (!journal.ReadObject(header) || header.magic != JournalMagic ||
+            header.version != JournalVersion) {
+            return false;
+        }
+
+        u64 checksum = 0;
+        for (u64 i = 0; i < header.num_entries; ++i) {
+            JournalEntry entry{};
+            if (!journal.ReadObject(entry) ||
+                entry.path_size + entry.data_size >
+                    journal_size - static_cast<u64>(journal.Tell())) {
+                return false;
+            }
+            std::string path(entry.path_size, '\0');
+            std::vector<u8> data(entry.data_size);
+            if (journal.ReadSpan<char>(path) != path.size() ||
+                journal.ReadSpan<u8>(data) != data.size() || HashEntry(path, data) != entry.hash) {
+                return false;
+            }
+            checksum = AccumulateChecksum(checksum, entry.hash);
+            entries.emplace_back(std::move(path), std::move(data));
+        }
+
+        JournalFooter footer{};
+        return journal.ReadObject(footer) && footer.magic == JournalCommitMagic &&
+               footer.checksum == checksum;
+    }();
+
+    if (!complete) {
+        LOG_WARNING(Service_FS, "Discarding the incomplete journal of save data {}", root_path);
+        void(Common::FS::RemoveFile(journal_path));
+        return;
+    }
+
+    for (const auto& [path, data] : entries) {
+        auto file = root->GetFileRelative(path);
+        if (file == nullptr) {
+            file = root->CreateFileRelative(path);
+        }
+        if (file == nullptr || !WriteFileContents(*file, data)) {
+            LOG_ERROR(Service_FS, "Failed to recover {} of save data {} from its journal", path,
+                      root_path);
+            return;
+        }
+    }
+
+    LOG_INFO(Service_FS, "Recovered {} files of save data {} from its journal", entries.size(),
+             root_path);
+    void(Common::FS::RemoveFile(journal_path));
+}
+
+WriteBackVfsFile::WriteBackVfsFile(std::shared_ptr<WriteBackSaveData> save_, VirtualFile base_)
+    : save{std::move(save_)}, base{std::move(base_)}, path{NormalizePath(base->GetFullPath())} {}
+
+WriteBackVfsFile::~WriteBackVfsFile() = default;
+
+std::string WriteBackVfsFile::GetName() const {
+    return base->GetName();
+}
+
+std::size_t WriteBackVfsFile::GetSize() const {
+    return save->GetSize(base, path);
+}
+
+bool WriteBackVfsFile::Resize(std::size_t new_size) {
+    return save->Resize(base, path, new_size);
+}
+
+VirtualDir WriteBackVfsFile::GetContainingDirectory() const {
+    auto dir = base->GetContainingDirectory();
+    if (dir == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<WriteBackVfsDirectory>(save, std::move(dir));
+}
+
+bool WriteBackVfsFile::IsWritable() const {
+    return base->IsWritable();
+}
+
+bool WriteBackVfsFile::IsReadable() const {
+    return base->IsReadable();
+}
+
+std::size_t WriteBackVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    return save->Read(base, path, data, length, offset);
+}
+
+std::size_t WriteBackVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    return save->Write(base, path, data, length, offset);
+}
+
+bool WriteBackVfsFile::Commit() {
+    return save->Flush();
+}
+
+bool WriteBackVfsFile::Rename(std::string_view name) {
+    return save->Flush() && base->Rename(name);
+}
+
+std::string WriteBackVfsFile::GetFullPath() const {
+    return base->GetFullPath();
+}
+
+WriteBackVfsDirectory::WriteBackVfsDirectory(std::shared_ptr<WriteBackSaveData> save_,
+                                             VirtualDir base_)
+    : save{std::move(save_)}, base{std::move(base_)} {}
+
+WriteBackVfsDirectory::~WriteBackVfsDirectory() = default;
+
+VirtualFile WriteBackVfsDirectory::GetFileRelative(std::string_view path) const {
+    return WrapFile(base->GetFileRelative(path));
+}
+
+VirtualDir WriteBackVfsDirectory::GetDirectoryRelative(std::string_view path) const {
+    return WrapDirectory(base->GetDirectoryRelative(path));
+}
+
+std::vector<VirtualFile> WriteBackVfsDirectory::GetFiles() const {
+    auto files = base->GetFiles();
+    for (auto& file : files) {
+        file = WrapFile(std::move(file));
+    }
+    return files;
+}
+
+VirtualFile WriteBackVfsDirectory::GetFile(std::string_view name) const {
+    return WrapFile(base->GetFile(name));
+}
+
+FileTimeStampRaw WriteBackVfsDirectory::GetFileTimeStamp(std::string_view path) const {
+    return base->GetFileTimeStamp(path);
+}
+
+std::vector<VirtualDir> WriteBackVfsDirectory::GetSubdirectories() const {
+    auto dirs = base->GetSubdirectories();
+    for (auto& dir : dirs) {
+        dir = WrapDirectory(std::move(dir));
+    }
+    return dirs;
+}
+
+VirtualDir WriteBackVfsDirectory::GetSubdirectory(std::string_view name) const {
+    return WrapDirectory(base->GetSubdirectory(name));
+}
+
+bool WriteBackVfsDirectory::IsWritable() const {
+    return base->IsWritable();
+}
+
+bool WriteBackVfsDirectory::IsReadable() const {
+    return base->IsReadable();
+}
+
+bool WriteBackVfsDirectory::IsRoot() const {
+    return base->IsRoot();
+}
+
+std::string WriteBackVfsDirectory::GetName() const {
+    return base->GetName();
+}
+
+VirtualDir WriteBackVfsDirectory::GetParentDirectory() const {
+    return WrapDirectory(base->GetParentDirectory());
+}
+
+VirtualDir WriteBackVfsDirectory::CreateSubdirectory(std::string_view name) {
+    return WrapDirectory(base->CreateSubdirectory(name));
+}
+
+VirtualFile WriteBackVfsDirectory::CreateFile(std::string_view name) {
+    return WrapFile(base->CreateFile(name));
+}
+
+VirtualFile WriteBackVfsDirectory::CreateFileRelative(std::string_view path) {
+    return WrapFile(base->CreateFileRelative(path));
+}
+
+VirtualDir WriteBackVfsDirectory::CreateDirectoryRelative(std::string_view path) {
+    return WrapDirectory(base->CreateDirectoryRelative(path));
+}
+
+bool WriteBackVfsDirectory::DeleteSubdirectory(std::string_view name) {
+    return save->Flush() && base->DeleteSubdirectory(name);
+}
+
+bool WriteBackVfsDirectory::DeleteSubdirectoryRecursive(std::string_view name) {
+    return save->Flush() && base->DeleteSubdirectoryRecursive(name);
+}
+
+bool WriteBackVfsDirectory::CleanSubdirectoryRecursive(std::string_view name) {
+    return save->Flush() && base->CleanSubdirectoryRecursive(name);
+}
+
+bool WriteBackVfsDirectory::DeleteFile(std::string_view name) {
+    return save->Flush() && base->DeleteFile(name);
+}
+
+bool WriteBackVfsDirectory::Rename(std::string_view name) {
+    return save->Flush() && base->Rename(name);
+}
+
+std::map<std::string, VfsEntryType, std::less<>> WriteBackVfsDirectory::GetEntries() const {
+    return base->GetEntries();
+}
+
+std::string WriteBackVfsDirectory::GetFullPath() const {
+    return base->GetFullPath();
+}
+
+VirtualFile WriteBackVfsDirectory::WrapFile(VirtualFile file) const {
+    if (file == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<WriteBackVfsFile>(save, std::move(file));
+}
+
+VirtualDir WriteBackVfsDirectory::WrapDirectory(VirtualDir dir) const {
+    if (dir == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<WriteBackVfsDirectory>(save, std::move(dir));
+}
+
+} // namespace FileSys
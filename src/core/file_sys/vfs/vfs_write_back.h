@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "core/file_sys/vfs/vfs.h"
+
+namespace FileSys {
+
+/**
+ * Write-back cache of a save data directory on the host. Writes to its files are kept in memory
+ * and written back together when the game commits the save, after it stops writing for a while
+ * or when the last handle to the directory is closed, instead of going to the host every time.
+ *
+ * Writing back goes through a journal next to the directory: the new contents of every file are
+ * written and synced to it before any file is touched, and a journal left behind by a crash is
+ * replayed the next time the directory is opened. Changes to the directory structure write back
+ * the pending writes first, so they're never reordered with them.
+ */
+class WriteBackSaveData {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Files are kept in memory up to this many bytes in total, writes to others go to the host
+    static constexpr size_t MaxPendingSize = 64 * 1024 * 1024;
+
+    /**
+     * Wraps a save data directory, every wrapper of the same directory shares its pending writes.
+     * Directories that aren't on the host are returned as is, and so is every directory when the
+     * save_data_write_back_delay setting is zero.
+     */
+    [[nodiscard]] static VirtualDir Wrap(VirtualDir dir);
+
+    /// Writes back the pending writes of a directory returned by Wrap or one of its
+    /// subdirectories. Returns true on success and for directories that aren't wrapped.
+    static bool Commit(const VirtualDir& dir);
+
+    explicit WriteBackSaveData(VirtualDir root, std::string root_path,
+                               std::chrono::milliseconds delay);
+    ~WriteBackSaveData();
+
+    WriteBackSaveData(const WriteBackSaveData&) = delete;
+    WriteBackSaveData& operator=(const WriteBackSaveData&) = delete;
+
+    /// Writes back every pending write, returns false if the files couldn't be written
+    bool Flush();
+
+    /// Writes back the pending writes when nothing was written for the delay
+    void FlushIfIdle();
+
+private:
+    friend class WriteBackVfsFile;
+
+    struct PendingFile {
+        VirtualFile file;
+        std::vector<u8> data;
+    };
+
+    std::size_t GetSize(const VirtualFile& file, const std::string& path);
+    bool Resize(const VirtualFile& file, const std::string& path, std::size_t new_size);
+    std::size_t Read(const VirtualFile& file, const std::string& path, u8* data,
+                     std::size_t length, std::size_t offset);
+    std::size_t Write(const VirtualFile& file, const std::string& path, const u8* data,
+                      std::size_t length, std::size_t offset);
+
+    /// Returns the pending contents of a file, loading them when it's not buffered yet.
+    /// Returns nullptr when the file should be written to directly instead.
+    PendingFile* GetPending(const VirtualFile& file, const std::string& path,
+                            std::size_t min_size);
+
+    bool FlushLocked();
+    bool WriteJournal() const;
+    void ReplayJournal() const;
+
+    VirtualDir root;
+    std::string root_path;
+    std::string journal_path;
+    std::chrono::milliseconds delay;
+
+    std::mutex mutex;
+    std::map<std::string, PendingFile> pending;
+    std::size_t pending_size{};
+    Clock::time_point last_write{};
+
+    /// Set when writing back failed, the idle timer waits for new writes before trying again
+    bool flush_failed{};
+};
+
+/// File of a directory wrapped by WriteBackSaveData
+class WriteBackVfsFile : public VfsFile {
+public:
+    explicit WriteBackVfsFile(std::shared_ptr<WriteBackSaveData> save, VirtualFile base);
+    ~WriteBackVfsFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    VirtualDir GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Commit() override;
+    bool Rename(std::string_view name) override;
+    std::string GetFullPath() const override;
+
+private:
+    std::shared_ptr<WriteBackSaveData> save;
+    VirtualFile base;
+    std::string path;
+};
+
+/// Directory wrapped by WriteBackSaveData, its files and subdirectories are wrapped as well
+class WriteBackVfsDirectory : public VfsDirectory {
+public:
+    explicit WriteBackVfsDirectory(std::shared_ptr<WriteBackSaveData> save, VirtualDir base);
+    ~WriteBackVfsDirectory() override;
+
+    [[nodiscard]] WriteBackSaveData& GetSaveData() const {
+        return *save;
+    }
+
+    VirtualFile GetFileRelative(std::string_view path) const override;
+    VirtualDir GetDirectoryRelative(std::string_view path) const override;
+    std::vector<VirtualFile> GetFiles() const override;
+    VirtualFile GetFile(std::string_view name) const override;
+    FileTimeStampRaw GetFileTimeStamp(std::string_view path) const override;
+    std::vector<VirtualDir> GetSubdirectories() const override;
+    VirtualDir GetSubdirectory(std::string_view name) const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    bool IsRoot() const override;
+    std::string GetName() const override;
+    VirtualDir GetParentDirectory() const override;
+    VirtualDir CreateSubdirectory(std::string_view name) override;
+    VirtualFile CreateFile(std::string_view name) override;
+    VirtualFile CreateFileRelative(std::string_view path) override;
+    VirtualDir CreateDirectoryRelative(std::string_view path) override;
+    bool DeleteSubdirectory(std::string_view name) override;
+    bool DeleteSubdirectoryRecursive(std::string_view name) override;
+    bool CleanSubdirectoryRecursive(std::string_view name) override;
+    bool DeleteFile(std::string_view name) override;
+    bool Rename(std::string_view name) override;
+    std::map<std::string, VfsEntryType, std::less<>> GetEntries() const override;
+    std::string GetFullPath() const override;
+
+private:
+    VirtualFile WrapFile(VirtualFile file) const;
+    VirtualDir WrapDirectory(VirtualDir dir) const;
+
+    std::shared_ptr<WriteBackSaveData> save;
+    VirtualDir base;
+};
+
+} // namespace FileSys
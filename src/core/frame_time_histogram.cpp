@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/frame_time_histogram.h"
+
+namespace Core {
+
+void FrameTimeHistogram::Add(std::chrono::nanoseconds frame_time) {
+    const s64 ns = std::max<s64>(frame_time.count(), 0);
+    const auto bucket = static_cast<std::size_t>(
+        ns / std::chrono::duration_cast<std::chrono::nanoseconds>(BucketWidth).count());
+    buckets[std::min(bucket, NumBuckets)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+
+    s64 current_max = max_ns.load(std::memory_order_relaxed);
+    while (ns > current_max &&
+           !max_ns.compare_exchange_weak(current_max, ns, std::memory_order_relaxed)) {
+    }
+}
+
+void FrameTimeHistogram::Reset() {
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count.store(0, std::memory_order_relaxed);
+    max_ns.store(0, std::memory_order_relaxed);
+}
+
+u64 FrameTimeHistogram::Count() const {
+    return count.load(std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds FrameTimeHistogram::Max() const {
+    return std::chrono::nanoseconds{max_ns.load(std::memory_order_relaxed)};
+}
+
+std::chrono::nanoseconds FrameTimeHistogram::Percentile(double percentile) const {
+    // Take a copy first, so the rank and the walk agree while frames are being added
+    std::array<u64, NumBuckets + 1> counts;
+    u64 total = 0;
+    for (std::size_t index = 0; index < counts.size(); ++index) {
+        counts[index] = buckets[index].load(std::memory_order_relaxed);
+        total += counts[index];
+    }
+    if (total == 0) {
+        return {};
+    }
+    const double fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+    const u64 rank =
+        std::max<u64>(static_cast<u64>(std::ceil(fraction * static_cast<double>(total))), 1);
+
+    const std::chrono::nanoseconds max = Max();
+    u64 accumulated = 0;
+    for (std::size_t index = 0; index < NumBuckets; ++index) {
+        accumulated += counts[index];
+        if (accumulated >= rank) {
+            return std::min<std::chrono::nanoseconds>(BucketWidth * static_cast<s64>(index + 1),
+                                                       max);
+        }
+    }
+    return max;
+}
+
+u64 FrameTimeHistogram::BucketCount(std::size_t index) const {
+    return buckets[index].load(std::memory_order_relaxed);
+}
+
+} // namespace Core
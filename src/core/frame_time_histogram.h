@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Core {
+
+/**
+ * Histogram of frame times with fixed width buckets. Adding a frame and querying percentiles are
+ * lock-free, so monitoring can read it from any thread while frames are being recorded.
+ * Percentiles are exact to the bucket width, frames longer than the last bucket are accounted in an
+ * overflow bucket whose percentiles are clamped to the longest frame seen.
+ */
+class FrameTimeHistogram {
+public:
+    static constexpr std::chrono::microseconds BucketWidth{100};
+    /// Number of regular buckets, they cover frames up to 100 ms
+    static constexpr std::size_t NumBuckets = 1000;
+
+    /// Records the duration of a frame
+    void Add(std::chrono::nanoseconds frame_time);
+
+    /// Removes every recorded frame. Frames added while resetting may or may not be kept.
+    void Reset();
+
+    /// Returns the number of frames recorded
+    [[nodiscard]] u64 Count() const;
+
+    /// Returns the longest frame recorded
+    [[nodiscard]] std::chrono::nanoseconds Max() const;
+
+    /**
+     * Returns the shortest frame time that the given percentage of the frames do not exceed, in
+     * the resolution of the buckets. The 99th percentile is the "1% low" frame time.
+     *
+     * @param percentile Percentage in the range [0, 100]
+     * @returns Upper edge of the bucket holding the percentile, zero when there are no frames
+     */
+    [[nodiscard]] std::chrono::nanoseconds Percentile(double percentile) const;
+
+    /// Returns the frames recorded in a bucket, the overflow bucket is at index NumBuckets
+    [[nodiscard]] u64 BucketCount(std::size_t index) const;
+
+private:
+    std::array<std::atomic<u64>, NumBuckets + 1> buckets{};
+    std::atomic<u64> count{};
+    std::atomic<s64> max_ns{};
+};
+
+} // namespace Core
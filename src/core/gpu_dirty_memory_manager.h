@@ -5,21 +5,30 @@
 
 #include <atomic>
 #include <bit>
-#include <functional>
 #include <mutex>
-#include <utility>
+#include <new>
+#include <span>
 #include <vector>
 
+#include "common/ring_buffer.h"
 #include "core/device_memory_manager.h"
 
 namespace Core {
 
+struct GPUDirtyRange {
+    PAddr address;
+    size_t size;
+};
+
+/// Accumulates CPU writes to GPU tracked memory for a single core.
+/// Collect is called only by the owning core (or under the sys core guard) and Gather only by the
+/// GPU thread, so ranges are published through a single producer single consumer ring.
 class GPUDirtyMemoryManager {
 public:
-    GPUDirtyMemoryManager() : current{default_transform} {
-        back_buffer.reserve(256);
-        front_buffer.reserve(256);
-    }
+    /// Maximum number of ranges a single tracked transform can expand to.
+    static constexpr size_t MAX_RANGES_PER_TRANSFORM = 16;
+
+    GPUDirtyMemoryManager() : current{default_transform} {}
 
     ~GPUDirtyMemoryManager() = default;
 
@@ -31,9 +40,12 @@ public:
             original = tmp;
             if (tmp.address != t.address) {
                 if (IsValid(tmp.address)) {
-                    std::scoped_lock lk(guard);
-                    back_buffer.emplace_back(tmp);
-                    current.exchange(t, std::memory_order_relaxed);
+                    // Only Gather replaces the current transform behind our back, so whatever
+                    // we swap out here is ours to publish.
+                    const TransformAddress old = current.exchange(t, std::memory_order_acq_rel);
+                    if (IsValid(old.address)) {
+                        Publish(old);
+                    }
                     return;
                 }
                 tmp.address = t.address;
@@ -47,31 +59,32 @@ public:
                                                 std::memory_order_relaxed));
     }
 
-    void Gather(std::function<void(PAddr, size_t)>& callback) {
-        {
-            std::scoped_lock lk(guard);
-            TransformAddress t = current.exchange(default_transform, std::memory_order_relaxed);
-            front_buffer.swap(back_buffer);
-            if (IsValid(t.address)) {
-                front_buffer.emplace_back(t);
+    /// Drains published ranges into out.
+    /// @returns Number of ranges written, zero once the manager is empty
+    size_t Gather(std::span<GPUDirtyRange> out) {
+        size_t count = 0;
+        if (overflow_pending.load(std::memory_order_acquire)) [[unlikely]] {
+            std::scoped_lock lk(overflow_guard);
+            while (!overflow.empty() && out.size() - count >= MAX_RANGES_PER_TRANSFORM) {
+                count = Expand(overflow.back(), out, count);
+                overflow.pop_back();
             }
+            if (!overflow.empty()) {
+                return count;
+            }
+            overflow_pending.store(false, std::memory_order_release);
         }
-        for (auto& transform : front_buffer) {
-            size_t offset = 0;
-            u64 mask = transform.mask;
-            while (mask != 0) {
-                const size_t empty_bits = std::countr_zero(mask);
-                offset += empty_bits << align_bits;
-                mask = mask >> empty_bits;
-
-                const size_t continuous_bits = std::countr_one(mask);
-                callback((static_cast<PAddr>(transform.address) << page_bits) + offset,
-                         continuous_bits << align_bits);
-                mask = continuous_bits < align_size ? (mask >> continuous_bits) : 0;
-                offset += continuous_bits << align_bits;
+        while (out.size() - count >= MAX_RANGES_PER_TRANSFORM) {
+            TransformAddress transform;
+            if (transforms.Pop(&transform, 1) == 0) {
+                transform = current.exchange(default_transform, std::memory_order_acq_rel);
+                if (!IsValid(transform.address)) {
+                    break;
+                }
             }
+            count = Expand(transform, out, count);
         }
-        front_buffer.clear();
+        return count;
     }
 
 private:
@@ -89,8 +102,10 @@ private:
     constexpr static size_t align_mask = align_size - 1;
     constexpr static TransformAddress default_transform = {.address = ~0U, .mask = 0U};
 
-    bool IsValid(PAddr address) {
-        return address < (1ULL << 39);
+    constexpr static size_t transforms_capacity = 512;
+
+    bool IsValid(u32 address) {
+        return address != default_transform.address;
     }
 
     template <typename T>
@@ -113,10 +128,46 @@ private:
         return result;
     }
 
-    std::atomic<TransformAddress> current{};
-    std::mutex guard;
-    std::vector<TransformAddress> back_buffer;
-    std::vector<TransformAddress> front_buffer;
+    void Publish(const TransformAddress& transform) {
+        if (transforms.Push(&transform, 1) != 0) [[likely]] {
+            return;
+        }
+        // The GPU thread is falling behind, spill instead of blocking the core.
+        std::scoped_lock lk(overflow_guard);
+        overflow.push_back(transform);
+        overflow_pending.store(true, std::memory_order_release);
+    }
+
+    size_t Expand(const TransformAddress& transform, std::span<GPUDirtyRange> out,
+                  size_t count) {
+        size_t offset = 0;
+        u64 mask = transform.mask;
+        while (mask != 0) {
+            const size_t empty_bits = std::countr_zero(mask);
+            offset += empty_bits << align_bits;
+            mask = mask >> empty_bits;
+
+            const size_t continuous_bits = std::countr_one(mask);
+            out[count++] = GPUDirtyRange{
+                .address = (static_cast<PAddr>(transform.address) << page_bits) + offset,
+                .size = continuous_bits << align_bits,
+            };
+            mask = continuous_bits < align_size ? (mask >> continuous_bits) : 0;
+            offset += continuous_bits << align_bits;
+        }
+        return count;
+    }
+
+    // Keep the hot transform away from the ring indices and the neighbouring cores' managers.
+#ifdef __cpp_lib_hardware_interference_size
+    alignas(std::hardware_destructive_interference_size) std::atomic<TransformAddress> current{};
+#else
+    alignas(128) std::atomic<TransformAddress> current{};
+#endif
+    Common::RingBuffer<TransformAddress, transforms_capacity> transforms;
+    std::atomic<bool> overflow_pending{};
+    std::mutex overflow_guard;
+    std::vector<TransformAddress> overflow;
 };
 
 } // namespace Core
@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <span>
+#include <utility>
 #include <vector>
 
 #include "common/assert.h"
@@ -31,7 +32,10 @@ enum GuestMemoryFlags : u32 {
     UnsafeReadCachedWrite = UnsafeReadWrite | Cached,
 };
 
-namespace {
+/**
+ * Span of guest memory, pointing straight into host memory when the range is contiguous there
+ * and into a copy otherwise.
+ */
 template <typename M, typename T, GuestMemoryFlags FLAGS>
 class GuestMemory {
     using iterator = T*;
@@ -53,6 +57,12 @@ public:
 
     ~GuestMemory() = default;
 
+    GuestMemory(const GuestMemory&) = delete;
+    GuestMemory& operator=(const GuestMemory&) = delete;
+
+    // Moving the copy keeps its storage, so the span stays valid
+    GuestMemory(GuestMemory&&) noexcept = default;
+
     T* data() noexcept {
         return m_data_span.data();
     }
@@ -150,11 +160,11 @@ public:
         return false;
     }
 
-protected:
     bool IsDataCopy() const noexcept {
         return m_is_data_copy;
     }
 
+protected:
     bool AddressChanged() const noexcept {
         return m_addr_changed;
     }
@@ -169,6 +179,10 @@ protected:
     bool m_addr_changed{false};
 };
 
+/**
+ * GuestMemory committing writes when it goes out of scope. Copies are written back, while writes
+ * made in place only invalidate the range from the caches.
+ */
 template <typename M, typename T, GuestMemoryFlags FLAGS>
 class GuestMemoryScoped : public GuestMemory<M, T, FLAGS> {
 public:
@@ -178,15 +192,18 @@ public:
         : GuestMemory<M, T, FLAGS>(memory, addr, size, backup) {
         if constexpr (!(FLAGS & GuestMemoryFlags::Read)) {
             if (!this->TrySetSpan()) {
-                if (backup) {
-                    this->m_data_span = *backup;
-                    this->m_span_valid = true;
-                    this->m_is_data_copy = true;
-                }
+                // Copy the current contents, bytes left untouched must survive the write back
+                this->Read(addr, size, backup);
             }
         }
     }
 
+    GuestMemoryScoped(GuestMemoryScoped&& other) noexcept
+        : GuestMemory<M, T, FLAGS>(std::move(other)) {
+        // Only this object commits the writes now
+        other.m_size = 0;
+    }
+
     ~GuestMemoryScoped() {
         if constexpr (FLAGS & GuestMemoryFlags::Write) {
             if (this->size() == 0) [[unlikely]] {
@@ -209,6 +226,5 @@ public:
         }
     }
 };
-} // namespace
 
 } // namespace Core::Memory
@@ -266,6 +266,13 @@ public:
         KScopedAutoObject(o).Swap(*this);
     }
 
+    /// Takes over a reference the caller already opened
+    static KScopedAutoObject Adopt(T* o) {
+        KScopedAutoObject ret;
+        ret.m_obj = o;
+        return ret;
+    }
+
     constexpr T* GetPointerUnsafe() {
         return m_obj;
     }
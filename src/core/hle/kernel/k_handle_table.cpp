@@ -14,6 +14,13 @@ Result KHandleTable::Finalize() {
         KScopedSpinLock lk(m_lock);
 
         std::swap(m_table_size, saved_table_size);
+
+        // Stop lock-free readers from opening the objects being closed.
+        for (s32 i = 0; i < static_cast<s32>(saved_table_size); i++) {
+            if (KAutoObject* obj = m_objects[i]; obj != nullptr) {
+                this->PublishEntry(i, obj, 0);
+            }
+        }
     }
 
     // Close and free all entries.
@@ -73,9 +80,9 @@ Result KHandleTable::Add(Handle* out_handle, KAutoObject* obj) {
         const auto index = this->AllocateEntry();
 
         m_entry_infos[index].linear_id = linear_id;
-        m_objects[index] = obj;
 
         obj->Open();
+        this->PublishEntry(index, obj, linear_id);
 
         *out_handle = EncodeHandle(static_cast<u16>(index), linear_id);
     }
@@ -146,9 +153,9 @@ void KHandleTable::Register(Handle handle, KAutoObject* obj) {
         ASSERT(m_objects[index] == nullptr);
 
         m_entry_infos[index].linear_id = static_cast<u16>(linear_id);
-        m_objects[index] = obj;
 
         obj->Open();
+        this->PublishEntry(index, obj, static_cast<u16>(linear_id));
     }
 }
 
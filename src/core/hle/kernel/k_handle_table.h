@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 
 #include "common/assert.h"
 #include "common/bit_field.h"
@@ -47,7 +48,7 @@ public:
 
         // Free all entries.
         for (s32 i = 0; i < static_cast<s32>(m_table_size); ++i) {
-            m_objects[i] = nullptr;
+            this->PublishEntry(i, nullptr, 0);
             m_entry_infos[i].next_free_index = static_cast<s16>(i - 1);
             m_free_head_index = i;
         }
@@ -70,6 +71,19 @@ public:
 
     template <typename T = KAutoObject>
     KScopedAutoObject<T> GetObjectWithoutPseudoHandle(Handle handle) const {
+        // Try to look up without the lock first.
+        if (KAutoObject* obj = this->TryOpenObjectLockFree(handle); obj != nullptr) [[likely]] {
+            if constexpr (std::is_same_v<T, KAutoObject>) {
+                return KScopedAutoObject<T>::Adopt(obj);
+            } else {
+                T* const derived = obj->DynamicCast<T*>();
+                if (derived == nullptr) [[unlikely]] {
+                    obj->Close();
+                }
+                return KScopedAutoObject<T>::Adopt(derived);
+            }
+        }
+
         // Lock and look up in table.
         KScopedDisableDispatch dd{m_kernel};
         KScopedSpinLock lk(m_lock);
@@ -106,6 +120,11 @@ public:
     }
 
     KScopedAutoObject<KAutoObject> GetObjectForIpcWithoutPseudoHandle(Handle handle) const {
+        // Try to look up without the lock first.
+        if (KAutoObject* obj = this->TryOpenObjectLockFree(handle); obj != nullptr) [[likely]] {
+            return KScopedAutoObject<KAutoObject>::Adopt(obj);
+        }
+
         // Lock and look up in table.
         KScopedDisableDispatch dd{m_kernel};
         KScopedSpinLock lk(m_lock);
@@ -130,8 +149,28 @@ public:
 
     template <typename T>
     bool GetMultipleObjects(T** out, const Handle* handles, size_t num_handles) const {
-        // Try to convert and open all the handles.
+        // Try to convert and open all the handles without the lock first.
         size_t num_opened;
+        for (num_opened = 0; num_opened < num_handles; num_opened++) {
+            KAutoObject* cur_object = this->TryOpenObjectLockFree(handles[num_opened]);
+            if (cur_object == nullptr) [[unlikely]] {
+                break;
+            }
+            T* cur_t = cur_object->DynamicCast<T*>();
+            if (cur_t == nullptr) [[unlikely]] {
+                cur_object->Close();
+                break;
+            }
+            out[num_opened] = cur_t;
+        }
+        if (num_opened == num_handles) [[likely]] {
+            return true;
+        }
+        for (size_t i = 0; i < num_opened; i++) {
+            out[i]->Close();
+        }
+
+        // Retry under the lock.
         {
             // Lock the table.
             KScopedDisableDispatch dd{m_kernel};
@@ -187,7 +226,7 @@ private:
     void FreeEntry(s32 index) {
         ASSERT(m_count > 0);
 
-        m_objects[index] = nullptr;
+        this->PublishEntry(index, nullptr, 0);
         m_entry_infos[index].next_free_index = static_cast<s16>(m_free_head_index);
 
         m_free_head_index = index;
@@ -234,6 +273,49 @@ private:
         return true;
     }
 
+    /// Sets the object of an entry, seen by lock-free readers. Must be called with the lock held.
+    void PublishEntry(s32 index, KAutoObject* obj, u16 linear_id) {
+        // Readers see no linear id while the entry is being written.
+        const u32 sequence = (m_entry_tags[index].load(std::memory_order_relaxed) >> 16) + 1;
+        m_entry_tags[index].store(sequence << 16, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        m_objects[index].store(obj, std::memory_order_relaxed);
+        m_entry_tags[index].store(((sequence + 1) << 16) | linear_id, std::memory_order_release);
+    }
+
+    /**
+     * Opens the object of a handle without taking the lock.
+     * Kernel objects are slab allocated and their memory outlives them, so a stale pointer read
+     * here is safe to open. Open fails for destroyed objects, and the tag check afterwards
+     * catches entries that changed, including objects reused for another entry.
+     * @returns The opened object, or nullptr to fall back to the locked path
+     */
+    KAutoObject* TryOpenObjectLockFree(Handle handle) const {
+        const auto handle_pack = HandlePack(handle);
+        const u32 index = handle_pack.index;
+        const u32 linear_id = handle_pack.linear_id;
+        if (handle_pack.reserved != 0 || linear_id == 0 || index >= MaxTableSize) [[unlikely]] {
+            return nullptr;
+        }
+
+        const u32 tag = m_entry_tags[index].load(std::memory_order_acquire);
+        if ((tag & 0xFFFF) != linear_id) [[unlikely]] {
+            return nullptr;
+        }
+        KAutoObject* const obj = m_objects[index].load(std::memory_order_relaxed);
+        if (obj == nullptr || !obj->Open()) [[unlikely]] {
+            return nullptr;
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_entry_tags[index].load(std::memory_order_relaxed) != tag) [[unlikely]] {
+            obj->Close();
+            return nullptr;
+        }
+        return obj;
+    }
+
     KAutoObject* GetObjectImpl(Handle handle) const {
         // Handles must not have reserved bits set.
         const auto handle_pack = HandlePack(handle);
@@ -301,7 +383,9 @@ private:
 private:
     KernelCore& m_kernel;
     std::array<EntryInfo, MaxTableSize> m_entry_infos{};
-    std::array<KAutoObject*, MaxTableSize> m_objects{};
+    std::array<std::atomic<KAutoObject*>, MaxTableSize> m_objects{};
+    /// Per entry sequence in the upper half and linear id in the lower half, for lock-free reads
+    std::array<std::atomic<u32>, MaxTableSize> m_entry_tags{};
     mutable KSpinLock m_lock;
     s32 m_free_head_index{};
     u16 m_table_size{};
@@ -266,27 +266,32 @@ Result KMemoryManager::AllocatePageGroupImpl(KPageGroup* out, size_t num_pages,
         for (Impl* cur_manager = this->GetFirstManager(pool, dir); cur_manager != nullptr;
              cur_manager = this->GetNextManager(cur_manager, dir)) {
             while (num_pages >= pages_per_alloc) {
-                // Allocate a block.
-                KPhysicalAddress allocated_block = cur_manager->AllocateBlock(index, random);
+                // Allocate a block, or as many contiguous blocks as we can when not randomizing.
+                size_t num_blocks = 1;
+                KPhysicalAddress allocated_block =
+                    random ? cur_manager->AllocateBlock(index, true)
+                           : cur_manager->AllocateBlocks(index, num_pages / pages_per_alloc,
+                                                         std::addressof(num_blocks));
                 if (allocated_block == 0) {
                     break;
                 }
+                const size_t allocated_pages = num_blocks * pages_per_alloc;
 
-                // Ensure we don't leak the block if we fail.
+                // Ensure we don't leak the blocks if we fail.
                 ON_RESULT_FAILURE_2 {
-                    cur_manager->Free(allocated_block, pages_per_alloc);
+                    cur_manager->Free(allocated_block, allocated_pages);
                 };
 
-                // Add the block to our group.
-                R_TRY(out->AddBlock(allocated_block, pages_per_alloc));
+                // Add the blocks to our group.
+                R_TRY(out->AddBlock(allocated_block, allocated_pages));
 
                 // Maintain the optimized memory bitmap, if we should.
                 if (unoptimized) {
                     cur_manager->TrackUnoptimizedAllocation(m_system.Kernel(), allocated_block,
-                                                            pages_per_alloc);
+                                                            allocated_pages);
                 }
 
-                num_pages -= pages_per_alloc;
+                num_pages -= allocated_pages;
             }
         }
     }
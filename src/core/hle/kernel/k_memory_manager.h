@@ -205,6 +205,9 @@ private:
         KPhysicalAddress AllocateBlock(s32 index, bool random) {
             return m_heap.AllocateBlock(index, random);
         }
+        KPhysicalAddress AllocateBlocks(s32 index, size_t max_blocks, size_t* out_num_blocks) {
+            return m_heap.AllocateBlocks(index, max_blocks, out_num_blocks);
+        }
         KPhysicalAddress AllocateAligned(s32 index, size_t num_pages, size_t align_pages) {
             return m_heap.AllocateAligned(index, num_pages, align_pages);
         }
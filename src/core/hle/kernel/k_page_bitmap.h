@@ -174,6 +174,22 @@ public:
         return static_cast<s64>(offset);
     }
 
+    /// Finds the lowest free block, like a linear FindFreeBlock, along with the number of free
+    /// blocks following it in the same word, up to max_count of them
+    s64 FindFreeRun(size_t max_count, size_t* out_count) {
+        const s64 soffset = this->FindFreeBlock(false);
+        if (soffset < 0) {
+            return -1;
+        }
+        const size_t offset = static_cast<size_t>(soffset);
+
+        // The run ends at the first clear bit, the bits past the top of the word read as clear.
+        const u64 v = m_bit_storages[this->GetHighestDepthIndex()][offset / Common::BitSize<u64>()];
+        const size_t run = std::countr_one(v >> (offset % Common::BitSize<u64>()));
+        *out_count = std::min(run, max_count);
+        return soffset;
+    }
+
     s64 FindFreeRange(size_t count) {
         // Check that it is possible to find a range.
         const u64* const storage_start = m_bit_storages[m_used_depths - 1];
@@ -59,6 +59,19 @@ KPhysicalAddress KPageHeap::AllocateByLinearSearch(s32 index) {
     return 0;
 }
 
+KPhysicalAddress KPageHeap::AllocateBlocks(s32 index, size_t max_blocks, size_t* out_num_blocks) {
+    // Take the free blocks of this size in one go, they are the ones popping them one at a time
+    // would have returned.
+    if (const KPhysicalAddress addr = m_blocks[index].PopBlocks(max_blocks, out_num_blocks);
+        addr != 0) {
+        return addr;
+    }
+
+    // Otherwise split a larger block.
+    *out_num_blocks = 1;
+    return this->AllocateByLinearSearch(index);
+}
+
 KPhysicalAddress KPageHeap::AllocateByRandom(s32 index, size_t num_pages, size_t align_pages) {
     // Get the size and required alignment.
     const size_t needed_size = num_pages * PageSize;
@@ -62,6 +62,10 @@ public:
         }
     }
 
+    /// Allocates a run of up to max_blocks contiguous blocks by linear search, returning the
+    /// number of blocks in the run in out_num_blocks
+    KPhysicalAddress AllocateBlocks(s32 index, size_t max_blocks, size_t* out_num_blocks);
+
     KPhysicalAddress AllocateAligned(s32 index, size_t num_pages, size_t align_pages) {
         // TODO: linear search support?
         return this->AllocateByRandom(index, num_pages, align_pages);
@@ -175,6 +179,20 @@ private:
             return m_heap_address + (offset << this->GetShift());
         }
 
+        KPhysicalAddress PopBlocks(size_t max_count, size_t* out_count) {
+            // Find a run of free blocks.
+            s64 soffset = m_bitmap.FindFreeRun(max_count, out_count);
+            if (soffset < 0) {
+                return {};
+            }
+            const size_t offset = static_cast<size_t>(soffset);
+
+            // Update our tracking and return it.
+            const bool cleared = m_bitmap.ClearRange(offset, *out_count);
+            ASSERT(cleared);
+            return m_heap_address + (offset << this->GetShift());
+        }
+
     public:
         static constexpr size_t CalculateManagementOverheadSize(size_t region_size,
                                                                 size_t cur_block_shift,
@@ -16,6 +16,7 @@
 #include "core/hle/kernel/k_scheduler.h"
 #include "core/hle/kernel/k_scoped_scheduler_lock_and_sleep.h"
 #include "core/hle/kernel/k_thread.h"
+#include "core/hle/kernel/k_trace_recorder.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/physical_core.h"
 
@@ -116,7 +117,7 @@ void KScheduler::PreemptSingleCore() {
     auto& previous_scheduler = m_kernel.Scheduler(thread->GetCurrentCore());
     previous_scheduler.Unload(thread);
 
-    Common::Fiber::YieldTo(thread->GetHostContext(), *m_switch_fiber);
+    Common::Fiber::YieldTo(*thread->GetHostContext(), *m_switch_fiber);
 
     GetCurrentThread(m_kernel).EnableDispatch();
 }
@@ -375,6 +376,11 @@ void KScheduler::SwitchThread(KThread* next_thread) {
     //     KProcess::Switch(cur_process, next_process);
     // }
 
+    if (KTraceRecorder* const trace = m_kernel.GetTraceRecorder(); trace) [[unlikely]] {
+        trace->Record(static_cast<u32>(m_core_id), KTraceEventType::ThreadSwitch,
+                      next_thread->GetThreadId(), cur_thread->GetThreadId());
+    }
+
     // Set the new thread.
     SetCurrentThread(m_kernel, next_thread);
     m_current_thread = next_thread;
@@ -412,7 +418,7 @@ void KScheduler::ScheduleImpl() {
     m_switch_cur_thread = cur_thread;
     m_switch_highest_priority_thread = highest_priority_thread;
     m_switch_from_schedule = true;
-    Common::Fiber::YieldTo(cur_thread->m_host_context, *m_switch_fiber);
+    Common::Fiber::YieldTo(*cur_thread->m_host_context, *m_switch_fiber);
 
     // Returning from ScheduleImpl occurs after this thread has been scheduled again.
 }
@@ -490,7 +496,7 @@ void KScheduler::ScheduleImplFiber() {
     Reload(highest_priority_thread);
 
     // Reload the host thread.
-    Common::Fiber::YieldTo(m_switch_fiber, *highest_priority_thread->m_host_context);
+    Common::Fiber::YieldTo(*m_switch_fiber, *highest_priority_thread->m_host_context);
 }
 
 void KScheduler::Unload(KThread* thread) {
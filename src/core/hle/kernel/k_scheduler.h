@@ -63,6 +63,11 @@ public:
         return m_current_thread.load() == m_idle_thread;
     }
 
+    /// Returns true when the core is running a thread or has one about to be scheduled
+    bool HasWork() const {
+        return !this->IsIdle() || m_state.needs_scheduling.load();
+    }
+
     KThread* GetPreviousThread() const {
         return m_state.prev_thread;
     }
@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include "common/assert.h"
+#include "common/settings.h"
 #include "core/hle/kernel/k_interrupt_manager.h"
+#include "core/hle/kernel/k_scheduler_lock_stats.h"
 #include "core/hle/kernel/k_spin_lock.h"
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/kernel.h"
@@ -19,7 +23,9 @@ class GlobalSchedulerContext;
 template <typename SchedulerType>
 class KAbstractSchedulerLock {
 public:
-    explicit KAbstractSchedulerLock(KernelCore& kernel) : m_kernel{kernel} {}
+    explicit KAbstractSchedulerLock(KernelCore& kernel)
+        : m_kernel{kernel},
+          m_record_stats{Settings::values.record_scheduler_lock_stats.GetValue()} {}
 
     bool IsLockedByCurrentThread() const {
         return m_owner_thread == GetCurrentThreadPointer(m_kernel);
@@ -33,7 +39,11 @@ public:
         } else {
             // Otherwise, we want to disable scheduling and acquire the spinlock.
             SchedulerType::DisableScheduling(m_kernel);
-            m_spin_lock.Lock();
+            if (m_record_stats) {
+                this->LockAndRecord();
+            } else {
+                m_spin_lock.Lock();
+            }
 
             ASSERT(m_lock_count == 0);
             ASSERT(m_owner_thread == nullptr);
@@ -59,6 +69,10 @@ public:
             const u64 cores_needing_scheduling =
                 SchedulerType::UpdateHighestPriorityThreads(m_kernel);
 
+            if (m_record_stats) {
+                this->RecordHold();
+            }
+
             // Note that we no longer hold the lock, and unlock the spinlock.
             m_owner_thread = nullptr;
             m_spin_lock.Unlock();
@@ -68,13 +82,65 @@ public:
         }
     }
 
+    /// Returns the lock statistics since the last call, empty unless they are being recorded
+    KSchedulerLockStats GetAndResetStats() {
+        return {
+            .acquisitions = m_stats.acquisitions.exchange(0, std::memory_order_relaxed),
+            .contended_acquisitions =
+                m_stats.contended_acquisitions.exchange(0, std::memory_order_relaxed),
+            .wait_ns = m_stats.wait_ns.exchange(0, std::memory_order_relaxed),
+            .hold_ns = m_stats.hold_ns.exchange(0, std::memory_order_relaxed),
+            .max_hold_ns = m_stats.max_hold_ns.exchange(0, std::memory_order_relaxed),
+        };
+    }
+
 private:
     friend class GlobalSchedulerContext;
 
+    using Clock = std::chrono::steady_clock;
+
+    void LockAndRecord() {
+        if (!m_spin_lock.TryLock()) {
+            const Clock::time_point wait_start{Clock::now()};
+            m_spin_lock.Lock();
+            m_hold_start = Clock::now();
+            m_stats.contended_acquisitions.fetch_add(1, std::memory_order_relaxed);
+            m_stats.wait_ns.fetch_add(ToNanoseconds(m_hold_start - wait_start),
+                                      std::memory_order_relaxed);
+        } else {
+            m_hold_start = Clock::now();
+        }
+        m_stats.acquisitions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void RecordHold() {
+        const u64 hold_ns{ToNanoseconds(Clock::now() - m_hold_start)};
+        m_stats.hold_ns.fetch_add(hold_ns, std::memory_order_relaxed);
+        // Only the owner writes the maximum, a concurrent reset can at most lose this sample
+        const u64 max_hold_ns{m_stats.max_hold_ns.load(std::memory_order_relaxed)};
+        m_stats.max_hold_ns.store(std::max(max_hold_ns, hold_ns), std::memory_order_relaxed);
+    }
+
+    static u64 ToNanoseconds(Clock::duration duration) {
+        return static_cast<u64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
     KernelCore& m_kernel;
     KAlignedSpinLock m_spin_lock{};
     s32 m_lock_count{};
     std::atomic<KThread*> m_owner_thread{};
+
+    // Statistics are written while holding the lock and read from the frontend without it
+    const bool m_record_stats;
+    Clock::time_point m_hold_start{};
+    struct {
+        std::atomic<u64> acquisitions{};
+        std::atomic<u64> contended_acquisitions{};
+        std::atomic<u64> wait_ns{};
+        std::atomic<u64> hold_ns{};
+        std::atomic<u64> max_hold_ns{};
+    } m_stats;
 };
 
 } // namespace Kernel
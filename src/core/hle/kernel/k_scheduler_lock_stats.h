@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace Kernel {
+
+/// Host time spent on the global scheduler lock, summed since the last reset
+struct KSchedulerLockStats {
+    u64 acquisitions{};           ///< Times the lock was taken, not counting recursive locks
+    u64 contended_acquisitions{}; ///< Acquisitions that had to wait for another core
+    u64 wait_ns{};                ///< Host time spent waiting to take the lock
+    u64 hold_ns{};                ///< Host time the lock was held for
+    u64 max_hold_ns{};            ///< Longest time the lock was held for at once
+};
+
+} // namespace Kernel
@@ -20,6 +20,7 @@
 #include "core/hle/kernel/k_session.h"
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/k_thread_queue.h"
+#include "core/hle/kernel/k_trace_recorder.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/message_buffer.h"
 #include "core/hle/service/hle_ipc.h"
@@ -1239,6 +1240,11 @@ Result KServerSession::SendReply(uintptr_t server_message, uintptr_t server_buff
         }
     }
 
+    if (KTraceRecorder* const trace = m_kernel.GetTraceRecorder(); trace) [[unlikely]] {
+        trace->Record(m_kernel.GetCurrentHostThreadID(), KTraceEventType::IpcReply,
+                      GetCurrentThread(m_kernel).GetThreadId(), reinterpret_cast<uintptr_t>(this));
+    }
+
     // Close reference to the request once we're done processing it.
     SCOPE_EXIT {
         request->Close();
@@ -1338,6 +1344,12 @@ Result KServerSession::OnRequest(KSessionRequest* request) {
         // Check that we're not terminating.
         R_UNLESS(!GetCurrentThread(m_kernel).IsTerminationRequested(), ResultTerminationRequested);
 
+        if (KTraceRecorder* const trace = m_kernel.GetTraceRecorder(); trace) [[unlikely]] {
+            trace->Record(m_kernel.GetCurrentHostThreadID(), KTraceEventType::IpcSend,
+                          GetCurrentThread(m_kernel).GetThreadId(),
+                          reinterpret_cast<uintptr_t>(this));
+        }
+
         // Get whether we're empty.
         const bool was_empty = m_request_list.empty();
 
@@ -3,13 +3,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <mutex>
+#include <utility>
 
 #include "common/assert.h"
 #include "common/atomic_ops.h"
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "common/spin_lock.h"
+#include "core/hardware_properties.h"
 
 namespace Kernel {
 
@@ -26,6 +31,12 @@ public:
         Node* next{};
     };
 
+    /// Number of per-core caches, host threads outside of the emulated cores share the last one
+    static constexpr size_t NumCaches = Core::Hardware::NUM_CPU_CORES;
+
+    /// Number of objects moved between a cache and the shared free list at once
+    static constexpr u32 CacheBatchSize = 16;
+
 public:
     constexpr KSlabHeapImpl() = default;
 
@@ -63,9 +74,117 @@ public:
         m_lock.unlock();
     }
 
+    void* Allocate(size_t core_id) {
+        Cache& cache = m_caches[std::min(core_id, NumCaches - 1)];
+        {
+            std::scoped_lock lk{cache.lock};
+            if (Node* ret = cache.head; ret != nullptr) [[likely]] {
+                cache.head = ret->next;
+                --cache.count;
+                return ret;
+            }
+        }
+
+        // Refill the cache with a batch of the shared list, other caches are only drained when
+        // the shared list is empty so the heap runs out at the same point it did without caches.
+        Node* batch = this->TakeBatch();
+        if (batch == nullptr) [[unlikely]] {
+            this->ReclaimCaches();
+            batch = this->TakeBatch();
+            if (batch == nullptr) {
+                return nullptr;
+            }
+        }
+
+        Node* const ret = batch;
+        batch = batch->next;
+        std::scoped_lock lk{cache.lock};
+        while (batch != nullptr) {
+            Node* const next = batch->next;
+            batch->next = cache.head;
+            cache.head = batch;
+            ++cache.count;
+            batch = next;
+        }
+        return ret;
+    }
+
+    void Free(void* obj, size_t core_id) {
+        Cache& cache = m_caches[std::min(core_id, NumCaches - 1)];
+        std::scoped_lock lk{cache.lock};
+
+        Node* node = static_cast<Node*>(obj);
+        node->next = cache.head;
+        cache.head = node;
+        if (++cache.count < CacheBatchSize * 2) [[likely]] {
+            return;
+        }
+
+        // Give half of the cache back, this keeps the objects of a core freeing more than it
+        // allocates available to the others.
+        Node* last = cache.head;
+        for (u32 i = 1; i < CacheBatchSize; ++i) {
+            last = last->next;
+        }
+        Node* const first = std::exchange(cache.head, last->next);
+        cache.count -= CacheBatchSize;
+
+        m_lock.lock();
+        last->next = m_head;
+        m_head = first;
+        m_lock.unlock();
+    }
+
+private:
+    struct alignas(64) Cache {
+        Common::SpinLock lock;
+        Node* head{};
+        u32 count{};
+    };
+
+    /// Takes up to CacheBatchSize objects from the shared list
+    Node* TakeBatch() {
+        m_lock.lock();
+
+        Node* const first = m_head;
+        if (first != nullptr) [[likely]] {
+            Node* last = first;
+            for (u32 i = 1; i < CacheBatchSize && last->next != nullptr; ++i) {
+                last = last->next;
+            }
+            m_head = last->next;
+            last->next = nullptr;
+        }
+
+        m_lock.unlock();
+        return first;
+    }
+
+    /// Moves the objects of every cache back to the shared list
+    void ReclaimCaches() {
+        for (Cache& cache : m_caches) {
+            std::scoped_lock lk{cache.lock};
+            if (cache.head == nullptr) {
+                continue;
+            }
+            Node* last = cache.head;
+            while (last->next != nullptr) {
+                last = last->next;
+            }
+
+            m_lock.lock();
+            last->next = m_head;
+            m_head = std::exchange(cache.head, nullptr);
+            m_lock.unlock();
+
+            cache.count = 0;
+        }
+    }
+
 private:
     std::atomic<Node*> m_head{};
     Common::SpinLock m_lock;
+    std::array<Cache, NumCaches> m_caches{};
 };
 
 } // namespace impl
@@ -146,6 +265,17 @@ public:
         KSlabHeapImpl::Free(obj);
     }
 
+    void* Allocate(size_t core_id) {
+        return KSlabHeapImpl::Allocate(core_id);
+    }
+
+    void Free(void* obj, size_t core_id) {
+        // Don't allow freeing an object that wasn't allocated from this heap.
+        const bool contained = this->Contains(reinterpret_cast<uintptr_t>(obj));
+        ASSERT(contained);
+        KSlabHeapImpl::Free(obj, core_id);
+    }
+
     size_t GetObjectIndex(const void* obj) const {
         if constexpr (SupportDynamicExpansion) {
             if (!this->Contains(reinterpret_cast<uintptr_t>(obj))) {
@@ -200,10 +330,25 @@ public:
         return obj;
     }
 
+    /// Same as Allocate, going through the cache of the given core
+    T* Allocate(KernelCore& kernel, size_t core_id) {
+        T* obj = static_cast<T*>(BaseHeap::Allocate(core_id));
+
+        if (obj != nullptr) [[likely]] {
+            std::construct_at(obj, kernel);
+        }
+        return obj;
+    }
+
     void Free(T* obj) {
         BaseHeap::Free(obj);
     }
 
+    /// Same as Free, going through the cache of the given core
+    void Free(T* obj, size_t core_id) {
+        BaseHeap::Free(obj, core_id);
+    }
+
     size_t GetObjectIndex(const T* obj) const {
         return BaseHeap::GetObjectIndex(obj);
     }
@@ -29,6 +29,7 @@
 #include "core/hle/kernel/k_system_control.h"
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/k_thread_queue.h"
+#include "core/hle/kernel/k_trace_recorder.h"
 #include "core/hle/kernel/k_worker_task_manager.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/svc.h"
@@ -1392,6 +1393,16 @@ void KThread::SetState(ThreadState state) {
     if (m_thread_state.load(std::memory_order_relaxed) != old_state) {
         KScheduler::OnThreadStateChanged(m_kernel, this, old_state);
     }
+
+    if (KTraceRecorder* const trace = m_kernel.GetTraceRecorder(); trace) [[unlikely]] {
+        const bool was_waiting = (old_state & ThreadState::Mask) == ThreadState::Waiting;
+        const bool is_waiting = (state & ThreadState::Mask) == ThreadState::Waiting;
+        if (was_waiting != is_waiting) {
+            trace->Record(m_kernel.GetCurrentHostThreadID(),
+                          is_waiting ? KTraceEventType::WaitBegin : KTraceEventType::WaitEnd,
+                          this->GetThreadId());
+        }
+    }
 }
 
 std::shared_ptr<Common::Fiber>& KThread::GetHostContext() {
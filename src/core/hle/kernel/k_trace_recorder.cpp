@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "core/hle/kernel/k_trace_recorder.h"
+#include "core/hle/kernel/svc.h"
+
+namespace Kernel {
+namespace {
+/// Process ids of the tracks in the exported trace
+constexpr u32 CoresPid = 0;
+constexpr u32 ThreadsPid = 1;
+
+/// Per thread state needed to only emit balanced begin and end events, the beginning of an
+/// interval may have been overwritten in the ring
+struct ThreadTrackState {
+    u32 svc_depth{};
+    bool is_waiting{};
+};
+
+double ToMicroseconds(s64 ns) {
+    return static_cast<double>(ns) / 1000.0;
+}
+} // Anonymous namespace
+
+KTraceRecorder::KTraceRecorder() : m_clock{Common::CreateOptimalClock()} {
+    for (Ring& ring : m_rings) {
+        ring.events = std::make_unique<KTraceEvent[]>(RingSize);
+    }
+}
+
+KTraceRecorder::~KTraceRecorder() = default;
+
+std::vector<KTraceEvent> KTraceRecorder::CollectEvents() const {
+    std::vector<KTraceEvent> events;
+    for (const Ring& ring : m_rings) {
+        const u64 end = ring.write_index.load(std::memory_order_acquire);
+        const u64 begin = end > RingSize ? end - RingSize : 0;
+        for (u64 index = begin; index < end; ++index) {
+            events.push_back(ring.events[index & (RingSize - 1)]);
+        }
+    }
+    std::ranges::stable_sort(events, {}, &KTraceEvent::time_ns);
+    return events;
+}
+
+std::string KTraceRecorder::ExportChromeTrace() const {
+    const std::vector<KTraceEvent> events = CollectEvents();
+    const s64 base_ns = events.empty() ? 0 : events.front().time_ns;
+    const s64 end_ns = events.empty() ? 0 : events.back().time_ns;
+
+    std::string json{R"({"displayTimeUnit":"ns","traceEvents":[)"};
+    auto out = std::back_inserter(json);
+    bool first = true;
+    const auto separator = [&] { return std::exchange(first, false) ? "\n" : ",\n"; };
+
+    constexpr std::array processes{std::pair{CoresPid, "Cores"}, std::pair{ThreadsPid, "Threads"}};
+    for (const auto& [pid, name] : processes) {
+        fmt::format_to(out,
+                       R"({}{{"name":"process_name","ph":"M","pid":{},"args":{{"name":"{}"}}}})",
+                       separator(), pid, name);
+    }
+    for (u32 core = 0; core < NumRings; ++core) {
+        const std::string name = core < Core::Hardware::NUM_CPU_CORES
+                                     ? fmt::format("Core {}", core)
+                                     : std::string{"Host threads"};
+        fmt::format_to(
+            out, R"({}{{"name":"thread_name","ph":"M","pid":{},"tid":{},"args":{{"name":"{}"}}}})",
+            separator(), CoresPid, core, name);
+    }
+
+    // Threads switched in on each core, emitted as a slice once the next switch is seen
+    std::array<const KTraceEvent*, NumRings> running{};
+    const auto emit_running = [&](u32 core, s64 until_ns) {
+        const KTraceEvent* const switch_in = std::exchange(running[core], nullptr);
+        if (switch_in == nullptr) {
+            return;
+        }
+        fmt::format_to(
+            out,
+            R"({}{{"name":"Thread {}","ph":"X","pid":{},"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+            separator(), switch_in->thread_id, CoresPid, core,
+            ToMicroseconds(switch_in->time_ns - base_ns),
+            ToMicroseconds(until_ns - switch_in->time_ns));
+    };
+
+    std::unordered_map<u64, ThreadTrackState> threads;
+    for (const KTraceEvent& event : events) {
+        const double ts = ToMicroseconds(event.time_ns - base_ns);
+        ThreadTrackState& thread = threads[event.thread_id];
+        switch (event.type) {
+        case KTraceEventType::ThreadSwitch:
+            emit_running(event.core_id, event.time_ns);
+            running[event.core_id] = &event;
+            break;
+        case KTraceEventType::SvcEnter:
+            ++thread.svc_depth;
+            fmt::format_to(out, R"({}{{"name":"{}","ph":"B","pid":{},"tid":{},"ts":{:.3f}}})",
+                           separator(), Svc::GetSvcName(static_cast<u32>(event.arg)),
+                           ThreadsPid, event.thread_id, ts);
+            break;
+        case KTraceEventType::SvcExit:
+            if (thread.svc_depth == 0) {
+                break;
+            }
+            --thread.svc_depth;
+            fmt::format_to(out, R"({}{{"ph":"E","pid":{},"tid":{},"ts":{:.3f}}})", separator(),
+                           ThreadsPid, event.thread_id, ts);
+            break;
+        case KTraceEventType::IpcSend:
+        case KTraceEventType::IpcReply:
+            fmt::format_to(out,
+                           R"({}{{"name":"{}","ph":"i","s":"t","pid":{},"tid":{},"ts":{:.3f},)"
+                           R"("args":{{"session":"{:#x}"}}}})",
+                           separator(),
+                           event.type == KTraceEventType::IpcSend ? "IPC send" : "IPC reply",
+                           ThreadsPid, event.thread_id, ts, event.arg);
+            break;
+        case KTraceEventType::WaitBegin:
+        case KTraceEventType::WaitEnd: {
+            const bool is_begin = event.type == KTraceEventType::WaitBegin;
+            if (thread.is_waiting == is_begin) {
+                break;
+            }
+            thread.is_waiting = is_begin;
+            fmt::format_to(out,
+                           R"({}{{"name":"Wait","cat":"wait","ph":"{}","id":{},"pid":{},"tid":{},)"
+                           R"("ts":{:.3f}}})",
+                           separator(), is_begin ? 'b' : 'e', event.thread_id, ThreadsPid,
+                           event.thread_id, ts);
+            break;
+        }
+        }
+    }
+    for (u32 core = 0; core < NumRings; ++core) {
+        emit_running(core, end_ns);
+    }
+
+    json += "\n]}\n";
+    return json;
+}
+
+bool KTraceRecorder::WriteChromeTrace(const std::filesystem::path& path) const {
+    if (!Common::FS::CreateParentDir(path)) {
+        return false;
+    }
+    const std::string json = ExportChromeTrace();
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::TextFile};
+    return file.WriteString(json) == json.size();
+}
+
+} // namespace Kernel
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/wall_clock.h"
+#include "core/hardware_properties.h"
+
+namespace Kernel {
+
+enum class KTraceEventType : u32 {
+    ThreadSwitch, ///< thread_id switched in, arg is the id of the thread switched out
+    SvcEnter,     ///< arg is the supervisor call number
+    SvcExit,      ///< arg is the supervisor call number
+    IpcSend,      ///< arg is the server session the request was sent to
+    IpcReply,     ///< arg is the server session replying
+    WaitBegin,
+    WaitEnd,
+};
+
+struct KTraceEvent {
+    s64 time_ns;
+    u64 thread_id;
+    u64 arg;
+    KTraceEventType type;
+    u32 core_id;
+};
+
+/**
+ * Records kernel events in a ring buffer per core, keeping the most recent ones.
+ * Recording is lock-free, a slot is claimed with a single atomic increment. Host threads outside
+ * of the emulated cores share an extra ring.
+ */
+class KTraceRecorder {
+public:
+    /// Number of events kept per ring, as a power of two
+    static constexpr size_t RingSize = size_t{1} << 17;
+
+    /// Rings of the emulated cores followed by the ring shared by host threads
+    static constexpr size_t NumRings = Core::Hardware::NUM_CPU_CORES + 1;
+
+    explicit KTraceRecorder();
+    ~KTraceRecorder();
+
+    /// Records an event in the ring of a core, host thread ids past the cores share the last one
+    void Record(u32 core_id, KTraceEventType type, u64 thread_id, u64 arg = 0) noexcept {
+        core_id = core_id < NumRings ? core_id : NumRings - 1;
+        Ring& ring = m_rings[core_id];
+        const u64 index = ring.write_index.fetch_add(1, std::memory_order_relaxed);
+        ring.events[index & (RingSize - 1)] = KTraceEvent{
+            .time_ns = m_clock->GetTimeNS().count(),
+            .thread_id = thread_id,
+            .arg = arg,
+            .type = type,
+            .core_id = core_id,
+        };
+    }
+
+    /// Returns the recorded events of every ring sorted by time, must not race with Record
+    [[nodiscard]] std::vector<KTraceEvent> CollectEvents() const;
+
+    /// Formats the recorded events as Chrome trace event JSON, which Perfetto opens as well
+    [[nodiscard]] std::string ExportChromeTrace() const;
+
+    /// Writes the Chrome trace JSON to a file
+    /// @returns True on success
+    bool WriteChromeTrace(const std::filesystem::path& path) const;
+
+private:
+    struct alignas(64) Ring {
+        std::atomic<u64> write_index{};
+        std::unique_ptr<KTraceEvent[]> events;
+    };
+
+    std::unique_ptr<Common::WallClock> m_clock;
+    std::array<Ring, NumRings> m_rings{};
+};
+
+} // namespace Kernel
@@ -11,9 +11,12 @@
 #include <utility>
 
 #include "common/assert.h"
+#include "common/fs/fs_util.h"
+#include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "common/thread_worker.h"
 #include "core/arm/arm_interface.h"
@@ -38,9 +41,11 @@
 #include "core/hle/kernel/k_shared_memory.h"
 #include "core/hle/kernel/k_system_resource.h"
 #include "core/hle/kernel/k_thread.h"
+#include "core/hle/kernel/k_trace_recorder.h"
 #include "core/hle/kernel/k_worker_task_manager.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/physical_core.h"
+#include "core/hle/kernel/svc_statistics.h"
 #include "core/hle/result.h"
 #include "core/hle/service/server_manager.h"
 #include "core/hle/service/sm/sm.h"
@@ -95,6 +100,13 @@ struct KernelCore::Impl {
 
         InitializeHackSharedMemory(kernel);
         RegisterHostThread(nullptr);
+
+        if (Settings::values.record_svc_stats.GetValue()) {
+            svc_statistics = std::make_unique<Svc::SvcStatistics>();
+        }
+        if (Settings::values.record_kernel_trace.GetValue()) {
+            trace_recorder = std::make_unique<KTraceRecorder>();
+        }
     }
 
     void TerminateAllProcesses() {
@@ -115,6 +127,21 @@ struct KernelCore::Impl {
 
         CloseServices();
 
+        if (svc_statistics) {
+            svc_statistics->Log();
+            svc_statistics.reset();
+        }
+        if (trace_recorder) {
+            const auto path =
+                Common::FS::GetYuzuPath(Common::FS::YuzuPath::LogDir) / "kernel_trace.json";
+            if (trace_recorder->WriteChromeTrace(path)) {
+                LOG_INFO(Kernel, "Kernel trace written to {}", Common::FS::PathToUTF8String(path));
+            } else {
+                LOG_ERROR(Kernel, "Failed to write the kernel trace");
+            }
+            trace_recorder.reset();
+        }
+
         if (application_process) {
             application_process->Close();
             application_process = nullptr;
@@ -841,6 +868,8 @@ struct KernelCore::Impl {
     u32 single_core_thread_id{};
 
     std::array<u64, Core::Hardware::NUM_CPU_CORES> svc_ticks{};
+    std::unique_ptr<Svc::SvcStatistics> svc_statistics;
+    std::unique_ptr<KTraceRecorder> trace_recorder;
 
     KWorkerTaskManager worker_task_manager;
 
@@ -1286,6 +1315,14 @@ void KernelCore::ExitSVCProfile() {
     MicroProfileLeave(MICROPROFILE_TOKEN(Kernel_SVC), impl->svc_ticks[CurrentPhysicalCoreIndex()]);
 }
 
+Svc::SvcStatistics* KernelCore::GetSvcStatistics() {
+    return impl->svc_statistics.get();
+}
+
+KTraceRecorder* KernelCore::GetTraceRecorder() {
+    return impl->trace_recorder.get();
+}
+
 Init::KSlabResourceCounts& KernelCore::SlabResourceCounts() {
     return impl->slab_resource_counts;
 }
@@ -68,6 +68,7 @@ class KSharedMemoryInfo;
 class KSecureSystemResource;
 class KThread;
 class KThreadLocalPage;
+class KTraceRecorder;
 class KTransferMemory;
 class KWorkerTaskManager;
 class KCodeMemory;
@@ -77,6 +78,10 @@ namespace Init {
 struct KSlabResourceCounts;
 }
 
+namespace Svc {
+class SvcStatistics;
+}
+
 template <typename T>
 class KSlabHeap;
 
@@ -275,6 +280,12 @@ public:
 
     void ExitSVCProfile();
 
+    /// Gets the supervisor call statistics, or nullptr when they are not being recorded
+    Svc::SvcStatistics* GetSvcStatistics();
+
+    /// Gets the kernel event trace, or nullptr when it is not being recorded
+    KTraceRecorder* GetTraceRecorder();
+
     /// Workaround for single-core mode when preempting threads while idle.
     bool IsPhantomModeForSingleCore() const;
     void SetIsPhantomModeForSingleCore(bool value);
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "core/core.h"
@@ -12,6 +14,11 @@
 #include "core/hle/kernel/svc.h"
 
 namespace Kernel {
+namespace {
+s64 ToHostTimeNs(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+} // Anonymous namespace
 
 PhysicalCore::PhysicalCore(KernelCore& kernel, std::size_t core_index)
     : m_kernel{kernel}, m_core_index{core_index} {
@@ -204,12 +211,44 @@ void PhysicalCore::LogBacktrace() {
 }
 
 void PhysicalCore::Idle() {
-    std::unique_lock lk{m_guard};
-    m_on_interrupt.wait(lk, [this] { return m_is_interrupted; });
+    // In multicore the timer thread interrupts the cores when core timing events fire, so there is
+    // no deadline to wake up for and the host thread can sleep until it is interrupted.
+    m_idle_start_ns.store(ToHostTimeNs(std::chrono::steady_clock::now()),
+                          std::memory_order_relaxed);
+    m_is_interrupted.wait(false, std::memory_order_acquire);
+
+    const s64 idle_start_ns = m_idle_start_ns.exchange(0, std::memory_order_relaxed);
+    const s64 idle_ns = ToHostTimeNs(std::chrono::steady_clock::now()) - idle_start_ns;
+    m_idle_ns.fetch_add(static_cast<u64>(std::max<s64>(idle_ns, 0)), std::memory_order_relaxed);
+    m_idle_wakeups.fetch_add(1, std::memory_order_relaxed);
 }
 
 bool PhysicalCore::IsInterrupted() const {
-    return m_is_interrupted;
+    return m_is_interrupted.load(std::memory_order_acquire);
+}
+
+PhysicalCoreIdleStats PhysicalCore::GetAndResetIdleStats() {
+    const auto now = std::chrono::steady_clock::now();
+    const s64 now_ns = ToHostTimeNs(now);
+    u64 idle_ns = m_idle_ns.exchange(0, std::memory_order_relaxed);
+
+    // A core that is still idle counts up to now, the rest of its idle period goes to the next
+    // interval. If it wakes up meanwhile, its whole idle period goes to the next interval instead.
+    s64 idle_start_ns = m_idle_start_ns.load(std::memory_order_relaxed);
+    if (idle_start_ns != 0 && m_idle_start_ns.compare_exchange_strong(
+                                  idle_start_ns, now_ns, std::memory_order_relaxed)) {
+        idle_ns += static_cast<u64>(std::max<s64>(now_ns - idle_start_ns, 0));
+    }
+
+    const auto interval_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_idle_reset_time).count();
+    m_idle_reset_time = now;
+    const f64 idle_ratio =
+        interval_ns > 0 ? static_cast<f64>(idle_ns) / static_cast<f64>(interval_ns) : 0.0;
+    return PhysicalCoreIdleStats{
+        .idle_ratio = std::min(idle_ratio, 1.0),
+        .wakeups = m_idle_wakeups.exchange(0, std::memory_order_relaxed),
+    };
 }
 
 void PhysicalCore::Interrupt() {
@@ -221,10 +260,10 @@ void PhysicalCore::Interrupt() {
     auto* thread = m_current_thread;
 
     // Add interrupt flag.
-    m_is_interrupted = true;
+    m_is_interrupted.store(true, std::memory_order_release);
 
     // Interrupt ourselves.
-    m_on_interrupt.notify_one();
+    m_is_interrupted.notify_one();
 
     // If there is no thread running, we are done.
     if (arm_interface == nullptr) {
@@ -237,7 +276,7 @@ void PhysicalCore::Interrupt() {
 
 void PhysicalCore::ClearInterrupt() {
     std::scoped_lock lk{m_guard};
-    m_is_interrupted = false;
+    m_is_interrupted.store(false, std::memory_order_release);
 }
 
 } // namespace Kernel
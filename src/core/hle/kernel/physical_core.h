@@ -3,12 +3,14 @@
 
 #pragma once
 
-#include <condition_variable>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <mutex>
 
 #include "core/arm/arm_interface.h"
+#include "core/hle/kernel/physical_core_idle_stats.h"
 
 namespace Kernel {
 class KernelCore;
@@ -46,7 +48,8 @@ public:
     // Log backtrace of current processor state.
     void LogBacktrace();
 
-    // Wait for an interrupt.
+    // Wait for an interrupt. The host thread sleeps on the interrupt flag without taking the
+    // core context lock, so Interrupt() only has to wake it up.
     void Idle();
 
     // Interrupt this core.
@@ -58,6 +61,10 @@ public:
     // Check if this core is interrupted.
     bool IsInterrupted() const;
 
+    // Get the idle time of this core since the last call, see PhysicalCoreIdleStats.
+    // Must not be called from more than one thread at a time.
+    PhysicalCoreIdleStats GetAndResetIdleStats();
+
     std::size_t CoreIndex() const {
         return m_core_index;
     }
@@ -67,11 +74,16 @@ private:
     const std::size_t m_core_index;
 
     std::mutex m_guard;
-    std::condition_variable m_on_interrupt;
     Core::ArmInterface* m_arm_interface{};
     KThread* m_current_thread{};
-    bool m_is_interrupted{};
+    std::atomic<bool> m_is_interrupted{};
     bool m_is_single_core{};
+
+    // Host time the current idle period started at, zero while not idle.
+    std::atomic<s64> m_idle_start_ns{};
+    std::atomic<u64> m_idle_ns{};
+    std::atomic<u64> m_idle_wakeups{};
+    std::chrono::steady_clock::time_point m_idle_reset_time{std::chrono::steady_clock::now()};
 };
 
 } // namespace Kernel
@@ -0,0 +1,16 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace Kernel {
+
+/// Host time an emulated core spent waiting for an interrupt, since the last reset
+struct PhysicalCoreIdleStats {
+    f64 idle_ratio{}; ///< Fraction of the host time the core was idle
+    u64 wakeups{};    ///< Times the core woke up from idle
+};
+
+} // namespace Kernel
@@ -24,11 +24,11 @@ public:
     }
 
     static Derived* Allocate(KernelCore& kernel) {
-        return kernel.SlabHeap<Derived>().Allocate(kernel);
+        return kernel.SlabHeap<Derived>().Allocate(kernel, kernel.CurrentPhysicalCoreIndex());
     }
 
     static void Free(KernelCore& kernel, Derived* obj) {
-        kernel.SlabHeap<Derived>().Free(obj);
+        kernel.SlabHeap<Derived>().Free(obj, kernel.CurrentPhysicalCoreIndex());
     }
 
     static size_t GetObjectSize(KernelCore& kernel) {
@@ -58,11 +58,11 @@ class KAutoObjectWithSlabHeap : public Base {
 
 private:
     static Derived* Allocate(KernelCore& kernel) {
-        return kernel.SlabHeap<Derived>().Allocate(kernel);
+        return kernel.SlabHeap<Derived>().Allocate(kernel, kernel.CurrentPhysicalCoreIndex());
     }
 
     static void Free(KernelCore& kernel, Derived* obj) {
-        kernel.SlabHeap<Derived>().Free(obj);
+        kernel.SlabHeap<Derived>().Free(obj, kernel.CurrentPhysicalCoreIndex());
     }
 
 public:
@@ -133,11 +133,11 @@ class KAutoObjectWithSlabHeapAndContainer : public Base {
 
 private:
     static Derived* Allocate(KernelCore& kernel) {
-        return kernel.SlabHeap<Derived>().Allocate(kernel);
+        return kernel.SlabHeap<Derived>().Allocate(kernel, kernel.CurrentPhysicalCoreIndex());
     }
 
     static void Free(KernelCore& kernel, Derived* obj) {
-        kernel.SlabHeap<Derived>().Free(obj);
+        kernel.SlabHeap<Derived>().Free(obj, kernel.CurrentPhysicalCoreIndex());
     }
 
 public:
@@ -3,12 +3,17 @@
 
 // This file is automatically generated using svc_generator.py.
 
+#include <array>
+#include <chrono>
 #include <type_traits>
 
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/k_thread.h"
+#include "core/hle/kernel/k_trace_recorder.h"
 #include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_statistics.h"
 
 namespace Kernel::Svc {
 
@@ -3913,514 +3918,408 @@ static void SvcWrap_UnmapInsecureMemory64(Core::System& system, std::span<uint64
     SetArg64(args, 0, Convert<uint64_t>(ret));
 }
 
-static void Call32(Core::System& system, u32 imm, std::span<uint64_t, 8> args) {
-    switch (static_cast<SvcId>(imm)) {
-    case SvcId::SetHeapSize:
-        return SvcWrap_SetHeapSize64From32(system, args);
-    case SvcId::SetMemoryPermission:
-        return SvcWrap_SetMemoryPermission64From32(system, args);
-    case SvcId::SetMemoryAttribute:
-        return SvcWrap_SetMemoryAttribute64From32(system, args);
-    case SvcId::MapMemory:
-        return SvcWrap_MapMemory64From32(system, args);
-    case SvcId::UnmapMemory:
-        return SvcWrap_UnmapMemory64From32(system, args);
-    case SvcId::QueryMemory:
-        return SvcWrap_QueryMemory64From32(system, args);
-    case SvcId::ExitProcess:
-        return SvcWrap_ExitProcess64From32(system, args);
-    case SvcId::CreateThread:
-        return SvcWrap_CreateThread64From32(system, args);
-    case SvcId::StartThread:
-        return SvcWrap_StartThread64From32(system, args);
-    case SvcId::ExitThread:
-        return SvcWrap_ExitThread64From32(system, args);
-    case SvcId::SleepThread:
-        return SvcWrap_SleepThread64From32(system, args);
-    case SvcId::GetThreadPriority:
-        return SvcWrap_GetThreadPriority64From32(system, args);
-    case SvcId::SetThreadPriority:
-        return SvcWrap_SetThreadPriority64From32(system, args);
-    case SvcId::GetThreadCoreMask:
-        return SvcWrap_GetThreadCoreMask64From32(system, args);
-    case SvcId::SetThreadCoreMask:
-        return SvcWrap_SetThreadCoreMask64From32(system, args);
-    case SvcId::GetCurrentProcessorNumber:
-        return SvcWrap_GetCurrentProcessorNumber64From32(system, args);
-    case SvcId::SignalEvent:
-        return SvcWrap_SignalEvent64From32(system, args);
-    case SvcId::ClearEvent:
-        return SvcWrap_ClearEvent64From32(system, args);
-    case SvcId::MapSharedMemory:
-        return SvcWrap_MapSharedMemory64From32(system, args);
-    case SvcId::UnmapSharedMemory:
-        return SvcWrap_UnmapSharedMemory64From32(system, args);
-    case SvcId::CreateTransferMemory:
-        return SvcWrap_CreateTransferMemory64From32(system, args);
-    case SvcId::CloseHandle:
-        return SvcWrap_CloseHandle64From32(system, args);
-    case SvcId::ResetSignal:
-        return SvcWrap_ResetSignal64From32(system, args);
-    case SvcId::WaitSynchronization:
-        return SvcWrap_WaitSynchronization64From32(system, args);
-    case SvcId::CancelSynchronization:
-        return SvcWrap_CancelSynchronization64From32(system, args);
-    case SvcId::ArbitrateLock:
-        return SvcWrap_ArbitrateLock64From32(system, args);
-    case SvcId::ArbitrateUnlock:
-        return SvcWrap_ArbitrateUnlock64From32(system, args);
-    case SvcId::WaitProcessWideKeyAtomic:
-        return SvcWrap_WaitProcessWideKeyAtomic64From32(system, args);
-    case SvcId::SignalProcessWideKey:
-        return SvcWrap_SignalProcessWideKey64From32(system, args);
-    case SvcId::GetSystemTick:
-        return SvcWrap_GetSystemTick64From32(system, args);
-    case SvcId::ConnectToNamedPort:
-        return SvcWrap_ConnectToNamedPort64From32(system, args);
-    case SvcId::SendSyncRequestLight:
-        return SvcWrap_SendSyncRequestLight64From32(system, args);
-    case SvcId::SendSyncRequest:
-        return SvcWrap_SendSyncRequest64From32(system, args);
-    case SvcId::SendSyncRequestWithUserBuffer:
-        return SvcWrap_SendSyncRequestWithUserBuffer64From32(system, args);
-    case SvcId::SendAsyncRequestWithUserBuffer:
-        return SvcWrap_SendAsyncRequestWithUserBuffer64From32(system, args);
-    case SvcId::GetProcessId:
-        return SvcWrap_GetProcessId64From32(system, args);
-    case SvcId::GetThreadId:
-        return SvcWrap_GetThreadId64From32(system, args);
-    case SvcId::Break:
-        return SvcWrap_Break64From32(system, args);
-    case SvcId::OutputDebugString:
-        return SvcWrap_OutputDebugString64From32(system, args);
-    case SvcId::ReturnFromException:
-        return SvcWrap_ReturnFromException64From32(system, args);
-    case SvcId::GetInfo:
-        return SvcWrap_GetInfo64From32(system, args);
-    case SvcId::FlushEntireDataCache:
-        return SvcWrap_FlushEntireDataCache64From32(system, args);
-    case SvcId::FlushDataCache:
-        return SvcWrap_FlushDataCache64From32(system, args);
-    case SvcId::MapPhysicalMemory:
-        return SvcWrap_MapPhysicalMemory64From32(system, args);
-    case SvcId::UnmapPhysicalMemory:
-        return SvcWrap_UnmapPhysicalMemory64From32(system, args);
-    case SvcId::GetDebugFutureThreadInfo:
-        return SvcWrap_GetDebugFutureThreadInfo64From32(system, args);
-    case SvcId::GetLastThreadInfo:
-        return SvcWrap_GetLastThreadInfo64From32(system, args);
-    case SvcId::GetResourceLimitLimitValue:
-        return SvcWrap_GetResourceLimitLimitValue64From32(system, args);
-    case SvcId::GetResourceLimitCurrentValue:
-        return SvcWrap_GetResourceLimitCurrentValue64From32(system, args);
-    case SvcId::SetThreadActivity:
-        return SvcWrap_SetThreadActivity64From32(system, args);
-    case SvcId::GetThreadContext3:
-        return SvcWrap_GetThreadContext364From32(system, args);
-    case SvcId::WaitForAddress:
-        return SvcWrap_WaitForAddress64From32(system, args);
-    case SvcId::SignalToAddress:
-        return SvcWrap_SignalToAddress64From32(system, args);
-    case SvcId::SynchronizePreemptionState:
-        return SvcWrap_SynchronizePreemptionState64From32(system, args);
-    case SvcId::GetResourceLimitPeakValue:
-        return SvcWrap_GetResourceLimitPeakValue64From32(system, args);
-    case SvcId::CreateIoPool:
-        return SvcWrap_CreateIoPool64From32(system, args);
-    case SvcId::CreateIoRegion:
-        return SvcWrap_CreateIoRegion64From32(system, args);
-    case SvcId::KernelDebug:
-        return SvcWrap_KernelDebug64From32(system, args);
-    case SvcId::ChangeKernelTraceState:
-        return SvcWrap_ChangeKernelTraceState64From32(system, args);
-    case SvcId::CreateSession:
-        return SvcWrap_CreateSession64From32(system, args);
-    case SvcId::AcceptSession:
-        return SvcWrap_AcceptSession64From32(system, args);
-    case SvcId::ReplyAndReceiveLight:
-        return SvcWrap_ReplyAndReceiveLight64From32(system, args);
-    case SvcId::ReplyAndReceive:
-        return SvcWrap_ReplyAndReceive64From32(system, args);
-    case SvcId::ReplyAndReceiveWithUserBuffer:
-        return SvcWrap_ReplyAndReceiveWithUserBuffer64From32(system, args);
-    case SvcId::CreateEvent:
-        return SvcWrap_CreateEvent64From32(system, args);
-    case SvcId::MapIoRegion:
-        return SvcWrap_MapIoRegion64From32(system, args);
-    case SvcId::UnmapIoRegion:
-        return SvcWrap_UnmapIoRegion64From32(system, args);
-    case SvcId::MapPhysicalMemoryUnsafe:
-        return SvcWrap_MapPhysicalMemoryUnsafe64From32(system, args);
-    case SvcId::UnmapPhysicalMemoryUnsafe:
-        return SvcWrap_UnmapPhysicalMemoryUnsafe64From32(system, args);
-    case SvcId::SetUnsafeLimit:
-        return SvcWrap_SetUnsafeLimit64From32(system, args);
-    case SvcId::CreateCodeMemory:
-        return SvcWrap_CreateCodeMemory64From32(system, args);
-    case SvcId::ControlCodeMemory:
-        return SvcWrap_ControlCodeMemory64From32(system, args);
-    case SvcId::SleepSystem:
-        return SvcWrap_SleepSystem64From32(system, args);
-    case SvcId::ReadWriteRegister:
-        return SvcWrap_ReadWriteRegister64From32(system, args);
-    case SvcId::SetProcessActivity:
-        return SvcWrap_SetProcessActivity64From32(system, args);
-    case SvcId::CreateSharedMemory:
-        return SvcWrap_CreateSharedMemory64From32(system, args);
-    case SvcId::MapTransferMemory:
-        return SvcWrap_MapTransferMemory64From32(system, args);
-    case SvcId::UnmapTransferMemory:
-        return SvcWrap_UnmapTransferMemory64From32(system, args);
-    case SvcId::CreateInterruptEvent:
-        return SvcWrap_CreateInterruptEvent64From32(system, args);
-    case SvcId::QueryPhysicalAddress:
-        return SvcWrap_QueryPhysicalAddress64From32(system, args);
-    case SvcId::QueryIoMapping:
-        return SvcWrap_QueryIoMapping64From32(system, args);
-    case SvcId::CreateDeviceAddressSpace:
-        return SvcWrap_CreateDeviceAddressSpace64From32(system, args);
-    case SvcId::AttachDeviceAddressSpace:
-        return SvcWrap_AttachDeviceAddressSpace64From32(system, args);
-    case SvcId::DetachDeviceAddressSpace:
-        return SvcWrap_DetachDeviceAddressSpace64From32(system, args);
-    case SvcId::MapDeviceAddressSpaceByForce:
-        return SvcWrap_MapDeviceAddressSpaceByForce64From32(system, args);
-    case SvcId::MapDeviceAddressSpaceAligned:
-        return SvcWrap_MapDeviceAddressSpaceAligned64From32(system, args);
-    case SvcId::UnmapDeviceAddressSpace:
-        return SvcWrap_UnmapDeviceAddressSpace64From32(system, args);
-    case SvcId::InvalidateProcessDataCache:
-        return SvcWrap_InvalidateProcessDataCache64From32(system, args);
-    case SvcId::StoreProcessDataCache:
-        return SvcWrap_StoreProcessDataCache64From32(system, args);
-    case SvcId::FlushProcessDataCache:
-        return SvcWrap_FlushProcessDataCache64From32(system, args);
-    case SvcId::DebugActiveProcess:
-        return SvcWrap_DebugActiveProcess64From32(system, args);
-    case SvcId::BreakDebugProcess:
-        return SvcWrap_BreakDebugProcess64From32(system, args);
-    case SvcId::TerminateDebugProcess:
-        return SvcWrap_TerminateDebugProcess64From32(system, args);
-    case SvcId::GetDebugEvent:
-        return SvcWrap_GetDebugEvent64From32(system, args);
-    case SvcId::ContinueDebugEvent:
-        return SvcWrap_ContinueDebugEvent64From32(system, args);
-    case SvcId::GetProcessList:
-        return SvcWrap_GetProcessList64From32(system, args);
-    case SvcId::GetThreadList:
-        return SvcWrap_GetThreadList64From32(system, args);
-    case SvcId::GetDebugThreadContext:
-        return SvcWrap_GetDebugThreadContext64From32(system, args);
-    case SvcId::SetDebugThreadContext:
-        return SvcWrap_SetDebugThreadContext64From32(system, args);
-    case SvcId::QueryDebugProcessMemory:
-        return SvcWrap_QueryDebugProcessMemory64From32(system, args);
-    case SvcId::ReadDebugProcessMemory:
-        return SvcWrap_ReadDebugProcessMemory64From32(system, args);
-    case SvcId::WriteDebugProcessMemory:
-        return SvcWrap_WriteDebugProcessMemory64From32(system, args);
-    case SvcId::SetHardwareBreakPoint:
-        return SvcWrap_SetHardwareBreakPoint64From32(system, args);
-    case SvcId::GetDebugThreadParam:
-        return SvcWrap_GetDebugThreadParam64From32(system, args);
-    case SvcId::GetSystemInfo:
-        return SvcWrap_GetSystemInfo64From32(system, args);
-    case SvcId::CreatePort:
-        return SvcWrap_CreatePort64From32(system, args);
-    case SvcId::ManageNamedPort:
-        return SvcWrap_ManageNamedPort64From32(system, args);
-    case SvcId::ConnectToPort:
-        return SvcWrap_ConnectToPort64From32(system, args);
-    case SvcId::SetProcessMemoryPermission:
-        return SvcWrap_SetProcessMemoryPermission64From32(system, args);
-    case SvcId::MapProcessMemory:
-        return SvcWrap_MapProcessMemory64From32(system, args);
-    case SvcId::UnmapProcessMemory:
-        return SvcWrap_UnmapProcessMemory64From32(system, args);
-    case SvcId::QueryProcessMemory:
-        return SvcWrap_QueryProcessMemory64From32(system, args);
-    case SvcId::MapProcessCodeMemory:
-        return SvcWrap_MapProcessCodeMemory64From32(system, args);
-    case SvcId::UnmapProcessCodeMemory:
-        return SvcWrap_UnmapProcessCodeMemory64From32(system, args);
-    case SvcId::CreateProcess:
-        return SvcWrap_CreateProcess64From32(system, args);
-    case SvcId::StartProcess:
-        return SvcWrap_StartProcess64From32(system, args);
-    case SvcId::TerminateProcess:
-        return SvcWrap_TerminateProcess64From32(system, args);
-    case SvcId::GetProcessInfo:
-        return SvcWrap_GetProcessInfo64From32(system, args);
-    case SvcId::CreateResourceLimit:
-        return SvcWrap_CreateResourceLimit64From32(system, args);
-    case SvcId::SetResourceLimitLimitValue:
-        return SvcWrap_SetResourceLimitLimitValue64From32(system, args);
-    case SvcId::CallSecureMonitor:
-        return SvcWrap_CallSecureMonitor64From32(system, args);
-    case SvcId::MapInsecureMemory:
-        return SvcWrap_MapInsecureMemory64From32(system, args);
-    case SvcId::UnmapInsecureMemory:
-        return SvcWrap_UnmapInsecureMemory64From32(system, args);
-    default:
-        LOG_CRITICAL(Kernel_SVC, "Unknown SVC {:x}!", imm);
-        break;
+using SvcHandler = void (*)(Core::System&, std::span<uint64_t, 8>);
+
+static constexpr auto SvcTable32 = [] {
+    std::array<SvcHandler, NumSupervisorCalls> table{};
+    table[0x01] = SvcWrap_SetHeapSize64From32;
+    table[0x02] = SvcWrap_SetMemoryPermission64From32;
+    table[0x03] = SvcWrap_SetMemoryAttribute64From32;
+    table[0x04] = SvcWrap_MapMemory64From32;
+    table[0x05] = SvcWrap_UnmapMemory64From32;
+    table[0x06] = SvcWrap_QueryMemory64From32;
+    table[0x07] = SvcWrap_ExitProcess64From32;
+    table[0x08] = SvcWrap_CreateThread64From32;
+    table[0x09] = SvcWrap_StartThread64From32;
+    table[0x0a] = SvcWrap_ExitThread64From32;
+    table[0x0b] = SvcWrap_SleepThread64From32;
+    table[0x0c] = SvcWrap_GetThreadPriority64From32;
+    table[0x0d] = SvcWrap_SetThreadPriority64From32;
+    table[0x0e] = SvcWrap_GetThreadCoreMask64From32;
+    table[0x0f] = SvcWrap_SetThreadCoreMask64From32;
+    table[0x10] = SvcWrap_GetCurrentProcessorNumber64From32;
+    table[0x11] = SvcWrap_SignalEvent64From32;
+    table[0x12] = SvcWrap_ClearEvent64From32;
+    table[0x13] = SvcWrap_MapSharedMemory64From32;
+    table[0x14] = SvcWrap_UnmapSharedMemory64From32;
+    table[0x15] = SvcWrap_CreateTransferMemory64From32;
+    table[0x16] = SvcWrap_CloseHandle64From32;
+    table[0x17] = SvcWrap_ResetSignal64From32;
+    table[0x18] = SvcWrap_WaitSynchronization64From32;
+    table[0x19] = SvcWrap_CancelSynchronization64From32;
+    table[0x1a] = SvcWrap_ArbitrateLock64From32;
+    table[0x1b] = SvcWrap_ArbitrateUnlock64From32;
+    table[0x1c] = SvcWrap_WaitProcessWideKeyAtomic64From32;
+    table[0x1d] = SvcWrap_SignalProcessWideKey64From32;
+    table[0x1e] = SvcWrap_GetSystemTick64From32;
+    table[0x1f] = SvcWrap_ConnectToNamedPort64From32;
+    table[0x20] = SvcWrap_SendSyncRequestLight64From32;
+    table[0x21] = SvcWrap_SendSyncRequest64From32;
+    table[0x22] = SvcWrap_SendSyncRequestWithUserBuffer64From32;
+    table[0x23] = SvcWrap_SendAsyncRequestWithUserBuffer64From32;
+    table[0x24] = SvcWrap_GetProcessId64From32;
+    table[0x25] = SvcWrap_GetThreadId64From32;
+    table[0x26] = SvcWrap_Break64From32;
+    table[0x27] = SvcWrap_OutputDebugString64From32;
+    table[0x28] = SvcWrap_ReturnFromException64From32;
+    table[0x29] = SvcWrap_GetInfo64From32;
+    table[0x2a] = SvcWrap_FlushEntireDataCache64From32;
+    table[0x2b] = SvcWrap_FlushDataCache64From32;
+    table[0x2c] = SvcWrap_MapPhysicalMemory64From32;
+    table[0x2d] = SvcWrap_UnmapPhysicalMemory64From32;
+    table[0x2e] = SvcWrap_GetDebugFutureThreadInfo64From32;
+    table[0x2f] = SvcWrap_GetLastThreadInfo64From32;
+    table[0x30] = SvcWrap_GetResourceLimitLimitValue64From32;
+    table[0x31] = SvcWrap_GetResourceLimitCurrentValue64From32;
+    table[0x32] = SvcWrap_SetThreadActivity64From32;
+    table[0x33] = SvcWrap_GetThreadContext364From32;
+    table[0x34] = SvcWrap_WaitForAddress64From32;
+    table[0x35] = SvcWrap_SignalToAddress64From32;
+    table[0x36] = SvcWrap_SynchronizePreemptionState64From32;
+    table[0x37] = SvcWrap_GetResourceLimitPeakValue64From32;
+    table[0x39] = SvcWrap_CreateIoPool64From32;
+    table[0x3a] = SvcWrap_CreateIoRegion64From32;
+    table[0x3c] = SvcWrap_KernelDebug64From32;
+    table[0x3d] = SvcWrap_ChangeKernelTraceState64From32;
+    table[0x40] = SvcWrap_CreateSession64From32;
+    table[0x41] = SvcWrap_AcceptSession64From32;
+    table[0x42] = SvcWrap_ReplyAndReceiveLight64From32;
+    table[0x43] = SvcWrap_ReplyAndReceive64From32;
+    table[0x44] = SvcWrap_ReplyAndReceiveWithUserBuffer64From32;
+    table[0x45] = SvcWrap_CreateEvent64From32;
+    table[0x46] = SvcWrap_MapIoRegion64From32;
+    table[0x47] = SvcWrap_UnmapIoRegion64From32;
+    table[0x48] = SvcWrap_MapPhysicalMemoryUnsafe64From32;
+    table[0x49] = SvcWrap_UnmapPhysicalMemoryUnsafe64From32;
+    table[0x4a] = SvcWrap_SetUnsafeLimit64From32;
+    table[0x4b] = SvcWrap_CreateCodeMemory64From32;
+    table[0x4c] = SvcWrap_ControlCodeMemory64From32;
+    table[0x4d] = SvcWrap_SleepSystem64From32;
+    table[0x4e] = SvcWrap_ReadWriteRegister64From32;
+    table[0x4f] = SvcWrap_SetProcessActivity64From32;
+    table[0x50] = SvcWrap_CreateSharedMemory64From32;
+    table[0x51] = SvcWrap_MapTransferMemory64From32;
+    table[0x52] = SvcWrap_UnmapTransferMemory64From32;
+    table[0x53] = SvcWrap_CreateInterruptEvent64From32;
+    table[0x54] = SvcWrap_QueryPhysicalAddress64From32;
+    table[0x55] = SvcWrap_QueryIoMapping64From32;
+    table[0x56] = SvcWrap_CreateDeviceAddressSpace64From32;
+    table[0x57] = SvcWrap_AttachDeviceAddressSpace64From32;
+    table[0x58] = SvcWrap_DetachDeviceAddressSpace64From32;
+    table[0x59] = SvcWrap_MapDeviceAddressSpaceByForce64From32;
+    table[0x5a] = SvcWrap_MapDeviceAddressSpaceAligned64From32;
+    table[0x5c] = SvcWrap_UnmapDeviceAddressSpace64From32;
+    table[0x5d] = SvcWrap_InvalidateProcessDataCache64From32;
+    table[0x5e] = SvcWrap_StoreProcessDataCache64From32;
+    table[0x5f] = SvcWrap_FlushProcessDataCache64From32;
+    table[0x60] = SvcWrap_DebugActiveProcess64From32;
+    table[0x61] = SvcWrap_BreakDebugProcess64From32;
+    table[0x62] = SvcWrap_TerminateDebugProcess64From32;
+    table[0x63] = SvcWrap_GetDebugEvent64From32;
+    table[0x64] = SvcWrap_ContinueDebugEvent64From32;
+    table[0x65] = SvcWrap_GetProcessList64From32;
+    table[0x66] = SvcWrap_GetThreadList64From32;
+    table[0x67] = SvcWrap_GetDebugThreadContext64From32;
+    table[0x68] = SvcWrap_SetDebugThreadContext64From32;
+    table[0x69] = SvcWrap_QueryDebugProcessMemory64From32;
+    table[0x6a] = SvcWrap_ReadDebugProcessMemory64From32;
+    table[0x6b] = SvcWrap_WriteDebugProcessMemory64From32;
+    table[0x6c] = SvcWrap_SetHardwareBreakPoint64From32;
+    table[0x6d] = SvcWrap_GetDebugThreadParam64From32;
+    table[0x6f] = SvcWrap_GetSystemInfo64From32;
+    table[0x70] = SvcWrap_CreatePort64From32;
+    table[0x71] = SvcWrap_ManageNamedPort64From32;
+    table[0x72] = SvcWrap_ConnectToPort64From32;
+    table[0x73] = SvcWrap_SetProcessMemoryPermission64From32;
+    table[0x74] = SvcWrap_MapProcessMemory64From32;
+    table[0x75] = SvcWrap_UnmapProcessMemory64From32;
+    table[0x76] = SvcWrap_QueryProcessMemory64From32;
+    table[0x77] = SvcWrap_MapProcessCodeMemory64From32;
+    table[0x78] = SvcWrap_UnmapProcessCodeMemory64From32;
+    table[0x79] = SvcWrap_CreateProcess64From32;
+    table[0x7a] = SvcWrap_StartProcess64From32;
+    table[0x7b] = SvcWrap_TerminateProcess64From32;
+    table[0x7c] = SvcWrap_GetProcessInfo64From32;
+    table[0x7d] = SvcWrap_CreateResourceLimit64From32;
+    table[0x7e] = SvcWrap_SetResourceLimitLimitValue64From32;
+    table[0x7f] = SvcWrap_CallSecureMonitor64From32;
+    table[0x90] = SvcWrap_MapInsecureMemory64From32;
+    table[0x91] = SvcWrap_UnmapInsecureMemory64From32;
+    return table;
+}();
+
+static constexpr auto SvcTable64 = [] {
+    std::array<SvcHandler, NumSupervisorCalls> table{};
+    table[0x01] = SvcWrap_SetHeapSize64;
+    table[0x02] = SvcWrap_SetMemoryPermission64;
+    table[0x03] = SvcWrap_SetMemoryAttribute64;
+    table[0x04] = SvcWrap_MapMemory64;
+    table[0x05] = SvcWrap_UnmapMemory64;
+    table[0x06] = SvcWrap_QueryMemory64;
+    table[0x07] = SvcWrap_ExitProcess64;
+    table[0x08] = SvcWrap_CreateThread64;
+    table[0x09] = SvcWrap_StartThread64;
+    table[0x0a] = SvcWrap_ExitThread64;
+    table[0x0b] = SvcWrap_SleepThread64;
+    table[0x0c] = SvcWrap_GetThreadPriority64;
+    table[0x0d] = SvcWrap_SetThreadPriority64;
+    table[0x0e] = SvcWrap_GetThreadCoreMask64;
+    table[0x0f] = SvcWrap_SetThreadCoreMask64;
+    table[0x10] = SvcWrap_GetCurrentProcessorNumber64;
+    table[0x11] = SvcWrap_SignalEvent64;
+    table[0x12] = SvcWrap_ClearEvent64;
+    table[0x13] = SvcWrap_MapSharedMemory64;
+    table[0x14] = SvcWrap_UnmapSharedMemory64;
+    table[0x15] = SvcWrap_CreateTransferMemory64;
+    table[0x16] = SvcWrap_CloseHandle64;
+    table[0x17] = SvcWrap_ResetSignal64;
+    table[0x18] = SvcWrap_WaitSynchronization64;
+    table[0x19] = SvcWrap_CancelSynchronization64;
+    table[0x1a] = SvcWrap_ArbitrateLock64;
+    table[0x1b] = SvcWrap_ArbitrateUnlock64;
+    table[0x1c] = SvcWrap_WaitProcessWideKeyAtomic64;
+    table[0x1d] = SvcWrap_SignalProcessWideKey64;
+    table[0x1e] = SvcWrap_GetSystemTick64;
+    table[0x1f] = SvcWrap_ConnectToNamedPort64;
+    table[0x20] = SvcWrap_SendSyncRequestLight64;
+    table[0x21] = SvcWrap_SendSyncRequest64;
+    table[0x22] = SvcWrap_SendSyncRequestWithUserBuffer64;
+    table[0x23] = SvcWrap_SendAsyncRequestWithUserBuffer64;
+    table[0x24] = SvcWrap_GetProcessId64;
+    table[0x25] = SvcWrap_GetThreadId64;
+    table[0x26] = SvcWrap_Break64;
+    table[0x27] = SvcWrap_OutputDebugString64;
+    table[0x28] = SvcWrap_ReturnFromException64;
+    table[0x29] = SvcWrap_GetInfo64;
+    table[0x2a] = SvcWrap_FlushEntireDataCache64;
+    table[0x2b] = SvcWrap_FlushDataCache64;
+    table[0x2c] = SvcWrap_MapPhysicalMemory64;
+    table[0x2d] = SvcWrap_UnmapPhysicalMemory64;
+    table[0x2e] = SvcWrap_GetDebugFutureThreadInfo64;
+    table[0x2f] = SvcWrap_GetLastThreadInfo64;
+    table[0x30] = SvcWrap_GetResourceLimitLimitValue64;
+    table[0x31] = SvcWrap_GetResourceLimitCurrentValue64;
+    table[0x32] = SvcWrap_SetThreadActivity64;
+    table[0x33] = SvcWrap_GetThreadContext364;
+    table[0x34] = SvcWrap_WaitForAddress64;
+    table[0x35] = SvcWrap_SignalToAddress64;
+    table[0x36] = SvcWrap_SynchronizePreemptionState64;
+    table[0x37] = SvcWrap_GetResourceLimitPeakValue64;
+    table[0x39] = SvcWrap_CreateIoPool64;
+    table[0x3a] = SvcWrap_CreateIoRegion64;
+    table[0x3c] = SvcWrap_KernelDebug64;
+    table[0x3d] = SvcWrap_ChangeKernelTraceState64;
+    table[0x40] = SvcWrap_CreateSession64;
+    table[0x41] = SvcWrap_AcceptSession64;
+    table[0x42] = SvcWrap_ReplyAndReceiveLight64;
+    table[0x43] = SvcWrap_ReplyAndReceive64;
+    table[0x44] = SvcWrap_ReplyAndReceiveWithUserBuffer64;
+    table[0x45] = SvcWrap_CreateEvent64;
+    table[0x46] = SvcWrap_MapIoRegion64;
+    table[0x47] = SvcWrap_UnmapIoRegion64;
+    table[0x48] = SvcWrap_MapPhysicalMemoryUnsafe64;
+    table[0x49] = SvcWrap_UnmapPhysicalMemoryUnsafe64;
+    table[0x4a] = SvcWrap_SetUnsafeLimit64;
+    table[0x4b] = SvcWrap_CreateCodeMemory64;
+    table[0x4c] = SvcWrap_ControlCodeMemory64;
+    table[0x4d] = SvcWrap_SleepSystem64;
+    table[0x4e] = SvcWrap_ReadWriteRegister64;
+    table[0x4f] = SvcWrap_SetProcessActivity64;
+    table[0x50] = SvcWrap_CreateSharedMemory64;
+    table[0x51] = SvcWrap_MapTransferMemory64;
+    table[0x52] = SvcWrap_UnmapTransferMemory64;
+    table[0x53] = SvcWrap_CreateInterruptEvent64;
+    table[0x54] = SvcWrap_QueryPhysicalAddress64;
+    table[0x55] = SvcWrap_QueryIoMapping64;
+    table[0x56] = SvcWrap_CreateDeviceAddressSpace64;
+    table[0x57] = SvcWrap_AttachDeviceAddressSpace64;
+    table[0x58] = SvcWrap_DetachDeviceAddressSpace64;
+    table[0x59] = SvcWrap_MapDeviceAddressSpaceByForce64;
+    table[0x5a] = SvcWrap_MapDeviceAddressSpaceAligned64;
+    table[0x5c] = SvcWrap_UnmapDeviceAddressSpace64;
+    table[0x5d] = SvcWrap_InvalidateProcessDataCache64;
+    table[0x5e] = SvcWrap_StoreProcessDataCache64;
+    table[0x5f] = SvcWrap_FlushProcessDataCache64;
+    table[0x60] = SvcWrap_DebugActiveProcess64;
+    table[0x61] = SvcWrap_BreakDebugProcess64;
+    table[0x62] = SvcWrap_TerminateDebugProcess64;
+    table[0x63] = SvcWrap_GetDebugEvent64;
+    table[0x64] = SvcWrap_ContinueDebugEvent64;
+    table[0x65] = SvcWrap_GetProcessList64;
+    table[0x66] = SvcWrap_GetThreadList64;
+    table[0x67] = SvcWrap_GetDebugThreadContext64;
+    table[0x68] = SvcWrap_SetDebugThreadContext64;
+    table[0x69] = SvcWrap_QueryDebugProcessMemory64;
+    table[0x6a] = SvcWrap_ReadDebugProcessMemory64;
+    table[0x6b] = SvcWrap_WriteDebugProcessMemory64;
+    table[0x6c] = SvcWrap_SetHardwareBreakPoint64;
+    table[0x6d] = SvcWrap_GetDebugThreadParam64;
+    table[0x6f] = SvcWrap_GetSystemInfo64;
+    table[0x70] = SvcWrap_CreatePort64;
+    table[0x71] = SvcWrap_ManageNamedPort64;
+    table[0x72] = SvcWrap_ConnectToPort64;
+    table[0x73] = SvcWrap_SetProcessMemoryPermission64;
+    table[0x74] = SvcWrap_MapProcessMemory64;
+    table[0x75] = SvcWrap_UnmapProcessMemory64;
+    table[0x76] = SvcWrap_QueryProcessMemory64;
+    table[0x77] = SvcWrap_MapProcessCodeMemory64;
+    table[0x78] = SvcWrap_UnmapProcessCodeMemory64;
+    table[0x79] = SvcWrap_CreateProcess64;
+    table[0x7a] = SvcWrap_StartProcess64;
+    table[0x7b] = SvcWrap_TerminateProcess64;
+    table[0x7c] = SvcWrap_GetProcessInfo64;
+    table[0x7d] = SvcWrap_CreateResourceLimit64;
+    table[0x7e] = SvcWrap_SetResourceLimitLimitValue64;
+    table[0x7f] = SvcWrap_CallSecureMonitor64;
+    table[0x90] = SvcWrap_MapInsecureMemory64;
+    table[0x91] = SvcWrap_UnmapInsecureMemory64;
+    return table;
+}();
+
+static constexpr auto SvcNames = [] {
+    std::array<const char*, NumSupervisorCalls> table{};
+    table[0x01] = "SetHeapSize";
+    table[0x02] = "SetMemoryPermission";
+    table[0x03] = "SetMemoryAttribute";
+    table[0x04] = "MapMemory";
+    table[0x05] = "UnmapMemory";
+    table[0x06] = "QueryMemory";
+    table[0x07] = "ExitProcess";
+    table[0x08] = "CreateThread";
+    table[0x09] = "StartThread";
+    table[0x0a] = "ExitThread";
+    table[0x0b] = "SleepThread";
+    table[0x0c] = "GetThreadPriority";
+    table[0x0d] = "SetThreadPriority";
+    table[0x0e] = "GetThreadCoreMask";
+    table[0x0f] = "SetThreadCoreMask";
+    table[0x10] = "GetCurrentProcessorNumber";
+    table[0x11] = "SignalEvent";
+    table[0x12] = "ClearEvent";
+    table[0x13] = "MapSharedMemory";
+    table[0x14] = "UnmapSharedMemory";
+    table[0x15] = "CreateTransferMemory";
+    table[0x16] = "CloseHandle";
+    table[0x17] = "ResetSignal";
+    table[0x18] = "WaitSynchronization";
+    table[0x19] = "CancelSynchronization";
+    table[0x1a] = "ArbitrateLock";
+    table[0x1b] = "ArbitrateUnlock";
+    table[0x1c] = "WaitProcessWideKeyAtomic";
+    table[0x1d] = "SignalProcessWideKey";
+    table[0x1e] = "GetSystemTick";
+    table[0x1f] = "ConnectToNamedPort";
+    table[0x20] = "SendSyncRequestLight";
+    table[0x21] = "SendSyncRequest";
+    table[0x22] = "SendSyncRequestWithUserBuffer";
+    table[0x23] = "SendAsyncRequestWithUserBuffer";
+    table[0x24] = "GetProcessId";
+    table[0x25] = "GetThreadId";
+    table[0x26] = "Break";
+    table[0x27] = "OutputDebugString";
+    table[0x28] = "ReturnFromException";
+    table[0x29] = "GetInfo";
+    table[0x2a] = "FlushEntireDataCache";
+    table[0x2b] = "FlushDataCache";
+    table[0x2c] = "MapPhysicalMemory";
+    table[0x2d] = "UnmapPhysicalMemory";
+    table[0x2e] = "GetDebugFutureThreadInfo";
+    table[0x2f] = "GetLastThreadInfo";
+    table[0x30] = "GetResourceLimitLimitValue";
+    table[0x31] = "GetResourceLimitCurrentValue";
+    table[0x32] = "SetThreadActivity";
+    table[0x33] = "GetThreadContext3";
+    table[0x34] = "WaitForAddress";
+    table[0x35] = "SignalToAddress";
+    table[0x36] = "SynchronizePreemptionState";
+    table[0x37] = "GetResourceLimitPeakValue";
+    table[0x39] = "CreateIoPool";
+    table[0x3a] = "CreateIoRegion";
+    table[0x3c] = "KernelDebug";
+    table[0x3d] = "ChangeKernelTraceState";
+    table[0x40] = "CreateSession";
+    table[0x41] = "AcceptSession";
+    table[0x42] = "ReplyAndReceiveLight";
+    table[0x43] = "ReplyAndReceive";
+    table[0x44] = "ReplyAndReceiveWithUserBuffer";
+    table[0x45] = "CreateEvent";
+    table[0x46] = "MapIoRegion";
+    table[0x47] = "UnmapIoRegion";
+    table[0x48] = "MapPhysicalMemoryUnsafe";
+    table[0x49] = "UnmapPhysicalMemoryUnsafe";
+    table[0x4a] = "SetUnsafeLimit";
+    table[0x4b] = "CreateCodeMemory";
+    table[0x4c] = "ControlCodeMemory";
+    table[0x4d] = "SleepSystem";
+    table[0x4e] = "ReadWriteRegister";
+    table[0x4f] = "SetProcessActivity";
+    table[0x50] = "CreateSharedMemory";
+    table[0x51] = "MapTransferMemory";
+    table[0x52] = "UnmapTransferMemory";
+    table[0x53] = "CreateInterruptEvent";
+    table[0x54] = "QueryPhysicalAddress";
+    table[0x55] = "QueryIoMapping";
+    table[0x56] = "CreateDeviceAddressSpace";
+    table[0x57] = "AttachDeviceAddressSpace";
+    table[0x58] = "DetachDeviceAddressSpace";
+    table[0x59] = "MapDeviceAddressSpaceByForce";
+    table[0x5a] = "MapDeviceAddressSpaceAligned";
+    table[0x5c] = "UnmapDeviceAddressSpace";
+    table[0x5d] = "InvalidateProcessDataCache";
+    table[0x5e] = "StoreProcessDataCache";
+    table[0x5f] = "FlushProcessDataCache";
+    table[0x60] = "DebugActiveProcess";
+    table[0x61] = "BreakDebugProcess";
+    table[0x62] = "TerminateDebugProcess";
+    table[0x63] = "GetDebugEvent";
+    table[0x64] = "ContinueDebugEvent";
+    table[0x65] = "GetProcessList";
+    table[0x66] = "GetThreadList";
+    table[0x67] = "GetDebugThreadContext";
+    table[0x68] = "SetDebugThreadContext";
+    table[0x69] = "QueryDebugProcessMemory";
+    table[0x6a] = "ReadDebugProcessMemory";
+    table[0x6b] = "WriteDebugProcessMemory";
+    table[0x6c] = "SetHardwareBreakPoint";
+    table[0x6d] = "GetDebugThreadParam";
+    table[0x6f] = "GetSystemInfo";
+    table[0x70] = "CreatePort";
+    table[0x71] = "ManageNamedPort";
+    table[0x72] = "ConnectToPort";
+    table[0x73] = "SetProcessMemoryPermission";
+    table[0x74] = "MapProcessMemory";
+    table[0x75] = "UnmapProcessMemory";
+    table[0x76] = "QueryProcessMemory";
+    table[0x77] = "MapProcessCodeMemory";
+    table[0x78] = "UnmapProcessCodeMemory";
+    table[0x79] = "CreateProcess";
+    table[0x7a] = "StartProcess";
+    table[0x7b] = "TerminateProcess";
+    table[0x7c] = "GetProcessInfo";
+    table[0x7d] = "CreateResourceLimit";
+    table[0x7e] = "SetResourceLimitLimitValue";
+    table[0x7f] = "CallSecureMonitor";
+    table[0x90] = "MapInsecureMemory";
+    table[0x91] = "UnmapInsecureMemory";
+    return table;
+}();
+// clang-format on
+
+const char* GetSvcName(u32 imm) {
+    if (imm >= SvcNames.size() || SvcNames[imm] == nullptr) {
+        return "Unknown";
     }
+    return SvcNames[imm];
 }
 
-static void Call64(Core::System& system, u32 imm, std::span<uint64_t, 8> args) {
-    switch (static_cast<SvcId>(imm)) {
-    case SvcId::SetHeapSize:
-        return SvcWrap_SetHeapSize64(system, args);
-    case SvcId::SetMemoryPermission:
-        return SvcWrap_SetMemoryPermission64(system, args);
-    case SvcId::SetMemoryAttribute:
-        return SvcWrap_SetMemoryAttribute64(system, args);
-    case SvcId::MapMemory:
-        return SvcWrap_MapMemory64(system, args);
-    case SvcId::UnmapMemory:
-        return SvcWrap_UnmapMemory64(system, args);
-    case SvcId::QueryMemory:
-        return SvcWrap_QueryMemory64(system, args);
-    case SvcId::ExitProcess:
-        return SvcWrap_ExitProcess64(system, args);
-    case SvcId::CreateThread:
-        return SvcWrap_CreateThread64(system, args);
-    case SvcId::StartThread:
-        return SvcWrap_StartThread64(system, args);
-    case SvcId::ExitThread:
-        return SvcWrap_ExitThread64(system, args);
-    case SvcId::SleepThread:
-        return SvcWrap_SleepThread64(system, args);
-    case SvcId::GetThreadPriority:
-        return SvcWrap_GetThreadPriority64(system, args);
-    case SvcId::SetThreadPriority:
-        return SvcWrap_SetThreadPriority64(system, args);
-    case SvcId::GetThreadCoreMask:
-        return SvcWrap_GetThreadCoreMask64(system, args);
-    case SvcId::SetThreadCoreMask:
-        return SvcWrap_SetThreadCoreMask64(system, args);
-    case SvcId::GetCurrentProcessorNumber:
-        return SvcWrap_GetCurrentProcessorNumber64(system, args);
-    case SvcId::SignalEvent:
-        return SvcWrap_SignalEvent64(system, args);
-    case SvcId::ClearEvent:
-        return SvcWrap_ClearEvent64(system, args);
-    case SvcId::MapSharedMemory:
-        return SvcWrap_MapSharedMemory64(system, args);
-    case SvcId::UnmapSharedMemory:
-        return SvcWrap_UnmapSharedMemory64(system, args);
-    case SvcId::CreateTransferMemory:
-        return SvcWrap_CreateTransferMemory64(system, args);
-    case SvcId::CloseHandle:
-        return SvcWrap_CloseHandle64(system, args);
-    case SvcId::ResetSignal:
-        return SvcWrap_ResetSignal64(system, args);
-    case SvcId::WaitSynchronization:
-        return SvcWrap_WaitSynchronization64(system, args);
-    case SvcId::CancelSynchronization:
-        return SvcWrap_CancelSynchronization64(system, args);
-    case SvcId::ArbitrateLock:
-        return SvcWrap_ArbitrateLock64(system, args);
-    case SvcId::ArbitrateUnlock:
-        return SvcWrap_ArbitrateUnlock64(system, args);
-    case SvcId::WaitProcessWideKeyAtomic:
-        return SvcWrap_WaitProcessWideKeyAtomic64(system, args);
-    case SvcId::SignalProcessWideKey:
-        return SvcWrap_SignalProcessWideKey64(system, args);
-    case SvcId::GetSystemTick:
-        return SvcWrap_GetSystemTick64(system, args);
-    case SvcId::ConnectToNamedPort:
-        return SvcWrap_ConnectToNamedPort64(system, args);
-    case SvcId::SendSyncRequestLight:
-        return SvcWrap_SendSyncRequestLight64(system, args);
-    case SvcId::SendSyncRequest:
-        return SvcWrap_SendSyncRequest64(system, args);
-    case SvcId::SendSyncRequestWithUserBuffer:
-        return SvcWrap_SendSyncRequestWithUserBuffer64(system, args);
-    case SvcId::SendAsyncRequestWithUserBuffer:
-        return SvcWrap_SendAsyncRequestWithUserBuffer64(system, args);
-    case SvcId::GetProcessId:
-        return SvcWrap_GetProcessId64(system, args);
-    case SvcId::GetThreadId:
-        return SvcWrap_GetThreadId64(system, args);
-    case SvcId::Break:
-        return SvcWrap_Break64(system, args);
-    case SvcId::OutputDebugString:
-        return SvcWrap_OutputDebugString64(system, args);
-    case SvcId::ReturnFromException:
-        return SvcWrap_ReturnFromException64(system, args);
-    case SvcId::GetInfo:
-        return SvcWrap_GetInfo64(system, args);
-    case SvcId::FlushEntireDataCache:
-        return SvcWrap_FlushEntireDataCache64(system, args);
-    case SvcId::FlushDataCache:
-        return SvcWrap_FlushDataCache64(system, args);
-    case SvcId::MapPhysicalMemory:
-        return SvcWrap_MapPhysicalMemory64(system, args);
-    case SvcId::UnmapPhysicalMemory:
-        return SvcWrap_UnmapPhysicalMemory64(system, args);
-    case SvcId::GetDebugFutureThreadInfo:
-        return SvcWrap_GetDebugFutureThreadInfo64(system, args);
-    case SvcId::GetLastThreadInfo:
-        return SvcWrap_GetLastThreadInfo64(system, args);
-    case SvcId::GetResourceLimitLimitValue:
-        return SvcWrap_GetResourceLimitLimitValue64(system, args);
-    case SvcId::GetResourceLimitCurrentValue:
-        return SvcWrap_GetResourceLimitCurrentValue64(system, args);
-    case SvcId::SetThreadActivity:
-        return SvcWrap_SetThreadActivity64(system, args);
-    case SvcId::GetThreadContext3:
-        return SvcWrap_GetThreadContext364(system, args);
-    case SvcId::WaitForAddress:
-        return SvcWrap_WaitForAddress64(system, args);
-    case SvcId::SignalToAddress:
-        return SvcWrap_SignalToAddress64(system, args);
-    case SvcId::SynchronizePreemptionState:
-        return SvcWrap_SynchronizePreemptionState64(system, args);
-    case SvcId::GetResourceLimitPeakValue:
-        return SvcWrap_GetResourceLimitPeakValue64(system, args);
-    case SvcId::CreateIoPool:
-        return SvcWrap_CreateIoPool64(system, args);
-    case SvcId::CreateIoRegion:
-        return SvcWrap_CreateIoRegion64(system, args);
-    case SvcId::KernelDebug:
-        return SvcWrap_KernelDebug64(system, args);
-    case SvcId::ChangeKernelTraceState:
-        return SvcWrap_ChangeKernelTraceState64(system, args);
-    case SvcId::CreateSession:
-        return SvcWrap_CreateSession64(system, args);
-    case SvcId::AcceptSession:
-        return SvcWrap_AcceptSession64(system, args);
-    case SvcId::ReplyAndReceiveLight:
-        return SvcWrap_ReplyAndReceiveLight64(system, args);
-    case SvcId::ReplyAndReceive:
-        return SvcWrap_ReplyAndReceive64(system, args);
-    case SvcId::ReplyAndReceiveWithUserBuffer:
-        return SvcWrap_ReplyAndReceiveWithUserBuffer64(system, args);
-    case SvcId::CreateEvent:
-        return SvcWrap_CreateEvent64(system, args);
-    case SvcId::MapIoRegion:
-        return SvcWrap_MapIoRegion64(system, args);
-    case SvcId::UnmapIoRegion:
-        return SvcWrap_UnmapIoRegion64(system, args);
-    case SvcId::MapPhysicalMemoryUnsafe:
-        return SvcWrap_MapPhysicalMemoryUnsafe64(system, args);
-    case SvcId::UnmapPhysicalMemoryUnsafe:
-        return SvcWrap_UnmapPhysicalMemoryUnsafe64(system, args);
-    case SvcId::SetUnsafeLimit:
-        return SvcWrap_SetUnsafeLimit64(system, args);
-    case SvcId::CreateCodeMemory:
-        return SvcWrap_CreateCodeMemory64(system, args);
-    case SvcId::ControlCodeMemory:
-        return SvcWrap_ControlCodeMemory64(system, args);
-    case SvcId::SleepSystem:
-        return SvcWrap_SleepSystem64(system, args);
-    case SvcId::ReadWriteRegister:
-        return SvcWrap_ReadWriteRegister64(system, args);
-    case SvcId::SetProcessActivity:
-        return SvcWrap_SetProcessActivity64(system, args);
-    case SvcId::CreateSharedMemory:
-        return SvcWrap_CreateSharedMemory64(system, args);
-    case SvcId::MapTransferMemory:
-        return SvcWrap_MapTransferMemory64(system, args);
-    case SvcId::UnmapTransferMemory:
-        return SvcWrap_UnmapTransferMemory64(system, args);
-    case SvcId::CreateInterruptEvent:
-        return SvcWrap_CreateInterruptEvent64(system, args);
-    case SvcId::QueryPhysicalAddress:
-        return SvcWrap_QueryPhysicalAddress64(system, args);
-    case SvcId::QueryIoMapping:
-        return SvcWrap_QueryIoMapping64(system, args);
-    case SvcId::CreateDeviceAddressSpace:
-        return SvcWrap_CreateDeviceAddressSpace64(system, args);
-    case SvcId::AttachDeviceAddressSpace:
-        return SvcWrap_AttachDeviceAddressSpace64(system, args);
-    case SvcId::DetachDeviceAddressSpace:
-        return SvcWrap_DetachDeviceAddressSpace64(system, args);
-    case SvcId::MapDeviceAddressSpaceByForce:
-        return SvcWrap_MapDeviceAddressSpaceByForce64(system, args);
-    case SvcId::MapDeviceAddressSpaceAligned:
-        return SvcWrap_MapDeviceAddressSpaceAligned64(system, args);
-    case SvcId::UnmapDeviceAddressSpace:
-        return SvcWrap_UnmapDeviceAddressSpace64(system, args);
-    case SvcId::InvalidateProcessDataCache:
-        return SvcWrap_InvalidateProcessDataCache64(system, args);
-    case SvcId::StoreProcessDataCache:
-        return SvcWrap_StoreProcessDataCache64(system, args);
-    case SvcId::FlushProcessDataCache:
-        return SvcWrap_FlushProcessDataCache64(system, args);
-    case SvcId::DebugActiveProcess:
-        return SvcWrap_DebugActiveProcess64(system, args);
-    case SvcId::BreakDebugProcess:
-        return SvcWrap_BreakDebugProcess64(system, args);
-    case SvcId::TerminateDebugProcess:
-        return SvcWrap_TerminateDebugProcess64(system, args);
-    case SvcId::GetDebugEvent:
-        return SvcWrap_GetDebugEvent64(system, args);
-    case SvcId::ContinueDebugEvent:
-        return SvcWrap_ContinueDebugEvent64(system, args);
-    case SvcId::GetProcessList:
-        return SvcWrap_GetProcessList64(system, args);
-    case SvcId::GetThreadList:
-        return SvcWrap_GetThreadList64(system, args);
-    case SvcId::GetDebugThreadContext:
-        return SvcWrap_GetDebugThreadContext64(system, args);
-    case SvcId::SetDebugThreadContext:
-        return SvcWrap_SetDebugThreadContext64(system, args);
-    case SvcId::QueryDebugProcessMemory:
-        return SvcWrap_QueryDebugProcessMemory64(system, args);
-    case SvcId::ReadDebugProcessMemory:
-        return SvcWrap_ReadDebugProcessMemory64(system, args);
-    case SvcId::WriteDebugProcessMemory:
-        return SvcWrap_WriteDebugProcessMemory64(system, args);
-    case SvcId::SetHardwareBreakPoint:
-        return SvcWrap_SetHardwareBreakPoint64(system, args);
-    case SvcId::GetDebugThreadParam:
-        return SvcWrap_GetDebugThreadParam64(system, args);
-    case SvcId::GetSystemInfo:
-        return SvcWrap_GetSystemInfo64(system, args);
-    case SvcId::CreatePort:
-        return SvcWrap_CreatePort64(system, args);
-    case SvcId::ManageNamedPort:
-        return SvcWrap_ManageNamedPort64(system, args);
-    case SvcId::ConnectToPort:
-        return SvcWrap_ConnectToPort64(system, args);
-    case SvcId::SetProcessMemoryPermission:
-        return SvcWrap_SetProcessMemoryPermission64(system, args);
-    case SvcId::MapProcessMemory:
-        return SvcWrap_MapProcessMemory64(system, args);
-    case SvcId::UnmapProcessMemory:
-        return SvcWrap_UnmapProcessMemory64(system, args);
-    case SvcId::QueryProcessMemory:
-        return SvcWrap_QueryProcessMemory64(system, args);
-    case SvcId::MapProcessCodeMemory:
-        return SvcWrap_MapProcessCodeMemory64(system, args);
-    case SvcId::UnmapProcessCodeMemory:
-        return SvcWrap_UnmapProcessCodeMemory64(system, args);
-    case SvcId::CreateProcess:
-        return SvcWrap_CreateProcess64(system, args);
-    case SvcId::StartProcess:
-        return SvcWrap_StartProcess64(system, args);
-    case SvcId::TerminateProcess:
-        return SvcWrap_TerminateProcess64(system, args);
-    case SvcId::GetProcessInfo:
-        return SvcWrap_GetProcessInfo64(system, args);
-    case SvcId::CreateResourceLimit:
-        return SvcWrap_CreateResourceLimit64(system, args);
-    case SvcId::SetResourceLimitLimitValue:
-        return SvcWrap_SetResourceLimitLimitValue64(system, args);
-    case SvcId::CallSecureMonitor:
-        return SvcWrap_CallSecureMonitor64(system, args);
-    case SvcId::MapInsecureMemory:
-        return SvcWrap_MapInsecureMemory64(system, args);
-    case SvcId::UnmapInsecureMemory:
-        return SvcWrap_UnmapInsecureMemory64(system, args);
-    default:
+static void Dispatch(Core::System& system, bool is_64bit, u32 imm, std::span<uint64_t, 8> args) {
+    const auto& table = is_64bit ? SvcTable64 : SvcTable32;
+    if (imm >= table.size() || table[imm] == nullptr) [[unlikely]] {
         LOG_CRITICAL(Kernel_SVC, "Unknown SVC {:x}!", imm);
-        break;
+        return;
     }
+    table[imm](system, args);
 }
-// clang-format on
 
 void Call(Core::System& system, u32 imm) {
     auto& kernel = system.Kernel();
@@ -4430,10 +4329,24 @@ void Call(Core::System& system, u32 imm) {
     kernel.CurrentPhysicalCore().SaveSvcArguments(process, args);
     kernel.EnterSVCProfile();
 
-    if (process.Is64Bit()) {
-        Call64(system, imm, args);
+    KTraceRecorder* const trace = kernel.GetTraceRecorder();
+    if (trace) [[unlikely]] {
+        trace->Record(kernel.GetCurrentHostThreadID(), KTraceEventType::SvcEnter,
+                      GetCurrentThread(kernel).GetThreadId(), imm);
+    }
+
+    if (SvcStatistics* const statistics = kernel.GetSvcStatistics(); statistics) [[unlikely]] {
+        const u64 thread_id = GetCurrentThread(kernel).GetThreadId();
+        const auto start = std::chrono::steady_clock::now();
+        Dispatch(system, process.Is64Bit(), imm, args);
+        statistics->Record(imm, thread_id, std::chrono::steady_clock::now() - start);
     } else {
-        Call32(system, imm, args);
+        Dispatch(system, process.Is64Bit(), imm, args);
+    }
+
+    if (trace) [[unlikely]] {
+        trace->Record(kernel.GetCurrentHostThreadID(), KTraceEventType::SvcExit,
+                      GetCurrentThread(kernel).GetThreadId(), imm);
     }
 
     kernel.ExitSVCProfile();
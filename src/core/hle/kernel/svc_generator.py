@@ -539,16 +539,24 @@ void SvcWrap_CallSecureMonitor64(Core::System& system, std::span<uint64_t, 8> ar
 // Perform a supervisor call by index.
 void Call(Core::System& system, u32 imm);
 
+// Get the name of a supervisor call by index, or "Unknown".
+const char* GetSvcName(u32 imm);
+
 } // namespace Kernel::Svc
 """
 
 PROLOGUE_CPP = """
+#include <array>
+#include <chrono>
 #include <type_traits>
 
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/k_thread.h"
+#include "core/hle/kernel/k_trace_recorder.h"
 #include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_statistics.h"
 
 namespace Kernel::Svc {
 
@@ -590,6 +598,22 @@ static To Convert(const From& from) {
 EPILOGUE_CPP = """
 // clang-format on
 
+const char* GetSvcName(u32 imm) {
+    if (imm >= SvcNames.size() || SvcNames[imm] == nullptr) {
+        return "Unknown";
+    }
+    return SvcNames[imm];
+}
+
+static void Dispatch(Core::System& system, bool is_64bit, u32 imm, std::span<uint64_t, 8> args) {
+    const auto& table = is_64bit ? SvcTable64 : SvcTable32;
+    if (imm >= table.size() || table[imm] == nullptr) [[unlikely]] {
+        LOG_CRITICAL(Kernel_SVC, "Unknown SVC {:x}!", imm);
+        return;
+    }
+    table[imm](system, args);
+}
+
 void Call(Core::System& system, u32 imm) {
     auto& kernel = system.Kernel();
     auto& process = GetCurrentProcess(kernel);
@@ -598,10 +622,24 @@ void Call(Core::System& system, u32 imm) {
     kernel.CurrentPhysicalCore().SaveSvcArguments(process, args);
     kernel.EnterSVCProfile();
 
-    if (process.Is64Bit()) {
-        Call64(system, imm, args);
+    KTraceRecorder* const trace = kernel.GetTraceRecorder();
+    if (trace) [[unlikely]] {
+        trace->Record(kernel.GetCurrentHostThreadID(), KTraceEventType::SvcEnter,
+                      GetCurrentThread(kernel).GetThreadId(), imm);
+    }
+
+    if (SvcStatistics* const statistics = kernel.GetSvcStatistics(); statistics) [[unlikely]] {
+        const u64 thread_id = GetCurrentThread(kernel).GetThreadId();
+        const auto start = std::chrono::steady_clock::now();
+        Dispatch(system, process.Is64Bit(), imm, args);
+        statistics->Record(imm, thread_id, std::chrono::steady_clock::now() - start);
     } else {
-        Call32(system, imm, args);
+        Dispatch(system, process.Is64Bit(), imm, args);
+    }
+
+    if (trace) [[unlikely]] {
+        trace->Record(kernel.GetCurrentHostThreadID(), KTraceEventType::SvcExit,
+                      GetCurrentThread(kernel).GetThreadId(), imm);
     }
 
     kernel.ExitSVCProfile();
@@ -612,24 +650,35 @@ void Call(Core::System& system, u32 imm) {
 """
 
 
-def emit_call(bitness, names, suffix):
+def emit_table(bitness, names, suffix):
     bit_size = REG_SIZES[bitness]*8
     indent = "    "
     lines = [
-        f"static void Call{bit_size}(Core::System& system, u32 imm, std::span<uint64_t, 8> args) {{",
-        f"{indent}switch (static_cast<SvcId>(imm)) {{"
+        f"static constexpr auto SvcTable{bit_size} = [] {{",
+        f"{indent}std::array<SvcHandler, NumSupervisorCalls> table{{}};"
     ]
 
-    for _, name in names:
-        lines.append(f"{indent}case SvcId::{name}:")
-        lines.append(f"{indent*2}return SvcWrap_{name}{suffix}(system, args);")
+    for imm, name in names:
+        lines.append(f"{indent}table[{imm:#04x}] = SvcWrap_{name}{suffix};")
 
-    lines.append(f"{indent}default:")
-    lines.append(
-        f"{indent*2}LOG_CRITICAL(Kernel_SVC, \"Unknown SVC {{:x}}!\", imm);")
-    lines.append(f"{indent*2}break;")
-    lines.append(f"{indent}}}")
-    lines.append("}")
+    lines.append(f"{indent}return table;")
+    lines.append("}();")
+
+    return "\n".join(lines)
+
+
+def emit_names(names):
+    indent = "    "
+    lines = [
+        "static constexpr auto SvcNames = [] {",
+        f"{indent}std::array<const char*, NumSupervisorCalls> table{{}};"
+    ]
+
+    for imm, name in names:
+        lines.append(f"{indent}table[{imm:#04x}] = \"{name}\";")
+
+    lines.append(f"{indent}return table;")
+    lines.append("}();")
 
     return "\n".join(lines)
 
@@ -688,8 +737,9 @@ def main():
             arch_fw_declarations[bitness].append(
                 build_fn_declaration(return_type, name + suffix, arguments))
 
-    call_32 = emit_call(BIT_32, names, SUFFIX_NAMES[BIT_32])
-    call_64 = emit_call(BIT_64, names, SUFFIX_NAMES[BIT_64])
+    table_32 = emit_table(BIT_32, names, SUFFIX_NAMES[BIT_32])
+    table_64 = emit_table(BIT_64, names, SUFFIX_NAMES[BIT_64])
+    svc_names = emit_names(names)
     enum_decls = build_enum_declarations()
 
     with open("svc.h", "w") as f:
@@ -711,9 +761,13 @@ def main():
         f.write("\n\n")
         f.write("\n\n".join(wrapper_fns))
         f.write("\n\n")
-        f.write(call_32)
+        f.write("using SvcHandler = void (*)(Core::System&, std::span<uint64_t, 8>);")
+        f.write("\n\n")
+        f.write(table_32)
+        f.write("\n\n")
+        f.write(table_64)
         f.write("\n\n")
-        f.write(call_64)
+        f.write(svc_names)
         f.write(EPILOGUE_CPP)
 
     print(f"Done (emitted {len(names)} definitions)")
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/logging/log.h"
+#include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_statistics.h"
+
+namespace Kernel::Svc {
+namespace {
+/// Number of threads logged, sorted by the time spent in supervisor calls
+constexpr size_t NumLoggedThreads = 16;
+
+/// Number of calls logged for every thread
+constexpr size_t NumLoggedThreadCalls = 3;
+
+size_t HistogramBucket(u64 ns) {
+    return std::min<size_t>(std::bit_width(ns >> 10), SvcStatistics::NumHistogramBuckets - 1);
+}
+
+std::string BucketName(size_t bucket) {
+    if (bucket == SvcStatistics::NumHistogramBuckets - 1) {
+        return fmt::format(">={}ms", (1ULL << (bucket - 1)) / 1000);
+    }
+    return fmt::format("<{}us", 1ULL << bucket);
+}
+
+double ToMilliseconds(u64 ns) {
+    return static_cast<double>(ns) / 1'000'000.0;
+}
+
+double ToMicroseconds(u64 ns) {
+    return static_cast<double>(ns) / 1'000.0;
+}
+
+double Percent(u64 value, u64 total) {
+    return total == 0 ? 0.0 : static_cast<double>(value) * 100.0 / static_cast<double>(total);
+}
+} // Anonymous namespace
+
+SvcStatistics::SvcStatistics() : start_time{std::chrono::steady_clock::now()} {}
+
+SvcStatistics::~SvcStatistics() = default;
+
+void SvcStatistics::Record(u32 imm, u64 thread_id, std::chrono::nanoseconds time) {
+    if (imm >= NumSupervisorCalls) {
+        return;
+    }
+    const u64 ns = static_cast<u64>(std::max<s64>(time.count(), 0));
+
+    std::scoped_lock lk{mutex};
+    CallEntry& call = calls[imm];
+    ++call.count;
+    call.total_ns += ns;
+    call.max_ns = std::max(call.max_ns, ns);
+    ++call.histogram[HistogramBucket(ns)];
+
+    ThreadEntry& thread = threads[thread_id];
+    ++thread.count;
+    thread.total_ns += ns;
+    thread.call_ns[imm] += ns;
+}
+
+void SvcStatistics::Log() const {
+    std::scoped_lock lk{mutex};
+
+    const auto elapsed = std::chrono::steady_clock::now() - start_time;
+    u64 total_count = 0;
+    u64 total_ns = 0;
+    for (const CallEntry& call : calls) {
+        total_count += call.count;
+        total_ns += call.total_ns;
+    }
+    LOG_INFO(Kernel_SVC, "Supervisor calls over {:.1f}s: {} calls taking {:.2f}ms",
+             std::chrono::duration<double>(elapsed).count(), total_count,
+             ToMilliseconds(total_ns));
+
+    std::array<u32, NumSupervisorCalls> order;
+    std::iota(order.begin(), order.end(), 0U);
+    std::ranges::sort(order, std::greater{}, [&](u32 imm) { return calls[imm].total_ns; });
+    for (const u32 imm : order) {
+        const CallEntry& call = calls[imm];
+        if (call.count == 0) {
+            break;
+        }
+        std::string histogram;
+        for (size_t bucket = 0; bucket < NumHistogramBuckets; ++bucket) {
+            if (call.histogram[bucket] != 0) {
+                fmt::format_to(std::back_inserter(histogram), " {}:{}", BucketName(bucket),
+                               call.histogram[bucket]);
+            }
+        }
+        LOG_INFO(Kernel_SVC,
+                 "{:<32} {:>9} calls {:>10.2f}ms {:>5.1f}% avg {:>9.2f}us max {:>9.2f}us |{}",
+                 GetSvcName(imm), call.count, ToMilliseconds(call.total_ns),
+                 Percent(call.total_ns, total_ns), ToMicroseconds(call.total_ns / call.count),
+                 ToMicroseconds(call.max_ns), histogram);
+    }
+
+    std::vector<std::pair<u64, const ThreadEntry*>> sorted_threads;
+    sorted_threads.reserve(threads.size());
+    for (const auto& [thread_id, thread] : threads) {
+        sorted_threads.emplace_back(thread_id, &thread);
+    }
+    const size_t num_threads = std::min(sorted_threads.size(), NumLoggedThreads);
+    std::ranges::partial_sort(sorted_threads, sorted_threads.begin() + num_threads, std::greater{},
+                              [](const auto& pair) { return pair.second->total_ns; });
+    for (size_t index = 0; index < num_threads; ++index) {
+        // Not a structured binding, some compilers can't capture those in lambdas
+        const u64 thread_id = sorted_threads[index].first;
+        const ThreadEntry* const thread = sorted_threads[index].second;
+        std::array<u32, NumSupervisorCalls> thread_order;
+        std::iota(thread_order.begin(), thread_order.end(), 0U);
+        std::ranges::partial_sort(thread_order, thread_order.begin() + NumLoggedThreadCalls,
+                                  std::greater{}, [&](u32 imm) { return thread->call_ns[imm]; });
+        std::string top_calls;
+        for (size_t call = 0; call < NumLoggedThreadCalls; ++call) {
+            const u32 imm = thread_order[call];
+            if (thread->call_ns[imm] == 0) {
+                break;
+            }
+            fmt::format_to(std::back_inserter(top_calls), " {} {:.1f}%", GetSvcName(imm),
+                           Percent(thread->call_ns[imm], thread->total_ns));
+        }
+        LOG_INFO(Kernel_SVC, "Thread {:<6} {:>9} calls {:>10.2f}ms |{}", thread_id, thread->count,
+                 ToMilliseconds(thread->total_ns), top_calls);
+    }
+}
+
+} // namespace Kernel::Svc
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/common_types.h"
+#include "core/hle/kernel/svc_types.h"
+
+namespace Kernel::Svc {
+
+/**
+ * Call counts and host time of every supervisor call, per call and per calling thread.
+ * Time is measured from entering to leaving the call, so it includes the time a thread spends
+ * blocked in calls like WaitSynchronization.
+ */
+class SvcStatistics {
+public:
+    /// Power of two buckets of the time of a call, from under 1us to over 16ms
+    static constexpr size_t NumHistogramBuckets = 16;
+
+    struct CallEntry {
+        u64 count{};
+        u64 total_ns{};
+        u64 max_ns{};
+        std::array<u64, NumHistogramBuckets> histogram{};
+    };
+
+    struct ThreadEntry {
+        u64 count{};
+        u64 total_ns{};
+        std::array<u64, NumSupervisorCalls> call_ns{};
+    };
+
+    explicit SvcStatistics();
+    ~SvcStatistics();
+
+    /// Records a finished supervisor call
+    void Record(u32 imm, u64 thread_id, std::chrono::nanoseconds time);
+
+    /// Logs the calls sorted by total time, followed by the threads spending the most time in
+    /// supervisor calls
+    void Log() const;
+
+private:
+    mutable std::mutex mutex;
+    std::array<CallEntry, NumSupervisorCalls> calls{};
+    std::unordered_map<u64, ThreadEntry> threads;
+    std::chrono::steady_clock::time_point start_time;
+};
+
+} // namespace Kernel::Svc
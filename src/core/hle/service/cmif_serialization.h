@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <array>
+#include <optional>
+#include <utility>
+
 #include "common/div_ceil.h"
 
 #include "core/hle/service/cmif_types.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/service.h"
+#include "core/memory.h"
 
 namespace Service {
 
@@ -127,66 +132,101 @@ struct RequestLayout {
     u32 domain_interface_count;
 };
 
-template <typename MethodArguments, size_t PrevAlign = 1, size_t DataOffset = 0, size_t ArgIndex = 0>
-constexpr u32 GetInRawDataSize() {
-    if constexpr (ArgIndex >= std::tuple_size_v<MethodArguments>) {
-        return static_cast<u32>(DataOffset);
-    } else {
-        using ArgType = std::tuple_element_t<ArgIndex, MethodArguments>;
+struct ArgumentLayout {
+    ArgumentType type;
+    // Offset in the raw data of the request or the reply
+    u32 raw_data_offset;
+    // Index of the copy handle, input buffer or output buffer
+    u32 index;
+    bool is_aligned;
+    bool follows_interface;
+};
 
-        if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::InData || ArgumentTraits<ArgType>::Type == ArgumentType::InProcessId) {
-            constexpr size_t ArgAlign = alignof(ArgType);
-            constexpr size_t ArgSize = sizeof(ArgType);
+template <size_t NumArguments>
+struct MethodLayout {
+    std::array<ArgumentLayout, NumArguments> arguments;
+    u32 in_raw_data_size;
+    u32 out_raw_data_size;
+};
 
-            static_assert(PrevAlign <= ArgAlign, "Input argument is not ordered by alignment");
+template <typename MethodArguments>
+consteval auto BuildMethodLayout() {
+    MethodLayout<std::tuple_size_v<MethodArguments>> layout{};
+    size_t in_offset = 0;
+    size_t in_align = 1;
+    bool in_interface_seen = false;
+    size_t out_offset = 0;
+    size_t out_align = 1;
+    bool out_interface_seen = false;
+    u32 handle_index = 0;
+    u32 in_buffer_index = 0;
+    u32 out_buffer_index = 0;
+
+    const auto place_raw_data = [](ArgumentLayout& arg, size_t& offset, size_t& prev_align, size_t align, size_t size) {
+        arg.is_aligned = prev_align <= align;
+        arg.raw_data_offset = static_cast<u32>(Common::AlignUp(offset, align));
+        offset = arg.raw_data_offset + size;
+        prev_align = align;
+    };
 
-            constexpr size_t ArgOffset = Common::AlignUp(DataOffset, ArgAlign);
-            constexpr size_t ArgEnd = ArgOffset + ArgSize;
+    [&]<size_t... ArgIndex>(std::index_sequence<ArgIndex...>) {
+        ([&] {
+            using ArgType = std::tuple_element_t<ArgIndex, MethodArguments>;
+            constexpr ArgumentType Type = ArgumentTraits<ArgType>::Type;
+
+            ArgumentLayout& arg = layout.arguments[ArgIndex];
+            arg.type = Type;
+            arg.is_aligned = true;
+
+            if constexpr (Type == ArgumentType::InData || Type == ArgumentType::InProcessId) {
+                arg.follows_interface = in_interface_seen;
+                place_raw_data(arg, in_offset, in_align, alignof(ArgType), sizeof(ArgType));
+                layout.in_raw_data_size = static_cast<u32>(in_offset);
+            } else if constexpr (Type == ArgumentType::InInterface) {
+                // Domain object ids follow the raw data, they don't count towards its size
+                place_raw_data(arg, in_offset, in_align, alignof(u32), sizeof(u32));
+                in_interface_seen = true;
+            } else if constexpr (Type == ArgumentType::InCopyHandle) {
+                arg.index = handle_index++;
+            } else if constexpr (Type == ArgumentType::InBuffer || Type == ArgumentType::InLargeData) {
+                arg.index = in_buffer_index++;
+            } else if constexpr (Type == ArgumentType::OutData) {
+                using RawArgType = typename ArgType::Type;
+                arg.follows_interface = out_interface_seen;
+                place_raw_data(arg, out_offset, out_align, alignof(RawArgType), sizeof(RawArgType));
+                layout.out_raw_data_size = static_cast<u32>(out_offset);
+            } else if constexpr (Type == ArgumentType::OutInterface) {
+                out_interface_seen = true;
+            } else if constexpr (Type == ArgumentType::OutBuffer || Type == ArgumentType::OutLargeData) {
+                arg.index = out_buffer_index++;
+            }
+        }(), ...);
+    }(std::make_index_sequence<std::tuple_size_v<MethodArguments>>{});
 
-            return GetInRawDataSize<MethodArguments, ArgAlign, ArgEnd, ArgIndex + 1>();
-        } else {
-            return GetInRawDataSize<MethodArguments, PrevAlign, DataOffset, ArgIndex + 1>();
-        }
-    }
+    return layout;
 }
 
-template <typename MethodArguments, size_t PrevAlign = 1, size_t DataOffset = 0, size_t ArgIndex = 0>
-constexpr u32 GetOutRawDataSize() {
-    if constexpr (ArgIndex >= std::tuple_size_v<MethodArguments>) {
-        return static_cast<u32>(DataOffset);
-    } else {
-        using ArgType = std::tuple_element_t<ArgIndex, MethodArguments>;
-
-        if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutData) {
-            using RawArgType = typename ArgType::Type;
-            constexpr size_t ArgAlign = alignof(RawArgType);
-            constexpr size_t ArgSize = sizeof(RawArgType);
-
-            static_assert(PrevAlign <= ArgAlign, "Output argument is not ordered by alignment");
+// Raw data offsets, buffer indices and handle indices of every argument of a method
+template <typename MethodArguments>
+constexpr auto MethodArgumentLayout = BuildMethodLayout<MethodArguments>();
 
-            constexpr size_t ArgOffset = Common::AlignUp(DataOffset, ArgAlign);
-            constexpr size_t ArgEnd = ArgOffset + ArgSize;
+template <typename MethodArguments>
+constexpr u32 GetInRawDataSize() {
+    return MethodArgumentLayout<MethodArguments>.in_raw_data_size;
+}
 
-            return GetOutRawDataSize<MethodArguments, ArgAlign, ArgEnd, ArgIndex + 1>();
-        } else {
-            return GetOutRawDataSize<MethodArguments, PrevAlign, DataOffset, ArgIndex + 1>();
-        }
-    }
+template <typename MethodArguments>
+constexpr u32 GetOutRawDataSize() {
+    return MethodArgumentLayout<MethodArguments>.out_raw_data_size;
 }
 
-template <ArgumentType DataType, typename MethodArguments, size_t ArgCount = 0, size_t ArgIndex = 0>
+template <ArgumentType DataType, typename MethodArguments>
 constexpr u32 GetArgumentTypeCount() {
-    if constexpr (ArgIndex >= std::tuple_size_v<MethodArguments>) {
-        return static_cast<u32>(ArgCount);
-    } else {
-        using ArgType = std::tuple_element_t<ArgIndex, MethodArguments>;
-
-        if constexpr (ArgumentTraits<ArgType>::Type == DataType) {
-            return GetArgumentTypeCount<DataType, MethodArguments, ArgCount + 1, ArgIndex + 1>();
-        } else {
-            return GetArgumentTypeCount<DataType, MethodArguments, ArgCount, ArgIndex + 1>();
-        }
+    u32 count = 0;
+    for (const ArgumentLayout& arg : MethodArgumentLayout<MethodArguments>.arguments) {
+        count += arg.type == DataType ? 1 : 0;
     }
+    return count;
 }
 
 template <typename MethodArguments>
@@ -239,199 +279,157 @@ constexpr RequestLayout GetReplyOutLayout(bool is_domain) {
     return is_domain ? GetDomainReplyOutLayout<MethodArguments>() : GetNonDomainReplyOutLayout<MethodArguments>();
 }
 
-using OutTemporaryBuffers = std::array<Common::ScratchBuffer<u8>, 3>;
+struct OutTemporaryBuffers {
+    // Output buffers are written in place, through the backups when not contiguous on the host
+    std::array<Common::ScratchBuffer<u8>, 3> backups;
+    std::array<std::optional<HLERequestContext::WriteBufferMemory>, 3> views;
+};
 
-template <typename MethodArguments, typename CallArguments, size_t PrevAlign = 1, size_t DataOffset = 0, size_t HandleIndex = 0, size_t InBufferIndex = 0, size_t OutBufferIndex = 0, bool RawDataFinished = false, size_t ArgIndex = 0>
+template <typename MethodArguments, size_t ArgIndex, typename CallArguments>
 void ReadInArgument(bool is_domain, CallArguments& args, const u8* raw_data, HLERequestContext& ctx, OutTemporaryBuffers& temp) {
-    if constexpr (ArgIndex >= std::tuple_size_v<CallArguments>) {
-        return;
-    } else {
-        using ArgType = std::tuple_element_t<ArgIndex, MethodArguments>;
-
-        if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::InData || ArgumentTraits<ArgType>::Type == ArgumentType::InProcessId) {
-            constexpr size_t ArgAlign = alignof(ArgType);
-            constexpr size_t ArgSize = sizeof(ArgType);
-
-            static_assert(PrevAlign <= ArgAlign, "Input argument is not ordered by alignment");
-            static_assert(!RawDataFinished, "All input interface arguments must appear after raw data");
-            static_assert(!std::is_pointer_v<ArgType>, "Input raw data must not be a pointer");
-            static_assert(std::is_trivially_copyable_v<ArgType>, "Input raw data must be trivially copyable");
-
-            constexpr size_t ArgOffset = Common::AlignUp(DataOffset, ArgAlign);
-            constexpr size_t ArgEnd = ArgOffset + ArgSize;
-
-            if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::InProcessId) {
-                // TODO: abort parsing if PID is not provided?
-                // TODO: validate against raw data value?
-                std::get<ArgIndex>(args).pid = ctx.GetPID();
-            } else {
-                std::memcpy(&std::get<ArgIndex>(args), raw_data + ArgOffset, ArgSize);
-            }
-
-            return ReadInArgument<MethodArguments, CallArguments, ArgAlign, ArgEnd, HandleIndex, InBufferIndex, OutBufferIndex, false, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::InInterface) {
-            constexpr size_t ArgAlign = alignof(u32);
-            constexpr size_t ArgSize = sizeof(u32);
-            constexpr size_t ArgOffset = Common::AlignUp(DataOffset, ArgAlign);
-            constexpr size_t ArgEnd = ArgOffset + ArgSize;
-
-            ASSERT(is_domain);
-            ASSERT(ctx.GetDomainMessageHeader().input_object_count > 0);
-
-            u32 value{};
-            std::memcpy(&value, raw_data + ArgOffset, ArgSize);
-            std::get<ArgIndex>(args) = ctx.GetDomainHandler<typename ArgType::element_type>(value - 1);
-
-            return ReadInArgument<MethodArguments, CallArguments, ArgAlign, ArgEnd, HandleIndex, InBufferIndex, OutBufferIndex, true, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::InCopyHandle) {
-            std::get<ArgIndex>(args) = ctx.GetObjectFromHandle<typename ArgType::Type>(ctx.GetCopyHandle(HandleIndex)).GetPointerUnsafe();
-
-            return ReadInArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, HandleIndex + 1, InBufferIndex, OutBufferIndex, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::InLargeData) {
-            constexpr size_t BufferSize = sizeof(typename ArgType::Type);
+    using ArgType = std::tuple_element_t<ArgIndex, MethodArguments>;
+    constexpr ArgumentLayout Layout = MethodArgumentLayout<MethodArguments>.arguments[ArgIndex];
+
+    if constexpr (Layout.type == ArgumentType::InData || Layout.type == ArgumentType::InProcessId) {
+        static_assert(Layout.is_aligned, "Input argument is not ordered by alignment");
+        static_assert(!Layout.follows_interface, "All input interface arguments must appear after raw data");
+        static_assert(!std::is_pointer_v<ArgType>, "Input raw data must not be a pointer");
+        static_assert(std::is_trivially_copyable_v<ArgType>, "Input raw data must be trivially copyable");
+
+        if constexpr (Layout.type == ArgumentType::InProcessId) {
+            // TODO: abort parsing if PID is not provided?
+            // TODO: validate against raw data value?
+            std::get<ArgIndex>(args).pid = ctx.GetPID();
+        } else {
+            std::memcpy(&std::get<ArgIndex>(args), raw_data + Layout.raw_data_offset, sizeof(ArgType));
+        }
+    } else if constexpr (Layout.type == ArgumentType::InInterface) {
+        ASSERT(is_domain);
+        ASSERT(ctx.GetDomainMessageHeader().input_object_count > 0);
+
+        u32 value{};
+        std::memcpy(&value, raw_data + Layout.raw_data_offset, sizeof(u32));
+        std::get<ArgIndex>(args) = ctx.GetDomainHandler<typename ArgType::element_type>(value - 1);
+    } else if constexpr (Layout.type == ArgumentType::InCopyHandle) {
+        std::get<ArgIndex>(args) = ctx.GetObjectFromHandle<typename ArgType::Type>(ctx.GetCopyHandle(Layout.index)).GetPointerUnsafe();
+    } else if constexpr (Layout.type == ArgumentType::InLargeData) {
+        constexpr size_t BufferSize = sizeof(typename ArgType::Type);
+
+        // Clear the existing data.
+        std::memset(&std::get<ArgIndex>(args), 0, BufferSize);
+
+        std::span<const u8> buffer{};
+
+        ASSERT(ctx.CanReadBuffer(Layout.index));
+        if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
+            buffer = ctx.ReadBuffer(Layout.index);
+        } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
+            buffer = ctx.ReadBufferA(Layout.index);
+        } else /* if (ArgType::Attr & BufferAttr_HipcPointer) */ {
+            buffer = ctx.ReadBufferX(Layout.index);
+        }
 
-            // Clear the existing data.
-            std::memset(&std::get<ArgIndex>(args), 0, BufferSize);
+        std::memcpy(&std::get<ArgIndex>(args), buffer.data(), std::min(BufferSize, buffer.size()));
+    } else if constexpr (Layout.type == ArgumentType::InBuffer) {
+        using ElementType = typename ArgType::Type;
 
-            std::span<const u8> buffer{};
+        std::span<const u8> buffer{};
 
-            ASSERT(ctx.CanReadBuffer(InBufferIndex));
+        if (ctx.CanReadBuffer(Layout.index)) {
             if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
-                buffer = ctx.ReadBuffer(InBufferIndex);
+                buffer = ctx.ReadBuffer(Layout.index);
             } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
-                buffer = ctx.ReadBufferA(InBufferIndex);
+                buffer = ctx.ReadBufferA(Layout.index);
             } else /* if (ArgType::Attr & BufferAttr_HipcPointer) */ {
-                buffer = ctx.ReadBufferX(InBufferIndex);
-            }
-
-            std::memcpy(&std::get<ArgIndex>(args), buffer.data(), std::min(BufferSize, buffer.size()));
-
-            return ReadInArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, HandleIndex, InBufferIndex + 1, OutBufferIndex, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::InBuffer) {
-            using ElementType = typename ArgType::Type;
-
-            std::span<const u8> buffer{};
-
-            if (ctx.CanReadBuffer(InBufferIndex)) {
-                if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
-                    buffer = ctx.ReadBuffer(InBufferIndex);
-                } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
-                    buffer = ctx.ReadBufferA(InBufferIndex);
-                } else /* if (ArgType::Attr & BufferAttr_HipcPointer) */ {
-                    buffer = ctx.ReadBufferX(InBufferIndex);
-                }
-            }
-
-            ElementType* ptr = (ElementType*) buffer.data();
-            size_t size = buffer.size() / sizeof(ElementType);
-
-            std::get<ArgIndex>(args) = std::span(ptr, size);
-
-            return ReadInArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, HandleIndex, InBufferIndex + 1, OutBufferIndex, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutLargeData) {
-            constexpr size_t BufferSize = sizeof(typename ArgType::Type);
-
-            // Clear the existing data.
-            std::memset(&std::get<ArgIndex>(args).raw, 0, BufferSize);
-
-            return ReadInArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, HandleIndex, InBufferIndex, OutBufferIndex + 1, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
-            using ElementType = typename ArgType::Type;
-
-            // Set up scratch buffer.
-            auto& buffer = temp[OutBufferIndex];
-            if (ctx.CanWriteBuffer(OutBufferIndex)) {
-                buffer.resize_destructive(ctx.GetWriteBufferSize(OutBufferIndex));
-            } else {
-                buffer.resize_destructive(0);
+                buffer = ctx.ReadBufferX(Layout.index);
             }
+        }
 
-            ElementType* ptr = (ElementType*) buffer.data();
-            size_t size = buffer.size() / sizeof(ElementType);
+        ElementType* ptr = (ElementType*) buffer.data();
+        size_t size = buffer.size() / sizeof(ElementType);
+
+        std::get<ArgIndex>(args) = std::span(ptr, size);
+    } else if constexpr (Layout.type == ArgumentType::OutLargeData) {
+        constexpr size_t BufferSize = sizeof(typename ArgType::Type);
+
+        // Clear the existing data.
+        std::memset(&std::get<ArgIndex>(args).raw, 0, BufferSize);
+    } else if constexpr (Layout.type == ArgumentType::OutBuffer) {
+        using ElementType = typename ArgType::Type;
+
+        auto* const backup = &temp.backups[Layout.index];
+        auto& view = temp.views[Layout.index];
+        if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
+            view.emplace(ctx.GetWriteBuffer(Layout.index, backup));
+        } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
+            view.emplace(ctx.GetWriteBufferB(Layout.index, backup));
+        } else /* if (ArgType::Attr & BufferAttr_HipcPointer) */ {
+            view.emplace(ctx.GetWriteBufferC(Layout.index, backup));
+        }
 
-            std::get<ArgIndex>(args) = std::span(ptr, size);
+        ElementType* ptr = (ElementType*) view->data();
+        size_t size = view->size() / sizeof(ElementType);
 
-            return ReadInArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, HandleIndex, InBufferIndex, OutBufferIndex + 1, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else {
-            return ReadInArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, HandleIndex, InBufferIndex, OutBufferIndex, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        }
+        std::get<ArgIndex>(args) = std::span(ptr, size);
     }
 }
 
-template <typename MethodArguments, typename CallArguments, size_t PrevAlign = 1, size_t DataOffset = 0, size_t OutBufferIndex = 0, bool RawDataFinished = false, size_t ArgIndex = 0>
-void WriteOutArgument(bool is_domain, CallArguments& args, u8* raw_data, HLERequestContext& ctx, OutTemporaryBuffers& temp) {
-    if constexpr (ArgIndex >= std::tuple_size_v<CallArguments>) {
-        return;
-    } else {
-        using ArgType = std::tuple_element_t<ArgIndex, MethodArguments>;
-
-        if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutData) {
-            using RawArgType = decltype(std::get<ArgIndex>(args).raw);
-            constexpr size_t ArgAlign = alignof(RawArgType);
-            constexpr size_t ArgSize = sizeof(RawArgType);
-
-            static_assert(PrevAlign <= ArgAlign, "Output argument is not ordered by alignment");
-            static_assert(!RawDataFinished, "All output interface arguments must appear after raw data");
-            static_assert(!std::is_pointer_v<ArgType>, "Output raw data must not be a pointer");
-            static_assert(!std::is_pointer_v<RawArgType>, "Output raw data must not be a pointer");
-            static_assert(std::is_trivially_copyable_v<RawArgType>, "Output raw data must be trivially copyable");
-
-            constexpr size_t ArgOffset = Common::AlignUp(DataOffset, ArgAlign);
-            constexpr size_t ArgEnd = ArgOffset + ArgSize;
-
-            std::memcpy(raw_data + ArgOffset, &std::get<ArgIndex>(args).raw, ArgSize);
-
-            return WriteOutArgument<MethodArguments, CallArguments, ArgAlign, ArgEnd, OutBufferIndex, false, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutInterface) {
-            if (is_domain) {
-                ctx.AddDomainObject(std::get<ArgIndex>(args).raw);
-            } else {
-                ctx.AddMoveInterface(std::get<ArgIndex>(args).raw);
-            }
-
-            return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex, true, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutCopyHandle) {
-            ctx.AddCopyObject(std::get<ArgIndex>(args).raw);
-
-            return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutMoveHandle) {
-            ctx.AddMoveObject(std::get<ArgIndex>(args).raw);
-
-            return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutLargeData) {
-            constexpr size_t BufferSize = sizeof(typename ArgType::Type);
-
-            ASSERT(ctx.CanWriteBuffer(OutBufferIndex));
-            if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
-                ctx.WriteBuffer(std::get<ArgIndex>(args), OutBufferIndex);
-            } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
-                ctx.WriteBufferB(&std::get<ArgIndex>(args), BufferSize, OutBufferIndex);
-            } else /* if (ArgType::Attr & BufferAttr_HipcPointer) */ {
-                ctx.WriteBufferC(&std::get<ArgIndex>(args), BufferSize, OutBufferIndex);
-            }
-
-            return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex + 1, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
-        } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
-            auto& buffer = temp[OutBufferIndex];
-            const size_t size = buffer.size();
-
-            if (size > 0 && ctx.CanWriteBuffer(OutBufferIndex)) {
-                if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
-                    ctx.WriteBuffer(buffer.data(), size, OutBufferIndex);
-                } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
-                    ctx.WriteBufferB(buffer.data(), size, OutBufferIndex);
-                } else /* if (ArgType::Attr & BufferAttr_HipcPointer) */ {
-                    ctx.WriteBufferC(buffer.data(), size, OutBufferIndex);
-                }
-            }
+template <typename MethodArguments, typename CallArguments>
+void ReadInArguments(bool is_domain, CallArguments& args, const u8* raw_data, HLERequestContext& ctx, OutTemporaryBuffers& temp) {
+    [&]<size_t... ArgIndex>(std::index_sequence<ArgIndex...>) {
+        (ReadInArgument<MethodArguments, ArgIndex>(is_domain, args, raw_data, ctx, temp), ...);
+    }(std::make_index_sequence<std::tuple_size_v<CallArguments>>{});
+}
 
-            return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex + 1, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
+template <typename MethodArguments, size_t ArgIndex, typename CallArguments>
+void WriteOutArgument(bool is_domain, CallArguments& args, u8* raw_data, HLERequestContext& ctx, OutTemporaryBuffers& temp) {
+    using ArgType = std::tuple_element_t<ArgIndex, MethodArguments>;
+    constexpr ArgumentLayout Layout = MethodArgumentLayout<MethodArguments>.arguments[ArgIndex];
+
+    if constexpr (Layout.type == ArgumentType::OutData) {
+        using RawArgType = decltype(std::get<ArgIndex>(args).raw);
+
+        static_assert(Layout.is_aligned, "Output argument is not ordered by alignment");
+        static_assert(!Layout.follows_interface, "All output interface arguments must appear after raw data");
+        static_assert(!std::is_pointer_v<ArgType>, "Output raw data must not be a pointer");
+        static_assert(!std::is_pointer_v<RawArgType>, "Output raw data must not be a pointer");
+        static_assert(std::is_trivially_copyable_v<RawArgType>, "Output raw data must be trivially copyable");
+
+        std::memcpy(raw_data + Layout.raw_data_offset, &std::get<ArgIndex>(args).raw, sizeof(RawArgType));
+    } else if constexpr (Layout.type == ArgumentType::OutInterface) {
+        if (is_domain) {
+            ctx.AddDomainObject(std::get<ArgIndex>(args).raw);
         } else {
-            return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
+            ctx.AddMoveInterface(std::get<ArgIndex>(args).raw);
+        }
+    } else if constexpr (Layout.type == ArgumentType::OutCopyHandle) {
+        ctx.AddCopyObject(std::get<ArgIndex>(args).raw);
+    } else if constexpr (Layout.type == ArgumentType::OutMoveHandle) {
+        ctx.AddMoveObject(std::get<ArgIndex>(args).raw);
+    } else if constexpr (Layout.type == ArgumentType::OutLargeData) {
+        constexpr size_t BufferSize = sizeof(typename ArgType::Type);
+
+        ASSERT(ctx.CanWriteBuffer(Layout.index));
+        if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
+            ctx.WriteBuffer(std::get<ArgIndex>(args), Layout.index);
+        } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
+            ctx.WriteBufferB(&std::get<ArgIndex>(args), BufferSize, Layout.index);
+        } else /* if (ArgType::Attr & BufferAttr_HipcPointer) */ {
+            ctx.WriteBufferC(&std::get<ArgIndex>(args), BufferSize, Layout.index);
         }
+    } else if constexpr (Layout.type == ArgumentType::OutBuffer) {
+        // Commit the writes
+        temp.views[Layout.index].reset();
     }
 }
 
+template <typename MethodArguments, typename CallArguments>
+void WriteOutArguments(bool is_domain, CallArguments& args, u8* raw_data, HLERequestContext& ctx, OutTemporaryBuffers& temp) {
+    [&]<size_t... ArgIndex>(std::index_sequence<ArgIndex...>) {
+        (WriteOutArgument<MethodArguments, ArgIndex>(is_domain, args, raw_data, ctx, temp), ...);
+    }(std::make_index_sequence<std::tuple_size_v<CallArguments>>{});
+}
+
 template <bool Domain, typename T, typename... A>
 void CmifReplyWrapImpl(HLERequestContext& ctx, T& t, Result (T::*f)(A...)) {
     // Verify domain state.
@@ -448,7 +446,7 @@ void CmifReplyWrapImpl(HLERequestContext& ctx, T& t, Result (T::*f)(A...)) {
 
     // Read inputs.
     const size_t offset_plus_command_id = ctx.GetDataPayloadOffset() + 2;
-    ReadInArgument<MethodArguments>(is_domain, call_arguments, reinterpret_cast<u8*>(ctx.CommandBuffer() + offset_plus_command_id), ctx, buffers);
+    ReadInArguments<MethodArguments>(is_domain, call_arguments, reinterpret_cast<u8*>(ctx.CommandBuffer() + offset_plus_command_id), ctx, buffers);
 
     // Call.
     const auto Callable = [&]<typename... CallArgs>(CallArgs&... args) {
@@ -457,12 +455,14 @@ void CmifReplyWrapImpl(HLERequestContext& ctx, T& t, Result (T::*f)(A...)) {
     const Result res = std::apply(Callable, call_arguments);
 
     // Write result.
-    const RequestLayout layout = GetReplyOutLayout<MethodArguments>(is_domain);
+    constexpr RequestLayout DomainLayout = GetDomainReplyOutLayout<MethodArguments>();
+    constexpr RequestLayout NonDomainLayout = GetNonDomainReplyOutLayout<MethodArguments>();
+    const RequestLayout& layout = is_domain ? DomainLayout : NonDomainLayout;
     IPC::ResponseBuilder rb{ctx, 2 + Common::DivCeil(layout.cmif_raw_data_size, sizeof(u32)), layout.copy_handle_count, layout.move_handle_count + layout.domain_interface_count};
     rb.Push(res);
 
     // Write out arguments.
-    WriteOutArgument<MethodArguments>(is_domain, call_arguments, reinterpret_cast<u8*>(ctx.CommandBuffer() + rb.GetCurrentOffset()), ctx, buffers);
+    WriteOutArguments<MethodArguments>(is_domain, call_arguments, reinterpret_cast<u8*>(ctx.CommandBuffer() + rb.GetCurrentOffset()), ctx, buffers);
 }
 // clang-format on
 
@@ -6,12 +6,14 @@
 #include "common/assert.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/literals.h"
 #include "common/settings.h"
 #include "core/core.h"
 #include "core/file_sys/bis_factory.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/control_metadata.h"
 #include "core/file_sys/errors.h"
+#include "core/file_sys/fssystem/fssystem_compressed_block_cache.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/romfs_factory.h"
@@ -19,6 +21,8 @@
 #include "core/file_sys/sdmc_factory.h"
 #include "core/file_sys/vfs/vfs.h"
 #include "core/file_sys/vfs/vfs_offset.h"
+#include "core/file_sys/vfs/vfs_read_ahead.h"
+#include "core/file_sys/vfs/vfs_write_back.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/hle/service/filesystem/fsp/fsp_ldr.h"
 #include "core/hle/service/filesystem/fsp/fsp_pr.h"
@@ -291,6 +295,13 @@ Result VfsDirectoryServiceWrapper::GetFileTimeStampRaw(
     return ResultSuccess;
 }
 
+Result VfsDirectoryServiceWrapper::Commit() const {
+    if (!FileSys::WriteBackSaveData::Commit(backing)) {
+        return ResultUnknown;
+    }
+    return ResultSuccess;
+}
+
 FileSystemController::FileSystemController(Core::System& system_) : system{system_} {}
 
 FileSystemController::~FileSystemController() = default;
@@ -677,6 +688,33 @@ FileSys::VirtualDir FileSystemController::GetBCATDirectory(u64 title_id) const {
     return bis_factory->GetBCATDirectory(title_id);
 }
 
+FileSys::VirtualFile FileSystemController::WrapReadAhead(FileSys::VirtualFile file) {
+    FileSys::ReadAheadCache* cache{};
+    {
+        std::scoped_lock lk{read_ahead_lock};
+        if (!read_ahead_cache) {
+            const u32 cache_size = Settings::values.romfs_read_ahead_cache_size.GetValue();
+            if (cache_size == 0) {
+                return file;
+            }
+            using namespace Common::Literals;
+            read_ahead_cache =
+                std::make_unique<FileSys::ReadAheadCache>(static_cast<size_t>(cache_size) * 1_MiB);
+        }
+        cache = read_ahead_cache.get();
+    }
+    return cache->Wrap(std::move(file));
+}
+
+FileSys::ReadAheadStats FileSystemController::GetAndResetReadAheadStats() {
+    std::scoped_lock lk{read_ahead_lock};
+    return read_ahead_cache ? read_ahead_cache->GetAndResetStats() : FileSys::ReadAheadStats{};
+}
+
+FileSys::CompressedBlockCacheStats FileSystemController::GetAndResetCompressedBlockCacheStats() {
+    return FileSys::CompressedBlockCache::GetInstance().GetAndResetStats();
+}
+
 void FileSystemController::CreateFactories(FileSys::VfsFilesystem& vfs, bool overwrite) {
     if (overwrite) {
         bis_factory = nullptr;
@@ -8,7 +8,9 @@
 #include "common/common_types.h"
 #include "core/file_sys/fs_directory.h"
 #include "core/file_sys/fs_filesystem.h"
+#include "core/file_sys/fssystem/fssystem_compressed_block_cache_stats.h"
 #include "core/file_sys/vfs/vfs.h"
+#include "core/file_sys/vfs/vfs_read_ahead_stats.h"
 #include "core/hle/result.h"
 
 namespace Core {
@@ -21,6 +23,7 @@ class NCA;
 class RegisteredCache;
 class RegisteredCacheUnion;
 class PlaceholderCache;
+class ReadAheadCache;
 class RomFSFactory;
 class SaveDataFactory;
 class SDMCFactory;
@@ -117,6 +120,14 @@ public:
 
     FileSys::VirtualDir GetBCATDirectory(u64 title_id) const;
 
+    // Wraps a file opened by the guest with the read ahead cache. Writable files and files backed
+    // by memory are returned as is, as is every file when read ahead is disabled.
+    FileSys::VirtualFile WrapReadAhead(FileSys::VirtualFile file);
+    FileSys::ReadAheadStats GetAndResetReadAheadStats();
+
+    // Returns the lookups of the decompressed block cache shared by compressed NCA sections
+    FileSys::CompressedBlockCacheStats GetAndResetCompressedBlockCacheStats();
+
     // Creates the SaveData, SDMC, and BIS Factories. Should be called once and before any function
     // above is called.
     void CreateFactories(FileSys::VfsFilesystem& vfs, bool overwrite = true);
@@ -142,6 +153,10 @@ private:
     std::unique_ptr<FileSys::RegisteredCache> gamecard_registered;
     std::unique_ptr<FileSys::PlaceholderCache> gamecard_placeholder;
 
+    // Created on first use, kept until shutdown as wrapped files refer to it
+    std::mutex read_ahead_lock;
+    std::unique_ptr<FileSys::ReadAheadCache> read_ahead_cache;
+
     Core::System& system;
 };
 
@@ -253,6 +268,12 @@ public:
     Result GetFileTimeStampRaw(FileSys::FileTimeStampRaw* out_time_stamp_raw,
                                const std::string& path) const;
 
+    /**
+     * Writes back the writes buffered for a save data directory, does nothing for others
+     * @return Result of the operation
+     */
+    Result Commit() const;
+
 private:
     FileSys::VirtualDir backing;
 };
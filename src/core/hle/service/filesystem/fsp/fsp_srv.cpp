@@ -26,6 +26,7 @@
 #include "core/file_sys/savedata_factory.h"
 #include "core/file_sys/system_archive/system_archive.h"
 #include "core/file_sys/vfs/vfs.h"
+#include "core/file_sys/vfs/vfs_write_back.h"
 #include "core/hle/result.h"
 #include "core/hle/service/cmif_serialization.h"
 #include "core/hle/service/filesystem/filesystem.h"
@@ -270,8 +271,9 @@ Result FSP_SRV::OpenSaveDataFileSystem(OutInterface<IFileSystem> out_interface,
         ASSERT(false);
     }
 
-    *out_interface =
-        std::make_shared<IFileSystem>(system, std::move(dir), SizeGetter::FromStorageId(fsc, id));
+    *out_interface = std::make_shared<IFileSystem>(system,
+                                                   FileSys::WriteBackSaveData::Wrap(std::move(dir)),
+                                                   SizeGetter::FromStorageId(fsc, id));
 
     R_SUCCEED();
 }
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <sstream>
 
 #include <boost/range/algorithm_ext/erase.hpp>
@@ -129,6 +130,8 @@ HLERequestContext::HLERequestContext(Kernel::KernelCore& kernel_, Core::Memory::
                                      Kernel::KServerSession* server_session_,
                                      Kernel::KThread* thread_)
     : server_session(server_session_), thread(thread_), kernel{kernel_}, memory{memory_} {
+    static std::atomic<u64> next_request_id{};
+    request_id = next_request_id.fetch_add(1, std::memory_order_relaxed);
     cmd_buf[0] = 0;
 }
 
@@ -450,6 +453,34 @@ std::size_t HLERequestContext::WriteBufferC(const void* buffer, std::size_t size
     return size;
 }
 
+HLERequestContext::WriteBufferMemory HLERequestContext::GetWriteBuffer(
+    std::size_t buffer_index, Common::ScratchBuffer<u8>* backup) const {
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+    if (is_buffer_b) {
+        return GetWriteBufferB(buffer_index, backup);
+    }
+    return GetWriteBufferC(buffer_index, backup);
+}
+
+HLERequestContext::WriteBufferMemory HLERequestContext::GetWriteBufferB(
+    std::size_t buffer_index, Common::ScratchBuffer<u8>* backup) const {
+    if (buffer_index >= BufferDescriptorB().size()) {
+        return WriteBufferMemory(memory, 0, 0, backup);
+    }
+    return WriteBufferMemory(memory, BufferDescriptorB()[buffer_index].Address(),
+                             BufferDescriptorB()[buffer_index].Size(), backup);
+}
+
+HLERequestContext::WriteBufferMemory HLERequestContext::GetWriteBufferC(
+    std::size_t buffer_index, Common::ScratchBuffer<u8>* backup) const {
+    if (buffer_index >= BufferDescriptorC().size()) {
+        return WriteBufferMemory(memory, 0, 0, backup);
+    }
+    return WriteBufferMemory(memory, BufferDescriptorC()[buffer_index].Address(),
+                             BufferDescriptorC()[buffer_index].Size(), backup);
+}
+
 std::size_t HLERequestContext::GetReadBufferSize(std::size_t buffer_index) const {
     const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
                            BufferDescriptorA()[buffer_index].Size()};
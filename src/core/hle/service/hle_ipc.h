@@ -16,6 +16,7 @@
 #include "common/common_types.h"
 #include "common/concepts.h"
 #include "common/swap.h"
+#include "core/guest_memory.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/k_handle_table.h"
 #include "core/hle/kernel/svc_common.h"
@@ -281,6 +282,27 @@ public:
     std::size_t WriteBufferC(const void* buffer, std::size_t size,
                              std::size_t buffer_index = 0) const;
 
+    /// Writable view of an output buffer, destructible only where Core::Memory::Memory is complete
+    using WriteBufferMemory =
+        Core::Memory::GuestMemoryScoped<Core::Memory::Memory, u8,
+                                        Core::Memory::GuestMemoryFlags::SafeWrite>;
+
+    /**
+     * Helper function to get a writable view of a buffer using the appropriate buffer descriptor.
+     * The view points into guest memory when the buffer is contiguous on the host, and into backup
+     * with the current contents otherwise. Writes are committed when the view is destroyed.
+     */
+    [[nodiscard]] WriteBufferMemory GetWriteBuffer(
+        std::size_t buffer_index = 0, Common::ScratchBuffer<u8>* backup = nullptr) const;
+
+    /// Helper function to get a writable view of buffer B, see GetWriteBuffer
+    [[nodiscard]] WriteBufferMemory GetWriteBufferB(
+        std::size_t buffer_index = 0, Common::ScratchBuffer<u8>* backup = nullptr) const;
+
+    /// Helper function to get a writable view of buffer C, see GetWriteBuffer
+    [[nodiscard]] WriteBufferMemory GetWriteBufferC(
+        std::size_t buffer_index = 0, Common::ScratchBuffer<u8>* backup = nullptr) const;
+
     /* Helper function to write a buffer using the appropriate buffer descriptor
      *
      * @tparam T an arbitrary container that satisfies the
@@ -389,6 +411,11 @@ public:
         is_deferred = is_deferred_;
     }
 
+    /// Returns an identifier of this request, unlike its address it is never reused
+    [[nodiscard]] u64 GetRequestId() const {
+        return request_id;
+    }
+
 private:
     friend class IPC::ResponseBuilder;
 
@@ -425,6 +452,7 @@ private:
 
     std::weak_ptr<SessionRequestManager> manager{};
     bool is_deferred{false};
+    u64 request_id{};
 
     Kernel::KernelCore& kernel;
     Core::Memory::Memory& memory;
@@ -108,17 +108,27 @@ DisconnectReason LANDiscovery::GetDisconnectReason() const {
 
 Result LANDiscovery::Scan(std::span<NetworkInfo> out_networks, s16& out_count,
                           const ScanFilter& filter) {
-    {
-        std::scoped_lock lock{packet_mutex};
-        scan_results.clear();
+    std::unique_lock lock{packet_mutex};
+    scan_results.clear();
 
-        SendBroadcast(Network::LDNPacketType::Scan);
-    }
+    SendBroadcast(Network::LDNPacketType::Scan);
 
     LOG_INFO(Service_LDN, "Waiting for scan replies");
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    // Hosts reply as soon as they see the scan, so stop waiting once the replies dry up
+    const auto deadline = std::chrono::steady_clock::now() + scan_timeout;
+    std::size_t num_results = 0;
+    while (true) {
+        auto wait_until = deadline;
+        if (num_results > 0) {
+            wait_until = std::min(deadline, std::chrono::steady_clock::now() + scan_quiet_period);
+        }
+        if (!packet_received.wait_until(lock, wait_until,
+                                        [&] { return scan_results.size() != num_results; })) {
+            break;
+        }
+        num_results = scan_results.size();
+    }
 
-    std::scoped_lock lock{packet_mutex};
     for (const auto& [key, info] : scan_results) {
         if (out_count >= static_cast<s16>(out_networks.size())) {
             break;
@@ -284,7 +294,7 @@ Result LANDiscovery::DestroyNetwork() {
 
 Result LANDiscovery::Connect(const NetworkInfo& network_info_, const UserConfig& user_config,
                              u16 local_communication_version) {
-    std::scoped_lock lock{packet_mutex};
+    std::unique_lock lock{packet_mutex};
     if (network_info_.ldn.node_count == 0) {
         return ResultInvalidNodeCount;
     }
@@ -301,7 +311,11 @@ Result LANDiscovery::Connect(const NetworkInfo& network_info_, const UserConfig&
 
     InitNodeStateChange();
 
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    // The host answers with the network it added the node to
+    if (!packet_received.wait_for(lock, connect_timeout,
+                                  [this] { return state == State::StationConnected; })) {
+        LOG_WARNING(Service_LDN, "Host did not sync the network in time");
+    }
 
     return ResultSuccess;
 }
@@ -558,6 +572,7 @@ void LANDiscovery::ReceivePacket(const Network::LDNPacket& packet) {
         break;
     }
     }
+    packet_received.notify_all();
 }
 
 bool LANDiscovery::IsNodeStateChanged() {
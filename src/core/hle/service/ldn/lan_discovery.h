@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <functional>
 #include <memory>
@@ -111,8 +113,17 @@ protected:
     static const LanEventFunc empty_func;
     static constexpr Ssid fake_ssid{"YuzuFakeSsidForLdn"};
 
+    /// Longest time a scan waits for replies
+    static constexpr std::chrono::milliseconds scan_timeout{1000};
+    /// A scan ends early once no new network replied for this long
+    static constexpr std::chrono::milliseconds scan_quiet_period{250};
+    /// Longest time a connect waits for the host to sync its network
+    static constexpr std::chrono::milliseconds connect_timeout{1000};
+
     bool inited{};
     std::mutex packet_mutex;
+    /// Signaled under packet_mutex every time a packet was handled
+    std::condition_variable packet_received;
     std::array<LanStation, StationCountMax> stations;
     std::array<NodeLatestUpdate, NodeCountMax> node_changes{};
     std::array<u8, NodeCountMax> node_last_states{};
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <span>
 #include <vector>
 
 #include "common/assert.h"
@@ -37,7 +38,7 @@ constexpr u32 EXPECTED_MAGIC{0x36f81a1e};  // What we expect the encrypted bfttf
 constexpr u64 SHARED_FONT_MEM_SIZE{0x1100000};
 constexpr FontRegion EMPTY_REGION{0, 0};
 
-static void DecryptSharedFont(const std::vector<u32>& input, Kernel::PhysicalMemory& output,
+static void DecryptSharedFont(const std::vector<u32>& input, std::span<u8> output,
                               std::size_t& offset) {
     ASSERT_MSG(offset + (input.size() * sizeof(u32)) < SHARED_FONT_MEM_SIZE,
                "Shared fonts exceeds 17mb!");
@@ -122,11 +123,11 @@ struct IPlatformServiceManager::Impl {
         }
     }
 
-    /// Backing memory for the shared font data
-    std::shared_ptr<Kernel::PhysicalMemory> shared_font;
-
     // Automatically populated based on shared_fonts dump or system archives.
     std::vector<FontRegion> shared_font_regions;
+
+    /// Whether the fonts were written to the font shared memory
+    bool fonts_loaded{};
 };
 
 IPlatformServiceManager::IPlatformServiceManager(Core::System& system_, const char* service_name_)
@@ -152,6 +153,19 @@ IPlatformServiceManager::IPlatformServiceManager(Core::System& system_, const ch
     };
     // clang-format on
     RegisterHandlers(functions);
+}
+
+IPlatformServiceManager::~IPlatformServiceManager() = default;
+
+void IPlatformServiceManager::LoadSharedFonts() {
+    if (impl->fonts_loaded) {
+        return;
+    }
+    impl->fonts_loaded = true;
+
+    // Fonts are decrypted straight into the font shared memory the first time a client asks for
+    // them, applications that never draw system text skip decompressing the embedded archives
+    const std::span<u8> shared_font{kernel.GetFontSharedMem().GetPointer(), SHARED_FONT_MEM_SIZE};
 
     auto& fsc = system.GetFileSystemController();
 
@@ -160,7 +174,6 @@ IPlatformServiceManager::IPlatformServiceManager(Core::System& system_, const ch
     std::size_t offset = 0;
     // Rebuild shared fonts from data ncas or synthesize
 
-    impl->shared_font = std::make_shared<Kernel::PhysicalMemory>(SHARED_FONT_MEM_SIZE);
     for (auto font : SHARED_FONTS) {
         FileSys::VirtualFile romfs;
         const auto nca =
@@ -196,13 +209,11 @@ IPlatformServiceManager::IPlatformServiceManager(Core::System& system_, const ch
         // Font offset and size do not account for the header
         const FontRegion region{static_cast<u32>(offset + 8),
                                 static_cast<u32>((font_data_u32.size() * sizeof(u32)) - 8)};
-        DecryptSharedFont(font_data_u32, *impl->shared_font, offset);
+        DecryptSharedFont(font_data_u32, shared_font, offset);
         impl->shared_font_regions.push_back(region);
     }
 }
 
-IPlatformServiceManager::~IPlatformServiceManager() = default;
-
 Result IPlatformServiceManager::RequestLoad(SharedFontType type) {
     // Games don't call this so all fonts should be loaded
     LOG_DEBUG(Service_NS, "called, shared_font_type={}", type);
@@ -217,6 +228,7 @@ Result IPlatformServiceManager::GetLoadState(Out<LoadState> out_load_state, Shar
 
 Result IPlatformServiceManager::GetSize(Out<u32> out_size, SharedFontType type) {
     LOG_DEBUG(Service_NS, "called, shared_font_type={}", type);
+    LoadSharedFonts();
     *out_size = impl->GetSharedFontRegion(static_cast<size_t>(type)).size;
     R_SUCCEED();
 }
@@ -224,6 +236,7 @@ Result IPlatformServiceManager::GetSize(Out<u32> out_size, SharedFontType type)
 Result IPlatformServiceManager::GetSharedMemoryAddressOffset(Out<u32> out_shared_memory_offset,
                                                              SharedFontType type) {
     LOG_DEBUG(Service_NS, "called, shared_font_type={}", type);
+    LoadSharedFonts();
     *out_shared_memory_offset = impl->GetSharedFontRegion(static_cast<size_t>(type)).offset;
     R_SUCCEED();
 }
@@ -232,10 +245,7 @@ Result IPlatformServiceManager::GetSharedMemoryNativeHandle(
     OutCopyHandle<Kernel::KSharedMemory> out_shared_memory_native_handle) {
     // Map backing memory for the font data
     LOG_DEBUG(Service_NS, "called");
-
-    // Create shared font memory object
-    std::memcpy(kernel.GetFontSharedMem().GetPointer(), impl->shared_font->data(),
-                impl->shared_font->size());
+    LoadSharedFonts();
 
     // FIXME: this shouldn't belong to the kernel
     *out_shared_memory_native_handle = &kernel.GetFontSharedMem();
@@ -248,6 +258,7 @@ Result IPlatformServiceManager::GetSharedFontInOrderOfPriority(
     OutArray<u32, BufferAttr_HipcMapAlias> out_font_sizes, Out<bool> out_fonts_are_loaded,
     Out<u32> out_font_count, Set::LanguageCode language_code) {
     LOG_DEBUG(Service_NS, "called, language_code={:#x}", language_code);
+    LoadSharedFonts();
 
     // The maximum number of elements that can be returned is 6. Regardless of the available fonts
     // or buffer size.
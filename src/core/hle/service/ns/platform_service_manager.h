@@ -58,6 +58,8 @@ public:
     ~IPlatformServiceManager() override;
 
 private:
+    void LoadSharedFonts();
+
     Result RequestLoad(SharedFontType type);
     Result GetLoadState(Out<LoadState> out_load_state, SharedFontType type);
     Result GetSize(Out<u32> out_size, SharedFontType type);
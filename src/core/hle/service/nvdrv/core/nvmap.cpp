@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <functional>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/assert.h"
@@ -72,16 +73,16 @@ NvResult NvMap::Handle::Duplicate(bool internal_session) {
 NvMap::NvMap(Container& core_, Tegra::Host1x::Host1x& host1x_) : host1x{host1x_}, core{core_} {}
 
 void NvMap::AddHandle(std::shared_ptr<Handle> handle_description) {
-    std::scoped_lock lock(handles_lock);
+    HandleShard& shard{GetShard(handle_description->id)};
+    std::scoped_lock lock(shard.lock);
 
-    handles.emplace(handle_description->id, std::move(handle_description));
+    shard.handles.emplace(handle_description->id, std::move(handle_description));
 }
 
 void NvMap::UnmapHandle(Handle& handle_description) {
     // Remove pending unmap queue entry if needed
-    if (handle_description.unmap_queue_entry) {
-        unmap_queue.erase(*handle_description.unmap_queue_entry);
-        handle_description.unmap_queue_entry.reset();
+    if (handle_description.unmap_queue_node.IsLinked()) {
+        unmap_queue.erase(unmap_queue.iterator_to(handle_description));
     }
 
     // Free and unmap the handle from Host1x GMMU
@@ -110,16 +111,19 @@ void NvMap::UnmapHandle(Handle& handle_description) {
     handle_description.in_heap = false;
 }
 
-bool NvMap::TryRemoveHandle(const Handle& handle_description) {
+bool NvMap::TryRemoveHandle(Handle& handle_description) {
     // No dupes left, we can remove from handle map
     if (handle_description.dupes == 0 && handle_description.internal_dupes == 0) {
-        std::scoped_lock lock(handles_lock);
-
-        auto it{handles.find(handle_description.id)};
-        if (it != handles.end()) {
-            handles.erase(it);
+        // The unmap queue doesn't keep handles alive, unmap it while the map still owns it
+        if (handle_description.unmap_queue_node.IsLinked()) {
+            std::scoped_lock queueLock(unmap_queue_lock);
+            UnmapHandle(handle_description);
         }
 
+        HandleShard& shard{GetShard(handle_description.id)};
+        std::scoped_lock lock(shard.lock);
+        shard.handles.erase(handle_description.id);
+
         return true;
     } else {
         return false;
@@ -140,21 +144,23 @@ NvResult NvMap::CreateHandle(u64 size, std::shared_ptr<NvMap::Handle>& result_ou
 }
 
 std::shared_ptr<NvMap::Handle> NvMap::GetHandle(Handle::Id handle) {
-    std::scoped_lock lock(handles_lock);
-    try {
-        return handles.at(handle);
-    } catch (std::out_of_range&) {
+    HandleShard& shard{GetShard(handle)};
+    std::scoped_lock lock(shard.lock);
+    const auto it{shard.handles.find(handle)};
+    if (it == shard.handles.end()) {
         return nullptr;
     }
+    return it->second;
 }
 
 DAddr NvMap::GetHandleAddress(Handle::Id handle) {
-    std::scoped_lock lock(handles_lock);
-    try {
-        return handles.at(handle)->d_address;
-    } catch (std::out_of_range&) {
+    HandleShard& shard{GetShard(handle)};
+    std::scoped_lock lock(shard.lock);
+    const auto it{shard.handles.find(handle)};
+    if (it == shard.handles.end()) {
         return 0;
     }
+    return it->second->d_address;
 }
 
 DAddr NvMap::PinHandle(NvMap::Handle::Id handle, bool low_area_pin) {
@@ -182,9 +188,8 @@ DAddr NvMap::PinHandle(NvMap::Handle::Id handle, bool low_area_pin) {
             // Lock now to prevent our queue entry from being removed for allocation in-between the
             // following check and erase
             std::scoped_lock queueLock(unmap_queue_lock);
-            if (handle_description->unmap_queue_entry) {
-                unmap_queue.erase(*handle_description->unmap_queue_entry);
-                handle_description->unmap_queue_entry.reset();
+            if (handle_description->unmap_queue_node.IsLinked()) {
+                unmap_queue.erase(unmap_queue.iterator_to(*handle_description));
 
                 if (low_area_pin) {
                     map_low_area();
@@ -212,12 +217,12 @@ DAddr NvMap::PinHandle(NvMap::Handle::Id handle, bool low_area_pin) {
             while ((address = smmu.Allocate(aligned_up)) == 0) {
                 // Free handles until the allocation succeeds
                 std::scoped_lock queueLock(unmap_queue_lock);
-                if (auto freeHandleDesc{unmap_queue.front()}) {
+                if (!unmap_queue.empty()) {
                     // Handles in the unmap queue are guaranteed not to be pinned so don't bother
                     // checking if they are before unmapping
-                    std::scoped_lock freeLock(freeHandleDesc->mutex);
-                    if (handle_description->d_address)
-                        UnmapHandle(*freeHandleDesc);
+                    Handle& freeHandleDesc{unmap_queue.front()};
+                    std::scoped_lock freeLock(freeHandleDesc.mutex);
+                    UnmapHandle(freeHandleDesc);
                 } else {
                     LOG_CRITICAL(Service_NVDRV, "Ran out of SMMU address space!");
                 }
@@ -253,8 +258,7 @@ void NvMap::UnpinHandle(Handle::Id handle) {
         std::scoped_lock queueLock(unmap_queue_lock);
 
         // Add to the unmap queue allowing this handle's memory to be freed if needed
-        unmap_queue.push_back(handle_description);
-        handle_description->unmap_queue_entry = std::prev(unmap_queue.end());
+        unmap_queue.push_back(*handle_description);
     }
 }
 
@@ -327,19 +331,22 @@ std::optional<NvMap::FreeInfo> NvMap::FreeHandle(Handle::Id handle, bool interna
 }
 
 void NvMap::UnmapAllHandles(NvCore::SessionId session_id) {
-    auto handles_copy = [&] {
-        std::scoped_lock lk{handles_lock};
-        return handles;
-    }();
+    std::vector<std::shared_ptr<Handle>> handles_copy;
+    for (HandleShard& shard : handle_shards) {
+        std::scoped_lock lk{shard.lock};
+        for (const auto& [id, handle] : shard.handles) {
+            handles_copy.push_back(handle);
+        }
+    }
 
-    for (auto& [id, handle] : handles_copy) {
+    for (const auto& handle : handles_copy) {
         {
             std::scoped_lock lk{handle->mutex};
             if (handle->session_id.id != session_id.id || handle->dupes <= 0) {
                 continue;
             }
         }
-        FreeHandle(id, false);
+        FreeHandle(handle->id, false);
     }
 }
 
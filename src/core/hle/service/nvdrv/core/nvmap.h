@@ -4,8 +4,8 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
-#include <list>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -14,6 +14,8 @@
 
 #include "common/bit_field.h"
 #include "common/common_types.h"
+#include "common/intrusive_list.h"
+#include "common/spin_lock.h"
 #include "core/hle/service/nvdrv/core/container.h"
 #include "core/hle/service/nvdrv/nvdata.h"
 
@@ -53,7 +55,7 @@ public:
 
         s64 pins{};
         u32 pin_virt_address{};
-        std::optional<typename std::list<std::shared_ptr<Handle>>::iterator> unmap_queue_entry{};
+        Common::IntrusiveListNode unmap_queue_node; //!< Linked while in the unmap queue
 
         union Flags {
             u32 raw;
@@ -155,18 +157,35 @@ public:
     void UnmapAllHandles(NvCore::SessionId session_id);
 
 private:
-    std::list<std::shared_ptr<Handle>> unmap_queue{};
+    using UnmapQueue = Common::IntrusiveListMemberTraits<&Handle::unmap_queue_node>::ListType;
+
+    /**
+     * @brief A part of the owning map of handles with its own lock, consecutive handle IDs map to
+     * different shards so lookups of unrelated handles don't contend
+     */
+    struct alignas(64) HandleShard {
+        Common::SpinLock lock; //!< Protects access to `handles`
+        std::unordered_map<Handle::Id, std::shared_ptr<Handle>> handles;
+    };
+
+    static constexpr size_t NumHandleShards{32};
+
+    /// Handles with no pins left, in the order they were unpinned. The queue doesn't own its
+    /// handles, a handle is unlinked before it's removed from the handle map.
+    UnmapQueue unmap_queue{};
     std::mutex unmap_queue_lock{}; //!< Protects access to `unmap_queue`
 
-    std::unordered_map<Handle::Id, std::shared_ptr<Handle>>
-        handles{};           //!< Main owning map of handles
-    std::mutex handles_lock; //!< Protects access to `handles`
+    std::array<HandleShard, NumHandleShards> handle_shards{}; //!< Main owning map of handles
 
     static constexpr u32 HandleIdIncrement{
         4}; //!< Each new handle ID is an increment of 4 from the previous
     std::atomic<u32> next_handle_id{HandleIdIncrement};
     Tegra::Host1x::Host1x& host1x;
 
+    HandleShard& GetShard(Handle::Id handle) {
+        return handle_shards[(handle / HandleIdIncrement) % NumHandleShards];
+    }
+
     void AddHandle(std::shared_ptr<Handle> handle);
 
     /**
@@ -176,11 +195,12 @@ private:
     void UnmapHandle(Handle& handle_description);
 
     /**
-     * @brief Removes a handle from the map taking its dupes into account
+     * @brief Removes a handle from the map taking its dupes into account, unmapping it if it's
+     * still in the unmap queue
      * @note handle_description.mutex MUST be locked when calling this
      * @return If the handle was removed from the map
      */
-    bool TryRemoveHandle(const Handle& handle_description);
+    bool TryRemoveHandle(Handle& handle_description);
 
     Container& core;
 };
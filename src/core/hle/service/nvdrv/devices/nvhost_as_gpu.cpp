@@ -270,6 +270,10 @@ NvResult nvhost_as_gpu::Remap(std::span<IoctlRemapEntry> entries) {
         return NvResult::BadValue;
     }
 
+    std::vector<Tegra::MemoryManager::BatchMapEntry> batch;
+    batch.reserve(entries.size());
+
+    NvResult result{NvResult::Success};
     for (const auto& entry : entries) {
         GPUVAddr virtual_address{static_cast<u64>(entry.as_offset_big_pages)
                                  << vm.big_page_size_bits};
@@ -280,33 +284,53 @@ NvResult nvhost_as_gpu::Remap(std::span<IoctlRemapEntry> entries) {
         if (alloc-- == allocation_map.begin() ||
             (virtual_address - alloc->first) + size > alloc->second.size) {
             LOG_WARNING(Service_NVDRV, "Cannot remap into an unallocated region!");
-            return NvResult::BadValue;
+            result = NvResult::BadValue;
+            break;
         }
 
         if (!alloc->second.sparse) {
             LOG_WARNING(Service_NVDRV, "Cannot remap a non-sparse mapping!");
-            return NvResult::BadValue;
+            result = NvResult::BadValue;
+            break;
         }
 
         const bool use_big_pages = alloc->second.big_pages;
         if (!entry.handle) {
-            gmmu->MapSparse(virtual_address, size, use_big_pages);
+            batch.push_back({
+                .gpu_addr = virtual_address,
+                .dev_addr = 0,
+                .size = size,
+                .kind = Tegra::PTEKind::INVALID,
+                .is_big_pages = use_big_pages,
+                .is_sparse = true,
+            });
         } else {
             auto handle{nvmap.GetHandle(entry.handle)};
             if (!handle) {
-                return NvResult::BadValue;
+                result = NvResult::BadValue;
+                break;
             }
 
             DAddr base = nvmap.PinHandle(entry.handle, false);
             DAddr device_address{static_cast<DAddr>(
                 base + (static_cast<u64>(entry.handle_offset_big_pages) << vm.big_page_size_bits))};
 
-            gmmu->Map(virtual_address, device_address, size,
-                      static_cast<Tegra::PTEKind>(entry.kind), use_big_pages);
+            batch.push_back({
+                .gpu_addr = virtual_address,
+                .dev_addr = device_address,
+                .size = size,
+                .kind = static_cast<Tegra::PTEKind>(entry.kind),
+                .is_big_pages = use_big_pages,
+                .is_sparse = false,
+            });
         }
     }
 
-    return NvResult::Success;
+    // Entries before a failing one are still applied, as they were when mapped one at a time.
+    // The rasterizer is notified once for the whole batch.
+    gmmu->MapBatch(batch);
+
+    return result;
 }
 
 NvResult nvhost_as_gpu::MapBufferEx(IoctlMapBufferEx& params) {
@@ -3,260 +3,206 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "common/logging/log.h"
-#include "common/scope_exit.h"
 #include "common/string_util.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_event.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/k_readable_event.h"
-#include "core/hle/service/ipc_helpers.h"
+#include "core/hle/kernel/k_transfer_memory.h"
+#include "core/hle/service/cmif_serialization.h"
 #include "core/hle/service/nvdrv/nvdata.h"
 #include "core/hle/service/nvdrv/nvdrv.h"
 #include "core/hle/service/nvdrv/nvdrv_interface.h"
+#include "core/memory.h"
 
 namespace Service::Nvidia {
 
-void NVDRV::Open(HLERequestContext& ctx) {
+Result NVDRV::Open(Out<DeviceFD> out_fd, Out<NvResult> out_result,
+                   InBuffer<BufferAttr_HipcAutoSelect> device_name_buffer) {
     LOG_DEBUG(Service_NVDRV, "called");
-    IPC::ResponseBuilder rb{ctx, 4};
-    rb.Push(ResultSuccess);
+    *out_fd = 0;
 
     if (!is_initialized) {
-        rb.Push<DeviceFD>(0);
-        rb.PushEnum(NvResult::NotInitialized);
-
+        *out_result = NvResult::NotInitialized;
         LOG_ERROR(Service_NVDRV, "NvServices is not initialized!");
-        return;
+        R_SUCCEED();
     }
 
-    const auto& buffer = ctx.ReadBuffer();
-    const std::string device_name(Common::StringFromBuffer(buffer));
+    const std::string device_name(Common::StringFromBuffer(device_name_buffer));
 
     if (device_name == "/dev/nvhost-prof-gpu") {
-        rb.Push<DeviceFD>(0);
-        rb.PushEnum(NvResult::NotSupported);
-
+        *out_result = NvResult::NotSupported;
         LOG_WARNING(Service_NVDRV, "/dev/nvhost-prof-gpu cannot be opened in production");
-        return;
+        R_SUCCEED();
     }
 
-    DeviceFD fd = nvdrv->Open(device_name, session_id);
-
-    rb.Push<DeviceFD>(fd);
-    rb.PushEnum(fd != INVALID_NVDRV_FD ? NvResult::Success : NvResult::FileOperationFailed);
+    *out_fd = nvdrv->Open(device_name, session_id);
+    *out_result = *out_fd != INVALID_NVDRV_FD ? NvResult::Success : NvResult::FileOperationFailed;
+    R_SUCCEED();
 }
 
-void NVDRV::ServiceError(HLERequestContext& ctx, NvResult result) {
-    IPC::ResponseBuilder rb{ctx, 3};
-    rb.Push(ResultSuccess);
-    rb.PushEnum(result);
-}
-
-void NVDRV::Ioctl1(HLERequestContext& ctx) {
-    IPC::RequestParser rp{ctx};
-    const auto fd = rp.Pop<DeviceFD>();
-    const auto command = rp.PopRaw<Ioctl>();
+Result NVDRV::Ioctl1(Out<NvResult> out_result, DeviceFD fd, Ioctl command,
+                     InBuffer<BufferAttr_HipcAutoSelect> input,
+                     OutBuffer<BufferAttr_HipcAutoSelect> output) {
     LOG_DEBUG(Service_NVDRV, "called fd={}, ioctl=0x{:08X}", fd, command.raw);
 
     if (!is_initialized) {
-        ServiceError(ctx, NvResult::NotInitialized);
+        *out_result = NvResult::NotInitialized;
         LOG_ERROR(Service_NVDRV, "NvServices is not initialized!");
-        return;
+        R_SUCCEED();
     }
 
-    // Check device
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
-    const auto input_buffer = ctx.ReadBuffer(0);
-
-    const auto nv_result = nvdrv->Ioctl1(fd, command, input_buffer, output_buffer);
     if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer);
+        *out_result = nvdrv->Ioctl1(fd, command, input, output);
+    } else {
+        output_buffer.resize_destructive(output.size());
+        *out_result = nvdrv->Ioctl1(fd, command, input, output_buffer);
     }
-
-    IPC::ResponseBuilder rb{ctx, 3};
-    rb.Push(ResultSuccess);
-    rb.PushEnum(nv_result);
+    R_SUCCEED();
 }
 
-void NVDRV::Ioctl2(HLERequestContext& ctx) {
-    IPC::RequestParser rp{ctx};
-    const auto fd = rp.Pop<DeviceFD>();
-    const auto command = rp.PopRaw<Ioctl>();
+Result NVDRV::Ioctl2(Out<NvResult> out_result, DeviceFD fd, Ioctl command,
+                     InBuffer<BufferAttr_HipcAutoSelect> input,
+                     InBuffer<BufferAttr_HipcAutoSelect> inline_input,
+                     OutBuffer<BufferAttr_HipcAutoSelect> output) {
     LOG_DEBUG(Service_NVDRV, "called fd={}, ioctl=0x{:08X}", fd, command.raw);
 
     if (!is_initialized) {
-        ServiceError(ctx, NvResult::NotInitialized);
+        *out_result = NvResult::NotInitialized;
         LOG_ERROR(Service_NVDRV, "NvServices is not initialized!");
-        return;
+        R_SUCCEED();
     }
 
-    const auto input_buffer = ctx.ReadBuffer(0);
-    const auto input_inlined_buffer = ctx.ReadBuffer(1);
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
-
-    const auto nv_result =
-        nvdrv->Ioctl2(fd, command, input_buffer, input_inlined_buffer, output_buffer);
     if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer);
+        *out_result = nvdrv->Ioctl2(fd, command, input, inline_input, output);
+    } else {
+        output_buffer.resize_destructive(output.size());
+        *out_result = nvdrv->Ioctl2(fd, command, input, inline_input, output_buffer);
     }
-
-    IPC::ResponseBuilder rb{ctx, 3};
-    rb.Push(ResultSuccess);
-    rb.PushEnum(nv_result);
+    R_SUCCEED();
 }
 
-void NVDRV::Ioctl3(HLERequestContext& ctx) {
-    IPC::RequestParser rp{ctx};
-    const auto fd = rp.Pop<DeviceFD>();
-    const auto command = rp.PopRaw<Ioctl>();
+Result NVDRV::Ioctl3(Out<NvResult> out_result, DeviceFD fd, Ioctl command,
+                     InBuffer<BufferAttr_HipcAutoSelect> input,
+                     OutBuffer<BufferAttr_HipcAutoSelect> output,
+                     OutBuffer<BufferAttr_HipcAutoSelect> inline_output) {
     LOG_DEBUG(Service_NVDRV, "called fd={}, ioctl=0x{:08X}", fd, command.raw);
 
     if (!is_initialized) {
-        ServiceError(ctx, NvResult::NotInitialized);
+        *out_result = NvResult::NotInitialized;
         LOG_ERROR(Service_NVDRV, "NvServices is not initialized!");
-        return;
+        R_SUCCEED();
     }
 
-    const auto input_buffer = ctx.ReadBuffer(0);
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
-    inline_output_buffer.resize_destructive(ctx.GetWriteBufferSize(1));
-
-    const auto nv_result =
-        nvdrv->Ioctl3(fd, command, input_buffer, output_buffer, inline_output_buffer);
     if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer, 0);
-        ctx.WriteBuffer(inline_output_buffer, 1);
+        *out_result = nvdrv->Ioctl3(fd, command, input, output, inline_output);
+    } else {
+        output_buffer.resize_destructive(output.size());
+        inline_output_buffer.resize_destructive(inline_output.size());
+        *out_result = nvdrv->Ioctl3(fd, command, input, output_buffer, inline_output_buffer);
     }
-
-    IPC::ResponseBuilder rb{ctx, 3};
-    rb.Push(ResultSuccess);
-    rb.PushEnum(nv_result);
+    R_SUCCEED();
 }
 
-void NVDRV::Close(HLERequestContext& ctx) {
+Result NVDRV::Close(Out<NvResult> out_result, DeviceFD fd) {
     LOG_DEBUG(Service_NVDRV, "called");
 
     if (!is_initialized) {
-        ServiceError(ctx, NvResult::NotInitialized);
+        *out_result = NvResult::NotInitialized;
         LOG_ERROR(Service_NVDRV, "NvServices is not initialized!");
-        return;
+        R_SUCCEED();
     }
 
-    IPC::RequestParser rp{ctx};
-    const auto fd = rp.Pop<DeviceFD>();
-    const auto result = nvdrv->Close(fd);
-
-    IPC::ResponseBuilder rb{ctx, 3};
-    rb.Push(ResultSuccess);
-    rb.PushEnum(result);
+    *out_result = nvdrv->Close(fd);
+    R_SUCCEED();
 }
 
-void NVDRV::Initialize(HLERequestContext& ctx) {
+Result NVDRV::Initialize(Out<NvResult> out_result, u32 transfer_memory_size,
+                         InCopyHandle<Kernel::KProcess> process_handle,
+                         InCopyHandle<Kernel::KTransferMemory> transfer_memory_handle) {
     LOG_WARNING(Service_NVDRV, "(STUBBED) called");
-    IPC::ResponseBuilder rb{ctx, 3};
-    SCOPE_EXIT {
-        rb.Push(ResultSuccess);
-        rb.PushEnum(NvResult::Success);
-    };
+    *out_result = NvResult::Success;
 
     if (is_initialized) {
         // No need to initialize again
-        return;
+        R_SUCCEED();
     }
 
-    IPC::RequestParser rp{ctx};
-    const auto process_handle{ctx.GetCopyHandle(0)};
     // The transfer memory is lent to nvdrv as a work buffer since nvdrv is
     // unable to allocate as much memory on its own. For HLE it's unnecessary to handle it
-    [[maybe_unused]] const auto transfer_memory_handle{ctx.GetCopyHandle(1)};
-    [[maybe_unused]] const auto transfer_memory_size = rp.Pop<u32>();
-
     auto& container = nvdrv->GetContainer();
-    auto process = ctx.GetObjectFromHandle<Kernel::KProcess>(process_handle);
-    session_id = container.OpenSession(process.GetPointerUnsafe());
+    session_id = container.OpenSession(process_handle.Get());
 
     is_initialized = true;
+    R_SUCCEED();
 }
 
-void NVDRV::QueryEvent(HLERequestContext& ctx) {
-    IPC::RequestParser rp{ctx};
-    const auto fd = rp.Pop<DeviceFD>();
-    const auto event_id = rp.Pop<u32>();
+Result NVDRV::QueryEvent(Out<NvResult> out_result,
+                         OutCopyHandle<Kernel::KReadableEvent> out_event, DeviceFD fd,
+                         u32 event_id) {
+    *out_event = nullptr;
 
     if (!is_initialized) {
-        ServiceError(ctx, NvResult::NotInitialized);
+        *out_result = NvResult::NotInitialized;
         LOG_ERROR(Service_NVDRV, "NvServices is not initialized!");
-        return;
+        R_SUCCEED();
     }
 
     Kernel::KEvent* event = nullptr;
-    NvResult result = nvdrv->QueryEvent(fd, event_id, event);
-
-    if (result == NvResult::Success) {
-        IPC::ResponseBuilder rb{ctx, 3, 1};
-        rb.Push(ResultSuccess);
-        auto& readable_event = event->GetReadableEvent();
-        rb.PushCopyObjects(readable_event);
-        rb.PushEnum(NvResult::Success);
+    *out_result = nvdrv->QueryEvent(fd, event_id, event);
+
+    if (*out_result == NvResult::Success) {
+        *out_event = std::addressof(event->GetReadableEvent());
     } else {
         LOG_ERROR(Service_NVDRV, "Invalid event request!");
-        IPC::ResponseBuilder rb{ctx, 3};
-        rb.Push(ResultSuccess);
-        rb.PushEnum(result);
     }
+    R_SUCCEED();
 }
 
-void NVDRV::SetAruid(HLERequestContext& ctx) {
-    IPC::RequestParser rp{ctx};
-    pid = rp.Pop<u64>();
+Result NVDRV::SetAruid(Out<NvResult> out_result, u64 aruid) {
+    pid = aruid;
     LOG_WARNING(Service_NVDRV, "(STUBBED) called, pid=0x{:X}", pid);
 
-    IPC::ResponseBuilder rb{ctx, 3};
-    rb.Push(ResultSuccess);
-    rb.PushEnum(NvResult::Success);
+    *out_result = NvResult::Success;
+    R_SUCCEED();
 }
 
-void NVDRV::SetGraphicsFirmwareMemoryMarginEnabled(HLERequestContext& ctx) {
-    LOG_WARNING(Service_NVDRV, "(STUBBED) called");
-
-    IPC::ResponseBuilder rb{ctx, 2};
-    rb.Push(ResultSuccess);
+Result NVDRV::SetGraphicsFirmwareMemoryMarginEnabled(bool enabled) {
+    LOG_WARNING(Service_NVDRV, "(STUBBED) called, enabled={}", enabled);
+    R_SUCCEED();
 }
 
-void NVDRV::GetStatus(HLERequestContext& ctx) {
+Result NVDRV::GetStatus(Out<NvResult> out_result) {
     LOG_WARNING(Service_NVDRV, "(STUBBED) called");
 
-    IPC::ResponseBuilder rb{ctx, 3};
-    rb.Push(ResultSuccess);
-    rb.PushEnum(NvResult::Success);
+    *out_result = NvResult::Success;
+    R_SUCCEED();
 }
 
-void NVDRV::DumpGraphicsMemoryInfo(HLERequestContext& ctx) {
+Result NVDRV::DumpGraphicsMemoryInfo() {
     // According to SwitchBrew, this has no inputs and no outputs, so effectively does nothing on
     // retail hardware.
     LOG_DEBUG(Service_NVDRV, "called");
-
-    IPC::ResponseBuilder rb{ctx, 2};
-    rb.Push(ResultSuccess);
+    R_SUCCEED();
 }
 
 NVDRV::NVDRV(Core::System& system_, std::shared_ptr<Module> nvdrv_, const char* name)
     : ServiceFramework{system_, name}, nvdrv{std::move(nvdrv_)} {
     static const FunctionInfo functions[] = {
-        {0, &NVDRV::Open, "Open"},
-        {1, &NVDRV::Ioctl1, "Ioctl"},
-        {2, &NVDRV::Close, "Close"},
-        {3, &NVDRV::Initialize, "Initialize"},
-        {4, &NVDRV::QueryEvent, "QueryEvent"},
+        {0, C<&NVDRV::Open>, "Open"},
+        {1, C<&NVDRV::Ioctl1>, "Ioctl"},
+        {2, C<&NVDRV::Close>, "Close"},
+        {3, C<&NVDRV::Initialize>, "Initialize"},
+        {4, C<&NVDRV::QueryEvent>, "QueryEvent"},
         {5, nullptr, "MapSharedMem"},
-        {6, &NVDRV::GetStatus, "GetStatus"},
+        {6, C<&NVDRV::GetStatus>, "GetStatus"},
         {7, nullptr, "SetAruidForTest"},
-        {8, &NVDRV::SetAruid, "SetAruid"},
-        {9, &NVDRV::DumpGraphicsMemoryInfo, "DumpGraphicsMemoryInfo"},
+        {8, C<&NVDRV::SetAruid>, "SetAruid"},
+        {9, C<&NVDRV::DumpGraphicsMemoryInfo>, "DumpGraphicsMemoryInfo"},
         {10, nullptr, "InitializeDevtools"},
-        {11, &NVDRV::Ioctl2, "Ioctl2"},
-        {12, &NVDRV::Ioctl3, "Ioctl3"},
-        {13, &NVDRV::SetGraphicsFirmwareMemoryMarginEnabled,
+        {11, C<&NVDRV::Ioctl2>, "Ioctl2"},
+        {12, C<&NVDRV::Ioctl3>, "Ioctl3"},
+        {13, C<&NVDRV::SetGraphicsFirmwareMemoryMarginEnabled>,
          "SetGraphicsFirmwareMemoryMarginEnabled"},
     };
     RegisterHandlers(functions);
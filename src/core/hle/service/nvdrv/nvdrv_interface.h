@@ -6,9 +6,16 @@
 #include <memory>
 
 #include "common/scratch_buffer.h"
+#include "core/hle/service/cmif_types.h"
 #include "core/hle/service/nvdrv/nvdrv.h"
 #include "core/hle/service/service.h"
 
+namespace Kernel {
+class KProcess;
+class KReadableEvent;
+class KTransferMemory;
+} // namespace Kernel
+
 namespace Service::Nvidia {
 
 class NVDRV final : public ServiceFramework<NVDRV> {
@@ -21,19 +28,29 @@ public:
     }
 
 private:
-    void Open(HLERequestContext& ctx);
-    void Ioctl1(HLERequestContext& ctx);
-    void Ioctl2(HLERequestContext& ctx);
-    void Ioctl3(HLERequestContext& ctx);
-    void Close(HLERequestContext& ctx);
-    void Initialize(HLERequestContext& ctx);
-    void QueryEvent(HLERequestContext& ctx);
-    void SetAruid(HLERequestContext& ctx);
-    void SetGraphicsFirmwareMemoryMarginEnabled(HLERequestContext& ctx);
-    void GetStatus(HLERequestContext& ctx);
-    void DumpGraphicsMemoryInfo(HLERequestContext& ctx);
-
-    void ServiceError(HLERequestContext& ctx, NvResult result);
+    Result Open(Out<DeviceFD> out_fd, Out<NvResult> out_result,
+                InBuffer<BufferAttr_HipcAutoSelect> device_name);
+    Result Ioctl1(Out<NvResult> out_result, DeviceFD fd, Ioctl command,
+                  InBuffer<BufferAttr_HipcAutoSelect> input,
+                  OutBuffer<BufferAttr_HipcAutoSelect> output);
+    Result Ioctl2(Out<NvResult> out_result, DeviceFD fd, Ioctl command,
+                  InBuffer<BufferAttr_HipcAutoSelect> input,
+                  InBuffer<BufferAttr_HipcAutoSelect> inline_input,
+                  OutBuffer<BufferAttr_HipcAutoSelect> output);
+    Result Ioctl3(Out<NvResult> out_result, DeviceFD fd, Ioctl command,
+                  InBuffer<BufferAttr_HipcAutoSelect> input,
+                  OutBuffer<BufferAttr_HipcAutoSelect> output,
+                  OutBuffer<BufferAttr_HipcAutoSelect> inline_output);
+    Result Close(Out<NvResult> out_result, DeviceFD fd);
+    Result Initialize(Out<NvResult> out_result, u32 transfer_memory_size,
+                      InCopyHandle<Kernel::KProcess> process_handle,
+                      InCopyHandle<Kernel::KTransferMemory> transfer_memory_handle);
+    Result QueryEvent(Out<NvResult> out_result, OutCopyHandle<Kernel::KReadableEvent> out_event,
+                      DeviceFD fd, u32 event_id);
+    Result SetAruid(Out<NvResult> out_result, u64 aruid);
+    Result SetGraphicsFirmwareMemoryMarginEnabled(bool enabled);
+    Result GetStatus(Out<NvResult> out_result);
+    Result DumpGraphicsMemoryInfo();
 
     std::shared_ptr<Module> nvdrv;
 
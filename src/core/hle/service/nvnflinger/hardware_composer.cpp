@@ -1,9 +1,11 @@
 // SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <optional>
+
 #include <boost/container/small_vector.hpp>
 
-#include "common/microprofile.h"
+#include "common/microprofile_trace.h"
 #include "core/hle/service/nvdrv/devices/nvdisp_disp0.h"
 #include "core/hle/service/nvnflinger/buffer_item.h"
 #include "core/hle/service/nvnflinger/buffer_item_consumer.h"
@@ -116,7 +118,7 @@ u32 HardwareComposer::ComposeLocked(f32* out_speed_scale, Display& display,
     }
 
     // Render MicroProfile.
-    MicroProfileFlip();
+    Common::FlipMicroProfile();
 
     // Advance by at least one frame.
     const u32 frame_advance = swap_interval.value_or(1);
@@ -1,9 +1,14 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
+#include "common/logging/log.h"
+#include "common/polyfill_thread.h"
 #include "common/scope_exit.h"
 
 #include "core/core.h"
+#include "core/hardware_properties.h"
 #include "core/hle/kernel/k_client_port.h"
 #include "core/hle/kernel/k_client_session.h"
 #include "core/hle/kernel/k_event.h"
@@ -242,6 +247,19 @@ void ServerManager::StartAdditionalHostThreads(const char* name, size_t num_thre
     }
 }
 
+void ServerManager::StartDispatchPool(const char* name, size_t min_threads, size_t max_threads) {
+    // Leave the host threads running the emulated cores alone, the thread calling LoopProcess
+    // is part of the pool as well
+    const size_t host_threads{std::jthread::hardware_concurrency()};
+    const size_t free_threads{host_threads > Core::Hardware::NUM_CPU_CORES
+                                  ? host_threads - Core::Hardware::NUM_CPU_CORES
+                                  : 0};
+    const size_t num_threads{
+        std::clamp(free_threads, min_threads, std::max(min_threads, max_threads))};
+    LOG_INFO(Service, "Dispatching {} on {} host threads", name, num_threads + 1);
+    this->StartAdditionalHostThreads(name, num_threads);
+}
+
 Result ServerManager::LoopProcess() {
     SCOPE_EXIT {
         m_stopped.Set();
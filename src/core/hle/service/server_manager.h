@@ -50,6 +50,17 @@ public:
     Result LoopProcess();
     void StartAdditionalHostThreads(const char* name, size_t num_threads);
 
+    /**
+     * Spreads the sessions of this manager over a pool of host threads sized to the host.
+     * A session is unlinked from the wait list while one thread processes its request and is
+     * linked back after the reply, so the requests of a session are still handled in order.
+     * Only use it when the handlers are safe to call concurrently for different sessions.
+     * @param name        Name of the pool threads
+     * @param min_threads Number of threads started even on hosts with few cores
+     * @param max_threads Upper bound of the number of threads started
+     */
+    void StartDispatchPool(const char* name, size_t min_threads, size_t max_threads);
+
     static void RunServer(std::unique_ptr<ServerManager>&& server);
 
 private:
@@ -54,7 +54,8 @@ void PutValue(std::span<u8> buffer, const T& t) {
 } // Anonymous namespace
 
 void BSD::PollWork::Execute(BSD* bsd) {
-    std::tie(ret, bsd_errno) = bsd->PollImpl(write_buffer, read_buffer, nfds, timeout);
+    std::tie(ret, bsd_errno) =
+        bsd->PollImpl(write_buffer, read_buffer, nfds, timeout, &wait_entries);
 }
 
 void BSD::PollWork::Response(HLERequestContext& ctx) {
@@ -198,12 +199,35 @@ void BSD::Poll(HLERequestContext& ctx) {
 
     LOG_DEBUG(Service, "called. nfds={} timeout={}", nfds, timeout);
 
-    ExecuteWork(ctx, PollWork{
-                         .nfds = nfds,
-                         .timeout = timeout,
-                         .read_buffer = ctx.ReadBuffer(),
-                         .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
-                     });
+    // Polls that can't block, including the ones with an invalid timeout, are answered directly
+    if (!poll_reactor || (timeout != -1 && timeout <= 0)) {
+        ExecuteWork(ctx, PollWork{
+                             .nfds = nfds,
+                             .timeout = timeout,
+                             .read_buffer = ctx.ReadBuffer(),
+                             .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
+                         });
+        return;
+    }
+
+    // Only query the sockets here, when nothing is ready the request is deferred until the
+    // reactor sees one of them become ready or the timeout pass
+    const auto deadline = poll_reactor->GetDeadline(ctx.GetRequestId(), timeout);
+    PollWork work{
+        .nfds = nfds,
+        .timeout = 0,
+        .read_buffer = ctx.ReadBuffer(),
+        .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
+    };
+    work.Execute(this);
+    const bool timed_out = deadline && PollReactor::Clock::now() >= *deadline;
+    if (work.ret == 0 && !work.wait_entries.empty() && !timed_out) {
+        poll_reactor->Wait(ctx.GetRequestId(), std::move(work.wait_entries), deadline);
+        ctx.SetIsDeferred();
+        return;
+    }
+    poll_reactor->Finish(ctx.GetRequestId());
+    work.Response(ctx);
 }
 
 void BSD::Accept(HLERequestContext& ctx) {
@@ -522,7 +546,8 @@ std::pair<s32, Errno> BSD::SocketImpl(Domain domain, Type type, Protocol protoco
 }
 
 std::pair<s32, Errno> BSD::PollImpl(std::vector<u8>& write_buffer, std::span<const u8> read_buffer,
-                                    s32 nfds, s32 timeout) {
+                                    s32 nfds, s32 timeout,
+                                    std::vector<PollReactor::Entry>* out_wait_entries) {
     if (nfds <= 0) {
         // When no entries are provided, -1 is returned with errno zero
         return {-1, Errno::SUCCESS};
@@ -585,6 +610,16 @@ std::pair<s32, Errno> BSD::PollImpl(std::vector<u8>& write_buffer, std::span<con
     }
     std::memcpy(write_buffer.data(), fds.data(), nfds * sizeof(PollFD));
 
+    if (out_wait_entries && result.first == 0) {
+        out_wait_entries->reserve(fds.size());
+        for (const PollFD& pollfd : fds) {
+            out_wait_entries->push_back({
+                .socket = file_descriptors[pollfd.fd]->socket,
+                .events = Translate(pollfd.events),
+            });
+        }
+    }
+
     return Translate(result);
 }
 
@@ -1026,6 +1061,10 @@ BSD::~BSD() {
     }
 }
 
+void BSD::SetPollReactor(std::shared_ptr<PollReactor> poll_reactor_) {
+    poll_reactor = std::move(poll_reactor_);
+}
+
 std::unique_lock<std::mutex> BSD::LockService() {
     // Do not lock socket IClient instances.
     return {};
@@ -11,6 +11,7 @@
 #include "common/expected.h"
 #include "common/socket_types.h"
 #include "core/hle/service/service.h"
+#include "core/hle/service/sockets/poll_reactor.h"
 #include "core/hle/service/sockets/sockets.h"
 #include "network/network.h"
 
@@ -37,6 +38,9 @@ public:
     Errno CloseImpl(s32 fd);
     std::optional<std::shared_ptr<Network::SocketBase>> GetSocket(s32 fd);
 
+    /// Defers guest polls that would block to a reactor signaling the deferral event
+    void SetPollReactor(std::shared_ptr<PollReactor> poll_reactor_);
+
 private:
     /// Maximum number of file descriptors
     static constexpr size_t MAX_FD = 128;
@@ -57,6 +61,8 @@ private:
         std::vector<u8> write_buffer;
         s32 ret{};
         Errno bsd_errno{};
+        /// Sockets to wait on when nothing was ready, empty if the poll can't wait
+        std::vector<PollReactor::Entry> wait_entries;
     };
 
     struct AcceptWork {
@@ -154,7 +160,8 @@ private:
 
     std::pair<s32, Errno> SocketImpl(Domain domain, Type type, Protocol protocol);
     std::pair<s32, Errno> PollImpl(std::vector<u8>& write_buffer, std::span<const u8> read_buffer,
-                                   s32 nfds, s32 timeout);
+                                   s32 nfds, s32 timeout,
+                                   std::vector<PollReactor::Entry>* out_wait_entries = nullptr);
     std::pair<s32, Errno> AcceptImpl(s32 fd, std::vector<u8>& write_buffer);
     Errno BindImpl(s32 fd, std::span<const u8> addr);
     Errno ConnectImpl(s32 fd, std::span<const u8> addr);
@@ -181,6 +188,8 @@ private:
 
     Network::RoomNetwork& room_network;
 
+    std::shared_ptr<PollReactor> poll_reactor;
+
     /// Callback to parse and handle a received wifi packet.
     void OnProxyPacketReceived(const Network::ProxyPacket& packet);
 
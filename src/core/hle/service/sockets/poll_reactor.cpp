@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <thread>
+
+#include "common/logging/log.h"
+#include "core/core.h"
+#include "core/hle/kernel/k_event.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/service/sockets/poll_reactor.h"
+
+namespace Service::Sockets {
+
+PollReactor::PollReactor(Core::System& system, Kernel::KEvent* deferral_event_)
+    : deferral_event{deferral_event_} {
+    // Loopback datagram socket the reactor polls on, sending it a byte interrupts the poll
+    wake_socket.Initialize(Network::Domain::INET, Network::Type::DGRAM, Network::Protocol::UDP);
+    wake_socket.Bind({Network::Domain::INET, {127, 0, 0, 1}, 0});
+    wake_socket.SetNonBlock(true);
+    const auto [address, bsd_errno] = wake_socket.GetSockName();
+    if (bsd_errno != Network::Errno::SUCCESS) {
+        LOG_ERROR(Service, "Failed to create the wake-up socket of the poll reactor");
+    }
+    wake_address = address;
+
+    thread = system.Kernel().RunOnHostCoreThread("bsdsocket:Poll", [this] { Run(); });
+}
+
+PollReactor::~PollReactor() {
+    stop_requested = true;
+    WakeUp();
+    thread = {};
+}
+
+std::optional<PollReactor::Clock::time_point> PollReactor::GetDeadline(u64 request_id,
+                                                                       s32 timeout) {
+    std::scoped_lock lock{mutex};
+    const auto [it, inserted] = deadlines.try_emplace(request_id);
+    if (inserted && timeout >= 0) {
+        it->second = Clock::now() + std::chrono::milliseconds{timeout};
+    }
+    return it->second;
+}
+
+void PollReactor::Wait(u64 request_id, std::vector<Entry> entries,
+                       std::optional<Clock::time_point> deadline) {
+    {
+        std::scoped_lock lock{mutex};
+        const u64 id = next_wait_id++;
+        if (const auto it = wait_ids.find(request_id); it != wait_ids.end()) {
+            waits.erase(it->second);
+        }
+        wait_ids.insert_or_assign(request_id, id);
+        waits.emplace(id, PendingWait{request_id, std::move(entries), deadline});
+    }
+    WakeUp();
+}
+
+void PollReactor::Finish(u64 request_id) {
+    std::scoped_lock lock{mutex};
+    deadlines.erase(request_id);
+    if (const auto it = wait_ids.find(request_id); it != wait_ids.end()) {
+        waits.erase(it->second);
+        wait_ids.erase(it);
+    }
+}
+
+void PollReactor::WakeUp() {
+    static constexpr std::array<u8, 1> wake_data{};
+    wake_socket.SendTo(0, wake_data, &wake_address);
+}
+
+void PollReactor::Run() {
+    // Longest pause between two failed polls, only reached when polling keeps failing
+    static constexpr std::chrono::milliseconds MaxFailureBackoff{100};
+
+    std::vector<Network::PollFD> pollfds;
+    std::vector<u64> owners;
+    std::chrono::milliseconds failure_backoff{};
+    while (!stop_requested) {
+        // Poll the sockets of every wait at once, until the earliest deadline
+        pollfds.assign(1, {&wake_socket, Network::PollEvents::In, {}});
+        owners.assign(1, 0);
+        std::optional<Clock::time_point> earliest;
+        {
+            std::scoped_lock lock{mutex};
+            for (const auto& [id, wait] : waits) {
+                for (const Entry& entry : wait.entries) {
+                    pollfds.push_back({entry.socket.get(), entry.events, {}});
+                    owners.push_back(id);
+                }
+                if (wait.deadline && (!earliest || *wait.deadline < *earliest)) {
+                    earliest = wait.deadline;
+                }
+            }
+        }
+        s32 timeout = -1;
+        if (earliest) {
+            const auto remaining_time = *earliest - Clock::now();
+            const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(remaining_time);
+            timeout = static_cast<s32>(std::clamp<s64>(remaining.count(), 0,
+                                                       std::numeric_limits<s32>::max()));
+        }
+        const auto [result, bsd_errno] = Network::Poll(pollfds, timeout);
+        if (result < 0) {
+            // Back off so a persistent failure doesn't spin, and only log the first one
+            if (failure_backoff.count() == 0) {
+                LOG_ERROR(Service, "Poll reactor failed to poll, errno={}",
+                          static_cast<int>(bsd_errno));
+            }
+            failure_backoff = std::clamp(failure_backoff * 2, std::chrono::milliseconds{1},
+                                         MaxFailureBackoff);
+            std::this_thread::sleep_for(failure_backoff);
+            continue;
+        }
+        failure_backoff = {};
+        if (result > 0 && std::ranges::none_of(pollfds, [](const Network::PollFD& pollfd) {
+                return pollfd.revents != Network::PollEvents{};
+            })) {
+            // Socket operations were cancelled, the system is shutting down
+            break;
+        }
+        if (pollfds[0].revents != Network::PollEvents{}) {
+            // Drain every pending wake-up
+            std::array<u8, 16> buffer;
+            while (wake_socket.RecvFrom(0, buffer, nullptr).first > 0) {
+            }
+        }
+
+        bool any_ready = false;
+        {
+            std::scoped_lock lock{mutex};
+            const auto finish = [&](std::map<u64, PendingWait>::iterator it) {
+                wait_ids.erase(it->second.request_id);
+                any_ready = true;
+                return waits.erase(it);
+            };
+            for (size_t i = 1; i < pollfds.size(); ++i) {
+                if (pollfds[i].revents == Network::PollEvents{}) {
+                    continue;
+                }
+                if (const auto it = waits.find(owners[i]); it != waits.end()) {
+                    finish(it);
+                }
+            }
+            const auto now = Clock::now();
+            for (auto it = waits.begin(); it != waits.end();) {
+                if (it->second.deadline && *it->second.deadline <= now) {
+                    it = finish(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        if (any_ready) {
+            // The server manager retries every deferred request, the ones still waiting defer
+            // themselves again
+            deferral_event->Signal();
+        }
+    }
+}
+
+} // namespace Service::Sockets
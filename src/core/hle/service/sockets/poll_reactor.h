@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/internal_network/network.h"
+#include "core/internal_network/sockets.h"
+
+namespace Core {
+class System;
+}
+
+namespace Kernel {
+class KEvent;
+}
+
+namespace Service::Sockets {
+
+/**
+ * Waits for the sockets of every deferred guest poll on a single host thread.
+ *
+ * A guest poll that finds nothing ready is deferred instead of blocking a service thread. The
+ * reactor signals the deferral event of the server manager once one of its sockets is ready or
+ * its timeout passed, and the server manager then runs the request again.
+ */
+class PollReactor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        std::shared_ptr<Network::SocketBase> socket;
+        Network::PollEvents events;
+    };
+
+    explicit PollReactor(Core::System& system, Kernel::KEvent* deferral_event_);
+    ~PollReactor();
+
+    PollReactor(const PollReactor&) = delete;
+    PollReactor& operator=(const PollReactor&) = delete;
+
+    /**
+     * Returns the deadline of a poll request, remembering it the first time the request runs.
+     * @param request_id Identifier of the request of the guest poll
+     * @param timeout Timeout of the guest poll in milliseconds, negative waits forever
+     * @return The deadline, or nullopt when the poll has none
+     */
+    std::optional<Clock::time_point> GetDeadline(u64 request_id, s32 timeout);
+
+    /// Waits for any of the sockets to become ready or for the deadline to pass
+    void Wait(u64 request_id, std::vector<Entry> entries,
+              std::optional<Clock::time_point> deadline);
+
+    /// Forgets a poll request once it was answered
+    void Finish(u64 request_id);
+
+private:
+    struct PendingWait {
+        u64 request_id;
+        std::vector<Entry> entries;
+        std::optional<Clock::time_point> deadline;
+    };
+
+    void Run();
+
+    /// Interrupts the host poll so it picks up new waits
+    void WakeUp();
+
+    Kernel::KEvent* deferral_event;
+
+    std::mutex mutex;
+    std::unordered_map<u64, std::optional<Clock::time_point>> deadlines;
+    std::unordered_map<u64, u64> wait_ids;
+    std::map<u64, PendingWait> waits;
+    u64 next_wait_id = 0;
+
+    Network::Socket wake_socket;
+    Network::SockAddrIn wake_address{};
+    std::atomic_bool stop_requested{};
+    std::jthread thread;
+};
+
+} // namespace Service::Sockets
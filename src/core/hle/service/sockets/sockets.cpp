@@ -4,6 +4,7 @@
 #include "core/hle/service/server_manager.h"
 #include "core/hle/service/sockets/bsd.h"
 #include "core/hle/service/sockets/nsd.h"
+#include "core/hle/service/sockets/poll_reactor.h"
 #include "core/hle/service/sockets/sfdnsres.h"
 #include "core/hle/service/sockets/sockets.h"
 
@@ -12,13 +13,23 @@ namespace Service::Sockets {
 void LoopProcess(Core::System& system) {
     auto server_manager = std::make_unique<ServerManager>(system);
 
-    server_manager->RegisterNamedService("bsd:s", std::make_shared<BSD>(system, "bsd:s"));
-    server_manager->RegisterNamedService("bsd:u", std::make_shared<BSD>(system, "bsd:u"));
+    // Guest polls that would block are deferred and retried when the reactor signals the event
+    Kernel::KEvent* deferral_event{};
+    server_manager->ManageDeferral(&deferral_event);
+    const auto poll_reactor = std::make_shared<PollReactor>(system, deferral_event);
+
+    auto bsd_s = std::make_shared<BSD>(system, "bsd:s");
+    auto bsd_u = std::make_shared<BSD>(system, "bsd:u");
+    bsd_s->SetPollReactor(poll_reactor);
+    bsd_u->SetPollReactor(poll_reactor);
+
+    server_manager->RegisterNamedService("bsd:s", std::move(bsd_s));
+    server_manager->RegisterNamedService("bsd:u", std::move(bsd_u));
     server_manager->RegisterNamedService("bsdcfg", std::make_shared<BSDCFG>(system));
     server_manager->RegisterNamedService("nsd:a", std::make_shared<NSD>(system, "nsd:a"));
     server_manager->RegisterNamedService("nsd:u", std::make_shared<NSD>(system, "nsd:u"));
     server_manager->RegisterNamedService("sfdnsres", std::make_shared<SFDNSRES>(system));
-    server_manager->StartAdditionalHostThreads("bsdsocket", 2);
+    server_manager->StartDispatchPool("bsdsocket", 2, 4);
     ServerManager::RunServer(std::move(server_manager));
 }
 
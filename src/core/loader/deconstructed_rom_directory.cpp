@@ -1,9 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstring>
+#include <optional>
 #include "common/logging/log.h"
 #include "common/settings.h"
+#include "common/task_pool.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/content_archive.h"
 #include "core/file_sys/control_metadata.h"
@@ -228,6 +234,32 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
         return {ResultStatus::ErrorUnableToParseKernelMetadata, {}};
     }
 
+    // Read and decompress all NSO modules at once, only loading them has to be done in order
+    using Clock = std::chrono::steady_clock;
+    std::array<FileSys::VirtualFile, static_modules.size()> module_files;
+    std::array<std::optional<AppLoader_NSO::ModuleImage>, static_modules.size()> module_images;
+    std::array<Clock::duration, static_modules.size()> read_times{};
+    for (size_t i = 0; i < static_modules.size(); i++) {
+        module_files[i] = dir->GetFile(static_modules[i]);
+    }
+    {
+        const auto read_module = [&](size_t i) {
+            const auto& module_file = module_files[i];
+            if (!module_file) {
+                return;
+            }
+
+            const auto start_time = Clock::now();
+            const bool should_pass_arguments = std::strcmp(static_modules[i], "rtld") == 0;
+            module_images[i] =
+                AppLoader_NSO::ReadModule(*module_file, should_pass_arguments, true,
+                                          patch_ctx.GetPatchers(), patch_ctx.GetIndex(i));
+            read_times[i] = Clock::now() - start_time;
+        };
+        Common::TaskGroup workers{Common::TaskPriority::Normal};
+        Common::ParallelForEach(workers, static_modules.size(), read_module);
+    }
+
     // Load NSO modules
     modules.clear();
     const VAddr base_address{GetInteger(process.GetEntryPoint())};
@@ -236,23 +268,30 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
                                    system.GetContentProvider()};
     for (size_t i = 0; i < static_modules.size(); i++) {
         const auto& module = static_modules[i];
-        const FileSys::VirtualFile module_file{dir->GetFile(module)};
-        if (!module_file) {
+        if (!module_files[i]) {
             continue;
         }
+        if (!module_images[i]) {
+            return {ResultStatus::ErrorLoadingNSO, {}};
+        }
 
+        const auto start_time = Clock::now();
         const VAddr load_addr{next_load_addr};
-        const bool should_pass_arguments = std::strcmp(module, "rtld") == 0;
         const auto tentative_next_load_addr = AppLoader_NSO::LoadModule(
-            process, system, *module_file, load_addr, should_pass_arguments, true, pm,
+            process, system, std::move(*module_images[i]), module, load_addr, true, pm,
             patch_ctx.GetPatchers(), patch_ctx.GetIndex(i));
         if (!tentative_next_load_addr) {
             return {ResultStatus::ErrorLoadingNSO, {}};
         }
+        module_images[i].reset();
 
         next_load_addr = *tentative_next_load_addr;
         modules.insert_or_assign(load_addr, module);
-        LOG_DEBUG(Loader, "loaded module {} @ {:#X}", module, load_addr);
+        LOG_DEBUG(Loader, "loaded module {} @ {:#X} (read in {} ms, loaded in {} ms)", module,
+                  load_addr,
+                  std::chrono::duration_cast<std::chrono::milliseconds>(read_times[i]).count(),
+                  std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start_time)
+                      .count());
     }
 
     is_loaded = true;
@@ -1,11 +1,17 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 #include "common/hex_util.h"
-#include "common/scope_exit.h"
+#include "common/literals.h"
 #include "core/core.h"
+#include "core/crypto/sha_util.h"
 #include "core/file_sys/content_archive.h"
 #include "core/file_sys/nca_metadata.h"
 #include "core/file_sys/registered_cache.h"
@@ -14,7 +20,6 @@
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/loader/deconstructed_rom_directory.h"
 #include "core/loader/nca.h"
-#include "mbedtls/sha256.h"
 
 namespace Loader {
 
@@ -84,72 +89,128 @@ AppLoader_NCA::LoadResult AppLoader_NCA::Load(Kernel::KProcess& process, Core::S
 }
 
 ResultStatus AppLoader_NCA::VerifyIntegrity(std::function<bool(size_t, size_t)> progress_callback) {
+    return VerifyIntegrity(std::span(&file, 1), progress_callback).front();
+}
+
+std::vector<ResultStatus> AppLoader_NCA::VerifyIntegrity(
+    std::span<const FileSys::VirtualFile> nca_files,
+    const std::function<bool(size_t, size_t)>& progress_callback) {
+    // Files hashed at the same time, more only makes reads from a hard drive seek
+    constexpr size_t MaxParallelVerifications = 2;
+
+    size_t total_size = 0;
+    for (const auto& nca_file : nca_files) {
+        total_size += nca_file->GetSize();
+    }
+
+    std::vector<ResultStatus> results(nca_files.size(), ResultStatus::ErrorNotInitialized);
+    std::atomic<size_t> processed_size{};
+    std::atomic<size_t> next_file{};
+    std::atomic<bool> cancelled{};
+    std::mutex mutex;
+    std::condition_variable finished_cv;
+    size_t num_finished = 0;
+
+    const auto verify_files = [&] {
+        for (size_t index = next_file++; index < nca_files.size(); index = next_file++) {
+            const ResultStatus result =
+                VerifyFileIntegrity(nca_files[index], processed_size, cancelled);
+            std::scoped_lock lk{mutex};
+            results[index] = result;
+            ++num_finished;
+            finished_cv.notify_one();
+        }
+    };
+
+    // Progress is only reported from this thread, callers drive dialogs and JNI from it
+    {
+        std::vector<std::jthread> threads;
+        const size_t num_threads = std::min(nca_files.size(), MaxParallelVerifications);
+        for (size_t i = 0; i < num_threads; ++i) {
+            threads.emplace_back(verify_files);
+        }
+
+        std::unique_lock lk{mutex};
+        while (num_finished < nca_files.size()) {
+            finished_cv.wait_for(lk, std::chrono::milliseconds{50},
+                                 [&] { return num_finished == nca_files.size(); });
+            lk.unlock();
+            if (!cancelled && !progress_callback(processed_size, total_size)) {
+                cancelled = true;
+            }
+            lk.lock();
+        }
+    }
+    return results;
+}
+
+ResultStatus AppLoader_NCA::VerifyFileIntegrity(const FileSys::VirtualFile& nca_file,
+                                                std::atomic<size_t>& processed_size,
+                                                const std::atomic<bool>& cancelled) {
     using namespace Common::Literals;
 
     constexpr size_t NcaFileNameWithHashLength = 36;
     constexpr size_t NcaFileNameHashLength = 32;
-    constexpr size_t NcaSha256HashLength = 32;
-    constexpr size_t NcaSha256HalfHashLength = NcaSha256HashLength / 2;
+    constexpr size_t NcaSha256HalfHashLength = std::tuple_size_v<Core::Crypto::SHA256Hash> / 2;
 
     // Get the file name.
-    const auto name = file->GetName();
+    const auto name = nca_file->GetName();
 
     // We won't try to verify meta NCAs.
     if (name.ends_with(".cnmt.nca")) {
+        processed_size += nca_file->GetSize();
         return ResultStatus::Success;
     }
 
     // Check if we can verify this file. NCAs should be named after their hashes.
     if (!name.ends_with(".nca") || name.size() != NcaFileNameWithHashLength) {
         LOG_WARNING(Loader, "Unable to validate NCA with name {}", name);
+        processed_size += nca_file->GetSize();
         return ResultStatus::ErrorIntegrityVerificationNotImplemented;
     }
 
     // Get the expected truncated hash of the NCA.
     const auto input_hash =
-        Common::HexStringToVector(file->GetName().substr(0, NcaFileNameHashLength), false);
+        Common::HexStringToVector(name.substr(0, NcaFileNameHashLength), false);
 
     // Declare buffer to read into.
     std::vector<u8> buffer(4_MiB);
 
-    // Initialize sha256 verification context.
-    mbedtls_sha256_context ctx;
-    mbedtls_sha256_init(&ctx);
-    mbedtls_sha256_starts_ret(&ctx, 0);
-
-    // Ensure we maintain a clean state on exit.
-    SCOPE_EXIT {
-        mbedtls_sha256_free(&ctx);
-    };
+    Core::Crypto::Sha256 sha;
 
     // Declare counters.
-    const size_t total_size = file->GetSize();
-    size_t processed_size = 0;
+    const size_t total_size = nca_file->GetSize();
+    size_t file_processed_size = 0;
 
     // Begin iterating the file.
-    while (processed_size < total_size) {
+    while (file_processed_size < total_size) {
+        if (cancelled) {
+            return ResultStatus::ErrorIntegrityVerificationFailed;
+        }
+
         // Refill the buffer.
-        const size_t intended_read_size = std::min(buffer.size(), total_size - processed_size);
-        const size_t read_size = file->Read(buffer.data(), intended_read_size, processed_size);
+        const size_t intended_read_size =
+            std::min(buffer.size(), total_size - file_processed_size);
+        const size_t read_size =
+            nca_file->Read(buffer.data(), intended_read_size, file_processed_size);
+        if (read_size == 0) {
+            break;
+        }
 
         // Update the hash function with the buffer contents.
-        mbedtls_sha256_update_ret(&ctx, buffer.data(), read_size);
+        sha.Update(std::span(buffer).first(read_size));
 
         // Update counters.
+        file_processed_size += read_size;
         processed_size += read_size;
-
-        // Call the progress function.
-        if (!progress_callback(processed_size, total_size)) {
-            return ResultStatus::ErrorIntegrityVerificationFailed;
-        }
     }
 
     // Finalize context and compute the output hash.
-    std::array<u8, NcaSha256HashLength> output_hash;
-    mbedtls_sha256_finish_ret(&ctx, output_hash.data());
+    const Core::Crypto::SHA256Hash output_hash = sha.Finish();
 
     // Compare to expected.
-    if (std::memcmp(input_hash.data(), output_hash.data(), NcaSha256HalfHashLength) != 0) {
+    if (file_processed_size != total_size ||
+        std::memcmp(input_hash.data(), output_hash.data(), NcaSha256HalfHashLength) != 0) {
         LOG_ERROR(Loader, "NCA hash mismatch detected for file {}", name);
         return ResultStatus::ErrorIntegrityVerificationFailed;
     }
@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <span>
+#include <vector>
+
 #include "common/common_types.h"
 #include "core/loader/loader.h"
 
@@ -41,6 +45,19 @@ public:
 
     ResultStatus VerifyIntegrity(std::function<bool(size_t, size_t)> progress_callback) override;
 
+    /**
+     * Verifies NCAs named after their hashes, hashing a few of them at the same time.
+     *
+     * @param nca_files         The NCAs to verify.
+     * @param progress_callback Called from the calling thread with the bytes hashed so far and
+     *                          the total size of the NCAs, returning false cancels verification.
+     *
+     * @return The result of every NCA, in the order of nca_files.
+     */
+    static std::vector<ResultStatus> VerifyIntegrity(
+        std::span<const FileSys::VirtualFile> nca_files,
+        const std::function<bool(size_t, size_t)>& progress_callback);
+
     ResultStatus ReadRomFS(FileSys::VirtualFile& dir) override;
     ResultStatus ReadProgramId(u64& out_program_id) override;
 
@@ -50,6 +67,10 @@ public:
     ResultStatus ReadNSOModules(Modules& modules) override;
 
 private:
+    static ResultStatus VerifyFileIntegrity(const FileSys::VirtualFile& nca_file,
+                                            std::atomic<size_t>& processed_size,
+                                            const std::atomic<bool>& cancelled);
+
     std::unique_ptr<FileSys::NCA> nca;
     std::unique_ptr<AppLoader_DeconstructedRomDirectory> directory_loader;
 };
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 #include <vector>
@@ -11,6 +12,8 @@
 #include "common/lz4_compression.h"
 #include "common/settings.h"
 #include "common/swap.h"
+#include "common/task_pool.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/hle/kernel/code_set.h"
@@ -37,19 +40,64 @@ struct MODHeader {
 };
 static_assert(sizeof(MODHeader) == 0x1c, "MODHeader has incorrect size.");
 
-std::vector<u8> DecompressSegment(const std::vector<u8>& compressed_data,
-                                  const NSOSegmentHeader& header) {
-    std::vector<u8> uncompressed_data =
-        Common::Compression::DecompressDataLZ4(compressed_data, header.size);
+constexpr u32 PageAlignSize(u32 size) {
+    return static_cast<u32>((size + Core::Memory::YUZU_PAGEMASK) & ~Core::Memory::YUZU_PAGEMASK);
+}
+
+Common::TaskGroup& GetWorkers() {
+    static Common::TaskGroup workers{Common::TaskPriority::Normal};
+    return workers;
+}
+
+std::optional<NSOHeader> ReadHeader(const FileSys::VfsFile& nso_file) {
+    if (nso_file.GetSize() < sizeof(NSOHeader)) {
+        return std::nullopt;
+    }
+
+    NSOHeader nso_header{};
+    if (sizeof(NSOHeader) != nso_file.ReadObject(&nso_header)) {
+        return std::nullopt;
+    }
+
+    if (nso_header.magic != Common::MakeMagic('N', 'S', 'O', '0')) {
+        return std::nullopt;
+    }
 
-    ASSERT_MSG(uncompressed_data.size() == header.size, "{} != {}", header.size,
-               uncompressed_data.size());
+    return nso_header;
+}
 
-    return uncompressed_data;
+/// Space at the beginning of the image reserved for the patch section in PreText mode
+size_t GetModuleStart(bool load_into_process,
+                      [[maybe_unused]] const std::vector<Core::NCE::Patcher>* patches,
+                      [[maybe_unused]] s32 patch_index) {
+#ifdef HAS_NCE
+    if (patches && load_into_process) {
+        const auto& patch = (*patches)[patch_index];
+        if (patch.GetPatchMode() == Core::NCE::PatchMode::PreText) {
+            return patch.GetSectionSize();
+        }
+    }
+#endif
+    return 0;
 }
 
-constexpr u32 PageAlignSize(u32 size) {
-    return static_cast<u32>((size + Core::Memory::YUZU_PAGEMASK) & ~Core::Memory::YUZU_PAGEMASK);
+/// Size of the segments and arguments in the image, without the bss
+size_t GetProgramSize(const NSOHeader& nso_header, size_t module_start,
+                      bool should_pass_arguments) {
+    size_t program_size = 0;
+    for (const auto& segment : nso_header.segments) {
+        program_size =
+            std::max<size_t>(program_size, module_start + segment.location + segment.size);
+    }
+    if (should_pass_arguments && !Settings::values.program_args.GetValue().empty()) {
+        program_size += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
+    }
+    return program_size;
+}
+
+u32 GetImageSize(const NSOHeader& nso_header, size_t module_start, bool should_pass_arguments) {
+    const size_t program_size = GetProgramSize(nso_header, module_start, should_pass_arguments);
+    return PageAlignSize(static_cast<u32>(program_size) + nso_header.segments[2].bss_size);
 }
 } // Anonymous namespace
 
@@ -73,55 +121,46 @@ FileType AppLoader_NSO::IdentifyType(const FileSys::VirtualFile& in_file) {
     return FileType::NSO;
 }
 
-std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::System& system,
-                                               const FileSys::VfsFile& nso_file, VAddr load_base,
-                                               bool should_pass_arguments, bool load_into_process,
-                                               std::optional<FileSys::PatchManager> pm,
-                                               std::vector<Core::NCE::Patcher>* patches,
-                                               s32 patch_index) {
-    if (nso_file.GetSize() < sizeof(NSOHeader)) {
-        return std::nullopt;
-    }
-
-    NSOHeader nso_header{};
-    if (sizeof(NSOHeader) != nso_file.ReadObject(&nso_header)) {
+std::optional<AppLoader_NSO::ModuleImage> AppLoader_NSO::ReadModule(
+    const FileSys::VfsFile& nso_file, bool should_pass_arguments, bool load_into_process,
+    const std::vector<Core::NCE::Patcher>* patches, s32 patch_index) {
+    const auto nso_header = ReadHeader(nso_file);
+    if (!nso_header) {
         return std::nullopt;
     }
 
-    if (nso_header.magic != Common::MakeMagic('N', 'S', 'O', '0')) {
-        return std::nullopt;
+    // Allocate some space at the beginning if we are patching in PreText mode.
+    const size_t module_start = GetModuleStart(load_into_process, patches, patch_index);
+
+    // Build program image, the segments are decompressed straight into it
+    ModuleImage image;
+    image.header = *nso_header;
+    image.module_start = module_start;
+    Kernel::CodeSet& codeset = image.codeset;
+    codeset.memory.resize(GetImageSize(*nso_header, module_start, should_pass_arguments));
+    for (std::size_t i = 0; i < nso_header->segments.size(); ++i) {
+        codeset.segments[i].addr = module_start + nso_header->segments[i].location;
+        codeset.segments[i].offset = module_start + nso_header->segments[i].location;
+        codeset.segments[i].size = nso_header->segments[i].size;
     }
 
-    // Allocate some space at the beginning if we are patching in PreText mode.
-    const size_t module_start = [&]() -> size_t {
-#ifdef HAS_NCE
-        if (patches && load_into_process) {
-            auto* patch = &patches->operator[](patch_index);
-            if (patch->GetPatchMode() == Core::NCE::PatchMode::PreText) {
-                return patch->GetSectionSize();
-            }
+    const auto read_segment = [&](size_t i) {
+        const auto& segment = nso_header->segments[i];
+        const size_t compressed_size = nso_header->segments_compressed_size[i];
+        u8* const segment_data = codeset.memory.data() + module_start + segment.location;
+        if (!nso_header->IsSegmentCompressed(i)) {
+            nso_file.Read(segment_data, std::min<size_t>(compressed_size, segment.size),
+                          segment.offset);
+            return;
         }
-#endif
-        return 0;
-    }();
-
-    // Build program image
-    Kernel::CodeSet codeset;
-    Kernel::PhysicalMemory program_image;
-    for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
-        std::vector<u8> data = nso_file.ReadBytes(nso_header.segments_compressed_size[i],
-                                                  nso_header.segments[i].offset);
-        if (nso_header.IsSegmentCompressed(i)) {
-            data = DecompressSegment(data, nso_header.segments[i]);
-        }
-        program_image.resize(module_start + nso_header.segments[i].location +
-                             static_cast<u32>(data.size()));
-        std::memcpy(program_image.data() + module_start + nso_header.segments[i].location,
-                    data.data(), data.size());
-        codeset.segments[i].addr = module_start + nso_header.segments[i].location;
-        codeset.segments[i].offset = module_start + nso_header.segments[i].location;
-        codeset.segments[i].size = nso_header.segments[i].size;
-    }
+
+        const std::vector<u8> compressed_data = nso_file.ReadBytes(compressed_size, segment.offset);
+        const int uncompressed_size = Common::Compression::DecompressDataLZ4(
+            segment_data, segment.size, compressed_data.data(), compressed_data.size());
+        ASSERT_MSG(uncompressed_size == static_cast<int>(segment.size), "{} != {}", segment.size,
+                   uncompressed_size);
+    };
+    Common::ParallelForEach(GetWorkers(), nso_header->segments.size(), read_segment);
 
     if (should_pass_arguments && !Settings::values.program_args.GetValue().empty()) {
         const auto arg_data{Settings::values.program_args.GetValue()};
@@ -129,25 +168,55 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
         codeset.DataSegment().size += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
         NSOArgumentHeader args_header{
             NSO_ARGUMENT_DATA_ALLOCATION_SIZE, static_cast<u32_le>(arg_data.size()), {}};
-        const auto end_offset = program_image.size();
-        program_image.resize(static_cast<u32>(program_image.size()) +
-                             NSO_ARGUMENT_DATA_ALLOCATION_SIZE);
-        std::memcpy(program_image.data() + end_offset, &args_header, sizeof(NSOArgumentHeader));
-        std::memcpy(program_image.data() + end_offset + sizeof(NSOArgumentHeader), arg_data.data(),
-                    arg_data.size());
+        const auto end_offset = GetProgramSize(*nso_header, module_start, false);
+        std::memcpy(codeset.memory.data() + end_offset, &args_header, sizeof(NSOArgumentHeader));
+        std::memcpy(codeset.memory.data() + end_offset + sizeof(NSOArgumentHeader),
+                    arg_data.data(), arg_data.size());
     }
 
-    codeset.DataSegment().size += nso_header.segments[2].bss_size;
-    u32 image_size{
-        PageAlignSize(static_cast<u32>(program_image.size()) + nso_header.segments[2].bss_size)};
-    program_image.resize(image_size);
-
-    for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
+    codeset.DataSegment().size += nso_header->segments[2].bss_size;
+    for (std::size_t i = 0; i < nso_header->segments.size(); ++i) {
         codeset.segments[i].size = PageAlignSize(codeset.segments[i].size);
     }
 
+    return image;
+}
+
+std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::System& system,
+                                               const FileSys::VfsFile& nso_file, VAddr load_base,
+                                               bool should_pass_arguments, bool load_into_process,
+                                               std::optional<FileSys::PatchManager> pm,
+                                               std::vector<Core::NCE::Patcher>* patches,
+                                               s32 patch_index) {
+    // Without NCE patching the code layout only depends on the sizes in the header
+    if (!load_into_process && patches == nullptr) {
+        const auto nso_header = ReadHeader(nso_file);
+        if (!nso_header) {
+            return std::nullopt;
+        }
+        return load_base + GetImageSize(*nso_header, 0, should_pass_arguments);
+    }
+
+    auto image = ReadModule(nso_file, should_pass_arguments, load_into_process, patches,
+                            patch_index);
+    if (!image) {
+        return std::nullopt;
+    }
+    return LoadModule(process, system, std::move(*image), nso_file.GetName(), load_base,
+                      load_into_process, std::move(pm), patches, patch_index);
+}
+
+std::optional<VAddr> AppLoader_NSO::LoadModule(
+    Kernel::KProcess& process, Core::System& system, ModuleImage image, const std::string& name,
+    VAddr load_base, bool load_into_process, std::optional<FileSys::PatchManager> pm,
+    [[maybe_unused]] std::vector<Core::NCE::Patcher>* patches, [[maybe_unused]] s32 patch_index) {
+    const NSOHeader& nso_header = image.header;
+    const size_t module_start = image.module_start;
+    Kernel::CodeSet& codeset = image.codeset;
+    Kernel::PhysicalMemory& program_image = codeset.memory;
+    u32 image_size{static_cast<u32>(program_image.size())};
+
     // Apply patches if necessary
-    const auto name = nso_file.GetName();
     if (pm && (pm->HasNSOPatch(nso_header.build_id, name) || Settings::values.dump_nso)) {
         std::span<u8> patchable_section(program_image.data() + module_start,
                                         program_image.size() - module_start);
@@ -200,7 +269,6 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
     }
 
     // Load codeset for current process
-    codeset.memory = std::move(program_image);
     process.LoadModule(std::move(codeset), load_base);
 
     return load_base + image_size;
@@ -5,10 +5,13 @@
 
 #include <array>
 #include <optional>
+#include <string>
 #include <type_traits>
+#include <vector>
 #include "common/common_types.h"
 #include "common/swap.h"
 #include "core/file_sys/patch_manager.h"
+#include "core/hle/kernel/code_set.h"
 #include "core/loader/loader.h"
 
 namespace Core {
@@ -89,6 +92,25 @@ public:
         return IdentifyType(file);
     }
 
+    /// NSO module decompressed into the memory image it's loaded from
+    struct ModuleImage {
+        NSOHeader header;
+        Kernel::CodeSet codeset;
+        size_t module_start;
+    };
+
+    /**
+     * Reads an NSO file into the memory image of its code, decompressing the segments in
+     * parallel. Doesn't modify the process or the patchers, so several modules can be read at once.
+     *
+     * @return The image, or std::nullopt if the file isn't an NSO.
+     */
+    static std::optional<ModuleImage> ReadModule(const FileSys::VfsFile& nso_file,
+                                                 bool should_pass_arguments,
+                                                 bool load_into_process,
+                                                 const std::vector<Core::NCE::Patcher>* patches,
+                                                 s32 patch_index);
+
     static std::optional<VAddr> LoadModule(Kernel::KProcess& process, Core::System& system,
                                            const FileSys::VfsFile& nso_file, VAddr load_base,
                                            bool should_pass_arguments, bool load_into_process,
@@ -96,6 +118,14 @@ public:
                                            std::vector<Core::NCE::Patcher>* patches = nullptr,
                                            s32 patch_index = -1);
 
+    /// Loads a module read with ReadModule, the arguments must match the ones it was read with
+    static std::optional<VAddr> LoadModule(Kernel::KProcess& process, Core::System& system,
+                                           ModuleImage image, const std::string& name,
+                                           VAddr load_base, bool load_into_process,
+                                           std::optional<FileSys::PatchManager> pm = {},
+                                           std::vector<Core::NCE::Patcher>* patches = nullptr,
+                                           s32 patch_index = -1);
+
     LoadResult Load(Kernel::KProcess& process, Core::System& system) override;
 
     ResultStatus ReadNSOModules(Modules& out_modules) override;
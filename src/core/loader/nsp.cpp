@@ -136,28 +136,18 @@ ResultStatus AppLoader_NSP::VerifyIntegrity(std::function<bool(size_t, size_t)>
     // Get list of all NCAs.
     const auto ncas = nsp->GetNCAsCollapsed();
 
-    size_t total_size = 0;
-    size_t processed_size = 0;
-
-    // Loop over NCAs, collecting the total size to verify.
+    std::vector<FileSys::VirtualFile> nca_files;
+    nca_files.reserve(ncas.size());
     for (const auto& nca : ncas) {
-        total_size += nca->GetBaseFile()->GetSize();
+        nca_files.push_back(nca->GetBaseFile());
     }
 
-    // Loop over NCAs again, verifying each.
-    for (const auto& nca : ncas) {
-        AppLoader_NCA loader_nca(nca->GetBaseFile());
-
-        const auto NcaProgressCallback = [&](size_t nca_processed_size, size_t nca_total_size) {
-            return progress_callback(processed_size + nca_processed_size, total_size);
-        };
-
-        const auto verification_result = loader_nca.VerifyIntegrity(NcaProgressCallback);
+    // Verify the NCAs, reporting the first failure.
+    for (const auto verification_result :
+         AppLoader_NCA::VerifyIntegrity(nca_files, progress_callback)) {
         if (verification_result != ResultStatus::Success) {
             return verification_result;
         }
-
-        processed_size += nca->GetBaseFile()->GetSize();
     }
 
     return ResultStatus::Success;
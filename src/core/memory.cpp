@@ -64,6 +64,11 @@ struct Memory::Impl {
 #endif
     }
 
+    void SetCurrentPageTable(Common::PageTable& page_table) {
+        current_page_table = &page_table;
+        current_page_table->fastmem_arena = nullptr;
+    }
+
     void MapMemoryRegion(Common::PageTable& page_table, Common::ProcessAddress base, u64 size,
                          Common::PhysicalAddress target, Common::MemoryPermission perms,
                          bool separate_heap) {
@@ -654,21 +659,20 @@ struct Memory::Impl {
                 base += 1;
             }
         } else {
-            auto orig_base = base;
-            while (base != end) {
-                auto host_ptr =
-                    reinterpret_cast<uintptr_t>(system.DeviceMemory().GetPointer<u8>(target)) -
-                    (base << YUZU_PAGEBITS);
-                auto backing = GetInteger(target) - (base << YUZU_PAGEBITS);
-                page_table.pointers[base].Store(host_ptr, type);
-                page_table.backing_addr[base] = backing;
-                page_table.blocks[base] = orig_base << YUZU_PAGEBITS;
+            // Entries are stored relative to the page address, so they are the same for every page
+            // of a physically contiguous region. Large heaps map millions of pages through here.
+            u8* const target_ptr = system.DeviceMemory().GetPointer<u8>(target);
+            ASSERT_MSG(target_ptr != nullptr,
+                       "memory mapping base yield a nullptr within the table");
 
-                ASSERT_MSG(page_table.pointers[base].Pointer(),
-                           "memory mapping base yield a nullptr within the table");
+            const auto host_ptr = reinterpret_cast<uintptr_t>(target_ptr) - (base << YUZU_PAGEBITS);
+            const auto backing = GetInteger(target) - (base << YUZU_PAGEBITS);
+            const auto block = base << YUZU_PAGEBITS;
 
-                base += 1;
-                target += YUZU_PAGESIZE;
+            for (; base != end; ++base) {
+                page_table.pointers[base].Store(host_ptr, type);
+                page_table.backing_addr[base] = backing;
+                page_table.blocks[base] = block;
             }
         }
     }
@@ -908,6 +912,10 @@ void Memory::SetCurrentPageTable(Kernel::KProcess& process) {
     impl->SetCurrentPageTable(process);
 }
 
+void Memory::SetCurrentPageTable(Common::PageTable& page_table) {
+    impl->SetCurrentPageTable(page_table);
+}
+
 void Memory::MapMemoryRegion(Common::PageTable& page_table, Common::ProcessAddress base, u64 size,
                              Common::PhysicalAddress target, Common::MemoryPermission perms,
                              bool separate_heap) {
@@ -1069,6 +1077,16 @@ Result Memory::FlushDataCache(Common::ProcessAddress dest_addr, const std::size_
     return impl->FlushDataCache(dest_addr, size);
 }
 
+void Memory::FlushRegion(Common::ProcessAddress dest_addr, const std::size_t size) {
+    // Same as dc ivac, GPU flush -> CPU invalidate
+    static_cast<void>(impl->InvalidateDataCache(dest_addr, size));
+}
+
+void Memory::InvalidateRegion(Common::ProcessAddress dest_addr, const std::size_t size) {
+    // Same as dc cvac, CPU flush -> GPU invalidate
+    static_cast<void>(impl->StoreDataCache(dest_addr, size));
+}
+
 void Memory::RasterizerMarkRegionCached(Common::ProcessAddress vaddr, u64 size, bool cached) {
     impl->RasterizerMarkRegionCached(GetInteger(vaddr), size, cached);
 }
@@ -76,6 +76,14 @@ public:
      */
     void SetCurrentPageTable(Kernel::KProcess& process);
 
+    /**
+     * Changes the currently active page table to one that isn't owned by a process, such as one
+     * built by a tool replaying guest memory outside of emulation. Fastmem is not used with it.
+     *
+     * @param page_table The page table to use.
+     */
+    void SetCurrentPageTable(Common::PageTable& page_table);
+
     /**
      * Maps an allocated buffer onto a region of the emulated process address space.
      *
@@ -465,6 +473,22 @@ public:
      */
     Result FlushDataCache(Common::ProcessAddress dest_addr, std::size_t size);
 
+    /**
+     * Downloads GPU modifications of a range before it's read in place, like through GetSpan.
+     *
+     * @param dest_addr The virtual address of the range.
+     * @param size      The size of the range, in bytes.
+     */
+    void FlushRegion(Common::ProcessAddress dest_addr, std::size_t size);
+
+    /**
+     * Invalidates GPU caches of a range after it's been written in place, like through GetSpan.
+     *
+     * @param dest_addr The virtual address of the range.
+     * @param size      The size of the range, in bytes.
+     */
+    void InvalidateRegion(Common::ProcessAddress dest_addr, std::size_t size);
+
     /**
      * Marks each page within the specified address range as cached or uncached.
      *
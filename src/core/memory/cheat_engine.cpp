@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
 #include <locale>
 #include "common/hex_util.h"
 #include "common/microprofile.h"
@@ -65,6 +66,16 @@ void StandardVmCallbacks::MemoryWriteUnsafe(VAddr address, const void* data, u64
         return;
     }
 
+    // Cheats rewrite the same values every frame, skipping unchanged values avoids invalidating
+    // the JIT code cache of the range on every run
+    if (size <= sizeof(u64)) {
+        u64 current{};
+        system.ApplicationMemory().ReadBlock(address, &current, size);
+        if (std::memcmp(&current, data, size) == 0) {
+            return;
+        }
+    }
+
     if (system.ApplicationMemory().WriteBlock(address, data, size)) {
         Core::InvalidateInstructionCacheRange(system.ApplicationProcess(), address, size);
     }
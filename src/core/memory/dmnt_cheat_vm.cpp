@@ -634,31 +634,57 @@ bool DmntCheatVm::DecodeNextOpcode(CheatVmOpcode& out) {
     return valid;
 }
 
-void DmntCheatVm::SkipConditionalBlock(bool is_if) {
-    if (condition_depth > 0) {
-        // We want to continue until we're out of the current block.
-        const std::size_t desired_depth = condition_depth - 1;
+void DmntCheatVm::DecodeProgram() {
+    decoded_program.clear();
 
-        CheatVmOpcode skip_opcode{};
-        while (condition_depth > desired_depth && DecodeNextOpcode(skip_opcode)) {
-            // Decode instructions until we see end of the current conditional block.
-            // NOTE: This is broken in gateway's implementation.
-            // Gateway currently checks for "0x2" instead of "0x20000000"
-            // In addition, they do a linear scan instead of correctly decoding opcodes.
-            // This causes issues if "0x2" appears as an immediate in the conditional block...
+    // Decoding stops at the first invalid opcode, execution ends there like it did when opcodes
+    // were decoded while executing
+    ResetState();
+    CheatVmOpcode opcode{};
+    while (DecodeNextOpcode(opcode)) {
+        decoded_program.push_back({.opcode = opcode});
+    }
+    for (std::size_t index = 0; index < decoded_program.size(); ++index) {
+        DecodedOpcode& decoded = decoded_program[index];
+        if (decoded.opcode.begin_conditional_block) {
+            std::tie(decoded.skip_target, decoded.skip_to_else) = FindBlockEnd(index + 1, true);
+        } else if (const auto end_cond = std::get_if<EndConditionalOpcode>(&decoded.opcode.opcode);
+                   end_cond && end_cond->is_else) {
+            std::tie(decoded.skip_target, decoded.skip_to_else) = FindBlockEnd(index + 1, false);
+        }
+    }
+    ResetState();
+}
 
-            // We also support nesting of conditional blocks, and Gateway does not.
-            if (skip_opcode.begin_conditional_block) {
-                condition_depth++;
-            } else if (auto end_cond = std::get_if<EndConditionalOpcode>(&skip_opcode.opcode)) {
-                if (!end_cond->is_else) {
-                    condition_depth--;
-                } else if (is_if && condition_depth - 1 == desired_depth) {
-                    break;
+std::pair<std::size_t, bool> DmntCheatVm::FindBlockEnd(std::size_t start, bool is_if) const {
+    // Walk until we're out of the current block.
+    // NOTE: This is broken in gateway's implementation.
+    // Gateway currently checks for "0x2" instead of "0x20000000"
+    // In addition, they do a linear scan instead of correctly decoding opcodes.
+    // This causes issues if "0x2" appears as an immediate in the conditional block...
+
+    // We also support nesting of conditional blocks, and Gateway does not.
+    std::size_t depth = 1;
+    for (std::size_t index = start; index < decoded_program.size(); ++index) {
+        const CheatVmOpcode& opcode = decoded_program[index].opcode;
+        if (opcode.begin_conditional_block) {
+            depth++;
+        } else if (auto end_cond = std::get_if<EndConditionalOpcode>(&opcode.opcode)) {
+            if (!end_cond->is_else) {
+                if (--depth == 0) {
+                    return {index + 1, false};
                 }
+            } else if (is_if && depth == 1) {
+                return {index + 1, true};
             }
         }
-    } else {
+    }
+    // The block runs to the end of the program
+    return {decoded_program.size(), false};
+}
+
+void DmntCheatVm::SkipConditionalBlock(const DecodedOpcode& decoded) {
+    if (condition_depth == 0) {
         // Skipping, but condition_depth = 0.
         // This is an error condition.
         // However, I don't actually believe it is possible for this to happen.
@@ -666,6 +692,10 @@ void DmntCheatVm::SkipConditionalBlock(bool is_if) {
         // in the event that someone triggers it? I don't know how you'd do that.
         UNREACHABLE_MSG("Invalid condition depth in DMNT Cheat VM");
     }
+    instruction_ptr = decoded.skip_target;
+    if (!decoded.skip_to_else) {
+        condition_depth--;
+    }
 }
 
 u64 DmntCheatVm::GetVmInt(VmInt value, u32 bit_width) {
@@ -726,12 +756,11 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
         }
     }
 
+    DecodeProgram();
     return true;
 }
 
 void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
-    CheatVmOpcode cur_opcode{};
-
     // Get Keys down.
     u64 kDown = callbacks->HidKeysDown();
 
@@ -743,8 +772,14 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
     // Clear VM state.
     ResetState();
 
-    // Loop until program finishes.
-    while (DecodeNextOpcode(cur_opcode)) {
+    // Loop until program finishes. The instruction pointer indexes the decoded opcodes.
+    while (instruction_ptr < decoded_program.size()) {
+        const DecodedOpcode& decoded = decoded_program[instruction_ptr++];
+        const CheatVmOpcode& cur_opcode = decoded.opcode;
+
+#ifdef _DEBUG
+        // Tracing every opcode formats dozens of strings per opcode, it costs more than running
+        // the program
         callbacks->CommandLog(
             fmt::format("Instruction Ptr: {:04X}", static_cast<u32>(instruction_ptr)));
 
@@ -756,6 +791,7 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
             callbacks->CommandLog(fmt::format("SavedRegs[{:02X}]: {:016X}", i, saved_values[i]));
         }
         LogOpcode(cur_opcode);
+#endif
 
         // Increment conditional depth, if relevant.
         if (cur_opcode.begin_conditional_block) {
@@ -814,12 +850,12 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
             }
             // Skip conditional block if condition not met.
             if (!cond_met) {
-                SkipConditionalBlock(true);
+                SkipConditionalBlock(decoded);
             }
         } else if (auto end_cond = std::get_if<EndConditionalOpcode>(&cur_opcode.opcode)) {
             if (end_cond->is_else) {
                 /* Skip to the end of the conditional block. */
-                this->SkipConditionalBlock(false);
+                SkipConditionalBlock(decoded);
             } else {
                 /* Decrement the condition depth. */
                 /* We will assume, graciously, that mismatched conditional block ends are a nop. */
@@ -933,7 +969,7 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
             // Check for keypress.
             if ((begin_keypress_cond->key_mask & kDown) != begin_keypress_cond->key_mask) {
                 // Keys not pressed. Skip conditional block.
-                SkipConditionalBlock(true);
+                SkipConditionalBlock(decoded);
             }
         } else if (auto perform_math_reg =
                        std::get_if<PerformArithmeticRegisterOpcode>(&cur_opcode.opcode)) {
@@ -1142,7 +1178,7 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
 
             // Skip conditional block if condition not met.
             if (!cond_met) {
-                SkipConditionalBlock(true);
+                SkipConditionalBlock(decoded);
             }
         } else if (auto save_restore_reg =
                        std::get_if<SaveRestoreRegisterOpcode>(&cur_opcode.opcode)) {
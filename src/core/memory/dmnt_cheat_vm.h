@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <utility>
 #include <variant>
 #include <vector>
 #include <fmt/printf.h>
@@ -296,8 +297,18 @@ public:
     void Execute(const CheatProcessMetadata& metadata);
 
 private:
+    /// Opcode decoded once when the program is loaded, it is executed every frame
+    struct DecodedOpcode {
+        CheatVmOpcode opcode;
+        /// Index of the opcode executed after skipping the block of a condition or an else
+        std::size_t skip_target{};
+        /// True when the skip lands after an else, still inside the conditional block
+        bool skip_to_else{};
+    };
+
     std::unique_ptr<Callbacks> callbacks;
 
+    std::vector<DecodedOpcode> decoded_program;
     std::size_t num_opcodes = 0;
     std::size_t instruction_ptr = 0;
     std::size_t condition_depth = 0;
@@ -309,7 +320,9 @@ private:
     std::array<std::size_t, NumRegisters> loop_tops{};
 
     bool DecodeNextOpcode(CheatVmOpcode& out);
-    void SkipConditionalBlock(bool is_if);
+    void DecodeProgram();
+    std::pair<std::size_t, bool> FindBlockEnd(std::size_t start, bool is_if) const;
+    void SkipConditionalBlock(const DecodedOpcode& decoded);
     void ResetState();
 
     // For implementing the DebugLog opcode.
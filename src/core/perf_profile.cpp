@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <initializer_list>
+#include <type_traits>
+
+#include <fmt/format.h>
+
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "core/perf_profile.h"
+#include "core/perf_stats.h"
+
+namespace Core {
+
+namespace {
+/// Relative difference between two runs considered noise
+constexpr double Tolerance = 0.02;
+
+/// Emulation speed above which a title is considered to run at full speed
+constexpr double FullSpeed = 0.98;
+
+template <typename Type>
+std::string Serialize(Type value) {
+    if constexpr (std::is_same_v<Type, bool>) {
+        return value ? "true" : "false";
+    } else {
+        return std::to_string(static_cast<u32>(value));
+    }
+}
+
+template <typename Type, bool ranged>
+PerfProfileDimension MakeDimension(const Settings::SwitchableSetting<Type, ranged>& setting,
+                                   std::initializer_list<Type> values, bool lowers_quality) {
+    PerfProfileDimension dimension{
+        .label = setting.GetLabel(),
+        .current = setting.ToString(),
+        .values = {},
+        .lowers_quality = lowers_quality,
+    };
+    for (const Type value : values) {
+        dimension.values.push_back(Serialize(value));
+    }
+    return dimension;
+}
+
+/// Compares two values, returns a negative number when lhs is meaningfully lower
+int Compare(double lhs, double rhs) {
+    if (lhs < rhs * (1.0 - Tolerance)) {
+        return -1;
+    }
+    if (lhs > rhs * (1.0 + Tolerance)) {
+        return 1;
+    }
+    return 0;
+}
+} // Anonymous namespace
+
+void PerfProfile::Set(const std::string& label, const std::string& value) {
+    const auto it = std::ranges::find(values, label, &std::pair<std::string, std::string>::first);
+    if (it != values.end()) {
+        it->second = value;
+    } else {
+        values.emplace_back(label, value);
+    }
+}
+
+std::string PerfProfile::Describe() const {
+    if (values.empty()) {
+        return "current settings";
+    }
+    std::string description;
+    for (const auto& [label, value] : values) {
+        if (!description.empty()) {
+            description += ", ";
+        }
+        description += fmt::format("{}={}", label, value);
+    }
+    return description;
+}
+
+bool IsFasterProfile(const PerfProfileMetrics& lhs, const PerfProfileMetrics& rhs) {
+    if (const int fps = Compare(lhs.average_game_fps, rhs.average_game_fps); fps != 0) {
+        return fps > 0;
+    }
+    // Same frame rate, prefer smoother frame pacing and then more headroom
+    if (const int low = Compare(lhs.low_1_percent, rhs.low_1_percent); low != 0) {
+        return low < 0;
+    }
+    return Compare(lhs.frametime, rhs.frametime) < 0;
+}
+
+void PerfProfileRecorder::AddSample(const PerfStatsResults& results) {
+    sums.average_game_fps += results.average_game_fps;
+    sums.emulation_speed += results.emulation_speed;
+    sums.frametime += results.frametime;
+    sums.low_1_percent = std::max(sums.low_1_percent, results.frame_times.low_1_percent);
+    sums.stutters += results.frame_times.stutters;
+    ++sums.num_samples;
+}
+
+PerfProfileMetrics PerfProfileRecorder::GetMetrics() const {
+    if (sums.num_samples == 0) {
+        return {};
+    }
+    const double count = static_cast<double>(sums.num_samples);
+    return PerfProfileMetrics{
+        .average_game_fps = sums.average_game_fps / count,
+        .emulation_speed = sums.emulation_speed / count,
+        .frametime = sums.frametime / count,
+        .low_1_percent = sums.low_1_percent,
+        .stutters = sums.stutters,
+        .num_samples = sums.num_samples,
+    };
+}
+
+PerfProfileTuner::PerfProfileTuner(std::vector<PerfProfileDimension> dimensions_)
+    : dimensions{std::move(dimensions_)} {}
+
+std::optional<PerfProfile> PerfProfileTuner::Next() {
+    if (!best_metrics) {
+        // Benchmark the current configuration first
+        pending = PerfProfile{};
+        return pending;
+    }
+    while (dimension_index < dimensions.size()) {
+        const PerfProfileDimension& dimension = dimensions[dimension_index];
+        const bool skip = dimension.lowers_quality && best_metrics->emulation_speed >= FullSpeed;
+        if (skip || value_index == dimension.values.size()) {
+            ++dimension_index;
+            value_index = 0;
+            continue;
+        }
+        const std::string& value = dimension.values[value_index++];
+        if (value == dimension.current) {
+            continue;
+        }
+        pending = best;
+        pending->Set(dimension.label, value);
+        return pending;
+    }
+    pending.reset();
+    return std::nullopt;
+}
+
+void PerfProfileTuner::Report(const PerfProfileMetrics& metrics) {
+    if (!pending) {
+        return;
+    }
+    if (!best_metrics || IsFasterProfile(metrics, *best_metrics)) {
+        best = std::move(*pending);
+        best_metrics = metrics;
+    }
+    pending.reset();
+}
+
+std::vector<PerfProfileDimension> GetPerfProfileDimensions() {
+    using namespace Settings;
+    auto& values = Settings::values;
+    return {
+        MakeDimension(values.gpu_accuracy, {GpuAccuracy::Normal, GpuAccuracy::High}, false),
+        MakeDimension(values.use_asynchronous_shaders, {false, true}, false),
+        MakeDimension(values.accelerate_astc,
+                      {AstcDecodeMode::Cpu, AstcDecodeMode::Gpu, AstcDecodeMode::CpuAsynchronous},
+                      false),
+        MakeDimension(values.nvdec_emulation, {NvdecEmulation::Cpu, NvdecEmulation::Gpu}, false),
+        MakeDimension(values.cpu_accuracy, {CpuAccuracy::Auto, CpuAccuracy::Unsafe}, true),
+        MakeDimension(values.resolution_setup,
+                      {ResolutionSetup::Res3_4X, ResolutionSetup::Res1_2X}, true),
+    };
+}
+
+bool ApplyPerfProfile(const PerfProfile& profile) {
+    bool applied_all = true;
+    for (const auto& [label, value] : profile.values) {
+        const auto it = Settings::values.linkage.by_key.find(label);
+        if (it == Settings::values.linkage.by_key.end() || !it->second->Switchable()) {
+            LOG_WARNING(Core, "Performance profile sets unknown setting {}", label);
+            applied_all = false;
+            continue;
+        }
+        it->second->SetGlobal(false);
+        it->second->LoadString(value);
+    }
+    return applied_all;
+}
+
+} // namespace Core
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Core {
+
+struct PerfStatsResults;
+
+/// Setting values applied on top of the configuration of a title
+struct PerfProfile {
+    /// Labels of the settings, as used by the config files, and their serialized values
+    std::vector<std::pair<std::string, std::string>> values;
+
+    /// Assigns a value to a setting, replacing the previous one
+    void Set(const std::string& label, const std::string& value);
+
+    /// Returns a readable list of the values for logging
+    [[nodiscard]] std::string Describe() const;
+};
+
+/// Performance of a profile, averaged over the samples taken while it ran
+struct PerfProfileMetrics {
+    double average_game_fps{};
+    double emulation_speed{};
+    /// Walltime per system frame excluding waits, in seconds. Lower leaves more headroom
+    double frametime{};
+    /// Worst 1% low frame time of the samples, in seconds
+    double low_1_percent{};
+    u64 stutters{};
+    u64 num_samples{};
+};
+
+/// Returns true when the metrics of a profile are meaningfully better than another ones
+[[nodiscard]] bool IsFasterProfile(const PerfProfileMetrics& lhs, const PerfProfileMetrics& rhs);
+
+/// Accumulates the performance statistics sampled while a profile runs
+class PerfProfileRecorder {
+public:
+    /// Adds the statistics since the previous sample
+    void AddSample(const PerfStatsResults& results);
+
+    [[nodiscard]] PerfProfileMetrics GetMetrics() const;
+
+private:
+    PerfProfileMetrics sums;
+};
+
+/// Setting the tuner tries different values of
+struct PerfProfileDimension {
+    std::string label;
+    /// Value in the configuration being tuned, it is not benchmarked again
+    std::string current;
+    std::vector<std::string> values;
+    /// Trades image quality or accuracy for speed, only tried while the title misses full speed
+    bool lowers_quality;
+};
+
+/**
+ * Searches for the fastest combination of setting values. The current configuration is
+ * benchmarked first, then every dimension in order tries its values on top of the best profile
+ * found so far. This takes one run per value instead of one per combination.
+ */
+class PerfProfileTuner {
+public:
+    explicit PerfProfileTuner(std::vector<PerfProfileDimension> dimensions_);
+
+    /**
+     * Returns the profile to benchmark next, std::nullopt once the search is over.
+     * Its metrics have to be reported before asking for another profile.
+     */
+    [[nodiscard]] std::optional<PerfProfile> Next();
+
+    /// Records the metrics of the last profile returned by Next
+    void Report(const PerfProfileMetrics& metrics);
+
+    [[nodiscard]] const PerfProfile& Best() const noexcept {
+        return best;
+    }
+
+    [[nodiscard]] const std::optional<PerfProfileMetrics>& BestMetrics() const noexcept {
+        return best_metrics;
+    }
+
+private:
+    std::vector<PerfProfileDimension> dimensions;
+    std::size_t dimension_index{};
+    std::size_t value_index{};
+    PerfProfile best;
+    std::optional<PerfProfileMetrics> best_metrics;
+    std::optional<PerfProfile> pending;
+};
+
+/// Returns the settings worth tuning with their current values: GPU and CPU accuracy,
+/// asynchronous shaders, ASTC decoding, NVDEC emulation and the resolution scale
+[[nodiscard]] std::vector<PerfProfileDimension> GetPerfProfileDimensions();
+
+/**
+ * Applies a profile as per-game values of the settings.
+ *
+ * @returns false when the profile names a setting that doesn't exist or can't be set per-game
+ */
+bool ApplyPerfProfile(const PerfProfile& profile);
+
+} // namespace Core
@@ -7,9 +7,14 @@
 #include <mutex>
 #include <numeric>
 #include <sstream>
+#include <string>
 #include <thread>
+#include <utility>
 #include <fmt/chrono.h>
 #include <fmt/format.h>
+#ifdef ANDROID
+#include "common/android/performance_governor.h"
+#endif
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
@@ -25,8 +30,42 @@ using std::chrono::microseconds;
 // booting that we shouldn't account for
 constexpr std::size_t IgnoreFrames = 5;
 
+// Longest delay low latency mode adds before a system frame, a frame at 30 FPS
+constexpr auto MaxLatencyDelay = 33ms;
+
+// A frame taking this many times the running average is counted as a stutter
+constexpr double StutterRatio = 2.0;
+
+// Input kept waiting for a displayed frame, older input is dropped when presentation stalls
+constexpr std::size_t MaxPendingInputs = 64;
+
 namespace Core {
 
+namespace {
+std::string FormatHistogram(const FrameTimeHistogram& histogram) {
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    const auto ms = [](std::chrono::nanoseconds time) { return Milliseconds(time).count(); };
+
+    std::string json = fmt::format(
+        R"({{"frames":{},"p50_ms":{:.3f},"p90_ms":{:.3f},"p99_ms":{:.3f},"p99_9_ms":{:.3f},)"
+        R"("max_ms":{:.3f},"bucket_width_ms":{:.3f},"buckets":[)",
+        histogram.Count(), ms(histogram.Percentile(50.0)), ms(histogram.Percentile(90.0)),
+        ms(histogram.Percentile(99.0)), ms(histogram.Percentile(99.9)), ms(histogram.Max()),
+        Milliseconds(FrameTimeHistogram::BucketWidth).count());
+    // Trailing empty buckets are left out, the last one listed is the overflow bucket if it has any
+    std::size_t size = FrameTimeHistogram::NumBuckets + 1;
+    while (size > 0 && histogram.BucketCount(size - 1) == 0) {
+        --size;
+    }
+    for (std::size_t index = 0; index < size; ++index) {
+        fmt::format_to(std::back_inserter(json), "{}{}", index == 0 ? "" : ",",
+                       histogram.BucketCount(index));
+    }
+    json += "]}";
+    return json;
+}
+} // Anonymous namespace
+
 PerfStats::PerfStats(u64 title_id_) : title_id(title_id_) {}
 
 PerfStats::~PerfStats() {
@@ -49,6 +88,10 @@ PerfStats::~PerfStats() {
                                 Common::FS::FileType::TextFile);
         void(file.WriteString(stream.str()));
     }
+
+    const auto report_filename =
+        fmt::format("{:%F-%H-%M}_{:016X}_histogram.json", *std::localtime(&t), title_id);
+    void(WriteFrameTimeReport(path / report_filename));
 }
 
 void PerfStats::BeginSystemFrame() {
@@ -68,6 +111,44 @@ void PerfStats::EndSystemFrame() {
     }
     accumulated_frametime += frame_time;
     system_frames += 1;
+#ifdef ANDROID
+    // Lets the system raise the clocks before frames start missing the target of the speed limit
+    const bool limited = Settings::values.use_speed_limit.GetValue() &&
+                         Settings::values.speed_limit.GetValue() > 0;
+    const double speed = limited ? Settings::values.speed_limit.GetValue() / 100.0 : 1.0;
+    Common::Android::GetPerformanceGovernor().ReportFrame(
+        duration_cast<std::chrono::nanoseconds>(DoubleSecs{1.0 / (60.0 * speed)}), frame_time);
+#endif
+
+    const std::chrono::nanoseconds gpu_busy{
+        frame_gpu_busy_ns.exchange(0, std::memory_order_relaxed)};
+    const std::chrono::nanoseconds cpu_wait{
+        frame_cpu_wait_ns.exchange(0, std::memory_order_relaxed)};
+    const auto present_wait = std::exchange(frame_present_wait, Clock::duration::zero());
+    if (current_index > IgnoreFrames) {
+        // The GPU bounds the frame when executing its commands and waiting on the host GPU took
+        // longer than the work the emulated CPU did without waiting for it
+        const auto cpu_work = std::max<Clock::duration>(frame_time - cpu_wait, {});
+        const bool gpu_bound = gpu_busy + present_wait > cpu_work;
+        const auto bound = gpu_bound ? FrameBound::Gpu : FrameBound::Cpu;
+        session_histograms[static_cast<std::size_t>(FrameBound::Any)].Add(frame_time);
+        session_histograms[static_cast<std::size_t>(bound)].Add(frame_time);
+        interval_histogram.Add(frame_time);
+        if (gpu_bound) {
+            ++gpu_bound_frames;
+        } else {
+            ++cpu_bound_frames;
+        }
+
+        const double frame_ms = std::chrono::duration<double, std::milli>(frame_time).count();
+        if (average_frametime_ms > 0 && frame_ms > average_frametime_ms * StutterRatio) {
+            ++stutters;
+            session_stutters.fetch_add(1, std::memory_order_relaxed);
+        }
+        average_frametime_ms = average_frametime_ms == 0
+                                   ? frame_ms
+                                   : average_frametime_ms + (frame_ms - average_frametime_ms) / 16;
+    }
 
     previous_frame_length = frame_end - previous_frame_end;
     previous_frame_end = frame_end;
@@ -75,6 +156,7 @@ void PerfStats::EndSystemFrame() {
 
 void PerfStats::EndGameFrame() {
     game_frames.fetch_add(1, std::memory_order_relaxed);
+    total_game_frames.fetch_add(1, std::memory_order_relaxed);
 }
 
 double PerfStats::GetMeanFrametime() const {
@@ -99,12 +181,38 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     const auto system_us_per_second = (current_system_time_us - reset_point_system_us) / interval;
     const auto current_frames = static_cast<double>(game_frames.load(std::memory_order_relaxed));
     const auto current_fps = current_frames / interval;
+    const double present_latency =
+        presented_frames == 0 ? 0.0
+                              : duration_cast<DoubleSecs>(accumulated_present_latency).count() /
+                                    static_cast<double>(presented_frames);
+    // Input is sampled around the start of a system frame and the frame is composited at its end
+    const double system_frame_length =
+        system_frames == 0 ? 0.0 : interval / static_cast<double>(system_frames);
     const PerfStatsResults results{
         .system_fps = static_cast<double>(system_frames) / interval,
         .average_game_fps = (current_fps + previous_fps) / 2.0,
         .frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                      static_cast<double>(system_frames),
         .emulation_speed = system_us_per_second.count() / 1'000'000.0,
+        .present_latency = present_latency,
+        .input_latency = present_latency == 0.0 ? 0.0 : system_frame_length + present_latency,
+        .frame_times{
+            .low_1_percent = duration_cast<DoubleSecs>(interval_histogram.Percentile(99.0)).count(),
+            .low_0_1_percent =
+                duration_cast<DoubleSecs>(interval_histogram.Percentile(99.9)).count(),
+            .stutters = stutters,
+            .cpu_bound_frames = cpu_bound_frames,
+            .gpu_bound_frames = gpu_bound_frames,
+        },
+        .measured_input_latency{
+            .samples = input_present_histogram.Count(),
+            .sampling_p50 =
+                duration_cast<DoubleSecs>(input_sampling_histogram.Percentile(50.0)).count(),
+            .present_p50 =
+                duration_cast<DoubleSecs>(input_present_histogram.Percentile(50.0)).count(),
+            .present_p99 =
+                duration_cast<DoubleSecs>(input_present_histogram.Percentile(99.0)).count(),
+        },
     };
 
     // Reset counters
@@ -114,6 +222,14 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     system_frames = 0;
     game_frames.store(0, std::memory_order_relaxed);
     previous_fps = current_fps;
+    accumulated_present_latency = Clock::duration::zero();
+    presented_frames = 0;
+    interval_histogram.Reset();
+    input_sampling_histogram.Reset();
+    input_present_histogram.Reset();
+    stutters = 0;
+    cpu_bound_frames = 0;
+    gpu_bound_frames = 0;
 
     return results;
 }
@@ -125,6 +241,112 @@ double PerfStats::GetLastFrameTimeScale() const {
     return duration_cast<DoubleSecs>(previous_frame_length).count() / FRAME_LENGTH;
 }
 
+void PerfStats::AddPresentLatency(std::chrono::nanoseconds latency) {
+    std::scoped_lock lock{object_mutex};
+
+    const auto now = Clock::now();
+    if (!pending_inputs.empty()) {
+        // Input written after this frame was composited has to wait for a later one
+        const auto composite_time = now - latency;
+        const auto first_pending =
+            std::ranges::find_if(pending_inputs, [composite_time](const PendingInput& input) {
+                return input.written_time > composite_time;
+            });
+        for (auto it = pending_inputs.begin(); it != first_pending; ++it) {
+            input_present_histogram.Add(now - it->input_time);
+        }
+        pending_inputs.erase(pending_inputs.begin(), first_pending);
+    }
+
+    accumulated_present_latency += latency;
+    presented_frames += 1;
+}
+
+void PerfStats::AddInputWritten(Clock::time_point input_time, Clock::time_point written_time) {
+    std::scoped_lock lock{object_mutex};
+
+    if (pending_inputs.size() == MaxPendingInputs) {
+        pending_inputs.erase(pending_inputs.begin());
+    }
+    pending_inputs.push_back({input_time, written_time});
+    input_sampling_histogram.Add(written_time - input_time);
+}
+
+void PerfStats::AddPresentWait(std::chrono::nanoseconds wait) {
+    std::scoped_lock lock{object_mutex};
+
+    pending_present_wait += wait;
+    frame_present_wait += wait;
+}
+
+void PerfStats::AddGpuBusyTime(std::chrono::nanoseconds busy) {
+    frame_gpu_busy_ns.fetch_add(busy.count(), std::memory_order_relaxed);
+}
+
+void PerfStats::AddCpuWaitTime(std::chrono::nanoseconds wait) {
+    frame_cpu_wait_ns.fetch_add(wait.count(), std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds PerfStats::GetFrameTimePercentile(double percentile,
+                                                           FrameBound bound) const {
+    return GetFrameTimeHistogram(bound).Percentile(percentile);
+}
+
+const FrameTimeHistogram& PerfStats::GetFrameTimeHistogram(FrameBound bound) const {
+    return session_histograms[static_cast<std::size_t>(bound)];
+}
+
+u64 PerfStats::GetStutterCount() const {
+    return session_stutters.load(std::memory_order_relaxed);
+}
+
+u64 PerfStats::GetGameFrameCount() const {
+    return total_game_frames.load(std::memory_order_relaxed);
+}
+
+bool PerfStats::WriteFrameTimeReport(const std::filesystem::path& path) const {
+    if (!Common::FS::CreateParentDir(path)) {
+        return false;
+    }
+    Common::FS::IOFile file(path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::TextFile);
+    if (!file.IsOpen()) {
+        return false;
+    }
+    const std::string report = fmt::format(
+        "{{\"title_id\":\"{:016X}\",\"stutters\":{},\"all\":{},\"cpu_bound\":{},"
+        "\"gpu_bound\":{}}}\n",
+        title_id, GetStutterCount(), FormatHistogram(GetFrameTimeHistogram(FrameBound::Any)),
+        FormatHistogram(GetFrameTimeHistogram(FrameBound::Cpu)),
+        FormatHistogram(GetFrameTimeHistogram(FrameBound::Gpu)));
+    return file.WriteString(report) == report.size();
+}
+
+void PerfStats::DoLatencyLimiting() {
+    if (!Settings::values.use_low_latency_mode.GetValue()) {
+        return;
+    }
+    Clock::duration delay;
+    {
+        std::scoped_lock lock{object_mutex};
+
+        // Taking only half of the measured wait lets the delay settle instead of oscillating, as
+        // delaying the frame shortens the next wait. Once the renderer stops waiting the delay
+        // decays slowly, in case frames got heavier.
+        if (pending_present_wait > Clock::duration::zero()) {
+            latency_delay += pending_present_wait / 2;
+        } else {
+            latency_delay -= latency_delay / 16;
+        }
+        latency_delay = std::min<Clock::duration>(latency_delay, MaxLatencyDelay);
+        pending_present_wait = Clock::duration::zero();
+        delay = latency_delay;
+    }
+    if (delay > Clock::duration::zero()) {
+        std::this_thread::sleep_for(delay);
+    }
+}
+
 void SpeedLimiter::DoSpeedLimiting(microseconds current_system_time_us) {
     if (Settings::values.use_multi_core.GetValue() ||
         !Settings::values.use_speed_limit.GetValue()) {
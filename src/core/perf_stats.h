@@ -7,11 +7,58 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <filesystem>
 #include <mutex>
+#include <vector>
 #include "common/common_types.h"
+#include "core/arm/jit_cache_stats.h"
+#include "core/frame_time_histogram.h"
+#include "core/file_sys/fssystem/fssystem_compressed_block_cache_stats.h"
+#include "core/file_sys/vfs/vfs_read_ahead_stats.h"
+#include "core/hardware_properties.h"
+#include "core/hle/kernel/k_scheduler_lock_stats.h"
+#include "core/hle/kernel/physical_core_idle_stats.h"
+#include "video_core/engines/semaphore_wait_stats.h"
+#include "video_core/gpu_thread_queue_stats.h"
+#include "video_core/host1x/syncpoint_wait_stats.h"
+#include "video_core/host1x/video_pipeline_stats.h"
+#include "video_core/texture_cache/texture_cache_stats.h"
 
 namespace Core {
 
+/// Distribution of the system frame times since the last reset
+struct FrameTimeSummary {
+    /// Frame time that 99% of the frames do not exceed, the "1% low", in seconds
+    double low_1_percent;
+    /// Frame time that 99.9% of the frames do not exceed, the "0.1% low", in seconds
+    double low_0_1_percent;
+    /// Frames that took more than twice as long as the running average before them
+    u64 stutters;
+    /// Frames where the emulated CPU took longer than the GPU
+    u64 cpu_bound_frames;
+    /// Frames where the GPU thread and the presentation took longer than the emulated CPU
+    u64 gpu_bound_frames;
+};
+
+/// Distribution of the input latency measured since the last reset, see AddInputWritten
+struct InputLatencySummary {
+    /// Input events that were followed by a presented frame
+    u64 samples;
+    /// Median time from an input event to the HID services writing it to shared memory, in seconds
+    double sampling_p50;
+    /// Median and 99th percentile time from an input event to the first frame presented after
+    /// the game could read it, in seconds
+    double present_p50;
+    double present_p99;
+};
+
+/// What bounded the frames counted by a frame time histogram
+enum class FrameBound {
+    Any,
+    Cpu,
+    Gpu,
+};
+
 struct PerfStatsResults {
     /// System FPS (LCD VBlanks) in Hz
     double system_fps;
@@ -21,6 +68,39 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Average time from a frame being composited to it being displayed, in seconds. Zero when the
+    /// renderer can't measure it
+    double present_latency;
+    /// Estimated time from a system frame starting, and sampling input, to it being displayed, in
+    /// seconds. Zero when the present latency is unknown
+    double input_latency;
+    /// Estimated time from audio being rendered to it being played by the host, in seconds. Zero
+    /// when no audio is playing
+    double audio_latency;
+    /// Frame time percentiles and stutters of the frames since the last reset
+    FrameTimeSummary frame_times;
+    /// Measured input latency since the last reset, when it is being recorded
+    InputLatencySummary measured_input_latency;
+    /// Texture cache work summed over the frames rendered since the last reset
+    VideoCommon::TextureCacheFrameStats texture_cache;
+    /// Global scheduler lock usage since the last reset, when it is being recorded
+    Kernel::KSchedulerLockStats scheduler_lock;
+    /// Host time each emulated core spent idle since the last reset, only measured in multicore
+    std::array<Kernel::PhysicalCoreIdleStats, Hardware::NUM_CPU_CORES> core_idle;
+    /// CPU side waits on GPU syncpoints since the last reset
+    Tegra::Host1x::SyncpointWaitStats syncpoint_wait;
+    /// GPU side waits on semaphore acquires since the last reset
+    Tegra::Engines::SemaphoreWaitStats semaphore_wait;
+    /// Commands handed to the GPU thread since the last reset, only counted in async GPU mode
+    VideoCommon::GPUThread::QueueStats gpu_thread_queue;
+    /// Video decoding and conversion done by the Host1x engines since the last reset
+    Tegra::Host1x::VideoPipelineStats video_pipeline;
+    /// RomFS read ahead cache lookups and waits on storage since the last reset
+    FileSys::ReadAheadStats read_ahead;
+    /// Decompressed block cache lookups of compressed NCA sections since the last reset
+    FileSys::CompressedBlockCacheStats compressed_block_cache;
+    /// Code cache activity of the CPU JITs since the last reset
+    JitCacheStats jit_cache;
 };
 
 /**
@@ -51,6 +131,60 @@ public:
      */
     double GetLastFrameTimeScale() const;
 
+    /// Records how long a composited frame took to be displayed. Safe to call from any thread.
+    void AddPresentLatency(std::chrono::nanoseconds latency);
+
+    /**
+     * Records an input event the HID services wrote to shared memory. Its latency is taken when
+     * the first frame composited after the write is displayed, the earliest one the game could
+     * have reacted to it in. How long the game takes to read the input is not known to HLE, so
+     * this is a lower bound when the game reacts a frame later. Safe to call from any thread.
+     */
+    void AddInputWritten(Clock::time_point input_time, Clock::time_point written_time);
+
+    /// Records how long the renderer waited for frames in flight before composing a new one.
+    void AddPresentWait(std::chrono::nanoseconds wait);
+
+    /// Records time the GPU thread spent executing commands. Lock-free, safe to call from any
+    /// thread.
+    void AddGpuBusyTime(std::chrono::nanoseconds busy);
+
+    /// Records time the emulated CPU spent blocked on the GPU. Lock-free, safe to call from any
+    /// thread.
+    void AddCpuWaitTime(std::chrono::nanoseconds wait);
+
+    /**
+     * Returns a percentile of the system frame times of the whole session, see
+     * FrameTimeHistogram::Percentile. Lock-free, safe to call from any thread.
+     */
+    std::chrono::nanoseconds GetFrameTimePercentile(double percentile,
+                                                    FrameBound bound = FrameBound::Any) const;
+
+    /// Returns the system frame times of the whole session, split by what bounded them
+    const FrameTimeHistogram& GetFrameTimeHistogram(FrameBound bound = FrameBound::Any) const;
+
+    /// Returns the number of stutters of the whole session. Lock-free.
+    u64 GetStutterCount() const;
+
+    /// Returns the number of game frames of the whole session. Lock-free.
+    u64 GetGameFrameCount() const;
+
+    /**
+     * Writes the frame time histograms and percentiles of the session as JSON, for monitoring
+     * tools to consume.
+     *
+     * @returns True when the file was written
+     */
+    bool WriteFrameTimeReport(const std::filesystem::path& path) const;
+
+    /**
+     * In low latency mode, delays the start of the next system frame by the time the renderer
+     * spends waiting for the display. The wait moves from the end of the frame to its start, so
+     * input is sampled closer to when the frame is shown. Call between EndSystemFrame and
+     * BeginSystemFrame.
+     */
+    void DoLatencyLimiting();
+
 private:
     mutable std::mutex object_mutex;
 
@@ -73,6 +207,8 @@ private:
     u32 system_frames = 0;
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     std::atomic<u32> game_frames = 0;
+    /// Number of game frames since the session began
+    std::atomic<u64> total_game_frames = 0;
 
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
@@ -82,6 +218,42 @@ private:
     Clock::duration previous_frame_length = Clock::duration::zero();
     /// Previously computed fps
     double previous_fps = 0;
+
+    /// Cumulative present latency of the frames displayed since last reset
+    Clock::duration accumulated_present_latency = Clock::duration::zero();
+    /// Cumulative number of frames with a measured present latency since last reset
+    u32 presented_frames = 0;
+    /// Time the renderer waited for frames in flight since the last latency limiting
+    Clock::duration pending_present_wait = Clock::duration::zero();
+    /// Delay currently applied before the start of each system frame
+    Clock::duration latency_delay = Clock::duration::zero();
+
+    struct PendingInput {
+        Clock::time_point input_time;
+        Clock::time_point written_time;
+    };
+    /// Input written to shared memory that no displayed frame was composited after yet
+    std::vector<PendingInput> pending_inputs;
+    /// Input latency since the last reset
+    FrameTimeHistogram input_sampling_histogram;
+    FrameTimeHistogram input_present_histogram;
+
+    /// Breakdown of the current system frame, taken when it ends
+    std::atomic<s64> frame_gpu_busy_ns{};
+    std::atomic<s64> frame_cpu_wait_ns{};
+    Clock::duration frame_present_wait = Clock::duration::zero();
+
+    /// Frame times of the session, indexed by FrameBound
+    std::array<FrameTimeHistogram, 3> session_histograms;
+    /// Frame times since the last reset
+    FrameTimeHistogram interval_histogram;
+    /// Running average of the frame times, in milliseconds, used to detect stutters
+    double average_frametime_ms = 0;
+    std::atomic<u64> session_stutters = 0;
+    /// Stutters and bounded frames since the last reset
+    u64 stutters = 0;
+    u64 cpu_bound_frames = 0;
+    u64 gpu_bound_frames = 0;
 };
 
 class SpeedLimiter {
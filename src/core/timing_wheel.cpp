@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <tuple>
+#include <utility>
+
+#include "common/assert.h"
+#include "core/timing_wheel.h"
+
+namespace Core::Timing {
+namespace {
+u64 TimeToTick(s64 time) {
+    return static_cast<u64>(std::max<s64>(time, 0)) >> TimingWheel::TICK_SHIFT;
+}
+
+bool IsEarlier(const TimingWheelNode& lhs, const TimingWheelNode& rhs) {
+    return std::tie(lhs.time, lhs.fifo_order) < std::tie(rhs.time, rhs.fifo_order);
+}
+} // Anonymous namespace
+
+TimingWheel::TimingWheel() = default;
+
+TimingWheel::~TimingWheel() = default;
+
+void TimingWheel::Insert(TimingWheelNode* node) {
+    ASSERT(!node->is_linked);
+    Link(node);
+    ++num_nodes;
+}
+
+void TimingWheel::Remove(TimingWheelNode* node) {
+    ASSERT(node->is_linked);
+    Unlink(node);
+    --num_nodes;
+}
+
+TimingWheelNode* TimingWheel::PopExpired(s64 now) {
+    const u64 now_tick{TimeToTick(now)};
+    while (true) {
+        const u32 level{LowestLevel()};
+        if (level == NUM_LEVELS) {
+            return nullptr;
+        }
+        const u32 slot{static_cast<u32>(std::countr_zero(levels[level].occupied))};
+        if (level == 0) {
+            TimingWheelNode* const node{levels[0].heads[slot]};
+            if (node->time > now) {
+                return nullptr;
+            }
+            Remove(node);
+            return node;
+        }
+        // Nothing expires before this slot starts, cascade it when time gets there
+        const u64 start_tick{SlotStartTick(level, slot)};
+        if (start_tick > now_tick) {
+            return nullptr;
+        }
+        current_tick = start_tick;
+        TimingWheelNode* node{std::exchange(levels[level].heads[slot], nullptr)};
+        levels[level].tails[slot] = nullptr;
+        levels[level].occupied &= ~(1ULL << slot);
+        while (node) {
+            TimingWheelNode* const next{node->next};
+            node->is_linked = false;
+            Link(node);
+            node = next;
+        }
+    }
+}
+
+std::optional<s64> TimingWheel::NextTime() const {
+    const u32 level{LowestLevel()};
+    if (level == NUM_LEVELS) {
+        return std::nullopt;
+    }
+    const u32 slot{static_cast<u32>(std::countr_zero(levels[level].occupied))};
+    if (level == 0) {
+        return levels[0].heads[slot]->time;
+    }
+    return static_cast<s64>(SlotStartTick(level, slot) << TICK_SHIFT);
+}
+
+void TimingWheel::Clear() {
+    for (Level& level : levels) {
+        for (TimingWheelNode* head : level.heads) {
+            for (TimingWheelNode* node = head; node; node = node->next) {
+                node->is_linked = false;
+            }
+        }
+        level.heads.fill(nullptr);
+        level.tails.fill(nullptr);
+        level.occupied = 0;
+    }
+    num_nodes = 0;
+}
+
+void TimingWheel::Link(TimingWheelNode* node) {
+    // Expired nodes go to the current tick, they can't be placed behind it
+    const u64 tick{std::max(TimeToTick(node->time), current_tick)};
+    const u64 diff{tick ^ current_tick};
+    const u32 level{diff == 0 ? 0U : static_cast<u32>(std::bit_width(diff) - 1) / SLOT_BITS};
+    const u32 slot{static_cast<u32>(tick >> (level * SLOT_BITS)) & (NUM_SLOTS - 1)};
+
+    // Find the node to insert after, the first level is sorted and the others are appended to
+    TimingWheelNode* prev{levels[level].tails[slot]};
+    if (level == 0) {
+        while (prev && IsEarlier(*node, *prev)) {
+            prev = prev->prev;
+        }
+    }
+    TimingWheelNode*& next_link{prev ? prev->next : levels[level].heads[slot]};
+    TimingWheelNode* const next{next_link};
+    node->prev = prev;
+    node->next = next;
+    next_link = node;
+    (next ? next->prev : levels[level].tails[slot]) = node;
+    levels[level].occupied |= 1ULL << slot;
+
+    node->level = level;
+    node->slot = slot;
+    node->is_linked = true;
+}
+
+void TimingWheel::Unlink(TimingWheelNode* node) {
+    Level& level{levels[node->level]};
+    (node->prev ? node->prev->next : level.heads[node->slot]) = node->next;
+    (node->next ? node->next->prev : level.tails[node->slot]) = node->prev;
+    if (!level.heads[node->slot]) {
+        level.occupied &= ~(1ULL << node->slot);
+    }
+    node->prev = nullptr;
+    node->next = nullptr;
+    node->is_linked = false;
+}
+
+u32 TimingWheel::LowestLevel() const {
+    for (u32 level = 0; level < NUM_LEVELS; ++level) {
+        if (levels[level].occupied != 0) {
+            return level;
+        }
+    }
+    return NUM_LEVELS;
+}
+
+u64 TimingWheel::SlotStartTick(u32 level, u32 slot) const {
+    const u32 shift{level * SLOT_BITS};
+    const u64 upper_mask{~0ULL << (shift + SLOT_BITS)};
+    return (current_tick & upper_mask) | (static_cast<u64>(slot) << shift);
+}
+
+} // namespace Core::Timing
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <optional>
+
+#include "common/common_types.h"
+
+namespace Core::Timing {
+
+/// Intrusive node of a TimingWheel, embedded in the scheduled object
+struct TimingWheelNode {
+    s64 time{};       ///< Expiration time in nanoseconds
+    u64 fifo_order{}; ///< Orders nodes with the same expiration time
+
+    TimingWheelNode* prev{};
+    TimingWheelNode* next{};
+    u32 level{};
+    u32 slot{};
+    bool is_linked{};
+};
+
+/**
+ * Hierarchical timing wheel with nanosecond ordering.
+ *
+ * Nodes are placed on the level of the highest digit where their tick differs from the wheel's
+ * current tick, so the earliest node is always in the lowest non-empty slot of the lowest
+ * non-empty level. Higher level slots are cascaded lazily once time reaches them.
+ *
+ * Slots of the first level are kept sorted, inserting from the back so nodes added in order are
+ * O(1). Other slots append in insertion order, this keeps cascades cheap for the common case of
+ * many events expiring at once. Removal is O(1).
+ *
+ * Nodes are owned by the caller and may be destroyed while linked once the wheel is unused.
+ */
+class TimingWheel {
+public:
+    /// Nanoseconds covered by a slot of the first level, as a power of two
+    static constexpr u32 TICK_SHIFT = 10;
+    static constexpr u32 SLOT_BITS = 6;
+    static constexpr u32 NUM_SLOTS = 1U << SLOT_BITS;
+    /// Enough levels to hold any non-negative s64 time
+    static constexpr u32 NUM_LEVELS = (64 - TICK_SHIFT + SLOT_BITS - 1) / SLOT_BITS;
+
+    explicit TimingWheel();
+    ~TimingWheel();
+
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+
+    /// Inserts a node that is not in the wheel, times in the past expire on the next pop
+    void Insert(TimingWheelNode* node);
+
+    /// Removes a node that is in the wheel
+    void Remove(TimingWheelNode* node);
+
+    /// Removes and returns the earliest node expiring at or before now, ordered by time and then
+    /// by fifo order
+    /// @returns The node, or nullptr when no node has expired
+    [[nodiscard]] TimingWheelNode* PopExpired(s64 now);
+
+    /// Returns a lower bound of the earliest expiration time, exact when it is on the first level
+    [[nodiscard]] std::optional<s64> NextTime() const;
+
+    /// Unlinks every node without touching the current time
+    void Clear();
+
+    [[nodiscard]] bool Empty() const noexcept {
+        return num_nodes == 0;
+    }
+
+    [[nodiscard]] size_t Size() const noexcept {
+        return num_nodes;
+    }
+
+private:
+    struct Level {
+        u64 occupied{};
+        std::array<TimingWheelNode*, NUM_SLOTS> heads{};
+        std::array<TimingWheelNode*, NUM_SLOTS> tails{};
+    };
+
+    /// Links a node on the level given by its tick
+    void Link(TimingWheelNode* node);
+
+    /// Unlinks a node from its slot
+    void Unlink(TimingWheelNode* node);
+
+    /// Returns the lowest non-empty level, or NUM_LEVELS when the wheel is empty
+    [[nodiscard]] u32 LowestLevel() const;
+
+    /// Returns the first tick of a slot on a level above the first one
+    [[nodiscard]] u64 SlotStartTick(u32 level, u32 slot) const;
+
+    std::array<Level, NUM_LEVELS> levels{};
+    u64 current_tick{};
+    size_t num_nodes{};
+};
+
+} // namespace Core::Timing
@@ -47,6 +47,11 @@ void MemoryWriteWidth(Core::Memory::Memory& memory, u32 width, VAddr addr, u64 v
     }
 }
 
+bool IsSameValue(u32 width, u64 lhs, u64 rhs) {
+    const u64 mask = width >= sizeof(u64) ? ~u64{0} : (u64{1} << (width * 8)) - 1;
+    return ((lhs ^ rhs) & mask) == 0;
+}
+
 } // Anonymous namespace
 
 Freezer::Freezer(Core::Timing::CoreTiming& core_timing_, Core::Memory::Memory& memory_)
@@ -167,6 +172,11 @@ void Freezer::FrameCallback(std::chrono::nanoseconds ns_late) {
     std::scoped_lock lock{entries_mutex};
 
     for (const auto& entry : entries) {
+        // Writes can invalidate caches of the page, only restore the values the guest changed
+        const u64 current_value = MemoryReadWidth(memory, entry.width, entry.address);
+        if (IsSameValue(entry.width, current_value, entry.value)) {
+            continue;
+        }
         LOG_DEBUG(Common_Memory,
                   "Enforcing memory freeze at address={:016X}, value={:016X}, width={:02X}",
                   entry.address, entry.value, entry.width);
@@ -24,6 +24,7 @@
 #include "common/fs/path_util.h"
 #include "common/logging/backend.h"
 #include "common/logging/log.h"
+#include "common/polyfill_thread.h"
 #include "common/scm_rev.h"
 #include "common/settings.h"
 #include "common/string_util.h"
@@ -61,6 +62,9 @@ static void PrintHelp(const char* argv0) {
              "--ban-list-file     The file for storing the room ban list\n"
              "--log-file          The file for storing the room log\n"
              "--enable-yuzu-mods Allow yuzu Community Moderators to moderate on your room\n"
+             "--stats-interval    Seconds between room traffic reports, 0 disables them\n"
+             "--batch-window      Milliseconds relayed messages wait to be sent together to each\n"
+             "                    member, 0 disables batching\n"
              "-h, --help          Display this help and exit\n"
              "-v, --version       Output version information and exit\n",
              argv0);
@@ -71,6 +75,29 @@ static void PrintVersion() {
              Common::g_scm_desc, Network::network_version);
 }
 
+static void LogRoomStats(const Network::RoomStats& stats) {
+    const double seconds = std::chrono::duration<double>(stats.elapsed).count();
+    if (seconds <= 0.0) {
+        return;
+    }
+    const auto to_ms = [](std::chrono::nanoseconds delay) {
+        return std::chrono::duration<double, std::milli>(delay).count();
+    };
+    LOG_INFO(Network,
+             "Room traffic: in {:.1f} packets/s {:.1f} KiB/s, out {:.1f} packets/s {:.1f} KiB/s, "
+             "{} messages received, {} copies forwarded, "
+             "dispatch delay avg {:.3f} ms max {:.3f} ms",
+             stats.datagrams_received / seconds, stats.bytes_received / seconds / 1024.0,
+             stats.datagrams_sent / seconds, stats.bytes_sent / seconds / 1024.0,
+             stats.messages_received, stats.messages_forwarded,
+             to_ms(stats.average_dispatch_delay), to_ms(stats.max_dispatch_delay));
+    if (stats.batches_sent > 0) {
+        LOG_INFO(Network, "Relay batches: {} sent, {:.1f} KiB of messages compressed to {:.1f} KiB",
+                 stats.batches_sent, stats.batched_bytes / 1024.0,
+                 stats.compressed_batch_bytes / 1024.0);
+    }
+}
+
 /// The magic text at the beginning of a yuzu-room ban list file.
 static constexpr char BanListMagic[] = "YuzuRoom-BanList-1";
 
@@ -201,6 +228,8 @@ int main(int argc, char** argv) {
     u32 port = Network::DefaultRoomPort;
     u32 max_members = 16;
     bool enable_yuzu_mods = false;
+    u32 stats_interval = 60;
+    u32 batch_window = 0;
 
     static struct option long_options[] = {
         {"room-name", required_argument, 0, 'n'},
@@ -217,6 +246,8 @@ int main(int argc, char** argv) {
         {"ban-list-file", required_argument, 0, 'b'},
         {"log-file", required_argument, 0, 'l'},
         {"enable-yuzu-mods", no_argument, 0, 'e'},
+        {"stats-interval", required_argument, 0, 'r'},
+        {"batch-window", required_argument, 0, 'c'},
         {"help", no_argument, 0, 'h'},
         {"version", no_argument, 0, 'v'},
         {0, 0, 0, 0},
@@ -226,7 +257,7 @@ int main(int argc, char** argv) {
 
     while (optind < argc) {
         int arg =
-            getopt_long(argc, argv, "n:d:s:p:m:w:g:u:t:a:i:l:hv", long_options, &option_index);
+            getopt_long(argc, argv, "n:d:s:p:m:w:g:u:t:a:i:l:r:c:hv", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
             case 'n':
@@ -271,6 +302,12 @@ int main(int argc, char** argv) {
             case 'e':
                 enable_yuzu_mods = true;
                 break;
+            case 'r':
+                stats_interval = strtoul(optarg, &endarg, 0);
+                break;
+            case 'c':
+                batch_window = strtoul(optarg, &endarg, 0);
+                break;
             case 'h':
                 PrintHelp(argv[0]);
                 return 0;
@@ -368,6 +405,7 @@ int main(int argc, char** argv) {
     if (auto room = network.GetRoom().lock()) {
         AnnounceMultiplayerRoom::GameInfo preferred_game_info{.name = preferred_game,
                                                               .id = preferred_game_id};
+        room->SetRelayBatching(std::chrono::milliseconds{batch_window});
         if (!room->Create(room_name, room_description, bind_address, static_cast<u16>(port),
                           password, max_members, username, preferred_game_info,
                           std::move(verify_backend), ban_list, enable_yuzu_mods)) {
@@ -379,6 +417,17 @@ int main(int argc, char** argv) {
         if (announce) {
             announce_session->Start();
         }
+        // The loop below blocks on the console, so the traffic is reported from its own thread
+        std::jthread stats_thread;
+        if (stats_interval > 0) {
+            const std::chrono::seconds interval{stats_interval};
+            stats_thread = std::jthread([&room, interval](std::stop_token stop_token) {
+                room->GetAndResetStats();
+                while (Common::StoppableTimedWait(stop_token, interval)) {
+                    LogRoomStats(room->GetAndResetStats());
+                }
+            });
+        }
         while (room->GetState() == Network::Room::State::Open) {
             std::string in;
             std::cin >> in;
@@ -387,6 +436,7 @@ int main(int argc, char** argv) {
             }
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
+        stats_thread = {};
         if (announce) {
             announce_session->Stop();
         }
@@ -291,22 +291,20 @@ inline std::vector<std::string> VerifyInstalledContents(
     // Declare a list of file names which failed to verify.
     std::vector<std::string> failed;
 
-    size_t processed_size = 0;
     bool cancelled = false;
-    auto nca_callback = [&](size_t nca_processed, size_t nca_total) {
-        cancelled = callback(total_size, processed_size + nca_processed);
+    auto nca_callback = [&](size_t processed_size, size_t nca_total_size) {
+        cancelled = callback(total_size, processed_size);
         return !cancelled;
     };
 
     // Using the NCA loader, determine if all NCAs are valid.
-    for (auto& nca_file : nca_files) {
-        Loader::AppLoader_NCA nca_loader(nca_file);
-
-        auto status = nca_loader.VerifyIntegrity(nca_callback);
-        if (cancelled) {
-            break;
-        }
-        if (status != Loader::ResultStatus::Success) {
+    const auto statuses = Loader::AppLoader_NCA::VerifyIntegrity(nca_files, nca_callback);
+    if (cancelled) {
+        return failed;
+    }
+    for (size_t i = 0; i < nca_files.size(); ++i) {
+        const auto& nca_file = nca_files[i];
+        if (statuses[i] != Loader::ResultStatus::Success) {
             FileSys::NCA nca(nca_file);
             const auto title_id = nca.GetTitleId();
             std::string title_name = "unknown";
@@ -329,8 +327,6 @@ inline std::vector<std::string> VerifyInstalledContents(
                 failed.push_back(fmt::format("{} (unknown)", nca_file->GetName()));
             }
         }
-
-        processed_size += nca_file->GetSize();
     }
     return failed;
 }
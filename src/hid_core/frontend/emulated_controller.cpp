@@ -521,6 +521,10 @@ void EmulatedController::ReloadInput() {
         });
     }
     turbo_button_state = 0;
+    {
+        std::scoped_lock lock{mutex};
+        PublishServiceState();
+    }
     is_initialized = true;
 }
 
@@ -620,12 +624,14 @@ void EmulatedController::DisableSystemButtons() {
     system_buttons_enabled = false;
     controller.home_button_state.raw = 0;
     controller.capture_button_state.raw = 0;
+    PublishServiceState();
 }
 
 void EmulatedController::ResetSystemButtons() {
     std::scoped_lock lock{mutex};
     controller.home_button_state.home.Assign(false);
     controller.capture_button_state.capture.Assign(false);
+    PublishServiceState();
 }
 
 bool EmulatedController::IsConfiguring() const {
@@ -766,6 +772,12 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
         return;
     }
     std::unique_lock lock{mutex};
+    SCOPE_EXIT {
+        if (lock.owns_lock()) {
+            PublishServiceState();
+        }
+    };
+    StampInputEvent();
     bool value_changed = false;
     const auto new_status = TransformToButton(callback);
     auto& current_status = controller.button_values[index];
@@ -811,6 +823,7 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
         controller.debug_pad_button_state.raw = 0;
         controller.home_button_state.raw = 0;
         controller.capture_button_state.raw = 0;
+        PublishServiceState();
         lock.unlock();
         TriggerOnChange(ControllerTriggerType::Button, false);
         return;
@@ -915,6 +928,7 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
         break;
     }
 
+    PublishServiceState();
     lock.unlock();
 
     if (!is_connected) {
@@ -937,6 +951,10 @@ void EmulatedController::SetStick(const Common::Input::CallbackStatus& callback,
         TriggerOnChange(ControllerTriggerType::Stick, !is_configuring);
     };
     std::scoped_lock lock{mutex};
+    SCOPE_EXIT {
+        PublishServiceState();
+    };
+    StampInputEvent();
     const auto stick_value = TransformToStick(callback);
 
     // Only read stick values that have the same uuid or are over the threshold to avoid flapping
@@ -994,6 +1012,10 @@ void EmulatedController::SetTrigger(const Common::Input::CallbackStatus& callbac
         TriggerOnChange(ControllerTriggerType::Trigger, !is_configuring);
     };
     std::scoped_lock lock{mutex};
+    SCOPE_EXIT {
+        PublishServiceState();
+    };
+    StampInputEvent();
     const auto trigger_value = TransformToTrigger(callback);
 
     // Only read trigger values that have the same uuid or are pressed once
@@ -1042,6 +1064,9 @@ void EmulatedController::SetMotion(const Common::Input::CallbackStatus& callback
         TriggerOnChange(ControllerTriggerType::Motion, !is_configuring);
     };
     std::scoped_lock lock{mutex};
+    SCOPE_EXIT {
+        PublishServiceState();
+    };
     auto& raw_status = controller.motion_values[index].raw_status;
     auto& emulated = controller.motion_values[index].emulated;
 
@@ -1857,58 +1882,59 @@ RingAnalogValue EmulatedController::GetRingSensorValues() const {
 }
 
 HomeButtonState EmulatedController::GetHomeButtons() const {
-    std::scoped_lock lock{mutex};
     if (is_configuring) {
         return {};
     }
-    return controller.home_button_state;
+    return service_state.Read().home_button_state;
 }
 
 CaptureButtonState EmulatedController::GetCaptureButtons() const {
-    std::scoped_lock lock{mutex};
     if (is_configuring) {
         return {};
     }
-    return controller.capture_button_state;
+    return service_state.Read().capture_button_state;
 }
 
 NpadButtonState EmulatedController::GetNpadButtons() const {
-    std::scoped_lock lock{mutex};
     if (is_configuring) {
         return {};
     }
-    return {controller.npad_button_state.raw & GetTurboButtonMask()};
+    const ServiceState state = service_state.Read();
+    // Turbo buttons are released every other period
+    if (turbo_button_state < TURBO_BUTTON_DELAY) {
+        return state.npad_button_state;
+    }
+    return {state.npad_button_state.raw & ~state.turbo_buttons};
 }
 
 DebugPadButton EmulatedController::GetDebugPadButtons() const {
-    std::scoped_lock lock{mutex};
     if (is_configuring) {
         return {};
     }
-    return controller.debug_pad_button_state;
+    return service_state.Read().debug_pad_button_state;
 }
 
 AnalogSticks EmulatedController::GetSticks() const {
-    std::scoped_lock lock{mutex};
-
     if (is_configuring) {
         return {};
     }
 
-    return controller.analog_stick_state;
+    return service_state.Read().analog_stick_state;
+}
+
+s64 EmulatedController::GetInputTimestamp() const {
+    return service_state.Read().input_time_ns;
 }
 
 NpadGcTriggerState EmulatedController::GetTriggers() const {
-    std::scoped_lock lock{mutex};
     if (is_configuring) {
         return {};
     }
-    return controller.gc_trigger_state;
+    return service_state.Read().gc_trigger_state;
 }
 
 MotionState EmulatedController::GetMotions() const {
-    std::unique_lock lock{mutex};
-    return controller.motion_state;
+    return service_state.Read().motion_state;
 }
 
 ControllerColors EmulatedController::GetColors() const {
@@ -1945,10 +1971,20 @@ NpadColor EmulatedController::GetNpadColor(u32 color) {
 }
 
 void EmulatedController::TriggerOnChange(ControllerTriggerType type, bool is_npad_service_update) {
+    // Input changes reach the HID services once per update from StatusUpdate instead of once per
+    // field, motion alone changes hundreds of times per second
+    const bool is_batched = is_npad_service_update && IsBatchedTrigger(type);
+    if (is_batched) {
+        pending_service_changes.fetch_or(1U << static_cast<u32>(type), std::memory_order_relaxed);
+        if (frontend_callback_count.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+    }
+
     std::scoped_lock lock{callback_mutex};
     for (const auto& poller_pair : callback_list) {
         const ControllerUpdateCallback& poller = poller_pair.second;
-        if (!is_npad_service_update && poller.is_npad_service) {
+        if (poller.is_npad_service && (!is_npad_service_update || is_batched)) {
             continue;
         }
         if (poller.on_change) {
@@ -1957,8 +1993,44 @@ void EmulatedController::TriggerOnChange(ControllerTriggerType type, bool is_npa
     }
 }
 
+void EmulatedController::DispatchServiceChanges() {
+    const u32 pending = pending_service_changes.exchange(0, std::memory_order_relaxed);
+    if (pending == 0) {
+        return;
+    }
+
+    std::scoped_lock lock{callback_mutex};
+    for (u32 index = 0; index < 32; ++index) {
+        if ((pending & (1U << index)) == 0) {
+            continue;
+        }
+        const auto type = static_cast<ControllerTriggerType>(index);
+        for (const auto& poller_pair : callback_list) {
+            const ControllerUpdateCallback& poller = poller_pair.second;
+            if (poller.is_npad_service && poller.on_change) {
+                poller.on_change(type);
+            }
+        }
+    }
+}
+
+bool EmulatedController::IsBatchedTrigger(ControllerTriggerType type) {
+    switch (type) {
+    case ControllerTriggerType::Button:
+    case ControllerTriggerType::Stick:
+    case ControllerTriggerType::Trigger:
+    case ControllerTriggerType::Motion:
+        return true;
+    default:
+        return false;
+    }
+}
+
 int EmulatedController::SetCallback(ControllerUpdateCallback update_callback) {
     std::scoped_lock lock{callback_mutex};
+    if (!update_callback.is_npad_service) {
+        frontend_callback_count.fetch_add(1, std::memory_order_relaxed);
+    }
     callback_list.insert_or_assign(last_callback_key, std::move(update_callback));
     return last_callback_key++;
 }
@@ -1970,6 +2042,9 @@ void EmulatedController::DeleteCallback(int key) {
         LOG_ERROR(Input, "Tried to delete non-existent callback {}", key);
         return;
     }
+    if (!iterator->second.is_npad_service) {
+        frontend_callback_count.fetch_sub(1, std::memory_order_relaxed);
+    }
     callback_list.erase(iterator);
 }
 
@@ -1988,14 +2063,34 @@ void EmulatedController::StatusUpdate() {
         }
         device->ForceUpdate();
     }
+
+    DispatchServiceChanges();
 }
 
-NpadButton EmulatedController::GetTurboButtonMask() const {
-    // Apply no mask when disabled
-    if (turbo_button_state < TURBO_BUTTON_DELAY) {
-        return {NpadButton::All};
+void EmulatedController::PublishServiceState() {
+    service_state.Write({
+        .npad_button_state = controller.npad_button_state,
+        .turbo_buttons = GetTurboButtons(),
+        .debug_pad_button_state = controller.debug_pad_button_state,
+        .home_button_state = controller.home_button_state,
+        .capture_button_state = controller.capture_button_state,
+        .analog_stick_state = controller.analog_stick_state,
+        .gc_trigger_state = controller.gc_trigger_state,
+        .motion_state = controller.motion_state,
+        .input_time_ns = last_input_time_ns,
+    });
+}
+
+void EmulatedController::StampInputEvent() {
+    if (!Settings::values.record_input_latency.GetValue()) {
+        return;
     }
+    last_input_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now().time_since_epoch())
+                             .count();
+}
 
+NpadButton EmulatedController::GetTurboButtons() const {
     NpadButtonState button_mask{};
     for (std::size_t index = 0; index < controller.button_values.size(); ++index) {
         if (!controller.button_values[index].turbo) {
@@ -2056,7 +2151,7 @@ NpadButton EmulatedController::GetTurboButtonMask() const {
         }
     }
 
-    return static_cast<NpadButton>(~button_mask.raw);
+    return button_mask.raw;
 }
 
 } // namespace Core::HID
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -13,6 +14,7 @@
 #include "common/common_types.h"
 #include "common/input.h"
 #include "common/param_package.h"
+#include "common/seqlock.h"
 #include "common/settings.h"
 #include "common/vector_math.h"
 #include "hid_core/frontend/motion_input.h"
@@ -334,6 +336,12 @@ public:
     /// Returns the latest status of stick input from the mouse
     AnalogSticks GetSticks() const;
 
+    /**
+     * Returns the steady clock time, in nanoseconds, of the last button, stick or trigger event
+     * read by the HID services. Zero unless input latency is being recorded
+     */
+    s64 GetInputTimestamp() const;
+
     /// Returns the latest status of trigger input from the mouse
     NpadGcTriggerState GetTriggers() const;
 
@@ -465,7 +473,10 @@ public:
      */
     void DeleteCallback(int key);
 
-    /// Swaps the state of the turbo buttons and updates motion input
+    /**
+     * Swaps the state of the turbo buttons, updates motion input and notifies the HID services of
+     * the input changes since the last call
+     */
     void StatusUpdate();
 
 private:
@@ -568,7 +579,21 @@ private:
      */
     void TriggerOnChange(ControllerTriggerType type, bool is_service_update);
 
-    NpadButton GetTurboButtonMask() const;
+    /// Notifies the HID services once of each kind of input change batched by TriggerOnChange
+    void DispatchServiceChanges();
+
+    /// Returns true for the input changes the HID services are notified of in batches
+    static bool IsBatchedTrigger(ControllerTriggerType type);
+
+    /// Returns the buttons with turbo enabled
+    NpadButton GetTurboButtons() const;
+
+    /// Publishes the input read by the HID services, must be called with the mutex held
+    void PublishServiceState();
+
+    /// Marks the arrival of an input event when input latency is recorded, must be called with
+    /// the mutex held
+    void StampInputEvent();
 
     const NpadIdType npad_id_type;
     NpadStyleIndex npad_type{NpadStyleIndex::None};
@@ -632,9 +657,32 @@ private:
     mutable std::mutex connect_mutex;
     std::unordered_map<int, ControllerUpdateCallback> callback_list;
     int last_callback_key = 0;
+    // Callbacks that aren't from HID services, which are notified of every input change
+    std::atomic<std::size_t> frontend_callback_count{};
+    // Bits of the ControllerTriggerType of the input changes not yet sent to the HID services
+    std::atomic<u32> pending_service_changes{};
 
     // Stores the current status of all controller input
     ControllerStatus controller;
+
+    /// Input read by the HID services on every update, copied from controller
+    struct ServiceState {
+        NpadButtonState npad_button_state{};
+        NpadButton turbo_buttons{};
+        DebugPadButton debug_pad_button_state{};
+        HomeButtonState home_button_state{};
+        CaptureButtonState capture_button_state{};
+        AnalogSticks analog_stick_state{};
+        NpadGcTriggerState gc_trigger_state{};
+        MotionState motion_state{};
+        s64 input_time_ns{};
+    };
+
+    // Steady clock time of the last input event, see GetInputTimestamp
+    s64 last_input_time_ns{};
+
+    // Lets the HID services read input without waiting on input threads holding the mutex
+    Common::SeqLock<ServiceState> service_state;
 };
 
 } // namespace Core::HID
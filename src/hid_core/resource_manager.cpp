@@ -7,6 +7,7 @@
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/set/system_settings_server.h"
 #include "core/hle/service/sm/sm.h"
+#include "core/perf_stats.h"
 #include "hid_core/hid_core.h"
 #include "hid_core/hid_util.h"
 #include "hid_core/resource_manager.h"
@@ -41,11 +42,14 @@ namespace Service::HID {
 
 // Updating period for each HID device.
 // Period time is obtained by measuring the number of samples in a second on HW using a homebrew
-// Correct npad_update_ns is 4ms this is overclocked to lower input lag
-constexpr auto npad_update_ns = std::chrono::nanoseconds{1 * 1000 * 1000};    // (1ms, 1000Hz)
-constexpr auto default_update_ns = std::chrono::nanoseconds{4 * 1000 * 1000}; // (4ms, 1000Hz)
-constexpr auto mouse_keyboard_update_ns = std::chrono::nanoseconds{8 * 1000 * 1000}; // (8ms, 125Hz)
-constexpr auto motion_update_ns = std::chrono::nanoseconds{5 * 1000 * 1000};         // (5ms, 200Hz)
+// Every device is updated from a single event ticking at the npad rate. Correct npad_update_ns is
+// 4ms, this is overclocked to lower input lag
+constexpr auto npad_update_ns = std::chrono::nanoseconds{1 * 1000 * 1000}; // (1ms, 1000Hz)
+// Periods of the other devices and of the hardware npad sampling, in npad updates
+constexpr u64 npad_hardware_update_ticks = 4;  // (4ms, 250Hz)
+constexpr u64 default_update_ticks = 4;        // (4ms, 250Hz)
+constexpr u64 mouse_keyboard_update_ticks = 8; // (8ms, 125Hz)
+constexpr u64 motion_update_ticks = 5;         // (5ms, 200Hz)
 
 ResourceManager::ResourceManager(Core::System& system_,
                                  std::shared_ptr<HidFirmwareSettings> settings)
@@ -53,40 +57,17 @@ ResourceManager::ResourceManager(Core::System& system_,
     applet_resource = std::make_shared<AppletResource>(system);
 
     // Register update callbacks
-    npad_update_event = Core::Timing::CreateEvent("HID::UpdatePadCallback",
-                                                  [this](s64 time, std::chrono::nanoseconds ns_late)
-                                                      -> std::optional<std::chrono::nanoseconds> {
-                                                      UpdateNpad(ns_late);
-                                                      return std::nullopt;
-                                                  });
-    default_update_event = Core::Timing::CreateEvent(
-        "HID::UpdateDefaultCallback",
+    update_event = Core::Timing::CreateEvent(
+        "HID::UpdateCallback",
         [this](s64 time,
                std::chrono::nanoseconds ns_late) -> std::optional<std::chrono::nanoseconds> {
-            UpdateControllers(ns_late);
-            return std::nullopt;
-        });
-    mouse_keyboard_update_event = Core::Timing::CreateEvent(
-        "HID::UpdateMouseKeyboardCallback",
-        [this](s64 time,
-               std::chrono::nanoseconds ns_late) -> std::optional<std::chrono::nanoseconds> {
-            UpdateMouseKeyboard(ns_late);
-            return std::nullopt;
-        });
-    motion_update_event = Core::Timing::CreateEvent(
-        "HID::UpdateMotionCallback",
-        [this](s64 time,
-               std::chrono::nanoseconds ns_late) -> std::optional<std::chrono::nanoseconds> {
-            UpdateMotion(ns_late);
+            UpdateResources(ns_late);
             return std::nullopt;
         });
 }
 
 ResourceManager::~ResourceManager() {
-    system.CoreTiming().UnscheduleEvent(npad_update_event);
-    system.CoreTiming().UnscheduleEvent(default_update_event);
-    system.CoreTiming().UnscheduleEvent(mouse_keyboard_update_event);
-    system.CoreTiming().UnscheduleEvent(motion_update_event);
+    system.CoreTiming().UnscheduleEvent(update_event);
     system.CoreTiming().UnscheduleEvent(touch_update_event);
     input_event->Finalize();
 };
@@ -248,13 +229,7 @@ void ResourceManager::InitializeHidCommonSampler() {
     sleep_button->SetAppletResource(applet_resource, &shared_mutex);
     capture_button->SetAppletResource(applet_resource, &shared_mutex);
 
-    system.CoreTiming().ScheduleLoopingEvent(npad_update_ns, npad_update_ns, npad_update_event);
-    system.CoreTiming().ScheduleLoopingEvent(default_update_ns, default_update_ns,
-                                             default_update_event);
-    system.CoreTiming().ScheduleLoopingEvent(mouse_keyboard_update_ns, mouse_keyboard_update_ns,
-                                             mouse_keyboard_update_event);
-    system.CoreTiming().ScheduleLoopingEvent(motion_update_ns, motion_update_ns,
-                                             motion_update_event);
+    system.CoreTiming().ScheduleLoopingEvent(npad_update_ns, npad_update_ns, update_event);
 }
 
 void ResourceManager::InitializeTouchScreenSampler() {
@@ -470,6 +445,27 @@ Result ResourceManager::GetTouchScreenFirmwareVersion(Core::HID::FirmwareVersion
     return ResultSuccess;
 }
 
+void ResourceManager::UpdateResources(std::chrono::nanoseconds ns_late) {
+    // The devices take the same recursive lock, holding it here avoids contending for it once per
+    // device
+    std::scoped_lock lock{shared_mutex};
+    // The first update happens a period after scheduling, like with one event per device
+    const u64 tick = ++update_tick;
+
+    // Between hardware samples the npad only writes input that changed, the hardware samples keep
+    // the sampling numbers advancing at the rate games expect
+    UpdateNpad(ns_late, tick % npad_hardware_update_ticks != 0);
+    if (tick % default_update_ticks == 0) {
+        UpdateControllers(ns_late);
+    }
+    if (tick % mouse_keyboard_update_ticks == 0) {
+        UpdateMouseKeyboard(ns_late);
+    }
+    if (tick % motion_update_ticks == 0) {
+        UpdateMotion(ns_late);
+    }
+}
+
 void ResourceManager::UpdateControllers(std::chrono::nanoseconds ns_late) {
     auto& core_timing = system.CoreTiming();
     debug_pad->OnUpdate(core_timing);
@@ -481,9 +477,15 @@ void ResourceManager::UpdateControllers(std::chrono::nanoseconds ns_late) {
     capture_button->OnUpdate(core_timing);
 }
 
-void ResourceManager::UpdateNpad(std::chrono::nanoseconds ns_late) {
+void ResourceManager::UpdateNpad(std::chrono::nanoseconds ns_late, bool only_changed) {
     auto& core_timing = system.CoreTiming();
-    npad->OnUpdate(core_timing);
+    npad->OnUpdate(core_timing, only_changed);
+
+    if (const s64 input_time = npad->TakeWrittenInputTime(); input_time != 0) {
+        using Clock = Core::PerfStats::Clock;
+        system.GetPerfStats().AddInputWritten(
+            Clock::time_point{std::chrono::nanoseconds{input_time}}, Clock::now());
+    }
 }
 
 void ResourceManager::UpdateMouseKeyboard(std::chrono::nanoseconds ns_late) {
@@ -109,8 +109,10 @@ public:
 
     Result GetTouchScreenFirmwareVersion(Core::HID::FirmwareVersion& firmware) const;
 
+    /// Updates every device whose sampling period has elapsed in a single locked pass
+    void UpdateResources(std::chrono::nanoseconds ns_late);
     void UpdateControllers(std::chrono::nanoseconds ns_late);
-    void UpdateNpad(std::chrono::nanoseconds ns_late);
+    void UpdateNpad(std::chrono::nanoseconds ns_late, bool only_changed);
     void UpdateMouseKeyboard(std::chrono::nanoseconds ns_late);
     void UpdateMotion(std::chrono::nanoseconds ns_late);
 
@@ -147,10 +149,9 @@ private:
     std::shared_ptr<SixAxis> six_axis{nullptr};
     std::shared_ptr<SleepButton> sleep_button{nullptr};
     std::shared_ptr<UniquePad> unique_pad{nullptr};
-    std::shared_ptr<Core::Timing::EventType> npad_update_event;
-    std::shared_ptr<Core::Timing::EventType> default_update_event;
-    std::shared_ptr<Core::Timing::EventType> mouse_keyboard_update_event;
-    std::shared_ptr<Core::Timing::EventType> motion_update_event;
+    std::shared_ptr<Core::Timing::EventType> update_event;
+    /// Updates done by update_event, used to derive the period of each device
+    u64 update_tick{};
 
     // TODO: Create these resources
     // std::shared_ptr<AudioControl> audio_control{nullptr};
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <utility>
 
 #include "common/assert.h"
 #include "common/bit_field.h"
@@ -103,6 +104,7 @@ Result NPad::Activate(u64 aruid) {
         }
 
         controller.is_active = true;
+        controller.is_written = false;
     }
 
     return ResultSuccess;
@@ -364,6 +366,7 @@ void NPad::InitNewlyAddedController(u64 aruid, Core::HID::NpadIdType npad_id) {
 
     npad_resource.SignalStyleSetUpdateEvent(aruid, npad_id);
     WriteEmptyEntry(controller.shared_memory);
+    controller.is_written = false;
     hid_core.SetLastActiveController(npad_id);
     abstracted_pads[NpadIdTypeToIndex(npad_id)].Update();
 }
@@ -458,11 +461,12 @@ void NPad::RequestPadStateUpdate(u64 aruid, Core::HID::NpadIdType npad_id) {
     }
 }
 
-void NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing) {
+void NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing, bool only_changed) {
     if (ref_counter == 0) {
         return;
     }
 
+    const bool record_input_latency = Settings::values.record_input_latency.GetValue();
     std::scoped_lock lock{*applet_resource_holder.shared_mutex};
     for (std::size_t aruid_index = 0; aruid_index < AruidIndexMax; ++aruid_index) {
         const auto* data = applet_resource_holder.applet_resource->GetAruidDataByIndex(aruid_index);
@@ -500,11 +504,19 @@ void NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing) {
                 continue;
             }
 
+            // Read before the state so the time never belongs to newer input than what is written
+            const s64 input_time =
+                record_input_latency ? controller.device->GetInputTimestamp() : 0;
             RequestPadStateUpdate(aruid, controller.device->GetNpadIdType());
             auto& pad_state = controller.npad_pad_state;
             auto& libnx_state = controller.npad_libnx_state;
             auto& trigger_state = controller.npad_trigger_state;
 
+            if (only_changed && controller.is_written && !HasInputChanged(controller)) {
+                press_state |= static_cast<u64>(pad_state.npad_buttons.raw);
+                continue;
+            }
+
             // LibNX exclusively uses this section, so we always update it since LibNX doesn't
             // activate any controllers.
             libnx_state.connection_status.raw = 0;
@@ -613,10 +625,39 @@ void NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing) {
             npad->system_ext_lifo.WriteNextEntry(libnx_state);
 
             press_state |= static_cast<u64>(pad_state.npad_buttons.raw);
+            controller.is_written = true;
+            controller.written_style = controller_type;
+            controller.written_pad_state = pad_state;
+            controller.written_trigger_state = trigger_state;
+
+            if (input_time > controller.written_input_time_ns) {
+                controller.written_input_time_ns = input_time;
+                pending_input_time_ns = std::max(pending_input_time_ns, input_time);
+            }
         }
     }
 }
 
+bool NPad::HasInputChanged(const NpadControllerData& controller) const {
+    const auto& pad_state = controller.npad_pad_state;
+    const auto& written_pad_state = controller.written_pad_state;
+    const auto& trigger_state = controller.npad_trigger_state;
+    const auto& written_trigger_state = controller.written_trigger_state;
+    return controller.device->GetNpadStyleIndex() != controller.written_style ||
+           pad_state.npad_buttons.raw != written_pad_state.npad_buttons.raw ||
+           pad_state.l_stick.x != written_pad_state.l_stick.x ||
+           pad_state.l_stick.y != written_pad_state.l_stick.y ||
+           pad_state.r_stick.x != written_pad_state.r_stick.x ||
+           pad_state.r_stick.y != written_pad_state.r_stick.y ||
+           trigger_state.l_analog != written_trigger_state.l_analog ||
+           trigger_state.r_analog != written_trigger_state.r_analog;
+}
+
+s64 NPad::TakeWrittenInputTime() {
+    std::scoped_lock lock{*applet_resource_holder.shared_mutex};
+    return std::exchange(pending_input_time_ns, 0);
+}
+
 Result NPad::SetSupportedNpadStyleSet(u64 aruid, Core::HID::NpadStyleSet supported_style_set) {
     std::scoped_lock lock{mutex};
     hid_core.SetSupportedStyleTag({supported_style_set});
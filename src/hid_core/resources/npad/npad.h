@@ -60,8 +60,19 @@ public:
 
     void FreeAppletResourceId(u64 aruid);
 
-    // When the controller is requesting an update for the shared memory
-    void OnUpdate(const Core::Timing::CoreTiming& core_timing);
+    /**
+     * When the controller is requesting an update for the shared memory
+     * @param only_changed Skips writing the controllers whose input didn't change since their
+     *                     last write
+     */
+    void OnUpdate(const Core::Timing::CoreTiming& core_timing, bool only_changed = false);
+
+    /**
+     * Returns the steady clock time, in nanoseconds, of the newest input event written to shared
+     * memory since the last call, or zero when there is none. Only tracked when input latency is
+     * being recorded.
+     */
+    s64 TakeWrittenInputTime();
 
     Result SetSupportedNpadStyleSet(u64 aruid, Core::HID::NpadStyleSet supported_style_set);
     Result GetSupportedNpadStyleSet(u64 aruid,
@@ -178,12 +189,21 @@ private:
         NPadGenericState npad_libnx_state{};
         NpadGcTriggerState npad_trigger_state{};
         int callback_key{};
+        // Time of the newest input event written to the shared memory of this controller
+        s64 written_input_time_ns{};
+
+        // Input of the last write to the LIFOs, to skip writing it again
+        bool is_written{};
+        Core::HID::NpadStyleIndex written_style{};
+        NPadGenericState written_pad_state{};
+        NpadGcTriggerState written_trigger_state{};
     };
 
     void ControllerUpdate(Core::HID::ControllerTriggerType type, std::size_t controller_idx);
     void InitNewlyAddedController(u64 aruid, Core::HID::NpadIdType npad_id);
     void RequestPadStateUpdate(u64 aruid, Core::HID::NpadIdType npad_id);
     void WriteEmptyEntry(NpadInternalState* npad);
+    bool HasInputChanged(const NpadControllerData& controller) const;
 
     NpadControllerData& GetControllerFromHandle(
         u64 aruid, const Core::HID::SixAxisSensorHandle& device_handle);
@@ -209,6 +229,8 @@ private:
     NpadVibration vibration_handler{};
 
     std::atomic<u64> press_state{};
+    // Newest input time written since TakeWrittenInputTime, guarded by the applet resource mutex
+    s64 pending_input_time_ns{};
     std::array<std::array<NpadControllerData, MaxSupportedNpadIdTypes>, AruidIndexMax>
         controller_data{};
 };
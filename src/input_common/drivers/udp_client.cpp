@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <random>
+#include <span>
 #include <boost/asio.hpp>
 #include <fmt/format.h>
 
@@ -18,7 +19,8 @@ namespace InputCommon::CemuhookUDP {
 struct SocketCallback {
     std::function<void(Response::Version)> version;
     std::function<void(Response::PortInfo)> port_info;
-    std::function<void(Response::PadData)> pad_data;
+    /// Receives the pad data packets that arrived together, oldest first
+    std::function<void(std::span<const Response::PadData>)> pad_data;
 };
 
 class Socket {
@@ -66,32 +68,50 @@ private:
     }
 
     void HandleReceive(const boost::system::error_code&, std::size_t bytes_transferred) {
-        if (auto type = Response::Validate(receive_buffer.data(), bytes_transferred)) {
-            switch (*type) {
-            case Type::Version: {
-                Response::Version version;
-                std::memcpy(&version, &receive_buffer[sizeof(Header)], sizeof(Response::Version));
-                callback.version(std::move(version));
-                break;
-            }
-            case Type::PortInfo: {
-                Response::PortInfo port_info;
-                std::memcpy(&port_info, &receive_buffer[sizeof(Header)],
-                            sizeof(Response::PortInfo));
-                callback.port_info(std::move(port_info));
-                break;
-            }
-            case Type::PadData: {
-                Response::PadData pad_data;
-                std::memcpy(&pad_data, &receive_buffer[sizeof(Header)], sizeof(Response::PadData));
-                callback.pad_data(std::move(pad_data));
+        ParsePacket(bytes_transferred);
+
+        // Wi-Fi tends to deliver packets in bursts, the ones already waiting are handled together
+        boost::system::error_code ec{};
+        while (num_pad_data < pad_data_batch.size() && socket.available(ec) > 0 && !ec) {
+            const std::size_t bytes =
+                socket.receive_from(boost::asio::buffer(receive_buffer), receive_endpoint, 0, ec);
+            if (ec) {
                 break;
             }
-            }
+            ParsePacket(bytes);
+        }
+        if (num_pad_data > 0) {
+            callback.pad_data(std::span{pad_data_batch.data(), num_pad_data});
+            num_pad_data = 0;
         }
         StartReceive();
     }
 
+    void ParsePacket(std::size_t bytes_transferred) {
+        const auto type = Response::Validate(receive_buffer.data(), bytes_transferred);
+        if (!type) {
+            return;
+        }
+        switch (*type) {
+        case Type::Version: {
+            Response::Version version;
+            std::memcpy(&version, &receive_buffer[sizeof(Header)], sizeof(Response::Version));
+            callback.version(std::move(version));
+            break;
+        }
+        case Type::PortInfo: {
+            Response::PortInfo port_info;
+            std::memcpy(&port_info, &receive_buffer[sizeof(Header)], sizeof(Response::PortInfo));
+            callback.port_info(std::move(port_info));
+            break;
+        }
+        case Type::PadData:
+            std::memcpy(&pad_data_batch[num_pad_data++], &receive_buffer[sizeof(Header)],
+                        sizeof(Response::PadData));
+            break;
+        }
+    }
+
     void HandleSend(const boost::system::error_code&) {
         boost::system::error_code _ignored{};
         // Send a request for getting port info for the pad
@@ -127,6 +147,10 @@ private:
 
     std::array<u8, MAX_PACKET_SIZE> receive_buffer;
     udp::endpoint receive_endpoint;
+
+    /// Pad data packets received together, reused for every batch
+    std::array<Response::PadData, 16> pad_data_batch;
+    std::size_t num_pad_data{};
 };
 
 static void SocketLoop(Socket* socket) {
@@ -151,6 +175,15 @@ UDPClient::ClientConnection::~ClientConnection() = default;
 void UDPClient::ReloadSockets() {
     Reset();
 
+    // TODO: Use custom calibration per device
+    const Common::ParamPackage touch_param(Settings::values.touch_device.GetValue());
+    touch_calibration = {
+        .min_x = static_cast<u16>(touch_param.Get("min_x", 100)),
+        .min_y = static_cast<u16>(touch_param.Get("min_y", 50)),
+        .max_x = static_cast<u16>(touch_param.Get("max_x", 1800)),
+        .max_y = static_cast<u16>(touch_param.Get("max_y", 850)),
+    };
+
     std::stringstream servers_ss(Settings::values.udp_input_servers.GetValue());
     std::string server_token;
     std::size_t client = 0;
@@ -218,51 +251,89 @@ void UDPClient::OnPortInfo([[maybe_unused]] Response::PortInfo data) {
     LOG_TRACE(Input, "PortInfo packet received: {}", data.model);
 }
 
-void UDPClient::OnPadData(Response::PadData data, std::size_t client) {
-    const std::size_t pad_index = (client * PADS_PER_CLIENT) + data.info.id;
+void UDPClient::OnPadData(std::span<const Response::PadData> batch, std::size_t client) {
+    // Gyroscope values are not it the correct scale from better joy.
+    // Dividing by 312 allows us to make one full turn = 1 turn
+    // This must be a configurable valued called sensitivity
+    const float gyro_scale = 1.0f / 312.0f;
 
-    if (pad_index >= pads.size()) {
-        LOG_ERROR(Input, "Invalid pad id {}", data.info.id);
-        return;
-    }
+    // Packets of a pad that arrived together are merged into a single motion update, the gyro is
+    // averaged over the time each packet covers and the accelerometer keeps its newest value
+    std::array<const Response::PadData*, PADS_PER_CLIENT> newest{};
+    std::array<BasicMotion, PADS_PER_CLIENT> motions{};
+    std::array<f32, PADS_PER_CLIENT> gyro_weights{};
+
+    for (const Response::PadData& data : batch) {
+        if (data.info.id >= PADS_PER_CLIENT) {
+            LOG_ERROR(Input, "Invalid pad id {}", data.info.id);
+            continue;
+        }
+        const std::size_t pad_index = (client * PADS_PER_CLIENT) + data.info.id;
+        PadData& pad = pads[pad_index];
+
+        LOG_TRACE(Input, "PadData packet received");
+        if (data.packet_counter == pad.packet_sequence) {
+            LOG_WARNING(
+                Input,
+                "PadData packet dropped because its stale info. Current count: {} Packet count: {}",
+                pad.packet_sequence, data.packet_counter);
+            pad.connected = false;
+            continue;
+        }
 
-    LOG_TRACE(Input, "PadData packet received");
-    if (data.packet_counter == pads[pad_index].packet_sequence) {
-        LOG_WARNING(
-            Input,
-            "PadData packet dropped because its stale info. Current count: {} Packet count: {}",
-            pads[pad_index].packet_sequence, data.packet_counter);
-        pads[pad_index].connected = false;
-        return;
+        clients[client].active = 1;
+        pad.connected = true;
+        pad.packet_sequence = data.packet_counter;
+
+        const u64 time_difference = GetMotionDelta(pad, data.motion_timestamp);
+        const f32 weight = static_cast<f32>(std::max<u64>(time_difference, 1));
+        BasicMotion& motion = motions[data.info.id];
+        motion.gyro_x += data.gyro.pitch * gyro_scale * weight;
+        motion.gyro_y += data.gyro.roll * gyro_scale * weight;
+        motion.gyro_z += -data.gyro.yaw * gyro_scale * weight;
+        motion.accel_x = data.accel.x;
+        motion.accel_y = -data.accel.z;
+        motion.accel_z = data.accel.y;
+        motion.delta_timestamp += time_difference;
+        gyro_weights[data.info.id] += weight;
+        newest[data.info.id] = &data;
     }
 
-    clients[client].active = 1;
-    pads[pad_index].connected = true;
-    pads[pad_index].packet_sequence = data.packet_counter;
+    for (std::size_t id = 0; id < PADS_PER_CLIENT; ++id) {
+        if (newest[id] == nullptr) {
+            continue;
+        }
+        BasicMotion& motion = motions[id];
+        motion.gyro_x /= gyro_weights[id];
+        motion.gyro_y /= gyro_weights[id];
+        motion.gyro_z /= gyro_weights[id];
+
+        const PadIdentifier identifier = GetPadIdentifier((client * PADS_PER_CLIENT) + id);
+        SetMotion(identifier, 0, motion);
+        UpdatePadState(identifier, *newest[id]);
+    }
+}
 
+u64 UDPClient::GetMotionDelta(PadData& pad, u64 motion_timestamp) {
     const auto now = std::chrono::steady_clock::now();
-    const auto time_difference = static_cast<u64>(
-        std::chrono::duration_cast<std::chrono::microseconds>(now - pads[pad_index].last_update)
-            .count());
-    pads[pad_index].last_update = now;
-
-    // Gyroscope values are not it the correct scale from better joy.
-    // Dividing by 312 allows us to make one full turn = 1 turn
-    // This must be a configurable valued called sensitivity
-    const float gyro_scale = 1.0f / 312.0f;
-
-    const BasicMotion motion{
-        .gyro_x = data.gyro.pitch * gyro_scale,
-        .gyro_y = data.gyro.roll * gyro_scale,
-        .gyro_z = -data.gyro.yaw * gyro_scale,
-        .accel_x = data.accel.x,
-        .accel_y = -data.accel.z,
-        .accel_z = data.accel.y,
-        .delta_timestamp = time_difference,
-    };
-    const PadIdentifier identifier = GetPadIdentifier(pad_index);
-    SetMotion(identifier, 0, motion);
+    const auto host_difference = static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - pad.last_update).count());
+    pad.last_update = now;
+
+    // The timestamp of the device tells when the sample was taken, unlike the arrival time that
+    // jitters with the network. It's only trusted while it moves forward at a sane pace
+    static constexpr u64 max_device_difference = 1'000'000;
+    const u64 previous_timestamp = pad.motion_timestamp;
+    pad.motion_timestamp = motion_timestamp;
+    if (previous_timestamp == 0 || motion_timestamp <= previous_timestamp ||
+        motion_timestamp - previous_timestamp >= max_device_difference) {
+        return host_difference;
+    }
+    return motion_timestamp - previous_timestamp;
+}
 
+void UDPClient::UpdatePadState(const PadIdentifier& identifier, const Response::PadData& data) {
+    const auto& [min_x, min_y, max_x, max_y] = touch_calibration;
     for (std::size_t id = 0; id < data.touch.size(); ++id) {
         const auto touch_pad = data.touch[id];
         const auto touch_axis_x_id =
@@ -272,13 +343,6 @@ void UDPClient::OnPadData(Response::PadData data, std::size_t client) {
         const auto touch_button_id =
             static_cast<int>(id == 0 ? PadButton::Touch1 : PadButton::Touch2);
 
-        // TODO: Use custom calibration per device
-        const Common::ParamPackage touch_param(Settings::values.touch_device.GetValue());
-        const u16 min_x = static_cast<u16>(touch_param.Get("min_x", 100));
-        const u16 min_y = static_cast<u16>(touch_param.Get("min_y", 50));
-        const u16 max_x = static_cast<u16>(touch_param.Get("max_x", 1800));
-        const u16 max_y = static_cast<u16>(touch_param.Get("max_y", 850));
-
         const f32 x =
             static_cast<f32>(std::clamp(static_cast<u16>(touch_pad.x), min_x, max_x) - min_x) /
             static_cast<f32>(max_x - min_x);
@@ -327,7 +391,9 @@ void UDPClient::OnPadData(Response::PadData data, std::size_t client) {
 void UDPClient::StartCommunication(std::size_t client, const std::string& host, u16 port) {
     SocketCallback callback{[this](Response::Version version) { OnVersion(version); },
                             [this](Response::PortInfo info) { OnPortInfo(info); },
-                            [this, client](Response::PadData data) { OnPadData(data, client); }};
+                            [this, client](std::span<const Response::PadData> batch) {
+                                OnPadData(batch, client);
+                            }};
     LOG_INFO(Input, "Starting communication with UDP input server on {}:{}", host, port);
     clients[client].uuid = GetHostUUID(host);
     clients[client].host = host;
@@ -573,7 +639,7 @@ void TestCommunication(const std::string& host, u16 port,
         SocketCallback callback{
             .version = [](Response::Version) {},
             .port_info = [](Response::PortInfo) {},
-            .pad_data = [&](Response::PadData) { success_event.Set(); },
+            .pad_data = [&](std::span<const Response::PadData>) { success_event.Set(); },
         };
         Socket socket{host, port, std::move(callback)};
         std::thread worker_thread{SocketLoop, &socket};
@@ -600,38 +666,41 @@ CalibrationConfigurationJob::CalibrationConfigurationJob(
         u16 max_y{};
 
         Status current_status{Status::Initialized};
-        SocketCallback callback{[](Response::Version) {}, [](Response::PortInfo) {},
-                                [&](Response::PadData data) {
-                                    constexpr u16 CALIBRATION_THRESHOLD = 100;
+        const auto on_pad_data = [&](const Response::PadData& data) {
+            constexpr u16 CALIBRATION_THRESHOLD = 100;
 
-                                    if (current_status == Status::Initialized) {
-                                        // Receiving data means the communication is ready now
-                                        current_status = Status::Ready;
-                                        status_callback(current_status);
-                                    }
-                                    if (data.touch[0].is_active == 0) {
-                                        return;
-                                    }
-                                    LOG_DEBUG(Input, "Current touch: {} {}", data.touch[0].x,
-                                              data.touch[0].y);
-                                    min_x = std::min(min_x, static_cast<u16>(data.touch[0].x));
-                                    min_y = std::min(min_y, static_cast<u16>(data.touch[0].y));
-                                    if (current_status == Status::Ready) {
-                                        // First touch - min data (min_x/min_y)
-                                        current_status = Status::Stage1Completed;
-                                        status_callback(current_status);
-                                    }
-                                    if (data.touch[0].x - min_x > CALIBRATION_THRESHOLD &&
-                                        data.touch[0].y - min_y > CALIBRATION_THRESHOLD) {
-                                        // Set the current position as max value and finishes
-                                        // configuration
-                                        max_x = data.touch[0].x;
-                                        max_y = data.touch[0].y;
-                                        current_status = Status::Completed;
-                                        data_callback(min_x, min_y, max_x, max_y);
-                                        status_callback(current_status);
-
-                                        complete_event.Set();
+            if (current_status == Status::Initialized) {
+                // Receiving data means the communication is ready now
+                current_status = Status::Ready;
+                status_callback(current_status);
+            }
+            if (data.touch[0].is_active == 0) {
+                return;
+            }
+            LOG_DEBUG(Input, "Current touch: {} {}", data.touch[0].x, data.touch[0].y);
+            min_x = std::min(min_x, static_cast<u16>(data.touch[0].x));
+            min_y = std::min(min_y, static_cast<u16>(data.touch[0].y));
+            if (current_status == Status::Ready) {
+                // First touch - min data (min_x/min_y)
+                current_status = Status::Stage1Completed;
+                status_callback(current_status);
+            }
+            if (data.touch[0].x - min_x > CALIBRATION_THRESHOLD &&
+                data.touch[0].y - min_y > CALIBRATION_THRESHOLD) {
+                // Set the current position as max value and finishes configuration
+                max_x = data.touch[0].x;
+                max_y = data.touch[0].y;
+                current_status = Status::Completed;
+                data_callback(min_x, min_y, max_x, max_y);
+                status_callback(current_status);
+
+                complete_event.Set();
+            }
+        };
+        SocketCallback callback{[](Response::Version) {}, [](Response::PortInfo) {},
+                                [&](std::span<const Response::PadData> batch) {
+                                    for (const Response::PadData& data : batch) {
+                                        on_pad_data(data);
                                     }
                                 }};
         Socket socket{host, port, std::move(callback)};
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <optional>
+#include <span>
 
 #include "common/common_types.h"
 #include "common/thread.h"
@@ -120,6 +121,8 @@ private:
         bool connected{};
         DeviceStatus status;
         u64 packet_sequence{};
+        /// Device timestamp of the last motion sample in microseconds
+        u64 motion_timestamp{};
 
         std::chrono::time_point<std::chrono::steady_clock> last_update;
     };
@@ -146,7 +149,13 @@ private:
 
     void OnVersion(Response::Version);
     void OnPortInfo(Response::PortInfo);
-    void OnPadData(Response::PadData, std::size_t client);
+    void OnPadData(std::span<const Response::PadData> batch, std::size_t client);
+
+    // Returns the microseconds between the last two motion samples of a pad
+    u64 GetMotionDelta(PadData& pad, u64 motion_timestamp);
+
+    // Updates the touch, sticks, buttons and battery of a pad from its newest packet
+    void UpdatePadState(const PadIdentifier& identifier, const Response::PadData& data);
     void StartCommunication(std::size_t client, const std::string& host, u16 port);
     PadIdentifier GetPadIdentifier(std::size_t pad_index) const;
     Common::UUID GetHostUUID(const std::string& host) const;
@@ -158,6 +167,7 @@ private:
     static constexpr std::size_t PADS_PER_CLIENT = 4;
     std::array<PadData, MAX_UDP_CLIENTS * PADS_PER_CLIENT> pads{};
     std::array<ClientConnection, MAX_UDP_CLIENTS> clients{};
+    DeviceStatus::CalibrationData touch_calibration{};
 };
 
 /// An async job allowing configuration of the touchpad calibration.
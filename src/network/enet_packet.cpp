@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <vector>
+#include "network/enet_packet.h"
+
+namespace Network {
+
+namespace {
+void FreePacketData(ENetPacket* enet_packet) {
+    delete static_cast<std::vector<char>*>(enet_packet->userData);
+}
+} // Anonymous namespace
+
+ENetPacket* CreateENetPacket(Packet&& packet, enet_uint32 flags) {
+    auto data = std::make_unique<std::vector<char>>(packet.ReleaseData());
+    // ENet sends straight from the vector, which is freed along with the ENet packet
+    ENetPacket* const enet_packet =
+        enet_packet_create(data->data(), data->size(), flags | ENET_PACKET_FLAG_NO_ALLOCATE);
+    if (enet_packet == nullptr) {
+        return nullptr;
+    }
+    enet_packet->userData = data.release();
+    enet_packet->freeCallback = FreePacketData;
+    return enet_packet;
+}
+
+Packet ViewENetPacket(const ENetPacket* enet_packet) {
+    return Packet{{enet_packet->data, enet_packet->dataLength}};
+}
+
+} // namespace Network
@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "enet/enet.h"
+#include "network/packet.h"
+
+namespace Network {
+
+/**
+ * Creates an ENet packet that sends the serialized data of a packet without copying it. ENet owns
+ * the data afterwards and frees it together with the ENet packet.
+ * @param packet Packet to send, it is left empty
+ * @param flags ENet packet flags
+ * @return The ENet packet, or nullptr if it couldn't be created
+ */
+[[nodiscard]] ENetPacket* CreateENetPacket(Packet&& packet, enet_uint32 flags);
+
+/**
+ * Returns a packet that reads the payload of a received ENet packet in place. The ENet packet must
+ * outlive the returned packet.
+ */
+[[nodiscard]] Packet ViewENetPacket(const ENetPacket* enet_packet);
+
+} // namespace Network
@@ -8,6 +8,7 @@
 #endif
 #include <cstring>
 #include <string>
+#include <utility>
 #include "network/packet.h"
 
 namespace Network {
@@ -24,8 +25,12 @@ static u64 ntohll(u64 x) {
 }
 #endif
 
+Packet::Packet(std::span<const u8> view_)
+    : view{reinterpret_cast<const char*>(view_.data()), view_.size()}, is_view{true} {}
+
 void Packet::Append(const void* in_data, std::size_t size_in_bytes) {
     if (in_data && (size_in_bytes > 0)) {
+        DetachView();
         std::size_t start = data.size();
         data.resize(start + size_in_bytes);
         std::memcpy(&data[start], in_data, size_in_bytes);
@@ -34,19 +39,33 @@ void Packet::Append(const void* in_data, std::size_t size_in_bytes) {
 
 void Packet::Read(void* out_data, std::size_t size_in_bytes) {
     if (out_data && CheckSize(size_in_bytes)) {
-        std::memcpy(out_data, &data[read_pos], size_in_bytes);
+        std::memcpy(out_data, Contents().data() + read_pos, size_in_bytes);
         read_pos += size_in_bytes;
     }
 }
 
+std::span<const u8> Packet::ReadView(std::size_t size_in_bytes) {
+    if (!CheckSize(size_in_bytes)) {
+        return {};
+    }
+    const auto contents = Contents();
+    const std::span<const u8> result{reinterpret_cast<const u8*>(contents.data()) + read_pos,
+                                     size_in_bytes};
+    read_pos += size_in_bytes;
+    return result;
+}
+
 void Packet::Clear() {
     data.clear();
+    view = {};
+    is_view = false;
     read_pos = 0;
     is_valid = true;
 }
 
 const void* Packet::GetData() const {
-    return !data.empty() ? &data[0] : nullptr;
+    const std::span<const char> contents = Contents();
+    return !contents.empty() ? contents.data() : nullptr;
 }
 
 void Packet::IgnoreBytes(u32 length) {
@@ -54,11 +73,33 @@ void Packet::IgnoreBytes(u32 length) {
 }
 
 std::size_t Packet::GetDataSize() const {
-    return data.size();
+    return Contents().size();
+}
+
+std::vector<char> Packet::ReleaseData() {
+    DetachView();
+    std::vector<char> released = std::move(data);
+    Clear();
+    return released;
 }
 
 bool Packet::EndOfPacket() const {
-    return read_pos >= data.size();
+    return read_pos >= GetDataSize();
+}
+
+std::span<const char> Packet::Contents() const {
+    if (is_view) {
+        return view;
+    }
+    return data;
+}
+
+void Packet::DetachView() {
+    if (is_view) {
+        data.assign(view.begin(), view.end());
+        view = {};
+        is_view = false;
+    }
 }
 
 Packet::operator bool() const {
@@ -142,7 +183,7 @@ Packet& Packet::Read(char* out_data) {
 
     if ((length > 0) && CheckSize(length)) {
         // Then extract characters
-        std::memcpy(out_data, &data[read_pos], length);
+        std::memcpy(out_data, Contents().data() + read_pos, length);
         out_data[length] = '\0';
 
         // Update reading position
@@ -160,7 +201,7 @@ Packet& Packet::Read(std::string& out_data) {
     out_data.clear();
     if ((length > 0) && CheckSize(length)) {
         // Then extract characters
-        out_data.assign(&data[read_pos], length);
+        out_data.assign(Contents().data() + read_pos, length);
 
         // Update reading position
         read_pos += length;
@@ -254,7 +295,7 @@ Packet& Packet::Write(const std::string& in_data) {
 }
 
 bool Packet::CheckSize(std::size_t size) {
-    is_valid = is_valid && (read_pos + size <= data.size());
+    is_valid = is_valid && (read_pos + size <= GetDataSize());
 
     return is_valid;
 }
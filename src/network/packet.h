@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <span>
 #include <vector>
 #include "common/common_types.h"
 
@@ -15,6 +16,13 @@ public:
     Packet() = default;
     ~Packet() = default;
 
+    /**
+     * Creates a packet that reads a buffer in place without copying it, the buffer must outlive
+     * the packet. Appending to the packet copies the buffer first.
+     * @param view Bytes to read
+     */
+    explicit Packet(std::span<const u8> view);
+
     /**
      * Append data to the end of the packet
      * @param data        Pointer to the sequence of bytes to append
@@ -29,6 +37,14 @@ public:
      */
     void Read(void* out_data, std::size_t size_in_bytes);
 
+    /**
+     * Reads bytes from the current read position of the packet without copying them
+     * @param size_in_bytes Number of bytes to read
+     * @return The bytes, valid until the packet is modified, or an empty span when there aren't
+     *         enough left
+     */
+    std::span<const u8> ReadView(std::size_t size_in_bytes);
+
     /**
      * Clear the packet
      * After calling Clear, the packet is empty.
@@ -54,6 +70,12 @@ public:
      */
     std::size_t GetDataSize() const;
 
+    /**
+     * Moves the serialized data out of the packet, leaving it empty
+     * @return The bytes of the packet
+     */
+    std::vector<char> ReleaseData();
+
     /**
      * This function is useful to know if there is some data
      * left to be read, without actually reading it.
@@ -110,10 +132,18 @@ private:
      */
     bool CheckSize(std::size_t size);
 
+    /// Returns the bytes of the packet, either its own or the viewed buffer
+    std::span<const char> Contents() const;
+
+    /// Copies the viewed buffer into the packet so it can be written to
+    void DetachView();
+
     // Member data
-    std::vector<char> data;   ///< Data stored in the packet
-    std::size_t read_pos = 0; ///< Current reading position in the packet
-    bool is_valid = true;     ///< Reading state of the packet
+    std::vector<char> data;     ///< Data stored in the packet
+    std::span<const char> view; ///< Buffer read in place instead of data
+    bool is_view = false;       ///< Whether the packet reads the viewed buffer
+    std::size_t read_pos = 0;   ///< Current reading position in the packet
+    bool is_valid = true;       ///< Reading state of the packet
 };
 
 template <typename T>
@@ -3,21 +3,35 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <iomanip>
 #include <mutex>
+#include <optional>
 #include <random>
 #include <regex>
 #include <shared_mutex>
 #include <sstream>
 #include <thread>
+#include <utility>
 #include "common/logging/log.h"
+#include "common/lz4_compression.h"
 #include "enet/enet.h"
+#include "network/enet_packet.h"
 #include "network/packet.h"
 #include "network/room.h"
 #include "network/verify_user.h"
 
 namespace Network {
 
+// A batch this large is sent right away instead of waiting for the batching window to end
+constexpr std::size_t MaxBatchSize = 8 * 1024;
+
+// Smaller batches are not compressed, LZ4 saves close to nothing on them
+constexpr std::size_t MinCompressedBatchSize = 128;
+
+// Features the room can enable for the members that support them
+constexpr u32 SupportedFeatures = FeatureBatching | FeatureCompression;
+
 class Room::RoomImpl {
 public:
     std::mt19937 random_gen; ///< Random number generator. Used for GenerateFakeIPAddress
@@ -39,6 +53,10 @@ public:
         /// Data of the user, often including authenticated forum username.
         VerifyUser::UserData user_data;
         ENetPeer* peer; ///< The remote peer.
+        u32 features;   ///< Features enabled for the member, see RoomFeatures.
+        /// Relayed messages waiting to be sent together, and when the first of them was queued
+        Packet batch;
+        std::chrono::steady_clock::time_point batch_start;
     };
     using MemberList = std::vector<Member>;
     MemberList members;                     ///< Information about the members of this room
@@ -48,6 +66,20 @@ public:
     IPBanList ip_ban_list;             ///< List of banned IP addresses
     mutable std::mutex ban_list_mutex; ///< Mutex for the ban lists
 
+    /// Copies of received messages the room thread queued since the last flush
+    u64 forwarded_in_batch = 0;
+
+    /// How long relayed messages wait to be batched, zero when batching is disabled
+    std::chrono::milliseconds batch_window{};
+    /// When the oldest batch waiting has to be sent, if any batch is waiting
+    std::optional<std::chrono::steady_clock::time_point> next_batch_deadline;
+
+    RoomStats stats;                                ///< Traffic since the last stats reset
+    std::chrono::steady_clock::time_point stats_start; ///< Start of the stats period
+    std::chrono::nanoseconds total_dispatch_delay{};   ///< Dispatch delay of the batches
+    u64 num_batches = 0;                               ///< Batches of messages handled
+    mutable std::mutex stats_mutex;                    ///< Mutex for the stats
+
     RoomImpl() : random_gen(std::random_device()()) {}
 
     /// Thread that receives and dispatches network packets
@@ -60,6 +92,37 @@ public:
     void ServerLoop();
     void StartLoop();
 
+    /// Dispatches an event received by the room thread
+    void HandleEvent(ENetEvent& event);
+
+    /// Returns how long the room thread can wait for events before a batch has to be sent
+    enet_uint32 GetServiceTimeout() const;
+
+    /**
+     * Queues a relayed message in the batch of a member, sending the batch when it is full.
+     * Must be called from the room thread.
+     */
+    void QueueRelayedMessage(Member& member, const ENetPacket* enet_packet);
+
+    /**
+     * Sends the batches that waited for the whole batching window.
+     * @returns True when any batch was sent
+     */
+    bool SendExpiredBatches();
+
+    /// Sends the relayed messages waiting in the batch of a member
+    void SendBatch(Member& member);
+
+    /**
+     * Moves the traffic counters of ENet into the stats of the room.
+     * @param batch_start When the messages handled since the last call were received, if any
+     * @param num_messages Number of messages received
+     */
+    void CollectStats(std::optional<std::chrono::steady_clock::time_point> batch_start,
+                      u64 num_messages);
+
+    RoomStats GetAndResetStats();
+
     /**
      * Parses and answers a room join request from a client.
      * Validates the uniqueness of the username and assigns the MAC address
@@ -136,13 +199,13 @@ public:
      * Notifies the member that its connection attempt was successful,
      * and it is now part of the room.
      */
-    void SendJoinSuccess(ENetPeer* client, IPv4Address fake_ip);
+    void SendJoinSuccess(ENetPeer* client, IPv4Address fake_ip, u32 features);
 
     /**
      * Notifies the member that its connection attempt was successful,
      * and it is now part of the room, and it has been granted mod permissions.
      */
-    void SendJoinSuccessAsMod(ENetPeer* client, IPv4Address fake_ip);
+    void SendJoinSuccessAsMod(ENetPeer* client, IPv4Address fake_ip, u32 features);
 
     /**
      * Sends a IdHostKicked message telling the client that they have been kicked.
@@ -217,6 +280,13 @@ public:
      */
     void HandleLdnPacket(const ENetEvent* event);
 
+    /**
+     * Forwards a received packet to every member except the sender, or only to the member with
+     * the destination fake IP. The received packet is sent instead of a copy of it.
+     */
+    void ForwardPacket(const ENetEvent* event, bool broadcast,
+                       const IPv4Address& destination_address);
+
     /**
      * Extracts a chat entry from a received ENet packet and adds it to the chat queue.
      * @param event The ENet event that was received.
@@ -240,54 +310,188 @@ public:
 void Room::RoomImpl::ServerLoop() {
     while (state != State::Closed) {
         ENetEvent event;
-        if (enet_host_service(server, &event, 5) > 0) {
-            switch (event.type) {
-            case ENET_EVENT_TYPE_RECEIVE:
-                switch (event.packet->data[0]) {
-                case IdJoinRequest:
-                    HandleJoinRequest(&event);
-                    break;
-                case IdSetGameInfo:
-                    HandleGameInfoPacket(&event);
-                    break;
-                case IdProxyPacket:
-                    HandleProxyPacket(&event);
-                    break;
-                case IdLdnPacket:
-                    HandleLdnPacket(&event);
-                    break;
-                case IdChatMessage:
-                    HandleChatPacket(&event);
-                    break;
-                // Moderation
-                case IdModKick:
-                    HandleModKickPacket(&event);
-                    break;
-                case IdModBan:
-                    HandleModBanPacket(&event);
-                    break;
-                case IdModUnban:
-                    HandleModUnbanPacket(&event);
-                    break;
-                case IdModGetBanList:
-                    HandleModGetBanListPacket(&event);
-                    break;
-                }
-                enet_packet_destroy(event.packet);
-                break;
-            case ENET_EVENT_TYPE_DISCONNECT:
-                HandleClientDisconnection(event.peer);
-                break;
-            case ENET_EVENT_TYPE_NONE:
-            case ENET_EVENT_TYPE_CONNECT:
-                break;
+        if (enet_host_service(server, &event, GetServiceTimeout()) <= 0) {
+            if (SendExpiredBatches()) {
+                enet_host_flush(server);
             }
+            CollectStats(std::nullopt, 0);
+            continue;
         }
+        const auto batch_start = std::chrono::steady_clock::now();
+        u64 num_messages = 0;
+        // Handle every event ENet has already received before sending anything, so members get
+        // the messages forwarded to them in as few datagrams as possible
+        do {
+            if (event.type == ENET_EVENT_TYPE_RECEIVE) {
+                ++num_messages;
+            }
+            HandleEvent(event);
+        } while (enet_host_check_events(server, &event) > 0);
+        SendExpiredBatches();
+        enet_host_flush(server);
+        CollectStats(batch_start, num_messages);
     }
     // Close the connection to all members:
     SendCloseMessage();
 }
 
+void Room::RoomImpl::HandleEvent(ENetEvent& event) {
+    switch (event.type) {
+    case ENET_EVENT_TYPE_RECEIVE:
+        switch (event.packet->data[0]) {
+        case IdJoinRequest:
+            HandleJoinRequest(&event);
+            break;
+        case IdSetGameInfo:
+            HandleGameInfoPacket(&event);
+            break;
+        case IdProxyPacket:
+            HandleProxyPacket(&event);
+            break;
+        case IdLdnPacket:
+            HandleLdnPacket(&event);
+            break;
+        case IdChatMessage:
+            HandleChatPacket(&event);
+            break;
+        // Moderation
+        case IdModKick:
+            HandleModKickPacket(&event);
+            break;
+        case IdModBan:
+            HandleModBanPacket(&event);
+            break;
+        case IdModUnban:
+            HandleModUnbanPacket(&event);
+            break;
+        case IdModGetBanList:
+            HandleModGetBanListPacket(&event);
+            break;
+        }
+        // Forwarded packets are freed by ENet once every member they were sent to received them
+        if (event.packet->referenceCount == 0) {
+            enet_packet_destroy(event.packet);
+        }
+        break;
+    case ENET_EVENT_TYPE_DISCONNECT:
+        HandleClientDisconnection(event.peer);
+        break;
+    case ENET_EVENT_TYPE_NONE:
+    case ENET_EVENT_TYPE_CONNECT:
+        break;
+    }
+}
+
+enet_uint32 Room::RoomImpl::GetServiceTimeout() const {
+    constexpr std::chrono::milliseconds DefaultTimeout{5};
+    if (!next_batch_deadline) {
+        return static_cast<enet_uint32>(DefaultTimeout.count());
+    }
+    const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+        *next_batch_deadline - std::chrono::steady_clock::now());
+    return static_cast<enet_uint32>(
+        std::clamp(remaining, std::chrono::milliseconds{0}, DefaultTimeout).count());
+}
+
+void Room::RoomImpl::QueueRelayedMessage(Member& member, const ENetPacket* enet_packet) {
+    if (member.batch.GetDataSize() == 0) {
+        member.batch_start = std::chrono::steady_clock::now();
+        const auto deadline = member.batch_start + batch_window;
+        next_batch_deadline = next_batch_deadline ? std::min(*next_batch_deadline, deadline)
+                                                  : deadline;
+    }
+    member.batch.Write(static_cast<u32>(enet_packet->dataLength));
+    member.batch.Append(enet_packet->data, enet_packet->dataLength);
+    if (member.batch.GetDataSize() >= MaxBatchSize) {
+        SendBatch(member);
+    }
+}
+
+bool Room::RoomImpl::SendExpiredBatches() {
+    const auto now = std::chrono::steady_clock::now();
+    if (!next_batch_deadline || now < *next_batch_deadline) {
+        return false;
+    }
+    next_batch_deadline.reset();
+    bool sent = false;
+    std::shared_lock lock(member_mutex);
+    for (auto& member : members) {
+        if (member.batch.GetDataSize() == 0) {
+            continue;
+        }
+        const auto deadline = member.batch_start + batch_window;
+        if (now >= deadline) {
+            SendBatch(member);
+            sent = true;
+        } else {
+            next_batch_deadline =
+                next_batch_deadline ? std::min(*next_batch_deadline, deadline) : deadline;
+        }
+    }
+    return sent;
+}
+
+void Room::RoomImpl::SendBatch(Member& member) {
+    const auto* const messages = static_cast<const u8*>(member.batch.GetData());
+    const std::size_t size = member.batch.GetDataSize();
+    std::vector<u8> compressed;
+    if ((member.features & FeatureCompression) != 0 && size >= MinCompressedBatchSize) {
+        compressed = Common::Compression::CompressDataLZ4(messages, size);
+        if (compressed.size() >= size) {
+            compressed.clear();
+        }
+    }
+    const bool is_compressed = !compressed.empty();
+
+    Packet packet;
+    packet.Write(static_cast<u8>(IdBatch));
+    packet.Write(is_compressed);
+    packet.Write(static_cast<u32>(size));
+    if (is_compressed) {
+        packet.Append(compressed.data(), compressed.size());
+    } else {
+        packet.Append(messages, size);
+    }
+    member.batch.Clear();
+    enet_peer_send(member.peer, 0, CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE));
+
+    std::lock_guard lock(stats_mutex);
+    ++stats.batches_sent;
+    stats.batched_bytes += size;
+    stats.compressed_batch_bytes += is_compressed ? compressed.size() : size;
+}
+
+void Room::RoomImpl::CollectStats(std::optional<std::chrono::steady_clock::time_point> batch_start,
+                                  u64 num_messages) {
+    std::lock_guard lock(stats_mutex);
+    stats.datagrams_received += std::exchange(server->totalReceivedPackets, 0);
+    stats.bytes_received += std::exchange(server->totalReceivedData, 0);
+    stats.datagrams_sent += std::exchange(server->totalSentPackets, 0);
+    stats.bytes_sent += std::exchange(server->totalSentData, 0);
+    if (!batch_start) {
+        return;
+    }
+    const std::chrono::nanoseconds delay = std::chrono::steady_clock::now() - *batch_start;
+    stats.messages_received += num_messages;
+    stats.messages_forwarded += std::exchange(forwarded_in_batch, 0);
+    stats.max_dispatch_delay = std::max(stats.max_dispatch_delay, delay);
+    total_dispatch_delay += delay;
+    ++num_batches;
+}
+
+RoomStats Room::RoomImpl::GetAndResetStats() {
+    std::lock_guard lock(stats_mutex);
+    const auto now = std::chrono::steady_clock::now();
+    RoomStats result = std::exchange(stats, RoomStats{});
+    result.elapsed = now - std::exchange(stats_start, now);
+    if (num_batches > 0) {
+        result.average_dispatch_delay = total_dispatch_delay / num_batches;
+    }
+    total_dispatch_delay = {};
+    num_batches = 0;
+    return result;
+}
+
 void Room::RoomImpl::StartLoop() {
     room_thread = std::make_unique<std::thread>(&Room::RoomImpl::ServerLoop, this);
 }
@@ -300,8 +504,7 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
             return;
         }
     }
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet = ViewENetPacket(event->packet);
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
     std::string nickname;
     packet.Read(nickname);
@@ -318,6 +521,9 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
     std::string token;
     packet.Read(token);
 
+    u32 member_features = 0;
+    packet.Read(member_features);
+
     if (pass != password) {
         SendWrongPassword(event->peer);
         return;
@@ -349,6 +555,11 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
     member.fake_ip = preferred_fake_ip;
     member.nickname = nickname;
     member.peer = event->peer;
+    // Compression only applies to batches, so it is never enabled on its own
+    if (batch_window.count() > 0 && (member_features & FeatureBatching) != 0) {
+        member.features = member_features & SupportedFeatures;
+    }
+    const u32 features = member.features;
 
     std::string uid;
     {
@@ -392,9 +603,9 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
     // Notify everyone that the room information has changed.
     BroadcastRoomInformation();
     if (HasModPermission(event->peer)) {
-        SendJoinSuccessAsMod(event->peer, preferred_fake_ip);
+        SendJoinSuccessAsMod(event->peer, preferred_fake_ip, features);
     } else {
-        SendJoinSuccess(event->peer, preferred_fake_ip);
+        SendJoinSuccess(event->peer, preferred_fake_ip, features);
     }
 }
 
@@ -404,8 +615,7 @@ void Room::RoomImpl::HandleModKickPacket(const ENetEvent* event) {
         return;
     }
 
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet = ViewENetPacket(event->packet);
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
 
     std::string nickname;
@@ -446,8 +656,7 @@ void Room::RoomImpl::HandleModBanPacket(const ENetEvent* event) {
         return;
     }
 
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet = ViewENetPacket(event->packet);
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
 
     std::string nickname;
@@ -507,8 +716,7 @@ void Room::RoomImpl::HandleModUnbanPacket(const ENetEvent* event) {
         return;
     }
 
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet = ViewENetPacket(event->packet);
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
 
     std::string address;
@@ -591,8 +799,7 @@ void Room::RoomImpl::SendNameCollision(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdNameCollision));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -601,8 +808,7 @@ void Room::RoomImpl::SendIPCollision(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdIpCollision));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -611,8 +817,7 @@ void Room::RoomImpl::SendWrongPassword(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdWrongPassword));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -621,8 +826,7 @@ void Room::RoomImpl::SendRoomIsFull(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdRoomIsFull));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -632,28 +836,27 @@ void Room::RoomImpl::SendVersionMismatch(ENetPeer* client) {
     packet.Write(static_cast<u8>(IdVersionMismatch));
     packet.Write(network_version);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
 
-void Room::RoomImpl::SendJoinSuccess(ENetPeer* client, IPv4Address fake_ip) {
+void Room::RoomImpl::SendJoinSuccess(ENetPeer* client, IPv4Address fake_ip, u32 features) {
     Packet packet;
     packet.Write(static_cast<u8>(IdJoinSuccess));
     packet.Write(fake_ip);
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    packet.Write(features);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
 
-void Room::RoomImpl::SendJoinSuccessAsMod(ENetPeer* client, IPv4Address fake_ip) {
+void Room::RoomImpl::SendJoinSuccessAsMod(ENetPeer* client, IPv4Address fake_ip, u32 features) {
     Packet packet;
     packet.Write(static_cast<u8>(IdJoinSuccessAsMod));
     packet.Write(fake_ip);
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    packet.Write(features);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -662,8 +865,7 @@ void Room::RoomImpl::SendUserKicked(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdHostKicked));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -672,8 +874,7 @@ void Room::RoomImpl::SendUserBanned(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdHostBanned));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -682,8 +883,7 @@ void Room::RoomImpl::SendModPermissionDenied(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdModPermissionDenied));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -692,8 +892,7 @@ void Room::RoomImpl::SendModNoSuchUser(ENetPeer* client) {
     Packet packet;
     packet.Write(static_cast<u8>(IdModNoSuchUser));
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -707,8 +906,7 @@ void Room::RoomImpl::SendModBanListResponse(ENetPeer* client) {
         packet.Write(ip_ban_list);
     }
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -718,8 +916,7 @@ void Room::RoomImpl::SendCloseMessage() {
     packet.Write(static_cast<u8>(IdCloseRoom));
     std::lock_guard lock(member_mutex);
     if (!members.empty()) {
-        ENetPacket* enet_packet =
-            enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+        ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
         for (auto& member : members) {
             enet_peer_send(member.peer, 0, enet_packet);
         }
@@ -739,8 +936,7 @@ void Room::RoomImpl::SendStatusMessage(StatusMessageTypes type, const std::strin
     packet.Write(username);
     std::lock_guard lock(member_mutex);
     if (!members.empty()) {
-        ENetPacket* enet_packet =
-            enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+        ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
         for (auto& member : members) {
             enet_peer_send(member.peer, 0, enet_packet);
         }
@@ -794,8 +990,7 @@ void Room::RoomImpl::BroadcastRoomInformation() {
         }
     }
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
     enet_host_broadcast(server, 0, enet_packet);
     enet_host_flush(server);
 }
@@ -813,8 +1008,7 @@ IPv4Address Room::RoomImpl::GenerateFakeIPAddress() {
 }
 
 void Room::RoomImpl::HandleProxyPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    Packet in_packet = ViewENetPacket(event->packet);
     in_packet.IgnoreBytes(sizeof(u8)); // Message type
 
     in_packet.IgnoreBytes(sizeof(u8));          // Domain
@@ -831,48 +1025,11 @@ void Room::RoomImpl::HandleProxyPacket(const ENetEvent* event) {
     bool broadcast;
     in_packet.Read(broadcast); // Broadcast
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
-
-    const auto& destination_address = remote_ip;
-    if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
-        for (const auto& member : members) {
-            if (member.peer != event->peer) {
-                sent_packet = true;
-                enet_peer_send(member.peer, 0, enet_packet);
-            }
-        }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
-    } else { // Send the data only to the destination client
-        std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
-                                       return member_entry.fake_ip == destination_address;
-                                   });
-        if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
-        } else {
-            LOG_ERROR(Network,
-                      "Attempting to send to unknown IP address: "
-                      "{}.{}.{}.{}",
-                      destination_address[0], destination_address[1], destination_address[2],
-                      destination_address[3]);
-            enet_packet_destroy(enet_packet);
-        }
-    }
-    enet_host_flush(server);
+    ForwardPacket(event, broadcast, remote_ip);
 }
 
 void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    Packet in_packet = ViewENetPacket(event->packet);
 
     in_packet.IgnoreBytes(sizeof(u8)); // Message type
 
@@ -885,48 +1042,51 @@ void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
     bool broadcast;
     in_packet.Read(broadcast); // Broadcast
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
+    ForwardPacket(event, broadcast, remote_ip);
+}
+
+void Room::RoomImpl::ForwardPacket(const ENetEvent* event, bool broadcast,
+                                   const IPv4Address& destination_address) {
+    // Members always receive forwarded packets reliably
+    ENetPacket* const enet_packet = event->packet;
+    enet_packet->flags = ENET_PACKET_FLAG_RELIABLE;
+
+    const auto send = [this, enet_packet](Member& member) {
+        if ((member.features & FeatureBatching) != 0) {
+            QueueRelayedMessage(member, enet_packet);
+        } else {
+            enet_peer_send(member.peer, 0, enet_packet);
+        }
+        ++forwarded_in_batch;
+    };
 
-    const auto& destination_address = remote_ip;
+    std::shared_lock lock(member_mutex);
     if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
-        for (const auto& member : members) {
+        for (auto& member : members) {
             if (member.peer != event->peer) {
-                sent_packet = true;
-                enet_peer_send(member.peer, 0, enet_packet);
+                send(member);
             }
         }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
+        return;
+    }
+    // Send the data only to the destination client
+    const auto member = std::find_if(members.begin(), members.end(),
+                                     [&destination_address](const Member& member_entry) -> bool {
+                                         return member_entry.fake_ip == destination_address;
+                                     });
+    if (member != members.end()) {
+        send(*member);
     } else {
-        std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
-                                       return member_entry.fake_ip == destination_address;
-                                   });
-        if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
-        } else {
-            LOG_ERROR(Network,
-                      "Attempting to send to unknown IP address: "
-                      "{}.{}.{}.{}",
-                      destination_address[0], destination_address[1], destination_address[2],
-                      destination_address[3]);
-            enet_packet_destroy(enet_packet);
-        }
+        LOG_ERROR(Network,
+                  "Attempting to send to unknown IP address: "
+                  "{}.{}.{}.{}",
+                  destination_address[0], destination_address[1], destination_address[2],
+                  destination_address[3]);
     }
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    Packet in_packet = ViewENetPacket(event->packet);
 
     in_packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
     std::string message;
@@ -950,13 +1110,13 @@ void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
     out_packet.Write(sending_member->user_data.username);
     out_packet.Write(message);
 
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
+    ENetPacket* enet_packet = CreateENetPacket(std::move(out_packet), ENET_PACKET_FLAG_RELIABLE);
     bool sent_packet = false;
     for (const auto& member : members) {
         if (member.peer != event->peer) {
             sent_packet = true;
             enet_peer_send(member.peer, 0, enet_packet);
+            ++forwarded_in_batch;
         }
     }
 
@@ -964,8 +1124,6 @@ void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
         enet_packet_destroy(enet_packet);
     }
 
-    enet_host_flush(server);
-
     if (sending_member->user_data.username.empty()) {
         LOG_INFO(Network, "{}: {}", sending_member->nickname, message);
     } else {
@@ -975,8 +1133,7 @@ void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
 }
 
 void Room::RoomImpl::HandleGameInfoPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    Packet in_packet = ViewENetPacket(event->packet);
 
     in_packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
     GameInfo game_info;
@@ -1070,6 +1227,7 @@ bool Room::Create(const std::string& name, const std::string& description,
     room_impl->room_information.preferred_game = preferred_game;
     room_impl->room_information.host_username = host_username;
     room_impl->room_information.enable_yuzu_mods = enable_yuzu_mods;
+    room_impl->stats_start = std::chrono::steady_clock::now();
     room_impl->password = password;
     room_impl->verify_backend = std::move(verify_backend);
     room_impl->username_ban_list = ban_list.first;
@@ -1117,6 +1275,14 @@ bool Room::HasPassword() const {
     return !room_impl->password.empty();
 }
 
+RoomStats Room::GetAndResetStats() {
+    return room_impl->GetAndResetStats();
+}
+
+void Room::SetRelayBatching(std::chrono::milliseconds window) {
+    room_impl->batch_window = window;
+}
+
 void Room::SetVerifyUID(const std::string& uid) {
     std::lock_guard lock(room_impl->verify_uid_mutex);
     room_impl->verify_uid = uid;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -61,6 +62,22 @@ enum RoomMessageTypes : u8 {
     IdModPermissionDenied,
     IdModNoSuchUser,
     IdJoinSuccessAsMod,
+    /// Relayed messages sent together, see RoomFeatures::FeatureBatching
+    IdBatch,
+};
+
+/**
+ * Optional features a member supports, sent at the end of the join request. The room answers with
+ * the ones it enabled for the member at the end of the join success message. Older members and
+ * rooms don't send them, which reads as no features.
+ */
+enum RoomFeatures : u32 {
+    /// Proxy and LDN messages relayed to the member can arrive together in an IdBatch message:
+    /// <u8 IdBatch><bool compressed><u32 size of the messages><messages>, the messages being LZ4
+    /// compressed when flagged. Each message is <u32 size><bytes of the message>
+    FeatureBatching = 1 << 0,
+    /// Batches sent to the member can be compressed
+    FeatureCompression = 1 << 1,
 };
 
 /// Types of system status messages
@@ -72,6 +89,28 @@ enum StatusMessageTypes : u8 {
     IdAddressUnbanned, ///< A username / ip address is unbanned from the room
 };
 
+/// Traffic handled by a room during a period of time
+struct RoomStats {
+    /// Length of the period
+    std::chrono::nanoseconds elapsed{};
+    /// UDP datagrams and bytes on the wire, including ENet acknowledgements and resends
+    u64 datagrams_received{};
+    u64 bytes_received{};
+    u64 datagrams_sent{};
+    u64 bytes_sent{};
+    /// Messages received from the members, and copies of them sent to other members
+    u64 messages_received{};
+    u64 messages_forwarded{};
+    /// Batches of relayed messages sent, and the size of their messages before and after
+    /// compression
+    u64 batches_sent{};
+    u64 batched_bytes{};
+    u64 compressed_batch_bytes{};
+    /// Time from the room thread receiving messages to sending out the copies it forwards
+    std::chrono::nanoseconds average_dispatch_delay{};
+    std::chrono::nanoseconds max_dispatch_delay{};
+};
+
 /// This is what a server [person creating a server] would use.
 class Room final {
 public:
@@ -125,6 +164,14 @@ public:
                 std::unique_ptr<VerifyUser::Backend> verify_backend = nullptr,
                 const BanList& ban_list = {}, bool enable_yuzu_mods = false);
 
+    /**
+     * Makes the room hold the proxy and LDN messages it relays to each member for up to a window,
+     * and send them together, compressed when it saves space. Only members that announce support
+     * for it get batches. Must be called before Create.
+     * @param window How long a relayed message can wait, zero disables batching
+     */
+    void SetRelayBatching(std::chrono::milliseconds window);
+
     /**
      * Sets the verification GUID of the room.
      */
@@ -135,6 +182,11 @@ public:
      */
     BanList GetBanList() const;
 
+    /**
+     * Gets the traffic of the room since the previous call, or since the room was created.
+     */
+    RoomStats GetAndResetStats();
+
     /**
      * Destroys the socket
      */
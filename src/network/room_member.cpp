@@ -7,8 +7,11 @@
 #include <set>
 #include <thread>
 #include "common/assert.h"
+#include "common/logging/log.h"
+#include "common/lz4_compression.h"
 #include "common/socket_types.h"
 #include "enet/enet.h"
+#include "network/enet_packet.h"
 #include "network/packet.h"
 #include "network/room_member.h"
 
@@ -16,6 +19,9 @@ namespace Network {
 
 constexpr u32 ConnectionTimeoutMs = 5000;
 
+// Largest batch accepted from the room, it sends them once they pass a few KiB
+constexpr u32 MaxBatchSize = 1024 * 1024;
+
 class RoomMember::RoomMemberImpl {
 public:
     ENetHost* client = nullptr; ///< ENet network interface.
@@ -40,6 +46,7 @@ public:
     mutable std::mutex username_mutex; ///< Mutex for locking username.
 
     IPv4Address fake_ip; ///< The fake ip of this member.
+    u32 features = 0;    ///< Features the room enabled for this member, see RoomFeatures.
 
     std::mutex network_mutex; ///< Mutex that controls access to the `client` variable.
     /// Thread that receives and dispatches network packets
@@ -103,16 +110,22 @@ public:
     void HandleRoomInformationPacket(const ENetEvent* event);
 
     /**
-     * Extracts a ProxyPacket from a received ENet packet.
-     * @param event The ENet event that was received.
+     * Extracts a ProxyPacket from a received message.
+     * @param packet The message that was received.
+     */
+    void HandleProxyPackets(Packet&& packet);
+
+    /**
+     * Extracts an LdnPacket from a received message.
+     * @param packet The message that was received.
      */
-    void HandleProxyPackets(const ENetEvent* event);
+    void HandleLdnPackets(Packet&& packet);
 
     /**
-     * Extracts an LdnPacket from a received ENet packet.
+     * Extracts the relayed messages of a batch and handles each of them.
      * @param event The ENet event that was received.
      */
-    void HandleLdnPackets(const ENetEvent* event);
+    void HandleBatchPacket(const ENetEvent* event);
 
     /**
      * Extracts a chat entry from a received ENet packet and adds it to the chat queue.
@@ -171,10 +184,13 @@ void RoomMember::RoomMemberImpl::MemberLoop() {
             case ENET_EVENT_TYPE_RECEIVE:
                 switch (event.packet->data[0]) {
                 case IdProxyPacket:
-                    HandleProxyPackets(&event);
+                    HandleProxyPackets(ViewENetPacket(event.packet));
                     break;
                 case IdLdnPacket:
-                    HandleLdnPackets(&event);
+                    HandleLdnPackets(ViewENetPacket(event.packet));
+                    break;
+                case IdBatch:
+                    HandleBatchPacket(&event);
                     break;
                 case IdChatMessage:
                     HandleChatPacket(&event);
@@ -262,9 +278,8 @@ void RoomMember::RoomMemberImpl::MemberLoop() {
             std::lock_guard send_lock(send_list_mutex);
             packets.swap(send_list);
         }
-        for (const auto& packet : packets) {
-            ENetPacket* enetPacket = enet_packet_create(packet.GetData(), packet.GetDataSize(),
-                                                        ENET_PACKET_FLAG_RELIABLE);
+        for (auto& packet : packets) {
+            ENetPacket* enetPacket = CreateENetPacket(std::move(packet), ENET_PACKET_FLAG_RELIABLE);
             enet_peer_send(server, 0, enetPacket);
         }
         enet_host_flush(client);
@@ -292,12 +307,12 @@ void RoomMember::RoomMemberImpl::SendJoinRequest(const std::string& nickname_,
     packet.Write(network_version);
     packet.Write(password);
     packet.Write(token);
+    packet.Write(static_cast<u32>(FeatureBatching | FeatureCompression));
     Send(std::move(packet));
 }
 
 void RoomMember::RoomMemberImpl::HandleRoomInformationPacket(const ENetEvent* event) {
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet = ViewENetPacket(event->packet);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
@@ -341,20 +356,18 @@ void RoomMember::RoomMemberImpl::HandleRoomInformationPacket(const ENetEvent* ev
 }
 
 void RoomMember::RoomMemberImpl::HandleJoinPacket(const ENetEvent* event) {
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet = ViewENetPacket(event->packet);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
 
     // Parse the MAC Address from the packet
     packet.Read(fake_ip);
+    packet.Read(features);
 }
 
-void RoomMember::RoomMemberImpl::HandleProxyPackets(const ENetEvent* event) {
+void RoomMember::RoomMemberImpl::HandleProxyPackets(Packet&& packet) {
     ProxyPacket proxy_packet{};
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
@@ -382,10 +395,8 @@ void RoomMember::RoomMemberImpl::HandleProxyPackets(const ENetEvent* event) {
     Invoke<ProxyPacket>(proxy_packet);
 }
 
-void RoomMember::RoomMemberImpl::HandleLdnPackets(const ENetEvent* event) {
+void RoomMember::RoomMemberImpl::HandleLdnPackets(Packet&& packet) {
     LDNPacket ldn_packet{};
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
@@ -403,9 +414,57 @@ void RoomMember::RoomMemberImpl::HandleLdnPackets(const ENetEvent* event) {
     Invoke<LDNPacket>(ldn_packet);
 }
 
+void RoomMember::RoomMemberImpl::HandleBatchPacket(const ENetEvent* event) {
+    Packet packet = ViewENetPacket(event->packet);
+    packet.IgnoreBytes(sizeof(u8)); // Ignore the message type
+
+    bool is_compressed = false;
+    packet.Read(is_compressed);
+    u32 size = 0;
+    packet.Read(size);
+    if (!packet || size > MaxBatchSize) {
+        LOG_ERROR(Network, "Received an invalid batch");
+        return;
+    }
+
+    // Message type, compressed flag and size
+    constexpr std::size_t HeaderSize = sizeof(u8) + sizeof(u8) + sizeof(u32);
+    const std::span<const u8> payload{event->packet->data + HeaderSize,
+                                      event->packet->dataLength - HeaderSize};
+    std::vector<u8> decompressed;
+    if (is_compressed) {
+        decompressed = Common::Compression::DecompressDataLZ4(payload, size);
+        if (decompressed.size() != size) {
+            LOG_ERROR(Network, "Received a batch that failed to decompress");
+            return;
+        }
+    }
+    Packet messages{is_compressed ? std::span<const u8>{decompressed} : payload};
+
+    while (!messages.EndOfPacket()) {
+        u32 message_size = 0;
+        messages.Read(message_size);
+        const std::span<const u8> message = messages.ReadView(message_size);
+        if (message.empty()) {
+            LOG_ERROR(Network, "Received a truncated batch");
+            return;
+        }
+        switch (message[0]) {
+        case IdProxyPacket:
+            HandleProxyPackets(Packet{message});
+            break;
+        case IdLdnPacket:
+            HandleLdnPackets(Packet{message});
+            break;
+        default:
+            LOG_ERROR(Network, "Received a batch with an unexpected message {}", message[0]);
+            break;
+        }
+    }
+}
+
 void RoomMember::RoomMemberImpl::HandleChatPacket(const ENetEvent* event) {
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet = ViewENetPacket(event->packet);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8));
@@ -418,8 +477,7 @@ void RoomMember::RoomMemberImpl::HandleChatPacket(const ENetEvent* event) {
 }
 
 void RoomMember::RoomMemberImpl::HandleStatusMessagePacket(const ENetEvent* event) {
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet = ViewENetPacket(event->packet);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8));
@@ -434,8 +492,7 @@ void RoomMember::RoomMemberImpl::HandleStatusMessagePacket(const ENetEvent* even
 }
 
 void RoomMember::RoomMemberImpl::HandleModBanListResponsePacket(const ENetEvent* event) {
-    Packet packet;
-    packet.Append(event->packet->data, event->packet->dataLength);
+    Packet packet = ViewENetPacket(event->packet);
 
     // Ignore the first byte, which is the message id.
     packet.IgnoreBytes(sizeof(u8));
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "common/logging/backend.h"
+#include "shader_bench/shader_bench.h"
+#include "video_core/shader_environment.h"
+
+// Inputs are the decompressed environments of a pipeline cache record,
+// yuzu-shader-bench --corpus extracts them from existing pipeline caches.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    static ShaderBench::Bench bench{[] {
+        Common::Log::DisableLoggingInTests();
+        return ShaderBench::Options{};
+    }()};
+    std::vector<VideoCommon::FileEnvironment> envs{
+        ShaderBench::ParseEnvironments(std::span(data, size))};
+    if (!envs.empty()) {
+        // Rejected programs are expected, anything but a Shader::Exception escapes
+        (void)bench.RunPipeline(envs);
+    }
+    return 0;
+}
@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fmt/format.h>
+#include <getopt.h>
+
+#include "common/cityhash.h"
+#include "common/common_types.h"
+#include "common/logging/backend.h"
+#include "common/logging/filter.h"
+#include "common/polyfill_thread.h"
+#include "shader_bench/shader_bench.h"
+#include "video_core/shader_environment.h"
+
+namespace {
+/// Parses the numeric argument of an option, values below one are raised to one
+std::optional<u32> ParseCount(const char* text) {
+    const char* const end = text + std::strlen(text);
+    u32 value{};
+    const auto [ptr, ec] = std::from_chars(text, end, value);
+    if (ec != std::errc{} || ptr != end) {
+        return std::nullopt;
+    }
+    return std::max(value, 1U);
+}
+
+void PrintHelp(const char* argv0) {
+    std::cout << "Usage: " << argv0
+              << " [options] <pipeline cache>...\n"
+                 "-b, --backend         Only emit with the given backend (spirv, glsl, glasm),\n"
+                 "                      may be repeated\n"
+                 "-c, --corpus          Write every pipeline to the given directory as a fuzzer "
+                 "input\n"
+                 "-h, --help            Display this help and exit\n"
+                 "-n, --iterations      Number of times every pipeline is recompiled\n";
+}
+
+void WriteCorpus(const std::filesystem::path& directory,
+                 const VideoCommon::CachedPipeline& pipeline) {
+    const std::vector<u8> data{pipeline.EnvironmentsData()};
+    if (data.empty()) {
+        return;
+    }
+    const u64 hash{Common::CityHash64(reinterpret_cast<const char*>(data.data()), data.size())};
+    std::ofstream file(directory / fmt::format("{:016x}.bin", hash), std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data.data()),
+               static_cast<std::streamsize>(data.size()));
+}
+
+void PrintStatistics(const ShaderBench::Statistics& stats) {
+    const u64 num_programs{std::max<u64>(stats.num_programs, 1)};
+    fmt::print("Pipelines: {} ({} rejected)\n", stats.num_pipelines, stats.num_failures);
+    fmt::print("Programs: {}, blocks: {}, IR instructions: {} ({:.1f} per program)\n",
+               stats.num_programs, stats.num_blocks, stats.num_instructions,
+               static_cast<double>(stats.num_instructions) / static_cast<double>(num_programs));
+    fmt::print("SPIR-V words: {}, GLSL bytes: {}, GLASM bytes: {}\n", stats.spirv_words,
+               stats.glsl_size, stats.glasm_size);
+    fmt::print("{:<14}{:>12}{:>18}\n", "Phase", "Total (ms)", "Per program (us)");
+    for (size_t index = 0; index < ShaderBench::NUM_PHASES; ++index) {
+        const auto phase{static_cast<ShaderBench::Phase>(index)};
+        const auto time{stats.phase_times[index]};
+        const double total_ms{std::chrono::duration<double, std::milli>(time).count()};
+        const double average_us{std::chrono::duration<double, std::micro>(time).count() /
+                                static_cast<double>(num_programs)};
+        fmt::print("{:<14}{:>12.2f}{:>18.2f}\n", ShaderBench::PhaseName(phase), total_ms,
+                   average_us);
+    }
+}
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    Common::Log::Initialize();
+    Common::Log::SetColorConsoleBackendEnabled(true);
+    Common::Log::Start();
+
+    // Translation logs every unimplemented feature it finds, keep the report readable
+    Common::Log::Filter filter;
+    filter.ParseFilterString("*:Error");
+    Common::Log::SetGlobalFilter(filter);
+
+    std::optional<ShaderBench::Options> options;
+    std::optional<std::filesystem::path> corpus_directory;
+    u32 iterations{1};
+
+    static struct option long_options[] = {
+        // clang-format off
+        {"backend", required_argument, 0, 'b'},
+        {"corpus", required_argument, 0, 'c'},
+        {"help", no_argument, 0, 'h'},
+        {"iterations", required_argument, 0, 'n'},
+        {0, 0, 0, 0},
+        // clang-format on
+    };
+    int option_index = 0;
+    int arg;
+    while ((arg = getopt_long(argc, argv, "b:c:hn:", long_options, &option_index)) != -1) {
+        switch (static_cast<char>(arg)) {
+        case 'b': {
+            if (!options) {
+                options = ShaderBench::Options{
+                    .emit_spirv = false,
+                    .emit_glsl = false,
+                    .emit_glasm = false,
+                };
+            }
+            const std::string backend{optarg};
+            if (backend == "spirv") {
+                options->emit_spirv = true;
+            } else if (backend == "glsl") {
+                options->emit_glsl = true;
+            } else if (backend == "glasm") {
+                options->emit_glasm = true;
+            } else {
+                std::cerr << "Unknown backend " << backend << '\n';
+                return 1;
+            }
+            break;
+        }
+        case 'c':
+            corpus_directory = optarg;
+            break;
+        case 'h':
+            PrintHelp(argv[0]);
+            return 0;
+        case 'n': {
+            const std::optional<u32> count{ParseCount(optarg)};
+            if (!count) {
+                PrintHelp(argv[0]);
+                return 1;
+            }
+            iterations = *count;
+            break;
+        }
+        default:
+            PrintHelp(argv[0]);
+            return 1;
+        }
+    }
+    if (optind == argc) {
+        PrintHelp(argv[0]);
+        return 1;
+    }
+    if (corpus_directory) {
+        std::filesystem::create_directories(*corpus_directory);
+    }
+
+    std::vector<VideoCommon::CachedPipeline> pipelines;
+    for (int index = optind; index < argc; ++index) {
+        const std::filesystem::path filename{argv[index]};
+        // Load with the file's own version, mismatching versions would delete the file
+        const std::optional<u32> cache_version{VideoCommon::ReadPipelineCacheVersion(filename)};
+        if (!cache_version) {
+            std::cerr << argv[index] << " is not a pipeline cache file\n";
+            return 1;
+        }
+        const auto load{[&](VideoCommon::CachedPipeline pipeline) {
+            if (corpus_directory) {
+                WriteCorpus(*corpus_directory, pipeline);
+            }
+            pipelines.push_back(std::move(pipeline));
+        }};
+        VideoCommon::LoadPipelines(std::stop_token{}, filename, *cache_version, load, load);
+    }
+
+    ShaderBench::Bench bench{options.value_or(ShaderBench::Options{})};
+    for (u32 iteration = 0; iteration < iterations; ++iteration) {
+        for (const VideoCommon::CachedPipeline& pipeline : pipelines) {
+            std::vector<VideoCommon::FileEnvironment> envs{pipeline.Environments()};
+            if (!envs.empty()) {
+                (void)bench.RunPipeline(envs);
+            }
+        }
+    }
+    PrintStatistics(bench.GetStatistics());
+
+    Common::Log::Stop();
+    return 0;
+}
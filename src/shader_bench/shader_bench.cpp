@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <ios>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "shader_bench/shader_bench.h"
+#include "shader_recompiler/backend/bindings.h"
+#include "shader_recompiler/backend/glasm/emit_glasm.h"
+#include "shader_recompiler/backend/glsl/emit_glsl.h"
+#include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/program_header.h"
+#include "shader_recompiler/runtime_info.h"
+
+namespace ShaderBench {
+namespace {
+constexpr size_t MAX_PIPELINE_ENVS = 5;
+
+/// Capabilities of a recent desktop driver, so every backend path is exercised
+Shader::Profile MakeProfile() {
+    return Shader::Profile{
+        .supported_spirv = 0x00010600,
+        .unified_descriptor_binding = true,
+        .support_descriptor_aliasing = true,
+        .support_int8 = true,
+        .support_int16 = true,
+        .support_int64 = true,
+        .support_vertex_instance_id = false,
+        .support_float_controls = true,
+        .support_separate_denorm_behavior = true,
+        .support_separate_rounding_mode = true,
+        .support_fp16_denorm_preserve = true,
+        .support_fp32_denorm_preserve = true,
+        .support_fp16_denorm_flush = true,
+        .support_fp32_denorm_flush = true,
+        .support_fp16_signed_zero_nan_preserve = true,
+        .support_fp32_signed_zero_nan_preserve = true,
+        .support_fp64_signed_zero_nan_preserve = true,
+        .support_explicit_workgroup_layout = true,
+        .support_vote = true,
+        .support_viewport_index_layer_non_geometry = true,
+        .support_viewport_mask = true,
+        .support_typeless_image_loads = true,
+        .support_demote_to_helper_invocation = true,
+        .support_int64_atomics = true,
+        .support_derivative_control = true,
+        .support_geometry_shader_passthrough = false,
+        .support_native_ndc = true,
+        .support_gl_nv_gpu_shader_5 = true,
+        .support_gl_amd_gpu_shader_half_float = false,
+        .support_gl_texture_shadow_lod = true,
+        .support_gl_warp_intrinsics = true,
+        .support_gl_variable_aoffi = true,
+        .support_gl_sparse_textures = true,
+        .support_gl_derivative_control = true,
+        .support_scaled_attributes = true,
+        .support_multi_viewport = true,
+        .support_geometry_streams = true,
+        .warp_size_potentially_larger_than_guest = false,
+        .gl_max_compute_smem_size = 48 * 1024,
+        .min_ssbo_alignment = 16,
+        .max_user_clip_distances = 8,
+    };
+}
+
+Shader::HostTranslateInfo MakeHostInfo() {
+    return Shader::HostTranslateInfo{
+        .support_float64 = true,
+        .support_float16 = true,
+        .support_int64 = true,
+        .needs_demote_reorder = false,
+        .support_snorm_render_buffer = true,
+        .support_viewport_index_layer = true,
+        .min_ssbo_alignment = 16,
+        .support_geometry_shader_passthrough = false,
+        .support_conditional_barrier = true,
+    };
+}
+} // Anonymous namespace
+
+const char* PhaseName(Phase phase) {
+    switch (phase) {
+    case Phase::ControlFlow:
+        return "Control flow";
+    case Phase::Translate:
+        return "Translate";
+    case Phase::SPIRV:
+        return "SPIR-V";
+    case Phase::GLSL:
+        return "GLSL";
+    case Phase::GLASM:
+        return "GLASM";
+    }
+    return "Invalid";
+}
+
+Bench::Bench(const Options& options_)
+    : options{options_}, profile{MakeProfile()}, host_info{MakeHostInfo()} {}
+
+Bench::~Bench() = default;
+
+bool Bench::RunPipeline(std::span<VideoCommon::FileEnvironment> envs) {
+    ++statistics.num_pipelines;
+    bool succeeded{true};
+    try {
+        std::optional<Shader::IR::Program> vertex_a;
+        for (VideoCommon::FileEnvironment& env : envs) {
+            const bool is_vertex_a{env.ShaderStage() == Shader::Stage::VertexA};
+            const u32 cfg_offset{
+                static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
+            const auto cfg_start{Clock::now()};
+            Shader::Maxwell::Flow::CFG cfg(env, flow_block_pool, cfg_offset, is_vertex_a);
+            AddTime(Phase::ControlFlow, cfg_start);
+
+            const auto translate_start{Clock::now()};
+            Shader::IR::Program program{
+                Shader::Maxwell::TranslateProgram(inst_pool, block_pool, env, cfg, host_info)};
+            if (!is_vertex_a && vertex_a && env.ShaderStage() == Shader::Stage::VertexB) {
+                program = Shader::Maxwell::MergeDualVertexPrograms(*vertex_a, program, env);
+            }
+            AddTime(Phase::Translate, translate_start);
+            ++statistics.num_programs;
+
+            if (is_vertex_a) {
+                vertex_a = std::move(program);
+                continue;
+            }
+            vertex_a.reset();
+            Emit(program);
+        }
+    } catch (const Shader::Exception&) {
+        ++statistics.num_failures;
+        succeeded = false;
+    }
+    emit_inst_pool.ReleaseContents();
+    emit_block_pool.ReleaseContents();
+    flow_block_pool.ReleaseContents();
+    block_pool.ReleaseContents();
+    inst_pool.ReleaseContents();
+    return succeeded;
+}
+
+void Bench::Emit(Shader::IR::Program& program) {
+    statistics.num_blocks += program.blocks.size();
+    for (Shader::IR::Block* const block : program.blocks) {
+        statistics.num_instructions += block->Instructions().size();
+    }
+    Shader::RuntimeInfo runtime_info;
+    runtime_info.previous_stage_stores.mask.set();
+    Shader::Maxwell::ConvertLegacyToGeneric(program, runtime_info);
+
+    // Backends modify the program while emitting it, each one gets its own copy
+    const auto emit{[&](bool enabled, Phase phase, auto&& func) -> u64 {
+        if (!enabled) {
+            return 0;
+        }
+        emit_inst_pool.ReleaseContents();
+        emit_block_pool.ReleaseContents();
+        Shader::IR::Program copy{
+            Shader::IR::CloneProgram(emit_inst_pool, emit_block_pool, program)};
+        Shader::Backend::Bindings bindings;
+        const auto start{Clock::now()};
+        const u64 size{func(copy, bindings)};
+        AddTime(phase, start);
+        return size;
+    }};
+    statistics.spirv_words +=
+        emit(options.emit_spirv, Phase::SPIRV, [&](Shader::IR::Program& copy, auto& bindings) {
+            return Shader::Backend::SPIRV::EmitSPIRV(profile, runtime_info, copy, bindings)
+                .size();
+        });
+    statistics.glsl_size +=
+        emit(options.emit_glsl, Phase::GLSL, [&](Shader::IR::Program& copy, auto& bindings) {
+            return Shader::Backend::GLSL::EmitGLSL(profile, runtime_info, copy, bindings).size();
+        });
+    statistics.glasm_size +=
+        emit(options.emit_glasm, Phase::GLASM, [&](Shader::IR::Program& copy, auto& bindings) {
+            return Shader::Backend::GLASM::EmitGLASM(profile, runtime_info, copy, bindings)
+                .size();
+        });
+}
+
+void Bench::AddTime(Phase phase, Clock::time_point start) {
+    statistics.phase_times[static_cast<size_t>(phase)] += Clock::now() - start;
+}
+
+std::vector<VideoCommon::FileEnvironment> ParseEnvironments(std::span<const u8> data) {
+    std::istringstream stream(std::string(reinterpret_cast<const char*>(data.data()), data.size()));
+    stream.exceptions(std::ios::failbit);
+    std::vector<VideoCommon::FileEnvironment> envs;
+    try {
+        size_t offset{};
+        while (offset < data.size()) {
+            if (envs.size() == MAX_PIPELINE_ENVS || data.size() - offset < sizeof(u64)) {
+                return {};
+            }
+            // Deserialize trusts the code size, reject sizes larger than the input
+            u64 code_size{};
+            std::memcpy(&code_size, data.data() + offset, sizeof(code_size));
+            if (code_size > data.size()) {
+                return {};
+            }
+            envs.emplace_back().Deserialize(stream);
+            if (envs.back().ShaderStage() > Shader::Stage::VertexA) {
+                return {};
+            }
+            offset = static_cast<size_t>(stream.tellg());
+        }
+    } catch (const std::ios_base::failure&) {
+        return {};
+    }
+    return envs;
+}
+
+} // namespace ShaderBench
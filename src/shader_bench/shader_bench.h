@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/object_pool.h"
+#include "shader_recompiler/profile.h"
+#include "video_core/shader_environment.h"
+
+namespace ShaderBench {
+
+enum class Phase : u32 {
+    ControlFlow, ///< Decoding and control flow analysis
+    Translate,   ///< IR translation and optimization passes
+    SPIRV,
+    GLSL,
+    GLASM,
+};
+constexpr size_t NUM_PHASES = 5;
+
+[[nodiscard]] const char* PhaseName(Phase phase);
+
+struct Options {
+    bool emit_spirv{true};
+    bool emit_glsl{true};
+    bool emit_glasm{true};
+};
+
+struct Statistics {
+    std::array<std::chrono::nanoseconds, NUM_PHASES> phase_times{};
+    u64 num_pipelines{};
+    u64 num_failures{};
+    u64 num_programs{};
+    u64 num_blocks{};
+    u64 num_instructions{};
+    u64 spirv_words{};
+    u64 glsl_size{};
+    u64 glasm_size{};
+};
+
+/// Runs the shader recompiler on pipelines loaded from pipeline cache files
+class Bench {
+public:
+    explicit Bench(const Options& options);
+    ~Bench();
+
+    /// Translates the environments of a pipeline and emits them with every enabled backend
+    /// @returns False when the recompiler rejected one of the stages
+    bool RunPipeline(std::span<VideoCommon::FileEnvironment> envs);
+
+    [[nodiscard]] const Statistics& GetStatistics() const noexcept {
+        return statistics;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void Emit(Shader::IR::Program& program);
+
+    void AddTime(Phase phase, Clock::time_point start);
+
+    Options options;
+    Statistics statistics;
+    Shader::Profile profile;
+    Shader::HostTranslateInfo host_info;
+
+    Shader::ObjectPool<Shader::IR::Inst> inst_pool{8192};
+    Shader::ObjectPool<Shader::IR::Block> block_pool{32};
+    Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block_pool{32};
+    Shader::ObjectPool<Shader::IR::Inst> emit_inst_pool{8192};
+    Shader::ObjectPool<Shader::IR::Block> emit_block_pool{32};
+};
+
+/// Parses environments serialized back to back, the layout of a pipeline cache record.
+/// Malformed data is rejected instead of trusted, so it can be used on fuzzer inputs.
+/// @returns The environments, or an empty vector when the data is malformed
+[[nodiscard]] std::vector<VideoCommon::FileEnvironment> ParseEnvironments(
+    std::span<const u8> data);
+
+} // namespace ShaderBench
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include "common/alignment.h"
+#include "common/logging/log.h"
+#include "shader_recompiler/arena.h"
+
+namespace Shader {
+
+Arena::Arena(size_t block_size_) : block_size{block_size_} {
+    PushBlock(block_size);
+}
+
+Arena::~Arena() = default;
+
+void Arena::Reset() {
+    if (blocks.size() > 1) {
+        // The program overflowed the root block, squash allocations into a single one
+        const size_t total_size{std::accumulate(blocks.begin(), blocks.end(), size_t{0},
+                                                [](size_t sum, const Block& block) {
+                                                    return sum + block.size;
+                                                })};
+        blocks.clear();
+        PushBlock(total_size);
+    }
+    offset = 0;
+    last_peak_bytes = bytes_used;
+    if (bytes_used > max_peak_bytes) {
+        max_peak_bytes = bytes_used;
+        LOG_DEBUG(Shader, "Translation arena peak grew to {} KiB", max_peak_bytes / 1024);
+    }
+    bytes_used = 0;
+}
+
+void* Arena::do_allocate(size_t bytes, size_t alignment) {
+    while (true) {
+        std::byte* const data{blocks.back().data.get()};
+        const uintptr_t base{reinterpret_cast<uintptr_t>(data)};
+        const size_t aligned_offset{Common::AlignUp(base + offset, alignment) - base};
+        if (aligned_offset + bytes <= blocks.back().size) {
+            offset = aligned_offset + bytes;
+            bytes_used += bytes;
+            return data + aligned_offset;
+        }
+        // Reserve room to realign, blocks only have operator new alignment
+        PushBlock(std::max(block_size, bytes + alignment));
+    }
+}
+
+void Arena::PushBlock(size_t size) {
+    blocks.push_back({
+        .data = std::make_unique_for_overwrite<std::byte[]>(size),
+        .size = size,
+    });
+    offset = 0;
+}
+
+Arena& ThreadArena() {
+    thread_local Arena arena;
+    return arena;
+}
+
+ArenaScope::ArenaScope() : arena{ThreadArena()} {
+    ++arena.scope_depth;
+}
+
+ArenaScope::~ArenaScope() {
+    if (--arena.scope_depth == 0) {
+        arena.Reset();
+    }
+}
+
+} // namespace Shader
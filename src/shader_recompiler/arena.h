@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace Shader {
+
+/**
+ * Bump allocator for the temporaries of a single program translation.
+ *
+ * Deallocations are no-ops; memory is returned in bulk when the program finishes. Like the object
+ * pools, blocks allocated during a translation are squashed into a single one on reset, so a
+ * worker thread settles on one allocation sized for the largest program it has seen.
+ */
+class Arena final : public std::pmr::memory_resource {
+public:
+    explicit Arena(size_t block_size = 64 * 1024);
+    ~Arena() override;
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// Releases every allocation made from the arena
+    void Reset();
+
+    /// Bytes allocated since the last reset
+    [[nodiscard]] size_t BytesUsed() const noexcept {
+        return bytes_used;
+    }
+
+    /// Bytes allocated by the last program before it was reset
+    [[nodiscard]] size_t LastPeakBytes() const noexcept {
+        return last_peak_bytes;
+    }
+
+    /// Largest number of bytes allocated by a single program on this arena
+    [[nodiscard]] size_t MaxPeakBytes() const noexcept {
+        return max_peak_bytes;
+    }
+
+private:
+    friend class ArenaScope;
+
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    void PushBlock(size_t size);
+
+    std::vector<Block> blocks;
+    size_t block_size{};
+    size_t offset{};
+    size_t bytes_used{};
+    size_t last_peak_bytes{};
+    size_t max_peak_bytes{};
+    size_t scope_depth{};
+};
+
+/// Returns the arena of the calling thread
+[[nodiscard]] Arena& ThreadArena();
+
+/// Resets the calling thread's arena when the outermost scope on the thread is destroyed.
+/// Nested scopes are no-ops, so passes can open one without knowing if they run standalone.
+class ArenaScope {
+public:
+    explicit ArenaScope();
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    Arena& arena;
+};
+
+} // namespace Shader
@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <iterator>
 #include <string>
 #include <tuple>
+#include <utility>
 
 #include "common/div_ceil.h"
 #include "common/settings.h"
@@ -204,7 +206,19 @@ void Precolor(const IR::Program& program) {
     }
 }
 
+/// Rough size of the code emitted for an IR instruction, to reserve the code of a program up front
+constexpr size_t CODE_BYTES_PER_INST = 24;
+
+size_t NumInstructions(const IR::Program& program) {
+    size_t num_insts{};
+    for (const IR::Block* const block : program.blocks) {
+        num_insts += block->size();
+    }
+    return num_insts;
+}
+
 void EmitCode(EmitContext& ctx, const IR::Program& program) {
+    ctx.code.reserve(ctx.code.size() + NumInstructions(program) * CODE_BYTES_PER_INST);
     const auto eval{
         [&](const IR::U1& cond) { return ScalarS32{ctx.reg_alloc.Consume(IR::Value{cond})}; }};
     for (const IR::AbstractSyntaxNode& node : program.syntax_list) {
@@ -458,7 +472,7 @@ std::string EmitGLASM(const Profile& profile, const RuntimeInfo& runtime_info, I
     }
     header += "TEMP ";
     for (size_t index = 0; index < ctx.reg_alloc.NumUsedRegisters(); ++index) {
-        header += fmt::format("R{},", index);
+        fmt::format_to(std::back_inserter(header), "R{},", index);
     }
     if (program.local_memory_size > 0) {
         header += fmt::format("lmem[{}],", Common::DivCeil(program.local_memory_size, 4U));
@@ -468,12 +482,12 @@ std::string EmitGLASM(const Profile& profile, const RuntimeInfo& runtime_info, I
     }
     const u32 num_safety_loop_vectors{Common::DivCeil(ctx.num_safety_loop_vars, 4u)};
     for (u32 index = 0; index < num_safety_loop_vectors; ++index) {
-        header += fmt::format("loop{},", index);
+        fmt::format_to(std::back_inserter(header), "loop{},", index);
     }
     header += "RC;"
               "LONG TEMP ";
     for (size_t index = 0; index < ctx.reg_alloc.NumUsedLongRegisters(); ++index) {
-        header += fmt::format("D{},", index);
+        fmt::format_to(std::back_inserter(header), "D{},", index);
     }
     header += "DC;";
     if (program.info.uses_fswzadd) {
@@ -487,14 +501,15 @@ std::string EmitGLASM(const Profile& profile, const RuntimeInfo& runtime_info, I
                   "MOV.F FSWZB[3],-1;";
     }
     for (u32 index = 0; index < num_safety_loop_vectors; ++index) {
-        header += fmt::format("MOV.S loop{},{{0x2000,0x2000,0x2000,0x2000}};", index);
+        fmt::format_to(std::back_inserter(header), "MOV.S loop{},{{0x2000,0x2000,0x2000,0x2000}};",
+                       index);
     }
     if (ctx.uses_y_direction) {
         header += "PARAM y_direction[1]={state.material.front.ambient};";
     }
     ctx.code.insert(0, header);
     ctx.code += "END";
-    return ctx.code;
+    return std::move(ctx.code);
 }
 
 } // namespace Shader::Backend::GLASM
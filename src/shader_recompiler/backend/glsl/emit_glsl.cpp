@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <iterator>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include "common/div_ceil.h"
 #include "common/settings.h"
@@ -130,7 +132,19 @@ void Precolor(const IR::Program& program) {
     }
 }
 
+/// Rough size of the code emitted for an IR instruction, to reserve the code of a program up front
+constexpr size_t CODE_BYTES_PER_INST = 24;
+
+size_t NumInstructions(const IR::Program& program) {
+    size_t num_insts{};
+    for (const IR::Block* const block : program.blocks) {
+        num_insts += block->size();
+    }
+    return num_insts;
+}
+
 void EmitCode(EmitContext& ctx, const IR::Program& program) {
+    ctx.code.reserve(ctx.code.size() + NumInstructions(program) * CODE_BYTES_PER_INST);
     for (const IR::AbstractSyntaxNode& node : program.syntax_list) {
         switch (node.type) {
         case IR::AbstractSyntaxNode::Type::Block:
@@ -200,16 +214,16 @@ void DefineVariables(const EmitContext& ctx, std::string& header) {
         const auto precise{!has_precise_bug && IsPreciseType(type) ? "precise " : ""};
         // Temps/return types that are never used are stored at index 0
         if (tracker.uses_temp) {
-            header += fmt::format("{}{} t{}={}(0);", precise, type_name,
-                                  ctx.var_alloc.Representation(0, type), type_name);
+            fmt::format_to(std::back_inserter(header), "{}{} t{}={}(0);", precise, type_name,
+                           ctx.var_alloc.Representation(0, type), type_name);
         }
         for (u32 index = 0; index < tracker.num_used; ++index) {
-            header += fmt::format("{}{} {}={}(0);", precise, type_name,
-                                  ctx.var_alloc.Representation(index, type), type_name);
+            fmt::format_to(std::back_inserter(header), "{}{} {}={}(0);", precise, type_name,
+                           ctx.var_alloc.Representation(index, type), type_name);
         }
     }
     for (u32 i = 0; i < ctx.num_safety_loop_vars; ++i) {
-        header += fmt::format("int loop{}=0x2000;", i);
+        fmt::format_to(std::back_inserter(header), "int loop{}=0x2000;", i);
     }
 }
 } // Anonymous namespace
@@ -246,7 +260,7 @@ std::string EmitGLSL(const Profile& profile, const RuntimeInfo& runtime_info, IR
     }
     ctx.code.insert(0, ctx.header);
     ctx.code += '}';
-    return ctx.code;
+    return std::move(ctx.code);
 }
 
 } // namespace Shader::Backend::GLSL
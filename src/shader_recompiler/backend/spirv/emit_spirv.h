@@ -30,6 +30,28 @@ constexpr u32 RESCALING_LAYOUT_WORDS_OFFSET = offsetof(RescalingLayout, rescalin
 constexpr u32 RESCALING_LAYOUT_DOWN_FACTOR_OFFSET = offsetof(RescalingLayout, down_factor);
 constexpr u32 RENDERAREA_LAYOUT_OFFSET = offsetof(RenderAreaLayout, render_area);
 
+/// Fixed function state read through specialization constants.
+/// The constant id of each member is its word offset in the structure.
+struct SpecializationLayout {
+    f32 alpha_test_reference;
+    f32 point_size;
+    f32 y_direction;
+};
+constexpr u32 SPECIALIZATION_ALPHA_TEST_REFERENCE_ID =
+    offsetof(SpecializationLayout, alpha_test_reference) / sizeof(u32);
+constexpr u32 SPECIALIZATION_POINT_SIZE_ID =
+    offsetof(SpecializationLayout, point_size) / sizeof(u32);
+constexpr u32 SPECIALIZATION_Y_DIRECTION_ID =
+    offsetof(SpecializationLayout, y_direction) / sizeof(u32);
+
+/// Entry of the storage buffer table, indexed with the storage buffer binding of the stage.
+/// Only used when the profile accesses storage buffers through pointers.
+struct StorageBufferAddress {
+    u64 address;
+    u32 size;
+    u32 padding;
+};
+
 [[nodiscard]] std::vector<u32> EmitSPIRV(const Profile& profile, const RuntimeInfo& runtime_info,
                                          IR::Program& program, Bindings& bindings);
 
@@ -40,11 +40,31 @@ Id StoragePointer(EmitContext& ctx, const StorageTypeDefinition& type_def,
     if (!binding.IsImmediate()) {
         throw NotImplementedException("Dynamic storage buffer indexing");
     }
-    const Id ssbo{ctx.ssbos[binding.U32()].*member_ptr};
     const Id index{StorageIndex(ctx, offset, element_size)};
+    if (ctx.profile.storage_buffer_pointers) {
+        const auto [ssbo, clamped_index]{
+            ctx.StorageBufferPointer(binding.U32(), type_def, element_size, index)};
+        return ctx.OpAccessChain(type_def.element, ssbo, ctx.u32_zero_value, clamped_index);
+    }
+    const Id ssbo{ctx.ssbos[binding.U32()].*member_ptr};
     return ctx.OpAccessChain(type_def.element, ssbo, ctx.u32_zero_value, index);
 }
 
+/// Returns the storage buffer and word index passed to the compare and swap loop functions
+std::pair<Id, Id> StorageCasArgs(EmitContext& ctx, const IR::Value& binding,
+                                 const IR::Value& offset) {
+    const Id index{StorageIndex(ctx, offset, sizeof(u32))};
+    if (ctx.profile.storage_buffer_pointers) {
+        return ctx.StorageBufferPointer(binding.U32(), ctx.storage_types.U32, sizeof(u32), index);
+    }
+    return {ctx.ssbos[binding.U32()].U32, index};
+}
+
+/// Non-atomic 64-bit fallbacks need wide loads, pointers are only accessed in words
+bool CanEmulateStorageAtomicU64(const EmitContext& ctx) {
+    return ctx.profile.support_descriptor_aliasing && !ctx.profile.storage_buffer_pointers;
+}
+
 std::pair<Id, Id> AtomicArgs(EmitContext& ctx) {
     const Id scope{ctx.Const(static_cast<u32>(spv::Scope::Device))};
     const Id semantics{ctx.u32_zero_value};
@@ -69,17 +89,17 @@ Id StorageAtomicU32(EmitContext& ctx, const IR::Value& binding, const IR::Value&
 Id StorageAtomicU64(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset, Id value,
                     Id (Sirit::Module::*atomic_func)(Id, Id, Id, Id, Id),
                     Id (Sirit::Module::*non_atomic_func)(Id, Id, Id)) {
-    if (!ctx.profile.support_descriptor_aliasing) {
-        LOG_WARNING(Shader_SPIRV, "Descriptor aliasing not supported, this cannot be atomic.");
-        return ctx.ConstantNull(ctx.U64);
-    }
-
-    if (ctx.profile.support_int64_atomics) {
+    if (ctx.profile.support_int64_atomics &&
+        (ctx.profile.support_descriptor_aliasing || ctx.profile.storage_buffer_pointers)) {
         const Id pointer{StoragePointer(ctx, ctx.storage_types.U64, &StorageDefinitions::U64,
                                         binding, offset, sizeof(u64))};
         const auto [scope, semantics]{AtomicArgs(ctx)};
         return (ctx.*atomic_func)(ctx.U64, pointer, scope, semantics, value);
     }
+    if (!CanEmulateStorageAtomicU64(ctx)) {
+        LOG_WARNING(Shader_SPIRV, "Descriptor aliasing not supported, this cannot be atomic.");
+        return ctx.ConstantNull(ctx.U64);
+    }
     LOG_WARNING(Shader_SPIRV, "Int64 atomics not supported, fallback to non-atomic");
     const Id pointer{StoragePointer(ctx, ctx.storage_types.U32x2, &StorageDefinitions::U32x2,
                                     binding, offset, sizeof(u32[2]))};
@@ -91,7 +111,7 @@ Id StorageAtomicU64(EmitContext& ctx, const IR::Value& binding, const IR::Value&
 
 Id StorageAtomicU32x2(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset, Id value,
                       Id (Sirit::Module::*non_atomic_func)(Id, Id, Id)) {
-    if (!ctx.profile.support_descriptor_aliasing) {
+    if (!CanEmulateStorageAtomicU64(ctx)) {
         LOG_WARNING(Shader_SPIRV, "Descriptor aliasing not supported, this cannot be atomic.");
         return ctx.ConstantNull(ctx.U32[2]);
     }
@@ -213,15 +233,13 @@ Id EmitStorageAtomicUMax32(EmitContext& ctx, const IR::Value& binding, const IR:
 
 Id EmitStorageAtomicInc32(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                           Id value) {
-    const Id ssbo{ctx.ssbos[binding.U32()].U32};
-    const Id base_index{StorageIndex(ctx, offset, sizeof(u32))};
+    const auto [ssbo, base_index]{StorageCasArgs(ctx, binding, offset)};
     return ctx.OpFunctionCall(ctx.U32[1], ctx.increment_cas_ssbo, base_index, value, ssbo);
 }
 
 Id EmitStorageAtomicDec32(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                           Id value) {
-    const Id ssbo{ctx.ssbos[binding.U32()].U32};
-    const Id base_index{StorageIndex(ctx, offset, sizeof(u32))};
+    const auto [ssbo, base_index]{StorageCasArgs(ctx, binding, offset)};
     return ctx.OpFunctionCall(ctx.U32[1], ctx.decrement_cas_ssbo, base_index, value, ssbo);
 }
 
@@ -301,6 +319,10 @@ Id EmitStorageAtomicExchange64(EmitContext& ctx, const IR::Value& binding, const
         const auto [scope, semantics]{AtomicArgs(ctx)};
         return ctx.OpAtomicExchange(ctx.U64, pointer, scope, semantics, value);
     }
+    if (ctx.profile.storage_buffer_pointers) {
+        LOG_WARNING(Shader_SPIRV, "Int64 atomics not supported, this cannot be atomic.");
+        return ctx.ConstantNull(ctx.U64);
+    }
     LOG_WARNING(Shader_SPIRV, "Int64 atomics not supported, fallback to non-atomic");
     const Id pointer{StoragePointer(ctx, ctx.storage_types.U32x2, &StorageDefinitions::U32x2,
                                     binding, offset, sizeof(u32[2]))};
@@ -351,6 +373,10 @@ Id EmitStorageAtomicXor32x2(EmitContext& ctx, const IR::Value& binding, const IR
 
 Id EmitStorageAtomicExchange32x2(EmitContext& ctx, const IR::Value& binding,
                                  const IR::Value& offset, Id value) {
+    if (ctx.profile.storage_buffer_pointers) {
+        LOG_WARNING(Shader_SPIRV, "Int64 atomics not supported, this cannot be atomic.");
+        return ctx.ConstantNull(ctx.U32[2]);
+    }
     LOG_WARNING(Shader_SPIRV, "Int64 atomics not supported, fallback to non-atomic");
     const Id pointer{StoragePointer(ctx, ctx.storage_types.U32x2, &StorageDefinitions::U32x2,
                                     binding, offset, sizeof(u32[2]))};
@@ -361,55 +387,48 @@ Id EmitStorageAtomicExchange32x2(EmitContext& ctx, const IR::Value& binding,
 
 Id EmitStorageAtomicAddF32(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                            Id value) {
-    const Id ssbo{ctx.ssbos[binding.U32()].U32};
-    const Id base_index{StorageIndex(ctx, offset, sizeof(u32))};
+    const auto [ssbo, base_index]{StorageCasArgs(ctx, binding, offset)};
     return ctx.OpFunctionCall(ctx.F32[1], ctx.f32_add_cas, base_index, value, ssbo);
 }
 
 Id EmitStorageAtomicAddF16x2(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                              Id value) {
-    const Id ssbo{ctx.ssbos[binding.U32()].U32};
-    const Id base_index{StorageIndex(ctx, offset, sizeof(u32))};
+    const auto [ssbo, base_index]{StorageCasArgs(ctx, binding, offset)};
     const Id result{ctx.OpFunctionCall(ctx.F16[2], ctx.f16x2_add_cas, base_index, value, ssbo)};
     return ctx.OpBitcast(ctx.U32[1], result);
 }
 
 Id EmitStorageAtomicAddF32x2(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                              Id value) {
-    const Id ssbo{ctx.ssbos[binding.U32()].U32};
-    const Id base_index{StorageIndex(ctx, offset, sizeof(u32))};
+    const auto [ssbo, base_index]{StorageCasArgs(ctx, binding, offset)};
     const Id result{ctx.OpFunctionCall(ctx.F32[2], ctx.f32x2_add_cas, base_index, value, ssbo)};
     return ctx.OpPackHalf2x16(ctx.U32[1], result);
 }
 
 Id EmitStorageAtomicMinF16x2(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                              Id value) {
-    const Id ssbo{ctx.ssbos[binding.U32()].U32};
-    const Id base_index{StorageIndex(ctx, offset, sizeof(u32))};
+    const auto [ssbo, base_index]{StorageCasArgs(ctx, binding, offset)};
     const Id result{ctx.OpFunctionCall(ctx.F16[2], ctx.f16x2_min_cas, base_index, value, ssbo)};
     return ctx.OpBitcast(ctx.U32[1], result);
 }
 
 Id EmitStorageAtomicMinF32x2(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                              Id value) {
-    const Id ssbo{ctx.ssbos[binding.U32()].U32};
-    const Id base_index{StorageIndex(ctx, offset, sizeof(u32))};
+    const auto [ssbo, base_index]{StorageCasArgs(ctx, binding, offset)};
     const Id result{ctx.OpFunctionCall(ctx.F32[2], ctx.f32x2_min_cas, base_index, value, ssbo)};
     return ctx.OpPackHalf2x16(ctx.U32[1], result);
 }
 
 Id EmitStorageAtomicMaxF16x2(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                              Id value) {
-    const Id ssbo{ctx.ssbos[binding.U32()].U32};
-    const Id base_index{StorageIndex(ctx, offset, sizeof(u32))};
+    const auto [ssbo, base_index]{StorageCasArgs(ctx, binding, offset)};
     const Id result{ctx.OpFunctionCall(ctx.F16[2], ctx.f16x2_max_cas, base_index, value, ssbo)};
     return ctx.OpBitcast(ctx.U32[1], result);
 }
 
 Id EmitStorageAtomicMaxF32x2(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                              Id value) {
-    const Id ssbo{ctx.ssbos[binding.U32()].U32};
-    const Id base_index{StorageIndex(ctx, offset, sizeof(u32))};
+    const auto [ssbo, base_index]{StorageCasArgs(ctx, binding, offset)};
     const Id result{ctx.OpFunctionCall(ctx.F32[2], ctx.f32x2_max_cas, base_index, value, ssbo)};
     return ctx.OpPackHalf2x16(ctx.U32[1], result);
 }
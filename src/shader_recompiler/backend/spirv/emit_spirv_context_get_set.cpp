@@ -564,7 +564,7 @@ Id EmitIsHelperInvocation(EmitContext& ctx) {
 }
 
 Id EmitYDirection(EmitContext& ctx) {
-    return ctx.Const(ctx.runtime_info.y_negate ? -1.0f : 1.0f);
+    return ctx.y_direction;
 }
 
 Id EmitResolutionDownFactor(EmitContext& ctx) {
@@ -27,14 +27,28 @@ Id StorageIndex(EmitContext& ctx, const IR::Value& offset, size_t element_size,
     return index;
 }
 
+/// Storage buffers accessed through pointers are only read and written in words
+bool UseWideStorageTypes(const EmitContext& ctx) {
+    return ctx.profile.support_descriptor_aliasing && !ctx.profile.storage_buffer_pointers;
+}
+
+bool UseNarrowStorageWrites(const EmitContext& ctx, bool supported) {
+    return supported && !ctx.profile.storage_buffer_pointers;
+}
+
 Id StoragePointer(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                   const StorageTypeDefinition& type_def, size_t element_size,
                   Id StorageDefinitions::*member_ptr, u32 index_offset = 0) {
     if (!binding.IsImmediate()) {
         throw NotImplementedException("Dynamic storage buffer indexing");
     }
-    const Id ssbo{ctx.ssbos[binding.U32()].*member_ptr};
     const Id index{StorageIndex(ctx, offset, element_size, index_offset)};
+    if (ctx.profile.storage_buffer_pointers) {
+        const auto [ssbo, clamped_index]{
+            ctx.StorageBufferPointer(binding.U32(), type_def, element_size, index)};
+        return ctx.OpAccessChain(type_def.element, ssbo, ctx.u32_zero_value, clamped_index);
+    }
+    const Id ssbo{ctx.ssbos[binding.U32()].*member_ptr};
     return ctx.OpAccessChain(type_def.element, ssbo, ctx.u32_zero_value, index);
 }
 
@@ -43,7 +57,7 @@ Id LoadStorage(EmitContext& ctx, const IR::Value& binding, const IR::Value& offs
                Id StorageDefinitions::*member_ptr, u32 index_offset = 0) {
     const Id pointer{
         StoragePointer(ctx, binding, offset, type_def, element_size, member_ptr, index_offset)};
-    return ctx.OpLoad(result_type, pointer);
+    return ctx.StorageLoad(result_type, pointer);
 }
 
 Id LoadStorage32(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
@@ -57,7 +71,7 @@ void WriteStorage(EmitContext& ctx, const IR::Value& binding, const IR::Value& o
                   Id StorageDefinitions::*member_ptr, u32 index_offset = 0) {
     const Id pointer{
         StoragePointer(ctx, binding, offset, type_def, element_size, member_ptr, index_offset)};
-    ctx.OpStore(pointer, value);
+    ctx.StorageStore(pointer, value);
 }
 
 void WriteStorage32(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset, Id value,
@@ -156,7 +170,7 @@ void EmitWriteGlobal128(EmitContext& ctx, Id address, Id value) {
 }
 
 Id EmitLoadStorageU8(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset) {
-    if (ctx.profile.support_int8 && ctx.profile.support_descriptor_aliasing) {
+    if (ctx.profile.support_int8 && UseWideStorageTypes(ctx)) {
         return ctx.OpUConvert(ctx.U32[1],
                               LoadStorage(ctx, binding, offset, ctx.U8, ctx.storage_types.U8,
                                           sizeof(u8), &StorageDefinitions::U8));
@@ -167,7 +181,7 @@ Id EmitLoadStorageU8(EmitContext& ctx, const IR::Value& binding, const IR::Value
 }
 
 Id EmitLoadStorageS8(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset) {
-    if (ctx.profile.support_int8 && ctx.profile.support_descriptor_aliasing) {
+    if (ctx.profile.support_int8 && UseWideStorageTypes(ctx)) {
         return ctx.OpSConvert(ctx.U32[1],
                               LoadStorage(ctx, binding, offset, ctx.S8, ctx.storage_types.S8,
                                           sizeof(s8), &StorageDefinitions::S8));
@@ -178,7 +192,7 @@ Id EmitLoadStorageS8(EmitContext& ctx, const IR::Value& binding, const IR::Value
 }
 
 Id EmitLoadStorageU16(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset) {
-    if (ctx.profile.support_int16 && ctx.profile.support_descriptor_aliasing) {
+    if (ctx.profile.support_int16 && UseWideStorageTypes(ctx)) {
         return ctx.OpUConvert(ctx.U32[1],
                               LoadStorage(ctx, binding, offset, ctx.U16, ctx.storage_types.U16,
                                           sizeof(u16), &StorageDefinitions::U16));
@@ -189,7 +203,7 @@ Id EmitLoadStorageU16(EmitContext& ctx, const IR::Value& binding, const IR::Valu
 }
 
 Id EmitLoadStorageS16(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset) {
-    if (ctx.profile.support_int16 && ctx.profile.support_descriptor_aliasing) {
+    if (ctx.profile.support_int16 && UseWideStorageTypes(ctx)) {
         return ctx.OpSConvert(ctx.U32[1],
                               LoadStorage(ctx, binding, offset, ctx.S16, ctx.storage_types.S16,
                                           sizeof(s16), &StorageDefinitions::S16));
@@ -204,7 +218,7 @@ Id EmitLoadStorage32(EmitContext& ctx, const IR::Value& binding, const IR::Value
 }
 
 Id EmitLoadStorage64(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset) {
-    if (ctx.profile.support_descriptor_aliasing) {
+    if (UseWideStorageTypes(ctx)) {
         return LoadStorage(ctx, binding, offset, ctx.U32[2], ctx.storage_types.U32x2,
                            sizeof(u32[2]), &StorageDefinitions::U32x2);
     } else {
@@ -214,7 +228,7 @@ Id EmitLoadStorage64(EmitContext& ctx, const IR::Value& binding, const IR::Value
 }
 
 Id EmitLoadStorage128(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset) {
-    if (ctx.profile.support_descriptor_aliasing) {
+    if (UseWideStorageTypes(ctx)) {
         return LoadStorage(ctx, binding, offset, ctx.U32[4], ctx.storage_types.U32x4,
                            sizeof(u32[4]), &StorageDefinitions::U32x4);
     } else {
@@ -227,7 +241,7 @@ Id EmitLoadStorage128(EmitContext& ctx, const IR::Value& binding, const IR::Valu
 
 void EmitWriteStorageU8(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                         Id value) {
-    if (ctx.profile.support_int8) {
+    if (UseNarrowStorageWrites(ctx, ctx.profile.support_int8)) {
         WriteStorage(ctx, binding, offset, ctx.OpSConvert(ctx.U8, value), ctx.storage_types.U8,
                      sizeof(u8), &StorageDefinitions::U8);
     } else {
@@ -237,7 +251,7 @@ void EmitWriteStorageU8(EmitContext& ctx, const IR::Value& binding, const IR::Va
 
 void EmitWriteStorageS8(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                         Id value) {
-    if (ctx.profile.support_int8) {
+    if (UseNarrowStorageWrites(ctx, ctx.profile.support_int8)) {
         WriteStorage(ctx, binding, offset, ctx.OpSConvert(ctx.S8, value), ctx.storage_types.S8,
                      sizeof(s8), &StorageDefinitions::S8);
     } else {
@@ -247,7 +261,7 @@ void EmitWriteStorageS8(EmitContext& ctx, const IR::Value& binding, const IR::Va
 
 void EmitWriteStorageU16(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                          Id value) {
-    if (ctx.profile.support_int16) {
+    if (UseNarrowStorageWrites(ctx, ctx.profile.support_int16)) {
         WriteStorage(ctx, binding, offset, ctx.OpSConvert(ctx.U16, value), ctx.storage_types.U16,
                      sizeof(u16), &StorageDefinitions::U16);
     } else {
@@ -257,7 +271,7 @@ void EmitWriteStorageU16(EmitContext& ctx, const IR::Value& binding, const IR::V
 
 void EmitWriteStorageS16(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                          Id value) {
-    if (ctx.profile.support_int16) {
+    if (UseNarrowStorageWrites(ctx, ctx.profile.support_int16)) {
         WriteStorage(ctx, binding, offset, ctx.OpSConvert(ctx.S16, value), ctx.storage_types.S16,
                      sizeof(s16), &StorageDefinitions::S16);
     } else {
@@ -272,7 +286,7 @@ void EmitWriteStorage32(EmitContext& ctx, const IR::Value& binding, const IR::Va
 
 void EmitWriteStorage64(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                         Id value) {
-    if (ctx.profile.support_descriptor_aliasing) {
+    if (UseWideStorageTypes(ctx)) {
         WriteStorage(ctx, binding, offset, value, ctx.storage_types.U32x2, sizeof(u32[2]),
                      &StorageDefinitions::U32x2);
     } else {
@@ -285,7 +299,7 @@ void EmitWriteStorage64(EmitContext& ctx, const IR::Value& binding, const IR::Va
 
 void EmitWriteStorage128(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                          Id value) {
-    if (ctx.profile.support_descriptor_aliasing) {
+    if (UseWideStorageTypes(ctx)) {
         WriteStorage(ctx, binding, offset, value, ctx.storage_types.U32x4, sizeof(u32[4]),
                      &StorageDefinitions::U32x4);
     } else {
@@ -19,8 +19,7 @@ void ConvertDepthMode(EmitContext& ctx) {
 
 void SetFixedPipelinePointSize(EmitContext& ctx) {
     if (ctx.runtime_info.fixed_state_point_size) {
-        const float point_size{*ctx.runtime_info.fixed_state_point_size};
-        ctx.OpStore(ctx.output_point_size, ctx.Const(point_size));
+        ctx.OpStore(ctx.output_point_size, ctx.fixed_point_size);
     }
 }
 
@@ -79,8 +78,7 @@ void AlphaTest(EmitContext& ctx) {
 
     const Id true_label{ctx.OpLabel()};
     const Id discard_label{ctx.OpLabel()};
-    const Id alpha_reference{ctx.Const(ctx.runtime_info.alpha_test_reference)};
-    const Id condition{ComparisonFunction(ctx, comparison, alpha, alpha_reference)};
+    const Id condition{ComparisonFunction(ctx, comparison, alpha, ctx.alpha_test_reference)};
 
     ctx.OpSelectionMerge(true_label, spv::SelectionControlMask::MaskNone);
     ctx.OpBranchConditional(condition, true_label, discard_label);
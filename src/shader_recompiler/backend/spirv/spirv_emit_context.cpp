@@ -5,6 +5,7 @@
 #include <array>
 #include <bit>
 #include <climits>
+#include <span>
 
 #include <boost/container/static_vector.hpp>
 
@@ -323,6 +324,19 @@ void DefineSsbos(EmitContext& ctx, StorageTypeDefinition& type_def,
     }
 }
 
+void DefineStoragePointerTypes(EmitContext& ctx, StorageTypeDefinition& type_def, Id type,
+                               u32 stride) {
+    const Id array_type{ctx.TypeRuntimeArray(type)};
+    ctx.Decorate(array_type, spv::Decoration::ArrayStride, stride);
+
+    const Id struct_type{ctx.TypeStruct(array_type)};
+    ctx.Decorate(struct_type, spv::Decoration::Block);
+    ctx.MemberDecorate(struct_type, 0, spv::Decoration::Offset, 0U);
+
+    type_def.array = ctx.TypePointer(spv::StorageClass::PhysicalStorageBuffer, struct_type);
+    type_def.element = ctx.TypePointer(spv::StorageClass::PhysicalStorageBuffer, type);
+}
+
 Id CasFunction(EmitContext& ctx, Operation operation, Id value_type) {
     const Id func_type{ctx.TypeFunction(value_type, value_type, value_type)};
     const Id func{ctx.OpFunction(value_type, spv::FunctionControlMask::MaskNone, func_type)};
@@ -392,7 +406,8 @@ Id CasLoop(EmitContext& ctx, Operation operation, Id array_pointer, Id element_p
     const Id word_pointer{is_struct ? ctx.OpAccessChain(element_pointer, base, zero, index)
                                     : ctx.OpAccessChain(element_pointer, base, index)};
     if (value_type.value == ctx.F32[2].value) {
-        const Id u32_value{ctx.OpLoad(ctx.U32[1], word_pointer)};
+        const Id u32_value{is_shared ? ctx.OpLoad(ctx.U32[1], word_pointer)
+                                     : ctx.StorageLoad(ctx.U32[1], word_pointer)};
         const Id value{ctx.OpUnpackHalf2x16(ctx.F32[2], u32_value)};
         const Id new_value{ctx.OpFunctionCall(value_type, cas_func, value, op_b)};
         const Id u32_new_value{ctx.OpPackHalf2x16(ctx.U32[1], new_value)};
@@ -404,7 +419,8 @@ Id CasLoop(EmitContext& ctx, Operation operation, Id array_pointer, Id element_p
         ctx.AddLabel(merge_block);
         ctx.OpReturnValue(ctx.OpUnpackHalf2x16(ctx.F32[2], atomic_res));
     } else {
-        const Id value{ctx.OpLoad(memory_type, word_pointer)};
+        const Id value{is_shared ? ctx.OpLoad(memory_type, word_pointer)
+                                 : ctx.StorageLoad(memory_type, word_pointer)};
         const bool matching_type{value_type.value == memory_type.value};
         const Id bitcast_value{matching_type ? value : ctx.OpBitcast(value_type, value)};
         const Id cal_res{ctx.OpFunctionCall(value_type, cas_func, bitcast_value, op_b)};
@@ -484,6 +500,7 @@ EmitContext::EmitContext(const Profile& profile_, const RuntimeInfo& runtime_inf
     DefineGlobalMemoryFunctions(program.info);
     DefineRescalingInput(program.info);
     DefineRenderArea(program.info);
+    DefineSpecializationConstants();
 }
 
 EmitContext::~EmitContext() = default;
@@ -526,6 +543,46 @@ Id EmitContext::BitOffset16(const IR::Value& offset) {
     return OpBitwiseAnd(U32[1], OpShiftLeftLogical(U32[1], Def(offset), Const(3u)), Const(16u));
 }
 
+std::pair<Id, Id> EmitContext::StorageBufferPointer(u32 binding,
+                                                    const StorageTypeDefinition& type_def,
+                                                    size_t element_size, Id index) {
+    const Id entry_pointer{OpAccessChain(storage_buffer_table_entry, storage_buffer_table,
+                                         u32_zero_value, Const(binding))};
+    const Id entry{OpLoad(U32[4], entry_pointer)};
+    const Id address{OpCompositeConstruct(U32[2], OpCompositeExtract(U32[1], entry, 0U),
+                                          OpCompositeExtract(U32[1], entry, 1U))};
+    const Id pointer{OpConvertUToPtr(type_def.array, OpBitcast(U64, address))};
+
+    // Out of bounds accesses are clamped to the last element, unbound buffers have a size of
+    // zero and point to a dummy buffer
+    const u32 shift{static_cast<u32>(std::countr_zero(element_size))};
+    const Id size{OpCompositeExtract(U32[1], entry, 2U)};
+    const Id num_elements{OpShiftRightLogical(U32[1], size, Const(shift))};
+    const Id last_element{OpISub(U32[1], OpUMax(U32[1], num_elements, Const(1u)), Const(1u))};
+    return {pointer, OpUMin(U32[1], index, last_element)};
+}
+
+Id EmitContext::StorageLoad(Id type, Id pointer) {
+    if (!profile.storage_buffer_pointers) {
+        return OpLoad(type, pointer);
+    }
+    // Loads through physical pointers need an alignment operand, relaxed atomics do not
+    const Id scope{Const(static_cast<u32>(spv::Scope::Device))};
+    if (type.value == U32[1].value || type.value == U64.value) {
+        return OpAtomicLoad(type, pointer, scope, u32_zero_value);
+    }
+    return OpBitcast(type, OpAtomicLoad(U32[1], pointer, scope, u32_zero_value));
+}
+
+void EmitContext::StorageStore(Id pointer, Id value) {
+    if (!profile.storage_buffer_pointers) {
+        OpStore(pointer, value);
+        return;
+    }
+    const Id scope{Const(static_cast<u32>(spv::Scope::Device))};
+    OpAtomicStore(pointer, scope, u32_zero_value, value);
+}
+
 void EmitContext::DefineCommonTypes(const Info& info) {
     void_id = TypeVoid();
 
@@ -879,16 +936,22 @@ void EmitContext::DefineAttributeMemAccess(const Info& info) {
 }
 
 void EmitContext::DefineWriteStorageCasLoopFunction(const Info& info) {
-    if (profile.support_int8 && profile.support_int16) {
+    // Narrow stores through pointers can't be made atomically, they always take the loop
+    if (profile.support_int8 && profile.support_int16 && !profile.storage_buffer_pointers) {
         return;
     }
     if (!info.uses_int8 && !info.uses_int16) {
         return;
     }
+    if (profile.storage_buffer_pointers && info.storage_buffers_descriptors.empty()) {
+        return;
+    }
 
     AddCapability(spv::Capability::VariablePointersStorageBuffer);
 
-    const Id ptr_type{TypePointer(spv::StorageClass::StorageBuffer, U32[1])};
+    const Id ptr_type{profile.storage_buffer_pointers
+                          ? storage_types.U32.element
+                          : TypePointer(spv::StorageClass::StorageBuffer, U32[1])};
     const Id func_type{TypeFunction(void_id, ptr_type, U32[1], U32[1], U32[1])};
     const Id func{OpFunction(void_id, spv::FunctionControlMask::MaskNone, func_type)};
     const Id pointer{OpFunctionParameter(ptr_type)};
@@ -910,7 +973,7 @@ void EmitContext::DefineWriteStorageCasLoopFunction(const Info& info) {
     OpBranch(body_label);
 
     AddLabel(body_label);
-    const Id expected_value{OpLoad(U32[1], pointer)};
+    const Id expected_value{StorageLoad(U32[1], pointer)};
     const Id desired_value{OpBitFieldInsert(U32[1], expected_value, value, bit_offset, bit_count)};
     const Id actual_value{OpAtomicCompareExchange(U32[1], pointer, scope_device, ordering_relaxed,
                                                   ordering_relaxed, desired_value, expected_value)};
@@ -934,8 +997,8 @@ void EmitContext::DefineGlobalMemoryFunctions(const Info& info) {
     }
     using DefPtr = Id StorageDefinitions::*;
     const Id zero{u32_zero_value};
-    const auto define_body{[&](DefPtr ssbo_member, Id addr, Id element_pointer, u32 shift,
-                               auto&& callback) {
+    const bool use_pointers{profile.storage_buffer_pointers};
+    const auto define_body{[&](DefPtr ssbo_member, Id addr, u32 shift, auto&& callback) {
         AddLabel();
         const size_t num_buffers{info.storage_buffers_descriptors.size()};
         for (size_t index = 0; index < num_buffers; ++index) {
@@ -962,20 +1025,49 @@ void EmitContext::DefineGlobalMemoryFunctions(const Info& info) {
             OpSelectionMerge(else_label, spv::SelectionControlMask::MaskNone);
             OpBranchConditional(cond, then_label, else_label);
             AddLabel(then_label);
-            const Id ssbo_id{ssbos[index].*ssbo_member};
             const Id ssbo_offset{OpUConvert(U32[1], OpISub(U64, addr, ssbo_addr))};
             const Id ssbo_index{OpShiftRightLogical(U32[1], ssbo_offset, Const(shift))};
-            const Id ssbo_pointer{OpAccessChain(element_pointer, ssbo_id, zero, ssbo_index)};
-            callback(ssbo_pointer);
+            if (use_pointers) {
+                const auto [ssbo_id, clamped_index]{StorageBufferPointer(
+                    static_cast<u32>(index), storage_types.U32, size_t{1} << shift, ssbo_index)};
+                callback(ssbo_id, clamped_index);
+            } else {
+                callback(ssbos[index].*ssbo_member, ssbo_index);
+            }
             AddLabel(else_label);
         }
     }};
+    // Pointers are accessed word by word, the index of the first word is the element index
+    // scaled to words
+    const auto word_pointer{[&](Id ssbo, Id index, u32 shift, u32 word) {
+        Id word_index{index};
+        if (shift > 2) {
+            word_index = OpShiftLeftLogical(U32[1], word_index, Const(shift - 2));
+        }
+        if (word != 0) {
+            word_index = OpIAdd(U32[1], word_index, Const(word));
+        }
+        return OpAccessChain(storage_types.U32.element, ssbo, zero, word_index);
+    }};
     const auto define_load{[&](DefPtr ssbo_member, Id element_pointer, Id type, u32 shift) {
         const Id function_type{TypeFunction(type, U64)};
         const Id func_id{OpFunction(type, spv::FunctionControlMask::MaskNone, function_type)};
         const Id addr{OpFunctionParameter(U64)};
-        define_body(ssbo_member, addr, element_pointer, shift,
-                    [&](Id ssbo_pointer) { OpReturnValue(OpLoad(type, ssbo_pointer)); });
+        define_body(ssbo_member, addr, shift, [&](Id ssbo, Id index) {
+            if (!use_pointers) {
+                const Id ssbo_pointer{OpAccessChain(element_pointer, ssbo, zero, index)};
+                OpReturnValue(OpLoad(type, ssbo_pointer));
+                return;
+            }
+            const u32 num_words{1U << (shift - 2)};
+            std::array<Id, 4> words{};
+            for (u32 word = 0; word < num_words; ++word) {
+                words[word] = StorageLoad(U32[1], word_pointer(ssbo, index, shift, word));
+            }
+            OpReturnValue(num_words == 1 ? words[0]
+                                         : OpCompositeConstruct(type, std::span(words.data(),
+                                                                                num_words)));
+        });
         OpReturnValue(ConstantNull(type));
         OpFunctionEnd();
         return func_id;
@@ -985,8 +1077,17 @@ void EmitContext::DefineGlobalMemoryFunctions(const Info& info) {
         const Id func_id{OpFunction(void_id, spv::FunctionControlMask::MaskNone, function_type)};
         const Id addr{OpFunctionParameter(U64)};
         const Id data{OpFunctionParameter(type)};
-        define_body(ssbo_member, addr, element_pointer, shift, [&](Id ssbo_pointer) {
-            OpStore(ssbo_pointer, data);
+        define_body(ssbo_member, addr, shift, [&](Id ssbo, Id index) {
+            if (!use_pointers) {
+                OpStore(OpAccessChain(element_pointer, ssbo, zero, index), data);
+                OpReturn();
+                return;
+            }
+            const u32 num_words{1U << (shift - 2)};
+            for (u32 word = 0; word < num_words; ++word) {
+                const Id value{num_words == 1 ? data : OpCompositeExtract(U32[1], data, word)};
+                StorageStore(word_pointer(ssbo, index, shift, word), value);
+            }
             OpReturn();
         });
         OpReturn();
@@ -1106,6 +1207,26 @@ void EmitContext::DefineRenderArea(const Info& info) {
     }
 }
 
+void EmitContext::DefineSpecializationConstants() {
+    // Runtime values are the defaults, so modules are valid without specialization info
+    const auto define{[this](u32 spec_id, f32 value, std::string_view name) {
+        const Id id{SpecConstant(F32[1], value)};
+        Decorate(id, spv::Decoration::SpecId, spec_id);
+        Name(id, name);
+        return id;
+    }};
+    if (stage == Stage::Fragment && runtime_info.alpha_test_func) {
+        alpha_test_reference = define(SPECIALIZATION_ALPHA_TEST_REFERENCE_ID,
+                                      runtime_info.alpha_test_reference, "alpha_test_reference");
+    }
+    if (runtime_info.fixed_state_point_size) {
+        fixed_point_size = define(SPECIALIZATION_POINT_SIZE_ID,
+                                  *runtime_info.fixed_state_point_size, "fixed_point_size");
+    }
+    y_direction =
+        define(SPECIALIZATION_Y_DIRECTION_ID, runtime_info.y_negate ? -1.0f : 1.0f, "y_direction");
+}
+
 void EmitContext::DefineConstantBuffers(const Info& info, u32& binding) {
     if (info.constant_buffer_descriptors.empty()) {
         return;
@@ -1209,10 +1330,7 @@ void EmitContext::DefineConstantBufferIndirectFunctions(const Info& info) {
     }
 }
 
-void EmitContext::DefineStorageBuffers(const Info& info, u32& binding) {
-    if (info.storage_buffers_descriptors.empty()) {
-        return;
-    }
+void EmitContext::DefineStorageBufferDescriptors(const Info& info, u32& binding) {
     AddExtension("SPV_KHR_storage_buffer_storage_class");
 
     const IR::Type used_types{profile.support_descriptor_aliasing ? info.used_storage_buffer_types
@@ -1252,6 +1370,55 @@ void EmitContext::DefineStorageBuffers(const Info& info, u32& binding) {
     for (const StorageBufferDescriptor& desc : info.storage_buffers_descriptors) {
         binding += desc.count;
     }
+}
+
+void EmitContext::DefineStorageBufferTable(const Info& info, u32& binding) {
+    AddCapability(spv::Capability::PhysicalStorageBufferAddresses);
+    AddExtension("SPV_KHR_physical_storage_buffer");
+    SetMemoryModel(spv::AddressingModel::PhysicalStorageBuffer64, spv::MemoryModel::GLSL450);
+    if (U64.value == 0) {
+        AddCapability(spv::Capability::Int64);
+        U64 = Name(TypeInt(64, false), "u64");
+    }
+    // Loads and stores are made on words, only 64-bit atomics need a wider type
+    DefineStoragePointerTypes(*this, storage_types.U32, U32[1], sizeof(u32));
+    if (profile.support_int64_atomics && True(info.used_storage_buffer_types & IR::Type::U64)) {
+        DefineStoragePointerTypes(*this, storage_types.U64, U64, sizeof(u64));
+    }
+
+    u32 num_buffers{};
+    for (const StorageBufferDescriptor& desc : info.storage_buffers_descriptors) {
+        num_buffers += desc.count;
+    }
+    const Id array_type{TypeArray(U32[4], Const(num_buffers))};
+    Decorate(array_type, spv::Decoration::ArrayStride, sizeof(StorageBufferAddress));
+
+    const Id struct_type{TypeStruct(array_type)};
+    Name(struct_type, "ssbo_table_block");
+    Decorate(struct_type, spv::Decoration::Block);
+    MemberDecorate(struct_type, 0, spv::Decoration::Offset, 0U);
+
+    const Id struct_pointer{TypePointer(spv::StorageClass::Uniform, struct_type)};
+    storage_buffer_table_entry = TypePointer(spv::StorageClass::Uniform, U32[4]);
+    storage_buffer_table = AddGlobalVariable(struct_pointer, spv::StorageClass::Uniform);
+    Decorate(storage_buffer_table, spv::Decoration::Binding, binding);
+    Decorate(storage_buffer_table, spv::Decoration::DescriptorSet, 0U);
+    Name(storage_buffer_table, "ssbo_table");
+    if (profile.supported_spirv >= 0x00010400) {
+        interfaces.push_back(storage_buffer_table);
+    }
+    ++binding;
+}
+
+void EmitContext::DefineStorageBuffers(const Info& info, u32& binding) {
+    if (info.storage_buffers_descriptors.empty()) {
+        return;
+    }
+    if (profile.storage_buffer_pointers) {
+        DefineStorageBufferTable(info, binding);
+    } else {
+        DefineStorageBufferDescriptors(info, binding);
+    }
     const bool needs_function{
         info.uses_global_increment || info.uses_global_decrement || info.uses_atomic_f32_add ||
         info.uses_atomic_f16x2_add || info.uses_atomic_f16x2_min || info.uses_atomic_f16x2_max ||
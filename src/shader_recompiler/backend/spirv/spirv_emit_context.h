@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <utility>
 
 #include <sirit/sirit.h>
 
@@ -202,6 +203,18 @@ public:
         return Constant(F32[1], value);
     }
 
+    /// Reads the address of a storage buffer from the storage buffer table.
+    /// @returns The pointer to the buffer and the element index clamped to its size
+    [[nodiscard]] std::pair<Id, Id> StorageBufferPointer(u32 binding,
+                                                         const StorageTypeDefinition& type_def,
+                                                         size_t element_size, Id index);
+
+    /// Loads a storage buffer element, pointers to device addresses are read atomically
+    [[nodiscard]] Id StorageLoad(Id type, Id pointer);
+
+    /// Stores a storage buffer element, pointers to device addresses are written atomically
+    void StorageStore(Id pointer, Id value);
+
     const Profile& profile;
     const RuntimeInfo& runtime_info;
     Stage stage{};
@@ -248,6 +261,8 @@ public:
 
     std::array<UniformDefinitions, Info::MAX_CBUFS> cbufs{};
     std::array<StorageDefinitions, Info::MAX_SSBOS> ssbos{};
+    Id storage_buffer_table{};
+    Id storage_buffer_table_entry{};
     std::vector<TextureBufferDefinition> texture_buffers;
     std::vector<ImageBufferDefinition> image_buffers;
     std::vector<TextureDefinition> textures;
@@ -300,6 +315,10 @@ public:
     Id render_area_push_constant{};
     u32 render_are_member_index{};
 
+    Id alpha_test_reference{};
+    Id fixed_point_size{};
+    Id y_direction{};
+
     Id local_memory{};
 
     Id shared_memory_u8{};
@@ -369,6 +388,8 @@ private:
     void DefineConstantBuffers(const Info& info, u32& binding);
     void DefineConstantBufferIndirectFunctions(const Info& info);
     void DefineStorageBuffers(const Info& info, u32& binding);
+    void DefineStorageBufferDescriptors(const Info& info, u32& binding);
+    void DefineStorageBufferTable(const Info& info, u32& binding);
     void DefineTextureBuffers(const Info& info, u32& binding);
     void DefineImageBuffers(const Info& info, u32& binding);
     void DefineTextures(const Info& info, u32& binding, u32& scaling_index);
@@ -380,6 +401,7 @@ private:
     void DefineRescalingInputPushConstant();
     void DefineRescalingInputUniformConstant();
     void DefineRenderArea(const Info& info);
+    void DefineSpecializationConstants();
 
     void DefineInputs(const IR::Program& program);
     void DefineOutputs(const IR::Program& program);
@@ -3,6 +3,8 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -28,4 +30,125 @@ std::string DumpProgram(const Program& program) {
     return ret;
 }
 
+Program CloneProgram(ObjectPool<Inst>& inst_pool, ObjectPool<Block>& block_pool,
+                     const Program& program) {
+    // Blocks dropped from the block list might still be referenced by the syntax list or by
+    // the branches of reachable blocks, so walk everything connected to the syntax list
+    std::vector<const Block*> old_blocks;
+    std::unordered_map<const Block*, Block*> block_map;
+    const auto visit_block{[&](const Block* block) {
+        if (block && block_map.try_emplace(block, nullptr).second) {
+            old_blocks.push_back(block);
+        }
+    }};
+    for (const AbstractSyntaxNode& node : program.syntax_list) {
+        if (node.type == AbstractSyntaxNode::Type::Block) {
+            visit_block(node.data.block);
+        }
+    }
+    for (size_t index = 0; index < old_blocks.size(); ++index) {
+        for (const Block* const succ : old_blocks[index]->ImmSuccessors()) {
+            visit_block(succ);
+        }
+        for (const Block* const pred : old_blocks[index]->ImmPredecessors()) {
+            visit_block(pred);
+        }
+    }
+    std::unordered_map<const Inst*, Inst*> inst_map;
+    for (const Block* const old_block : old_blocks) {
+        Block* const block{block_pool.Create(inst_pool)};
+        block->SetOrder(old_block->GetOrder());
+        if (old_block->IsSsaSealed()) {
+            block->SsaSeal();
+        }
+        for (const Inst& old_inst : old_block->Instructions()) {
+            const auto it{block->PrependNewInst(block->end(), old_inst.GetOpcode(), {},
+                                                old_inst.Flags<u32>())};
+            inst_map.emplace(&old_inst, &*it);
+        }
+        block_map[old_block] = block;
+    }
+    const auto remap_value{[&](const Value& value) {
+        const Value resolved{value.Resolve()};
+        return resolved.IsImmediate() ? resolved : Value{inst_map.at(resolved.Inst())};
+    }};
+    const auto remap_cond{[&](const U1& cond) { return U1{remap_value(cond)}; }};
+    const auto remap_block{[&](const Block* block) { return block_map.at(block); }};
+    for (const Block* const old_block : old_blocks) {
+        Block* const block{block_map[old_block]};
+        for (const Block* const succ : old_block->ImmSuccessors()) {
+            block->AddBranch(block_map[succ]);
+        }
+        for (const Inst& old_inst : old_block->Instructions()) {
+            Inst* const inst{inst_map[&old_inst]};
+            const size_t num_args{old_inst.NumArgs()};
+            for (size_t index = 0; index < num_args; ++index) {
+                if (old_inst.GetOpcode() == Opcode::Phi) {
+                    inst->AddPhiOperand(remap_block(old_inst.PhiBlock(index)),
+                                        remap_value(old_inst.Arg(index)));
+                } else {
+                    inst->SetArg(index, remap_value(old_inst.Arg(index)));
+                }
+            }
+        }
+    }
+    Program result{
+        .syntax_list = program.syntax_list,
+        .blocks{},
+        .post_order_blocks{},
+        .info = program.info,
+        .stage = program.stage,
+        .workgroup_size = program.workgroup_size,
+        .output_topology = program.output_topology,
+        .output_vertices = program.output_vertices,
+        .invocations = program.invocations,
+        .local_memory_size = program.local_memory_size,
+        .shared_memory_size = program.shared_memory_size,
+        .is_geometry_passthrough = program.is_geometry_passthrough,
+    };
+    for (AbstractSyntaxNode& node : result.syntax_list) {
+        auto& data{node.data};
+        switch (node.type) {
+        case AbstractSyntaxNode::Type::Block:
+            data.block = remap_block(data.block);
+            break;
+        case AbstractSyntaxNode::Type::If:
+            data.if_node.cond = remap_cond(data.if_node.cond);
+            data.if_node.body = remap_block(data.if_node.body);
+            data.if_node.merge = remap_block(data.if_node.merge);
+            break;
+        case AbstractSyntaxNode::Type::EndIf:
+            data.end_if.merge = remap_block(data.end_if.merge);
+            break;
+        case AbstractSyntaxNode::Type::Loop:
+            data.loop.body = remap_block(data.loop.body);
+            data.loop.continue_block = remap_block(data.loop.continue_block);
+            data.loop.merge = remap_block(data.loop.merge);
+            break;
+        case AbstractSyntaxNode::Type::Repeat:
+            data.repeat.cond = remap_cond(data.repeat.cond);
+            data.repeat.loop_header = remap_block(data.repeat.loop_header);
+            data.repeat.merge = remap_block(data.repeat.merge);
+            break;
+        case AbstractSyntaxNode::Type::Break:
+            data.break_node.cond = remap_cond(data.break_node.cond);
+            data.break_node.merge = remap_block(data.break_node.merge);
+            data.break_node.skip = remap_block(data.break_node.skip);
+            break;
+        case AbstractSyntaxNode::Type::Return:
+        case AbstractSyntaxNode::Type::Unreachable:
+            break;
+        }
+    }
+    result.blocks.reserve(program.blocks.size());
+    for (const Block* const block : program.blocks) {
+        result.blocks.push_back(remap_block(block));
+    }
+    result.post_order_blocks.reserve(program.post_order_blocks.size());
+    for (const Block* const block : program.post_order_blocks) {
+        result.post_order_blocks.push_back(remap_block(block));
+    }
+    return result;
+}
+
 } // namespace Shader::IR
@@ -8,6 +8,7 @@
 
 #include "shader_recompiler/frontend/ir/abstract_syntax_list.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/object_pool.h"
 #include "shader_recompiler/program_header.h"
 #include "shader_recompiler/shader_info.h"
 #include "shader_recompiler/stage.h"
@@ -31,4 +32,8 @@ struct Program {
 
 [[nodiscard]] std::string DumpProgram(const Program& program);
 
+/// Deep copies a program into new pools, so it can be modified while the source stays untouched
+[[nodiscard]] Program CloneProgram(ObjectPool<Inst>& inst_pool, ObjectPool<Block>& block_pool,
+                                   const Program& program);
+
 } // namespace Shader::IR
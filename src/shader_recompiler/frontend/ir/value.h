@@ -144,6 +144,10 @@ public:
     /// Determines whether or not this instruction may have side effects.
     [[nodiscard]] bool MayHaveSideEffects() const noexcept;
 
+    /// Determines whether the result of this instruction only depends on its arguments and flags.
+    /// Pure instructions can be merged or moved freely as long as their arguments dominate them.
+    [[nodiscard]] bool IsPure() const noexcept;
+
     /// Determines whether or not this instruction is a pseudo-instruction.
     /// Pseudo-instructions depend on their parent instructions for their semantics.
     [[nodiscard]] bool IsPseudoInstruction() const noexcept;
@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Dominator based global value numbering, as described in
+//
+//      Value Numbering.
+//      Briggs P., Cooper K. D., Simpson L. T. (1997)
+//      Software: Practice and Experience, vol 27
+//
+// Dominators are computed with the iterative algorithm from
+//
+//      A Simple, Fast Dominance Algorithm.
+//      Cooper K. D., Harvey T. J., Kennedy K. (2001)
+//
+
+#include <array>
+#include <bit>
+#include <functional>
+#include <memory_resource>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "shader_recompiler/arena.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+
+namespace Shader::Optimization {
+namespace {
+constexpr size_t MAX_ARGS = 5;
+constexpr size_t UNDEFINED = ~size_t{0};
+
+struct Expression {
+    bool operator==(const Expression&) const = default;
+
+    IR::Opcode opcode{};
+    u32 flags{};
+    std::array<IR::Value, MAX_ARGS> args{};
+};
+
+size_t HashValue(const IR::Value& value) {
+    if (!value.IsImmediate()) {
+        return std::hash<IR::Inst*>{}(value.Inst());
+    }
+    switch (value.Type()) {
+    case IR::Type::Reg:
+        return static_cast<size_t>(value.Reg());
+    case IR::Type::Pred:
+        return static_cast<size_t>(value.Pred());
+    case IR::Type::Attribute:
+        return static_cast<size_t>(value.Attribute());
+    case IR::Type::Patch:
+        return static_cast<size_t>(value.Patch());
+    case IR::Type::U1:
+        return value.U1() ? 1 : 0;
+    case IR::Type::U8:
+        return value.U8();
+    case IR::Type::U16:
+        return value.U16();
+    case IR::Type::U32:
+        return value.U32();
+    case IR::Type::F32:
+        return std::bit_cast<u32>(value.F32());
+    case IR::Type::U64:
+        return static_cast<size_t>(value.U64());
+    case IR::Type::F64:
+        return static_cast<size_t>(std::bit_cast<u64>(value.F64()));
+    default:
+        return 0;
+    }
+}
+
+struct ExpressionHash {
+    size_t operator()(const Expression& expression) const noexcept {
+        size_t seed{static_cast<size_t>(expression.opcode)};
+        boost::hash_combine(seed, expression.flags);
+        for (const IR::Value& arg : expression.args) {
+            boost::hash_combine(seed, HashValue(arg));
+        }
+        return seed;
+    }
+};
+
+Expression MakeExpression(const IR::Inst& inst) {
+    Expression expression{
+        .opcode = inst.GetOpcode(),
+        .flags = inst.Flags<u32>(),
+    };
+    const size_t num_args{inst.NumArgs()};
+    for (size_t index = 0; index < num_args; ++index) {
+        expression.args[index] = inst.Arg(index).Resolve();
+    }
+    return expression;
+}
+
+class DominatorTree {
+public:
+    explicit DominatorTree(const IR::Program& program, std::pmr::memory_resource* resource)
+        : blocks{program.post_order_blocks}, idom(blocks.size(), UNDEFINED, resource),
+          children(blocks.size(), resource), indices{resource} {
+        for (size_t index = 0; index < blocks.size(); ++index) {
+            indices.emplace(blocks[index], index);
+        }
+        Build();
+    }
+
+    /// Index of the entry block, the root of the tree
+    [[nodiscard]] size_t Root() const noexcept {
+        return blocks.size() - 1;
+    }
+
+    [[nodiscard]] IR::Block* Block(size_t index) const noexcept {
+        return blocks[index];
+    }
+
+    /// Blocks immediately dominated by a block
+    [[nodiscard]] const std::pmr::vector<size_t>& Children(size_t index) const noexcept {
+        return children[index];
+    }
+
+private:
+    void Build() {
+        // Post order indices grow towards the entry block
+        const size_t root{Root()};
+        idom[root] = root;
+        bool changed{true};
+        while (changed) {
+            changed = false;
+            for (size_t index = root; index-- > 0;) {
+                size_t new_idom{UNDEFINED};
+                for (IR::Block* const pred : blocks[index]->ImmPredecessors()) {
+                    const auto it{indices.find(pred)};
+                    if (it == indices.end() || idom[it->second] == UNDEFINED) {
+                        continue;
+                    }
+                    new_idom = new_idom == UNDEFINED ? it->second : Intersect(it->second, new_idom);
+                }
+                if (new_idom != idom[index]) {
+                    idom[index] = new_idom;
+                    changed = true;
+                }
+            }
+        }
+        for (size_t index = 0; index < root; ++index) {
+            if (idom[index] != UNDEFINED) {
+                children[idom[index]].push_back(index);
+            }
+        }
+    }
+
+    [[nodiscard]] size_t Intersect(size_t lhs, size_t rhs) const {
+        while (lhs != rhs) {
+            while (lhs < rhs) {
+                lhs = idom[lhs];
+            }
+            while (rhs < lhs) {
+                rhs = idom[rhs];
+            }
+        }
+        return lhs;
+    }
+
+    std::span<IR::Block* const> blocks;
+    std::pmr::vector<size_t> idom;
+    std::pmr::vector<std::pmr::vector<size_t>> children;
+    std::pmr::unordered_map<const IR::Block*, size_t> indices;
+};
+
+class Pass {
+public:
+    explicit Pass(std::pmr::memory_resource* resource) : table{resource}, scoped{resource} {}
+
+    /// Numbers the instructions of a block, then drops its definitions once the subtree is done
+    void Visit(const DominatorTree& tree, std::pmr::memory_resource* resource) {
+        struct Frame {
+            size_t block;
+            size_t next_child;
+            size_t scope_begin;
+        };
+        std::pmr::vector<Frame> stack{resource};
+        const auto enter{[&](size_t block) {
+            stack.push_back({block, 0, scoped.size()});
+            VisitBlock(*tree.Block(block));
+        }};
+        enter(tree.Root());
+        while (!stack.empty()) {
+            Frame& frame{stack.back()};
+            const auto& children{tree.Children(frame.block)};
+            if (frame.next_child < children.size()) {
+                enter(children[frame.next_child++]);
+                continue;
+            }
+            while (scoped.size() > frame.scope_begin) {
+                table.erase(scoped.back());
+                scoped.pop_back();
+            }
+            stack.pop_back();
+        }
+    }
+
+private:
+    void VisitBlock(IR::Block& block) {
+        for (IR::Inst& inst : block.Instructions()) {
+            if (!inst.IsPure()) {
+                continue;
+            }
+            Expression expression{MakeExpression(inst)};
+            const auto [it, is_new] = table.try_emplace(expression, &inst);
+            if (is_new) {
+                scoped.push_back(std::move(expression));
+                continue;
+            }
+            if (inst.HasAssociatedPseudoOperation()) {
+                // Flags and sparse results are read from this instruction, keep it
+                continue;
+            }
+            inst.ReplaceUsesWith(IR::Value{it->second});
+        }
+    }
+
+    std::pmr::unordered_map<Expression, IR::Inst*, ExpressionHash> table;
+    std::pmr::vector<Expression> scoped;
+};
+} // Anonymous namespace
+
+void GlobalValueNumberingPass(IR::Program& program) {
+    if (program.post_order_blocks.empty()) {
+        return;
+    }
+    const ArenaScope arena_scope;
+    std::pmr::memory_resource* const resource{&ThreadArena()};
+    const DominatorTree tree{program, resource};
+    Pass pass{resource};
+    pass.Visit(tree, resource);
+}
+
+} // namespace Shader::Optimization
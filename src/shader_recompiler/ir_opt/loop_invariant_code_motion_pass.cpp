@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory_resource>
+#include <unordered_set>
+#include <vector>
+
+#include "shader_recompiler/arena.h"
+#include "shader_recompiler/frontend/ir/abstract_syntax_list.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+
+namespace Shader::Optimization {
+namespace {
+using ASL = IR::AbstractSyntaxNode;
+
+/// Returns the single block entering the loop from outside, or null when there is none
+IR::Block* Preheader(IR::Block* header, IR::Block* continue_block) {
+    IR::Block* preheader{};
+    for (IR::Block* const pred : header->ImmPredecessors()) {
+        if (pred == continue_block) {
+            continue;
+        }
+        if (preheader) {
+            return nullptr;
+        }
+        preheader = pred;
+    }
+    if (!preheader || preheader->ImmSuccessors().size() != 1) {
+        return nullptr;
+    }
+    return preheader;
+}
+
+bool IsInvariant(const IR::Inst& inst, const std::pmr::unordered_set<const IR::Inst*>& variant) {
+    if (!inst.IsPure() || inst.HasAssociatedPseudoOperation()) {
+        return false;
+    }
+    const size_t num_args{inst.NumArgs()};
+    for (size_t index = 0; index < num_args; ++index) {
+        const IR::Value arg{inst.Arg(index).Resolve()};
+        if (!arg.IsImmediate() && variant.contains(arg.Inst())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void HoistLoop(const IR::AbstractSyntaxList& syntax_list, size_t loop_index, size_t repeat_index,
+               std::pmr::memory_resource* resource) {
+    const ASL& repeat{syntax_list[repeat_index]};
+    IR::Block* const header{repeat.data.repeat.loop_header};
+    IR::Block* const continue_block{syntax_list[loop_index].data.loop.continue_block};
+    IR::Block* const preheader{Preheader(header, continue_block)};
+    if (!preheader) {
+        return;
+    }
+    // Only blocks executed on every iteration are hoisted from, instructions inside conditional
+    // statements would otherwise run even when the guest skips them
+    std::pmr::vector<IR::Block*> blocks{resource};
+    std::pmr::vector<IR::Block*> conditional_blocks{resource};
+    blocks.push_back(header);
+    size_t if_depth{};
+    size_t loop_depth{};
+    for (size_t index = loop_index + 1; index < repeat_index; ++index) {
+        const ASL& node{syntax_list[index]};
+        switch (node.type) {
+        case ASL::Type::Block:
+            if (if_depth == 0 && loop_depth == 0) {
+                blocks.push_back(node.data.block);
+            } else {
+                conditional_blocks.push_back(node.data.block);
+            }
+            break;
+        case ASL::Type::If:
+            ++if_depth;
+            break;
+        case ASL::Type::EndIf:
+            --if_depth;
+            break;
+        case ASL::Type::Loop:
+            ++loop_depth;
+            break;
+        case ASL::Type::Repeat:
+            --loop_depth;
+            break;
+        default:
+            break;
+        }
+    }
+    std::pmr::unordered_set<const IR::Inst*> variant{resource};
+    for (IR::Block* const block : blocks) {
+        for (const IR::Inst& inst : block->Instructions()) {
+            variant.insert(&inst);
+        }
+    }
+    for (IR::Block* const block : conditional_blocks) {
+        for (const IR::Inst& inst : block->Instructions()) {
+            variant.insert(&inst);
+        }
+    }
+    // Blocks are in syntax order, so definitions are visited before their uses in the loop
+    IR::Block::InstructionList& preheader_insts{preheader->Instructions()};
+    for (IR::Block* const block : blocks) {
+        IR::Block::InstructionList& insts{block->Instructions()};
+        for (auto it = insts.begin(); it != insts.end();) {
+            IR::Inst& inst{*it};
+            if (!IsInvariant(inst, variant)) {
+                ++it;
+                continue;
+            }
+            it = insts.erase(it);
+            preheader_insts.push_back(inst);
+            variant.erase(&inst);
+        }
+    }
+}
+} // Anonymous namespace
+
+void LoopInvariantCodeMotionPass(IR::Program& program) {
+    const ArenaScope arena_scope;
+    std::pmr::memory_resource* const resource{&ThreadArena()};
+    const IR::AbstractSyntaxList& syntax_list{program.syntax_list};
+
+    // Loops are visited as they close, so inner loops hoist into their preheader first and the
+    // enclosing loop can hoist the same instructions again
+    std::pmr::vector<size_t> loop_stack{resource};
+    for (size_t index = 0; index < syntax_list.size(); ++index) {
+        switch (syntax_list[index].type) {
+        case ASL::Type::Loop:
+            loop_stack.push_back(index);
+            break;
+        case ASL::Type::Repeat:
+            HoistLoop(syntax_list, loop_stack.back(), index, resource);
+            loop_stack.pop_back();
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+} // namespace Shader::Optimization
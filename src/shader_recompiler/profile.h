@@ -48,6 +48,10 @@ struct Profile {
 
     bool warp_size_potentially_larger_than_guest{};
 
+    /// Storage buffers are accessed through device addresses read from a uniform buffer table,
+    /// instead of being bound as individual descriptors
+    bool storage_buffer_pointers{};
+
     bool lower_left_origin_mode{};
     /// Fragment outputs have to be declared even if they are not written to avoid undefined values.
     /// See Ori and the Blind Forest's main menu for reference.
@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "common/settings.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/translation_cache.h"
+
+namespace Shader {
+namespace {
+constexpr size_t MAX_PROGRAMS = 512;
+constexpr size_t MAX_VARIANTS = 4;
+
+/// Environment queries made while translating a program
+struct EnvironmentReads {
+    [[nodiscard]] bool Matches(Environment& env) const {
+        if (std::memcmp(&env.SPH(), &sph, sizeof(sph)) != 0 ||
+            env.GpPassthroughMask() != gp_passthrough_mask ||
+            env.TextureBoundBuffer() != texture_bound || env.LocalMemorySize() != local_memory ||
+            env.SharedMemorySize() != shared_memory || env.WorkgroupSize() != workgroup_size ||
+            env.HasHLEMacroState() != has_hle_macro_state) {
+            return false;
+        }
+        if (viewport_transform_state &&
+            env.ReadViewportTransformState() != *viewport_transform_state) {
+            return false;
+        }
+        for (const auto& [key, value] : cbuf_values) {
+            if (env.ReadCbufValue(static_cast<u32>(key >> 32), static_cast<u32>(key)) != value) {
+                return false;
+            }
+        }
+        for (const auto& [key, value] : cbuf_replacements) {
+            if (env.GetReplaceConstBuffer(static_cast<u32>(key >> 32), static_cast<u32>(key)) !=
+                value) {
+                return false;
+            }
+        }
+        for (const auto& [handle, type] : texture_types) {
+            if (env.ReadTextureType(handle) != type) {
+                return false;
+            }
+        }
+        for (const auto& [handle, format] : texture_pixel_formats) {
+            if (env.ReadTexturePixelFormat(handle) != format) {
+                return false;
+            }
+        }
+        for (const auto& [handle, is_integer] : texture_integer_formats) {
+            if (env.IsTexturePixelFormatInteger(handle) != is_integer) {
+                return false;
+            }
+        }
+        // The code is covered by the stage hash, but the environment has to see the same read
+        // range to serialize the shader to the pipeline cache
+        if (lowest_address <= highest_address) {
+            (void)env.ReadInstruction(lowest_address);
+            (void)env.ReadInstruction(highest_address);
+        }
+        return true;
+    }
+
+    ProgramHeader sph{};
+    std::array<u32, 8> gp_passthrough_mask{};
+    u32 texture_bound{};
+    u32 local_memory{};
+    u32 shared_memory{};
+    std::array<u32, 3> workgroup_size{};
+    bool has_hle_macro_state{};
+    u32 lowest_address{std::numeric_limits<u32>::max()};
+    u32 highest_address{};
+    std::optional<u32> viewport_transform_state;
+    std::unordered_map<u64, u32> cbuf_values;
+    std::unordered_map<u64, std::optional<ReplaceConstant>> cbuf_replacements;
+    std::unordered_map<u32, TextureType> texture_types;
+    std::unordered_map<u32, TexturePixelFormat> texture_pixel_formats;
+    std::unordered_map<u32, bool> texture_integer_formats;
+};
+
+/// Forwards every query to another environment and records the ones translation depends on
+class RecordingEnvironment final : public Environment {
+public:
+    explicit RecordingEnvironment(Environment& env_, EnvironmentReads& reads_)
+        : env{env_}, reads{reads_} {
+        sph = env.SPH();
+        gp_passthrough_mask = env.GpPassthroughMask();
+        stage = env.ShaderStage();
+        start_address = env.StartAddress();
+        is_proprietary_driver = env.IsProprietaryDriver();
+
+        reads.sph = sph;
+        reads.gp_passthrough_mask = gp_passthrough_mask;
+        reads.texture_bound = env.TextureBoundBuffer();
+        reads.local_memory = env.LocalMemorySize();
+        reads.shared_memory = env.SharedMemorySize();
+        reads.workgroup_size = env.WorkgroupSize();
+        reads.has_hle_macro_state = env.HasHLEMacroState();
+    }
+
+    u64 ReadInstruction(u32 address) override {
+        reads.lowest_address = std::min(reads.lowest_address, address);
+        reads.highest_address = std::max(reads.highest_address, address);
+        return env.ReadInstruction(address);
+    }
+
+    u32 ReadCbufValue(u32 cbuf_index, u32 cbuf_offset) override {
+        const u32 value{env.ReadCbufValue(cbuf_index, cbuf_offset)};
+        reads.cbuf_values.emplace(MakeCbufKey(cbuf_index, cbuf_offset), value);
+        return value;
+    }
+
+    TextureType ReadTextureType(u32 raw_handle) override {
+        const TextureType type{env.ReadTextureType(raw_handle)};
+        reads.texture_types.emplace(raw_handle, type);
+        return type;
+    }
+
+    TexturePixelFormat ReadTexturePixelFormat(u32 raw_handle) override {
+        const TexturePixelFormat format{env.ReadTexturePixelFormat(raw_handle)};
+        reads.texture_pixel_formats.emplace(raw_handle, format);
+        return format;
+    }
+
+    bool IsTexturePixelFormatInteger(u32 raw_handle) override {
+        const bool is_integer{env.IsTexturePixelFormatInteger(raw_handle)};
+        reads.texture_integer_formats.emplace(raw_handle, is_integer);
+        return is_integer;
+    }
+
+    u32 ReadViewportTransformState() override {
+        const u32 state{env.ReadViewportTransformState()};
+        reads.viewport_transform_state = state;
+        return state;
+    }
+
+    u32 TextureBoundBuffer() const override {
+        return env.TextureBoundBuffer();
+    }
+
+    u32 LocalMemorySize() const override {
+        return env.LocalMemorySize();
+    }
+
+    u32 SharedMemorySize() const override {
+        return env.SharedMemorySize();
+    }
+
+    std::array<u32, 3> WorkgroupSize() const override {
+        return env.WorkgroupSize();
+    }
+
+    bool HasHLEMacroState() const override {
+        return env.HasHLEMacroState();
+    }
+
+    std::optional<ReplaceConstant> GetReplaceConstBuffer(u32 bank, u32 offset) override {
+        const std::optional<ReplaceConstant> replace{env.GetReplaceConstBuffer(bank, offset)};
+        reads.cbuf_replacements.emplace(MakeCbufKey(bank, offset), replace);
+        return replace;
+    }
+
+    void Dump(u64 pipeline_hash, u64 shader_hash) override {
+        env.Dump(pipeline_hash, shader_hash);
+    }
+
+private:
+    static u64 MakeCbufKey(u32 index, u32 offset) {
+        return (static_cast<u64>(index) << 32) | offset;
+    }
+
+    Environment& env;
+    EnvironmentReads& reads;
+};
+
+u64 ConfigHash(const HostTranslateInfo& host_info) {
+    size_t seed{};
+    boost::hash_combine(seed, host_info.support_float64);
+    boost::hash_combine(seed, host_info.support_float16);
+    boost::hash_combine(seed, host_info.support_int64);
+    boost::hash_combine(seed, host_info.needs_demote_reorder);
+    boost::hash_combine(seed, host_info.support_snorm_render_buffer);
+    boost::hash_combine(seed, host_info.support_viewport_index_layer);
+    boost::hash_combine(seed, host_info.min_ssbo_alignment);
+    boost::hash_combine(seed, host_info.support_geometry_shader_passthrough);
+    boost::hash_combine(seed, host_info.support_conditional_barrier);
+    // Settings read by the optimization pipeline
+    boost::hash_combine(seed, Settings::values.resolution_info.active);
+    boost::hash_combine(seed, Settings::values.renderer_debug.GetValue());
+    return seed;
+}
+} // Anonymous namespace
+
+struct TranslationCache::Entry {
+    ObjectPool<IR::Inst> inst_pool{256};
+    ObjectPool<IR::Block> block_pool{32};
+    IR::Program program;
+    EnvironmentReads reads;
+};
+
+size_t TranslationCache::KeyHash::operator()(const Key& key) const noexcept {
+    size_t seed{key.hash};
+    boost::hash_combine(seed, static_cast<u32>(key.stage));
+    boost::hash_combine(seed, key.config);
+    return seed;
+}
+
+TranslationCache::TranslationCache() = default;
+
+TranslationCache::~TranslationCache() = default;
+
+IR::Program TranslationCache::Translate(ObjectPool<IR::Inst>& inst_pool,
+                                        ObjectPool<IR::Block>& block_pool, Environment& env,
+                                        u64 hash, const HostTranslateInfo& host_info,
+                                        const TranslateFunction& translate) {
+    const Key key{
+        .hash = hash,
+        .stage = env.ShaderStage(),
+        .config = ConfigHash(host_info),
+    };
+    if (const std::shared_ptr<const Entry> entry{Find(key, env)}) {
+        return IR::CloneProgram(inst_pool, block_pool, entry->program);
+    }
+    auto entry{std::make_shared<Entry>()};
+    RecordingEnvironment recording_env{env, entry->reads};
+    IR::Program program{translate(recording_env)};
+    entry->program = IR::CloneProgram(entry->inst_pool, entry->block_pool, program);
+    Insert(key, std::move(entry));
+    return program;
+}
+
+void TranslationCache::Clear() {
+    std::scoped_lock lock{mutex};
+    entries.clear();
+    insertion_order.clear();
+}
+
+std::shared_ptr<const TranslationCache::Entry> TranslationCache::Find(const Key& key,
+                                                                      Environment& env) {
+    std::vector<std::shared_ptr<const Entry>> candidates;
+    {
+        std::scoped_lock lock{mutex};
+        const auto it{entries.find(key)};
+        if (it == entries.end()) {
+            return nullptr;
+        }
+        candidates = it->second;
+    }
+    // Entries are immutable once inserted, replay them without holding the lock
+    for (const std::shared_ptr<const Entry>& candidate : candidates) {
+        try {
+            if (candidate->reads.Matches(env)) {
+                return candidate;
+            }
+        } catch (const Exception&) {
+            // Environments loaded from disk throw on queries they have not recorded
+        }
+    }
+    return nullptr;
+}
+
+void TranslationCache::Insert(const Key& key, std::shared_ptr<const Entry> entry) {
+    std::scoped_lock lock{mutex};
+    auto& variants{entries[key]};
+    if (variants.empty()) {
+        insertion_order.push_back(key);
+    } else if (variants.size() == MAX_VARIANTS) {
+        variants.erase(variants.begin());
+    }
+    variants.push_back(std::move(entry));
+
+    while (insertion_order.size() > MAX_PROGRAMS) {
+        entries.erase(insertion_order.front());
+        insertion_order.pop_front();
+    }
+}
+
+} // namespace Shader
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "shader_recompiler/environment.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/object_pool.h"
+
+namespace Shader {
+
+struct HostTranslateInfo;
+
+/**
+ * In-memory cache of optimized programs, shared by every pipeline that uses the same stage.
+ *
+ * Programs are keyed by the stage hash and the host and settings state that changes translation.
+ * Translation also depends on the environment (bound texture types, constant buffer values), so
+ * every environment query made during translation is recorded and replayed against the next
+ * environment before the cached program is reused. Replaying also records the queries in that
+ * environment, so it can be serialized to the pipeline cache as if it had been translated.
+ *
+ * Backends modify programs while emitting them, callers always receive their own copy.
+ */
+class TranslationCache {
+public:
+    using TranslateFunction = std::function<IR::Program(Environment& env)>;
+
+    explicit TranslationCache();
+    ~TranslationCache();
+
+    TranslationCache(const TranslationCache&) = delete;
+    TranslationCache& operator=(const TranslationCache&) = delete;
+
+    /// Returns a copy of a compatible cached program in the given pools,
+    /// or translates the stage with the given function and caches the result
+    [[nodiscard]] IR::Program Translate(ObjectPool<IR::Inst>& inst_pool,
+                                        ObjectPool<IR::Block>& block_pool, Environment& env,
+                                        u64 hash, const HostTranslateInfo& host_info,
+                                        const TranslateFunction& translate);
+
+    /// Drops every cached program
+    void Clear();
+
+private:
+    struct Key {
+        u64 hash;
+        Stage stage;
+        u64 config;
+
+        auto operator<=>(const Key&) const noexcept = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    struct Entry;
+
+    /// Returns a cached program translated with an environment matching env, or null
+    [[nodiscard]] std::shared_ptr<const Entry> Find(const Key& key, Environment& env);
+
+    void Insert(const Key& key, std::shared_ptr<const Entry> entry);
+
+    std::mutex mutex;
+    std::unordered_map<Key, std::vector<std::shared_ptr<const Entry>>, KeyHash> entries;
+    std::deque<Key> insertion_order;
+};
+
+} // namespace Shader
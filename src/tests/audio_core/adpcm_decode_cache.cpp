@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <random>
+#include <span>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "audio_core/renderer/command/data_source/adpcm_decode_cache.h"
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+namespace {
+using Context = VoiceState::AdpcmContext;
+
+// Plain decoder, only there to give the cache samples that follow from their contexts
+void Decode(std::span<const u8> wave, u32 position, u32 count,
+            const std::array<s16, 16>& coefficients, Context& context, std::span<s16> output) {
+    for (u32 i = 0; i < count; i++, position++) {
+        const u8* frame{&wave[position / AdpcmSamplesPerFrame * AdpcmFrameSize]};
+        const u32 index{position % AdpcmSamplesPerFrame};
+        if (index == 0) {
+            context.header = frame[0];
+        }
+        const u8 byte{frame[1 + index / 2]};
+        const s32 nibble{(index % 2 == 0 ? byte >> 4 : byte & 0xF) ^ 8};
+        const s32 code{nibble - 8};
+        const u32 coeff_index{(context.header >> 4U) & 7U};
+        const s32 prediction{coefficients[coeff_index * 2] * context.yn0 +
+                             coefficients[coeff_index * 2 + 1] * context.yn1};
+        const s32 sample{((code * (1 << (context.header & 0xF))) * 2048 + 0x400 + prediction) >>
+                         11};
+        context.yn1 = context.yn0;
+        context.yn0 = static_cast<s16>(std::clamp(sample, -0x8000, 0x7FFF));
+        output[i] = context.yn0;
+    }
+}
+
+std::span<const u8> FramesAt(std::span<const u8> wave, u32 position) {
+    return wave.subspan(position / AdpcmSamplesPerFrame * AdpcmFrameSize);
+}
+
+struct Voice {
+    std::vector<u8> wave;
+    AdpcmDecodeCache::Segment segment;
+    Context initial_context;
+};
+
+Voice MakeVoice(u64 seed) {
+    std::mt19937_64 rng{seed};
+    Voice voice{};
+    voice.wave.resize((4 + rng() % 60) * AdpcmFrameSize);
+    for (auto& byte : voice.wave) {
+        byte = static_cast<u8>(rng());
+    }
+    const u32 sample_count{static_cast<u32>(voice.wave.size() / AdpcmFrameSize) *
+                           AdpcmSamplesPerFrame};
+    voice.segment.buffer = 0x1000;
+    voice.segment.buffer_size = voice.wave.size();
+    voice.segment.start_offset = static_cast<u32>(rng() % (sample_count / 2));
+    voice.segment.end_offset = sample_count - static_cast<u32>(rng() % 20);
+    for (auto& coefficient : voice.segment.coefficients) {
+        coefficient = static_cast<s16>(rng() % 4096) - 2048;
+    }
+    voice.initial_context = {static_cast<u16>(rng() & 0x7F), static_cast<s16>(rng()),
+                             static_cast<s16>(rng())};
+    return voice;
+}
+
+/// Plays the segment through the cache in random chunks, checking it against the decoder
+void Play(AdpcmDecodeCache& cache, const Voice& voice, u64 seed, bool expect_cached) {
+    std::mt19937_64 rng{seed};
+    const auto& segment{voice.segment};
+    Context context{voice.initial_context};
+    Context expected_context{voice.initial_context};
+    std::vector<s16> output(segment.end_offset);
+    std::vector<s16> expected(segment.end_offset);
+
+    for (u32 position = segment.start_offset; position < segment.end_offset;) {
+        const u32 count{std::min<u32>(1 + static_cast<u32>(rng() % 300),
+                                      segment.end_offset - position)};
+        const auto frames{FramesAt(voice.wave, position)};
+        Decode(voice.wave, position, count, segment.coefficients, expected_context, expected);
+
+        const u32 cached{cache.Read(segment, position, count, frames, context, output)};
+        // Other contexts can end up decoding the same samples as the segment goes on, so only the
+        // start is sure to miss
+        if (expect_cached) {
+            REQUIRE(cached == count);
+        } else if (position == segment.start_offset) {
+            REQUIRE(cached == 0);
+        }
+        if (cached < count) {
+            const Context before{context};
+            const auto rest{std::span(output).subspan(cached, count - cached)};
+            const auto rest_frames{FramesAt(voice.wave, position + cached)};
+            Decode(voice.wave, position + cached, count - cached, segment.coefficients, context,
+                   rest);
+            cache.Write(segment, position + cached, rest_frames, before, rest);
+        }
+
+        REQUIRE(std::equal(output.begin(), output.begin() + count, expected.begin()));
+        REQUIRE(context.header == expected_context.header);
+        REQUIRE(context.yn0 == expected_context.yn0);
+        REQUIRE(context.yn1 == expected_context.yn1);
+        position += count;
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("AdpcmDecodeCache[Replay]", "[audio_core]") {
+    for (u64 seed = 0; seed < 200; seed++) {
+        AdpcmDecodeCache cache;
+        const auto voice{MakeVoice(seed)};
+        Play(cache, voice, seed, false);
+        // Chunked differently on the way back, the cache doesn't care where calls split
+        Play(cache, voice, seed + 1000, true);
+        Play(cache, voice, seed + 2000, true);
+    }
+}
+
+TEST_CASE("AdpcmDecodeCache[Invalidation]", "[audio_core]") {
+    for (u64 seed = 0; seed < 200; seed++) {
+        AdpcmDecodeCache cache;
+        auto voice{MakeVoice(seed)};
+        Play(cache, voice, seed, false);
+
+        // Another starting context decodes differently, and gets its own entry
+        auto other_voice{voice};
+        other_voice.initial_context.yn0 ^= 1;
+        Play(cache, other_voice, seed, false);
+        Play(cache, other_voice, seed, true);
+        Play(cache, voice, seed, true);
+
+        // Streaming over the wave buffer drops its entries
+        voice.wave[voice.segment.start_offset / AdpcmSamplesPerFrame * AdpcmFrameSize + 1] ^= 0x10;
+        Play(cache, voice, seed, false);
+        Play(cache, voice, seed, true);
+    }
+}
+
+} // namespace AudioCore::Renderer
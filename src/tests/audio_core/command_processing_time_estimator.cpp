@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+#include "audio_core/renderer/command/command_processing_time_estimator.h"
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+namespace {
+void Record(ADSP::AudioRenderer::CommandProfile& profile, CommandId type, u64 time,
+            u64 estimate) {
+    const auto index{static_cast<size_t>(type)};
+    profile.counts[index]++;
+    profile.times[index] += time;
+    profile.estimates[index] += estimate;
+}
+} // Anonymous namespace
+
+TEST_CASE("MeasuredCommandProcessingTimeEstimator", "[audio_core]") {
+    MeasuredCommandProcessingTimeEstimator estimator;
+    ADSP::AudioRenderer::CommandProfile profile;
+
+    MixCommand mix{};
+    mix.type = CommandId::Mix;
+    mix.estimated_process_time = 1000;
+    VolumeCommand volume{};
+    volume.type = CommandId::Volume;
+    volume.estimated_process_time = 500;
+
+    // Types that haven't been measured keep their HOS estimates
+    REQUIRE(estimator.Estimate(mix) == 1000);
+    estimator.Update(profile);
+    REQUIRE(estimator.Estimate(mix) == 1000);
+
+    // 5us for an estimate of 2,000 is 2,880 units, 1.44 per unit of estimate
+    Record(profile, CommandId::Mix, 5'000, 2'000);
+    estimator.Update(profile);
+    REQUIRE(estimator.Estimate(mix) >= 1439);
+    REQUIRE(estimator.Estimate(mix) <= 1440);
+    REQUIRE(estimator.Estimate(volume) == 500);
+
+    // Later measurements move the scale towards theirs, ones already learned from are ignored
+    const u32 learned{estimator.Estimate(mix)};
+    Record(profile, CommandId::Mix, 0, 0);
+    estimator.Update(profile);
+    REQUIRE(estimator.Estimate(mix) == learned);
+    for (int i = 0; i < 200; i++) {
+        Record(profile, CommandId::Mix, 1'000, 2'000);
+        estimator.Update(profile);
+    }
+    REQUIRE(estimator.Estimate(mix) >= 287);
+    REQUIRE(estimator.Estimate(mix) <= 289);
+}
+
+} // namespace AudioCore::Renderer
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#include "common/common_types.h"
+#include "common/fixed_point.h"
+
+namespace AudioCore::Renderer {
+namespace {
+// The loops the mix and volume commands ran before the kernels, done with FixedPoint
+template <size_t Q>
+s32 ReferenceMix(std::vector<s32>& output, const std::vector<s32>& input, f32 volume_,
+                 f32 ramp_) {
+    Common::FixedPoint<64 - Q, Q> volume{volume_};
+    const Common::FixedPoint<64 - Q, Q> ramp{ramp_};
+    Common::FixedPoint<64 - Q, Q> sample{0};
+    for (size_t i = 0; i < input.size(); i++) {
+        sample = input[i] * volume;
+        output[i] = (output[i] + sample).to_int();
+        volume += ramp;
+    }
+    return sample.to_int();
+}
+
+template <size_t Q>
+void ReferenceScale(std::vector<s32>& output, const std::vector<s32>& input, f32 volume,
+                    f32 ramp_) {
+    Common::FixedPoint<64 - Q, Q> gain{volume};
+    const Common::FixedPoint<64 - Q, Q> ramp{ramp_};
+    for (size_t i = 0; i < input.size(); i++) {
+        output[i] = (input[i] * gain).to_int();
+        gain += ramp;
+    }
+}
+
+template <size_t Q>
+void CheckBitExact(std::mt19937& rng) {
+    std::uniform_real_distribution<f32> volume_distribution(-4.0f, 4.0f);
+    for (u32 iteration = 0; iteration < 2000; iteration++) {
+        // Sizes that aren't multiples of the vector widths exercise the scalar tails
+        const u32 sample_count = rng() % 70;
+        std::vector<s32> input(sample_count);
+        std::vector<s32> output(sample_count);
+        for (auto& sample : input) {
+            // Mostly 16 bit samples, with full range ones to hit wrapping
+            sample = rng() % 4 == 0 ? static_cast<s32>(rng()) : static_cast<s32>(rng() % 65536) -
+                                                                     32768;
+        }
+        for (auto& sample : output) {
+            sample = static_cast<s32>(rng());
+        }
+
+        // Volumes past the 32 bit range of the vector kernels go through the scalar one
+        const f32 volume = iteration % 100 == 0 ? 600.0f : volume_distribution(rng);
+        const f32 ramp = iteration % 2 == 0 ? 0.0f : volume_distribution(rng) / 100.0f;
+        const Common::FixedPoint<64 - Q, Q> raw_volume{volume};
+        const Common::FixedPoint<64 - Q, Q> raw_ramp{ramp};
+
+        auto expected_mix = output;
+        const s32 expected_last = ReferenceMix<Q>(expected_mix, input, volume, ramp);
+        auto expected_scale = output;
+        ReferenceScale<Q>(expected_scale, input, volume, ramp);
+
+        for (const auto isa : GetSupportedMixKernelIsas()) {
+            auto mixed = output;
+            const s32 last = MixSamples<Q>(mixed, input, raw_volume.to_raw(), raw_ramp.to_raw(),
+                                           sample_count, isa);
+            REQUIRE(mixed == expected_mix);
+            REQUIRE(last == expected_last);
+
+            auto scaled = output;
+            ScaleSamples<Q>(scaled, input, raw_volume.to_raw(), raw_ramp.to_raw(), sample_count,
+                            isa);
+            REQUIRE(scaled == expected_scale);
+        }
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("MixKernels: Bit exact with FixedPoint", "[audio_core]") {
+    std::mt19937 rng{1234};
+    CheckBitExact<15>(rng);
+    CheckBitExact<23>(rng);
+}
+
+TEST_CASE("MixKernels: In place scaling", "[audio_core]") {
+    std::vector<s32> samples(37);
+    for (size_t i = 0; i < samples.size(); i++) {
+        samples[i] = static_cast<s32>(i * 1000) - 15000;
+    }
+    const Common::FixedPoint<49, 15> gain{0.75f};
+
+    auto expected = samples;
+    ReferenceScale<15>(expected, samples, 0.75f, 0.0f);
+    for (const auto isa : GetSupportedMixKernelIsas()) {
+        auto buffer = samples;
+        ScaleSamples<15>(buffer, buffer, gain.to_raw(), 0, static_cast<u32>(buffer.size()), isa);
+        REQUIRE(buffer == expected);
+    }
+}
+
+} // namespace AudioCore::Renderer
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <bit>
+#include <memory>
+#include <random>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "audio_core/renderer/command/effect/reverb_kernels.h"
+#include "common/common_types.h"
+#include "common/fixed_point.h"
+
+namespace AudioCore::Renderer {
+namespace {
+using Sample = Common::FixedPoint<50, 14>;
+
+Sample RandomSample(std::mt19937_64& rng) {
+    // Mostly sample sized values, with full range ones to hit wrapping and the scalar fallback
+    if (rng() % 64 == 0) {
+        return Sample::from_base(static_cast<s64>(rng()));
+    }
+    return Sample::from_base(static_cast<s64>(rng() % (u64{1} << 41)) - (s64{1} << 40));
+}
+
+Sample RandomGain(std::mt19937_64& rng) {
+    return Sample::from_base(static_cast<s64>(rng() % 65536) - 32768);
+}
+
+template <typename DelayLine>
+void FillDelayLine(DelayLine& line, std::mt19937_64& rng) {
+    for (auto& sample : line.buffer) {
+        sample = RandomSample(rng);
+    }
+}
+
+// Every state built from the same seed is the same, delay line pointers included
+std::unique_ptr<ReverbInfo::State> MakeReverbState(u64 seed) {
+    std::mt19937_64 rng{seed};
+    auto state{std::make_unique<ReverbInfo::State>()};
+    for (u32 i = 0; i < ReverbInfo::MaxDelayLines; i++) {
+        auto& fdn{state->fdn_delay_lines[i]};
+        auto& decay{state->decay_delay_lines[i]};
+        // Shorter than a block, so the lines wrap within one
+        fdn.Initialize(static_cast<s32>(20 + rng() % 100), 1.0f);
+        decay.Initialize(static_cast<s32>(2 + rng() % 30), 0.0f);
+        FillDelayLine(fdn, rng);
+        FillDelayLine(decay, rng);
+        for (u64 tick = rng() % 50; tick > 0; tick--) {
+            fdn.Tick(RandomSample(rng));
+            decay.Tick(RandomSample(rng));
+        }
+        // Shrunk like a parameter update does, which can leave the pointers past the end
+        fdn.sample_count = static_cast<s32>(1 + rng() % fdn.sample_count_max);
+        fdn.buffer_end = &fdn.buffer[fdn.sample_count - 1];
+        decay.decay = RandomGain(rng);
+
+        state->hf_decay_prev_gain[i] = RandomGain(rng);
+        state->hf_decay_gain[i] = RandomGain(rng);
+        state->prev_feedback_output[i] = RandomSample(rng);
+    }
+    return state;
+}
+
+std::unique_ptr<I3dl2ReverbInfo::State> MakeI3dl2ReverbState(u64 seed) {
+    std::mt19937_64 rng{seed};
+    std::uniform_real_distribution<f32> coeff_distribution(-1.5f, 1.5f);
+    auto state{std::make_unique<I3dl2ReverbInfo::State>()};
+    for (u32 i = 0; i < I3dl2ReverbInfo::MaxDelayLines; i++) {
+        auto& fdn{state->fdn_delay_lines[i]};
+        auto& decay0{state->decay_delay_lines0[i]};
+        auto& decay1{state->decay_delay_lines1[i]};
+        fdn.Initialize(static_cast<s32>(20 + rng() % 100));
+        decay0.Initialize(static_cast<s32>(2 + rng() % 30));
+        decay1.Initialize(static_cast<s32>(2 + rng() % 30));
+        // No delay at all makes ticking return the sample just written
+        fdn.SetDelay(static_cast<s32>(rng() % (fdn.max_delay + 1)));
+        decay0.SetDelay(static_cast<s32>(rng() % (decay0.max_delay + 1)));
+        decay1.SetDelay(rng() % 4 == 0 ? 0 : static_cast<s32>(rng() % (decay1.max_delay + 1)));
+        FillDelayLine(fdn, rng);
+        FillDelayLine(decay0, rng);
+        FillDelayLine(decay1, rng);
+        decay0.wet_gain = coeff_distribution(rng);
+        decay1.wet_gain = coeff_distribution(rng);
+
+        for (auto& coeff : state->lowpass_coeff[i]) {
+            coeff = coeff_distribution(rng);
+        }
+        state->shelf_filter[i] = rng() % 64 == 0 ? 1.0e20f : coeff_distribution(rng) * 1.0e6f;
+    }
+    return state;
+}
+
+template <typename DelayLine>
+void CheckSameDelayLine(const DelayLine& lhs, const DelayLine& rhs) {
+    REQUIRE(lhs.buffer.size() == rhs.buffer.size());
+    for (size_t i = 0; i < lhs.buffer.size(); i++) {
+        REQUIRE(lhs.buffer[i].to_raw() == rhs.buffer[i].to_raw());
+    }
+    REQUIRE(lhs.input - lhs.buffer.data() == rhs.input - rhs.buffer.data());
+    REQUIRE(lhs.output - lhs.buffer.data() == rhs.output - rhs.buffer.data());
+}
+
+void CheckSameOutputs(const std::vector<ReverbFdnSamples>& lhs,
+                      const std::vector<ReverbFdnSamples>& rhs) {
+    for (size_t sample = 0; sample < lhs.size(); sample++) {
+        for (size_t line = 0; line < ReverbFdnLineCount; line++) {
+            REQUIRE(lhs[sample][line].to_raw() == rhs[sample][line].to_raw());
+        }
+    }
+}
+
+std::vector<Sample> MakeInputs(u64 seed) {
+    std::mt19937_64 rng{seed};
+    std::vector<Sample> inputs(rng() % 200);
+    for (auto& input : inputs) {
+        input = RandomSample(rng);
+    }
+    return inputs;
+}
+} // Anonymous namespace
+
+TEST_CASE("ReverbFdn[BitExact]", "[audio_core]") {
+    for (const auto isa : GetSupportedMixKernelIsas()) {
+        for (u64 seed = 0; seed < 300; seed++) {
+            const auto inputs{MakeInputs(seed)};
+            auto expected_state{MakeReverbState(seed)};
+            auto state{MakeReverbState(seed)};
+            std::vector<ReverbFdnSamples> expected(inputs.size());
+            std::vector<ReverbFdnSamples> outputs(inputs.size());
+
+            ProcessReverbFdn(*expected_state, inputs, expected, MixKernelIsa::Scalar);
+            ProcessReverbFdn(*state, inputs, outputs, isa);
+
+            CheckSameOutputs(expected, outputs);
+            for (u32 i = 0; i < ReverbInfo::MaxDelayLines; i++) {
+                REQUIRE(expected_state->prev_feedback_output[i].to_raw() ==
+                        state->prev_feedback_output[i].to_raw());
+                CheckSameDelayLine(expected_state->fdn_delay_lines[i], state->fdn_delay_lines[i]);
+                CheckSameDelayLine(expected_state->decay_delay_lines[i],
+                                   state->decay_delay_lines[i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("I3dl2ReverbFdn[BitExact]", "[audio_core]") {
+    for (const auto isa : GetSupportedMixKernelIsas()) {
+        for (u64 seed = 0; seed < 300; seed++) {
+            const auto inputs{MakeInputs(seed)};
+            auto expected_state{MakeI3dl2ReverbState(seed)};
+            auto state{MakeI3dl2ReverbState(seed)};
+            if (seed % 50 == 0) {
+                // Coefficients past the 32 bit range of the vector kernels use the scalar one
+                expected_state->lowpass_coeff[1][0] = 200000.0f;
+                state->lowpass_coeff[1][0] = 200000.0f;
+            }
+            std::vector<ReverbFdnSamples> expected(inputs.size());
+            std::vector<ReverbFdnSamples> outputs(inputs.size());
+
+            ProcessI3dl2ReverbFdn(*expected_state, inputs, expected, MixKernelIsa::Scalar);
+            ProcessI3dl2ReverbFdn(*state, inputs, outputs, isa);
+
+            CheckSameOutputs(expected, outputs);
+            for (u32 i = 0; i < I3dl2ReverbInfo::MaxDelayLines; i++) {
+                REQUIRE(std::bit_cast<u32>(expected_state->shelf_filter[i]) ==
+                        std::bit_cast<u32>(state->shelf_filter[i]));
+                CheckSameDelayLine(expected_state->fdn_delay_lines[i], state->fdn_delay_lines[i]);
+                CheckSameDelayLine(expected_state->decay_delay_lines0[i],
+                                   state->decay_delay_lines0[i]);
+                CheckSameDelayLine(expected_state->decay_delay_lines1[i],
+                                   state->decay_delay_lines1[i]);
+            }
+        }
+    }
+}
+
+} // namespace AudioCore::Renderer
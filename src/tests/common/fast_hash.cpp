@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/fast_hash.h"
+
+namespace {
+std::vector<u8> MakeInput(size_t size) {
+    std::vector<u8> input(size);
+    for (size_t i = 0; i < size; ++i) {
+        input[i] = static_cast<u8>(i * 31 + 7);
+    }
+    return input;
+}
+} // Anonymous namespace
+
+TEST_CASE("FastHash64: Matches XXH3", "[common]") {
+    // Generated with XXH3_64bits of the reference implementation, covering every size class
+    static constexpr std::array<std::pair<size_t, u64>, 8> expected{{
+        {0, 0x2D06800538D394C2ULL},
+        {3, 0x15F7093B173D005CULL},
+        {8, 0xDEC6A9A43575982EULL},
+        {16, 0x7E484C18D74895D0ULL},
+        {100, 0x8C97158042FBF926ULL},
+        {200, 0x12FDB864685F344DULL},
+        {1000, 0x989765D0EA7A5ECDULL},
+        {4999, 0x00710881668D48EBULL},
+    }};
+    const std::vector<u8> input = MakeInput(5000);
+    for (const auto& [size, hash] : expected) {
+        REQUIRE(Common::FastHash64(input.data(), size) == hash);
+    }
+}
+
+TEST_CASE("FastHash64: Unaligned input", "[common]") {
+    const std::vector<u8> input = MakeInput(4096 + 1);
+    std::vector<u8> shifted(input.size() + 1);
+    std::copy(input.begin(), input.end(), shifted.begin() + 1);
+    for (const size_t size : {17, 129, 241, 1024, 4097}) {
+        REQUIRE(Common::FastHash64(input.data(), size) ==
+                Common::FastHash64(shifted.data() + 1, size));
+    }
+}
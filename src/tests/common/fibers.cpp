@@ -11,6 +11,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include <boost/context/detail/fcontext.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/common_types.h"
@@ -310,4 +312,48 @@ TEST_CASE("Fibers::Rewind", "[common]") {
     REQUIRE(test_control.rewinded);
 }
 
+TEST_CASE("Fibers::SwitchLatency", "[common][.benchmark]") {
+    // Round trips between the thread and a fiber, as the kernel does between a guest thread and
+    // the scheduler fiber
+    constexpr u32 num_round_trips = 1'000'000;
+
+    std::shared_ptr<Fiber> thread_fiber = Fiber::ThreadToFiber();
+    std::shared_ptr<Fiber> work_fiber;
+    work_fiber = std::make_shared<Fiber>([&] {
+        while (true) {
+            Fiber::YieldTo(*work_fiber, *thread_fiber);
+        }
+    });
+
+    BENCHMARK("Fiber::YieldTo weak_ptr") {
+        for (u32 i = 0; i < num_round_trips; ++i) {
+            Fiber::YieldTo(thread_fiber, *work_fiber);
+        }
+        return num_round_trips;
+    };
+    BENCHMARK("Fiber::YieldTo reference") {
+        for (u32 i = 0; i < num_round_trips; ++i) {
+            Fiber::YieldTo(*thread_fiber, *work_fiber);
+        }
+        return num_round_trips;
+    };
+    // Bare Boost.Context switches, the previous backend without any of the fiber bookkeeping
+    BENCHMARK("boost::context fcontext") {
+        using namespace boost::context::detail;
+        std::vector<u8> stack(512 * 1024);
+        fcontext_t context = make_fcontext(stack.data() + stack.size(), stack.size(),
+                                           [](transfer_t transfer) {
+                                               while (true) {
+                                                   transfer = jump_fcontext(transfer.fctx, nullptr);
+                                               }
+                                           });
+        for (u32 i = 0; i < num_round_trips; ++i) {
+            context = jump_fcontext(context, nullptr).fctx;
+        }
+        return num_round_trips;
+    };
+
+    thread_fiber->Exit();
+}
+
 } // namespace Common
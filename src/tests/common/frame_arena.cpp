@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/frame_arena.h"
+
+TEST_CASE("FrameArena[Alignment]", "[common]") {
+    Common::FrameArena arena{256};
+    void* const byte = arena.Allocate(1, 1);
+    void* const aligned = arena.Allocate(8, 64);
+    REQUIRE(byte != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(aligned) % 64 == 0);
+    arena.Deallocate();
+    arena.Deallocate();
+    arena.Reset();
+}
+
+TEST_CASE("FrameArena[GrowsToFitFrame]", "[common]") {
+    Common::FrameArena arena{64};
+    for (int frame = 0; frame < 2; ++frame) {
+        Common::FrameVector<u64> values{Common::FrameAllocator<u64>{arena}};
+        for (u64 value = 0; value < 1000; ++value) {
+            values.push_back(value);
+        }
+        for (u64 value = 0; value < 1000; ++value) {
+            REQUIRE(values[value] == value);
+        }
+        values = Common::FrameVector<u64>{Common::FrameAllocator<u64>{arena}};
+        arena.Reset();
+    }
+    // Every reallocation of the vector fits in the arena after the first frame
+    REQUIRE(arena.Capacity() >= 1000 * sizeof(u64));
+}
+
+TEST_CASE("FrameArena[SmallVector]", "[common]") {
+    Common::FrameArena arena;
+    {
+        auto values = Common::MakeFrameSmallVector<u32, 4>(arena);
+        for (u32 value = 0; value < 64; ++value) {
+            values.push_back(value);
+        }
+        REQUIRE(values.size() == 64);
+        REQUIRE(values[63] == 63);
+    }
+    arena.Reset();
+}
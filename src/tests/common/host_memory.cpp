@@ -184,3 +184,18 @@ TEST_CASE("HostMemory: Partial sparse middle unmap and check bindings", "[common
     REQUIRE(ptr[0x0000] == 19);
     REQUIRE(ptr[0x3fff] == 12);
 }
+
+TEST_CASE("HostMemory: Huge pages fall back and keep the backing usable", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE, Common::HugePages::Explicit);
+    if (mem.HasExplicitHugePages()) {
+        REQUIRE(mem.VirtualBasePointer() == nullptr);
+    } else {
+        mem.Map(0x5000, 0x200000, 0x1000, PERMS, HEAP);
+        mem.VirtualBasePointer()[0x5000] = 31;
+        REQUIRE(mem.BackingBasePointer()[0x200000] == 31);
+    }
+    volatile u8* const backing = mem.BackingBasePointer();
+    backing[0x400000] = 7;
+    mem.ClearBackingRegion(0x400000, 0x1000, 0);
+    REQUIRE(backing[0x400000] == 0);
+}
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/logging/deferred_args.h"
+
+namespace {
+using namespace Common::Log;
+
+enum class TestEnum : u32 {
+    Value = 7,
+};
+
+template <typename... Args>
+std::string FormatLater(const char* format, const Args&... args) {
+    DeferredArgs deferred;
+    REQUIRE(Detail::DeferArgs(deferred, args...));
+    return deferred.formatter(format, deferred.data.data());
+}
+} // Anonymous namespace
+
+TEST_CASE("LogDeferredArgs[Format]", "[common]") {
+    REQUIRE(FormatLater("no arguments {{}}") == "no arguments {}");
+    REQUIRE(FormatLater("{} {:08X} {:.2f} {}", 12, u64{0xBEEF}, 1.5, true) ==
+            "12 0000BEEF 1.50 true");
+    REQUIRE(FormatLater("{}", TestEnum::Value) == fmt::format("{}", TestEnum::Value));
+
+    std::string owned = "owned";
+    const std::string_view view = "view";
+    DeferredArgs deferred;
+    REQUIRE(Detail::DeferArgs(deferred, owned, view, "literal", 'c'));
+    // The arguments were copied, the originals can change before the message is formatted
+    owned = "changed";
+    REQUIRE(deferred.formatter("{} {} {} {}", deferred.data.data()) == "owned view literal c");
+}
+
+TEST_CASE("LogDeferredArgs[Fallback]", "[common]") {
+    DeferredArgs deferred;
+    const int value = 0;
+    const char* const pointer = "pointer";
+    REQUIRE(!Detail::DeferArgs(deferred, &value));
+    REQUIRE(!Detail::DeferArgs(deferred, pointer));
+    REQUIRE(!Detail::DeferArgs(deferred, std::string(DeferredArgs::Capacity, 'a')));
+    const size_t longest = DeferredArgs::Capacity - sizeof(size_t);
+    REQUIRE(Detail::DeferArgs(deferred, std::string(longest, 'a')));
+}
@@ -1,11 +1,18 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <random>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/range_map.h"
+#include "common/range_sets.h"
+#include "common/range_sets.inc"
+#include "common/sorted_range_set.h"
 
 enum class MappedEnum : u32 {
     Invalid = 0,
@@ -68,3 +75,130 @@ TEST_CASE("Range Map: Setup", "[video_core]") {
     REQUIRE(my_map.GetValueAt(5999) == MappedEnum::Valid_3);
     REQUIRE(my_map.GetValueAt(6000) == MappedEnum::Invalid);
 }
+
+namespace {
+using Ranges = std::vector<std::pair<u64, u64>>;
+
+template <typename Set>
+Ranges Collect(const Set& set) {
+    Ranges result;
+    set.ForEach([&](u64 begin, u64 end) { result.emplace_back(begin, end); });
+    return result;
+}
+
+template <typename Set>
+Ranges CollectInRange(const Set& set, u64 address, u64 size) {
+    Ranges result;
+    set.ForEachInRange(address, size, [&](u64 begin, u64 end) { result.emplace_back(begin, end); });
+    return result;
+}
+
+struct Write {
+    u64 offset;
+    u64 size;
+};
+
+/// 16 to 256 byte writes scattered over 256 MiB, like games patching constants and descriptors
+std::vector<Write> ScatteredWrites() {
+    static constexpr u64 region_size = 256ULL << 20;
+    std::mt19937_64 rng{4321};
+    std::uniform_int_distribution<u64> offset_dist{0, region_size / 16 - 1};
+    std::uniform_int_distribution<u64> size_dist{1, 16};
+    std::vector<Write> result(8192);
+    for (Write& write : result) {
+        write = {offset_dist(rng) * 16, size_dist(rng) * 16};
+    }
+    return result;
+}
+} // Anonymous namespace
+
+TEST_CASE("SortedRangeSet: Join and split", "[common]") {
+    Common::SortedRangeSet<u64> set;
+    set.Add(1000, 1000);
+    set.Add(3000, 1000);
+    set.Add(2000, 1000);
+    REQUIRE(Collect(set) == Ranges{{1000, 4000}});
+
+    set.Subtract(1500, 100);
+    set.Subtract(3900, 200);
+    REQUIRE(Collect(set) == Ranges{{1000, 1500}, {1600, 3900}});
+    REQUIRE(CollectInRange(set, 1400, 300) == Ranges{{1400, 1500}, {1600, 1700}});
+    REQUIRE(CollectInRange(set, 1500, 100).empty());
+
+    set.Subtract(0, 5000);
+    REQUIRE(set.Empty());
+}
+
+TEST_CASE("SortedRangeSet: Matches RangeSet", "[common]") {
+    std::mt19937_64 rng{1234};
+    Common::RangeSet<u64> reference;
+    Common::SortedRangeSet<u64> set;
+    // Enough ranges to split and merge blocks many times
+    for (int i = 0; i < 20000; ++i) {
+        const u64 address = rng() % (1ULL << 20);
+        const u64 size = rng() % 512;
+        if (rng() % 3 != 0) {
+            reference.Add(address, size);
+            set.Add(address, size);
+        } else {
+            reference.Subtract(address, size);
+            set.Subtract(address, size);
+        }
+        const u64 query = rng() % (1ULL << 20);
+        REQUIRE(CollectInRange(set, query, 4096) == CollectInRange(reference, query, 4096));
+    }
+    REQUIRE(Collect(set) == Collect(reference));
+}
+
+TEST_CASE("SortedRangeSet: Benchmark against RangeSet", "[common][.benchmark]") {
+    static constexpr u64 size = 256ULL << 20;
+    const std::vector<Write> scattered = ScatteredWrites();
+
+    const auto streaming_writes = [&]<typename Set>() {
+        Set ranges;
+        for (u64 offset = 0; offset < size; offset += 64ULL << 10) {
+            ranges.Add(offset % (32ULL << 20), 64ULL << 10);
+        }
+        u64 total = 0;
+        ranges.ForEach([&](u64 begin, u64 end) { total += end - begin; });
+        return total;
+    };
+    const auto scattered_writes = [&]<typename Set>() {
+        Set ranges;
+        for (const Write& write : scattered) {
+            ranges.Add(write.offset, write.size);
+        }
+        u64 total = 0;
+        for (const Write& write : scattered) {
+            ranges.ForEachInRange(write.offset, 4096,
+                                  [&](u64 begin, u64 end) { total += end - begin; });
+        }
+        return total;
+    };
+    const auto scattered_unmaps = [&]<typename Set>() {
+        Set ranges;
+        ranges.Add(0, size);
+        for (const Write& write : scattered) {
+            ranges.Subtract(write.offset, write.size);
+        }
+        return ranges.Empty();
+    };
+    BENCHMARK("RangeSet streaming writes") {
+        return streaming_writes.template operator()<Common::RangeSet<u64>>();
+    };
+    BENCHMARK("SortedRangeSet streaming writes") {
+        return streaming_writes.template operator()<Common::SortedRangeSet<u64>>();
+    };
+    BENCHMARK("RangeSet scattered writes") {
+        return scattered_writes.template operator()<Common::RangeSet<u64>>();
+    };
+    BENCHMARK("SortedRangeSet scattered writes") {
+        return scattered_writes.template operator()<Common::SortedRangeSet<u64>>();
+    };
+    BENCHMARK("RangeSet scattered unmaps") {
+        return scattered_unmaps.template operator()<Common::RangeSet<u64>>();
+    };
+    BENCHMARK("SortedRangeSet scattered unmaps") {
+        return scattered_unmaps.template operator()<Common::SortedRangeSet<u64>>();
+    };
+}
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <atomic>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/seqlock.h"
+
+namespace {
+struct Sample {
+    std::array<u32, 13> values;
+};
+} // Anonymous namespace
+
+TEST_CASE("SeqLock: Reads the last written value", "[common]") {
+    Common::SeqLock<Sample> seqlock;
+    REQUIRE(seqlock.Read().values == std::array<u32, 13>{});
+
+    Sample sample{};
+    sample.values.fill(42);
+    seqlock.Write(sample);
+    REQUIRE(seqlock.Read().values == sample.values);
+}
+
+TEST_CASE("SeqLock: Readers never see a partial write", "[common]") {
+    Common::SeqLock<Sample> seqlock;
+    std::atomic_bool done{};
+    std::jthread writer([&] {
+        Sample sample{};
+        for (u32 i = 1; i <= 100'000; ++i) {
+            sample.values.fill(i);
+            seqlock.Write(sample);
+        }
+        done = true;
+    });
+    u32 last = 0;
+    while (!done) {
+        const Sample sample = seqlock.Read();
+        for (const u32 value : sample.values) {
+            REQUIRE(value == sample.values[0]);
+        }
+        REQUIRE(sample.values[0] >= last);
+        last = sample.values[0];
+    }
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <stop_token>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/task_pool.h"
+#include "common/thread_worker.h"
+
+TEST_CASE("TaskPool[ParallelForEach]", "[common]") {
+    Common::TaskGroup group{Common::TaskPriority::Normal};
+    std::vector<std::atomic<int>> runs(1000);
+    Common::ParallelForEach(group, runs.size(), [&runs](size_t index) { ++runs[index]; });
+    for (const auto& count : runs) {
+        REQUIRE(count == 1);
+    }
+}
+
+TEST_CASE("TaskPool[Serial]", "[common]") {
+    Common::TaskGroup group{Common::TaskPriority::Background, 1};
+    std::vector<int> order;
+    std::atomic<int> running{};
+    bool overlapped = false;
+    for (int task = 0; task < 200; ++task) {
+        group.QueueWork([&, task] {
+            overlapped |= ++running > 1;
+            order.push_back(task);
+            --running;
+        });
+    }
+    group.WaitForRequests();
+    REQUIRE(!overlapped);
+    REQUIRE(order.size() == 200);
+    for (int task = 0; task < 200; ++task) {
+        REQUIRE(order[task] == task);
+    }
+}
+
+TEST_CASE("TaskPool[NestedWait]", "[common]") {
+    // Tasks waiting on other groups run their work, so they can't starve the pool
+    Common::TaskGroup outer{Common::TaskPriority::Normal};
+    std::atomic<size_t> inner_runs{};
+    const size_t num_outer = Common::GetTaskPoolSize() * 2;
+    for (size_t task = 0; task < num_outer; ++task) {
+        outer.QueueWork([&inner_runs] {
+            Common::TaskGroup inner{Common::TaskPriority::LatencyCritical};
+            for (int index = 0; index < 16; ++index) {
+                inner.QueueWork([&inner_runs] { ++inner_runs; });
+            }
+            inner.WaitForRequests();
+        });
+    }
+    outer.WaitForRequests();
+    REQUIRE(inner_runs == num_outer * 16);
+}
+
+TEST_CASE("TaskPool[Stop]", "[common]") {
+    Common::TaskGroup group{Common::TaskPriority::Normal, 1};
+    std::stop_source stop_source;
+    std::atomic<int> runs{};
+    group.QueueWork([&] {
+        ++runs;
+        stop_source.request_stop();
+    });
+    for (int task = 0; task < 100; ++task) {
+        group.QueueWork([&runs] { ++runs; });
+    }
+    group.WaitForRequests(stop_source.get_token());
+    REQUIRE(runs >= 1);
+    REQUIRE(runs < 101);
+}
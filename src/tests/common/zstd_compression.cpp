@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/zstd_compression.h"
+
+using namespace Common::Compression;
+
+namespace {
+std::vector<u8> MakeInput(size_t size) {
+    std::vector<u8> input(size);
+    u32 state = 1;
+    for (size_t i = 0; i < size; ++i) {
+        // Compressible but not trivially, a few distinct symbols in a pseudo random order
+        state = state * 1103515245 + 12345;
+        input[i] = static_cast<u8>((state >> 16) % 16);
+    }
+    return input;
+}
+} // Anonymous namespace
+
+TEST_CASE("ZSTD: Compress into spans", "[common]") {
+    const std::vector<u8> input = MakeInput(100'000);
+    std::vector<u8> compressed(GetCompressBoundZSTD(input.size()));
+    const auto compressed_size = CompressDataZSTD(compressed, input, 3);
+    REQUIRE(compressed_size.has_value());
+    REQUIRE(*compressed_size < input.size());
+    compressed.resize(*compressed_size);
+
+    std::vector<u8> output(input.size());
+    REQUIRE(DecompressDataZSTD(output, compressed) == input.size());
+    REQUIRE(output == input);
+
+    std::vector<u8> small_output(input.size() - 1);
+    REQUIRE(!DecompressDataZSTD(small_output, compressed).has_value());
+}
+
+TEST_CASE("ZSTD: Streaming with small buffers", "[common]") {
+    const std::vector<u8> input = MakeInput(300'000);
+    ZstdEncoder encoder(3);
+    std::vector<u8> compressed;
+    std::vector<u8> chunk(1000);
+    std::span<const u8> remaining = input;
+    while (true) {
+        const size_t piece_size = std::min<size_t>(remaining.size(), 4096);
+        const bool finish = piece_size == remaining.size();
+        std::span<const u8> in = remaining.first(piece_size);
+        std::span<u8> out = chunk;
+        const StreamStatus status = encoder.CompressStream(in, out, finish);
+        REQUIRE(status != StreamStatus::Error);
+        remaining = remaining.subspan(piece_size - in.size());
+        compressed.insert(compressed.end(), chunk.begin(), chunk.end() - out.size());
+        if (finish && status == StreamStatus::Done) {
+            break;
+        }
+    }
+    REQUIRE(remaining.empty());
+
+    ZstdDecoder decoder;
+    std::vector<u8> output;
+    std::span<const u8> in = compressed;
+    StreamStatus status = StreamStatus::Pending;
+    while (status == StreamStatus::Pending) {
+        std::span<u8> out = chunk;
+        status = decoder.DecompressStream(in, out);
+        output.insert(output.end(), chunk.begin(), chunk.end() - out.size());
+    }
+    REQUIRE(status == StreamStatus::Done);
+    REQUIRE(in.empty());
+    REQUIRE(output == input);
+}
+
+TEST_CASE("ZSTD: Dictionary", "[common]") {
+    // Records sharing most of their contents, like pipeline cache entries
+    const std::vector<u8> base = MakeInput(256);
+    std::vector<u8> samples;
+    std::vector<size_t> sample_sizes;
+    for (u32 i = 0; i < 512; ++i) {
+        std::vector<u8> record = base;
+        record[i % record.size()] = static_cast<u8>(i);
+        samples.insert(samples.end(), record.begin(), record.end());
+        sample_sizes.push_back(record.size());
+    }
+    const std::vector<u8> content = ZstdDictionary::Train(samples, sample_sizes, 4096);
+    REQUIRE(!content.empty());
+    const ZstdDictionary dictionary(content, 3);
+    REQUIRE(dictionary.IsValid());
+    REQUIRE(dictionary.Id() != 0);
+
+    const std::span<const u8> record = std::span<const u8>(samples).first(base.size());
+    std::vector<u8> plain(GetCompressBoundZSTD(record.size()));
+    const auto plain_size = CompressDataZSTD(plain, record, 3);
+    REQUIRE(plain_size.has_value());
+
+    ZstdEncoder encoder(3, 0, &dictionary);
+    std::vector<u8> compressed(GetCompressBoundZSTD(record.size()));
+    const auto compressed_size = encoder.Compress(compressed, record);
+    REQUIRE(compressed_size.has_value());
+    REQUIRE(*compressed_size < *plain_size);
+    compressed.resize(*compressed_size);
+
+    ZstdDecoder decoder(&dictionary);
+    std::vector<u8> output(record.size());
+    REQUIRE(decoder.Decompress(output, compressed) == record.size());
+    REQUIRE(std::ranges::equal(output, record));
+
+    // Frames compressed with a dictionary can't be decoded without it
+    ZstdDecoder plain_decoder;
+    REQUIRE(!plain_decoder.Decompress(output, compressed).has_value());
+
+    REQUIRE(!ZstdDictionary(std::vector<u8>(64), 3).IsValid());
+}
+
+TEST_CASE("ZSTD: Multithreaded compression", "[common]") {
+    const std::vector<u8> input = MakeInput(4'000'000);
+    ZstdEncoder encoder(3, 2);
+    std::vector<u8> compressed(GetCompressBoundZSTD(input.size()));
+    const auto compressed_size = encoder.Compress(compressed, input);
+    REQUIRE(compressed_size.has_value());
+    compressed.resize(*compressed_size);
+
+    std::vector<u8> output(input.size());
+    REQUIRE(DecompressDataZSTD(output, compressed) == input.size());
+    REQUIRE(output == input);
+}
@@ -1,18 +1,27 @@
 // SPDX-FileCopyrightText: 2016 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
 #include <bitset>
 #include <chrono>
 #include <cstdlib>
+#include <iterator>
 #include <memory>
 #include <optional>
+#include <random>
+#include <set>
 #include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/heap/fibonacci_heap.hpp>
 
 #include "core/core.h"
 #include "core/core_timing.h"
+#include "core/timing_wheel.h"
 
 namespace {
 // Numbers are chosen randomly to make sure the correct one is given.
@@ -50,6 +59,26 @@ u64 TestTimerSpeed(Core::Timing::CoreTiming& core_timing) {
     return end - start;
 }
 
+/// Periods of the looping events rescheduled every frame, audio, input, vsync and timers
+constexpr std::array<s64, 6> loop_periods{
+    1'000'000, 4'000'000, 5'000'000, 8'333'333, 16'666'666, 33'333'333,
+};
+
+struct HeapEvent {
+    s64 time;
+    u64 fifo_order;
+    s64 period;
+    size_t index;
+
+    friend bool operator>(const HeapEvent& left, const HeapEvent& right) {
+        return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
+    }
+};
+
+struct WheelEvent : Core::Timing::TimingWheelNode {
+    s64 period{};
+};
+
 } // Anonymous namespace
 
 TEST_CASE("CoreTiming[BasicOrder]", "[core]") {
@@ -139,3 +168,137 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[SingleCoreSlices]", "[core]") {
+    Core::Timing::CoreTiming core_timing;
+    core_timing.SetMulticore(false);
+    core_timing.Initialize([]() {});
+
+    core_timing.ResetTicks();
+    const s64 default_slice = core_timing.GetDowncount();
+    core_timing.ResetTicks(8);
+    REQUIRE(core_timing.GetDowncount() == default_slice * 8);
+
+    // Longer slices stop at the next event, but never get shorter than the default one
+    const auto event = Core::Timing::CreateEvent("callback", HostCallbackTemplate<0>);
+    core_timing.ScheduleEvent(std::chrono::microseconds{20}, event);
+    core_timing.ResetTicks(8);
+    const s64 capped_slice = core_timing.GetDowncount();
+    REQUIRE(capped_slice > default_slice);
+    REQUIRE(capped_slice < default_slice * 8);
+
+    core_timing.UnscheduleEvent(event);
+    core_timing.ScheduleEvent(std::chrono::microseconds{1}, event);
+    core_timing.ResetTicks(8);
+    REQUIRE(core_timing.GetDowncount() == default_slice);
+    core_timing.UnscheduleEvent(event);
+}
+
+TEST_CASE("TimingWheel[Order]", "[core]") {
+    using Core::Timing::TimingWheel;
+    using Core::Timing::TimingWheelNode;
+
+    std::mt19937_64 rng{1234};
+    std::vector<TimingWheelNode> nodes(4096);
+    std::set<std::tuple<s64, u64, TimingWheelNode*>> expected;
+    TimingWheel wheel;
+    s64 now = 0;
+    u64 fifo_order = 0;
+    size_t num_used = 0;
+    for (size_t step = 0; step < 50000; ++step) {
+        const u64 action = rng() % 8;
+        if (action < 3 && num_used < nodes.size()) {
+            // Mostly near events, some far in the future and some already expired
+            const s64 range = rng() % 4 == 0 ? s64{1} << (rng() % 40) : 5000;
+            TimingWheelNode* const node = &nodes[num_used++];
+            node->time = now + static_cast<s64>(rng() % range) - 100;
+            node->fifo_order = fifo_order++;
+            wheel.Insert(node);
+            expected.emplace(node->time, node->fifo_order, node);
+        } else if (action < 4 && !expected.empty()) {
+            auto it = expected.begin();
+            std::advance(it, rng() % expected.size());
+            wheel.Remove(std::get<2>(*it));
+            expected.erase(it);
+        } else {
+            now += static_cast<s64>(rng() % (rng() % 8 == 0 ? u64{1} << (rng() % 36) : 3000));
+            const std::optional<s64> next_time = wheel.NextTime();
+            REQUIRE(next_time.has_value() == !expected.empty());
+            if (next_time) {
+                REQUIRE(*next_time <= std::get<0>(*expected.begin()));
+            }
+            while (TimingWheelNode* const node = wheel.PopExpired(now)) {
+                REQUIRE(!expected.empty());
+                REQUIRE(std::get<2>(*expected.begin()) == node);
+                expected.erase(expected.begin());
+            }
+            REQUIRE((expected.empty() || std::get<0>(*expected.begin()) > now));
+        }
+        REQUIRE(wheel.Size() == expected.size());
+    }
+}
+
+TEST_CASE("TimingWheel[Benchmark]", "[core][.benchmark]") {
+    using Core::Timing::TimingWheel;
+    using Heap = boost::heap::fibonacci_heap<HeapEvent, boost::heap::compare<std::greater<>>>;
+
+    // One second of emulated time advanced in 100us steps, like the timer thread under load
+    constexpr s64 STEP = 100'000;
+    constexpr s64 DURATION = 1'000'000'000;
+
+    for (const size_t num_events : {64U, 512U, 4096U}) {
+        const auto name = [&](const char* kind) {
+            return std::string{kind} + " events=" + std::to_string(num_events);
+        };
+        BENCHMARK(name("fibonacci_heap")) {
+            Heap heap;
+            std::vector<Heap::handle_type> handles;
+            u64 fifo_order = 0;
+            for (size_t i = 0; i < num_events; ++i) {
+                const s64 period = loop_periods[i % loop_periods.size()];
+                handles.push_back(heap.emplace(HeapEvent{period, fifo_order++, period, i}));
+            }
+            u64 fired = 0;
+            for (s64 now = 0; now < DURATION; now += STEP) {
+                while (!heap.empty() && heap.top().time <= now) {
+                    const HeapEvent top = heap.top();
+                    heap.update(handles[top.index], HeapEvent{top.time + top.period, fifo_order++,
+                                                              top.period, top.index});
+                    ++fired;
+                }
+                // A timer is cancelled and programmed again, as guest timers do
+                const size_t index = static_cast<size_t>(now / STEP) % num_events;
+                const s64 period = (*handles[index]).period;
+                heap.erase(handles[index]);
+                handles[index] = heap.emplace(HeapEvent{now + period, fifo_order++, period, index});
+            }
+            return fired;
+        };
+        BENCHMARK(name("TimingWheel")) {
+            TimingWheel wheel;
+            std::vector<WheelEvent> events(num_events);
+            u64 fifo_order = 0;
+            for (size_t i = 0; i < num_events; ++i) {
+                events[i].period = loop_periods[i % loop_periods.size()];
+                events[i].time = events[i].period;
+                events[i].fifo_order = fifo_order++;
+                wheel.Insert(&events[i]);
+            }
+            u64 fired = 0;
+            for (s64 now = 0; now < DURATION; now += STEP) {
+                while (auto* const evt = static_cast<WheelEvent*>(wheel.PopExpired(now))) {
+                    evt->time += evt->period;
+                    evt->fifo_order = fifo_order++;
+                    wheel.Insert(evt);
+                    ++fired;
+                }
+                WheelEvent& evt = events[static_cast<size_t>(now / STEP) % num_events];
+                wheel.Remove(&evt);
+                evt.time = now + evt.period;
+                evt.fifo_order = fifo_order++;
+                wheel.Insert(&evt);
+            }
+            return fired;
+        };
+    }
+}
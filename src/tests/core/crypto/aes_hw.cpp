@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "common/common_types.h"
+#include "core/crypto/aes_hw.h"
+
+namespace Core::Crypto::AesHw {
+namespace {
+using Block = std::array<u8, 16>;
+
+Block Filled(u8 value) {
+    Block block;
+    block.fill(value);
+    return block;
+}
+} // Anonymous namespace
+
+TEST_CASE("AesHw: CTR matches SP 800-38A", "[core][crypto]") {
+    if (!IsSupported()) {
+        return;
+    }
+    constexpr Block key{0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                        0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+    constexpr Block counter{0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+                            0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff};
+    // First two blocks of F.5.1, the second one cut short to test partial blocks
+    constexpr std::array<u8, 20> plaintext{0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f,
+                                           0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93,
+                                           0x17, 0x2a, 0xae, 0x2d, 0x8a, 0x57};
+    constexpr std::array<u8, 20> ciphertext{0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3,
+                                            0x26, 0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d,
+                                            0xb6, 0xce, 0x98, 0x06, 0xf6, 0x6b};
+    KeySchedule schedule;
+    ExpandKey(schedule, key.data());
+
+    std::array<u8, 20> out{};
+    CtrTranscode(schedule, counter, plaintext.data(), out.data(), out.size());
+    REQUIRE(out == ciphertext);
+
+    // The key stream of every block only depends on its counter
+    std::vector<u8> zeros(16 * 19 + 4);
+    std::vector<u8> whole(zeros.size());
+    std::vector<u8> split(zeros.size());
+    CtrTranscode(schedule, counter, zeros.data(), whole.data(), whole.size());
+    CtrTranscode(schedule, counter, zeros.data(), split.data(), 16 * 3);
+    CtrTranscode(schedule, AddToCounter(counter, 3), zeros.data() + 16 * 3,
+                 split.data() + 16 * 3, split.size() - 16 * 3);
+    REQUIRE(whole == split);
+}
+
+TEST_CASE("AesHw: XTS matches IEEE 1619", "[core][crypto]") {
+    if (!IsSupported()) {
+        return;
+    }
+    KeySchedule data_key;
+    KeySchedule tweak_key;
+    Block tweak{};
+    std::array<u8, 32> out{};
+
+    // Vector 1
+    const Block zero_key = Filled(0);
+    ExpandKey(data_key, zero_key.data());
+    ExpandKey(tweak_key, zero_key.data());
+    const std::array<u8, 32> zeros{};
+    XtsTranscode(data_key, tweak_key, tweak, zeros.data(), out.data(), out.size(), false);
+    constexpr std::array<u8, 32> vector1{
+        0x91, 0x7c, 0xf6, 0x9e, 0xbd, 0x68, 0xb2, 0xec, 0x9b, 0x9f, 0xe9,
+        0xa3, 0xea, 0xdd, 0xa6, 0x92, 0xcd, 0x43, 0xd2, 0xf5, 0x95, 0x98,
+        0xed, 0x85, 0x8c, 0x02, 0xc2, 0x65, 0x2f, 0xbf, 0x92, 0x2e};
+    REQUIRE(out == vector1);
+
+    // Vector 2
+    const Block key1 = Filled(0x11);
+    const Block key2 = Filled(0x22);
+    ExpandKey(data_key, key1.data());
+    ExpandKey(tweak_key, key2.data());
+    tweak = {0x33, 0x33, 0x33, 0x33, 0x33};
+    std::array<u8, 32> plaintext;
+    plaintext.fill(0x44);
+    XtsTranscode(data_key, tweak_key, tweak, plaintext.data(), out.data(), out.size(), false);
+    constexpr std::array<u8, 32> vector2{
+        0xc4, 0x54, 0x18, 0x5e, 0x6a, 0x16, 0x93, 0x6e, 0x39, 0x33, 0x40,
+        0x38, 0xac, 0xef, 0x83, 0x8b, 0xfb, 0x18, 0x6f, 0xff, 0x74, 0x80,
+        0xad, 0xc4, 0x28, 0x93, 0x82, 0xec, 0xd6, 0xd3, 0x94, 0xf0};
+    REQUIRE(out == vector2);
+
+    // Long enough for the multi block path
+    std::vector<u8> data(16 * 37);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<u8>(i * 7);
+    }
+    std::vector<u8> encrypted(data.size());
+    std::vector<u8> decrypted(data.size());
+    XtsTranscode(data_key, tweak_key, tweak, data.data(), encrypted.data(), data.size(), false);
+    XtsTranscode(data_key, tweak_key, tweak, encrypted.data(), decrypted.data(), data.size(),
+                 true);
+    REQUIRE(encrypted != data);
+    REQUIRE(decrypted == data);
+}
+
+} // namespace Core::Crypto::AesHw
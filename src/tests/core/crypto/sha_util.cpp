@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "common/common_types.h"
+#include "common/hex_util.h"
+#include "core/crypto/sha_util.h"
+
+namespace Core::Crypto {
+namespace {
+std::span<const u8> AsBytes(std::string_view string) {
+    return {reinterpret_cast<const u8*>(string.data()), string.size()};
+}
+
+SHA256Hash Hash(std::string_view hex) {
+    return Common::HexStringToArray<0x20>(hex);
+}
+} // Anonymous namespace
+
+TEST_CASE("Sha256: Matches FIPS 180-2 vectors", "[core][crypto]") {
+    REQUIRE(CalculateSha256({}) ==
+            Hash("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"));
+    REQUIRE(CalculateSha256(AsBytes("abc")) ==
+            Hash("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+    REQUIRE(CalculateSha256(
+                AsBytes("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq")) ==
+            Hash("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"));
+}
+
+TEST_CASE("Sha256: Streaming matches one shot", "[core][crypto]") {
+    const std::vector<u8> data(1'000'000, 'a');
+    constexpr auto expected =
+        "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0";
+
+    // Odd sizes keep the buffered and direct paths both busy
+    Sha256 sha;
+    for (size_t offset = 0; offset < data.size();) {
+        const size_t size = std::min<size_t>(offset % 97 + 1, data.size() - offset);
+        sha.Update(std::span(data).subspan(offset, size));
+        offset += size;
+    }
+    REQUIRE(sha.Finish() == Hash(expected));
+    REQUIRE(CalculateSha256(data) == Hash(expected));
+}
+
+} // namespace Core::Crypto
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/frame_time_histogram.h"
+
+using namespace std::chrono_literals;
+
+TEST_CASE("FrameTimeHistogram[Percentiles]", "[core]") {
+    Core::FrameTimeHistogram histogram;
+    REQUIRE(histogram.Percentile(99.0) == 0ns);
+
+    // 990 frames at 16.6 ms, 9 at 33.3 ms and a single 250 ms hitch
+    for (int frame = 0; frame < 990; ++frame) {
+        histogram.Add(16'600us);
+    }
+    for (int frame = 0; frame < 9; ++frame) {
+        histogram.Add(33'300us);
+    }
+    histogram.Add(250ms);
+
+    REQUIRE(histogram.Count() == 1000);
+    REQUIRE(histogram.Max() == 250ms);
+    REQUIRE(histogram.Percentile(50.0) == 16'700us);
+    REQUIRE(histogram.Percentile(99.0) == 16'700us);
+    REQUIRE(histogram.Percentile(99.5) == 33'400us);
+    // The hitch is past the last bucket, it reports the longest frame
+    REQUIRE(histogram.Percentile(100.0) == 250ms);
+    REQUIRE(histogram.BucketCount(166) == 990);
+    REQUIRE(histogram.BucketCount(Core::FrameTimeHistogram::NumBuckets) == 1);
+
+    histogram.Reset();
+    REQUIRE(histogram.Count() == 0);
+    REQUIRE(histogram.Percentile(50.0) == 0ns);
+}
+
+TEST_CASE("FrameTimeHistogram[ClampToMax]", "[core]") {
+    Core::FrameTimeHistogram histogram;
+    histogram.Add(5'050us);
+    histogram.Add(5'020us);
+    REQUIRE(histogram.Percentile(100.0) == 5'050us);
+    REQUIRE(histogram.Percentile(0.0) == 5'050us);
+}
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/guest_memory.h"
+
+namespace {
+using Core::Memory::GuestMemoryFlags;
+
+/// Memory split in two halves, contiguous within each half only
+class FakeMemory {
+public:
+    static constexpr u64 HALF = 0x1000;
+
+    u8* GetSpan(u64 addr, std::size_t size) {
+        if (addr / HALF != (addr + size - 1) / HALF) {
+            return nullptr;
+        }
+        return data.data() + addr;
+    }
+
+    bool ReadBlock(u64 addr, void* dest, std::size_t size) {
+        std::memcpy(dest, data.data() + addr, size);
+        return true;
+    }
+
+    bool WriteBlock(u64 addr, const void* src, std::size_t size) {
+        std::memcpy(data.data() + addr, src, size);
+        ++num_writes;
+        return true;
+    }
+
+    void FlushRegion(u64 addr, std::size_t size) {}
+
+    void InvalidateRegion(u64 addr, std::size_t size) {
+        ++num_invalidations;
+    }
+
+    std::array<u8, HALF * 2> data{};
+    int num_writes{};
+    int num_invalidations{};
+};
+
+using ScopedWrite = Core::Memory::GuestMemoryScoped<FakeMemory, u8, GuestMemoryFlags::SafeWrite>;
+} // Anonymous namespace
+
+TEST_CASE("GuestMemory: Contiguous writes are made in place", "[core]") {
+    FakeMemory memory;
+    {
+        ScopedWrite span(memory, 0x100, 0x10);
+        REQUIRE(!span.IsDataCopy());
+        REQUIRE(span.data() == memory.data.data() + 0x100);
+        span[3] = 42;
+    }
+    REQUIRE(memory.data[0x103] == 42);
+    REQUIRE(memory.num_writes == 0);
+    REQUIRE(memory.num_invalidations == 1);
+}
+
+TEST_CASE("GuestMemory: Discontiguous writes keep untouched bytes", "[core]") {
+    FakeMemory memory;
+    memory.data[FakeMemory::HALF] = 7;
+    Common::ScratchBuffer<u8> backup;
+    {
+        ScopedWrite span(memory, FakeMemory::HALF - 4, 8, &backup);
+        REQUIRE(span.IsDataCopy());
+        span[0] = 1;
+    }
+    REQUIRE(memory.data[FakeMemory::HALF - 4] == 1);
+    REQUIRE(memory.data[FakeMemory::HALF] == 7);
+    REQUIRE(memory.num_writes == 1);
+}
+
+TEST_CASE("GuestMemory: Moved scopes commit once", "[core]") {
+    FakeMemory memory;
+    {
+        ScopedWrite span(memory, FakeMemory::HALF - 4, 8);
+        ScopedWrite moved(std::move(span));
+        moved[0] = 5;
+    }
+    REQUIRE(memory.data[FakeMemory::HALF - 4] == 5);
+    REQUIRE(memory.num_writes == 1);
+}
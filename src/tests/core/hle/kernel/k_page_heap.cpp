@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/hle/kernel/k_page_heap.h"
+
+namespace {
+using Run = std::pair<u64, size_t>;
+
+constexpr u64 HeapAddress = 0x80000000;
+constexpr size_t HeapSize = 16 * 1024 * 1024;
+// Management regions are in the kernel half of the address space, above any host pointer
+constexpr u64 ManagementAddress = 0xFFFFFF8000000000;
+
+/// Creates a heap with free pages interleaved with holes, so the smallest blocks come in short runs
+std::unique_ptr<Kernel::KPageHeap> MakeFragmentedHeap() {
+    auto heap = std::make_unique<Kernel::KPageHeap>();
+    heap->Initialize(HeapAddress, HeapSize, ManagementAddress,
+                     Kernel::KPageHeap::CalculateManagementOverheadSize(HeapSize));
+    for (size_t page = 0; page < 256; ++page) {
+        if (page % 7 != 3 && page % 29 != 0) {
+            heap->Free(HeapAddress + page * Kernel::PageSize, 1);
+        }
+    }
+    heap->Free(HeapAddress + 256 * Kernel::PageSize, 768);
+    return heap;
+}
+
+void AddRun(std::vector<Run>& runs, u64 address, size_t num_pages) {
+    if (!runs.empty() && runs.back().first + runs.back().second * Kernel::PageSize == address) {
+        runs.back().second += num_pages;
+    } else {
+        runs.emplace_back(address, num_pages);
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("KPageHeap[AllocateBlocks]", "[core][kernel]") {
+    constexpr size_t NumPages = 600;
+    const auto single = MakeFragmentedHeap();
+    const auto bulk = MakeFragmentedHeap();
+
+    std::vector<Run> expected;
+    for (size_t page = 0; page < NumPages; ++page) {
+        const Kernel::KPhysicalAddress block = single->AllocateBlock(0, false);
+        REQUIRE(block != 0);
+        AddRun(expected, GetInteger(block), 1);
+    }
+
+    std::vector<Run> runs;
+    size_t calls = 0;
+    for (size_t remaining = NumPages; remaining > 0; ++calls) {
+        size_t num_blocks = 0;
+        const Kernel::KPhysicalAddress block = bulk->AllocateBlocks(0, remaining, &num_blocks);
+        REQUIRE(block != 0);
+        REQUIRE(num_blocks <= remaining);
+        AddRun(runs, GetInteger(block), num_blocks);
+        remaining -= num_blocks;
+    }
+
+    REQUIRE(runs == expected);
+    REQUIRE(calls < NumPages);
+    REQUIRE(bulk->GetFreeSize() == single->GetFreeSize());
+}
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/hle/kernel/k_slab_heap.h"
+
+namespace {
+using Heap = Kernel::KSlabHeapBase<false>;
+
+constexpr size_t ObjectSize = 32;
+constexpr size_t NumObjects = 100;
+
+size_t AllocateAll(Heap& heap, size_t core_id, std::vector<void*>& objects) {
+    size_t count = 0;
+    while (void* const obj = heap.Allocate(core_id)) {
+        objects.push_back(obj);
+        ++count;
+    }
+    return count;
+}
+} // Anonymous namespace
+
+TEST_CASE("KSlabHeap[CoreCaches]", "[core][kernel]") {
+    alignas(u64) std::array<u8, ObjectSize * NumObjects> memory{};
+    Heap heap;
+    heap.Initialize(ObjectSize, memory.data(), memory.size());
+
+    // Leave objects behind in the caches of other cores, one core must still get all of them
+    heap.Free(heap.Allocate(1), 1);
+    heap.Free(heap.Allocate(2), 2);
+
+    std::vector<void*> objects;
+    REQUIRE(AllocateAll(heap, 0, objects) == NumObjects);
+    std::ranges::sort(objects);
+    REQUIRE(std::ranges::adjacent_find(objects) == objects.end());
+
+    // Freeing everything to a single core spills its cache to the shared list
+    for (void* const obj : objects) {
+        heap.Free(obj, 3);
+    }
+    objects.clear();
+    REQUIRE(AllocateAll(heap, 1, objects) == NumObjects);
+}
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/perf_profile.h"
+
+namespace {
+using Values = std::vector<std::pair<std::string, std::string>>;
+
+Core::PerfProfileMetrics Metrics(double fps, double speed) {
+    return Core::PerfProfileMetrics{
+        .average_game_fps = fps,
+        .emulation_speed = speed,
+        .frametime = 0.010,
+        .low_1_percent = 0.020,
+        .stutters = 0,
+        .num_samples = 10,
+    };
+}
+
+std::vector<Core::PerfProfileDimension> Dimensions() {
+    return {
+        {.label = "shaders", .current = "0", .values = {"0", "1"}, .lowers_quality = false},
+        {.label = "scale", .current = "2", .values = {"1", "0"}, .lowers_quality = true},
+    };
+}
+} // Anonymous namespace
+
+TEST_CASE("PerfProfileTuner: Keeps the fastest values", "[core]") {
+    Core::PerfProfileTuner tuner{Dimensions()};
+
+    std::optional<Core::PerfProfile> profile = tuner.Next();
+    REQUIRE(profile);
+    REQUIRE(profile->values.empty());
+    tuner.Report(Metrics(20.0, 0.7));
+
+    // The current value of a dimension is not benchmarked again
+    profile = tuner.Next();
+    REQUIRE(profile);
+    REQUIRE(profile->values == Values{{"shaders", "1"}});
+    tuner.Report(Metrics(25.0, 0.8));
+
+    profile = tuner.Next();
+    REQUIRE(profile);
+    REQUIRE(profile->values == Values{{"shaders", "1"}, {"scale", "1"}});
+    // Within the noise of a run, not an improvement
+    tuner.Report(Metrics(25.2, 0.8));
+
+    profile = tuner.Next();
+    REQUIRE(profile);
+    REQUIRE(profile->values == Values{{"shaders", "1"}, {"scale", "0"}});
+    tuner.Report(Metrics(24.0, 0.75));
+
+    REQUIRE(!tuner.Next());
+    REQUIRE(tuner.Best().values == Values{{"shaders", "1"}});
+    REQUIRE(tuner.BestMetrics()->average_game_fps == 25.0);
+}
+
+TEST_CASE("PerfProfileTuner: Keeps the quality at full speed", "[core]") {
+    Core::PerfProfileTuner tuner{Dimensions()};
+    REQUIRE(tuner.Next());
+    tuner.Report(Metrics(30.0, 1.0));
+
+    const std::optional<Core::PerfProfile> profile = tuner.Next();
+    REQUIRE(profile);
+    REQUIRE(profile->values == Values{{"shaders", "1"}});
+    tuner.Report(Metrics(30.0, 1.0));
+
+    REQUIRE(!tuner.Next());
+    REQUIRE(tuner.Best().values.empty());
+}
+
+TEST_CASE("PerfProfileTuner: Frame pacing breaks ties", "[core]") {
+    Core::PerfProfileMetrics smooth = Metrics(30.0, 1.0);
+    smooth.low_1_percent = 0.034;
+    Core::PerfProfileMetrics stuttery = Metrics(30.1, 1.0);
+    stuttery.low_1_percent = 0.050;
+    REQUIRE(Core::IsFasterProfile(smooth, stuttery));
+    REQUIRE(!Core::IsFasterProfile(stuttery, smooth));
+    REQUIRE(Core::IsFasterProfile(Metrics(40.0, 1.0), smooth));
+}
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "shader_recompiler/arena.h"
+
+TEST_CASE("Arena: Aligned allocations", "[shader_recompiler]") {
+    Shader::Arena arena(256);
+    for (size_t alignment = 1; alignment <= 64; alignment *= 2) {
+        void* const pointer{arena.allocate(24, alignment)};
+        REQUIRE(reinterpret_cast<uintptr_t>(pointer) % alignment == 0);
+    }
+    // Larger than a block, forces a dedicated one
+    REQUIRE(arena.allocate(1024, 16) != nullptr);
+}
+
+TEST_CASE("Arena: Reset records peaks", "[shader_recompiler]") {
+    Shader::Arena arena(256);
+    for (int i = 0; i < 16; ++i) {
+        (void)arena.allocate(64, 8);
+    }
+    REQUIRE(arena.BytesUsed() == 16 * 64);
+    arena.Reset();
+    REQUIRE(arena.BytesUsed() == 0);
+    REQUIRE(arena.LastPeakBytes() == 16 * 64);
+
+    (void)arena.allocate(64, 8);
+    arena.Reset();
+    REQUIRE(arena.LastPeakBytes() == 64);
+    REQUIRE(arena.MaxPeakBytes() == 16 * 64);
+}
+
+TEST_CASE("ArenaScope: Outermost scope resets the thread arena", "[shader_recompiler]") {
+    Shader::Arena& arena{Shader::ThreadArena()};
+    {
+        const Shader::ArenaScope outer;
+        {
+            const Shader::ArenaScope inner;
+            std::pmr::vector<int> values(&arena);
+            values.resize(100);
+        }
+        REQUIRE(arena.BytesUsed() != 0);
+    }
+    REQUIRE(arena.BytesUsed() == 0);
+    REQUIRE(arena.LastPeakBytes() >= 100 * sizeof(int));
+}
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/div_ceil.h"
+#include "video_core/textures/astc.h"
+
+namespace {
+using Tegra::Texture::ASTC::Decompress;
+
+using Block = std::array<u8, 16>;
+
+std::span<u8> AsBytes(std::vector<u32>& texels) {
+    return {reinterpret_cast<u8*>(texels.data()), texels.size() * sizeof(u32)};
+}
+
+/// Void extent block with every bit after the block mode set, decoding to opaque white
+Block MakeWhiteVoidExtentBlock() {
+    Block block;
+    block.fill(0xff);
+    // Block mode 0x1fc with the HDR bit clear
+    block[0] = 0xfc;
+    block[1] = static_cast<u8>((block[1] & ~0x03) | 0x01);
+    return block;
+}
+
+std::vector<u32> DecodeBlock(const Block& block, u32 block_width, u32 block_height) {
+    std::vector<u32> texels(block_width * block_height);
+    Decompress(block, block_width, block_height, 1, block_width, block_height, AsBytes(texels));
+    return texels;
+}
+
+/// Random single partition LDR blocks with a 4x4 weight grid, random data is rarely valid ASTC
+std::vector<Block> MakeBlocks(size_t count) {
+    static constexpr std::array<u32, 10> LDR_MODES{0, 1, 4, 5, 6, 8, 9, 10, 12, 13};
+    u32 state = 0x12345678;
+    const auto next = [&state] {
+        state = state * 1664525 + 1013904223;
+        return state >> 8;
+    };
+    std::vector<Block> blocks(count);
+    for (Block& block : blocks) {
+        for (u8& value : block) {
+            value = static_cast<u8>(next());
+        }
+        const u32 range = 2 + next() % 6;
+        const u32 mode = LDR_MODES[next() % LDR_MODES.size()];
+        // Block mode with the range in bits 0, 1 and 4, and the grid height minus two in bits 5
+        // and 6. Followed by the number of partitions minus one and the color endpoint mode.
+        const u32 header = (range >> 1) | ((range & 1) << 4) | (2 << 5) | (mode << 13);
+        block[0] = static_cast<u8>(header);
+        block[1] = static_cast<u8>(header >> 8);
+        block[2] = static_cast<u8>((block[2] & ~1) | (header >> 16));
+    }
+    return blocks;
+}
+
+std::vector<u8> MakeImage(u32 width, u32 height, u32 block_width, u32 block_height) {
+    const size_t num_blocks = static_cast<size_t>(Common::DivCeil(width, block_width)) *
+                              Common::DivCeil(height, block_height);
+    const std::vector<Block> blocks = MakeBlocks(std::min<size_t>(num_blocks, 1024));
+    std::vector<u8> data(num_blocks * sizeof(Block));
+    for (size_t i = 0; i < num_blocks; ++i) {
+        std::memcpy(&data[i * sizeof(Block)], blocks[i % blocks.size()].data(), sizeof(Block));
+    }
+    return data;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("ASTC[VoidExtent]", "[video_core]") {
+    for (const u32 block_size : {4U, 6U, 8U}) {
+        const std::vector<u32> white =
+            DecodeBlock(MakeWhiteVoidExtentBlock(), block_size, block_size);
+        REQUIRE(std::ranges::all_of(white, [](u32 texel) { return texel == 0xffffffff; }));
+    }
+}
+
+TEST_CASE("ASTC[Tiles]", "[video_core]") {
+    // Wide enough to be split across several tiles, with partial blocks at the edges
+    static constexpr u32 width = 1030;
+    static constexpr u32 height = 70;
+    for (const auto& [block_width, block_height] : {std::pair{4U, 4U}, {6U, 6U}, {8U, 5U}}) {
+        const u32 cols = Common::DivCeil(width, block_width);
+        const std::vector<u8> data = MakeImage(width, height, block_width, block_height);
+        std::vector<u32> image(width * height);
+        Decompress(data, width, height, 1, block_width, block_height, AsBytes(image));
+
+        for (u32 y = 0; y < height; y += block_height) {
+            for (u32 x = 0; x < width; x += block_width) {
+                const size_t block_index = (y / block_height) * cols + x / block_width;
+                Block block;
+                std::memcpy(block.data(), &data[block_index * sizeof(Block)], sizeof(Block));
+                const std::vector<u32> texels = DecodeBlock(block, block_width, block_height);
+                for (u32 j = 0; j < std::min(block_height, height - y); ++j) {
+                    for (u32 i = 0; i < std::min(block_width, width - x); ++i) {
+                        REQUIRE(image[(y + j) * width + x + i] == texels[j * block_width + i]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("ASTC[Benchmark]", "[video_core][.benchmark]") {
+    static constexpr u32 width = 1024;
+    static constexpr u32 height = 1024;
+    for (const u32 block_size : {4U, 6U, 8U}) {
+        const std::vector<u8> data = MakeImage(width, height, block_size, block_size);
+        std::vector<u8> output(width * height * 4);
+        BENCHMARK("Decompress " + std::to_string(block_size) + "x" + std::to_string(block_size)) {
+            Decompress(data, width, height, 1, block_size, block_size, output);
+            return output[0];
+        };
+    }
+}
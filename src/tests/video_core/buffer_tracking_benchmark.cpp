@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/range_sets.h"
+#include "common/range_sets.inc"
+#include "video_core/buffer_cache/memory_tracker_base.h"
+#include "video_core/buffer_cache/word_manager.h"
+
+namespace {
+constexpr u64 PAGE = 4096;
+constexpr u64 HIGH_PAGE_SIZE = 1ULL << 22;
+
+constexpr VAddr BASE = 16 * HIGH_PAGE_SIZE;
+
+/// Only counts notifications, so the rasterizer bookkeeping does not dominate the timings
+class RasterizerInterface {
+public:
+    void UpdatePagesCachedCount(VAddr, u64 size, int delta) {
+        cached_bytes += static_cast<s64>(size) * delta;
+    }
+
+    s64 cached_bytes = 0;
+};
+
+struct Write {
+    u64 offset;
+    u64 size;
+};
+
+/// Sequential 64 KiB uploads wrapping around a 32 MiB ring, like streamed vertex and uniform data
+std::vector<Write> StreamingWrites() {
+    static constexpr u64 ring_size = 32ULL << 20;
+    static constexpr u64 chunk = 64ULL << 10;
+    std::vector<Write> result;
+    for (u64 offset = 0; offset < ring_size * 2; offset += chunk) {
+        result.push_back({offset % ring_size, chunk});
+    }
+    return result;
+}
+
+/// 16 to 256 byte writes scattered over 256 MiB, like games patching constants and descriptors
+std::vector<Write> ScatteredWrites() {
+    static constexpr u64 region_size = 256ULL << 20;
+    std::mt19937_64 rng{4321};
+    std::uniform_int_distribution<u64> offset_dist{0, region_size / 16 - 1};
+    std::uniform_int_distribution<u64> size_dist{1, 16};
+    std::vector<Write> result(8192);
+    for (Write& write : result) {
+        write = {offset_dist(rng) * 16, size_dist(rng) * 16};
+    }
+    return result;
+}
+
+/// Unmaps of 1 to 64 MiB, like games releasing and remapping their heaps between scenes
+std::vector<Write> LargeUnmaps() {
+    static constexpr u64 region_size = 256ULL << 20;
+    std::mt19937_64 rng{8765};
+    std::uniform_int_distribution<u64> size_shift_dist{20, 26};
+    std::vector<Write> result(64);
+    for (Write& write : result) {
+        const u64 size = 1ULL << size_shift_dist(rng);
+        std::uniform_int_distribution<u64> offset_dist{0, (region_size - size) / PAGE};
+        write = {offset_dist(rng) * PAGE, size};
+    }
+    return result;
+}
+} // Anonymous namespace
+
+using MemoryTracker = VideoCommon::MemoryTrackerBase<RasterizerInterface>;
+using WordManager = VideoCommon::WordManager<RasterizerInterface>;
+
+TEST_CASE("MemoryTracker: Benchmark game access patterns", "[video_core][.benchmark]") {
+    static constexpr u64 size = 256ULL << 20;
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    memory_track->UnmarkRegionAsCpuModified(BASE, size);
+
+    const auto upload_all = [&] {
+        u64 uploaded = 0;
+        memory_track->ForEachUploadRange(BASE, size, [&](u64, u64 range_size) {
+            uploaded += range_size;
+        });
+        return uploaded;
+    };
+    const std::vector<Write> streaming = StreamingWrites();
+    BENCHMARK("Streaming writes") {
+        for (const Write& write : streaming) {
+            memory_track->MarkRegionAsCpuModified(BASE + write.offset, write.size);
+        }
+        return upload_all();
+    };
+    const std::vector<Write> scattered = ScatteredWrites();
+    BENCHMARK("Scattered small writes") {
+        for (const Write& write : scattered) {
+            memory_track->MarkRegionAsCpuModified(BASE + write.offset, write.size);
+        }
+        return upload_all();
+    };
+    const std::vector<Write> unmaps = LargeUnmaps();
+    BENCHMARK("Large unmaps") {
+        for (const Write& write : unmaps) {
+            memory_track->MarkRegionAsCpuModified(BASE + write.offset, write.size);
+            memory_track->MarkRegionAsGpuModified(BASE + write.offset, write.size);
+        }
+        u64 downloaded = 0;
+        memory_track->ForEachDownloadRangeAndClear(BASE, size, [&](u64, u64 range_size) {
+            downloaded += range_size;
+        });
+        return downloaded + upload_all();
+    };
+}
+
+TEST_CASE("WordManager: Benchmark game access patterns", "[video_core][.benchmark]") {
+    using VideoCommon::Type;
+    // Large enough to hold every pattern, like a big guest heap backing a single buffer
+    static constexpr u64 size = 256ULL << 20;
+    RasterizerInterface rasterizer;
+    WordManager manager(BASE, rasterizer, size);
+    manager.ChangeRegionState<Type::CPU, false>(BASE, size);
+
+    const auto upload_all = [&] {
+        u64 uploaded = 0;
+        manager.ForEachModifiedRange<Type::CPU, true>(BASE, size, [&](u64, u64 range_size) {
+            uploaded += range_size;
+        });
+        return uploaded;
+    };
+    const std::vector<Write> streaming = StreamingWrites();
+    BENCHMARK("Streaming writes") {
+        for (const Write& write : streaming) {
+            manager.ChangeRegionState<Type::CPU, true>(BASE + write.offset, write.size);
+        }
+        return upload_all();
+    };
+    const std::vector<Write> scattered = ScatteredWrites();
+    BENCHMARK("Scattered small writes") {
+        for (const Write& write : scattered) {
+            manager.ChangeRegionState<Type::CPU, true>(BASE + write.offset, write.size);
+        }
+        return upload_all();
+    };
+    const std::vector<Write> unmaps = LargeUnmaps();
+    BENCHMARK("Query after large unmaps") {
+        for (const Write& write : unmaps) {
+            manager.ChangeRegionState<Type::CPU, true>(BASE + write.offset, write.size);
+        }
+        bool modified = false;
+        for (const Write& write : scattered) {
+            modified |= manager.IsRegionModified<Type::CPU>(write.offset, write.size);
+        }
+        return modified ? upload_all() : 0;
+    };
+}
+
+TEST_CASE("RangeSet: Benchmark game access patterns", "[common][.benchmark]") {
+    static constexpr u64 size = 256ULL << 20;
+    const std::vector<Write> streaming = StreamingWrites();
+    const std::vector<Write> scattered = ScatteredWrites();
+    const std::vector<Write> unmaps = LargeUnmaps();
+
+    // Mirrors how the buffer cache tracks GPU modified ranges across a frame
+    BENCHMARK("Streaming writes") {
+        Common::RangeSet<DAddr> ranges;
+        for (const Write& write : streaming) {
+            ranges.Add(BASE + write.offset, write.size);
+        }
+        u64 total = 0;
+        ranges.ForEach([&](DAddr begin, DAddr end) { total += end - begin; });
+        return total;
+    };
+    BENCHMARK("Scattered small writes") {
+        Common::RangeSet<DAddr> ranges;
+        for (const Write& write : scattered) {
+            ranges.Add(BASE + write.offset, write.size);
+        }
+        u64 total = 0;
+        for (const Write& write : scattered) {
+            ranges.ForEachInRange(BASE + write.offset, PAGE,
+                                  [&](DAddr begin, DAddr end) { total += end - begin; });
+        }
+        return total;
+    };
+    BENCHMARK("Large unmaps") {
+        Common::RangeSet<DAddr> ranges;
+        ranges.Add(BASE, size);
+        for (const Write& write : scattered) {
+            ranges.Subtract(BASE + write.offset, write.size);
+        }
+        for (const Write& write : unmaps) {
+            ranges.Subtract(BASE + write.offset, write.size);
+        }
+        return ranges.Empty();
+    };
+}
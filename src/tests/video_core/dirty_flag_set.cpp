@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/dirty_flag_set.h"
+
+namespace {
+using Flags = VideoCommon::DirtyFlagSet<255>;
+} // Anonymous namespace
+
+TEST_CASE("DirtyFlagSet[Basic]", "[video_core]") {
+    Flags flags;
+    REQUIRE(flags.none());
+    flags[70] = true;
+    REQUIRE(flags[70]);
+    REQUIRE(!flags[71]);
+    REQUIRE(flags.any());
+    flags[70] = false;
+    REQUIRE(flags.none());
+}
+
+TEST_CASE("DirtyFlagSet[SetFlip]", "[video_core]") {
+    Flags flags;
+    flags.flip();
+    REQUIRE(flags[0]);
+    REQUIRE(flags[254]);
+    size_t count = 0;
+    flags.ForEachSet([&count](size_t) { ++count; });
+    REQUIRE(count == 255);
+    flags.reset();
+    REQUIRE(flags.none());
+    flags.set();
+    count = 0;
+    flags.ForEachSet([&count](size_t) { ++count; });
+    REQUIRE(count == 255);
+}
+
+TEST_CASE("DirtyFlagSet[AnyOf]", "[video_core]") {
+    Flags mask;
+    mask[3] = true;
+    mask[200] = true;
+
+    Flags flags;
+    REQUIRE(!flags.AnyOf(mask));
+    flags[4] = true;
+    flags[199] = true;
+    REQUIRE(!flags.AnyOf(mask));
+    flags[200] = true;
+    REQUIRE(flags.AnyOf(mask));
+    flags[200] = false;
+    REQUIRE(!flags.AnyOf(mask));
+}
+
+TEST_CASE("DirtyFlagSet[ForEachSet]", "[video_core]") {
+    Flags flags;
+    flags[1] = true;
+    flags[63] = true;
+    flags[64] = true;
+    flags[254] = true;
+    std::vector<size_t> indices;
+    flags.ForEachSet([&indices](size_t index) { indices.push_back(index); });
+    REQUIRE(indices == std::vector<size_t>{1, 63, 64, 254});
+
+    Flags other;
+    other[100] = true;
+    flags |= other;
+    REQUIRE(flags[100]);
+}
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "video_core/dynamic_resolution.h"
+
+using namespace std::chrono_literals;
+using VideoCommon::DynamicResolution;
+
+namespace {
+constexpr auto Target = 16ms;
+
+void AddFrames(DynamicResolution& dynamic_resolution, std::chrono::nanoseconds gpu_time,
+               u32 num_frames) {
+    for (u32 frame = 0; frame < num_frames; ++frame) {
+        dynamic_resolution.AddFrame(gpu_time, Target);
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("DynamicResolution: Scales down over the target", "[video_core]") {
+    DynamicResolution dynamic_resolution;
+    AddFrames(dynamic_resolution, 10ms, DynamicResolution::HoldFrames * 2);
+    REQUIRE(dynamic_resolution.IsUpscaling());
+
+    // A few slow frames are smoothed out
+    AddFrames(dynamic_resolution, 20ms, 2);
+    REQUIRE(dynamic_resolution.IsUpscaling());
+    AddFrames(dynamic_resolution, 20ms, 30);
+    REQUIRE(!dynamic_resolution.IsUpscaling());
+}
+
+TEST_CASE("DynamicResolution: Scales up when the upscaled cost fits", "[video_core]") {
+    DynamicResolution dynamic_resolution;
+    AddFrames(dynamic_resolution, 20ms, DynamicResolution::HoldFrames);
+    REQUIRE(!dynamic_resolution.IsUpscaling());
+
+    // Native resolution takes half the time, upscaling again would go back over the target
+    AddFrames(dynamic_resolution, 10ms, DynamicResolution::HoldFrames * 4);
+    REQUIRE(!dynamic_resolution.IsUpscaling());
+
+    AddFrames(dynamic_resolution, 5ms, DynamicResolution::HoldFrames);
+    REQUIRE(dynamic_resolution.IsUpscaling());
+}
+
+TEST_CASE("DynamicResolution: Reset", "[video_core]") {
+    DynamicResolution dynamic_resolution;
+    AddFrames(dynamic_resolution, 20ms, DynamicResolution::HoldFrames);
+    REQUIRE(!dynamic_resolution.IsUpscaling());
+    dynamic_resolution.Reset();
+    REQUIRE(dynamic_resolution.IsUpscaling());
+}
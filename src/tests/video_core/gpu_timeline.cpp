@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "video_core/gpu_timeline.h"
+
+using VideoCore::GpuPass;
+using VideoCore::GpuPassMark;
+using VideoCore::GpuPassSpan;
+
+TEST_CASE("GpuTimeline[BuildSpans]", "[video_core]") {
+    static constexpr std::array<GpuPassMark, 7> marks{{
+        {GpuPass::TextureUpload, 100},
+        {GpuPass::RenderTarget, 150},
+        // A second set of render targets
+        {GpuPass::RenderTarget, 400},
+        {GpuPass::Idle, 500},
+        // Nothing was recorded to the compute pass before the submission ended
+        {GpuPass::Compute, 900},
+        {GpuPass::Idle, 900},
+        // The last pass of the frame has no end yet
+        {GpuPass::Present, 1000},
+    }};
+    const std::vector<GpuPassSpan> spans = VideoCore::GpuTimeline::BuildSpans(marks);
+    REQUIRE(spans.size() == 3);
+    REQUIRE(spans[0].pass == GpuPass::TextureUpload);
+    REQUIRE(spans[0].begin_ns == 100);
+    REQUIRE(spans[0].end_ns == 150);
+    REQUIRE(spans[1].pass == GpuPass::RenderTarget);
+    REQUIRE(spans[1].end_ns == 400);
+    REQUIRE(spans[2].pass == GpuPass::RenderTarget);
+    REQUIRE(spans[2].begin_ns == 400);
+    REQUIRE(spans[2].end_ns == 500);
+}
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/hash.h"
+#include "video_core/texture_cache/image_page_table.h"
+
+namespace {
+using VideoCommon::ImagePageTable;
+
+constexpr u64 PAGE_BITS = 20;
+
+struct ResidentImage {
+    u64 addr;
+    u64 size;
+};
+
+/// Places images of 64 KiB to 32 MiB across a 16 GiB address space, like a texture heavy title
+std::vector<ResidentImage> MakeImages(size_t count) {
+    std::mt19937_64 rng{1234};
+    std::uniform_int_distribution<u64> addr_dist{0, (16ULL << 30) - 1};
+    std::uniform_int_distribution<u64> size_shift_dist{16, 25};
+    std::vector<ResidentImage> images(count);
+    for (ResidentImage& image : images) {
+        image.addr = addr_dist(rng) & ~0xffffULL;
+        image.size = 1ULL << size_shift_dist(rng);
+    }
+    return images;
+}
+
+template <typename Func>
+void ForEachImagePage(const ResidentImage& image, Func&& func) {
+    const u64 last_page = (image.addr + image.size - 1) >> PAGE_BITS;
+    for (u64 page = image.addr >> PAGE_BITS; page <= last_page; ++page) {
+        func(page);
+    }
+}
+
+} // Anonymous namespace
+
+TEST_CASE("ImagePageTable[Find]", "[video_core]") {
+    ImagePageTable<u32> table;
+    REQUIRE(table.Find(0) == nullptr);
+    REQUIRE(table.Find(12345) == nullptr);
+
+    // Near pages live in the direct chunks, the far ones in the hashed chunks
+    constexpr u64 far_page = ~(1ULL << 40ULL) >> PAGE_BITS;
+    for (const u64 page : std::vector<u64>{0, 1, 1023, 1024, 0xfffff, 0x100000, far_page}) {
+        table[page].push_back(static_cast<u32>(page));
+        table[page].push_back(static_cast<u32>(page + 1));
+        const auto* const entries = table.Find(page);
+        REQUIRE(entries != nullptr);
+        REQUIRE(entries->size() == 2);
+        REQUIRE((*entries)[0] == static_cast<u32>(page));
+        REQUIRE((*entries)[1] == static_cast<u32>(page + 1));
+    }
+    REQUIRE(table.Find(2) != nullptr);
+    REQUIRE(table.Find(2)->empty());
+    REQUIRE(table.Find(far_page - 1) != nullptr);
+    REQUIRE(table.Find(far_page + (1ULL << 20)) == nullptr);
+
+    // A page keeps its entries past the inline capacity
+    for (u32 i = 0; i < 100; ++i) {
+        table[7].push_back(i);
+    }
+    REQUIRE(table.Find(7)->size() == 100);
+    REQUIRE(table.Find(7)->back() == 99);
+}
+
+TEST_CASE("ImagePageTable[ForEachPage]", "[video_core]") {
+    ImagePageTable<u32> table;
+    const std::vector<u64> pages{3, 4, 1000, 1030, 5000, 1ULL << 24};
+    for (const u64 page : pages) {
+        table[page].push_back(static_cast<u32>(page));
+    }
+    table[10].clear();
+
+    std::vector<u64> visited;
+    table.ForEachPage(0, ~0ULL >> PAGE_BITS, [&](u64 page, ImagePageTable<u32>::Entries& entries) {
+        REQUIRE(entries.size() == 1);
+        REQUIRE(entries[0] == static_cast<u32>(page));
+        visited.push_back(page);
+    });
+    REQUIRE(visited == pages);
+
+    visited.clear();
+    table.ForEachPage(4, 1030, [&](u64 page, ImagePageTable<u32>::Entries&) {
+        visited.push_back(page);
+    });
+    REQUIRE(visited == std::vector<u64>{4, 1000, 1030});
+
+    visited.clear();
+    table.ForEachPage(5, 999, [&](u64 page, ImagePageTable<u32>::Entries&) {
+        visited.push_back(page);
+    });
+    REQUIRE(visited.empty());
+
+    visited.clear();
+    table.ForEachPage(0, 5000, [&](u64 page, ImagePageTable<u32>::Entries&) {
+        visited.push_back(page);
+        return page == 1000;
+    });
+    REQUIRE(visited == std::vector<u64>{3, 4, 1000});
+}
+
+TEST_CASE("ImagePageTable[Benchmark]", "[video_core][.benchmark]") {
+    using HashMap = std::unordered_map<u64, std::vector<u32>, Common::IdentityHash<u64>>;
+    for (const size_t num_images : {1000U, 10000U, 50000U}) {
+        const std::vector<ResidentImage> images = MakeImages(num_images);
+        HashMap hash_map;
+        ImagePageTable<u32> table;
+        for (u32 id = 0; id < images.size(); ++id) {
+            ForEachImagePage(images[id], [&](u64 page) {
+                hash_map[page].push_back(id);
+                table[page].push_back(id);
+            });
+        }
+        // Invalidations of 4 KiB to 4 MiB, as seen from guest writes and unmaps
+        const std::vector<ResidentImage> queries = [] {
+            std::mt19937_64 rng{5678};
+            std::uniform_int_distribution<u64> addr_dist{0, (16ULL << 30) - 1};
+            std::uniform_int_distribution<u64> size_shift_dist{12, 22};
+            std::vector<ResidentImage> result(4096);
+            for (ResidentImage& query : result) {
+                query = {addr_dist(rng), 1ULL << size_shift_dist(rng)};
+            }
+            return result;
+        }();
+
+        const auto name = [&](const char* kind) {
+            return std::string{kind} + " images=" + std::to_string(num_images);
+        };
+        BENCHMARK(name("unordered_map")) {
+            u64 sum = 0;
+            for (const ResidentImage& query : queries) {
+                ForEachImagePage(query, [&](u64 page) {
+                    const auto it = hash_map.find(page);
+                    if (it == hash_map.end()) {
+                        return;
+                    }
+                    for (const u32 id : it->second) {
+                        sum += id;
+                    }
+                });
+            }
+            return sum;
+        };
+        BENCHMARK(name("ImagePageTable")) {
+            u64 sum = 0;
+            for (const ResidentImage& query : queries) {
+                const u64 last_page = (query.addr + query.size - 1) >> PAGE_BITS;
+                table.ForEachPage(query.addr >> PAGE_BITS, last_page,
+                                  [&](u64, ImagePageTable<u32>::Entries& entries) {
+                                      for (const u32 id : entries) {
+                                          sum += id;
+                                      }
+                                  });
+            }
+            return sum;
+        };
+    }
+}
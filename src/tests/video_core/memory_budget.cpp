@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "video_core/memory_budget.h"
+
+namespace {
+using namespace Common::Literals;
+using VideoCore::MemoryBudget;
+using VideoCore::MemoryBudgetClient;
+} // Anonymous namespace
+
+TEST_CASE("MemoryBudget[UnderTarget]", "[video_core]") {
+    MemoryBudget budget;
+    budget.Report(MemoryBudgetClient::TextureCache, 512_MiB, 100);
+    budget.Report(MemoryBudgetClient::BufferCache, 256_MiB, 100);
+    REQUIRE(budget.EvictionShare(MemoryBudgetClient::TextureCache) == 0);
+
+    budget.SetTarget(1_GiB);
+    REQUIRE(budget.TotalResidentBytes() == 768_MiB);
+    REQUIRE(budget.EvictionShare(MemoryBudgetClient::TextureCache) == 0);
+    REQUIRE(budget.EvictionShare(MemoryBudgetClient::BufferCache) == 0);
+}
+
+TEST_CASE("MemoryBudget[StaleCachePaysMore]", "[video_core]") {
+    MemoryBudget budget;
+    budget.SetTarget(1_GiB);
+    budget.Report(MemoryBudgetClient::TextureCache, 1_GiB, 0);
+    budget.Report(MemoryBudgetClient::BufferCache, 1_GiB, 99);
+    const u64 texture_share = budget.EvictionShare(MemoryBudgetClient::TextureCache);
+    const u64 buffer_share = budget.EvictionShare(MemoryBudgetClient::BufferCache);
+    REQUIRE(buffer_share > 99 * texture_share);
+    REQUIRE(buffer_share < 101 * texture_share);
+    REQUIRE(texture_share + buffer_share <= 1_GiB);
+    REQUIRE(texture_share + buffer_share > 1_GiB - 1_KiB);
+    REQUIRE(budget.EvictionShare(MemoryBudgetClient::StagingBuffers) == 0);
+}
+
+TEST_CASE("MemoryBudget[ShareBoundedByResidency]", "[video_core]") {
+    MemoryBudget budget;
+    budget.SetTarget(64_MiB);
+    budget.Report(MemoryBudgetClient::TextureCache, 4_GiB, 0);
+    budget.Report(MemoryBudgetClient::StagingBuffers, 16_MiB, 5000);
+    REQUIRE(budget.EvictionShare(MemoryBudgetClient::StagingBuffers) <= 16_MiB);
+}
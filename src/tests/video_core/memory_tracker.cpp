@@ -1,10 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <array>
 #include <memory>
 #include <stdexcept>
 #include <unordered_map>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/alignment.h"
@@ -546,3 +548,72 @@ TEST_CASE("MemoryTracker: Cached write downloads") {
     memory_track->MarkRegionAsCpuModified(c, WORD);
     REQUIRE(rasterizer.Count() == 0);
 }
+
+TEST_CASE("MemoryTracker: Sparse pages in clean words", "[video_core]") {
+    static constexpr u64 size = HIGH_PAGE_SIZE * 2;
+    static constexpr std::array<u64, 5> pages{0, 64 * 4 - 1, 64 * 4, 64 * 13 + 5, 64 * 31 + 63};
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    memory_track->UnmarkRegionAsCpuModified(c, size);
+    REQUIRE(rasterizer.Count() == size / PAGE);
+    for (const u64 page : pages) {
+        memory_track->MarkRegionAsCpuModified(c + page * PAGE, PAGE);
+    }
+    REQUIRE(rasterizer.Count() == size / PAGE - pages.size());
+    REQUIRE(memory_track->IsRegionCpuModified(c + PAGE, size - PAGE));
+    REQUIRE(!memory_track->IsRegionCpuModified(c + PAGE, PAGE * (64 * 4 - 2)));
+    REQUIRE(memory_track->ModifiedCpuRegion(c + PAGE, WORD * 8) ==
+            Range{c + PAGE * (64 * 4 - 1), c + PAGE * (64 * 4 + 1)});
+
+    static constexpr std::array<Range, 4> ranges{
+        Range{c, PAGE},
+        Range{c + PAGE * (64 * 4 - 1), PAGE * 2},
+        Range{c + PAGE * (64 * 13 + 5), PAGE},
+        Range{c + PAGE * (64 * 31 + 63), PAGE},
+    };
+    size_t index = 0;
+    memory_track->ForEachUploadRange(c, size, [&](u64 offset, u64 range_size) {
+        REQUIRE(index < ranges.size());
+        REQUIRE(Range{offset, range_size} == ranges[index]);
+        ++index;
+    });
+    REQUIRE(index == ranges.size());
+    REQUIRE(rasterizer.Count() == size / PAGE);
+    REQUIRE(!memory_track->IsRegionCpuModified(c, size));
+
+    memory_track->MarkRegionAsGpuModified(c + PAGE * (64 * 20), PAGE * 3);
+    index = 0;
+    memory_track->ForEachDownloadRangeAndClear(c, size, [&](u64 offset, u64 range_size) {
+        REQUIRE(Range{offset, range_size} == Range{c + PAGE * (64 * 20), PAGE * 3});
+        ++index;
+    });
+    REQUIRE(index == 1);
+    REQUIRE(!memory_track->IsRegionGpuModified(c, size));
+}
+
+TEST_CASE("MemoryTracker: Benchmark mostly clean region", "[video_core][.benchmark]") {
+    static constexpr u64 size = HIGH_PAGE_SIZE * 16;
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    memory_track->UnmarkRegionAsCpuModified(c, size);
+    BENCHMARK("Query clean region") {
+        return memory_track->IsRegionCpuModified(c, size);
+    };
+    BENCHMARK("Upload sparse pages") {
+        for (u64 offset = 0; offset < size; offset += WORD * 37) {
+            memory_track->MarkRegionAsCpuModified(c + offset, PAGE);
+        }
+        u64 uploaded = 0;
+        memory_track->ForEachUploadRange(c, size, [&](u64, u64 range_size) {
+            uploaded += range_size;
+        });
+        return uploaded;
+    };
+    BENCHMARK("Download clean region") {
+        u64 downloaded = 0;
+        memory_track->ForEachDownloadRange(c, size, false, [&](u64, u64 range_size) {
+            downloaded += range_size;
+        });
+        return downloaded;
+    };
+}
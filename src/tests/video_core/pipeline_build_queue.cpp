@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <future>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/task_pool.h"
+#include "video_core/pipeline_build_queue.h"
+
+namespace {
+/// Holds the only slot of a serial group, so builds queued meanwhile are ordered all at once
+std::promise<void> BlockGroup(Common::TaskGroup& group) {
+    std::promise<void> release;
+    group.QueueWork([blocked = release.get_future().share()] { blocked.wait(); });
+    return release;
+}
+} // Anonymous namespace
+
+TEST_CASE("PipelineBuildQueue[Coverage]", "[video_core]") {
+    Common::TaskGroup workers{Common::TaskPriority::Normal, 1};
+    VideoCore::PipelineBuildQueue queue{workers};
+    std::promise<void> release = BlockGroup(workers);
+    std::array<int, 3> pipelines{};
+    std::vector<int> order;
+    for (int index = 0; index < 3; ++index) {
+        queue.QueueBuild(&pipelines[index], [&order, index] { order.push_back(index); });
+    }
+    queue.Request(&pipelines[0], 0.01f);
+    queue.Request(&pipelines[1], 0.5f);
+    queue.Request(&pipelines[2], 1.0f);
+    REQUIRE(queue.PendingBuilds() == 3);
+    release.set_value();
+    workers.WaitForRequests();
+    REQUIRE(queue.PendingBuilds() == 0);
+    REQUIRE(order == std::vector<int>{2, 1, 0});
+}
+
+TEST_CASE("PipelineBuildQueue[RequestedAgain]", "[video_core]") {
+    Common::TaskGroup workers{Common::TaskPriority::Normal, 1};
+    VideoCore::PipelineBuildQueue queue{workers};
+    std::promise<void> release = BlockGroup(workers);
+    std::array<int, 3> pipelines{};
+    std::vector<int> order;
+    for (int index = 0; index < 3; ++index) {
+        queue.QueueBuild(&pipelines[index], [&order, index] { order.push_back(index); });
+        queue.Request(&pipelines[index], 1.0f);
+    }
+    // A small draw requesting a pipeline again goes ahead of builds requested once
+    queue.Request(&pipelines[0], 0.0f);
+    release.set_value();
+    workers.WaitForRequests();
+    REQUIRE(order.front() == 0);
+    REQUIRE(order.size() == 3);
+
+    // Requests of pipelines that were already built are ignored
+    queue.Request(&pipelines[1], 1.0f);
+    REQUIRE(queue.PendingBuilds() == 0);
+}
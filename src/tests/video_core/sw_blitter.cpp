@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/engines/sw_blitter/converter.h"
+
+namespace {
+using namespace Tegra::Engines::Blitter;
+using Tegra::RenderTargetFormat;
+
+constexpr size_t NUM_PIXELS = 333;
+
+std::vector<u8> ConvertThroughIr(ConverterFactory& factory, RenderTargetFormat src_format,
+                                 RenderTargetFormat dst_format, const std::vector<u8>& input,
+                                 size_t bytes_per_pixel) {
+    std::vector<f32> intermediate(NUM_PIXELS * 4);
+    std::vector<u8> output(NUM_PIXELS * bytes_per_pixel);
+    factory.GetFormatConverter(src_format)->ConvertTo(input, intermediate);
+    factory.GetFormatConverter(dst_format)->ConvertFrom(intermediate, output);
+    return output;
+}
+} // Anonymous namespace
+
+TEST_CASE("SoftwareBlitter[PixelShuffle]", "[video_core]") {
+    ConverterFactory factory;
+    std::mt19937 rng{0};
+    const auto random_pixels = [&](size_t bytes_per_pixel) {
+        std::vector<u8> pixels(NUM_PIXELS * bytes_per_pixel);
+        for (u8& value : pixels) {
+            value = static_cast<u8>(rng());
+        }
+        return pixels;
+    };
+
+    SECTION("Matches the float intermediate") {
+        // 8 bit UNORM channels survive the float intermediate unchanged
+        const std::vector<std::pair<RenderTargetFormat, RenderTargetFormat>> pairs{
+            {RenderTargetFormat::A8R8G8B8_UNORM, RenderTargetFormat::A8B8G8R8_UNORM},
+            {RenderTargetFormat::A8B8G8R8_UNORM, RenderTargetFormat::A8R8G8B8_UNORM},
+            {RenderTargetFormat::A8B8G8R8_UNORM, RenderTargetFormat::X8R8G8B8_UNORM},
+            {RenderTargetFormat::A8R8G8B8_UNORM, RenderTargetFormat::X8B8G8R8_UNORM},
+        };
+        for (const auto& [src_format, dst_format] : pairs) {
+            std::vector<u8> input = random_pixels(4);
+            const PixelShuffle* const shuffle = factory.GetPixelShuffle(src_format, dst_format);
+            REQUIRE(shuffle != nullptr);
+
+            const auto expected = ConvertThroughIr(factory, src_format, dst_format, input, 4);
+            std::vector<u8> output(input.size());
+            shuffle->Apply(input, output);
+            REQUIRE(output == expected);
+
+            // In place, like the blitter does
+            shuffle->Apply(input, input);
+            REQUIRE(input == expected);
+        }
+    }
+
+    SECTION("Keeps the bits of every channel") {
+        const std::vector<u8> input = random_pixels(16);
+        const PixelShuffle* const shuffle = factory.GetPixelShuffle(
+            RenderTargetFormat::R32G32B32A32_UINT, RenderTargetFormat::R32G32B32X32_UINT);
+        REQUIRE(shuffle != nullptr);
+        std::vector<u8> output(input.size());
+        shuffle->Apply(input, output);
+        for (size_t byte = 0; byte < input.size(); byte++) {
+            REQUIRE(output[byte] == (byte % 16 < 12 ? input[byte] : 0));
+        }
+    }
+
+    SECTION("Rejects formats with different encodings") {
+        REQUIRE(factory.GetPixelShuffle(RenderTargetFormat::A8R8G8B8_UNORM,
+                                        RenderTargetFormat::A8B8G8R8_SRGB) == nullptr);
+        REQUIRE(factory.GetPixelShuffle(RenderTargetFormat::X8R8G8B8_UNORM,
+                                        RenderTargetFormat::A8B8G8R8_UNORM) == nullptr);
+        REQUIRE(factory.GetPixelShuffle(RenderTargetFormat::A8B8G8R8_UNORM,
+                                        RenderTargetFormat::R16G16_UNORM) == nullptr);
+    }
+}
@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/div_ceil.h"
+#include "video_core/textures/decoders.h"
+
+namespace {
+using namespace Tegra::Texture;
+
+constexpr SwizzleTable SWIZZLE_TABLE = MakeSwizzleTable();
+
+/// Straightforward block linear addressing of byte x in row y of slice z
+u32 SwizzledOffset(u32 x, u32 y, u32 z, u32 stride, u32 height, u32 block_height,
+                   u32 block_depth) {
+    const u32 gobs_in_x = Common::DivCeil(stride, GOB_SIZE_X);
+    const u32 block_size = gobs_in_x << (GOB_SIZE_SHIFT + block_height + block_depth);
+    const u32 slice_size = Common::DivCeil(height, GOB_SIZE_Y << block_height) * block_size;
+    const u32 offset_z = (z >> block_depth) * slice_size +
+                         ((z & ((1U << block_depth) - 1)) << (GOB_SIZE_SHIFT + block_height));
+    const u32 block_y = y / GOB_SIZE_Y;
+    const u32 offset_y = (block_y >> block_height) * block_size +
+                         ((block_y & ((1U << block_height) - 1)) << GOB_SIZE_SHIFT);
+    const u32 offset_x = (x / GOB_SIZE_X) << (GOB_SIZE_SHIFT + block_height + block_depth);
+    return offset_z + offset_y + offset_x + SWIZZLE_TABLE[y % GOB_SIZE_Y][x % GOB_SIZE_X];
+}
+
+std::vector<u8> MakePattern(size_t size) {
+    std::vector<u8> data(size);
+    u32 state = 0x12345678;
+    for (u8& value : data) {
+        state = state * 1664525 + 1013904223;
+        value = static_cast<u8>(state >> 24);
+    }
+    return data;
+}
+
+struct Layout {
+    u32 bytes_per_pixel;
+    u32 width;
+    u32 height;
+    u32 depth;
+    u32 block_height;
+    u32 block_depth;
+};
+
+constexpr std::array LAYOUTS{
+    Layout{1, 64, 8, 1, 0, 0},    Layout{1, 200, 37, 1, 2, 0},  Layout{2, 100, 64, 1, 3, 0},
+    Layout{4, 256, 128, 1, 4, 0}, Layout{4, 33, 17, 3, 1, 1},   Layout{8, 96, 40, 1, 5, 0},
+    Layout{16, 48, 24, 2, 2, 1},  Layout{16, 1, 1, 1, 0, 0},    Layout{4, 1000, 9, 1, 0, 0},
+    Layout{2, 7, 300, 1, 5, 0},   Layout{8, 130, 70, 4, 3, 2},  Layout{1, 4096, 16, 1, 1, 0},
+};
+
+} // Anonymous namespace
+
+TEST_CASE("Swizzle[Unswizzle]", "[video_core]") {
+    for (const Layout& layout : LAYOUTS) {
+        const u32 pitch = layout.width * layout.bytes_per_pixel;
+        const size_t swizzled_size =
+            CalculateSize(true, layout.bytes_per_pixel, layout.width, layout.height, layout.depth,
+                          layout.block_height, layout.block_depth);
+        const std::vector<u8> swizzled = MakePattern(swizzled_size);
+        std::vector<u8> linear(static_cast<size_t>(pitch) * layout.height * layout.depth);
+        UnswizzleTexture(linear, swizzled, layout.bytes_per_pixel, layout.width, layout.height,
+                         layout.depth, layout.block_height, layout.block_depth, 0);
+
+        bool matches = true;
+        for (u32 z = 0; z < layout.depth; ++z) {
+            for (u32 y = 0; y < layout.height; ++y) {
+                for (u32 x = 0; x < pitch; ++x) {
+                    const u32 src = SwizzledOffset(x, y, z, pitch, layout.height,
+                                                   layout.block_height, layout.block_depth);
+                    matches &= linear[(z * layout.height + y) * pitch + x] == swizzled[src];
+                }
+            }
+        }
+        REQUIRE(matches);
+    }
+}
+
+TEST_CASE("Swizzle[RoundTrip]", "[video_core]") {
+    for (const Layout& layout : LAYOUTS) {
+        const u32 pitch = layout.width * layout.bytes_per_pixel;
+        const size_t swizzled_size =
+            CalculateSize(true, layout.bytes_per_pixel, layout.width, layout.height, layout.depth,
+                          layout.block_height, layout.block_depth);
+        const std::vector<u8> linear =
+            MakePattern(static_cast<size_t>(pitch) * layout.height * layout.depth);
+        std::vector<u8> swizzled(swizzled_size);
+        SwizzleTexture(swizzled, linear, layout.bytes_per_pixel, layout.width, layout.height,
+                       layout.depth, layout.block_height, layout.block_depth, 0);
+        std::vector<u8> result(linear.size());
+        UnswizzleTexture(result, swizzled, layout.bytes_per_pixel, layout.width, layout.height,
+                         layout.depth, layout.block_height, layout.block_depth, 0);
+        REQUIRE(result == linear);
+    }
+}
+
+TEST_CASE("Swizzle[Subrect]", "[video_core]") {
+    constexpr u32 width = 300;
+    constexpr u32 height = 64;
+    constexpr u32 block_height = 3;
+    for (const u32 bytes_per_pixel : {1U, 2U, 3U, 4U, 8U, 12U, 16U}) {
+        const u32 stride = width * bytes_per_pixel;
+        const size_t swizzled_size =
+            CalculateSize(true, bytes_per_pixel, width, height, 1, block_height, 0);
+        const std::vector<u8> swizzled = MakePattern(swizzled_size);
+
+        constexpr u32 origin_x = 21;
+        constexpr u32 origin_y = 5;
+        constexpr u32 extent_x = 250;
+        constexpr u32 extent_y = 40;
+        const u32 pitch_linear = extent_x * bytes_per_pixel;
+        std::vector<u8> linear(static_cast<size_t>(pitch_linear) * extent_y);
+        UnswizzleSubrect(linear, swizzled, bytes_per_pixel, width, height, 1, origin_x, origin_y,
+                         extent_x, extent_y, block_height, 0, pitch_linear);
+
+        // Pixels of non power of two sizes are copied as a whole even when they straddle 16 byte
+        // runs of a GOB, so only the round trip is checked for them
+        if (std::has_single_bit(bytes_per_pixel)) {
+            bool matches = true;
+            for (u32 y = 0; y < extent_y; ++y) {
+                for (u32 x = 0; x < pitch_linear; ++x) {
+                    const u32 src = SwizzledOffset(origin_x * bytes_per_pixel + x, origin_y + y,
+                                                   0, stride, height, block_height, 0);
+                    matches &= linear[y * pitch_linear + x] == swizzled[src];
+                }
+            }
+            REQUIRE(matches);
+        }
+
+        std::vector<u8> reswizzled = swizzled;
+        std::vector<u8> modified = linear;
+        for (u8& value : modified) {
+            value = static_cast<u8>(~value);
+        }
+        SwizzleSubrect(reswizzled, modified, bytes_per_pixel, width, height, 1, origin_x, origin_y,
+                       extent_x, extent_y, block_height, 0, pitch_linear);
+        std::vector<u8> result(linear.size());
+        UnswizzleSubrect(result, reswizzled, bytes_per_pixel, width, height, 1, origin_x, origin_y,
+                         extent_x, extent_y, block_height, 0, pitch_linear);
+        REQUIRE(result == modified);
+    }
+}
+
+TEST_CASE("Swizzle[Benchmark]", "[video_core][.benchmark]") {
+    constexpr u32 width = 1024;
+    constexpr u32 height = 1024;
+    for (const u32 bytes_per_pixel : {1U, 4U, 16U}) {
+        for (const u32 block_height : {0U, 2U, 4U}) {
+            const u32 pitch = width * bytes_per_pixel;
+            const std::vector<u8> swizzled = MakePattern(
+                CalculateSize(true, bytes_per_pixel, width, height, 1, block_height, 0));
+            std::vector<u8> linear(static_cast<size_t>(pitch) * height);
+
+            const auto name = [&](const char* kind) {
+                return std::string{kind} + " bpp=" + std::to_string(bytes_per_pixel) +
+                       " block_height=" + std::to_string(block_height);
+            };
+            BENCHMARK(name("Unswizzle")) {
+                UnswizzleTexture(linear, swizzled, bytes_per_pixel, width, height, 1,
+                                 block_height, 0, 0);
+                return linear[0];
+            };
+            BENCHMARK(name("UnswizzleSubrect")) {
+                UnswizzleSubrect(linear, swizzled, bytes_per_pixel, width, height, 1, 0, 0, width,
+                                 height, block_height, 0, pitch);
+                return linear[0];
+            };
+            BENCHMARK(name("Reference per pixel")) {
+                for (u32 y = 0; y < height; ++y) {
+                    for (u32 x = 0; x < pitch; x += bytes_per_pixel) {
+                        const u32 src = SwizzledOffset(x, y, 0, pitch, height, block_height, 0);
+                        std::memcpy(&linear[y * pitch + x], &swizzled[src], bytes_per_pixel);
+                    }
+                }
+                return linear[0];
+            };
+        }
+    }
+}
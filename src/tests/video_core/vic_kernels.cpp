@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/host1x/vic_kernels.h"
+#include "video_core/textures/decoders.h"
+
+namespace {
+using namespace Tegra::Host1x;
+using Pixel = std::array<u8, 4>;
+
+constexpr Pixel GREY{130, 130, 130, 255};
+constexpr Pixel BLACK{0, 0, 0, 255};
+constexpr Pixel WHITE{255, 255, 255, 255};
+// BT.601 red
+constexpr Pixel RED{255, 0, 0, 255};
+
+struct Frame {
+    std::vector<u8> luma;
+    std::vector<u8> chroma_u;
+    std::vector<u8> chroma_v;
+    YuvFrameView view;
+};
+
+Frame MakeFrame(u32 width, u32 height, bool interleaved, u64 seed) {
+    std::mt19937_64 rng{seed};
+    const size_t luma_stride = width + rng() % 32;
+    const size_t chroma_width = (width + 1) / 2 * (interleaved ? 2 : 1);
+    const size_t chroma_stride = chroma_width + rng() % 32;
+    const size_t chroma_height = (height + 1) / 2;
+
+    Frame frame;
+    frame.luma.resize(luma_stride * height);
+    frame.chroma_u.resize(chroma_stride * chroma_height);
+    if (!interleaved) {
+        frame.chroma_v.resize(chroma_stride * chroma_height);
+    }
+    for (auto* plane : {&frame.luma, &frame.chroma_u, &frame.chroma_v}) {
+        std::ranges::generate(*plane, [&] { return static_cast<u8>(rng()); });
+    }
+    frame.view = {
+        .luma = frame.luma.data(),
+        .chroma_u = frame.chroma_u.data(),
+        .chroma_v = interleaved ? nullptr : frame.chroma_v.data(),
+        .luma_stride = luma_stride,
+        .chroma_stride = chroma_stride,
+    };
+    return frame;
+}
+
+std::vector<u8> Convert(const Frame& frame, const RgbSurfaceLayout& layout, VicRgbOrder order,
+                        VicKernelIsa isa) {
+    std::vector<u8> surface(Tegra::Texture::CalculateSize(layout.block_linear, 4, layout.width,
+                                                          layout.height, 1, layout.block_height,
+                                                          0));
+    ConvertYuvToRgb(surface, frame.view, layout, order, isa);
+    return surface;
+}
+} // Anonymous namespace
+
+TEST_CASE("VicKernels[Reference]", "[video_core]") {
+    // Mid grey, then the limited range extremes
+    const Frame frame = [] {
+        Frame result = MakeFrame(8, 2, false, 0);
+        std::ranges::copy(std::array<u8, 8>{128, 128, 16, 16, 235, 235, 81, 81},
+                          result.luma.begin());
+        std::ranges::copy(std::array<u8, 4>{128, 128, 128, 90}, result.chroma_u.begin());
+        std::ranges::copy(std::array<u8, 4>{128, 128, 128, 240}, result.chroma_v.begin());
+        return result;
+    }();
+    const RgbSurfaceLayout layout{.width = 8, .height = 1, .block_linear = false};
+    for (const auto isa : GetSupportedVicKernelIsas()) {
+        const auto surface = Convert(frame, layout, VicRgbOrder::Rgba, isa);
+        const auto pixel = [&](size_t index) {
+            return Pixel{surface[index * 4], surface[index * 4 + 1], surface[index * 4 + 2],
+                         surface[index * 4 + 3]};
+        };
+        REQUIRE(pixel(0) == GREY);
+        REQUIRE(pixel(2) == BLACK);
+        REQUIRE(pixel(4) == WHITE);
+        REQUIRE(pixel(6) == RED);
+
+        const auto bgra = Convert(frame, layout, VicRgbOrder::Bgra, isa);
+        REQUIRE(bgra[6 * 4] == 0);
+        REQUIRE(bgra[6 * 4 + 2] == 255);
+    }
+}
+
+TEST_CASE("VicKernels[Isas]", "[video_core]") {
+    const auto isas = GetSupportedVicKernelIsas();
+    for (u64 seed = 0; seed < 64; seed++) {
+        std::mt19937_64 rng{seed};
+        const u32 width = 1 + static_cast<u32>(rng() % 300);
+        const u32 height = 1 + static_cast<u32>(rng() % 70);
+        const bool interleaved = seed % 2 == 0;
+        const auto order = seed % 4 < 2 ? VicRgbOrder::Rgba : VicRgbOrder::Bgra;
+        const Frame frame = MakeFrame(width, height, interleaved, seed);
+
+        const RgbSurfaceLayout pitch_layout{.width = width, .height = height};
+        const auto expected = Convert(frame, pitch_layout, order, VicKernelIsa::Scalar);
+        for (u32 block_height = 0; block_height < 4; block_height++) {
+            const RgbSurfaceLayout block_layout{
+                .width = width,
+                .height = height,
+                .block_linear = true,
+                .block_height = block_height,
+            };
+            std::vector<u8> expected_swizzled(
+                Tegra::Texture::CalculateSize(true, 4, width, height, 1, block_height, 0));
+            Tegra::Texture::SwizzleSubrect(expected_swizzled, expected, 4, width, height, 1, 0, 0,
+                                           width, height, block_height, 0, width * 4);
+            for (const auto isa : isas) {
+                REQUIRE(Convert(frame, block_layout, order, isa) == expected_swizzled);
+            }
+        }
+        for (const auto isa : isas) {
+            REQUIRE(Convert(frame, pitch_layout, order, isa) == expected);
+        }
+    }
+}
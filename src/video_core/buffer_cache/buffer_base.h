@@ -19,12 +19,19 @@ enum class BufferFlagBits {
     Picked = 1 << 0,
     CachedWrites = 1 << 1,
     PreemtiveDownload = 1 << 2,
+    HostMemory = 1 << 3,
 };
 DECLARE_ENUM_FLAG_OPERATORS(BufferFlagBits)
 
 /// Tag for creating null buffers with no storage or size
 struct NullBufferParams {};
 
+/// Hints given to the backend when creating a buffer, backends are free to ignore them
+struct BufferCreateHints {
+    u8* host_pointer = nullptr; ///< Guest memory the buffer can import, null when not importable
+    bool reserve = false;       ///< The buffer is likely to grow and may reserve room for it
+};
+
 /**
  * Range tracking buffer container.
  *
@@ -58,6 +65,11 @@ public:
         flags |= BufferFlagBits::PreemtiveDownload;
     }
 
+    /// Mark buffer as backed by imported guest memory
+    void MarkHostMemory() noexcept {
+        flags |= BufferFlagBits::HostMemory;
+    }
+
     /// Unmark buffer as picked
     void Unpick() noexcept {
         flags &= ~BufferFlagBits::Picked;
@@ -92,6 +104,11 @@ public:
         return True(flags & BufferFlagBits::PreemtiveDownload);
     }
 
+    /// Returns true when the GPU accesses guest memory directly instead of a cached copy
+    [[nodiscard]] bool IsHostMemory() const noexcept {
+        return True(flags & BufferFlagBits::HostMemory);
+    }
+
     /// Returns the base CPU address of the buffer
     [[nodiscard]] VAddr CpuAddr() const noexcept {
         return cpu_addr;
@@ -115,12 +132,28 @@ public:
         return size_bytes;
     }
 
+    /// Returns the buffer cache tick of the last write to the buffer contents
+    [[nodiscard]] u64 ModificationTick() const noexcept {
+        return modification_tick;
+    }
+
+    void SetModificationTick(u64 modification_tick_) noexcept {
+        modification_tick = modification_tick_;
+    }
+
+protected:
+    /// Extends the buffer end, the backend has to provide storage for the new range
+    void SetSizeBytes(size_t size_bytes_) noexcept {
+        size_bytes = size_bytes_;
+    }
+
 private:
     VAddr cpu_addr = 0;
     BufferFlagBits flags{};
     int stream_score = 0;
     size_t lru_id = SIZE_MAX;
     size_t size_bytes = 0;
+    u64 modification_tick = 0;
 };
 
 } // namespace VideoCommon
@@ -4,21 +4,29 @@
 #pragma once
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <utility>
 
 #include "common/range_sets.inc"
 #include "video_core/buffer_cache/buffer_cache_base.h"
+#include "video_core/gpu_capture.h"
 #include "video_core/guest_memory.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/memory_budget.h"
+#include "video_core/memory_stats.h"
 
 namespace VideoCommon {
 
 using Core::DEVICE_PAGESIZE;
 
 template <class P>
-BufferCache<P>::BufferCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, Runtime& runtime_)
-    : runtime{runtime_}, device_memory{device_memory_}, memory_tracker{device_memory} {
+BufferCache<P>::BufferCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, Runtime& runtime_,
+                            VideoCore::MemoryStats& memory_stats_,
+                            VideoCore::MemoryBudget& global_budget_)
+    : runtime{runtime_}, device_memory{device_memory_}, memory_stats{memory_stats_},
+      global_budget{global_budget_}, memory_tracker{device_memory} {
     // Ensure the first slot is used for the null buffer
     void(slot_buffers.insert(runtime, NullBufferParams{}));
     gpu_modified_ranges.Clear();
@@ -27,10 +35,17 @@ BufferCache<P>::BufferCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, R
     if (!runtime.CanReportMemoryUsage()) {
         minimum_memory = DEFAULT_EXPECTED_MEMORY;
         critical_memory = DEFAULT_CRITICAL_MEMORY;
+        // Without usage reports there is no budget to exceed
+        memory_budget = std::numeric_limits<u64>::max();
         return;
     }
+    ConfigureMemoryThresholds(runtime.GetDeviceLocalMemory());
+}
 
-    const s64 device_local_memory = static_cast<s64>(runtime.GetDeviceLocalMemory());
+template <class P>
+void BufferCache<P>::ConfigureMemoryThresholds(u64 budget) {
+    memory_budget = budget;
+    const s64 device_local_memory = static_cast<s64>(budget);
     const s64 min_spacing_expected = device_local_memory - 1_GiB;
     const s64 min_spacing_critical = device_local_memory - 512_MiB;
     const s64 mem_threshold = std::min(device_local_memory, TARGET_THRESHOLD);
@@ -48,18 +63,27 @@ template <class P>
 BufferCache<P>::~BufferCache() = default;
 
 template <class P>
-void BufferCache<P>::RunGarbageCollector() {
+void BufferCache<P>::RunGarbageCollector(u64 budget_share) {
     const bool aggressive_gc = total_used_memory >= critical_memory;
-    const u64 ticks_to_destroy = aggressive_gc ? 60 : 120;
-    int num_iterations = aggressive_gc ? 64 : 32;
-    const auto clean_up = [this, &num_iterations](BufferId buffer_id) {
+    const bool over_budget = total_used_memory >= memory_budget;
+    const u64 ticks_to_destroy = over_budget ? 30 : (aggressive_gc ? 60 : 120);
+    int num_iterations = over_budget ? 256 : (aggressive_gc ? 64 : 32);
+    u64 freed_memory = 0;
+    const auto clean_up = [this, &num_iterations, &freed_memory, budget_share](BufferId buffer_id) {
         if (num_iterations == 0) {
-            return true;
+            // Keep going while the shared budget still expects memory back from this cache
+            if (freed_memory >= budget_share) {
+                return true;
+            }
+        } else {
+            --num_iterations;
         }
-        --num_iterations;
         auto& buffer = slot_buffers[buffer_id];
         DownloadBufferMemory(buffer);
+        const u64 resident_memory_before = resident_memory;
         DeleteBuffer(buffer_id);
+        freed_memory += resident_memory_before - resident_memory;
+        memory_stats.MarkEviction(resident_memory_before - resident_memory);
         return false;
     };
     lru_cache.ForEachItemBelow(frame_tick - ticks_to_destroy, clean_up);
@@ -67,6 +91,8 @@ void BufferCache<P>::RunGarbageCollector() {
 
 template <class P>
 void BufferCache<P>::TickFrame() {
+    frame_arena.Reset();
+
     // Homebrew console apps don't create or bind any channels, so this will be nullptr.
     if (!channel_state) {
         return;
@@ -93,11 +119,21 @@ void BufferCache<P>::TickFrame() {
     // If we can obtain the memory info, use it instead of the estimate.
     if (runtime.CanReportMemoryUsage()) {
         total_used_memory = runtime.GetDeviceMemoryUsage();
+        const u64 budget = runtime.GetDeviceMemoryBudget();
+        if (budget != memory_budget) {
+            ConfigureMemoryThresholds(budget);
+        }
     }
-    if (total_used_memory >= minimum_memory) {
-        RunGarbageCollector();
+    const u64 lru_age = frame_tick - lru_cache.OldestTick().value_or(frame_tick);
+    global_budget.Report(VideoCore::MemoryBudgetClient::BufferCache, resident_memory, lru_age);
+    const u64 budget_share =
+        global_budget.EvictionShare(VideoCore::MemoryBudgetClient::BufferCache);
+    if (total_used_memory >= minimum_memory || budget_share != 0) {
+        RunGarbageCollector(budget_share);
     }
     ++frame_tick;
+    frame_stats.frames = 1;
+    memory_stats.ReportBufferCacheStats(std::exchange(frame_stats, {}));
     delayed_destruction_ring.Tick();
 
     for (auto& buffer : async_buffers_death_ring) {
@@ -115,6 +151,24 @@ void BufferCache<P>::WriteMemory(DAddr device_addr, u64 size) {
     memory_tracker.MarkRegionAsCpuModified(device_addr, size);
 }
 
+template <class P>
+void BufferCache<P>::UnmapMemory(DAddr device_addr, u64 size) {
+    WriteMemory(device_addr, size);
+    if constexpr (HAS_HOST_MEMORY_IMPORT) {
+        // Imported buffers keep the backing pages they were created with, drop them so the range
+        // is looked up again through the new mapping
+        boost::container::small_vector<BufferId, 16> imported_ids;
+        ForEachBufferInRange(device_addr, size, [&](BufferId buffer_id, Buffer& buffer) {
+            if (buffer.IsHostMemory()) {
+                imported_ids.push_back(buffer_id);
+            }
+        });
+        for (const BufferId buffer_id : imported_ids) {
+            DeleteBuffer(buffer_id);
+        }
+    }
+}
+
 template <class P>
 void BufferCache<P>::CachedWriteMemory(DAddr device_addr, u64 size) {
     const bool is_dirty = IsRegionRegistered(device_addr, size);
@@ -129,6 +183,7 @@ void BufferCache<P>::CachedWriteMemory(DAddr device_addr, u64 size) {
     }
 
     tmp_buffer.resize_destructive(size);
+    RecordRead(device_addr, size);
     device_memory.ReadBlockUnsafe(device_addr, tmp_buffer.data(), size);
 
     InlineMemoryImplementation(device_addr, size, tmp_buffer);
@@ -233,6 +288,7 @@ bool BufferCache<P>::DMACopy(GPUVAddr src_address, GPUVAddr dest_address, u64 am
     const auto& copy = copies[0];
     src_buffer.MarkUsage(copy.src_offset, copy.size);
     dest_buffer.MarkUsage(copy.dst_offset, copy.size);
+    MarkBufferModified(dest_buffer);
     runtime.CopyBuffer(dest_buffer, src_buffer, copies, true);
     if (has_new_downloads) {
         memory_tracker.MarkRegionAsGpuModified(*cpu_dest_address, amount);
@@ -264,6 +320,46 @@ bool BufferCache<P>::DMAClear(GPUVAddr dst_address, u64 amount, u32 value) {
     const u32 offset = dest_buffer.Offset(*cpu_dst_address);
     runtime.ClearBuffer(dest_buffer, offset, size, value);
     dest_buffer.MarkUsage(offset, size);
+    MarkBufferModified(dest_buffer);
+    return true;
+}
+
+template <class P>
+bool BufferCache<P>::DMALayoutCopy(const Tegra::DMA::LayoutCopy& copy) {
+    const std::optional<DAddr> cpu_src_address = gpu_memory->GpuToCpuAddress(copy.src.address);
+    const std::optional<DAddr> cpu_dest_address = gpu_memory->GpuToCpuAddress(copy.dst.address);
+    if (!cpu_src_address || !cpu_dest_address) {
+        return false;
+    }
+    const u32 src_size = static_cast<u32>(copy.src.size);
+    const u32 dest_size = static_cast<u32>(copy.dst.size);
+    const bool source_dirty = IsRegionRegistered(*cpu_src_address, src_size);
+    const bool dest_dirty = IsRegionRegistered(*cpu_dest_address, dest_size);
+    if (!source_dirty && !dest_dirty) {
+        return false;
+    }
+
+    ClearDownload(*cpu_dest_address, dest_size);
+
+    BufferId buffer_a;
+    BufferId buffer_b;
+    do {
+        channel_state->has_deleted_buffers = false;
+        buffer_a = FindBuffer(*cpu_src_address, src_size);
+        buffer_b = FindBuffer(*cpu_dest_address, dest_size);
+    } while (channel_state->has_deleted_buffers);
+    auto& src_buffer = slot_buffers[buffer_a];
+    auto& dest_buffer = slot_buffers[buffer_b];
+    // The destination is only partially written, the rest of it has to be valid too
+    SynchronizeBuffer(src_buffer, *cpu_src_address, src_size);
+    SynchronizeBuffer(dest_buffer, *cpu_dest_address, dest_size);
+
+    const u32 src_offset = src_buffer.Offset(*cpu_src_address);
+    const u32 dest_offset = dest_buffer.Offset(*cpu_dest_address);
+    src_buffer.MarkUsage(src_offset, src_size);
+    dest_buffer.MarkUsage(dest_offset, dest_size);
+    runtime.LayoutCopy(dest_buffer, dest_offset, src_buffer, src_offset, copy);
+    MarkWrittenBuffer(buffer_b, *cpu_dest_address, dest_size);
     return true;
 }
 
@@ -541,10 +637,9 @@ void BufferCache<P>::CommitAsyncFlushesHigh() {
         it++;
     }
 
-    boost::container::small_vector<std::pair<BufferCopy, BufferId>, 16> downloads;
-    u64 total_size_bytes = 0;
-    u64 largest_copy = 0;
-    for (const Common::RangeSet<DAddr>& range_set : committed_gpu_modified_ranges) {
+    auto downloads =
+        Common::MakeFrameSmallVector<std::pair<BufferCopy, BufferId>, 16>(frame_arena);
+    for (const Common::SortedRangeSet<DAddr>& range_set : committed_gpu_modified_ranges) {
         range_set.ForEach([&](DAddr interval_lower, DAddr interval_upper) {
             const std::size_t size = interval_upper - interval_lower;
             const DAddr device_addr = interval_lower;
@@ -558,21 +653,14 @@ void BufferCache<P>::CommitAsyncFlushesHigh() {
                     [&](u64 device_addr_out, u64 range_size) {
                         const DAddr buffer_addr = buffer.CpuAddr();
                         const auto add_download = [&](DAddr start, DAddr end) {
-                            const u64 new_offset = start - buffer_addr;
-                            const u64 new_size = end - start;
                             downloads.push_back({
                                 BufferCopy{
-                                    .src_offset = new_offset,
-                                    .dst_offset = total_size_bytes,
-                                    .size = new_size,
+                                    .src_offset = start - buffer_addr,
+                                    .dst_offset = 0,
+                                    .size = end - start,
                                 },
                                 buffer_id,
                             });
-                            // Align up to avoid cache conflicts
-                            constexpr u64 align = 64ULL;
-                            constexpr u64 mask = ~(align - 1ULL);
-                            total_size_bytes += (new_size + align - 1) & mask;
-                            largest_copy = std::max(largest_copy, new_size);
                         };
 
                         gpu_modified_ranges.ForEachInRange(device_addr_out, range_size,
@@ -586,20 +674,60 @@ void BufferCache<P>::CommitAsyncFlushesHigh() {
         async_buffers.emplace_back(std::optional<Async_Buffer>{});
         return;
     }
+    // Merge touching ranges of the same buffer, so each source buffer is downloaded with a single
+    // copy command into the shared staging allocation.
+    std::ranges::sort(downloads, [](const auto& lhs, const auto& rhs) {
+        if (lhs.second != rhs.second) {
+            return lhs.second < rhs.second;
+        }
+        return lhs.first.src_offset < rhs.first.src_offset;
+    });
+    size_t num_merged = 0;
+    for (size_t i = 1; i < downloads.size(); ++i) {
+        auto& [last, last_id] = downloads[num_merged];
+        const auto& [copy, buffer_id] = downloads[i];
+        if (buffer_id == last_id && copy.src_offset <= last.src_offset + last.size) {
+            const u64 end = std::max(last.src_offset + last.size, copy.src_offset + copy.size);
+            last.size = end - last.src_offset;
+            ++frame_stats.downloads_merged;
+            continue;
+        }
+        downloads[++num_merged] = downloads[i];
+    }
+    downloads.resize(num_merged + 1);
+
+    u64 total_size_bytes = 0;
+    for (auto& [copy, buffer_id] : downloads) {
+        copy.dst_offset = total_size_bytes;
+        // Align up to avoid cache conflicts
+        constexpr u64 align = 64ULL;
+        constexpr u64 mask = ~(align - 1ULL);
+        total_size_bytes += (copy.size + align - 1) & mask;
+    }
+    frame_stats.downloads += downloads.size();
+    frame_stats.bytes_downloaded += total_size_bytes;
+
     auto download_staging = runtime.DownloadStagingBuffer(total_size_bytes, true);
     boost::container::small_vector<BufferCopy, 4> normalized_copies;
+    boost::container::small_vector<BufferCopy, 4> buffer_copies;
     runtime.PreCopyBarrier();
-    for (auto& [copy, buffer_id] : downloads) {
+    for (size_t i = 0; i < downloads.size(); ++i) {
+        auto& [copy, buffer_id] = downloads[i];
         copy.dst_offset += download_staging.offset;
-        const std::array copies{copy};
         BufferCopy second_copy{copy};
         Buffer& buffer = slot_buffers[buffer_id];
         second_copy.src_offset = static_cast<size_t>(buffer.CpuAddr()) + copy.src_offset;
         const DAddr orig_device_addr = static_cast<DAddr>(second_copy.src_offset);
         async_downloads.Add(orig_device_addr, copy.size);
         buffer.MarkUsage(copy.src_offset, copy.size);
-        runtime.CopyBuffer(download_staging.buffer, buffer, copies, false);
         normalized_copies.push_back(second_copy);
+        buffer_copies.push_back(copy);
+        if (i + 1 < downloads.size() && downloads[i + 1].second == buffer_id) {
+            continue;
+        }
+        const std::span<const BufferCopy> copies(buffer_copies.data(), buffer_copies.size());
+        runtime.CopyBuffer(download_staging.buffer, buffer, copies, false);
+        buffer_copies.clear();
     }
     runtime.PostCopyBarrier();
     pending_downloads.emplace_back(std::move(normalized_copies));
@@ -698,6 +826,7 @@ void BufferCache<P>::BindHostIndexBuffer() {
         } else {
             buffer.ImmediateUpload(0, draw_state.inline_index_draw_indexes);
         }
+        MarkBufferModified(buffer);
     } else {
         SynchronizeBuffer(buffer, channel_state->index_buffer.device_addr, size);
     }
@@ -818,6 +947,7 @@ void BufferCache<P>::BindHostGraphicsUniformBuffer(size_t stage, u32 index, u32
         }
         // Stream buffer path to avoid stalling on non-Nvidia drivers or Vulkan
         const std::span<u8> span = runtime.BindMappedUniformBuffer(stage, binding_index, size);
+        RecordRead(device_addr, size);
         device_memory.ReadBlockUnsafe(device_addr, span.data(), size);
         return;
     }
@@ -882,6 +1012,9 @@ void BufferCache<P>::BindHostGraphicsStorageBuffers(size_t stage) {
             runtime.BindStorageBuffer(buffer, offset, size, is_written);
         }
     });
+    if constexpr (HAS_STORAGE_BUFFER_TABLE) {
+        runtime.FinishStorageBuffers();
+    }
 }
 
 template <class P>
@@ -995,6 +1128,9 @@ void BufferCache<P>::BindHostComputeStorageBuffers() {
             runtime.BindStorageBuffer(buffer, offset, size, is_written);
         }
     });
+    if constexpr (HAS_STORAGE_BUFFER_TABLE) {
+        runtime.FinishStorageBuffers();
+    }
 }
 
 template <class P>
@@ -1263,6 +1399,7 @@ void BufferCache<P>::UpdateComputeTextureBuffers() {
 
 template <class P>
 void BufferCache<P>::MarkWrittenBuffer(BufferId buffer_id, DAddr device_addr, u32 size) {
+    MarkBufferModified(slot_buffers[buffer_id]);
     memory_tracker.MarkRegionAsGpuModified(device_addr, size);
     gpu_modified_ranges.Add(device_addr, size);
     uncommitted_gpu_modified_ranges.Add(device_addr, size);
@@ -1371,6 +1508,12 @@ void BufferCache<P>::JoinOverlap(BufferId new_buffer_id, BufferId overlap_id,
     if (accumulate_stream_score) {
         new_buffer.IncreaseStreamScore(overlap.StreamScore() + 1);
     }
+    if (new_buffer.IsHostMemory()) {
+        // Imported buffers are only created over ranges without GPU modifications, so guest
+        // memory already holds the contents of the overlap
+        DeleteBuffer(overlap_id, true);
+        return;
+    }
     boost::container::small_vector<BufferCopy, 10> copies;
     const size_t dst_base_offset = overlap.CpuAddr() - new_buffer.CpuAddr();
     copies.push_back(BufferCopy{
@@ -1378,6 +1521,8 @@ void BufferCache<P>::JoinOverlap(BufferId new_buffer_id, BufferId overlap_id,
         .dst_offset = dst_base_offset,
         .size = overlap.SizeBytes(),
     });
+    ++frame_stats.joins;
+    frame_stats.bytes_copied += overlap.SizeBytes();
     new_buffer.MarkUsage(copies[0].dst_offset, copies[0].size);
     runtime.CopyBuffer(new_buffer, overlap, copies, true);
     DeleteBuffer(overlap_id, true);
@@ -1389,12 +1534,25 @@ BufferId BufferCache<P>::CreateBuffer(DAddr device_addr, u32 wanted_size) {
     device_addr = Common::AlignDown(device_addr, CACHING_PAGESIZE);
     wanted_size = static_cast<u32>(device_addr_end - device_addr);
     const OverlapResult overlap = ResolveOverlaps(device_addr, wanted_size);
+    if constexpr (HAS_RESERVED_BUFFERS) {
+        if (const std::optional<BufferId> grown_id = GrowBuffer(overlap)) {
+            return *grown_id;
+        }
+    }
     const u32 size = static_cast<u32>(overlap.end - overlap.begin);
-    const BufferId new_buffer_id = slot_buffers.insert(runtime, overlap.begin, size);
+    const BufferCreateHints hints{
+        .host_pointer = FindImportableHostMemory(overlap.begin, size),
+        // Buffers made from joined overlaps are likely to keep growing
+        .reserve = !overlap.ids.empty(),
+    };
+    const BufferId new_buffer_id = slot_buffers.insert(runtime, overlap.begin, size, hints);
     auto& new_buffer = slot_buffers[new_buffer_id];
     const size_t size_bytes = new_buffer.SizeBytes();
-    runtime.ClearBuffer(new_buffer, 0, size_bytes, 0);
+    if (!new_buffer.IsHostMemory()) {
+        runtime.ClearBuffer(new_buffer, 0, size_bytes, 0);
+    }
     new_buffer.MarkUsage(0, size_bytes);
+    MarkBufferModified(new_buffer);
     for (const BufferId overlap_id : overlap.ids) {
         JoinOverlap(new_buffer_id, overlap_id, !overlap.has_stream_leap);
     }
@@ -1403,6 +1561,80 @@ BufferId BufferCache<P>::CreateBuffer(DAddr device_addr, u32 wanted_size) {
     return new_buffer_id;
 }
 
+template <class P>
+std::optional<BufferId> BufferCache<P>::GrowBuffer(const OverlapResult& overlap) {
+    if constexpr (HAS_RESERVED_BUFFERS) {
+        // Only the buffer starting the range keeps its offsets valid when it grows
+        const auto it = std::ranges::find_if(overlap.ids, [&](BufferId overlap_id) {
+            return slot_buffers[overlap_id].CpuAddr() == overlap.begin;
+        });
+        if (it == overlap.ids.end()) {
+            return std::nullopt;
+        }
+        const BufferId buffer_id = *it;
+        Buffer& buffer = slot_buffers[buffer_id];
+        const u64 old_size = buffer.SizeBytes();
+        const u64 new_size = overlap.end - overlap.begin;
+        if (!buffer.CanGrow(new_size)) {
+            return std::nullopt;
+        }
+        Unregister(buffer_id);
+        buffer.Unpick();
+        buffer.Grow(new_size);
+        if (!overlap.has_stream_leap) {
+            buffer.IncreaseStreamScore(1);
+        }
+        runtime.ClearBuffer(buffer, static_cast<u32>(old_size), new_size - old_size, 0);
+        buffer.MarkUsage(old_size, new_size - old_size);
+        MarkBufferModified(buffer);
+        for (const BufferId overlap_id : overlap.ids) {
+            if (overlap_id != buffer_id) {
+                JoinOverlap(buffer_id, overlap_id, !overlap.has_stream_leap);
+            }
+        }
+        Register(buffer_id);
+        TouchBuffer(buffer, buffer_id);
+        ++frame_stats.grows;
+        return buffer_id;
+    }
+    return std::nullopt;
+}
+
+template <class P>
+void BufferCache<P>::RecordRead(DAddr device_addr, u64 size) {
+    if (capture) [[unlikely]] {
+        capture->RecordRead(device_addr, size);
+    }
+}
+
+template <class P>
+u8* BufferCache<P>::FindImportableHostMemory(DAddr device_addr, u32 size) {
+    if constexpr (HAS_HOST_MEMORY_IMPORT) {
+        // The host GPU reads imported memory directly, a capture would never see those reads
+        if (!runtime.CanImportHostMemory() || capture) {
+            return nullptr;
+        }
+        // Only import read-mostly memory, GPU written ranges are better served by a cached copy
+        if (memory_tracker.IsRegionGpuModified(device_addr, size)) {
+            return nullptr;
+        }
+        u8* const host_pointer = device_memory.GetPointer<u8>(device_addr);
+        const u64 alignment = runtime.GetHostMemoryImportAlignment();
+        if (!host_pointer || reinterpret_cast<uintptr_t>(host_pointer) % alignment != 0 ||
+            size % alignment != 0) {
+            return nullptr;
+        }
+        // Device pages can map anywhere in guest memory, the whole range has to be contiguous
+        for (u32 offset = DEVICE_PAGESIZE; offset < size; offset += DEVICE_PAGESIZE) {
+            if (device_memory.GetPointer<u8>(device_addr + offset) != host_pointer + offset) {
+                return nullptr;
+            }
+        }
+        return host_pointer;
+    }
+    return nullptr;
+}
+
 template <class P>
 void BufferCache<P>::Register(BufferId buffer_id) {
     ChangeRegister<true>(buffer_id);
@@ -1420,9 +1652,11 @@ void BufferCache<P>::ChangeRegister(BufferId buffer_id) {
     const auto size = buffer.SizeBytes();
     if (insert) {
         total_used_memory += Common::AlignUp(size, 1024);
+        resident_memory += Common::AlignUp(size, 1024);
         buffer.setLRUID(lru_cache.Insert(buffer_id, frame_tick));
     } else {
         total_used_memory -= Common::AlignUp(size, 1024);
+        resident_memory -= Common::AlignUp(size, 1024);
         lru_cache.Free(buffer.getLRUID());
     }
     const DAddr device_addr_begin = buffer.CpuAddr();
@@ -1447,7 +1681,11 @@ void BufferCache<P>::TouchBuffer(Buffer& buffer, BufferId buffer_id) noexcept {
 
 template <class P>
 bool BufferCache<P>::SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 size) {
-    boost::container::small_vector<BufferCopy, 4> copies;
+    if (buffer.IsHostMemory()) {
+        // The GPU reads guest memory directly, CPU writes are left untracked
+        return true;
+    }
+    auto copies = Common::MakeFrameSmallVector<BufferCopy, 4>(frame_arena);
     u64 total_size_bytes = 0;
     u64 largest_copy = 0;
     DAddr buffer_start = buffer.CpuAddr();
@@ -1471,6 +1709,12 @@ bool BufferCache<P>::SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 si
 template <class P>
 void BufferCache<P>::UploadMemory(Buffer& buffer, u64 total_size_bytes, u64 largest_copy,
                                   std::span<BufferCopy> copies) {
+    MarkBufferModified(buffer);
+    if (capture) [[unlikely]] {
+        for (const BufferCopy& copy : copies) {
+            RecordRead(buffer.CpuAddr() + copy.dst_offset, copy.size);
+        }
+    }
     if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
         MappedUploadMemory(buffer, total_size_bytes, copies);
     } else {
@@ -1527,16 +1771,12 @@ void BufferCache<P>::MappedUploadMemory([[maybe_unused]] Buffer& buffer,
 template <class P>
 bool BufferCache<P>::InlineMemory(DAddr dest_address, size_t copy_size,
                                   std::span<const u8> inlined_buffer) {
-    const bool is_dirty = IsRegionRegistered(dest_address, copy_size);
-    if (!is_dirty) {
+    if (!IsRegionRegistered(dest_address, copy_size)) {
         return false;
     }
-    DAddr aligned_start = Common::AlignDown(dest_address, DEVICE_PAGESIZE);
-    DAddr aligned_end = Common::AlignUp(dest_address + copy_size, DEVICE_PAGESIZE);
-    if (!IsRegionGpuModified(aligned_start, aligned_end - aligned_start)) {
-        return false;
-    }
-
+    // The inlined data is known here, so record it as a staging copy into the cached buffer
+    // instead of marking the region as CPU modified and reading it back from guest memory on the
+    // next bind. This also keeps GPU modified contents around the written range intact.
     InlineMemoryImplementation(dest_address, copy_size, inlined_buffer);
 
     return true;
@@ -1550,7 +1790,12 @@ void BufferCache<P>::InlineMemoryImplementation(DAddr dest_address, size_t copy_
 
     BufferId buffer_id = FindBuffer(dest_address, static_cast<u32>(copy_size));
     auto& buffer = slot_buffers[buffer_id];
+    if (buffer.IsHostMemory()) {
+        // The inlined data has already been written to guest memory
+        return;
+    }
     SynchronizeBuffer(buffer, dest_address, static_cast<u32>(copy_size));
+    MarkBufferModified(buffer);
 
     if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
         auto upload_staging = runtime.UploadStagingBuffer(copy_size);
@@ -1757,6 +2002,7 @@ TextureBufferBinding BufferCache<P>::GetTextureBufferBinding(GPUVAddr gpu_addr,
 
 template <class P>
 std::span<const u8> BufferCache<P>::ImmediateBufferWithData(DAddr device_addr, size_t size) {
+    RecordRead(device_addr, size);
     u8* const base_pointer = device_memory.GetPointer<u8>(device_addr);
     if (IsRangeGranular(device_addr, size) ||
         base_pointer + size == device_memory.GetPointer<u8>(device_addr + size)) {
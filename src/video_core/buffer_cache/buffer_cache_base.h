@@ -9,12 +9,14 @@
 #include <memory>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <span>
 #include <unordered_map>
 #include <vector>
 
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "common/frame_arena.h"
 #include "common/literals.h"
 #include "common/lru_cache.h"
 #include "common/microprofile.h"
@@ -22,6 +24,7 @@
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "common/slot_vector.h"
+#include "common/sorted_range_set.h"
 #include "video_core/buffer_cache/buffer_base.h"
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/delayed_destruction_ring.h"
@@ -29,12 +32,22 @@
 #include "video_core/engines/draw_manager.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/engines/maxwell_dma.h"
 #include "video_core/memory_manager.h"
+#include "video_core/memory_budget.h"
+#include "video_core/memory_stats.h"
 #include "video_core/surface.h"
 #include "video_core/texture_cache/types.h"
 
+namespace VideoCore {
+class MemoryBudget;
+class MemoryStats;
+}
+
 namespace VideoCommon {
 
+class GpuCaptureWriter;
+
 MICROPROFILE_DECLARE(GPU_PrepareBuffers);
 MICROPROFILE_DECLARE(GPU_BindUploadBuffers);
 MICROPROFILE_DECLARE(GPU_DownloadMemory);
@@ -169,6 +182,9 @@ class BufferCache : public VideoCommon::ChannelSetupCaches<BufferCacheChannelInf
     static constexpr bool USE_MEMORY_MAPS = P::USE_MEMORY_MAPS;
     static constexpr bool SEPARATE_IMAGE_BUFFERS_BINDINGS = P::SEPARATE_IMAGE_BUFFER_BINDINGS;
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = P::USE_MEMORY_MAPS_FOR_UPLOADS;
+    static constexpr bool HAS_HOST_MEMORY_IMPORT = P::HAS_HOST_MEMORY_IMPORT;
+    static constexpr bool HAS_RESERVED_BUFFERS = P::HAS_RESERVED_BUFFERS;
+    static constexpr bool HAS_STORAGE_BUFFER_TABLE = P::HAS_STORAGE_BUFFER_TABLE;
 
     static constexpr s64 DEFAULT_EXPECTED_MEMORY = 512_MiB;
     static constexpr s64 DEFAULT_CRITICAL_MEMORY = 1_GiB;
@@ -193,14 +209,24 @@ class BufferCache : public VideoCommon::ChannelSetupCaches<BufferCacheChannelInf
     };
 
 public:
-    explicit BufferCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, Runtime& runtime_);
+    explicit BufferCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, Runtime& runtime_,
+                         VideoCore::MemoryStats& memory_stats_,
+                         VideoCore::MemoryBudget& global_budget_);
 
     ~BufferCache();
 
+    /// Records the guest memory uploaded to buffers into a capture
+    void BindCapture(GpuCaptureWriter* capture_) {
+        capture = capture_;
+    }
+
     void TickFrame();
 
     void WriteMemory(DAddr device_addr, u64 size);
 
+    /// Marks the region as CPU written and drops buffers that imported its old backing memory
+    void UnmapMemory(DAddr device_addr, u64 size);
+
     void CachedWriteMemory(DAddr device_addr, u64 size);
 
     bool OnCPUWrite(DAddr device_addr, u64 size);
@@ -209,6 +235,8 @@ public:
 
     std::optional<VideoCore::RasterizerDownloadArea> GetFlushArea(DAddr device_addr, u64 size);
 
+    /// Writes inlined data directly into the cached buffer backing the destination, if any.
+    /// Returns false when no buffer is registered there and the caller has to invalidate instead.
     bool InlineMemory(DAddr dest_address, size_t copy_size, std::span<const u8> inlined_buffer);
 
     void BindGraphicsUniformBuffer(size_t stage, u32 index, GPUVAddr gpu_addr, u32 size);
@@ -279,6 +307,9 @@ public:
 
     bool DMAClear(GPUVAddr src_address, u64 amount, u32 value);
 
+    /// Runs the layout conversion of a DMA copy between cached buffers on the host GPU
+    bool DMALayoutCopy(const Tegra::DMA::LayoutCopy& copy);
+
     /// Return true when a CPU region is modified from the GPU
     [[nodiscard]] bool IsRegionGpuModified(DAddr addr, size_t size);
 
@@ -341,7 +372,11 @@ private:
                ((device_addr + size) & ~Core::DEVICE_PAGEMASK);
     }
 
-    void RunGarbageCollector();
+    /// Derives the garbage collection thresholds from the device memory the cache may use
+    void ConfigureMemoryThresholds(u64 budget);
+
+    /// Evicts old buffers, going on until at least budget_share bytes are freed
+    void RunGarbageCollector(u64 budget_share);
 
     void BindHostIndexBuffer();
 
@@ -395,6 +430,11 @@ private:
 
     void MarkWrittenBuffer(BufferId buffer_id, DAddr device_addr, u32 size);
 
+    /// Stamps the buffer with a new modification tick, invalidating data derived from it
+    void MarkBufferModified(Buffer& buffer) {
+        buffer.SetModificationTick(++modification_tick);
+    }
+
     [[nodiscard]] BufferId FindBuffer(DAddr device_addr, u32 size);
 
     [[nodiscard]] OverlapResult ResolveOverlaps(DAddr device_addr, u32 wanted_size);
@@ -403,6 +443,12 @@ private:
 
     [[nodiscard]] BufferId CreateBuffer(DAddr device_addr, u32 wanted_size);
 
+    /// Extends the overlap starting the range in place, returns the buffer when it could
+    [[nodiscard]] std::optional<BufferId> GrowBuffer(const OverlapResult& overlap);
+
+    /// Returns the host pointer backing the range when it can be imported, null otherwise
+    [[nodiscard]] u8* FindImportableHostMemory(DAddr device_addr, u32 size);
+
     void Register(BufferId buffer_id);
 
     void Unregister(BufferId buffer_id);
@@ -445,7 +491,13 @@ private:
     void InlineMemoryImplementation(DAddr dest_address, size_t copy_size,
                                     std::span<const u8> inlined_buffer);
 
+    /// Records a read of guest memory into the capture, if there is one
+    void RecordRead(DAddr device_addr, u64 size);
+
     Tegra::MaxwellDeviceMemoryManager& device_memory;
+    GpuCaptureWriter* capture = nullptr;
+    VideoCore::MemoryStats& memory_stats;
+    VideoCore::MemoryBudget& global_budget;
 
     Common::SlotVector<Buffer> slot_buffers;
     DelayedDestructionRing<Buffer, 8> delayed_destruction_ring;
@@ -455,9 +507,9 @@ private:
     u32 last_index_count = 0;
 
     MemoryTracker memory_tracker;
-    Common::RangeSet<DAddr> uncommitted_gpu_modified_ranges;
-    Common::RangeSet<DAddr> gpu_modified_ranges;
-    std::deque<Common::RangeSet<DAddr>> committed_gpu_modified_ranges;
+    Common::SortedRangeSet<DAddr> uncommitted_gpu_modified_ranges;
+    Common::SortedRangeSet<DAddr> gpu_modified_ranges;
+    std::deque<Common::SortedRangeSet<DAddr>> committed_gpu_modified_ranges;
 
     // Async Buffers
     Common::OverlapRangeSet<DAddr> async_downloads;
@@ -476,7 +528,14 @@ private:
     };
     Common::LeastRecentlyUsedCache<LRUItemParams> lru_cache;
     u64 frame_tick = 0;
+    VideoCore::BufferCacheStats frame_stats{};
+    /// Transient containers of the current frame, reclaimed by TickFrame
+    Common::FrameArena frame_arena;
+    u64 modification_tick = 0;
     u64 total_used_memory = 0;
+    /// Bytes held by the buffers of this cache, total_used_memory is device wide when reported
+    u64 resident_memory = 0;
+    u64 memory_budget = 0;
     u64 minimum_memory = 0;
     u64 critical_memory = 0;
     BufferId inline_buffer_id;
@@ -227,6 +227,75 @@ public:
         }
     }
 
+    /**
+     * Returns the index of the first word in [index, end) with any bit set in either state,
+     * testing 256 bits at a time while the words are clean.
+     */
+    static size_t FindDirtyWord(std::span<const u64> state_a, std::span<const u64> state_b,
+                                size_t index, size_t end) noexcept {
+        static constexpr size_t WORDS_PER_STEP = 4;
+        for (; index + WORDS_PER_STEP <= end; index += WORDS_PER_STEP) {
+            u64 bits = 0;
+            for (size_t step = 0; step < WORDS_PER_STEP; ++step) {
+                bits |= state_a[index + step] | state_b[index + step];
+            }
+            if (bits != 0) {
+                break;
+            }
+        }
+        while (index < end && (state_a[index] | state_b[index]) == 0) {
+            ++index;
+        }
+        return index;
+    }
+
+    /**
+     * Like IterateWords, but skips the words fully inside the range that have no bits set in
+     * either state. Callers pass the states that have to be non-zero for func to have effects.
+     */
+    template <typename Func>
+    void IterateDirtyWords(size_t offset, size_t size, std::span<const u64> state_a,
+                           std::span<const u64> state_b, Func&& func) const {
+        using FuncReturn = std::invoke_result_t<Func, std::size_t, u64>;
+        static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
+        const size_t start = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset), 0LL));
+        const size_t end = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset + size), 0LL));
+        if (start >= SizeBytes() || end <= start) {
+            return;
+        }
+        auto [start_word, start_page] = GetWordPage(start);
+        auto [end_word, end_page] = GetWordPage(end + BYTES_PER_PAGE - 1ULL);
+        const size_t num_words = NumWords();
+        start_word = std::min(start_word, num_words);
+        end_word = std::min(end_word, num_words);
+        const size_t diff = end_word - start_word;
+        end_word += (end_page + PAGES_PER_WORD - 1ULL) / PAGES_PER_WORD;
+        end_word = std::min(end_word, num_words);
+        end_page += diff * PAGES_PER_WORD;
+        constexpr u64 base_mask{~0ULL};
+        for (size_t word_index = start_word; word_index < end_word; word_index++) {
+            if (start_page == 0 && end_page >= PAGES_PER_WORD) {
+                const size_t full_end = std::min(end_word, word_index + end_page / PAGES_PER_WORD);
+                const size_t dirty_index = FindDirtyWord(state_a, state_b, word_index, full_end);
+                end_page -= (dirty_index - word_index) * PAGES_PER_WORD;
+                word_index = dirty_index;
+                if (word_index == end_word) {
+                    return;
+                }
+            }
+            const u64 mask = ExtractBits(base_mask, start_page, end_page);
+            start_page = 0;
+            end_page -= PAGES_PER_WORD;
+            if constexpr (BOOL_BREAK) {
+                if (func(word_index, mask)) {
+                    return;
+                }
+            } else {
+                func(word_index, mask);
+            }
+        }
+    }
+
     template <typename Func>
     void IteratePages(u64 mask, Func&& func) const {
         size_t offset = 0;
@@ -253,7 +322,7 @@ public:
         std::span<u64> state_words = words.template Span<type>();
         [[maybe_unused]] std::span<u64> untracked_words = words.template Span<Type::Untracked>();
         [[maybe_unused]] std::span<u64> cached_words = words.template Span<Type::CachedCPU>();
-        IterateWords(dirty_addr - cpu_addr, size, [&](size_t index, u64 mask) {
+        const auto change = [&](size_t index, u64 mask) {
             if constexpr (type == Type::CPU || type == Type::CachedCPU) {
                 NotifyRasterizer<!enable>(index, untracked_words[index], mask);
             }
@@ -275,7 +344,15 @@ public:
                     untracked_words[index] &= ~mask;
                 }
             }
-        });
+        };
+        if constexpr (enable) {
+            IterateWords(dirty_addr - cpu_addr, size, change);
+        } else {
+            // Unmarking only has effects on words with pages set in this state, or untracked
+            // pages for CPU states
+            IterateDirtyWords(dirty_addr - cpu_addr, size, state_words,
+                              HasTrackerEffects<type>() ? untracked_words : state_words, change);
+        }
     }
 
     /**
@@ -301,7 +378,9 @@ public:
             func(cpu_addr + pending_offset * BYTES_PER_PAGE,
                  (pending_pointer - pending_offset) * BYTES_PER_PAGE);
         };
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        const std::span<const u64> clear_words =
+            clear && HasTrackerEffects<type>() ? untracked_words : state_words;
+        IterateDirtyWords(offset, size, state_words, clear_words, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -356,7 +435,7 @@ public:
         [[maybe_unused]] const std::span<const u64> untracked_words =
             words.template Span<Type::Untracked>();
         bool result = false;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        IterateDirtyWords(offset, size, state_words, state_words, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -384,7 +463,7 @@ public:
             words.template Span<Type::Untracked>();
         u64 begin = std::numeric_limits<u64>::max();
         u64 end = 0;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        IterateDirtyWords(offset, size, state_words, state_words, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -458,6 +537,12 @@ private:
         }
     }
 
+    /// Returns true when changing the state also changes the pages tracked by the rasterizer
+    template <Type type>
+    static constexpr bool HasTrackerEffects() noexcept {
+        return type == Type::CPU || type == Type::CachedCPU;
+    }
+
     /**
      * Notify tracker about changes in the CPU tracking state of a word in the buffer
      *
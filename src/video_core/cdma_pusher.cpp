@@ -1,7 +1,12 @@
 // SPDX-FileCopyrightText: Ryujinx Team and Contributors
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
 #include <bit>
+
+#include "common/microprofile.h"
+#include "common/settings.h"
+#include "common/thread.h"
 #include "video_core/cdma_pusher.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/host1x/control.h"
@@ -12,30 +17,78 @@
 #include "video_core/host1x/vic.h"
 #include "video_core/memory_manager.h"
 
+MICROPROFILE_DEFINE(Host1x_CdmaExecute, "Host1x", "Execute CDMA command list",
+                    MP_RGB(128, 160, 128));
+
 namespace Tegra {
 CDmaPusher::CDmaPusher(Host1x::Host1x& host1x_)
     : host1x{host1x_}, nvdec_processor(std::make_shared<Host1x::Nvdec>(host1x)),
       vic_processor(std::make_unique<Host1x::Vic>(host1x, nvdec_processor)),
       host1x_processor(std::make_unique<Host1x::Control>(host1x)),
-      sync_manager(std::make_unique<Host1x::SyncptIncrManager>(host1x)) {}
+      sync_manager(std::make_unique<Host1x::SyncptIncrManager>(host1x)) {
+    if (Settings::values.use_asynchronous_nvdec.GetValue()) {
+        // Syncpoint waits of one client no longer hold up the others or the submitting thread
+        thread = std::jthread([this](std::stop_token stop_token) { ProcessThread(stop_token); });
+    }
+}
 
-CDmaPusher::~CDmaPusher() = default;
+CDmaPusher::~CDmaPusher() {
+    if (thread.joinable()) {
+        thread.request_stop();
+        thread.join();
+        // Run what was left behind, it may increment syncpoints the guest waits for
+        ChCommandHeaderList entries;
+        while (entries_queue.TryPop(entries)) {
+            ExecuteEntries(entries);
+        }
+    }
+    // The engines' threads signal the sync manager, stop them before it goes away
+    vic_processor.reset();
+    nvdec_processor.reset();
+}
 
 void CDmaPusher::ProcessEntries(ChCommandHeaderList&& entries) {
-    for (const auto& value : entries) {
+    if (!thread.joinable()) {
+        host1x.VideoStats().Report({.command_lists = 1});
+        ExecuteEntries(entries);
+        return;
+    }
+    entries_queue.EmplaceWait(std::move(entries));
+    host1x.VideoStats().Report({
+        .command_lists = 1,
+        .max_command_queue = entries_queue.Size(),
+    });
+}
+
+void CDmaPusher::ProcessThread(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("Host1xCdma");
+    while (!stop_token.stop_requested()) {
+        // Nothing is popped when the wait is stopped, the destructor drains what's left
+        ChCommandHeaderList entries;
+        entries_queue.PopWait(entries, stop_token);
+        ExecuteEntries(entries);
+    }
+}
+
+void CDmaPusher::ExecuteEntries(std::span<const ChCommandHeader> entries) {
+    MICROPROFILE_SCOPE(Host1x_CdmaExecute);
+    size_t index = 0;
+    while (index < entries.size()) {
         if (mask != 0) {
             const auto lbs = static_cast<u32>(std::countr_zero(mask));
             mask &= ~(1U << lbs);
-            ExecuteCommand(offset + lbs, value.raw);
+            ExecuteCommand(offset + lbs, entries[index++].raw);
             continue;
-        } else if (count != 0) {
-            --count;
-            ExecuteCommand(offset, value.raw);
-            if (incrementing) {
-                ++offset;
-            }
+        }
+        if (count != 0) {
+            // Runs may continue in the next list, execute what this one holds at once
+            const u32 run = static_cast<u32>(std::min<size_t>(count, entries.size() - index));
+            ExecuteRun(entries.subspan(index, run));
+            index += run;
+            count -= run;
             continue;
         }
+        const ChCommandHeader value = entries[index++];
         const auto mode = value.submission_mode.Value();
         switch (mode) {
         case ChSubmissionMode::SetClass: {
@@ -67,61 +120,45 @@ void CDmaPusher::ProcessEntries(ChCommandHeaderList&& entries) {
     }
 }
 
+void CDmaPusher::ExecuteRun(std::span<const ChCommandHeader> words) {
+    // The class can't change within a run, dispatch on it once
+    const auto for_each_write = [&](auto&& func) {
+        for (const ChCommandHeader word : words) {
+            func(offset, word.raw);
+            if (incrementing) {
+                ++offset;
+            }
+        }
+    };
+    switch (current_class) {
+    case ChClassId::NvDec:
+        for_each_write([this](u32 state_offset, u32 data) {
+            ExecuteNvdecCommand(state_offset, data);
+        });
+        break;
+    case ChClassId::GraphicsVic:
+        for_each_write([this](u32 state_offset, u32 data) {
+            ExecuteVicCommand(state_offset, data);
+        });
+        break;
+    default:
+        for_each_write([this](u32 state_offset, u32 data) { ExecuteCommand(state_offset, data); });
+        break;
+    }
+}
+
 void CDmaPusher::ExecuteCommand(u32 state_offset, u32 data) {
     switch (current_class) {
     case ChClassId::NvDec:
-        ThiStateWrite(nvdec_thi_state, offset, data);
-        switch (static_cast<ThiMethod>(offset)) {
-        case ThiMethod::IncSyncpt: {
-            LOG_DEBUG(Service_NVDRV, "NVDEC Class IncSyncpt Method");
-            const auto syncpoint_id = static_cast<u32>(data & 0xFF);
-            const auto cond = static_cast<u32>((data >> 8) & 0xFF);
-            if (cond == 0) {
-                sync_manager->Increment(syncpoint_id);
-            } else {
-                sync_manager->SignalDone(
-                    sync_manager->IncrementWhenDone(static_cast<u32>(current_class), syncpoint_id));
-            }
-            break;
-        }
-        case ThiMethod::SetMethod1:
-            LOG_DEBUG(Service_NVDRV, "NVDEC method 0x{:X}",
-                      static_cast<u32>(nvdec_thi_state.method_0));
-            nvdec_processor->ProcessMethod(nvdec_thi_state.method_0, data);
-            break;
-        default:
-            break;
-        }
+        ExecuteNvdecCommand(state_offset, data);
         break;
     case ChClassId::GraphicsVic:
-        ThiStateWrite(vic_thi_state, static_cast<u32>(state_offset), {data});
-        switch (static_cast<ThiMethod>(state_offset)) {
-        case ThiMethod::IncSyncpt: {
-            LOG_DEBUG(Service_NVDRV, "VIC Class IncSyncpt Method");
-            const auto syncpoint_id = static_cast<u32>(data & 0xFF);
-            const auto cond = static_cast<u32>((data >> 8) & 0xFF);
-            if (cond == 0) {
-                sync_manager->Increment(syncpoint_id);
-            } else {
-                sync_manager->SignalDone(
-                    sync_manager->IncrementWhenDone(static_cast<u32>(current_class), syncpoint_id));
-            }
-            break;
-        }
-        case ThiMethod::SetMethod1:
-            LOG_DEBUG(Service_NVDRV, "VIC method 0x{:X}, Args=({})",
-                      static_cast<u32>(vic_thi_state.method_0), data);
-            vic_processor->ProcessMethod(static_cast<Host1x::Vic::Method>(vic_thi_state.method_0),
-                                         data);
-            break;
-        default:
-            break;
-        }
+        ExecuteVicCommand(state_offset, data);
         break;
     case ChClassId::Control:
         // This device is mainly for syncpoint synchronization
         LOG_DEBUG(Service_NVDRV, "Host1X Class Method");
-        host1x_processor->ProcessMethod(static_cast<Host1x::Control::Method>(offset), data);
+        host1x_processor->ProcessMethod(static_cast<Host1x::Control::Method>(state_offset), data);
         break;
     default:
         UNIMPLEMENTED_MSG("Current class not implemented {:X}", static_cast<u32>(current_class));
@@ -129,6 +166,60 @@ void CDmaPusher::ExecuteCommand(u32 state_offset, u32 data) {
     }
 }
 
+void CDmaPusher::ExecuteNvdecCommand(u32 state_offset, u32 data) {
+    ThiStateWrite(nvdec_thi_state, state_offset, data);
+    switch (static_cast<ThiMethod>(state_offset)) {
+    case ThiMethod::IncSyncpt: {
+        LOG_DEBUG(Service_NVDRV, "NVDEC Class IncSyncpt Method");
+        const auto syncpoint_id = static_cast<u32>(data & 0xFF);
+        const auto cond = static_cast<u32>((data >> 8) & 0xFF);
+        if (cond == 0) {
+            sync_manager->Increment(syncpoint_id);
+        } else {
+            // Incremented once the frames submitted so far are decoded
+            const u32 handle =
+                sync_manager->IncrementWhenDone(static_cast<u32>(current_class), syncpoint_id);
+            nvdec_processor->SignalWhenDone([this, handle] { sync_manager->SignalDone(handle); });
+        }
+        break;
+    }
+    case ThiMethod::SetMethod1:
+        LOG_DEBUG(Service_NVDRV, "NVDEC method 0x{:X}", static_cast<u32>(nvdec_thi_state.method_0));
+        nvdec_processor->ProcessMethod(nvdec_thi_state.method_0, data);
+        break;
+    default:
+        break;
+    }
+}
+
+void CDmaPusher::ExecuteVicCommand(u32 state_offset, u32 data) {
+    ThiStateWrite(vic_thi_state, state_offset, data);
+    switch (static_cast<ThiMethod>(state_offset)) {
+    case ThiMethod::IncSyncpt: {
+        LOG_DEBUG(Service_NVDRV, "VIC Class IncSyncpt Method");
+        const auto syncpoint_id = static_cast<u32>(data & 0xFF);
+        const auto cond = static_cast<u32>((data >> 8) & 0xFF);
+        if (cond == 0) {
+            sync_manager->Increment(syncpoint_id);
+        } else {
+            // Incremented once the frames executed so far are written to their surfaces
+            const u32 handle =
+                sync_manager->IncrementWhenDone(static_cast<u32>(current_class), syncpoint_id);
+            vic_processor->SignalWhenDone([this, handle] { sync_manager->SignalDone(handle); });
+        }
+        break;
+    }
+    case ThiMethod::SetMethod1:
+        LOG_DEBUG(Service_NVDRV, "VIC method 0x{:X}, Args=({})",
+                  static_cast<u32>(vic_thi_state.method_0), data);
+        vic_processor->ProcessMethod(static_cast<Host1x::Vic::Method>(vic_thi_state.method_0),
+                                     data);
+        break;
+    default:
+        break;
+    }
+}
+
 void CDmaPusher::ThiStateWrite(ThiRegisters& state, u32 state_offset, u32 argument) {
     u8* const offset_ptr = reinterpret_cast<u8*>(&state) + sizeof(u32) * state_offset;
     std::memcpy(offset_ptr, &argument, sizeof(u32));
@@ -4,11 +4,14 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "common/bit_field.h"
+#include "common/bounded_threadsafe_queue.h"
 #include "common/common_funcs.h"
 #include "common/common_types.h"
+#include "common/polyfill_thread.h"
 
 namespace Tegra {
 
@@ -92,13 +95,27 @@ public:
     explicit CDmaPusher(Host1x::Host1x& host1x);
     ~CDmaPusher();
 
-    /// Process the command entry
+    /// Process the command entries, on the pusher's own thread when decoding asynchronously.
+    /// Entries are always processed in submission order.
     void ProcessEntries(ChCommandHeaderList&& entries);
 
 private:
+    /// Decodes the entries, writes of the same run are executed together
+    void ExecuteEntries(std::span<const ChCommandHeader> entries);
+
+    /// Executes the data words of an incrementing or non-incrementing run
+    void ExecuteRun(std::span<const ChCommandHeader> words);
+
     /// Invoke command class devices to execute the command based on the current state
     void ExecuteCommand(u32 state_offset, u32 data);
 
+    void ExecuteNvdecCommand(u32 state_offset, u32 data);
+
+    void ExecuteVicCommand(u32 state_offset, u32 data);
+
+    /// Processes the queued entries until stopped
+    void ProcessThread(std::stop_token stop_token);
+
     /// Write arguments value to the ThiRegisters member at the specified offset
     void ThiStateWrite(ThiRegisters& state, u32 offset, u32 argument);
 
@@ -115,6 +132,9 @@ private:
     u32 offset{};
     u32 mask{};
     bool incrementing{};
+
+    Common::SPSCQueue<ChCommandHeaderList> entries_queue;
+    std::jthread thread;
 };
 
 } // namespace Tegra
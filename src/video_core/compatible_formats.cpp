@@ -44,7 +44,7 @@ constexpr std::array VIEW_CLASS_32_BITS{
     PixelFormat::R16G16_UNORM,      PixelFormat::A8B8G8R8_SNORM,  PixelFormat::R16G16_SNORM,
     PixelFormat::A8B8G8R8_SRGB,     PixelFormat::E5B9G9R9_FLOAT,  PixelFormat::B8G8R8A8_UNORM,
     PixelFormat::B8G8R8A8_SRGB,     PixelFormat::A8B8G8R8_UINT,   PixelFormat::A8B8G8R8_SINT,
-    PixelFormat::A2B10G10R10_UINT,
+    PixelFormat::A2B10G10R10_UINT,  PixelFormat::A2R10G10B10_UNORM,
 };
 
 constexpr std::array VIEW_CLASS_32_BITS_NO_BGR{
@@ -126,6 +126,11 @@ constexpr std::array VIEW_CLASS_ASTC_8x8_RGBA{
     PixelFormat::ASTC_2D_8X8_SRGB,
 };
 
+constexpr std::array VIEW_CLASS_ASTC_8x6_RGBA{
+    PixelFormat::ASTC_2D_8X6_UNORM,
+    PixelFormat::ASTC_2D_8X6_SRGB,
+};
+
 constexpr std::array VIEW_CLASS_ASTC_10x5_RGBA{
     PixelFormat::ASTC_2D_10X5_UNORM,
     PixelFormat::ASTC_2D_10X5_SRGB,
@@ -228,6 +233,7 @@ constexpr Table MakeViewTable() {
     EnableRange(view, VIEW_CLASS_ASTC_6x5_RGBA);
     EnableRange(view, VIEW_CLASS_ASTC_6x6_RGBA);
     EnableRange(view, VIEW_CLASS_ASTC_8x5_RGBA);
+    EnableRange(view, VIEW_CLASS_ASTC_8x6_RGBA);
     EnableRange(view, VIEW_CLASS_ASTC_8x8_RGBA);
     EnableRange(view, VIEW_CLASS_ASTC_10x5_RGBA);
     EnableRange(view, VIEW_CLASS_ASTC_10x6_RGBA);
@@ -7,6 +7,7 @@
 #include "video_core/control/channel_state.h"
 #include "video_core/control/scheduler.h"
 #include "video_core/gpu.h"
+#include "video_core/gpu_capture.h"
 
 namespace Tegra::Control {
 Scheduler::Scheduler(GPU& gpu_) : gpu{gpu_} {}
@@ -14,11 +15,19 @@ Scheduler::Scheduler(GPU& gpu_) : gpu{gpu_} {}
 Scheduler::~Scheduler() = default;
 
 void Scheduler::Push(s32 channel, CommandList&& entries) {
-    std::unique_lock lk(scheduling_guard);
-    auto it = channels.find(channel);
-    ASSERT(it != channels.end());
-    auto channel_state = it->second;
+    std::shared_ptr<ChannelState> channel_state;
+    {
+        // Only guard the lookup, so declaring new channels doesn't wait for the whole command
+        // list to be dispatched.
+        std::scoped_lock lk(scheduling_guard);
+        auto it = channels.find(channel);
+        ASSERT(it != channels.end());
+        channel_state = it->second;
+    }
     gpu.BindChannel(channel_state->bind_id);
+    if (auto* const capture = gpu.Capture()) {
+        capture->RecordCommandList(channel, entries);
+    }
     channel_state->dma_pusher->Push(std::move(entries));
     channel_state->dma_pusher->DispatchCalls();
 }
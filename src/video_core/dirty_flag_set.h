@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/**
+ * Fixed size set of dirty flags with a summary word tracking which 64-bit words have any flag
+ * set. Testing whether anything in a group of flags is dirty only touches the words the summary
+ * reports as non-empty, so draws with clean state skip their per-flag checks entirely.
+ *
+ * The interface mirrors the subset of std::bitset used by the dirty flag consumers.
+ */
+template <size_t N>
+class DirtyFlagSet {
+    static constexpr size_t BitsPerWord = 64;
+    static constexpr size_t NumWords = (N + BitsPerWord - 1) / BitsPerWord;
+    static_assert(NumWords <= BitsPerWord, "The summary word can't cover this many flags");
+
+public:
+    class Reference {
+    public:
+        Reference& operator=(bool value) {
+            flag_set.Assign(index, value);
+            return *this;
+        }
+
+        Reference& operator=(const Reference& other) {
+            return *this = static_cast<bool>(other);
+        }
+
+        operator bool() const {
+            return flag_set.Test(index);
+        }
+
+    private:
+        friend class DirtyFlagSet;
+
+        explicit Reference(DirtyFlagSet& flag_set_, size_t index_)
+            : flag_set{flag_set_}, index{index_} {}
+
+        DirtyFlagSet& flag_set;
+        size_t index;
+    };
+
+    Reference operator[](size_t index) {
+        return Reference{*this, index};
+    }
+
+    bool operator[](size_t index) const {
+        return Test(index);
+    }
+
+    [[nodiscard]] bool Test(size_t index) const {
+        return (words[index / BitsPerWord] & Mask(index)) != 0;
+    }
+
+    void Assign(size_t index, bool value) {
+        const size_t word = index / BitsPerWord;
+        if (value) {
+            words[word] |= Mask(index);
+            summary |= u64{1} << word;
+#ifdef _DEBUG
+            ++set_counts[index];
+#endif
+        } else {
+            words[word] &= ~Mask(index);
+            if (words[word] == 0) {
+                summary &= ~(u64{1} << word);
+            }
+        }
+    }
+
+    /// Marks every flag as dirty
+    void set() {
+        words.fill(~u64{0});
+        words.back() &= LastWordMask();
+        summary = AllWordsMask();
+    }
+
+    /// Clears every flag
+    void reset() {
+        words.fill(0);
+        summary = 0;
+    }
+
+    void flip() {
+        for (u64& word : words) {
+            word = ~word;
+        }
+        words.back() &= LastWordMask();
+        RebuildSummary();
+    }
+
+    [[nodiscard]] bool any() const {
+        return summary != 0;
+    }
+
+    [[nodiscard]] bool none() const {
+        return summary == 0;
+    }
+
+    [[nodiscard]] static constexpr size_t size() {
+        return N;
+    }
+
+    DirtyFlagSet& operator|=(const DirtyFlagSet& other) {
+        for (size_t i = 0; i < NumWords; ++i) {
+            words[i] |= other.words[i];
+        }
+        summary |= other.summary;
+        return *this;
+    }
+
+    /// Returns true when any of the flags in mask is dirty
+    [[nodiscard]] bool AnyOf(const DirtyFlagSet& mask) const {
+        u64 common_words = summary & mask.summary;
+        while (common_words != 0) {
+            const size_t word = static_cast<size_t>(std::countr_zero(common_words));
+            if ((words[word] & mask.words[word]) != 0) {
+                return true;
+            }
+            common_words &= common_words - 1;
+        }
+        return false;
+    }
+
+    /// Calls func with the index of every dirty flag in ascending order
+    template <typename Func>
+    void ForEachSet(Func&& func) const {
+        u64 pending_words = summary;
+        while (pending_words != 0) {
+            const size_t word = static_cast<size_t>(std::countr_zero(pending_words));
+            u64 bits = words[word];
+            while (bits != 0) {
+                func(word * BitsPerWord + static_cast<size_t>(std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+            pending_words &= pending_words - 1;
+        }
+    }
+
+#ifdef _DEBUG
+    /// Number of times each flag was marked dirty, used to find the state groups that churn most
+    [[nodiscard]] const std::array<u64, N>& SetCounts() const {
+        return set_counts;
+    }
+#endif
+
+private:
+    static constexpr u64 Mask(size_t index) {
+        return u64{1} << (index % BitsPerWord);
+    }
+
+    static constexpr u64 LastWordMask() {
+        constexpr size_t remainder = N % BitsPerWord;
+        return remainder == 0 ? ~u64{0} : (u64{1} << remainder) - 1;
+    }
+
+    static constexpr u64 AllWordsMask() {
+        return NumWords == BitsPerWord ? ~u64{0} : (u64{1} << NumWords) - 1;
+    }
+
+    void RebuildSummary() {
+        summary = 0;
+        for (size_t i = 0; i < NumWords; ++i) {
+            if (words[i] != 0) {
+                summary |= u64{1} << i;
+            }
+        }
+    }
+
+    std::array<u64, NumWords> words{};
+    u64 summary{};
+#ifdef _DEBUG
+    std::array<u64, N> set_counts{};
+#endif
+};
+
+} // namespace VideoCommon
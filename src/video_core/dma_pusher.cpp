@@ -6,6 +6,7 @@
 #include "common/settings.h"
 #include "core/core.h"
 #include "video_core/dma_pusher.h"
+#include "video_core/engines/draw_manager.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/gpu.h"
 #include "video_core/guest_memory.h"
@@ -24,6 +25,8 @@ DmaPusher::DmaPusher(Core::System& system_, GPU& gpu_, MemoryManager& memory_man
 DmaPusher::~DmaPusher() = default;
 
 MICROPROFILE_DEFINE(DispatchCalls, "GPU", "Execute command buffer", MP_RGB(128, 128, 192));
+MICROPROFILE_DEFINE(DmaPusher_ProcessCommandList, "GPU", "Process command list",
+                    MP_RGB(128, 160, 192));
 
 void DmaPusher::DispatchCalls() {
     MICROPROFILE_SCOPE(DispatchCalls);
@@ -37,6 +40,7 @@ void DmaPusher::DispatchCalls() {
             break;
         }
     }
+    FlushDrawBatch();
     gpu.FlushCommands();
     gpu.OnCommandListEnd();
 }
@@ -85,18 +89,12 @@ bool DmaPusher::Step() {
             }
         }
         const auto safe_process = [&] {
-            Tegra::Memory::GpuGuestMemory<Tegra::CommandHeader,
-                                          Tegra::Memory::GuestMemoryFlags::SafeRead>
-                headers(memory_manager, dma_state.dma_get, command_list_header.size,
-                        &command_headers);
-            ProcessCommands(headers);
+            ProcessCommandList<Tegra::Memory::GuestMemoryFlags::SafeRead>(
+                command_list_header.size);
         };
         const auto unsafe_process = [&] {
-            Tegra::Memory::GpuGuestMemory<Tegra::CommandHeader,
-                                          Tegra::Memory::GuestMemoryFlags::UnsafeRead>
-                headers(memory_manager, dma_state.dma_get, command_list_header.size,
-                        &command_headers);
-            ProcessCommands(headers);
+            ProcessCommandList<Tegra::Memory::GuestMemoryFlags::UnsafeRead>(
+                command_list_header.size);
         };
         if (Settings::IsGPULevelHigh()) {
             if (dma_state.method >= MacroRegistersStart) {
@@ -116,6 +114,23 @@ bool DmaPusher::Step() {
     return true;
 }
 
+template <Core::Memory::GuestMemoryFlags FLAGS>
+void DmaPusher::ProcessCommandList(u32 num_words) {
+    MICROPROFILE_SCOPE(DmaPusher_ProcessCommandList);
+
+    // Command lists that are contiguous in host memory are read in place, everything else is
+    // gathered into the command_headers scratch buffer.
+    const Tegra::Memory::GpuGuestMemory<Tegra::CommandHeader, FLAGS> headers(
+        memory_manager, dma_state.dma_get, num_words, &command_headers);
+    const int size_bytes = static_cast<int>(headers.size_bytes());
+    if (headers.IsDataCopy()) {
+        MICROPROFILE_META_CPU("Bytes copied", size_bytes);
+    } else {
+        MICROPROFILE_META_CPU("Bytes in place", size_bytes);
+    }
+    ProcessCommands(headers);
+}
+
 void DmaPusher::ProcessCommands(std::span<const CommandHeader> commands) {
     for (std::size_t index = 0; index < commands.size();) {
         const CommandHeader& command_header = commands[index];
@@ -186,7 +201,17 @@ void DmaPusher::SetState(const CommandHeader& command_header) {
     dma_state.method_count = command_header.method_count;
 }
 
+void DmaPusher::FlushDrawBatch() const {
+    if (maxwell3d != nullptr) {
+        maxwell3d->draw_manager->FlushBatch();
+    }
+}
+
 void DmaPusher::CallMethod(u32 argument) const {
+    if (dma_state.method < non_puller_methods ||
+        subchannel_type[dma_state.subchannel] != Engines::EngineTypes::Maxwell3D) {
+        FlushDrawBatch();
+    }
     if (dma_state.method < non_puller_methods) {
         puller.CallPullerMethod(Engines::Puller::MethodCall{
             dma_state.method,
@@ -207,6 +232,10 @@ void DmaPusher::CallMethod(u32 argument) const {
 }
 
 void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) const {
+    if (dma_state.method < non_puller_methods ||
+        subchannel_type[dma_state.subchannel] != Engines::EngineTypes::Maxwell3D) {
+        FlushDrawBatch();
+    }
     if (dma_state.method < non_puller_methods) {
         puller.CallMultiMethod(dma_state.method, dma_state.subchannel, base_start, num_methods,
                                dma_state.method_count);
@@ -219,6 +248,15 @@ void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) const {
     }
 }
 
+void DmaPusher::BindSubchannel(Engines::EngineInterface* engine, u32 subchannel_id,
+                               Engines::EngineTypes engine_type) {
+    subchannels[subchannel_id] = engine;
+    subchannel_type[subchannel_id] = engine_type;
+    if (engine_type == Engines::EngineTypes::Maxwell3D) {
+        maxwell3d = static_cast<Engines::Maxwell3D*>(engine);
+    }
+}
+
 void DmaPusher::BindRasterizer(VideoCore::RasterizerInterface* rasterizer) {
     puller.BindRasterizer(rasterizer);
 }
@@ -12,6 +12,7 @@
 #include "common/bit_field.h"
 #include "common/common_types.h"
 #include "common/scratch_buffer.h"
+#include "core/guest_memory.h"
 #include "video_core/engines/engine_interface.h"
 #include "video_core/engines/puller.h"
 
@@ -25,6 +26,10 @@ namespace Control {
 struct ChannelState;
 }
 
+namespace Engines {
+class Maxwell3D;
+}
+
 class GPU;
 class MemoryManager;
 
@@ -131,10 +136,7 @@ public:
     void DispatchCalls();
 
     void BindSubchannel(Engines::EngineInterface* engine, u32 subchannel_id,
-                        Engines::EngineTypes engine_type) {
-        subchannels[subchannel_id] = engine;
-        subchannel_type[subchannel_id] = engine_type;
-    }
+                        Engines::EngineTypes engine_type);
 
     void BindRasterizer(VideoCore::RasterizerInterface* rasterizer);
 
@@ -142,6 +144,11 @@ private:
     static constexpr u32 non_puller_methods = 0x40;
     static constexpr u32 max_subchannels = 8;
     bool Step();
+
+    /// Reads a command list of num_words words at dma_get and processes it
+    template <Core::Memory::GuestMemoryFlags FLAGS>
+    void ProcessCommandList(u32 num_words);
+
     void ProcessCommands(std::span<const CommandHeader> commands);
 
     void SetState(const CommandHeader& command_header);
@@ -149,6 +156,9 @@ private:
     void CallMethod(u32 argument) const;
     void CallMultiMethod(const u32* base_start, u32 num_methods) const;
 
+    /// Dispatches the draws held back by the 3D engine before another engine runs
+    void FlushDrawBatch() const;
+
     Common::ScratchBuffer<CommandHeader>
         command_headers; ///< Buffer for list of commands fetched at once
 
@@ -171,6 +181,7 @@ private:
 
     const bool ib_enable{true}; ///< IB mode enabled
 
+    Engines::Maxwell3D* maxwell3d{};
     std::array<Engines::EngineInterface*, max_subchannels> subchannels{};
     std::array<Engines::EngineTypes, max_subchannels> subchannel_type;
 
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "common/logging/log.h"
+#include "video_core/dynamic_resolution.h"
+
+namespace VideoCommon {
+
+namespace {
+/// Weight of a new frame in the smoothed GPU time
+constexpr double SmoothingFactor = 1.0 / 8.0;
+
+/// Share of the target the configured resolution has to fit in to scale back up
+constexpr double UpscaleHeadroom = 0.85;
+} // Anonymous namespace
+
+void DynamicResolution::AddFrame(std::chrono::nanoseconds gpu_time,
+                                 std::chrono::nanoseconds target) {
+    const double sample = static_cast<double>(gpu_time.count());
+    average_ns = frames_since_change == 0 ? sample
+                                          : average_ns + (sample - average_ns) * SmoothingFactor;
+    if (++frames_since_change < HoldFrames) {
+        return;
+    }
+    const double target_ns = static_cast<double>(target.count());
+    if (upscaling) {
+        if (average_ns > target_ns) {
+            upscaled_ns = average_ns;
+            Change(false);
+        }
+        return;
+    }
+    if (upscaled_ns != 0.0) {
+        // Native resolution has settled, compare it to the cost of the configured one
+        upscale_cost = std::max(upscaled_ns / std::max(average_ns, 1.0), 1.0);
+        upscaled_ns = 0.0;
+    }
+    if (average_ns * upscale_cost < target_ns * UpscaleHeadroom) {
+        Change(true);
+    }
+}
+
+void DynamicResolution::Reset() {
+    average_ns = 0.0;
+    upscaled_ns = 0.0;
+    upscale_cost = 1.0;
+    frames_since_change = 0;
+    upscaling = true;
+}
+
+void DynamicResolution::Change(bool upscale) {
+    LOG_DEBUG(Render, "Scaling {} at {:.2f} ms of GPU time per frame", upscale ? "up" : "down",
+              average_ns / 1'000'000.0);
+    upscaling = upscale;
+    frames_since_change = 0;
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/**
+ * Decides whether render targets are drawn at the configured resolution or at native resolution
+ * from the time the GPU takes on each frame.
+ *
+ * Scaling down happens when the GPU time goes over the target. Before scaling back up, the cost
+ * measured for the configured resolution when it last scaled down has to fit in the target with
+ * some headroom, and every change holds for a while so the GPU time can settle. Together they keep
+ * a game hovering around the target from switching every few frames.
+ */
+class DynamicResolution {
+public:
+    /// Frames a change is held for before the GPU time is looked at again
+    static constexpr u32 HoldFrames = 90;
+
+    /// Feeds the GPU time of a frame and the frame time to hold
+    void AddFrame(std::chrono::nanoseconds gpu_time, std::chrono::nanoseconds target);
+
+    /// Returns to the configured resolution and forgets what was measured
+    void Reset();
+
+    /// Returns true when render targets should be drawn at the configured resolution
+    [[nodiscard]] bool IsUpscaling() const noexcept {
+        return upscaling;
+    }
+
+private:
+    void Change(bool upscale);
+
+    /// Smoothed GPU time since the last change
+    double average_ns{};
+    /// Smoothed GPU time when the configured resolution was given up, zero once consumed
+    double upscaled_ns{};
+    /// GPU time at the configured resolution over the one at native resolution
+    double upscale_cost{1.0};
+    u32 frames_since_change{};
+    bool upscaling{true};
+};
+
+} // namespace VideoCommon
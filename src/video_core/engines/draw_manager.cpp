@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/settings.h"
 #include "video_core/dirty_flags.h"
 #include "video_core/engines/draw_manager.h"
@@ -9,6 +11,31 @@
 namespace Tegra::Engines {
 DrawManager::DrawManager(Maxwell3D* maxwell3d_) : maxwell3d(maxwell3d_) {}
 
+bool DrawManager::IsBatchableMethod(u32 method) {
+    switch (method) {
+    case MAXWELL3D_REG_INDEX(draw.begin):
+    case MAXWELL3D_REG_INDEX(draw.end):
+    case MAXWELL3D_REG_INDEX(vertex_buffer.first):
+    case MAXWELL3D_REG_INDEX(vertex_buffer.count):
+    case MAXWELL3D_REG_INDEX(index_buffer.first):
+    case MAXWELL3D_REG_INDEX(index_buffer.count):
+    case MAXWELL3D_REG_INDEX(index_buffer32_first):
+    case MAXWELL3D_REG_INDEX(index_buffer16_first):
+    case MAXWELL3D_REG_INDEX(index_buffer8_first):
+    case MAXWELL3D_REG_INDEX(global_base_vertex_index):
+    case MAXWELL3D_REG_INDEX(global_base_instance_index):
+        return true;
+    default:
+        return false;
+    }
+}
+
+void DrawManager::BindRasterizer(VideoCore::RasterizerInterface* rasterizer) {
+    draw_batch.clear();
+    batching_supported = rasterizer->HasDrawBatch();
+    batching_enabled = batching_supported;
+}
+
 void DrawManager::ProcessMethodCall(u32 method, u32 argument) {
     const auto& regs{maxwell3d->regs};
     switch (method) {
@@ -266,8 +293,94 @@ void DrawManager::ProcessDraw(bool draw_indexed, u32 instance_count) {
 
     UpdateTopology();
 
-    if (maxwell3d->ShouldExecute()) {
+    if (!maxwell3d->ShouldExecute()) {
+        return;
+    }
+    if (!CanBatch(draw_indexed)) {
+        FlushBatch();
         maxwell3d->rasterizer->Draw(draw_indexed, instance_count);
+        return;
+    }
+    // Only draw parameters may have changed since the previous batched draw, any other state
+    // change flushes the batch before it is applied.
+    if (!draw_batch.empty() && (batch_indexed != draw_indexed ||
+                                batch_topology != draw_state.topology ||
+                                draw_batch.size() == MaxBatchedDraws)) {
+        FlushBatchImpl();
+    }
+    batch_indexed = draw_indexed;
+    batch_topology = draw_state.topology;
+    draw_batch.push_back(BatchedDraw{
+        .first = draw_indexed ? draw_state.index_buffer.first : draw_state.vertex_buffer.first,
+        .count = draw_indexed ? draw_state.index_buffer.count : draw_state.vertex_buffer.count,
+        .base_vertex = draw_state.base_index,
+        .base_instance = draw_state.base_instance,
+        .instance_count = instance_count,
+    });
+}
+
+bool DrawManager::CanBatch(bool draw_indexed) const {
+    if (!batching_enabled || draw_state.draw_mode != DrawMode::General) {
+        return false;
+    }
+    // Quads are emulated with generated index buffers sized for a single draw
+    if (draw_state.topology == PrimitiveTopology::Quads ||
+        draw_state.topology == PrimitiveTopology::QuadStrip) {
+        return false;
+    }
+    if (maxwell3d->regs.transform_feedback_enabled) {
+        return false;
+    }
+    // 8-bit indices may be converted on the host for a single draw range
+    return !draw_indexed ||
+           draw_state.index_buffer.format != Maxwell3D::Regs::IndexFormat::UnsignedByte;
+}
+
+void DrawManager::FlushBatchImpl() {
+    const PrimitiveTopology topology = draw_state.topology;
+    const VertexBuffer vertex_buffer = draw_state.vertex_buffer;
+    const IndexBuffer index_buffer = draw_state.index_buffer;
+    const u32 base_index = draw_state.base_index;
+    const u32 base_instance = draw_state.base_instance;
+
+    draw_state.topology = batch_topology;
+    if (draw_batch.size() == 1) {
+        const BatchedDraw& draw = draw_batch.front();
+        if (batch_indexed) {
+            draw_state.index_buffer.first = draw.first;
+            draw_state.index_buffer.count = draw.count;
+        } else {
+            draw_state.vertex_buffer.first = draw.first;
+            draw_state.vertex_buffer.count = draw.count;
+        }
+        draw_state.base_index = draw.base_vertex;
+        draw_state.base_instance = draw.base_instance;
+        maxwell3d->rasterizer->Draw(batch_indexed, draw.instance_count);
+    } else {
+        if (batch_indexed) {
+            // Bind an index range covering every draw of the batch
+            u32 first = draw_batch.front().first;
+            u32 end = first;
+            for (const BatchedDraw& draw : draw_batch) {
+                first = std::min(first, draw.first);
+                end = std::max(end, draw.first + draw.count);
+            }
+            draw_state.index_buffer.first = first;
+            draw_state.index_buffer.count = end - first;
+            maxwell3d->dirty.flags[VideoCommon::Dirty::IndexBuffer] = true;
+        }
+        maxwell3d->rasterizer->DrawBatch(batch_indexed);
+    }
+    draw_batch.clear();
+
+    draw_state.topology = topology;
+    draw_state.vertex_buffer = vertex_buffer;
+    draw_state.index_buffer = index_buffer;
+    draw_state.base_index = base_index;
+    draw_state.base_instance = base_instance;
+    if (batch_indexed) {
+        // The bound range belongs to the flushed draws, make the next draw bind its own
+        maxwell3d->dirty.flags[VideoCommon::Dirty::IndexBuffer] = true;
     }
 }
 
@@ -279,6 +392,7 @@ void DrawManager::ProcessDrawIndirect() {
         indirect_state.buffer_size, indirect_state.max_draw_counts);
 
     UpdateTopology();
+    FlushBatch();
 
     if (maxwell3d->ShouldExecute()) {
         maxwell3d->rasterizer->DrawIndirect();
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
+#include <span>
+#include <boost/container/static_vector.hpp>
+
 #include "common/common_types.h"
 #include "video_core/engines/maxwell_3d.h"
 
@@ -56,8 +59,22 @@ public:
         size_t stride;
     };
 
+    /// Parameters of a draw held back to be dispatched together with its neighbours
+    struct BatchedDraw {
+        u32 first;
+        u32 count;
+        u32 base_vertex;
+        u32 base_instance;
+        u32 instance_count;
+    };
+
+    static constexpr size_t MaxBatchedDraws = 256;
+
     explicit DrawManager(Maxwell3D* maxwell_3d);
 
+    /// Returns true when writing the method can't change any state a batched draw depends on
+    [[nodiscard]] static bool IsBatchableMethod(u32 method);
+
     void ProcessMethodCall(u32 method, u32 argument);
 
     void Clear(u32 layer_count);
@@ -76,6 +93,29 @@ public:
 
     void DrawIndexedIndirect(PrimitiveTopology topology, u32 index_first, u32 index_count);
 
+    /// Dispatches the held back draws, must be called before any state they depend on changes
+    void FlushBatch() {
+        if (!draw_batch.empty()) [[unlikely]] {
+            FlushBatchImpl();
+        }
+    }
+
+    [[nodiscard]] bool HasPendingBatch() const {
+        return !draw_batch.empty();
+    }
+
+    /// Enables or disables batching, draws are never held back while it is disabled
+    void SetBatching(bool enabled) {
+        FlushBatch();
+        batching_enabled = enabled && batching_supported;
+    }
+
+    void BindRasterizer(VideoCore::RasterizerInterface* rasterizer);
+
+    std::span<const BatchedDraw> GetDrawBatch() const {
+        return {draw_batch.data(), draw_batch.size()};
+    }
+
     const State& GetDrawState() const {
         return draw_state;
     }
@@ -109,9 +149,19 @@ private:
 
     void ProcessDrawIndirect();
 
+    bool CanBatch(bool draw_indexed) const;
+
+    void FlushBatchImpl();
+
     Maxwell3D* maxwell3d{};
     State draw_state{};
     DrawTextureState draw_texture_state{};
     IndirectParams indirect_state{};
+
+    boost::container::static_vector<BatchedDraw, MaxBatchedDraws> draw_batch;
+    PrimitiveTopology batch_topology{};
+    bool batch_indexed{};
+    bool batching_supported{};
+    bool batching_enabled{};
 };
 } // namespace Tegra::Engines
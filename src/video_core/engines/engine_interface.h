@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <bitset>
 #include <limits>
 #include <vector>
@@ -19,6 +20,17 @@ enum class EngineTypes : u32 {
     KeplerMemory,
 };
 
+/// Evaluates predicate for every register index at compile time, used to build the tables that
+/// tell registers which trigger an action apart from plain register stores.
+template <size_t NumRegs, typename Predicate>
+constexpr std::array<bool, NumRegs> BuildMethodTable(Predicate&& predicate) {
+    std::array<bool, NumRegs> table{};
+    for (size_t method = 0; method < NumRegs; ++method) {
+        table[method] = predicate(static_cast<u32>(method));
+    }
+    return table;
+}
+
 class EngineInterface {
 public:
     virtual ~EngineInterface() = default;
@@ -43,6 +55,15 @@ public:
     GPUVAddr current_dma_segment;
 
 protected:
+    /// Marks the registers flagged in table as executable, everything else as pass-through
+    template <size_t NumRegs>
+    void SetExecutionMask(const std::array<bool, NumRegs>& table) {
+        execution_mask.reset();
+        for (size_t method = 0; method < NumRegs; ++method) {
+            execution_mask[method] = table[method];
+        }
+    }
+
     virtual void ConsumeSinkImpl() {
         for (auto [method, value] : method_sink) {
             CallMethod(method, value, true);
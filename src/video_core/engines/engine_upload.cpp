@@ -47,6 +47,12 @@ void State::ProcessData(const u32* data, size_t num_data) {
 void State::ProcessData(std::span<const u8> read_buffer) {
     const GPUVAddr address{regs.dest.Address()};
     if (is_linear) {
+        if (regs.line_count == 1 || regs.dest.pitch == regs.line_length_in) {
+            // Contiguous destination, hand the whole upload to the rasterizer at once so it is
+            // written to the caches as a single copy
+            rasterizer->AccelerateInlineToMemory(address, copy_size, read_buffer.first(copy_size));
+            return;
+        }
         for (size_t line = 0; line < regs.line_count; ++line) {
             const GPUVAddr dest_line = address + line * regs.dest.pitch;
             std::span<const u8> buffer(read_buffer.data() + line * regs.line_length_in,
@@ -21,14 +21,21 @@ namespace Tegra::Engines {
 
 using namespace Texture;
 
+namespace {
+
+/// Writing the last blit argument launches the blit, everything else is a plain register store.
+constexpr auto ExecutableMethods = BuildMethodTable<Fermi2D::Regs::NUM_REGS>(
+    [](u32 method) { return method == FERMI2D_REG_INDEX(pixels_from_memory.src_y0) + 1; });
+
+} // Anonymous namespace
+
 Fermi2D::Fermi2D(MemoryManager& memory_manager_) : memory_manager{memory_manager_} {
     sw_blitter = std::make_unique<Blitter::SoftwareBlitEngine>(memory_manager);
     // Nvidia's OpenGL driver seems to assume these values
     regs.src.depth = 1;
     regs.dst.depth = 1;
 
-    execution_mask.reset();
-    execution_mask[FERMI2D_REG_INDEX(pixels_from_memory.src_y0) + 1] = true;
+    SetExecutionMask(ExecutableMethods);
 }
 
 Fermi2D::~Fermi2D() = default;
@@ -48,6 +55,11 @@ void Fermi2D::CallMethod(u32 method, u32 method_argument, bool is_last_call) {
 }
 
 void Fermi2D::CallMultiMethod(u32 method, const u32* base_start, u32 amount, u32 methods_pending) {
+    if (method < Regs::NUM_REGS && !ExecutableMethods[method]) {
+        // Repeated writes to a plain register, only the last one is observable
+        regs.reg_array[method] = base_start[amount - 1];
+        return;
+    }
     for (u32 i = 0; i < amount; ++i) {
         CallMethod(method, base_start[i], methods_pending - i <= 1);
     }
@@ -13,12 +13,21 @@
 
 namespace Tegra::Engines {
 
+namespace {
+
+/// Registers that trigger an action when written, everything else is a plain register store.
+constexpr auto ExecutableMethods =
+    BuildMethodTable<KeplerCompute::Regs::NUM_REGS>([](u32 method) {
+        return method == KEPLER_COMPUTE_REG_INDEX(exec_upload) ||
+               method == KEPLER_COMPUTE_REG_INDEX(data_upload) ||
+               method == KEPLER_COMPUTE_REG_INDEX(launch);
+    });
+
+} // Anonymous namespace
+
 KeplerCompute::KeplerCompute(Core::System& system_, MemoryManager& memory_manager_)
     : system{system_}, memory_manager{memory_manager_}, upload_state{memory_manager, regs.upload} {
-    execution_mask.reset();
-    execution_mask[KEPLER_COMPUTE_REG_INDEX(exec_upload)] = true;
-    execution_mask[KEPLER_COMPUTE_REG_INDEX(data_upload)] = true;
-    execution_mask[KEPLER_COMPUTE_REG_INDEX(launch)] = true;
+    SetExecutionMask(ExecutableMethods);
 }
 
 KeplerCompute::~KeplerCompute() = default;
@@ -83,6 +92,11 @@ void KeplerCompute::CallMultiMethod(u32 method, const u32* base_start, u32 amoun
         upload_state.ProcessData(base_start, amount);
         return;
     default:
+        if (method < Regs::NUM_REGS && !ExecutableMethods[method]) {
+            // Repeated writes to a plain register, only the last one is observable
+            regs.reg_array[method] = base_start[amount - 1];
+            return;
+        }
         for (u32 i = 0; i < amount; i++) {
             CallMethod(method, base_start[i], methods_pending - i <= 1);
         }
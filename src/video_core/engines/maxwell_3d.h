@@ -4,7 +4,6 @@
 #pragma once
 
 #include <array>
-#include <bitset>
 #include <cmath>
 #include <limits>
 #include <optional>
@@ -16,6 +15,7 @@
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "common/math_util.h"
+#include "video_core/dirty_flag_set.h"
 #include "video_core/engines/const_buffer_info.h"
 #include "video_core/engines/engine_interface.h"
 #include "video_core/engines/engine_upload.h"
@@ -3078,6 +3078,14 @@ public:
     void CallMultiMethod(u32 method, const u32* base_start, u32 amount,
                          u32 methods_pending) override;
 
+    /// Returns the number of register writes received through CallMethod and CallMultiMethod.
+    u64 GetMethodCallCount() const {
+        return method_call_count;
+    }
+
+    /// Returns the program ID of the running application.
+    u64 GetProgramID() const;
+
     bool ShouldExecute() const {
         return execute_on;
     }
@@ -3091,7 +3099,7 @@ public:
     }
 
     struct DirtyState {
-        using Flags = std::bitset<std::numeric_limits<u8>::max()>;
+        using Flags = VideoCommon::DirtyFlagSet<std::numeric_limits<u8>::max()>;
         using Table = std::array<u8, Regs::NUM_REGS>;
         using Tables = std::array<Table, 2>;
 
@@ -3184,8 +3192,6 @@ private:
 
     void RefreshParametersImpl();
 
-    bool IsMethodExecutable(u32 method);
-
     Core::System& system;
     MemoryManager& memory_manager;
 
@@ -3196,6 +3202,8 @@ private:
 
     /// Macro method that is currently being executed / being fed parameters.
     u32 executing_macro = 0;
+    /// Number of register writes received so far, used by the macro profiler.
+    u64 method_call_count = 0;
     /// Parameters that have been submitted to the macro call so far.
     std::vector<u32> macro_params;
 
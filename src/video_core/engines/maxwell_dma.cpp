@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/algorithm.h"
+#include "common/alignment.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
@@ -188,6 +189,9 @@ void MaxwellDMA::CopyBlockLinearToPitch() {
     if (accelerate.ImageToBuffer(copy_info, src_operand, dst_operand)) {
         return;
     }
+    if (AccelerateLayoutCopy(true, false)) {
+        return;
+    }
 
     UNIMPLEMENTED_IF(regs.src_params.block_size.width != 0);
     UNIMPLEMENTED_IF(regs.src_params.block_size.depth != 0);
@@ -261,6 +265,9 @@ void MaxwellDMA::CopyPitchToBlockLinear() {
     if (accelerate.BufferToImage(copy_info, src_operand, dst_operand)) {
         return;
     }
+    if (AccelerateLayoutCopy(false, true)) {
+        return;
+    }
 
     const auto& dst_params = regs.dst_params;
 
@@ -304,6 +311,10 @@ void MaxwellDMA::CopyPitchToBlockLinear() {
 void MaxwellDMA::CopyBlockLinearToBlockLinear() {
     UNIMPLEMENTED_IF(regs.src_params.block_size.width != 0);
 
+    if (AccelerateLayoutCopy(true, true)) {
+        return;
+    }
+
     const bool is_remapping = regs.launch_dma.remap_enable != 0;
 
     // Deswizzle the input and copy it over.
@@ -358,6 +369,68 @@ void MaxwellDMA::CopyBlockLinearToBlockLinear() {
                    dst.block_size.height, dst.block_size.depth, pitch);
 }
 
+bool MaxwellDMA::AccelerateLayoutCopy(bool src_block_linear, bool dst_block_linear) {
+    if (regs.launch_dma.remap_enable != 0 || regs.line_length_in == 0 || regs.line_count == 0) {
+        return false;
+    }
+    // Without remapping every horizontal quantity is already in bytes
+    const auto make_operand = [this](bool block_linear, const DMA::Parameters& params,
+                                     GPUVAddr address, s32 pitch) {
+        DMA::LayoutOperand operand{
+            .address = address,
+            .size = 0,
+            .block_linear = block_linear,
+            .origin_x = 0,
+            .origin_y = 0,
+            .pitch = static_cast<u32>(pitch),
+            .width = params.width,
+            .height = params.height,
+            .block_height = params.block_size.height,
+            .block_depth = params.block_size.depth,
+        };
+        if (block_linear) {
+            operand.origin_x = params.origin.x;
+            operand.origin_y = params.origin.y;
+            operand.size = CalculateSize(true, 1, params.width, params.height, params.depth,
+                                         params.block_size.height, params.block_size.depth);
+        } else {
+            operand.size = static_cast<u64>(operand.pitch) * regs.line_count;
+        }
+        return operand;
+    };
+    const DMA::LayoutCopy copy{
+        .src = make_operand(src_block_linear, regs.src_params, regs.offset_in, regs.pitch_in),
+        .dst = make_operand(dst_block_linear, regs.dst_params, regs.offset_out, regs.pitch_out),
+        .line_length = regs.line_length_in,
+        .line_count = regs.line_count,
+    };
+    const auto is_supported = [&copy](const DMA::LayoutOperand& operand, s32 pitch) {
+        // Lines are copied a word at a time
+        if (((operand.address | operand.origin_x) & 3) != 0 || copy.line_length % 4 != 0) {
+            return false;
+        }
+        if (!operand.block_linear) {
+            return pitch >= 0 && operand.pitch % 4 == 0 && copy.line_length <= operand.pitch;
+        }
+        // Lines past the height would continue in the next slices, only the first one is handled
+        const u32 stride = Common::AlignUpLog2(operand.width, GOB_SIZE_X_SHIFT);
+        return operand.origin_x + copy.line_length <= stride &&
+               operand.origin_y + copy.line_count <= operand.height;
+    };
+    if (!is_supported(copy.src, regs.pitch_in) || !is_supported(copy.dst, regs.pitch_out)) {
+        return false;
+    }
+    if (regs.src_params.block_size.width != 0 || regs.dst_params.block_size.width != 0) {
+        return false;
+    }
+    // Overlapping operands would be read and written by different invocations
+    if (copy.src.address < copy.dst.address + copy.dst.size &&
+        copy.dst.address < copy.src.address + copy.src.size) {
+        return false;
+    }
+    return rasterizer->AccessAccelerateDMA().BufferLayoutCopy(copy);
+}
+
 void MaxwellDMA::ReleaseSemaphore() {
     const auto type = regs.launch_dma.semaphore_type;
     const GPUVAddr address = regs.semaphore.address;
@@ -70,6 +70,31 @@ struct BufferOperand {
     GPUVAddr address;
 };
 
+/// One side of a LayoutCopy, with every horizontal quantity in bytes
+struct LayoutOperand {
+    GPUVAddr address;
+    /// Bytes from address the operand spans in memory
+    u64 size;
+    bool block_linear;
+    u32 origin_x;
+    u32 origin_y;
+    /// Distance between lines, pitch linear operands only
+    u32 pitch;
+    /// Block linear operands only
+    u32 width;
+    u32 height;
+    u32 block_height;
+    u32 block_depth;
+};
+
+/// Rectangle copied between two operands in any combination of pitch and block linear layouts
+struct LayoutCopy {
+    LayoutOperand src;
+    LayoutOperand dst;
+    u32 line_length;
+    u32 line_count;
+};
+
 } // namespace DMA
 } // namespace Tegra
 
@@ -87,6 +112,9 @@ public:
 
     virtual bool BufferToImage(const DMA::ImageCopy& copy_info, const DMA::BufferOperand& src,
                                const DMA::ImageOperand& dst) = 0;
+
+    /// Swizzles or unswizzles between cached buffers on the host GPU, when no image matches
+    virtual bool BufferLayoutCopy(const DMA::LayoutCopy& copy) = 0;
 };
 
 /**
@@ -259,6 +287,9 @@ private:
 
     void CopyBlockLinearToBlockLinear();
 
+    /// Tries to run the configured layout conversion on the host GPU, returns true on success
+    bool AccelerateLayoutCopy(bool src_block_linear, bool dst_block_linear);
+
     void ReleaseSemaphore();
 
     void ConsumeSinkImpl() override;
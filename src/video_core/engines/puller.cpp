@@ -1,6 +1,10 @@
 // SPDX-FileCopyrightText: 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
@@ -18,6 +22,13 @@
 #include "video_core/rasterizer_interface.h"
 
 namespace Tegra::Engines {
+namespace {
+/// Polls of an unsatisfied semaphore acquire before the puller starts sleeping between them
+constexpr u32 ACQUIRE_SPIN_POLLS = 64;
+/// Sleep after the polling, doubled on every poll until it reaches the maximum
+constexpr std::chrono::microseconds MIN_ACQUIRE_BACKOFF{10};
+constexpr std::chrono::microseconds MAX_ACQUIRE_BACKOFF{500};
+} // Anonymous namespace
 
 Puller::Puller(GPU& gpu_, MemoryManager& memory_manager_, DmaPusher& dma_pusher_,
                Control::ChannelState& channel_state_)
@@ -123,17 +134,35 @@ void Puller::ProcessSemaphoreRelease() {
 }
 
 void Puller::ProcessSemaphoreAcquire() {
-    u32 word = memory_manager.Read<u32>(regs.semaphore_address.SemaphoreAddress());
+    const GPUVAddr address = regs.semaphore_address.SemaphoreAddress();
     const auto value = regs.semaphore_acquire;
-    while (word != value) {
-        regs.acquire_active = true;
-        regs.acquire_value = value;
+    if (memory_manager.Read<u32>(address) == value) {
+        return;
+    }
+    regs.acquire_active = true;
+    regs.acquire_value = value;
+    // TODO(kemathe73) figure out how to do the acquire_timeout
+    regs.acquire_mode = false;
+    regs.acquire_source = false;
+
+    // The semaphore is written either by a fence released here or by the guest CPU, which
+    // doesn't notify us. Poll the first few times to catch quick handshakes, then back off to
+    // sleeping so a long wait doesn't keep a host core busy.
+    const auto start = std::chrono::steady_clock::now();
+    auto backoff = MIN_ACQUIRE_BACKOFF;
+    for (u32 poll = 1;; ++poll) {
         rasterizer->ReleaseFences();
-        word = memory_manager.Read<u32>(regs.semaphore_address.SemaphoreAddress());
-        // TODO(kemathe73) figure out how to do the acquire_timeout
-        regs.acquire_mode = false;
-        regs.acquire_source = false;
+        if (memory_manager.Read<u32>(address) == value) {
+            break;
+        }
+        if (poll < ACQUIRE_SPIN_POLLS) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(backoff);
+            backoff = std::min(backoff * 2, MAX_ACQUIRE_BACKOFF);
+        }
     }
+    gpu.ReportSemaphoreWait(std::chrono::steady_clock::now() - start);
 }
 
 /// Calls a GPU puller method.
@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace Tegra::Engines {
+
+/// Host time the puller spent blocked on semaphore acquires, summed since the last reset.
+/// Acquires that were already satisfied when they were reached are not counted.
+struct SemaphoreWaitStats {
+    u64 waits{};       ///< Acquires that had to wait for the semaphore to be written
+    u64 wait_ns{};     ///< Host time spent in those waits
+    u64 max_wait_ns{}; ///< Longest wait
+};
+
+} // namespace Tegra::Engines
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <vector>
 
+#include "common/assert.h"
 #include "common/scratch_buffer.h"
 #include "video_core/engines/sw_blitter/blitter.h"
 #include "video_core/engines/sw_blitter/converter.h"
@@ -28,16 +29,25 @@ namespace {
 
 constexpr size_t ir_components = 4;
 
+template <size_t bpp>
 void NearestNeighbor(std::span<const u8> input, std::span<u8> output, u32 src_width, u32 src_height,
-                     u32 dst_width, u32 dst_height, size_t bpp) {
+                     u32 dst_width, u32 dst_height) {
     const size_t dx_du = std::llround((static_cast<f64>(src_width) / dst_width) * (1ULL << 32));
     const size_t dy_dv = std::llround((static_cast<f64>(src_height) / dst_height) * (1ULL << 32));
     size_t src_y = 0;
     for (u32 y = 0; y < dst_height; y++) {
+        const size_t write_row = y * dst_width * bpp;
+        if (src_width == dst_width) {
+            // Only scaled vertically, rows are copied whole
+            const size_t read_from = ((src_y * src_width) >> 32) * bpp;
+            std::memcpy(&output[write_row], &input[read_from], dst_width * bpp);
+            src_y += dy_dv;
+            continue;
+        }
         size_t src_x = 0;
         for (u32 x = 0; x < dst_width; x++) {
             const size_t read_from = ((src_y * src_width + src_x) >> 32) * bpp;
-            const size_t write_to = (y * dst_width + x) * bpp;
+            const size_t write_to = write_row + x * bpp;
 
             std::memcpy(&output[write_to], &input[read_from], bpp);
             src_x += dx_du;
@@ -46,6 +56,25 @@ void NearestNeighbor(std::span<const u8> input, std::span<u8> output, u32 src_wi
     }
 }
 
+void NearestNeighbor(std::span<const u8> input, std::span<u8> output, u32 src_width, u32 src_height,
+                     u32 dst_width, u32 dst_height, size_t bpp) {
+    // A constant pixel size turns the per pixel copy into a single move
+    switch (bpp) {
+    case 1:
+        return NearestNeighbor<1>(input, output, src_width, src_height, dst_width, dst_height);
+    case 2:
+        return NearestNeighbor<2>(input, output, src_width, src_height, dst_width, dst_height);
+    case 4:
+        return NearestNeighbor<4>(input, output, src_width, src_height, dst_width, dst_height);
+    case 8:
+        return NearestNeighbor<8>(input, output, src_width, src_height, dst_width, dst_height);
+    case 16:
+        return NearestNeighbor<16>(input, output, src_width, src_height, dst_width, dst_height);
+    default:
+        UNREACHABLE_MSG("Invalid bytes per pixel {}", bpp);
+    }
+}
+
 void NearestNeighborFast(std::span<const f32> input, std::span<f32> output, u32 src_width,
                          u32 src_height, u32 dst_width, u32 dst_height) {
     const size_t dx_du = std::llround((static_cast<f64>(src_width) / dst_width) * (1ULL << 32));
@@ -178,6 +207,17 @@ bool SoftwareBlitEngine::Blit(Fermi2D::Surface& src, Fermi2D::Surface& dst,
                         dst_extent_x, dst_extent_y, dst_bytes_per_pixel);
     };
 
+    // The formats only differ in the order of their channels, pixels are shuffled in place and
+    // resampled like a same format blit
+    const auto conversion_phase_shuffle = [&](const PixelShuffle& shuffle) {
+        shuffle.Apply(impl->src_buffer, impl->src_buffer);
+        if (src_extent_x != dst_extent_x || src_extent_y != dst_extent_y) {
+            conversion_phase_same_format();
+        } else {
+            impl->dst_buffer.swap(impl->src_buffer);
+        }
+    };
+
     const auto conversion_phase_ir = [&]() {
         auto* input_converter = impl->converter_factory.GetFormatConverter(src.format);
         impl->intermediate_src.resize_destructive((src_copy_size / src_bytes_per_pixel) *
@@ -212,7 +252,13 @@ bool SoftwareBlitEngine::Blit(Fermi2D::Surface& src, Fermi2D::Surface& dst,
 
     // Conversion Phase
     if (no_passthrough) {
-        if (src.format != dst.format || config.filter == Fermi2D::Filter::Bilinear) {
+        const PixelShuffle* const shuffle =
+            src.format != dst.format && config.filter != Fermi2D::Filter::Bilinear
+                ? impl->converter_factory.GetPixelShuffle(src.format, dst.format)
+                : nullptr;
+        if (shuffle) {
+            conversion_phase_shuffle(*shuffle);
+        } else if (src.format != dst.format || config.filter == Fermi2D::Filter::Bilinear) {
             conversion_phase_ir();
         } else {
             conversion_phase_same_format();
@@ -1,10 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstring>
+#include <map>
+#include <optional>
 #include <span>
 #include <unordered_map>
+#include <utility>
 
 #include "common/assert.h"
 #include "common/bit_cast.h"
@@ -12,12 +17,25 @@
 #include "video_core/surface.h"
 #include "video_core/textures/decoders.h"
 
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
 #ifdef _MSC_VER
 #define FORCE_INLINE __forceinline
 #else
 #define FORCE_INLINE inline __attribute__((always_inline))
 #endif
 
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AVX2_TARGET
+#endif
+
 namespace Tegra::Engines::Blitter {
 
 enum class Swizzle : size_t {
@@ -137,6 +155,70 @@ constexpr std::array<f32, 256> RGB_TO_SRGB_LUT = {
     9.843225e-01f, 9.860808e-01f, 9.878350e-01f, 9.895850e-01f, 9.913309e-01f, 9.930727e-01f,
     9.948106e-01f, 9.965444e-01f, 9.982741e-01f, 1.000000e+00f};
 
+/// Where one of the R, G, B and A channels lives within a pixel, in bytes
+struct ChannelBytes {
+    size_t offset;
+    /// Zero when the format does not store the channel
+    size_t size;
+    ComponentType type;
+};
+
+struct PixelLayout {
+    size_t bytes_per_pixel;
+    /// True when every component starts and ends on a byte boundary
+    bool byte_aligned;
+    std::array<ChannelBytes, 4> channels;
+};
+
+std::optional<PixelShuffle> MakePixelShuffle(const PixelLayout& src, const PixelLayout& dst) {
+    if (!src.byte_aligned || !dst.byte_aligned || src.bytes_per_pixel != dst.bytes_per_pixel) {
+        return std::nullopt;
+    }
+    // Bytes of channels the destination does not store are left as zero, like ConvertFrom does
+    std::array<s8, PixelShuffle::MAX_BYTES_PER_PIXEL> source_bytes;
+    source_bytes.fill(-1);
+    for (size_t channel = 0; channel < dst.channels.size(); channel++) {
+        const ChannelBytes& to = dst.channels[channel];
+        const ChannelBytes& from = src.channels[channel];
+        if (to.size == 0) {
+            continue;
+        }
+        if (from.size != to.size || from.type != to.type) {
+            return std::nullopt;
+        }
+        for (size_t byte = 0; byte < to.size; byte++) {
+            source_bytes[to.offset + byte] = static_cast<s8>(from.offset + byte);
+        }
+    }
+    return PixelShuffle{src.bytes_per_pixel, source_bytes};
+}
+
+#if defined(ARCHITECTURE_x86_64)
+AVX2_TARGET size_t ShuffleAvx2(const u8* input, u8* output, size_t num_bytes,
+                               const std::array<u8, 16>& lane_mask) {
+    const __m256i mask = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(lane_mask.data())));
+    size_t offset = 0;
+    for (; offset + sizeof(__m256i) <= num_bytes; offset += sizeof(__m256i)) {
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + offset));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + offset),
+                            _mm256_shuffle_epi8(pixels, mask));
+    }
+    return offset;
+}
+#elif defined(ARCHITECTURE_arm64)
+size_t ShuffleNeon(const u8* input, u8* output, size_t num_bytes,
+                   const std::array<u8, 16>& lane_mask) {
+    // Out of range indices read as zero, like the high bit does with pshufb
+    const uint8x16_t mask = vld1q_u8(lane_mask.data());
+    size_t offset = 0;
+    for (; offset + sizeof(uint8x16_t) <= num_bytes; offset += sizeof(uint8x16_t)) {
+        vst1q_u8(output + offset, vqtbl1q_u8(vld1q_u8(input + offset), mask));
+    }
+    return offset;
+}
+#endif
+
 } // namespace
 
 struct R32G32B32A32_FLOATTraits {
@@ -830,6 +912,29 @@ private:
     }
 
 public:
+    static constexpr PixelLayout GetPixelLayout() {
+        PixelLayout layout{
+            .bytes_per_pixel = total_bytes_per_pixel,
+            .byte_aligned = true,
+            .channels{},
+        };
+        for (size_t i = 0; i < num_components; i++) {
+            if (component_sizes[i] % 8 != 0) {
+                layout.byte_aligned = false;
+                continue;
+            }
+            if (component_swizzle[i] == Swizzle::None) {
+                continue;
+            }
+            layout.channels[static_cast<size_t>(component_swizzle[i])] = {
+                .offset = bound_words[i] * sizeof(u32) + bound_offsets[i] / 8,
+                .size = component_sizes[i] / 8,
+                .type = component_types[i],
+            };
+        }
+        return layout;
+    }
+
     void ConvertTo(std::span<const u8> input, std::span<f32> output) override {
         const size_t num_pixels = output.size() / components_per_ir_rep;
         for (size_t pixel = 0; pixel < num_pixels; pixel++) {
@@ -920,8 +1025,56 @@ public:
     ~ConverterImpl() override = default;
 };
 
+PixelShuffle::PixelShuffle(size_t bytes_per_pixel_,
+                           const std::array<s8, MAX_BYTES_PER_PIXEL>& source_bytes_)
+    : bytes_per_pixel{bytes_per_pixel_}, source_bytes{source_bytes_} {
+    ASSERT(bytes_per_pixel != 0 && lane_mask.size() % bytes_per_pixel == 0);
+    for (size_t i = 0; i < lane_mask.size(); i++) {
+        const size_t pixel_offset = i - i % bytes_per_pixel;
+        const s8 source = source_bytes[i % bytes_per_pixel];
+        lane_mask[i] = source < 0 ? 0x80 : static_cast<u8>(pixel_offset + source);
+    }
+}
+
+void PixelShuffle::Apply(std::span<const u8> input, std::span<u8> output) const {
+    const size_t num_bytes =
+        std::min(input.size(), output.size()) / bytes_per_pixel * bytes_per_pixel;
+    size_t offset = 0;
+#if defined(ARCHITECTURE_x86_64)
+    static const bool has_avx2 = Common::GetCPUCaps().avx2;
+    if (has_avx2) {
+        offset = ShuffleAvx2(input.data(), output.data(), num_bytes, lane_mask);
+    }
+#elif defined(ARCHITECTURE_arm64)
+    offset = ShuffleNeon(input.data(), output.data(), num_bytes, lane_mask);
+#endif
+    ApplyScalar(input.data() + offset, output.data() + offset, num_bytes - offset);
+}
+
+void PixelShuffle::ApplyScalar(const u8* input, u8* output, size_t num_bytes) const {
+    std::array<u8, MAX_BYTES_PER_PIXEL> pixel;
+    for (size_t offset = 0; offset < num_bytes; offset += bytes_per_pixel) {
+        // Read the whole pixel first, input and output can overlap
+        std::memcpy(pixel.data(), input + offset, bytes_per_pixel);
+        for (size_t i = 0; i < bytes_per_pixel; i++) {
+            output[offset + i] = source_bytes[i] < 0 ? u8{0} : pixel[source_bytes[i]];
+        }
+    }
+}
+
 struct ConverterFactory::ConverterFactoryImpl {
+    template <class ConverterTraits>
+    Converter* Build(RenderTargetFormat format) {
+        layouts_cache.emplace(format, ConverterImpl<ConverterTraits>::GetPixelLayout());
+        return converters_cache
+            .emplace(format, std::make_unique<ConverterImpl<ConverterTraits>>())
+            .first->second.get();
+    }
+
     std::unordered_map<RenderTargetFormat, std::unique_ptr<Converter>> converters_cache;
+    std::unordered_map<RenderTargetFormat, PixelLayout> layouts_cache;
+    std::map<std::pair<RenderTargetFormat, RenderTargetFormat>, std::optional<PixelShuffle>>
+        shuffles_cache;
 };
 
 ConverterFactory::ConverterFactory() {
@@ -938,6 +1091,24 @@ Converter* ConverterFactory::GetFormatConverter(RenderTargetFormat format) {
     return it->second.get();
 }
 
+const PixelShuffle* ConverterFactory::GetPixelShuffle(RenderTargetFormat src_format,
+                                                      RenderTargetFormat dst_format) {
+    const auto key = std::make_pair(src_format, dst_format);
+    auto it = impl->shuffles_cache.find(key);
+    if (it == impl->shuffles_cache.end()) [[unlikely]] {
+        GetFormatConverter(src_format);
+        GetFormatConverter(dst_format);
+        std::optional<PixelShuffle> shuffle;
+        const auto src_layout = impl->layouts_cache.find(src_format);
+        const auto dst_layout = impl->layouts_cache.find(dst_format);
+        if (src_layout != impl->layouts_cache.end() && dst_layout != impl->layouts_cache.end()) {
+            shuffle = MakePixelShuffle(src_layout->second, dst_layout->second);
+        }
+        it = impl->shuffles_cache.emplace(key, shuffle).first;
+    }
+    return it->second ? &*it->second : nullptr;
+}
+
 class NullConverter : public Converter {
 public:
     void ConvertTo([[maybe_unused]] std::span<const u8> input, std::span<f32> output) override {
@@ -954,274 +1125,166 @@ public:
 Converter* ConverterFactory::BuildConverter(RenderTargetFormat format) {
     switch (format) {
     case RenderTargetFormat::R32G32B32A32_FLOAT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32G32B32A32_FLOATTraits>>())
-            .first->second.get();
+        return impl->Build<R32G32B32A32_FLOATTraits>(format);
         break;
     case RenderTargetFormat::R32G32B32A32_SINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32G32B32A32_SINTTraits>>())
-            .first->second.get();
+        return impl->Build<R32G32B32A32_SINTTraits>(format);
         break;
     case RenderTargetFormat::R32G32B32A32_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32G32B32A32_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<R32G32B32A32_UINTTraits>(format);
         break;
     case RenderTargetFormat::R32G32B32X32_FLOAT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32G32B32X32_FLOATTraits>>())
-            .first->second.get();
+        return impl->Build<R32G32B32X32_FLOATTraits>(format);
         break;
     case RenderTargetFormat::R32G32B32X32_SINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32G32B32X32_SINTTraits>>())
-            .first->second.get();
+        return impl->Build<R32G32B32X32_SINTTraits>(format);
         break;
     case RenderTargetFormat::R32G32B32X32_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32G32B32X32_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<R32G32B32X32_UINTTraits>(format);
         break;
     case RenderTargetFormat::R16G16B16A16_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16B16A16_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16B16A16_UNORMTraits>(format);
         break;
     case RenderTargetFormat::R16G16B16A16_SNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16B16A16_SNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16B16A16_SNORMTraits>(format);
         break;
     case RenderTargetFormat::R16G16B16A16_SINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16B16A16_SINTTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16B16A16_SINTTraits>(format);
         break;
     case RenderTargetFormat::R16G16B16A16_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16B16A16_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16B16A16_UINTTraits>(format);
         break;
     case RenderTargetFormat::R16G16B16A16_FLOAT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16B16A16_FLOATTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16B16A16_FLOATTraits>(format);
         break;
     case RenderTargetFormat::R32G32_FLOAT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32G32_FLOATTraits>>())
-            .first->second.get();
+        return impl->Build<R32G32_FLOATTraits>(format);
         break;
     case RenderTargetFormat::R32G32_SINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32G32_SINTTraits>>())
-            .first->second.get();
+        return impl->Build<R32G32_SINTTraits>(format);
         break;
     case RenderTargetFormat::R32G32_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32G32_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<R32G32_UINTTraits>(format);
         break;
     case RenderTargetFormat::R16G16B16X16_FLOAT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16B16X16_FLOATTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16B16X16_FLOATTraits>(format);
         break;
     case RenderTargetFormat::A8R8G8B8_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A8R8G8B8_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<A8R8G8B8_UNORMTraits>(format);
         break;
     case RenderTargetFormat::A8R8G8B8_SRGB:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A8R8G8B8_SRGBTraits>>())
-            .first->second.get();
+        return impl->Build<A8R8G8B8_SRGBTraits>(format);
         break;
     case RenderTargetFormat::A2B10G10R10_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A2B10G10R10_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<A2B10G10R10_UNORMTraits>(format);
         break;
     case RenderTargetFormat::A2B10G10R10_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A2B10G10R10_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<A2B10G10R10_UINTTraits>(format);
         break;
     case RenderTargetFormat::A2R10G10B10_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A2R10G10B10_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<A2R10G10B10_UNORMTraits>(format);
         break;
     case RenderTargetFormat::A8B8G8R8_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A8B8G8R8_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<A8B8G8R8_UNORMTraits>(format);
         break;
     case RenderTargetFormat::A8B8G8R8_SRGB:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A8B8G8R8_SRGBTraits>>())
-            .first->second.get();
+        return impl->Build<A8B8G8R8_SRGBTraits>(format);
         break;
     case RenderTargetFormat::A8B8G8R8_SNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A8B8G8R8_SNORMTraits>>())
-            .first->second.get();
+        return impl->Build<A8B8G8R8_SNORMTraits>(format);
         break;
     case RenderTargetFormat::A8B8G8R8_SINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A8B8G8R8_SINTTraits>>())
-            .first->second.get();
+        return impl->Build<A8B8G8R8_SINTTraits>(format);
         break;
     case RenderTargetFormat::A8B8G8R8_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A8B8G8R8_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<A8B8G8R8_UINTTraits>(format);
         break;
     case RenderTargetFormat::R16G16_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16_UNORMTraits>(format);
         break;
     case RenderTargetFormat::R16G16_SNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16_SNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16_SNORMTraits>(format);
         break;
     case RenderTargetFormat::R16G16_SINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16_SINTTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16_SINTTraits>(format);
         break;
     case RenderTargetFormat::R16G16_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16_UINTTraits>(format);
         break;
     case RenderTargetFormat::R16G16_FLOAT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16G16_FLOATTraits>>())
-            .first->second.get();
+        return impl->Build<R16G16_FLOATTraits>(format);
         break;
     case RenderTargetFormat::B10G11R11_FLOAT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<B10G11R11_FLOATTraits>>())
-            .first->second.get();
+        return impl->Build<B10G11R11_FLOATTraits>(format);
         break;
     case RenderTargetFormat::R32_SINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32_SINTTraits>>())
-            .first->second.get();
+        return impl->Build<R32_SINTTraits>(format);
         break;
     case RenderTargetFormat::R32_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<R32_UINTTraits>(format);
         break;
     case RenderTargetFormat::R32_FLOAT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R32_FLOATTraits>>())
-            .first->second.get();
+        return impl->Build<R32_FLOATTraits>(format);
         break;
     case RenderTargetFormat::X8R8G8B8_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<X8R8G8B8_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<X8R8G8B8_UNORMTraits>(format);
         break;
     case RenderTargetFormat::X8R8G8B8_SRGB:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<X8R8G8B8_SRGBTraits>>())
-            .first->second.get();
+        return impl->Build<X8R8G8B8_SRGBTraits>(format);
         break;
     case RenderTargetFormat::R5G6B5_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R5G6B5_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R5G6B5_UNORMTraits>(format);
         break;
     case RenderTargetFormat::A1R5G5B5_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<A1R5G5B5_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<A1R5G5B5_UNORMTraits>(format);
         break;
     case RenderTargetFormat::R8G8_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R8G8_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R8G8_UNORMTraits>(format);
         break;
     case RenderTargetFormat::R8G8_SNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R8G8_SNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R8G8_SNORMTraits>(format);
         break;
     case RenderTargetFormat::R8G8_SINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R8G8_SINTTraits>>())
-            .first->second.get();
+        return impl->Build<R8G8_SINTTraits>(format);
         break;
     case RenderTargetFormat::R8G8_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R8G8_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<R8G8_UINTTraits>(format);
         break;
     case RenderTargetFormat::R16_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R16_UNORMTraits>(format);
         break;
     case RenderTargetFormat::R16_SNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16_SNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R16_SNORMTraits>(format);
         break;
     case RenderTargetFormat::R16_SINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16_SINTTraits>>())
-            .first->second.get();
+        return impl->Build<R16_SINTTraits>(format);
         break;
     case RenderTargetFormat::R16_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<R16_UINTTraits>(format);
         break;
     case RenderTargetFormat::R16_FLOAT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R16_FLOATTraits>>())
-            .first->second.get();
+        return impl->Build<R16_FLOATTraits>(format);
         break;
     case RenderTargetFormat::R8_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R8_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R8_UNORMTraits>(format);
         break;
     case RenderTargetFormat::R8_SNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R8_SNORMTraits>>())
-            .first->second.get();
+        return impl->Build<R8_SNORMTraits>(format);
         break;
     case RenderTargetFormat::R8_SINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R8_SINTTraits>>())
-            .first->second.get();
+        return impl->Build<R8_SINTTraits>(format);
         break;
     case RenderTargetFormat::R8_UINT:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<R8_UINTTraits>>())
-            .first->second.get();
+        return impl->Build<R8_UINTTraits>(format);
         break;
     case RenderTargetFormat::X1R5G5B5_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<X1R5G5B5_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<X1R5G5B5_UNORMTraits>(format);
         break;
     case RenderTargetFormat::X8B8G8R8_UNORM:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<X8B8G8R8_UNORMTraits>>())
-            .first->second.get();
+        return impl->Build<X8B8G8R8_UNORMTraits>(format);
         break;
     case RenderTargetFormat::X8B8G8R8_SRGB:
-        return impl->converters_cache
-            .emplace(format, std::make_unique<ConverterImpl<X8B8G8R8_SRGBTraits>>())
-            .first->second.get();
+        return impl->Build<X8B8G8R8_SRGBTraits>(format);
         break;
     default: {
         UNIMPLEMENTED_MSG("This format {} converter is not implemented", format);
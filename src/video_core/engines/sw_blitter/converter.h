@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <span>
 
@@ -19,6 +20,35 @@ public:
     virtual ~Converter() = default;
 };
 
+/**
+ * Turns pixels of one format into another that stores the same channels with the same encoding,
+ * only in a different order (e.g. A8R8G8B8_UNORM into A8B8G8R8_UNORM), by moving bytes around.
+ * The result is the same as converting through the float intermediate, without the conversion.
+ */
+class PixelShuffle {
+public:
+    static constexpr size_t MAX_BYTES_PER_PIXEL = 16;
+
+    /**
+     * @param bytes_per_pixel - Size of a pixel of both formats, a power of two.
+     * @param source_bytes    - Input byte each output byte of a pixel is copied from, output bytes
+     *                          with a negative source are written as zero.
+     */
+    explicit PixelShuffle(size_t bytes_per_pixel,
+                          const std::array<s8, MAX_BYTES_PER_PIXEL>& source_bytes);
+
+    /// Shuffles the pixels of input into output, which can be the same span as input
+    void Apply(std::span<const u8> input, std::span<u8> output) const;
+
+private:
+    void ApplyScalar(const u8* input, u8* output, size_t num_bytes) const;
+
+    size_t bytes_per_pixel;
+    std::array<s8, MAX_BYTES_PER_PIXEL> source_bytes;
+    /// source_bytes repeated over 16 bytes of pixels, in the form taken by byte shuffles
+    std::array<u8, 16> lane_mask;
+};
+
 class ConverterFactory {
 public:
     ConverterFactory();
@@ -26,6 +56,11 @@ public:
 
     Converter* GetFormatConverter(RenderTargetFormat format);
 
+    /// Returns the shuffle turning src_format pixels into dst_format ones, or nullptr when the
+    /// formats differ in more than the order of their channels
+    const PixelShuffle* GetPixelShuffle(RenderTargetFormat src_format,
+                                        RenderTargetFormat dst_format);
+
 private:
     Converter* BuildConverter(RenderTargetFormat format);
 
@@ -64,9 +64,7 @@ class Format:
 
     def print_case(self):
         print("case RenderTargetFormat::" + self.name + ":")
-        print("  return impl->converters_cache")
-        print("    .emplace(format, std::make_unique<ConverterImpl<" + self.name + "Traits>>())")
-        print("    .first->second.get();")
+        print("  return impl->Build<" + self.name + "Traits>(format);")
         print("  break;")
 
 txt = """
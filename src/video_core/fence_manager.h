@@ -8,10 +8,10 @@
 #include <cstring>
 #include <deque>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <thread>
-#include <queue>
 
 #include "common/common_types.h"
 #include "common/microprofile.h"
@@ -78,19 +78,32 @@ public:
         }
         const bool should_flush = ShouldFlush();
         CommitAsyncFlushes();
-        TFence new_fence = CreateFence(!should_flush);
         if constexpr (can_async_check) {
             guard.lock();
         }
         if (delay_fence) {
             uncommitted_operations.emplace_back(std::move(func));
         }
-        pending_operations.emplace_back(std::move(uncommitted_operations));
-        QueueFence(new_fence);
+        if (!should_flush && !fences.empty()) {
+            // Nothing new to wait for on the host, this fence is signaled together with the last
+            // queued one. Saves a backend fence and a release per guest fence.
+            PendingFence& last = fences.back();
+            std::ranges::move(uncommitted_operations, std::back_inserter(last.operations));
+            uncommitted_operations.clear();
+            ++last.num_async_flushes;
+        } else {
+            TFence new_fence = CreateFence(!should_flush);
+            QueueFence(new_fence);
+            fences.push_back(PendingFence{
+                .fence = std::move(new_fence),
+                .operations = std::move(uncommitted_operations),
+                .num_async_flushes = 1,
+            });
+            uncommitted_operations.clear();
+        }
         if (!delay_fence) {
             func();
         }
-        fences.push(std::move(new_fence));
         if (should_flush) {
             rasterizer.FlushCommands();
         }
@@ -167,28 +180,28 @@ protected:
     TQueryCache& query_cache;
 
 private:
+    /// Guest fences released by a single backend fence
+    struct PendingFence {
+        TFence fence;
+        std::deque<std::function<void()>> operations;
+        /// Number of async flush commits made for the guest fences in this entry
+        size_t num_async_flushes;
+    };
+
     template <bool force_wait>
     void TryReleasePendingFences() {
         while (!fences.empty()) {
-            TFence& current_fence = fences.front();
-            if (ShouldWait() && !IsFenceSignaled(current_fence)) {
+            PendingFence& current = fences.front();
+            if (ShouldWait() && !IsFenceSignaled(current.fence)) {
                 if constexpr (force_wait) {
-                    WaitFence(current_fence);
+                    WaitFence(current.fence);
                 } else {
                     return;
                 }
             }
-            PopAsyncFlushes();
-            auto operations = std::move(pending_operations.front());
-            pending_operations.pop_front();
-            for (auto& operation : operations) {
-                operation();
-            }
-            {
-                std::unique_lock lock(ring_guard);
-                delayed_destruction_ring.Push(std::move(current_fence));
-            }
-            fences.pop();
+            PendingFence pending = std::move(current);
+            fences.pop_front();
+            Release(pending);
         }
     }
 
@@ -204,8 +217,7 @@ private:
         Common::SetCurrentThreadName(name.c_str());
         Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
 
-        TFence current_fence;
-        std::deque<std::function<void()>> current_operations;
+        PendingFence current;
         while (!stop_token.stop_requested()) {
             {
                 std::unique_lock lock(guard);
@@ -213,22 +225,27 @@ private:
                 if (stop_token.stop_requested()) [[unlikely]] {
                     return;
                 }
-                current_fence = std::move(fences.front());
-                current_operations = std::move(pending_operations.front());
-                fences.pop();
-                pending_operations.pop_front();
+                current = std::move(fences.front());
+                fences.pop_front();
             }
-            if (!current_fence->IsStubbed()) {
-                WaitFence(current_fence);
+            if (!current.fence->IsStubbed()) {
+                WaitFence(current.fence);
             }
+            Release(current);
+        }
+    }
+
+    void Release(PendingFence& pending) {
+        for (size_t i = 0; i < pending.num_async_flushes; ++i) {
             PopAsyncFlushes();
-            for (auto& operation : current_operations) {
-                operation();
-            }
-            {
-                std::unique_lock lock(ring_guard);
-                delayed_destruction_ring.Push(std::move(current_fence));
-            }
+        }
+        for (auto& operation : pending.operations) {
+            operation();
+        }
+        pending.operations.clear();
+        {
+            std::unique_lock lock(ring_guard);
+            delayed_destruction_ring.Push(std::move(pending.fence));
         }
     }
 
@@ -262,9 +279,8 @@ private:
         query_cache.CommitAsyncFlushes();
     }
 
-    std::queue<TFence> fences;
+    std::deque<PendingFence> fences;
     std::deque<std::function<void()>> uncommitted_operations;
-    std::deque<std::deque<std::function<void()>>> pending_operations;
 
     std::mutex guard;
     std::mutex ring_guard;
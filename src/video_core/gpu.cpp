@@ -1,12 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <utility>
 
 #include "common/assert.h"
 #include "common/microprofile.h"
@@ -15,6 +18,7 @@
 #include "core/core_timing.h"
 #include "core/frontend/emu_window.h"
 #include "core/frontend/graphics_context.h"
+#include "core/gpu_dirty_memory_manager.h"
 #include "core/hle/service/nvdrv/nvdata.h"
 #include "core/perf_stats.h"
 #include "video_core/cdma_pusher.h"
@@ -27,19 +31,29 @@
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/engines/maxwell_dma.h"
 #include "video_core/gpu.h"
+#include "video_core/gpu_capture.h"
 #include "video_core/gpu_thread.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/host1x/syncpoint_manager.h"
+#include "video_core/memory_budget.h"
 #include "video_core/memory_manager.h"
+#include "video_core/memory_stats.h"
+#include "video_core/pipeline_stats.h"
 #include "video_core/renderer_base.h"
 #include "video_core/shader_notify.h"
+#include "video_core/texture_cache/texture_cache_stats.h"
 
 namespace Tegra {
 
 struct GPU::Impl {
     explicit Impl(GPU& gpu_, Core::System& system_, bool is_async_, bool use_nvdec_)
         : gpu{gpu_}, system{system_}, host1x{system.Host1x()}, use_nvdec{use_nvdec_},
-          shader_notify{std::make_unique<VideoCore::ShaderNotify>()}, is_async{is_async_},
+          shader_notify{std::make_unique<VideoCore::ShaderNotify>()},
+          memory_budget{std::make_unique<VideoCore::MemoryBudget>()},
+          memory_stats{std::make_unique<VideoCore::MemoryStats>()},
+          pipeline_stats{std::make_unique<VideoCore::PipelineStats>()},
+          texture_cache_stats{std::make_unique<VideoCommon::TextureCacheStats>()},
+          is_async{is_async_},
           gpu_thread{system_, is_async_}, scheduler{std::make_unique<Control::Scheduler>(gpu)} {}
 
     ~Impl() = default;
@@ -69,12 +83,29 @@ struct GPU::Impl {
 
     void InitChannel(Control::ChannelState& to_init, u64 program_id) {
         to_init.Init(system, gpu, program_id);
+        if (Settings::values.dump_texture_cache_stats.GetValue()) {
+            texture_cache_stats->OpenDump(program_id);
+        }
         to_init.BindRasterizer(rasterizer);
         rasterizer->InitializeChannel(to_init);
+        if (gpu_capture) {
+            gpu_capture->RecordChannel(to_init.bind_id, *to_init.memory_manager, program_id);
+        }
     }
 
     void InitAddressSpace(Tegra::MemoryManager& memory_manager) {
         memory_manager.BindRasterizer(rasterizer);
+        if (Settings::values.capture_gpu_commands.GetValue() && !gpu_capture) {
+            // The program is known once it creates its first address space, and it can't have
+            // submitted anything before that
+            gpu_capture = VideoCommon::GpuCaptureWriter::Create(
+                system.GetApplicationProcessProgramID(), host1x.MemoryManager());
+            rasterizer->BindCapture(gpu_capture.get());
+        }
+        if (gpu_capture) {
+            gpu_capture->RecordAddressSpace(memory_manager);
+            memory_manager.BindCapture(gpu_capture.get());
+        }
     }
 
     void ReleaseChannel(Control::ChannelState& to_release) {
@@ -96,9 +127,12 @@ struct GPU::Impl {
 
     /// Synchronizes CPU writes with Host GPU memory.
     void InvalidateGPUCache() {
-        std::function<void(PAddr, size_t)> callback_writes(
-            [this](PAddr address, size_t size) { rasterizer->OnCacheInvalidation(address, size); });
-        system.GatherGPUDirtyMemory(callback_writes);
+        size_t count;
+        while ((count = system.GatherGPUDirtyMemory(dirty_ranges)) != 0) {
+            for (const auto& range : std::span(dirty_ranges).first(count)) {
+                rasterizer->OnCacheInvalidation(range.address, range.size);
+            }
+        }
     }
 
     /// Signal the ending of command list.
@@ -110,6 +144,8 @@ struct GPU::Impl {
     /// Request a host GPU memory flush from the CPU.
     template <typename Func>
     [[nodiscard]] u64 RequestSyncOperation(Func&& action) {
+        // The action runs in the middle of the GPU thread's work, queued invalidations go first
+        gpu_thread.SyncRegionCommands();
         std::unique_lock lck{sync_request_mutex};
         const u64 fence = ++last_sync_fence;
         sync_requests.emplace_back(action);
@@ -196,6 +232,58 @@ struct GPU::Impl {
         return *shader_notify;
     }
 
+    /// Returns a reference to the device memory budget shared by the caches.
+    [[nodiscard]] VideoCore::MemoryBudget& MemoryBudget() {
+        return *memory_budget;
+    }
+
+    /// Returns a reference to the device memory statistics.
+    [[nodiscard]] VideoCore::MemoryStats& MemoryStats() {
+        return *memory_stats;
+    }
+
+    /// Returns a const reference to the device memory statistics.
+    [[nodiscard]] const VideoCore::MemoryStats& MemoryStats() const {
+        return *memory_stats;
+    }
+
+    /// Returns a reference to the per pipeline compiler statistics.
+    [[nodiscard]] VideoCore::PipelineStats& PipelineStats() {
+        return *pipeline_stats;
+    }
+
+    /// Returns a const reference to the per pipeline compiler statistics.
+    [[nodiscard]] const VideoCore::PipelineStats& PipelineStats() const {
+        return *pipeline_stats;
+    }
+
+    /// Returns a reference to the per frame texture cache statistics.
+    [[nodiscard]] VideoCommon::TextureCacheStats& TextureCacheStats() {
+        return *texture_cache_stats;
+    }
+
+    /// Returns the capture the submissions are recorded into, or nullptr when not capturing.
+    [[nodiscard]] VideoCommon::GpuCaptureWriter* Capture() {
+        return gpu_capture.get();
+    }
+
+    void ReportSemaphoreWait(std::chrono::nanoseconds wait) {
+        const auto wait_ns = static_cast<u64>(wait.count());
+        std::scoped_lock lock{semaphore_wait_mutex};
+        ++semaphore_wait_stats.waits;
+        semaphore_wait_stats.wait_ns += wait_ns;
+        semaphore_wait_stats.max_wait_ns = std::max(semaphore_wait_stats.max_wait_ns, wait_ns);
+    }
+
+    [[nodiscard]] Engines::SemaphoreWaitStats GetAndResetSemaphoreWaitStats() {
+        std::scoped_lock lock{semaphore_wait_mutex};
+        return std::exchange(semaphore_wait_stats, {});
+    }
+
+    [[nodiscard]] VideoCommon::GPUThread::QueueStats GetAndResetGpuThreadQueueStats() {
+        return gpu_thread.GetAndResetQueueStats();
+    }
+
     [[nodiscard]] u64 GetTicks() const {
         u64 gpu_tick = system.CoreTiming().GetGPUTicks();
 
@@ -218,6 +306,14 @@ struct GPU::Impl {
         system.GetPerfStats().EndGameFrame();
     }
 
+    void RendererPresentLatencyNotify(std::chrono::nanoseconds latency) {
+        system.GetPerfStats().AddPresentLatency(latency);
+    }
+
+    void RendererPresentWaitNotify(std::chrono::nanoseconds wait) {
+        system.GetPerfStats().AddPresentWait(wait);
+    }
+
     /// Performs any additional setup necessary in order to begin GPU emulation.
     /// This can be used to launch any necessary threads and register any necessary
     /// core timing events.
@@ -260,9 +356,8 @@ struct GPU::Impl {
             cdma_pushers.insert_or_assign(id, std::make_unique<Tegra::CDmaPusher>(host1x));
         }
 
-        // SubmitCommandBuffer would make the nvdec operations async, this is not currently working
-        // TODO(ameerj): RE proper async nvdec operation
-        // gpu_thread.SubmitCommandBuffer(std::move(entries));
+        // With asynchronous decoding, every pusher processes its commands on its own thread while
+        // NVDEC and VIC decode and write the frames on theirs, signalling the syncpoints once done
         cdma_pushers[id]->ProcessEntries(std::move(entries));
     }
 
@@ -325,6 +420,9 @@ struct GPU::Impl {
         }
         const auto wait_fence =
             RequestSyncOperation([this, current_request_counter, &layers, &fences, num_fences] {
+                if (gpu_capture) {
+                    gpu_capture->RecordFrameEnd();
+                }
                 auto& syncpoint_manager = host1x.GetSyncpointManager();
                 if (num_fences == 0) {
                     renderer->Composite(layers);
@@ -358,6 +456,12 @@ struct GPU::Impl {
         return out;
     }
 
+    void WaitIdle() {
+        const auto wait_fence = RequestSyncOperation([this] { rasterizer->FlushCommands(); });
+        gpu_thread.TickGPU();
+        WaitForSyncOperation(wait_fence);
+    }
+
     GPU& gpu;
     Core::System& system;
     Host1x::Host1x& host1x;
@@ -370,8 +474,23 @@ struct GPU::Impl {
     s32 new_channel_id{1};
     /// Shader build notifier
     std::unique_ptr<VideoCore::ShaderNotify> shader_notify;
+    /// Device memory target the caches evict toward together
+    std::unique_ptr<VideoCore::MemoryBudget> memory_budget;
+    /// Device memory statistics reported by the caches
+    std::unique_ptr<VideoCore::MemoryStats> memory_stats;
+    /// Compiler statistics of the pipelines built by the renderer
+    std::unique_ptr<VideoCore::PipelineStats> pipeline_stats;
+    /// Texture cache statistics reported every frame
+    std::unique_ptr<VideoCommon::TextureCacheStats> texture_cache_stats;
+    /// Submissions capture, created with the first address space when capturing is enabled
+    std::unique_ptr<VideoCommon::GpuCaptureWriter> gpu_capture;
+    /// Puller waits on semaphore acquires, protected by semaphore_wait_mutex
+    Engines::SemaphoreWaitStats semaphore_wait_stats{};
+    std::mutex semaphore_wait_mutex;
     /// When true, we are about to shut down emulation session, so terminate outstanding tasks
     std::atomic_bool shutting_down{};
+    /// Scratch storage for the CPU written ranges drained on cache invalidation
+    std::array<Core::GPUDirtyRange, 256> dirty_ranges{};
 
     std::array<std::atomic<u32>, Service::Nvidia::MaxSyncPoints> syncpoints{};
 
@@ -511,6 +630,46 @@ const VideoCore::ShaderNotify& GPU::ShaderNotify() const {
     return impl->ShaderNotify();
 }
 
+VideoCore::MemoryBudget& GPU::MemoryBudget() {
+    return impl->MemoryBudget();
+}
+
+VideoCore::MemoryStats& GPU::MemoryStats() {
+    return impl->MemoryStats();
+}
+
+const VideoCore::MemoryStats& GPU::MemoryStats() const {
+    return impl->MemoryStats();
+}
+
+VideoCore::PipelineStats& GPU::PipelineStats() {
+    return impl->PipelineStats();
+}
+
+const VideoCore::PipelineStats& GPU::PipelineStats() const {
+    return impl->PipelineStats();
+}
+
+VideoCommon::TextureCacheStats& GPU::TextureCacheStats() {
+    return impl->TextureCacheStats();
+}
+
+VideoCommon::GpuCaptureWriter* GPU::Capture() {
+    return impl->Capture();
+}
+
+void GPU::ReportSemaphoreWait(std::chrono::nanoseconds wait) {
+    impl->ReportSemaphoreWait(wait);
+}
+
+Engines::SemaphoreWaitStats GPU::GetAndResetSemaphoreWaitStats() {
+    return impl->GetAndResetSemaphoreWaitStats();
+}
+
+VideoCommon::GPUThread::QueueStats GPU::GetAndResetGpuThreadQueueStats() {
+    return impl->GetAndResetGpuThreadQueueStats();
+}
+
 void GPU::RequestComposite(std::vector<Tegra::FramebufferConfig>&& layers,
                            std::vector<Service::Nvidia::NvFence>&& fences) {
     impl->RequestComposite(std::move(layers), std::move(fences));
@@ -520,6 +679,10 @@ std::vector<u8> GPU::GetAppletCaptureBuffer() {
     return impl->GetAppletCaptureBuffer();
 }
 
+void GPU::WaitIdle() {
+    impl->WaitIdle();
+}
+
 u64 GPU::GetTicks() const {
     return impl->GetTicks();
 }
@@ -536,6 +699,14 @@ void GPU::RendererFrameEndNotify() {
     impl->RendererFrameEndNotify();
 }
 
+void GPU::RendererPresentLatencyNotify(std::chrono::nanoseconds latency) {
+    impl->RendererPresentLatencyNotify(latency);
+}
+
+void GPU::RendererPresentWaitNotify(std::chrono::nanoseconds wait) {
+    impl->RendererPresentWaitNotify(wait);
+}
+
 void GPU::Start() {
     impl->Start();
 }
@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 
 #include "common/bit_field.h"
 #include "common/common_types.h"
 #include "core/hle/service/nvdrv/nvdata.h"
 #include "video_core/cdma_pusher.h"
+#include "video_core/engines/semaphore_wait_stats.h"
+#include "video_core/gpu_thread_queue_stats.h"
 #include "video_core/framebuffer_config.h"
 #include "video_core/rasterizer_download_area.h"
 
@@ -17,10 +20,18 @@ class System;
 } // namespace Core
 
 namespace VideoCore {
+class MemoryBudget;
+class MemoryStats;
+class PipelineStats;
 class RendererBase;
 class ShaderNotify;
 } // namespace VideoCore
 
+namespace VideoCommon {
+class GpuCaptureWriter;
+class TextureCacheStats;
+}
+
 namespace Tegra {
 class DmaPusher;
 struct CommandList;
@@ -204,6 +215,36 @@ public:
     /// Returns a const reference to the shader notifier.
     [[nodiscard]] const VideoCore::ShaderNotify& ShaderNotify() const;
 
+    /// Returns a reference to the device memory budget shared by the caches.
+    [[nodiscard]] VideoCore::MemoryBudget& MemoryBudget();
+
+    /// Returns a reference to the device memory statistics.
+    [[nodiscard]] VideoCore::MemoryStats& MemoryStats();
+
+    /// Returns a const reference to the device memory statistics.
+    [[nodiscard]] const VideoCore::MemoryStats& MemoryStats() const;
+
+    /// Returns a reference to the per pipeline compiler statistics.
+    [[nodiscard]] VideoCore::PipelineStats& PipelineStats();
+
+    /// Returns a const reference to the per pipeline compiler statistics.
+    [[nodiscard]] const VideoCore::PipelineStats& PipelineStats() const;
+
+    /// Returns a reference to the per frame texture cache statistics.
+    [[nodiscard]] VideoCommon::TextureCacheStats& TextureCacheStats();
+
+    /// Returns the capture the submissions are recorded into, or nullptr when not capturing.
+    [[nodiscard]] VideoCommon::GpuCaptureWriter* Capture();
+
+    /// Records the host time a puller was blocked on a semaphore acquire, thread safe
+    void ReportSemaphoreWait(std::chrono::nanoseconds wait);
+
+    /// Returns the semaphore acquire waits since the last call, thread safe
+    [[nodiscard]] Engines::SemaphoreWaitStats GetAndResetSemaphoreWaitStats();
+
+    /// Returns the GPU thread queue counters since the last call, thread safe
+    [[nodiscard]] VideoCommon::GPUThread::QueueStats GetAndResetGpuThreadQueueStats();
+
     [[nodiscard]] u64 GetTicks() const;
 
     [[nodiscard]] bool IsAsync() const;
@@ -212,11 +253,20 @@ public:
 
     void RendererFrameEndNotify();
 
+    /// Reports how long a composited frame took to be displayed.
+    void RendererPresentLatencyNotify(std::chrono::nanoseconds latency);
+
+    /// Reports how long the renderer waited for frames in flight before composing a new one.
+    void RendererPresentWaitNotify(std::chrono::nanoseconds wait);
+
     void RequestComposite(std::vector<Tegra::FramebufferConfig>&& layers,
                           std::vector<Service::Nvidia::NvFence>&& fences);
 
     std::vector<u8> GetAppletCaptureBuffer();
 
+    /// Flushes the commands pushed so far to the host GPU, and waits until the GPU executed them.
+    void WaitIdle();
+
     /// Performs any additional setup necessary in order to begin GPU emulation.
     /// This can be used to launch any necessary threads and register any necessary
     /// core timing events.
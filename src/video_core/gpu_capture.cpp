@@ -0,0 +1,646 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/div_ceil.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/host_memory.h"
+#include "common/logging/log.h"
+#include "common/page_table.h"
+#include "core/core.h"
+#include "core/device_memory.h"
+#include "core/memory.h"
+#include "video_core/control/channel_state.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/gpu.h"
+#include "video_core/gpu_capture.h"
+#include "video_core/host1x/host1x.h"
+#include "video_core/memory_manager.h"
+
+namespace VideoCommon {
+
+namespace {
+
+constexpr u32 CaptureMagic = 0x43475559; // "YUGC"
+constexpr u32 CaptureVersion = 2;
+
+enum class RecordType : u32 {
+    AddressSpace = 0,
+    Map = 1,
+    Unmap = 2,
+    Channel = 3,
+    Memory = 4,
+    CommandList = 5,
+    FrameEnd = 6,
+};
+
+struct FileHeader {
+    u32 magic;
+    u32 version;
+    u64 program_id;
+};
+static_assert(sizeof(FileHeader) == 16, "FileHeader has incorrect size");
+
+struct RecordHeader {
+    RecordType type;
+    u32 reserved;
+    u64 size; ///< Bytes of the record following the header
+};
+static_assert(sizeof(RecordHeader) == 16, "RecordHeader has incorrect size");
+
+static_assert(sizeof(CapturedAddressSpace) == 40, "CapturedAddressSpace has incorrect size");
+static_assert(sizeof(CapturedUnmap) == 24, "CapturedUnmap has incorrect size");
+
+struct MapRecord {
+    u64 as_id;
+    u64 gpu_addr;
+    u64 dev_addr;
+    u64 size;
+    u32 kind;
+    u8 is_big_pages;
+    u8 is_sparse;
+    u16 reserved;
+};
+static_assert(sizeof(MapRecord) == 40, "MapRecord has incorrect size");
+
+struct ChannelRecord {
+    s32 channel;
+    u32 reserved;
+    u64 as_id;
+    u64 program_id;
+};
+static_assert(sizeof(ChannelRecord) == 24, "ChannelRecord has incorrect size");
+
+/// Followed by the memory contents
+struct MemoryRecord {
+    u64 address;
+};
+static_assert(sizeof(MemoryRecord) == 8, "MemoryRecord has incorrect size");
+
+/// Followed by the headers and the prefetched command words
+struct CommandListRecord {
+    s32 channel;
+    u32 num_prefetch;
+    u64 num_headers;
+};
+static_assert(sizeof(CommandListRecord) == 16, "CommandListRecord has incorrect size");
+
+template <typename T>
+std::span<const u8> AsBytes(const T& object) {
+    return std::span{reinterpret_cast<const u8*>(&object), sizeof(T)};
+}
+
+template <typename T>
+bool ReadFixed(std::span<const u8> payload, T& object) {
+    if (payload.size() < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&object, payload.data(), sizeof(T));
+    return true;
+}
+
+/// Backs the device pages a capture uses with emulated DRAM, through a process whose virtual
+/// addresses are the device addresses
+class ReplayDeviceMemory {
+public:
+    explicit ReplayDeviceMemory(Core::System& system)
+        : device_memory{system.Host1x().MemoryManager()}, dram{system.DeviceMemory()},
+          memory{system} {
+        page_table.Resize(Tegra::MaxwellDeviceTraits::device_virtual_bits,
+                          Core::Memory::YUZU_PAGEBITS);
+        memory.SetCurrentPageTable(page_table);
+        asid = device_memory.RegisterProcess(&memory);
+    }
+
+    ~ReplayDeviceMemory() {
+        for (const auto& [address, size] : mapped) {
+            device_memory.Unmap(address, size);
+            device_memory.Free(address, size);
+        }
+        device_memory.UnregisterProcess(asid);
+    }
+
+    ReplayDeviceMemory(const ReplayDeviceMemory&) = delete;
+    ReplayDeviceMemory& operator=(const ReplayDeviceMemory&) = delete;
+
+    /// Maps every device page the capture maps or writes
+    [[nodiscard]] bool Map(const GpuCapture& capture) {
+        constexpr u64 max_address{1ULL << Tegra::MaxwellDeviceTraits::device_virtual_bits};
+
+        std::vector<std::pair<u64, u64>> runs;
+        const auto add_run = [&](DAddr address, u64 size) {
+            if (size == 0 || address + size > max_address) {
+                return;
+            }
+            runs.emplace_back(address >> Core::Memory::YUZU_PAGEBITS,
+                              Common::DivCeil(address + size, Core::Memory::YUZU_PAGESIZE));
+        };
+        for (const CapturedFrame& frame : capture.frames) {
+            for (const CapturedEvent& event : frame.events) {
+                if (const auto* map = std::get_if<CapturedMap>(&event); map && !map->is_sparse) {
+                    add_run(map->dev_addr, map->size);
+                } else if (const auto* range = std::get_if<CapturedMemory>(&event)) {
+                    add_run(range->address, range->data.size());
+                }
+            }
+        }
+        std::ranges::sort(runs);
+
+        const u64 dram_size{dram.buffer.BackingSize()};
+        u64 backing{};
+        for (size_t i = 0; i < runs.size();) {
+            auto [first_page, end_page] = runs[i];
+            for (i++; i < runs.size() && runs[i].first <= end_page; i++) {
+                end_page = std::max(end_page, runs[i].second);
+            }
+            const DAddr address{first_page << Core::Memory::YUZU_PAGEBITS};
+            const u64 size{(end_page - first_page) << Core::Memory::YUZU_PAGEBITS};
+            if (backing + size > dram_size) {
+                LOG_ERROR(HW_GPU, "The capture uses more device memory than the emulated DRAM");
+                return false;
+            }
+            memory.MapMemoryRegion(page_table, address, size,
+                                   Core::DramMemoryMap::Base + backing,
+                                   Common::MemoryPermission::ReadWrite, false);
+            device_memory.AllocateFixed(address, size);
+            device_memory.Map(address, address, size, asid);
+            mapped.emplace_back(address, size);
+            backing += size;
+        }
+        return true;
+    }
+
+    void Write(const CapturedMemory& range) {
+        device_memory.WriteBlockUnsafe(range.address, range.data.data(), range.data.size());
+    }
+
+private:
+    Tegra::MaxwellDeviceMemoryManager& device_memory;
+    Core::DeviceMemory& dram;
+    Common::PageTable page_table;
+    Core::Memory::Memory memory;
+    Core::Asid asid{};
+    std::vector<std::pair<DAddr, u64>> mapped;
+};
+
+/// Applies the captured events to the GPU, creating the address spaces and channels they use
+class ReplayState {
+public:
+    explicit ReplayState(Core::System& system_, ReplayDeviceMemory& replay_memory_,
+                         GpuReplayStats& stats_)
+        : system{system_}, gpu{system.GPU()}, replay_memory{replay_memory_}, stats{stats_} {}
+
+    void operator()(const CapturedAddressSpace& address_space) {
+        if (address_spaces.contains(address_space.id)) {
+            return;
+        }
+        auto memory_manager = std::make_shared<Tegra::MemoryManager>(
+            system, system.Host1x().MemoryManager(), address_space.address_space_bits,
+            address_space.split_address, address_space.big_page_bits, address_space.page_bits);
+        gpu.InitAddressSpace(*memory_manager);
+        address_spaces.emplace(address_space.id, std::move(memory_manager));
+    }
+
+    void operator()(const CapturedMap& map) {
+        Tegra::MemoryManager* const memory_manager = FindAddressSpace(map.as_id);
+        if (!memory_manager) {
+            return;
+        }
+        if (map.is_sparse) {
+            memory_manager->MapSparse(map.gpu_addr, map.size, map.is_big_pages);
+        } else {
+            memory_manager->Map(map.gpu_addr, map.dev_addr, map.size, map.kind, map.is_big_pages);
+        }
+    }
+
+    void operator()(const CapturedUnmap& unmap) {
+        if (Tegra::MemoryManager* const memory_manager = FindAddressSpace(unmap.as_id)) {
+            memory_manager->Unmap(unmap.gpu_addr, unmap.size);
+        }
+    }
+
+    void operator()(const CapturedChannel& channel) {
+        if (channels.contains(channel.channel)) {
+            return;
+        }
+        const auto it = address_spaces.find(channel.as_id);
+        if (it == address_spaces.end()) {
+            LOG_WARNING(HW_GPU, "Channel {} uses an address space the capture did not create",
+                        channel.channel);
+            return;
+        }
+        auto channel_state = gpu.AllocateChannel();
+        channel_state->memory_manager = it->second;
+        gpu.InitChannel(*channel_state, channel.program_id);
+        channels.emplace(channel.channel, std::move(channel_state));
+    }
+
+    void operator()(const CapturedMemory& range) {
+        if (has_pending_work) {
+            // The submissions already pushed must not see the contents meant for later ones
+            gpu.WaitIdle();
+            has_pending_work = false;
+        }
+        replay_memory.Write(range);
+        gpu.InvalidateRegion(range.address, range.data.size());
+        stats.memory_bytes += range.data.size();
+    }
+
+    void operator()(const CapturedCommandList& list) {
+        const auto it = channels.find(list.channel);
+        if (it == channels.end()) {
+            return;
+        }
+        Tegra::CommandList entries{list.headers.size()};
+        std::memcpy(entries.command_lists.data(), list.headers.data(),
+                    list.headers.size() * sizeof(u64));
+        entries.prefetch_command_list.resize(list.prefetch.size());
+        std::memcpy(entries.prefetch_command_list.data(), list.prefetch.data(),
+                    list.prefetch.size() * sizeof(u32));
+        gpu.PushGPUEntries(it->second->bind_id, std::move(entries));
+        has_pending_work = true;
+        ++stats.command_lists;
+    }
+
+    void EndFrame() {
+        gpu.WaitIdle();
+        has_pending_work = false;
+    }
+
+private:
+    Tegra::MemoryManager* FindAddressSpace(u64 id) {
+        const auto it = address_spaces.find(id);
+        return it != address_spaces.end() ? it->second.get() : nullptr;
+    }
+
+    Core::System& system;
+    Tegra::GPU& gpu;
+    ReplayDeviceMemory& replay_memory;
+    GpuReplayStats& stats;
+    std::map<u64, std::shared_ptr<Tegra::MemoryManager>> address_spaces;
+    std::map<s32, std::shared_ptr<Tegra::Control::ChannelState>> channels;
+    bool has_pending_work{};
+};
+
+} // Anonymous namespace
+
+GpuCaptureWriter::GpuCaptureWriter(const std::filesystem::path& path, u64 program_id,
+                                   Tegra::MaxwellDeviceMemoryManager& device_memory_)
+    : file{path, Common::FS::FileAccessMode::Write, Common::FS::FileType::BinaryFile},
+      device_memory{device_memory_} {
+    if (!file.IsOpen()) {
+        LOG_ERROR(Common_Filesystem, "Unable to open or create file at {}",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    const FileHeader header{
+        .magic = CaptureMagic,
+        .version = CaptureVersion,
+        .program_id = program_id,
+    };
+    if (!file.WriteObject(header)) {
+        LOG_ERROR(HW_GPU, "Failed to write GPU capture header");
+        file.Close();
+    }
+}
+
+GpuCaptureWriter::~GpuCaptureWriter() {
+    if (file.IsOpen()) {
+        FlushCommandList();
+    }
+}
+
+std::unique_ptr<GpuCaptureWriter> GpuCaptureWriter::Create(
+    u64 program_id, Tegra::MaxwellDeviceMemoryManager& device_memory) {
+    const auto base_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::DumpDir)};
+    const auto capture_dir{base_dir / "gpu_captures"};
+    if (!Common::FS::CreateDir(base_dir) || !Common::FS::CreateDir(capture_dir)) {
+        LOG_ERROR(Common_Filesystem, "Failed to create GPU capture directories");
+        return nullptr;
+    }
+    const auto name{capture_dir / fmt::format("{:016X}.gpucap", program_id)};
+    auto writer = std::make_unique<GpuCaptureWriter>(name, program_id, device_memory);
+    if (!writer->IsOpen()) {
+        return nullptr;
+    }
+    LOG_INFO(HW_GPU, "Capturing GPU submissions to {}", Common::FS::PathToUTF8String(name));
+    return writer;
+}
+
+void GpuCaptureWriter::RecordAddressSpace(const Tegra::MemoryManager& memory_manager) {
+    std::scoped_lock lk{mutex};
+    if (!file.IsOpen()) {
+        return;
+    }
+    const CapturedAddressSpace record{
+        .id = memory_manager.GetID(),
+        .address_space_bits = memory_manager.GetAddressSpaceBits(),
+        .split_address = memory_manager.GetSplitAddress(),
+        .big_page_bits = memory_manager.GetBigPageBits(),
+        .page_bits = memory_manager.GetPageBits(),
+    };
+    WriteRecord(static_cast<u32>(RecordType::AddressSpace), AsBytes(record));
+}
+
+void GpuCaptureWriter::RecordMap(const Tegra::MemoryManager& memory_manager, GPUVAddr gpu_addr,
+                                 DAddr dev_addr, u64 size, Tegra::PTEKind kind, bool is_big_pages,
+                                 bool is_sparse) {
+    std::scoped_lock lk{mutex};
+    if (!file.IsOpen()) {
+        return;
+    }
+    const MapRecord record{
+        .as_id = memory_manager.GetID(),
+        .gpu_addr = gpu_addr,
+        .dev_addr = dev_addr,
+        .size = size,
+        .kind = static_cast<u32>(kind),
+        .is_big_pages = is_big_pages,
+        .is_sparse = is_sparse,
+        .reserved = 0,
+    };
+    WriteRecord(static_cast<u32>(RecordType::Map), AsBytes(record));
+}
+
+void GpuCaptureWriter::RecordUnmap(const Tegra::MemoryManager& memory_manager, GPUVAddr gpu_addr,
+                                   u64 size) {
+    std::scoped_lock lk{mutex};
+    if (!file.IsOpen()) {
+        return;
+    }
+    // The submission being executed may still use the mapping
+    FlushCommandList();
+    const CapturedUnmap record{
+        .as_id = memory_manager.GetID(),
+        .gpu_addr = gpu_addr,
+        .size = size,
+    };
+    WriteRecord(static_cast<u32>(RecordType::Unmap), AsBytes(record));
+}
+
+void GpuCaptureWriter::RecordChannel(s32 channel, const Tegra::MemoryManager& memory_manager,
+                                     u64 program_id) {
+    std::scoped_lock lk{mutex};
+    if (!file.IsOpen()) {
+        return;
+    }
+    const ChannelRecord record{
+        .channel = channel,
+        .reserved = 0,
+        .as_id = memory_manager.GetID(),
+        .program_id = program_id,
+    };
+    WriteRecord(static_cast<u32>(RecordType::Channel), AsBytes(record));
+}
+
+void GpuCaptureWriter::RecordCommandList(s32 channel, const Tegra::CommandList& entries) {
+    std::scoped_lock lk{mutex};
+    if (!file.IsOpen()) {
+        return;
+    }
+    FlushCommandList();
+
+    const CommandListRecord record{
+        .channel = channel,
+        .num_prefetch = static_cast<u32>(entries.prefetch_command_list.size()),
+        .num_headers = entries.command_lists.size(),
+    };
+    const size_t headers_size = entries.command_lists.size() * sizeof(u64);
+    const size_t prefetch_size = entries.prefetch_command_list.size() * sizeof(u32);
+    pending_list.resize(sizeof(record) + headers_size + prefetch_size);
+    std::memcpy(pending_list.data(), &record, sizeof(record));
+    std::memcpy(pending_list.data() + sizeof(record), entries.command_lists.data(), headers_size);
+    std::memcpy(pending_list.data() + sizeof(record) + headers_size,
+                entries.prefetch_command_list.data(), prefetch_size);
+    has_pending_list = true;
+}
+
+void GpuCaptureWriter::RecordRead(DAddr address, u64 size) {
+    std::scoped_lock lk{mutex};
+    if (!file.IsOpen() || size == 0) {
+        return;
+    }
+    scratch.resize(size);
+    device_memory.ReadBlockUnsafe(address, scratch.data(), size);
+    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(scratch.data()), size);
+    const auto [it, is_new] = recorded_hashes.try_emplace({address, size}, hash);
+    if (!is_new) {
+        if (it->second == hash) {
+            return;
+        }
+        it->second = hash;
+    }
+    const MemoryRecord record{.address = address};
+    WriteRecord(static_cast<u32>(RecordType::Memory), AsBytes(record), scratch);
+}
+
+void GpuCaptureWriter::RecordFrameEnd() {
+    std::scoped_lock lk{mutex};
+    if (!file.IsOpen()) {
+        return;
+    }
+    FlushCommandList();
+    WriteRecord(static_cast<u32>(RecordType::FrameEnd), {});
+    (void)file.Flush();
+}
+
+void GpuCaptureWriter::FlushCommandList() {
+    if (!has_pending_list) {
+        return;
+    }
+    has_pending_list = false;
+    WriteRecord(static_cast<u32>(RecordType::CommandList), pending_list);
+}
+
+void GpuCaptureWriter::WriteRecord(u32 type, std::span<const u8> payload,
+                                   std::span<const u8> data) {
+    const RecordHeader header{
+        .type = static_cast<RecordType>(type),
+        .reserved = 0,
+        .size = payload.size() + data.size(),
+    };
+    if (!file.WriteObject(header) || file.WriteSpan(payload) != payload.size() ||
+        file.WriteSpan(data) != data.size()) {
+        LOG_ERROR(HW_GPU, "Failed to write GPU capture record, stopping capture");
+        file.Close();
+    }
+}
+
+std::optional<GpuCapture> LoadGpuCapture(const std::filesystem::path& path) {
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Common_Filesystem, "Unable to open file at {}",
+                  Common::FS::PathToUTF8String(path));
+        return std::nullopt;
+    }
+    FileHeader header{};
+    if (!file.ReadObject(header) || header.magic != CaptureMagic) {
+        LOG_ERROR(HW_GPU, "{} is not a GPU capture", Common::FS::PathToUTF8String(path));
+        return std::nullopt;
+    }
+    if (header.version != CaptureVersion) {
+        LOG_ERROR(HW_GPU, "Unsupported GPU capture version {}", header.version);
+        return std::nullopt;
+    }
+
+    GpuCapture capture{.program_id = header.program_id};
+    CapturedFrame frame;
+    const u64 file_size = file.GetSize();
+    std::vector<u8> payload;
+    RecordHeader record{};
+    while (file.ReadObject(record)) {
+        if (record.size > file_size - static_cast<u64>(file.Tell())) {
+            LOG_ERROR(HW_GPU, "Truncated GPU capture record");
+            break;
+        }
+        payload.resize(record.size);
+        if (file.ReadSpan<u8>(payload) != payload.size()) {
+            LOG_ERROR(HW_GPU, "Truncated GPU capture record");
+            break;
+        }
+        bool is_valid = true;
+        switch (record.type) {
+        case RecordType::AddressSpace: {
+            CapturedAddressSpace address_space;
+            is_valid = ReadFixed(payload, address_space);
+            frame.events.emplace_back(address_space);
+            break;
+        }
+        case RecordType::Map: {
+            MapRecord map{};
+            is_valid = ReadFixed(payload, map);
+            frame.events.emplace_back(CapturedMap{
+                .as_id = map.as_id,
+                .gpu_addr = map.gpu_addr,
+                .dev_addr = map.dev_addr,
+                .size = map.size,
+                .kind = static_cast<Tegra::PTEKind>(map.kind),
+                .is_big_pages = map.is_big_pages != 0,
+                .is_sparse = map.is_sparse != 0,
+            });
+            break;
+        }
+        case RecordType::Unmap: {
+            CapturedUnmap unmap;
+            is_valid = ReadFixed(payload, unmap);
+            frame.events.emplace_back(unmap);
+            break;
+        }
+        case RecordType::Channel: {
+            ChannelRecord channel{};
+            is_valid = ReadFixed(payload, channel);
+            frame.events.emplace_back(CapturedChannel{
+                .channel = channel.channel,
+                .as_id = channel.as_id,
+                .program_id = channel.program_id,
+            });
+            break;
+        }
+        case RecordType::Memory: {
+            MemoryRecord memory{};
+            is_valid = ReadFixed(payload, memory);
+            if (is_valid) {
+                frame.events.emplace_back(CapturedMemory{
+                    .address = memory.address,
+                    .data{payload.begin() + sizeof(memory), payload.end()},
+                });
+            }
+            break;
+        }
+        case RecordType::CommandList: {
+            CommandListRecord list_record{};
+            is_valid = ReadFixed(payload, list_record) &&
+                       payload.size() == sizeof(list_record) +
+                                             list_record.num_headers * sizeof(u64) +
+                                             u64{list_record.num_prefetch} * sizeof(u32);
+            if (!is_valid) {
+                break;
+            }
+            CapturedCommandList list{.channel = list_record.channel};
+            list.headers.resize(list_record.num_headers);
+            list.prefetch.resize(list_record.num_prefetch);
+            const u8* const data = payload.data() + sizeof(list_record);
+            const size_t headers_size = list.headers.size() * sizeof(u64);
+            std::memcpy(list.headers.data(), data, headers_size);
+            std::memcpy(list.prefetch.data(), data + headers_size,
+                        list.prefetch.size() * sizeof(u32));
+            frame.events.emplace_back(std::move(list));
+            break;
+        }
+        case RecordType::FrameEnd:
+            capture.frames.push_back(std::move(frame));
+            frame = {};
+            break;
+        default:
+            LOG_ERROR(HW_GPU, "Unknown GPU capture record type {}", static_cast<u32>(record.type));
+            return capture;
+        }
+        if (!is_valid) {
+            LOG_ERROR(HW_GPU, "Malformed GPU capture record of type {}",
+                      static_cast<u32>(record.type));
+            return capture;
+        }
+    }
+    if (!frame.events.empty()) {
+        capture.frames.push_back(std::move(frame));
+    }
+    return capture;
+}
+
+std::optional<GpuReplayStats> ReplayGpuCapture(Core::System& system, const GpuCapture& capture,
+                                               size_t iterations) {
+    using Clock = std::chrono::steady_clock;
+
+    ReplayDeviceMemory replay_memory{system};
+    if (!replay_memory.Map(capture)) {
+        return std::nullopt;
+    }
+
+    GpuReplayStats stats{};
+    std::vector<std::chrono::nanoseconds> frame_times;
+    frame_times.reserve(capture.frames.size() * iterations);
+    {
+        ReplayState state{system, replay_memory, stats};
+        for (size_t iteration = 0; iteration < iterations; ++iteration) {
+            for (const CapturedFrame& frame : capture.frames) {
+                const auto start = Clock::now();
+                for (const CapturedEvent& event : frame.events) {
+                    std::visit(state, event);
+                }
+                state.EndFrame();
+                frame_times.push_back(Clock::now() - start);
+            }
+        }
+    }
+    if (frame_times.empty()) {
+        return stats;
+    }
+
+    stats.frames = frame_times.size();
+    for (const auto frame_time : frame_times) {
+        stats.total += frame_time;
+    }
+    stats.average_frame = stats.total / static_cast<s64>(stats.frames);
+    std::ranges::sort(frame_times);
+    stats.min_frame = frame_times.front();
+    stats.max_frame = frame_times.back();
+    stats.p99_frame = frame_times[(frame_times.size() - 1) * 99 / 100];
+
+    LOG_INFO(HW_GPU,
+             "Replayed {} frames ({} command lists, {} KiB of memory) in {} ms: "
+             "avg={:.3f} ms min={:.3f} ms max={:.3f} ms p99={:.3f} ms",
+             stats.frames, stats.command_lists, stats.memory_bytes / 1024,
+             std::chrono::duration_cast<std::chrono::milliseconds>(stats.total).count(),
+             stats.average_frame.count() / 1e6, stats.min_frame.count() / 1e6,
+             stats.max_frame.count() / 1e6, stats.p99_frame.count() / 1e6);
+    return stats;
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/fs/file.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/pte_kind.h"
+
+namespace Core {
+class System;
+}
+
+namespace Tegra {
+struct CommandList;
+class MemoryManager;
+} // namespace Tegra
+
+namespace VideoCommon {
+
+/// A GPU address space, identified by the ID of its memory manager
+struct CapturedAddressSpace {
+    u64 id{};
+    u64 address_space_bits{};
+    u64 split_address{};
+    u64 big_page_bits{};
+    u64 page_bits{};
+};
+
+struct CapturedMap {
+    u64 as_id{};
+    GPUVAddr gpu_addr{};
+    DAddr dev_addr{}; ///< Ignored by sparse mappings
+    u64 size{};
+    Tegra::PTEKind kind{};
+    bool is_big_pages{};
+    bool is_sparse{};
+};
+
+struct CapturedUnmap {
+    u64 as_id{};
+    GPUVAddr gpu_addr{};
+    u64 size{};
+};
+
+struct CapturedChannel {
+    s32 channel{};
+    u64 as_id{};
+    u64 program_id{};
+};
+
+/// Guest memory read by the GPU, as it was when it was read
+struct CapturedMemory {
+    DAddr address{};
+    std::vector<u8> data;
+};
+
+/// A submission, as handed to the GPU. Its pushbuffers are read from the captured memory.
+struct CapturedCommandList {
+    s32 channel{};
+    std::vector<u64> headers;  ///< Raw CommandListHeader entries
+    std::vector<u32> prefetch; ///< Prefetched command words
+};
+
+using CapturedEvent = std::variant<CapturedAddressSpace, CapturedMap, CapturedUnmap,
+                                   CapturedChannel, CapturedMemory, CapturedCommandList>;
+
+/// Everything that happened between two frame presentations, in order
+struct CapturedFrame {
+    std::vector<CapturedEvent> events;
+};
+
+struct GpuCapture {
+    u64 program_id{};
+    std::vector<CapturedFrame> frames;
+};
+
+struct GpuReplayStats {
+    size_t frames{};
+    size_t command_lists{};
+    u64 memory_bytes{}; ///< Guest memory written back before the command lists that read it
+    std::chrono::nanoseconds total{};
+    std::chrono::nanoseconds min_frame{};
+    std::chrono::nanoseconds max_frame{};
+    std::chrono::nanoseconds average_frame{};
+    std::chrono::nanoseconds p99_frame{};
+};
+
+/**
+ * Records the submissions made to the GPU, the address spaces and channels they run on, and the
+ * guest memory the GPU reads while executing them into a capture file.
+ * Memory is recorded in device address space at the points the GPU reads it, which are the
+ * memory managers and the buffer cache uploads. A range is only recorded again when its contents
+ * changed since the last time it was read, and always before the submission that read it.
+ */
+class GpuCaptureWriter {
+public:
+    explicit GpuCaptureWriter(const std::filesystem::path& path, u64 program_id,
+                              Tegra::MaxwellDeviceMemoryManager& device_memory);
+    ~GpuCaptureWriter();
+
+    GpuCaptureWriter(const GpuCaptureWriter&) = delete;
+    GpuCaptureWriter& operator=(const GpuCaptureWriter&) = delete;
+
+    /// Creates a writer for the given title in the dump directory, if it could be opened
+    static std::unique_ptr<GpuCaptureWriter> Create(
+        u64 program_id, Tegra::MaxwellDeviceMemoryManager& device_memory);
+
+    [[nodiscard]] bool IsOpen() const {
+        return file.IsOpen();
+    }
+
+    void RecordAddressSpace(const Tegra::MemoryManager& memory_manager);
+
+    void RecordMap(const Tegra::MemoryManager& memory_manager, GPUVAddr gpu_addr, DAddr dev_addr,
+                   u64 size, Tegra::PTEKind kind, bool is_big_pages, bool is_sparse);
+
+    void RecordUnmap(const Tegra::MemoryManager& memory_manager, GPUVAddr gpu_addr, u64 size);
+
+    void RecordChannel(s32 channel, const Tegra::MemoryManager& memory_manager, u64 program_id);
+
+    /// Records a submission when the GPU thread starts executing it
+    void RecordCommandList(s32 channel, const Tegra::CommandList& entries);
+
+    /// Records a range of device memory the GPU is reading, if it changed since the last read
+    void RecordRead(DAddr address, u64 size);
+
+    /// Marks the end of the current frame
+    void RecordFrameEnd();
+
+private:
+    void WriteRecord(u32 type, std::span<const u8> payload, std::span<const u8> data = {});
+
+    /// Writes the submission being executed, after the memory it read
+    void FlushCommandList();
+
+    std::mutex mutex;
+    Common::FS::IOFile file;
+    Tegra::MaxwellDeviceMemoryManager& device_memory;
+    /// Contents hash of every range recorded so far
+    std::map<std::pair<DAddr, u64>, u64> recorded_hashes;
+    std::vector<u8> pending_list;
+    bool has_pending_list{};
+    std::vector<u8> scratch;
+};
+
+/// Loads a capture file written by GpuCaptureWriter
+[[nodiscard]] std::optional<GpuCapture> LoadGpuCapture(const std::filesystem::path& path);
+
+/**
+ * Recreates the captured address spaces and channels on a GPU that runs no program, and feeds
+ * the captured submissions through them with the memory they read, measuring how long every
+ * frame takes. The GPU must have been started, and nothing else may be using it.
+ * Address spaces and channels are only created by the first iteration, later ones keep the
+ * state the previous one left.
+ */
+[[nodiscard]] std::optional<GpuReplayStats> ReplayGpuCapture(Core::System& system,
+                                                             const GpuCapture& capture,
+                                                             size_t iterations = 1);
+
+} // namespace VideoCommon
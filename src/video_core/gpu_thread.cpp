@@ -1,6 +1,13 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#ifdef ANDROID
+#include "common/android/performance_governor.h"
+#endif
 #include "common/assert.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
@@ -8,6 +15,7 @@
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/frontend/graphics_context.h"
+#include "core/perf_stats.h"
 #include "video_core/control/scheduler.h"
 #include "video_core/dma_pusher.h"
 #include "video_core/gpu.h"
@@ -16,13 +24,51 @@
 
 namespace VideoCommon::GPUThread {
 
+namespace {
+
+/// Maximum number of region commands held back before they are published
+constexpr size_t MaxPendingCommands = 64;
+
+bool IsRegionCommand(const CommandData& command_data) {
+    return std::holds_alternative<FlushRegionCommand>(command_data) ||
+           std::holds_alternative<InvalidateRegionCommand>(command_data) ||
+           std::holds_alternative<FlushAndInvalidateRegionCommand>(command_data);
+}
+
+/// Merges two region commands of the same kind when their ranges overlap or touch
+template <typename RegionCommand>
+bool MergeRegion(CommandData& pending, const CommandData& incoming) {
+    auto* const lhs = std::get_if<RegionCommand>(&pending);
+    const auto* const rhs = std::get_if<RegionCommand>(&incoming);
+    if (lhs == nullptr || rhs == nullptr) {
+        return false;
+    }
+    const DAddr lhs_end = lhs->addr + lhs->size;
+    const DAddr rhs_end = rhs->addr + rhs->size;
+    if (rhs->addr > lhs_end || lhs->addr > rhs_end) {
+        return false;
+    }
+    const DAddr begin = std::min(lhs->addr, rhs->addr);
+    lhs->size = std::max(lhs_end, rhs_end) - begin;
+    lhs->addr = begin;
+    return true;
+}
+
+} // Anonymous namespace
+
 /// Runs the GPU thread
 static void RunThread(std::stop_token stop_token, Core::System& system,
                       VideoCore::RendererBase& renderer, Core::Frontend::GraphicsContext& context,
                       Tegra::Control::Scheduler& scheduler, SynchState& state) {
     std::string name = "GPU";
     MicroProfileOnThreadCreate(name.c_str());
+#ifdef ANDROID
+    Common::Android::GetPerformanceGovernor().RegisterThread();
+#endif
     SCOPE_EXIT {
+#ifdef ANDROID
+        Common::Android::GetPerformanceGovernor().UnregisterThread();
+#endif
         MicroProfileOnThreadExit();
     };
 
@@ -40,6 +86,7 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
         if (stop_token.stop_requested()) {
             break;
         }
+        const auto busy_start = std::chrono::steady_clock::now();
         if (auto* submit_list = std::get_if<SubmitListCommand>(&next.data)) {
             scheduler.Push(submit_list->channel, std::move(submit_list->entries));
         } else if (std::holds_alternative<GPUTickCommand>(next.data)) {
@@ -51,6 +98,7 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
         } else {
             ASSERT(false);
         }
+        system.GetPerfStats().AddGpuBusyTime(std::chrono::steady_clock::now() - busy_start);
         state.signaled_fence.store(next.fence);
         if (next.block) {
             // We have to lock the write_lock to ensure that the condition_variable wait not get a
@@ -98,12 +146,41 @@ void ThreadManager::TickGPU() {
 }
 
 void ThreadManager::InvalidateRegion(DAddr addr, u64 size) {
-    rasterizer->OnCacheInvalidation(addr, size);
+    if (!is_async || IsGpuThread()) {
+        rasterizer->OnCacheInvalidation(addr, size);
+        return;
+    }
+    // Queued behind the submitted work so neighbouring invalidations can be merged
+    PushCommand(InvalidateRegionCommand(addr, size));
 }
 
 void ThreadManager::FlushAndInvalidateRegion(DAddr addr, u64 size) {
     // Skip flush on asynch mode, as FlushAndInvalidateRegion is not used for anything too important
-    rasterizer->OnCacheInvalidation(addr, size);
+    InvalidateRegion(addr, size);
+}
+
+void ThreadManager::SyncRegionCommands() {
+    if (!is_async || IsGpuThread()) {
+        return;
+    }
+    {
+        std::scoped_lock lk{state.write_lock};
+        PublishPending();
+        if (state.last_region_fence <= state.signaled_fence.load(std::memory_order_relaxed)) {
+            return;
+        }
+        ++state.stats.region_syncs;
+    }
+    PushCommand(GPUTickCommand(), true);
+}
+
+QueueStats ThreadManager::GetAndResetQueueStats() {
+    std::scoped_lock lk{state.write_lock};
+    return std::exchange(state.stats, {});
+}
+
+bool ThreadManager::IsGpuThread() const {
+    return thread.get_id() == std::this_thread::get_id();
 }
 
 u64 ThreadManager::PushCommand(CommandData&& command_data, bool block) {
@@ -114,15 +191,66 @@ u64 ThreadManager::PushCommand(CommandData&& command_data, bool block) {
 
     std::unique_lock lk(state.write_lock);
     const u64 fence{++state.last_fence};
-    state.queue.EmplaceWait(std::move(command_data), fence, block);
+
+    const bool is_region = !block && IsRegionCommand(command_data);
+    if (is_region) {
+        state.last_region_fence = fence;
+        if (TryCoalesce(command_data, fence)) {
+            return fence;
+        }
+    }
+    state.pending.emplace_back(std::move(command_data), fence, block);
+
+    // Region commands are held back so neighbouring ranges can be merged, anything else is
+    // published right away together with whatever is pending.
+    if (!is_region || state.pending.size() >= MaxPendingCommands) {
+        PublishPending();
+    }
 
     if (block) {
+        const auto wait_start = std::chrono::steady_clock::now();
         Common::CondvarWait(state.cv, lk, thread.get_stop_token(), [this, fence] {
             return fence <= state.signaled_fence.load(std::memory_order_relaxed);
         });
+        system.GetPerfStats().AddCpuWaitTime(std::chrono::steady_clock::now() - wait_start);
     }
 
     return fence;
 }
 
+bool ThreadManager::TryCoalesce(const CommandData& command_data, u64 fence) {
+    if (state.pending.empty()) {
+        return false;
+    }
+    CommandDataContainer& last = state.pending.back();
+    if (last.block) {
+        return false;
+    }
+    const bool merged = MergeRegion<FlushRegionCommand>(last.data, command_data) ||
+                        MergeRegion<InvalidateRegionCommand>(last.data, command_data) ||
+                        MergeRegion<FlushAndInvalidateRegionCommand>(last.data, command_data);
+    if (!merged) {
+        return false;
+    }
+    // Fences are signaled in order, so the merged command can signal the newest one.
+    last.fence = fence;
+    ++state.stats.coalesced_commands;
+    return true;
+}
+
+void ThreadManager::PublishPending() {
+    const u64 batch_size = state.pending.size();
+    if (batch_size == 0) {
+        return;
+    }
+    state.queue.EmplaceRangeWait(state.pending.begin(), state.pending.end());
+    state.pending.clear();
+
+    QueueStats& stats = state.stats;
+    ++stats.published_batches;
+    stats.published_commands += batch_size;
+    stats.max_batch_size = std::max(stats.max_batch_size, batch_size);
+    stats.max_depth = std::max<u64>(stats.max_depth, state.queue.Size());
+}
+
 } // namespace VideoCommon::GPUThread
@@ -9,10 +9,12 @@
 #include <optional>
 #include <thread>
 #include <variant>
+#include <vector>
 
 #include "common/bounded_threadsafe_queue.h"
 #include "common/polyfill_thread.h"
 #include "video_core/framebuffer_config.h"
+#include "video_core/gpu_thread_queue_stats.h"
 
 namespace Tegra {
 struct FramebufferConfig;
@@ -89,12 +91,16 @@ struct CommandDataContainer {
 
 /// Struct used to synchronize the GPU thread
 struct SynchState final {
-    using CommandQueue = Common::MPSCQueue<CommandDataContainer>;
+    /// Producers are serialized by write_lock, so a single-producer ring is enough
+    using CommandQueue = Common::SPSCQueue<CommandDataContainer>;
     std::mutex write_lock;
     CommandQueue queue;
+    std::vector<CommandDataContainer> pending; ///< Region commands held back to be merged
     u64 last_fence{};
+    u64 last_region_fence{}; ///< Fence of the newest region command pushed
     std::atomic<u64> signaled_fence{};
     std::condition_variable_any cv;
+    QueueStats stats; ///< Protected by write_lock
 };
 
 /// Class used to manage the GPU thread
@@ -121,10 +127,28 @@ public:
 
     void TickGPU();
 
+    /**
+     * Waits until every region command pushed so far has run on the GPU thread. Sync operations
+     * run between the commands of a list, so they would otherwise overtake queued invalidations.
+     */
+    void SyncRegionCommands();
+
+    /// Returns the queue counters since the last call, thread safe
+    [[nodiscard]] QueueStats GetAndResetQueueStats();
+
 private:
     /// Pushes a command to be executed by the GPU thread
     u64 PushCommand(CommandData&& command_data, bool block = false);
 
+    /// Tries to merge a region command into the last pending command, returns true on success
+    bool TryCoalesce(const CommandData& command_data, u64 fence);
+
+    /// Publishes all pending commands to the GPU thread with a single wakeup
+    void PublishPending();
+
+    /// Returns true when called from the GPU thread, which must not wait on its own queue
+    [[nodiscard]] bool IsGpuThread() const;
+
     Core::System& system;
     const bool is_async;
     VideoCore::RasterizerInterface* rasterizer = nullptr;
@@ -0,0 +1,20 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace VideoCommon::GPUThread {
+
+/// Commands handed to the GPU thread through its queue, summed since the last reset
+struct QueueStats {
+    u64 published_batches{};  ///< Batches published to the GPU thread, one wakeup each
+    u64 published_commands{}; ///< Commands in those batches
+    u64 coalesced_commands{}; ///< Region commands merged into an already pending command
+    u64 max_batch_size{};     ///< Largest batch
+    u64 max_depth{};          ///< Most commands waiting in the queue after a batch was published
+    u64 region_syncs{};       ///< Sync operations that waited for queued region commands first
+};
+
+} // namespace VideoCommon::GPUThread
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "common/microprofile.h"
+#include "video_core/gpu_timeline.h"
+
+MICROPROFILE_DEFINE(GPU_PassRenderTarget, "GPU passes", "Render target", MP_RGB(255, 128, 64));
+MICROPROFILE_DEFINE(GPU_PassCompute, "GPU passes", "Compute", MP_RGB(64, 160, 255));
+MICROPROFILE_DEFINE(GPU_PassTextureUpload, "GPU passes", "Texture upload", MP_RGB(192, 64, 255));
+MICROPROFILE_DEFINE(GPU_PassPresent, "GPU passes", "Present", MP_RGB(64, 255, 64));
+
+namespace VideoCore {
+
+#if MICROPROFILE_ENABLED
+namespace {
+MicroProfileToken PassToken(GpuPass pass) {
+    switch (pass) {
+    case GpuPass::RenderTarget:
+        return MICROPROFILE_TOKEN(GPU_PassRenderTarget);
+    case GpuPass::Compute:
+        return MICROPROFILE_TOKEN(GPU_PassCompute);
+    case GpuPass::TextureUpload:
+        return MICROPROFILE_TOKEN(GPU_PassTextureUpload);
+    case GpuPass::Present:
+    case GpuPass::Idle:
+        break;
+    }
+    // Idle marks never start a span
+    return MICROPROFILE_TOKEN(GPU_PassPresent);
+}
+} // Anonymous namespace
+#endif
+
+std::vector<GpuPassSpan> GpuTimeline::BuildSpans(std::span<const GpuPassMark> marks) {
+    std::vector<GpuPassSpan> spans;
+    for (size_t index = 0; index + 1 < marks.size(); ++index) {
+        const GpuPassMark& mark = marks[index];
+        const u64 end_ns = marks[index + 1].timestamp_ns;
+        // Consecutive marks may land on the same timestamp when no work was recorded in between
+        if (mark.pass == GpuPass::Idle || end_ns <= mark.timestamp_ns) {
+            continue;
+        }
+        spans.push_back({
+            .pass = mark.pass,
+            .begin_ns = mark.timestamp_ns,
+            .end_ns = end_ns,
+        });
+    }
+    return spans;
+}
+
+void GpuTimeline::AddFrame(std::span<const GpuPassMark> marks,
+                           std::chrono::steady_clock::time_point cpu_time) {
+#if MICROPROFILE_ENABLED
+    if (marks.empty()) {
+        return;
+    }
+    static MicroProfileThreadLog* const timeline = MicroProfileCreateTimeline("GPU passes");
+
+    const f64 ticks_per_ns = static_cast<f64>(MicroProfileTicksPerSecondCpu()) / 1e9;
+    const f64 age_ns = std::chrono::duration<f64, std::nano>(
+                           std::chrono::steady_clock::now() - cpu_time)
+                           .count();
+    const s64 base_tick = MP_TICK() - static_cast<s64>(age_ns * ticks_per_ns);
+    const u64 base_ns = marks.front().timestamp_ns;
+    const auto to_tick = [&](u64 timestamp_ns) {
+        const f64 offset_ns = static_cast<f64>(timestamp_ns - base_ns);
+        return base_tick + static_cast<s64>(offset_ns * ticks_per_ns);
+    };
+    for (const GpuPassSpan& span : BuildSpans(marks)) {
+        // Frames placed from CPU times may overlap slightly, the scopes of a log must not
+        const s64 begin = std::max(to_tick(span.begin_ns), last_tick);
+        const s64 end = std::max(to_tick(span.end_ns), begin);
+        MicroProfileTimelineScope(timeline, PassToken(span.pass), begin, end);
+        last_tick = end;
+    }
+#else
+    static_cast<void>(marks);
+    static_cast<void>(cpu_time);
+#endif
+}
+
+} // namespace VideoCore
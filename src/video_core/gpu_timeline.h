@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace VideoCore {
+
+/// Kind of guest work timed on the GPU
+enum class GpuPass : u32 {
+    RenderTarget,  ///< Draws and clears to one set of render targets
+    Compute,       ///< Compute dispatches
+    TextureUpload, ///< Texture cache uploads
+    Present,       ///< Presentation passes
+    Idle,          ///< No timed work, ends the previous pass
+};
+
+/// GPU time at which the GPU started a pass
+struct GpuPassMark {
+    GpuPass pass;
+    u64 timestamp_ns;
+};
+
+/// GPU time range spent on a pass
+struct GpuPassSpan {
+    GpuPass pass;
+    u64 begin_ns;
+    u64 end_ns;
+};
+
+/**
+ * Shows the passes of the frames timed with GPU timestamps on a MicroProfile timeline of their
+ * own, next to the CPU threads, so they are also exported by the MicroProfile trace.
+ *
+ * GPU timestamps don't share a clock with the CPU. Each frame is placed at the CPU time its first
+ * mark was recorded at, the passes of a frame are exact relative to each other but only roughly
+ * aligned with the CPU scopes.
+ */
+class GpuTimeline {
+public:
+    /// Turns the marks of a frame, in GPU order, into the spans of its passes
+    [[nodiscard]] static std::vector<GpuPassSpan> BuildSpans(std::span<const GpuPassMark> marks);
+
+    /// Adds the passes of a frame the GPU finished to the timeline
+    void AddFrame(std::span<const GpuPassMark> marks,
+                  std::chrono::steady_clock::time_point cpu_time);
+
+private:
+    s64 last_tick{};
+};
+
+} // namespace VideoCore
@@ -1,7 +1,10 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+
 #include "common/assert.h"
+#include "common/microprofile.h"
 #include "common/settings.h"
 #include "video_core/host1x/codecs/codec.h"
 #include "video_core/host1x/codecs/h264.h"
@@ -10,12 +13,28 @@
 #include "video_core/host1x/host1x.h"
 #include "video_core/memory_manager.h"
 
+MICROPROFILE_DEFINE(Host1x_NvdecCompose, "Host1x", "NVDEC compose bitstream",
+                    MP_RGB(160, 96, 192));
+MICROPROFILE_DEFINE(Host1x_NvdecDecode, "Host1x", "NVDEC decode", MP_RGB(192, 96, 160));
+
 namespace Tegra {
 
+namespace {
+u64 NanosecondsSince(std::chrono::steady_clock::time_point start) {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - start)
+                                .count());
+}
+} // Anonymous namespace
+
 Codec::Codec(Host1x::Host1x& host1x_, const Host1x::NvdecCommon::NvdecRegisters& regs)
     : host1x(host1x_), state{regs}, h264_decoder(std::make_unique<Decoder::H264>(host1x)),
       vp8_decoder(std::make_unique<Decoder::VP8>(host1x)),
-      vp9_decoder(std::make_unique<Decoder::VP9>(host1x)) {}
+      vp9_decoder(std::make_unique<Decoder::VP9>(host1x)) {
+    if (Settings::values.use_asynchronous_nvdec.GetValue()) {
+        decode_thread = std::make_unique<Common::ThreadWorker>(1, "NvdecDecode");
+    }
+}
 
 Codec::~Codec() = default;
 
@@ -41,6 +60,8 @@ void Codec::Decode() {
     }
 
     // Assemble bitstream.
+    MICROPROFILE_SCOPE(Host1x_NvdecCompose);
+    const auto compose_start = std::chrono::steady_clock::now();
     bool vp9_hidden_frame = false;
     size_t configuration_size = 0;
     const auto packet_data = [&]() {
@@ -58,27 +79,66 @@ void Codec::Decode() {
             return std::span<const u8>{};
         }
     }();
-
-    // Send assembled bitstream to decoder.
-    if (!decode_api.SendPacket(packet_data, configuration_size)) {
+    host1x.VideoStats().Report({
+        .frames_submitted = 1,
+        .parse_ns = NanosecondsSince(compose_start),
+    });
+
+    ++packets_submitted;
+    if (!decode_thread) {
+        DecodePacket(packet_data, configuration_size, vp9_hidden_frame);
         return;
     }
+    // The decoders reuse their bitstream buffers, the decode thread gets a copy
+    decode_thread->QueueWork(
+        [this, packet = std::vector<u8>(packet_data.begin(), packet_data.end()),
+         configuration_size, vp9_hidden_frame] {
+            DecodePacket(packet, configuration_size, vp9_hidden_frame);
+        });
+}
 
-    // Only receive/store visible frames.
-    if (vp9_hidden_frame) {
-        return;
-    }
+void Codec::DecodePacket(std::span<const u8> packet_data, size_t configuration_size,
+                         bool hidden_frame) {
+    MICROPROFILE_SCOPE(Host1x_NvdecDecode);
+    const auto decode_start = std::chrono::steady_clock::now();
+    std::queue<std::unique_ptr<FFmpeg::Frame>> decoded_frames;
 
-    // Receive output frames from decoder.
-    decode_api.ReceiveFrames(frames);
+    // Send assembled bitstream to decoder, then only receive visible frames.
+    if (decode_api.SendPacket(packet_data, configuration_size) && !hidden_frame) {
+        decode_api.ReceiveFrames(decoded_frames);
+    }
 
-    while (frames.size() > 10) {
-        LOG_DEBUG(HW_GPU, "ReceiveFrames overflow, dropped frame");
-        frames.pop();
+    Host1x::VideoPipelineStats stats{
+        .frames_decoded = decoded_frames.size(),
+        .hardware_frames = decode_api.IsHardwareDecoding() ? decoded_frames.size() : 0,
+        .decode_ns = NanosecondsSince(decode_start),
+    };
+    {
+        std::scoped_lock lock{frame_mutex};
+        while (!decoded_frames.empty()) {
+            frames.push(std::move(decoded_frames.front()));
+            decoded_frames.pop();
+        }
+        stats.max_frame_queue = frames.size();
+        while (frames.size() > 10) {
+            LOG_DEBUG(HW_GPU, "ReceiveFrames overflow, dropped frame");
+            frames.pop();
+            ++stats.dropped_frames;
+        }
+        ++packets_decoded;
     }
+    frame_cv.notify_all();
+    host1x.VideoStats().Report(stats);
+}
+
+u64 Codec::GetSubmittedPackets() const {
+    return packets_submitted;
 }
 
-std::unique_ptr<FFmpeg::Frame> Codec::GetCurrentFrame() {
+std::unique_ptr<FFmpeg::Frame> Codec::GetCurrentFrame(u64 submitted_packets) {
+    std::unique_lock lock{frame_mutex};
+    frame_cv.wait(lock, [&] { return packets_decoded >= submitted_packets; });
+
     // Sometimes VIC will request more frames than have been decoded.
     // in this case, return a blank frame and don't overwrite previous data.
     if (frames.empty()) {
@@ -90,6 +150,14 @@ std::unique_ptr<FFmpeg::Frame> Codec::GetCurrentFrame() {
     return frame;
 }
 
+void Codec::SignalWhenDecoded(std::function<void()> callback) {
+    if (!decode_thread) {
+        callback();
+        return;
+    }
+    decode_thread->QueueWork(std::move(callback));
+}
+
 Host1x::NvdecCommon::VideoCodec Codec::GetCurrentCodec() const {
     return current_codec;
 }
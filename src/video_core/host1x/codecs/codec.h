@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <string_view>
 #include <queue>
 #include "common/common_types.h"
+#include "common/thread_worker.h"
 #include "video_core/host1x/ffmpeg/ffmpeg.h"
 #include "video_core/host1x/nvdec_common.h"
 
@@ -34,11 +39,18 @@ public:
     /// Sets NVDEC video stream codec
     void SetTargetCodec(Host1x::NvdecCommon::VideoCodec codec);
 
-    /// Call decoders to construct headers, decode AVFrame with ffmpeg
+    /// Call decoders to construct headers, then decode the bitstream with ffmpeg, on the decode
+    /// thread when asynchronous decoding is enabled
     void Decode();
 
-    /// Returns next decoded frame
-    [[nodiscard]] std::unique_ptr<FFmpeg::Frame> GetCurrentFrame();
+    /// Returns the number of bitstreams submitted by Decode so far
+    [[nodiscard]] u64 GetSubmittedPackets() const;
+
+    /// Returns next decoded frame, once the first `submitted_packets` bitstreams are decoded
+    [[nodiscard]] std::unique_ptr<FFmpeg::Frame> GetCurrentFrame(u64 submitted_packets);
+
+    /// Runs the callback once every bitstream submitted so far has been decoded
+    void SignalWhenDecoded(std::function<void()> callback);
 
     /// Returns the value of current_codec
     [[nodiscard]] Host1x::NvdecCommon::VideoCodec GetCurrentCodec() const;
@@ -47,6 +59,10 @@ public:
     [[nodiscard]] std::string_view GetCurrentCodecName() const;
 
 private:
+    /// Sends a bitstream to ffmpeg and queues the frames it outputs
+    void DecodePacket(std::span<const u8> packet_data, size_t configuration_size,
+                      bool hidden_frame);
+
     bool initialized{};
     Host1x::NvdecCommon::VideoCodec current_codec{Host1x::NvdecCommon::VideoCodec::None};
     FFmpeg::DecodeApi decode_api;
@@ -58,6 +74,13 @@ private:
     std::unique_ptr<Decoder::VP9> vp9_decoder;
 
     std::queue<std::unique_ptr<FFmpeg::Frame>> frames{};
+    std::mutex frame_mutex;
+    std::condition_variable frame_cv;
+    u64 packets_submitted{};
+    u64 packets_decoded{};
+
+    /// Runs ffmpeg off the command thread, declared last so it stops before the state it uses
+    std::unique_ptr<Common::ThreadWorker> decode_thread;
 };
 
 } // namespace Tegra
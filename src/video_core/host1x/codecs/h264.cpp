@@ -6,6 +6,7 @@
 
 #include "common/scratch_buffer.h"
 #include "common/settings.h"
+#include "video_core/guest_memory.h"
 #include "video_core/host1x/codecs/h264.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/memory_manager.h"
@@ -36,12 +37,67 @@ std::span<const u8> H264::ComposeFrame(const Host1x::NvdecCommon::NvdecRegisters
 
     const s64 frame_number = context.h264_parameter_set.frame_number.Value();
     if (!is_first_frame && frame_number != 0) {
-        frame.resize_destructive(context.stream_len);
-        host1x.GMMU().ReadBlock(state.frame_bitstream_offset, frame.data(), frame.size());
+        // Nothing is prepended, hand the bitstream over straight from guest memory when it's
+        // contiguous
+        const Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::SafeRead>
+            bitstream(host1x.GMMU(), state.frame_bitstream_offset, context.stream_len, &frame);
         *out_configuration_size = 0;
-        return frame;
+        return std::span<const u8>(bitstream.data(), bitstream.size());
     }
 
+    // TODO (ameerj): Where do we get this number, it seems to be particular for each stream
+    const auto nvdec_decoding = Settings::values.nvdec_emulation.GetValue();
+    const bool uses_gpu_decoding = nvdec_decoding == Settings::NvdecEmulation::Gpu;
+
+    const auto& parameter_set = context.h264_parameter_set;
+    const HeaderParameters parameters{
+        .chroma_format_idc = static_cast<u32>(parameter_set.chroma_format_idc.Value()),
+        .log2_max_frame_num_minus4 =
+            static_cast<u32>(parameter_set.log2_max_frame_num_minus4.Value()),
+        .pic_order_cnt_type = static_cast<u32>(parameter_set.pic_order_cnt_type.Value()),
+        .log2_max_pic_order_cnt_lsb_minus4 = parameter_set.log2_max_pic_order_cnt_lsb_minus4,
+        .delta_pic_order_always_zero = parameter_set.delta_pic_order_always_zero_flag != 0,
+        .max_num_ref_frames = uses_gpu_decoding ? 6u : 16u,
+        .pic_width_in_mbs = parameter_set.pic_width_in_mbs,
+        .frame_height_in_map_units = parameter_set.frame_height_in_map_units,
+        .frame_mbs_only = parameter_set.frame_mbs_only_flag != 0,
+        .mbaff_frame = parameter_set.flags.mbaff_frame.Value() != 0,
+        .direct_8x8_inference = parameter_set.flags.direct_8x8_inference.Value() != 0,
+        .entropy_coding_mode = parameter_set.entropy_coding_mode_flag != 0,
+        .pic_order_present = parameter_set.pic_order_present_flag != 0,
+        .num_refidx_l0_default_active = parameter_set.num_refidx_l0_default_active,
+        .num_refidx_l1_default_active = parameter_set.num_refidx_l1_default_active,
+        .weighted_pred = parameter_set.flags.weighted_pred.Value() != 0,
+        .weighted_bipred_idc = static_cast<s32>(parameter_set.weighted_bipred_idc.Value()),
+        .pic_init_qp_minus26 = static_cast<s32>(parameter_set.pic_init_qp_minus26.Value()),
+        .chroma_qp_index_offset = static_cast<s32>(parameter_set.chroma_qp_index_offset.Value()),
+        .second_chroma_qp_index_offset =
+            static_cast<s32>(parameter_set.second_chroma_qp_index_offset.Value()),
+        .deblocking_filter_control_present =
+            parameter_set.deblocking_filter_control_present_flag != 0,
+        .constrained_intra_pred = parameter_set.flags.constrained_intra_pred.Value() != 0,
+        .redundant_pic_cnt_present = parameter_set.redundant_pic_cnt_present_flag != 0,
+        .transform_8x8_mode = parameter_set.transform_8x8_mode_flag != 0,
+        .weight_scale = context.weight_scale,
+        .weight_scale_8x8 = context.weight_scale_8x8,
+    };
+    // Streams keep their parameters from one IDR frame to the next, the header rarely changes
+    if (header_parameters != parameters) {
+        ComposeHeader(parameters);
+        header_parameters = parameters;
+    }
+
+    frame.resize_destructive(header.size() + context.stream_len);
+    std::memcpy(frame.data(), header.data(), header.size());
+
+    *out_configuration_size = header.size();
+    host1x.GMMU().ReadBlock(state.frame_bitstream_offset, frame.data() + header.size(),
+                            context.stream_len);
+
+    return frame;
+}
+
+void H264::ComposeHeader(const HeaderParameters& parameters) {
     // Encode header
     H264BitWriter writer{};
     writer.WriteU(1, 24);
@@ -52,10 +108,8 @@ std::span<const u8> H264::ComposeFrame(const Host1x::NvdecCommon::NvdecRegisters
     writer.WriteU(0, 8);
     writer.WriteU(31, 8);
     writer.WriteUe(0);
-    const u32 chroma_format_idc =
-        static_cast<u32>(context.h264_parameter_set.chroma_format_idc.Value());
-    writer.WriteUe(chroma_format_idc);
-    if (chroma_format_idc == 3) {
+    writer.WriteUe(parameters.chroma_format_idc);
+    if (parameters.chroma_format_idc == 3) {
         writer.WriteBit(false);
     }
 
@@ -64,39 +118,34 @@ std::span<const u8> H264::ComposeFrame(const Host1x::NvdecCommon::NvdecRegisters
     writer.WriteBit(false); // QpprimeYZeroTransformBypassFlag
     writer.WriteBit(false); // Scaling matrix present flag
 
-    writer.WriteUe(static_cast<u32>(context.h264_parameter_set.log2_max_frame_num_minus4.Value()));
+    writer.WriteUe(parameters.log2_max_frame_num_minus4);
 
-    const auto order_cnt_type =
-        static_cast<u32>(context.h264_parameter_set.pic_order_cnt_type.Value());
+    const u32 order_cnt_type = parameters.pic_order_cnt_type;
     writer.WriteUe(order_cnt_type);
     if (order_cnt_type == 0) {
-        writer.WriteUe(context.h264_parameter_set.log2_max_pic_order_cnt_lsb_minus4);
+        writer.WriteUe(parameters.log2_max_pic_order_cnt_lsb_minus4);
     } else if (order_cnt_type == 1) {
-        writer.WriteBit(context.h264_parameter_set.delta_pic_order_always_zero_flag != 0);
+        writer.WriteBit(parameters.delta_pic_order_always_zero);
 
         writer.WriteSe(0);
         writer.WriteSe(0);
         writer.WriteUe(0);
     }
 
-    const s32 pic_height = context.h264_parameter_set.frame_height_in_map_units /
-                           (context.h264_parameter_set.frame_mbs_only_flag ? 1 : 2);
+    const s32 pic_height =
+        parameters.frame_height_in_map_units / (parameters.frame_mbs_only ? 1 : 2);
 
-    // TODO (ameerj): Where do we get this number, it seems to be particular for each stream
-    const auto nvdec_decoding = Settings::values.nvdec_emulation.GetValue();
-    const bool uses_gpu_decoding = nvdec_decoding == Settings::NvdecEmulation::Gpu;
-    const u32 max_num_ref_frames = uses_gpu_decoding ? 6u : 16u;
-    writer.WriteUe(max_num_ref_frames);
+    writer.WriteUe(parameters.max_num_ref_frames);
     writer.WriteBit(false);
-    writer.WriteUe(context.h264_parameter_set.pic_width_in_mbs - 1);
+    writer.WriteUe(parameters.pic_width_in_mbs - 1);
     writer.WriteUe(pic_height - 1);
-    writer.WriteBit(context.h264_parameter_set.frame_mbs_only_flag != 0);
+    writer.WriteBit(parameters.frame_mbs_only);
 
-    if (!context.h264_parameter_set.frame_mbs_only_flag) {
-        writer.WriteBit(context.h264_parameter_set.flags.mbaff_frame.Value() != 0);
+    if (!parameters.frame_mbs_only) {
+        writer.WriteBit(parameters.mbaff_frame);
     }
 
-    writer.WriteBit(context.h264_parameter_set.flags.direct_8x8_inference.Value() != 0);
+    writer.WriteBit(parameters.direct_8x8_inference);
     writer.WriteBit(false); // Frame cropping flag
     writer.WriteBit(false); // VUI parameter present flag
 
@@ -111,57 +160,45 @@ std::span<const u8> H264::ComposeFrame(const Host1x::NvdecCommon::NvdecRegisters
     writer.WriteUe(0);
     writer.WriteUe(0);
 
-    writer.WriteBit(context.h264_parameter_set.entropy_coding_mode_flag != 0);
-    writer.WriteBit(context.h264_parameter_set.pic_order_present_flag != 0);
+    writer.WriteBit(parameters.entropy_coding_mode);
+    writer.WriteBit(parameters.pic_order_present);
     writer.WriteUe(0);
-    writer.WriteUe(context.h264_parameter_set.num_refidx_l0_default_active);
-    writer.WriteUe(context.h264_parameter_set.num_refidx_l1_default_active);
-    writer.WriteBit(context.h264_parameter_set.flags.weighted_pred.Value() != 0);
-    writer.WriteU(static_cast<s32>(context.h264_parameter_set.weighted_bipred_idc.Value()), 2);
-    s32 pic_init_qp = static_cast<s32>(context.h264_parameter_set.pic_init_qp_minus26.Value());
-    writer.WriteSe(pic_init_qp);
+    writer.WriteUe(parameters.num_refidx_l0_default_active);
+    writer.WriteUe(parameters.num_refidx_l1_default_active);
+    writer.WriteBit(parameters.weighted_pred);
+    writer.WriteU(parameters.weighted_bipred_idc, 2);
+    writer.WriteSe(parameters.pic_init_qp_minus26);
     writer.WriteSe(0);
-    s32 chroma_qp_index_offset =
-        static_cast<s32>(context.h264_parameter_set.chroma_qp_index_offset.Value());
 
-    writer.WriteSe(chroma_qp_index_offset);
-    writer.WriteBit(context.h264_parameter_set.deblocking_filter_control_present_flag != 0);
-    writer.WriteBit(context.h264_parameter_set.flags.constrained_intra_pred.Value() != 0);
-    writer.WriteBit(context.h264_parameter_set.redundant_pic_cnt_present_flag != 0);
-    writer.WriteBit(context.h264_parameter_set.transform_8x8_mode_flag != 0);
+    writer.WriteSe(parameters.chroma_qp_index_offset);
+    writer.WriteBit(parameters.deblocking_filter_control_present);
+    writer.WriteBit(parameters.constrained_intra_pred);
+    writer.WriteBit(parameters.redundant_pic_cnt_present);
+    writer.WriteBit(parameters.transform_8x8_mode);
 
     writer.WriteBit(true); // pic_scaling_matrix_present_flag
 
     for (s32 index = 0; index < 6; index++) {
         writer.WriteBit(true);
-        std::span<const u8> matrix{context.weight_scale};
+        std::span<const u8> matrix{parameters.weight_scale};
         writer.WriteScalingList(scan, matrix, index * 16, 16);
     }
 
-    if (context.h264_parameter_set.transform_8x8_mode_flag) {
+    if (parameters.transform_8x8_mode) {
         for (s32 index = 0; index < 2; index++) {
             writer.WriteBit(true);
-            std::span<const u8> matrix{context.weight_scale_8x8};
+            std::span<const u8> matrix{parameters.weight_scale_8x8};
             writer.WriteScalingList(scan, matrix, index * 64, 64);
         }
     }
 
-    s32 chroma_qp_index_offset2 =
-        static_cast<s32>(context.h264_parameter_set.second_chroma_qp_index_offset.Value());
-
-    writer.WriteSe(chroma_qp_index_offset2);
+    writer.WriteSe(parameters.second_chroma_qp_index_offset);
 
     writer.End();
 
     const auto& encoded_header = writer.GetByteArray();
-    frame.resize(encoded_header.size() + context.stream_len);
-    std::memcpy(frame.data(), encoded_header.data(), encoded_header.size());
-
-    *out_configuration_size = encoded_header.size();
-    host1x.GMMU().ReadBlock(state.frame_bitstream_offset, frame.data() + encoded_header.size(),
-                            context.stream_len);
-
-    return frame;
+    header.resize_destructive(encoded_header.size());
+    std::memcpy(header.data(), encoded_header.data(), encoded_header.size());
 }
 
 H264BitWriter::H264BitWriter() = default;
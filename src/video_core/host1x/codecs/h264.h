@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <optional>
 #include <span>
 #include <vector>
 
@@ -65,14 +67,53 @@ public:
     explicit H264(Host1x::Host1x& host1x);
     ~H264();
 
-    /// Compose the H264 frame for FFmpeg decoding
+    /// Compose the H264 frame for FFmpeg decoding.
+    /// The span can point into guest memory, it is only valid until the guest reuses the buffer.
     [[nodiscard]] std::span<const u8> ComposeFrame(const Host1x::NvdecCommon::NvdecRegisters& state,
                                                    size_t* out_configuration_size,
                                                    bool is_first_frame = false);
 
 private:
+    /// Fields of the parameter set the SPS and PPS are composed from
+    struct HeaderParameters {
+        u32 chroma_format_idc;
+        u32 log2_max_frame_num_minus4;
+        u32 pic_order_cnt_type;
+        s32 log2_max_pic_order_cnt_lsb_minus4;
+        bool delta_pic_order_always_zero;
+        u32 max_num_ref_frames;
+        u32 pic_width_in_mbs;
+        u32 frame_height_in_map_units;
+        bool frame_mbs_only;
+        bool mbaff_frame;
+        bool direct_8x8_inference;
+        bool entropy_coding_mode;
+        bool pic_order_present;
+        s32 num_refidx_l0_default_active;
+        s32 num_refidx_l1_default_active;
+        bool weighted_pred;
+        s32 weighted_bipred_idc;
+        s32 pic_init_qp_minus26;
+        s32 chroma_qp_index_offset;
+        s32 second_chroma_qp_index_offset;
+        bool deblocking_filter_control_present;
+        bool constrained_intra_pred;
+        bool redundant_pic_cnt_present;
+        bool transform_8x8_mode;
+        std::array<u8, 0x60> weight_scale;
+        std::array<u8, 0x80> weight_scale_8x8;
+
+        bool operator==(const HeaderParameters&) const = default;
+    };
+
+    /// Writes the SPS and PPS of the parameters into header
+    void ComposeHeader(const HeaderParameters& parameters);
+
     Common::ScratchBuffer<u8> frame;
     Common::ScratchBuffer<u8> scan;
+    Common::ScratchBuffer<u8> header;
+    /// Parameters of the header above, it is reused until they change
+    std::optional<HeaderParameters> header_parameters;
     Host1x::Host1x& host1x;
 
     struct H264ParameterSet {
@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm> // for std::copy
+#include <cstring>
 #include <numeric>
 
 #include "common/assert.h"
+#include "video_core/guest_memory.h"
 #include "video_core/host1x/codecs/vp9.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/memory_manager.h"
@@ -372,34 +374,37 @@ Vp9PictureInfo VP9::GetVp9PictureInfo(const Host1x::NvdecCommon::NvdecRegisters&
 }
 
 void VP9::InsertEntropy(u64 offset, Vp9EntropyProbs& dst) {
-    EntropyProbs entropy;
-    host1x.GMMU().ReadBlock(offset, &entropy, sizeof(EntropyProbs));
-    entropy.Convert(dst);
-}
+    // Compared in place when the probabilities are contiguous, they're only converted again when
+    // the guest changed them
+    const Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::SafeRead> entropy(
+        host1x.GMMU(), offset, sizeof(EntropyProbs), &entropy_buffer);
+    if (!entropy_cached ||
+        std::memcmp(entropy.data(), &cached_entropy, sizeof(EntropyProbs)) != 0) {
+        std::memcpy(&cached_entropy, entropy.data(), sizeof(EntropyProbs));
+        cached_entropy.Convert(converted_entropy);
+        entropy_cached = true;
+    }
+    dst = converted_entropy;
+}
+
+std::span<const u8> VP9::GetCurrentFrame(const Host1x::NvdecCommon::NvdecRegisters& state) {
+    const Vp9PictureInfo info = GetVp9PictureInfo(state);
+    // Read into the buffer of the frame decoded before, its capacity is reused
+    current_bit_stream.resize(info.bitstream_size);
+    host1x.GMMU().ReadBlock(state.frame_bitstream_offset, current_bit_stream.data(),
+                            info.bitstream_size);
 
-Vp9FrameContainer VP9::GetCurrentFrame(const Host1x::NvdecCommon::NvdecRegisters& state) {
-    Vp9FrameContainer current_frame{};
-    {
-        // gpu.SyncGuestHost(); epic, why?
-        current_frame.info = GetVp9PictureInfo(state);
-        current_frame.bit_stream.resize(current_frame.info.bitstream_size);
-        host1x.GMMU().ReadBlock(state.frame_bitstream_offset, current_frame.bit_stream.data(),
-                                current_frame.info.bitstream_size);
-    }
     if (!next_frame.bit_stream.empty()) {
-        Vp9FrameContainer temp{
-            .info = current_frame.info,
-            .bit_stream = std::move(current_frame.bit_stream),
-        };
-        next_frame.info.show_frame = current_frame.info.last_frame_shown;
-        current_frame.info = next_frame.info;
-        current_frame.bit_stream = std::move(next_frame.bit_stream);
-        next_frame = std::move(temp);
+        next_frame.info.show_frame = info.last_frame_shown;
+        current_frame_info = next_frame.info;
+        next_frame.info = info;
+        std::swap(current_bit_stream, next_frame.bit_stream);
     } else {
-        next_frame.info = current_frame.info;
-        next_frame.bit_stream = current_frame.bit_stream;
+        current_frame_info = info;
+        next_frame.info = info;
+        next_frame.bit_stream = current_bit_stream;
     }
-    return current_frame;
+    return current_bit_stream;
 }
 
 std::vector<u8> VP9::ComposeCompressedHeader() {
@@ -577,7 +582,7 @@ std::vector<u8> VP9::ComposeCompressedHeader() {
         }
     }
     writer.End();
-    return writer.GetBuffer();
+    return std::move(writer.GetBuffer());
 }
 
 VpxBitStreamWriter VP9::ComposeUncompressedHeader() {
@@ -771,27 +776,22 @@ VpxBitStreamWriter VP9::ComposeUncompressedHeader() {
 }
 
 void VP9::ComposeFrame(const Host1x::NvdecCommon::NvdecRegisters& state) {
-    std::vector<u8> bitstream;
-    {
-        Vp9FrameContainer curr_frame = GetCurrentFrame(state);
-        current_frame_info = curr_frame.info;
-        bitstream = std::move(curr_frame.bit_stream);
-    }
+    const std::span<const u8> bitstream = GetCurrentFrame(state);
+
     // The uncompressed header routine sets PrevProb parameters needed for the compressed header
     auto uncomp_writer = ComposeUncompressedHeader();
-    std::vector<u8> compressed_header = ComposeCompressedHeader();
+    const std::vector<u8> compressed_header = ComposeCompressedHeader();
 
     uncomp_writer.WriteU(static_cast<s32>(compressed_header.size()), 16);
     uncomp_writer.Flush();
-    std::vector<u8> uncompressed_header = uncomp_writer.GetByteArray();
+    const std::vector<u8>& uncompressed_header = uncomp_writer.GetByteArray();
 
     // Write headers and frame to buffer
-    frame.resize(uncompressed_header.size() + compressed_header.size() + bitstream.size());
-    std::copy(uncompressed_header.begin(), uncompressed_header.end(), frame.begin());
-    std::copy(compressed_header.begin(), compressed_header.end(),
-              frame.begin() + uncompressed_header.size());
-    std::copy(bitstream.begin(), bitstream.end(),
-              frame.begin() + uncompressed_header.size() + compressed_header.size());
+    frame.resize_destructive(uncompressed_header.size() + compressed_header.size() +
+                             bitstream.size());
+    auto it = std::copy(uncompressed_header.begin(), uncompressed_header.end(), frame.begin());
+    it = std::copy(compressed_header.begin(), compressed_header.end(), it);
+    std::copy(bitstream.begin(), bitstream.end(), it);
 }
 
 VpxRangeEncoder::VpxRangeEncoder() {
@@ -174,8 +174,9 @@ private:
     /// Read and convert NVDEC provided entropy probs to Vp9EntropyProbs struct
     void InsertEntropy(u64 offset, Vp9EntropyProbs& dst);
 
-    /// Returns frame to be decoded after buffering
-    [[nodiscard]] Vp9FrameContainer GetCurrentFrame(
+    /// Reads the current frame, then returns the bitstream of the frame to be decoded after
+    /// buffering and sets current_frame_info to its information
+    [[nodiscard]] std::span<const u8> GetCurrentFrame(
         const Host1x::NvdecCommon::NvdecRegisters& state);
 
     /// Use NVDEC providied information to compose the headers for the current frame
@@ -189,11 +190,18 @@ private:
     std::array<s8, 2> loop_filter_mode_deltas{};
 
     Vp9FrameContainer next_frame{};
+    std::vector<u8> current_bit_stream;
     std::array<Vp9EntropyProbs, 4> frame_ctxs{};
     bool swap_ref_indices{};
 
     Vp9PictureInfo current_frame_info{};
     Vp9EntropyProbs prev_frame_probs{};
+
+    /// Guest probabilities read last, and their conversion
+    Common::ScratchBuffer<u8> entropy_buffer;
+    EntropyProbs cached_entropy;
+    Vp9EntropyProbs converted_entropy{};
+    bool entropy_cached{};
 };
 
 } // namespace Decoder
@@ -1,13 +1,23 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string>
+
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "video_core/host1x/ffmpeg/ffmpeg.h"
 
+#ifdef __ANDROID__
+#include "common/android/id_cache.h"
+#endif
+
 extern "C" {
+#ifdef __ANDROID__
+// for letting the MediaCodec decoders reach the Java VM
+#include <libavcodec/jni.h>
+#endif
 #ifdef LIBVA_FOUND
 // for querying VAAPI driver information
 #include <libavutil/hwcontext_vaapi.h>
@@ -73,7 +83,7 @@ Frame::~Frame() {
     av_frame_free(&m_frame);
 }
 
-Decoder::Decoder(Tegra::Host1x::NvdecCommon::VideoCodec codec) {
+Decoder::Decoder(Tegra::Host1x::NvdecCommon::VideoCodec codec, std::string_view wrapper) {
     const AVCodecID av_codec = [&] {
         switch (codec) {
         case Tegra::Host1x::NvdecCommon::VideoCodec::H264:
@@ -89,6 +99,20 @@ Decoder::Decoder(Tegra::Host1x::NvdecCommon::VideoCodec codec) {
     }();
 
     m_codec = avcodec_find_decoder(av_codec);
+    if (!m_codec || wrapper.empty()) {
+        return;
+    }
+
+    // Wrapper decoders are named after the codec they decode, like h264_mediacodec
+    std::string wrapper_name{m_codec->name};
+    wrapper_name += '_';
+    wrapper_name += wrapper;
+    if (const AVCodec* wrapper_codec = avcodec_find_decoder_by_name(wrapper_name.c_str())) {
+        m_codec = wrapper_codec;
+        m_is_wrapper = true;
+    } else {
+        LOG_DEBUG(HW_GPU, "{} decoder is not available", wrapper_name);
+    }
 }
 
 bool Decoder::SupportsDecodingOnDevice(AVPixelFormat* out_pix_fmt, AVHWDeviceType type) const {
@@ -208,7 +232,9 @@ bool DecoderContext::OpenContext(const Decoder& decoder) {
         return false;
     }
 
-    if (!m_codec_context->hw_device_ctx) {
+    if (decoder.IsWrapper()) {
+        LOG_INFO(HW_GPU, "Using FFmpeg {} decoder", decoder.GetCodec()->name);
+    } else if (!m_codec_context->hw_device_ctx) {
         LOG_INFO(HW_GPU, "Using FFmpeg software decoding");
     }
 
@@ -364,11 +390,21 @@ void DecodeApi::Reset() {
 
 bool DecodeApi::Initialize(Tegra::Host1x::NvdecCommon::VideoCodec codec) {
     this->Reset();
+    const bool gpu_decoding =
+        Settings::values.nvdec_emulation.GetValue() == Settings::NvdecEmulation::Gpu;
+
+#ifdef __ANDROID__
+    // FFmpeg has no hardware device for Android's decoders, they are reached through MediaCodec.
+    if (gpu_decoding && this->InitializeMediaCodec(codec)) {
+        return true;
+    }
+#endif
+
     m_decoder.emplace(codec);
     m_decoder_context.emplace(*m_decoder);
 
     // Enable GPU decoding if requested.
-    if (Settings::values.nvdec_emulation.GetValue() == Settings::NvdecEmulation::Gpu) {
+    if (gpu_decoding) {
         m_hardware_context.emplace();
         m_hardware_context->InitializeForDecoder(*m_decoder_context, *m_decoder);
     }
@@ -382,11 +418,40 @@ bool DecodeApi::Initialize(Tegra::Host1x::NvdecCommon::VideoCodec codec) {
     return true;
 }
 
+#ifdef __ANDROID__
+bool DecodeApi::InitializeMediaCodec(Tegra::Host1x::NvdecCommon::VideoCodec codec) {
+    m_decoder.emplace(codec, "mediacodec");
+    if (!m_decoder->IsWrapper()) {
+        this->Reset();
+        return false;
+    }
+
+    // Without an output surface, MediaCodec decodes into buffers that FFmpeg copies out as
+    // NV12 or YUV420P frames, which the VIC converts like any other software frame.
+    av_jni_set_java_vm(Common::Android::GetJavaVM(), nullptr);
+    m_decoder_context.emplace(*m_decoder);
+    if (!m_decoder_context->OpenContext(*m_decoder)) {
+        LOG_WARNING(HW_GPU, "Could not open the MediaCodec decoder, falling back to FFmpeg's");
+        this->Reset();
+        return false;
+    }
+
+    return true;
+}
+#endif
+
 bool DecodeApi::SendPacket(std::span<const u8> packet_data, size_t configuration_size) {
     FFmpeg::Packet packet(packet_data);
     return m_decoder_context->SendPacket(packet);
 }
 
+bool DecodeApi::IsHardwareDecoding() const {
+    if (!m_decoder || !m_decoder_context) {
+        return false;
+    }
+    return m_decoder->IsWrapper() || m_decoder_context->GetCodecContext()->hw_device_ctx;
+}
+
 void DecodeApi::ReceiveFrames(std::queue<std::unique_ptr<Frame>>& frame_queue) {
     // Receive raw frame from decoder.
     bool is_interlaced;
@@ -6,6 +6,7 @@
 #include <memory>
 #include <optional>
 #include <span>
+#include <string_view>
 #include <vector>
 #include <queue>
 
@@ -112,7 +113,12 @@ public:
     YUZU_NON_COPYABLE(Decoder);
     YUZU_NON_MOVEABLE(Decoder);
 
-    explicit Decoder(Tegra::Host1x::NvdecCommon::VideoCodec codec);
+    /**
+     * Finds the decoder of a codec. When a wrapper is named (like "mediacodec"), FFmpeg's decoder
+     * wrapping that platform decoder is preferred, falling back to FFmpeg's own decoder when the
+     * wrapper is not built in.
+     */
+    explicit Decoder(Tegra::Host1x::NvdecCommon::VideoCodec codec, std::string_view wrapper = {});
     ~Decoder() = default;
 
     bool SupportsDecodingOnDevice(AVPixelFormat* out_pix_fmt, AVHWDeviceType type) const;
@@ -121,8 +127,14 @@ public:
         return m_codec;
     }
 
+    /// Whether the decoder wraps a platform decoder, which outputs frames in system memory
+    bool IsWrapper() const {
+        return m_is_wrapper;
+    }
+
 private:
     const AVCodec* m_codec{};
+    bool m_is_wrapper{};
 };
 
 // Wraps AVBufferRef for an accelerated decoder.
@@ -203,7 +215,15 @@ public:
     bool SendPacket(std::span<const u8> packet_data, size_t configuration_size);
     void ReceiveFrames(std::queue<std::unique_ptr<Frame>>& frame_queue);
 
+    /// Whether frames are decoded by a hardware device or a platform decoder, FFmpeg may fall
+    /// back to software decoding once the first frame is decoded
+    bool IsHardwareDecoding() const;
+
 private:
+#ifdef __ANDROID__
+    bool InitializeMediaCodec(Tegra::Host1x::NvdecCommon::VideoCodec codec);
+#endif
+
     std::optional<FFmpeg::Decoder> m_decoder;
     std::optional<FFmpeg::DecoderContext> m_decoder_context;
     std::optional<FFmpeg::HardwareContext> m_hardware_context;
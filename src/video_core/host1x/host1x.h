@@ -8,6 +8,7 @@
 #include "common/address_space.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/host1x/syncpoint_manager.h"
+#include "video_core/host1x/video_pipeline_stats.h"
 #include "video_core/memory_manager.h"
 
 namespace Core {
@@ -31,6 +32,10 @@ public:
         return syncpoint_manager;
     }
 
+    VideoPipelineStatsCollector& VideoStats() {
+        return video_stats;
+    }
+
     Tegra::MaxwellDeviceMemoryManager& MemoryManager() {
         return memory_manager;
     }
@@ -58,6 +63,7 @@ public:
 private:
     Core::System& system;
     SyncpointManager syncpoint_manager;
+    VideoPipelineStatsCollector video_stats;
     Tegra::MaxwellDeviceMemoryManager memory_manager;
     Tegra::MemoryManager gmmu_manager;
     std::unique_ptr<Common::FlatAllocator<u32, 0, 32>> allocator;
@@ -28,8 +28,16 @@ void Nvdec::ProcessMethod(u32 method, u32 argument) {
     }
 }
 
-std::unique_ptr<FFmpeg::Frame> Nvdec::GetFrame() {
-    return codec->GetCurrentFrame();
+u64 Nvdec::GetSubmittedFrames() const {
+    return codec->GetSubmittedPackets();
+}
+
+std::unique_ptr<FFmpeg::Frame> Nvdec::GetFrame(u64 submitted_frames) {
+    return codec->GetCurrentFrame(submitted_frames);
+}
+
+void Nvdec::SignalWhenDone(std::function<void()> callback) {
+    codec->SignalWhenDecoded(std::move(callback));
 }
 
 void Nvdec::Execute() {
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 #include "common/common_types.h"
@@ -22,8 +23,14 @@ public:
     /// Writes the method into the state, Invoke Execute() if encountered
     void ProcessMethod(u32 method, u32 argument);
 
-    /// Return most recently decoded frame
-    [[nodiscard]] std::unique_ptr<FFmpeg::Frame> GetFrame();
+    /// Returns the number of frames submitted for decoding so far
+    [[nodiscard]] u64 GetSubmittedFrames() const;
+
+    /// Return the next decoded frame, waiting for the first `submitted_frames` to be decoded
+    [[nodiscard]] std::unique_ptr<FFmpeg::Frame> GetFrame(u64 submitted_frames);
+
+    /// Runs the callback once every frame submitted so far has been decoded
+    void SignalWhenDone(std::function<void()> callback);
 
 private:
     /// Invoke codec to decode a frame
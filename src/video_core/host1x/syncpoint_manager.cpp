@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <algorithm>
+#include <utility>
+
 #include "common/microprofile.h"
 #include "video_core/host1x/syncpoint_manager.h"
 
@@ -58,47 +61,69 @@ void SyncpointManager::DeregisterHostAction(u32 syncpoint_id, const ActionHandle
 }
 
 void SyncpointManager::IncrementGuest(u32 syncpoint_id) {
-    Increment(syncpoints_guest[syncpoint_id], wait_guest_cv, guest_action_storage[syncpoint_id]);
+    Increment(syncpoints_guest[syncpoint_id], guest_action_storage[syncpoint_id]);
 }
 
 void SyncpointManager::IncrementHost(u32 syncpoint_id) {
-    Increment(syncpoints_host[syncpoint_id], wait_host_cv, host_action_storage[syncpoint_id]);
+    Increment(syncpoints_host[syncpoint_id], host_action_storage[syncpoint_id]);
 }
 
 void SyncpointManager::WaitGuest(u32 syncpoint_id, u32 expected_value) {
-    Wait(syncpoints_guest[syncpoint_id], wait_guest_cv, expected_value);
+    Wait(syncpoints_guest[syncpoint_id], guest_action_storage[syncpoint_id], expected_value);
 }
 
 void SyncpointManager::WaitHost(u32 syncpoint_id, u32 expected_value) {
     MICROPROFILE_SCOPE(GPU_wait);
-    Wait(syncpoints_host[syncpoint_id], wait_host_cv, expected_value);
+    Wait(syncpoints_host[syncpoint_id], host_action_storage[syncpoint_id], expected_value);
+}
+
+SyncpointWaitStats SyncpointManager::GetAndResetWaitStats() {
+    std::scoped_lock lk(guard);
+    return std::exchange(wait_stats, {});
 }
 
-void SyncpointManager::Increment(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv,
+void SyncpointManager::Increment(std::atomic<u32>& syncpoint,
                                  std::list<RegisteredAction>& action_storage) {
     auto new_value{syncpoint.fetch_add(1, std::memory_order_acq_rel) + 1};
 
     std::unique_lock lk(guard);
     auto it = action_storage.begin();
+    if (it == action_storage.end() || it->expected_value > new_value) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
     while (it != action_storage.end()) {
         if (it->expected_value > new_value) {
             break;
         }
+        const auto wait_ns = static_cast<u64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - it->register_time).count());
+        ++wait_stats.waits;
+        wait_stats.wait_ns += wait_ns;
+        wait_stats.max_wait_ns = std::max(wait_stats.max_wait_ns, wait_ns);
+
         it->action();
         it = action_storage.erase(it);
     }
-    wait_cv.notify_all();
 }
 
-void SyncpointManager::Wait(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv,
-                            u32 expected_value) {
-    const auto pred = [&]() { return syncpoint.load(std::memory_order_acquire) >= expected_value; };
-    if (pred()) {
+void SyncpointManager::Wait(std::atomic<u32>& syncpoint,
+                            std::list<RegisteredAction>& action_storage, u32 expected_value) {
+    if (syncpoint.load(std::memory_order_acquire) >= expected_value) {
         return;
     }
 
-    std::unique_lock lk(guard);
-    wait_cv.wait(lk, pred);
+    // Waiters are queued with the actions, sorted by threshold, so an increment only wakes the
+    // waiters it satisfies
+    std::atomic<bool> signaled{};
+    RegisterAction(syncpoint, action_storage, expected_value, [&signaled] {
+        signaled.store(true, std::memory_order_release);
+        signaled.notify_one();
+    });
+    signaled.wait(false, std::memory_order_acquire);
+
+    // The action runs with the guard held, wait for it to stop using the flag before returning
+    std::scoped_lock lk(guard);
 }
 
 } // namespace Host1x
@@ -5,12 +5,13 @@
 
 #include <array>
 #include <atomic>
-#include <condition_variable>
+#include <chrono>
 #include <functional>
 #include <list>
 #include <mutex>
 
 #include "common/common_types.h"
+#include "video_core/host1x/syncpoint_wait_stats.h"
 
 namespace Tegra {
 
@@ -28,9 +29,11 @@ public:
 
     struct RegisteredAction {
         explicit RegisteredAction(u32 expected_value_, std::function<void()>&& action_)
-            : expected_value{expected_value_}, action{std::move(action_)} {}
+            : expected_value{expected_value_}, action{std::move(action_)},
+              register_time{std::chrono::steady_clock::now()} {}
         u32 expected_value;
         std::function<void()> action;
+        std::chrono::steady_clock::time_point register_time;
     };
     using ActionHandle = std::list<RegisteredAction>::iterator;
 
@@ -54,10 +57,15 @@ public:
 
     void IncrementHost(u32 syncpoint_id);
 
+    /// Blocks until the syncpoint reaches the value, only woken by the increment that reaches it
     void WaitGuest(u32 syncpoint_id, u32 expected_value);
 
+    /// Blocks until the syncpoint reaches the value, only woken by the increment that reaches it
     void WaitHost(u32 syncpoint_id, u32 expected_value);
 
+    /// Returns the time spent waiting on syncpoints by actions and waits since the previous call
+    [[nodiscard]] SyncpointWaitStats GetAndResetWaitStats();
+
     bool IsReadyGuest(u32 syncpoint_id, u32 expected_value) const {
         return syncpoints_guest[syncpoint_id].load(std::memory_order_acquire) >= expected_value;
     }
@@ -67,8 +75,7 @@ public:
     }
 
 private:
-    void Increment(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv,
-                   std::list<RegisteredAction>& action_storage);
+    void Increment(std::atomic<u32>& syncpoint, std::list<RegisteredAction>& action_storage);
 
     ActionHandle RegisterAction(std::atomic<u32>& syncpoint,
                                 std::list<RegisteredAction>& action_storage, u32 expected_value,
@@ -76,7 +83,8 @@ private:
 
     void DeregisterAction(std::list<RegisteredAction>& action_storage, const ActionHandle& handle);
 
-    void Wait(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv, u32 expected_value);
+    void Wait(std::atomic<u32>& syncpoint, std::list<RegisteredAction>& action_storage,
+              u32 expected_value);
 
     static constexpr size_t NUM_MAX_SYNCPOINTS = 192;
 
@@ -87,8 +95,7 @@ private:
     std::array<std::list<RegisteredAction>, NUM_MAX_SYNCPOINTS> host_action_storage;
 
     std::mutex guard;
-    std::condition_variable wait_guest_cv;
-    std::condition_variable wait_host_cv;
+    SyncpointWaitStats wait_stats{}; ///< Protected by `guard`
 };
 
 } // namespace Host1x
@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace Tegra {
+
+namespace Host1x {
+
+/// Host time from starting to wait on a syncpoint to it reaching the threshold, summed since the
+/// last reset. Waits that were already satisfied when they started are not counted.
+struct SyncpointWaitStats {
+    u64 waits{};       ///< Waits that had to be woken up by an increment
+    u64 wait_ns{};     ///< Host time spent in those waits
+    u64 max_wait_ns{}; ///< Longest wait
+};
+
+} // namespace Host1x
+
+} // namespace Tegra
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <chrono>
 
 extern "C" {
 #if defined(__GNUC__) || defined(__clang__)
@@ -17,14 +18,20 @@ extern "C" {
 #include "common/assert.h"
 #include "common/bit_field.h"
 #include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "common/settings.h"
 
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/guest_memory.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/host1x/nvdec.h"
 #include "video_core/host1x/vic.h"
+#include "video_core/host1x/vic_kernels.h"
 #include "video_core/memory_manager.h"
 #include "video_core/textures/decoders.h"
 
+MICROPROFILE_DEFINE(Host1x_VicWrite, "Host1x", "VIC write frame", MP_RGB(96, 160, 192));
+
 namespace Tegra {
 
 namespace Host1x {
@@ -51,7 +58,11 @@ union VicConfig {
 
 Vic::Vic(Host1x& host1x_, std::shared_ptr<Nvdec> nvdec_processor_)
     : host1x(host1x_),
-      nvdec_processor(std::move(nvdec_processor_)), converted_frame_buffer{nullptr, av_free} {}
+      nvdec_processor(std::move(nvdec_processor_)), converted_frame_buffer{nullptr, av_free} {
+    if (Settings::values.use_asynchronous_nvdec.GetValue()) {
+        write_thread = std::make_unique<Common::ThreadWorker>(1, "VicWrite");
+    }
+}
 
 Vic::~Vic() = default;
 
@@ -82,10 +93,35 @@ void Vic::Execute() {
         return;
     }
     const VicConfig config{host1x.GMMU().Read<u64>(config_struct_address + 0x20)};
-    auto frame = nvdec_processor->GetFrame();
+    const u64 submitted_frames = nvdec_processor->GetSubmittedFrames();
+    if (!write_thread) {
+        WriteFrame(config, output_surface_luma_address, output_surface_chroma_address,
+                   submitted_frames);
+        return;
+    }
+    // The surfaces are latched now, the conversion overlaps the decoding of the next frames
+    write_thread->QueueWork([this, config, luma_address = output_surface_luma_address,
+                             chroma_address = output_surface_chroma_address, submitted_frames] {
+        WriteFrame(config, luma_address, chroma_address, submitted_frames);
+    });
+}
+
+void Vic::SignalWhenDone(std::function<void()> callback) {
+    if (!write_thread) {
+        callback();
+        return;
+    }
+    write_thread->QueueWork(std::move(callback));
+}
+
+void Vic::WriteFrame(const VicConfig& config, GPUVAddr luma_address, GPUVAddr chroma_address,
+                     u64 submitted_frames) {
+    auto frame = nvdec_processor->GetFrame(submitted_frames);
     if (!frame) {
         return;
     }
+    MICROPROFILE_SCOPE(Host1x_VicWrite);
+    const auto write_start = std::chrono::steady_clock::now();
     const u64 surface_width = config.surface_width_minus1 + 1;
     const u64 surface_height = config.surface_height_minus1 + 1;
     if (static_cast<u64>(frame->GetWidth()) != surface_width ||
@@ -94,28 +130,72 @@ void Vic::Execute() {
         LOG_WARNING(Service_NVDRV, "Frame dimensions {}x{} don't match surface dimensions {}x{}",
                     frame->GetWidth(), frame->GetHeight(), surface_width, surface_height);
     }
+    size_t bytes_written = 0;
     switch (config.pixel_format) {
     case VideoPixelFormat::RGBA8:
     case VideoPixelFormat::BGRA8:
     case VideoPixelFormat::RGBX8:
-        WriteRGBFrame(std::move(frame), config);
+        bytes_written = WriteRGBFrame(std::move(frame), config, luma_address);
         break;
     case VideoPixelFormat::YUV420:
-        WriteYUVFrame(std::move(frame), config);
+        bytes_written = WriteYUVFrame(std::move(frame), config, luma_address, chroma_address);
         break;
     default:
         UNIMPLEMENTED_MSG("Unknown video pixel format {:X}", config.pixel_format.Value());
-        break;
+        return;
     }
+    host1x.VideoStats().Report({
+        .frames_written = 1,
+        .conversion_ns = static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                              std::chrono::steady_clock::now() - write_start)
+                                              .count()),
+        .bytes_written = bytes_written,
+    });
 }
 
-void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config) {
+size_t Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config,
+                          GPUVAddr luma_address) {
     LOG_TRACE(Service_NVDRV, "Writing RGB Frame");
 
     const auto frame_width = frame->GetWidth();
     const auto frame_height = frame->GetHeight();
     const auto frame_format = frame->GetPixelFormat();
 
+    // Use the minimum of surface/frame dimensions to avoid buffer overflow.
+    const u32 surface_width = static_cast<u32>(config.surface_width_minus1) + 1;
+    const u32 surface_height = static_cast<u32>(config.surface_height_minus1) + 1;
+    const u32 width = std::min(surface_width, static_cast<u32>(frame_width));
+    const u32 height = std::min(surface_height, static_cast<u32>(frame_height));
+    const u32 blk_kind = static_cast<u32>(config.block_linear_kind);
+
+    if (frame_format == AV_PIX_FMT_NV12 || frame_format == AV_PIX_FMT_YUV420P) {
+        // The decoders' own formats are converted and swizzled in one pass, straight into the
+        // surface. Anything else goes through swscale below.
+        const u32 block_height = static_cast<u32>(config.block_linear_height_log2);
+        const RgbSurfaceLayout layout{
+            .width = width,
+            .height = height,
+            .block_linear = blk_kind != 0,
+            .block_height = block_height,
+        };
+        const bool interleaved = frame_format == AV_PIX_FMT_NV12;
+        const YuvFrameView view{
+            .luma = frame->GetPlanes()[0],
+            .chroma_u = frame->GetPlanes()[1],
+            .chroma_v = interleaved ? nullptr : frame->GetPlanes()[2],
+            .luma_stride = static_cast<size_t>(frame->GetStride(0)),
+            .chroma_stride = static_cast<size_t>(frame->GetStride(1)),
+        };
+        const auto order = config.pixel_format == VideoPixelFormat::BGRA8 ? VicRgbOrder::Bgra
+                                                                           : VicRgbOrder::Rgba;
+        const auto size = Texture::CalculateSize(layout.block_linear, 4, width, height, 1,
+                                                 block_height, 0);
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            surface(host1x.GMMU(), luma_address, size, &luma_buffer);
+        ConvertYuvToRgb(surface, view, layout, order);
+        return size;
+    }
+
     if (!scaler_ctx || frame_width != scaler_width || frame_height != scaler_height) {
         const AVPixelFormat target_format = [pixel_format = config.pixel_format]() {
             switch (pixel_format) {
@@ -138,6 +218,19 @@ void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         scaler_height = frame_height;
         converted_frame_buffer.reset();
     }
+
+    if (blk_kind == 0 && width == static_cast<u32>(frame_width) &&
+        height == static_cast<u32>(frame_height)) {
+        // The whole frame fits in the pitch linear surface, convert it straight into it
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            surface(host1x.GMMU(), luma_address, width * height * 4, &luma_buffer);
+        u8* const surface_addr{surface.data()};
+        const std::array<int, 4> surface_stride{static_cast<int>(width * 4), 0, 0, 0};
+        sws_scale(scaler_ctx, frame->GetPlanes(), frame->GetStrides(), 0, frame_height,
+                  &surface_addr, surface_stride.data());
+        return surface.size();
+    }
+
     if (!converted_frame_buffer) {
         const size_t frame_size = frame_width * frame_height * 4;
         converted_frame_buffer = AVMallocPtr{static_cast<u8*>(av_malloc(frame_size)), av_free};
@@ -147,31 +240,30 @@ void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
     sws_scale(scaler_ctx, frame->GetPlanes(), frame->GetStrides(), 0, frame_height,
               &converted_frame_buf_addr, converted_stride.data());
 
-    // Use the minimum of surface/frame dimensions to avoid buffer overflow.
-    const u32 surface_width = static_cast<u32>(config.surface_width_minus1) + 1;
-    const u32 surface_height = static_cast<u32>(config.surface_height_minus1) + 1;
-    const u32 width = std::min(surface_width, static_cast<u32>(frame_width));
-    const u32 height = std::min(surface_height, static_cast<u32>(frame_height));
-    const u32 blk_kind = static_cast<u32>(config.block_linear_kind);
     if (blk_kind != 0) {
-        // swizzle pitch linear to block linear
+        // swizzle pitch linear to block linear, straight into the surface
         const u32 block_height = static_cast<u32>(config.block_linear_height_log2);
         const auto size = Texture::CalculateSize(true, 4, width, height, 1, block_height, 0);
-        luma_buffer.resize_destructive(size);
-        std::span<const u8> frame_buff(converted_frame_buf_addr, 4 * width * height);
-        Texture::SwizzleSubrect(luma_buffer, frame_buff, 4, width, height, 1, 0, 0, width, height,
-                                block_height, 0, width * 4);
-
-        host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), size);
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            surface(host1x.GMMU(), luma_address, size, &luma_buffer);
+        std::span<const u8> frame_buff(converted_frame_buf_addr, 4 * frame_width * height);
+        Texture::SwizzleSubrect(surface, frame_buff, 4, width, height, 1, 0, 0, width, height,
+                                block_height, 0, frame_width * 4);
+        return size;
     } else {
-        // send pitch linear frame
-        const size_t linear_size = width * height * 4;
-        host1x.GMMU().WriteBlock(output_surface_luma_address, converted_frame_buf_addr,
-                                 linear_size);
+        // send pitch linear frame, cropped to the surface
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            surface(host1x.GMMU(), luma_address, width * height * 4, &luma_buffer);
+        for (u32 y = 0; y < height; ++y) {
+            std::memcpy(surface.data() + y * width * 4,
+                        converted_frame_buf_addr + y * frame_width * 4, width * 4);
+        }
+        return surface.size();
     }
 }
 
-void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config) {
+size_t Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config,
+                          GPUVAddr luma_address, GPUVAddr chroma_address) {
     LOG_TRACE(Service_NVDRV, "Writing YUV420 Frame");
 
     const std::size_t surface_width = config.surface_width_minus1 + 1;
@@ -182,29 +274,33 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
     const auto frame_height = std::min(surface_height, static_cast<size_t>(frame->GetHeight()));
 
     const auto stride = static_cast<size_t>(frame->GetStride(0));
+    const std::size_t luma_size = aligned_width * surface_height;
+    const std::size_t chroma_size = aligned_width * surface_height / 2;
 
-    luma_buffer.resize_destructive(aligned_width * surface_height);
-    chroma_buffer.resize_destructive(aligned_width * surface_height / 2);
-
-    // Populate luma buffer
-    const u8* luma_src = frame->GetData(0);
-    for (std::size_t y = 0; y < frame_height; ++y) {
-        const std::size_t src = y * stride;
-        const std::size_t dst = y * aligned_width;
-        std::memcpy(luma_buffer.data() + dst, luma_src + src, frame_width);
+    // The planes are copied straight into the surfaces, padding columns are left as they were
+    {
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            luma(host1x.GMMU(), luma_address, luma_size, &luma_buffer);
+        const u8* luma_src = frame->GetData(0);
+        for (std::size_t y = 0; y < frame_height; ++y) {
+            const std::size_t src = y * stride;
+            const std::size_t dst = y * aligned_width;
+            std::memcpy(luma.data() + dst, luma_src + src, frame_width);
+        }
     }
-    host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), luma_buffer.size());
 
     // Chroma
     const std::size_t half_height = frame_height / 2;
     const auto half_stride = static_cast<size_t>(frame->GetStride(1));
 
+    Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite> chroma(
+        host1x.GMMU(), chroma_address, chroma_size, &chroma_buffer);
     switch (frame->GetPixelFormat()) {
     case AV_PIX_FMT_YUV420P: {
         // Frame from FFmpeg software
         // Populate chroma buffer from both channels with interleaving.
         const std::size_t half_width = frame_width / 2;
-        u8* chroma_buffer_data = chroma_buffer.data();
+        u8* chroma_buffer_data = chroma.data();
         const u8* chroma_b_src = frame->GetData(1);
         const u8* chroma_r_src = frame->GetData(2);
         for (std::size_t y = 0; y < half_height; ++y) {
@@ -224,7 +320,7 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         for (std::size_t y = 0; y < half_height; ++y) {
             const std::size_t src = y * stride;
             const std::size_t dst = y * aligned_width;
-            std::memcpy(chroma_buffer.data() + dst, chroma_src + src, frame_width);
+            std::memcpy(chroma.data() + dst, chroma_src + src, frame_width);
         }
         break;
     }
@@ -232,8 +328,7 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         ASSERT(false);
         break;
     }
-    host1x.GMMU().WriteBlock(output_surface_chroma_address, chroma_buffer.data(),
-                             chroma_buffer.size());
+    return luma_size + chroma_size;
 }
 
 } // namespace Host1x
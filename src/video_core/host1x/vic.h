@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "common/common_types.h"
 #include "common/scratch_buffer.h"
+#include "common/thread_worker.h"
 
 struct SwsContext;
 
@@ -36,12 +38,23 @@ public:
     /// Write to the device state.
     void ProcessMethod(Method method, u32 argument);
 
+    /// Runs the callback once every frame executed so far has been written to its surfaces
+    void SignalWhenDone(std::function<void()> callback);
+
 private:
     void Execute();
 
-    void WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config);
+    /// Writes the next decoded frame, once the first `submitted_frames` are decoded
+    void WriteFrame(const VicConfig& config, GPUVAddr luma_address, GPUVAddr chroma_address,
+                    u64 submitted_frames);
+
+    /// Returns the number of bytes written to the surface
+    size_t WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config,
+                         GPUVAddr luma_address);
 
-    void WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config);
+    /// Returns the number of bytes written to the surfaces
+    size_t WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config,
+                         GPUVAddr luma_address, GPUVAddr chroma_address);
 
     Host1x& host1x;
     std::shared_ptr<Tegra::Host1x::Nvdec> nvdec_processor;
@@ -60,6 +73,10 @@ private:
     SwsContext* scaler_ctx{};
     s32 scaler_width{};
     s32 scaler_height{};
+
+    /// Writes the frames off the command thread, declared last so it stops before the state it
+    /// uses
+    std::unique_ptr<Common::ThreadWorker> write_thread;
 };
 
 } // namespace Host1x
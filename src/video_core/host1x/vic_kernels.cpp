@@ -0,0 +1,328 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "common/assert.h"
+#include "common/div_ceil.h"
+#include "video_core/host1x/vic_kernels.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AVX2_TARGET
+#endif
+
+namespace Tegra::Host1x {
+namespace {
+
+/*
+ * BT.601 limited range, in 8 bit fixed point:
+ *   c = 298 * (Y - 16) + 128
+ *   R = (c + 409 * (V - 128)) >> 8
+ *   G = (c - 100 * (U - 128) - 208 * (V - 128)) >> 8
+ *   B = (c + 516 * (U - 128)) >> 8
+ * Every term fits in 32 bits, so the vector kernels compute the same values in 32 bit lanes.
+ *
+ * Pixels are stored in runs of four, 16 bytes, which are contiguous in pitch linear surfaces and
+ * inside a GOB of block linear ones. The row writers give the address of the run holding a pixel.
+ */
+
+constexpr u32 GOB_SIZE_SHIFT = 9;
+
+// Offsets of the four 16 byte runs of a GOB row, from the x bits of the swizzle
+constexpr std::array<u32, 4> GOB_RUN_OFFSETS{0, 32, 256, 288};
+
+template <bool Bgra>
+u32 PackPixel(s32 r, s32 g, s32 b) {
+    r = std::clamp(r, 0, 255);
+    g = std::clamp(g, 0, 255);
+    b = std::clamp(b, 0, 255);
+    if constexpr (Bgra) {
+        std::swap(r, b);
+    }
+    return static_cast<u32>(r) | (static_cast<u32>(g) << 8) | (static_cast<u32>(b) << 16) |
+           0xFF000000U;
+}
+
+template <bool Bgra>
+u32 ConvertPixel(u8 y, u8 u, u8 v) {
+    const s32 c = 298 * (s32{y} - 16) + 128;
+    const s32 d = s32{u} - 128;
+    const s32 e = s32{v} - 128;
+    return PackPixel<Bgra>((c + 409 * e) >> 8, (c - 100 * d - 208 * e) >> 8, (c + 516 * d) >> 8);
+}
+
+struct RowInput {
+    const u8* luma;
+    const u8* chroma_u;
+    const u8* chroma_v;
+};
+
+struct PitchLinearRow {
+    u8* row;
+
+    u8* operator()(u32 x) const {
+        return row + x * 4;
+    }
+};
+
+struct BlockLinearRow {
+    u8* row;
+    u32 gob_shift;
+
+    u8* operator()(u32 x) const {
+        const u32 x_bytes = x * 4;
+        return row + ((x_bytes >> 6) << gob_shift) + GOB_RUN_OFFSETS[(x_bytes >> 4) & 3] +
+               (x_bytes & 15);
+    }
+};
+
+template <bool Bgra, bool Interleaved, typename Writer>
+void ConvertRowScalar(const RowInput& input, u32 begin, u32 end, const Writer& writer) {
+    for (u32 x = begin; x < end; x++) {
+        const u32 chroma_x = x / 2;
+        const u8 u = Interleaved ? input.chroma_u[chroma_x * 2] : input.chroma_u[chroma_x];
+        const u8 v = Interleaved ? input.chroma_u[chroma_x * 2 + 1] : input.chroma_v[chroma_x];
+        const u32 pixel = ConvertPixel<Bgra>(input.luma[x], u, v);
+        std::memcpy(writer(x), &pixel, sizeof(pixel));
+    }
+}
+
+#if defined(ARCHITECTURE_x86_64)
+
+AVX2_TARGET __m256i ClampAvx2(__m256i value) {
+    return _mm256_min_epi32(_mm256_max_epi32(_mm256_srai_epi32(value, 8), _mm256_setzero_si256()),
+                            _mm256_set1_epi32(255));
+}
+
+template <bool Bgra>
+AVX2_TARGET __m256i ConvertPixelsAvx2(__m256i y, __m256i u, __m256i v) {
+    const __m256i c = _mm256_add_epi32(
+        _mm256_mullo_epi32(_mm256_sub_epi32(y, _mm256_set1_epi32(16)), _mm256_set1_epi32(298)),
+        _mm256_set1_epi32(128));
+    const __m256i d = _mm256_sub_epi32(u, _mm256_set1_epi32(128));
+    const __m256i e = _mm256_sub_epi32(v, _mm256_set1_epi32(128));
+
+    __m256i r = ClampAvx2(_mm256_add_epi32(c, _mm256_mullo_epi32(e, _mm256_set1_epi32(409))));
+    const __m256i g = ClampAvx2(_mm256_sub_epi32(
+        _mm256_sub_epi32(c, _mm256_mullo_epi32(d, _mm256_set1_epi32(100))),
+        _mm256_mullo_epi32(e, _mm256_set1_epi32(208))));
+    __m256i b = ClampAvx2(_mm256_add_epi32(c, _mm256_mullo_epi32(d, _mm256_set1_epi32(516))));
+    if constexpr (Bgra) {
+        std::swap(r, b);
+    }
+    return _mm256_or_si256(
+        _mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+        _mm256_or_si256(_mm256_slli_epi32(b, 16), _mm256_set1_epi32(static_cast<s32>(0xFF000000))));
+}
+
+// Converts eight pixels at a time, returns the first pixel left for the scalar tail
+template <bool Bgra, bool Interleaved, typename Writer>
+AVX2_TARGET u32 ConvertRowAvx2(const RowInput& input, u32 width, const Writer& writer) {
+    const __m128i u_shuffle = _mm_setr_epi8(0, 0, 2, 2, 4, 4, 6, 6, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i v_shuffle = _mm_setr_epi8(1, 1, 3, 3, 5, 5, 7, 7, -1, -1, -1, -1, -1, -1, -1, -1);
+    u32 x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const __m256i y = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input.luma + x)));
+        __m128i u;
+        __m128i v;
+        if constexpr (Interleaved) {
+            const __m128i uv =
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input.chroma_u + x));
+            u = _mm_shuffle_epi8(uv, u_shuffle);
+            v = _mm_shuffle_epi8(uv, v_shuffle);
+        } else {
+            s32 u_samples;
+            s32 v_samples;
+            std::memcpy(&u_samples, input.chroma_u + x / 2, sizeof(u_samples));
+            std::memcpy(&v_samples, input.chroma_v + x / 2, sizeof(v_samples));
+            u = _mm_cvtsi32_si128(u_samples);
+            v = _mm_cvtsi32_si128(v_samples);
+            u = _mm_unpacklo_epi8(u, u);
+            v = _mm_unpacklo_epi8(v, v);
+        }
+        const __m256i pixels = ConvertPixelsAvx2<Bgra>(y, _mm256_cvtepu8_epi32(u),
+                                                       _mm256_cvtepu8_epi32(v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(writer(x)), _mm256_castsi256_si128(pixels));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(writer(x + 4)),
+                         _mm256_extracti128_si256(pixels, 1));
+    }
+    return x;
+}
+
+#elif defined(ARCHITECTURE_arm64)
+
+template <bool Bgra>
+uint32x4_t ConvertPixelsNeon(int32x4_t y, int32x4_t u, int32x4_t v) {
+    const int32x4_t c = vmlaq_n_s32(vdupq_n_s32(128), vsubq_s32(y, vdupq_n_s32(16)), 298);
+    const int32x4_t d = vsubq_s32(u, vdupq_n_s32(128));
+    const int32x4_t e = vsubq_s32(v, vdupq_n_s32(128));
+
+    const auto clamp = [](int32x4_t value) {
+        return vreinterpretq_u32_s32(
+            vminq_s32(vmaxq_s32(vshrq_n_s32(value, 8), vdupq_n_s32(0)), vdupq_n_s32(255)));
+    };
+    uint32x4_t r = clamp(vmlaq_n_s32(c, e, 409));
+    const uint32x4_t g = clamp(vmlsq_n_s32(vmlsq_n_s32(c, d, 100), e, 208));
+    uint32x4_t b = clamp(vmlaq_n_s32(c, d, 516));
+    if constexpr (Bgra) {
+        std::swap(r, b);
+    }
+    return vorrq_u32(vorrq_u32(r, vshlq_n_u32(g, 8)),
+                     vorrq_u32(vshlq_n_u32(b, 16), vdupq_n_u32(0xFF000000U)));
+}
+
+int32x4_t WidenLow(uint16x8_t value) {
+    return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(value)));
+}
+
+int32x4_t WidenHigh(uint16x8_t value) {
+    return vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(value)));
+}
+
+// Converts eight pixels at a time, returns the first pixel left for the scalar tail
+template <bool Bgra, bool Interleaved, typename Writer>
+u32 ConvertRowNeon(const RowInput& input, u32 width, const Writer& writer) {
+    u32 x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const uint16x8_t y = vmovl_u8(vld1_u8(input.luma + x));
+        uint8x8_t u;
+        uint8x8_t v;
+        if constexpr (Interleaved) {
+            const uint8x8_t uv = vld1_u8(input.chroma_u + x);
+            const uint8x8_t u_samples = vuzp1_u8(uv, uv);
+            const uint8x8_t v_samples = vuzp2_u8(uv, uv);
+            u = vzip1_u8(u_samples, u_samples);
+            v = vzip1_u8(v_samples, v_samples);
+        } else {
+            u32 u_samples;
+            u32 v_samples;
+            std::memcpy(&u_samples, input.chroma_u + x / 2, sizeof(u_samples));
+            std::memcpy(&v_samples, input.chroma_v + x / 2, sizeof(v_samples));
+            const uint8x8_t u_vector = vcreate_u8(u_samples);
+            const uint8x8_t v_vector = vcreate_u8(v_samples);
+            u = vzip1_u8(u_vector, u_vector);
+            v = vzip1_u8(v_vector, v_vector);
+        }
+        const uint16x8_t u_wide = vmovl_u8(u);
+        const uint16x8_t v_wide = vmovl_u8(v);
+        const uint32x4_t low =
+            ConvertPixelsNeon<Bgra>(WidenLow(y), WidenLow(u_wide), WidenLow(v_wide));
+        const uint32x4_t high =
+            ConvertPixelsNeon<Bgra>(WidenHigh(y), WidenHigh(u_wide), WidenHigh(v_wide));
+        vst1q_u8(writer(x), vreinterpretq_u8_u32(low));
+        vst1q_u8(writer(x + 4), vreinterpretq_u8_u32(high));
+    }
+    return x;
+}
+
+#endif
+
+template <bool Bgra, bool Interleaved, typename Writer>
+void ConvertRow(const RowInput& input, u32 width, const Writer& writer, VicKernelIsa isa) {
+    u32 converted = 0;
+    switch (isa) {
+#if defined(ARCHITECTURE_x86_64)
+    case VicKernelIsa::Avx2:
+        converted = ConvertRowAvx2<Bgra, Interleaved>(input, width, writer);
+        break;
+#elif defined(ARCHITECTURE_arm64)
+    case VicKernelIsa::Neon:
+        converted = ConvertRowNeon<Bgra, Interleaved>(input, width, writer);
+        break;
+#endif
+    default:
+        break;
+    }
+    ConvertRowScalar<Bgra, Interleaved>(input, converted, width, writer);
+}
+
+template <bool Bgra, bool Interleaved>
+void ConvertFrame(std::span<u8> surface, const YuvFrameView& frame,
+                  const RgbSurfaceLayout& layout, VicKernelIsa isa) {
+    const u32 width = layout.width;
+    const u32 block_height = layout.block_height;
+    const u32 gob_shift = GOB_SIZE_SHIFT + block_height;
+    const u32 gobs_in_x = Common::DivCeilLog2(width * 4, 6U);
+    const size_t block_size = size_t{gobs_in_x} << gob_shift;
+    const u32 block_height_mask = (1U << block_height) - 1;
+
+    for (u32 y = 0; y < layout.height; y++) {
+        const size_t chroma_offset = (y / 2) * frame.chroma_stride;
+        const RowInput input{
+            .luma = frame.luma + y * frame.luma_stride,
+            .chroma_u = frame.chroma_u + chroma_offset,
+            .chroma_v = Interleaved ? nullptr : frame.chroma_v + chroma_offset,
+        };
+        if (layout.block_linear) {
+            const u32 gob_y = y >> 3;
+            const size_t offset_y = (gob_y >> block_height) * block_size +
+                                    (size_t{gob_y & block_height_mask} << GOB_SIZE_SHIFT) +
+                                    ((y & 1) << 4) + ((y & 6) << 5);
+            const BlockLinearRow writer{surface.data() + offset_y, gob_shift};
+            ConvertRow<Bgra, Interleaved>(input, width, writer, isa);
+        } else {
+            const PitchLinearRow writer{surface.data() + size_t{y} * width * 4};
+            ConvertRow<Bgra, Interleaved>(input, width, writer, isa);
+        }
+    }
+}
+
+} // Anonymous namespace
+
+VicKernelIsa GetBestVicKernelIsa() {
+#if defined(ARCHITECTURE_x86_64)
+    static const VicKernelIsa best =
+        Common::GetCPUCaps().avx2 ? VicKernelIsa::Avx2 : VicKernelIsa::Scalar;
+    return best;
+#elif defined(ARCHITECTURE_arm64)
+    // NEON is part of the base ARMv8 instruction set
+    return VicKernelIsa::Neon;
+#else
+    return VicKernelIsa::Scalar;
+#endif
+}
+
+std::vector<VicKernelIsa> GetSupportedVicKernelIsas() {
+    std::vector<VicKernelIsa> isas{VicKernelIsa::Scalar};
+#if defined(ARCHITECTURE_x86_64)
+    if (Common::GetCPUCaps().avx2) {
+        isas.push_back(VicKernelIsa::Avx2);
+    }
+#elif defined(ARCHITECTURE_arm64)
+    isas.push_back(VicKernelIsa::Neon);
+#endif
+    return isas;
+}
+
+void ConvertYuvToRgb(std::span<u8> surface, const YuvFrameView& frame,
+                     const RgbSurfaceLayout& layout, VicRgbOrder order, VicKernelIsa isa) {
+    ASSERT(frame.luma != nullptr && frame.chroma_u != nullptr);
+    const bool interleaved = frame.chroma_v == nullptr;
+    if (order == VicRgbOrder::Bgra) {
+        if (interleaved) {
+            ConvertFrame<true, true>(surface, frame, layout, isa);
+        } else {
+            ConvertFrame<true, false>(surface, frame, layout, isa);
+        }
+    } else {
+        if (interleaved) {
+            ConvertFrame<false, true>(surface, frame, layout, isa);
+        } else {
+            ConvertFrame<false, false>(surface, frame, layout, isa);
+        }
+    }
+}
+
+} // namespace Tegra::Host1x
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Tegra::Host1x {
+
+/// Instruction sets the VIC conversion kernels can run with
+enum class VicKernelIsa {
+    Scalar,
+    Avx2,
+    Neon,
+};
+
+/// Returns the fastest instruction set supported by the host, used by default
+[[nodiscard]] VicKernelIsa GetBestVicKernelIsa();
+
+/// Returns every instruction set supported by the host, scalar first
+[[nodiscard]] std::vector<VicKernelIsa> GetSupportedVicKernelIsas();
+
+/// Byte order of an RGB output surface, alpha (or the unused X channel) is always opaque
+enum class VicRgbOrder {
+    Rgba,
+    Bgra,
+};
+
+/// A decoded 8 bit 4:2:0 frame, with either NV12 (interleaved) or YUV420P (planar) chroma
+struct YuvFrameView {
+    const u8* luma;
+    /// Interleaved U and V samples when chroma_v is null, otherwise the U samples
+    const u8* chroma_u;
+    /// V samples of planar frames, null for interleaved frames
+    const u8* chroma_v;
+    size_t luma_stride;
+    size_t chroma_stride;
+};
+
+/// Layout of the RGB surface written by ConvertYuvToRgb
+struct RgbSurfaceLayout {
+    /// Pixels written per row, also the pitch (or block linear stride) of the surface
+    u32 width;
+    /// Rows written
+    u32 height;
+    bool block_linear;
+    /// Log2 of the height of the surface's blocks in GOBs, when block linear
+    u32 block_height;
+};
+
+/**
+ * Converts a frame to RGB with BT.601 limited range coefficients, the ones swscale defaults to,
+ * and writes it to the surface. Block linear surfaces are swizzled as the pixels are converted,
+ * so every pixel is written to the surface once and nothing is staged in between.
+ * The results are the same whatever instruction set is used.
+ *
+ * @param surface - Output surface, sized for the layout like Texture::CalculateSize.
+ * @param frame   - Frame to convert, at least as large as the layout.
+ * @param layout  - Layout of the surface.
+ * @param order   - Byte order of the surface's pixels.
+ * @param isa     - Instruction set to use, must be supported by the host.
+ */
+void ConvertYuvToRgb(std::span<u8> surface, const YuvFrameView& frame,
+                     const RgbSurfaceLayout& layout, VicRgbOrder order,
+                     VicKernelIsa isa = GetBestVicKernelIsa());
+
+} // namespace Tegra::Host1x
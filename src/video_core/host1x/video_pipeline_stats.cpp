@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include "video_core/host1x/video_pipeline_stats.h"
+
+namespace Tegra::Host1x {
+
+VideoPipelineStats& VideoPipelineStats::operator+=(const VideoPipelineStats& rhs) noexcept {
+    command_lists += rhs.command_lists;
+    max_command_queue = std::max(max_command_queue, rhs.max_command_queue);
+    frames_submitted += rhs.frames_submitted;
+    parse_ns += rhs.parse_ns;
+    frames_decoded += rhs.frames_decoded;
+    hardware_frames += rhs.hardware_frames;
+    decode_ns += rhs.decode_ns;
+    dropped_frames += rhs.dropped_frames;
+    max_frame_queue = std::max(max_frame_queue, rhs.max_frame_queue);
+    frames_written += rhs.frames_written;
+    conversion_ns += rhs.conversion_ns;
+    bytes_written += rhs.bytes_written;
+    return *this;
+}
+
+void VideoPipelineStatsCollector::Report(const VideoPipelineStats& stats) {
+    std::scoped_lock lock{mutex};
+    accumulated += stats;
+}
+
+VideoPipelineStats VideoPipelineStatsCollector::GetAndReset() {
+    std::scoped_lock lock{mutex};
+    return std::exchange(accumulated, {});
+}
+
+} // namespace Tegra::Host1x
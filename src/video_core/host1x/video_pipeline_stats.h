@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <mutex>
+
+#include "common/common_types.h"
+
+namespace Tegra::Host1x {
+
+/// Work done by the Host1x video engines, summed over every client since the last reset
+struct VideoPipelineStats {
+    u64 command_lists;      ///< Command lists executed by the CDMA pushers
+    u64 max_command_queue;  ///< Most command lists waiting on a pusher's thread at once
+    u64 frames_submitted;   ///< Bitstreams composed from the NVDEC registers
+    u64 parse_ns;           ///< Time spent composing those bitstreams
+    u64 frames_decoded;     ///< Frames output by FFmpeg
+    u64 hardware_frames;    ///< Decoded frames that came from a hardware decoder
+    u64 decode_ns;          ///< Time spent in FFmpeg decoding
+    u64 dropped_frames;     ///< Decoded frames dropped because the VIC did not consume them
+    u64 max_frame_queue;    ///< Most decoded frames waiting for the VIC at once
+    u64 frames_written;     ///< Frames the VIC wrote to output surfaces
+    u64 conversion_ns;      ///< Time spent converting frames and writing them to the surfaces
+    u64 bytes_written;      ///< Bytes written to the output surfaces
+
+    VideoPipelineStats& operator+=(const VideoPipelineStats& rhs) noexcept;
+};
+
+/// Collects the statistics reported by the video engines from any of their threads
+class VideoPipelineStatsCollector {
+public:
+    /// Adds the work done by one step of the pipeline
+    void Report(const VideoPipelineStats& stats);
+
+    /// Returns the sum of the work reported since the previous call
+    [[nodiscard]] VideoPipelineStats GetAndReset();
+
+private:
+    std::mutex mutex;
+    VideoPipelineStats accumulated{};
+};
+
+} // namespace Tegra::Host1x
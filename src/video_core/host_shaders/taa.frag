@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Temporal resolve of the presented frames. The guest renders without jitter and leaves no motion
+// vectors behind, so the history is sampled in place and clipped against the neighbourhood of the
+// current frame, which removes ghosting from moving content while still averaging out the flicker
+// of dithered and aliased detail on static content.
+
+#version 460
+
+layout (location = 0) in vec2 tex_coord;
+
+layout (location = 0) out vec4 frag_color;
+
+layout (binding = 0) uniform sampler2D input_texture;
+layout (binding = 1) uniform sampler2D history_texture;
+
+// Weight of the current frame in the resolved color
+const float CURRENT_WEIGHT = 0.1;
+// Standard deviations of the neighbourhood the history may stray from the current frame
+const float CLIP_GAMMA = 1.0;
+
+vec3 RGBToYCoCg(vec3 rgb) {
+    return vec3(dot(rgb, vec3(0.25, 0.5, 0.25)),
+                dot(rgb, vec3(0.5, 0.0, -0.5)),
+                dot(rgb, vec3(-0.25, 0.5, -0.25)));
+}
+
+vec3 YCoCgToRGB(vec3 ycocg) {
+    return vec3(ycocg.x + ycocg.y - ycocg.z,
+                ycocg.x + ycocg.z,
+                ycocg.x - ycocg.y - ycocg.z);
+}
+
+void main() {
+    const vec2 texel_size = 1.0 / vec2(textureSize(input_texture, 0));
+    const vec4 current = textureLod(input_texture, tex_coord, 0.0);
+
+    vec3 moment1 = vec3(0.0);
+    vec3 moment2 = vec3(0.0);
+    for (int y = -1; y <= 1; ++y) {
+        for (int x = -1; x <= 1; ++x) {
+            const vec2 coord = tex_coord + vec2(x, y) * texel_size;
+            const vec3 color = RGBToYCoCg(textureLod(input_texture, coord, 0.0).rgb);
+            moment1 += color;
+            moment2 += color * color;
+        }
+    }
+    const vec3 mean = moment1 / 9.0;
+    const vec3 sigma = sqrt(max(moment2 / 9.0 - mean * mean, vec3(0.0)));
+
+    const vec3 history = RGBToYCoCg(textureLod(history_texture, tex_coord, 0.0).rgb);
+    const vec3 clipped = clamp(history, mean - CLIP_GAMMA * sigma, mean + CLIP_GAMMA * sigma);
+    const vec3 resolved = mix(clipped, RGBToYCoCg(current.rgb), CURRENT_WEIGHT);
+    frag_color = vec4(YCoCgToRGB(resolved), current.a);
+}
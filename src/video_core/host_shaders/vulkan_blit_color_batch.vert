@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#version 460 core
+
+struct BlitRect {
+    // Minimum and maximum corners of the destination, in normalized device coordinates
+    vec4 dst;
+    // Texel coordinates sampled at the minimum and maximum destination corners
+    vec4 src;
+};
+
+layout(binding = 1, std430) readonly buffer BlitRects {
+    BlitRect rects[];
+};
+
+layout(location = 0) out vec2 texcoord;
+
+void main() {
+    // Each instance draws one blit as two triangles, wound like the full screen triangle
+    vec2 corner = vec2((0x1A >> gl_VertexIndex) & 1, (0x34 >> gl_VertexIndex) & 1);
+    BlitRect rect = rects[gl_InstanceIndex];
+    gl_Position = vec4(mix(rect.dst.xy, rect.dst.zw, corner), 0.0, 1.0);
+    texcoord = mix(rect.src.xy, rect.src.zw, corner);
+}
@@ -1,10 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <optional>
 #include <span>
+#include <utility>
 
 #include "common/container_hash.h"
 
@@ -14,6 +16,7 @@
 #include "common/fs/path_util.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
+#include "video_core/engines/draw_manager.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/macro/macro.h"
 #include "video_core/macro/macro_hle.h"
@@ -21,6 +24,8 @@
 
 #ifdef ARCHITECTURE_x86_64
 #include "video_core/macro/macro_jit_x64.h"
+#elif defined(ARCHITECTURE_arm64)
+#include "video_core/macro/macro_jit_arm64.h"
 #endif
 
 MICROPROFILE_DEFINE(MacroHLE, "GPU", "Execute macro HLE", MP_RGB(128, 192, 192));
@@ -55,9 +60,18 @@ static void Dump(u64 hash, std::span<const u32> code, bool decompiled = false) {
 }
 
 MacroEngine::MacroEngine(Engines::Maxwell3D& maxwell3d_)
-    : hle_macros{std::make_unique<Tegra::HLEMacro>(maxwell3d_)}, maxwell3d{maxwell3d_} {}
+    : hle_macros{std::make_unique<Tegra::HLEMacro>(maxwell3d_)}, maxwell3d{maxwell3d_},
+      profile_macros{Settings::values.profile_macros.GetValue()} {
+    if (profile_macros) {
+        program_id = maxwell3d.GetProgramID();
+    }
+}
 
-MacroEngine::~MacroEngine() = default;
+MacroEngine::~MacroEngine() {
+    if (profile_macros) {
+        DumpProfile();
+    }
+}
 
 void MacroEngine::AddCode(u32 method, u32 data) {
     uploaded_macro_code[method].push_back(data);
@@ -71,14 +85,7 @@ void MacroEngine::ClearCode(u32 method) {
 void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
     auto compiled_macro = macro_cache.find(method);
     if (compiled_macro != macro_cache.end()) {
-        const auto& cache_info = compiled_macro->second;
-        if (cache_info.has_hle_program) {
-            MICROPROFILE_SCOPE(MacroHLE);
-            cache_info.hle_program->Execute(parameters, method);
-        } else {
-            maxwell3d.RefreshParameters();
-            cache_info.lle_program->Execute(parameters, method);
-        }
+        ExecuteProgram(compiled_macro->second, method, parameters);
     } else {
         // Macro not compiled, check if it's uploaded and if so, compile it
         std::optional<u32> mid_method;
@@ -112,15 +119,11 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
         }
 
         auto hle_program = hle_macros->GetHLEProgram(cache_info.hash);
-        if (!hle_program || Settings::values.disable_macro_hle) {
-            maxwell3d.RefreshParameters();
-            cache_info.lle_program->Execute(parameters, method);
-        } else {
+        if (hle_program && !Settings::values.disable_macro_hle) {
             cache_info.has_hle_program = true;
             cache_info.hle_program = std::move(hle_program);
-            MICROPROFILE_SCOPE(MacroHLE);
-            cache_info.hle_program->Execute(parameters, method);
         }
+        ExecuteProgram(cache_info, method, parameters);
 
         if (Settings::values.dump_macros) {
             Dump(cache_info.hash, macro_code->second, cache_info.has_hle_program);
@@ -128,12 +131,91 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
     }
 }
 
+void MacroEngine::ExecuteProgram(const CacheInfo& cache_info, u32 method,
+                                 const std::vector<u32>& parameters) {
+    const auto run = [&] {
+        if (cache_info.has_hle_program) {
+            MICROPROFILE_SCOPE(MacroHLE);
+            // HLE macros write registers directly, so their draws can't be held back
+            maxwell3d.draw_manager->SetBatching(false);
+            cache_info.hle_program->Execute(parameters, method);
+            maxwell3d.draw_manager->SetBatching(true);
+        } else {
+            maxwell3d.RefreshParameters();
+            cache_info.lle_program->Execute(parameters, method);
+        }
+    };
+    if (!profile_macros) [[likely]] {
+        run();
+        return;
+    }
+
+    const u64 method_calls_before = maxwell3d.GetMethodCallCount();
+    const auto start_time = std::chrono::steady_clock::now();
+    run();
+    const auto end_time = std::chrono::steady_clock::now();
+
+    auto& entry = macro_profile[cache_info.hash];
+    ++entry.executions;
+    entry.method_calls += maxwell3d.GetMethodCallCount() - method_calls_before;
+    entry.time += end_time - start_time;
+    entry.is_hle = cache_info.has_hle_program;
+
+    // Macros past this many executions are worth a hand-written HLE implementation
+    static constexpr u64 HotMacroThreshold = 10000;
+    if (!entry.is_hle && !entry.warned && entry.executions >= HotMacroThreshold) {
+        entry.warned = true;
+        LOG_WARNING(HW_GPU, "Hot macro 0x{:016x} has no HLE implementation ({} executions, {} us)",
+                    cache_info.hash, entry.executions,
+                    std::chrono::duration_cast<std::chrono::microseconds>(entry.time).count());
+    }
+}
+
+void MacroEngine::DumpProfile() const {
+    if (macro_profile.empty()) {
+        return;
+    }
+    const auto base_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::DumpDir)};
+    const auto profile_dir{base_dir / "macro_profiles"};
+    if (!Common::FS::CreateDir(base_dir) || !Common::FS::CreateDir(profile_dir)) {
+        LOG_ERROR(Common_Filesystem, "Failed to create macro profile directories");
+        return;
+    }
+    const auto name{profile_dir / fmt::format("{:016X}.csv", program_id)};
+    const bool write_header = !Common::FS::Exists(name);
+
+    // Every channel appends its own rows, so entries of the same hash are meant to be summed
+    std::fstream profile_file(name, std::ios::out | std::ios::app);
+    if (!profile_file) {
+        LOG_ERROR(Common_Filesystem, "Unable to open or create file at {}",
+                  Common::FS::PathToUTF8String(name));
+        return;
+    }
+
+    std::vector<std::pair<u64, ProfileEntry>> entries(macro_profile.begin(), macro_profile.end());
+    std::ranges::sort(entries, [](const auto& lhs, const auto& rhs) {
+        return lhs.second.time > rhs.second.time;
+    });
+
+    if (write_header) {
+        profile_file << "hash,executions,method_calls,total_ns,average_ns,hle\n";
+    }
+    for (const auto& [hash, entry] : entries) {
+        const u64 total_ns = static_cast<u64>(entry.time.count());
+        profile_file << fmt::format("{:016x},{},{},{},{},{}\n", hash, entry.executions,
+                                    entry.method_calls, total_ns, total_ns / entry.executions,
+                                    entry.is_hle ? 1 : 0);
+    }
+}
+
 std::unique_ptr<MacroEngine> GetMacroEngine(Engines::Maxwell3D& maxwell3d) {
     if (Settings::values.disable_macro_jit) {
         return std::make_unique<MacroInterpreter>(maxwell3d);
     }
 #ifdef ARCHITECTURE_x86_64
     return std::make_unique<MacroJITx64>(maxwell3d);
+#elif defined(ARCHITECTURE_arm64)
+    return std::make_unique<MacroJITArm64>(maxwell3d);
 #else
     return std::make_unique<MacroInterpreter>(maxwell3d);
 #endif
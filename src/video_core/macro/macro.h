@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -134,10 +135,29 @@ private:
         bool has_hle_program{};
     };
 
+    /// Execution statistics of a single macro, keyed by its hash
+    struct ProfileEntry {
+        u64 executions{};
+        u64 method_calls{};
+        std::chrono::nanoseconds time{};
+        bool is_hle{};
+        bool warned{};
+    };
+
+    // Runs the cached program, recording its statistics when macro profiling is enabled
+    void ExecuteProgram(const CacheInfo& cache_info, u32 method, const std::vector<u32>& parameters);
+
+    // Writes the recorded macro statistics to the dump directory
+    void DumpProfile() const;
+
     std::unordered_map<u32, CacheInfo> macro_cache;
     std::unordered_map<u32, std::vector<u32>> uploaded_macro_code;
     std::unique_ptr<HLEMacro> hle_macros;
     Engines::Maxwell3D& maxwell3d;
+
+    bool profile_macros{};
+    u64 program_id{};
+    std::unordered_map<u64, ProfileEntry> macro_profile;
 };
 
 std::unique_ptr<MacroEngine> GetMacroEngine(Engines::Maxwell3D& maxwell3d);
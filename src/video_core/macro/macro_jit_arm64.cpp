@@ -0,0 +1,517 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <oaknut/code_block.hpp>
+#include <oaknut/oaknut.hpp>
+
+#include "common/assert.h"
+#include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/macro/macro_jit_arm64.h"
+
+MICROPROFILE_DEFINE(MacroJitCompile, "GPU", "Compile macro JIT", MP_RGB(173, 255, 47));
+MICROPROFILE_DEFINE(MacroJitExecute, "GPU", "Execute macro JIT", MP_RGB(255, 255, 0));
+
+namespace Tegra {
+namespace {
+using namespace oaknut::util;
+
+// Macro registers 1-7 live in callee-saved registers so they survive calls into Maxwell3D.
+// Register 0 is hardwired to zero and maps to WZR.
+constexpr int MACRO_REGISTER_BASE = 19;
+constexpr oaknut::WReg METHOD_ADDRESS = W26;
+constexpr oaknut::XReg PARAMETERS = X27;
+constexpr oaknut::XReg MAX_PARAMETER = X28;
+
+// Caller-saved scratch registers
+constexpr oaknut::WReg RESULT = W9;
+constexpr oaknut::XReg RESULT_64 = X9;
+constexpr oaknut::WReg PARAMETER = W8;
+constexpr oaknut::WReg SCRATCH0 = W10;
+constexpr oaknut::XReg SCRATCH0_64 = X10;
+constexpr oaknut::WReg SCRATCH1 = W11;
+constexpr oaknut::XReg SCRATCH1_64 = X11;
+constexpr oaknut::XReg CALL_TARGET = X16;
+
+// Stack frame layout: x29/x30, x19-x28 and the carry flag.
+constexpr int FRAME_SIZE = 112;
+constexpr int CARRY_FLAG_OFFSET = 96;
+
+// Upper bound of host code emitted per macro instruction, including an inlined delay slot.
+constexpr size_t MAX_BYTES_PER_INSTRUCTION = 512;
+constexpr size_t MIN_CODE_SIZE = 0x1000;
+
+class MacroJITArm64Impl final : public CachedMacro {
+public:
+    explicit MacroJITArm64Impl(Engines::Maxwell3D& maxwell3d_, const std::vector<u32>& code_)
+        : code_block{MIN_CODE_SIZE + code_.size() * MAX_BYTES_PER_INSTRUCTION},
+          c{code_block.ptr()}, labels(code_.size()), code{code_}, maxwell3d{maxwell3d_} {
+        Compile();
+    }
+
+    void Execute(const std::vector<u32>& parameters, u32 method) override;
+
+private:
+    void Compile_Instruction(Macro::Opcode opcode, bool is_delay_slot);
+    void Compile_DelaySlot();
+
+    void Compile_ALU(Macro::Opcode opcode);
+    void Compile_AddImmediate(Macro::Opcode opcode);
+    void Compile_ExtractInsert(Macro::Opcode opcode);
+    void Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode);
+    void Compile_ExtractShiftLeftRegister(Macro::Opcode opcode);
+    void Compile_Read(Macro::Opcode opcode);
+    void Compile_Branch(Macro::Opcode opcode);
+
+    void Optimizer_ScanFlags();
+
+    void Compile();
+
+    oaknut::WReg Compile_FetchParameter();
+    oaknut::WReg GetRegister(u32 index) const;
+    void Compile_AddImmediateTo(oaknut::WReg dst, u32 src_index, s32 immediate);
+    void Compile_StoreCarry();
+    void Compile_LoadCarry();
+
+    void Compile_ProcessResult(Macro::ResultOperation operation, u32 reg);
+    void Compile_Send(oaknut::WReg value);
+
+    using ProgramType = void (*)(const u32*, const u32*);
+
+    struct OptimizerState {
+        bool can_skip_carry{};
+        bool skip_dummy_addimmediate{};
+    };
+    OptimizerState optimizer{};
+
+    oaknut::CodeBlock code_block;
+    oaknut::CodeGenerator c;
+    ProgramType program{nullptr};
+
+    std::vector<oaknut::Label> labels;
+    oaknut::Label end_of_code{};
+
+    u32 pc{};
+
+    const std::vector<u32>& code;
+    Engines::Maxwell3D& maxwell3d;
+};
+
+void MacroJITArm64Impl::Execute(const std::vector<u32>& parameters, u32 method) {
+    MICROPROFILE_SCOPE(MacroJitExecute);
+    ASSERT_OR_EXECUTE(program != nullptr, { return; });
+    program(parameters.data(), parameters.data() + parameters.size());
+}
+
+oaknut::WReg MacroJITArm64Impl::GetRegister(u32 index) const {
+    if (index == 0) {
+        // Register 0 is always zero
+        return WZR;
+    }
+    return oaknut::WReg{MACRO_REGISTER_BASE + static_cast<int>(index) - 1};
+}
+
+void MacroJITArm64Impl::Compile_AddImmediateTo(oaknut::WReg dst, u32 src_index, s32 immediate) {
+    if (src_index == 0) {
+        // Immediate forms treat register 31 as the stack pointer, materialize the value instead
+        c.MOV(dst, static_cast<u32>(immediate));
+        return;
+    }
+    const oaknut::WReg src = GetRegister(src_index);
+    if (immediate == 0) {
+        c.MOV(dst, src);
+    } else if (immediate > 0 && immediate < 0x1000) {
+        c.ADD(dst, src, static_cast<u32>(immediate));
+    } else if (immediate < 0 && immediate > -0x1000) {
+        c.SUB(dst, src, static_cast<u32>(-immediate));
+    } else {
+        c.MOV(SCRATCH1, static_cast<u32>(immediate));
+        c.ADD(dst, src, SCRATCH1);
+    }
+}
+
+void MacroJITArm64Impl::Compile_StoreCarry() {
+    c.CSET(SCRATCH0, oaknut::Cond::CS);
+    c.STR(SCRATCH0, SP, CARRY_FLAG_OFFSET);
+}
+
+void MacroJITArm64Impl::Compile_LoadCarry() {
+    // Set the host carry flag from the stored value, C = (carry >= 1)
+    c.LDR(SCRATCH0, SP, CARRY_FLAG_OFFSET);
+    c.CMP(SCRATCH0, 1);
+}
+
+void MacroJITArm64Impl::Compile_ALU(Macro::Opcode opcode) {
+    const oaknut::WReg src_a = GetRegister(opcode.src_a);
+    const oaknut::WReg src_b = GetRegister(opcode.src_b);
+
+    // The host carry flag has the same meaning as the macro carry flag, including the inverted
+    // borrow of subtractions, so the flag setting forms can be used directly.
+    switch (opcode.alu_operation) {
+    case Macro::ALUOperation::Add:
+        c.ADDS(RESULT, src_a, src_b);
+        if (!optimizer.can_skip_carry) {
+            Compile_StoreCarry();
+        }
+        break;
+    case Macro::ALUOperation::AddWithCarry:
+        Compile_LoadCarry();
+        c.ADCS(RESULT, src_a, src_b);
+        Compile_StoreCarry();
+        break;
+    case Macro::ALUOperation::Subtract:
+        c.SUBS(RESULT, src_a, src_b);
+        if (!optimizer.can_skip_carry) {
+            Compile_StoreCarry();
+        }
+        break;
+    case Macro::ALUOperation::SubtractWithBorrow:
+        Compile_LoadCarry();
+        c.SBCS(RESULT, src_a, src_b);
+        Compile_StoreCarry();
+        break;
+    case Macro::ALUOperation::Xor:
+        c.EOR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Or:
+        c.ORR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::And:
+        c.AND(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::AndNot:
+        c.BIC(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Nand:
+        c.AND(RESULT, src_a, src_b);
+        c.MVN(RESULT, RESULT);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented ALU operation {}", opcode.alu_operation.Value());
+        c.MOV(RESULT, src_a);
+        break;
+    }
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_AddImmediate(Macro::Opcode opcode) {
+    if (optimizer.skip_dummy_addimmediate) {
+        // Games tend to use this as an exit instruction placeholder. It's to encode an instruction
+        // without doing anything. In our case we can just not emit anything.
+        if (opcode.result_operation == Macro::ResultOperation::Move && opcode.dst == 0) {
+            return;
+        }
+    }
+    Compile_AddImmediateTo(RESULT, opcode.src_a, opcode.immediate);
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractInsert(Macro::Opcode opcode) {
+    const oaknut::WReg dst = GetRegister(opcode.src_a);
+    const oaknut::WReg src = GetRegister(opcode.src_b);
+    const u32 mask = opcode.GetBitfieldMask();
+
+    c.LSR(SCRATCH0, src, opcode.bf_src_bit.Value());
+    c.MOV(SCRATCH1, mask);
+    c.AND(SCRATCH0, SCRATCH0, SCRATCH1);
+    c.LSL(SCRATCH0, SCRATCH0, opcode.bf_dst_bit.Value());
+    c.MOV(SCRATCH1, ~(mask << opcode.bf_dst_bit.Value()));
+    c.AND(RESULT, dst, SCRATCH1);
+    c.ORR(RESULT, RESULT, SCRATCH0);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode) {
+    const oaknut::WReg dst = GetRegister(opcode.src_a);
+    const oaknut::WReg src = GetRegister(opcode.src_b);
+
+    c.LSRV(RESULT, src, dst);
+    c.MOV(SCRATCH1, opcode.GetBitfieldMask());
+    c.AND(RESULT, RESULT, SCRATCH1);
+    c.LSL(RESULT, RESULT, opcode.bf_dst_bit.Value());
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractShiftLeftRegister(Macro::Opcode opcode) {
+    const oaknut::WReg dst = GetRegister(opcode.src_a);
+    const oaknut::WReg src = GetRegister(opcode.src_b);
+
+    c.LSR(RESULT, src, opcode.bf_src_bit.Value());
+    c.MOV(SCRATCH1, opcode.GetBitfieldMask());
+    c.AND(RESULT, RESULT, SCRATCH1);
+    c.LSLV(RESULT, RESULT, dst);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_Read(Macro::Opcode opcode) {
+    Compile_AddImmediateTo(RESULT, opcode.src_a, opcode.immediate);
+
+    // Equivalent to Engines::Maxwell3D::GetRegisterValue:
+    c.UBFIZ(SCRATCH0_64, RESULT_64, 2, 32);
+    c.MOV(SCRATCH1_64, reinterpret_cast<u64>(maxwell3d.regs.reg_array.data()));
+    c.ADD(SCRATCH0_64, SCRATCH1_64, SCRATCH0_64);
+    c.LDR(RESULT, SCRATCH0_64, 0);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void Send(Engines::Maxwell3D* maxwell3d, Macro::MethodAddress method_address, u32 value) {
+    maxwell3d->CallMethod(method_address.address, value, true);
+}
+
+void MacroJITArm64Impl::Compile_Send(oaknut::WReg value) {
+    c.MOV(W2, value);
+    c.MOV(W1, METHOD_ADDRESS);
+    c.MOV(X0, reinterpret_cast<u64>(&maxwell3d));
+    c.MOV(CALL_TARGET, reinterpret_cast<u64>(&Send));
+    c.BLR(CALL_TARGET);
+
+    // Increment the method address by the method increment, keeping the rest of the bits intact
+    c.UBFX(SCRATCH0, METHOD_ADDRESS, 12, 6);
+    c.ADD(SCRATCH0, METHOD_ADDRESS, SCRATCH0);
+    c.BFI(METHOD_ADDRESS, SCRATCH0, 0, 12);
+}
+
+void MacroJITArm64Impl::Compile_Branch(Macro::Opcode opcode) {
+    const s64 jump_address =
+        static_cast<s64>(pc) + static_cast<s64>(opcode.GetBranchTarget() / sizeof(s32));
+    const bool is_target_valid = jump_address >= 0 && jump_address < static_cast<s64>(code.size());
+    ASSERT_MSG(is_target_valid, "Macro branch target 0x{:x} is out of bounds", jump_address);
+    oaknut::Label& target = is_target_valid ? labels[jump_address] : end_of_code;
+
+    const oaknut::WReg value = GetRegister(opcode.src_a);
+    if (opcode.branch_annul) {
+        switch (opcode.branch_condition) {
+        case Macro::BranchCondition::Zero:
+            c.CBZ(value, target);
+            break;
+        case Macro::BranchCondition::NotZero:
+            c.CBNZ(value, target);
+            break;
+        }
+        return;
+    }
+
+    // Taken branches execute the delay slot before jumping, emit a copy of it on that path.
+    // When the branch is not taken the delay slot runs as the next instruction.
+    oaknut::Label not_taken;
+    switch (opcode.branch_condition) {
+    case Macro::BranchCondition::Zero:
+        c.CBNZ(value, not_taken);
+        break;
+    case Macro::BranchCondition::NotZero:
+        c.CBZ(value, not_taken);
+        break;
+    }
+    Compile_DelaySlot();
+    c.B(target);
+    c.l(not_taken);
+}
+
+void MacroJITArm64Impl::Compile_DelaySlot() {
+    if (pc + 1 >= code.size()) {
+        return;
+    }
+    const u32 branch_pc = pc;
+    pc = branch_pc + 1;
+    Compile_Instruction({code[pc]}, true);
+    pc = branch_pc;
+}
+
+void MacroJITArm64Impl::Optimizer_ScanFlags() {
+    optimizer.can_skip_carry = true;
+    for (auto raw_op : code) {
+        Macro::Opcode op{};
+        op.raw = raw_op;
+
+        if (op.operation == Macro::Operation::ALU) {
+            // Scan for any ALU operations which actually use the carry flag, if they don't exist in
+            // our current code we can skip emitting the carry flag handling operations
+            if (op.alu_operation == Macro::ALUOperation::AddWithCarry ||
+                op.alu_operation == Macro::ALUOperation::SubtractWithBorrow) {
+                optimizer.can_skip_carry = false;
+            }
+        }
+    }
+}
+
+void MacroJITArm64Impl::Compile() {
+    MICROPROFILE_SCOPE(MacroJitCompile);
+    code_block.unprotect();
+
+    c.STP(X29, X30, SP, PRE_INDEXED, -FRAME_SIZE);
+    c.STP(X19, X20, SP, 16);
+    c.STP(X21, X22, SP, 32);
+    c.STP(X23, X24, SP, 48);
+    c.STP(X25, X26, SP, 64);
+    c.STP(X27, X28, SP, 80);
+    c.STR(WZR, SP, CARRY_FLAG_OFFSET);
+
+    c.MOV(PARAMETERS, X0);
+    c.MOV(MAX_PARAMETER, X1);
+    c.MOV(METHOD_ADDRESS, WZR);
+    for (u32 index = 2; index < Macro::NUM_MACRO_REGISTERS; ++index) {
+        c.MOV(GetRegister(index), WZR);
+    }
+    c.MOV(GetRegister(1), Compile_FetchParameter());
+
+    // AddImmediate tends to be used as a NOP instruction, if we detect this we can
+    // completely skip the entire code path and no emit anything
+    optimizer.skip_dummy_addimmediate = true;
+
+    // Check to see if we can skip emitting certain instructions
+    Optimizer_ScanFlags();
+
+    const u32 op_count = static_cast<u32>(code.size());
+    for (pc = 0; pc < op_count; ++pc) {
+        c.l(labels[pc]);
+        Compile_Instruction({code[pc]}, false);
+    }
+
+    c.l(end_of_code);
+
+    c.LDP(X27, X28, SP, 80);
+    c.LDP(X25, X26, SP, 64);
+    c.LDP(X23, X24, SP, 48);
+    c.LDP(X21, X22, SP, 32);
+    c.LDP(X19, X20, SP, 16);
+    c.LDP(X29, X30, SP, POST_INDEXED, FRAME_SIZE);
+    c.RET();
+
+    code_block.protect();
+    code_block.invalidate_all();
+    program = reinterpret_cast<ProgramType>(code_block.ptr());
+}
+
+void MacroJITArm64Impl::Compile_Instruction(Macro::Opcode opcode, bool is_delay_slot) {
+    switch (opcode.operation) {
+    case Macro::Operation::ALU:
+        Compile_ALU(opcode);
+        break;
+    case Macro::Operation::AddImmediate:
+        Compile_AddImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractInsert:
+        Compile_ExtractInsert(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftImmediate:
+        Compile_ExtractShiftLeftImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftRegister:
+        Compile_ExtractShiftLeftRegister(opcode);
+        break;
+    case Macro::Operation::Read:
+        Compile_Read(opcode);
+        break;
+    case Macro::Operation::Branch:
+        if (is_delay_slot) {
+            ASSERT_MSG(false, "Executing a branch in a delay slot is not valid");
+            break;
+        }
+        Compile_Branch(opcode);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented opcode {}", opcode.operation.Value());
+        break;
+    }
+
+    // An instruction with the Exit flag will not actually cause an exit if it's executed inside a
+    // delay slot. Otherwise the next instruction is executed as its delay slot before exiting.
+    if (opcode.is_exit && !is_delay_slot) {
+        Compile_DelaySlot();
+        c.B(end_of_code);
+    }
+}
+
+static void WarnInvalidParameter(uintptr_t parameter, uintptr_t max_parameter) {
+    LOG_CRITICAL(HW_GPU,
+                 "Macro JIT: invalid parameter access 0x{:x} (0x{:x} is the last parameter)",
+                 parameter, max_parameter - sizeof(u32));
+}
+
+oaknut::WReg MacroJITArm64Impl::Compile_FetchParameter() {
+    oaknut::Label parameter_ok;
+    c.CMP(PARAMETERS, MAX_PARAMETER);
+    c.B(oaknut::Cond::LO, parameter_ok);
+    // RESULT is the only live caller-saved register at this point
+    c.STR(RESULT_64, SP, PRE_INDEXED, -16);
+    c.MOV(X0, PARAMETERS);
+    c.MOV(X1, MAX_PARAMETER);
+    c.MOV(CALL_TARGET, reinterpret_cast<u64>(&WarnInvalidParameter));
+    c.BLR(CALL_TARGET);
+    c.LDR(RESULT_64, SP, POST_INDEXED, 16);
+    c.l(parameter_ok);
+    c.LDR(PARAMETER, PARAMETERS, POST_INDEXED, static_cast<int>(sizeof(u32)));
+    return PARAMETER;
+}
+
+void MacroJITArm64Impl::Compile_ProcessResult(Macro::ResultOperation operation, u32 reg) {
+    const auto SetRegister = [this](u32 reg_index, oaknut::WReg result) {
+        // Register 0 is supposed to always return 0. NOP is implemented as a store to the zero
+        // register.
+        if (reg_index == 0) {
+            return;
+        }
+        c.MOV(GetRegister(reg_index), result);
+    };
+    const auto SetMethodAddress = [this](oaknut::WReg reg32) { c.MOV(METHOD_ADDRESS, reg32); };
+
+    switch (operation) {
+    case Macro::ResultOperation::IgnoreAndFetch:
+        SetRegister(reg, Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::Move:
+        SetRegister(reg, RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethod:
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSend:
+        // Fetch parameter and send result.
+        SetRegister(reg, Compile_FetchParameter());
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSend:
+        // Move and send result.
+        SetRegister(reg, RESULT);
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSetMethod:
+        // Fetch parameter and use result as Method Address.
+        SetRegister(reg, Compile_FetchParameter());
+        SetMethodAddress(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodFetchAndSend:
+        // Move result and use as Method Address, then fetch and send parameter.
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        Compile_Send(Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodSend:
+        // Move result and use as Method Address, then send bits 12:17 of result.
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        c.UBFX(RESULT, RESULT, 12, 6);
+        Compile_Send(RESULT);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented macro operation {}", operation);
+        break;
+    }
+}
+} // Anonymous namespace
+
+MacroJITArm64::MacroJITArm64(Engines::Maxwell3D& maxwell3d_)
+    : MacroEngine{maxwell3d_}, maxwell3d{maxwell3d_} {}
+
+std::unique_ptr<CachedMacro> MacroJITArm64::Compile(const std::vector<u32>& code) {
+    return std::make_unique<MacroJITArm64Impl>(maxwell3d, code);
+}
+} // namespace Tegra
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "video_core/memory_budget.h"
+
+namespace VideoCore {
+namespace {
+// Ages past this are all equally stale, it also keeps the weights from overflowing
+constexpr u64 MAX_LRU_AGE = 1024;
+} // Anonymous namespace
+
+void MemoryBudget::Report(MemoryBudgetClient client, u64 resident_bytes, u64 lru_age) noexcept {
+    ClientState& state = clients[static_cast<size_t>(client)];
+    state.resident_bytes.store(resident_bytes, std::memory_order::relaxed);
+    state.lru_age.store(std::min(lru_age, MAX_LRU_AGE), std::memory_order::relaxed);
+}
+
+u64 MemoryBudget::ResidentBytes(MemoryBudgetClient client) const noexcept {
+    return clients[static_cast<size_t>(client)].resident_bytes.load(std::memory_order::relaxed);
+}
+
+u64 MemoryBudget::TotalResidentBytes() const noexcept {
+    u64 total = 0;
+    for (const ClientState& state : clients) {
+        total += state.resident_bytes.load(std::memory_order::relaxed);
+    }
+    return total;
+}
+
+u64 MemoryBudget::EvictionShare(MemoryBudgetClient client) const noexcept {
+    const u64 target_bytes = Target();
+    const u64 total = TotalResidentBytes();
+    if (target_bytes == 0 || total <= target_bytes) {
+        return 0;
+    }
+    const auto weight = [](const ClientState& state) {
+        const u64 resident = state.resident_bytes.load(std::memory_order::relaxed);
+        return resident * (state.lru_age.load(std::memory_order::relaxed) + 1);
+    };
+    u64 total_weight = 0;
+    for (const ClientState& state : clients) {
+        total_weight += weight(state);
+    }
+    const ClientState& state = clients[static_cast<size_t>(client)];
+    const u64 client_weight = weight(state);
+    if (client_weight == 0) {
+        return 0;
+    }
+    const double ratio = static_cast<double>(client_weight) / static_cast<double>(total_weight);
+    const u64 share = static_cast<u64>(static_cast<double>(total - target_bytes) * ratio);
+    return std::min(share, state.resident_bytes.load(std::memory_order::relaxed));
+}
+
+} // namespace VideoCore
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include "common/common_types.h"
+
+namespace VideoCore {
+
+/// Caches sharing the device memory budget
+enum class MemoryBudgetClient : u32 {
+    TextureCache,
+    BufferCache,
+    StagingBuffers,
+    MaxValue,
+};
+
+/**
+ * Device memory target shared by the caches.
+ *
+ * Every frame each cache reports the bytes it keeps resident and how many frames ago its least
+ * recently used entry was last used. When the sum goes over the target, the excess is split
+ * between the caches by their resident bytes weighted by that age, so the cache holding the
+ * stalest memory gives back the most instead of every cache only looking at its own usage.
+ */
+class MemoryBudget {
+public:
+    /// Sets the combined footprint the caches should converge on, zero disables the budget
+    void SetTarget(u64 bytes) noexcept {
+        target.store(bytes, std::memory_order::relaxed);
+    }
+
+    /// Returns the combined footprint the caches should converge on in bytes
+    [[nodiscard]] u64 Target() const noexcept {
+        return target.load(std::memory_order::relaxed);
+    }
+
+    /// Records the footprint of a cache, lru_age is the number of frames since its least
+    /// recently used entry was used
+    void Report(MemoryBudgetClient client, u64 resident_bytes, u64 lru_age) noexcept;
+
+    /// Returns the bytes resident in a cache as of its last report
+    [[nodiscard]] u64 ResidentBytes(MemoryBudgetClient client) const noexcept;
+
+    /// Returns the bytes resident in all caches
+    [[nodiscard]] u64 TotalResidentBytes() const noexcept;
+
+    /// Returns the bytes a cache should evict to move the combined footprint to the target
+    [[nodiscard]] u64 EvictionShare(MemoryBudgetClient client) const noexcept;
+
+private:
+    static constexpr size_t NUM_CLIENTS = static_cast<size_t>(MemoryBudgetClient::MaxValue);
+
+    struct ClientState {
+        std::atomic<u64> resident_bytes{};
+        std::atomic<u64> lru_age{};
+    };
+
+    std::atomic<u64> target{};
+    std::array<ClientState, NUM_CLIENTS> clients{};
+};
+
+} // namespace VideoCore
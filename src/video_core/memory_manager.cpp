@@ -9,6 +9,7 @@
 #include "core/core.h"
 #include "core/hle/kernel/k_page_table.h"
 #include "core/hle/kernel/k_process.h"
+#include "video_core/gpu_capture.h"
 #include "video_core/guest_memory.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/invalidation_accumulator.h"
@@ -115,20 +116,25 @@ GPUVAddr MemoryManager::PageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr de
     }
     for (u64 offset{}; offset < size; offset += page_size) {
         const GPUVAddr current_gpu_addr = gpu_addr + offset;
-        [[maybe_unused]] const auto current_entry_type = GetEntry<false>(current_gpu_addr);
+        const auto current_entry_type = GetEntry<false>(current_gpu_addr);
         SetEntry<false>(current_gpu_addr, entry_type);
-        if (current_entry_type != entry_type) {
-            rasterizer->ModifyGPUMemory(unique_identifier, current_gpu_addr, page_size);
-        }
+        bool is_modified = current_entry_type != entry_type;
         if constexpr (entry_type == EntryType::Mapped) {
             const DAddr current_dev_addr = dev_addr + offset;
             const auto index = PageEntryIndex<false>(current_gpu_addr);
             const u32 sub_value = static_cast<u32>(current_dev_addr >> cpu_page_bits);
+            // Remapping a mapped page to other memory invalidates what was cached from it too
+            is_modified |=
+                current_entry_type == EntryType::Mapped && page_table[index] != sub_value;
             page_table[index] = sub_value;
         }
+        if (is_modified) {
+            MarkModified(current_gpu_addr, page_size);
+        }
         remaining_size -= page_size;
     }
     kind_map.Map(gpu_addr, gpu_addr + size, kind);
+    FlushModified();
     return gpu_addr;
 }
 
@@ -138,15 +144,15 @@ GPUVAddr MemoryManager::BigPageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr
     [[maybe_unused]] u64 remaining_size{size};
     for (u64 offset{}; offset < size; offset += big_page_size) {
         const GPUVAddr current_gpu_addr = gpu_addr + offset;
-        [[maybe_unused]] const auto current_entry_type = GetEntry<true>(current_gpu_addr);
+        const auto current_entry_type = GetEntry<true>(current_gpu_addr);
         SetEntry<true>(current_gpu_addr, entry_type);
-        if (current_entry_type != entry_type) {
-            rasterizer->ModifyGPUMemory(unique_identifier, current_gpu_addr, big_page_size);
-        }
+        bool is_modified = current_entry_type != entry_type;
         if constexpr (entry_type == EntryType::Mapped) {
             const DAddr current_dev_addr = dev_addr + offset;
             const auto index = PageEntryIndex<true>(current_gpu_addr);
             const u32 sub_value = static_cast<u32>(current_dev_addr >> cpu_page_bits);
+            is_modified |=
+                current_entry_type == EntryType::Mapped && big_page_table_dev[index] != sub_value;
             big_page_table_dev[index] = sub_value;
             const bool is_continuous = ([&] {
                 uintptr_t base_ptr{
@@ -166,21 +172,57 @@ GPUVAddr MemoryManager::BigPageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr
             })();
             SetBigPageContinuous(index, is_continuous);
         }
+        if (is_modified) {
+            MarkModified(current_gpu_addr, big_page_size);
+        }
         remaining_size -= big_page_size;
     }
     {
         std::unique_lock<std::mutex> lock(guard);
         kind_map.Map(gpu_addr, gpu_addr + size, kind);
     }
+    FlushModified();
     return gpu_addr;
 }
 
+void MemoryManager::MarkModified(GPUVAddr gpu_addr, u64 size) {
+    if (!modified_ranges.empty()) {
+        auto& [last_addr, last_size] = modified_ranges.back();
+        if (last_addr + last_size == gpu_addr) {
+            last_size += size;
+            return;
+        }
+    }
+    modified_ranges.emplace_back(gpu_addr, size);
+}
+
+void MemoryManager::FlushModified() {
+    if (is_batching || modified_ranges.empty()) {
+        return;
+    }
+    rasterizer->ModifyGPUMemoryBatch(unique_identifier, modified_ranges);
+    modified_ranges.clear();
+}
+
 void MemoryManager::BindRasterizer(VideoCore::RasterizerInterface* rasterizer_) {
     rasterizer = rasterizer_;
 }
 
+void MemoryManager::BindCapture(VideoCommon::GpuCaptureWriter* capture_) {
+    capture = capture_;
+}
+
+void MemoryManager::RecordRead(DAddr dev_addr, std::size_t size) const {
+    if (capture) [[unlikely]] {
+        capture->RecordRead(dev_addr, size);
+    }
+}
+
 GPUVAddr MemoryManager::Map(GPUVAddr gpu_addr, DAddr dev_addr, std::size_t size, PTEKind kind,
                             bool is_big_pages) {
+    if (capture) [[unlikely]] {
+        capture->RecordMap(*this, gpu_addr, dev_addr, size, kind, is_big_pages, false);
+    }
     if (is_big_pages) [[likely]] {
         return BigPageTableOp<EntryType::Mapped>(gpu_addr, dev_addr, size, kind);
     }
@@ -188,16 +230,35 @@ GPUVAddr MemoryManager::Map(GPUVAddr gpu_addr, DAddr dev_addr, std::size_t size,
 }
 
 GPUVAddr MemoryManager::MapSparse(GPUVAddr gpu_addr, std::size_t size, bool is_big_pages) {
+    if (capture) [[unlikely]] {
+        capture->RecordMap(*this, gpu_addr, 0, size, PTEKind::INVALID, is_big_pages, true);
+    }
     if (is_big_pages) [[likely]] {
         return BigPageTableOp<EntryType::Reserved>(gpu_addr, 0, size, PTEKind::INVALID);
     }
     return PageTableOp<EntryType::Reserved>(gpu_addr, 0, size, PTEKind::INVALID);
 }
 
+void MemoryManager::MapBatch(std::span<const BatchMapEntry> batch) {
+    is_batching = true;
+    for (const BatchMapEntry& entry : batch) {
+        if (entry.is_sparse) {
+            MapSparse(entry.gpu_addr, entry.size, entry.is_big_pages);
+        } else {
+            Map(entry.gpu_addr, entry.dev_addr, entry.size, entry.kind, entry.is_big_pages);
+        }
+    }
+    is_batching = false;
+    FlushModified();
+}
+
 void MemoryManager::Unmap(GPUVAddr gpu_addr, std::size_t size) {
     if (size == 0) {
         return;
     }
+    if (capture) [[unlikely]] {
+        capture->RecordUnmap(*this, gpu_addr, size);
+    }
     GetSubmappedRangeImpl<false>(gpu_addr, size, page_stash);
 
     for (const auto& [map_addr, map_size] : page_stash) {
@@ -243,6 +304,11 @@ std::optional<DAddr> MemoryManager::GpuToCpuAddress(GPUVAddr addr, std::size_t s
 
 template <typename T>
 T MemoryManager::Read(GPUVAddr addr) const {
+    if (capture) [[unlikely]] {
+        if (const auto dev_addr = GpuToCpuAddress(addr)) {
+            RecordRead(*dev_addr, sizeof(T));
+        }
+    }
     if (auto page_pointer{GetPointer(addr)}; page_pointer) {
         // NOTE: Avoid adding any extra logic to this fast-path block
         T value;
@@ -379,6 +445,7 @@ void MemoryManager::ReadBlockImpl(GPUVAddr gpu_src_addr, void* dest_buffer, std:
         if constexpr (is_safe) {
             rasterizer->FlushRegion(dev_addr_base, copy_amount, which);
         }
+        RecordRead(dev_addr_base, copy_amount);
         u8* physical = memory.GetPointer<u8>(dev_addr_base);
         std::memcpy(dest_buffer, physical, copy_amount);
         dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
@@ -389,6 +456,7 @@ void MemoryManager::ReadBlockImpl(GPUVAddr gpu_src_addr, void* dest_buffer, std:
         if constexpr (is_safe) {
             rasterizer->FlushRegion(dev_addr_base, copy_amount, which);
         }
+        RecordRead(dev_addr_base, copy_amount);
         if (!IsBigPageContinuous(page_index)) [[unlikely]] {
             memory.ReadBlockUnsafe(dev_addr_base, dest_buffer, copy_amount);
         } else {
@@ -768,6 +836,7 @@ const u8* MemoryManager::GetSpan(const GPUVAddr src_addr, const std::size_t size
     }
     auto dev_addr = GpuToCpuAddress(src_addr);
     if (dev_addr) {
+        RecordRead(*dev_addr, size);
         return memory.GetSpan(*dev_addr, size);
     }
     return nullptr;
@@ -779,6 +848,7 @@ u8* MemoryManager::GetSpan(const GPUVAddr src_addr, const std::size_t size) {
     }
     auto dev_addr = GpuToCpuAddress(src_addr);
     if (dev_addr) {
+        RecordRead(*dev_addr, size);
         return memory.GetSpan(*dev_addr, size);
     }
     return nullptr;
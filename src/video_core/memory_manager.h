@@ -7,6 +7,8 @@
 #include <map>
 #include <mutex>
 #include <optional>
+#include <span>
+#include <utility>
 #include <vector>
 #include <boost/container/small_vector.hpp>
 
@@ -24,8 +26,9 @@ class RasterizerInterface;
 }
 
 namespace VideoCommon {
+class GpuCaptureWriter;
 class InvalidationAccumulator;
-}
+} // namespace VideoCommon
 
 namespace Core {
 class System;
@@ -47,9 +50,28 @@ public:
         return unique_identifier;
     }
 
+    u64 GetAddressSpaceBits() const {
+        return address_space_bits;
+    }
+
+    GPUVAddr GetSplitAddress() const {
+        return split_address;
+    }
+
+    u64 GetBigPageBits() const {
+        return big_page_bits;
+    }
+
+    u64 GetPageBits() const {
+        return page_bits;
+    }
+
     /// Binds a renderer to the memory manager.
     void BindRasterizer(VideoCore::RasterizerInterface* rasterizer);
 
+    /// Records the mappings made and the memory read through this memory manager into a capture
+    void BindCapture(VideoCommon::GpuCaptureWriter* capture);
+
     [[nodiscard]] std::optional<DAddr> GpuToCpuAddress(GPUVAddr addr) const;
 
     [[nodiscard]] std::optional<DAddr> GpuToCpuAddress(GPUVAddr addr, std::size_t size) const;
@@ -132,6 +154,20 @@ public:
     GPUVAddr MapSparse(GPUVAddr gpu_addr, std::size_t size, bool is_big_pages = true);
     void Unmap(GPUVAddr gpu_addr, std::size_t size);
 
+    /// A mapping applied by MapBatch
+    struct BatchMapEntry {
+        GPUVAddr gpu_addr;
+        DAddr dev_addr; ///< Ignored by sparse entries
+        std::size_t size;
+        PTEKind kind;
+        bool is_big_pages;
+        bool is_sparse;
+    };
+
+    /// Applies every mapping in order and notifies the rasterizer of the modified ranges once
+    /// they have all been applied, adjacent ranges merged
+    void MapBatch(std::span<const BatchMapEntry> batch);
+
     void FlushRegion(GPUVAddr gpu_addr, size_t size,
                      VideoCommon::CacheType which = VideoCommon::CacheType::All) const;
 
@@ -207,6 +243,19 @@ private:
     u64 big_page_table_mask;
 
     VideoCore::RasterizerInterface* rasterizer = nullptr;
+    VideoCommon::GpuCaptureWriter* capture = nullptr;
+
+    /// Records a read of device memory into the capture, if there is one
+    void RecordRead(DAddr dev_addr, std::size_t size) const;
+
+    /// Adds a range whose entry type changed to the ranges notified to the rasterizer
+    void MarkModified(GPUVAddr gpu_addr, u64 size);
+
+    /// Notifies the rasterizer of the modified ranges, unless a batch is being applied
+    void FlushModified();
+
+    std::vector<std::pair<GPUVAddr, u64>> modified_ranges;
+    bool is_batching{};
 
     enum class EntryType : u64 {
         Free = 0,
@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+
+#include "video_core/memory_stats.h"
+
+namespace VideoCore {
+
+double MemoryStats::GetAndResetEvictionRate() {
+    std::scoped_lock lock{rate_mutex};
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> interval = now - rate_reset_time;
+    rate_reset_time = now;
+    const u64 bytes = evicted_bytes.exchange(0, std::memory_order::relaxed);
+    if (interval.count() <= 0.0) {
+        return 0.0;
+    }
+    return static_cast<double>(bytes) / interval.count();
+}
+
+void MemoryStats::ReportBufferCacheStats(const BufferCacheStats& frame) {
+    std::scoped_lock lock{buffer_stats_mutex};
+    buffer_stats += frame;
+}
+
+BufferCacheStats MemoryStats::GetAndResetBufferCacheStats() {
+    std::scoped_lock lock{buffer_stats_mutex};
+    return std::exchange(buffer_stats, {});
+}
+
+} // namespace VideoCore
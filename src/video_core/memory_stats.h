@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include "common/common_types.h"
+
+namespace VideoCore {
+
+/// Buffer cache joins and downloads, counted from one frame tick to the next
+struct BufferCacheStats {
+    u64 frames;           ///< Number of frames counted
+    u64 joins;            ///< Overlapping buffers copied into a larger buffer
+    u64 bytes_copied;     ///< Bytes copied by joins
+    u64 grows;            ///< Buffers extended in place instead of being joined
+    u64 downloads;        ///< Copies recorded to download GPU modified ranges
+    u64 downloads_merged; ///< Download ranges folded into a neighbouring copy
+    u64 bytes_downloaded; ///< Bytes copied into download staging buffers
+
+    BufferCacheStats& operator+=(const BufferCacheStats& rhs) noexcept {
+        frames += rhs.frames;
+        joins += rhs.joins;
+        bytes_copied += rhs.bytes_copied;
+        grows += rhs.grows;
+        downloads += rhs.downloads;
+        downloads_merged += rhs.downloads_merged;
+        bytes_downloaded += rhs.bytes_downloaded;
+        return *this;
+    }
+};
+
+/// Device memory figures reported by the caches, read by the frontends' performance displays
+class MemoryStats {
+public:
+    /// Returns the device memory budget of the caches in bytes
+    [[nodiscard]] u64 Budget() const noexcept {
+        return budget.load(std::memory_order::relaxed);
+    }
+
+    /// Returns the device memory in use in bytes
+    [[nodiscard]] u64 Usage() const noexcept {
+        return usage.load(std::memory_order::relaxed);
+    }
+
+    void UpdateBudget(u64 budget_, u64 usage_) noexcept {
+        budget.store(budget_, std::memory_order::relaxed);
+        usage.store(usage_, std::memory_order::relaxed);
+    }
+
+    void MarkEviction(u64 bytes) noexcept {
+        evicted_bytes.fetch_add(bytes, std::memory_order::relaxed);
+    }
+
+    /// Returns the bytes evicted per second since the previous call
+    [[nodiscard]] double GetAndResetEvictionRate();
+
+    /// Records the buffer cache statistics of a finished frame
+    void ReportBufferCacheStats(const BufferCacheStats& frame);
+
+    /// Returns the sum of the buffer cache statistics reported since the previous call
+    [[nodiscard]] BufferCacheStats GetAndResetBufferCacheStats();
+
+private:
+    std::atomic<u64> budget{};
+    std::atomic<u64> usage{};
+    std::atomic<u64> evicted_bytes{};
+
+    std::mutex rate_mutex;
+    std::chrono::steady_clock::time_point rate_reset_time = std::chrono::steady_clock::now();
+
+    std::mutex buffer_stats_mutex;
+    BufferCacheStats buffer_stats{};
+};
+
+} // namespace VideoCore
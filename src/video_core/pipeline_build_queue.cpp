@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "common/assert.h"
+#include "common/task_pool.h"
+#include "video_core/pipeline_build_queue.h"
+
+namespace VideoCore {
+namespace {
+/// Coverage given to every draw, so draws with an empty or unknown area still gain from requests
+constexpr f64 MIN_COVERAGE = 0.25;
+/// Waiting time that doubles the score of a build
+constexpr f64 AGE_DOUBLING_MS = 100.0;
+} // Anonymous namespace
+
+PipelineBuildQueue::PipelineBuildQueue(Common::TaskGroup& workers_)
+    : workers{workers_}, state{std::make_shared<State>()} {}
+
+PipelineBuildQueue::~PipelineBuildQueue() {
+    std::unordered_map<const void*, PendingBuild> dropped;
+    std::scoped_lock lock{state->mutex};
+    dropped.swap(state->pending);
+}
+
+void PipelineBuildQueue::QueueBuild(const void* id, Common::UniqueFunction<void> build) {
+    {
+        std::scoped_lock lock{state->mutex};
+        PendingBuild entry{
+            .build = std::move(build),
+            .queue_time = std::chrono::steady_clock::now(),
+        };
+        const bool is_new = state->pending.try_emplace(id, std::move(entry)).second;
+        ASSERT_MSG(is_new, "Pipeline build queued twice");
+    }
+    workers.QueueWork([shared = state] { RunNext(*shared); });
+}
+
+void PipelineBuildQueue::Request(const void* id, f32 coverage) {
+    std::scoped_lock lock{state->mutex};
+    const auto it = state->pending.find(id);
+    if (it == state->pending.end()) {
+        return;
+    }
+    ++it->second.requests;
+    it->second.coverage = std::max(it->second.coverage, std::clamp(coverage, 0.0f, 1.0f));
+}
+
+size_t PipelineBuildQueue::PendingBuilds() const {
+    std::scoped_lock lock{state->mutex};
+    return state->pending.size();
+}
+
+void PipelineBuildQueue::RunNext(State& state) {
+    Common::UniqueFunction<void> build;
+    {
+        std::scoped_lock lock{state.mutex};
+        auto& pending = state.pending;
+        if (pending.empty()) {
+            // Dropped by the destructor of the queue
+            return;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        const auto priority = [now](const PendingBuild& entry) {
+            const f64 age_ms =
+                std::chrono::duration<f64, std::milli>(now - entry.queue_time).count();
+            const f64 score = static_cast<f64>(entry.requests + 1) *
+                              (MIN_COVERAGE + static_cast<f64>(entry.coverage)) *
+                              (1.0 + age_ms / AGE_DOUBLING_MS);
+            // The first request comes from the draw that created the pipeline
+            return std::pair{entry.requests > 1, score};
+        };
+        auto best = pending.begin();
+        auto best_priority = priority(best->second);
+        for (auto it = std::next(best); it != pending.end(); ++it) {
+            const auto it_priority = priority(it->second);
+            if (it_priority > best_priority) {
+                best = it;
+                best_priority = it_priority;
+            }
+        }
+        build = std::move(best->second.build);
+        pending.erase(best);
+    }
+    build();
+}
+
+} // namespace VideoCore
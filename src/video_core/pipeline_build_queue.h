@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/common_types.h"
+#include "common/unique_function.h"
+
+namespace Common {
+class TaskGroup;
+}
+
+namespace VideoCore {
+
+/**
+ * Runs the pipeline builds queued to a task group in order of how much they are needed, instead
+ * of the order they were queued in.
+ *
+ * Builds are scored by the number of times their pipeline was requested while queued, the
+ * fraction of the render area covered by the draws requesting it and the time they have been
+ * waiting, so builds that keep losing to others still run eventually. A pipeline requested again
+ * while its build is queued is known to be wanted by the game right now, its build is promoted
+ * ahead of the builds that were only requested once.
+ */
+class PipelineBuildQueue {
+public:
+    explicit PipelineBuildQueue(Common::TaskGroup& workers_);
+
+    /// Drops the builds that have not started
+    ~PipelineBuildQueue();
+
+    PipelineBuildQueue(const PipelineBuildQueue&) = delete;
+    PipelineBuildQueue& operator=(const PipelineBuildQueue&) = delete;
+
+    /// Queues the build of a pipeline, id identifies the pipeline until its build starts
+    void QueueBuild(const void* id, Common::UniqueFunction<void> build);
+
+    /// Records a request of a pipeline by a draw covering a fraction of the render area, does
+    /// nothing when the build of the pipeline has already started
+    void Request(const void* id, f32 coverage);
+
+    /// Returns the number of builds that have not started
+    [[nodiscard]] size_t PendingBuilds() const;
+
+private:
+    struct PendingBuild {
+        Common::UniqueFunction<void> build;
+        std::chrono::steady_clock::time_point queue_time;
+        u32 requests{};
+        f32 coverage{};
+    };
+
+    /// Builds waiting for a worker, shared with the tasks queued to the workers
+    struct State {
+        std::mutex mutex;
+        std::unordered_map<const void*, PendingBuild> pending;
+    };
+
+    /// Takes the build with the highest priority and runs it, queued to the workers once per build
+    static void RunNext(State& state);
+
+    Common::TaskGroup& workers;
+    std::shared_ptr<State> state;
+};
+
+} // namespace VideoCore
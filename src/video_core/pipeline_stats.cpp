@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <fstream>
+#include <tuple>
+#include <utility>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "video_core/pipeline_stats.h"
+
+namespace VideoCore {
+
+void PipelineStats::ReportTranslation(u64 hash, bool is_compute, std::chrono::microseconds time) {
+    std::scoped_lock lock{mutex};
+    Entry(hash, is_compute).translate_time_us = static_cast<u64>(time.count());
+}
+
+void PipelineStats::ReportCompilation(u64 hash, bool is_compute, std::chrono::microseconds time,
+                                      std::vector<PipelineExecutableStats> executables) {
+    std::scoped_lock lock{mutex};
+    PipelineStatsEntry& entry{Entry(hash, is_compute)};
+    entry.compile_time_us = static_cast<u64>(time.count());
+    entry.executables = std::move(executables);
+}
+
+void PipelineStats::MarkUse(u64 hash) {
+    std::scoped_lock lock{mutex};
+    ++frame_uses[hash];
+}
+
+void PipelineStats::TickFrame() {
+    std::scoped_lock lock{mutex};
+    ++frame;
+    for (const u64 hash : last_frame_pipelines) {
+        pipelines[hash].frame_uses = 0;
+    }
+    last_frame_pipelines.clear();
+    for (const auto& [hash, uses] : frame_uses) {
+        const auto it{pipelines.find(hash)};
+        if (it == pipelines.end()) {
+            // Not reported yet, the driver might still be building it
+            continue;
+        }
+        it->second.frame_uses = uses;
+        it->second.total_uses += uses;
+        last_frame_pipelines.push_back(hash);
+    }
+    frame_uses.clear();
+}
+
+bool PipelineStats::IsEmpty() const {
+    std::scoped_lock lock{mutex};
+    return pipelines.empty();
+}
+
+std::vector<PipelineStatsEntry> PipelineStats::Snapshot(bool last_frame_only) const {
+    std::vector<PipelineStatsEntry> result;
+    {
+        std::scoped_lock lock{mutex};
+        if (last_frame_only) {
+            result.reserve(last_frame_pipelines.size());
+            for (const u64 hash : last_frame_pipelines) {
+                result.push_back(pipelines.at(hash));
+            }
+        } else {
+            result.reserve(pipelines.size());
+            for (const auto& [hash, entry] : pipelines) {
+                result.push_back(entry);
+            }
+        }
+    }
+    std::ranges::sort(result, [](const PipelineStatsEntry& lhs, const PipelineStatsEntry& rhs) {
+        return std::tie(lhs.frame_uses, lhs.total_uses) > std::tie(rhs.frame_uses, rhs.total_uses);
+    });
+    return result;
+}
+
+std::string PipelineStats::ToJson() const {
+    const std::vector<PipelineStatsEntry> entries{Snapshot(false)};
+    nlohmann::json pipelines_json = nlohmann::json::array();
+    for (const PipelineStatsEntry& entry : entries) {
+        nlohmann::json executables_json = nlohmann::json::array();
+        for (const PipelineExecutableStats& executable : entry.executables) {
+            executables_json.push_back({
+                {"name", executable.name},
+                {"code_size", executable.code_size},
+                {"register_count", executable.register_count},
+                {"sgpr_count", executable.sgpr_count},
+                {"vgpr_count", executable.vgpr_count},
+                {"spill_count", executable.spill_count},
+                {"scratch_size", executable.scratch_size},
+                {"branches_count", executable.branches_count},
+                {"basic_block_count", executable.basic_block_count},
+            });
+        }
+        pipelines_json.push_back({
+            {"hash", fmt::format("{:016x}", entry.hash)},
+            {"type", entry.is_compute ? "compute" : "graphics"},
+            {"translate_time_us", entry.translate_time_us},
+            {"compile_time_us", entry.compile_time_us},
+            {"frame_uses", entry.frame_uses},
+            {"total_uses", entry.total_uses},
+            {"executables", std::move(executables_json)},
+        });
+    }
+    u64 current_frame;
+    {
+        std::scoped_lock lock{mutex};
+        current_frame = frame;
+    }
+    const nlohmann::json json{
+        {"frame", current_frame},
+        {"pipelines", std::move(pipelines_json)},
+    };
+    return json.dump(4);
+}
+
+bool PipelineStats::DumpJson(const std::filesystem::path& path) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        LOG_ERROR(Render, "Failed to open {} to dump pipeline statistics",
+                  Common::FS::PathToUTF8String(path));
+        return false;
+    }
+    file << ToJson() << std::endl;
+    return file.good();
+}
+
+PipelineStatsEntry& PipelineStats::Entry(u64 hash, bool is_compute) {
+    const auto [it, is_new] = pipelines.try_emplace(hash);
+    if (is_new) {
+        it->second.hash = hash;
+        it->second.is_compute = is_compute;
+    }
+    return it->second;
+}
+
+} // namespace VideoCore
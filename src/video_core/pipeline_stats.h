@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace VideoCore {
+
+/// Compiler statistics of one executable of a pipeline, usually a shader stage, from the driver
+struct PipelineExecutableStats {
+    std::string name;
+    u64 code_size{};
+    u64 register_count{};
+    u64 sgpr_count{};
+    u64 vgpr_count{};
+    u64 spill_count{};  ///< Registers spilled to memory
+    u64 scratch_size{}; ///< Scratch memory per invocation in bytes
+    u64 branches_count{};
+    u64 basic_block_count{};
+};
+
+/// Statistics of a pipeline built by the renderer
+struct PipelineStatsEntry {
+    u64 hash{}; ///< Hash of the pipeline cache key
+    bool is_compute{};
+    u64 translate_time_us{}; ///< Time spent recompiling the guest shaders
+    u64 compile_time_us{};   ///< Time the driver spent building the pipeline
+    u64 frame_uses{};        ///< Draws or dispatches in the last finished frame
+    u64 total_uses{};        ///< Draws or dispatches since the pipeline was built
+    std::vector<PipelineExecutableStats> executables;
+};
+
+/// Per pipeline compiler statistics and usage, read by the frontends to find expensive shaders.
+/// Only filled by renderers that can query shader statistics from the driver.
+class PipelineStats {
+public:
+    /// Records how long the guest shaders of a pipeline took to recompile, thread safe
+    void ReportTranslation(u64 hash, bool is_compute, std::chrono::microseconds time);
+
+    /// Records the driver statistics of a newly built pipeline, thread safe
+    void ReportCompilation(u64 hash, bool is_compute, std::chrono::microseconds time,
+                           std::vector<PipelineExecutableStats> executables);
+
+    /// Counts a draw or dispatch using a pipeline
+    void MarkUse(u64 hash);
+
+    /// Finishes the frame the uses are counted for
+    void TickFrame();
+
+    /// Returns true when no pipeline has been reported
+    [[nodiscard]] bool IsEmpty() const;
+
+    /// Returns the pipelines sorted by their uses in the last frame, then by their total uses
+    /// @param last_frame_only Only return the pipelines used in the last frame
+    [[nodiscard]] std::vector<PipelineStatsEntry> Snapshot(bool last_frame_only) const;
+
+    /// Returns every pipeline as a JSON document
+    [[nodiscard]] std::string ToJson() const;
+
+    /// Writes every pipeline as JSON to a file
+    /// @returns True on success
+    bool DumpJson(const std::filesystem::path& path) const;
+
+private:
+    PipelineStatsEntry& Entry(u64 hash, bool is_compute);
+
+    mutable std::mutex mutex;
+    std::unordered_map<u64, PipelineStatsEntry> pipelines;
+    std::unordered_map<u64, u64> frame_uses;
+    std::vector<u64> last_frame_pipelines;
+    u64 frame{};
+};
+
+} // namespace VideoCore
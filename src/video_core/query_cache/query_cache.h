@@ -417,6 +417,16 @@ bool QueryCacheBase<Traits>::AccelerateHostConditionalRendering() {
         };
     };
 
+    // Predicted mode treats conditional rendering on unresolved queries as passing, the CPU
+    // fallback would otherwise stall the GPU thread reading the report back.
+    const auto resolve = [this, &qc_dirty](bool accelerated) {
+        if (accelerated || !qc_dirty || !Settings::values.use_predicted_queries.GetValue()) {
+            return accelerated;
+        }
+        impl->runtime.EndHostConditionalRendering();
+        return true;
+    };
+
     auto& regs = maxwell3d->regs;
     if (regs.render_enable_override != Maxwell::Regs::RenderEnable::Override::UseRenderEnable) {
         impl->runtime.EndHostConditionalRendering();
@@ -433,19 +443,19 @@ bool QueryCacheBase<Traits>::AccelerateHostConditionalRendering() {
         return false;
     case ComparisonMode::Conditional: {
         VideoCommon::LookupData object_1{gen_lookup(address)};
-        return impl->runtime.HostConditionalRenderingCompareValue(object_1, qc_dirty);
+        return resolve(impl->runtime.HostConditionalRenderingCompareValue(object_1, qc_dirty));
     }
     case ComparisonMode::IfEqual: {
         VideoCommon::LookupData object_1{gen_lookup(address)};
         VideoCommon::LookupData object_2{gen_lookup(address + 16)};
-        return impl->runtime.HostConditionalRenderingCompareValues(object_1, object_2, qc_dirty,
-                                                                   true);
+        return resolve(impl->runtime.HostConditionalRenderingCompareValues(object_1, object_2,
+                                                                           qc_dirty, true));
     }
     case ComparisonMode::IfNotEqual: {
         VideoCommon::LookupData object_1{gen_lookup(address)};
         VideoCommon::LookupData object_2{gen_lookup(address + 16)};
-        return impl->runtime.HostConditionalRenderingCompareValues(object_1, object_2, qc_dirty,
-                                                                   false);
+        return resolve(impl->runtime.HostConditionalRenderingCompareValues(object_1, object_2,
+                                                                           qc_dirty, false));
     }
     default:
         return false;
@@ -13,6 +13,7 @@
 #include "common/assert.h"
 #include "common/bit_field.h"
 #include "common/common_types.h"
+#include "common/settings.h"
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/query_cache/query_base.h"
@@ -65,7 +66,9 @@ public:
             result |= SemiFlushQueryDirty(location);
             return result;
         });
-        if (result) {
+        if (result && !Settings::values.use_predicted_queries.GetValue()) {
+            // When predicting, the guest keeps reading the last value written at the address
+            // until the fence operation lands the real result.
             RequestGuestHostSync();
         }
     }
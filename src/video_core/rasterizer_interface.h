@@ -25,6 +25,10 @@ struct ChannelState;
 }
 } // namespace Tegra
 
+namespace VideoCommon {
+class GpuCaptureWriter;
+}
+
 namespace VideoCore {
 
 enum class LoadCallbackStage {
@@ -44,6 +48,9 @@ public:
     /// Dispatches an indirect draw invocation
     virtual void DrawIndirect() {}
 
+    /// Dispatches the draws gathered in the DrawManager batch sharing the current state
+    virtual void DrawBatch(bool is_indexed) {}
+
     /// Dispatches an draw texture invocation
     virtual void DrawTexture() = 0;
 
@@ -119,6 +126,14 @@ public:
     /// Remap GPU memory range. This means underneath backing memory changed
     virtual void ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) = 0;
 
+    /// Remap a set of GPU memory ranges, by default one range at a time
+    virtual void ModifyGPUMemoryBatch(size_t as_id,
+                                      std::span<const std::pair<GPUVAddr, u64>> ranges) {
+        for (const auto& [addr, size] : ranges) {
+            ModifyGPUMemory(as_id, addr, size);
+        }
+    }
+
     /// Notify rasterizer that any caches of the specified region should be flushed to Switch memory
     /// and invalidated
     virtual void FlushAndInvalidateRegion(
@@ -159,12 +174,20 @@ public:
     virtual void LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                                    const DiskResourceLoadCallback& callback) {}
 
+    /// Builds every pipeline of the disk cache into the driver pipeline cache and saves it, so the
+    /// game starts with a warm cache on this host. Backends without a driver cache do nothing.
+    virtual void PrecompileDiskResources(u64 title_id, std::stop_token stop_loading,
+                                         const DiskResourceLoadCallback& callback) {}
+
     virtual void InitializeChannel(Tegra::Control::ChannelState& channel) {}
 
     virtual void BindChannel(Tegra::Control::ChannelState& channel) {}
 
     virtual void ReleaseChannel(s32 channel_id) {}
 
+    /// Records the guest memory the caches read outside of the memory managers into a capture
+    virtual void BindCapture(VideoCommon::GpuCaptureWriter* capture) {}
+
     /// Register the address as a Transform Feedback Object
     virtual void RegisterTransformFeedback(GPUVAddr tfb_object_addr) {}
 
@@ -172,5 +195,10 @@ public:
     virtual bool HasDrawTransformFeedback() {
         return false;
     }
+
+    /// Returns true when the rasterizer can dispatch batched draws through DrawBatch
+    virtual bool HasDrawBatch() {
+        return false;
+    }
 };
 } // namespace VideoCore
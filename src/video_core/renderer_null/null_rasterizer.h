@@ -29,6 +29,9 @@ public:
                        const Tegra::DMA::ImageOperand& dst) override {
         return false;
     }
+    bool BufferLayoutCopy(const Tegra::DMA::LayoutCopy& copy) override {
+        return false;
+    }
 };
 
 class RasterizerNull final : public VideoCore::RasterizerInterface,
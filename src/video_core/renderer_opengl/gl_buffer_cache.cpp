@@ -4,11 +4,16 @@
 #include <algorithm>
 #include <span>
 
+#include "common/div_ceil.h"
 #include "shader_recompiler/backend/glasm/emit_glasm.h"
 #include "video_core/buffer_cache/buffer_cache.h"
+#include "video_core/host_shaders/dma_layout_copy_comp.h"
 #include "video_core/renderer_opengl/gl_buffer_cache.h"
 #include "video_core/renderer_opengl/gl_device.h"
+#include "video_core/renderer_opengl/gl_shader_manager.h"
+#include "video_core/renderer_opengl/gl_shader_util.h"
 #include "video_core/renderer_opengl/maxwell_to_gl.h"
+#include "video_core/texture_cache/accelerated_swizzle.h"
 
 namespace OpenGL {
 namespace {
@@ -49,7 +54,8 @@ constexpr std::array PROGRAM_LUT{
 Buffer::Buffer(BufferCacheRuntime&, VideoCommon::NullBufferParams null_params)
     : VideoCommon::BufferBase(null_params) {}
 
-Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_)
+Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_,
+               const VideoCommon::BufferCreateHints&)
     : VideoCommon::BufferBase(cpu_addr_, size_bytes_) {
     buffer.Create();
     if (runtime.device.HasDebuggingToolAttached()) {
@@ -57,7 +63,7 @@ Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_)
         glObjectLabel(GL_BUFFER, buffer.handle, static_cast<GLsizei>(name.size()), name.data());
     }
     glNamedBufferData(buffer.handle, SizeBytes(), nullptr, GL_DYNAMIC_DRAW);
-    if (runtime.has_unified_vertex_buffers) {
+    if (runtime.has_unified_vertex_buffers || runtime.has_unified_uniform_buffers) {
         glGetNamedBufferParameterui64vNV(buffer.handle, GL_BUFFER_GPU_ADDRESS_NV, &address);
     }
 }
@@ -106,21 +112,32 @@ GLuint Buffer::View(u32 offset, u32 size, PixelFormat format) {
     return views.back().texture.handle;
 }
 
-BufferCacheRuntime::BufferCacheRuntime(const Device& device_,
+BufferCacheRuntime::BufferCacheRuntime(const Device& device_, ProgramManager& program_manager_,
                                        StagingBufferPool& staging_buffer_pool_)
-    : device{device_}, staging_buffer_pool{staging_buffer_pool_},
+    : device{device_}, program_manager{program_manager_},
+      staging_buffer_pool{staging_buffer_pool_},
+      dma_layout_copy_program{CreateProgram(HostShaders::DMA_LAYOUT_COPY_COMP, GL_COMPUTE_SHADER)},
       has_fast_buffer_sub_data{device.HasFastBufferSubData()},
       use_assembly_shaders{device.UseAssemblyShaders()},
       has_unified_vertex_buffers{device.HasVertexBufferUnifiedMemory()},
-      stream_buffer{has_fast_buffer_sub_data ? std::nullopt : std::make_optional<StreamBuffer>()} {
+      has_unified_uniform_buffers{device.HasUniformBufferUnifiedMemory()},
+      stream_buffer{has_fast_buffer_sub_data
+                        ? std::nullopt
+                        : std::make_optional<StreamBuffer>(has_unified_uniform_buffers)} {
     GLint gl_max_attributes;
     glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &gl_max_attributes);
     max_attributes = static_cast<u32>(gl_max_attributes);
-    for (auto& stage_uniforms : fast_uniforms) {
-        for (OGLBuffer& buffer : stage_uniforms) {
+    for (size_t stage = 0; stage < VideoCommon::NUM_STAGES; ++stage) {
+        for (size_t index = 0; index < VideoCommon::NUM_GRAPHICS_UNIFORM_BUFFERS; ++index) {
+            OGLBuffer& buffer = fast_uniforms[stage][index];
             buffer.Create();
             glNamedBufferData(buffer.handle, VideoCommon::DEFAULT_SKIP_CACHE_SIZE, nullptr,
                               GL_STREAM_DRAW);
+            if (has_unified_uniform_buffers) {
+                glMakeNamedBufferResidentNV(buffer.handle, GL_READ_ONLY);
+                glGetNamedBufferParameterui64vNV(buffer.handle, GL_BUFFER_GPU_ADDRESS_NV,
+                                                 &fast_uniform_addresses[stage][index]);
+            }
         }
     }
     if (use_assembly_shaders) {
@@ -212,6 +229,39 @@ void BufferCacheRuntime::ClearBuffer(Buffer& dest_buffer, u32 offset, size_t siz
                               static_cast<GLsizeiptr>(size), GL_RED, GL_UNSIGNED_INT, &value);
 }
 
+void BufferCacheRuntime::LayoutCopy(Buffer& dest_buffer, u32 dest_offset, Buffer& src_buffer,
+                                    u32 src_offset, const Tegra::DMA::LayoutCopy& copy) {
+    static constexpr GLuint BINDING_INPUT_BUFFER = 0;
+    static constexpr GLuint BINDING_OUTPUT_BUFFER = 1;
+    static constexpr GLuint LOC_SRC_LAYOUT = 0;
+    static constexpr GLuint LOC_DST_LAYOUT = 1;
+    static constexpr GLuint LOC_ORIGINS = 2;
+    static constexpr GLuint LOC_EXTENT = 3;
+
+    // Bind from aligned offsets, the shader adds what is left over
+    const u32 alignment = static_cast<u32>(device.GetShaderStorageBufferAlignment());
+    const u32 src_base_offset = src_offset % alignment;
+    const u32 dest_base_offset = dest_offset % alignment;
+    const auto params =
+        VideoCommon::Accelerated::MakeDmaLayoutCopyParams(copy, src_base_offset, dest_base_offset);
+
+    program_manager.BindComputeProgram(dma_layout_copy_program.handle);
+    glUniform4uiv(LOC_SRC_LAYOUT, 1, params.src_layout.data());
+    glUniform4uiv(LOC_DST_LAYOUT, 1, params.dst_layout.data());
+    glUniform4uiv(LOC_ORIGINS, 1, params.origins.data());
+    glUniform2uiv(LOC_EXTENT, 1, params.extent.data());
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, BINDING_INPUT_BUFFER, src_buffer.Handle(),
+                      static_cast<GLintptr>(src_offset - src_base_offset),
+                      static_cast<GLsizeiptr>(copy.src.size + src_base_offset));
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, BINDING_OUTPUT_BUFFER, dest_buffer.Handle(),
+                      static_cast<GLintptr>(dest_offset - dest_base_offset),
+                      static_cast<GLsizeiptr>(copy.dst.size + dest_base_offset));
+    glDispatchCompute(Common::DivCeil(params.extent[0], 32U),
+                      Common::DivCeil(params.extent[1], 8U), 1);
+    glMemoryBarrier(GL_ALL_BARRIER_BITS);
+    program_manager.RestoreGuestCompute();
+}
+
 void BufferCacheRuntime::BindIndexBuffer(Buffer& buffer, u32 offset, u32 size) {
     if (has_unified_vertex_buffers) {
         buffer.MakeResident(GL_READ_ONLY);
@@ -280,6 +330,11 @@ void BufferCacheRuntime::BindUniformBuffer(size_t stage, u32 binding_index, Buff
         }
         glBindBufferRangeNV(PABO_LUT[stage], binding_index, handle, 0,
                             static_cast<GLsizeiptr>(size));
+    } else if (has_unified_uniform_buffers) {
+        const GLuint base_binding = graphics_base_uniform_bindings[stage];
+        buffer.MakeResident(GL_READ_ONLY);
+        glBufferAddressRangeNV(GL_UNIFORM_BUFFER_ADDRESS_NV, base_binding + binding_index,
+                               buffer.HostGpuAddr() + offset, static_cast<GLsizeiptr>(size));
     } else {
         const GLuint base_binding = graphics_base_uniform_bindings[stage];
         const GLuint binding = base_binding + binding_index;
@@ -300,6 +355,10 @@ void BufferCacheRuntime::BindComputeUniformBuffer(u32 binding_index, Buffer& buf
         }
         glBindBufferRangeNV(GL_COMPUTE_PROGRAM_PARAMETER_BUFFER_NV, binding_index, handle, 0,
                             static_cast<GLsizeiptr>(size));
+    } else if (has_unified_uniform_buffers) {
+        buffer.MakeResident(GL_READ_ONLY);
+        glBufferAddressRangeNV(GL_UNIFORM_BUFFER_ADDRESS_NV, binding_index,
+                               buffer.HostGpuAddr() + offset, static_cast<GLsizeiptr>(size));
     } else {
         glBindBufferRange(GL_UNIFORM_BUFFER, binding_index, buffer.Handle(),
                           static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
@@ -17,10 +17,12 @@
 namespace OpenGL {
 
 class BufferCacheRuntime;
+class ProgramManager;
 
 class Buffer : public VideoCommon::BufferBase {
 public:
-    explicit Buffer(BufferCacheRuntime&, DAddr cpu_addr, u64 size_bytes);
+    explicit Buffer(BufferCacheRuntime&, DAddr cpu_addr, u64 size_bytes,
+                    const VideoCommon::BufferCreateHints& hints = {});
     explicit Buffer(BufferCacheRuntime&, VideoCommon::NullBufferParams);
 
     void ImmediateUpload(size_t offset, std::span<const u8> data) noexcept;
@@ -61,7 +63,8 @@ class BufferCacheRuntime {
 public:
     static constexpr u8 INVALID_BINDING = std::numeric_limits<u8>::max();
 
-    explicit BufferCacheRuntime(const Device& device_, StagingBufferPool& staging_buffer_pool_);
+    explicit BufferCacheRuntime(const Device& device_, ProgramManager& program_manager_,
+                                StagingBufferPool& staging_buffer_pool_);
 
     [[nodiscard]] StagingBufferMap UploadStagingBuffer(size_t size);
 
@@ -94,6 +97,9 @@ public:
 
     void ClearBuffer(Buffer& dest_buffer, u32 offset, size_t size, u32 value);
 
+    void LayoutCopy(Buffer& dest_buffer, u32 dest_offset, Buffer& src_buffer, u32 src_offset,
+                    const Tegra::DMA::LayoutCopy& copy);
+
     void BindIndexBuffer(Buffer& buffer, u32 offset, u32 size);
 
     void BindVertexBuffer(u32 index, Buffer& buffer, u32 offset, u32 size, u32 stride);
@@ -130,6 +136,10 @@ public:
         const GLsizeiptr gl_size = static_cast<GLsizeiptr>(size);
         if (use_assembly_shaders) {
             glBindBufferRangeNV(PABO_LUT[stage], binding_index, handle, 0, gl_size);
+        } else if (has_unified_uniform_buffers) {
+            const GLuint binding = graphics_base_uniform_bindings[stage] + binding_index;
+            glBufferAddressRangeNV(GL_UNIFORM_BUFFER_ADDRESS_NV, binding,
+                                   fast_uniform_addresses[stage][binding_index], gl_size);
         } else {
             const GLuint base_binding = graphics_base_uniform_bindings[stage];
             const GLuint binding = base_binding + binding_index;
@@ -153,8 +163,15 @@ public:
         const auto [mapped_span, offset] = stream_buffer->Request(static_cast<size_t>(size));
         const GLuint base_binding = graphics_base_uniform_bindings[stage];
         const GLuint binding = base_binding + binding_index;
-        glBindBufferRange(GL_UNIFORM_BUFFER, binding, stream_buffer->Handle(),
-                          static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+        if (has_unified_uniform_buffers) {
+            // The stream buffer is coherent, binding it is only writing its address
+            glBufferAddressRangeNV(GL_UNIFORM_BUFFER_ADDRESS_NV, binding,
+                                   stream_buffer->Address() + offset,
+                                   static_cast<GLsizeiptr>(size));
+        } else {
+            glBindBufferRange(GL_UNIFORM_BUFFER, binding, stream_buffer->Handle(),
+                              static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+        }
         return mapped_span;
     }
 
@@ -191,6 +208,10 @@ public:
         return device_access_memory;
     }
 
+    u64 GetDeviceMemoryBudget() const {
+        return device_access_memory;
+    }
+
     bool CanReportMemoryUsage() const {
         return device.CanReportMemoryUsage();
     }
@@ -207,11 +228,15 @@ private:
     };
 
     const Device& device;
+    ProgramManager& program_manager;
     StagingBufferPool& staging_buffer_pool;
 
+    OGLProgram dma_layout_copy_program;
+
     bool has_fast_buffer_sub_data = false;
     bool use_assembly_shaders = false;
     bool has_unified_vertex_buffers = false;
+    bool has_unified_uniform_buffers = false;
 
     bool use_storage_buffers = false;
 
@@ -227,6 +252,9 @@ private:
     std::array<std::array<OGLBuffer, VideoCommon::NUM_GRAPHICS_UNIFORM_BUFFERS>,
                VideoCommon::NUM_STAGES>
         fast_uniforms;
+    std::array<std::array<GLuint64EXT, VideoCommon::NUM_GRAPHICS_UNIFORM_BUFFERS>,
+               VideoCommon::NUM_STAGES>
+        fast_uniform_addresses{};
     std::array<std::array<OGLBuffer, VideoCommon::NUM_GRAPHICS_UNIFORM_BUFFERS>,
                VideoCommon::NUM_STAGES>
         copy_uniforms;
@@ -254,6 +282,9 @@ struct BufferCacheParams {
 
     // TODO: Investigate why OpenGL seems to perform worse with persistently mapped buffer uploads
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = false;
+    static constexpr bool HAS_HOST_MEMORY_IMPORT = false;
+    static constexpr bool HAS_RESERVED_BUFFERS = false;
+    static constexpr bool HAS_STORAGE_BUFFER_TABLE = false;
 };
 
 using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
@@ -237,12 +237,22 @@ Device::Device(Core::Frontend::EmuWindow& emu_window) {
     }
     has_lmem_perf_bug = is_nvidia;
 
+    // Assembly shaders read uniforms from parameter buffers, they are already bound by address
+    has_uniform_buffer_unified_memory = GLAD_GL_NV_uniform_buffer_unified_memory &&
+                                        GLAD_GL_NV_shader_buffer_load && !use_assembly_shaders;
+    has_parallel_shader_compile =
+        GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
+
     strict_context_required = emu_window.StrictContextRequired();
     // Blocks Intel OpenGL drivers on Windows from using asynchronous shader compilation.
     // Blocks EGL on Wayland from using asynchronous shader compilation.
     const bool blacklist_async_shaders = (is_intel && !is_linux) || strict_context_required;
     use_asynchronous_shaders =
         Settings::values.use_asynchronous_shaders.GetValue() && !blacklist_async_shaders;
+    // The present thread makes a shared context current on the window surface the render context
+    // is bound to, which EGL rejects.
+    use_asynchronous_present =
+        Settings::values.async_presentation.GetValue() && !strict_context_required;
     use_driver_cache = is_nvidia;
     supports_conditional_barriers = !is_intel;
 
@@ -254,6 +264,9 @@ Device::Device(Core::Frontend::EmuWindow& emu_window) {
     if (Settings::values.use_asynchronous_shaders.GetValue() && !use_asynchronous_shaders) {
         LOG_WARNING(Render_OpenGL, "Asynchronous shader compilation enabled but not supported");
     }
+    if (Settings::values.async_presentation.GetValue() && !use_asynchronous_present) {
+        LOG_WARNING(Render_OpenGL, "Asynchronous presentation enabled but not supported");
+    }
 }
 
 std::string Device::GetVendorName() const {
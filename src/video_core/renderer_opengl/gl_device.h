@@ -76,6 +76,15 @@ public:
         return has_vertex_buffer_unified_memory;
     }
 
+    bool HasUniformBufferUnifiedMemory() const {
+        return has_uniform_buffer_unified_memory;
+    }
+
+    /// Returns true when program links can be polled for completion instead of blocking.
+    bool HasParallelShaderCompile() const {
+        return has_parallel_shader_compile;
+    }
+
     bool HasASTC() const {
         return has_astc;
     }
@@ -120,6 +129,10 @@ public:
         return use_asynchronous_shaders;
     }
 
+    bool UseAsynchronousPresent() const {
+        return use_asynchronous_present;
+    }
+
     bool UseDriverCache() const {
         return use_driver_cache;
     }
@@ -216,6 +229,8 @@ private:
     bool has_image_load_formatted{};
     bool has_texture_shadow_lod{};
     bool has_vertex_buffer_unified_memory{};
+    bool has_uniform_buffer_unified_memory{};
+    bool has_parallel_shader_compile{};
     bool has_astc{};
     bool has_variable_aoffi{};
     bool has_component_indexing_bug{};
@@ -227,6 +242,7 @@ private:
     bool has_debugging_tool_attached{};
     bool use_assembly_shaders{};
     bool use_asynchronous_shaders{};
+    bool use_asynchronous_present{};
     bool use_driver_cache{};
     bool has_depth_buffer_float{};
     bool has_geometry_shader_passthrough{};
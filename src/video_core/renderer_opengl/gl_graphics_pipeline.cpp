@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -172,15 +173,18 @@ ConfigureFuncPtr ConfigureFunc(const std::array<Shader::Info, 5>& infos, u32 ena
 GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_cache_,
                                    BufferCache& buffer_cache_, ProgramManager& program_manager_,
                                    StateTracker& state_tracker_, ShaderWorker* thread_worker,
-                                   VideoCore::ShaderNotify* shader_notify,
+                                   VideoCore::ShaderNotify* shader_notify_,
                                    std::array<std::string, 5> sources,
                                    std::array<std::vector<u32>, 5> sources_spirv,
                                    const std::array<const Shader::Info*, 5>& infos,
                                    const GraphicsPipelineKey& key_, bool force_context_flush)
     : texture_cache{texture_cache_}, buffer_cache{buffer_cache_}, program_manager{program_manager_},
-      state_tracker{state_tracker_}, key{key_} {
+      state_tracker{state_tracker_}, shader_notify{shader_notify_}, key{key_} {
+    const auto build_queue{thread_worker ? VideoCore::ShaderBuildQueue::Worker
+                                         : VideoCore::ShaderBuildQueue::Blocking};
+    const auto queue_time{std::chrono::steady_clock::now()};
     if (shader_notify) {
-        shader_notify->MarkShaderBuilding();
+        shader_notify->MarkShaderBuilding(build_queue);
     }
     u32 num_textures{};
     u32 num_images{};
@@ -231,8 +235,12 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
         GenerateTransformFeedbackState();
     }
     const bool in_parallel = thread_worker != nullptr;
+    // Without a worker the links don't block, their completion is polled before drawing
+    polls_link_status = !in_parallel && !force_context_flush &&
+                        backend != Settings::ShaderBackend::Glasm &&
+                        device.HasParallelShaderCompile();
     auto func{[this, sources_ = std::move(sources), sources_spirv_ = std::move(sources_spirv),
-               shader_notify, backend, in_parallel,
+               build_queue, queue_time, backend, in_parallel,
                force_context_flush](ShaderContext::Context*) mutable {
         for (size_t stage = 0; stage < 5; ++stage) {
             switch (backend) {
@@ -260,11 +268,11 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
             // Flush this context to ensure compilation commands and fence are in the GPU pipe.
             glFlush();
             built_condvar.notify_one();
-        } else {
+        } else if (!polls_link_status) {
             is_built = true;
         }
         if (shader_notify) {
-            shader_notify->MarkShaderComplete();
+            shader_notify->MarkShaderComplete(build_queue, queue_time);
         }
     }};
     if (thread_worker) {
@@ -615,18 +623,38 @@ void GraphicsPipeline::GenerateTransformFeedbackState() {
 }
 
 void GraphicsPipeline::WaitForBuild() {
+    if (polls_link_status) {
+        // The driver finishes the links before the programs are used
+        is_built = true;
+        return;
+    }
+    const auto wait_start{std::chrono::steady_clock::now()};
     if (built_fence.handle == 0) {
         std::unique_lock lock{built_mutex};
         built_condvar.wait(lock, [this] { return built_fence.handle != 0; });
     }
     ASSERT(glClientWaitSync(built_fence.handle, 0, GL_TIMEOUT_IGNORED) != GL_WAIT_FAILED);
     is_built = true;
+    if (shader_notify) {
+        shader_notify->MarkStall(std::chrono::steady_clock::now() - wait_start);
+    }
 }
 
 bool GraphicsPipeline::IsBuilt() noexcept {
     if (is_built) {
         return true;
     }
+    if (polls_link_status) {
+        is_built = std::ranges::all_of(source_programs, [](const OGLProgram& program) {
+            if (program.handle == 0) {
+                return true;
+            }
+            GLint completed{};
+            glGetProgramiv(program.handle, GL_COMPLETION_STATUS_KHR, &completed);
+            return completed != GL_FALSE;
+        });
+        return is_built;
+    }
     if (built_fence.handle == 0) {
         return false;
     }
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+
+#include <glad/glad.h>
+
+#include "video_core/renderer_opengl/gl_pass_timer.h"
+
+namespace OpenGL {
+
+PassTimer::PassTimer() = default;
+
+PassTimer::~PassTimer() = default;
+
+void PassTimer::Mark(VideoCore::GpuPass pass, u64 target) {
+    if (pass == current_pass && target == current_target) {
+        return;
+    }
+    current_pass = pass;
+    current_target = target;
+
+    OGLQuery query;
+    if (free_queries.empty()) {
+        query.Create(GL_TIMESTAMP);
+    } else {
+        query = std::move(free_queries.back());
+        free_queries.pop_back();
+    }
+    glQueryCounter(query.handle, GL_TIMESTAMP);
+    if (current_frame.queries.empty()) {
+        current_frame.cpu_time = std::chrono::steady_clock::now();
+    }
+    current_frame.queries.push_back(std::move(query));
+    current_frame.passes.push_back(pass);
+}
+
+void PassTimer::EndFrame() {
+    // The pass being recorded is reopened by the next mark, in the next frame
+    Mark(VideoCore::GpuPass::Idle);
+    if (!current_frame.queries.empty()) {
+        pending_frames.push(std::move(current_frame));
+    }
+    current_frame = Frame{};
+
+    while (!pending_frames.empty()) {
+        // Timestamps finish in order, the frame is done when its last one is
+        Frame& frame = pending_frames.front();
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(frame.queries.back().handle, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available == GL_FALSE) {
+            break;
+        }
+        ReadFrame(frame);
+        pending_frames.pop();
+    }
+}
+
+void PassTimer::ReadFrame(Frame& frame) {
+    std::vector<VideoCore::GpuPassMark> marks;
+    marks.reserve(frame.queries.size());
+    for (size_t index = 0; index < frame.queries.size(); ++index) {
+        GLuint64 timestamp_ns{};
+        glGetQueryObjectui64v(frame.queries[index].handle, GL_QUERY_RESULT, &timestamp_ns);
+        marks.push_back({
+            .pass = frame.passes[index],
+            .timestamp_ns = timestamp_ns,
+        });
+    }
+    timeline.AddFrame(marks, frame.cpu_time);
+    for (OGLQuery& query : frame.queries) {
+        free_queries.push_back(std::move(query));
+    }
+}
+
+} // namespace OpenGL
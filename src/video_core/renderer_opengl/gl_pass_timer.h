@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <queue>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/gpu_timeline.h"
+#include "video_core/renderer_opengl/gl_resource_manager.h"
+
+namespace OpenGL {
+
+/**
+ * Times the guest passes with timestamp queries and shows them on the GPU timeline.
+ *
+ * A timestamp is written every time the work changes to another pass, it ends the previous pass
+ * and starts the next one. OpenGL has no submissions to close the passes at, the time the GPU
+ * waits for commands is counted in the pass it waits in.
+ */
+class PassTimer {
+public:
+    PassTimer();
+    ~PassTimer();
+
+    /// Times the work from now on as a pass, target tells sets of render targets apart
+    void Mark(VideoCore::GpuPass pass, u64 target = 0);
+
+    /// Closes the current frame and adds the frames the GPU finished to the timeline
+    void EndFrame();
+
+private:
+    struct Frame {
+        std::vector<OGLQuery> queries;
+        std::vector<VideoCore::GpuPass> passes;
+        std::chrono::steady_clock::time_point cpu_time;
+    };
+
+    /// Reads the timestamps of a finished frame and recycles its queries
+    void ReadFrame(Frame& frame);
+
+    VideoCore::GpuTimeline timeline;
+    std::queue<Frame> pending_frames;
+    Frame current_frame;
+    std::vector<OGLQuery> free_queries;
+    VideoCore::GpuPass current_pass{VideoCore::GpuPass::Idle};
+    u64 current_target{};
+};
+
+} // namespace OpenGL
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include <glad/glad.h>
+
+#include "common/microprofile.h"
+#include "common/thread.h"
+#include "core/frontend/emu_window.h"
+#include "core/frontend/graphics_context.h"
+#include "video_core/gpu.h"
+#include "video_core/renderer_opengl/gl_present_manager.h"
+
+MICROPROFILE_DEFINE(OpenGL_WaitPresent, "OpenGL", "Wait For Present", MP_RGB(128, 128, 128));
+
+namespace OpenGL {
+
+PresentManager::PresentManager(Core::Frontend::EmuWindow& render_window_, Tegra::GPU& gpu_)
+    : render_window{render_window_}, gpu{gpu_} {
+    for (Frame& frame : frames) {
+        free_queue.push(&frame);
+    }
+    present_thread = std::jthread([this](std::stop_token token) { PresentThread(token); });
+}
+
+PresentManager::~PresentManager() = default;
+
+Frame* PresentManager::GetRenderFrame(u32 width, u32 height) {
+    Frame* frame;
+    {
+        MICROPROFILE_SCOPE(OpenGL_WaitPresent);
+        std::unique_lock lock{free_mutex};
+        free_cv.wait(lock, [this] { return !free_queue.empty(); });
+        frame = free_queue.front();
+        free_queue.pop();
+    }
+    // Rendering waits on the GPU for the last presentation of the frame to be done reading it
+    if (frame->present_done.handle) {
+        glWaitSync(frame->present_done.handle, 0, GL_TIMEOUT_IGNORED);
+        frame->present_done.Release();
+    }
+    width = std::max(width, 1U);
+    height = std::max(height, 1U);
+    if (frame->width != width || frame->height != height) {
+        frame->width = width;
+        frame->height = height;
+        ++frame->generation;
+        frame->color.Release();
+        frame->color.Create();
+        glNamedRenderbufferStorage(frame->color.handle, GL_RGBA8, static_cast<GLsizei>(width),
+                                   static_cast<GLsizei>(height));
+        frame->framebuffer.Release();
+        frame->framebuffer.Create();
+        glNamedFramebufferRenderbuffer(frame->framebuffer.handle, GL_COLOR_ATTACHMENT0,
+                                       GL_RENDERBUFFER, frame->color.handle);
+    }
+    frame->render_start = std::chrono::steady_clock::now();
+    return frame;
+}
+
+void PresentManager::Present(Frame* frame) {
+    frame->render_done.Release();
+    frame->render_done.Create();
+    // The fence has to reach the GPU before the present context can wait for it
+    glFlush();
+
+    std::scoped_lock lock{queue_mutex};
+    present_queue.push(frame);
+    frame_cv.notify_one();
+}
+
+void PresentManager::PresentThread(std::stop_token token) {
+    Common::SetCurrentThreadName("OpenGLPresent");
+    const auto context = render_window.CreateSharedContext();
+    const auto scope = context->Acquire();
+
+    // Framebuffers are not shared between contexts, each frame is read through one of our own
+    std::array<OGLFramebuffer, NUM_FRAMES> read_framebuffers;
+    std::array<u64, NUM_FRAMES> read_generations{};
+
+    while (!token.stop_requested()) {
+        Frame* frame;
+        {
+            std::unique_lock lock{queue_mutex};
+            Common::CondvarWait(frame_cv, lock, token, [this] { return !present_queue.empty(); });
+            if (token.stop_requested()) {
+                return;
+            }
+            frame = present_queue.front();
+            present_queue.pop();
+        }
+        const size_t index = static_cast<size_t>(frame - frames.data());
+        OGLFramebuffer& read_framebuffer = read_framebuffers[index];
+        if (read_generations[index] != frame->generation) {
+            read_generations[index] = frame->generation;
+            read_framebuffer.Release();
+            read_framebuffer.Create();
+            glNamedFramebufferRenderbuffer(read_framebuffer.handle, GL_COLOR_ATTACHMENT0,
+                                           GL_RENDERBUFFER, frame->color.handle);
+        }
+        glWaitSync(frame->render_done.handle, 0, GL_TIMEOUT_IGNORED);
+
+        const GLint width = static_cast<GLint>(frame->width);
+        const GLint height = static_cast<GLint>(frame->height);
+        glBlitNamedFramebuffer(read_framebuffer.handle, 0, 0, 0, width, height, 0, 0, width,
+                               height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        context->SwapBuffers();
+        // The swap returns once the frame is queued to the display, which is as close to it
+        // being shown as OpenGL tells
+        gpu.RendererPresentLatencyNotify(std::chrono::steady_clock::now() - frame->render_start);
+
+        frame->present_done.Create();
+        glFlush();
+
+        std::scoped_lock lock{free_mutex};
+        free_queue.push(frame);
+        free_cv.notify_one();
+    }
+}
+
+} // namespace OpenGL
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+
+#include "common/common_types.h"
+#include "common/polyfill_thread.h"
+#include "video_core/renderer_opengl/gl_resource_manager.h"
+
+namespace Core::Frontend {
+class EmuWindow;
+} // namespace Core::Frontend
+
+namespace Tegra {
+class GPU;
+}
+
+namespace OpenGL {
+
+struct Frame {
+    u32 width{};
+    u32 height{};
+    /// Changes whenever the color buffer is recreated, names of deleted objects can be reused
+    u64 generation{};
+    OGLRenderbuffer color;
+    OGLFramebuffer framebuffer; ///< Only valid in the rendering context
+    OGLSync render_done;
+    OGLSync present_done;
+    std::chrono::steady_clock::time_point render_start;
+};
+
+/**
+ * Presents frames from a thread of its own, with a context shared with the rendering one, so the
+ * GPU thread doesn't wait for the swap. Frames are handed between the contexts with fences waited
+ * on the GPU, neither thread waits for the other to finish rendering or presenting a frame.
+ */
+class PresentManager {
+public:
+    explicit PresentManager(Core::Frontend::EmuWindow& render_window, Tegra::GPU& gpu);
+    ~PresentManager();
+
+    /// Returns a frame to render to with the given size, waits when every frame is queued
+    Frame* GetRenderFrame(u32 width, u32 height);
+
+    /// Pushes a frame rendered in the current context for presentation
+    void Present(Frame* frame);
+
+private:
+    static constexpr size_t NUM_FRAMES = 3;
+
+    void PresentThread(std::stop_token token);
+
+    Core::Frontend::EmuWindow& render_window;
+    Tegra::GPU& gpu;
+    std::array<Frame, NUM_FRAMES> frames;
+    std::queue<Frame*> present_queue;
+    std::queue<Frame*> free_queue;
+    std::condition_variable_any frame_cv;
+    std::condition_variable free_cv;
+    std::mutex queue_mutex;
+    std::mutex free_mutex;
+    std::jthread present_thread;
+};
+
+} // namespace OpenGL
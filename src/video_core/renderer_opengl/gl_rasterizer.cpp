@@ -48,6 +48,27 @@ MICROPROFILE_DEFINE(OpenGL_CacheManagement, "OpenGL", "Cache Management", MP_RGB
 namespace {
 constexpr size_t NUM_SUPPORTED_VERTEX_ATTRIBUTES = 16;
 
+/// Flags gating every step of SyncState, a draw with none of them dirty has nothing to sync
+Tegra::Engines::Maxwell3D::DirtyState::Flags MakeSyncStateFlags() {
+    Tegra::Engines::Maxwell3D::DirtyState::Flags flags;
+    for (const u8 flag : {
+             Dirty::Viewports,          Dirty::ClipControl,        Dirty::FrontFace,
+             Dirty::RasterizeEnable,    Dirty::PolygonModes,       Dirty::ColorMasks,
+             Dirty::FragmentClampColor, Dirty::MultisampleControl, Dirty::DepthMask,
+             Dirty::DepthTest,          Dirty::DepthClampEnabled,  Dirty::StencilTest,
+             Dirty::BlendColor,         Dirty::BlendStates,        Dirty::LogicOp,
+             Dirty::CullTest,           Dirty::PrimitiveRestart,   Dirty::Scissors,
+             Dirty::PointSize,          Dirty::LineWidth,          Dirty::PolygonOffset,
+             Dirty::AlphaTest,          Dirty::FramebufferSRGB,    Dirty::VertexFormats,
+             Dirty::VertexInstances,
+         }) {
+        flags[flag] = true;
+    }
+    flags[VideoCommon::Dirty::RescaleViewports] = true;
+    flags[VideoCommon::Dirty::RescaleScissors] = true;
+    return flags;
+}
+
 void oglEnable(GLenum cap, bool state) {
     (state ? glEnable : glDisable)(cap);
 }
@@ -76,14 +97,20 @@ RasterizerOpenGL::RasterizerOpenGL(Core::Frontend::EmuWindow& emu_window_, Tegra
     : gpu(gpu_), device_memory(device_memory_), device(device_), program_manager(program_manager_),
       state_tracker(state_tracker_),
       texture_cache_runtime(device, program_manager, state_tracker, staging_buffer_pool),
-      texture_cache(texture_cache_runtime, device_memory_),
-      buffer_cache_runtime(device, staging_buffer_pool),
-      buffer_cache(device_memory_, buffer_cache_runtime),
+      texture_cache(texture_cache_runtime, device_memory_, gpu.MemoryStats(), gpu.MemoryBudget(),
+                    gpu.TextureCacheStats()),
+      buffer_cache_runtime(device, program_manager, staging_buffer_pool),
+      buffer_cache(device_memory_, buffer_cache_runtime, gpu.MemoryStats(), gpu.MemoryBudget()),
       shader_cache(device_memory_, emu_window_, device, texture_cache, buffer_cache,
                    program_manager, state_tracker, gpu.ShaderNotify()),
       query_cache(*this, device_memory_), accelerate_dma(buffer_cache, texture_cache),
       fence_manager(*this, gpu, texture_cache, buffer_cache, query_cache),
-      blit_image(program_manager_) {}
+      blit_image(program_manager_), sync_state_flags(MakeSyncStateFlags()) {
+    if (Settings::values.gpu_pass_timestamps.GetValue()) {
+        pass_timer.emplace();
+        texture_cache_runtime.SetPassTimer(&*pass_timer);
+    }
+}
 
 RasterizerOpenGL::~RasterizerOpenGL() = default;
 
@@ -153,6 +180,8 @@ void RasterizerOpenGL::SyncVertexInstances() {
 void RasterizerOpenGL::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                                          const VideoCore::DiskResourceLoadCallback& callback) {
     shader_cache.LoadDiskResources(title_id, stop_loading, callback);
+    std::scoped_lock lock{texture_cache.mutex};
+    texture_cache.LoadDiskResources(title_id, gpu.ShaderNotify());
 }
 
 void RasterizerOpenGL::Clear(u32 layer_count) {
@@ -204,6 +233,7 @@ void RasterizerOpenGL::Clear(u32 layer_count) {
     std::scoped_lock lock{texture_cache.mutex};
     texture_cache.UpdateRenderTargets(true);
     state_tracker.BindFramebuffer(texture_cache.GetFramebuffer()->Handle());
+    MarkRenderTargetPass();
     SyncViewport();
     if (regs.clear_control.use_scissor) {
         SyncScissorTest();
@@ -248,6 +278,7 @@ void RasterizerOpenGL::PrepareDraw(bool is_indexed, Func&& draw_func) {
     }
     pipeline->SetEngine(maxwell3d, gpu_memory);
     pipeline->Configure(is_indexed);
+    MarkRenderTargetPass();
 
     SyncState();
 
@@ -354,6 +385,60 @@ void RasterizerOpenGL::DrawIndirect() {
     buffer_cache.SetDrawIndirect(nullptr);
 }
 
+void RasterizerOpenGL::DrawBatch(bool is_indexed) {
+    PrepareDraw(is_indexed, [this, is_indexed](GLenum primitive_mode) {
+        using Tegra::Engines::DrawManager;
+        const auto& draw_state = maxwell3d->draw_manager->GetDrawState();
+        const auto draws = maxwell3d->draw_manager->GetDrawBatch();
+        const GLsizei draw_count = static_cast<GLsizei>(draws.size());
+        // The parameter arrays of the multi draw entry points have no instancing variant
+        const bool is_single_instance = std::ranges::all_of(draws, [](const auto& draw) {
+            return draw.instance_count == 1 && draw.base_instance == 0;
+        });
+        std::array<GLsizei, DrawManager::MaxBatchedDraws> counts;
+        if (is_indexed) {
+            const GLenum format = MaxwellToGL::IndexFormat(draw_state.index_buffer.format);
+            const size_t format_size = draw_state.index_buffer.FormatSizeInBytes();
+            const uintptr_t base_offset =
+                reinterpret_cast<uintptr_t>(buffer_cache_runtime.IndexOffset());
+            std::array<const GLvoid*, DrawManager::MaxBatchedDraws> offsets;
+            std::array<GLint, DrawManager::MaxBatchedDraws> base_vertices;
+            for (size_t i = 0; i < draws.size(); ++i) {
+                const size_t first = draws[i].first - draw_state.index_buffer.first;
+                counts[i] = static_cast<GLsizei>(draws[i].count);
+                offsets[i] = reinterpret_cast<const GLvoid*>(base_offset + first * format_size);
+                base_vertices[i] = static_cast<GLint>(draws[i].base_vertex);
+            }
+            if (is_single_instance) {
+                glMultiDrawElementsBaseVertex(primitive_mode, counts.data(), format,
+                                              offsets.data(), draw_count, base_vertices.data());
+                return;
+            }
+            for (size_t i = 0; i < draws.size(); ++i) {
+                glDrawElementsInstancedBaseVertexBaseInstance(
+                    primitive_mode, counts[i], format, offsets[i],
+                    static_cast<GLsizei>(draws[i].instance_count), base_vertices[i],
+                    static_cast<GLuint>(draws[i].base_instance));
+            }
+        } else {
+            std::array<GLint, DrawManager::MaxBatchedDraws> firsts;
+            for (size_t i = 0; i < draws.size(); ++i) {
+                firsts[i] = static_cast<GLint>(draws[i].first);
+                counts[i] = static_cast<GLsizei>(draws[i].count);
+            }
+            if (is_single_instance) {
+                glMultiDrawArrays(primitive_mode, firsts.data(), counts.data(), draw_count);
+                return;
+            }
+            for (size_t i = 0; i < draws.size(); ++i) {
+                glDrawArraysInstancedBaseInstance(primitive_mode, firsts[i], counts[i],
+                                                  static_cast<GLsizei>(draws[i].instance_count),
+                                                  static_cast<GLuint>(draws[i].base_instance));
+            }
+        }
+    });
+}
+
 void RasterizerOpenGL::DrawTexture() {
     MICROPROFILE_SCOPE(OpenGL_Drawing);
 
@@ -383,6 +468,7 @@ void RasterizerOpenGL::DrawTexture() {
     Extent3D src_size = {static_cast<u32>(Scale(texture.size.width)),
                          static_cast<u32>(Scale(texture.size.height)), texture.size.depth};
 
+    MarkRenderTargetPass();
     if (device.HasDrawTexture()) {
         state_tracker.BindFramebuffer(texture_cache.GetFramebuffer()->Handle());
 
@@ -413,6 +499,9 @@ void RasterizerOpenGL::DispatchCompute() {
     }
     pipeline->SetEngine(kepler_compute, gpu_memory);
     pipeline->Configure();
+    if (pass_timer) {
+        pass_timer->Mark(VideoCore::GpuPass::Compute);
+    }
     const auto& qmd{kepler_compute->launch_description};
     auto indirect_address = kepler_compute->GetIndirectComputeAddress();
     if (indirect_address) {
@@ -625,6 +714,14 @@ void RasterizerOpenGL::ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) {
     }
 }
 
+void RasterizerOpenGL::ModifyGPUMemoryBatch(size_t as_id,
+                                            std::span<const std::pair<GPUVAddr, u64>> ranges) {
+    std::scoped_lock lock{texture_cache.mutex};
+    for (const auto& [addr, size] : ranges) {
+        texture_cache.UnmapGPUMemory(as_id, addr, size);
+    }
+}
+
 void RasterizerOpenGL::SignalFence(std::function<void()>&& func) {
     fence_manager.SignalFence(std::move(func));
 }
@@ -774,6 +871,9 @@ std::optional<FramebufferTextureInfo> RasterizerOpenGL::AccelerateDisplay(
 }
 
 void RasterizerOpenGL::SyncState() {
+    if (!maxwell3d->dirty.flags.AnyOf(sync_state_flags)) {
+        return;
+    }
     SyncViewport();
     SyncRasterizeEnable();
     SyncPolygonModes();
@@ -1353,6 +1453,13 @@ void RasterizerOpenGL::EndTransformFeedback() {
     }
 }
 
+void RasterizerOpenGL::MarkRenderTargetPass() {
+    if (pass_timer) {
+        pass_timer->Mark(VideoCore::GpuPass::RenderTarget,
+                         texture_cache.GetFramebuffer()->Handle());
+    }
+}
+
 void RasterizerOpenGL::InitializeChannel(Tegra::Control::ChannelState& channel) {
     CreateChannel(channel);
     {
@@ -1390,6 +1497,11 @@ void RasterizerOpenGL::ReleaseChannel(s32 channel_id) {
     query_cache.EraseChannel(channel_id);
 }
 
+void RasterizerOpenGL::BindCapture(VideoCommon::GpuCaptureWriter* capture) {
+    std::scoped_lock lock{buffer_cache.mutex};
+    buffer_cache.BindCapture(capture);
+}
+
 void RasterizerOpenGL::RegisterTransformFeedback(GPUVAddr tfb_object_addr) {
     buffer_cache_runtime.BindTransformFeedbackObject(tfb_object_addr);
 }
@@ -1452,4 +1564,14 @@ bool AccelerateDMA::BufferToImage(const Tegra::DMA::ImageCopy& copy_info,
     return DmaBufferImageCopy<true>(copy_info, buffer_operand, image_operand);
 }
 
+bool AccelerateDMA::BufferLayoutCopy(const Tegra::DMA::LayoutCopy& copy) {
+    std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+    // Images are refreshed from guest memory, which the copy leaves untouched
+    if (texture_cache.HasImagesInRegion(copy.src.address, copy.src.size) ||
+        texture_cache.HasImagesInRegion(copy.dst.address, copy.dst.size)) {
+        return false;
+    }
+    return buffer_cache.DMALayoutCopy(copy);
+}
+
 } // namespace OpenGL
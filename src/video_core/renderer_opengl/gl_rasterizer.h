@@ -20,6 +20,7 @@
 #include "video_core/renderer_opengl/gl_buffer_cache.h"
 #include "video_core/renderer_opengl/gl_device.h"
 #include "video_core/renderer_opengl/gl_fence_manager.h"
+#include "video_core/renderer_opengl/gl_pass_timer.h"
 #include "video_core/renderer_opengl/gl_query_cache.h"
 #include "video_core/renderer_opengl/gl_shader_cache.h"
 #include "video_core/renderer_opengl/gl_texture_cache.h"
@@ -62,6 +63,8 @@ public:
     bool BufferToImage(const Tegra::DMA::ImageCopy& copy_info, const Tegra::DMA::BufferOperand& src,
                        const Tegra::DMA::ImageOperand& dst) override;
 
+    bool BufferLayoutCopy(const Tegra::DMA::LayoutCopy& copy) override;
+
 private:
     template <bool IS_IMAGE_UPLOAD>
     bool DmaBufferImageCopy(const Tegra::DMA::ImageCopy& copy_info,
@@ -83,6 +86,7 @@ public:
 
     void Draw(bool is_indexed, u32 instance_count) override;
     void DrawIndirect() override;
+    void DrawBatch(bool is_indexed) override;
     void DrawTexture() override;
     void Clear(u32 layer_count) override;
     void DispatchCompute() override;
@@ -104,6 +108,8 @@ public:
     void InvalidateGPUCache() override;
     void UnmapMemory(DAddr addr, u64 size) override;
     void ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) override;
+    void ModifyGPUMemoryBatch(size_t as_id,
+                              std::span<const std::pair<GPUVAddr, u64>> ranges) override;
     void SignalFence(std::function<void()>&& func) override;
     void SyncOperation(std::function<void()>&& func) override;
     void SignalSyncPoint(u32 value) override;
@@ -137,16 +143,27 @@ public:
 
     void ReleaseChannel(s32 channel_id) override;
 
+    void BindCapture(VideoCommon::GpuCaptureWriter* capture) override;
+
     void RegisterTransformFeedback(GPUVAddr tfb_object_addr) override;
 
     bool HasDrawTransformFeedback() override {
         return true;
     }
 
+    bool HasDrawBatch() override {
+        return true;
+    }
+
     std::optional<FramebufferTextureInfo> AccelerateDisplay(const Tegra::FramebufferConfig& config,
                                                             VAddr framebuffer_addr,
                                                             u32 pixel_stride);
 
+    /// Returns the timer of the GPU passes, null when passes are not timed
+    PassTimer* GetPassTimer() {
+        return pass_timer ? &*pass_timer : nullptr;
+    }
+
 private:
     static constexpr size_t MAX_TEXTURES = 192;
     static constexpr size_t MAX_IMAGES = 48;
@@ -233,6 +250,9 @@ private:
     /// End a transform feedback
     void EndTransformFeedback();
 
+    /// Times the work from now on as a pass of the bound render targets, when passes are timed
+    void MarkRenderTargetPass();
+
     void QueryFallback(GPUVAddr gpu_addr, VideoCommon::QueryType type,
                        VideoCommon::QueryPropertiesFlags flags, u32 payload, u32 subreport);
 
@@ -243,6 +263,7 @@ private:
     ProgramManager& program_manager;
     StateTracker& state_tracker;
 
+    std::optional<PassTimer> pass_timer;
     StagingBufferPool staging_buffer_pool;
     TextureCacheRuntime texture_cache_runtime;
     TextureCache texture_cache;
@@ -266,6 +287,9 @@ private:
     bool has_written_global_memory = false;
 
     u32 last_clip_distance_mask = 0;
+
+    /// Union of the dirty flags checked by SyncState
+    Tegra::Engines::Maxwell3D::DirtyState::Flags sync_state_flags;
 };
 
 } // namespace OpenGL
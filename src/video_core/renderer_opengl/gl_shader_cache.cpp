@@ -2,7 +2,6 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <atomic>
-#include <fstream>
 #include <functional>
 #include <mutex>
 #include <string>
@@ -51,7 +50,7 @@ using VideoCommon::LoadPipelines;
 using VideoCommon::SerializePipeline;
 using Context = ShaderContext::Context;
 
-constexpr u32 CACHE_VERSION = 10;
+constexpr u32 CACHE_VERSION = 13;
 
 template <typename Container>
 auto MakeSpan(Container& container) {
@@ -290,12 +289,19 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
             workers->QueueWork(std::move(work));
         }
     }};
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
-        ComputePipelineKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
-        queue_work([this, key, env_ = std::move(env), &state, &callback](Context* ctx) mutable {
-            ctx->pools.ReleaseContents();
-            auto pipeline{CreateComputePipeline(ctx->pools, key, env_, true)};
+    const auto load_compute{[&](VideoCommon::CachedPipeline cached) {
+        const std::optional key{cached.ReadKey<ComputePipelineKey>()};
+        if (!key) {
+            return;
+        }
+        queue_work([this, key = *key, cached_ = std::move(cached), &state,
+                    &callback](Context* ctx) {
+            std::unique_ptr<ComputePipeline> pipeline;
+            std::vector<FileEnvironment> envs{cached_.Environments()};
+            if (!envs.empty()) {
+                ctx->pools.ReleaseContents();
+                pipeline = CreateComputePipeline(ctx->pools, key, envs.front(), true);
+            }
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
                 compute_cache.emplace(key, std::move(pipeline));
@@ -307,16 +313,23 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
-        GraphicsPipelineKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
-        queue_work([this, key, envs_ = std::move(envs), &state, &callback](Context* ctx) mutable {
-            boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
-            for (auto& env : envs_) {
-                env_ptrs.push_back(&env);
+    const auto load_graphics{[&](VideoCommon::CachedPipeline cached) {
+        const std::optional key{cached.ReadKey<GraphicsPipelineKey>()};
+        if (!key) {
+            return;
+        }
+        queue_work([this, key = *key, cached_ = std::move(cached), &state,
+                    &callback](Context* ctx) {
+            std::unique_ptr<GraphicsPipeline> pipeline;
+            std::vector<FileEnvironment> envs{cached_.Environments()};
+            if (!envs.empty()) {
+                boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
+                for (auto& env : envs) {
+                    env_ptrs.push_back(&env);
+                }
+                ctx->pools.ReleaseContents();
+                pipeline = CreateGraphicsPipeline(ctx->pools, key, MakeSpan(env_ptrs), false, true);
             }
-            ctx->pools.ReleaseContents();
-            auto pipeline{CreateGraphicsPipeline(ctx->pools, key, MakeSpan(env_ptrs), false, true)};
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
                 graphics_cache.emplace(key, std::move(pipeline));
@@ -394,6 +407,7 @@ GraphicsPipeline* ShaderCache::BuiltPipeline(GraphicsPipeline* pipeline) const n
     // If something is using depth, we can assume that games are not rendering anything which
     // will be used one time.
     if (maxwell3d->regs.zeta_enable) {
+        shader_notify.MarkDrawSkipped();
         return nullptr;
     }
     // If games are using a small index count, we can assume these are full screen quads.
@@ -403,6 +417,7 @@ GraphicsPipeline* ShaderCache::BuiltPipeline(GraphicsPipeline* pipeline) const n
     if (draw_state.index_buffer.count <= 6 || draw_state.vertex_buffer.count <= 6) {
         return pipeline;
     }
+    shader_notify.MarkDrawSkipped();
     return nullptr;
 }
 
@@ -431,8 +446,12 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline() {
     GetGraphicsEnvironments(environments, graphics_key.unique_hashes);
 
     main_pools.ReleaseContents();
+    // Compiles issued from this thread already run on the driver's threads when it can compile in
+    // parallel, so the shader workers and their shared contexts are only needed without it
+    const bool use_shader_workers = use_asynchronous_shaders && !device.HasParallelShaderCompile();
+    // Stages are translated on the shader workers too, they only exist with asynchronous shaders
     auto pipeline{CreateGraphicsPipeline(main_pools, graphics_key, environments.Span(),
-                                         use_asynchronous_shaders)};
+                                         use_shader_workers, false, workers != nullptr)};
     if (!pipeline || shader_cache_filename.empty()) {
         return pipeline;
     }
@@ -442,14 +461,15 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline() {
             env_ptrs.push_back(&environments.envs[index]);
         }
     }
-    SerializePipeline(graphics_key, env_ptrs, shader_cache_filename, CACHE_VERSION);
+    SerializePipeline(graphics_key, env_ptrs, shader_cache_filename, CACHE_VERSION,
+                      VideoCommon::PipelineUsage{});
     return pipeline;
 }
 
 std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
     ShaderContext::ShaderPools& pools, const GraphicsPipelineKey& key,
     std::span<Shader::Environment* const> envs, bool use_shader_workers,
-    bool force_context_flush) try {
+    bool force_context_flush, bool translate_in_parallel) try {
     auto hash = key.Hash();
     LOG_INFO(Render_OpenGL, "0x{:016x}", hash);
     size_t env_index{};
@@ -461,6 +481,49 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
     // Layer passthrough generation for devices without GL_ARB_shader_viewport_layer_array
     Shader::IR::Program* layer_source_program{};
 
+    // Stages are translated independently of each other, emission below links them in order
+    std::array<Shader::Environment*, Maxwell::MaxShaderProgram> stage_envs{};
+    std::array<size_t, Maxwell::MaxShaderProgram> stage_indices{};
+    size_t num_stages{};
+    for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+        if (key.unique_hashes[index] == 0) {
+            continue;
+        }
+        Shader::Environment& env{*envs[env_index]};
+        ++env_index;
+        if (Settings::values.dump_shaders) {
+            env.Dump(hash, key.unique_hashes[index]);
+        }
+        stage_envs[index] = &env;
+        stage_indices[num_stages] = index;
+        ++num_stages;
+    }
+    const auto translate_stage{[&](size_t stage) {
+        const size_t index{stage_indices[stage]};
+        ShaderContext::ShaderPools& stage_pool{translate_in_parallel ? stage_pools[index] : pools};
+        Shader::Environment& env{*stage_envs[index]};
+        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
+        const auto translate{[&](Shader::Environment& translate_env) {
+            Shader::Maxwell::Flow::CFG cfg(translate_env, stage_pool.flow_block, cfg_offset,
+                                           index == 0);
+            return TranslateProgram(stage_pool.inst, stage_pool.block, translate_env, cfg,
+                                    host_info);
+        }};
+        programs[index] = translation_cache.Translate(stage_pool.inst, stage_pool.block, env,
+                                                      key.unique_hashes[index], host_info,
+                                                      translate);
+    }};
+    if (translate_in_parallel) {
+        for (ShaderContext::ShaderPools& stage_pool : stage_pools) {
+            stage_pool.ReleaseContents();
+        }
+        Common::ParallelForEach(*workers, num_stages, translate_stage);
+    } else {
+        for (size_t stage = 0; stage < num_stages; ++stage) {
+            translate_stage(stage);
+        }
+    }
+
     for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
         const bool is_emulated_stage = layer_source_program != nullptr &&
                                        index == static_cast<u32>(Maxwell::ShaderType::Geometry);
@@ -473,29 +536,12 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
         if (key.unique_hashes[index] == 0) {
             continue;
         }
-        Shader::Environment& env{*envs[env_index]};
-        ++env_index;
-
-        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
-        Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, cfg_offset, index == 0);
-
-        if (Settings::values.dump_shaders) {
-            env.Dump(hash, key.unique_hashes[index]);
-        }
-
-        if (!uses_vertex_a || index != 1) {
-            // Normal path
-            programs[index] = TranslateProgram(pools.inst, pools.block, env, cfg, host_info);
-
-            total_storage_buffers +=
-                Shader::NumDescriptors(programs[index].info.storage_buffers_descriptors);
-        } else {
+        total_storage_buffers +=
+            Shader::NumDescriptors(programs[index].info.storage_buffers_descriptors);
+        if (uses_vertex_a && index == 1) {
             // VertexB path when VertexA is present.
-            auto& program_va{programs[0]};
-            auto program_vb{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
-            total_storage_buffers +=
-                Shader::NumDescriptors(program_vb.info.storage_buffers_descriptors);
-            programs[index] = MergeDualVertexPrograms(program_va, program_vb, env);
+            programs[index] = MergeDualVertexPrograms(programs[0], programs[index],
+                                                      *stage_envs[index]);
         }
 
         if (programs[index].info.requires_layer_emulation) {
@@ -565,7 +611,7 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
         return pipeline;
     }
     SerializePipeline(key, std::array<const GenericEnvironment*, 1>{&env}, shader_cache_filename,
-                      CACHE_VERSION);
+                      CACHE_VERSION, VideoCommon::PipelineUsage{});
     return pipeline;
 }
 
@@ -575,13 +621,16 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
     auto hash = key.Hash();
     LOG_INFO(Render_OpenGL, "0x{:016x}", hash);
 
-    Shader::Maxwell::Flow::CFG cfg{env, pools.flow_block, env.StartAddress()};
-
     if (Settings::values.dump_shaders) {
         env.Dump(hash, key.unique_hash);
     }
 
-    auto program{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
+    const auto translate{[&](Shader::Environment& translate_env) {
+        Shader::Maxwell::Flow::CFG cfg{translate_env, pools.flow_block, env.StartAddress()};
+        return TranslateProgram(pools.inst, pools.block, translate_env, cfg, host_info);
+    }};
+    auto program{translation_cache.Translate(pools.inst, pools.block, env, key.unique_hash,
+                                             host_info, translate)};
     const u32 num_storage_buffers{Shader::NumDescriptors(program.info.storage_buffers_descriptors)};
     Shader::RuntimeInfo info;
     info.glasm_use_storage_buffers = num_storage_buffers <= device.GetMaxGLASMStorageBufferBlocks();
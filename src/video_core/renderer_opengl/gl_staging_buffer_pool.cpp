@@ -98,13 +98,17 @@ std::optional<size_t> StagingBuffers::FindBuffer(size_t requested_size) {
     return found;
 }
 
-StreamBuffer::StreamBuffer() {
+StreamBuffer::StreamBuffer(bool use_unified_memory) {
     static constexpr GLenum flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
     buffer.Create();
     glObjectLabel(GL_BUFFER, buffer.handle, -1, "Stream Buffer");
     glNamedBufferStorage(buffer.handle, STREAM_BUFFER_SIZE, nullptr, flags);
     mapped_pointer =
         static_cast<u8*>(glMapNamedBufferRange(buffer.handle, 0, STREAM_BUFFER_SIZE, flags));
+    if (use_unified_memory) {
+        glMakeNamedBufferResidentNV(buffer.handle, GL_READ_ONLY);
+        glGetNamedBufferParameterui64vNV(buffer.handle, GL_BUFFER_GPU_ADDRESS_NV, &address);
+    }
     for (OGLSync& sync : fences) {
         sync.Create();
     }
@@ -65,7 +65,8 @@ class StreamBuffer {
     static_assert(REGION_SIZE % MAX_ALIGNMENT == 0);
 
 public:
-    explicit StreamBuffer();
+    /// When use_unified_memory is true the buffer is made resident and can be bound by address
+    explicit StreamBuffer(bool use_unified_memory = false);
 
     [[nodiscard]] std::pair<std::span<u8>, size_t> Request(size_t size) noexcept;
 
@@ -73,6 +74,10 @@ public:
         return buffer.handle;
     }
 
+    [[nodiscard]] GLuint64EXT Address() const noexcept {
+        return address;
+    }
+
 private:
     [[nodiscard]] static size_t Region(size_t offset) noexcept {
         return offset / REGION_SIZE;
@@ -82,6 +87,7 @@ private:
     size_t used_iterator = 0;
     size_t free_iterator = 0;
     u8* mapped_pointer = nullptr;
+    GLuint64EXT address = 0;
     OGLBuffer buffer;
     std::array<OGLSync, NUM_SYNCS> fences;
 };
@@ -12,6 +12,7 @@
 #include "common/literals.h"
 #include "common/settings.h"
 #include "video_core/renderer_opengl/gl_device.h"
+#include "video_core/renderer_opengl/gl_pass_timer.h"
 #include "video_core/renderer_opengl/gl_shader_manager.h"
 #include "video_core/renderer_opengl/gl_state_tracker.h"
 #include "video_core/renderer_opengl/gl_texture_cache.h"
@@ -737,6 +738,9 @@ void Image::UploadMemory(GLuint buffer_handle, size_t buffer_offset,
     if (is_rescaled) {
         ScaleDown(true);
     }
+    if (runtime->pass_timer) {
+        runtime->pass_timer->Mark(VideoCore::GpuPass::TextureUpload);
+    }
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer_handle);
     glFlushMappedBufferRange(GL_PIXEL_UNPACK_BUFFER, buffer_offset, unswizzled_size_bytes);
 
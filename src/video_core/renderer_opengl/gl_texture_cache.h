@@ -22,6 +22,7 @@ struct ResolutionScalingInfo;
 
 namespace OpenGL {
 
+class PassTimer;
 class ProgramManager;
 class StateTracker;
 
@@ -84,6 +85,10 @@ public:
 
     u64 GetDeviceMemoryUsage() const;
 
+    u64 GetDeviceMemoryBudget() const {
+        return device_access_memory;
+    }
+
     bool CanReportMemoryUsage() const {
         return device.CanReportMemoryUsage();
     }
@@ -145,10 +150,16 @@ public:
         // OpenGL does not require a barrier for attachment feedback loops.
     }
 
+    /// Assigns the timer of the GPU passes, uploads are timed as passes of their own
+    void SetPassTimer(PassTimer* pass_timer_) {
+        pass_timer = pass_timer_;
+    }
+
 private:
     const Device& device;
     StateTracker& state_tracker;
     StagingBufferPool& staging_buffer_pool;
+    PassTimer* pass_timer = nullptr;
 
     UtilShaders util_shaders;
     FormatConversionPass format_conversion_pass;
@@ -364,6 +375,7 @@ struct TextureCacheParams {
     static constexpr bool HAS_EMULATED_COPIES = true;
     static constexpr bool HAS_DEVICE_MEMORY_INFO = true;
     static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = true;
+    static constexpr bool HAS_SPARSE_RESIDENCY = false;
 
     using Runtime = OpenGL::TextureCacheRuntime;
     using Image = OpenGL::Image;
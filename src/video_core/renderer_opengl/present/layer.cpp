@@ -10,6 +10,7 @@
 #include "video_core/renderer_opengl/present/layer.h"
 #include "video_core/renderer_opengl/present/present_uniforms.h"
 #include "video_core/renderer_opengl/present/smaa.h"
+#include "video_core/renderer_opengl/present/taa.h"
 #include "video_core/surface.h"
 #include "video_core/textures/decoders.h"
 
@@ -56,6 +57,10 @@ GLuint Layer::ConfigureDraw(std::array<GLfloat, 3 * 2>& out_matrix,
             CreateFXAA();
             texture = fxaa->Draw(program_manager, info.display_texture);
             break;
+        case Settings::AntiAliasing::Taa:
+            CreateTAA();
+            texture = taa->Draw(program_manager, info.display_texture);
+            break;
         case Settings::AntiAliasing::Smaa:
         default:
             CreateSMAA();
@@ -201,10 +206,12 @@ void Layer::ConfigureFramebufferTexture(const Tegra::FramebufferConfig& framebuf
 
     fxaa.reset();
     smaa.reset();
+    taa.reset();
 }
 
 void Layer::CreateFXAA() {
     smaa.reset();
+    taa.reset();
     if (!fxaa) {
         fxaa = std::make_unique<FXAA>(
             Settings::values.resolution_info.ScaleUp(framebuffer_texture.width),
@@ -214,6 +221,7 @@ void Layer::CreateFXAA() {
 
 void Layer::CreateSMAA() {
     fxaa.reset();
+    taa.reset();
     if (!smaa) {
         smaa = std::make_unique<SMAA>(
             Settings::values.resolution_info.ScaleUp(framebuffer_texture.width),
@@ -221,4 +229,14 @@ void Layer::CreateSMAA() {
     }
 }
 
+void Layer::CreateTAA() {
+    fxaa.reset();
+    smaa.reset();
+    if (!taa) {
+        taa = std::make_unique<TAA>(
+            Settings::values.resolution_info.ScaleUp(framebuffer_texture.width),
+            Settings::values.resolution_info.ScaleUp(framebuffer_texture.height));
+    }
+}
+
 } // namespace OpenGL
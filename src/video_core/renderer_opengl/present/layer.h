@@ -31,6 +31,7 @@ class FXAA;
 class ProgramManager;
 class RasterizerOpenGL;
 class SMAA;
+class TAA;
 
 /// Structure used for storing information about the textures for the Switch screen
 struct TextureInfo {
@@ -64,6 +65,7 @@ private:
 
     void CreateFXAA();
     void CreateSMAA();
+    void CreateTAA();
 
 private:
     RasterizerOpenGL& rasterizer;
@@ -79,6 +81,7 @@ private:
     std::unique_ptr<FSR> fsr;
     std::unique_ptr<FXAA> fxaa;
     std::unique_ptr<SMAA> smaa;
+    std::unique_ptr<TAA> taa;
 };
 
 } // namespace OpenGL
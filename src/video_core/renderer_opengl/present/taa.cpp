@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "video_core/host_shaders/taa_frag.h"
+#include "video_core/host_shaders/taa_vert.h"
+#include "video_core/renderer_opengl/gl_shader_manager.h"
+#include "video_core/renderer_opengl/gl_shader_util.h"
+#include "video_core/renderer_opengl/present/taa.h"
+#include "video_core/renderer_opengl/present/util.h"
+
+namespace OpenGL {
+
+TAA::TAA(u32 width, u32 height) {
+    vert_shader = CreateProgram(HostShaders::TAA_VERT, GL_VERTEX_SHADER);
+    frag_shader = CreateProgram(HostShaders::TAA_FRAG, GL_FRAGMENT_SHADER);
+
+    sampler = CreateBilinearSampler();
+
+    for (size_t i = 0; i < textures.size(); ++i) {
+        framebuffers[i].Create();
+        textures[i].Create(GL_TEXTURE_2D);
+        glTextureStorage2D(textures[i].handle, 1, GL_RGBA16F, width, height);
+        glNamedFramebufferTexture(framebuffers[i].handle, GL_COLOR_ATTACHMENT0,
+                                  textures[i].handle, 0);
+    }
+}
+
+TAA::~TAA() = default;
+
+GLuint TAA::Draw(ProgramManager& program_manager, GLuint input_texture) {
+    // The first frame has no history, resolving it against itself passes it through
+    const GLuint history_texture = has_history ? textures[current ^ 1].handle : input_texture;
+
+    glFrontFace(GL_CCW);
+
+    program_manager.BindPresentPrograms(vert_shader.handle, frag_shader.handle);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffers[current].handle);
+    glBindTextureUnit(0, input_texture);
+    glBindTextureUnit(1, history_texture);
+    glBindSampler(0, sampler.handle);
+    glBindSampler(1, sampler.handle);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glFrontFace(GL_CW);
+
+    const GLuint output_texture = textures[current].handle;
+    current ^= 1;
+    has_history = true;
+    return output_texture;
+}
+
+} // namespace OpenGL
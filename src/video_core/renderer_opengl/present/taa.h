@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "video_core/renderer_opengl/gl_resource_manager.h"
+
+namespace OpenGL {
+
+class ProgramManager;
+
+/// Blends every frame into the history of the previous ones, alternating between two textures
+class TAA {
+public:
+    explicit TAA(u32 width, u32 height);
+    ~TAA();
+
+    GLuint Draw(ProgramManager& program_manager, GLuint input_texture);
+
+private:
+    OGLProgram vert_shader;
+    OGLProgram frag_shader;
+    OGLSampler sampler;
+    std::array<OGLFramebuffer, 2> framebuffers;
+    std::array<OGLTexture, 2> textures;
+    size_t current{};
+    bool has_history{};
+};
+
+} // namespace OpenGL
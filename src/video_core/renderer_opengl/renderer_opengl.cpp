@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdlib>
 #include <memory>
@@ -121,6 +122,16 @@ RendererOpenGL::RendererOpenGL(Core::TelemetrySession& telemetry_session_,
         glEnableClientState(GL_VERTEX_ATTRIB_ARRAY_UNIFIED_NV);
         glEnableClientState(GL_ELEMENT_ARRAY_UNIFIED_NV);
     }
+    // Let the driver compile and link on as many threads as it wants
+    if (GLAD_GL_KHR_parallel_shader_compile) {
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    } else if (GLAD_GL_ARB_parallel_shader_compile) {
+        glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+    }
+    // Uniform buffers are bound by address, only the buffer cache binds them
+    if (device.HasUniformBufferUnifiedMemory()) {
+        glEnableClientState(GL_UNIFORM_BUFFER_UNIFIED_NV);
+    }
     blit_screen = std::make_unique<BlitScreen>(rasterizer, device_memory, state_tracker,
                                                program_manager, device, PresentFiltersForDisplay);
     blit_applet =
@@ -131,6 +142,9 @@ RendererOpenGL::RendererOpenGL(Core::TelemetrySession& telemetry_session_,
     glBindRenderbuffer(GL_RENDERBUFFER, capture_renderbuffer.handle);
     glRenderbufferStorage(GL_RENDERBUFFER, GL_SRGB8, VideoCore::Capture::LinearWidth,
                           VideoCore::Capture::LinearHeight);
+    if (device.UseAsynchronousPresent()) {
+        present_manager = std::make_unique<PresentManager>(emu_window, gpu);
+    }
 }
 
 RendererOpenGL::~RendererOpenGL() = default;
@@ -140,18 +154,41 @@ void RendererOpenGL::Composite(std::span<const Tegra::FramebufferConfig> framebu
         return;
     }
 
+    const auto composite_start = std::chrono::steady_clock::now();
+    PassTimer* const pass_timer = rasterizer.GetPassTimer();
+    if (pass_timer) {
+        pass_timer->EndFrame();
+        pass_timer->Mark(VideoCore::GpuPass::Present);
+    }
     RenderAppletCaptureLayer(framebuffers);
     RenderScreenshot(framebuffers);
 
-    state_tracker.BindFramebuffer(0);
-    blit_screen->DrawScreen(framebuffers, emu_window.GetFramebufferLayout(), false);
+    const auto layout = emu_window.GetFramebufferLayout();
+    if (present_manager) {
+        Frame* const frame = present_manager->GetRenderFrame(layout.width, layout.height);
+        state_tracker.BindFramebuffer(frame->framebuffer.handle);
+        blit_screen->DrawScreen(framebuffers, layout, false);
+        present_manager->Present(frame);
+    } else {
+        state_tracker.BindFramebuffer(0);
+        blit_screen->DrawScreen(framebuffers, layout, false);
+    }
+    if (pass_timer) {
+        // Keeps the time the GPU waits for the next frame out of the presentation passes
+        pass_timer->Mark(VideoCore::GpuPass::Idle);
+    }
 
     ++m_current_frame;
 
     gpu.RendererFrameEndNotify();
     rasterizer.TickFrame();
 
-    context->SwapBuffers();
+    if (!present_manager) {
+        context->SwapBuffers();
+        // The swap returns once the frame is queued to the display, which is as close to it being
+        // shown as OpenGL tells
+        gpu.RendererPresentLatencyNotify(std::chrono::steady_clock::now() - composite_start);
+    }
     render_window.OnFrameDisplayed();
 }
 
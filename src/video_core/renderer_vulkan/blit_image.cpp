@@ -5,6 +5,7 @@
 
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 
+#include "common/alignment.h"
 #include "common/settings.h"
 #include "video_core/host_shaders/blit_color_float_frag_spv.h"
 #include "video_core/host_shaders/convert_abgr8_to_d24s8_frag_spv.h"
@@ -15,6 +16,7 @@
 #include "video_core/host_shaders/convert_float_to_depth_frag_spv.h"
 #include "video_core/host_shaders/convert_s8d24_to_abgr8_frag_spv.h"
 #include "video_core/host_shaders/full_screen_triangle_vert_spv.h"
+#include "video_core/host_shaders/vulkan_blit_color_batch_vert_spv.h"
 #include "video_core/host_shaders/vulkan_blit_depth_stencil_frag_spv.h"
 #include "video_core/host_shaders/vulkan_color_clear_frag_spv.h"
 #include "video_core/host_shaders/vulkan_color_clear_vert_spv.h"
@@ -23,6 +25,7 @@
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_shader_util.h"
+#include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/renderer_vulkan/vk_state_tracker.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/surface.h"
@@ -58,6 +61,32 @@ constexpr VkDescriptorSetLayoutCreateInfo ONE_TEXTURE_DESCRIPTOR_SET_LAYOUT_CREA
     .bindingCount = 1,
     .pBindings = &TEXTURE_DESCRIPTOR_SET_LAYOUT_BINDING<0>,
 };
+constexpr std::array COLOR_BATCH_DESCRIPTOR_SET_LAYOUT_BINDINGS{
+    TEXTURE_DESCRIPTOR_SET_LAYOUT_BINDING<0>,
+    VkDescriptorSetLayoutBinding{
+        .binding = 1,
+        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+        .descriptorCount = 1,
+        .stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
+        .pImmutableSamplers = nullptr,
+    },
+};
+constexpr VkDescriptorSetLayoutCreateInfo COLOR_BATCH_DESCRIPTOR_SET_LAYOUT_CREATE_INFO{
+    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+    .pNext = nullptr,
+    .flags = 0,
+    .bindingCount = static_cast<u32>(COLOR_BATCH_DESCRIPTOR_SET_LAYOUT_BINDINGS.size()),
+    .pBindings = COLOR_BATCH_DESCRIPTOR_SET_LAYOUT_BINDINGS.data(),
+};
+constexpr DescriptorBankInfo COLOR_BATCH_DESCRIPTOR_BANK_INFO{
+    .uniform_buffers = 0,
+    .storage_buffers = 1,
+    .texture_buffers = 0,
+    .image_buffers = 0,
+    .textures = 1,
+    .images = 0,
+    .score = 2,
+};
 template <u32 num_textures>
 inline constexpr DescriptorBankInfo TEXTURE_DESCRIPTOR_BANK_INFO{
     .uniform_buffers = 0,
@@ -307,6 +336,48 @@ void UpdateTwoTexturesDescriptorSet(const Device& device, VkDescriptorSet descri
     device.GetLogical().UpdateDescriptorSets(write_descriptor_sets, nullptr);
 }
 
+void UpdateColorBatchDescriptorSet(const Device& device, VkDescriptorSet descriptor_set,
+                                   VkSampler sampler, VkImageView image_view, VkBuffer buffer,
+                                   VkDeviceSize offset, VkDeviceSize size) {
+    const VkDescriptorImageInfo image_info{
+        .sampler = sampler,
+        .imageView = image_view,
+        .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
+    };
+    const VkDescriptorBufferInfo buffer_info{
+        .buffer = buffer,
+        .offset = offset,
+        .range = size,
+    };
+    const std::array write_descriptor_sets{
+        VkWriteDescriptorSet{
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .pNext = nullptr,
+            .dstSet = descriptor_set,
+            .dstBinding = 0,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+            .pImageInfo = &image_info,
+            .pBufferInfo = nullptr,
+            .pTexelBufferView = nullptr,
+        },
+        VkWriteDescriptorSet{
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .pNext = nullptr,
+            .dstSet = descriptor_set,
+            .dstBinding = 1,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .pImageInfo = nullptr,
+            .pBufferInfo = &buffer_info,
+            .pTexelBufferView = nullptr,
+        },
+    };
+    device.GetLogical().UpdateDescriptorSets(write_descriptor_sets, nullptr);
+}
+
 void BindBlitState(vk::CommandBuffer cmdbuf, const Region2D& dst_region) {
     const VkOffset2D offset{
         .x = std::min(dst_region.start.x, dst_region.end.x),
@@ -349,6 +420,27 @@ void BindBlitState(vk::CommandBuffer cmdbuf, VkPipelineLayout layout, const Regi
     cmdbuf.PushConstants(layout, VK_SHADER_STAGE_VERTEX_BIT, push_constants);
 }
 
+static_assert(sizeof(BlitImageHelper::BlitRect) == sizeof(float) * 8,
+              "BlitRect must match the std430 layout of the shader");
+
+/// Places a blit in a render area the way the viewport of an unbatched blit would
+BlitImageHelper::BlitRect MakeBlitRect(const Region2D& dst_region, const Region2D& src_region,
+                                       VkExtent2D render_area) {
+    const auto to_ndc = [](s32 value, u32 size) {
+        return static_cast<float>(value) * 2.0f / static_cast<float>(size) - 1.0f;
+    };
+    const s32 min_x = std::min(dst_region.start.x, dst_region.end.x);
+    const s32 min_y = std::min(dst_region.start.y, dst_region.end.y);
+    const s32 max_x = std::max(dst_region.start.x, dst_region.end.x);
+    const s32 max_y = std::max(dst_region.start.y, dst_region.end.y);
+    return BlitImageHelper::BlitRect{
+        .dst = {to_ndc(min_x, render_area.width), to_ndc(min_y, render_area.height),
+                to_ndc(max_x, render_area.width), to_ndc(max_y, render_area.height)},
+        .src = {static_cast<float>(src_region.start.x), static_cast<float>(src_region.start.y),
+                static_cast<float>(src_region.end.x), static_cast<float>(src_region.end.y)},
+    };
+}
+
 VkExtent2D GetConversionExtent(const ImageView& src_image_view) {
     const auto& resolution = Settings::values.resolution_info;
     const bool is_rescaled = src_image_view.IsRescaled();
@@ -407,16 +499,22 @@ void BeginRenderPass(vk::CommandBuffer& cmdbuf, const Framebuffer* framebuffer)
 } // Anonymous namespace
 
 BlitImageHelper::BlitImageHelper(const Device& device_, Scheduler& scheduler_,
-                                 StateTracker& state_tracker_, DescriptorPool& descriptor_pool)
+                                 StateTracker& state_tracker_, StagingBufferPool& staging_pool_,
+                                 DescriptorPool& descriptor_pool)
     : device{device_}, scheduler{scheduler_}, state_tracker{state_tracker_},
+      staging_pool{staging_pool_},
       one_texture_set_layout(device.GetLogical().CreateDescriptorSetLayout(
           ONE_TEXTURE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO)),
       two_textures_set_layout(device.GetLogical().CreateDescriptorSetLayout(
           TWO_TEXTURES_DESCRIPTOR_SET_LAYOUT_CREATE_INFO)),
+      color_batch_set_layout(device.GetLogical().CreateDescriptorSetLayout(
+          COLOR_BATCH_DESCRIPTOR_SET_LAYOUT_CREATE_INFO)),
       one_texture_descriptor_allocator{
           descriptor_pool.Allocator(*one_texture_set_layout, TEXTURE_DESCRIPTOR_BANK_INFO<1>)},
       two_textures_descriptor_allocator{
           descriptor_pool.Allocator(*two_textures_set_layout, TEXTURE_DESCRIPTOR_BANK_INFO<2>)},
+      color_batch_descriptor_allocator{
+          descriptor_pool.Allocator(*color_batch_set_layout, COLOR_BATCH_DESCRIPTOR_BANK_INFO)},
       one_texture_pipeline_layout(device.GetLogical().CreatePipelineLayout(PipelineLayoutCreateInfo(
           one_texture_set_layout.address(),
           PUSH_CONSTANT_RANGE<VK_SHADER_STAGE_VERTEX_BIT, sizeof(PushConstants)>))),
@@ -426,7 +524,10 @@ BlitImageHelper::BlitImageHelper(const Device& device_, Scheduler& scheduler_,
               PUSH_CONSTANT_RANGE<VK_SHADER_STAGE_VERTEX_BIT, sizeof(PushConstants)>))),
       clear_color_pipeline_layout(device.GetLogical().CreatePipelineLayout(PipelineLayoutCreateInfo(
           nullptr, PUSH_CONSTANT_RANGE<VK_SHADER_STAGE_FRAGMENT_BIT, sizeof(float) * 4>))),
+      color_batch_pipeline_layout(device.GetLogical().CreatePipelineLayout(
+          PipelineLayoutCreateInfo(color_batch_set_layout.address(), {}))),
       full_screen_vert(BuildShader(device, FULL_SCREEN_TRIANGLE_VERT_SPV)),
+      blit_color_batch_vert(BuildShader(device, VULKAN_BLIT_COLOR_BATCH_VERT_SPV)),
       blit_color_to_color_frag(BuildShader(device, BLIT_COLOR_FLOAT_FRAG_SPV)),
       blit_depth_stencil_frag(BuildShader(device, VULKAN_BLIT_DEPTH_STENCIL_FRAG_SPV)),
       clear_color_vert(BuildShader(device, VULKAN_COLOR_CLEAR_VERT_SPV)),
@@ -453,22 +554,70 @@ void BlitImageHelper::BlitColor(const Framebuffer* dst_framebuffer, VkImageView
         .renderpass = dst_framebuffer->RenderPass(),
         .operation = operation,
     };
-    const VkPipelineLayout layout = *one_texture_pipeline_layout;
     const VkSampler sampler = is_linear ? *linear_sampler : *nearest_sampler;
-    const VkPipeline pipeline = FindOrEmplaceColorPipeline(key);
+    const VkPipeline pipeline = FindOrEmplaceColorBatchPipeline(key);
+    const VkExtent2D render_area = dst_framebuffer->RenderArea();
     scheduler.RequestRenderpass(dst_framebuffer);
-    scheduler.Record([this, dst_region, src_region, pipeline, layout, sampler,
-                      src_view](vk::CommandBuffer cmdbuf) {
+
+    // Join the previous blit's draw when nothing has been recorded after it, which also means the
+    // render pass is still the same
+    const bool can_batch = color_batch.draw != nullptr &&
+                           color_batch.serial == scheduler.RecordSerial() &&
+                           color_batch.pipeline == pipeline && color_batch.src_view == src_view &&
+                           color_batch.sampler == sampler &&
+                           color_batch.draw->instanceCount < MAX_BATCHED_BLITS;
+    if (!can_batch) {
+        BeginColorBatch(pipeline, src_view, sampler, render_area);
+    }
+    // The draw reads the instance count once the commands are submitted
+    color_batch.rects[color_batch.draw->instanceCount++] =
+        MakeBlitRect(dst_region, src_region, render_area);
+    scheduler.InvalidateState();
+}
+
+void BlitImageHelper::BeginColorBatch(VkPipeline pipeline, VkImageView src_view, VkSampler sampler,
+                                      VkExtent2D render_area) {
+    const VkDeviceSize alignment = device.GetStorageBufferAlignment();
+    const VkDeviceSize rects_size = MAX_BATCHED_BLITS * sizeof(BlitRect);
+    const StagingBufferRef ref = staging_pool.Request(
+        sizeof(VkDrawIndirectCommand) + alignment + rects_size, MemoryUsage::Upload);
+    const VkDeviceSize rects_offset =
+        Common::AlignUp(ref.offset + sizeof(VkDrawIndirectCommand), alignment);
+
+    auto* const draw = reinterpret_cast<VkDrawIndirectCommand*>(ref.mapped_span.data());
+    *draw = VkDrawIndirectCommand{
+        .vertexCount = 6,
+        .instanceCount = 0,
+        .firstVertex = 0,
+        .firstInstance = 0,
+    };
+    color_batch = ColorBatch{
+        .pipeline = pipeline,
+        .src_view = src_view,
+        .sampler = sampler,
+        .draw = draw,
+        .rects = reinterpret_cast<BlitRect*>(ref.mapped_span.data() + (rects_offset - ref.offset)),
+    };
+    const VkPipelineLayout layout = *color_batch_pipeline_layout;
+    const VkBuffer buffer = ref.buffer;
+    const VkDeviceSize draw_offset = ref.offset;
+    scheduler.Record([this, pipeline, layout, sampler, src_view, buffer, draw_offset, rects_offset,
+                      rects_size, render_area](vk::CommandBuffer cmdbuf) {
         // TODO: Barriers
-        const VkDescriptorSet descriptor_set = one_texture_descriptor_allocator.Commit();
-        UpdateOneTextureDescriptorSet(device, descriptor_set, sampler, src_view);
+        const VkDescriptorSet descriptor_set = color_batch_descriptor_allocator.Commit();
+        UpdateColorBatchDescriptorSet(device, descriptor_set, sampler, src_view, buffer,
+                                      rects_offset, rects_size);
         cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
         cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, descriptor_set,
                                   nullptr);
-        BindBlitState(cmdbuf, layout, dst_region, src_region);
-        cmdbuf.Draw(3, 1, 0, 0);
+        BindBlitState(cmdbuf, Region2D{
+                                  .start = {0, 0},
+                                  .end = {static_cast<s32>(render_area.width),
+                                          static_cast<s32>(render_area.height)},
+                              });
+        cmdbuf.DrawIndirect(buffer, draw_offset, 1, sizeof(VkDrawIndirectCommand));
     });
-    scheduler.InvalidateState();
+    color_batch.serial = scheduler.RecordSerial();
 }
 
 void BlitImageHelper::BlitColor(const Framebuffer* dst_framebuffer, VkImageView src_image_view,
@@ -733,8 +882,26 @@ VkPipeline BlitImageHelper::FindOrEmplaceColorPipeline(const BlitImagePipelineKe
         return *blit_color_pipelines[std::distance(blit_color_keys.begin(), it)];
     }
     blit_color_keys.push_back(key);
+    blit_color_pipelines.push_back(
+        MakeColorPipeline(key.renderpass, *full_screen_vert, *one_texture_pipeline_layout));
+    return *blit_color_pipelines.back();
+}
 
-    const std::array stages = MakeStages(*full_screen_vert, *blit_color_to_color_frag);
+VkPipeline BlitImageHelper::FindOrEmplaceColorBatchPipeline(const BlitImagePipelineKey& key) {
+    const auto it = std::ranges::find(blit_color_batch_keys, key);
+    if (it != blit_color_batch_keys.end()) {
+        return *blit_color_batch_pipelines[std::distance(blit_color_batch_keys.begin(), it)];
+    }
+    blit_color_batch_keys.push_back(key);
+    blit_color_batch_pipelines.push_back(MakeColorPipeline(
+        key.renderpass, *blit_color_batch_vert, *color_batch_pipeline_layout));
+    return *blit_color_batch_pipelines.back();
+}
+
+vk::Pipeline BlitImageHelper::MakeColorPipeline(VkRenderPass renderpass,
+                                                VkShaderModule vertex_shader,
+                                                VkPipelineLayout layout) {
+    const std::array stages = MakeStages(vertex_shader, *blit_color_to_color_frag);
     const VkPipelineColorBlendAttachmentState blend_attachment{
         .blendEnable = VK_FALSE,
         .srcColorBlendFactor = VK_BLEND_FACTOR_ZERO,
@@ -757,7 +924,7 @@ VkPipeline BlitImageHelper::FindOrEmplaceColorPipeline(const BlitImagePipelineKe
         .pAttachments = &blend_attachment,
         .blendConstants = {0.0f, 0.0f, 0.0f, 0.0f},
     };
-    blit_color_pipelines.push_back(device.GetLogical().CreateGraphicsPipeline({
+    return device.GetLogical().CreateGraphicsPipeline({
         .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
@@ -772,13 +939,12 @@ VkPipeline BlitImageHelper::FindOrEmplaceColorPipeline(const BlitImagePipelineKe
         .pDepthStencilState = nullptr,
         .pColorBlendState = &color_blend_create_info,
         .pDynamicState = &PIPELINE_DYNAMIC_STATE_CREATE_INFO,
-        .layout = *one_texture_pipeline_layout,
-        .renderPass = key.renderpass,
+        .layout = layout,
+        .renderPass = renderpass,
         .subpass = 0,
         .basePipelineHandle = VK_NULL_HANDLE,
         .basePipelineIndex = 0,
-    }));
-    return *blit_color_pipelines.back();
+    });
 }
 
 VkPipeline BlitImageHelper::FindOrEmplaceDepthStencilPipeline(const BlitImagePipelineKey& key) {
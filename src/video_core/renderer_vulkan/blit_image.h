@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/texture_cache/types.h"
@@ -17,6 +19,7 @@ using VideoCommon::Region2D;
 class Device;
 class Framebuffer;
 class ImageView;
+class StagingBufferPool;
 class StateTracker;
 class Scheduler;
 
@@ -39,10 +42,20 @@ struct BlitDepthStencilPipelineKey {
 
 class BlitImageHelper {
 public:
+    /// Placement of one blit drawn by a batch, read by the batch's vertex shader
+    struct BlitRect {
+        std::array<float, 4> dst;
+        std::array<float, 4> src;
+    };
+
     explicit BlitImageHelper(const Device& device, Scheduler& scheduler,
-                             StateTracker& state_tracker, DescriptorPool& descriptor_pool);
+                             StateTracker& state_tracker, StagingBufferPool& staging_pool,
+                             DescriptorPool& descriptor_pool);
     ~BlitImageHelper();
 
+    /// Blits a color image, consecutive blits to the same framebuffer from the same source with
+    /// the same filter and operation are drawn as instances of a single draw
+
     void BlitColor(const Framebuffer* dst_framebuffer, VkImageView src_image_view,
                    const Region2D& dst_region, const Region2D& src_region,
                    Tegra::Engines::Fermi2D::Filter filter,
@@ -83,6 +96,21 @@ public:
                            const Region2D& dst_region);
 
 private:
+    /// Blits drawn by the last color blit draw, appended to while it's the newest command
+    struct ColorBatch {
+        u64 serial = 0;
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        VkImageView src_view = VK_NULL_HANDLE;
+        VkSampler sampler = VK_NULL_HANDLE;
+        VkDrawIndirectCommand* draw = nullptr;
+        BlitRect* rects = nullptr;
+    };
+
+    static constexpr u32 MAX_BATCHED_BLITS = 64;
+
+    void BeginColorBatch(VkPipeline pipeline, VkImageView src_view, VkSampler sampler,
+                         VkExtent2D render_area);
+
     void Convert(VkPipeline pipeline, const Framebuffer* dst_framebuffer,
                  const ImageView& src_image_view);
 
@@ -91,6 +119,12 @@ private:
 
     [[nodiscard]] VkPipeline FindOrEmplaceColorPipeline(const BlitImagePipelineKey& key);
 
+    [[nodiscard]] VkPipeline FindOrEmplaceColorBatchPipeline(const BlitImagePipelineKey& key);
+
+    [[nodiscard]] vk::Pipeline MakeColorPipeline(VkRenderPass renderpass,
+                                                 VkShaderModule vertex_shader,
+                                                 VkPipelineLayout layout);
+
     [[nodiscard]] VkPipeline FindOrEmplaceDepthStencilPipeline(const BlitImagePipelineKey& key);
 
     [[nodiscard]] VkPipeline FindOrEmplaceClearColorPipeline(const BlitImagePipelineKey& key);
@@ -115,15 +149,20 @@ private:
     const Device& device;
     Scheduler& scheduler;
     StateTracker& state_tracker;
+    StagingBufferPool& staging_pool;
 
     vk::DescriptorSetLayout one_texture_set_layout;
     vk::DescriptorSetLayout two_textures_set_layout;
+    vk::DescriptorSetLayout color_batch_set_layout;
     DescriptorAllocator one_texture_descriptor_allocator;
     DescriptorAllocator two_textures_descriptor_allocator;
+    DescriptorAllocator color_batch_descriptor_allocator;
     vk::PipelineLayout one_texture_pipeline_layout;
     vk::PipelineLayout two_textures_pipeline_layout;
     vk::PipelineLayout clear_color_pipeline_layout;
+    vk::PipelineLayout color_batch_pipeline_layout;
     vk::ShaderModule full_screen_vert;
+    vk::ShaderModule blit_color_batch_vert;
     vk::ShaderModule blit_color_to_color_frag;
     vk::ShaderModule blit_depth_stencil_frag;
     vk::ShaderModule clear_color_vert;
@@ -141,6 +180,8 @@ private:
 
     std::vector<BlitImagePipelineKey> blit_color_keys;
     std::vector<vk::Pipeline> blit_color_pipelines;
+    std::vector<BlitImagePipelineKey> blit_color_batch_keys;
+    std::vector<vk::Pipeline> blit_color_batch_pipelines;
     std::vector<BlitImagePipelineKey> blit_depth_stencil_keys;
     std::vector<vk::Pipeline> blit_depth_stencil_pipelines;
     std::vector<BlitImagePipelineKey> clear_color_keys;
@@ -156,6 +197,8 @@ private:
     vk::Pipeline convert_d32f_to_abgr8_pipeline;
     vk::Pipeline convert_d24s8_to_abgr8_pipeline;
     vk::Pipeline convert_s8d24_to_abgr8_pipeline;
+
+    ColorBatch color_batch;
 };
 
 } // namespace Vulkan
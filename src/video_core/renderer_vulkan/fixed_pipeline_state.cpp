@@ -5,8 +5,8 @@
 #include <cstring>
 
 #include "common/bit_cast.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/fast_hash.h"
 #include "common/polyfill_ranges.h"
 #include "video_core/engines/draw_manager.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
@@ -51,6 +51,7 @@ void RefreshXfbState(VideoCommon::TransformFeedbackState& state, const Maxwell&
 void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFeatures& features) {
     const Maxwell& regs = maxwell3d.regs;
     const auto topology_ = maxwell3d.draw_manager->GetDrawState().topology;
+    const bool topology_changed = topology.Value() != topology_;
 
     raw1 = 0;
     extended_dynamic_state.Assign(features.has_extended_dynamic_state ? 1 : 0);
@@ -139,16 +140,36 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
             return static_cast<u16>(viewport.swizzle.raw);
         });
     }
-    dynamic_state.raw1 = 0;
-    dynamic_state.raw2 = 0;
+    // The dynamic state fields are only refreshed when their registers change. The dirty flags used
+    // here are the ones the rasterizer only checks when the state is dynamic, the fields of state
+    // that is dynamic are never written and stay zero.
+    auto& flags = maxwell3d.dirty.flags;
+    const auto take_dirty = [&flags](auto... indices) {
+        const bool is_dirty = (flags[indices] || ...);
+        ((flags[indices] = false), ...);
+        return is_dirty;
+    };
     if (!extended_dynamic_state) {
-        dynamic_state.Refresh(regs);
+        if (take_dirty(Dirty::CullMode, Dirty::FrontFace, Dirty::DepthCompareOp, Dirty::StencilOp,
+                       Dirty::DepthBoundsEnable, Dirty::DepthTestEnable, Dirty::DepthWriteEnable,
+                       Dirty::StencilTestEnable)) {
+            dynamic_state.Refresh(regs);
+        }
         std::ranges::transform(regs.vertex_streams, vertex_strides.begin(), [](const auto& array) {
             return static_cast<u16>(array.stride.Value());
         });
     }
     if (!extended_dynamic_state_2_extra) {
-        dynamic_state.Refresh2(regs, topology_, extended_dynamic_state_2);
+        bool is_dirty = take_dirty(Dirty::LogicOp);
+        if (!extended_dynamic_state_2) {
+            // Depth bias enables are picked by the primitive topology
+            is_dirty |= take_dirty(Dirty::PrimitiveRestartEnable, Dirty::RasterizerDiscardEnable,
+                                   Dirty::DepthBiasEnable) ||
+                        topology_changed;
+        }
+        if (is_dirty) {
+            dynamic_state.Refresh2(regs, topology_, extended_dynamic_state_2);
+        }
     }
     if (!extended_dynamic_state_3_blend) {
         if (maxwell3d.dirty.flags[Dirty::Blending]) {
@@ -159,7 +180,9 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
         }
     }
     if (!extended_dynamic_state_3_enables) {
-        dynamic_state.Refresh3(regs);
+        if (take_dirty(Dirty::LogicOpEnable, Dirty::DepthClampEnable)) {
+            dynamic_state.Refresh3(regs);
+        }
     }
     if (xfb_enabled) {
         RefreshXfbState(xfb_state, regs);
@@ -261,7 +284,7 @@ void FixedPipelineState::DynamicState::Refresh3(const Maxwell& regs) {
 }
 
 size_t FixedPipelineState::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
+    const u64 hash = Common::FastHash64(this, Size());
     return static_cast<size_t>(hash);
 }
 
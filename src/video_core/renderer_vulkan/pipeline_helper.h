@@ -10,6 +10,7 @@
 #include "common/common_types.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/shader_info.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/texture_cache/types.h"
@@ -28,12 +29,18 @@ public:
                num_descriptors <= device->MaxPushDescriptors();
     }
 
-    vk::DescriptorSetLayout CreateDescriptorSetLayout(bool use_push_descriptor) const {
+    vk::DescriptorSetLayout CreateDescriptorSetLayout(bool use_push_descriptor,
+                                                      bool use_descriptor_buffer = false) const {
         if (bindings.empty()) {
             return nullptr;
         }
-        const VkDescriptorSetLayoutCreateFlags flags =
-            use_push_descriptor ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+        VkDescriptorSetLayoutCreateFlags flags{};
+        if (use_push_descriptor) {
+            flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+        }
+        if (use_descriptor_buffer) {
+            flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+        }
         return device->GetLogical().CreateDescriptorSetLayout({
             .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
             .pNext = nullptr,
@@ -43,6 +50,12 @@ public:
         });
     }
 
+    DescriptorBufferLayout CreateDescriptorBufferLayout(
+        const DescriptorBuffer& descriptor_buffer,
+        VkDescriptorSetLayout descriptor_set_layout) const {
+        return descriptor_buffer.MakeLayout(descriptor_set_layout, bindings);
+    }
+
     vk::DescriptorUpdateTemplate CreateTemplate(VkDescriptorSetLayout descriptor_set_layout,
                                                 VkPipelineLayout pipeline_layout,
                                                 bool use_push_descriptor) const {
@@ -92,7 +105,12 @@ public:
         is_compute |= (stage & VK_SHADER_STAGE_COMPUTE_BIT) != 0;
 
         Add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, stage, info.constant_buffer_descriptors);
-        Add(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, stage, info.storage_buffers_descriptors);
+        if (!device->IsStorageBufferPointersEnabled()) {
+            Add(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, stage, info.storage_buffers_descriptors);
+        } else if (!info.storage_buffers_descriptors.empty()) {
+            // Storage buffer addresses are read from a table in a single uniform buffer
+            AddBinding(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, stage, 1);
+        }
         Add(VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, stage, info.texture_buffer_descriptors);
         Add(VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, stage, info.image_buffer_descriptors);
         Add(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, stage, info.texture_descriptors);
@@ -104,27 +122,31 @@ private:
     void Add(VkDescriptorType type, VkShaderStageFlags stage, const Descriptors& descriptors) {
         const size_t num{descriptors.size()};
         for (size_t i = 0; i < num; ++i) {
-            bindings.push_back({
-                .binding = binding,
-                .descriptorType = type,
-                .descriptorCount = descriptors[i].count,
-                .stageFlags = stage,
-                .pImmutableSamplers = nullptr,
-            });
-            entries.push_back({
-                .dstBinding = binding,
-                .dstArrayElement = 0,
-                .descriptorCount = descriptors[i].count,
-                .descriptorType = type,
-                .offset = offset,
-                .stride = sizeof(DescriptorUpdateEntry),
-            });
-            ++binding;
-            num_descriptors += descriptors[i].count;
-            offset += sizeof(DescriptorUpdateEntry);
+            AddBinding(type, stage, descriptors[i].count);
         }
     }
 
+    void AddBinding(VkDescriptorType type, VkShaderStageFlags stage, u32 count) {
+        bindings.push_back({
+            .binding = binding,
+            .descriptorType = type,
+            .descriptorCount = count,
+            .stageFlags = stage,
+            .pImmutableSamplers = nullptr,
+        });
+        entries.push_back({
+            .dstBinding = binding,
+            .dstArrayElement = 0,
+            .descriptorCount = count,
+            .descriptorType = type,
+            .offset = offset,
+            .stride = sizeof(DescriptorUpdateEntry),
+        });
+        ++binding;
+        num_descriptors += count;
+        offset += sizeof(DescriptorUpdateEntry);
+    }
+
     const Device* device{};
     bool is_compute{};
     boost::container::small_vector<VkDescriptorSetLayoutBinding, 32> bindings;
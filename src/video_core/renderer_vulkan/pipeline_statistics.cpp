@@ -2,11 +2,13 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <string_view>
+#include <utility>
 
 #include <fmt/format.h>
 
 #include "common/common_types.h"
 #include "common/logging/log.h"
+#include "video_core/pipeline_stats.h"
 #include "video_core/renderer_vulkan/pipeline_statistics.h"
 #include "video_core/vulkan_common/vulkan_device.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -28,18 +30,24 @@ static u64 GetUint64(const VkPipelineExecutableStatisticKHR& statistic) {
     }
 }
 
-PipelineStatistics::PipelineStatistics(const Device& device_) : device{device_} {}
+PipelineStatistics::PipelineStatistics(const Device& device_,
+                                       VideoCore::PipelineStats& pipeline_stats_)
+    : device{device_}, pipeline_stats{pipeline_stats_} {}
 
-void PipelineStatistics::Collect(VkPipeline pipeline) {
+void PipelineStatistics::Collect(VkPipeline pipeline, u64 hash, bool is_compute,
+                                 std::chrono::microseconds compile_time) {
     const auto& dev{device.GetLogical()};
     const std::vector properties{dev.GetPipelineExecutablePropertiesKHR(pipeline)};
     const u32 num_executables{static_cast<u32>(properties.size())};
+    std::vector<VideoCore::PipelineExecutableStats> executables;
     for (u32 executable = 0; executable < num_executables; ++executable) {
         const auto statistics{dev.GetPipelineExecutableStatisticsKHR(pipeline, executable)};
         if (statistics.empty()) {
             continue;
         }
         Stats stage_stats;
+        VideoCore::PipelineExecutableStats& report{executables.emplace_back()};
+        report.name = properties[executable].name;
         for (const auto& statistic : statistics) {
             const char* const name{statistic.name};
             if (name == "Binary Size"sv || name == "Code size"sv || name == "Instruction Count"sv) {
@@ -54,11 +62,33 @@ void PipelineStatistics::Collect(VkPipeline pipeline) {
                 stage_stats.branches_count = GetUint64(statistic);
             } else if (name == "Basic Block Count"sv) {
                 stage_stats.basic_block_count = GetUint64(statistic);
+            } else if (name == "Spilled SGPRs"sv || name == "Spilled VGPRs"sv ||
+                       name == "Spill Count"sv) {
+                report.spill_count += GetUint64(statistic);
+            } else if (name == "Scratch size"sv || name == "Scratch Memory Size"sv) {
+                report.scratch_size = GetUint64(statistic);
             }
         }
+        report.code_size = stage_stats.code_size;
+        report.register_count = stage_stats.register_count;
+        report.sgpr_count = stage_stats.sgpr_count;
+        report.vgpr_count = stage_stats.vgpr_count;
+        report.branches_count = stage_stats.branches_count;
+        report.basic_block_count = stage_stats.basic_block_count;
+
         std::scoped_lock lock{mutex};
         collected_stats.push_back(stage_stats);
     }
+    pipeline_stats.ReportCompilation(hash, is_compute, compile_time, std::move(executables));
+}
+
+void PipelineStatistics::CollectTranslation(u64 hash, bool is_compute,
+                                            std::chrono::microseconds time) {
+    pipeline_stats.ReportTranslation(hash, is_compute, time);
+}
+
+void PipelineStatistics::MarkUse(u64 hash) {
+    pipeline_stats.MarkUse(hash);
 }
 
 void PipelineStatistics::Report() const {
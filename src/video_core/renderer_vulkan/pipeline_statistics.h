@@ -3,22 +3,38 @@
 
 #pragma once
 
+#include <chrono>
 #include <mutex>
 #include <vector>
 
 #include "common/common_types.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
+namespace VideoCore {
+class PipelineStats;
+}
+
 namespace Vulkan {
 
 class Device;
 
 class PipelineStatistics {
 public:
-    explicit PipelineStatistics(const Device& device_);
+    explicit PipelineStatistics(const Device& device_, VideoCore::PipelineStats& pipeline_stats_);
+
+    /// Queries the driver statistics of a built pipeline and reports them to the frontend
+    /// @param hash         Hash of the pipeline cache key
+    /// @param compile_time Time the driver took to build the pipeline
+    void Collect(VkPipeline pipeline, u64 hash, bool is_compute,
+                 std::chrono::microseconds compile_time);
+
+    /// Records how long the guest shaders of a pipeline took to recompile
+    void CollectTranslation(u64 hash, bool is_compute, std::chrono::microseconds time);
 
-    void Collect(VkPipeline pipeline);
+    /// Counts a draw or dispatch using a pipeline
+    void MarkUse(u64 hash);
 
+    /// Logs the average statistics of the pipelines collected so far
     void Report() const;
 
 private:
@@ -32,6 +48,7 @@ private:
     };
 
     const Device& device;
+    VideoCore::PipelineStats& pipeline_stats;
     mutable std::mutex mutex;
     std::vector<Stats> collected_stats;
 };
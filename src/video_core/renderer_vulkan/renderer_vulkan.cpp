@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstring>
 #include <memory>
 #include <optional>
@@ -21,6 +22,7 @@
 #include "core/telemetry_session.h"
 #include "video_core/capture.h"
 #include "video_core/gpu.h"
+#include "video_core/gpu_timeline.h"
 #include "video_core/present.h"
 #include "video_core/renderer_vulkan/present/util.h"
 #include "video_core/renderer_vulkan/renderer_vulkan.h"
@@ -84,6 +86,15 @@ std::string BuildCommaSeparatedExtensions(
     return fmt::format("{}", fmt::join(available_extensions, ","));
 }
 
+std::unique_ptr<Scheduler> CreateAsyncPresentScheduler(const Device& device,
+                                                      StateTracker& state_tracker) {
+    // The passes wait for the guest work on its timeline semaphore
+    if (!device.HasAsyncPresentQueue() || !device.HasTimelineSemaphore()) {
+        return nullptr;
+    }
+    return std::make_unique<Scheduler>(device, state_tracker, SchedulerQueue::AsyncPresent);
+}
+
 } // Anonymous namespace
 
 Device CreateDevice(const vk::Instance& instance, const vk::InstanceDispatch& dld,
@@ -110,12 +121,14 @@ RendererVulkan::RendererVulkan(Core::TelemetrySession& telemetry_session_,
                                                       : vk::DebugUtilsMessenger{}),
       surface(CreateSurface(instance, render_window.GetWindowInfo())),
       device(CreateDevice(instance, dld, *surface)), memory_allocator(device), state_tracker(),
-      scheduler(device, state_tracker),
+      scheduler(device, state_tracker), present_state_tracker(),
+      async_present_scheduler(CreateAsyncPresentScheduler(device, present_state_tracker)),
+      present_scheduler(async_present_scheduler ? *async_present_scheduler : scheduler),
       swapchain(*surface, device, scheduler, render_window.GetFramebufferLayout().width,
                 render_window.GetFramebufferLayout().height),
-      present_manager(instance, render_window, device, memory_allocator, scheduler, swapchain,
-                      surface),
-      blit_swapchain(device_memory, device, memory_allocator, present_manager, scheduler,
+      present_manager(instance, render_window, device, memory_allocator, scheduler,
+                      present_scheduler, swapchain, surface, gpu),
+      blit_swapchain(device_memory, device, memory_allocator, present_manager, present_scheduler,
                      PresentFiltersForDisplay),
       blit_capture(device_memory, device, memory_allocator, present_manager, scheduler,
                    PresentFiltersForDisplay),
@@ -128,6 +141,17 @@ RendererVulkan::RendererVulkan(Core::TelemetrySession& telemetry_session_,
         turbo_mode.emplace(instance, dld);
         scheduler.RegisterOnSubmit([this] { turbo_mode->QueueSubmitted(); });
     }
+    // Only scaling up can be undone to shorten frames, scaling down already renders less
+    const auto& resolution = Settings::values.resolution_info;
+    if (Settings::values.use_dynamic_resolution.GetValue() && resolution.active &&
+        !resolution.downscale && FrameTimer::IsSupported(device)) {
+        frame_timer.emplace(device, scheduler);
+        scheduler.SetFrameTimer(&*frame_timer);
+    }
+    if (Settings::values.gpu_pass_timestamps.GetValue() && FrameTimer::IsSupported(device)) {
+        pass_timer.emplace(device, scheduler);
+        scheduler.SetPassTimer(&*pass_timer);
+    }
     Report();
 } catch (const vk::Exception& exception) {
     LOG_ERROR(Render_Vulkan, "Vulkan initialization failed with error: {}", exception.what());
@@ -136,6 +160,8 @@ RendererVulkan::RendererVulkan(Core::TelemetrySession& telemetry_session_,
 
 RendererVulkan::~RendererVulkan() {
     scheduler.RegisterOnSubmit([] {});
+    scheduler.SetFrameTimer(nullptr);
+    scheduler.SetPassTimer(nullptr);
     void(device.GetLogical().WaitIdle());
 }
 
@@ -148,6 +174,15 @@ void RendererVulkan::Composite(std::span<const Tegra::FramebufferConfig> framebu
         render_window.OnFrameDisplayed();
     };
 
+    if (frame_timer) {
+        UpdateDynamicResolution();
+    }
+    if (pass_timer) {
+        pass_timer->EndFrame();
+        // Captures, and the presentation passes when they are not sent to their own queue
+        scheduler.MarkGpuPass(VideoCore::GpuPass::Present);
+    }
+
     RenderAppletCaptureLayer(framebuffers);
 
     if (!render_window.IsShown()) {
@@ -156,16 +191,50 @@ void RendererVulkan::Composite(std::span<const Tegra::FramebufferConfig> framebu
 
     RenderScreenshot(framebuffers);
     Frame* frame = present_manager.GetRenderFrame();
+    blit_swapchain.SetDirectCopyAllowed(swapchain.GetImageFormat() ==
+                                            swapchain.GetImageViewFormat() &&
+                                        swapchain.IsAlphaOpaque());
     blit_swapchain.DrawToFrame(rasterizer, frame, framebuffers,
                                render_window.GetFramebufferLayout(), swapchain.GetImageCount(),
                                swapchain.GetImageViewFormat());
-    scheduler.Flush(*frame->render_ready);
+    if (async_present_scheduler) {
+        FlushAsyncPresent(*frame->render_ready);
+    } else {
+        scheduler.Flush(*frame->render_ready);
+    }
     present_manager.Present(frame);
 
     gpu.RendererFrameEndNotify();
     rasterizer.TickFrame();
 }
 
+void RendererVulkan::UpdateDynamicResolution() {
+    const std::optional<std::chrono::nanoseconds> gpu_time = frame_timer->EndFrame();
+    if (!gpu_time) {
+        return;
+    }
+    const u16 target_fps = Settings::values.dynamic_resolution_target.GetValue();
+    dynamic_resolution.AddFrame(*gpu_time, std::chrono::nanoseconds{1'000'000'000 / target_fps});
+    rasterizer.SetRescalingAllowed(dynamic_resolution.IsUpscaling());
+}
+
+void RendererVulkan::FlushAsyncPresent(VkSemaphore render_ready) {
+    // The passes read the guest framebuffers, so they wait for the work rendering them. Only the
+    // passes wait, the next frame's guest work starts while they run on the other queue.
+    const u64 guest_tick = scheduler.Flush();
+    present_scheduler.WaitTimeline(scheduler.GetMasterSemaphore().Handle(), guest_tick);
+    const u64 present_tick = present_scheduler.Flush(render_ready);
+
+    // Queueing a frame releases the guest buffer presented before it. Guest work from now on may
+    // render to it, so it waits for the previous passes to be done reading it, which they
+    // usually are by the time this frame's passes are submitted.
+    if (last_present_tick != 0) {
+        scheduler.WaitTimeline(present_scheduler.GetMasterSemaphore().Handle(),
+                               last_present_tick);
+    }
+    last_present_tick = present_tick;
+}
+
 void RendererVulkan::Report() const {
     using namespace Common::Literals;
     const std::string vendor_name{device.GetVendorName()};
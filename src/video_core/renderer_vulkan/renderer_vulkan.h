@@ -8,9 +8,12 @@
 #include <variant>
 
 #include "common/dynamic_library.h"
+#include "video_core/dynamic_resolution.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/renderer_base.h"
 #include "video_core/renderer_vulkan/vk_blit_screen.h"
+#include "video_core/renderer_vulkan/vk_frame_timer.h"
+#include "video_core/renderer_vulkan/vk_pass_timer.h"
 #include "video_core/renderer_vulkan/vk_present_manager.h"
 #include "video_core/renderer_vulkan/vk_rasterizer.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -61,6 +64,12 @@ public:
 private:
     void Report() const;
 
+    /// Submits the presentation passes on their own queue, synchronized with the guest work
+    void FlushAsyncPresent(VkSemaphore render_ready);
+
+    /// Scales the render targets from the GPU time of the frames the GPU finished
+    void UpdateDynamicResolution();
+
     vk::Buffer RenderToBuffer(std::span<const Tegra::FramebufferConfig> framebuffers,
                               const Layout::FramebufferLayout& layout, VkFormat format,
                               VkDeviceSize buffer_size);
@@ -82,6 +91,10 @@ private:
     MemoryAllocator memory_allocator;
     StateTracker state_tracker;
     Scheduler scheduler;
+    StateTracker present_state_tracker;
+    std::unique_ptr<Scheduler> async_present_scheduler;
+    Scheduler& present_scheduler; ///< Scheduler of the presentation passes, main one when inline
+    u64 last_present_tick{};
     Swapchain swapchain;
     PresentManager present_manager;
     BlitScreen blit_swapchain;
@@ -89,6 +102,9 @@ private:
     BlitScreen blit_applet;
     RasterizerVulkan rasterizer;
     std::optional<TurboMode> turbo_mode;
+    std::optional<FrameTimer> frame_timer;
+    std::optional<PassTimer> pass_timer;
+    VideoCommon::DynamicResolution dynamic_resolution;
 
     Frame applet_frame;
 };
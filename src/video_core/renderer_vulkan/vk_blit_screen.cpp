@@ -1,13 +1,18 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+
+#include "common/settings.h"
 #include "video_core/framebuffer_config.h"
 #include "video_core/present.h"
 #include "video_core/renderer_vulkan/present/filters.h"
 #include "video_core/renderer_vulkan/present/layer.h"
 #include "video_core/renderer_vulkan/vk_blit_screen.h"
 #include "video_core/renderer_vulkan/vk_present_manager.h"
+#include "video_core/renderer_vulkan/vk_rasterizer.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/vulkan_common/vulkan_device.h"
 
 namespace Vulkan {
 
@@ -106,8 +111,11 @@ void BlitScreen::DrawToFrame(RasterizerVulkan& rasterizer, Frame* frame,
                             window_size, window_adapt->GetDescriptorSetLayout(), filters);
     }
 
-    // Perform the draw
-    window_adapt->Draw(rasterizer, scheduler, image_index, layers, framebuffers, layout, frame);
+    // Perform the draw, unless the framebuffer can be copied as is
+    if (framebuffers.size() != 1 || !TryDirectCopy(rasterizer, frame, framebuffers[0], layout)) {
+        window_adapt->Draw(rasterizer, scheduler, image_index, layers, framebuffers, layout,
+                           frame);
+    }
 
     // Advance to next image
     if (++image_index >= image_count) {
@@ -115,6 +123,150 @@ void BlitScreen::DrawToFrame(RasterizerVulkan& rasterizer, Frame* frame,
     }
 }
 
+bool BlitScreen::TryDirectCopy(RasterizerVulkan& rasterizer, Frame* frame,
+                               const Tegra::FramebufferConfig& framebuffer,
+                               const Layout::FramebufferLayout& layout) {
+    if (!direct_copy_allowed) {
+        return false;
+    }
+    // Alpha is not forced to one and nothing is blended with the background
+    if (framebuffer.blending != Tegra::BlendMode::Opaque ||
+        framebuffer.transform_flags != Service::android::BufferTransformFlags::Unset) {
+        return false;
+    }
+    // Sampling at texel centers with these filters returns the texels unchanged
+    const Settings::ScalingFilter filter = filters.get_scaling_filter();
+    if ((filter != Settings::ScalingFilter::NearestNeighbor &&
+         filter != Settings::ScalingFilter::Bilinear) ||
+        filters.get_anti_aliasing() != Settings::AntiAliasing::None) {
+        return false;
+    }
+    const auto& screen = layout.screen;
+    if (screen.left != 0 || screen.top != 0 || screen.GetWidth() != frame->width ||
+        screen.GetHeight() != frame->height) {
+        return false;
+    }
+    // Rule out size mismatches before looking the image up, the lookup is repeated by the draw
+    const auto& resolution = Settings::values.resolution_info;
+    if (framebuffer.width != frame->width &&
+        resolution.ScaleUp(framebuffer.width) != frame->width) {
+        return false;
+    }
+    const Common::Rectangle<int>& crop = framebuffer.crop_rect;
+    const bool is_cropped = crop.left != 0 || crop.top != 0 ||
+                            crop.GetWidth() != static_cast<int>(framebuffer.width) ||
+                            crop.GetHeight() != static_cast<int>(framebuffer.height);
+    if (!crop.IsEmpty() && is_cropped) {
+        return false;
+    }
+
+    const auto texture_info = rasterizer.AccelerateDisplay(
+        framebuffer, framebuffer.address + framebuffer.offset, framebuffer.stride);
+    if (!texture_info || texture_info->format == VK_FORMAT_UNDEFINED ||
+        texture_info->width != framebuffer.width || texture_info->height != framebuffer.height ||
+        texture_info->scaled_width != frame->width ||
+        texture_info->scaled_height != frame->height) {
+        return false;
+    }
+    const VkFormat src_format = texture_info->format;
+    const VkFormat dst_format = swapchain_view_format;
+    const bool needs_blit = src_format != dst_format;
+    if (needs_blit &&
+        (!device.IsFormatSupported(src_format, VK_FORMAT_FEATURE_BLIT_SRC_BIT,
+                                   FormatType::Optimal) ||
+         !device.IsFormatSupported(dst_format, VK_FORMAT_FEATURE_BLIT_DST_BIT,
+                                   FormatType::Optimal))) {
+        return false;
+    }
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([src_image = texture_info->image, dst_image = *frame->image,
+                      width = frame->width, height = frame->height,
+                      needs_blit](vk::CommandBuffer cmdbuf) {
+        static constexpr VkImageSubresourceRange range{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = 1,
+            .baseArrayLayer = 0,
+            .layerCount = 1,
+        };
+        static constexpr VkImageSubresourceLayers layers{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .mipLevel = 0,
+            .baseArrayLayer = 0,
+            .layerCount = 1,
+        };
+        const std::array pre_barriers{
+            VkImageMemoryBarrier{
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                                 VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+                .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+                .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .image = src_image,
+                .subresourceRange = range,
+            },
+            VkImageMemoryBarrier{
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = 0,
+                .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .image = dst_image,
+                .subresourceRange = range,
+            },
+        };
+        // The frame is left as the window adapt pass leaves it
+        const VkImageMemoryBarrier post_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = dst_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               0, {}, {}, pre_barriers);
+        if (needs_blit) {
+            const VkImageBlit blit{
+                .srcSubresource = layers,
+                .srcOffsets = {{0, 0, 0},
+                               {static_cast<s32>(width), static_cast<s32>(height), 1}},
+                .dstSubresource = layers,
+                .dstOffsets = {{0, 0, 0},
+                               {static_cast<s32>(width), static_cast<s32>(height), 1}},
+            };
+            cmdbuf.BlitImage(src_image, VK_IMAGE_LAYOUT_GENERAL, dst_image,
+                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, blit, VK_FILTER_NEAREST);
+        } else {
+            const VkImageCopy copy{
+                .srcSubresource = layers,
+                .srcOffset = {0, 0, 0},
+                .dstSubresource = layers,
+                .dstOffset = {0, 0, 0},
+                .extent = {width, height, 1},
+            };
+            cmdbuf.CopyImage(src_image, VK_IMAGE_LAYOUT_GENERAL, dst_image,
+                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copy);
+        }
+        // Later writes to the guest image wait for the copy to finish reading it
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               0, post_barrier);
+    });
+    return true;
+}
+
 vk::Framebuffer BlitScreen::CreateFramebuffer(const Layout::FramebufferLayout& layout,
                                               VkImageView image_view,
                                               VkFormat current_view_format) {
@@ -39,6 +39,7 @@ struct Frame;
 struct FramebufferTextureInfo {
     VkImage image{};
     VkImageView image_view{};
+    VkFormat format{}; ///< Format of the image, undefined when the view reinterprets it
     u32 width{};
     u32 height{};
     u32 scaled_width{};
@@ -57,6 +58,13 @@ public:
                      const Layout::FramebufferLayout& layout, size_t current_swapchain_image_count,
                      VkFormat current_swapchain_view_format);
 
+    /// Allows copying a single layer matching the frame straight into it instead of drawing it.
+    /// Only valid when the frame's view and image formats are the same and the destination
+    /// ignores alpha, the copy doesn't force it to one like the opaque draw does.
+    void SetDirectCopyAllowed(bool allowed) {
+        direct_copy_allowed = allowed;
+    }
+
     [[nodiscard]] vk::Framebuffer CreateFramebuffer(const Layout::FramebufferLayout& layout,
                                                     VkImageView image_view,
                                                     VkFormat current_view_format);
@@ -64,6 +72,14 @@ public:
 private:
     void WaitIdle();
     void SetWindowAdaptPass();
+
+    /// Copies the framebuffer into the frame when it covers it exactly and no filter would
+    /// change it
+    /// @returns True when the frame was written, false when it has to be drawn
+    bool TryDirectCopy(RasterizerVulkan& rasterizer, Frame* frame,
+                       const Tegra::FramebufferConfig& framebuffer,
+                       const Layout::FramebufferLayout& layout);
+
     vk::Framebuffer CreateFramebuffer(const VkImageView& image_view, VkExtent2D extent,
                                       VkRenderPass render_pass);
 
@@ -76,6 +92,7 @@ private:
     std::size_t image_count{};
     std::size_t image_index{};
     VkFormat swapchain_view_format{};
+    bool direct_copy_allowed{};
 
     Settings::ScalingFilter scaling_filter{};
     std::unique_ptr<WindowAdaptPass> window_adapt{};
@@ -9,8 +9,13 @@
 
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 
+#include "common/alignment.h"
+#include "common/hash.h"
+#include "common/literals.h"
+#include "common/settings.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_sparse_image.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/vulkan_common/vulkan_device.h"
@@ -51,7 +56,7 @@ size_t BytesPerIndex(VkIndexType index_type) {
     }
 }
 
-vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allocator, u64 size) {
+VkBufferCreateInfo MakeBufferCreateInfo(const Device& device, u64 size) {
     VkBufferUsageFlags flags =
         VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
         VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT |
@@ -64,7 +69,7 @@ vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allo
     if (device.IsExtConditionalRendering()) {
         flags |= VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT;
     }
-    const VkBufferCreateInfo buffer_ci = {
+    return VkBufferCreateInfo{
         .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
@@ -74,7 +79,23 @@ vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allo
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
     };
-    return memory_allocator.CreateBuffer(buffer_ci, MemoryUsage::DeviceLocal);
+}
+
+using namespace Common::Literals;
+
+// Reservations cost address space only, but they are bounded to keep offsets 32-bit
+constexpr u64 MIN_RESERVED_BUFFER_SIZE = 64_MiB;
+constexpr u64 MAX_RESERVED_BUFFER_SIZE = 1_GiB;
+
+/// Bytes backing unbound storage buffers accessed through pointers, enough for a 64-bit atomic
+constexpr u64 NULL_STORAGE_BUFFER_SIZE = 16;
+
+/// Frames an unused index buffer conversion is kept for
+constexpr u64 CONVERTED_INDEX_LIFETIME = 60;
+
+vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allocator, u64 size) {
+    return memory_allocator.CreateBuffer(MakeBufferCreateInfo(device, size),
+                                         MemoryUsage::DeviceLocal);
 }
 } // Anonymous namespace
 
@@ -88,14 +109,69 @@ Buffer::Buffer(BufferCacheRuntime& runtime, VideoCommon::NullBufferParams null_p
     is_null = true;
 }
 
-Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_)
+Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_,
+               const VideoCommon::BufferCreateHints& hints)
     : VideoCommon::BufferBase(cpu_addr_, size_bytes_), device{&runtime.device},
-      buffer{CreateBuffer(*device, runtime.memory_allocator, SizeBytes())}, tracker{SizeBytes()} {
+      reserved_size{hints.reserve ? runtime.GetReservedBufferSize(size_bytes_) : 0},
+      tracker{std::max<u64>(size_bytes_, reserved_size)} {
+    if (hints.host_pointer) {
+        buffer = runtime.memory_allocator.ImportHostBuffer(
+            MakeBufferCreateInfo(*device, SizeBytes()), hints.host_pointer, host_memory);
+    }
+    if (buffer) {
+        MarkHostMemory();
+        reserved_size = 0;
+    } else if (reserved_size != 0) {
+        Reserve(runtime);
+    } else {
+        // Importing is best effort, fall back to a device local copy of guest memory
+        buffer = CreateBuffer(*device, runtime.memory_allocator, SizeBytes());
+    }
     if (runtime.device.HasDebuggingToolAttached()) {
         buffer.SetObjectNameEXT(fmt::format("Buffer 0x{:x}", CpuAddr()).c_str());
     }
 }
 
+void Buffer::Grow(u64 new_size_bytes) {
+    ASSERT(CanGrow(new_size_bytes));
+    CommitPages(new_size_bytes);
+    SetSizeBytes(new_size_bytes);
+}
+
+void Buffer::Reserve(BufferCacheRuntime& runtime) {
+    VkBufferCreateInfo buffer_ci = MakeBufferCreateInfo(*device, reserved_size);
+    buffer_ci.flags = VK_BUFFER_CREATE_SPARSE_BINDING_BIT | VK_BUFFER_CREATE_SPARSE_RESIDENCY_BIT;
+    buffer = runtime.memory_allocator.CreateSparseBuffer(buffer_ci);
+    memory_allocator = &runtime.memory_allocator;
+    sparse_binder = runtime.scheduler.GetSparseBinder();
+    page_requirements = device->GetLogical().GetBufferMemoryRequirements(*buffer);
+    CommitPages(SizeBytes());
+}
+
+void Buffer::CommitPages(u64 end) {
+    const u64 begin = committed_size;
+    end = Common::AlignUp(end, page_requirements.alignment);
+    if (end <= begin) {
+        return;
+    }
+    // Pages are only ever added, the committed range grows with a single allocation per step
+    VkMemoryRequirements requirements = page_requirements;
+    requirements.size = end - begin;
+    const MemoryCommit& commit =
+        commits.emplace_back(memory_allocator->Commit(requirements, MemoryUsage::DeviceLocal));
+    sparse_binder->BindBuffer(SparseBufferBinds{
+        .buffer = *buffer,
+        .binds{VkSparseMemoryBind{
+            .resourceOffset = begin,
+            .size = end - begin,
+            .memory = commit.Memory(),
+            .memoryOffset = commit.Offset(),
+            .flags = 0,
+        }},
+    });
+    committed_size = end;
+}
+
 VkBufferView Buffer::View(u32 offset, u32 size, VideoCore::Surface::PixelFormat format) {
     if (!device) {
         // Null buffer supported, return a null descriptor
@@ -128,6 +204,29 @@ VkBufferView Buffer::View(u32 offset, u32 size, VideoCore::Surface::PixelFormat
     return *views.back().handle;
 }
 
+TexelBufferAddress Buffer::TexelAddress(u32 offset, u32 size,
+                                       VideoCore::Surface::PixelFormat format) {
+    if (!device || is_null) {
+        // Descriptor buffers require null descriptors, return one
+        return {};
+    }
+    return TexelBufferAddress{
+        .address = DeviceAddress() + offset,
+        .range = size,
+        .format = MaxwellToVK::SurfaceFormat(*device, FormatType::Buffer, false, format).format,
+    };
+}
+
+VkDeviceAddress Buffer::DeviceAddress() {
+    if (!device || is_null) {
+        return 0;
+    }
+    if (device_address == 0) {
+        device_address = device->GetLogical().GetBufferDeviceAddress(*buffer);
+    }
+    return device_address;
+}
+
 class QuadIndexBuffer {
 public:
     QuadIndexBuffer(const Device& device_, MemoryAllocator& memory_allocator_,
@@ -327,8 +426,10 @@ BufferCacheRuntime::BufferCacheRuntime(const Device& device_, MemoryAllocator& m
                                        DescriptorPool& descriptor_pool)
     : device{device_}, memory_allocator{memory_allocator_}, scheduler{scheduler_},
       staging_pool{staging_pool_}, guest_descriptor_queue{guest_descriptor_queue_},
+      upload_ring(device, memory_allocator, scheduler),
       quad_index_pass(device, scheduler, descriptor_pool, staging_pool,
-                      compute_pass_descriptor_queue) {
+                      compute_pass_descriptor_queue),
+      layout_copy_pass(device, scheduler, descriptor_pool, compute_pass_descriptor_queue) {
     if (device.GetDriverID() != VK_DRIVER_ID_QUALCOMM_PROPRIETARY) {
         // TODO: FixMe: Uint8Pass compute shader does not build on some Qualcomm drivers.
         uint8_pass = std::make_unique<Uint8Pass>(device, scheduler, descriptor_pool, staging_pool,
@@ -338,9 +439,22 @@ BufferCacheRuntime::BufferCacheRuntime(const Device& device_, MemoryAllocator& m
                                                                      scheduler_, staging_pool_);
     quad_strip_index_buffer = std::make_shared<QuadStripIndexBuffer>(device_, memory_allocator_,
                                                                      scheduler_, staging_pool_);
+    if (device.IsStorageBufferPointersEnabled()) {
+        null_storage_buffer = CreateBuffer(device, memory_allocator, NULL_STORAGE_BUFFER_SIZE);
+        null_storage_buffer_address =
+            device.GetLogical().GetBufferDeviceAddress(*null_storage_buffer);
+        scheduler.RequestOutsideRenderPassOperationContext();
+        scheduler.Record([buffer = *null_storage_buffer](vk::CommandBuffer cmdbuf) {
+            cmdbuf.FillBuffer(buffer, 0, VK_WHOLE_SIZE, 0);
+        });
+    }
 }
 
 StagingBufferRef BufferCacheRuntime::UploadStagingBuffer(size_t size) {
+    // Small uploads are served from the ring to keep them clear of large uploads
+    if (const std::optional<StagingBufferRef> ref = upload_ring.Request(size)) {
+        return *ref;
+    }
     return staging_pool.Request(size, MemoryUsage::Upload);
 }
 
@@ -360,6 +474,10 @@ u64 BufferCacheRuntime::GetDeviceMemoryUsage() const {
     return device.GetDeviceMemoryUsage();
 }
 
+u64 BufferCacheRuntime::GetDeviceMemoryBudget() const {
+    return device.GetDeviceMemoryBudget();
+}
+
 bool BufferCacheRuntime::CanReportMemoryUsage() const {
     return device.CanReportMemoryUsage();
 }
@@ -368,10 +486,41 @@ u32 BufferCacheRuntime::GetStorageBufferAlignment() const {
     return static_cast<u32>(device.GetStorageBufferAlignment());
 }
 
+bool BufferCacheRuntime::CanImportHostMemory() const {
+    return device.IsExtExternalMemoryHostSupported() &&
+           Settings::values.use_host_memory_import.GetValue();
+}
+
+u64 BufferCacheRuntime::GetHostMemoryImportAlignment() const {
+    return device.GetMinImportedHostPointerAlignment();
+}
+
+u64 BufferCacheRuntime::GetReservedBufferSize(u64 size) const {
+    if (!Settings::values.use_reserved_buffers.GetValue() || !scheduler.GetSparseBinder() ||
+        !SparseBinder::IsBufferSupported(device) || size >= MAX_RESERVED_BUFFER_SIZE) {
+        return 0;
+    }
+    return std::clamp(size * 4, MIN_RESERVED_BUFFER_SIZE, MAX_RESERVED_BUFFER_SIZE);
+}
+
 void BufferCacheRuntime::TickFrame(Common::SlotVector<Buffer>& slot_buffers) noexcept {
     for (auto it = slot_buffers.begin(); it != slot_buffers.end(); it++) {
         it->ResetUsageTracking();
     }
+    upload_ring.TickFrame();
+
+    ++frame_index;
+    converted_indices_garbage.Tick();
+    std::erase_if(converted_indices, [this](auto& pair) {
+        ConvertedIndexEntry& entry = pair.second;
+        if (entry.last_used_frame + CONVERTED_INDEX_LIFETIME >= frame_index) {
+            return false;
+        }
+        if (entry.buffer) {
+            converted_indices_garbage.Push(std::move(entry.buffer));
+        }
+        return true;
+    });
 }
 
 void BufferCacheRuntime::Finish() {
@@ -412,7 +561,9 @@ void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
     // Measuring a popular game, this number never exceeds the specified size once data is warmed up
     boost::container::small_vector<VkBufferCopy, 8> vk_copies(copies.size());
     std::ranges::transform(copies, vk_copies.begin(), MakeBufferCopy);
-    if (src_buffer == staging_pool.StreamBuf() && can_reorder_upload) {
+    const bool is_stream_buffer =
+        src_buffer == staging_pool.StreamBuf() || src_buffer == upload_ring.Handle();
+    if (is_stream_buffer && can_reorder_upload) {
         scheduler.RecordWithUploadBuffer([src_buffer, dst_buffer, vk_copies](
                                              vk::CommandBuffer, vk::CommandBuffer upload_cmdbuf) {
             upload_cmdbuf.CopyBuffer(src_buffer, dst_buffer, vk_copies);
@@ -489,21 +640,92 @@ void BufferCacheRuntime::ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t si
     });
 }
 
+void BufferCacheRuntime::LayoutCopy(VkBuffer dest_buffer, u32 dest_offset, VkBuffer src_buffer,
+                                    u32 src_offset, const Tegra::DMA::LayoutCopy& copy) {
+    layout_copy_pass.Copy(dest_buffer, dest_offset, src_buffer, src_offset, copy);
+}
+
+template <typename Func>
+std::pair<VkBuffer, VkDeviceSize> BufferCacheRuntime::ConvertIndexBuffer(
+    const ConvertedIndexKey& key, const Buffer& buffer, size_t size, Func&& assemble) {
+    // Imported buffers change with guest memory without going through the buffer cache
+    if (size != 0 && buffer.Handle() != VK_NULL_HANDLE && !buffer.IsHostMemory()) {
+        const auto [it, is_new] = converted_indices.try_emplace(key);
+        ConvertedIndexEntry& entry = it->second;
+        entry.last_used_frame = frame_index;
+        if (!is_new && entry.modification_tick == buffer.ModificationTick()) {
+            if (!entry.buffer) {
+                // The same conversion was made again from unmodified data, keep it this time
+                entry.buffer = memory_allocator.CreateBuffer(
+                    VkBufferCreateInfo{
+                        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                        .pNext = nullptr,
+                        .flags = 0,
+                        .size = size,
+                        .usage =
+                            VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+                        .queueFamilyIndexCount = 0,
+                        .pQueueFamilyIndices = nullptr,
+                    },
+                    MemoryUsage::DeviceLocal);
+                assemble(*entry.buffer, 0);
+            }
+            return {*entry.buffer, 0};
+        }
+        if (entry.buffer) {
+            converted_indices_garbage.Push(std::move(entry.buffer));
+        }
+        entry.modification_tick = buffer.ModificationTick();
+    }
+    const StagingBufferRef staging = staging_pool.Request(size, MemoryUsage::DeviceLocal);
+    assemble(staging.buffer, staging.offset);
+    return {staging.buffer, staging.offset};
+}
+
+size_t BufferCacheRuntime::ConvertedIndexKeyHash::operator()(
+    const ConvertedIndexKey& key) const noexcept {
+    size_t seed = std::hash<VkBuffer>{}(key.buffer);
+    boost::hash_combine(seed, key.offset);
+    boost::hash_combine(seed, key.num_indices);
+    boost::hash_combine(seed, key.base_vertex);
+    boost::hash_combine(seed, static_cast<u32>(key.index_format));
+    boost::hash_combine(seed, static_cast<u32>(key.topology));
+    return seed;
+}
+
 void BufferCacheRuntime::BindIndexBuffer(PrimitiveTopology topology, IndexFormat index_format,
-                                         u32 base_vertex, u32 num_indices, VkBuffer buffer,
+                                         u32 base_vertex, u32 num_indices, const Buffer& buffer,
                                          u32 offset, [[maybe_unused]] u32 size) {
     VkIndexType vk_index_type = MaxwellToVK::IndexFormat(index_format);
     VkDeviceSize vk_offset = offset;
     VkBuffer vk_buffer = buffer;
+    const ConvertedIndexKey key{
+        .buffer = vk_buffer,
+        .offset = offset,
+        .num_indices = num_indices,
+        .base_vertex = base_vertex,
+        .index_format = index_format,
+        .topology = topology,
+    };
     if (topology == PrimitiveTopology::Quads || topology == PrimitiveTopology::QuadStrip) {
         vk_index_type = VK_INDEX_TYPE_UINT32;
-        std::tie(vk_buffer, vk_offset) =
-            quad_index_pass.Assemble(index_format, num_indices, base_vertex, buffer, offset,
-                                     topology == PrimitiveTopology::QuadStrip);
+        const bool is_strip = topology == PrimitiveTopology::QuadStrip;
+        std::tie(vk_buffer, vk_offset) = ConvertIndexBuffer(
+            key, buffer, QuadIndexedPass::GetOutputSize(num_indices, is_strip),
+            [&](VkBuffer dst_buffer, VkDeviceSize dst_offset) {
+                quad_index_pass.Assemble(index_format, num_indices, base_vertex, buffer, offset,
+                                         is_strip, dst_buffer, dst_offset);
+            });
     } else if (vk_index_type == VK_INDEX_TYPE_UINT8_EXT && !device.IsExtIndexTypeUint8Supported()) {
         vk_index_type = VK_INDEX_TYPE_UINT16;
         if (uint8_pass) {
-            std::tie(vk_buffer, vk_offset) = uint8_pass->Assemble(num_indices, buffer, offset);
+            std::tie(vk_buffer, vk_offset) =
+                ConvertIndexBuffer(key, buffer, Uint8Pass::GetOutputSize(num_indices),
+                                   [&](VkBuffer dst_buffer, VkDeviceSize dst_offset) {
+                                       uint8_pass->Assemble(num_indices, buffer, offset,
+                                                            dst_buffer, dst_offset);
+                                   });
         }
     }
     if (vk_buffer == VK_NULL_HANDLE) {
@@ -635,6 +857,42 @@ void BufferCacheRuntime::BindTransformFeedbackBuffers(VideoCommon::HostBindings<
     });
 }
 
+void BufferCacheRuntime::BindStorageBuffer(Buffer& buffer, u32 offset, u32 size,
+                                           [[maybe_unused]] bool is_written) {
+    if (!device.IsStorageBufferPointersEnabled()) {
+        BindBuffer(buffer, offset, size);
+        return;
+    }
+    const VkDeviceAddress address = buffer.DeviceAddress();
+    if (address == 0) {
+        // Shaders clamp accesses to the first element of buffers with a size of zero
+        storage_buffer_addresses.push_back({
+            .address = null_storage_buffer_address,
+            .size = 0,
+            .padding = 0,
+        });
+        return;
+    }
+    storage_buffer_addresses.push_back({
+        .address = address + offset,
+        .size = size,
+        .padding = 0,
+    });
+}
+
+void BufferCacheRuntime::FinishStorageBuffers() {
+    if (storage_buffer_addresses.empty()) {
+        return;
+    }
+    using Shader::Backend::SPIRV::StorageBufferAddress;
+    const u32 size =
+        static_cast<u32>(storage_buffer_addresses.size() * sizeof(StorageBufferAddress));
+    const StagingBufferRef ref = UploadStagingBuffer(size);
+    std::memcpy(ref.mapped_span.data(), storage_buffer_addresses.data(), size);
+    BindBuffer(ref.buffer, static_cast<u32>(ref.offset), size);
+    storage_buffer_addresses.clear();
+}
+
 void BufferCacheRuntime::ReserveNullBuffer() {
     if (!null_buffer) {
         null_buffer = CreateNullBuffer();
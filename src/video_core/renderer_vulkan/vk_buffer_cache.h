@@ -3,13 +3,19 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <utility>
+
+#include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "video_core/buffer_cache/buffer_cache_base.h"
 #include "video_core/buffer_cache/memory_tracker_base.h"
 #include "video_core/buffer_cache/usage_tracker.h"
+#include "video_core/delayed_destruction_ring.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/renderer_vulkan/vk_upload_ring.h"
 #include "video_core/surface.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -19,6 +25,7 @@ namespace Vulkan {
 class Device;
 class DescriptorPool;
 class Scheduler;
+class SparseBinder;
 struct HostVertexBinding;
 
 class BufferCacheRuntime;
@@ -26,10 +33,18 @@ class BufferCacheRuntime;
 class Buffer : public VideoCommon::BufferBase {
 public:
     explicit Buffer(BufferCacheRuntime&, VideoCommon::NullBufferParams null_params);
-    explicit Buffer(BufferCacheRuntime& runtime, VAddr cpu_addr_, u64 size_bytes_);
+    explicit Buffer(BufferCacheRuntime& runtime, VAddr cpu_addr_, u64 size_bytes_,
+                    const VideoCommon::BufferCreateHints& hints = {});
 
     [[nodiscard]] VkBufferView View(u32 offset, u32 size, VideoCore::Surface::PixelFormat format);
 
+    /// Returns the texel buffer descriptor data used by descriptor buffers in place of a view
+    [[nodiscard]] TexelBufferAddress TexelAddress(u32 offset, u32 size,
+                                                  VideoCore::Surface::PixelFormat format);
+
+    /// Returns the device address of the buffer, zero for null buffers
+    [[nodiscard]] VkDeviceAddress DeviceAddress();
+
     [[nodiscard]] VkBuffer Handle() const noexcept {
         return *buffer;
     }
@@ -50,6 +65,15 @@ public:
         return *buffer;
     }
 
+    /// Returns true when the buffer can be extended in place to the given size
+    [[nodiscard]] bool CanGrow(u64 new_size_bytes) const noexcept {
+        return new_size_bytes <= reserved_size;
+    }
+
+    /// Extends the buffer in place, binding memory to the new range
+    /// @pre CanGrow returns true
+    void Grow(u64 new_size_bytes);
+
 private:
     struct BufferView {
         u32 offset;
@@ -58,9 +82,23 @@ private:
         vk::BufferView handle;
     };
 
+    /// Creates a sparse buffer over the reserved range and binds memory to its used part
+    void Reserve(BufferCacheRuntime& runtime);
+
+    /// Binds memory up to the given offset
+    void CommitPages(u64 end);
+
     const Device* device{};
+    MemoryAllocator* memory_allocator{};
+    SparseBinder* sparse_binder{};
+    u64 reserved_size = 0;  ///< Bytes reserved for the buffer to grow into, zero when not reserved
+    u64 committed_size = 0; ///< Bytes of the reserved range backed by memory
+    VkMemoryRequirements page_requirements{};
+    vk::DeviceMemory host_memory;
+    std::vector<MemoryCommit> commits;
     vk::Buffer buffer;
     std::vector<BufferView> views;
+    VkDeviceAddress device_address{};
     VideoCommon::UsageTracker tracker;
     bool is_null{};
 };
@@ -89,10 +127,21 @@ public:
 
     u64 GetDeviceMemoryUsage() const;
 
+    u64 GetDeviceMemoryBudget() const;
+
     bool CanReportMemoryUsage() const;
 
     u32 GetStorageBufferAlignment() const;
 
+    /// Returns true when guest memory can be imported as buffers.
+    bool CanImportHostMemory() const;
+
+    /// Returns the alignment required for imported guest memory.
+    u64 GetHostMemoryImportAlignment() const;
+
+    /// Returns the bytes to reserve for a buffer that may grow, zero when it can't be reserved.
+    u64 GetReservedBufferSize(u64 size) const;
+
     [[nodiscard]] StagingBufferRef UploadStagingBuffer(size_t size);
 
     [[nodiscard]] StagingBufferRef DownloadStagingBuffer(size_t size, bool deferred = false);
@@ -111,8 +160,11 @@ public:
 
     void ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t size, u32 value);
 
-    void BindIndexBuffer(PrimitiveTopology topology, IndexFormat index_format, u32 num_indices,
-                         u32 base_vertex, VkBuffer buffer, u32 offset, u32 size);
+    void LayoutCopy(VkBuffer dest_buffer, u32 dest_offset, VkBuffer src_buffer, u32 src_offset,
+                    const Tegra::DMA::LayoutCopy& copy);
+
+    void BindIndexBuffer(PrimitiveTopology topology, IndexFormat index_format, u32 base_vertex,
+                         u32 num_indices, const Buffer& buffer, u32 offset, u32 size);
 
     void BindQuadIndexBuffer(PrimitiveTopology topology, u32 first, u32 count);
 
@@ -126,7 +178,7 @@ public:
 
     std::span<u8> BindMappedUniformBuffer([[maybe_unused]] size_t stage,
                                           [[maybe_unused]] u32 binding_index, u32 size) {
-        const StagingBufferRef ref = staging_pool.Request(size, MemoryUsage::Upload);
+        const StagingBufferRef ref = UploadStagingBuffer(size);
         BindBuffer(ref.buffer, static_cast<u32>(ref.offset), size);
         return ref.mapped_span;
     }
@@ -135,21 +187,56 @@ public:
         BindBuffer(buffer, offset, size);
     }
 
-    void BindStorageBuffer(VkBuffer buffer, u32 offset, u32 size,
-                           [[maybe_unused]] bool is_written) {
-        BindBuffer(buffer, offset, size);
-    }
+    void BindStorageBuffer(Buffer& buffer, u32 offset, u32 size, bool is_written);
+
+    /// Binds the address table of the storage buffers bound since the last call, when storage
+    /// buffers are accessed through pointers
+    void FinishStorageBuffers();
 
     void BindTextureBuffer(Buffer& buffer, u32 offset, u32 size,
                            VideoCore::Surface::PixelFormat format) {
+        if (guest_descriptor_queue.GetDescriptorBuffer()) {
+            const TexelBufferAddress texel{buffer.TexelAddress(offset, size, format)};
+            guest_descriptor_queue.AddTexelBufferAddress(texel.address, texel.range, texel.format);
+            return;
+        }
         guest_descriptor_queue.AddTexelBuffer(buffer.View(offset, size, format));
     }
 
 private:
+    /// Identifies an index buffer conversion made by a compute pass
+    struct ConvertedIndexKey {
+        VkBuffer buffer;
+        u32 offset;
+        u32 num_indices;
+        u32 base_vertex;
+        IndexFormat index_format;
+        PrimitiveTopology topology;
+
+        bool operator==(const ConvertedIndexKey&) const noexcept = default;
+    };
+
+    struct ConvertedIndexKeyHash {
+        size_t operator()(const ConvertedIndexKey& key) const noexcept;
+    };
+
+    struct ConvertedIndexEntry {
+        vk::Buffer buffer;     ///< Kept conversion, created once the same conversion repeats
+        u64 modification_tick; ///< Modification tick of the source buffer when converted
+        u64 last_used_frame;
+    };
+
     void BindBuffer(VkBuffer buffer, u32 offset, u32 size) {
         guest_descriptor_queue.AddBuffer(buffer, offset, size);
     }
 
+    /// Returns the converted indices for key, reusing a kept conversion when the source buffer
+    /// hasn't been modified since it was made
+    template <typename Func>
+    std::pair<VkBuffer, VkDeviceSize> ConvertIndexBuffer(const ConvertedIndexKey& key,
+                                                         const Buffer& buffer, size_t size,
+                                                         Func&& assemble);
+
     void ReserveNullBuffer();
     vk::Buffer CreateNullBuffer();
 
@@ -158,14 +245,26 @@ private:
     Scheduler& scheduler;
     StagingBufferPool& staging_pool;
     GuestDescriptorQueue& guest_descriptor_queue;
+    UploadRing upload_ring;
 
     std::shared_ptr<QuadArrayIndexBuffer> quad_array_index_buffer;
     std::shared_ptr<QuadStripIndexBuffer> quad_strip_index_buffer;
 
     vk::Buffer null_buffer;
 
+    /// Storage buffers accessed through pointers, uploaded as a table once they are all bound
+    std::vector<Shader::Backend::SPIRV::StorageBufferAddress> storage_buffer_addresses;
+    vk::Buffer null_storage_buffer;
+    VkDeviceAddress null_storage_buffer_address{};
+
     std::unique_ptr<Uint8Pass> uint8_pass;
     QuadIndexedPass quad_index_pass;
+    DmaLayoutCopyPass layout_copy_pass;
+
+    std::unordered_map<ConvertedIndexKey, ConvertedIndexEntry, ConvertedIndexKeyHash>
+        converted_indices;
+    VideoCommon::DelayedDestructionRing<vk::Buffer, 8> converted_indices_garbage;
+    u64 frame_index = 0;
 };
 
 struct BufferCacheParams {
@@ -182,6 +281,9 @@ struct BufferCacheParams {
     static constexpr bool USE_MEMORY_MAPS = true;
     static constexpr bool SEPARATE_IMAGE_BUFFER_BINDINGS = false;
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = true;
+    static constexpr bool HAS_HOST_MEMORY_IMPORT = true;
+    static constexpr bool HAS_RESERVED_BUFFERS = true;
+    static constexpr bool HAS_STORAGE_BUFFER_TABLE = true;
 };
 
 using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
@@ -11,10 +11,15 @@
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/surface.h"
 #include "video_core/texture_cache/types.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
+namespace Tegra::DMA {
+struct LayoutCopy;
+}
+
 namespace VideoCommon {
 struct SwizzleParameters;
 }
@@ -61,6 +66,13 @@ public:
     std::pair<VkBuffer, VkDeviceSize> Assemble(u32 num_vertices, VkBuffer src_buffer,
                                                u32 src_offset);
 
+    /// Assemble uint8 indices into the given uint16 index buffer
+    void Assemble(u32 num_vertices, VkBuffer src_buffer, u32 src_offset, VkBuffer dst_buffer,
+                  VkDeviceSize dst_offset);
+
+    /// Returns the size in bytes of the indices assembled from num_vertices indices
+    [[nodiscard]] static size_t GetOutputSize(u32 num_vertices);
+
 private:
     Scheduler& scheduler;
     StagingBufferPool& staging_buffer_pool;
@@ -79,6 +91,14 @@ public:
         Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format, u32 num_vertices,
         u32 base_vertex, VkBuffer src_buffer, u32 src_offset, bool is_strip);
 
+    /// Assemble the triangle list indices into the given uint32 index buffer
+    void Assemble(Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format, u32 num_vertices,
+                  u32 base_vertex, VkBuffer src_buffer, u32 src_offset, bool is_strip,
+                  VkBuffer dst_buffer, VkDeviceSize dst_offset);
+
+    /// Returns the size in bytes of the triangle list indices assembled from num_vertices
+    [[nodiscard]] static size_t GetOutputSize(u32 num_vertices, bool is_strip);
+
 private:
     Scheduler& scheduler;
     StagingBufferPool& staging_buffer_pool;
@@ -112,6 +132,21 @@ private:
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
 };
 
+/// Copies DMA rectangles between buffers in any combination of pitch and block linear layouts
+class DmaLayoutCopyPass final : public ComputePass {
+public:
+    explicit DmaLayoutCopyPass(const Device& device_, Scheduler& scheduler_,
+                               DescriptorPool& descriptor_pool_,
+                               ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+
+    void Copy(VkBuffer dst_buffer, u32 dst_offset, VkBuffer src_buffer, u32 src_offset,
+              const Tegra::DMA::LayoutCopy& copy);
+
+private:
+    Scheduler& scheduler;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
 class ASTCDecoderPass final : public ComputePass {
 public:
     explicit ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
@@ -131,6 +166,25 @@ private:
     MemoryAllocator& memory_allocator;
 };
 
+/// Decodes BC1, BC2, BC3 and BC7 images to RGBA8 on devices that can't sample them natively
+class BCnDecoderPass final : public ComputePass {
+public:
+    explicit BCnDecoderPass(const Device& device_, Scheduler& scheduler_,
+                            DescriptorPool& descriptor_pool_,
+                            ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+    ~BCnDecoderPass();
+
+    /// Returns true when the pass can decode images of the given format
+    [[nodiscard]] static bool IsFormatSupported(VideoCore::Surface::PixelFormat format);
+
+    void Assemble(Image& image, const StagingBufferRef& map,
+                  std::span<const VideoCommon::SwizzleParameters> swizzles);
+
+private:
+    Scheduler& scheduler;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
 class MSAACopyPass final : public ComputePass {
 public:
     explicit MSAACopyPass(const Device& device_, Scheduler& scheduler_,
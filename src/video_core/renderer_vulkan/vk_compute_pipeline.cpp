@@ -2,10 +2,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <chrono>
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
 
+#include "video_core/pipeline_build_queue.h"
 #include "video_core/renderer_vulkan/pipeline_helper.h"
 #include "video_core/renderer_vulkan/pipeline_statistics.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
@@ -27,34 +29,50 @@ using Tegra::Texture::TexturePair;
 ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipeline_cache_,
                                  DescriptorPool& descriptor_pool,
                                  GuestDescriptorQueue& guest_descriptor_queue_,
-                                 Common::ThreadWorker* thread_worker,
-                                 PipelineStatistics* pipeline_statistics,
-                                 VideoCore::ShaderNotify* shader_notify, const Shader::Info& info_,
-                                 vk::ShaderModule spv_module_)
-    : device{device_},
-      pipeline_cache(pipeline_cache_), guest_descriptor_queue{guest_descriptor_queue_}, info{info_},
+                                 VideoCore::PipelineBuildQueue* build_queue,
+                                 PipelineStatistics* pipeline_statistics_, u64 statistics_hash_,
+                                 VideoCore::ShaderNotify* shader_notify_,
+                                 const Shader::Info& info_, vk::ShaderModule spv_module_)
+    : device{device_}, pipeline_cache(pipeline_cache_),
+      guest_descriptor_queue{guest_descriptor_queue_}, pipeline_statistics{pipeline_statistics_},
+      shader_notify{shader_notify_}, statistics_hash{statistics_hash_}, info{info_},
       spv_module(std::move(spv_module_)) {
+    const auto notify_queue{build_queue ? VideoCore::ShaderBuildQueue::Worker
+                                        : VideoCore::ShaderBuildQueue::Blocking};
+    const auto queue_time{std::chrono::steady_clock::now()};
     if (shader_notify) {
-        shader_notify->MarkShaderBuilding();
+        shader_notify->MarkShaderBuilding(notify_queue);
     }
     std::copy_n(info.constant_buffer_used_sizes.begin(), uniform_buffer_sizes.size(),
                 uniform_buffer_sizes.begin());
 
-    auto func{[this, &descriptor_pool, shader_notify, pipeline_statistics] {
-        DescriptorLayoutBuilder builder{device};
-        builder.Add(info, VK_SHADER_STAGE_COMPUTE_BIT);
-
-        descriptor_set_layout = builder.CreateDescriptorSetLayout(false);
+    // The set layout is created up front, dispatches reserve descriptor buffer memory for it
+    // before the pipeline has been built
+    DescriptorLayoutBuilder builder{device};
+    builder.Add(info, VK_SHADER_STAGE_COMPUTE_BIT);
+    descriptor_buffer = guest_descriptor_queue.GetDescriptorBuffer();
+    descriptor_set_layout = builder.CreateDescriptorSetLayout(false, descriptor_buffer != nullptr);
+    if (descriptor_buffer) {
+        descriptor_buffer_layout =
+            builder.CreateDescriptorBufferLayout(*descriptor_buffer, *descriptor_set_layout);
+    }
+    auto func{[this, builder, &descriptor_pool, notify_queue, queue_time] {
+        const auto build_start{std::chrono::steady_clock::now()};
         pipeline_layout = builder.CreatePipelineLayout(*descriptor_set_layout);
-        descriptor_update_template =
-            builder.CreateTemplate(*descriptor_set_layout, *pipeline_layout, false);
-        descriptor_allocator = descriptor_pool.Allocator(*descriptor_set_layout, info);
+        if (!descriptor_buffer) {
+            descriptor_update_template =
+                builder.CreateTemplate(*descriptor_set_layout, *pipeline_layout, false);
+            descriptor_allocator = descriptor_pool.Allocator(*descriptor_set_layout, info);
+        }
         const VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT subgroup_size_ci{
             .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT,
             .pNext = nullptr,
             .requiredSubgroupSize = GuestWarpSize,
         };
         VkPipelineCreateFlags flags{};
+        if (descriptor_buffer) {
+            flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+        }
         if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
             flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
         }
@@ -80,17 +98,20 @@ ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipel
             *pipeline_cache);
 
         if (pipeline_statistics) {
-            pipeline_statistics->Collect(*pipeline);
+            const auto build_time{std::chrono::steady_clock::now() - build_start};
+            pipeline_statistics->Collect(
+                *pipeline, statistics_hash, true,
+                std::chrono::duration_cast<std::chrono::microseconds>(build_time));
         }
         std::scoped_lock lock{build_mutex};
         is_built = true;
         build_condvar.notify_one();
         if (shader_notify) {
-            shader_notify->MarkShaderComplete();
+            shader_notify->MarkShaderComplete(notify_queue, queue_time);
         }
     }};
-    if (thread_worker) {
-        thread_worker->QueueWork(std::move(func));
+    if (build_queue) {
+        build_queue->QueueBuild(this, std::move(func));
     } else {
         func();
     }
@@ -99,6 +120,9 @@ ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipel
 void ComputePipeline::Configure(Tegra::Engines::KeplerCompute& kepler_compute,
                                 Tegra::MemoryManager& gpu_memory, Scheduler& scheduler,
                                 BufferCache& buffer_cache, TextureCache& texture_cache) {
+    if (pipeline_statistics) {
+        pipeline_statistics->MarkUse(statistics_hash);
+    }
     guest_descriptor_queue.Acquire();
 
     buffer_cache.SetComputeUniformBufferState(info.constant_buffer_mask, &uniform_buffer_sizes);
@@ -200,14 +224,23 @@ void ComputePipeline::Configure(Tegra::Engines::KeplerCompute& kepler_compute,
     if (!is_built.load(std::memory_order::relaxed)) {
         // Wait for the pipeline to be built
         scheduler.Record([this](vk::CommandBuffer) {
+            const auto wait_start{std::chrono::steady_clock::now()};
             std::unique_lock lock{build_mutex};
             build_condvar.wait(lock, [this] { return is_built.load(std::memory_order::relaxed); });
+            if (shader_notify) {
+                shader_notify->MarkStall(std::chrono::steady_clock::now() - wait_start);
+            }
         });
     }
+    const bool writes_descriptor_buffer{descriptor_buffer_layout.size != 0};
+    const VkDeviceSize descriptor_offset{
+        writes_descriptor_buffer ? descriptor_buffer->Reserve(descriptor_buffer_layout.size) : 0};
+    const bool bind_descriptor_buffer{writes_descriptor_buffer &&
+                                      scheduler.UpdateDescriptorBuffer()};
     const void* const descriptor_data{guest_descriptor_queue.UpdateData()};
     const bool is_rescaling = !info.texture_descriptors.empty() || !info.image_descriptors.empty();
-    scheduler.Record([this, descriptor_data, is_rescaling,
-                      rescaling_data = rescaling.Data()](vk::CommandBuffer cmdbuf) {
+    scheduler.Record([this, descriptor_data, descriptor_offset, bind_descriptor_buffer,
+                      is_rescaling, rescaling_data = rescaling.Data()](vk::CommandBuffer cmdbuf) {
         cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
         if (!descriptor_set_layout) {
             return;
@@ -217,6 +250,16 @@ void ComputePipeline::Configure(Tegra::Engines::KeplerCompute& kepler_compute,
                                  RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
                                  rescaling_data.data());
         }
+        if (descriptor_buffer) {
+            descriptor_buffer->Write(descriptor_buffer_layout, descriptor_offset,
+                                     static_cast<const DescriptorUpdateEntry*>(descriptor_data));
+            if (bind_descriptor_buffer) {
+                descriptor_buffer->Bind(cmdbuf);
+            }
+            descriptor_buffer->BindSet(cmdbuf, VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline_layout,
+                                       descriptor_offset);
+            return;
+        }
         const VkDescriptorSet descriptor_set{descriptor_allocator.Commit()};
         const vk::Device& dev{device.GetLogical()};
         dev.UpdateDescriptorSet(descriptor_set, *descriptor_update_template, descriptor_data);
@@ -8,17 +8,18 @@
 #include <mutex>
 
 #include "common/common_types.h"
-#include "common/thread_worker.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace VideoCore {
+class PipelineBuildQueue;
 class ShaderNotify;
-}
+} // namespace VideoCore
 
 namespace Vulkan {
 
@@ -31,8 +32,8 @@ public:
     explicit ComputePipeline(const Device& device, vk::PipelineCache& pipeline_cache,
                              DescriptorPool& descriptor_pool,
                              GuestDescriptorQueue& guest_descriptor_queue,
-                             Common::ThreadWorker* thread_worker,
-                             PipelineStatistics* pipeline_statistics,
+                             VideoCore::PipelineBuildQueue* build_queue,
+                             PipelineStatistics* pipeline_statistics, u64 statistics_hash,
                              VideoCore::ShaderNotify* shader_notify, const Shader::Info& info,
                              vk::ShaderModule spv_module);
 
@@ -49,6 +50,9 @@ private:
     const Device& device;
     vk::PipelineCache& pipeline_cache;
     GuestDescriptorQueue& guest_descriptor_queue;
+    PipelineStatistics* pipeline_statistics;
+    VideoCore::ShaderNotify* shader_notify;
+    u64 statistics_hash;
     Shader::Info info;
 
     VideoCommon::ComputeUniformBufferSizes uniform_buffer_sizes{};
@@ -56,6 +60,8 @@ private:
     vk::ShaderModule spv_module;
     vk::DescriptorSetLayout descriptor_set_layout;
     DescriptorAllocator descriptor_allocator;
+    DescriptorBuffer* descriptor_buffer{};
+    DescriptorBufferLayout descriptor_buffer_layout;
     vk::PipelineLayout pipeline_layout;
     vk::DescriptorUpdateTemplate descriptor_update_template;
     vk::Pipeline pipeline;
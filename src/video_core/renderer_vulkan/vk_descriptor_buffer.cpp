@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+
+namespace Vulkan {
+namespace {
+using namespace Common::Literals;
+
+constexpr VkDeviceSize MAX_DESCRIPTOR_BUFFER_SIZE = 16_MiB;
+
+VkDeviceSize GetDescriptorBufferSize(const Device& device) {
+    // Combined image samplers live in the same buffer, so it's bounded by both address spaces
+    const auto& props = device.DescriptorBufferProperties();
+    return std::min({
+        MAX_DESCRIPTOR_BUFFER_SIZE,
+        props.maxResourceDescriptorBufferRange,
+        props.maxSamplerDescriptorBufferRange,
+        props.resourceDescriptorBufferAddressSpaceSize,
+        props.samplerDescriptorBufferAddressSpaceSize,
+        props.descriptorBufferAddressSpaceSize,
+    });
+}
+} // Anonymous namespace
+
+DescriptorBuffer::DescriptorBuffer(const Device& device_, MemoryAllocator& memory_allocator,
+                                   Scheduler& scheduler_)
+    : device{device_}, scheduler{scheduler_}, buffer_size{GetDescriptorBufferSize(device)},
+      alignment{device.DescriptorBufferProperties().descriptorBufferOffsetAlignment} {
+    region_size = Common::AlignDown(buffer_size / NUM_SYNCS, alignment);
+    buffer_size = region_size * NUM_SYNCS;
+    buffer = memory_allocator.CreateBuffer(
+        {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = buffer_size,
+            .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                     VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+                     VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        },
+        MemoryUsage::Stream);
+    if (device.HasDebuggingToolAttached()) {
+        buffer.SetObjectNameEXT("Descriptor Buffer");
+    }
+    mapped = buffer.Mapped();
+    ASSERT_MSG(!mapped.empty(), "Descriptor buffer must be host visible!");
+    address = device.GetLogical().GetBufferDeviceAddress(*buffer);
+}
+
+DescriptorBuffer::~DescriptorBuffer() = default;
+
+DescriptorBufferLayout DescriptorBuffer::MakeLayout(
+    VkDescriptorSetLayout set_layout,
+    std::span<const VkDescriptorSetLayoutBinding> bindings) const {
+    DescriptorBufferLayout layout;
+    if (!set_layout) {
+        return layout;
+    }
+    const vk::Device& dev{device.GetLogical()};
+    layout.size = Common::AlignUp(dev.GetDescriptorSetLayoutSizeEXT(set_layout), alignment);
+    for (const VkDescriptorSetLayoutBinding& binding : bindings) {
+        layout.bindings.push_back({
+            .type = binding.descriptorType,
+            .count = binding.descriptorCount,
+            .offset = dev.GetDescriptorSetLayoutBindingOffsetEXT(set_layout, binding.binding),
+            .descriptor_size = DescriptorSize(binding.descriptorType),
+        });
+    }
+    return layout;
+}
+
+VkDeviceSize DescriptorBuffer::Reserve(VkDeviceSize size) {
+    ASSERT(size <= region_size);
+    VkDeviceSize offset = Common::AlignUp(iterator, alignment);
+    if (offset + size > (current_region + 1) * region_size) {
+        // Sets never straddle regions, move to the start of the next one
+        sync_ticks[current_region] = scheduler.CurrentTick();
+        current_region = (current_region + 1) % NUM_SYNCS;
+        offset = current_region * region_size;
+        if (!scheduler.IsFree(sync_ticks[current_region])) {
+            LOG_DEBUG(Render_Vulkan, "Descriptor buffer is full, waiting for the GPU");
+            scheduler.Wait(sync_ticks[current_region]);
+        }
+    }
+    iterator = offset + size;
+    return offset;
+}
+
+void DescriptorBuffer::Write(const DescriptorBufferLayout& layout, VkDeviceSize offset,
+                             const DescriptorUpdateEntry* entries) const {
+    const vk::Device& dev{device.GetLogical()};
+    u8* const set_data{mapped.data() + offset};
+    for (const DescriptorBufferLayout::Binding& binding : layout.bindings) {
+        u8* descriptor_data{set_data + binding.offset};
+        for (u32 index = 0; index < binding.count; ++index) {
+            const DescriptorUpdateEntry& entry{*entries++};
+            VkDescriptorAddressInfoEXT address_info{
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+                .pNext = nullptr,
+                .address = 0,
+                .range = 0,
+                .format = VK_FORMAT_UNDEFINED,
+            };
+            VkDescriptorGetInfoEXT get_info{
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+                .pNext = nullptr,
+                .type = binding.type,
+                .data{},
+            };
+            switch (binding.type) {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                // Unbound buffers are left as null descriptors
+                if (entry.buffer.buffer != VK_NULL_HANDLE && entry.buffer.range != 0) {
+                    address_info.address =
+                        dev.GetBufferDeviceAddress(entry.buffer.buffer) + entry.buffer.offset;
+                    address_info.range = entry.buffer.range;
+                }
+                if (binding.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) {
+                    get_info.data.pUniformBuffer = address_info.address ? &address_info : nullptr;
+                } else {
+                    get_info.data.pStorageBuffer = address_info.address ? &address_info : nullptr;
+                }
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                address_info.address = entry.texel_buffer_address.address;
+                address_info.range = entry.texel_buffer_address.range;
+                address_info.format = entry.texel_buffer_address.format;
+                if (binding.type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER) {
+                    get_info.data.pUniformTexelBuffer =
+                        address_info.address ? &address_info : nullptr;
+                } else {
+                    get_info.data.pStorageTexelBuffer =
+                        address_info.address ? &address_info : nullptr;
+                }
+                break;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                get_info.data.pCombinedImageSampler = &entry.image;
+                break;
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                get_info.data.pStorageImage = &entry.image;
+                break;
+            default:
+                UNREACHABLE_MSG("Unexpected descriptor type {}", static_cast<int>(binding.type));
+            }
+            dev.GetDescriptorEXT(get_info, binding.descriptor_size, descriptor_data);
+            descriptor_data += binding.descriptor_size;
+        }
+    }
+}
+
+void DescriptorBuffer::Bind(vk::CommandBuffer cmdbuf) const {
+    cmdbuf.BindDescriptorBuffersEXT(VkDescriptorBufferBindingInfoEXT{
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+        .pNext = nullptr,
+        .address = address,
+        .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                 VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT,
+    });
+}
+
+void DescriptorBuffer::BindSet(vk::CommandBuffer cmdbuf, VkPipelineBindPoint bind_point,
+                               VkPipelineLayout pipeline_layout, VkDeviceSize offset) const {
+    static constexpr u32 buffer_index = 0;
+    cmdbuf.SetDescriptorBufferOffsetsEXT(bind_point, pipeline_layout, 0, buffer_index, offset);
+}
+
+size_t DescriptorBuffer::DescriptorSize(VkDescriptorType type) const {
+    // Robust buffer access is always enabled, so buffers use the robust descriptor sizes
+    const auto& props = device.DescriptorBufferProperties();
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        return props.robustUniformBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        return props.robustStorageBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        return props.robustUniformTexelBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        return props.robustStorageTexelBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        return props.combinedImageSamplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        return props.storageImageDescriptorSize;
+    default:
+        UNREACHABLE_MSG("Unexpected descriptor type {}", static_cast<int>(type));
+        return 0;
+    }
+}
+
+} // namespace Vulkan
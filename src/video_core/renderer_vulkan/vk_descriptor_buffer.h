@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <span>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class MemoryAllocator;
+class Scheduler;
+struct DescriptorUpdateEntry;
+
+/// Placement of a descriptor set layout in descriptor buffer memory.
+struct DescriptorBufferLayout {
+    struct Binding {
+        VkDescriptorType type;
+        u32 count;
+        VkDeviceSize offset;    ///< Offset of the binding from the start of the set
+        size_t descriptor_size; ///< Size in bytes of each descriptor in the binding
+    };
+
+    boost::container::small_vector<Binding, 32> bindings;
+    VkDeviceSize size{}; ///< Size in bytes of the whole set, zero when the set is empty
+};
+
+/**
+ * Ring of host visible descriptor buffer memory (VK_EXT_descriptor_buffer).
+ *
+ * Sets are reserved linearly on the main thread and written by the worker threads straight into
+ * the mapped memory, so there are no descriptor pools to allocate from or reset. The ring is split
+ * in regions protected by the tick of their last use, like the stream buffer.
+ */
+class DescriptorBuffer {
+public:
+    explicit DescriptorBuffer(const Device& device, MemoryAllocator& memory_allocator,
+                              Scheduler& scheduler);
+    ~DescriptorBuffer();
+
+    DescriptorBuffer(const DescriptorBuffer&) = delete;
+    DescriptorBuffer& operator=(const DescriptorBuffer&) = delete;
+
+    /// Queries the placement of a set layout created with the descriptor buffer flag
+    [[nodiscard]] DescriptorBufferLayout MakeLayout(
+        VkDescriptorSetLayout set_layout,
+        std::span<const VkDescriptorSetLayoutBinding> bindings) const;
+
+    /// Reserves memory for a set and returns its offset in the ring.
+    /// Waits for the GPU when the ring wraps around onto work in flight; main thread only.
+    [[nodiscard]] VkDeviceSize Reserve(VkDeviceSize size);
+
+    /// Writes the descriptors of a set at a reserved offset, in the update queue entry order
+    void Write(const DescriptorBufferLayout& layout, VkDeviceSize offset,
+               const DescriptorUpdateEntry* entries) const;
+
+    /// Binds the ring to a command buffer
+    void Bind(vk::CommandBuffer cmdbuf) const;
+
+    /// Points set zero of a pipeline layout to a set written at offset
+    void BindSet(vk::CommandBuffer cmdbuf, VkPipelineBindPoint bind_point,
+                 VkPipelineLayout pipeline_layout, VkDeviceSize offset) const;
+
+private:
+    static constexpr size_t NUM_SYNCS = 16;
+
+    /// Returns the descriptor size of a descriptor type on this device
+    [[nodiscard]] size_t DescriptorSize(VkDescriptorType type) const;
+
+    const Device& device;
+    Scheduler& scheduler;
+
+    vk::Buffer buffer;
+    std::span<u8> mapped;
+    VkDeviceAddress address{};
+    VkDeviceSize buffer_size{};
+    VkDeviceSize region_size{};
+    VkDeviceSize alignment{};
+
+    VkDeviceSize iterator{};
+    size_t current_region{};
+    std::array<u64, NUM_SYNCS> sync_ticks{};
+};
+
+} // namespace Vulkan
@@ -23,6 +23,7 @@ constexpr s32 SCORE_THRESHOLD = 3;
 struct DescriptorBank {
     DescriptorBankInfo info;
     std::vector<vk::DescriptorPool> pools;
+    std::mutex commit_mutex; ///< Serializes commits from parallel scheduler workers
 };
 
 bool DescriptorBankInfo::IsSuperset(const DescriptorBankInfo& subset) const noexcept {
@@ -40,11 +41,17 @@ static u32 Accumulate(const Descriptors& descriptors) {
     return count;
 }
 
-static DescriptorBankInfo MakeBankInfo(std::span<const Shader::Info> infos) {
+static DescriptorBankInfo MakeBankInfo(const Device& device,
+                                       std::span<const Shader::Info> infos) {
     DescriptorBankInfo bank;
     for (const Shader::Info& info : infos) {
         bank.uniform_buffers += Accumulate(info.constant_buffer_descriptors);
-        bank.storage_buffers += Accumulate(info.storage_buffers_descriptors);
+        if (!device.IsStorageBufferPointersEnabled()) {
+            bank.storage_buffers += Accumulate(info.storage_buffers_descriptors);
+        } else if (!info.storage_buffers_descriptors.empty()) {
+            // Storage buffers are replaced by the uniform buffer of their address table
+            ++bank.uniform_buffers;
+        }
         bank.texture_buffers += Accumulate(info.texture_buffer_descriptors);
         bank.image_buffers += Accumulate(info.image_buffer_descriptors);
         bank.textures += Accumulate(info.texture_descriptors);
@@ -90,6 +97,7 @@ DescriptorAllocator::DescriptorAllocator(const Device& device_, MasterSemaphore&
       layout{layout_} {}
 
 VkDescriptorSet DescriptorAllocator::Commit() {
+    std::scoped_lock lock{bank->commit_mutex};
     const size_t index = CommitResource();
     return sets[index / SETS_GROW_RATE][index % SETS_GROW_RATE];
 }
@@ -129,12 +137,12 @@ DescriptorPool::~DescriptorPool() = default;
 
 DescriptorAllocator DescriptorPool::Allocator(VkDescriptorSetLayout layout,
                                               std::span<const Shader::Info> infos) {
-    return Allocator(layout, MakeBankInfo(infos));
+    return Allocator(layout, MakeBankInfo(device, infos));
 }
 
 DescriptorAllocator DescriptorPool::Allocator(VkDescriptorSetLayout layout,
                                               const Shader::Info& info) {
-    return Allocator(layout, MakeBankInfo(std::array{info}));
+    return Allocator(layout, MakeBankInfo(device, std::array{info}));
 }
 
 DescriptorAllocator DescriptorPool::Allocator(VkDescriptorSetLayout layout,
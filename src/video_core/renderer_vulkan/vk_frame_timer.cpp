@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+
+#include "video_core/renderer_vulkan/vk_frame_timer.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+
+namespace Vulkan {
+
+namespace {
+/// Timestamps in flight, two per submission. Submissions past it are not timed.
+constexpr u32 NUM_QUERIES = 1024;
+} // Anonymous namespace
+
+FrameTimer::FrameTimer(const Device& device_, Scheduler& scheduler_)
+    : device{device_}, scheduler{scheduler_},
+      timestamp_period{static_cast<double>(device.GetTimestampPeriod())} {
+    query_pool = device.GetLogical().CreateQueryPool({
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = NUM_QUERIES,
+        .pipelineStatistics = 0,
+    });
+}
+
+FrameTimer::~FrameTimer() = default;
+
+bool FrameTimer::IsSupported(const Device& device) {
+    return device.SupportsTimestamps() && device.GetTimestampPeriod() > 0.0f;
+}
+
+void FrameTimer::BeginSubmission() {
+    if (in_submission) {
+        return;
+    }
+    if (used_queries + 2 > NUM_QUERIES) {
+        // The GPU is too far behind, the frame would be missing the time of this submission
+        current_frame.complete = false;
+        return;
+    }
+    if (current_frame.num_submissions == 0) {
+        current_frame.first_query = next_query;
+    }
+    const u32 query = next_query;
+    next_query = (next_query + 2) % NUM_QUERIES;
+    used_queries += 2;
+    in_submission = true;
+
+    // The queries were read back before being handed out again, nothing uses them on the GPU
+    device.GetLogical().ResetQueryPool(*query_pool, query, 2);
+    scheduler.Record([pool = *query_pool, query](vk::CommandBuffer cmdbuf) {
+        cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, pool, query);
+    });
+}
+
+void FrameTimer::EndSubmission() {
+    if (!in_submission) {
+        return;
+    }
+    in_submission = false;
+    const u32 query = (current_frame.first_query + current_frame.num_submissions * 2 + 1) %
+                      NUM_QUERIES;
+    ++current_frame.num_submissions;
+    current_frame.tick = scheduler.CurrentTick();
+    scheduler.Record([pool = *query_pool, query](vk::CommandBuffer cmdbuf) {
+        cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, pool, query);
+    });
+}
+
+std::optional<std::chrono::nanoseconds> FrameTimer::EndFrame() {
+    if (current_frame.num_submissions != 0) {
+        pending_frames.push(current_frame);
+    }
+    // A submission still being recorded is timed as part of the next frame
+    current_frame = Frame{};
+    if (in_submission) {
+        current_frame.first_query = (next_query + NUM_QUERIES - 2) % NUM_QUERIES;
+    }
+
+    std::optional<std::chrono::nanoseconds> gpu_time;
+    while (!pending_frames.empty() && scheduler.IsFree(pending_frames.front().tick)) {
+        if (const auto frame_time = ReadFrame(pending_frames.front())) {
+            gpu_time = frame_time;
+        }
+        pending_frames.pop();
+    }
+    return gpu_time;
+}
+
+std::optional<std::chrono::nanoseconds> FrameTimer::ReadFrame(const Frame& frame) {
+    used_queries -= frame.num_submissions * 2;
+    u64 total_ticks = 0;
+    for (u32 submission = 0; submission < frame.num_submissions; ++submission) {
+        const u32 query = (frame.first_query + submission * 2) % NUM_QUERIES;
+        std::array<u64, 2> timestamps{};
+        const VkResult result =
+            device.GetLogical().GetQueryResults(*query_pool, query, 2, sizeof(timestamps),
+                                                timestamps.data(), sizeof(u64),
+                                                VK_QUERY_RESULT_64_BIT);
+        if (result != VK_SUCCESS || timestamps[1] < timestamps[0]) {
+            return std::nullopt;
+        }
+        total_ticks += timestamps[1] - timestamps[0];
+    }
+    if (!frame.complete) {
+        return std::nullopt;
+    }
+    return std::chrono::nanoseconds{
+        static_cast<s64>(static_cast<double>(total_ticks) * timestamp_period)};
+}
+
+} // namespace Vulkan
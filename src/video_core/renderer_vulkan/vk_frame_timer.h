@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <queue>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class Scheduler;
+
+/**
+ * Measures the time the GPU spends on each frame with timestamp queries.
+ *
+ * The queries are written around every submission of a frame instead of around the whole frame, so
+ * the time the GPU sits idle waiting for the next submission is not counted.
+ */
+class FrameTimer {
+public:
+    explicit FrameTimer(const Device& device, Scheduler& scheduler);
+    ~FrameTimer();
+
+    /// Returns true when the device can time frames
+    [[nodiscard]] static bool IsSupported(const Device& device);
+
+    /// Starts timing the submission being recorded, called by the scheduler
+    void BeginSubmission();
+
+    /// Stops timing the submission about to be sent, called by the scheduler
+    void EndSubmission();
+
+    /// Closes the current frame and returns the GPU time of the newest frame the GPU finished, if
+    /// one finished since the last call
+    [[nodiscard]] std::optional<std::chrono::nanoseconds> EndFrame();
+
+private:
+    struct Frame {
+        u32 first_query{};
+        u32 num_submissions{};
+        u64 tick{};
+        bool complete{true};
+    };
+
+    /// Returns the GPU time of a finished frame and releases its queries
+    [[nodiscard]] std::optional<std::chrono::nanoseconds> ReadFrame(const Frame& frame);
+
+    const Device& device;
+    Scheduler& scheduler;
+    vk::QueryPool query_pool;
+    double timestamp_period{};
+
+    std::queue<Frame> pending_frames;
+    Frame current_frame{};
+    u32 next_query{};
+    u32 used_queries{};
+    bool in_submission{};
+};
+
+} // namespace Vulkan
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <chrono>
 #include <span>
 
 #include <boost/container/small_vector.hpp>
@@ -9,7 +10,9 @@
 
 #include "video_core/renderer_vulkan/pipeline_helper.h"
 
+#include "common/bit_cast.h"
 #include "common/bit_field.h"
+#include "video_core/pipeline_build_queue.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/pipeline_statistics.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
@@ -40,6 +43,7 @@ using Tegra::Texture::TexturePair;
 using VideoCore::Surface::PixelFormat;
 using VideoCore::Surface::PixelFormatFromDepthFormat;
 using VideoCore::Surface::PixelFormatFromRenderTargetFormat;
+using VideoCore::Surface::SurfaceType;
 
 constexpr size_t NUM_STAGES = Maxwell::MaxShaderStage;
 constexpr size_t MAX_IMAGE_ELEMENTS = 64;
@@ -142,6 +146,13 @@ size_t NumAttachments(const FixedPipelineState& state) {
     return num;
 }
 
+VkFormat AttachmentFormat(const Device& device, PixelFormat format) {
+    if (format == PixelFormat::Invalid) {
+        return VK_FORMAT_UNDEFINED;
+    }
+    return MaxwellToVK::SurfaceFormat(device, FormatType::Optimal, true, format).format;
+}
+
 template <typename Spec>
 bool Passes(const std::array<vk::ShaderModule, NUM_STAGES>& modules,
             const std::array<Shader::Info, NUM_STAGES>& stage_infos) {
@@ -236,17 +247,25 @@ ConfigureFuncPtr ConfigureFunc(const std::array<vk::ShaderModule, NUM_STAGES>& m
 
 GraphicsPipeline::GraphicsPipeline(
     Scheduler& scheduler_, BufferCache& buffer_cache_, TextureCache& texture_cache_,
-    vk::PipelineCache& pipeline_cache_, VideoCore::ShaderNotify* shader_notify,
+    vk::PipelineCache& pipeline_cache_, VideoCore::ShaderNotify* shader_notify_,
     const Device& device_, DescriptorPool& descriptor_pool,
-    GuestDescriptorQueue& guest_descriptor_queue_, Common::ThreadWorker* worker_thread,
-    PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
+    GuestDescriptorQueue& guest_descriptor_queue_, VideoCore::PipelineBuildQueue* build_queue,
+    Common::TaskGroup* optimize_thread, PipelineStatistics* pipeline_statistics_,
+    RenderPassCache& render_pass_cache,
     const GraphicsPipelineCacheKey& key_, std::array<vk::ShaderModule, NUM_STAGES> stages,
     const std::array<const Shader::Info*, NUM_STAGES>& infos)
     : key{key_}, device{device_}, texture_cache{texture_cache_}, buffer_cache{buffer_cache_},
       pipeline_cache(pipeline_cache_), scheduler{scheduler_},
-      guest_descriptor_queue{guest_descriptor_queue_}, spv_modules{std::move(stages)} {
+      guest_descriptor_queue{guest_descriptor_queue_}, pipeline_statistics{pipeline_statistics_},
+      shader_notify{shader_notify_}, spv_modules{std::move(stages)} {
+    if (pipeline_statistics) {
+        statistics_hash = key.Hash();
+    }
+    const auto notify_queue{build_queue ? VideoCore::ShaderBuildQueue::Worker
+                                        : VideoCore::ShaderBuildQueue::Blocking};
+    const auto queue_time{std::chrono::steady_clock::now()};
     if (shader_notify) {
-        shader_notify->MarkShaderBuilding();
+        shader_notify->MarkShaderBuilding(notify_queue);
     }
     for (size_t stage = 0; stage < NUM_STAGES; ++stage) {
         const Shader::Info* const info{infos[stage]};
@@ -258,34 +277,63 @@ GraphicsPipeline::GraphicsPipeline(
         std::ranges::copy(info->constant_buffer_used_sizes, uniform_buffer_sizes[stage].begin());
         num_textures += Shader::NumDescriptors(info->texture_descriptors);
     }
-    auto func{[this, shader_notify, &render_pass_cache, &descriptor_pool, pipeline_statistics] {
-        DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
-        uses_push_descriptor = builder.CanUsePushDescriptor();
-        descriptor_set_layout = builder.CreateDescriptorSetLayout(uses_push_descriptor);
-        if (!uses_push_descriptor) {
+    // The set layout is created up front, draws reserve descriptor buffer memory for it before
+    // the pipeline has been built
+    DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
+    uses_push_descriptor = builder.CanUsePushDescriptor();
+    if (!uses_push_descriptor) {
+        descriptor_buffer = guest_descriptor_queue.GetDescriptorBuffer();
+    }
+    uses_descriptor_buffer = descriptor_buffer != nullptr;
+    descriptor_set_layout =
+        builder.CreateDescriptorSetLayout(uses_push_descriptor, uses_descriptor_buffer);
+    if (uses_descriptor_buffer) {
+        descriptor_buffer_layout =
+            builder.CreateDescriptorBufferLayout(*descriptor_buffer, *descriptor_set_layout);
+    }
+    auto func{[this, builder, notify_queue, queue_time, &render_pass_cache, &descriptor_pool,
+                optimize_thread] {
+        const auto build_start{std::chrono::steady_clock::now()};
+        if (!uses_push_descriptor && !uses_descriptor_buffer) {
             descriptor_allocator = descriptor_pool.Allocator(*descriptor_set_layout, stage_infos);
         }
         const VkDescriptorSetLayout set_layout{*descriptor_set_layout};
         pipeline_layout = builder.CreatePipelineLayout(set_layout);
-        descriptor_update_template =
-            builder.CreateTemplate(set_layout, *pipeline_layout, uses_push_descriptor);
+        if (!uses_descriptor_buffer) {
+            descriptor_update_template =
+                builder.CreateTemplate(set_layout, *pipeline_layout, uses_push_descriptor);
+        }
 
-        const VkRenderPass render_pass{render_pass_cache.Get(MakeRenderPassKey(key.state))};
+        // Dynamic rendering pipelines describe their attachments by format instead
+        const VkRenderPass render_pass{device.IsKhrDynamicRenderingSupported()
+                                           ? VK_NULL_HANDLE
+                                           : render_pass_cache.Get(MakeRenderPassKey(key.state))};
         Validate();
-        MakePipeline(render_pass);
+        // Statistics can't be captured from fast-linked pipelines, build those monolithically
+        const bool use_libraries = optimize_thread &&
+                                   !device.IsKhrPipelineExecutablePropertiesEnabled() &&
+                                   device.IsExtGraphicsPipelineLibrarySupported();
+        MakePipeline(render_pass, use_libraries);
         if (pipeline_statistics) {
-            pipeline_statistics->Collect(*pipeline);
+            const auto build_time{std::chrono::steady_clock::now() - build_start};
+            pipeline_statistics->Collect(
+                *pipeline, statistics_hash, false,
+                std::chrono::duration_cast<std::chrono::microseconds>(build_time));
+        }
+        if (libraries[0]) {
+            // Draw with the fast-linked pipeline while the optimized one is built in the background
+            optimize_thread->QueueWork([this] { MakeOptimizedPipeline(); });
         }
 
         std::scoped_lock lock{build_mutex};
         is_built = true;
         build_condvar.notify_one();
         if (shader_notify) {
-            shader_notify->MarkShaderComplete();
+            shader_notify->MarkShaderComplete(notify_queue, queue_time);
         }
     }};
-    if (worker_thread) {
-        worker_thread->QueueWork(std::move(func));
+    if (build_queue) {
+        build_queue->QueueBuild(this, std::move(func));
     } else {
         func();
     }
@@ -490,25 +538,39 @@ void GraphicsPipeline::ConfigureImpl(bool is_indexed) {
 
 void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
                                      const RenderAreaPushConstant& render_area) {
-    scheduler.RequestRenderpass(texture_cache.GetFramebuffer());
+    // Reserving descriptor buffer memory may wait for the GPU, do it outside of the render pass
+    const bool writes_descriptor_buffer{descriptor_buffer_layout.size != 0};
+    const VkDeviceSize descriptor_offset{
+        writes_descriptor_buffer ? descriptor_buffer->Reserve(descriptor_buffer_layout.size) : 0};
+    const bool bind_descriptor_buffer{writes_descriptor_buffer &&
+                                      scheduler.UpdateDescriptorBuffer()};
+
+    scheduler.RequestRendering(texture_cache.GetFramebuffer());
 
     if (!is_built.load(std::memory_order::relaxed)) {
         // Wait for the pipeline to be built
         scheduler.Record([this](vk::CommandBuffer) {
+            const auto wait_start{std::chrono::steady_clock::now()};
             std::unique_lock lock{build_mutex};
             build_condvar.wait(lock, [this] { return is_built.load(std::memory_order::relaxed); });
+            if (shader_notify) {
+                shader_notify->MarkStall(std::chrono::steady_clock::now() - wait_start);
+            }
         });
     }
     const bool is_rescaling{texture_cache.IsRescaling()};
     const bool update_rescaling{scheduler.UpdateRescaling(is_rescaling)};
     const bool bind_pipeline{scheduler.UpdateGraphicsPipeline(this)};
     const void* const descriptor_data{guest_descriptor_queue.UpdateData()};
-    scheduler.Record([this, descriptor_data, bind_pipeline, rescaling_data = rescaling.Data(),
-                      is_rescaling, update_rescaling,
+    scheduler.Record([this, descriptor_data, descriptor_offset, bind_descriptor_buffer,
+                      bind_pipeline, rescaling_data = rescaling.Data(), is_rescaling,
+                      update_rescaling,
                       uses_render_area = render_area.uses_render_area,
                       render_area_data = render_area.words](vk::CommandBuffer cmdbuf) {
         if (bind_pipeline) {
-            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
+            const bool optimized = is_optimized.load(std::memory_order::acquire);
+            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                optimized ? *optimized_pipeline : *pipeline);
         }
         cmdbuf.PushConstants(*pipeline_layout, VK_SHADER_STAGE_ALL_GRAPHICS,
                              RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
@@ -528,7 +590,15 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
         if (!descriptor_set_layout) {
             return;
         }
-        if (uses_push_descriptor) {
+        if (uses_descriptor_buffer) {
+            descriptor_buffer->Write(descriptor_buffer_layout, descriptor_offset,
+                                     static_cast<const DescriptorUpdateEntry*>(descriptor_data));
+            if (bind_descriptor_buffer) {
+                descriptor_buffer->Bind(cmdbuf);
+            }
+            descriptor_buffer->BindSet(cmdbuf, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline_layout,
+                                       descriptor_offset);
+        } else if (uses_push_descriptor) {
             cmdbuf.PushDescriptorSetWithTemplateKHR(*descriptor_update_template, *pipeline_layout,
                                                     0, descriptor_data);
         } else {
@@ -541,7 +611,7 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     });
 }
 
-void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
+void GraphicsPipeline::MakePipeline(VkRenderPass render_pass, bool use_libraries) {
     FixedPipelineState::DynamicState dynamic{};
     if (!key.state.extended_dynamic_state) {
         dynamic = key.state.dynamic_state;
@@ -853,6 +923,36 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
         .pNext = nullptr,
         .requiredSubgroupSize = GuestWarpSize,
     };
+    using Shader::Backend::SPIRV::SpecializationLayout;
+    const SpecializationLayout specialization_data{
+        .alpha_test_reference = Common::BitCast<f32>(key.state.alpha_test_ref),
+        .point_size = Common::BitCast<f32>(key.state.point_size),
+        .y_direction = key.state.y_negate != 0 ? -1.0f : 1.0f,
+    };
+    static constexpr std::array<VkSpecializationMapEntry, 3> specialization_entries{{
+        {
+            .constantID = Shader::Backend::SPIRV::SPECIALIZATION_ALPHA_TEST_REFERENCE_ID,
+            .offset = offsetof(SpecializationLayout, alpha_test_reference),
+            .size = sizeof(f32),
+        },
+        {
+            .constantID = Shader::Backend::SPIRV::SPECIALIZATION_POINT_SIZE_ID,
+            .offset = offsetof(SpecializationLayout, point_size),
+            .size = sizeof(f32),
+        },
+        {
+            .constantID = Shader::Backend::SPIRV::SPECIALIZATION_Y_DIRECTION_ID,
+            .offset = offsetof(SpecializationLayout, y_direction),
+            .size = sizeof(f32),
+        },
+    }};
+    // Entries for constants a stage doesn't declare are ignored, share the same info
+    const VkSpecializationInfo specialization_info{
+        .mapEntryCount = static_cast<u32>(specialization_entries.size()),
+        .pMapEntries = specialization_entries.data(),
+        .dataSize = sizeof(specialization_data),
+        .pData = &specialization_data,
+    };
     static_vector<VkPipelineShaderStageCreateInfo, 5> shader_stages;
     for (size_t stage = 0; stage < Maxwell::MaxShaderStage; ++stage) {
         if (!spv_modules[stage]) {
@@ -866,7 +966,7 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
                 .stage = MaxwellToVK::ShaderStage(Shader::StageFromIndex(stage)),
                 .module = *spv_modules[stage],
                 .pName = "main",
-                .pSpecializationInfo = nullptr,
+                .pSpecializationInfo = &specialization_info,
             });
         /*
         if (program[stage]->entries.uses_warps && device.IsGuestWarpSizeSupported(stage_ci.stage)) {
@@ -874,33 +974,196 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
         }
         */
     }
-    VkPipelineCreateFlags flags{};
+    const RenderPassKey render_pass_key{MakeRenderPassKey(key.state)};
+    std::array<VkFormat, Maxwell::NumRenderTargets> color_formats;
+    std::ranges::transform(render_pass_key.color_formats, color_formats.begin(),
+                           [this](PixelFormat format) { return AttachmentFormat(device, format); });
+    const PixelFormat depth_format{render_pass_key.depth_format};
+    const SurfaceType depth_type{depth_format != PixelFormat::Invalid
+                                     ? VideoCore::Surface::GetFormatType(depth_format)
+                                     : SurfaceType::Invalid};
+    const bool has_depth{depth_type == SurfaceType::Depth ||
+                         depth_type == SurfaceType::DepthStencil};
+    const bool has_stencil{depth_type == SurfaceType::Stencil ||
+                           depth_type == SurfaceType::DepthStencil};
+    const VkPipelineRenderingCreateInfo rendering_ci{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+        .pNext = nullptr,
+        .viewMask = 0,
+        .colorAttachmentCount = static_cast<u32>(num_attachments),
+        .pColorAttachmentFormats = color_formats.data(),
+        .depthAttachmentFormat =
+            has_depth ? AttachmentFormat(device, depth_format) : VK_FORMAT_UNDEFINED,
+        .stencilAttachmentFormat =
+            has_stencil ? AttachmentFormat(device, depth_format) : VK_FORMAT_UNDEFINED,
+    };
+    VkPipelineCreateFlags flags{DescriptorFlags()};
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
         flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
     }
+    VkGraphicsPipelineCreateInfo pipeline_ci{
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext = render_pass ? nullptr : &rendering_ci,
+        .flags = flags,
+        .stageCount = static_cast<u32>(shader_stages.size()),
+        .pStages = shader_stages.data(),
+        .pVertexInputState = &vertex_input_ci,
+        .pInputAssemblyState = &input_assembly_ci,
+        .pTessellationState = &tessellation_ci,
+        .pViewportState = &viewport_ci,
+        .pRasterizationState = &rasterization_ci,
+        .pMultisampleState = &multisample_ci,
+        .pDepthStencilState = &depth_stencil_ci,
+        .pColorBlendState = &color_blend_ci,
+        .pDynamicState = &dynamic_state_ci,
+        .layout = *pipeline_layout,
+        .renderPass = render_pass,
+        .subpass = 0,
+        .basePipelineHandle = nullptr,
+        .basePipelineIndex = 0,
+    };
+    // Pipelines that never rasterize can't be linked from fragment libraries, build them whole
+    const bool static_discard =
+        !key.state.extended_dynamic_state_2 && rasterization_ci.rasterizerDiscardEnable;
+    if (!use_libraries || static_discard) {
+        pipeline = device.GetLogical().CreateGraphicsPipeline(pipeline_ci, *pipeline_cache);
+        return;
+    }
+    // Split the pipeline in its four library subsets. They are compiled without link time
+    // optimizations, which are applied later from the retained information.
+    const auto make_library{[&](VkGraphicsPipelineLibraryFlagsEXT subset,
+                                VkGraphicsPipelineCreateInfo library_ci) {
+        // Keep the attachment formats of dynamic rendering chained
+        const VkGraphicsPipelineLibraryCreateInfoEXT subset_ci{
+            .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+            .pNext = library_ci.pNext,
+            .flags = subset,
+        };
+        library_ci.pNext = &subset_ci;
+        library_ci.flags = DescriptorFlags() | VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                           VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+        return device.GetLogical().CreateGraphicsPipeline(library_ci, *pipeline_cache);
+    }};
+    const auto fragment_it{std::ranges::find(shader_stages, VK_SHADER_STAGE_FRAGMENT_BIT,
+                                             &VkPipelineShaderStageCreateInfo::stage)};
+    const u32 num_pre_raster_stages{
+        static_cast<u32>(std::distance(shader_stages.begin(), fragment_it))};
+    const u32 num_fragment_stages{static_cast<u32>(shader_stages.size()) - num_pre_raster_stages};
+
+    VkGraphicsPipelineCreateInfo vertex_input_library_ci{pipeline_ci};
+    vertex_input_library_ci.stageCount = 0;
+    vertex_input_library_ci.pStages = nullptr;
+    vertex_input_library_ci.pTessellationState = nullptr;
+    vertex_input_library_ci.pViewportState = nullptr;
+    vertex_input_library_ci.pRasterizationState = nullptr;
+    vertex_input_library_ci.pMultisampleState = nullptr;
+    vertex_input_library_ci.pDepthStencilState = nullptr;
+    vertex_input_library_ci.pColorBlendState = nullptr;
+    vertex_input_library_ci.layout = VK_NULL_HANDLE;
+    vertex_input_library_ci.renderPass = VK_NULL_HANDLE;
+    libraries[0] = make_library(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+                                vertex_input_library_ci);
+
+    VkGraphicsPipelineCreateInfo pre_raster_library_ci{pipeline_ci};
+    pre_raster_library_ci.stageCount = num_pre_raster_stages;
+    pre_raster_library_ci.pVertexInputState = nullptr;
+    pre_raster_library_ci.pInputAssemblyState = nullptr;
+    pre_raster_library_ci.pMultisampleState = nullptr;
+    pre_raster_library_ci.pDepthStencilState = nullptr;
+    pre_raster_library_ci.pColorBlendState = nullptr;
+    libraries[1] = make_library(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+                                pre_raster_library_ci);
+
+    VkGraphicsPipelineCreateInfo fragment_library_ci{pipeline_ci};
+    fragment_library_ci.stageCount = num_fragment_stages;
+    fragment_library_ci.pStages = num_fragment_stages != 0 ? &*fragment_it : nullptr;
+    fragment_library_ci.pVertexInputState = nullptr;
+    fragment_library_ci.pInputAssemblyState = nullptr;
+    fragment_library_ci.pTessellationState = nullptr;
+    fragment_library_ci.pViewportState = nullptr;
+    fragment_library_ci.pRasterizationState = nullptr;
+    fragment_library_ci.pColorBlendState = nullptr;
+    libraries[2] =
+        make_library(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, fragment_library_ci);
+
+    VkGraphicsPipelineCreateInfo output_library_ci{pipeline_ci};
+    output_library_ci.stageCount = 0;
+    output_library_ci.pStages = nullptr;
+    output_library_ci.pVertexInputState = nullptr;
+    output_library_ci.pInputAssemblyState = nullptr;
+    output_library_ci.pTessellationState = nullptr;
+    output_library_ci.pViewportState = nullptr;
+    output_library_ci.pRasterizationState = nullptr;
+    output_library_ci.pDepthStencilState = nullptr;
+    output_library_ci.layout = VK_NULL_HANDLE;
+    libraries[3] =
+        make_library(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+                     output_library_ci);
+
+    const std::array library_handles{*libraries[0], *libraries[1], *libraries[2], *libraries[3]};
+    const VkPipelineLibraryCreateInfoKHR link_ci{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+        .pNext = nullptr,
+        .libraryCount = static_cast<u32>(library_handles.size()),
+        .pLibraries = library_handles.data(),
+    };
     pipeline = device.GetLogical().CreateGraphicsPipeline(
         {
             .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-            .pNext = nullptr,
-            .flags = flags,
-            .stageCount = static_cast<u32>(shader_stages.size()),
-            .pStages = shader_stages.data(),
-            .pVertexInputState = &vertex_input_ci,
-            .pInputAssemblyState = &input_assembly_ci,
-            .pTessellationState = &tessellation_ci,
-            .pViewportState = &viewport_ci,
-            .pRasterizationState = &rasterization_ci,
-            .pMultisampleState = &multisample_ci,
-            .pDepthStencilState = &depth_stencil_ci,
-            .pColorBlendState = &color_blend_ci,
-            .pDynamicState = &dynamic_state_ci,
+            .pNext = &link_ci,
+            .flags = DescriptorFlags(),
+            .stageCount = 0,
+            .pStages = nullptr,
+            .pVertexInputState = nullptr,
+            .pInputAssemblyState = nullptr,
+            .pTessellationState = nullptr,
+            .pViewportState = nullptr,
+            .pRasterizationState = nullptr,
+            .pMultisampleState = nullptr,
+            .pDepthStencilState = nullptr,
+            .pColorBlendState = nullptr,
+            .pDynamicState = nullptr,
+            .layout = *pipeline_layout,
+            .renderPass = VK_NULL_HANDLE,
+            .subpass = 0,
+            .basePipelineHandle = nullptr,
+            .basePipelineIndex = 0,
+        },
+        *pipeline_cache);
+}
+
+void GraphicsPipeline::MakeOptimizedPipeline() {
+    const std::array library_handles{*libraries[0], *libraries[1], *libraries[2], *libraries[3]};
+    const VkPipelineLibraryCreateInfoKHR link_ci{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+        .pNext = nullptr,
+        .libraryCount = static_cast<u32>(library_handles.size()),
+        .pLibraries = library_handles.data(),
+    };
+    optimized_pipeline = device.GetLogical().CreateGraphicsPipeline(
+        {
+            .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+            .pNext = &link_ci,
+            .flags = DescriptorFlags() | VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT,
+            .stageCount = 0,
+            .pStages = nullptr,
+            .pVertexInputState = nullptr,
+            .pInputAssemblyState = nullptr,
+            .pTessellationState = nullptr,
+            .pViewportState = nullptr,
+            .pRasterizationState = nullptr,
+            .pMultisampleState = nullptr,
+            .pDepthStencilState = nullptr,
+            .pColorBlendState = nullptr,
+            .pDynamicState = nullptr,
             .layout = *pipeline_layout,
-            .renderPass = render_pass,
+            .renderPass = VK_NULL_HANDLE,
             .subpass = 0,
             .basePipelineHandle = nullptr,
             .basePipelineIndex = 0,
         },
         *pipeline_cache);
+    is_optimized.store(true, std::memory_order::release);
 }
 
 void GraphicsPipeline::Validate() {
@@ -10,18 +10,21 @@
 #include <mutex>
 #include <type_traits>
 
-#include "common/thread_worker.h"
+#include "common/task_pool.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
+#include "video_core/renderer_vulkan/pipeline_statistics.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace VideoCore {
+class PipelineBuildQueue;
 class ShaderNotify;
-}
+} // namespace VideoCore
 
 namespace Vulkan {
 
@@ -59,7 +62,6 @@ struct hash<Vulkan::GraphicsPipelineCacheKey> {
 namespace Vulkan {
 
 class Device;
-class PipelineStatistics;
 class RenderPassCache;
 class RescalingPushConstant;
 class RenderAreaPushConstant;
@@ -73,8 +75,9 @@ public:
         Scheduler& scheduler, BufferCache& buffer_cache, TextureCache& texture_cache,
         vk::PipelineCache& pipeline_cache, VideoCore::ShaderNotify* shader_notify,
         const Device& device, DescriptorPool& descriptor_pool,
-        GuestDescriptorQueue& guest_descriptor_queue, Common::ThreadWorker* worker_thread,
-        PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
+        GuestDescriptorQueue& guest_descriptor_queue, VideoCore::PipelineBuildQueue* build_queue,
+        Common::TaskGroup* optimize_thread, PipelineStatistics* pipeline_statistics,
+        RenderPassCache& render_pass_cache,
         const GraphicsPipelineCacheKey& key, std::array<vk::ShaderModule, NUM_STAGES> stages,
         const std::array<const Shader::Info*, NUM_STAGES>& infos);
 
@@ -87,6 +90,9 @@ public:
     void AddTransition(GraphicsPipeline* transition);
 
     void Configure(bool is_indexed) {
+        if (pipeline_statistics) {
+            pipeline_statistics->MarkUse(statistics_hash);
+        }
         configure_func(this, is_indexed);
     }
 
@@ -120,7 +126,14 @@ private:
     void ConfigureDraw(const RescalingPushConstant& rescaling,
                        const RenderAreaPushConstant& render_are);
 
-    void MakePipeline(VkRenderPass render_pass);
+    void MakePipeline(VkRenderPass render_pass, bool use_libraries);
+
+    void MakeOptimizedPipeline();
+
+    /// Returns the pipeline creation flags required by the descriptor backend in use
+    VkPipelineCreateFlags DescriptorFlags() const noexcept {
+        return uses_descriptor_buffer ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
+    }
 
     void Validate();
 
@@ -133,6 +146,9 @@ private:
     vk::PipelineCache& pipeline_cache;
     Scheduler& scheduler;
     GuestDescriptorQueue& guest_descriptor_queue;
+    PipelineStatistics* pipeline_statistics;
+    VideoCore::ShaderNotify* shader_notify;
+    u64 statistics_hash{};
 
     void (*configure_func)(GraphicsPipeline*, bool){};
 
@@ -148,14 +164,23 @@ private:
 
     vk::DescriptorSetLayout descriptor_set_layout;
     DescriptorAllocator descriptor_allocator;
+    DescriptorBuffer* descriptor_buffer{};
+    DescriptorBufferLayout descriptor_buffer_layout;
     vk::PipelineLayout pipeline_layout;
     vk::DescriptorUpdateTemplate descriptor_update_template;
     vk::Pipeline pipeline;
 
+    /// Libraries the pipeline was fast-linked from, when it was built with pipeline libraries
+    std::array<vk::Pipeline, 4> libraries;
+    /// Pipeline linked with link time optimizations, replaces the fast-linked one once built
+    vk::Pipeline optimized_pipeline;
+    std::atomic_bool is_optimized{false};
+
     std::condition_variable build_condvar;
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
     bool uses_push_descriptor{false};
+    bool uses_descriptor_buffer{false};
 };
 
 } // namespace Vulkan
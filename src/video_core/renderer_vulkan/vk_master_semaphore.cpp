@@ -3,6 +3,7 @@
 
 #include <thread>
 
+#include "common/assert.h"
 #include "common/polyfill_ranges.h"
 #include "common/settings.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
@@ -13,7 +14,11 @@ namespace Vulkan {
 
 constexpr u64 FENCE_RESERVE_SIZE = 8;
 
-MasterSemaphore::MasterSemaphore(const Device& device_) : device(device_) {
+MasterSemaphore::MasterSemaphore(const Device& device_)
+    : MasterSemaphore(device_, device_.GetGraphicsQueue()) {}
+
+MasterSemaphore::MasterSemaphore(const Device& device_, vk::Queue queue_)
+    : device(device_), queue(queue_) {
     if (!device.HasTimelineSemaphore()) {
         static constexpr VkFenceCreateInfo fence_ci{
             .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, .pNext = nullptr, .flags = 0};
@@ -102,15 +107,44 @@ void MasterSemaphore::Wait(u64 tick) {
 
 VkResult MasterSemaphore::SubmitQueue(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
                                       VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
-                                      u64 host_tick) {
+                                      u64 host_tick,
+                                      std::span<const TimelineWait> wait_timelines) {
     if (semaphore) {
         return SubmitQueueTimeline(cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore,
-                                   host_tick);
+                                   host_tick, wait_timelines);
     } else {
+        ASSERT_MSG(wait_timelines.empty(),
+                   "Waiting for a timeline semaphore without device support");
         return SubmitQueueFence(cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, host_tick);
     }
 }
 
+VkResult MasterSemaphore::SubmitQueue(vk::Queue queue, vk::CommandBuffer& cmdbuf, u64 host_tick) {
+    ASSERT(semaphore);
+    const VkSemaphore timeline_semaphore = *semaphore;
+    const VkCommandBuffer cmdbuffer = *cmdbuf;
+    const VkTimelineSemaphoreSubmitInfo timeline_si{
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreValueCount = 0,
+        .pWaitSemaphoreValues = nullptr,
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues = &host_tick,
+    };
+    const VkSubmitInfo submit_info{
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = &timeline_si,
+        .waitSemaphoreCount = 0,
+        .pWaitSemaphores = nullptr,
+        .pWaitDstStageMask = nullptr,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &cmdbuffer,
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores = &timeline_semaphore,
+    };
+    return queue.Submit(submit_info);
+}
+
 static constexpr std::array<VkPipelineStageFlags, 2> wait_stage_masks{
     VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
     VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
@@ -119,7 +153,8 @@ static constexpr std::array<VkPipelineStageFlags, 2> wait_stage_masks{
 VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
                                               vk::CommandBuffer& upload_cmdbuf,
                                               VkSemaphore signal_semaphore,
-                                              VkSemaphore wait_semaphore, u64 host_tick) {
+                                              VkSemaphore wait_semaphore, u64 host_tick,
+                                              std::span<const TimelineWait> wait_timelines) {
     const VkSemaphore timeline_semaphore = *semaphore;
 
     const u32 num_signal_semaphores = signal_semaphore ? 2 : 1;
@@ -128,12 +163,30 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
 
     const std::array cmdbuffers{*upload_cmdbuf, *cmdbuf};
 
-    const u32 num_wait_semaphores = wait_semaphore ? 1 : 0;
+    // Work from other queues is waited for on all stages, as the barriers acquiring its resources
+    // can be anywhere in the submission
+    static constexpr size_t MAX_WAIT_SEMAPHORES = 4;
+    ASSERT(wait_timelines.size() < MAX_WAIT_SEMAPHORES);
+    u32 num_wait_semaphores = 0;
+    std::array<VkSemaphore, MAX_WAIT_SEMAPHORES> wait_semaphores{};
+    std::array<u64, MAX_WAIT_SEMAPHORES> wait_values{};
+    std::array<VkPipelineStageFlags, MAX_WAIT_SEMAPHORES> wait_stages{};
+    if (wait_semaphore) {
+        wait_semaphores[num_wait_semaphores] = wait_semaphore;
+        wait_stages[num_wait_semaphores] = wait_stage_masks[0];
+        ++num_wait_semaphores;
+    }
+    for (const TimelineWait& wait_timeline : wait_timelines) {
+        wait_semaphores[num_wait_semaphores] = wait_timeline.semaphore;
+        wait_values[num_wait_semaphores] = wait_timeline.value;
+        wait_stages[num_wait_semaphores] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        ++num_wait_semaphores;
+    }
     const VkTimelineSemaphoreSubmitInfo timeline_si{
         .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
         .pNext = nullptr,
-        .waitSemaphoreValueCount = 0,
-        .pWaitSemaphoreValues = nullptr,
+        .waitSemaphoreValueCount = num_wait_semaphores,
+        .pWaitSemaphoreValues = wait_values.data(),
         .signalSemaphoreValueCount = num_signal_semaphores,
         .pSignalSemaphoreValues = signal_values.data(),
     };
@@ -141,15 +194,15 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
         .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
         .pNext = &timeline_si,
         .waitSemaphoreCount = num_wait_semaphores,
-        .pWaitSemaphores = &wait_semaphore,
-        .pWaitDstStageMask = wait_stage_masks.data(),
+        .pWaitSemaphores = wait_semaphores.data(),
+        .pWaitDstStageMask = wait_stages.data(),
         .commandBufferCount = static_cast<u32>(cmdbuffers.size()),
         .pCommandBuffers = cmdbuffers.data(),
         .signalSemaphoreCount = num_signal_semaphores,
         .pSignalSemaphores = signal_semaphores.data(),
     };
 
-    return device.GetGraphicsQueue().Submit(submit_info);
+    return queue.Submit(submit_info);
 }
 
 VkResult MasterSemaphore::SubmitQueueFence(vk::CommandBuffer& cmdbuf,
@@ -174,7 +227,7 @@ VkResult MasterSemaphore::SubmitQueueFence(vk::CommandBuffer& cmdbuf,
     };
 
     auto fence = GetFreeFence();
-    auto result = device.GetGraphicsQueue().Submit(submit_info, *fence);
+    auto result = queue.Submit(submit_info, *fence);
 
     if (result == VK_SUCCESS) {
         std::scoped_lock lock{wait_mutex};
@@ -9,6 +9,7 @@
 #include <mutex>
 #include <thread>
 #include <queue>
+#include <span>
 
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
@@ -18,11 +19,18 @@ namespace Vulkan {
 
 class Device;
 
+/// Value of a timeline semaphore from another queue a submission has to wait for.
+struct TimelineWait {
+    VkSemaphore semaphore;
+    u64 value;
+};
+
 class MasterSemaphore {
     using Waitable = std::pair<u64, vk::Fence>;
 
 public:
     explicit MasterSemaphore(const Device& device);
+    explicit MasterSemaphore(const Device& device, vk::Queue queue);
     ~MasterSemaphore();
 
     /// Returns the current logical tick.
@@ -45,20 +53,31 @@ public:
         return current_tick.fetch_add(1, std::memory_order_release);
     }
 
+    /// Returns the timeline semaphore, null when the device doesn't support them
+    [[nodiscard]] VkSemaphore Handle() const noexcept {
+        return *semaphore;
+    }
+
     /// Refresh the known GPU tick
     void Refresh();
 
     /// Waits for a tick to be hit on the GPU
     void Wait(u64 tick);
 
-    /// Submits the device graphics queue, updating the tick as necessary
+    /// Submits the queue owning the semaphore, graphics by default, updating the tick as necessary.
+    /// The submission waits for each of wait_timelines to reach its value.
     VkResult SubmitQueue(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
-                         VkSemaphore signal_semaphore, VkSemaphore wait_semaphore, u64 host_tick);
+                         VkSemaphore signal_semaphore, VkSemaphore wait_semaphore, u64 host_tick,
+                         std::span<const TimelineWait> wait_timelines = {});
+
+    /// Submits a command buffer to a queue other than graphics, signalling host_tick on completion.
+    /// Requires timeline semaphores.
+    VkResult SubmitQueue(vk::Queue queue, vk::CommandBuffer& cmdbuf, u64 host_tick);
 
 private:
     VkResult SubmitQueueTimeline(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
                                  VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
-                                 u64 host_tick);
+                                 u64 host_tick, std::span<const TimelineWait> wait_timelines);
     VkResult SubmitQueueFence(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
                               VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
                               u64 host_tick);
@@ -69,6 +88,7 @@ private:
 
 private:
     const Device& device;             ///< Device.
+    vk::Queue queue;                  ///< Queue the command buffers are submitted to.
     vk::Semaphore semaphore;          ///< Timeline semaphore.
     std::atomic<u64> gpu_tick{0};     ///< Current known GPU tick.
     std::atomic<u64> current_tick{1}; ///< Current logical tick.
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include "video_core/renderer_vulkan/vk_pass_timer.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+
+namespace Vulkan {
+
+namespace {
+/// Timestamps in flight, one per pass. Passes past it are not timed.
+constexpr u32 NUM_QUERIES = 4096;
+} // Anonymous namespace
+
+PassTimer::PassTimer(const Device& device_, Scheduler& scheduler_)
+    : device{device_}, scheduler{scheduler_},
+      timestamp_period{static_cast<double>(device.GetTimestampPeriod())} {
+    query_pool = device.GetLogical().CreateQueryPool({
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = NUM_QUERIES,
+        .pipelineStatistics = 0,
+    });
+}
+
+PassTimer::~PassTimer() = default;
+
+void PassTimer::Mark(VideoCore::GpuPass pass, u64 target) {
+    if (!in_submission || (pass == current_pass && target == current_target)) {
+        return;
+    }
+    current_pass = pass;
+    current_target = target;
+    WriteMark(pass);
+}
+
+void PassTimer::BeginSubmission() {
+    in_submission = true;
+}
+
+void PassTimer::EndSubmission() {
+    Mark(VideoCore::GpuPass::Idle, 0);
+    in_submission = false;
+}
+
+void PassTimer::EndFrame() {
+    // The pass being recorded is reopened by the next mark, in the next frame
+    Mark(VideoCore::GpuPass::Idle, 0);
+    if (!current_frame.passes.empty()) {
+        pending_frames.push(std::move(current_frame));
+    }
+    current_frame = Frame{};
+
+    while (!pending_frames.empty() && scheduler.IsFree(pending_frames.front().tick)) {
+        ReadFrame(pending_frames.front());
+        pending_frames.pop();
+    }
+}
+
+void PassTimer::WriteMark(VideoCore::GpuPass pass) {
+    if (used_queries == NUM_QUERIES) {
+        // The GPU is too far behind, the frame would be missing the boundary of this pass
+        current_frame.complete = false;
+        return;
+    }
+    if (current_frame.passes.empty()) {
+        current_frame.first_query = next_query;
+        current_frame.cpu_time = std::chrono::steady_clock::now();
+    }
+    const u32 query = next_query;
+    next_query = (next_query + 1) % NUM_QUERIES;
+    ++used_queries;
+    current_frame.passes.push_back(pass);
+    current_frame.tick = scheduler.CurrentTick();
+
+    // The queries were read back before being handed out again, nothing uses them on the GPU.
+    // One timestamp both ends the previous pass and starts the next one, so it is written once
+    // the work recorded before it is done.
+    device.GetLogical().ResetQueryPool(*query_pool, query, 1);
+    scheduler.Record([pool = *query_pool, query](vk::CommandBuffer cmdbuf) {
+        cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, pool, query);
+    });
+}
+
+void PassTimer::ReadFrame(const Frame& frame) {
+    const u32 num_queries = static_cast<u32>(frame.passes.size());
+    used_queries -= num_queries;
+    if (!frame.complete) {
+        return;
+    }
+    std::vector<u64> timestamps(num_queries);
+    for (u32 read = 0; read < num_queries;) {
+        // The queries of a frame may wrap around the end of the pool
+        const u32 query = (frame.first_query + read) % NUM_QUERIES;
+        const u32 count = std::min(num_queries - read, NUM_QUERIES - query);
+        const VkResult result = device.GetLogical().GetQueryResults(
+            *query_pool, query, count, count * sizeof(u64), timestamps.data() + read,
+            sizeof(u64), VK_QUERY_RESULT_64_BIT);
+        if (result != VK_SUCCESS) {
+            return;
+        }
+        read += count;
+    }
+    std::vector<VideoCore::GpuPassMark> marks;
+    marks.reserve(num_queries);
+    for (u32 index = 0; index < num_queries; ++index) {
+        if (timestamps[index] < timestamps[0]) {
+            return;
+        }
+        // Converted relative to the first timestamp, large timestamps lose precision as doubles
+        const u64 ticks = timestamps[index] - timestamps[0];
+        marks.push_back({
+            .pass = frame.passes[index],
+            .timestamp_ns = static_cast<u64>(static_cast<double>(ticks) * timestamp_period),
+        });
+    }
+    timeline.AddFrame(marks, frame.cpu_time);
+}
+
+} // namespace Vulkan
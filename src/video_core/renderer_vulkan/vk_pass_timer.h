@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <queue>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/gpu_timeline.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class Scheduler;
+
+/**
+ * Times the guest passes recorded to a scheduler with timestamp queries and shows them on the GPU
+ * timeline.
+ *
+ * A timestamp is written every time the recorded work changes to another pass, it ends the
+ * previous pass and starts the next one. Passes are closed when a submission ends, so the time
+ * the GPU sits idle between submissions is not counted.
+ */
+class PassTimer {
+public:
+    explicit PassTimer(const Device& device, Scheduler& scheduler);
+    ~PassTimer();
+
+    /// Times the work recorded from now on as a pass, target tells sets of render targets apart
+    void Mark(VideoCore::GpuPass pass, u64 target);
+
+    /// Starts timing the submission being recorded, called by the scheduler
+    void BeginSubmission();
+
+    /// Stops timing the submission about to be sent, called by the scheduler
+    void EndSubmission();
+
+    /// Closes the current frame and adds the frames the GPU finished to the timeline
+    void EndFrame();
+
+private:
+    struct Frame {
+        u32 first_query{};
+        std::vector<VideoCore::GpuPass> passes;
+        std::chrono::steady_clock::time_point cpu_time;
+        u64 tick{};
+        bool complete{true};
+    };
+
+    /// Writes the timestamp starting a pass
+    void WriteMark(VideoCore::GpuPass pass);
+
+    /// Reads the timestamps of a finished frame and releases its queries
+    void ReadFrame(const Frame& frame);
+
+    const Device& device;
+    Scheduler& scheduler;
+    vk::QueryPool query_pool;
+    double timestamp_period{};
+    VideoCore::GpuTimeline timeline;
+
+    std::queue<Frame> pending_frames;
+    Frame current_frame{};
+    VideoCore::GpuPass current_pass{VideoCore::GpuPass::Idle};
+    u64 current_target{};
+    u32 next_query{};
+    u32 used_queries{};
+    bool in_submission{};
+};
+
+} // namespace Vulkan
@@ -8,11 +8,13 @@
 #include <thread>
 #include <vector>
 
-#include "common/bit_cast.h"
-#include "common/cityhash.h"
+#include "common/fast_hash.h"
+#include "common/fs/file_lock.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/microprofile.h"
+#include "common/thread.h"
+#include "common/task_pool.h"
 #include "common/thread_worker.h"
 #include "core/core.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
@@ -52,15 +54,53 @@ using VideoCommon::ComputeEnvironment;
 using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
 using VideoCommon::GraphicsEnvironment;
+using VideoCommon::PipelineUsage;
+using VideoCommon::PipelineUsageRecord;
 
-constexpr u32 CACHE_VERSION = 11;
+constexpr u32 CACHE_VERSION = 14;
 constexpr std::array<char, 8> VULKAN_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'v', 'k', 'c', 'h'};
 
+/// Pipelines first needed this soon after boot are built before the game starts
+constexpr u64 STARTUP_WORKING_SET_MS = 60'000;
+
 template <typename Container>
 auto MakeSpan(Container& container) {
     return std::span(container.data(), container.size());
 }
 
+/// Returns the fraction of the render area inside the first viewport and scissor of a draw
+f32 DrawCoverage(const Maxwell& regs) {
+    const f32 width = static_cast<f32>(regs.surface_clip.width);
+    const f32 height = static_cast<f32>(regs.surface_clip.height);
+    if (width <= 0.0f || height <= 0.0f) {
+        return 0.0f;
+    }
+    f32 left = 0.0f;
+    f32 top = 0.0f;
+    f32 right = width;
+    f32 bottom = height;
+    if (regs.viewport_scale_offset_enabled) {
+        const auto& viewport = regs.viewport_transform[0];
+        left = viewport.GetX();
+        top = viewport.GetY();
+        right = left + viewport.GetWidth();
+        bottom = top + viewport.GetHeight();
+    }
+    const auto& scissor = regs.scissor_test[0];
+    if (scissor.enable) {
+        left = std::max(left, static_cast<f32>(scissor.min_x.Value()));
+        top = std::max(top, static_cast<f32>(scissor.min_y.Value()));
+        right = std::min(right, static_cast<f32>(scissor.max_x.Value()));
+        bottom = std::min(bottom, static_cast<f32>(scissor.max_y.Value()));
+    }
+    const f32 covered_width = std::clamp(right, 0.0f, width) - std::clamp(left, 0.0f, width);
+    const f32 covered_height = std::clamp(bottom, 0.0f, height) - std::clamp(top, 0.0f, height);
+    if (covered_width <= 0.0f || covered_height <= 0.0f) {
+        return 0.0f;
+    }
+    return (covered_width * covered_height) / (width * height);
+}
+
 Shader::OutputTopology MaxwellToOutputTopology(Maxwell::PrimitiveTopology topology) {
     switch (topology) {
     case Maxwell::PrimitiveTopology::Points:
@@ -158,7 +198,9 @@ Shader::RuntimeInfo MakeRuntimeInfo(std::span<const Shader::IR::Program> program
     const Shader::Stage stage{program.stage};
     const bool has_geometry{key.unique_hashes[4] != 0 && !programs[4].is_geometry_passthrough};
     const bool gl_ndc{key.state.ndc_minus_one_to_one != 0};
-    const float point_size{Common::BitCast<float>(key.state.point_size)};
+    // Point size, alpha reference and Y direction are specialized when the pipeline is created.
+    // Emitting their defaults keeps the module identical for every value.
+    static constexpr float point_size{1.0f};
     switch (stage) {
     case Shader::Stage::VertexB:
         if (!has_geometry) {
@@ -226,7 +268,6 @@ Shader::RuntimeInfo MakeRuntimeInfo(std::span<const Shader::IR::Program> program
     case Shader::Stage::Fragment:
         info.alpha_test_func = MaxwellToCompareFunction(
             key.state.UnpackComparisonOp(key.state.alpha_test_func.Value()));
-        info.alpha_test_reference = Common::BitCast<float>(key.state.alpha_test_ref);
         break;
     default:
         break;
@@ -259,29 +300,13 @@ Shader::RuntimeInfo MakeRuntimeInfo(std::span<const Shader::IR::Program> program
         break;
     }
     info.force_early_z = key.state.early_z != 0;
-    info.y_negate = key.state.y_negate != 0;
     return info;
 }
 
-size_t GetTotalPipelineWorkers() {
-    const size_t max_core_threads =
-        std::max<size_t>(static_cast<size_t>(std::thread::hardware_concurrency()), 2ULL) - 1ULL;
-#ifdef ANDROID
-    // Leave at least a few cores free in android
-    constexpr size_t free_cores = 3ULL;
-    if (max_core_threads <= free_cores) {
-        return 1ULL;
-    }
-    return max_core_threads - free_cores;
-#else
-    return max_core_threads;
-#endif
-}
-
 } // Anonymous namespace
 
 size_t ComputePipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
+    const u64 hash = Common::FastHash64(this, sizeof *this);
     return static_cast<size_t>(hash);
 }
 
@@ -290,7 +315,7 @@ bool ComputePipelineCacheKey::operator==(const ComputePipelineCacheKey& rhs) con
 }
 
 size_t GraphicsPipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
+    const u64 hash = Common::FastHash64(this, Size());
     return static_cast<size_t>(hash);
 }
 
@@ -303,16 +328,19 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
                              DescriptorPool& descriptor_pool_,
                              GuestDescriptorQueue& guest_descriptor_queue_,
                              RenderPassCache& render_pass_cache_, BufferCache& buffer_cache_,
-                             TextureCache& texture_cache_, VideoCore::ShaderNotify& shader_notify_)
+                             TextureCache& texture_cache_, VideoCore::ShaderNotify& shader_notify_,
+                             VideoCore::PipelineStats& pipeline_stats)
     : VideoCommon::ShaderCache{device_memory_}, device{device_}, scheduler{scheduler_},
       descriptor_pool{descriptor_pool_}, guest_descriptor_queue{guest_descriptor_queue_},
       render_pass_cache{render_pass_cache_}, buffer_cache{buffer_cache_},
       texture_cache{texture_cache_}, shader_notify{shader_notify_},
       use_asynchronous_shaders{Settings::values.use_asynchronous_shaders.GetValue()},
       use_vulkan_pipeline_cache{Settings::values.use_vulkan_driver_pipeline_cache.GetValue()},
-      workers(device.HasBrokenParallelShaderCompiling() ? 1ULL : GetTotalPipelineWorkers(),
-              "VkPipelineBuilder"),
-      serialization_thread(1, "VkPipelineSerialization") {
+      workers(Common::TaskPriority::Normal,
+              device.HasBrokenParallelShaderCompiling() ? 1ULL : Common::GetTaskPoolSize()),
+      build_queue(workers),
+      serialization_thread(Common::TaskPriority::Normal, 1),
+      background_workers(Common::TaskPriority::Background) {
     const auto& float_control{device.FloatControlProperties()};
     const VkDriverId driver_id{device.GetDriverID()};
     profile = Shader::Profile{
@@ -356,6 +384,8 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
 
         .warp_size_potentially_larger_than_guest = device.IsWarpSizePotentiallyBiggerThanGuest(),
 
+        .storage_buffer_pointers = device.IsStorageBufferPointersEnabled(),
+
         .lower_left_origin_mode = false,
         .need_declared_frag_colors = false,
         .need_gather_subpixel_offset = driver_id == VK_DRIVER_ID_AMD_PROPRIETARY ||
@@ -409,6 +439,9 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
         .has_extended_dynamic_state_3_enables = device.IsExtExtendedDynamicState3EnablesSupported(),
         .has_dynamic_vertex_input = device.IsExtVertexInputDynamicStateSupported(),
     };
+    if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
+        statistics = std::make_unique<PipelineStatistics>(device, pipeline_stats);
+    }
 }
 
 PipelineCache::~PipelineCache() {
@@ -450,20 +483,31 @@ ComputePipeline* PipelineCache::CurrentComputePipeline() {
         .shared_memory_size = qmd.shared_alloc,
         .workgroup_size{qmd.block_dim_x, qmd.block_dim_y, qmd.block_dim_z},
     };
+    AdoptBackgroundPipelines();
     const auto [pair, is_new]{compute_cache.try_emplace(key)};
     auto& pipeline{pair->second};
     if (!is_new) {
+        if (!compute_usage.empty()) {
+            RecordFirstUse(compute_usage, key);
+        }
         return pipeline.get();
     }
     pipeline = CreateComputePipeline(key, shader);
+    // The dispatch waits for the pipeline, so it is treated as covering the whole screen
+    build_queue.Request(pipeline.get(), 1.0f);
     return pipeline.get();
 }
 
 void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
-                                      const VideoCore::DiskResourceLoadCallback& callback) {
+                                      const VideoCore::DiskResourceLoadCallback& callback,
+                                      bool build_all) {
     if (title_id == 0) {
         return;
     }
+    if (build_all && !use_vulkan_pipeline_cache) {
+        LOG_WARNING(Render_Vulkan,
+                    "The driver pipeline cache is disabled, pipelines won't be saved");
+    }
     const auto shader_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::ShaderDir)};
     const auto base_dir{shader_dir / fmt::format("{:016x}", title_id)};
     if (!Common::FS::CreateDir(shader_dir) || !Common::FS::CreateDir(base_dir)) {
@@ -483,71 +527,159 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
         size_t total{};
         size_t built{};
         bool has_loaded{};
-        std::unique_ptr<PipelineStatistics> statistics;
     } state;
 
-    if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
-        state.statistics = std::make_unique<PipelineStatistics>(device);
-    }
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
-        ComputePipelineCacheKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
-
-        workers.QueueWork([this, key, env_ = std::move(env), &state, &callback]() mutable {
-            ShaderPools pools;
-            auto pipeline{CreateComputePipeline(pools, key, env_, state.statistics.get(), false)};
-            std::scoped_lock lock{state.mutex};
-            if (pipeline) {
-                compute_cache.emplace(key, std::move(pipeline));
-            }
-            ++state.built;
-            if (state.has_loaded) {
-                callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
-            }
+    // Pipelines are built in the order previous sessions first needed them. Only the startup
+    // working set blocks the boot, the rest is built on low priority threads while playing.
+    // Precompiling builds everything up front.
+    struct LoadJob {
+        u64 first_use_ms;
+        Common::UniqueFunction<void> build;
+    };
+    std::vector<LoadJob> startup_jobs;
+    std::vector<LoadJob> background_jobs;
+    const auto is_startup{[build_all](const PipelineUsageRecord& record) {
+        return build_all || record.usage.first_use_ms <= STARTUP_WORKING_SET_MS;
+    }};
+
+    const auto load_compute{[&](VideoCommon::CachedPipeline cached) {
+        const std::optional key{cached.ReadKey<ComputePipelineCacheKey>()};
+        if (!key) {
+            return;
+        }
+        const PipelineUsageRecord record{cached.Record()};
+        compute_usage.emplace(*key, record);
+
+        // Environments are decompressed by the worker that builds the pipeline
+        if (!is_startup(record)) {
+            background_jobs.push_back({
+                record.usage.first_use_ms,
+                [this, key = *key, cached_ = std::move(cached)] {
+                    Common::SetCurrentThreadPriority(Common::ThreadPriority::Low);
+                    std::vector<FileEnvironment> envs{cached_.Environments()};
+                    if (envs.empty()) {
+                        return;
+                    }
+                    ShaderPools pools;
+                    auto pipeline{
+                        CreateComputePipeline(pools, key, envs.front(), statistics.get(), false)};
+                    if (!pipeline) {
+                        // Adopting a failed pipeline would keep the key from being built on use
+                        return;
+                    }
+                    std::scoped_lock lock{background.mutex};
+                    background.compute.emplace_back(key, std::move(pipeline));
+                    background.has_pipelines.store(true, std::memory_order::release);
+                },
+            });
+            return;
+        }
+        startup_jobs.push_back({
+            record.usage.first_use_ms,
+            [this, key = *key, cached_ = std::move(cached), &state, &callback] {
+                std::unique_ptr<ComputePipeline> pipeline;
+                std::vector<FileEnvironment> envs{cached_.Environments()};
+                if (!envs.empty()) {
+                    ShaderPools pools;
+                    pipeline =
+                        CreateComputePipeline(pools, key, envs.front(), statistics.get(), false);
+                }
+                std::scoped_lock lock{state.mutex};
+                if (pipeline) {
+                    compute_cache.emplace(key, std::move(pipeline));
+                }
+                ++state.built;
+                if (state.has_loaded) {
+                    callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
+                }
+            },
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
-        GraphicsPipelineCacheKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
-
-        if ((key.state.extended_dynamic_state != 0) !=
+    const auto load_graphics{[&](VideoCommon::CachedPipeline cached) {
+        const std::optional key{cached.ReadKey<GraphicsPipelineCacheKey>()};
+        if (!key) {
+            return;
+        }
+        // Skipped pipelines never have their environments decompressed
+        if ((key->state.extended_dynamic_state != 0) !=
                 dynamic_features.has_extended_dynamic_state ||
-            (key.state.extended_dynamic_state_2 != 0) !=
+            (key->state.extended_dynamic_state_2 != 0) !=
                 dynamic_features.has_extended_dynamic_state_2 ||
-            (key.state.extended_dynamic_state_2_extra != 0) !=
+            (key->state.extended_dynamic_state_2_extra != 0) !=
                 dynamic_features.has_extended_dynamic_state_2_extra ||
-            (key.state.extended_dynamic_state_3_blend != 0) !=
+            (key->state.extended_dynamic_state_3_blend != 0) !=
                 dynamic_features.has_extended_dynamic_state_3_blend ||
-            (key.state.extended_dynamic_state_3_enables != 0) !=
+            (key->state.extended_dynamic_state_3_enables != 0) !=
                 dynamic_features.has_extended_dynamic_state_3_enables ||
-            (key.state.dynamic_vertex_input != 0) != dynamic_features.has_dynamic_vertex_input) {
+            (key->state.dynamic_vertex_input != 0) != dynamic_features.has_dynamic_vertex_input) {
             return;
         }
-        workers.QueueWork([this, key, envs_ = std::move(envs), &state, &callback]() mutable {
-            ShaderPools pools;
-            boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
-            for (auto& env : envs_) {
-                env_ptrs.push_back(&env);
-            }
-            auto pipeline{CreateGraphicsPipeline(pools, key, MakeSpan(env_ptrs),
-                                                 state.statistics.get(), false)};
-
-            std::scoped_lock lock{state.mutex};
-            if (pipeline) {
-                graphics_cache.emplace(key, std::move(pipeline));
-            }
-            ++state.built;
-            if (state.has_loaded) {
-                callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
-            }
+        const PipelineUsageRecord record{cached.Record()};
+        graphics_usage.emplace(*key, record);
+
+        if (!is_startup(record)) {
+            background_jobs.push_back({
+                record.usage.first_use_ms,
+                [this, key = *key, cached_ = std::move(cached)] {
+                    Common::SetCurrentThreadPriority(Common::ThreadPriority::Low);
+                    std::vector<FileEnvironment> envs{cached_.Environments()};
+                    if (envs.empty()) {
+                        return;
+                    }
+                    ShaderPools pools;
+                    boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
+                    for (auto& env : envs) {
+                        env_ptrs.push_back(&env);
+                    }
+                    auto pipeline{CreateGraphicsPipeline(pools, key, MakeSpan(env_ptrs),
+                                                         statistics.get(), false)};
+                    if (!pipeline) {
+                        return;
+                    }
+                    std::scoped_lock lock{background.mutex};
+                    background.graphics.emplace_back(key, std::move(pipeline));
+                    background.has_pipelines.store(true, std::memory_order::release);
+                },
+            });
+            return;
+        }
+        startup_jobs.push_back({
+            record.usage.first_use_ms,
+            [this, key = *key, cached_ = std::move(cached), &state, &callback] {
+                std::unique_ptr<GraphicsPipeline> pipeline;
+                std::vector<FileEnvironment> envs{cached_.Environments()};
+                if (!envs.empty()) {
+                    ShaderPools pools;
+                    boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
+                    for (auto& env : envs) {
+                        env_ptrs.push_back(&env);
+                    }
+                    pipeline = CreateGraphicsPipeline(pools, key, MakeSpan(env_ptrs),
+                                                      statistics.get(), false);
+                }
+                std::scoped_lock lock{state.mutex};
+                if (pipeline) {
+                    graphics_cache.emplace(key, std::move(pipeline));
+                }
+                ++state.built;
+                if (state.has_loaded) {
+                    callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
+                }
+            },
         });
         ++state.total;
     }};
     VideoCommon::LoadPipelines(stop_loading, pipeline_cache_filename, CACHE_VERSION, load_compute,
                                load_graphics);
 
-    LOG_INFO(Render_Vulkan, "Total Pipeline Count: {}", state.total);
+    LOG_INFO(Render_Vulkan, "Total Pipeline Count: {}, {} built in the background",
+             state.total + background_jobs.size(), background_jobs.size());
+
+    std::ranges::stable_sort(startup_jobs, {}, &LoadJob::first_use_ms);
+    for (LoadJob& job : startup_jobs) {
+        workers.QueueWork(std::move(job.build));
+    }
 
     std::unique_lock lock{state.mutex};
     callback(VideoCore::LoadCallbackStage::Build, 0, state.total);
@@ -556,21 +688,32 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
 
     workers.WaitForRequests(stop_loading);
 
+    if (!stop_loading.stop_requested()) {
+        std::ranges::stable_sort(background_jobs, {}, &LoadJob::first_use_ms);
+        for (LoadJob& job : background_jobs) {
+            background_workers.QueueWork(std::move(job.build));
+        }
+    }
+    boot_time = std::chrono::steady_clock::now();
+
     if (use_vulkan_pipeline_cache) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
                                      CACHE_VERSION);
     }
 
-    if (state.statistics) {
-        state.statistics->Report();
+    if (statistics) {
+        statistics->Report();
     }
 }
 
 GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
+    AdoptBackgroundPipelines();
     const auto [pair, is_new]{graphics_cache.try_emplace(graphics_key)};
     auto& pipeline{pair->second};
     if (is_new) {
         pipeline = CreateGraphicsPipeline();
+    } else if (!graphics_usage.empty()) {
+        RecordFirstUse(graphics_usage, graphics_key);
     }
     if (!pipeline) {
         return nullptr;
@@ -582,16 +725,18 @@ GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
     return BuiltPipeline(current_pipeline);
 }
 
-GraphicsPipeline* PipelineCache::BuiltPipeline(GraphicsPipeline* pipeline) const noexcept {
+GraphicsPipeline* PipelineCache::BuiltPipeline(GraphicsPipeline* pipeline) noexcept {
     if (pipeline->IsBuilt()) {
         return pipeline;
     }
+    build_queue.Request(pipeline, DrawCoverage(maxwell3d->regs));
     if (!use_asynchronous_shaders) {
         return pipeline;
     }
     // If something is using depth, we can assume that games are not rendering anything which
     // will be used one time.
     if (maxwell3d->regs.zeta_enable) {
+        shader_notify.MarkDrawSkipped();
         return nullptr;
     }
     // If games are using a small index count, we can assume these are full screen quads.
@@ -601,6 +746,7 @@ GraphicsPipeline* PipelineCache::BuiltPipeline(GraphicsPipeline* pipeline) const
     if (draw_state.index_buffer.count <= 6 || draw_state.vertex_buffer.count <= 6) {
         return pipeline;
     }
+    shader_notify.MarkDrawSkipped();
     return nullptr;
 }
 
@@ -608,6 +754,7 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     ShaderPools& pools, const GraphicsPipelineCacheKey& key,
     std::span<Shader::Environment* const> envs, PipelineStatistics* statistics,
     bool build_in_parallel) try {
+    const auto translate_start{std::chrono::steady_clock::now()};
     auto hash = key.Hash();
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
     size_t env_index{0};
@@ -618,6 +765,45 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     // Layer passthrough generation for devices without VK_EXT_shader_viewport_index_layer
     Shader::IR::Program* layer_source_program{};
 
+    // Stages are translated independently of each other, emission below links them in order
+    std::array<Shader::Environment*, Maxwell::MaxShaderProgram> stage_envs{};
+    std::array<size_t, Maxwell::MaxShaderProgram> stage_indices{};
+    size_t num_stages{};
+    for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+        if (key.unique_hashes[index] == 0) {
+            continue;
+        }
+        stage_envs[index] = envs[env_index];
+        stage_indices[num_stages] = index;
+        ++num_stages;
+        ++env_index;
+    }
+    const auto translate_stage{[&](size_t stage) {
+        const size_t index{stage_indices[stage]};
+        ShaderPools& stage_pool{build_in_parallel ? stage_pools[index] : pools};
+        Shader::Environment& env{*stage_envs[index]};
+        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
+        const auto translate{[&](Shader::Environment& translate_env) {
+            Shader::Maxwell::Flow::CFG cfg(translate_env, stage_pool.flow_block, cfg_offset,
+                                           index == 0);
+            return TranslateProgram(stage_pool.inst, stage_pool.block, translate_env, cfg,
+                                    host_info);
+        }};
+        programs[index] = translation_cache.Translate(stage_pool.inst, stage_pool.block, env,
+                                                      key.unique_hashes[index], host_info,
+                                                      translate);
+    }};
+    if (build_in_parallel) {
+        for (ShaderPools& stage_pool : stage_pools) {
+            stage_pool.ReleaseContents();
+        }
+        Common::ParallelForEach(workers, num_stages, translate_stage);
+    } else {
+        for (size_t stage = 0; stage < num_stages; ++stage) {
+            translate_stage(stage);
+        }
+    }
+
     for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
         const bool is_emulated_stage = layer_source_program != nullptr &&
                                        index == static_cast<u32>(Maxwell::ShaderType::Geometry);
@@ -630,19 +816,10 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         if (key.unique_hashes[index] == 0) {
             continue;
         }
-        Shader::Environment& env{*envs[env_index]};
-        ++env_index;
-
-        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
-        Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, cfg_offset, index == 0);
-        if (!uses_vertex_a || index != 1) {
-            // Normal path
-            programs[index] = TranslateProgram(pools.inst, pools.block, env, cfg, host_info);
-        } else {
+        Shader::Environment& env{*stage_envs[index]};
+        if (uses_vertex_a && index == 1) {
             // VertexB path when VertexA is present.
-            auto& program_va{programs[0]};
-            auto program_vb{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
-            programs[index] = MergeDualVertexPrograms(program_va, program_vb, env);
+            programs[index] = MergeDualVertexPrograms(programs[0], programs[index], env);
         }
 
         if (Settings::values.dump_shaders) {
@@ -682,11 +859,19 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         }
         previous_stage = &program;
     }
-    Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
+    VideoCore::PipelineBuildQueue* const builds{build_in_parallel ? &build_queue : nullptr};
+    // Pipelines built at runtime are fast-linked first and optimized later in the background
+    Common::TaskGroup* const optimize_thread{
+        build_in_parallel && device.IsExtGraphicsPipelineLibrarySupported() ? &workers : nullptr};
+    if (statistics) {
+        const auto translate_time{std::chrono::steady_clock::now() - translate_start};
+        statistics->CollectTranslation(
+            hash, false, std::chrono::duration_cast<std::chrono::microseconds>(translate_time));
+    }
     return std::make_unique<GraphicsPipeline>(
         scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
-        descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache, key,
-        std::move(modules), infos);
+        descriptor_pool, guest_descriptor_queue, builds, optimize_thread, statistics,
+        render_pass_cache, key, std::move(modules), infos);
 
 } catch (const Shader::Exception& exception) {
     auto hash = key.Hash();
@@ -711,12 +896,17 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
     GetGraphicsEnvironments(environments, graphics_key.unique_hashes);
 
     main_pools.ReleaseContents();
-    auto pipeline{
-        CreateGraphicsPipeline(main_pools, graphics_key, environments.Span(), nullptr, true)};
+    auto pipeline{CreateGraphicsPipeline(main_pools, graphics_key, environments.Span(),
+                                         statistics.get(), true)};
     if (!pipeline || pipeline_cache_filename.empty()) {
         return pipeline;
     }
-    serialization_thread.QueueWork([this, key = graphics_key, envs = std::move(environments.envs)] {
+    // Pipelines requested before the background loader got to them are already on disk
+    if (RecordFirstUse(graphics_usage, graphics_key)) {
+        return pipeline;
+    }
+    serialization_thread.QueueWork([this, key = graphics_key, envs = std::move(environments.envs),
+                                    usage = NewPipelineUsage()] {
         boost::container::static_vector<const GenericEnvironment*, Maxwell::MaxShaderProgram>
             env_ptrs;
         for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
@@ -724,7 +914,7 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
                 env_ptrs.push_back(&envs[index]);
             }
         }
-        SerializePipeline(key, env_ptrs, pipeline_cache_filename, CACHE_VERSION);
+        SerializePipeline(key, env_ptrs, pipeline_cache_filename, CACHE_VERSION, usage);
     });
     return pipeline;
 }
@@ -737,20 +927,68 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
     env.SetCachedSize(shader->size_bytes);
 
     main_pools.ReleaseContents();
-    auto pipeline{CreateComputePipeline(main_pools, key, env, nullptr, true)};
+    auto pipeline{CreateComputePipeline(main_pools, key, env, statistics.get(), true)};
     if (!pipeline || pipeline_cache_filename.empty()) {
         return pipeline;
     }
-    serialization_thread.QueueWork([this, key, env_ = std::move(env)] {
+    if (RecordFirstUse(compute_usage, key)) {
+        return pipeline;
+    }
+    serialization_thread.QueueWork([this, key, env_ = std::move(env), usage = NewPipelineUsage()] {
         SerializePipeline(key, std::array<const GenericEnvironment*, 1>{&env_},
-                          pipeline_cache_filename, CACHE_VERSION);
+                          pipeline_cache_filename, CACHE_VERSION, usage);
     });
     return pipeline;
 }
 
+void PipelineCache::AdoptBackgroundPipelines() {
+    if (!background.has_pipelines.load(std::memory_order::acquire)) {
+        return;
+    }
+    std::scoped_lock lock{background.mutex};
+    // Pipelines the game needed before they were loaded have already been built again
+    for (auto& [key, pipeline] : background.compute) {
+        compute_cache.try_emplace(key, std::move(pipeline));
+    }
+    for (auto& [key, pipeline] : background.graphics) {
+        graphics_cache.try_emplace(key, std::move(pipeline));
+    }
+    background.compute.clear();
+    background.graphics.clear();
+    background.has_pipelines.store(false, std::memory_order::relaxed);
+}
+
+template <typename Key>
+bool PipelineCache::RecordFirstUse(std::unordered_map<Key, PipelineUsageRecord>& records,
+                                   const Key& key) {
+    const auto node{records.extract(key)};
+    if (!node) {
+        return false;
+    }
+    // Keep the earliest use across sessions, so the startup working set only grows
+    PipelineUsageRecord record{node.mapped()};
+    const PipelineUsage usage{NewPipelineUsage()};
+    record.usage.first_use_ms = std::min(record.usage.first_use_ms, usage.first_use_ms);
+    ++record.usage.use_count;
+    serialization_thread.QueueWork([this, record] {
+        VideoCommon::UpdatePipelineUsage(pipeline_cache_filename, std::span(&record, 1));
+    });
+    return true;
+}
+
+PipelineUsage PipelineCache::NewPipelineUsage() const {
+    const auto elapsed{std::chrono::steady_clock::now() - boot_time};
+    return PipelineUsage{
+        .first_use_ms = static_cast<u64>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()),
+        .use_count = 1,
+    };
+}
+
 std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
     ShaderPools& pools, const ComputePipelineCacheKey& key, Shader::Environment& env,
     PipelineStatistics* statistics, bool build_in_parallel) try {
+    const auto translate_start{std::chrono::steady_clock::now()};
     auto hash = key.Hash();
     if (device.HasBrokenCompute()) {
         LOG_ERROR(Render_Vulkan, "Skipping 0x{:016x}", hash);
@@ -759,14 +997,17 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
 
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
 
-    Shader::Maxwell::Flow::CFG cfg{env, pools.flow_block, env.StartAddress()};
-
     // Dump it before error.
     if (Settings::values.dump_shaders) {
         env.Dump(hash, key.unique_hash);
     }
 
-    auto program{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
+    const auto translate{[&](Shader::Environment& translate_env) {
+        Shader::Maxwell::Flow::CFG cfg{translate_env, pools.flow_block, env.StartAddress()};
+        return TranslateProgram(pools.inst, pools.block, translate_env, cfg, host_info);
+    }};
+    auto program{translation_cache.Translate(pools.inst, pools.block, env, key.unique_hash,
+                                             host_info, translate)};
     const std::vector<u32> code{EmitSPIRV(profile, program)};
     device.SaveShader(code);
     vk::ShaderModule spv_module{BuildShader(device, code)};
@@ -774,9 +1015,14 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
         const auto name{fmt::format("Shader {:016x}", key.unique_hash)};
         spv_module.SetObjectNameEXT(name.c_str());
     }
-    Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
+    VideoCore::PipelineBuildQueue* const builds{build_in_parallel ? &build_queue : nullptr};
+    if (statistics) {
+        const auto translate_time{std::chrono::steady_clock::now() - translate_start};
+        statistics->CollectTranslation(
+            hash, true, std::chrono::duration_cast<std::chrono::microseconds>(translate_time));
+    }
     return std::make_unique<ComputePipeline>(device, vulkan_pipeline_cache, descriptor_pool,
-                                             guest_descriptor_queue, thread_worker, statistics,
+                                             guest_descriptor_queue, builds, statistics, hash,
                                              &shader_notify, program.info, std::move(spv_module));
 
 } catch (const Shader::Exception& exception) {
@@ -787,6 +1033,8 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
 void PipelineCache::SerializeVulkanPipelineCache(const std::filesystem::path& filename,
                                                  const vk::PipelineCache& pipeline_cache,
                                                  u32 cache_version) try {
+    const Common::FS::FileLock lock{Common::FS::FileLock::LockPathFor(filename),
+                                    Common::FS::FileLockMode::Exclusive};
     std::ofstream file(filename, std::ios::binary);
     file.exceptions(std::ifstream::failbit);
     if (!file.is_open()) {
@@ -829,6 +1077,9 @@ vk::PipelineCache PipelineCache::LoadVulkanPipelineCache(const std::filesystem::
         return device.GetLogical().CreatePipelineCache(pipeline_cache_ci);
     };
     try {
+        // Keeps other instances sharing the cache directory from rewriting the file while it's read
+        const Common::FS::FileLock lock{Common::FS::FileLock::LockPathFor(filename),
+                                        Common::FS::FileLockMode::Shared};
         std::ifstream file(filename, std::ios::binary | std::ios::ate);
         if (!file.is_open()) {
             return create_pipeline_cache(0, nullptr);
@@ -4,15 +4,19 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "common/common_types.h"
-#include "common/thread_worker.h"
+#include "common/task_pool.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
@@ -21,12 +25,14 @@
 #include "shader_recompiler/profile.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/pipeline_build_queue.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 #include "video_core/renderer_vulkan/vk_compute_pipeline.h"
 #include "video_core/renderer_vulkan/vk_graphics_pipeline.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/shader_cache.h"
+#include "video_core/shader_environment.h"
 
 namespace Core {
 class System;
@@ -37,8 +43,9 @@ struct Program;
 }
 
 namespace VideoCore {
+class PipelineStats;
 class ShaderNotify;
-}
+} // namespace VideoCore
 
 namespace Vulkan {
 
@@ -103,20 +110,37 @@ public:
                            Scheduler& scheduler, DescriptorPool& descriptor_pool,
                            GuestDescriptorQueue& guest_descriptor_queue,
                            RenderPassCache& render_pass_cache, BufferCache& buffer_cache,
-                           TextureCache& texture_cache, VideoCore::ShaderNotify& shader_notify_);
+                           TextureCache& texture_cache, VideoCore::ShaderNotify& shader_notify_,
+                           VideoCore::PipelineStats& pipeline_stats);
     ~PipelineCache();
 
     [[nodiscard]] GraphicsPipeline* CurrentGraphicsPipeline();
 
     [[nodiscard]] ComputePipeline* CurrentComputePipeline();
 
+    /**
+     * Loads the pipelines of a title from the disk cache. Only the startup working set is built
+     * before returning, the rest is built in the background unless build_all is set.
+     */
     void LoadDiskResources(u64 title_id, std::stop_token stop_loading,
-                           const VideoCore::DiskResourceLoadCallback& callback);
+                           const VideoCore::DiskResourceLoadCallback& callback, bool build_all);
 
 private:
     [[nodiscard]] GraphicsPipeline* CurrentGraphicsPipelineSlowPath();
 
-    [[nodiscard]] GraphicsPipeline* BuiltPipeline(GraphicsPipeline* pipeline) const noexcept;
+    [[nodiscard]] GraphicsPipeline* BuiltPipeline(GraphicsPipeline* pipeline) noexcept;
+
+    /// Moves pipelines finished by the background loader into the caches
+    void AdoptBackgroundPipelines();
+
+    /// Updates the usage of a pipeline loaded from disk the first time it's used this session
+    /// @returns True when the pipeline was loaded from the pipeline cache file
+    template <typename Key>
+    bool RecordFirstUse(std::unordered_map<Key, VideoCommon::PipelineUsageRecord>& records,
+                        const Key& key);
+
+    /// Returns the usage to serialize along new pipelines
+    [[nodiscard]] VideoCommon::PipelineUsage NewPipelineUsage() const;
 
     std::unique_ptr<GraphicsPipeline> CreateGraphicsPipeline();
 
@@ -148,6 +172,8 @@ private:
     BufferCache& buffer_cache;
     TextureCache& texture_cache;
     VideoCore::ShaderNotify& shader_notify;
+    /// Driver statistics of the pipelines, only when shader feedback is enabled
+    std::unique_ptr<PipelineStatistics> statistics;
     bool use_asynchronous_shaders{};
     bool use_vulkan_pipeline_cache{};
 
@@ -158,18 +184,39 @@ private:
     std::unordered_map<GraphicsPipelineCacheKey, std::unique_ptr<GraphicsPipeline>> graphics_cache;
 
     ShaderPools main_pools;
+    /// Pools of the stages translated in parallel when building pipelines at runtime
+    std::array<ShaderPools, Maxwell::MaxShaderProgram> stage_pools;
 
     Shader::Profile profile;
     Shader::HostTranslateInfo host_info;
 
     std::filesystem::path pipeline_cache_filename;
 
+    /// Usage of the pipelines in the cache file that haven't been used yet this session
+    std::unordered_map<ComputePipelineCacheKey, VideoCommon::PipelineUsageRecord> compute_usage;
+    std::unordered_map<GraphicsPipelineCacheKey, VideoCommon::PipelineUsageRecord> graphics_usage;
+    /// First use timestamps are relative to the moment the game started running
+    std::chrono::steady_clock::time_point boot_time{std::chrono::steady_clock::now()};
+
+    struct BackgroundPipelines {
+        std::mutex mutex;
+        std::atomic_bool has_pipelines{};
+        std::vector<std::pair<ComputePipelineCacheKey, std::unique_ptr<ComputePipeline>>> compute;
+        std::vector<std::pair<GraphicsPipelineCacheKey, std::unique_ptr<GraphicsPipeline>>>
+            graphics;
+    } background;
+
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
 
-    Common::ThreadWorker workers;
-    Common::ThreadWorker serialization_thread;
+    Common::TaskGroup workers;
+    /// Orders the pipelines built on the workers at runtime
+    VideoCore::PipelineBuildQueue build_queue;
+    Common::TaskGroup serialization_thread;
     DynamicFeatures dynamic_features;
+
+    // Destroyed first, the pipelines being loaded in the background reference the members above
+    Common::TaskGroup background_workers;
 };
 
 } // namespace Vulkan
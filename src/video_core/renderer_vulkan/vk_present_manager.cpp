@@ -1,10 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
 #include "common/thread.h"
 #include "core/frontend/emu_window.h"
+#include "video_core/gpu.h"
 #include "video_core/renderer_vulkan/vk_present_manager.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_swapchain.h"
@@ -18,6 +20,9 @@ MICROPROFILE_DEFINE(Vulkan_CopyToSwapchain, "Vulkan", "Copy to swapchain", MP_RG
 
 namespace {
 
+// Longest wait for a frame to be displayed, so a hidden window can't stall the renderer
+constexpr u64 PRESENT_WAIT_TIMEOUT_NS = 100'000'000;
+
 bool CanBlitToSwapchain(const vk::PhysicalDevice& physical_device, VkFormat format) {
     const VkFormatProperties props{physical_device.GetFormatProperties(format)};
     return (props.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_DST_BIT);
@@ -97,13 +102,21 @@ bool CanBlitToSwapchain(const vk::PhysicalDevice& physical_device, VkFormat form
 PresentManager::PresentManager(const vk::Instance& instance_,
                                Core::Frontend::EmuWindow& render_window_, const Device& device_,
                                MemoryAllocator& memory_allocator_, Scheduler& scheduler_,
-                               Swapchain& swapchain_, vk::SurfaceKHR& surface_)
+                               Scheduler& render_scheduler_, Swapchain& swapchain_,
+                               vk::SurfaceKHR& surface_, Tegra::GPU& gpu_)
     : instance{instance_}, render_window{render_window_}, device{device_},
-      memory_allocator{memory_allocator_}, scheduler{scheduler_}, swapchain{swapchain_},
-      surface{surface_}, blit_supported{CanBlitToSwapchain(device.GetPhysical(),
-                                                           swapchain.GetImageViewFormat())},
-      use_present_thread{Settings::values.async_presentation.GetValue()} {
+      memory_allocator{memory_allocator_}, scheduler{scheduler_},
+      render_scheduler{render_scheduler_}, swapchain{swapchain_}, surface{surface_}, gpu{gpu_},
+      blit_supported{
+          CanBlitToSwapchain(device.GetPhysical(), swapchain.GetImageViewFormat())},
+      use_present_thread{Settings::values.async_presentation.GetValue()},
+      use_low_latency{Settings::values.use_low_latency_mode.GetValue() &&
+                      device.IsKhrPresentWaitSupported()},
+      max_frames_in_flight{Settings::values.max_frames_in_flight.GetValue()} {
     SetImageCount();
+    if (Settings::values.use_low_latency_mode.GetValue() && !use_low_latency) {
+        LOG_WARNING(Render_Vulkan, "Low latency mode requires VK_KHR_present_wait");
+    }
 
     auto& dld = device.GetLogical();
     cmdpool = dld.CreateCommandPool({
@@ -142,6 +155,10 @@ PresentManager::~PresentManager() = default;
 Frame* PresentManager::GetRenderFrame() {
     MICROPROFILE_SCOPE(Vulkan_WaitPresent);
 
+    if (use_low_latency) {
+        WaitFramesInFlight();
+    }
+
     // Wait for free presentation frames
     std::unique_lock lock{free_mutex};
     free_cv.wait(lock, [this] { return !free_queue.empty(); });
@@ -154,22 +171,32 @@ Frame* PresentManager::GetRenderFrame() {
     frame->present_done.Wait();
     frame->present_done.Reset();
 
+    frame->render_start = std::chrono::steady_clock::now();
     return frame;
 }
 
 void PresentManager::Present(Frame* frame) {
+    if (use_low_latency) {
+        std::scoped_lock lock{latency_mutex};
+        ++frames_queued;
+    }
     if (!use_present_thread) {
-        scheduler.WaitWorker();
+        render_scheduler.WaitWorker();
         CopyToSwapchain(frame);
         free_queue.push(frame);
         return;
     }
 
-    scheduler.Record([this, frame](vk::CommandBuffer) {
+    // Queue the frame once the submission rendering it has been sent to the GPU
+    render_scheduler.RecordAfterSubmit([this, frame] {
         std::unique_lock lock{queue_mutex};
         present_queue.push(frame);
         frame_cv.notify_one();
     });
+    if (use_low_latency) {
+        // The next frame waits for this one to be displayed, submit it to the present thread
+        render_scheduler.DispatchWork();
+    }
 }
 
 void PresentManager::RecreateFrame(Frame* frame, u32 width, u32 height, VkFormat image_view_format,
@@ -195,7 +222,8 @@ void PresentManager::RecreateFrame(Frame* frame, u32 width, u32 height, VkFormat
         .arrayLayers = 1,
         .samples = VK_SAMPLE_COUNT_1_BIT,
         .tiling = VK_IMAGE_TILING_OPTIMAL,
-        .usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+        .usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                 VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
         .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
@@ -292,6 +320,26 @@ void PresentManager::RecreateSwapchain(Frame* frame) {
     SetImageCount();
 }
 
+void PresentManager::WaitFramesInFlight() {
+    const auto wait_start = std::chrono::steady_clock::now();
+    {
+        std::unique_lock lock{latency_mutex};
+        latency_cv.wait(lock, [this] {
+            return frames_queued - frames_displayed < max_frames_in_flight;
+        });
+    }
+    gpu.RendererPresentWaitNotify(std::chrono::steady_clock::now() - wait_start);
+}
+
+void PresentManager::WaitForDisplay(Frame* frame) {
+    if (swapchain.WaitForLastPresent(PRESENT_WAIT_TIMEOUT_NS)) {
+        gpu.RendererPresentLatencyNotify(std::chrono::steady_clock::now() - frame->render_start);
+    }
+    std::scoped_lock lock{latency_mutex};
+    ++frames_displayed;
+    latency_cv.notify_one();
+}
+
 void PresentManager::SetImageCount() {
     // We cannot have more than 7 images in flight at any given time.
     // FRAMES_IN_FLIGHT is 8, and the cache TICKS_TO_DESTROY is 8.
@@ -482,7 +530,12 @@ void PresentManager::CopyToSwapchainImpl(Frame* frame) {
     }
 
     // Present
-    swapchain.Present(render_semaphore);
+    if (!use_low_latency) {
+        swapchain.Present(render_semaphore);
+        return;
+    }
+    swapchain.Present(render_semaphore, next_present_id++);
+    WaitForDisplay(frame);
 }
 
 } // namespace Vulkan
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
@@ -16,6 +17,10 @@ namespace Core::Frontend {
 class EmuWindow;
 } // namespace Core::Frontend
 
+namespace Tegra {
+class GPU;
+}
+
 namespace Vulkan {
 
 class Device;
@@ -31,13 +36,15 @@ struct Frame {
     vk::CommandBuffer cmdbuf;
     vk::Semaphore render_ready;
     vk::Fence present_done;
+    std::chrono::steady_clock::time_point render_start;
 };
 
 class PresentManager {
 public:
     PresentManager(const vk::Instance& instance, Core::Frontend::EmuWindow& render_window,
                    const Device& device, MemoryAllocator& memory_allocator, Scheduler& scheduler,
-                   Swapchain& swapchain, vk::SurfaceKHR& surface);
+                   Scheduler& render_scheduler, Swapchain& swapchain, vk::SurfaceKHR& surface,
+                   Tegra::GPU& gpu);
     ~PresentManager();
 
     /// Returns the last used presentation frame
@@ -64,14 +71,22 @@ private:
 
     void SetImageCount();
 
+    /// Waits until fewer than max_frames_in_flight frames are queued for display
+    void WaitFramesInFlight();
+
+    /// Waits for the frame just presented to be displayed and reports its latency
+    void WaitForDisplay(Frame* frame);
+
 private:
     const vk::Instance& instance;
     Core::Frontend::EmuWindow& render_window;
     const Device& device;
     MemoryAllocator& memory_allocator;
-    Scheduler& scheduler;
+    Scheduler& scheduler;        ///< Owner of the graphics queue the swapchain copies run on
+    Scheduler& render_scheduler; ///< Scheduler rendering the frames, may be on another queue
     Swapchain& swapchain;
     vk::SurfaceKHR& surface;
+    Tegra::GPU& gpu;
     vk::CommandPool cmdpool;
     std::vector<Frame> frames;
     std::queue<Frame*> present_queue;
@@ -85,6 +100,15 @@ private:
     bool blit_supported;
     bool use_present_thread;
     std::size_t image_count{};
+
+    /// Low latency mode, limits frames in flight with VK_KHR_present_wait
+    bool use_low_latency;
+    u64 max_frames_in_flight;
+    u64 next_present_id = 1;
+    u64 frames_queued = 0;    ///< Frames pushed for presentation
+    u64 frames_displayed = 0; ///< Frames done presenting, displayed or not
+    std::mutex latency_mutex;
+    std::condition_variable latency_cv;
 };
 
 } // namespace Vulkan
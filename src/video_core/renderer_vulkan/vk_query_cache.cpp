@@ -1313,12 +1313,14 @@ void QueryCacheRuntime::HostConditionalRenderingCompareValueImpl(VideoCommon::Lo
     ResumeHostConditionalRendering();
 }
 
-void QueryCacheRuntime::HostConditionalRenderingCompareBCImpl(DAddr address, bool is_equal) {
+void QueryCacheRuntime::HostConditionalRenderingCompareBCImpl(DAddr address, bool is_equal,
+                                                              bool predicted) {
     VkBuffer to_resolve;
     u32 to_resolve_offset;
     {
         std::scoped_lock lk(impl->buffer_cache.mutex);
-        static constexpr auto sync_info = VideoCommon::ObtainBufferSynchronize::NoSynchronize;
+        const auto sync_info = predicted ? VideoCommon::ObtainBufferSynchronize::FullSynchronize
+                                         : VideoCommon::ObtainBufferSynchronize::NoSynchronize;
         const auto post_op = VideoCommon::ObtainBufferOperation::DoNothing;
         const auto [buffer, offset] =
             impl->buffer_cache.ObtainCPUBuffer(address, 24, sync_info, post_op);
@@ -1417,10 +1419,16 @@ bool QueryCacheRuntime::HostConditionalRenderingCompareValues(VideoCommon::Looku
     }
 
     if (!is_in_bc[0] && !is_in_bc[1]) {
+        if (Settings::values.use_predicted_queries.GetValue()) {
+            // Compare the last results written back to guest memory on the GPU, the pending
+            // queries land there later without the GPU thread waiting on them.
+            HostConditionalRenderingCompareBCImpl(object_1.address, equal_check, true);
+            return true;
+        }
         // Both queries are in query cache, it's best to just flush.
         return true;
     }
-    HostConditionalRenderingCompareBCImpl(object_1.address, equal_check);
+    HostConditionalRenderingCompareBCImpl(object_1.address, equal_check, false);
     return true;
 }
 
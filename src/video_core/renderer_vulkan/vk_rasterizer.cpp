@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <memory>
 #include <mutex>
 
@@ -18,7 +19,9 @@
 #include "video_core/engines/draw_manager.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/gpu_timeline.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/pipeline_stats.h"
 #include "video_core/renderer_vulkan/blit_image.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
@@ -151,6 +154,30 @@ VkRect2D GetScissorState(const Maxwell& regs, size_t index, u32 up_scale = 1, u3
     return scissor;
 }
 
+Tegra::Engines::Maxwell3D::DirtyState::Flags MakeDynamicStateFlags(const Device& device) {
+    Tegra::Engines::Maxwell3D::DirtyState::Flags flags{};
+    const auto add = [&flags](auto... indices) { ((flags[indices] = true), ...); };
+    // Only the flags checked first by every UpdateDynamicStates step, the finer grained flags
+    // they cover are always set together with them.
+    add(Dirty::Viewports, VideoCommon::Dirty::RescaleViewports, Dirty::Scissors,
+        VideoCommon::Dirty::RescaleScissors, Dirty::DepthBias, VideoCommon::Dirty::DepthBiasGlobal,
+        Dirty::BlendConstants, Dirty::DepthBounds, Dirty::StencilProperties, Dirty::LineWidth);
+    if (device.IsExtExtendedDynamicStateSupported()) {
+        add(Dirty::CullMode, Dirty::DepthCompareOp, Dirty::FrontFace, Dirty::StencilOp,
+            Dirty::StateEnable);
+        if (device.IsExtExtendedDynamicState2ExtrasSupported()) {
+            add(Dirty::LogicOp);
+        }
+        if (device.IsExtExtendedDynamicState3Supported()) {
+            add(Dirty::Blending);
+        }
+    }
+    if (device.IsExtVertexInputDynamicStateSupported()) {
+        add(Dirty::VertexInput);
+    }
+    return flags;
+}
+
 DrawParams MakeDrawParams(const MaxwellDrawState& draw_state, u32 num_instances, bool is_indexed) {
     DrawParams params{
         .base_instance = draw_state.base_instance,
@@ -181,24 +208,30 @@ RasterizerVulkan::RasterizerVulkan(Core::Frontend::EmuWindow& emu_window_, Tegra
                                    StateTracker& state_tracker_, Scheduler& scheduler_)
     : gpu{gpu_}, device_memory{device_memory_}, device{device_},
       memory_allocator{memory_allocator_}, state_tracker{state_tracker_}, scheduler{scheduler_},
-      staging_pool(device, memory_allocator, scheduler), descriptor_pool(device, scheduler),
-      guest_descriptor_queue(device, scheduler), compute_pass_descriptor_queue(device, scheduler),
-      blit_image(device, scheduler, state_tracker, descriptor_pool), render_pass_cache(device),
+      staging_pool(device, memory_allocator, scheduler, gpu.MemoryBudget()),
+      descriptor_pool(device, scheduler),
+      guest_descriptor_queue(device, scheduler, &memory_allocator),
+      compute_pass_descriptor_queue(device, scheduler),
+      blit_image(device, scheduler, state_tracker, staging_pool, descriptor_pool),
+      render_pass_cache(device),
       texture_cache_runtime{
           device,     scheduler,         memory_allocator, staging_pool,
           blit_image, render_pass_cache, descriptor_pool,  compute_pass_descriptor_queue},
-      texture_cache(texture_cache_runtime, device_memory),
+      texture_cache(texture_cache_runtime, device_memory, gpu.MemoryStats(), gpu.MemoryBudget(),
+                    gpu.TextureCacheStats()),
       buffer_cache_runtime(device, memory_allocator, scheduler, staging_pool,
                            guest_descriptor_queue, compute_pass_descriptor_queue, descriptor_pool),
-      buffer_cache(device_memory, buffer_cache_runtime),
+      buffer_cache(device_memory, buffer_cache_runtime, gpu.MemoryStats(), gpu.MemoryBudget()),
       query_cache_runtime(this, device_memory, buffer_cache, device, memory_allocator, scheduler,
                           staging_pool, compute_pass_descriptor_queue, descriptor_pool),
       query_cache(gpu, *this, device_memory, query_cache_runtime),
       pipeline_cache(device_memory, device, scheduler, descriptor_pool, guest_descriptor_queue,
-                     render_pass_cache, buffer_cache, texture_cache, gpu.ShaderNotify()),
+                     render_pass_cache, buffer_cache, texture_cache, gpu.ShaderNotify(),
+                     gpu.PipelineStats()),
       accelerate_dma(buffer_cache, texture_cache, scheduler),
       fence_manager(*this, gpu, texture_cache, buffer_cache, query_cache, device, scheduler),
-      wfi_event(device.GetLogical().CreateEvent()) {
+      wfi_event(device.GetLogical().CreateEvent()),
+      dynamic_state_flags{MakeDynamicStateFlags(device)} {
     scheduler.SetQueryCache(query_cache);
 }
 
@@ -299,6 +332,52 @@ void RasterizerVulkan::DrawIndirect() {
     buffer_cache.SetDrawIndirect(nullptr);
 }
 
+void RasterizerVulkan::DrawBatch(bool is_indexed) {
+    PrepareDraw(is_indexed, [this, is_indexed] {
+        const auto draws = maxwell3d->draw_manager->GetDrawBatch();
+        const u32 draw_count = static_cast<u32>(draws.size());
+        if (is_indexed) {
+            constexpr u32 stride = sizeof(VkDrawIndexedIndirectCommand);
+            const auto staging = staging_pool.Request(draw_count * stride, MemoryUsage::Upload);
+            for (u32 i = 0; i < draw_count; ++i) {
+                const VkDrawIndexedIndirectCommand command{
+                    .indexCount = draws[i].count,
+                    .instanceCount = draws[i].instance_count,
+                    .firstIndex = draws[i].first,
+                    .vertexOffset = static_cast<s32>(draws[i].base_vertex),
+                    .firstInstance = draws[i].base_instance,
+                };
+                std::memcpy(staging.mapped_span.data() + i * stride, &command, stride);
+            }
+            scheduler.Record([buffer = staging.buffer, offset = staging.offset,
+                              draw_count](vk::CommandBuffer cmdbuf) {
+                cmdbuf.DrawIndexedIndirect(buffer, offset, draw_count, stride);
+            });
+        } else {
+            constexpr u32 stride = sizeof(VkDrawIndirectCommand);
+            const auto staging = staging_pool.Request(draw_count * stride, MemoryUsage::Upload);
+            for (u32 i = 0; i < draw_count; ++i) {
+                const VkDrawIndirectCommand command{
+                    .vertexCount = draws[i].count,
+                    .instanceCount = draws[i].instance_count,
+                    .firstVertex = draws[i].first,
+                    .firstInstance = draws[i].base_instance,
+                };
+                std::memcpy(staging.mapped_span.data() + i * stride, &command, stride);
+            }
+            scheduler.Record([buffer = staging.buffer, offset = staging.offset,
+                              draw_count](vk::CommandBuffer cmdbuf) {
+                cmdbuf.DrawIndirect(buffer, offset, draw_count, stride);
+            });
+        }
+    });
+}
+
+bool RasterizerVulkan::HasDrawBatch() {
+    // DrawBatch issues a single indirect draw with a draw count for the whole batch
+    return device.IsMultiDrawIndirectSupported();
+}
+
 void RasterizerVulkan::DrawTexture() {
     MICROPROFILE_SCOPE(Vulkan_Drawing);
 
@@ -372,7 +451,7 @@ void RasterizerVulkan::Clear(u32 layer_count) {
     texture_cache.UpdateRenderTargets(true);
     const Framebuffer* const framebuffer = texture_cache.GetFramebuffer();
     const VkExtent2D render_area = framebuffer->RenderArea();
-    scheduler.RequestRenderpass(framebuffer);
+    scheduler.RequestRendering(framebuffer);
 
     u32 up_scale = 1;
     u32 down_shift = 0;
@@ -506,6 +585,7 @@ void RasterizerVulkan::DispatchCompute() {
         const auto [buffer, offset] =
             buffer_cache.ObtainBuffer(*indirect_address, 12, sync_info, post_op);
         scheduler.RequestOutsideRenderPassOperationContext();
+        scheduler.MarkGpuPass(VideoCore::GpuPass::Compute);
         scheduler.Record([indirect_buffer = buffer->Handle(),
                           indirect_offset = offset](vk::CommandBuffer cmdbuf) {
             cmdbuf.DispatchIndirect(indirect_buffer, indirect_offset);
@@ -514,6 +594,7 @@ void RasterizerVulkan::DispatchCompute() {
     }
     const std::array<u32, 3> dim{qmd.grid_dim_x, qmd.grid_dim_y, qmd.grid_dim_z};
     scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.MarkGpuPass(VideoCore::GpuPass::Compute);
     scheduler.Record([dim](vk::CommandBuffer cmdbuf) { cmdbuf.Dispatch(dim[0], dim[1], dim[2]); });
 }
 
@@ -680,7 +761,7 @@ void RasterizerVulkan::UnmapMemory(DAddr addr, u64 size) {
     }
     {
         std::scoped_lock lock{buffer_cache.mutex};
-        buffer_cache.WriteMemory(addr, size);
+        buffer_cache.UnmapMemory(addr, size);
     }
     pipeline_cache.OnCacheInvalidation(addr, size);
 }
@@ -692,6 +773,14 @@ void RasterizerVulkan::ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) {
     }
 }
 
+void RasterizerVulkan::ModifyGPUMemoryBatch(size_t as_id,
+                                            std::span<const std::pair<GPUVAddr, u64>> ranges) {
+    std::scoped_lock lock{texture_cache.mutex};
+    for (const auto& [addr, size] : ranges) {
+        texture_cache.UnmapGPUMemory(as_id, addr, size);
+    }
+}
+
 void RasterizerVulkan::SignalFence(std::function<void()>&& func) {
     fence_manager.SignalFence(std::move(func));
 }
@@ -766,6 +855,7 @@ void RasterizerVulkan::TickFrame() {
     compute_pass_descriptor_queue.TickFrame();
     fence_manager.TickFrame();
     staging_pool.TickFrame();
+    gpu.PipelineStats().TickFrame();
     {
         std::scoped_lock lock{texture_cache.mutex};
         texture_cache.TickFrame();
@@ -776,6 +866,11 @@ void RasterizerVulkan::TickFrame() {
     }
 }
 
+void RasterizerVulkan::SetRescalingAllowed(bool allowed) {
+    std::scoped_lock lock{texture_cache.mutex};
+    texture_cache.SetRescalingAllowed(allowed);
+}
+
 bool RasterizerVulkan::AccelerateConditionalRendering() {
     gpu_memory->FlushCaching();
     return query_cache.AccelerateHostConditionalRendering();
@@ -836,12 +931,25 @@ std::optional<FramebufferTextureInfo> RasterizerVulkan::AccelerateDisplay(
     info.height = image_view->size.height;
     info.scaled_width = scaled ? resolution.ScaleUp(info.width) : info.width;
     info.scaled_height = scaled ? resolution.ScaleUp(info.height) : info.height;
+    const Image& image = texture_cache.GetImage(image_view->image_id);
+    if (image.info.format == image_view->format && image.info.num_samples == 1) {
+        info.format = MaxwellToVK::SurfaceFormat(device, FormatType::Optimal, false,
+                                                 image.info.format)
+                          .format;
+    }
     return info;
 }
 
 void RasterizerVulkan::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                                          const VideoCore::DiskResourceLoadCallback& callback) {
-    pipeline_cache.LoadDiskResources(title_id, stop_loading, callback);
+    pipeline_cache.LoadDiskResources(title_id, stop_loading, callback, false);
+    std::scoped_lock lock{texture_cache.mutex};
+    texture_cache.LoadDiskResources(title_id, gpu.ShaderNotify());
+}
+
+void RasterizerVulkan::PrecompileDiskResources(
+    u64 title_id, std::stop_token stop_loading, const VideoCore::DiskResourceLoadCallback& callback) {
+    pipeline_cache.LoadDiskResources(title_id, stop_loading, callback, true);
 }
 
 void RasterizerVulkan::FlushWork() {
@@ -856,7 +964,10 @@ void RasterizerVulkan::FlushWork() {
     if ((++draw_counter & 7) != 7) {
         return;
     }
-    if (draw_counter < DRAWS_TO_DISPATCH) {
+    // Parallel workers record whole submissions, give them more than one per frame
+    const u32 draws_to_flush =
+        scheduler.IsParallelRecording() ? DRAWS_TO_DISPATCH / 4 : DRAWS_TO_DISPATCH;
+    if (draw_counter < draws_to_flush) {
         // Send recorded tasks to the worker thread
         scheduler.DispatchWork();
         return;
@@ -926,7 +1037,20 @@ bool AccelerateDMA::BufferToImage(const Tegra::DMA::ImageCopy& copy_info,
     return DmaBufferImageCopy<true>(copy_info, buffer_operand, image_operand);
 }
 
+bool AccelerateDMA::BufferLayoutCopy(const Tegra::DMA::LayoutCopy& copy) {
+    std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+    // Images are refreshed from guest memory, which the copy leaves untouched
+    if (texture_cache.HasImagesInRegion(copy.src.address, copy.src.size) ||
+        texture_cache.HasImagesInRegion(copy.dst.address, copy.dst.size)) {
+        return false;
+    }
+    return buffer_cache.DMALayoutCopy(copy);
+}
+
 void RasterizerVulkan::UpdateDynamicStates() {
+    if (!state_tracker.IsAnyDirty(dynamic_state_flags)) {
+        return;
+    }
     auto& regs = maxwell3d->regs;
     UpdateViewportsState(regs);
     UpdateScissorsState(regs);
@@ -1566,4 +1690,9 @@ void RasterizerVulkan::ReleaseChannel(s32 channel_id) {
     query_cache.EraseChannel(channel_id);
 }
 
+void RasterizerVulkan::BindCapture(VideoCommon::GpuCaptureWriter* capture) {
+    std::scoped_lock lock{buffer_cache.mutex};
+    buffer_cache.BindCapture(capture);
+}
+
 } // namespace Vulkan
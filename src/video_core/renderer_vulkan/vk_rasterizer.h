@@ -62,6 +62,8 @@ public:
     bool BufferToImage(const Tegra::DMA::ImageCopy& copy_info, const Tegra::DMA::BufferOperand& src,
                        const Tegra::DMA::ImageOperand& dst) override;
 
+    bool BufferLayoutCopy(const Tegra::DMA::LayoutCopy& copy) override;
+
 private:
     template <bool IS_IMAGE_UPLOAD>
     bool DmaBufferImageCopy(const Tegra::DMA::ImageCopy& copy_info,
@@ -84,6 +86,8 @@ public:
 
     void Draw(bool is_indexed, u32 instance_count) override;
     void DrawIndirect() override;
+    void DrawBatch(bool is_indexed) override;
+    bool HasDrawBatch() override;
     void DrawTexture() override;
     void Clear(u32 layer_count) override;
     void DispatchCompute() override;
@@ -106,6 +110,8 @@ public:
     void InvalidateGPUCache() override;
     void UnmapMemory(DAddr addr, u64 size) override;
     void ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) override;
+    void ModifyGPUMemoryBatch(size_t as_id,
+                              std::span<const std::pair<GPUVAddr, u64>> ranges) override;
     void SignalFence(std::function<void()>&& func) override;
     void SyncOperation(std::function<void()>&& func) override;
     void SignalSyncPoint(u32 value) override;
@@ -127,6 +133,8 @@ public:
                                   std::span<const u8> memory) override;
     void LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                            const VideoCore::DiskResourceLoadCallback& callback) override;
+    void PrecompileDiskResources(u64 title_id, std::stop_token stop_loading,
+                                 const VideoCore::DiskResourceLoadCallback& callback) override;
 
     void InitializeChannel(Tegra::Control::ChannelState& channel) override;
 
@@ -134,10 +142,15 @@ public:
 
     void ReleaseChannel(s32 channel_id) override;
 
+    void BindCapture(VideoCommon::GpuCaptureWriter* capture) override;
+
     std::optional<FramebufferTextureInfo> AccelerateDisplay(const Tegra::FramebufferConfig& config,
                                                             VAddr framebuffer_addr,
                                                             u32 pixel_stride);
 
+    /// Allows or forbids drawing render targets at the configured resolution
+    void SetRescalingAllowed(bool allowed);
+
 private:
     static constexpr size_t MAX_TEXTURES = 192;
     static constexpr size_t MAX_IMAGES = 48;
@@ -207,6 +220,9 @@ private:
 
     vk::Event wfi_event;
 
+    /// Dirty flags gating the dynamic states updated on this device
+    Tegra::Engines::Maxwell3D::DirtyState::Flags dynamic_state_flags;
+
     boost::container::static_vector<u32, MAX_IMAGE_VIEWS> image_view_indices;
     std::array<VideoCommon::ImageViewId, MAX_IMAGE_VIEWS> image_view_ids;
     boost::container::static_vector<VkSampler, MAX_TEXTURES> sampler_handles;
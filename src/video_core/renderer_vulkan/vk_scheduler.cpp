@@ -1,20 +1,34 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <thread>
 #include <utility>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "video_core/renderer_vulkan/vk_query_cache.h"
 
+#include "common/assert.h"
 #include "common/microprofile.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "video_core/renderer_vulkan/vk_command_pool.h"
+#include "video_core/renderer_vulkan/vk_frame_timer.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/renderer_vulkan/vk_pass_timer.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_sparse_image.h"
 #include "video_core/renderer_vulkan/vk_state_tracker.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
+#include "video_core/renderer_vulkan/vk_transfer_queue.h"
 #include "video_core/vulkan_common/vulkan_device.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
@@ -22,6 +36,31 @@ namespace Vulkan {
 
 MICROPROFILE_DECLARE(Vulkan_WaitForWorker);
 
+namespace {
+// Submissions are only split between a handful of threads, more would just wait on each other
+constexpr size_t MAX_PARALLEL_RECORDERS = 4;
+
+size_t NumRecorders(SchedulerQueue queue) {
+    // Presentation is a handful of passes, it doesn't gain anything from parallel recording
+    if (queue != SchedulerQueue::Graphics ||
+        !Settings::values.use_parallel_command_recording.GetValue()) {
+        return 1;
+    }
+    const size_t num_threads = std::thread::hardware_concurrency();
+    return std::clamp<size_t>(num_threads / 4, 2, MAX_PARALLEL_RECORDERS);
+}
+
+vk::Queue GetQueue(const Device& device, SchedulerQueue queue) {
+    switch (queue) {
+    case SchedulerQueue::Graphics:
+        break;
+    case SchedulerQueue::AsyncPresent:
+        return device.GetAsyncPresentQueue();
+    }
+    return device.GetGraphicsQueue();
+}
+} // Anonymous namespace
+
 void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
                                          vk::CommandBuffer upload_cmdbuf) {
     auto command = first;
@@ -32,18 +71,34 @@ void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
         command = next;
     }
     submit = false;
+    wait_submits = 0;
     command_offset = 0;
     first = nullptr;
     last = nullptr;
 }
 
-Scheduler::Scheduler(const Device& device_, StateTracker& state_tracker_)
+Scheduler::Scheduler(const Device& device_, StateTracker& state_tracker_, SchedulerQueue queue)
     : device{device_}, state_tracker{state_tracker_},
-      master_semaphore{std::make_unique<MasterSemaphore>(device)},
-      command_pool{std::make_unique<CommandPool>(*master_semaphore, device)} {
+      master_semaphore{std::make_unique<MasterSemaphore>(device, GetQueue(device, queue))} {
+    // Uploads and sparse binds only come from guest work
+    if (queue == SchedulerQueue::Graphics && TransferQueue::IsSupported(device)) {
+        transfer_queue = std::make_unique<TransferQueue>(device);
+    }
+    if (queue == SchedulerQueue::Graphics && SparseBinder::IsSupported(device)) {
+        sparse_binder = std::make_unique<SparseBinder>(device, *master_semaphore);
+    }
     AcquireNewChunk();
-    AllocateWorkerCommandBuffer();
-    worker_thread = std::jthread([this](std::stop_token token) { WorkerThread(token); });
+    const size_t num_recorders = NumRecorders(queue);
+    for (size_t index = 0; index < num_recorders; ++index) {
+        Recorder& recorder = *recorders.emplace_back(std::make_unique<Recorder>());
+        recorder.index = index;
+        recorder.command_pool = std::make_unique<CommandPool>(*master_semaphore, device);
+    }
+    for (const std::unique_ptr<Recorder>& recorder_ptr : recorders) {
+        Recorder& recorder = *recorder_ptr;
+        recorder.thread = std::jthread(
+            [this, &recorder](std::stop_token token) { WorkerThread(token, recorder); });
+    }
 }
 
 Scheduler::~Scheduler() = default;
@@ -67,23 +122,35 @@ void Scheduler::WaitWorker() {
     MICROPROFILE_SCOPE(Vulkan_WaitForWorker);
     DispatchWork();
 
-    // Ensure the queue is drained.
+    // Ensure the queues are drained.
     {
         std::unique_lock ql{queue_mutex};
-        event_cv.wait(ql, [this] { return work_queue.empty(); });
+        event_cv.wait(ql, [this] {
+            return std::ranges::all_of(recorders, [](const std::unique_ptr<Recorder>& recorder) {
+                return recorder->work_queue.empty();
+            });
+        });
     }
 
     // Now wait for execution to finish.
-    std::scoped_lock el{execution_mutex};
+    for (const std::unique_ptr<Recorder>& recorder : recorders) {
+        std::scoped_lock el{recorder->execution_mutex};
+    }
 }
 
 void Scheduler::DispatchWork() {
     if (chunk->Empty()) {
         return;
     }
+    const bool has_submit = chunk->HasSubmit();
     {
         std::scoped_lock ql{queue_mutex};
-        work_queue.push(std::move(chunk));
+        recorders[dispatch_index]->work_queue.push(std::move(chunk));
+    }
+    if (has_submit) {
+        // Each submission is recorded as a whole by one worker, hand the next one to another
+        dispatch_index = (dispatch_index + 1) % recorders.size();
+        ++num_dispatched_submits;
     }
     event_cv.notify_all();
     AcquireNewChunk();
@@ -99,6 +166,7 @@ void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
         return;
     }
     EndRenderPass();
+    MarkGpuPass(VideoCore::GpuPass::RenderTarget, reinterpret_cast<u64>(framebuffer));
     state.renderpass = renderpass;
     state.framebuffer = framebuffer_handle;
     state.render_area = render_area;
@@ -124,6 +192,76 @@ void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
     renderpass_image_ranges = framebuffer->ImageRanges();
 }
 
+void Scheduler::RequestRendering(const Framebuffer* framebuffer) {
+    if (!device.IsKhrDynamicRenderingSupported()) {
+        RequestRenderpass(framebuffer);
+        return;
+    }
+    const auto& color_views = framebuffer->ColorViews();
+    const VkImageView depth_view = framebuffer->DepthView();
+    const VkExtent2D render_area = framebuffer->RenderArea();
+    const u32 num_layers = framebuffer->NumLayers();
+    if (state.is_rendering && color_views == state.color_views &&
+        depth_view == state.depth_view && num_layers == state.num_layers &&
+        render_area.width == state.render_area.width &&
+        render_area.height == state.render_area.height) {
+        return;
+    }
+    EndRenderPass();
+    MarkGpuPass(VideoCore::GpuPass::RenderTarget, reinterpret_cast<u64>(framebuffer));
+    state.is_rendering = true;
+    state.color_views = color_views;
+    state.depth_view = depth_view;
+    state.num_layers = num_layers;
+    state.render_area = render_area;
+
+    Record([color_views, depth_view, render_area, num_layers,
+            has_depth = framebuffer->HasAspectDepthBit(),
+            has_stencil = framebuffer->HasAspectStencilBit()](vk::CommandBuffer cmdbuf) {
+        const auto attachment_info = [](VkImageView view) {
+            return VkRenderingAttachmentInfo{
+                .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+                .pNext = nullptr,
+                .imageView = view,
+                .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .resolveMode = VK_RESOLVE_MODE_NONE,
+                .resolveImageView = VK_NULL_HANDLE,
+                .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                .loadOp = VK_ATTACHMENT_LOAD_OP_LOAD,
+                .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+                .clearValue{},
+            };
+        };
+        // Unbound render targets stay as null attachments, matching the pipeline formats
+        std::array<VkRenderingAttachmentInfo, 8> color_attachments;
+        std::ranges::transform(color_views, color_attachments.begin(), attachment_info);
+        const auto last_color =
+            std::ranges::find_if(color_views.rbegin(), color_views.rend(),
+                                 [](VkImageView view) { return view != VK_NULL_HANDLE; });
+        const VkRenderingAttachmentInfo depth_attachment = attachment_info(depth_view);
+        const VkRenderingInfo rendering_info{
+            .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .renderArea =
+                {
+                    .offset = {.x = 0, .y = 0},
+                    .extent = render_area,
+                },
+            .layerCount = num_layers,
+            .viewMask = 0,
+            .colorAttachmentCount = static_cast<u32>(std::distance(last_color, color_views.rend())),
+            .pColorAttachments = color_attachments.data(),
+            .pDepthAttachment = has_depth ? &depth_attachment : nullptr,
+            .pStencilAttachment = has_stencil ? &depth_attachment : nullptr,
+        };
+        cmdbuf.BeginRendering(rendering_info);
+    });
+    num_renderpass_images = framebuffer->NumImages();
+    renderpass_images = framebuffer->Images();
+    renderpass_image_ranges = framebuffer->ImageRanges();
+}
+
 void Scheduler::RequestOutsideRenderPassOperationContext() {
     EndRenderPass();
 }
@@ -145,16 +283,44 @@ bool Scheduler::UpdateRescaling(bool is_rescaling) {
     return true;
 }
 
-void Scheduler::WorkerThread(std::stop_token stop_token) {
-    Common::SetCurrentThreadName("VulkanWorker");
+bool Scheduler::UpdateDescriptorBuffer() {
+    return !std::exchange(state.descriptor_buffer_bound, true);
+}
 
-    const auto TryPopQueue{[this](auto& work) -> bool {
-        if (work_queue.empty()) {
+void Scheduler::MarkGpuPass(VideoCore::GpuPass pass, u64 target) {
+    if (pass_timer) {
+        pass_timer->Mark(pass, target);
+    }
+}
+
+void Scheduler::WaitTimeline(VkSemaphore semaphore, u64 value) {
+    if (timeline_wait) {
+        ASSERT_MSG(timeline_wait->semaphore == semaphore,
+                   "Waiting for more than one timeline semaphore in a submission");
+        timeline_wait->value = std::max(timeline_wait->value, value);
+        return;
+    }
+    timeline_wait = TimelineWait{
+        .semaphore = semaphore,
+        .value = value,
+    };
+}
+
+void Scheduler::WorkerThread(std::stop_token stop_token, Recorder& recorder) {
+    if (recorder.index == 0) {
+        Common::SetCurrentThreadName("VulkanWorker");
+    } else {
+        const std::string name = fmt::format("VulkanWorker:{}", recorder.index);
+        Common::SetCurrentThreadName(name.c_str());
+    }
+
+    const auto TryPopQueue{[this, &recorder](auto& work) -> bool {
+        if (recorder.work_queue.empty()) {
             return false;
         }
 
-        work = std::move(work_queue.front());
-        work_queue.pop();
+        work = std::move(recorder.work_queue.front());
+        recorder.work_queue.pop();
         event_cv.notify_all();
         return true;
     }};
@@ -176,16 +342,31 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
             // Exchange lock ownership so that we take the execution lock before
             // the queue lock goes out of scope. This allows us to force execution
             // to complete in the next step.
-            std::exchange(lk, std::unique_lock{execution_mutex});
+            std::exchange(lk, std::unique_lock{recorder.execution_mutex});
+
+            // Command buffers are taken when a submission starts being recorded, so their
+            // resource tick is never older than the submission using them.
+            if (*recorder.cmdbuf == VK_NULL_HANDLE) {
+                AllocateWorkerCommandBuffer(recorder);
+            }
 
             // Perform the work, tracking whether the chunk was a submission
             // before executing.
             const bool has_submit = work->HasSubmit();
-            work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
+            if (has_submit && !WaitSubmitTurn(stop_token, recorder)) {
+                return;
+            }
+            if (const size_t submits = work->SubmitsToWait();
+                submits != 0 && !WaitSubmitted(stop_token, submits)) {
+                return;
+            }
+            work->ExecuteAll(recorder.cmdbuf, recorder.upload_cmdbuf);
 
-            // If the chunk was a submission, reallocate the command buffer.
+            // If the chunk was a submission, release the command buffers.
             if (has_submit) {
-                AllocateWorkerCommandBuffer();
+                recorder.cmdbuf = vk::CommandBuffer{};
+                recorder.upload_cmdbuf = vk::CommandBuffer{};
+                EndSubmitTurn();
             }
         }
 
@@ -198,16 +379,17 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
     }
 }
 
-void Scheduler::AllocateWorkerCommandBuffer() {
-    current_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
-    current_cmdbuf.Begin({
+void Scheduler::AllocateWorkerCommandBuffer(Recorder& recorder) {
+    CommandPool& command_pool = *recorder.command_pool;
+    recorder.cmdbuf = vk::CommandBuffer(command_pool.Commit(), device.GetDispatchLoader());
+    recorder.cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
         .pInheritanceInfo = nullptr,
     });
-    current_upload_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
-    current_upload_cmdbuf.Begin({
+    recorder.upload_cmdbuf = vk::CommandBuffer(command_pool.Commit(), device.GetDispatchLoader());
+    recorder.upload_cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
@@ -215,12 +397,65 @@ void Scheduler::AllocateWorkerCommandBuffer() {
     });
 }
 
+bool Scheduler::WaitSubmitTurn(std::stop_token stop_token, const Recorder& recorder) {
+    if (recorders.size() == 1) {
+        return true;
+    }
+    // Submissions are handed to the recorders in a round robin, so they also take turns here
+    std::unique_lock lk{turn_mutex};
+    Common::CondvarWait(turn_cv, lk, stop_token,
+                        [&] { return submit_turn % recorders.size() == recorder.index; });
+    return !stop_token.stop_requested();
+}
+
+bool Scheduler::WaitSubmitted(std::stop_token stop_token, size_t count) {
+    if (recorders.size() == 1) {
+        return true;
+    }
+    std::unique_lock lk{turn_mutex};
+    Common::CondvarWait(turn_cv, lk, stop_token, [&] { return submit_turn >= count; });
+    return !stop_token.stop_requested();
+}
+
+void Scheduler::EndSubmitTurn() {
+    if (recorders.size() == 1) {
+        return;
+    }
+    {
+        std::scoped_lock lk{turn_mutex};
+        ++submit_turn;
+    }
+    turn_cv.notify_all();
+}
+
 u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore) {
     EndPendingOperations();
+    if (frame_timer) {
+        frame_timer->EndSubmission();
+    }
+    if (pass_timer) {
+        pass_timer->EndSubmission();
+    }
     InvalidateState();
 
+    // Uploads recorded on the transfer queue are submitted before the work consuming them
+    const u64 transfer_tick = transfer_queue ? transfer_queue->Flush() : 0;
+    const VkSemaphore transfer_semaphore =
+        transfer_tick != 0 ? transfer_queue->Semaphore() : VK_NULL_HANDLE;
+    SparseBinds sparse_binds;
+    if (sparse_binder) {
+        sparse_binds = sparse_binder->TakeBinds();
+    }
+    const std::optional<TimelineWait> external_wait = std::exchange(timeline_wait, std::nullopt);
+
+    if (IsParallelRecording()) {
+        // Keep the submission in a chunk of its own, so waiting for its turn doesn't hold back
+        // the recording of the commands before it
+        DispatchWork();
+    }
     const u64 signal_value = master_semaphore->NextTick();
-    RecordWithUploadBuffer([signal_semaphore, wait_semaphore, signal_value,
+    RecordWithUploadBuffer([signal_semaphore, wait_semaphore, transfer_semaphore, transfer_tick,
+                            sparse_binds = std::move(sparse_binds), external_wait, signal_value,
                             this](vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf) {
         static constexpr VkMemoryBarrier WRITE_BARRIER{
             .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
@@ -238,8 +473,22 @@ u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_se
         }
 
         std::scoped_lock lock{submit_mutex};
+        std::array<TimelineWait, 2> wait_timelines;
+        size_t num_wait_timelines = 0;
+        if (!sparse_binds.Empty()) {
+            // Binds wait for the transfers, so the graphics work only has to wait for the binds
+            const u64 bind_tick = sparse_binder->Submit(sparse_binds, signal_value - 1,
+                                                        transfer_semaphore, transfer_tick);
+            wait_timelines[num_wait_timelines++] = {sparse_binder->Semaphore(), bind_tick};
+        } else if (transfer_semaphore) {
+            wait_timelines[num_wait_timelines++] = {transfer_semaphore, transfer_tick};
+        }
+        if (external_wait) {
+            wait_timelines[num_wait_timelines++] = *external_wait;
+        }
         switch (const VkResult result = master_semaphore->SubmitQueue(
-                    cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, signal_value)) {
+                    cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, signal_value,
+                    std::span(wait_timelines.data(), num_wait_timelines))) {
         case VK_SUCCESS:
             break;
         case VK_ERROR_DEVICE_LOST:
@@ -267,11 +516,18 @@ void Scheduler::AllocateNewContext() {
         query_cache->NotifySegment(true);
 #endif
     }
+    if (frame_timer) {
+        frame_timer->BeginSubmission();
+    }
+    if (pass_timer) {
+        pass_timer->BeginSubmission();
+    }
 }
 
 void Scheduler::InvalidateState() {
     state.graphics_pipeline = nullptr;
     state.rescaling_defined = false;
+    state.descriptor_buffer_bound = false;
     state_tracker.InvalidateCommandBufferState();
 }
 
@@ -284,16 +540,19 @@ void Scheduler::EndPendingOperations() {
 #else
     // query_cache->DisableStreams();
 #endif
-    query_cache->NotifySegment(false);
+    if (query_cache) {
+        query_cache->NotifySegment(false);
+    }
     EndRenderPass();
 }
 
 void Scheduler::EndRenderPass() {
-    if (!state.renderpass) {
+    if (!state.renderpass && !state.is_rendering) {
         return;
     }
     Record([num_images = num_renderpass_images, images = renderpass_images,
-            ranges = renderpass_image_ranges](vk::CommandBuffer cmdbuf) {
+            ranges = renderpass_image_ranges,
+            is_rendering = state.is_rendering](vk::CommandBuffer cmdbuf) {
         std::array<VkImageMemoryBarrier, 9> barriers;
         for (size_t i = 0; i < num_images; ++i) {
             barriers[i] = VkImageMemoryBarrier{
@@ -314,7 +573,11 @@ void Scheduler::EndRenderPass() {
                 .subresourceRange = ranges[i],
             };
         }
-        cmdbuf.EndRenderPass();
+        if (is_rendering) {
+            cmdbuf.EndRendering();
+        } else {
+            cmdbuf.EndRenderPass();
+        }
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
                                    VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
                                    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
@@ -322,11 +585,13 @@ void Scheduler::EndRenderPass() {
                                vk::Span(barriers.data(), num_images));
     });
     state.renderpass = nullptr;
+    state.is_rendering = false;
     num_renderpass_images = 0;
 }
 
 void Scheduler::AcquireNewChunk() {
     std::scoped_lock rl{reserve_mutex};
+    ++record_serial;
 
     if (chunk_reserve.empty()) {
         // If we don't have anything reserved, we need to make a new chunk.
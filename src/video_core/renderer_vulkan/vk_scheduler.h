@@ -7,9 +7,11 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <utility>
 #include <queue>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/common_types.h"
@@ -22,21 +24,36 @@ template <typename Trait>
 class QueryCacheBase;
 }
 
+namespace VideoCore {
+enum class GpuPass : u32;
+}
+
 namespace Vulkan {
 
 class CommandPool;
 class Device;
 class Framebuffer;
+class FrameTimer;
 class GraphicsPipeline;
+class PassTimer;
 class StateTracker;
+class SparseBinder;
+class TransferQueue;
 
 struct QueryCacheParams;
 
+/// Queue a scheduler submits its work to.
+enum class SchedulerQueue {
+    Graphics,     ///< Main graphics queue, used for guest work
+    AsyncPresent, ///< Second graphics family queue, used for presentation passes
+};
+
 /// The scheduler abstracts command buffer and fence management with an interface that's able to do
 /// OpenGL-like operations on Vulkan command buffers.
 class Scheduler {
 public:
-    explicit Scheduler(const Device& device, StateTracker& state_tracker);
+    explicit Scheduler(const Device& device, StateTracker& state_tracker,
+                       SchedulerQueue queue = SchedulerQueue::Graphics);
     ~Scheduler();
 
     /// Sends the current execution context to the GPU.
@@ -45,8 +62,8 @@ public:
     /// Sends the current execution context to the GPU and waits for it to complete.
     void Finish(VkSemaphore signal_semaphore = nullptr, VkSemaphore wait_semaphore = nullptr);
 
-    /// Waits for the worker thread to finish executing everything. After this function returns it's
-    /// safe to touch worker resources.
+    /// Waits for the worker threads to finish executing everything. After this function returns
+    /// it's safe to touch worker resources.
     void WaitWorker();
 
     /// Sends currently recorded work to the worker thread.
@@ -55,6 +72,10 @@ public:
     /// Requests to begin a renderpass.
     void RequestRenderpass(const Framebuffer* framebuffer);
 
+    /// Requests to begin rendering to a framebuffer for guest draws.
+    /// Uses dynamic rendering when available, otherwise begins a renderpass.
+    void RequestRendering(const Framebuffer* framebuffer);
+
     /// Requests the current execution context to be able to execute operations only allowed outside
     /// of a renderpass.
     void RequestOutsideRenderPassOperationContext();
@@ -65,6 +86,13 @@ public:
     /// Update the rescaling state. Returns true if the state has to be updated.
     bool UpdateRescaling(bool is_rescaling);
 
+    /// Returns true if the descriptor buffer has to be bound to the current execution context.
+    bool UpdateDescriptorBuffer();
+
+    /// Makes the next submission wait for a timeline semaphore from another queue to reach value.
+    /// Only one semaphore is waited for per submission, waiting for it again raises the value.
+    void WaitTimeline(VkSemaphore semaphore, u64 value);
+
     /// Invalidates current command buffer state except for render passes
     void InvalidateState();
 
@@ -73,6 +101,19 @@ public:
         query_cache = &query_cache_;
     }
 
+    /// Assigns the timer measuring the GPU time of the submissions.
+    void SetFrameTimer(FrameTimer* frame_timer_) {
+        frame_timer = frame_timer_;
+    }
+
+    /// Assigns the timer measuring the GPU time of the guest passes.
+    void SetPassTimer(PassTimer* pass_timer_) {
+        pass_timer = pass_timer_;
+    }
+
+    /// Times the work recorded from now on as a guest pass, when passes are timed.
+    void MarkGpuPass(VideoCore::GpuPass pass, u64 target = 0);
+
     // Registers a callback to perform on queue submission.
     void RegisterOnSubmit(std::function<void()>&& func) {
         on_submit = std::move(func);
@@ -82,6 +123,7 @@ public:
     template <typename T>
         requires std::is_invocable_v<T, vk::CommandBuffer, vk::CommandBuffer>
     void RecordWithUploadBuffer(T&& command) {
+        ++record_serial;
         if (chunk->Record(command)) {
             return;
         }
@@ -98,6 +140,31 @@ public:
             });
     }
 
+    /// Records a host side effect that runs once every submission recorded before it has been
+    /// sent to the queue. Workers record submissions in parallel, so a plain recorded command
+    /// could run before the previous submission.
+    template <typename T>
+        requires std::is_invocable_v<T>
+    void RecordAfterSubmit(T&& c) {
+        if (IsParallelRecording()) {
+            // Keep it in a chunk of its own, so waiting for the submissions doesn't hold back the
+            // recording of the commands around it
+            DispatchWork();
+            chunk->WaitForSubmits(num_dispatched_submits);
+        }
+        Record([command = std::move(c)](vk::CommandBuffer) { command(); });
+        if (IsParallelRecording()) {
+            DispatchWork();
+        }
+    }
+
+    /// Returns a serial that changes whenever a command is recorded or pending work is dispatched.
+    /// While it stays the same, the last recorded command is still the newest one and has not been
+    /// handed to a worker.
+    [[nodiscard]] u64 RecordSerial() const noexcept {
+        return record_serial;
+    }
+
     /// Returns the current command buffer tick.
     [[nodiscard]] u64 CurrentTick() const noexcept {
         return master_semaphore->CurrentTick();
@@ -122,6 +189,21 @@ public:
         return *master_semaphore;
     }
 
+    /// Returns the dedicated transfer queue, or nullptr when the device doesn't have one.
+    [[nodiscard]] TransferQueue* GetTransferQueue() const noexcept {
+        return transfer_queue.get();
+    }
+
+    /// Returns the binder of sparse image memory, or nullptr when the device can't bind it.
+    [[nodiscard]] SparseBinder* GetSparseBinder() const noexcept {
+        return sparse_binder.get();
+    }
+
+    /// Returns true when submissions are recorded by more than one worker thread.
+    [[nodiscard]] bool IsParallelRecording() const noexcept {
+        return recorders.size() > 1;
+    }
+
     std::mutex submit_mutex;
 
 private:
@@ -197,11 +279,20 @@ private:
             return submit;
         }
 
+        void WaitForSubmits(size_t count) {
+            wait_submits = count;
+        }
+
+        size_t SubmitsToWait() const {
+            return wait_submits;
+        }
+
     private:
         Command* first = nullptr;
         Command* last = nullptr;
 
         size_t command_offset = 0;
+        size_t wait_submits = 0; ///< Submissions sent to the queue before this chunk can run
         bool submit = false;
         alignas(std::max_align_t) std::array<u8, 0x8000> data{};
     };
@@ -210,14 +301,39 @@ private:
         VkRenderPass renderpass = nullptr;
         VkFramebuffer framebuffer = nullptr;
         VkExtent2D render_area = {0, 0};
+        bool is_rendering = false;
+        std::array<VkImageView, 8> color_views{};
+        VkImageView depth_view = nullptr;
+        u32 num_layers = 0;
         GraphicsPipeline* graphics_pipeline = nullptr;
         bool is_rescaling = false;
         bool rescaling_defined = false;
+        bool descriptor_buffer_bound = false;
+    };
+
+    /// Worker thread recording whole submissions into its own command buffers.
+    struct Recorder {
+        size_t index = 0;
+        std::unique_ptr<CommandPool> command_pool;
+        vk::CommandBuffer cmdbuf;
+        vk::CommandBuffer upload_cmdbuf;
+        std::queue<std::unique_ptr<CommandChunk>> work_queue;
+        std::mutex execution_mutex;
+        std::jthread thread;
     };
 
-    void WorkerThread(std::stop_token stop_token);
+    void WorkerThread(std::stop_token stop_token, Recorder& recorder);
+
+    void AllocateWorkerCommandBuffer(Recorder& recorder);
+
+    /// Blocks until the previous submission has been sent to the queue.
+    bool WaitSubmitTurn(std::stop_token stop_token, const Recorder& recorder);
 
-    void AllocateWorkerCommandBuffer();
+    /// Lets the next worker send its submission to the queue.
+    void EndSubmitTurn();
+
+    /// Blocks until the given number of submissions has been sent to the queue.
+    bool WaitSubmitted(std::stop_token stop_token, size_t count);
 
     u64 SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore);
 
@@ -233,15 +349,17 @@ private:
     StateTracker& state_tracker;
 
     std::unique_ptr<MasterSemaphore> master_semaphore;
-    std::unique_ptr<CommandPool> command_pool;
+    std::unique_ptr<TransferQueue> transfer_queue;
+    std::unique_ptr<SparseBinder> sparse_binder;
 
     VideoCommon::QueryCacheBase<QueryCacheParams>* query_cache = nullptr;
-
-    vk::CommandBuffer current_cmdbuf;
-    vk::CommandBuffer current_upload_cmdbuf;
+    FrameTimer* frame_timer = nullptr;
+    PassTimer* pass_timer = nullptr;
+    std::optional<TimelineWait> timeline_wait;
 
     std::unique_ptr<CommandChunk> chunk;
     std::function<void()> on_submit;
+    u64 record_serial = 0;
 
     State state;
 
@@ -249,13 +367,18 @@ private:
     std::array<VkImage, 9> renderpass_images{};
     std::array<VkImageSubresourceRange, 9> renderpass_image_ranges{};
 
-    std::queue<std::unique_ptr<CommandChunk>> work_queue;
     std::vector<std::unique_ptr<CommandChunk>> chunk_reserve;
-    std::mutex execution_mutex;
     std::mutex reserve_mutex;
     std::mutex queue_mutex;
     std::condition_variable_any event_cv;
-    std::jthread worker_thread;
+
+    size_t dispatch_index = 0;         ///< Recorder receiving the chunks of the current submission
+    size_t submit_turn = 0;            ///< Number of submissions sent to the queue by the recorders
+    size_t num_dispatched_submits = 0; ///< Number of submissions handed to the recorders
+    std::mutex turn_mutex;
+    std::condition_variable_any turn_cv;
+
+    std::vector<std::unique_ptr<Recorder>> recorders;
 };
 
 } // namespace Vulkan
@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/div_ceil.h"
+#include "video_core/renderer_vulkan/vk_sparse_image.h"
+#include "video_core/texture_cache/image_info.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+SparseBinder::SparseBinder(const Device& device_, MasterSemaphore& graphics_semaphore_)
+    : device{device_}, graphics_semaphore{graphics_semaphore_}, master_semaphore{device} {}
+
+SparseBinder::~SparseBinder() = default;
+
+bool SparseBinder::IsSupported(const Device& device) {
+    // Graphics submissions wait on the binds through a timeline semaphore
+    return device.IsSparseResidencySupported() && device.HasTimelineSemaphore();
+}
+
+bool SparseBinder::IsBufferSupported(const Device& device) {
+    return IsSupported(device) && device.IsSparseResidencyBufferSupported();
+}
+
+void SparseBinder::BindImage(SparseImageBinds&& binds, std::vector<MemoryCommit>&& commits) {
+    if (!commits.empty()) {
+        // Binds are submitted before the work recorded at the current tick, and memory they
+        // release can be reused once that work has finished
+        released_commits.emplace_back(graphics_semaphore.CurrentTick(), std::move(commits));
+    }
+    pending_binds.images.push_back(std::move(binds));
+}
+
+void SparseBinder::BindBuffer(SparseBufferBinds&& binds) {
+    pending_binds.buffers.push_back(std::move(binds));
+}
+
+SparseBinds SparseBinder::TakeBinds() {
+    while (!released_commits.empty() &&
+           graphics_semaphore.IsFree(released_commits.front().first)) {
+        released_commits.pop_front();
+    }
+    return std::exchange(pending_binds, {});
+}
+
+u64 SparseBinder::Submit(const SparseBinds& batch, u64 graphics_tick,
+                         VkSemaphore transfer_semaphore, u64 transfer_tick) {
+    std::vector<VkSparseImageMemoryBindInfo> image_binds;
+    std::vector<VkSparseImageOpaqueMemoryBindInfo> opaque_binds;
+    std::vector<VkSparseBufferMemoryBindInfo> buffer_binds;
+    for (const SparseImageBinds& binds : batch.images) {
+        if (!binds.binds.empty()) {
+            image_binds.push_back({
+                .image = binds.image,
+                .bindCount = static_cast<u32>(binds.binds.size()),
+                .pBinds = binds.binds.data(),
+            });
+        }
+        if (!binds.opaque_binds.empty()) {
+            opaque_binds.push_back({
+                .image = binds.image,
+                .bindCount = static_cast<u32>(binds.opaque_binds.size()),
+                .pBinds = binds.opaque_binds.data(),
+            });
+        }
+    }
+    for (const SparseBufferBinds& binds : batch.buffers) {
+        buffer_binds.push_back({
+            .buffer = binds.buffer,
+            .bindCount = static_cast<u32>(binds.binds.size()),
+            .pBinds = binds.binds.data(),
+        });
+    }
+    u32 num_wait_semaphores = 1;
+    std::array<VkSemaphore, 2> wait_semaphores{graphics_semaphore.Handle()};
+    std::array<u64, 2> wait_values{graphics_tick};
+    if (transfer_semaphore) {
+        wait_semaphores[num_wait_semaphores] = transfer_semaphore;
+        wait_values[num_wait_semaphores] = transfer_tick;
+        ++num_wait_semaphores;
+    }
+    const VkSemaphore signal_semaphore = master_semaphore.Handle();
+    const u64 signal_value = master_semaphore.NextTick();
+    const VkTimelineSemaphoreSubmitInfo timeline_si{
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreValueCount = num_wait_semaphores,
+        .pWaitSemaphoreValues = wait_values.data(),
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues = &signal_value,
+    };
+    const VkBindSparseInfo bind_info{
+        .sType = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO,
+        .pNext = &timeline_si,
+        .waitSemaphoreCount = num_wait_semaphores,
+        .pWaitSemaphores = wait_semaphores.data(),
+        .bufferBindCount = static_cast<u32>(buffer_binds.size()),
+        .pBufferBinds = buffer_binds.data(),
+        .imageOpaqueBindCount = static_cast<u32>(opaque_binds.size()),
+        .pImageOpaqueBinds = opaque_binds.data(),
+        .imageBindCount = static_cast<u32>(image_binds.size()),
+        .pImageBinds = image_binds.data(),
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores = &signal_semaphore,
+    };
+    switch (const VkResult result = device.GetGraphicsQueue().BindSparse(bind_info)) {
+    case VK_SUCCESS:
+        break;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        [[fallthrough]];
+    default:
+        vk::Check(result);
+        break;
+    }
+    return signal_value;
+}
+
+SparseImage::SparseImage(const Device& device, MemoryAllocator& memory_allocator_,
+                         SparseBinder& binder_, VkImage image_, const VideoCommon::ImageInfo& info)
+    : memory_allocator{memory_allocator_}, binder{binder_}, image{image_},
+      tile_requirements{device.GetLogical().GetImageMemoryRequirements(image)},
+      num_layers{static_cast<u32>(info.resources.layers)} {
+    const u32 num_levels = static_cast<u32>(info.resources.levels);
+    u32 first_tail_level = num_levels;
+    SparseImageBinds binds{.image = image, .binds{}, .opaque_binds{}};
+    for (const VkSparseImageMemoryRequirements& requirements :
+         device.GetLogical().GetImageSparseMemoryRequirements(image)) {
+        const VkSparseImageFormatProperties& format = requirements.formatProperties;
+        if (format.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) {
+            granularity = format.imageGranularity;
+            first_tail_level = std::min(requirements.imageMipTailFirstLod, num_levels);
+        }
+        if (requirements.imageMipTailFirstLod < num_levels) {
+            BindMipTail(requirements, binds.opaque_binds);
+        }
+    }
+    ASSERT(granularity.width != 0 && granularity.height != 0);
+
+    // Tiles are bound one by one, so a single tile is allocated at a time
+    tile_requirements.size = tile_requirements.alignment;
+
+    levels.reserve(first_tail_level);
+    for (u32 level = 0; level < first_tail_level; ++level) {
+        const VkExtent3D extent{
+            .width = std::max(info.size.width >> level, 1U),
+            .height = std::max(info.size.height >> level, 1U),
+            .depth = 1,
+        };
+        const u32 tiles_x = Common::DivCeil(extent.width, granularity.width);
+        const u32 tiles_y = Common::DivCeil(extent.height, granularity.height);
+        levels.push_back(Level{
+            .first_tile = tiles_per_layer,
+            .tiles_x = tiles_x,
+            .tiles_y = tiles_y,
+            .extent = extent,
+        });
+        tiles_per_layer += tiles_x * tiles_y;
+    }
+    tiles.resize(static_cast<size_t>(tiles_per_layer) * num_layers);
+    if (!binds.opaque_binds.empty()) {
+        binder.BindImage(std::move(binds), {});
+    }
+}
+
+SparseImage::~SparseImage() = default;
+
+bool SparseImage::IsSupported(const Device& device, const VkImageCreateInfo& image_ci) {
+    if (image_ci.imageType != VK_IMAGE_TYPE_2D || image_ci.samples != VK_SAMPLE_COUNT_1_BIT) {
+        return false;
+    }
+    const auto properties = device.GetPhysical().GetSparseImageFormatProperties(
+        image_ci.format, image_ci.imageType, image_ci.samples, image_ci.usage, image_ci.tiling);
+    return std::ranges::any_of(properties, [](const VkSparseImageFormatProperties& format) {
+        return (format.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) != 0;
+    });
+}
+
+void SparseImage::Update(std::span<const VideoCommon::SubresourceRows> rows, bool allow_commit) {
+    std::vector<bool> used_tiles(tiles.size());
+    for (const VideoCommon::SubresourceRows& range : rows) {
+        if (static_cast<size_t>(range.level) >= levels.size()) {
+            // Stored in the mip tail
+            continue;
+        }
+        const Level& level = levels[range.level];
+        const u32 first_row = range.begin / granularity.height;
+        const u32 last_row = std::min((range.end - 1) / granularity.height, level.tiles_y - 1);
+        const size_t layer_tile = static_cast<size_t>(range.layer) * tiles_per_layer;
+        for (u32 tile_y = first_row; tile_y <= last_row; ++tile_y) {
+            const size_t row_tile = layer_tile + level.first_tile + tile_y * level.tiles_x;
+            std::fill_n(used_tiles.begin() + row_tile, level.tiles_x, true);
+        }
+    }
+    SparseImageBinds binds{.image = image, .binds{}, .opaque_binds{}};
+    std::vector<MemoryCommit> released;
+    for (u32 layer = 0; layer < num_layers; ++layer) {
+        for (u32 level_index = 0; level_index < levels.size(); ++level_index) {
+            const Level& level = levels[level_index];
+            size_t tile = static_cast<size_t>(layer) * tiles_per_layer + level.first_tile;
+            for (u32 tile_y = 0; tile_y < level.tiles_y; ++tile_y) {
+                for (u32 tile_x = 0; tile_x < level.tiles_x; ++tile_x, ++tile) {
+                    const bool is_bound = tiles[tile].Memory() != VK_NULL_HANDLE;
+                    if (used_tiles[tile] == is_bound || (!is_bound && !allow_commit)) {
+                        continue;
+                    }
+                    if (is_bound) {
+                        released.push_back(std::exchange(tiles[tile], MemoryCommit{}));
+                    } else {
+                        tiles[tile] =
+                            memory_allocator.Commit(tile_requirements, MemoryUsage::DeviceLocal);
+                    }
+                    const u32 x = tile_x * granularity.width;
+                    const u32 y = tile_y * granularity.height;
+                    binds.binds.push_back(VkSparseImageMemoryBind{
+                        .subresource{
+                            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                            .mipLevel = level_index,
+                            .arrayLayer = layer,
+                        },
+                        .offset{
+                            .x = static_cast<s32>(x),
+                            .y = static_cast<s32>(y),
+                            .z = 0,
+                        },
+                        .extent{
+                            .width = std::min(granularity.width, level.extent.width - x),
+                            .height = std::min(granularity.height, level.extent.height - y),
+                            .depth = 1,
+                        },
+                        .memory = tiles[tile].Memory(),
+                        .memoryOffset = tiles[tile].Offset(),
+                        .flags = 0,
+                    });
+                }
+            }
+        }
+    }
+    if (!binds.binds.empty()) {
+        binder.BindImage(std::move(binds), std::move(released));
+    }
+}
+
+void SparseImage::BindMipTail(const VkSparseImageMemoryRequirements& requirements,
+                              std::vector<VkSparseMemoryBind>& opaque_binds) {
+    const bool is_metadata =
+        (requirements.formatProperties.aspectMask & VK_IMAGE_ASPECT_METADATA_BIT) != 0;
+    const bool single_tail =
+        (requirements.formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0;
+    const VkMemoryRequirements tail_requirements{
+        .size = Common::AlignUp(requirements.imageMipTailSize, tile_requirements.alignment),
+        .alignment = tile_requirements.alignment,
+        .memoryTypeBits = tile_requirements.memoryTypeBits,
+    };
+    const u32 num_tails = single_tail ? 1 : num_layers;
+    for (u32 layer = 0; layer < num_tails; ++layer) {
+        MemoryCommit& commit = mip_tails.emplace_back(
+            memory_allocator.Commit(tail_requirements, MemoryUsage::DeviceLocal));
+        opaque_binds.push_back(VkSparseMemoryBind{
+            .resourceOffset =
+                requirements.imageMipTailOffset + layer * requirements.imageMipTailStride,
+            .size = requirements.imageMipTailSize,
+            .memory = commit.Memory(),
+            .memoryOffset = commit.Offset(),
+            .flags = is_metadata ? VkSparseMemoryBindFlags{VK_SPARSE_MEMORY_BIND_METADATA_BIT}
+                                 : VkSparseMemoryBindFlags{},
+        });
+    }
+}
+
+} // namespace Vulkan
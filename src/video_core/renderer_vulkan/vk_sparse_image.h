@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <deque>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/texture_cache/util.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace VideoCommon {
+struct ImageInfo;
+}
+
+namespace Vulkan {
+
+class Device;
+
+/// Memory binds of a sparse image waiting to be submitted
+struct SparseImageBinds {
+    VkImage image;
+    std::vector<VkSparseImageMemoryBind> binds;
+    std::vector<VkSparseMemoryBind> opaque_binds;
+};
+
+/// Memory binds of a sparse buffer waiting to be submitted
+struct SparseBufferBinds {
+    VkBuffer buffer;
+    std::vector<VkSparseMemoryBind> binds;
+};
+
+/// Binds queued for a single submission
+struct SparseBinds {
+    std::vector<SparseImageBinds> images;
+    std::vector<SparseBufferBinds> buffers;
+
+    [[nodiscard]] bool Empty() const noexcept {
+        return images.empty() && buffers.empty();
+    }
+};
+
+/**
+ * Submits memory binds of sparse resident images and buffers on the graphics queue.
+ *
+ * Binds are queued while recording and submitted right before the graphics work of the same
+ * recording, which waits for them on the timeline of the binder. Binds themselves wait for the
+ * previous graphics submission, as pages being unbound may still be in use by it.
+ */
+class SparseBinder {
+public:
+    explicit SparseBinder(const Device& device, MasterSemaphore& graphics_semaphore);
+    ~SparseBinder();
+
+    SparseBinder(const SparseBinder&) = delete;
+    SparseBinder& operator=(const SparseBinder&) = delete;
+
+    /// Returns true when the device can bind memory to sparse resident images
+    [[nodiscard]] static bool IsSupported(const Device& device);
+
+    /// Returns true when the device can also bind memory to sparse resident buffers
+    [[nodiscard]] static bool IsBufferSupported(const Device& device);
+
+    /// Queues binds for an image, keeping the memory released by them alive until they execute
+    void BindImage(SparseImageBinds&& binds, std::vector<MemoryCommit>&& commits);
+
+    /// Queues binds for a buffer
+    void BindBuffer(SparseBufferBinds&& binds);
+
+    /// Takes the binds queued since the previous call and frees memory no longer in use
+    [[nodiscard]] SparseBinds TakeBinds();
+
+    /**
+     * Submits binds once the graphics work up to graphics_tick and the transfers up to
+     * transfer_tick have finished, returns the tick graphics work has to wait for.
+     * It has to be called with the queue submission lock held.
+     */
+    [[nodiscard]] u64 Submit(const SparseBinds& batch, u64 graphics_tick,
+                             VkSemaphore transfer_semaphore, u64 transfer_tick);
+
+    /// Returns the timeline semaphore signalled by bind submissions
+    [[nodiscard]] VkSemaphore Semaphore() const noexcept {
+        return master_semaphore.Handle();
+    }
+
+private:
+    const Device& device;
+    MasterSemaphore& graphics_semaphore;
+    MasterSemaphore master_semaphore;
+
+    SparseBinds pending_binds;
+    std::deque<std::pair<u64, std::vector<MemoryCommit>>> released_commits;
+};
+
+/**
+ * Device memory of a 2D color image created with sparse residency.
+ *
+ * Memory is bound one tile at a time, only to the tiles storing guest memory that is mapped.
+ * The mip tail, holding the smallest levels, is always bound.
+ */
+class SparseImage {
+public:
+    explicit SparseImage(const Device& device, MemoryAllocator& memory_allocator,
+                         SparseBinder& binder, VkImage image, const VideoCommon::ImageInfo& info);
+    ~SparseImage();
+
+    SparseImage(const SparseImage&) = delete;
+    SparseImage& operator=(const SparseImage&) = delete;
+
+    /// Returns true when an image can be created with sparse residency with these parameters
+    [[nodiscard]] static bool IsSupported(const Device& device, const VkImageCreateInfo& image_ci);
+
+    /**
+     * Releases the tiles that don't store any of the given rows.
+     * When allow_commit is true, also binds memory to the tiles storing them.
+     */
+    void Update(std::span<const VideoCommon::SubresourceRows> rows, bool allow_commit);
+
+private:
+    struct Level {
+        u32 first_tile;    ///< Index of the first tile of the level
+        u32 tiles_x;       ///< Number of tiles in a row
+        u32 tiles_y;       ///< Number of tile rows
+        VkExtent3D extent; ///< Size of the level in texels
+    };
+
+    /// Binds memory to the mip tail of an aspect
+    void BindMipTail(const VkSparseImageMemoryRequirements& requirements,
+                     std::vector<VkSparseMemoryBind>& opaque_binds);
+
+    MemoryAllocator& memory_allocator;
+    SparseBinder& binder;
+    VkImage image;
+    VkMemoryRequirements tile_requirements{};
+    VkExtent3D granularity{};
+    u32 num_layers = 0;
+    u32 tiles_per_layer = 0;
+    std::vector<Level> levels;
+    std::vector<MemoryCommit> tiles;
+    std::vector<MemoryCommit> mip_tails;
+};
+
+} // namespace Vulkan
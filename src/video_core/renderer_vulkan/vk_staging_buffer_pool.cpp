@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -12,6 +13,8 @@
 #include "common/bit_util.h"
 #include "common/common_types.h"
 #include "common/literals.h"
+#include "common/logging/log.h"
+#include "video_core/memory_budget.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/vulkan_common/vulkan_device.h"
@@ -26,6 +29,53 @@ using namespace Common::Literals;
 constexpr VkDeviceSize MAX_ALIGNMENT = 256;
 // Stream buffer size in bytes
 constexpr VkDeviceSize MAX_STREAM_BUFFER_SIZE = 128_MiB;
+// The smallest size class is 256 bytes
+constexpr u32 MIN_CLASS_LOG2 = 8;
+// Each power of two is split in four size classes, wasting at most 25% of a buffer
+constexpr u32 CLASS_STEP_BITS = 2;
+constexpr size_t NUM_SIZE_CLASSES = 1 + ((64 - MIN_CLASS_LOG2 - 1) << CLASS_STEP_BITS);
+// Size classes smaller than this are sub-allocated from arenas of up to this size
+constexpr size_t ARENA_SIZE = 1_MiB;
+// Number of frames a buffer can stay unused before it's returned to the allocator
+constexpr u64 RELEASE_IDLE_FRAMES = 60;
+// Same as above while the caches are over their shared memory budget
+constexpr u64 PRESSURE_RELEASE_IDLE_FRAMES = 15;
+// Number of frames between statistics reports
+constexpr u64 STATISTICS_LOG_FRAMES = 3600;
+
+constexpr u32 SizeClass(size_t size) {
+    if (size <= (1ULL << MIN_CLASS_LOG2)) {
+        return 0;
+    }
+    const u32 log2 = Common::Log2Ceil64(size);
+    const u32 step_shift = log2 - CLASS_STEP_BITS - 1;
+    const u64 steps = (size + (1ULL << step_shift) - 1) >> step_shift;
+    return ((log2 - MIN_CLASS_LOG2 - 1) << CLASS_STEP_BITS) +
+           static_cast<u32>(steps - (1ULL << CLASS_STEP_BITS));
+}
+
+constexpr size_t ClassSize(u32 size_class) {
+    if (size_class == 0) {
+        return 1ULL << MIN_CLASS_LOG2;
+    }
+    const u32 octave = (size_class - 1) >> CLASS_STEP_BITS;
+    const u64 steps = ((size_class - 1) & ((1U << CLASS_STEP_BITS) - 1)) +
+                      (1ULL << CLASS_STEP_BITS) + 1;
+    return steps << (octave + MIN_CLASS_LOG2 - CLASS_STEP_BITS);
+}
+
+/// Distance between the slots of an arena, any slot may be bound at its offset as a storage buffer
+constexpr size_t SlotStride(u32 size_class) {
+    return Common::AlignUp(ClassSize(size_class), MAX_ALIGNMENT);
+}
+
+static_assert(ClassSize(SizeClass(1)) == 256);
+static_assert(ClassSize(SizeClass(257)) == 320);
+static_assert(ClassSize(SizeClass(512)) == 512);
+static_assert(ClassSize(SizeClass(513)) == 640);
+static_assert(ClassSize(SizeClass(3_MiB + 1)) == 3_MiB + 512_KiB);
+static_assert(SizeClass(~size_t{0} >> 1) < NUM_SIZE_CLASSES);
+static_assert(SlotStride(SizeClass(257)) == 512);
 
 size_t GetStreamBufferSize(const Device& device) {
     VkDeviceSize size{0};
@@ -47,8 +97,9 @@ size_t GetStreamBufferSize(const Device& device) {
 } // Anonymous namespace
 
 StagingBufferPool::StagingBufferPool(const Device& device_, MemoryAllocator& memory_allocator_,
-                                     Scheduler& scheduler_)
+                                     Scheduler& scheduler_, VideoCore::MemoryBudget& global_budget_)
     : device{device_}, memory_allocator{memory_allocator_}, scheduler{scheduler_},
+      global_budget{global_budget_},
       stream_buffer_size{GetStreamBufferSize(device)}, region_size{stream_buffer_size /
                                                                    StagingBufferPool::NUM_SYNCS} {
     VkBufferCreateInfo stream_ci = {
@@ -57,7 +108,8 @@ StagingBufferPool::StagingBufferPool(const Device& device_, MemoryAllocator& mem
         .flags = 0,
         .size = stream_buffer_size,
         .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
-                 VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                 VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                 VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
         .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
@@ -71,6 +123,10 @@ StagingBufferPool::StagingBufferPool(const Device& device_, MemoryAllocator& mem
     }
     stream_pointer = stream_buffer.Mapped();
     ASSERT_MSG(!stream_pointer.empty(), "Stream buffer must be host visible!");
+
+    for (StagingBufferLists* cache : {&device_local_cache, &upload_cache, &download_cache}) {
+        cache->classes.resize(NUM_SIZE_CLASSES);
+    }
 }
 
 StagingBufferPool::~StagingBufferPool() = default;
@@ -83,23 +139,57 @@ StagingBufferRef StagingBufferPool::Request(size_t size, MemoryUsage usage, bool
 }
 
 void StagingBufferPool::FreeDeferred(StagingBufferRef& ref) {
-    auto& entries = GetCache(ref.usage)[ref.log2_level].entries;
+    auto& entries = GetCache(ref.usage).classes[ref.size_class].entries;
     const auto is_this_one = [&ref](const StagingBuffer& entry) {
         return entry.index == ref.index;
     };
     auto it = std::find_if(entries.begin(), entries.end(), is_this_one);
     ASSERT(it != entries.end());
     ASSERT(it->deferred);
-    it->tick = scheduler.CurrentTick();
+    it->slot_ticks[0] = scheduler.CurrentTick();
+    it->last_use_frame = current_frame;
     it->deferred = false;
 }
 
+const StagingBufferStatistics& StagingBufferPool::Statistics(MemoryUsage usage) const {
+    return GetCache(usage).statistics;
+}
+
 void StagingBufferPool::TickFrame() {
-    current_delete_level = (current_delete_level + 1) % NUM_LEVELS;
+    ++current_frame;
+
+    const bool over_budget =
+        global_budget.EvictionShare(VideoCore::MemoryBudgetClient::StagingBuffers) != 0;
+    const u64 idle_frames = over_budget ? PRESSURE_RELEASE_IDLE_FRAMES : RELEASE_IDLE_FRAMES;
+    ReleaseCache(device_local_cache, idle_frames);
+    ReleaseCache(upload_cache, idle_frames);
+    ReleaseCache(download_cache, idle_frames);
 
-    ReleaseCache(MemoryUsage::DeviceLocal);
-    ReleaseCache(MemoryUsage::Upload);
-    ReleaseCache(MemoryUsage::Download);
+    // The stream buffer is never released, so only the cached buffers are reported
+    const u64 resident_bytes = device_local_cache.statistics.allocated_bytes +
+                               upload_cache.statistics.allocated_bytes +
+                               download_cache.statistics.allocated_bytes;
+    const u64 oldest_use_frame =
+        std::min({OldestUseFrame(device_local_cache), OldestUseFrame(upload_cache),
+                  OldestUseFrame(download_cache)});
+    global_budget.Report(VideoCore::MemoryBudgetClient::StagingBuffers, resident_bytes,
+                         current_frame - oldest_use_frame);
+
+    if (current_frame % STATISTICS_LOG_FRAMES != 0) {
+        return;
+    }
+    static constexpr std::array usages{
+        std::pair{MemoryUsage::DeviceLocal, "Device local"},
+        std::pair{MemoryUsage::Upload, "Upload"},
+        std::pair{MemoryUsage::Download, "Download"},
+    };
+    for (const auto& [usage, name] : usages) {
+        const StagingBufferStatistics& stats = Statistics(usage);
+        LOG_DEBUG(Render_Vulkan,
+                  "{} staging: {} KiB allocated, {} KiB peak, {} KiB requested, {:.1f}% reused",
+                  name, stats.allocated_bytes / 1_KiB, stats.peak_allocated_bytes / 1_KiB,
+                  stats.requested_bytes / 1_KiB, stats.ReuseRate() * 100.0);
+    }
 }
 
 StagingBufferRef StagingBufferPool::GetStreamBuffer(size_t size) {
@@ -133,7 +223,7 @@ StagingBufferRef StagingBufferPool::GetStreamBuffer(size_t size) {
         .offset = static_cast<VkDeviceSize>(offset),
         .mapped_span = stream_pointer.subspan(offset, size),
         .usage{},
-        .log2_level{},
+        .size_class{},
         .index{},
     };
 }
@@ -146,47 +236,98 @@ bool StagingBufferPool::AreRegionsActive(size_t region_begin, size_t region_end)
 
 StagingBufferRef StagingBufferPool::GetStagingBuffer(size_t size, MemoryUsage usage,
                                                      bool deferred) {
-    if (const std::optional<StagingBufferRef> ref = TryGetReservedBuffer(size, usage, deferred)) {
+    StagingBufferStatistics& statistics = GetCache(usage).statistics;
+    statistics.requested_bytes += size;
+    ++statistics.num_requests;
+
+    const u32 size_class = SizeClass(size);
+    if (const std::optional<StagingBufferRef> ref =
+            TryGetReservedBuffer(size_class, usage, deferred)) {
+        ++statistics.num_reused;
         return *ref;
     }
-    return CreateStagingBuffer(size, usage, deferred);
+    return CreateStagingBuffer(size_class, usage, deferred);
 }
 
-std::optional<StagingBufferRef> StagingBufferPool::TryGetReservedBuffer(size_t size,
+std::optional<StagingBufferRef> StagingBufferPool::TryGetReservedBuffer(u32 size_class,
                                                                         MemoryUsage usage,
                                                                         bool deferred) {
-    StagingBuffers& cache_level = GetCache(usage)[Common::Log2Ceil64(size)];
+    StagingBuffers& cache_level = GetCache(usage).classes[size_class];
 
-    const auto is_free = [this](const StagingBuffer& entry) {
-        return !entry.deferred && scheduler.IsFree(entry.tick);
+    size_t slot = 0;
+    const auto find_free_slot = [this, deferred, &slot](const StagingBuffer& entry) {
+        // Deferred requests need a buffer of their own
+        if (entry.deferred || (deferred && entry.num_slots != 1)) {
+            return false;
+        }
+        for (slot = 0; slot < entry.num_slots; ++slot) {
+            if (scheduler.IsFree(entry.slot_ticks[slot])) {
+                return true;
+            }
+        }
+        return false;
     };
     auto& entries = cache_level.entries;
     const auto hint_it = entries.begin() + cache_level.iterate_index;
-    auto it = std::find_if(entries.begin() + cache_level.iterate_index, entries.end(), is_free);
+    auto it = std::find_if(hint_it, entries.end(), find_free_slot);
     if (it == entries.end()) {
-        it = std::find_if(entries.begin(), hint_it, is_free);
+        it = std::find_if(entries.begin(), hint_it, find_free_slot);
         if (it == hint_it) {
             return std::nullopt;
         }
     }
-    cache_level.iterate_index = std::distance(entries.begin(), it) + 1;
-    it->tick = deferred ? std::numeric_limits<u64>::max() : scheduler.CurrentTick();
-    ASSERT(!it->deferred);
+    // Arenas likely have more free slots, start the next search from the same entry
+    cache_level.iterate_index = std::distance(entries.begin(), it);
+    it->slot_ticks[slot] = deferred ? std::numeric_limits<u64>::max() : scheduler.CurrentTick();
+    it->last_use_frame = current_frame;
     it->deferred = deferred;
-    return it->Ref();
+    return it->Ref(slot, SlotStride(size_class), ClassSize(size_class));
 }
 
-StagingBufferRef StagingBufferPool::CreateStagingBuffer(size_t size, MemoryUsage usage,
+StagingBufferRef StagingBufferPool::CreateStagingBuffer(u32 size_class, MemoryUsage usage,
                                                         bool deferred) {
-    const u32 log2 = Common::Log2Ceil64(size);
+    const size_t slot_size = ClassSize(size_class);
+    const size_t slot_stride = SlotStride(size_class);
+    const size_t num_slots =
+        deferred ? 1 : std::clamp<size_t>(ARENA_SIZE / slot_stride, 1, MAX_SLOTS);
+    const size_t buffer_size = slot_stride * (num_slots - 1) + slot_size;
+    vk::Buffer buffer = CreateBuffer(buffer_size, usage);
+    if (device.HasDebuggingToolAttached()) {
+        ++buffer_index;
+        buffer.SetObjectNameEXT(fmt::format("Staging Buffer {}", buffer_index).c_str());
+    }
+    StagingBufferLists& cache = GetCache(usage);
+    cache.statistics.allocated_bytes += buffer_size;
+    cache.statistics.peak_allocated_bytes =
+        std::max(cache.statistics.peak_allocated_bytes, cache.statistics.allocated_bytes);
+
+    const std::span<u8> mapped_span = buffer.Mapped();
+    StagingBuffer& entry = cache.classes[size_class].entries.emplace_back(StagingBuffer{
+        .buffer = std::move(buffer),
+        .mapped_span = mapped_span,
+        .usage = usage,
+        .size_class = size_class,
+        .num_slots = static_cast<u32>(num_slots),
+        .buffer_size = buffer_size,
+        .index = unique_ids++,
+        .slot_ticks{},
+        .last_use_frame = current_frame,
+        .deferred = deferred,
+    });
+    entry.slot_ticks[0] = deferred ? std::numeric_limits<u64>::max() : scheduler.CurrentTick();
+    return entry.Ref(0, slot_stride, slot_size);
+}
+
+vk::Buffer StagingBufferPool::CreateBuffer(size_t size, MemoryUsage usage) {
     VkBufferCreateInfo buffer_ci = {
         .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
-        .size = 1ULL << log2,
+        .size = size,
         .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
                  VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
-                 VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                 VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+                 VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
         .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
@@ -194,25 +335,30 @@ StagingBufferRef StagingBufferPool::CreateStagingBuffer(size_t size, MemoryUsage
     if (device.IsExtTransformFeedbackSupported()) {
         buffer_ci.usage |= VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_BUFFER_BIT_EXT;
     }
-    vk::Buffer buffer = memory_allocator.CreateBuffer(buffer_ci, usage);
-    if (device.HasDebuggingToolAttached()) {
-        ++buffer_index;
-        buffer.SetObjectNameEXT(fmt::format("Staging Buffer {}", buffer_index).c_str());
+    try {
+        return memory_allocator.CreateBuffer(buffer_ci, usage);
+    } catch (const vk::Exception& exception) {
+        if (exception.GetResult() != VK_ERROR_OUT_OF_DEVICE_MEMORY &&
+            exception.GetResult() != VK_ERROR_OUT_OF_HOST_MEMORY) {
+            throw;
+        }
     }
-    const std::span<u8> mapped_span = buffer.Mapped();
-    StagingBuffer& entry = GetCache(usage)[log2].entries.emplace_back(StagingBuffer{
-        .buffer = std::move(buffer),
-        .mapped_span = mapped_span,
-        .usage = usage,
-        .log2_level = log2,
-        .index = unique_ids++,
-        .tick = deferred ? std::numeric_limits<u64>::max() : scheduler.CurrentTick(),
-        .deferred = deferred,
-    });
-    return entry.Ref();
+    // Allocations are made within the memory budget, so on small devices this is hit long before
+    // the driver runs out of memory. Give back every buffer the GPU is done with and retry.
+    size_t released = 0;
+    released += ReleaseCache(device_local_cache, 0);
+    released += ReleaseCache(upload_cache, 0);
+    released += ReleaseCache(download_cache, 0);
+    LOG_WARNING(Render_Vulkan, "Out of staging memory, released {} KiB of idle buffers",
+                released / 1_KiB);
+    return memory_allocator.CreateBuffer(buffer_ci, usage);
+}
+
+StagingBufferPool::StagingBufferLists& StagingBufferPool::GetCache(MemoryUsage usage) {
+    return const_cast<StagingBufferLists&>(std::as_const(*this).GetCache(usage));
 }
 
-StagingBufferPool::StagingBuffersCache& StagingBufferPool::GetCache(MemoryUsage usage) {
+const StagingBufferPool::StagingBufferLists& StagingBufferPool::GetCache(MemoryUsage usage) const {
     switch (usage) {
     case MemoryUsage::DeviceLocal:
         return device_local_cache;
@@ -226,33 +372,44 @@ StagingBufferPool::StagingBuffersCache& StagingBufferPool::GetCache(MemoryUsage
     }
 }
 
-void StagingBufferPool::ReleaseCache(MemoryUsage usage) {
-    ReleaseLevel(GetCache(usage), current_delete_level);
-}
-
-void StagingBufferPool::ReleaseLevel(StagingBuffersCache& cache, size_t log2) {
-    constexpr size_t deletions_per_tick = 16;
-    auto& staging = cache[log2];
-    auto& entries = staging.entries;
-    const size_t old_size = entries.size();
-
-    const auto is_deletable = [this](const StagingBuffer& entry) {
-        return scheduler.IsFree(entry.tick);
+size_t StagingBufferPool::ReleaseCache(StagingBufferLists& cache, u64 min_idle_frames) {
+    size_t released = 0;
+    const auto is_deletable = [this, min_idle_frames, &released](const StagingBuffer& entry) {
+        if (entry.deferred || current_frame - entry.last_use_frame < min_idle_frames) {
+            return false;
+        }
+        const auto slot_ticks_end = entry.slot_ticks.begin() + entry.num_slots;
+        if (!std::all_of(entry.slot_ticks.begin(), slot_ticks_end,
+                         [this](u64 tick) { return scheduler.IsFree(tick); })) {
+            return false;
+        }
+        released += entry.buffer_size;
+        return true;
     };
-    const size_t begin_offset = staging.delete_index;
-    const size_t end_offset = std::min(begin_offset + deletions_per_tick, old_size);
-    const auto begin = entries.begin() + begin_offset;
-    const auto end = entries.begin() + end_offset;
-    entries.erase(std::remove_if(begin, end, is_deletable), end);
-
-    const size_t new_size = entries.size();
-    staging.delete_index += deletions_per_tick;
-    if (staging.delete_index >= new_size) {
-        staging.delete_index = 0;
+    for (StagingBuffers& staging : cache.classes) {
+        auto& entries = staging.entries;
+        if (entries.empty()) {
+            continue;
+        }
+        entries.erase(std::remove_if(entries.begin(), entries.end(), is_deletable), entries.end());
+        if (staging.iterate_index >= entries.size()) {
+            staging.iterate_index = 0;
+        }
     }
-    if (staging.iterate_index > new_size) {
-        staging.iterate_index = 0;
+    cache.statistics.allocated_bytes -= released;
+    return released;
+}
+
+u64 StagingBufferPool::OldestUseFrame(const StagingBufferLists& cache) const noexcept {
+    u64 oldest_use_frame = current_frame;
+    for (const StagingBuffers& staging : cache.classes) {
+        for (const StagingBuffer& entry : staging.entries) {
+            if (!entry.deferred) {
+                oldest_use_frame = std::min(oldest_use_frame, entry.last_use_frame);
+            }
+        }
     }
+    return oldest_use_frame;
 }
 
 } // namespace Vulkan
@@ -3,7 +3,9 @@
 
 #pragma once
 
-#include <climits>
+#include <array>
+#include <optional>
+#include <span>
 #include <vector>
 
 #include "common/common_types.h"
@@ -11,6 +13,10 @@
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
+namespace VideoCore {
+class MemoryBudget;
+}
+
 namespace Vulkan {
 
 class Device;
@@ -21,16 +27,40 @@ struct StagingBufferRef {
     VkDeviceSize offset;
     std::span<u8> mapped_span;
     MemoryUsage usage;
-    u32 log2_level;
+    u32 size_class;
     u64 index;
 };
 
+/// Counters of the staging memory of a single memory usage
+struct StagingBufferStatistics {
+    u64 requested_bytes = 0;      ///< Bytes asked for by callers since creation
+    u64 allocated_bytes = 0;      ///< Bytes currently held by staging buffers
+    u64 peak_allocated_bytes = 0; ///< Largest value allocated_bytes has reached
+    u64 num_requests = 0;         ///< Requests served since creation
+    u64 num_reused = 0;           ///< Requests served without creating a buffer
+
+    [[nodiscard]] double ReuseRate() const noexcept {
+        return num_requests == 0 ? 0.0
+                                 : static_cast<double>(num_reused) /
+                                       static_cast<double>(num_requests);
+    }
+};
+
+/**
+ * Pool of host visible and device local scratch memory.
+ *
+ * Non-deferred uploads are taken from the stream buffer when possible. Everything else is rounded
+ * up to a size class, four per power of two, and small classes are sub-allocated from arena
+ * buffers holding several slots of the same size. Deferred requests may outlive many frames and
+ * callers index their mapped span from its start, so they always get a dedicated buffer at offset
+ * zero. Buffers left unused for a number of frames are returned to the allocator.
+ */
 class StagingBufferPool {
 public:
     static constexpr size_t NUM_SYNCS = 16;
 
     explicit StagingBufferPool(const Device& device, MemoryAllocator& memory_allocator,
-                               Scheduler& scheduler);
+                               Scheduler& scheduler, VideoCore::MemoryBudget& global_budget);
     ~StagingBufferPool();
 
     StagingBufferRef Request(size_t size, MemoryUsage usage, bool deferred = false);
@@ -40,30 +70,36 @@ public:
         return *stream_buffer;
     }
 
+    /// Returns the counters of a memory usage, stream buffer requests are not included
+    [[nodiscard]] const StagingBufferStatistics& Statistics(MemoryUsage usage) const;
+
     void TickFrame();
 
 private:
-    struct StreamBufferCommit {
-        size_t upper_bound;
-        u64 tick;
-    };
+    /// Largest number of slots in an arena
+    static constexpr size_t MAX_SLOTS = 32;
 
     struct StagingBuffer {
         vk::Buffer buffer;
         std::span<u8> mapped_span;
         MemoryUsage usage;
-        u32 log2_level;
+        u32 size_class;
+        u32 num_slots;
+        size_t buffer_size;
         u64 index;
-        u64 tick = 0;
+        std::array<u64, MAX_SLOTS> slot_ticks{};
+        u64 last_use_frame = 0;
         bool deferred{};
 
-        StagingBufferRef Ref() const noexcept {
+        StagingBufferRef Ref(size_t slot, size_t slot_stride, size_t slot_size) const noexcept {
+            const size_t offset = slot * slot_stride;
             return {
                 .buffer = *buffer,
-                .offset = 0,
-                .mapped_span = mapped_span,
+                .offset = static_cast<VkDeviceSize>(offset),
+                .mapped_span = mapped_span.empty() ? mapped_span
+                                                   : mapped_span.subspan(offset, slot_size),
                 .usage = usage,
-                .log2_level = log2_level,
+                .size_class = size_class,
                 .index = index,
             };
         }
@@ -71,12 +107,13 @@ private:
 
     struct StagingBuffers {
         std::vector<StagingBuffer> entries;
-        size_t delete_index = 0;
         size_t iterate_index = 0;
     };
 
-    static constexpr size_t NUM_LEVELS = sizeof(size_t) * CHAR_BIT;
-    using StagingBuffersCache = std::array<StagingBuffers, NUM_LEVELS>;
+    struct StagingBufferLists {
+        std::vector<StagingBuffers> classes;
+        StagingBufferStatistics statistics;
+    };
 
     StagingBufferRef GetStreamBuffer(size_t size);
 
@@ -84,16 +121,23 @@ private:
 
     StagingBufferRef GetStagingBuffer(size_t size, MemoryUsage usage, bool deferred = false);
 
-    std::optional<StagingBufferRef> TryGetReservedBuffer(size_t size, MemoryUsage usage,
+    std::optional<StagingBufferRef> TryGetReservedBuffer(u32 size_class, MemoryUsage usage,
                                                          bool deferred);
 
-    StagingBufferRef CreateStagingBuffer(size_t size, MemoryUsage usage, bool deferred);
+    StagingBufferRef CreateStagingBuffer(u32 size_class, MemoryUsage usage, bool deferred);
+
+    vk::Buffer CreateBuffer(size_t size, MemoryUsage usage);
+
+    StagingBufferLists& GetCache(MemoryUsage usage);
+
+    const StagingBufferLists& GetCache(MemoryUsage usage) const;
 
-    StagingBuffersCache& GetCache(MemoryUsage usage);
+    /// Destroys the buffers idle for at least min_idle_frames, returns the number of bytes freed
+    size_t ReleaseCache(StagingBufferLists& cache, u64 min_idle_frames);
 
-    void ReleaseCache(MemoryUsage usage);
+    /// Returns the frame the least recently used buffer of a cache was last used in
+    u64 OldestUseFrame(const StagingBufferLists& cache) const noexcept;
 
-    void ReleaseLevel(StagingBuffersCache& cache, size_t log2);
     size_t Region(size_t iter) const noexcept {
         return iter / region_size;
     }
@@ -101,6 +145,7 @@ private:
     const Device& device;
     MemoryAllocator& memory_allocator;
     Scheduler& scheduler;
+    VideoCore::MemoryBudget& global_budget;
 
     vk::Buffer stream_buffer;
     std::span<u8> stream_pointer;
@@ -112,11 +157,11 @@ private:
     size_t free_iterator = 0;
     std::array<u64, NUM_SYNCS> sync_ticks{};
 
-    StagingBuffersCache device_local_cache;
-    StagingBuffersCache upload_cache;
-    StagingBuffersCache download_cache;
+    StagingBufferLists device_local_cache;
+    StagingBufferLists upload_cache;
+    StagingBufferLists download_cache;
 
-    size_t current_delete_level = 0;
+    u64 current_frame = 0;
     u64 buffer_index = 0;
     u64 unique_ids{};
 };
@@ -180,6 +180,11 @@ public:
         return Exchange(Dirty::StateEnable, false);
     }
 
+    /// Returns true when any of the flags in mask is dirty
+    bool IsAnyDirty(const Tegra::Engines::Maxwell3D::DirtyState::Flags& mask) const {
+        return flags->AnyOf(mask);
+    }
+
     bool TouchDepthBoundsTestEnable() {
         return Exchange(Dirty::DepthBoundsEnable, false);
     }
@@ -162,11 +162,17 @@ bool Swapchain::AcquireNextImage() {
     return is_suboptimal || is_outdated;
 }
 
-void Swapchain::Present(VkSemaphore render_semaphore) {
+void Swapchain::Present(VkSemaphore render_semaphore, u64 present_id) {
     const auto present_queue{device.GetPresentQueue()};
+    const VkPresentIdKHR present_id_info{
+        .sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+        .pNext = nullptr,
+        .swapchainCount = 1,
+        .pPresentIds = &present_id,
+    };
     const VkPresentInfoKHR present_info{
         .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
-        .pNext = nullptr,
+        .pNext = present_id != 0 ? &present_id_info : nullptr,
         .waitSemaphoreCount = render_semaphore ? 1U : 0U,
         .pWaitSemaphores = &render_semaphore,
         .swapchainCount = 1,
@@ -174,12 +180,15 @@ void Swapchain::Present(VkSemaphore render_semaphore) {
         .pImageIndices = &image_index,
         .pResults = nullptr,
     };
+    last_present_id = 0;
     std::scoped_lock lock{scheduler.submit_mutex};
     switch (const VkResult result = present_queue.Present(present_info)) {
     case VK_SUCCESS:
+        last_present_id = present_id;
         break;
     case VK_SUBOPTIMAL_KHR:
         LOG_DEBUG(Render_Vulkan, "Suboptimal swapchain");
+        last_present_id = present_id;
         break;
     case VK_ERROR_OUT_OF_DATE_KHR:
         is_outdated = true;
@@ -197,6 +206,34 @@ void Swapchain::Present(VkSemaphore render_semaphore) {
     }
 }
 
+bool Swapchain::WaitForLastPresent(u64 timeout) {
+    if (last_present_id == 0) {
+        return false;
+    }
+    switch (const VkResult result =
+                device.GetLogical().WaitForPresentKHR(*swapchain, last_present_id, timeout)) {
+    case VK_SUCCESS:
+    case VK_SUBOPTIMAL_KHR:
+        return true;
+    case VK_TIMEOUT:
+        LOG_DEBUG(Render_Vulkan, "Timed out waiting for present {}", last_present_id);
+        return false;
+    case VK_ERROR_OUT_OF_DATE_KHR:
+        is_outdated = true;
+        return false;
+    case VK_ERROR_SURFACE_LOST_KHR:
+        // Left to the next acquire, which recreates the surface
+        return false;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        vk::Check(result);
+        return false;
+    default:
+        LOG_ERROR(Render_Vulkan, "vkWaitForPresentKHR returned {}", string_VkResult(result));
+        return false;
+    }
+}
+
 void Swapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities) {
     const auto physical_device{device.GetPhysical()};
     const auto formats{physical_device.GetSurfaceFormatsKHR(surface)};
@@ -275,6 +312,7 @@ void Swapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities) {
     swapchain = device.GetLogical().CreateSwapchainKHR(swapchain_ci);
 
     extent = swapchain_ci.imageExtent;
+    composite_alpha = alpha_flags;
 
     images = swapchain.GetImages();
     image_count = static_cast<u32>(images.size());
@@ -30,7 +30,12 @@ public:
     bool AcquireNextImage();
 
     /// Presents the rendered image to the swapchain.
-    void Present(VkSemaphore render_semaphore);
+    /// A non-zero present_id tags the present for WaitForLastPresent (VK_KHR_present_id).
+    void Present(VkSemaphore render_semaphore, u64 present_id = 0);
+
+    /// Waits until the last tagged present is displayed, or for timeout nanoseconds.
+    /// Returns true when the image was displayed.
+    bool WaitForLastPresent(u64 timeout);
 
     /// Returns true when the swapchain needs to be recreated.
     bool NeedsRecreation() const {
@@ -79,6 +84,11 @@ public:
         return surface_format.format;
     }
 
+    /// Returns true when the presentation engine ignores the alpha channel of the images
+    bool IsAlphaOpaque() const {
+        return composite_alpha == VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    }
+
     VkSemaphore CurrentPresentSemaphore() const {
         return *present_semaphores[frame_index];
     }
@@ -125,11 +135,13 @@ private:
 
     u32 image_index{};
     u32 frame_index{};
+    u64 last_present_id{};
 
     VkFormat image_view_format{};
     VkExtent2D extent{};
     VkPresentModeKHR present_mode{};
     VkSurfaceFormatKHR surface_format{};
+    VkCompositeAlphaFlagBitsKHR composite_alpha{};
     bool has_imm{false};
     bool has_mailbox{false};
     bool has_fifo_relaxed{false};
@@ -3,23 +3,28 @@
 
 #include <algorithm>
 #include <array>
+#include <iterator>
 #include <span>
 #include <vector>
 #include <boost/container/small_vector.hpp>
 
 #include "common/bit_cast.h"
 #include "common/bit_util.h"
+#include "common/literals.h"
 #include "common/settings.h"
 
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 
 #include "video_core/engines/fermi_2d.h"
+#include "video_core/gpu_timeline.h"
 #include "video_core/renderer_vulkan/blit_image.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
 #include "video_core/renderer_vulkan/vk_render_pass_cache.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_sparse_image.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
+#include "video_core/renderer_vulkan/vk_transfer_queue.h"
 #include "video_core/texture_cache/formatter.h"
 #include "video_core/texture_cache/samples_helper.h"
 #include "video_core/texture_cache/util.h"
@@ -43,6 +48,11 @@ using VideoCore::Surface::IsPixelFormatInteger;
 using VideoCore::Surface::SurfaceType;
 
 namespace {
+using namespace Common::Literals;
+
+/// Sparse guest images smaller than this are always fully backed with memory
+constexpr u32 SPARSE_RESIDENCY_THRESHOLD = 32_MiB;
+
 constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
     if (color == std::array<float, 4>{0, 0, 0, 0}) {
         return VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
@@ -156,7 +166,8 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
 }
 
 [[nodiscard]] vk::Image MakeImage(const Device& device, const MemoryAllocator& allocator,
-                                  const ImageInfo& info, std::span<const VkFormat> view_formats) {
+                                  const ImageInfo& info, std::span<const VkFormat> view_formats,
+                                  bool sparse_residency = false) {
     if (info.type == ImageType::Buffer) {
         return vk::Image{};
     }
@@ -173,6 +184,10 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
             image_ci.pNext = &image_format_list;
         }
     }
+    if (sparse_residency) {
+        image_ci.flags |= VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT;
+        return allocator.CreateSparseImage(image_ci);
+    }
     return allocator.CreateImage(image_ci);
 }
 
@@ -206,6 +221,11 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
     });
 }
 
+/// Returns true when images of this format are decoded by BCnDecoderPass instead of the CPU
+[[nodiscard]] bool IsBCnDecodedOnGpu(const Device& device, PixelFormat format) {
+    return !device.IsOptimalBcnSupported() && BCnDecoderPass::IsFormatSupported(format);
+}
+
 [[nodiscard]] VkImageAspectFlags ImageAspectMask(PixelFormat format) {
     switch (VideoCore::Surface::GetFormatType(format)) {
     case VideoCore::Surface::SurfaceType::ColorTexture:
@@ -222,6 +242,20 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
     }
 }
 
+/// Returns true when the memory of a guest image should be bound as its guest memory is mapped
+[[nodiscard]] bool UseSparseResidency(const Device& device, const Scheduler& scheduler,
+                                      const ImageInfo& info, u32 guest_size_bytes) {
+    if (!info.is_sparse || guest_size_bytes < SPARSE_RESIDENCY_THRESHOLD ||
+        !scheduler.GetSparseBinder()) {
+        return false;
+    }
+    if (info.type != ImageType::e2D || info.num_samples != 1 ||
+        ImageAspectMask(info.format) != VK_IMAGE_ASPECT_COLOR_BIT) {
+        return false;
+    }
+    return SparseImage::IsSupported(device, MakeImageCreateInfo(device, info));
+}
+
 [[nodiscard]] VkImageAspectFlags ImageViewAspectMask(const VideoCommon::ImageViewInfo& info) {
     if (info.IsRenderTarget()) {
         return ImageAspectMask(info.format);
@@ -848,16 +882,20 @@ TextureCacheRuntime::TextureCacheRuntime(const Device& device_, Scheduler& sched
         astc_decoder_pass.emplace(device, scheduler, descriptor_pool, staging_buffer_pool,
                                   compute_pass_descriptor_queue, memory_allocator);
     }
+    if (!device.IsOptimalBcnSupported()) {
+        bcn_decoder_pass.emplace(device, scheduler, descriptor_pool, compute_pass_descriptor_queue);
+    }
     if (device.IsStorageImageMultisampleSupported()) {
         msaa_copy_pass = std::make_unique<MSAACopyPass>(
             device, scheduler, descriptor_pool, staging_buffer_pool, compute_pass_descriptor_queue);
     }
-    if (!device.IsKhrImageFormatListSupported()) {
-        return;
-    }
+    // Images viewed with other formats are created with mutable formats even without
+    // VK_KHR_image_format_list, serving reinterpretations as views instead of alias copies.
+    // The list is only chained when supported.
     for (size_t index_a = 0; index_a < VideoCore::Surface::MaxPixelFormat; index_a++) {
         const auto image_format = static_cast<PixelFormat>(index_a);
-        if (IsPixelFormatASTC(image_format) && !device.IsOptimalAstcSupported()) {
+        if ((IsPixelFormatASTC(image_format) && !device.IsOptimalAstcSupported()) ||
+            IsBCnDecodedOnGpu(device, image_format)) {
             view_formats[index_a].push_back(VK_FORMAT_A8B8G8R8_UNORM_PACK32);
         }
         for (size_t index_b = 0; index_b < VideoCore::Surface::MaxPixelFormat; index_b++) {
@@ -1359,6 +1397,10 @@ u64 TextureCacheRuntime::GetDeviceMemoryUsage() const {
     return device.GetDeviceMemoryUsage();
 }
 
+u64 TextureCacheRuntime::GetDeviceMemoryBudget() const {
+    return device.GetDeviceMemoryBudget();
+}
+
 bool TextureCacheRuntime::CanReportMemoryUsage() const {
     return device.CanReportMemoryUsage();
 }
@@ -1368,9 +1410,16 @@ void TextureCacheRuntime::TickFrame() {}
 Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu_addr_,
              VAddr cpu_addr_)
     : VideoCommon::ImageBase(info_, gpu_addr_, cpu_addr_), scheduler{&runtime_.scheduler},
-      runtime{&runtime_}, original_image(MakeImage(runtime_.device, runtime_.memory_allocator, info,
-                                                   runtime->ViewFormats(info.format))),
-      aspect_mask(ImageAspectMask(info.format)) {
+      runtime{&runtime_}, aspect_mask(ImageAspectMask(info.format)) {
+    const bool sparse_residency =
+        UseSparseResidency(runtime->device, *scheduler, info, guest_size_bytes);
+    original_image = MakeImage(runtime->device, runtime->memory_allocator, info,
+                               runtime->ViewFormats(info.format), sparse_residency);
+    if (sparse_residency) {
+        sparse_image =
+            std::make_unique<SparseImage>(runtime->device, runtime->memory_allocator,
+                                          *scheduler->GetSparseBinder(), *original_image, info);
+    }
     if (IsPixelFormatASTC(info.format) && !runtime->device.IsOptimalAstcSupported()) {
         switch (Settings::values.accelerate_astc.GetValue()) {
         case Settings::AstcDecodeMode::Gpu:
@@ -1390,6 +1439,9 @@ Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu
         flags |= VideoCommon::ImageFlagBits::CostlyLoad;
     }
     if (IsPixelFormatBCn(info.format) && !runtime->device.IsOptimalBcnSupported()) {
+        if (IsBCnDecodedOnGpu(runtime->device, info.format) && info.size.depth == 1) {
+            flags |= VideoCommon::ImageFlagBits::AcceleratedUpload;
+        }
         flags |= VideoCommon::ImageFlagBits::Converted;
         flags |= VideoCommon::ImageFlagBits::CostlyLoad;
     }
@@ -1398,9 +1450,10 @@ Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu
     }
     current_image = *original_image;
     storage_image_views.resize(info.resources.levels);
-    if (IsPixelFormatASTC(info.format) && !runtime->device.IsOptimalAstcSupported() &&
-        Settings::values.astc_recompression.GetValue() ==
-            Settings::AstcRecompression::Uncompressed) {
+    if ((IsPixelFormatASTC(info.format) && !runtime->device.IsOptimalAstcSupported() &&
+         Settings::values.astc_recompression.GetValue() ==
+             Settings::AstcRecompression::Uncompressed) ||
+        IsBCnDecodedOnGpu(runtime->device, info.format)) {
         const auto& device = runtime->device.GetLogical();
         for (s32 level = 0; level < info.resources.levels; ++level) {
             storage_image_views[level] =
@@ -1413,6 +1466,11 @@ Image::Image(const VideoCommon::NullImageParams& params) : VideoCommon::ImageBas
 
 Image::~Image() = default;
 
+void Image::UpdateSparseResidency(std::span<const VideoCommon::SubresourceRows> rows,
+                                  bool allow_commit) {
+    sparse_image->Update(rows, allow_commit);
+}
+
 void Image::UploadMemory(VkBuffer buffer, VkDeviceSize offset,
                          std::span<const VideoCommon::BufferImageCopy> copies) {
     // TODO: Move this to another API
@@ -1426,6 +1484,24 @@ void Image::UploadMemory(VkBuffer buffer, VkDeviceSize offset,
     const VkImage vk_image = *original_image;
     const VkImageAspectFlags vk_aspect_mask = aspect_mask;
     const bool is_initialized = std::exchange(initialized, true);
+    // The transfer queue is submitted ahead of the graphics work being recorded, so only images
+    // no command has touched since they were created can be uploaded there
+    const bool is_gpu_used = True(flags & ImageFlagBits::GpuUsed);
+    TransferQueue* const transfer_queue = scheduler->GetTransferQueue();
+    // Sparse images are bound before graphics work, after the transfer queue has been submitted
+    if (transfer_queue && !is_initialized && !is_gpu_used && !is_rescaled && !sparse_image &&
+        False(flags & ImageFlagBits::AsynchronousDecode) &&
+        TransferQueue::CanUpload(vk_aspect_mask, vk_copies)) {
+        transfer_queue->UploadImage(src_buffer, vk_image, vk_aspect_mask, vk_copies,
+                                    unswizzled_size_bytes);
+        scheduler->Record([barrier = transfer_queue->AcquireBarrier(vk_image, vk_aspect_mask)](
+                              vk::CommandBuffer cmdbuf) {
+            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                   VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, barrier);
+        });
+        return;
+    }
+    scheduler->MarkGpuPass(VideoCore::GpuPass::TextureUpload);
     scheduler->Record([src_buffer, vk_image, vk_aspect_mask, is_initialized,
                        vk_copies](vk::CommandBuffer cmdbuf) {
         CopyBufferToImage(cmdbuf, src_buffer, vk_image, vk_aspect_mask, is_initialized, vk_copies);
@@ -1956,7 +2032,7 @@ Framebuffer::Framebuffer(TextureCacheRuntime& runtime, std::span<ImageView*, NUM
           .height = key.size.height,
       }} {
     CreateFramebuffer(runtime, color_buffers, depth_buffer, key.is_rescaled);
-    if (runtime.device.HasDebuggingToolAttached()) {
+    if (framebuffer && runtime.device.HasDebuggingToolAttached()) {
         framebuffer.SetObjectNameEXT(VideoCommon::Name(key).c_str());
     }
 }
@@ -1973,10 +2049,10 @@ Framebuffer::~Framebuffer() = default;
 void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
                                     std::span<ImageView*, NUM_RT> color_buffers,
                                     ImageView* depth_buffer, bool is_rescaled_) {
-    boost::container::small_vector<VkImageView, NUM_RT + 1> attachments;
     RenderPassKey renderpass_key{};
-    s32 num_layers = 1;
+    s32 layers = 1;
 
+    device = &runtime.device;
     is_rescaled = is_rescaled_;
     const auto& resolution = runtime.resolution;
 
@@ -1992,24 +2068,24 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
                                             : color_buffer->size.width);
         height = std::min(height, is_rescaled ? resolution.ScaleUp(color_buffer->size.height)
                                               : color_buffer->size.height);
-        attachments.push_back(color_buffer->RenderTarget());
+        color_views[index] = color_buffer->RenderTarget();
         renderpass_key.color_formats[index] = color_buffer->format;
-        num_layers = std::max(num_layers, color_buffer->range.extent.layers);
+        layers = std::max(layers, color_buffer->range.extent.layers);
         images[num_images] = color_buffer->ImageHandle();
         image_ranges[num_images] = MakeSubresourceRange(color_buffer);
         rt_map[index] = num_images;
         samples = color_buffer->Samples();
         ++num_images;
+        ++num_color_buffers;
     }
-    const size_t num_colors = attachments.size();
     if (depth_buffer) {
         width = std::min(width, is_rescaled ? resolution.ScaleUp(depth_buffer->size.width)
                                             : depth_buffer->size.width);
         height = std::min(height, is_rescaled ? resolution.ScaleUp(depth_buffer->size.height)
                                               : depth_buffer->size.height);
-        attachments.push_back(depth_buffer->RenderTarget());
+        depth_view = depth_buffer->RenderTarget();
         renderpass_key.depth_format = depth_buffer->format;
-        num_layers = std::max(num_layers, depth_buffer->range.extent.layers);
+        layers = std::max(layers, depth_buffer->range.extent.layers);
         images[num_images] = depth_buffer->ImageHandle();
         const VkImageSubresourceRange subresource_range = MakeSubresourceRange(depth_buffer);
         image_ranges[num_images] = subresource_range;
@@ -2025,9 +2101,26 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
     renderpass = runtime.render_pass_cache.Get(renderpass_key);
     render_area.width = std::min(render_area.width, width);
     render_area.height = std::min(render_area.height, height);
+    num_layers = static_cast<u32>(layers);
 
-    num_color_buffers = static_cast<u32>(num_colors);
-    framebuffer = runtime.device.GetLogical().CreateFramebuffer({
+    if (device->IsKhrDynamicRenderingSupported()) {
+        // Draws begin rendering straight from the image views, only blits need the object
+        return;
+    }
+    Handle();
+}
+
+VkFramebuffer Framebuffer::Handle() const {
+    if (framebuffer) {
+        return *framebuffer;
+    }
+    boost::container::small_vector<VkImageView, NUM_RT + 1> attachments;
+    std::ranges::copy_if(color_views, std::back_inserter(attachments),
+                         [](VkImageView view) { return view != VK_NULL_HANDLE; });
+    if (depth_view) {
+        attachments.push_back(depth_view);
+    }
+    framebuffer = device->GetLogical().CreateFramebuffer({
         .sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
@@ -2036,8 +2129,9 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         .pAttachments = attachments.data(),
         .width = render_area.width,
         .height = render_area.height,
-        .layers = static_cast<u32>(std::max(num_layers, 1)),
+        .layers = num_layers,
     });
+    return *framebuffer;
 }
 
 void TextureCacheRuntime::AccelerateImageUpload(
@@ -2046,6 +2140,9 @@ void TextureCacheRuntime::AccelerateImageUpload(
     if (IsPixelFormatASTC(image.info.format)) {
         return astc_decoder_pass->Assemble(image, map, swizzles);
     }
+    if (IsPixelFormatBCn(image.info.format)) {
+        return bcn_decoder_pass->Assemble(image, map, swizzles);
+    }
     ASSERT(false);
 }
 
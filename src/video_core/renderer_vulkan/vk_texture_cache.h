@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <memory>
 #include <span>
 
 #include "video_core/texture_cache/texture_cache_base.h"
@@ -36,6 +37,7 @@ class Framebuffer;
 class RenderPassCache;
 class StagingBufferPool;
 class Scheduler;
+class SparseImage;
 
 class TextureCacheRuntime {
 public:
@@ -61,6 +63,8 @@ public:
 
     u64 GetDeviceMemoryUsage() const;
 
+    u64 GetDeviceMemoryBudget() const;
+
     bool CanReportMemoryUsage() const;
 
     void BlitImage(Framebuffer* dst_framebuffer, ImageView& dst, ImageView& src,
@@ -119,6 +123,7 @@ public:
     BlitImageHelper& blit_image_helper;
     RenderPassCache& render_pass_cache;
     std::optional<ASTCDecoderPass> astc_decoder_pass;
+    std::optional<BCnDecoderPass> bcn_decoder_pass;
     std::unique_ptr<MSAACopyPass> msaa_copy_pass;
     const Settings::ResolutionScalingInfo& resolution;
     std::array<std::vector<VkFormat>, VideoCore::Surface::MaxPixelFormat> view_formats;
@@ -164,6 +169,16 @@ public:
         return aspect_mask;
     }
 
+    /// Returns true when memory is only bound to the parts of the image mapped in guest memory
+    [[nodiscard]] bool IsSparseResident() const noexcept {
+        return sparse_image != nullptr;
+    }
+
+    /// Releases the tiles not storing any of the given rows, and binds memory to the tiles
+    /// storing them when allow_commit is true.
+    void UpdateSparseResidency(std::span<const VideoCommon::SubresourceRows> rows,
+                               bool allow_commit);
+
     /// Returns true when the image is already initialized and mark it as initialized
     [[nodiscard]] bool ExchangeInitialization() noexcept {
         return std::exchange(initialized, true);
@@ -186,6 +201,7 @@ private:
     TextureCacheRuntime* runtime{};
 
     vk::Image original_image;
+    std::unique_ptr<SparseImage> sparse_image;
     std::vector<vk::ImageView> storage_image_views;
     VkImageAspectFlags aspect_mask = 0;
     bool initialized = false;
@@ -317,9 +333,8 @@ public:
                            std::span<ImageView*, NUM_RT> color_buffers, ImageView* depth_buffer,
                            bool is_rescaled = false);
 
-    [[nodiscard]] VkFramebuffer Handle() const noexcept {
-        return *framebuffer;
-    }
+    /// Returns the framebuffer object, with dynamic rendering it's only created for blits
+    [[nodiscard]] VkFramebuffer Handle() const;
 
     [[nodiscard]] VkRenderPass RenderPass() const noexcept {
         return renderpass;
@@ -329,6 +344,19 @@ public:
         return render_area;
     }
 
+    [[nodiscard]] u32 NumLayers() const noexcept {
+        return num_layers;
+    }
+
+    /// Returns the color attachments indexed by render target, null for unbound targets
+    [[nodiscard]] const std::array<VkImageView, NUM_RT>& ColorViews() const noexcept {
+        return color_views;
+    }
+
+    [[nodiscard]] VkImageView DepthView() const noexcept {
+        return depth_view;
+    }
+
     [[nodiscard]] VkSampleCountFlagBits Samples() const noexcept {
         return samples;
     }
@@ -366,9 +394,13 @@ public:
     }
 
 private:
-    vk::Framebuffer framebuffer;
+    const Device* device{};
+    mutable vk::Framebuffer framebuffer;
     VkRenderPass renderpass{};
     VkExtent2D render_area{};
+    u32 num_layers = 1;
+    std::array<VkImageView, NUM_RT> color_views{};
+    VkImageView depth_view{};
     VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
     u32 num_color_buffers = 0;
     u32 num_images = 0;
@@ -386,6 +418,7 @@ struct TextureCacheParams {
     static constexpr bool HAS_EMULATED_COPIES = false;
     static constexpr bool HAS_DEVICE_MEMORY_INFO = true;
     static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = true;
+    static constexpr bool HAS_SPARSE_RESIDENCY = true;
 
     using Runtime = Vulkan::TextureCacheRuntime;
     using Image = Vulkan::Image;
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include "common/literals.h"
+#include "video_core/renderer_vulkan/vk_transfer_queue.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+namespace {
+using namespace Common::Literals;
+
+/// Pending upload size that triggers a submission before the graphics queue is flushed
+constexpr size_t SUBMIT_THRESHOLD = 16_MiB;
+
+[[nodiscard]] VkImageSubresourceRange FullRange(VkImageAspectFlags aspect_mask) {
+    return VkImageSubresourceRange{
+        .aspectMask = aspect_mask,
+        .baseMipLevel = 0,
+        .levelCount = VK_REMAINING_MIP_LEVELS,
+        .baseArrayLayer = 0,
+        .layerCount = VK_REMAINING_ARRAY_LAYERS,
+    };
+}
+} // Anonymous namespace
+
+TransferQueue::TransferQueue(const Device& device_)
+    : device{device_}, master_semaphore{device},
+      command_pool{master_semaphore, device, device.GetTransferFamily()} {}
+
+TransferQueue::~TransferQueue() = default;
+
+bool TransferQueue::IsSupported(const Device& device) {
+    // Graphics submissions wait on the transfer queue through its timeline semaphore
+    return device.HasDedicatedTransferQueue() && device.HasTimelineSemaphore();
+}
+
+bool TransferQueue::CanUpload(VkImageAspectFlags aspect_mask,
+                              std::span<const VkBufferImageCopy> copies) {
+    // Queues without graphics or compute support can't copy to depth or stencil aspects, and
+    // their buffer offsets must be a multiple of four
+    if (aspect_mask != VK_IMAGE_ASPECT_COLOR_BIT) {
+        return false;
+    }
+    return std::ranges::all_of(copies, [](const VkBufferImageCopy& copy) {
+        return copy.bufferOffset % 4 == 0;
+    });
+}
+
+void TransferQueue::UploadImage(VkBuffer src_buffer, VkImage image, VkImageAspectFlags aspect_mask,
+                                std::span<const VkBufferImageCopy> copies, size_t size_bytes) {
+    RequestBatch();
+    const VkImageMemoryBarrier transfer_barrier{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = 0,
+        .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image,
+        .subresourceRange = FullRange(aspect_mask),
+    };
+    const VkImageMemoryBarrier release_barrier{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = 0,
+        .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+        .srcQueueFamilyIndex = device.GetTransferFamily(),
+        .dstQueueFamilyIndex = device.GetGraphicsFamily(),
+        .image = image,
+        .subresourceRange = FullRange(aspect_mask),
+    };
+    cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                           transfer_barrier);
+    cmdbuf.CopyBufferToImage(src_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copies);
+    cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+                           release_barrier);
+
+    pending_bytes += size_bytes;
+    if (pending_bytes >= SUBMIT_THRESHOLD) {
+        // Large uploads are sent right away, so they can run while the rest of the frame records
+        Submit();
+    }
+}
+
+VkImageMemoryBarrier TransferQueue::AcquireBarrier(VkImage image,
+                                                   VkImageAspectFlags aspect_mask) const {
+    return VkImageMemoryBarrier{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = 0,
+        .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT |
+                         VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
+                         VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT |
+                         VK_ACCESS_TRANSFER_WRITE_BIT,
+        .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+        .srcQueueFamilyIndex = device.GetTransferFamily(),
+        .dstQueueFamilyIndex = device.GetGraphicsFamily(),
+        .image = image,
+        .subresourceRange = FullRange(aspect_mask),
+    };
+}
+
+u64 TransferQueue::Flush() {
+    if (is_recording) {
+        Submit();
+    }
+    return std::exchange(wait_tick, 0);
+}
+
+void TransferQueue::RequestBatch() {
+    if (is_recording) {
+        return;
+    }
+    cmdbuf = vk::CommandBuffer(command_pool.Commit(), device.GetDispatchLoader());
+    cmdbuf.Begin({
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .pNext = nullptr,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+        .pInheritanceInfo = nullptr,
+    });
+    is_recording = true;
+}
+
+void TransferQueue::Submit() {
+    cmdbuf.End();
+    const u64 signal_value = master_semaphore.NextTick();
+    switch (const VkResult result =
+                master_semaphore.SubmitQueue(device.GetTransferQueue(), cmdbuf, signal_value)) {
+    case VK_SUCCESS:
+        break;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        [[fallthrough]];
+    default:
+        vk::Check(result);
+        break;
+    }
+    is_recording = false;
+    pending_bytes = 0;
+    wait_tick = signal_value;
+
+    // Keep a single batch in flight while the next one is recorded
+    master_semaphore.Wait(signal_value - 1);
+}
+
+} // namespace Vulkan
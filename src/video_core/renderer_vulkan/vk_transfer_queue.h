@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "common/common_types.h"
+#include "video_core/renderer_vulkan/vk_command_pool.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+
+/**
+ * Records image uploads on the device's dedicated transfer queue, so they execute alongside
+ * graphics work instead of in series with it.
+ *
+ * Uploads are batched and submitted once enough data is pending or when the graphics queue is
+ * submitted, whichever happens first. The graphics submission waits on the timeline of this queue,
+ * so resources tracked with MasterSemaphore ticks, like staging buffers, stay protected until the
+ * transfers reading them have finished. Only two batches are kept around: one executing on the GPU
+ * while the next one is recorded.
+ */
+class TransferQueue {
+public:
+    explicit TransferQueue(const Device& device);
+    ~TransferQueue();
+
+    TransferQueue(const TransferQueue&) = delete;
+    TransferQueue& operator=(const TransferQueue&) = delete;
+
+    /// Returns true when the device can offload uploads to a dedicated transfer queue
+    [[nodiscard]] static bool IsSupported(const Device& device);
+
+    /// Returns true when the given copies can be executed on a transfer-only queue
+    [[nodiscard]] static bool CanUpload(VkImageAspectFlags aspect_mask,
+                                        std::span<const VkBufferImageCopy> copies);
+
+    /**
+     * Records an upload to an image that has never been used, leaving it in the general layout
+     * and releasing its ownership to the graphics queue family.
+     * The barrier returned by AcquireBarrier must be recorded on the graphics queue before using it.
+     */
+    void UploadImage(VkBuffer src_buffer, VkImage image, VkImageAspectFlags aspect_mask,
+                     std::span<const VkBufferImageCopy> copies, size_t size_bytes);
+
+    /// Returns the barrier acquiring an image uploaded by this queue on the graphics queue family
+    [[nodiscard]] VkImageMemoryBarrier AcquireBarrier(VkImage image,
+                                                      VkImageAspectFlags aspect_mask) const;
+
+    /// Submits pending uploads, returns the tick graphics work has to wait for or zero if none
+    [[nodiscard]] u64 Flush();
+
+    /// Returns the timeline semaphore signalled by transfer submissions
+    [[nodiscard]] VkSemaphore Semaphore() const noexcept {
+        return master_semaphore.Handle();
+    }
+
+private:
+    /// Begins recording a new batch if there isn't one
+    void RequestBatch();
+
+    /// Submits the batch being recorded
+    void Submit();
+
+    const Device& device;
+    MasterSemaphore master_semaphore;
+    CommandPool command_pool;
+
+    vk::CommandBuffer cmdbuf;
+    bool is_recording = false;
+    size_t pending_bytes = 0;
+    u64 wait_tick = 0;
+};
+
+} // namespace Vulkan
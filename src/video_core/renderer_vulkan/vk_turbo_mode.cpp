@@ -3,6 +3,7 @@
 
 #if defined(ANDROID) && defined(ARCHITECTURE_arm64)
 #include <adrenotools/driver.h>
+#include "common/android/performance_governor.h"
 #endif
 
 #include "common/literals.h"
@@ -153,7 +154,8 @@ void TurboMode::Run(std::stop_token stop_token) {
     while (!stop_token.stop_requested()) {
 #ifdef ANDROID
 #ifdef ARCHITECTURE_arm64
-        adrenotools_set_turbo(true);
+        // Holding the clocks up once the device is about to throttle only makes it throttle harder
+        adrenotools_set_turbo(!Common::Android::GetPerformanceGovernor().IsNearThrottling());
 #endif
 #else
         // Reset the fence.
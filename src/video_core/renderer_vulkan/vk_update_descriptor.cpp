@@ -5,6 +5,7 @@
 #include <boost/container/static_vector.hpp>
 
 #include "common/logging/log.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/vulkan_common/vulkan_device.h"
@@ -12,10 +13,15 @@
 
 namespace Vulkan {
 
-UpdateDescriptorQueue::UpdateDescriptorQueue(const Device& device_, Scheduler& scheduler_)
+UpdateDescriptorQueue::UpdateDescriptorQueue(const Device& device_, Scheduler& scheduler_,
+                                             MemoryAllocator* memory_allocator)
     : device{device_}, scheduler{scheduler_} {
     payload_start = payload.data();
     payload_cursor = payload.data();
+    if (memory_allocator && device.IsExtDescriptorBufferSupported()) {
+        descriptor_buffer =
+            std::make_unique<DescriptorBuffer>(device, *memory_allocator, scheduler);
+    }
 }
 
 UpdateDescriptorQueue::~UpdateDescriptorQueue() = default;
@@ -4,14 +4,24 @@
 #pragma once
 
 #include <array>
+#include <memory>
 
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace Vulkan {
 
+class DescriptorBuffer;
 class Device;
+class MemoryAllocator;
 class Scheduler;
 
+/// Texel buffer referenced by address, used by descriptor buffers instead of buffer views
+struct TexelBufferAddress {
+    VkDeviceAddress address;
+    VkDeviceSize range;
+    VkFormat format;
+};
+
 struct DescriptorUpdateEntry {
     struct Empty {};
 
@@ -19,12 +29,15 @@ struct DescriptorUpdateEntry {
     DescriptorUpdateEntry(VkDescriptorImageInfo image_) : image{image_} {}
     DescriptorUpdateEntry(VkDescriptorBufferInfo buffer_) : buffer{buffer_} {}
     DescriptorUpdateEntry(VkBufferView texel_buffer_) : texel_buffer{texel_buffer_} {}
+    DescriptorUpdateEntry(TexelBufferAddress texel_buffer_address_)
+        : texel_buffer_address{texel_buffer_address_} {}
 
     union {
         Empty empty{};
         VkDescriptorImageInfo image;
         VkDescriptorBufferInfo buffer;
         VkBufferView texel_buffer;
+        TexelBufferAddress texel_buffer_address;
     };
 };
 
@@ -36,7 +49,10 @@ class UpdateDescriptorQueue final {
     static constexpr size_t PAYLOAD_SIZE = FRAME_PAYLOAD_SIZE * FRAMES_IN_FLIGHT;
 
 public:
-    explicit UpdateDescriptorQueue(const Device& device_, Scheduler& scheduler_);
+    /// When given a memory allocator, descriptors are written to a descriptor buffer on devices
+    /// that support them instead of being updated through descriptor sets
+    explicit UpdateDescriptorQueue(const Device& device_, Scheduler& scheduler_,
+                                   MemoryAllocator* memory_allocator = nullptr);
     ~UpdateDescriptorQueue();
 
     void TickFrame();
@@ -47,6 +63,11 @@ public:
         return upload_start;
     }
 
+    /// Returns the descriptor buffer backend, or nullptr when descriptor sets are used
+    DescriptorBuffer* GetDescriptorBuffer() const noexcept {
+        return descriptor_buffer.get();
+    }
+
     void AddSampledImage(VkImageView image_view, VkSampler sampler) {
         *(payload_cursor++) = VkDescriptorImageInfo{
             .sampler = sampler,
@@ -75,6 +96,14 @@ public:
         *(payload_cursor++) = texel_buffer;
     }
 
+    void AddTexelBufferAddress(VkDeviceAddress address, VkDeviceSize size, VkFormat format) {
+        *(payload_cursor++) = TexelBufferAddress{
+            .address = address,
+            .range = size,
+            .format = format,
+        };
+    }
+
 private:
     const Device& device;
     Scheduler& scheduler;
@@ -84,6 +113,7 @@ private:
     DescriptorUpdateEntry* payload_start = nullptr;
     const DescriptorUpdateEntry* upload_start = nullptr;
     std::array<DescriptorUpdateEntry, PAYLOAD_SIZE> payload;
+    std::unique_ptr<DescriptorBuffer> descriptor_buffer;
 };
 
 // TODO: should these be separate classes instead?
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <bit>
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_upload_ring.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+
+namespace Vulkan {
+namespace {
+// Maximum potential alignment of a Vulkan buffer
+constexpr size_t ALIGNMENT = 256;
+constexpr size_t MIN_REGION_SIZE = 2_MiB;
+constexpr size_t MAX_REGION_SIZE = 32_MiB;
+// Number of frames the high-water mark is measured over before the regions can shrink
+constexpr u32 SHRINK_INTERVAL = 600;
+} // Anonymous namespace
+
+UploadRing::UploadRing(const Device& device_, MemoryAllocator& memory_allocator_,
+                       Scheduler& scheduler_)
+    : device{device_}, memory_allocator{memory_allocator_}, scheduler{scheduler_} {
+    Allocate(MIN_REGION_SIZE);
+}
+
+UploadRing::~UploadRing() = default;
+
+std::optional<StagingBufferRef> UploadRing::Request(size_t size) {
+    if (size > MAX_UPLOAD_SIZE) {
+        return std::nullopt;
+    }
+    const size_t aligned_size = Common::AlignUp(size, ALIGNMENT);
+    frame_demand += aligned_size;
+    if (!is_region_free || region_offset + aligned_size > region_size) {
+        return std::nullopt;
+    }
+    const size_t offset = region_index * region_size + region_offset;
+    region_offset += aligned_size;
+    return StagingBufferRef{
+        .buffer = *buffer,
+        .offset = static_cast<VkDeviceSize>(offset),
+        .mapped_span = mapped.subspan(offset, size),
+        .usage = MemoryUsage::Upload,
+        .size_class{},
+        .index{},
+    };
+}
+
+void UploadRing::TickFrame() {
+    region_ticks[region_index] = scheduler.CurrentTick();
+    high_water_mark = std::max(high_water_mark, frame_demand);
+    frame_demand = 0;
+
+    while (!retired_buffers.empty() && scheduler.IsFree(retired_buffers.front().first)) {
+        retired_buffers.pop_front();
+    }
+    const size_t desired_size = DesiredRegionSize();
+    const bool is_window_over = ++frames_since_resize >= SHRINK_INTERVAL;
+    if (desired_size > region_size || (is_window_over && desired_size < region_size)) {
+        LOG_DEBUG(Render_Vulkan,
+                  "Resizing upload ring regions from {} KiB to {} KiB, high-water mark {} KiB",
+                  region_size / 1_KiB, desired_size / 1_KiB, high_water_mark / 1_KiB);
+        // Slices of the previous buffer may still be read by work up to the current tick
+        retired_buffers.emplace_back(scheduler.CurrentTick(), std::move(buffer));
+        Allocate(desired_size);
+    } else if (is_window_over) {
+        frames_since_resize = 0;
+        high_water_mark = 0;
+    }
+    region_index = (region_index + 1) % NUM_FRAMES;
+    region_offset = 0;
+
+    // Don't wait for the region to be free, uploads are staged elsewhere until it is
+    is_region_free = scheduler.IsFree(region_ticks[region_index]);
+}
+
+void UploadRing::Allocate(size_t new_region_size) {
+    VkBufferCreateInfo buffer_ci{
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .size = new_region_size * NUM_FRAMES,
+        .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+                 VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
+                 VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+    };
+    buffer = memory_allocator.CreateBuffer(buffer_ci, MemoryUsage::Stream);
+    if (device.HasDebuggingToolAttached()) {
+        buffer.SetObjectNameEXT("Upload Ring");
+    }
+    mapped = buffer.Mapped();
+    ASSERT_MSG(!mapped.empty(), "Upload ring must be host visible!");
+
+    region_size = new_region_size;
+    region_ticks.fill(0);
+    region_offset = 0;
+    is_region_free = true;
+    frames_since_resize = 0;
+    high_water_mark = 0;
+}
+
+size_t UploadRing::DesiredRegionSize() const noexcept {
+    // Leave a quarter of headroom over the largest demand seen
+    const size_t wanted_size = std::bit_ceil(high_water_mark + high_water_mark / 4);
+    return std::clamp(wanted_size, MIN_REGION_SIZE, MAX_REGION_SIZE);
+}
+
+} // namespace Vulkan
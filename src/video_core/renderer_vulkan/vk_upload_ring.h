@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <deque>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+using namespace Common::Literals;
+
+class Device;
+class MemoryAllocator;
+class Scheduler;
+
+/**
+ * Persistently mapped ring of memory for small uploads, split in one region per frame in flight.
+ *
+ * Slices are sub-allocated linearly from the region of the current frame and the whole region is
+ * recycled once the work recorded during its frame has finished. Requests that don't fit are
+ * left to the staging buffer pool, and the regions are resized from the largest demand seen in
+ * a frame.
+ */
+class UploadRing {
+public:
+    /// Largest upload served from the ring
+    static constexpr size_t MAX_UPLOAD_SIZE = 64_KiB;
+
+    explicit UploadRing(const Device& device, MemoryAllocator& memory_allocator,
+                        Scheduler& scheduler);
+    ~UploadRing();
+
+    UploadRing(const UploadRing&) = delete;
+    UploadRing& operator=(const UploadRing&) = delete;
+
+    /// Returns a slice of the ring, or nullopt when the upload has to be staged elsewhere
+    [[nodiscard]] std::optional<StagingBufferRef> Request(size_t size);
+
+    /// Moves to the region of the next frame, resizing the ring when needed
+    void TickFrame();
+
+    /// Returns the buffer slices are allocated from
+    [[nodiscard]] VkBuffer Handle() const noexcept {
+        return *buffer;
+    }
+
+    /// Returns the largest number of bytes requested in a frame since the last resize
+    [[nodiscard]] size_t HighWaterMark() const noexcept {
+        return high_water_mark;
+    }
+
+private:
+    static constexpr size_t NUM_FRAMES = 4;
+
+    /// Creates the buffer backing the ring with regions of the given size
+    void Allocate(size_t new_region_size);
+
+    /// Returns the region size that fits the high-water mark
+    [[nodiscard]] size_t DesiredRegionSize() const noexcept;
+
+    const Device& device;
+    MemoryAllocator& memory_allocator;
+    Scheduler& scheduler;
+
+    vk::Buffer buffer;
+    std::span<u8> mapped;
+    size_t region_size = 0;
+    std::array<u64, NUM_FRAMES> region_ticks{};
+    size_t region_index = 0;
+    size_t region_offset = 0;
+    bool is_region_free = true;
+
+    size_t frame_demand = 0;
+    size_t high_water_mark = 0;
+    u32 frames_since_resize = 0;
+
+    std::deque<std::pair<u64, vk::Buffer>> retired_buffers;
+};
+
+} // namespace Vulkan
@@ -13,6 +13,7 @@
 
 #include "common/common_types.h"
 #include "common/polyfill_ranges.h"
+#include "shader_recompiler/translation_cache.h"
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/rasterizer_interface.h"
@@ -96,6 +97,9 @@ protected:
     std::array<const ShaderInfo*, NUM_PROGRAMS> shader_infos{};
     bool last_shaders_valid = false;
 
+    /// Optimized programs shared between pipelines using the same stages
+    Shader::TranslationCache translation_cache;
+
 private:
     /// @brief Tries to obtain a cached shader starting in a given address
     /// @note Doesn't check for ranges, the given address has to be the start of the shader
@@ -2,20 +2,26 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <memory>
 #include <optional>
+#include <sstream>
+#include <streambuf>
 #include <utility>
 
 #include "common/assert.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "common/fast_hash.h"
+#include "common/fs/file_lock.h"
 #include "common/fs/fs.h"
+#include "common/fs/mapped_file.h"
 #include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/polyfill_ranges.h"
+#include "common/zstd_compression.h"
 #include "shader_recompiler/environment.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/memory_manager.h"
@@ -29,6 +35,33 @@ constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'a', 'c', 'h
 
 constexpr size_t INST_SIZE = sizeof(u64);
 
+/// Index entry in front of each pipeline in the pipeline cache file.
+/// It's followed by the pipeline key and the zstd compressed environments, so records can be
+/// walked and filtered by key without reading the environments of pipelines that are not built.
+struct PipelineRecordHeader {
+    PipelineUsage usage; ///< Must stay first, UpdatePipelineUsage rewrites it at the record offset
+    Shader::Stage stage; ///< Stage of the first environment
+    u32 num_envs;
+    u32 key_size;
+    u32 padding;
+    u64 uncompressed_size;
+    u64 compressed_size;
+};
+static_assert(offsetof(PipelineRecordHeader, usage) == 0);
+static_assert(std::is_trivially_copyable_v<PipelineRecordHeader>);
+
+constexpr size_t FILE_HEADER_SIZE = MAGIC_NUMBER.size() + sizeof(u32);
+constexpr u32 MAX_PIPELINE_ENVS = 5;
+
+/// Read only stream over a block of memory, avoids copying decompressed records into a string
+class MemoryStreamBuffer final : public std::streambuf {
+public:
+    explicit MemoryStreamBuffer(std::span<const u8> data) {
+        char* const begin{reinterpret_cast<char*>(const_cast<u8*>(data.data()))};
+        setg(begin, begin, begin + data.size());
+    }
+};
+
 using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 
 static u64 MakeCbufKey(u32 index, u32 offset) {
@@ -156,7 +189,7 @@ std::optional<u64> GenericEnvironment::Analyze() {
     }
     cached_lowest = start_address;
     cached_highest = start_address + static_cast<u32>(*size);
-    return Common::CityHash64(reinterpret_cast<const char*>(code.data()), *size);
+    return Common::FastHash64(code.data(), *size);
 }
 
 void GenericEnvironment::SetCachedSize(size_t size_bytes) {
@@ -186,14 +219,14 @@ u64 GenericEnvironment::CalculateHash() const {
     const size_t size{ReadSizeBytes()};
     const auto data{std::make_unique<char[]>(size)};
     gpu_memory->ReadBlock(program_base + read_lowest, data.get(), size);
-    return Common::CityHash64(data.get(), size);
+    return Common::FastHash64(data.get(), size);
 }
 
 void GenericEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
     DumpImpl(pipeline_hash, shader_hash, code, read_highest, read_lowest, initial_offset, stage);
 }
 
-void GenericEnvironment::Serialize(std::ofstream& file) const {
+void GenericEnvironment::Serialize(std::ostream& file) const {
     const u64 code_size{static_cast<u64>(CachedSizeBytes())};
     const u64 num_texture_types{static_cast<u64>(texture_types.size())};
     const u64 num_texture_pixel_formats{static_cast<u64>(texture_pixel_formats.size())};
@@ -448,7 +481,7 @@ u32 ComputeEnvironment::ReadViewportTransformState() {
     return viewport_transform_state;
 }
 
-void FileEnvironment::Deserialize(std::ifstream& file) {
+void FileEnvironment::Deserialize(std::istream& file) {
     u64 code_size{};
     u64 num_texture_types{};
     u64 num_texture_pixel_formats{};
@@ -517,10 +550,11 @@ void FileEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
 }
 
 u64 FileEnvironment::ReadInstruction(u32 address) {
-    if (address < read_lowest || address > read_highest) {
+    const size_t index{(address - read_lowest) / INST_SIZE};
+    if (address < read_lowest || address > read_highest || index >= code.size()) {
         throw Shader::LogicError("Out of bounds address {}", address);
     }
-    return code[(address - read_lowest) / sizeof(u64)];
+    return code[index];
 }
 
 u32 FileEnvironment::ReadCbufValue(u32 cbuf_index, u32 cbuf_offset) {
@@ -583,7 +617,41 @@ std::optional<Shader::ReplaceConstant> FileEnvironment::GetReplaceConstBuffer(u3
 }
 
 void SerializePipeline(std::span<const char> key, std::span<const GenericEnvironment* const> envs,
-                       const std::filesystem::path& filename, u32 cache_version) try {
+                       const std::filesystem::path& filename, u32 cache_version,
+                       const PipelineUsage& usage) try {
+    if (!std::ranges::all_of(envs, &GenericEnvironment::CanBeSerialized)) {
+        return;
+    }
+    std::ostringstream payload_stream(std::ios::binary);
+    payload_stream.exceptions(std::ios::failbit);
+    for (const GenericEnvironment* const env : envs) {
+        env->Serialize(payload_stream);
+    }
+    const std::string payload{std::move(payload_stream).str()};
+    // Reusing the compression context of the thread saves allocating it for every pipeline
+    thread_local Common::Compression::ZstdEncoder encoder(Common::Compression::DEFAULT_ZSTD_LEVEL);
+    std::vector<u8> compressed(Common::Compression::GetCompressBoundZSTD(payload.size()));
+    const std::optional<size_t> compressed_size{encoder.Compress(
+        compressed, {reinterpret_cast<const u8*>(payload.data()), payload.size()})};
+    if (!compressed_size) {
+        LOG_ERROR(Common_Filesystem, "Failed to compress pipeline");
+        return;
+    }
+    compressed.resize(*compressed_size);
+    const PipelineRecordHeader header{
+        .usage = usage,
+        .stage = envs.front()->ShaderStage(),
+        .num_envs = static_cast<u32>(envs.size()),
+        .key_size = static_cast<u32>(key.size_bytes()),
+        .padding = 0,
+        .uncompressed_size = payload.size(),
+        .compressed_size = compressed.size(),
+    };
+
+    // Instances sharing the cache directory append to the same file, the lock outlives the stream
+    // so the whole record is flushed before another instance writes or indexes the file
+    const Common::FS::FileLock lock{Common::FS::FileLock::LockPathFor(filename),
+                                    Common::FS::FileLockMode::Exclusive};
     std::ofstream file(filename, std::ios::binary | std::ios::ate | std::ios::app);
     file.exceptions(std::ifstream::failbit);
     if (!file.is_open()) {
@@ -596,15 +664,9 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
         file.write(MAGIC_NUMBER.data(), MAGIC_NUMBER.size())
             .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version));
     }
-    if (!std::ranges::all_of(envs, &GenericEnvironment::CanBeSerialized)) {
-        return;
-    }
-    const u32 num_envs{static_cast<u32>(envs.size())};
-    file.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
-    for (const GenericEnvironment* const env : envs) {
-        env->Serialize(file);
-    }
-    file.write(key.data(), key.size_bytes());
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header))
+        .write(key.data(), key.size_bytes())
+        .write(reinterpret_cast<const char*>(compressed.data()), compressed.size());
 
 } catch (const std::ios_base::failure& e) {
     LOG_ERROR(Common_Filesystem, "{}", e.what());
@@ -614,24 +676,90 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
     }
 }
 
-void LoadPipelines(
-    std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics) try {
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
-        return;
+std::vector<FileEnvironment> CachedPipeline::Environments() const {
+    const std::vector<u8> data{EnvironmentsData()};
+    if (data.empty()) {
+        return {};
     }
-    file.exceptions(std::ifstream::failbit);
-    const auto end{file.tellg()};
-    file.seekg(0, std::ios::beg);
+    MemoryStreamBuffer buffer(data);
+    std::istream stream(&buffer);
+    stream.exceptions(std::ios::failbit);
+    std::vector<FileEnvironment> envs(num_envs);
+    try {
+        for (FileEnvironment& env : envs) {
+            env.Deserialize(stream);
+        }
+    } catch (const std::ios_base::failure&) {
+        LOG_ERROR(Common_Filesystem, "Truncated pipeline at offset {} in the pipeline cache",
+                  record.offset);
+        return {};
+    }
+    return envs;
+}
+
+std::vector<u8> CachedPipeline::EnvironmentsData() const {
+    std::vector<u8> data(uncompressed_size);
+    if (Common::Compression::DecompressDataZSTD(data, payload) != uncompressed_size) {
+        LOG_ERROR(Common_Filesystem, "Corrupted pipeline at offset {} in the pipeline cache",
+                  record.offset);
+        return {};
+    }
+    return data;
+}
+
+namespace {
+struct IndexEntry {
+    size_t offset;
+    PipelineRecordHeader header;
+};
+
+/// Walks the record index of a mapped pipeline cache file.
+/// @returns Offset where the last complete record ends
+size_t ReadIndex(std::span<const u8> data, std::vector<IndexEntry>& entries) {
+    size_t offset{FILE_HEADER_SIZE};
+    while (data.size() - offset >= sizeof(PipelineRecordHeader)) {
+        IndexEntry entry{.offset = offset, .header{}};
+        std::memcpy(&entry.header, data.data() + offset, sizeof(entry.header));
+        const PipelineRecordHeader& header{entry.header};
+        const size_t remaining{data.size() - offset - sizeof(header)};
+        if (header.num_envs == 0 || header.num_envs > MAX_PIPELINE_ENVS ||
+            header.key_size > remaining || header.compressed_size > remaining - header.key_size) {
+            break;
+        }
+        offset += sizeof(header) + header.key_size + header.compressed_size;
+        entries.push_back(entry);
+    }
+    return offset;
+}
 
-    std::array<char, 8> magic_number;
-    u32 cache_version;
-    file.read(magic_number.data(), magic_number.size())
-        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+void RemovePipelineCache(const std::filesystem::path& filename) {
+    if (!Common::FS::RemoveFile(filename)) {
+        LOG_ERROR(Common_Filesystem, "Failed to delete pipeline cache file {}",
+                  Common::FS::PathToUTF8String(filename));
+    }
+}
+
+/// Maps a pipeline cache file and walks its records, dropping files of other versions and the
+/// broken tail of an interrupted append
+std::shared_ptr<const Common::FS::MappedFile> OpenPipelineCache(
+    const std::filesystem::path& filename, u32 expected_cache_version,
+    std::vector<IndexEntry>& entries) {
+    // Truncating or deleting the file is only safe while no other instance is appending to it
+    const Common::FS::FileLock lock{Common::FS::FileLock::LockPathFor(filename),
+                                    Common::FS::FileLockMode::Exclusive};
+    auto file{std::make_shared<Common::FS::MappedFile>(filename)};
+    if (!file->IsOpen()) {
+        return nullptr;
+    }
+    std::array<char, 8> magic_number{};
+    u32 cache_version{};
+    if (file->Data().size() >= FILE_HEADER_SIZE) {
+        std::memcpy(magic_number.data(), file->Data().data(), magic_number.size());
+        std::memcpy(&cache_version, file->Data().data() + magic_number.size(),
+                    sizeof(cache_version));
+    }
     if (magic_number != MAGIC_NUMBER || cache_version != expected_cache_version) {
-        file.close();
+        file->Close();
         if (Common::FS::RemoveFile(filename)) {
             if (magic_number != MAGIC_NUMBER) {
                 LOG_ERROR(Common_Filesystem, "Invalid pipeline cache file");
@@ -644,31 +772,86 @@ void LoadPipelines(
                       "Invalid pipeline cache file and failed to delete it in \"{}\"",
                       Common::FS::PathToUTF8String(filename));
         }
+        return nullptr;
+    }
+    const size_t valid_size{ReadIndex(file->Data(), entries)};
+    if (valid_size != file->Data().size()) {
+        // Usually a session that exited while appending a pipeline. Cut the broken tail so new
+        // pipelines are appended after the last good one, then map the file again.
+        LOG_WARNING(Common_Filesystem, "Dropping {} trailing bytes of the pipeline cache",
+                    file->Data().size() - valid_size);
+        file->Close();
+        std::error_code ec;
+        std::filesystem::resize_file(filename, valid_size, ec);
+        if (ec) {
+            LOG_ERROR(Common_Filesystem, "Failed to truncate pipeline cache: {}", ec.message());
+            RemovePipelineCache(filename);
+            return nullptr;
+        }
+        file = std::make_shared<Common::FS::MappedFile>(filename);
+        if (file->Data().size() != valid_size) {
+            return nullptr;
+        }
+    }
+    return file;
+}
+
+} // Anonymous namespace
+
+std::optional<u32> ReadPipelineCacheVersion(const std::filesystem::path& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    std::array<char, 8> magic_number{};
+    u32 cache_version{};
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    if (!file || magic_number != MAGIC_NUMBER) {
+        return std::nullopt;
+    }
+    return cache_version;
+}
+
+void LoadPipelines(std::stop_token stop_loading, const std::filesystem::path& filename,
+                   u32 expected_cache_version,
+                   Common::UniqueFunction<void, CachedPipeline> load_compute,
+                   Common::UniqueFunction<void, CachedPipeline> load_graphics) {
+    std::vector<IndexEntry> entries;
+    const auto file{OpenPipelineCache(filename, expected_cache_version, entries)};
+    if (!file) {
         return;
     }
-    while (file.tellg() != end) {
+    for (const auto& [offset, header] : entries) {
         if (stop_loading.stop_requested()) {
             return;
         }
-        u32 num_envs{};
-        file.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
-        std::vector<FileEnvironment> envs(num_envs);
-        for (FileEnvironment& env : envs) {
-            env.Deserialize(file);
-        }
-        if (envs.front().ShaderStage() == Shader::Stage::Compute) {
-            load_compute(file, std::move(envs.front()));
+        const u8* const key_data{file->Data().data() + offset + sizeof(header)};
+        const u8* const payload_data{key_data + header.key_size};
+        CachedPipeline pipeline(file, PipelineUsageRecord{.usage = header.usage, .offset = offset},
+                                header.num_envs, std::span(key_data, header.key_size),
+                                std::span(payload_data, header.compressed_size),
+                                header.uncompressed_size);
+        if (header.stage == Shader::Stage::Compute) {
+            load_compute(std::move(pipeline));
         } else {
-            load_graphics(file, std::move(envs));
+            load_graphics(std::move(pipeline));
         }
     }
+}
 
-} catch (const std::ios_base::failure& e) {
-    LOG_ERROR(Common_Filesystem, "{}", e.what());
-    if (!Common::FS::RemoveFile(filename)) {
-        LOG_ERROR(Common_Filesystem, "Failed to delete pipeline cache file {}",
-                  Common::FS::PathToUTF8String(filename));
+void UpdatePipelineUsage(const std::filesystem::path& filename,
+                         std::span<const PipelineUsageRecord> records) try {
+    const Common::FS::FileLock lock{Common::FS::FileLock::LockPathFor(filename),
+                                    Common::FS::FileLockMode::Exclusive};
+    std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+    if (!file.is_open()) {
+        return;
     }
+    file.exceptions(std::ifstream::failbit);
+    for (const PipelineUsageRecord& record : records) {
+        file.seekp(static_cast<std::streamoff>(record.offset))
+            .write(reinterpret_cast<const char*>(&record.usage), sizeof(record.usage));
+    }
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "Failed to update pipeline usage: {}", e.what());
 }
 
 } // namespace VideoCommon
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <cstring>
 #include <filesystem>
 #include <iosfwd>
 #include <limits>
@@ -20,6 +21,10 @@
 #include "shader_recompiler/environment.h"
 #include "video_core/engines/maxwell_3d.h"
 
+namespace Common::FS {
+class MappedFile;
+}
+
 namespace Tegra {
 class Memorymanager;
 }
@@ -60,7 +65,7 @@ public:
 
     void Dump(u64 pipeline_hash, u64 shader_hash) override;
 
-    void Serialize(std::ofstream& file) const;
+    void Serialize(std::ostream& file) const;
 
     bool HasHLEMacroState() const override {
         return has_hle_engine_state;
@@ -165,7 +170,7 @@ public:
     FileEnvironment& operator=(const FileEnvironment&) = delete;
     FileEnvironment(const FileEnvironment&) = delete;
 
-    void Deserialize(std::ifstream& file);
+    void Deserialize(std::istream& file);
 
     [[nodiscard]] u64 ReadInstruction(u32 address) override;
 
@@ -212,21 +217,87 @@ private:
     u32 viewport_transform_state = 1;
 };
 
+/// Usage statistics stored in front of each pipeline in the pipeline cache file
+struct PipelineUsage {
+    u64 first_use_ms; ///< Earliest time after boot a session needed the pipeline, in milliseconds
+    u32 use_count;    ///< Number of sessions that needed the pipeline
+    u32 padding;
+};
+
+/// Usage statistics of a pipeline and their position in the pipeline cache file
+struct PipelineUsageRecord {
+    PipelineUsage usage;
+    u64 offset;
+};
+
 void SerializePipeline(std::span<const char> key, std::span<const GenericEnvironment* const> envs,
-                       const std::filesystem::path& filename, u32 cache_version);
+                       const std::filesystem::path& filename, u32 cache_version,
+                       const PipelineUsage& usage);
 
 template <typename Key, typename Envs>
 void SerializePipeline(const Key& key, const Envs& envs, const std::filesystem::path& filename,
-                       u32 cache_version) {
+                       u32 cache_version, const PipelineUsage& usage) {
     static_assert(std::is_trivially_copyable_v<Key>);
     static_assert(std::has_unique_object_representations_v<Key>);
     SerializePipeline(std::span(reinterpret_cast<const char*>(&key), sizeof(key)),
-                      std::span(envs.data(), envs.size()), filename, cache_version);
+                      std::span(envs.data(), envs.size()), filename, cache_version, usage);
 }
 
-void LoadPipelines(
-    std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics);
+/// Pipeline of a memory mapped pipeline cache file.
+/// The key and usage are read straight from the record index, environments are only decompressed
+/// when the pipeline is built. Keeps the file mapped while it's alive.
+class CachedPipeline {
+public:
+    explicit CachedPipeline(std::shared_ptr<const Common::FS::MappedFile> file_,
+                            const PipelineUsageRecord& record_, u32 num_envs_,
+                            std::span<const u8> key_, std::span<const u8> payload_,
+                            u64 uncompressed_size_)
+        : file{std::move(file_)}, record{record_}, num_envs{num_envs_}, key{key_},
+          payload{payload_}, uncompressed_size{uncompressed_size_} {}
+
+    /// Returns the pipeline key, or nothing when its size does not match
+    template <typename Key>
+    [[nodiscard]] std::optional<Key> ReadKey() const {
+        static_assert(std::is_trivially_copyable_v<Key>);
+        if (key.size() != sizeof(Key)) {
+            return std::nullopt;
+        }
+        Key result;
+        std::memcpy(&result, key.data(), sizeof(Key));
+        return result;
+    }
+
+    [[nodiscard]] const PipelineUsageRecord& Record() const noexcept {
+        return record;
+    }
+
+    /// Decompresses the shader environments of the pipeline.
+    /// @returns The environments in stage order, or an empty vector when the record is corrupted
+    [[nodiscard]] std::vector<FileEnvironment> Environments() const;
+
+    /// Decompresses the serialized environments without parsing them
+    /// @returns The environments data, or an empty vector when the record is corrupted
+    [[nodiscard]] std::vector<u8> EnvironmentsData() const;
+
+private:
+    std::shared_ptr<const Common::FS::MappedFile> file;
+    PipelineUsageRecord record;
+    u32 num_envs;
+    std::span<const u8> key;
+    std::span<const u8> payload;
+    u64 uncompressed_size;
+};
+
+/// Returns the cache version of a pipeline cache file, or nothing when it isn't one
+[[nodiscard]] std::optional<u32> ReadPipelineCacheVersion(const std::filesystem::path& filename);
+
+void LoadPipelines(std::stop_token stop_loading, const std::filesystem::path& filename,
+                   u32 expected_cache_version,
+                   Common::UniqueFunction<void, CachedPipeline> load_compute,
+                   Common::UniqueFunction<void, CachedPipeline> load_graphics);
+
+/// Rewrites the usage statistics of pipelines already in the pipeline cache file
+void UpdatePipelineUsage(const std::filesystem::path& filename,
+                         std::span<const PipelineUsageRecord> records);
 
 } // namespace VideoCommon
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 
@@ -31,4 +32,47 @@ int ShaderNotify::ShadersBuilding() noexcept {
     return now_building - report_base;
 }
 
+void ShaderNotify::MarkShaderComplete(ShaderBuildQueue queue,
+                                      std::chrono::steady_clock::time_point queue_time) {
+    const auto latency = std::chrono::steady_clock::now() - queue_time;
+    const u64 latency_us =
+        static_cast<u64>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    const size_t index = static_cast<size_t>(queue);
+    {
+        std::scoped_lock lock{build_stats_mutex};
+        ++build_stats.completed[index];
+        build_stats.total_latency_us[index] += latency_us;
+        build_stats.max_latency_us[index] = std::max(build_stats.max_latency_us[index], latency_us);
+        const auto& buckets = ShaderBuildStats::LATENCY_BUCKETS_MS;
+        const auto bucket = std::ranges::lower_bound(buckets, (latency_us + 999) / 1000);
+        ++build_stats.latency_histogram[static_cast<size_t>(bucket - buckets.begin())];
+    }
+    if (queue == ShaderBuildQueue::Blocking) {
+        MarkStall(latency);
+    }
+    pending[index].fetch_sub(1, std::memory_order::relaxed);
+    ++num_complete;
+}
+
+ShaderBuildStats ShaderNotify::GetBuildStats() const {
+    ShaderBuildStats stats;
+    {
+        std::scoped_lock lock{build_stats_mutex};
+        stats = build_stats;
+    }
+    for (size_t index = 0; index < stats.pending.size(); ++index) {
+        stats.pending[index] = pending[index].load(std::memory_order::relaxed);
+    }
+    stats.skipped_draws = num_skipped_draws.load(std::memory_order::relaxed);
+    stats.stall_time_us = stall_time_us.load(std::memory_order::relaxed);
+    return stats;
+}
+
+void ShaderNotify::ResetBuildStats() {
+    std::scoped_lock lock{build_stats_mutex};
+    build_stats = {};
+    num_skipped_draws.store(0, std::memory_order::relaxed);
+    stall_time_us.store(0, std::memory_order::relaxed);
+}
+
 } // namespace VideoCore
@@ -3,25 +3,100 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <mutex>
+
+#include "common/common_types.h"
 
 namespace VideoCore {
+
+/// Where a pipeline is built, which decides whether drawing waits for it
+enum class ShaderBuildQueue : u32 {
+    Blocking, ///< Built by the thread recording the draws, which waits for it
+    Worker,   ///< Built by the shader workers while drawing goes on
+    MaxValue,
+};
+
+/// Pipeline build counters, read by the frontends to quantify compilation stutter
+struct ShaderBuildStats {
+    static constexpr size_t NUM_QUEUES = static_cast<size_t>(ShaderBuildQueue::MaxValue);
+    /// Upper bounds of the latency histogram buckets in milliseconds, the last bucket is unbounded
+    static constexpr std::array<u64, 6> LATENCY_BUCKETS_MS{1, 4, 16, 64, 256, 1024};
+
+    std::array<u64, NUM_QUEUES> pending{};          ///< Builds queued or running
+    std::array<u64, NUM_QUEUES> completed{};        ///< Builds finished
+    std::array<u64, NUM_QUEUES> total_latency_us{}; ///< Sum of the times from queueing to ready
+    std::array<u64, NUM_QUEUES> max_latency_us{};   ///< Longest time from queueing to ready
+    std::array<u64, LATENCY_BUCKETS_MS.size() + 1> latency_histogram{};
+    u64 skipped_draws{}; ///< Draws dropped because their pipeline was still being built
+    u64 stall_time_us{}; ///< Time drawing waited for pipelines, blocking builds included
+};
+
 class ShaderNotify {
 public:
     [[nodiscard]] int ShadersBuilding() noexcept;
 
-    void MarkShaderComplete() noexcept {
-        ++num_complete;
+    /// Returns the number of shader pipelines built during the session
+    [[nodiscard]] int ShadersBuilt() const noexcept {
+        return num_complete.load(std::memory_order::relaxed);
     }
 
-    void MarkShaderBuilding() noexcept {
+    /// Counts a pipeline build finished, queue_time is when it was passed to MarkShaderBuilding
+    void MarkShaderComplete(ShaderBuildQueue queue,
+                            std::chrono::steady_clock::time_point queue_time);
+
+    void MarkShaderBuilding(ShaderBuildQueue queue) noexcept {
         ++num_building;
+        pending[static_cast<size_t>(queue)].fetch_add(1, std::memory_order::relaxed);
+    }
+
+    /// Counts a draw skipped because its pipeline is built asynchronously and isn't ready
+    void MarkDrawSkipped() noexcept {
+        num_skipped_draws.fetch_add(1, std::memory_order::relaxed);
+    }
+
+    /// Adds the time drawing waited for a pipeline to be built
+    void MarkStall(std::chrono::nanoseconds time) noexcept {
+        stall_time_us.fetch_add(
+            static_cast<u64>(std::chrono::duration_cast<std::chrono::microseconds>(time).count()),
+            std::memory_order::relaxed);
+    }
+
+    /// Returns the pipeline build counters
+    [[nodiscard]] ShaderBuildStats GetBuildStats() const;
+
+    /// Clears the counters of finished builds, skipped draws and stalls, pending builds are kept
+    void ResetBuildStats();
+
+    [[nodiscard]] u64 TranscodeHits() const noexcept {
+        return num_transcode_hits.load(std::memory_order::relaxed);
+    }
+
+    [[nodiscard]] u64 TranscodeMisses() const noexcept {
+        return num_transcode_misses.load(std::memory_order::relaxed);
+    }
+
+    void MarkTranscodeHit() noexcept {
+        num_transcode_hits.fetch_add(1, std::memory_order::relaxed);
+    }
+
+    void MarkTranscodeMiss() noexcept {
+        num_transcode_misses.fetch_add(1, std::memory_order::relaxed);
     }
 
 private:
     std::atomic_int num_building{};
     std::atomic_int num_complete{};
+    std::atomic<u64> num_transcode_hits{};
+    std::atomic<u64> num_transcode_misses{};
+    std::array<std::atomic<u64>, ShaderBuildStats::NUM_QUEUES> pending{};
+    std::atomic<u64> num_skipped_draws{};
+    std::atomic<u64> stall_time_us{};
+
+    mutable std::mutex build_stats_mutex;
+    ShaderBuildStats build_stats{};
     int report_base{};
 
     bool completed{};
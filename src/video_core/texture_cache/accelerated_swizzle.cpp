@@ -7,6 +7,7 @@
 #include "common/alignment.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "video_core/engines/maxwell_dma.h"
 #include "video_core/surface.h"
 #include "video_core/texture_cache/accelerated_swizzle.h"
 #include "video_core/texture_cache/util.h"
@@ -20,6 +21,17 @@ using Tegra::Texture::GOB_SIZE_X_SHIFT;
 using Tegra::Texture::GOB_SIZE_Y_SHIFT;
 using VideoCore::Surface::BytesPerBlock;
 
+namespace {
+std::array<u32, 4> MakeDmaLayout(const Tegra::DMA::LayoutOperand& operand, u32 base_offset) {
+    if (!operand.block_linear) {
+        return {base_offset, operand.pitch, 0, 0};
+    }
+    const u32 gobs_in_x = Common::DivCeilLog2(operand.width, GOB_SIZE_X_SHIFT);
+    const u32 x_shift = GOB_SIZE_SHIFT + operand.block_height + operand.block_depth;
+    return {base_offset, gobs_in_x << x_shift, operand.block_height, x_shift};
+}
+} // Anonymous namespace
+
 BlockLinearSwizzle2DParams MakeBlockLinearSwizzle2DParams(const SwizzleParameters& swizzle,
                                                           const ImageInfo& info) {
     const Extent3D block = swizzle.block;
@@ -66,4 +78,14 @@ BlockLinearSwizzle3DParams MakeBlockLinearSwizzle3DParams(const SwizzleParameter
     };
 }
 
+DmaLayoutCopyParams MakeDmaLayoutCopyParams(const Tegra::DMA::LayoutCopy& copy,
+                                            u32 src_base_offset, u32 dst_base_offset) {
+    return DmaLayoutCopyParams{
+        .src_layout = MakeDmaLayout(copy.src, src_base_offset),
+        .dst_layout = MakeDmaLayout(copy.dst, dst_base_offset),
+        .origins{copy.src.origin_x, copy.src.origin_y, copy.dst.origin_x, copy.dst.origin_y},
+        .extent{copy.line_length / 4, copy.line_count},
+    };
+}
+
 } // namespace VideoCommon::Accelerated
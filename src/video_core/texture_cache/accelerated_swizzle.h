@@ -9,6 +9,10 @@
 #include "video_core/texture_cache/image_info.h"
 #include "video_core/texture_cache/types.h"
 
+namespace Tegra::DMA {
+struct LayoutCopy;
+}
+
 namespace VideoCommon::Accelerated {
 
 struct BlockLinearSwizzle2DParams {
@@ -35,10 +39,22 @@ struct BlockLinearSwizzle3DParams {
     u32 block_depth_mask;
 };
 
+struct DmaLayoutCopyParams {
+    std::array<u32, 4> src_layout;
+    std::array<u32, 4> dst_layout;
+    std::array<u32, 4> origins;
+    std::array<u32, 2> extent;
+};
+
 [[nodiscard]] BlockLinearSwizzle2DParams MakeBlockLinearSwizzle2DParams(
     const SwizzleParameters& swizzle, const ImageInfo& info);
 
 [[nodiscard]] BlockLinearSwizzle3DParams MakeBlockLinearSwizzle3DParams(
     const SwizzleParameters& swizzle, const ImageInfo& info);
 
+/// Parameters of dma_layout_copy.comp, for operands bound the given bytes before their address
+[[nodiscard]] DmaLayoutCopyParams MakeDmaLayoutCopyParams(const Tegra::DMA::LayoutCopy& copy,
+                                                          u32 src_base_offset,
+                                                          u32 dst_base_offset);
+
 } // namespace VideoCommon::Accelerated
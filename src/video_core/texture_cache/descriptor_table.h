@@ -4,6 +4,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <vector>
 
 #include "common/common_types.h"
@@ -28,11 +29,25 @@ public:
         std::ranges::fill(read_descriptors, 0);
     }
 
+    /// Forgets the host pointer to the table if the GPU mapping of the given range changed
+    void InvalidateGpuRange(GPUVAddr gpu_addr, size_t size) noexcept {
+        if (gpu_addr < current_gpu_addr + SizeBytes() && current_gpu_addr < gpu_addr + size) {
+            ResetHostSpan();
+        }
+    }
+
+    /// Forgets the host pointer to the table if the given device memory range was remapped
+    void InvalidateDeviceRange(DAddr device_addr, size_t size) noexcept {
+        if (host_span != nullptr && device_addr < host_span_device_addr + SizeBytes() &&
+            host_span_device_addr < device_addr + size) {
+            ResetHostSpan();
+        }
+    }
+
     [[nodiscard]] std::pair<Descriptor, bool> Read(u32 index) {
         DEBUG_ASSERT(index <= current_limit);
-        const GPUVAddr gpu_addr = current_gpu_addr + index * sizeof(Descriptor);
         std::pair<Descriptor, bool> result;
-        gpu_memory.ReadBlockUnsafe(gpu_addr, &result.first, sizeof(Descriptor));
+        ReadDescriptor(index, result.first);
         if (IsDescriptorRead(index)) {
             result.second = result.first != descriptors[index];
         } else {
@@ -58,6 +73,40 @@ private:
         read_descriptors.clear();
         read_descriptors.resize(Common::DivCeil(num_descriptors, 64U), 0);
         descriptors.resize(num_descriptors);
+        ResetHostSpan();
+    }
+
+    void ReadDescriptor(u32 index, Descriptor& descriptor) {
+        // Translating the address on every read is most of the cost of checking a descriptor, do
+        // it once for the whole table when it is contiguous in host memory.
+        if (!is_host_span_resolved) {
+            ResolveHostSpan();
+        }
+        if (host_span != nullptr) {
+            std::memcpy(&descriptor, host_span + index * sizeof(Descriptor), sizeof(Descriptor));
+            return;
+        }
+        const GPUVAddr gpu_addr = current_gpu_addr + index * sizeof(Descriptor);
+        gpu_memory.ReadBlockUnsafe(gpu_addr, &descriptor, sizeof(Descriptor));
+    }
+
+    void ResolveHostSpan() {
+        is_host_span_resolved = true;
+        const std::optional<DAddr> device_addr = gpu_memory.GpuToCpuAddress(current_gpu_addr);
+        if (!device_addr) {
+            return;
+        }
+        host_span = gpu_memory.GetSpan(current_gpu_addr, SizeBytes());
+        host_span_device_addr = *device_addr;
+    }
+
+    void ResetHostSpan() noexcept {
+        is_host_span_resolved = false;
+        host_span = nullptr;
+    }
+
+    [[nodiscard]] size_t SizeBytes() const noexcept {
+        return (static_cast<size_t>(current_limit) + 1) * sizeof(Descriptor);
     }
 
     void MarkDescriptorAsRead(u32 index) noexcept {
@@ -73,6 +122,9 @@ private:
     u32 current_limit{};
     std::vector<u64> read_descriptors;
     std::vector<Descriptor> descriptors;
+    const u8* host_span{};
+    DAddr host_span_device_addr{};
+    bool is_host_span_resolved{};
 };
 
 } // namespace VideoCommon
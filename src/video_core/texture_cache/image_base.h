@@ -42,6 +42,7 @@ enum class ImageFlagBits : u32 {
 
     AsynchronousDecode = 1 << 16,
     IsDecoding = 1 << 17, ///< Is currently being decoded asynchronously.
+    GpuUsed = 1 << 18,    ///< Has been bound, copied, cleared or blitted since it was created
 };
 DECLARE_ENUM_FLAG_OPERATORS(ImageFlagBits)
 
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "common/hash.h"
+
+namespace VideoCommon {
+
+/**
+ * Maps page indices to the ids registered in them.
+ *
+ * Pages are grouped in chunks allocated on first use. Chunks of the low address space (enough for
+ * 40-bit addresses with the texture cache's 1 MiB pages) are found with a single array index, any
+ * other chunk goes through a hash map. The ids of a page are stored inline for the common case of
+ * a few images per page, so walking a range of pages doesn't hash or chase pointers per page.
+ */
+template <typename Id>
+class ImagePageTable {
+    static constexpr size_t CHUNK_BITS = 10;
+    static constexpr u64 CHUNK_SIZE = 1ULL << CHUNK_BITS;
+    static constexpr u64 CHUNK_MASK = CHUNK_SIZE - 1;
+    static constexpr size_t DIRECT_PAGE_BITS = 20;
+    static constexpr u64 NUM_DIRECT_CHUNKS = 1ULL << (DIRECT_PAGE_BITS - CHUNK_BITS);
+
+public:
+    using Entries = boost::container::small_vector<Id, 4>;
+
+    ImagePageTable() = default;
+
+    ImagePageTable(const ImagePageTable&) = delete;
+    ImagePageTable& operator=(const ImagePageTable&) = delete;
+
+    /// Returns the ids of a page, or nullptr if nothing was ever registered in its chunk
+    [[nodiscard]] Entries* Find(u64 page) noexcept {
+        Chunk* const chunk = FindChunk(page >> CHUNK_BITS);
+        return chunk ? &chunk->pages[page & CHUNK_MASK] : nullptr;
+    }
+
+    [[nodiscard]] const Entries* Find(u64 page) const noexcept {
+        const Chunk* const chunk = FindChunk(page >> CHUNK_BITS);
+        return chunk ? &chunk->pages[page & CHUNK_MASK] : nullptr;
+    }
+
+    /// Returns the ids of a page, allocating its chunk if needed
+    [[nodiscard]] Entries& operator[](u64 page) {
+        const u64 chunk_index = page >> CHUNK_BITS;
+        std::unique_ptr<Chunk>& chunk = chunk_index < NUM_DIRECT_CHUNKS
+                                            ? direct_chunks[chunk_index]
+                                            : far_chunks[chunk_index];
+        if (!chunk) {
+            chunk = std::make_unique<Chunk>();
+        }
+        return chunk->pages[page & CHUNK_MASK];
+    }
+
+    /**
+     * Calls func(page, entries) for every non-empty page in [first_page, last_page] in ascending
+     * order, skipping unallocated chunks. If func returns bool, true stops the iteration.
+     */
+    template <typename Func>
+    void ForEachPage(u64 first_page, u64 last_page, Func&& func) {
+        static constexpr bool RETURNS_BOOL =
+            std::is_same_v<std::invoke_result_t<Func, u64, Entries&>, bool>;
+        for (u64 chunk_index = first_page >> CHUNK_BITS; chunk_index <= last_page >> CHUNK_BITS;
+             ++chunk_index) {
+            Chunk* const chunk = FindChunk(chunk_index);
+            if (!chunk) {
+                continue;
+            }
+            const u64 chunk_base = chunk_index << CHUNK_BITS;
+            const u64 begin = std::max(first_page, chunk_base) & CHUNK_MASK;
+            const u64 end = std::min(last_page, chunk_base | CHUNK_MASK) & CHUNK_MASK;
+            for (u64 offset = begin; offset <= end; ++offset) {
+                Entries& entries = chunk->pages[offset];
+                if (entries.empty()) {
+                    continue;
+                }
+                if constexpr (RETURNS_BOOL) {
+                    if (func(chunk_base | offset, entries)) {
+                        return;
+                    }
+                } else {
+                    func(chunk_base | offset, entries);
+                }
+            }
+        }
+    }
+
+private:
+    struct Chunk {
+        std::array<Entries, CHUNK_SIZE> pages;
+    };
+
+    [[nodiscard]] Chunk* FindChunk(u64 chunk_index) const noexcept {
+        if (chunk_index < NUM_DIRECT_CHUNKS) {
+            return direct_chunks[chunk_index].get();
+        }
+        const auto it = far_chunks.find(chunk_index);
+        return it != far_chunks.end() ? it->second.get() : nullptr;
+    }
+
+    std::array<std::unique_ptr<Chunk>, NUM_DIRECT_CHUNKS> direct_chunks{};
+    std::unordered_map<u64, std::unique_ptr<Chunk>, Common::IdentityHash<u64>> far_chunks;
+};
+
+} // namespace VideoCommon
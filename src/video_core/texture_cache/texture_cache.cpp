@@ -10,6 +10,21 @@ TextureCacheChannelInfo::TextureCacheChannelInfo(Tegra::Control::ChannelState& s
     : ChannelInfo(state), graphics_image_table{gpu_memory}, graphics_sampler_table{gpu_memory},
       compute_image_table{gpu_memory}, compute_sampler_table{gpu_memory} {}
 
+void TextureCacheChannelInfo::InvalidateDescriptorTables(DAddr device_addr, size_t size) noexcept {
+    graphics_image_table.InvalidateDeviceRange(device_addr, size);
+    graphics_sampler_table.InvalidateDeviceRange(device_addr, size);
+    compute_image_table.InvalidateDeviceRange(device_addr, size);
+    compute_sampler_table.InvalidateDeviceRange(device_addr, size);
+}
+
+void TextureCacheChannelInfo::InvalidateDescriptorTablesGPU(GPUVAddr gpu_addr,
+                                                            size_t size) noexcept {
+    graphics_image_table.InvalidateGpuRange(gpu_addr, size);
+    graphics_sampler_table.InvalidateGpuRange(gpu_addr, size);
+    compute_image_table.InvalidateGpuRange(gpu_addr, size);
+    compute_sampler_table.InvalidateGpuRange(gpu_addr, size);
+}
+
 template class VideoCommon::ChannelSetupCaches<VideoCommon::TextureCacheChannelInfo>;
 
 } // namespace VideoCommon
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <chrono>
 #include <unordered_set>
+#include <utility>
 #include <boost/container/small_vector.hpp>
 
 #include "common/alignment.h"
@@ -13,6 +15,8 @@
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/guest_memory.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/memory_budget.h"
+#include "video_core/memory_stats.h"
 #include "video_core/texture_cache/image_view_base.h"
 #include "video_core/texture_cache/samples_helper.h"
 #include "video_core/texture_cache/texture_cache_base.h"
@@ -28,8 +32,11 @@ using VideoCore::Surface::SurfaceType;
 using namespace Common::Literals;
 
 template <class P>
-TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManager& device_memory_)
-    : runtime{runtime_}, device_memory{device_memory_} {
+TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManager& device_memory_,
+                              VideoCore::MemoryStats& memory_stats_,
+                              VideoCore::MemoryBudget& global_budget_, TextureCacheStats& stats_)
+    : runtime{runtime_}, device_memory{device_memory_}, memory_stats{memory_stats_},
+      global_budget{global_budget_}, stats{stats_} {
     // Configure null sampler
     TSCEntry sampler_descriptor{};
     sampler_descriptor.min_filter.Assign(Tegra::Texture::TextureFilter::Linear);
@@ -50,45 +57,74 @@ TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManag
     void(slot_samplers.insert(runtime, sampler_descriptor));
 
     if constexpr (HAS_DEVICE_MEMORY_INFO) {
-        const s64 device_local_memory = static_cast<s64>(runtime.GetDeviceLocalMemory());
-        const s64 min_spacing_expected = device_local_memory - 1_GiB;
-        const s64 min_spacing_critical = device_local_memory - 512_MiB;
-        const s64 mem_threshold = std::min(device_local_memory, TARGET_THRESHOLD);
-        const s64 min_vacancy_expected = (6 * mem_threshold) / 10;
-        const s64 min_vacancy_critical = (2 * mem_threshold) / 10;
-        expected_memory = static_cast<u64>(
-            std::max(std::min(device_local_memory - min_vacancy_expected, min_spacing_expected),
-                     DEFAULT_EXPECTED_MEMORY));
-        critical_memory = static_cast<u64>(
-            std::max(std::min(device_local_memory - min_vacancy_critical, min_spacing_critical),
-                     DEFAULT_CRITICAL_MEMORY));
-        minimum_memory = static_cast<u64>((device_local_memory - mem_threshold) / 2);
+        ConfigureMemoryThresholds(runtime.GetDeviceLocalMemory());
     } else {
         expected_memory = DEFAULT_EXPECTED_MEMORY + 512_MiB;
         critical_memory = DEFAULT_CRITICAL_MEMORY + 1_GiB;
         minimum_memory = 0;
+        memory_budget = critical_memory;
+        global_budget.SetTarget(critical_memory);
     }
 }
 
 template <class P>
-void TextureCache<P>::RunGarbageCollector() {
+void TextureCache<P>::ConfigureMemoryThresholds(u64 budget) {
+    memory_budget = budget;
+    const s64 device_local_memory = static_cast<s64>(budget);
+    const s64 min_spacing_expected = device_local_memory - 1_GiB;
+    const s64 min_spacing_critical = device_local_memory - 512_MiB;
+    const s64 mem_threshold = std::min(device_local_memory, TARGET_THRESHOLD);
+    const s64 min_vacancy_expected = (6 * mem_threshold) / 10;
+    const s64 min_vacancy_critical = (2 * mem_threshold) / 10;
+    expected_memory = static_cast<u64>(
+        std::max(std::min(device_local_memory - min_vacancy_expected, min_spacing_expected),
+                 DEFAULT_EXPECTED_MEMORY));
+    critical_memory = static_cast<u64>(
+        std::max(std::min(device_local_memory - min_vacancy_critical, min_spacing_critical),
+                 DEFAULT_CRITICAL_MEMORY));
+    minimum_memory = static_cast<u64>((device_local_memory - mem_threshold) / 2);
+    // Images are most of the footprint, the other caches are fit under the same threshold
+    global_budget.SetTarget(critical_memory);
+}
+
+template <class P>
+size_t TextureCache<P>::EvictionScale() const noexcept {
+    // Ramp up from the regular amount at the expected threshold to four times as much at the
+    // budget, and evict hard once the budget is exceeded
+    if (total_used_memory >= memory_budget) {
+        return 8;
+    }
+    if (total_used_memory <= expected_memory) {
+        return 1;
+    }
+    const u64 window = memory_budget - expected_memory;
+    return 1 + static_cast<size_t>((3 * (total_used_memory - expected_memory)) / window);
+}
+
+template <class P>
+void TextureCache<P>::RunGarbageCollector(u64 budget_share) {
     bool high_priority_mode = false;
     bool aggressive_mode = false;
     u64 ticks_to_destroy = 0;
     size_t num_iterations = 0;
+    u64 freed_memory = 0;
 
     const auto Configure = [&](bool allow_aggressive) {
         high_priority_mode = total_used_memory >= expected_memory;
         aggressive_mode = allow_aggressive && total_used_memory >= critical_memory;
         ticks_to_destroy = aggressive_mode ? 10ULL : high_priority_mode ? 25ULL : 50ULL;
-        num_iterations = aggressive_mode ? 40 : (high_priority_mode ? 20 : 10);
+        num_iterations = (aggressive_mode ? 40 : (high_priority_mode ? 20 : 10)) * EvictionScale();
     };
-    const auto Cleanup = [this, &num_iterations, &high_priority_mode,
-                          &aggressive_mode](ImageId image_id) {
+    const auto Cleanup = [this, &num_iterations, &high_priority_mode, &aggressive_mode,
+                          &freed_memory, budget_share](ImageId image_id) {
         if (num_iterations == 0) {
-            return true;
+            // Keep going while the shared budget still expects memory back from this cache
+            if (freed_memory >= budget_share) {
+                return true;
+            }
+        } else {
+            --num_iterations;
         }
-        --num_iterations;
         auto& image = slot_images[image_id];
         if (True(image.flags & ImageFlagBits::IsDecoding)) {
             // This image is still being decoded, deleting it will invalidate the slot
@@ -110,12 +146,17 @@ void TextureCache<P>::RunGarbageCollector() {
             runtime.Finish();
             SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, map.mapped_span,
                          swizzle_data_buffer);
+            frame_stats.bytes_downloaded += image.unswizzled_size_bytes;
         }
         if (True(image.flags & ImageFlagBits::Tracked)) {
             UntrackImage(image, image_id);
         }
+        const u64 resident_memory_before = resident_memory;
         UnregisterImage(image_id);
         DeleteImage(image_id, image.scale_tick > frame_tick + 5);
+        freed_memory += resident_memory_before - resident_memory;
+        memory_stats.MarkEviction(resident_memory_before - resident_memory);
+        ++frame_stats.images_collected;
         if (total_used_memory < critical_memory) {
             if (aggressive_mode) {
                 // Sink the aggresiveness.
@@ -142,14 +183,38 @@ void TextureCache<P>::RunGarbageCollector() {
     }
 }
 
+template <class P>
+void TextureCache<P>::LoadDiskResources(u64 title_id, VideoCore::ShaderNotify& shader_notify) {
+    transcode_cache.Open(title_id, shader_notify);
+}
+
 template <class P>
 void TextureCache<P>::TickFrame() {
     // If we can obtain the memory info, use it instead of the estimate.
     if (runtime.CanReportMemoryUsage()) {
         total_used_memory = runtime.GetDeviceMemoryUsage();
+        if constexpr (HAS_DEVICE_MEMORY_INFO) {
+            // Other processes and shared memory devices move the budget while running
+            const u64 budget = runtime.GetDeviceMemoryBudget();
+            if (budget != memory_budget) {
+                ConfigureMemoryThresholds(budget);
+            }
+        }
+    }
+    if constexpr (HAS_SPARSE_RESIDENCY) {
+        // Unmaps are notified page by page, release the memory of whole images at once
+        for (const auto& [image_id, as_id] : sparse_residency_updates) {
+            UpdateSparseResidency(slot_images[image_id], *GetFromID(as_id), false);
+        }
+        sparse_residency_updates.clear();
     }
-    if (total_used_memory > minimum_memory) {
-        RunGarbageCollector();
+    memory_stats.UpdateBudget(memory_budget, total_used_memory);
+    const u64 lru_age = frame_tick - lru_cache.OldestTick().value_or(frame_tick);
+    global_budget.Report(VideoCore::MemoryBudgetClient::TextureCache, resident_memory, lru_age);
+    const u64 budget_share =
+        global_budget.EvictionShare(VideoCore::MemoryBudgetClient::TextureCache);
+    if (total_used_memory > minimum_memory || budget_share != 0) {
+        RunGarbageCollector(budget_share);
     }
     sentenced_images.Tick();
     sentenced_framebuffers.Tick();
@@ -159,12 +224,22 @@ void TextureCache<P>::TickFrame() {
     runtime.TickFrame();
     ++frame_tick;
 
+    frame_stats.frames = 1;
+    stats.ReportFrame(frame_stats);
+    last_frame_stats = std::exchange(frame_stats, {});
+
     if constexpr (IMPLEMENTS_ASYNC_DOWNLOADS) {
         for (auto& buffer : async_buffers_death_ring) {
             runtime.FreeDeferredStagingBuffer(buffer);
         }
         async_buffers_death_ring.clear();
     }
+    frame_arena.Reset();
+}
+
+template <class P>
+const typename P::Image& TextureCache<P>::GetImage(ImageId id) const noexcept {
+    return slot_images[id];
 }
 
 template <class P>
@@ -192,8 +267,12 @@ void TextureCache<P>::MarkModification(ImageId id) noexcept {
 template <class P>
 template <bool has_blacklists>
 void TextureCache<P>::FillGraphicsImageViews(std::span<ImageViewInOut> views) {
+    const auto start_time = std::chrono::steady_clock::now();
     FillImageViews<has_blacklists>(channel_state->graphics_image_table,
                                    channel_state->graphics_image_view_ids, views);
+    const auto elapsed = std::chrono::steady_clock::now() - start_time;
+    frame_stats.fill_image_views_ns += static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
 }
 
 template <class P>
@@ -370,7 +449,7 @@ bool TextureCache<P>::RescaleRenderTargets() {
         }
         check_rescale(render_targets.depth_buffer_id, tmp_depth_image);
 
-        if (can_rescale) {
+        if (can_rescale && rescaling_allowed) {
             rescaled = any_rescaled || scale_rating >= 2;
             const auto scale_up = [this](ImageId image_id) {
                 if (image_id != CORRUPT_ID) {
@@ -540,6 +619,10 @@ void TextureCache<P>::WriteMemory(DAddr cpu_addr, size_t size) {
             UntrackImage(image, image_id);
         }
     });
+    // Device memory unmaps are notified as writes
+    for (size_t c : active_channel_ids) {
+        channel_storage[c].InvalidateDescriptorTables(cpu_addr, size);
+    }
 }
 
 template <class P>
@@ -566,6 +649,7 @@ void TextureCache<P>::DownloadMemory(DAddr cpu_addr, size_t size) {
         runtime.Finish();
         SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, map.mapped_span,
                      swizzle_data_buffer);
+        frame_stats.bytes_downloaded += image.unswizzled_size_bytes;
     }
 }
 
@@ -607,10 +691,19 @@ void TextureCache<P>::UnmapMemory(DAddr cpu_addr, size_t size) {
         UnregisterImage(id);
         DeleteImage(id);
     }
+    for (size_t c : active_channel_ids) {
+        channel_storage[c].InvalidateDescriptorTables(cpu_addr, size);
+    }
 }
 
 template <class P>
 void TextureCache<P>::UnmapGPUMemory(size_t as_id, GPUVAddr gpu_addr, size_t size) {
+    for (size_t c : active_channel_ids) {
+        auto& channel_info = channel_storage[c];
+        if (channel_info.gpu_memory.GetID() == as_id) {
+            channel_info.InvalidateDescriptorTablesGPU(gpu_addr, size);
+        }
+    }
     boost::container::small_vector<ImageId, 16> deleted_images;
     ForEachImageInRegionGPU(as_id, gpu_addr, size,
                             [&](ImageId id, Image&) { deleted_images.push_back(id); });
@@ -622,6 +715,11 @@ void TextureCache<P>::UnmapGPUMemory(size_t as_id, GPUVAddr gpu_addr, size_t siz
                 UntrackImage(image, id);
             }
         }
+        if constexpr (HAS_SPARSE_RESIDENCY) {
+            if (image.IsSparseResident()) {
+                sparse_residency_updates.emplace(id, as_id);
+            }
+        }
 
         if (True(image.flags & ImageFlagBits::Remapped)) {
             continue;
@@ -732,13 +830,12 @@ template <class P>
 std::pair<typename P::ImageView*, bool> TextureCache<P>::TryFindFramebufferImageView(
     const Tegra::FramebufferConfig& config, DAddr cpu_addr) {
     // TODO: Properly implement this
-    const auto it = page_table.find(cpu_addr >> YUZU_PAGEBITS);
-    if (it == page_table.end()) {
+    const auto* const image_map_ids = page_table.Find(cpu_addr >> YUZU_PAGEBITS);
+    if (!image_map_ids) {
         return {};
     }
-    const auto& image_map_ids = it->second;
     boost::container::small_vector<ImageId, 4> valid_image_ids;
-    for (const ImageMapId map_id : image_map_ids) {
+    for (const ImageMapId map_id : *image_map_ids) {
         const ImageMapView& map = slot_map_views[map_id];
         const ImageBase& image = slot_images[map.image_id];
         if (image.cpu_addr != cpu_addr) {
@@ -829,6 +926,7 @@ void TextureCache<P>::CommitAsyncFlushes() {
                     const auto copies = FullDownloadCopies(image.info);
                     image.DownloadMemory(download_map, copies);
                     download_map.offset += Common::AlignUp(image.unswizzled_size_bytes, 64);
+                    frame_stats.bytes_downloaded += image.unswizzled_size_bytes;
                 }
             }
             uncommitted_async_buffers.emplace_back(download_map);
@@ -901,6 +999,7 @@ void TextureCache<P>::PopAsyncFlushes() {
             const auto copies = FullDownloadCopies(image.info);
             image.DownloadMemory(download_map, copies);
             download_map.offset += image.unswizzled_size_bytes;
+            frame_stats.bytes_downloaded += image.unswizzled_size_bytes;
         }
         // Wait for downloads to finish
         runtime.Finish();
@@ -954,6 +1053,18 @@ bool TextureCache<P>::IsRescaling() const noexcept {
     return is_rescaling;
 }
 
+template <class P>
+void TextureCache<P>::SetRescalingAllowed(bool allowed) {
+    if (rescaling_allowed == allowed) {
+        return;
+    }
+    rescaling_allowed = allowed;
+    // Looks up the bound render targets again, so they are scaled on the next draw
+    if (maxwell3d) {
+        maxwell3d->dirty.flags[Dirty::RenderTargets] = true;
+    }
+}
+
 template <class P>
 bool TextureCache<P>::IsRescaling(const ImageViewBase& image_view) const noexcept {
     if (image_view.type == ImageViewType::Buffer) {
@@ -976,6 +1087,20 @@ bool TextureCache<P>::IsRegionGpuModified(DAddr addr, size_t size) {
     return is_modified;
 }
 
+template <class P>
+bool TextureCache<P>::HasImagesInRegion(GPUVAddr gpu_addr, size_t size) {
+    const std::optional<DAddr> device_addr = gpu_memory->GpuToCpuAddress(gpu_addr);
+    if (!device_addr) {
+        return false;
+    }
+    bool has_images = false;
+    ForEachImageInRegion(*device_addr, size, [&has_images](ImageId, ImageBase&) {
+        has_images = true;
+        return true;
+    });
+    return has_images;
+}
+
 template <class P>
 std::pair<typename TextureCache<P>::Image*, BufferImageCopy> TextureCache<P>::DmaBufferImageCopy(
     const Tegra::DMA::ImageCopy& copy_info, const Tegra::DMA::BufferOperand& buffer_operand,
@@ -1025,6 +1150,7 @@ void TextureCache<P>::DownloadImageIntoBuffer(typename TextureCache<P>::Image* i
                                               size_t buffer_offset,
                                               std::span<const VideoCommon::BufferImageCopy> copies,
                                               GPUVAddr address, size_t size) {
+    frame_stats.bytes_downloaded += size;
     if constexpr (IMPLEMENTS_ASYNC_DOWNLOADS) {
         const BufferDownload new_buffer_download{address, size};
         auto slot = slot_buffer_downloads.insert(new_buffer_download);
@@ -1080,6 +1206,8 @@ void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging)
                               VideoCommon::CacheType::NoTextureCache);
         const auto uploads = FullUploadSwizzles(image.info);
         runtime.AccelerateImageUpload(image, staging, uploads);
+        frame_stats.bytes_uploaded += mapped_span.size_bytes();
+        frame_stats.gpu_decoded_bytes += mapped_span.size_bytes();
         return;
     }
 
@@ -1087,15 +1215,38 @@ void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging)
         *gpu_memory, gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
 
     if (True(image.flags & ImageFlagBits::Converted)) {
+        const bool use_transcode_cache = transcode_cache.ShouldCache(swizzle_data.size());
+        TranscodeCache::Key key{};
+        if (use_transcode_cache) {
+            key = TranscodeCache::MakeKey(image.info, swizzle_data);
+            TranscodeCache::Copies cached_copies;
+            if (transcode_cache.Load(key, mapped_span, cached_copies)) {
+                image.UploadMemory(staging, cached_copies);
+                frame_stats.bytes_uploaded += mapped_span.size_bytes();
+                return;
+            }
+        }
         unswizzle_data_buffer.resize_destructive(image.unswizzled_size_bytes);
         auto copies =
             UnswizzleImage(*gpu_memory, gpu_addr, image.info, swizzle_data, unswizzle_data_buffer);
-        ConvertImage(unswizzle_data_buffer, image.info, mapped_span, copies);
+        const size_t converted_size =
+            ConvertImage(unswizzle_data_buffer, image.info, mapped_span, copies);
+        if (use_transcode_cache) {
+            // Compress and write it from the decode worker, the staging memory is reused
+            const std::span<const u8> converted = mapped_span.first(converted_size);
+            texture_decode_worker.QueueWork(
+                [this, key, copies, data = std::vector<u8>(converted.begin(), converted.end())] {
+                    transcode_cache.Store(key, data, {copies.data(), copies.size()});
+                });
+        }
         image.UploadMemory(staging, copies);
+        frame_stats.bytes_uploaded += converted_size;
+        frame_stats.cpu_decoded_bytes += converted_size;
     } else {
         const auto copies =
             UnswizzleImage(*gpu_memory, gpu_addr, image.info, swizzle_data, mapped_span);
         image.UploadMemory(staging, copies);
+        frame_stats.bytes_uploaded += image.unswizzled_size_bytes;
     }
 }
 
@@ -1287,25 +1438,44 @@ void TextureCache<P>::QueueAsyncDecode(Image& image, ImageId image_id) {
     decode->image_id = image_id;
     async_decodes.push_back(std::move(decode));
 
-    static Common::ScratchBuffer<u8> local_unswizzle_data_buffer;
-    local_unswizzle_data_buffer.resize_destructive(image.unswizzled_size_bytes);
     Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::UnsafeRead> swizzle_data(
         *gpu_memory, image.gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
+    const size_t out_size = MapSizeBytes(image);
 
+    const bool use_transcode_cache = transcode_cache.ShouldCache(swizzle_data.size());
+    TranscodeCache::Key key{};
+    if (use_transcode_cache) {
+        key = TranscodeCache::MakeKey(image.info, swizzle_data);
+    }
+
+    static Common::ScratchBuffer<u8> local_unswizzle_data_buffer;
+    local_unswizzle_data_buffer.resize_destructive(image.unswizzled_size_bytes);
     auto copies = UnswizzleImage(*gpu_memory, image.gpu_addr, image.info, swizzle_data,
                                  local_unswizzle_data_buffer);
-    const size_t out_size = MapSizeBytes(image);
 
-    auto func = [out_size, copies, info = image.info,
+    // Cached conversions are read from disk and decompressed by the worker too, the unswizzled
+    // data is kept in case the entry turns out to be invalid
+    auto func = [this, out_size, copies, key, use_transcode_cache, info = image.info,
                  input = std::move(local_unswizzle_data_buffer),
                  async_decode = decode_ptr]() mutable {
         async_decode->decoded_data.resize_destructive(out_size);
-        std::span copies_span{copies.data(), copies.size()};
-        ConvertImage(input, info, async_decode->decoded_data, copies_span);
+        const bool is_cached =
+            use_transcode_cache && transcode_cache.Load(key, async_decode->decoded_data, copies);
+        if (!is_cached) {
+            std::span copies_span{copies.data(), copies.size()};
+            const size_t converted_size =
+                ConvertImage(input, info, async_decode->decoded_data, copies_span);
+            if (use_transcode_cache) {
+                const std::span<const u8> converted{async_decode->decoded_data.data(),
+                                                    converted_size};
+                transcode_cache.Store(key, converted, copies_span);
+            }
+        }
 
         // TODO: Do we need this lock?
         std::unique_lock lock{async_decode->mutex};
         async_decode->copies = std::move(copies);
+        async_decode->is_converted = !is_cached;
         async_decode->complete = true;
     };
     texture_decode_worker.QueueWork(std::move(func));
@@ -1328,6 +1498,10 @@ void TextureCache<P>::TickAsyncDecode() {
                     async_decode->decoded_data.size());
         image.UploadMemory(staging, async_decode->copies);
         image.flags &= ~ImageFlagBits::IsDecoding;
+        if (async_decode->is_converted) {
+            frame_stats.cpu_decoded_bytes += async_decode->decoded_data.size();
+        }
+        frame_stats.bytes_uploaded += async_decode->decoded_data.size();
         has_uploads = true;
         i = async_decodes.erase(i);
     }
@@ -1344,9 +1518,12 @@ bool TextureCache<P>::ScaleUp(Image& image) {
         return false;
     }
     if (!has_copy) {
-        total_used_memory += GetScaledImageSizeBytes(image);
+        const u64 scaled_size = GetScaledImageSizeBytes(image);
+        total_used_memory += scaled_size;
+        resident_memory += scaled_size;
     }
     InvalidateScale(image);
+    ++frame_stats.rescales;
     return true;
 }
 
@@ -1357,6 +1534,7 @@ bool TextureCache<P>::ScaleDown(Image& image) {
         return false;
     }
     InvalidateScale(image);
+    ++frame_stats.rescales;
     return true;
 }
 
@@ -1483,6 +1661,7 @@ ImageId TextureCache<P>::JoinImages(const ImageInfo& info, GPUVAddr gpu_addr, DA
     }
 
     const ImageId new_image_id = slot_images.insert(runtime, new_info, gpu_addr, cpu_addr);
+    ++frame_stats.images_created;
     Image& new_image = slot_images[new_image_id];
 
     if (!gpu_memory->IsContinuousRange(new_image.gpu_addr, new_image.guest_size_bytes) &&
@@ -1502,6 +1681,12 @@ ImageId TextureCache<P>::JoinImages(const ImageInfo& info, GPUVAddr gpu_addr, DA
         DeleteImage(overlap_id);
     }
 
+    if constexpr (HAS_SPARSE_RESIDENCY) {
+        if (new_image.IsSparseResident()) {
+            UpdateSparseResidency(new_image, *gpu_memory, true);
+        }
+    }
+
     // TODO: Only upload what we need
     RefreshContents(new_image, new_image_id);
 
@@ -1566,7 +1751,7 @@ ImageId TextureCache<P>::JoinImages(const ImageInfo& info, GPUVAddr gpu_addr, DA
             continue;
         }
         if (True(overlap.flags & ImageFlagBits::GpuModified)) {
-            new_image.flags |= ImageFlagBits::GpuModified;
+            new_image.flags |= ImageFlagBits::GpuModified | ImageFlagBits::GpuUsed;
             const auto& resolution = Settings::values.resolution_info;
             const SubresourceBase base = new_image.TryFindBase(overlap.gpu_addr).value();
             const u32 up_scale = can_rescale ? resolution.up_scale : 1;
@@ -1809,18 +1994,11 @@ template <typename Func>
 void TextureCache<P>::ForEachImageInRegion(DAddr cpu_addr, size_t size, Func&& func) {
     using FuncReturn = typename std::invoke_result<Func, ImageId, Image&>::type;
     static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
-    boost::container::small_vector<ImageId, 32> images;
-    boost::container::small_vector<ImageMapId, 32> maps;
-    ForEachCPUPage(cpu_addr, size, [this, &images, &maps, cpu_addr, size, func](u64 page) {
-        const auto it = page_table.find(page);
-        if (it == page_table.end()) {
-            if constexpr (BOOL_BREAK) {
-                return false;
-            } else {
-                return;
-            }
-        }
-        for (const ImageMapId map_id : it->second) {
+    auto images = Common::MakeFrameSmallVector<ImageId, 32>(frame_arena);
+    auto maps = Common::MakeFrameSmallVector<ImageMapId, 32>(frame_arena);
+    const auto visit_page = [this, &images, &maps, cpu_addr, size,
+                                func](u64, ImagePageTable<ImageMapId>::Entries& map_ids) {
+        for (const ImageMapId map_id : map_ids) {
             ImageMapView& map = slot_map_views[map_id];
             if (map.picked) {
                 continue;
@@ -1847,7 +2025,9 @@ void TextureCache<P>::ForEachImageInRegion(DAddr cpu_addr, size_t size, Func&& f
         if constexpr (BOOL_BREAK) {
             return false;
         }
-    });
+    };
+    page_table.ForEachPage(cpu_addr >> YUZU_PAGEBITS, (cpu_addr + size - 1) >> YUZU_PAGEBITS,
+                           visit_page);
     for (const ImageId image_id : images) {
         slot_images[image_id].flags &= ~ImageFlagBits::Picked;
     }
@@ -1862,44 +2042,38 @@ void TextureCache<P>::ForEachImageInRegionGPU(size_t as_id, GPUVAddr gpu_addr, s
                                               Func&& func) {
     using FuncReturn = typename std::invoke_result<Func, ImageId, Image&>::type;
     static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
-    boost::container::small_vector<ImageId, 8> images;
+    auto images = Common::MakeFrameSmallVector<ImageId, 8>(frame_arena);
     auto storage_id = getStorageID(as_id);
     if (!storage_id) {
         return;
     }
     auto& gpu_page_table = gpu_page_table_storage[*storage_id * 2];
-    ForEachGPUPage(gpu_addr, size,
-                   [this, &gpu_page_table, &images, gpu_addr, size, func](u64 page) {
-                       const auto it = gpu_page_table.find(page);
-                       if (it == gpu_page_table.end()) {
-                           if constexpr (BOOL_BREAK) {
-                               return false;
-                           } else {
-                               return;
-                           }
-                       }
-                       for (const ImageId image_id : it->second) {
-                           Image& image = slot_images[image_id];
-                           if (True(image.flags & ImageFlagBits::Picked)) {
-                               continue;
-                           }
-                           if (!image.OverlapsGPU(gpu_addr, size)) {
-                               continue;
-                           }
-                           image.flags |= ImageFlagBits::Picked;
-                           images.push_back(image_id);
-                           if constexpr (BOOL_BREAK) {
-                               if (func(image_id, image)) {
-                                   return true;
-                               }
-                           } else {
-                               func(image_id, image);
-                           }
-                       }
-                       if constexpr (BOOL_BREAK) {
-                           return false;
-                       }
-                   });
+    const auto visit_page = [this, &images, gpu_addr, size,
+                                func](u64, TextureCacheGPUMap::Entries& image_ids) {
+        for (const ImageId image_id : image_ids) {
+            Image& image = slot_images[image_id];
+            if (True(image.flags & ImageFlagBits::Picked)) {
+                continue;
+            }
+            if (!image.OverlapsGPU(gpu_addr, size)) {
+                continue;
+            }
+            image.flags |= ImageFlagBits::Picked;
+            images.push_back(image_id);
+            if constexpr (BOOL_BREAK) {
+                if (func(image_id, image)) {
+                    return true;
+                }
+            } else {
+                func(image_id, image);
+            }
+        }
+        if constexpr (BOOL_BREAK) {
+            return false;
+        }
+    };
+    gpu_page_table.ForEachPage(gpu_addr >> YUZU_PAGEBITS, (gpu_addr + size - 1) >> YUZU_PAGEBITS,
+                               visit_page);
     for (const ImageId image_id : images) {
         slot_images[image_id].flags &= ~ImageFlagBits::Picked;
     }
@@ -1911,44 +2085,38 @@ void TextureCache<P>::ForEachSparseImageInRegion(size_t as_id, GPUVAddr gpu_addr
                                                  Func&& func) {
     using FuncReturn = typename std::invoke_result<Func, ImageId, Image&>::type;
     static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
-    boost::container::small_vector<ImageId, 8> images;
+    auto images = Common::MakeFrameSmallVector<ImageId, 8>(frame_arena);
     auto storage_id = getStorageID(as_id);
     if (!storage_id) {
         return;
     }
     auto& sparse_page_table = gpu_page_table_storage[*storage_id * 2 + 1];
-    ForEachGPUPage(gpu_addr, size,
-                   [this, &sparse_page_table, &images, gpu_addr, size, func](u64 page) {
-                       const auto it = sparse_page_table.find(page);
-                       if (it == sparse_page_table.end()) {
-                           if constexpr (BOOL_BREAK) {
-                               return false;
-                           } else {
-                               return;
-                           }
-                       }
-                       for (const ImageId image_id : it->second) {
-                           Image& image = slot_images[image_id];
-                           if (True(image.flags & ImageFlagBits::Picked)) {
-                               continue;
-                           }
-                           if (!image.OverlapsGPU(gpu_addr, size)) {
-                               continue;
-                           }
-                           image.flags |= ImageFlagBits::Picked;
-                           images.push_back(image_id);
-                           if constexpr (BOOL_BREAK) {
-                               if (func(image_id, image)) {
-                                   return true;
-                               }
-                           } else {
-                               func(image_id, image);
-                           }
-                       }
-                       if constexpr (BOOL_BREAK) {
-                           return false;
-                       }
-                   });
+    const auto visit_page = [this, &images, gpu_addr, size,
+                                func](u64, TextureCacheGPUMap::Entries& image_ids) {
+        for (const ImageId image_id : image_ids) {
+            Image& image = slot_images[image_id];
+            if (True(image.flags & ImageFlagBits::Picked)) {
+                continue;
+            }
+            if (!image.OverlapsGPU(gpu_addr, size)) {
+                continue;
+            }
+            image.flags |= ImageFlagBits::Picked;
+            images.push_back(image_id);
+            if constexpr (BOOL_BREAK) {
+                if (func(image_id, image)) {
+                    return true;
+                }
+            } else {
+                func(image_id, image);
+            }
+        }
+        if constexpr (BOOL_BREAK) {
+            return false;
+        }
+    };
+    sparse_page_table.ForEachPage(gpu_addr >> YUZU_PAGEBITS, (gpu_addr + size - 1) >> YUZU_PAGEBITS,
+                                  visit_page);
     for (const ImageId image_id : images) {
         slot_images[image_id].flags &= ~ImageFlagBits::Picked;
     }
@@ -1998,6 +2166,7 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
         tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
     }
     total_used_memory += Common::AlignUp(tentative_size, 1024);
+    resident_memory += Common::AlignUp(tentative_size, 1024);
     image.lru_index = lru_cache.Insert(image_id, frame_tick);
 
     ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, image_id](u64 page) {
@@ -2034,22 +2203,19 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
     image.flags &= ~ImageFlagBits::BadOverlap;
     lru_cache.Free(image.lru_index);
     const auto& clear_page_table =
-        [image_id](u64 page,
-                   std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>>&
-                       selected_page_table) {
-            const auto page_it = selected_page_table.find(page);
-            if (page_it == selected_page_table.end()) {
+        [image_id](u64 page, TextureCacheGPUMap& selected_page_table) {
+            TextureCacheGPUMap::Entries* const image_ids = selected_page_table.Find(page);
+            if (!image_ids) {
                 ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
                 return;
             }
-            std::vector<ImageId>& image_ids = page_it->second;
-            const auto vector_it = std::ranges::find(image_ids, image_id);
-            if (vector_it == image_ids.end()) {
+            const auto vector_it = std::ranges::find(*image_ids, image_id);
+            if (vector_it == image_ids->end()) {
                 ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
                            page << YUZU_PAGEBITS);
                 return;
             }
-            image_ids.erase(vector_it);
+            image_ids->erase(vector_it);
         };
     ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, &clear_page_table](u64 page) {
         clear_page_table(page, (*channel_state->gpu_page_table));
@@ -2057,19 +2223,18 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
     if (False(image.flags & ImageFlagBits::Sparse)) {
         const auto map_id = image.map_view_id;
         ForEachCPUPage(image.cpu_addr, image.guest_size_bytes, [this, map_id](u64 page) {
-            const auto page_it = page_table.find(page);
-            if (page_it == page_table.end()) {
+            auto* const image_map_ids = page_table.Find(page);
+            if (!image_map_ids) {
                 ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
                 return;
             }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
-            const auto vector_it = std::ranges::find(image_map_ids, map_id);
-            if (vector_it == image_map_ids.end()) {
+            const auto vector_it = std::ranges::find(*image_map_ids, map_id);
+            if (vector_it == image_map_ids->end()) {
                 ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
                            page << YUZU_PAGEBITS);
                 return;
             }
-            image_map_ids.erase(vector_it);
+            image_map_ids->erase(vector_it);
         });
         slot_map_views.erase(map_id);
         return;
@@ -2085,14 +2250,13 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
         const DAddr cpu_addr = map_range.cpu_addr;
         const std::size_t size = map_range.size;
         ForEachCPUPage(cpu_addr, size, [this, image_id](u64 page) {
-            const auto page_it = page_table.find(page);
-            if (page_it == page_table.end()) {
+            auto* const image_map_ids = page_table.Find(page);
+            if (!image_map_ids) {
                 ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
                 return;
             }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
-            auto vector_it = image_map_ids.begin();
-            while (vector_it != image_map_ids.end()) {
+            auto vector_it = image_map_ids->begin();
+            while (vector_it != image_map_ids->end()) {
                 ImageMapView& map = slot_map_views[*vector_it];
                 if (map.image_id != image_id) {
                     vector_it++;
@@ -2101,7 +2265,7 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
                 if (!map.picked) {
                     map.picked = true;
                 }
-                vector_it = image_map_ids.erase(vector_it);
+                vector_it = image_map_ids->erase(vector_it);
             }
         });
         slot_map_views.erase(map_view_id);
@@ -2159,11 +2323,34 @@ void TextureCache<P>::UntrackImage(ImageBase& image, ImageId image_id) {
     }
 }
 
+template <class P>
+void TextureCache<P>::UpdateSparseResidency(Image& image, Tegra::MemoryManager& memory,
+                                            bool allow_commit) {
+    // Explicit instantiations build every member, images without residency have nothing to update
+    if constexpr (HAS_SPARSE_RESIDENCY) {
+        boost::container::small_vector<SubresourceRows, 16> rows;
+        for (const auto& [gpu_addr, size] :
+             memory.GetSubmappedRange(image.gpu_addr, image.guest_size_bytes)) {
+            const u32 offset = static_cast<u32>(gpu_addr - image.gpu_addr);
+            const auto segment_rows =
+                CalculateSubresourceRows(image.info, offset, static_cast<u32>(size));
+            rows.insert(rows.end(), segment_rows.begin(), segment_rows.end());
+        }
+        image.UpdateSparseResidency(rows, allow_commit);
+    }
+}
+
 template <class P>
 void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
     ImageBase& image = slot_images[image_id];
+    ++frame_stats.images_deleted;
+    if constexpr (HAS_SPARSE_RESIDENCY) {
+        sparse_residency_updates.erase(image_id);
+    }
     if (image.HasScaled()) {
-        total_used_memory -= GetScaledImageSizeBytes(image);
+        const u64 scaled_size = GetScaledImageSizeBytes(image);
+        total_used_memory -= scaled_size;
+        resident_memory -= scaled_size;
     }
     u64 tentative_size = std::max(image.guest_size_bytes, image.unswizzled_size_bytes);
     if ((IsPixelFormatASTC(image.info.format) &&
@@ -2172,6 +2359,7 @@ void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
         tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
     }
     total_used_memory -= Common::AlignUp(tentative_size, 1024);
+    resident_memory -= Common::AlignUp(tentative_size, 1024);
     const GPUVAddr gpu_addr = image.gpu_addr;
     const auto alloc_it = image_allocs_table.find(gpu_addr);
     if (alloc_it == image_allocs_table.end()) {
@@ -2308,6 +2496,7 @@ void TextureCache<P>::SynchronizeAliases(ImageId image_id) {
     if (aliased_images.empty()) {
         return;
     }
+    frame_stats.alias_syncs += aliased_images.size();
     const bool can_rescale = ImageCanRescale(image);
     if (any_rescaled) {
         if (can_rescale) {
@@ -2345,6 +2534,7 @@ void TextureCache<P>::SynchronizeAliases(ImageId image_id) {
 template <class P>
 void TextureCache<P>::PrepareImage(ImageId image_id, bool is_modification, bool invalidate) {
     Image& image = slot_images[image_id];
+    image.flags |= ImageFlagBits::GpuUsed;
     if (invalidate) {
         image.flags &= ~(ImageFlagBits::CpuModified | ImageFlagBits::GpuModified);
         if (False(image.flags & ImageFlagBits::Tracked)) {
@@ -2374,15 +2564,22 @@ void TextureCache<P>::PrepareImageView(ImageViewId image_view_id, bool is_modifi
 }
 
 template <class P>
-void TextureCache<P>::CopyImage(ImageId dst_id, ImageId src_id, std::vector<ImageCopy> copies) {
+void TextureCache<P>::CopyImage(ImageId dst_id, ImageId src_id,
+                                std::span<const ImageCopy> copies) {
+    ++frame_stats.image_copies;
     Image& dst = slot_images[dst_id];
     Image& src = slot_images[src_id];
+    dst.flags |= ImageFlagBits::GpuUsed;
+    src.flags |= ImageFlagBits::GpuUsed;
     const bool is_rescaled = True(src.flags & ImageFlagBits::Rescaled);
+    Common::FrameVector<ImageCopy> scaled_copies{Common::FrameAllocator<ImageCopy>{frame_arena}};
     if (is_rescaled) {
         ASSERT(True(dst.flags & ImageFlagBits::Rescaled));
         const bool both_2d{src.info.type == ImageType::e2D && dst.info.type == ImageType::e2D};
         const auto& resolution = Settings::values.resolution_info;
-        for (auto& copy : copies) {
+        scaled_copies.assign(copies.begin(), copies.end());
+        copies = scaled_copies;
+        for (auto& copy : scaled_copies) {
             copy.src_offset.x = resolution.ScaleUp(copy.src_offset.x);
             copy.dst_offset.x = resolution.ScaleUp(copy.dst_offset.x);
             copy.extent.width = resolution.ScaleUp(copy.extent.width);
@@ -16,6 +16,7 @@
 #include <queue>
 
 #include "common/common_types.h"
+#include "common/frame_arena.h"
 #include "common/hash.h"
 #include "common/literals.h"
 #include "common/lru_cache.h"
@@ -31,8 +32,11 @@
 #include "video_core/texture_cache/descriptor_table.h"
 #include "video_core/texture_cache/image_base.h"
 #include "video_core/texture_cache/image_info.h"
+#include "video_core/texture_cache/image_page_table.h"
 #include "video_core/texture_cache/image_view_base.h"
 #include "video_core/texture_cache/render_targets.h"
+#include "video_core/texture_cache/texture_cache_stats.h"
+#include "video_core/texture_cache/transcode_cache.h"
 #include "video_core/texture_cache/types.h"
 #include "video_core/textures/texture.h"
 
@@ -42,6 +46,11 @@ struct ChannelState;
 }
 } // namespace Tegra
 
+namespace VideoCore {
+class MemoryBudget;
+class MemoryStats;
+}
+
 namespace VideoCommon {
 
 using Tegra::Texture::TICEntry;
@@ -61,9 +70,10 @@ struct AsyncDecodeContext {
     boost::container::small_vector<BufferImageCopy, 16> copies;
     std::mutex mutex;
     std::atomic_bool complete;
+    bool is_converted{}; ///< False when the data was read from the transcode cache
 };
 
-using TextureCacheGPUMap = std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>>;
+using TextureCacheGPUMap = ImagePageTable<ImageId>;
 
 class TextureCacheChannelInfo : public ChannelInfo {
 public:
@@ -72,6 +82,12 @@ public:
     TextureCacheChannelInfo(const TextureCacheChannelInfo& state) = delete;
     TextureCacheChannelInfo& operator=(const TextureCacheChannelInfo&) = delete;
 
+    /// Drops the host pointers to the descriptor tables backed by the given device memory range
+    void InvalidateDescriptorTables(DAddr device_addr, size_t size) noexcept;
+
+    /// Drops the host pointers to the descriptor tables mapped in the given GPU memory range
+    void InvalidateDescriptorTablesGPU(GPUVAddr gpu_addr, size_t size) noexcept;
+
     DescriptorTable<TICEntry> graphics_image_table{gpu_memory};
     DescriptorTable<TSCEntry> graphics_sampler_table{gpu_memory};
     std::vector<SamplerId> graphics_sampler_ids;
@@ -104,6 +120,8 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
     static constexpr bool HAS_DEVICE_MEMORY_INFO = P::HAS_DEVICE_MEMORY_INFO;
     /// True when the API can do asynchronous texture downloads.
     static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = P::IMPLEMENTS_ASYNC_DOWNLOADS;
+    /// True when images can be created with memory bound only to their mapped guest memory
+    static constexpr bool HAS_SPARSE_RESIDENCY = P::HAS_SPARSE_RESIDENCY;
 
     static constexpr size_t UNSET_CHANNEL{std::numeric_limits<size_t>::max()};
 
@@ -129,11 +147,23 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
     };
 
 public:
-    explicit TextureCache(Runtime&, Tegra::MaxwellDeviceMemoryManager&);
+    explicit TextureCache(Runtime&, Tegra::MaxwellDeviceMemoryManager&, VideoCore::MemoryStats&,
+                          VideoCore::MemoryBudget&, TextureCacheStats&);
 
     /// Notify the cache that a new frame has been queued
     void TickFrame();
 
+    /// Return the statistics of the last frame, before the latest frame tick
+    [[nodiscard]] const TextureCacheFrameStats& LastFrameStats() const noexcept {
+        return last_frame_stats;
+    }
+
+    /// Open the on-disk cache of CPU converted images for the given title
+    void LoadDiskResources(u64 title_id, VideoCore::ShaderNotify& shader_notify);
+
+    /// Return a constant reference to the given image id
+    [[nodiscard]] const Image& GetImage(ImageId id) const noexcept;
+
     /// Return a constant reference to the given image view id
     [[nodiscard]] const ImageView& GetImageView(ImageViewId id) const noexcept;
 
@@ -240,10 +270,16 @@ public:
     /// Return true when a CPU region is modified from the GPU
     [[nodiscard]] bool IsRegionGpuModified(DAddr addr, size_t size);
 
+    /// Return true when any image overlaps a GPU region
+    [[nodiscard]] bool HasImagesInRegion(GPUVAddr gpu_addr, size_t size);
+
     [[nodiscard]] bool IsRescaling() const noexcept;
 
     [[nodiscard]] bool IsRescaling(const ImageViewBase& image_view) const noexcept;
 
+    /// Allows or forbids scaling up render targets, forbidden ones are scaled down when bound
+    void SetRescalingAllowed(bool allowed);
+
     /// Create channel state.
     void CreateChannel(Tegra::Control::ChannelState& channel) final override;
 
@@ -286,8 +322,14 @@ private:
 
     void OnGPUASRegister(size_t map_id) final override;
 
-    /// Runs the Garbage Collector.
-    void RunGarbageCollector();
+    /// Derives the garbage collection thresholds from the device memory the cache may use
+    void ConfigureMemoryThresholds(u64 budget);
+
+    /// Returns how many times the regular amount of images the garbage collector should evict
+    [[nodiscard]] size_t EvictionScale() const noexcept;
+
+    /// Runs the Garbage Collector, evicting old images until at least budget_share bytes are freed
+    void RunGarbageCollector(u64 budget_share);
 
     /// Fills image_view_ids in the image views in indices
     template <bool has_blacklists>
@@ -382,6 +424,9 @@ private:
     /// Delete image from the cache
     void DeleteImage(ImageId image, bool immediate_delete = false);
 
+    /// Bind device memory to the parts of a sparse resident image that are mapped in memory
+    void UpdateSparseResidency(Image& image, Tegra::MemoryManager& memory, bool allow_commit);
+
     /// Remove image views references from the cache
     void RemoveImageViewReferences(std::span<const ImageViewId> removed_views);
 
@@ -398,7 +443,7 @@ private:
     void PrepareImageView(ImageViewId image_view_id, bool is_modification, bool invalidate);
 
     /// Execute copies from one image to the other, even if they are incompatible
-    void CopyImage(ImageId dst_id, ImageId src_id, std::vector<ImageCopy> copies);
+    void CopyImage(ImageId dst_id, ImageId src_id, std::span<const ImageCopy> copies);
 
     /// Bind an image view as render target, downloading resources preemtively if needed
     void BindRenderTarget(ImageViewId* old_id, ImageViewId new_id);
@@ -425,20 +470,33 @@ private:
     Runtime& runtime;
 
     Tegra::MaxwellDeviceMemoryManager& device_memory;
+    VideoCore::MemoryStats& memory_stats;
+    VideoCore::MemoryBudget& global_budget;
+    TextureCacheStats& stats;
+    TextureCacheFrameStats frame_stats{};
+    TextureCacheFrameStats last_frame_stats{};
+    /// Transient containers of the current frame, reclaimed by TickFrame
+    Common::FrameArena frame_arena;
     std::deque<TextureCacheGPUMap> gpu_page_table_storage;
 
     RenderTargets render_targets;
 
     std::unordered_map<RenderTargets, FramebufferId> framebuffers;
 
-    std::unordered_map<u64, std::vector<ImageMapId>, Common::IdentityHash<u64>> page_table;
+    ImagePageTable<ImageMapId> page_table;
     std::unordered_map<ImageId, boost::container::small_vector<ImageViewId, 16>> sparse_views;
+    /// Sparse resident images unmapped since the last frame, with their address space
+    std::unordered_map<ImageId, size_t> sparse_residency_updates;
 
     DAddr virtual_invalid_space{};
 
     bool has_deleted_images = false;
     bool is_rescaling = false;
+    bool rescaling_allowed = true;
     u64 total_used_memory = 0;
+    /// Bytes held by the images of this cache, total_used_memory is device wide when reported
+    u64 resident_memory = 0;
+    u64 memory_budget = 0;
     u64 minimum_memory;
     u64 expected_memory;
     u64 critical_memory;
@@ -489,6 +547,7 @@ private:
     u64 modification_tick = 0;
     u64 frame_tick = 0;
 
+    TranscodeCache transcode_cache;
     Common::ThreadWorker texture_decode_worker{1, "TextureDecoder"};
     std::vector<std::unique_ptr<AsyncDecodeContext>> async_decodes;
 
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "video_core/texture_cache/texture_cache_stats.h"
+
+namespace VideoCommon {
+
+TextureCacheFrameStats& TextureCacheFrameStats::operator+=(
+    const TextureCacheFrameStats& rhs) noexcept {
+    frames += rhs.frames;
+    images_created += rhs.images_created;
+    images_deleted += rhs.images_deleted;
+    images_collected += rhs.images_collected;
+    bytes_uploaded += rhs.bytes_uploaded;
+    bytes_downloaded += rhs.bytes_downloaded;
+    cpu_decoded_bytes += rhs.cpu_decoded_bytes;
+    gpu_decoded_bytes += rhs.gpu_decoded_bytes;
+    alias_syncs += rhs.alias_syncs;
+    image_copies += rhs.image_copies;
+    rescales += rhs.rescales;
+    fill_image_views_ns += rhs.fill_image_views_ns;
+    return *this;
+}
+
+void TextureCacheStats::OpenDump(u64 program_id) {
+    std::scoped_lock lock{mutex};
+    if (dump_file.is_open()) {
+        return;
+    }
+    const auto base_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::DumpDir)};
+    const auto stats_dir{base_dir / "texture_cache_stats"};
+    if (!Common::FS::CreateDir(base_dir) || !Common::FS::CreateDir(stats_dir)) {
+        LOG_ERROR(Common_Filesystem, "Failed to create texture cache stats directories");
+        return;
+    }
+    const auto name{stats_dir / fmt::format("{:016X}.csv", program_id)};
+    dump_file.open(name, std::ios::out | std::ios::trunc);
+    if (!dump_file) {
+        LOG_ERROR(Common_Filesystem, "Unable to open or create file at {}",
+                  Common::FS::PathToUTF8String(name));
+        return;
+    }
+    dump_file << "frame,images_created,images_deleted,images_collected,bytes_uploaded,"
+                 "bytes_downloaded,cpu_decoded_bytes,gpu_decoded_bytes,alias_syncs,image_copies,"
+                 "rescales,fill_image_views_ns\n";
+}
+
+void TextureCacheStats::ReportFrame(const TextureCacheFrameStats& frame) {
+    std::scoped_lock lock{mutex};
+    accumulated += frame;
+    if (!dump_file.is_open()) {
+        return;
+    }
+    dump_file << fmt::format("{},{},{},{},{},{},{},{},{},{},{},{}\n", dump_frame++,
+                             frame.images_created, frame.images_deleted, frame.images_collected,
+                             frame.bytes_uploaded, frame.bytes_downloaded, frame.cpu_decoded_bytes,
+                             frame.gpu_decoded_bytes, frame.alias_syncs, frame.image_copies,
+                             frame.rescales, frame.fill_image_views_ns);
+}
+
+TextureCacheFrameStats TextureCacheStats::GetAndReset() {
+    std::scoped_lock lock{mutex};
+    return std::exchange(accumulated, {});
+}
+
+} // namespace VideoCommon
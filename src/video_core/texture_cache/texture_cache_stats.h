@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <fstream>
+#include <mutex>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/// Work done by the texture cache, counted from one frame tick to the next
+struct TextureCacheFrameStats {
+    u64 frames;              ///< Number of frames counted
+    u64 images_created;      ///< Images added to the cache
+    u64 images_deleted;      ///< Images removed from the cache, including collected ones
+    u64 images_collected;    ///< Images removed by the garbage collector
+    u64 bytes_uploaded;      ///< Bytes uploaded from guest memory to images
+    u64 bytes_downloaded;    ///< Bytes downloaded from images to guest memory
+    u64 cpu_decoded_bytes;   ///< Uploaded bytes converted on the CPU
+    u64 gpu_decoded_bytes;   ///< Uploaded bytes swizzled or converted on the GPU
+    u64 alias_syncs;         ///< Aliased images copied when synchronizing aliases
+    u64 image_copies;        ///< Copies between images
+    u64 rescales;            ///< Images scaled up or down
+    u64 fill_image_views_ns; ///< Time spent filling graphics image views
+
+    TextureCacheFrameStats& operator+=(const TextureCacheFrameStats& rhs) noexcept;
+};
+
+/**
+ * Collects the statistics reported by the texture caches every frame for the performance
+ * displays, and optionally appends them to a per title CSV file, one row per frame.
+ */
+class TextureCacheStats {
+public:
+    /// Starts dumping to dump/texture_cache_stats/<program id>.csv, ignored when already dumping
+    void OpenDump(u64 program_id);
+
+    /// Records the statistics of a finished frame
+    void ReportFrame(const TextureCacheFrameStats& frame);
+
+    /// Returns the sum of the frames reported since the previous call
+    [[nodiscard]] TextureCacheFrameStats GetAndReset();
+
+private:
+    std::mutex mutex;
+    TextureCacheFrameStats accumulated{};
+    std::ofstream dump_file;
+    u64 dump_frame = 0;
+};
+
+} // namespace VideoCommon
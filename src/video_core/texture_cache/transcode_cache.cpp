@@ -0,0 +1,296 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <optional>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/mapped_file.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "common/zstd_compression.h"
+#include "video_core/shader_notify.h"
+#include "video_core/texture_cache/image_info.h"
+#include "video_core/texture_cache/transcode_cache.h"
+
+namespace VideoCommon {
+
+namespace {
+
+constexpr u32 ENTRY_MAGIC = 0x43545559; // "YUTC"
+constexpr u32 ENTRY_VERSION = 1;
+constexpr size_t MAX_ENTRY_COPIES = 64;
+
+/// Evict down to this size when the cap is exceeded, so consecutive stores don't evict each time
+constexpr u64 EVICTION_TARGET_SIZE = TranscodeCache::MAX_CACHE_SIZE / 10 * 9;
+
+struct EntryHeader {
+    u32 magic;
+    u32 version;
+    u32 num_copies;
+    u32 copy_size;
+    u64 converted_size;
+};
+static_assert(sizeof(EntryHeader) == 24, "EntryHeader has incorrect size");
+
+std::optional<TranscodeCache::Key> ParseEntryName(const std::filesystem::path& path) {
+    if (path.extension() != ".bin") {
+        return std::nullopt;
+    }
+    const std::string name = Common::FS::PathToUTF8String(path.stem());
+    if (name.size() != 32) {
+        return std::nullopt;
+    }
+    TranscodeCache::Key key{};
+    for (size_t i = 0; i < key.size(); ++i) {
+        const char* const begin = name.data() + i * 16;
+        const auto [ptr, ec] = std::from_chars(begin, begin + 16, key[i], 16);
+        if (ec != std::errc{} || ptr != begin + 16) {
+            return std::nullopt;
+        }
+    }
+    return key;
+}
+
+} // Anonymous namespace
+
+TranscodeCache::TranscodeCache() = default;
+
+TranscodeCache::~TranscodeCache() = default;
+
+void TranscodeCache::Open(u64 title_id, VideoCore::ShaderNotify& shader_notify_) {
+    if (title_id == 0 || !Settings::values.use_disk_texture_cache.GetValue()) {
+        return;
+    }
+    const auto shader_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::ShaderDir)};
+    const auto base_dir{shader_dir / fmt::format("{:016x}", title_id)};
+    const auto textures_dir{base_dir / "textures"};
+    if (!Common::FS::CreateDir(shader_dir) || !Common::FS::CreateDir(base_dir) ||
+        !Common::FS::CreateDir(textures_dir)) {
+        LOG_ERROR(Common_Filesystem, "Failed to create transcoded texture cache directories");
+        return;
+    }
+
+    std::vector<std::pair<std::filesystem::file_time_type, Key>> found;
+    std::vector<u64> sizes;
+    Common::FS::IterateDirEntries(
+        textures_dir,
+        [&](const std::filesystem::directory_entry& entry) {
+            const std::optional<Key> key = ParseEntryName(entry.path());
+            std::error_code ec;
+            const auto write_time = entry.last_write_time(ec);
+            const u64 file_size = entry.file_size(ec);
+            if (!key || ec) {
+                return true;
+            }
+            found.emplace_back(write_time, *key);
+            sizes.push_back(file_size);
+            return true;
+        },
+        Common::FS::DirEntryFilter::File);
+
+    std::vector<size_t> order(found.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::ranges::sort(order, {}, [&](size_t i) { return found[i].first; });
+
+    std::scoped_lock lock{mutex};
+    cache_dir = textures_dir;
+    shader_notify = &shader_notify_;
+    is_enabled = true;
+    for (const size_t i : order) {
+        Insert(found[i].second, sizes[i]);
+    }
+    EvictLocked();
+
+    LOG_INFO(HW_GPU, "Loaded {} transcoded textures ({} MiB)", entries.size(),
+             total_size / 1_MiB);
+}
+
+TranscodeCache::Key TranscodeCache::MakeKey(const ImageInfo& info,
+                                             std::span<const u8> guest_data) {
+    // Hash the fields explicitly, ImageInfo has padding and members that don't affect its texels
+    const std::array<u32, 14> description{
+        static_cast<u32>(info.format),
+        static_cast<u32>(info.type),
+        info.size.width,
+        info.size.height,
+        info.size.depth,
+        static_cast<u32>(info.resources.levels),
+        static_cast<u32>(info.resources.layers),
+        info.block.width,
+        info.block.height,
+        info.block.depth,
+        info.layer_stride,
+        info.num_samples,
+        info.tile_width_spacing,
+        static_cast<u32>(Settings::values.astc_recompression.GetValue()),
+    };
+    const u128 seed = Common::CityHash128(reinterpret_cast<const char*>(description.data()),
+                                          sizeof(description));
+    return Common::CityHash128WithSeed(reinterpret_cast<const char*>(guest_data.data()),
+                                       guest_data.size(), seed);
+}
+
+bool TranscodeCache::Load(const Key& key, std::span<u8> output, Copies& copies) {
+    {
+        std::scoped_lock lock{mutex};
+        const auto it = entries.find(key);
+        if (it == entries.end()) {
+            shader_notify->MarkTranscodeMiss();
+            return false;
+        }
+        lru_cache.Touch(it->second.lru_id, ++current_tick);
+    }
+    const auto path{EntryPath(key)};
+    Common::FS::MappedFile file{path};
+    const auto drop_entry = [&] {
+        LOG_WARNING(HW_GPU, "Discarding invalid transcoded texture {}",
+                    Common::FS::PathToUTF8String(path));
+        // Some hosts can't remove a file while it is mapped
+        file.Close();
+        std::scoped_lock lock{mutex};
+        Erase(key);
+        shader_notify->MarkTranscodeMiss();
+        return false;
+    };
+
+    const std::span<const u8> data = file.Data();
+    EntryHeader header{};
+    if (data.size() < sizeof(EntryHeader)) {
+        return drop_entry();
+    }
+    std::memcpy(&header, data.data(), sizeof(EntryHeader));
+    if (header.magic != ENTRY_MAGIC || header.version != ENTRY_VERSION ||
+        header.copy_size != sizeof(BufferImageCopy) || header.num_copies == 0 ||
+        header.num_copies > MAX_ENTRY_COPIES || header.converted_size > output.size()) {
+        return drop_entry();
+    }
+    const u64 payload_offset = sizeof(EntryHeader) + header.num_copies * sizeof(BufferImageCopy);
+    if (data.size() <= payload_offset) {
+        return drop_entry();
+    }
+    file.Advise(Common::FS::MappedFileAccess::Sequential, 0, data.size());
+    Copies read_copies(header.num_copies);
+    std::memcpy(read_copies.data(), data.data() + sizeof(EntryHeader),
+                header.num_copies * sizeof(BufferImageCopy));
+    // Decompress straight from the mapping, the payload is only paged in as it is read
+    if (Common::Compression::DecompressDataZSTD(output.first(header.converted_size),
+                                                data.subspan(payload_offset)) !=
+        header.converted_size) {
+        return drop_entry();
+    }
+    file.Close();
+    copies = std::move(read_copies);
+
+    // Keep the recency order across sessions
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+    shader_notify->MarkTranscodeHit();
+    return true;
+}
+
+void TranscodeCache::Store(const Key& key, std::span<const u8> converted,
+                           std::span<const BufferImageCopy> copies) {
+    if (converted.empty() || copies.empty() || copies.size() > MAX_ENTRY_COPIES) {
+        return;
+    }
+    {
+        std::scoped_lock lock{mutex};
+        if (entries.contains(key)) {
+            return;
+        }
+    }
+    const std::vector<u8> compressed =
+        Common::Compression::CompressDataZSTDDefault(converted.data(), converted.size());
+    if (compressed.empty()) {
+        return;
+    }
+    const EntryHeader header{
+        .magic = ENTRY_MAGIC,
+        .version = ENTRY_VERSION,
+        .num_copies = static_cast<u32>(copies.size()),
+        .copy_size = static_cast<u32>(sizeof(BufferImageCopy)),
+        .converted_size = converted.size(),
+    };
+    const auto path{EntryPath(key)};
+    {
+        const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                                      Common::FS::FileType::BinaryFile};
+        if (!file.IsOpen() || !file.WriteObject(header) ||
+            file.WriteSpan(copies) != copies.size() ||
+            file.WriteSpan<u8>(compressed) != compressed.size()) {
+            LOG_ERROR(HW_GPU, "Failed to write transcoded texture {}",
+                      Common::FS::PathToUTF8String(path));
+            (void)Common::FS::RemoveFile(path);
+            return;
+        }
+    }
+    const u64 file_size =
+        sizeof(EntryHeader) + copies.size_bytes() + static_cast<u64>(compressed.size());
+
+    std::scoped_lock lock{mutex};
+    if (entries.contains(key)) {
+        return;
+    }
+    Insert(key, file_size);
+    EvictLocked();
+}
+
+std::filesystem::path TranscodeCache::EntryPath(const Key& key) const {
+    return cache_dir / fmt::format("{:016x}{:016x}.bin", key[0], key[1]);
+}
+
+void TranscodeCache::Insert(const Key& key, u64 file_size) {
+    const size_t lru_id = lru_cache.Insert(key, ++current_tick);
+    entries.emplace(key, Entry{
+                             .file_size = file_size,
+                             .lru_id = lru_id,
+                         });
+    total_size += file_size;
+}
+
+void TranscodeCache::Erase(const Key& key) {
+    const auto it = entries.find(key);
+    if (it == entries.end()) {
+        return;
+    }
+    lru_cache.Free(it->second.lru_id);
+    total_size -= it->second.file_size;
+    entries.erase(it);
+    (void)Common::FS::RemoveFile(EntryPath(key));
+}
+
+void TranscodeCache::EvictLocked() {
+    if (total_size <= MAX_CACHE_SIZE) {
+        return;
+    }
+    std::vector<Key> evicted;
+    u64 remaining_size = total_size;
+    lru_cache.ForEachItemBelow(current_tick, [&](const Key& key) {
+        if (remaining_size <= EVICTION_TARGET_SIZE) {
+            return;
+        }
+        remaining_size -= entries.at(key).file_size;
+        evicted.push_back(key);
+    });
+    for (const Key& key : evicted) {
+        Erase(key);
+    }
+    LOG_DEBUG(HW_GPU, "Evicted {} transcoded textures", evicted.size());
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "common/lru_cache.h"
+#include "common/scratch_buffer.h"
+#include "video_core/texture_cache/types.h"
+
+namespace VideoCore {
+class ShaderNotify;
+}
+
+namespace VideoCommon {
+
+using namespace Common::Literals;
+
+struct ImageInfo;
+
+/**
+ * Disk backed cache of images converted on the CPU (ASTC and BCn decodes on hosts without native
+ * support). Entries are keyed by a hash of the guest texel data and the image description, so a
+ * texture seen in a previous session or evicted from the texture cache is read back instead of
+ * being decoded again.
+ *
+ * Entries are zstd compressed, one file per entry, and evicted in least recently used order once
+ * the per title size cap is reached. It is safe to use from the texture decode worker.
+ */
+class TranscodeCache {
+public:
+    using Key = u128;
+    using Copies = boost::container::small_vector<BufferImageCopy, 16>;
+
+    /// Smallest guest image worth caching, decoding anything below is cheaper than a disk read
+    static constexpr size_t MIN_GUEST_SIZE = 16_KiB;
+    static constexpr u64 MAX_CACHE_SIZE = 1_GiB;
+
+    explicit TranscodeCache();
+    ~TranscodeCache();
+
+    TranscodeCache(const TranscodeCache&) = delete;
+    TranscodeCache& operator=(const TranscodeCache&) = delete;
+
+    /// Opens the cache directory of a title and indexes the entries left from previous sessions
+    void Open(u64 title_id, VideoCore::ShaderNotify& shader_notify);
+
+    [[nodiscard]] bool IsEnabled() const noexcept {
+        return is_enabled;
+    }
+
+    /// Returns true when an image with this description and guest data size should be cached
+    [[nodiscard]] bool ShouldCache(size_t guest_size) const noexcept {
+        return is_enabled && guest_size >= MIN_GUEST_SIZE;
+    }
+
+    /// Builds the lookup key of a converted image
+    [[nodiscard]] static Key MakeKey(const ImageInfo& info, std::span<const u8> guest_data);
+
+    /**
+     * Reads a cached conversion into output and replaces copies with the ones it was stored with.
+     * @returns true on a hit, false when the image has to be converted
+     */
+    [[nodiscard]] bool Load(const Key& key, std::span<u8> output, Copies& copies);
+
+    /// Stores the output of ConvertImage, evicting old entries if the size cap is exceeded
+    void Store(const Key& key, std::span<const u8> converted,
+               std::span<const BufferImageCopy> copies);
+
+private:
+    struct LruTraits {
+        using ObjectType = Key;
+        using TickType = u64;
+    };
+
+    struct KeyHash {
+        [[nodiscard]] size_t operator()(const Key& key) const noexcept {
+            return static_cast<size_t>(key[0] ^ key[1]);
+        }
+    };
+
+    struct Entry {
+        u64 file_size;
+        size_t lru_id;
+    };
+
+    [[nodiscard]] std::filesystem::path EntryPath(const Key& key) const;
+
+    void Insert(const Key& key, u64 file_size);
+
+    void Erase(const Key& key);
+
+    void EvictLocked();
+
+    bool is_enabled = false;
+    std::filesystem::path cache_dir;
+    VideoCore::ShaderNotify* shader_notify = nullptr;
+
+    std::mutex mutex;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    Common::LeastRecentlyUsedCache<LruTraits> lru_cache;
+    u64 current_tick = 0;
+    u64 total_size = 0;
+};
+
+} // namespace VideoCommon
@@ -699,6 +699,55 @@ boost::container::small_vector<SubresourceBase, 16> CalculateSliceSubresources(
     return subresources;
 }
 
+boost::container::small_vector<SubresourceRows, 16> CalculateSubresourceRows(
+    const ImageInfo& info, u32 offset, u32 size) {
+    ASSERT(info.type == ImageType::e2D);
+    const LevelInfo level_info = MakeLevelInfo(info);
+    const u32 layer_stride = info.resources.layers > 1 ? info.layer_stride : 0;
+    const u32 range_end = offset + size;
+    boost::container::small_vector<SubresourceRows, 16> result;
+    for (s32 layer = 0; layer < info.resources.layers; ++layer) {
+        u32 level_offset = static_cast<u32>(layer) * layer_stride;
+        if (level_offset >= range_end) {
+            break;
+        }
+        for (s32 level = 0; level < info.resources.levels; ++level) {
+            const u32 level_size = CalculateLevelSize(level_info, level);
+            const u32 level_begin = level_offset;
+            const u32 level_end = level_begin + level_size;
+            level_offset = level_end;
+            if (level_end <= offset || level_begin >= range_end) {
+                continue;
+            }
+            // Swizzle blocks are stored row by row, so a contiguous range of bytes holds whole
+            // rows of blocks except for its ends
+            const Extent3D tile_shift = TileShift(level_info, level);
+            const Extent3D tiles = LevelTiles(level_info, level);
+            const u32 block_shift =
+                GOB_SIZE_SHIFT + tile_shift.width + tile_shift.height + tile_shift.depth;
+            const u32 block_row_size = (tiles.width * tiles.depth) << block_shift;
+            const u32 first_block_row = (std::max(offset, level_begin) - level_begin) /
+                                        block_row_size;
+            const u32 last_block_row =
+                (std::min(range_end, level_end) - 1 - level_begin) / block_row_size;
+            const u32 rows_per_block =
+                (GOB_SIZE_Y << tile_shift.height) * level_info.tile_size.height;
+            const u32 level_height = AdjustMipSize(info.size.height, level);
+            const u32 begin = first_block_row * rows_per_block;
+            const u32 end = std::min((last_block_row + 1) * rows_per_block, level_height);
+            if (begin < end) {
+                result.push_back(SubresourceRows{
+                    .level = level,
+                    .layer = layer,
+                    .begin = begin,
+                    .end = end,
+                });
+            }
+        }
+    }
+    return result;
+}
+
 u32 CalculateLevelStrideAlignment(const ImageInfo& info, u32 level) {
     const Extent2D tile_size = DefaultBlockSize(info.format);
     const Extent3D level_size = AdjustMipSize(info.size, level);
@@ -910,8 +959,8 @@ boost::container::small_vector<BufferImageCopy, 16> UnswizzleImage(Tegra::Memory
     return copies;
 }
 
-void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8> output,
-                  std::span<BufferImageCopy> copies) {
+size_t ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8> output,
+                    std::span<BufferImageCopy> copies) {
     u32 output_offset = 0;
     Common::ScratchBuffer<u8> decode_scratch;
 
@@ -980,6 +1029,7 @@ void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8
         copy.buffer_row_length = mip_size.width;
         copy.buffer_image_height = mip_size.height;
     }
+    return output_offset;
 }
 
 boost::container::small_vector<BufferImageCopy, 16> FullDownloadCopies(const ImageInfo& info) {
@@ -27,6 +27,14 @@ struct OverlapResult {
     SubresourceExtent resources;
 };
 
+/// Range of texel rows of a subresource
+struct SubresourceRows {
+    s32 level;
+    s32 layer;
+    u32 begin; ///< First row
+    u32 end;   ///< One past the last row
+};
+
 [[nodiscard]] u32 CalculateGuestSizeInBytes(const ImageInfo& info) noexcept;
 
 [[nodiscard]] u32 CalculateUnswizzledSizeBytes(const ImageInfo& info) noexcept;
@@ -46,6 +54,11 @@ struct OverlapResult {
 [[nodiscard]] boost::container::small_vector<SubresourceBase, 16> CalculateSliceSubresources(
     const ImageInfo& info);
 
+/// Returns the rows of a block linear 2D image stored in a byte range of its guest memory.
+/// Rows are rounded out to whole rows of swizzle blocks, so they might also cover nearby bytes.
+[[nodiscard]] boost::container::small_vector<SubresourceRows, 16> CalculateSubresourceRows(
+    const ImageInfo& info, u32 offset, u32 size);
+
 [[nodiscard]] u32 CalculateLevelStrideAlignment(const ImageInfo& info, u32 level);
 
 [[nodiscard]] VideoCore::Surface::PixelFormat PixelFormatFromTIC(
@@ -66,8 +79,9 @@ struct OverlapResult {
     Tegra::MemoryManager& gpu_memory, GPUVAddr gpu_addr, const ImageInfo& info,
     std::span<const u8> input, std::span<u8> output);
 
-void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8> output,
-                  std::span<BufferImageCopy> copies);
+/// Converts an unswizzled image to a host supported format, returns the number of bytes written
+size_t ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8> output,
+                    std::span<BufferImageCopy> copies);
 
 [[nodiscard]] boost::container::small_vector<BufferImageCopy, 16> FullDownloadCopies(
     const ImageInfo& info);
@@ -8,6 +8,7 @@
 #include <bit>
 #include <cassert>
 #include <cstring>
+#include <memory>
 #include <span>
 #include <vector>
 
@@ -43,20 +44,28 @@ public:
     }
 
     constexpr u32 ReadBits(std::size_t nBits) {
+        // Read up to a byte at a time, bits past the end of the stream are read as zero
         u32 ret = 0;
-        for (std::size_t i = 0; i < nBits; ++i) {
-            ret |= (ReadBit() & 1) << i;
+        std::size_t offset = 0;
+        while (offset < nBits && bits_read < total_bits * 8) {
+            const std::size_t count =
+                std::min({nBits - offset, 8 - next_bit, total_bits * 8 - bits_read});
+            const u32 chunk = (*cur_byte >> next_bit) & ((1U << count) - 1);
+            ret |= chunk << offset;
+            offset += count;
+            bits_read += count;
+            next_bit += count;
+            if (next_bit >= 8) {
+                next_bit -= 8;
+                ++cur_byte;
+            }
         }
         return ret;
     }
 
     template <std::size_t nBits>
     constexpr u32 ReadBits() {
-        u32 ret = 0;
-        for (std::size_t i = 0; i < nBits; ++i) {
-            ret |= (ReadBit() & 1) << i;
-        }
-        return ret;
+        return ReadBits(nBits);
     }
 
 private:
@@ -691,6 +700,230 @@ static constexpr u32 FastReplicateTo6(u32 value, u32 num_bits) {
     }
 }
 
+/// Dequantizes a color endpoint value to the 0-255 range, procedure outlined in ASTC spec C.2.13
+static constexpr u32 UnquantizeColorValue(IntegerEncoding encoding, u32 bitlen, u32 bitval,
+                                          u32 D) {
+    u32 B = 0, C = 0;
+    // A is just the lsb replicated 9 times.
+    const u32 A = ReplicateBitTo9(bitval & 1);
+
+    switch (encoding) {
+    // Replicate bits
+    case IntegerEncoding::JustBits:
+        return FastReplicateTo8(bitval, bitlen);
+
+    // Use algorithm in C.2.13
+    case IntegerEncoding::Trit:
+        switch (bitlen) {
+        case 1:
+            C = 204;
+            break;
+        case 2: {
+            C = 93;
+            // B = b000b0bb0
+            const u32 b = (bitval >> 1) & 1;
+            B = (b << 8) | (b << 4) | (b << 2) | (b << 1);
+            break;
+        }
+        case 3: {
+            C = 44;
+            // B = cb000cbcb
+            const u32 cb = (bitval >> 1) & 3;
+            B = (cb << 7) | (cb << 2) | cb;
+            break;
+        }
+        case 4: {
+            C = 22;
+            // B = dcb000dcb
+            const u32 dcb = (bitval >> 1) & 7;
+            B = (dcb << 6) | dcb;
+            break;
+        }
+        case 5: {
+            C = 11;
+            // B = edcb000ed
+            const u32 edcb = (bitval >> 1) & 0xF;
+            B = (edcb << 5) | (edcb >> 2);
+            break;
+        }
+        case 6: {
+            C = 5;
+            // B = fedcb000f
+            const u32 fedcb = (bitval >> 1) & 0x1F;
+            B = (fedcb << 4) | (fedcb >> 4);
+            break;
+        }
+        default:
+            // Unsupported trit encoding for color values
+            break;
+        }
+        break;
+
+    case IntegerEncoding::Quint:
+        switch (bitlen) {
+        case 1:
+            C = 113;
+            break;
+        case 2: {
+            C = 54;
+            // B = b0000bb00
+            const u32 b = (bitval >> 1) & 1;
+            B = (b << 8) | (b << 3) | (b << 2);
+            break;
+        }
+        case 3: {
+            C = 26;
+            // B = cb0000cbc
+            const u32 cb = (bitval >> 1) & 3;
+            B = (cb << 7) | (cb << 1) | (cb >> 1);
+            break;
+        }
+        case 4: {
+            C = 13;
+            // B = dcb0000dc
+            const u32 dcb = (bitval >> 1) & 7;
+            B = (dcb << 6) | (dcb >> 1);
+            break;
+        }
+        case 5: {
+            C = 6;
+            // B = edcb0000e
+            const u32 edcb = (bitval >> 1) & 0xF;
+            B = (edcb << 5) | (edcb >> 3);
+            break;
+        }
+        default:
+            // Unsupported quint encoding for color values
+            break;
+        }
+        break;
+    }
+    u32 T = D * C + B;
+    T ^= A;
+    T = (A & 0x80) | (T >> 2);
+    return T;
+}
+
+/// Dequantizes a texel weight to the 0-64 range, procedure outlined in ASTC spec C.2.17
+static constexpr u32 UnquantizeWeightValue(IntegerEncoding encoding, u32 bitlen, u32 bitval,
+                                           u32 D) {
+    const u32 A = ReplicateBitTo7(bitval & 1);
+    u32 B = 0, C = 0;
+
+    u32 result = 0;
+    switch (encoding) {
+    case IntegerEncoding::JustBits:
+        result = FastReplicateTo6(bitval, bitlen);
+        break;
+
+    case IntegerEncoding::Trit:
+        switch (bitlen) {
+        case 0:
+            result = std::array<u32, 3>{0, 32, 63}[D];
+            break;
+        case 1:
+            C = 50;
+            break;
+        case 2: {
+            C = 23;
+            const u32 b = (bitval >> 1) & 1;
+            B = (b << 6) | (b << 2) | b;
+            break;
+        }
+        case 3: {
+            C = 11;
+            const u32 cb = (bitval >> 1) & 3;
+            B = (cb << 5) | cb;
+            break;
+        }
+        default:
+            // Invalid trit encoding for texel weight
+            break;
+        }
+        break;
+
+    case IntegerEncoding::Quint:
+        switch (bitlen) {
+        case 0:
+            result = std::array<u32, 5>{0, 16, 32, 47, 63}[D];
+            break;
+        case 1:
+            C = 28;
+            break;
+        case 2: {
+            C = 13;
+            const u32 b = (bitval >> 1) & 1;
+            B = (b << 6) | (b << 1);
+            break;
+        }
+        default:
+            // Invalid quint encoding for texel weight
+            break;
+        }
+        break;
+    }
+
+    if (encoding != IntegerEncoding::JustBits && bitlen > 0) {
+        // Decode the value...
+        result = D * C + B;
+        result ^= A;
+        result = (A & 0x20) | (result >> 2);
+    }
+
+    // Change from [0,63] to [0,64]
+    if (result > 32) {
+        result += 1;
+    }
+    return result;
+}
+
+/// Number of values each encoding can represent with a single bit
+static constexpr u32 NumEncodingValues(IntegerEncoding encoding) {
+    switch (encoding) {
+    case IntegerEncoding::Trit:
+        return 3;
+    case IntegerEncoding::Quint:
+        return 5;
+    default:
+        return 1;
+    }
+}
+
+/// Index of a decoded value in the unquantization tables
+static constexpr u32 QuantizedIndex(const IntegerEncodedValue& val) {
+    const u32 d = val.encoding == IntegerEncoding::JustBits ? 0 : val.trit_value;
+    return (d << val.num_bits) | val.bit_value;
+}
+
+/**
+ * Builds a table with the unquantized values of every encoding, so decoding a block is a lookup
+ * per value instead of branching on the encoding of each of them.
+ * Indexed by encoding, number of bits and the index returned by QuantizedIndex.
+ */
+template <u32 max_bits, u32 num_values, auto unquantize>
+static constexpr auto MakeUnquantizeTable() {
+    std::array<std::array<std::array<u8, num_values>, max_bits + 1>, 3> table{};
+    for (const IntegerEncoding encoding :
+         {IntegerEncoding::JustBits, IntegerEncoding::Quint, IntegerEncoding::Trit}) {
+        for (u32 bits = 0; bits <= max_bits; ++bits) {
+            for (u32 d = 0; d < NumEncodingValues(encoding); ++d) {
+                for (u32 bitval = 0; bitval < (1U << bits); ++bitval) {
+                    const u32 index = (d << bits) | bitval;
+                    if (index < num_values) {
+                        table[static_cast<size_t>(encoding)][bits][index] =
+                            static_cast<u8>(unquantize(encoding, bits, bitval, d));
+                    }
+                }
+            }
+        }
+    }
+    return table;
+}
+
+static constexpr auto COLOR_UNQUANTIZE_TABLE =
+    MakeUnquantizeTable<8, 256, UnquantizeColorValue>();
+static constexpr auto WEIGHT_UNQUANTIZE_TABLE = MakeUnquantizeTable<5, 32, UnquantizeWeightValue>();
+
 class Pixel {
 protected:
     using ChannelType = s16;
@@ -851,133 +1084,16 @@ static void DecodeColorValues(u32* out, std::span<u8> data, const u32* modes, co
     DecodeIntegerSequence(decodedColorValues, colorStream, range, nValues);
 
     // Once we have the decoded values, we need to dequantize them to the 0-255 range
-    // This procedure is outlined in ASTC spec C.2.13
     u32 outIdx = 0;
     for (auto itr = decodedColorValues.begin(); itr != decodedColorValues.end(); ++itr) {
         // Have we already decoded all that we need?
         if (outIdx >= nValues) {
             break;
         }
-
         const IntegerEncodedValue& val = *itr;
-        u32 bitlen = val.num_bits;
-        u32 bitval = val.bit_value;
-
-        assert(bitlen >= 1);
-
-        u32 A = 0, B = 0, C = 0, D = 0;
-        // A is just the lsb replicated 9 times.
-        A = ReplicateBitTo9(bitval & 1);
-
-        switch (val.encoding) {
-        // Replicate bits
-        case IntegerEncoding::JustBits:
-            out[outIdx++] = FastReplicateTo8(bitval, bitlen);
-            break;
-
-        // Use algorithm in C.2.13
-        case IntegerEncoding::Trit: {
-
-            D = val.trit_value;
-
-            switch (bitlen) {
-            case 1: {
-                C = 204;
-            } break;
-
-            case 2: {
-                C = 93;
-                // B = b000b0bb0
-                u32 b = (bitval >> 1) & 1;
-                B = (b << 8) | (b << 4) | (b << 2) | (b << 1);
-            } break;
-
-            case 3: {
-                C = 44;
-                // B = cb000cbcb
-                u32 cb = (bitval >> 1) & 3;
-                B = (cb << 7) | (cb << 2) | cb;
-            } break;
-
-            case 4: {
-                C = 22;
-                // B = dcb000dcb
-                u32 dcb = (bitval >> 1) & 7;
-                B = (dcb << 6) | dcb;
-            } break;
-
-            case 5: {
-                C = 11;
-                // B = edcb000ed
-                u32 edcb = (bitval >> 1) & 0xF;
-                B = (edcb << 5) | (edcb >> 2);
-            } break;
-
-            case 6: {
-                C = 5;
-                // B = fedcb000f
-                u32 fedcb = (bitval >> 1) & 0x1F;
-                B = (fedcb << 4) | (fedcb >> 4);
-            } break;
-
-            default:
-                assert(false && "Unsupported trit encoding for color values!");
-                break;
-            } // switch(bitlen)
-        }     // case IntegerEncoding::Trit
-        break;
-
-        case IntegerEncoding::Quint: {
-
-            D = val.quint_value;
-
-            switch (bitlen) {
-            case 1: {
-                C = 113;
-            } break;
-
-            case 2: {
-                C = 54;
-                // B = b0000bb00
-                u32 b = (bitval >> 1) & 1;
-                B = (b << 8) | (b << 3) | (b << 2);
-            } break;
-
-            case 3: {
-                C = 26;
-                // B = cb0000cbc
-                u32 cb = (bitval >> 1) & 3;
-                B = (cb << 7) | (cb << 1) | (cb >> 1);
-            } break;
-
-            case 4: {
-                C = 13;
-                // B = dcb0000dc
-                u32 dcb = (bitval >> 1) & 7;
-                B = (dcb << 6) | (dcb >> 1);
-            } break;
-
-            case 5: {
-                C = 6;
-                // B = edcb0000e
-                u32 edcb = (bitval >> 1) & 0xF;
-                B = (edcb << 5) | (edcb >> 3);
-            } break;
-
-            default:
-                assert(false && "Unsupported quint encoding for color values!");
-                break;
-            } // switch(bitlen)
-        }     // case IntegerEncoding::Quint
-        break;
-        } // switch(val.encoding)
-
-        if (val.encoding != IntegerEncoding::JustBits) {
-            u32 T = D * C + B;
-            T ^= A;
-            T = (A & 0x80) | (T >> 2);
-            out[outIdx++] = T;
-        }
+        assert(val.num_bits >= 1);
+        out[outIdx++] = COLOR_UNQUANTIZE_TABLE[static_cast<size_t>(val.encoding)][val.num_bits]
+                                               [QuantizedIndex(val)];
     }
 
     // Make sure that each of our values is in the proper range...
@@ -987,99 +1103,75 @@ static void DecodeColorValues(u32* out, std::span<u8> data, const u32* modes, co
 }
 
 static u32 UnquantizeTexelWeight(const IntegerEncodedValue& val) {
-    u32 bitval = val.bit_value;
-    u32 bitlen = val.num_bits;
-
-    u32 A = ReplicateBitTo7(bitval & 1);
-    u32 B = 0, C = 0, D = 0;
-
-    u32 result = 0;
-    switch (val.encoding) {
-    case IntegerEncoding::JustBits:
-        result = FastReplicateTo6(bitval, bitlen);
-        break;
-
-    case IntegerEncoding::Trit: {
-        D = val.trit_value;
-        assert(D < 3);
-
-        switch (bitlen) {
-        case 0: {
-            u32 results[3] = {0, 32, 63};
-            result = results[D];
-        } break;
-
-        case 1: {
-            C = 50;
-        } break;
-
-        case 2: {
-            C = 23;
-            u32 b = (bitval >> 1) & 1;
-            B = (b << 6) | (b << 2) | b;
-        } break;
-
-        case 3: {
-            C = 11;
-            u32 cb = (bitval >> 1) & 3;
-            B = (cb << 5) | cb;
-        } break;
-
-        default:
-            assert(false && "Invalid trit encoding for texel weight");
-            break;
-        }
-    } break;
-
-    case IntegerEncoding::Quint: {
-        D = val.quint_value;
-        assert(D < 5);
-
-        switch (bitlen) {
-        case 0: {
-            u32 results[5] = {0, 16, 32, 47, 63};
-            result = results[D];
-        } break;
-
-        case 1: {
-            C = 28;
-        } break;
+    return WEIGHT_UNQUANTIZE_TABLE[static_cast<size_t>(val.encoding)][val.num_bits]
+                                  [QuantizedIndex(val)];
+}
 
-        case 2: {
-            C = 13;
-            u32 b = (bitval >> 1) & 1;
-            B = (b << 6) | (b << 1);
-        } break;
+/// Bilinear infill of a weight grid to the texels of a block, as described in Section C.2.18
+struct InfillTable {
+    std::array<u8, 12 * 12> index;   ///< Weight at the top left of the texel
+    std::array<u8, 12 * 12> w00;     ///< Factor of the top left weight
+    std::array<u8, 12 * 12> w01;     ///< Factor of the top right weight
+    std::array<u8, 12 * 12> w10;     ///< Factor of the bottom left weight
+    std::array<u8, 12 * 12> w11;     ///< Factor of the bottom right weight
+};
 
-        default:
-            assert(false && "Invalid quint encoding for texel weight");
-            break;
+static InfillTable MakeInfillTable(u32 blockWidth, u32 blockHeight, u32 gridWidth,
+                                   u32 gridHeight) {
+    InfillTable table{};
+    const u32 Ds = (1024 + (blockWidth / 2)) / (blockWidth - 1);
+    const u32 Dt = (1024 + (blockHeight / 2)) / (blockHeight - 1);
+    for (u32 t = 0; t < blockHeight; t++) {
+        for (u32 s = 0; s < blockWidth; s++) {
+            const u32 gs = (Ds * s * (gridWidth - 1) + 32) >> 6;
+            const u32 gt = (Dt * t * (gridHeight - 1) + 32) >> 6;
+            const u32 fs = gs & 0xF;
+            const u32 ft = gt & 0xF;
+            const u32 w11 = (fs * ft + 8) >> 4;
+
+            const u32 texel = t * blockWidth + s;
+            table.index[texel] = static_cast<u8>((gs >> 4) + (gt >> 4) * gridWidth);
+            table.w00[texel] = static_cast<u8>(16 - fs - ft + w11);
+            table.w01[texel] = static_cast<u8>(fs - w11);
+            table.w10[texel] = static_cast<u8>(ft - w11);
+            table.w11[texel] = static_cast<u8>(w11);
         }
-    } break;
     }
+    return table;
+}
 
-    if (val.encoding != IntegerEncoding::JustBits && bitlen > 0) {
-        // Decode the value...
-        result = D * C + B;
-        result ^= A;
-        result = (A & 0x20) | (result >> 2);
-    }
-
-    assert(result < 64);
-
-    // Change from [0,63] to [0,64]
-    if (result > 32) {
-        result += 1;
+/// Infill tables of every weight grid size for the block size being decoded by a thread
+class InfillTables {
+public:
+    const InfillTable& Get(u32 blockWidth, u32 blockHeight, u32 gridWidth, u32 gridHeight) {
+        if (blockWidth != block_width || blockHeight != block_height) {
+            block_width = blockWidth;
+            block_height = blockHeight;
+            std::ranges::fill(tables, nullptr);
+        }
+        std::unique_ptr<InfillTable>& table = tables[gridHeight * 13 + gridWidth];
+        if (!table) {
+            table = std::make_unique<InfillTable>(
+                MakeInfillTable(blockWidth, blockHeight, gridWidth, gridHeight));
+        }
+        return *table;
     }
 
-    return result;
-}
+private:
+    u32 block_width = 0;
+    u32 block_height = 0;
+    std::array<std::unique_ptr<InfillTable>, 13 * 13> tables;
+};
 
 static void UnquantizeTexelWeights(u32 out[2][144], const IntegerEncodedVector& weights,
                                    const TexelWeightParams& params, const u32 blockWidth,
                                    const u32 blockHeight) {
+    const u32 numWeights = params.m_Width * params.m_Height;
     u32 weightIdx = 0;
-    u32 unquantized[2][144];
+
+    // Weights past the grid are read by the infill of the last row and column, keep them zero
+    // so the infill doesn't have to check each of them
+    u32 unquantized[2][144 + 13]{};
 
     for (auto itr = weights.begin(); itr != weights.end(); ++itr) {
         unquantized[0][weightIdx] = UnquantizeTexelWeight(*itr);
@@ -1092,55 +1184,27 @@ static void UnquantizeTexelWeights(u32 out[2][144], const IntegerEncodedVector&
             }
         }
 
-        if (++weightIdx >= (params.m_Width * params.m_Height))
+        if (++weightIdx >= numWeights)
             break;
     }
 
-    // Do infill if necessary (Section C.2.18) ...
-    u32 Ds = (1024 + (blockWidth / 2)) / (blockWidth - 1);
-    u32 Dt = (1024 + (blockHeight / 2)) / (blockHeight - 1);
+    static thread_local InfillTables infill_tables;
+    const InfillTable& infill =
+        infill_tables.Get(blockWidth, blockHeight, params.m_Width, params.m_Height);
 
+    const u32 numTexels = blockWidth * blockHeight;
+    const u32 stride = params.m_Width;
     const u32 kPlaneScale = params.m_bDualPlane ? 2U : 1U;
-    for (u32 plane = 0; plane < kPlaneScale; plane++)
-        for (u32 t = 0; t < blockHeight; t++)
-            for (u32 s = 0; s < blockWidth; s++) {
-                u32 cs = Ds * s;
-                u32 ct = Dt * t;
-
-                u32 gs = (cs * (params.m_Width - 1) + 32) >> 6;
-                u32 gt = (ct * (params.m_Height - 1) + 32) >> 6;
-
-                u32 js = gs >> 4;
-                u32 fs = gs & 0xF;
-
-                u32 jt = gt >> 4;
-                u32 ft = gt & 0x0F;
-
-                u32 w11 = (fs * ft + 8) >> 4;
-                u32 w10 = ft - w11;
-                u32 w01 = fs - w11;
-                u32 w00 = 16 - fs - ft + w11;
-
-                u32 v0 = js + jt * params.m_Width;
-
-#define FIND_TEXEL(tidx, bidx)                                                                     \
-    u32 p##bidx = 0;                                                                               \
-    do {                                                                                           \
-        if ((tidx) < (params.m_Width * params.m_Height)) {                                         \
-            p##bidx = unquantized[plane][(tidx)];                                                  \
-        }                                                                                          \
-    } while (0)
-
-                FIND_TEXEL(v0, 00);
-                FIND_TEXEL(v0 + 1, 01);
-                FIND_TEXEL(v0 + params.m_Width, 10);
-                FIND_TEXEL(v0 + params.m_Width + 1, 11);
-
-#undef FIND_TEXEL
-
-                out[plane][t * blockWidth + s] =
-                    (p00 * w00 + p01 * w01 + p10 * w10 + p11 * w11 + 8) >> 4;
-            }
+    for (u32 plane = 0; plane < kPlaneScale; plane++) {
+        const u32* const p = unquantized[plane];
+        for (u32 texel = 0; texel < numTexels; texel++) {
+            const u32 v0 = infill.index[texel];
+            out[plane][texel] = (p[v0] * infill.w00[texel] + p[v0 + 1] * infill.w01[texel] +
+                                 p[v0 + stride] * infill.w10[texel] +
+                                 p[v0 + stride + 1] * infill.w11[texel] + 8) >>
+                                4;
+        }
+    }
 }
 
 // Transfers a bit as described in C.2.14
@@ -1617,38 +1681,44 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
     u32 weights[2][144];
     UnquantizeTexelWeights(weights, texelWeightValues, weightParams, blockWidth, blockHeight);
 
+    // Expand the endpoints to 16 bits once, and find the weight plane of each channel
+    u32 endpoints16[4][2][4];
+    for (u32 partition = 0; partition < nPartitions; partition++) {
+        for (u32 c = 0; c < 4; c++) {
+            endpoints16[partition][0][c] = ReplicateByteTo16(endpoints[partition][0].Component(c));
+            endpoints16[partition][1][c] = ReplicateByteTo16(endpoints[partition][1].Component(c));
+        }
+    }
+    u32 channelPlane[4]{};
+    if (weightParams.m_bDualPlane) {
+        channelPlane[(planeIdx + 1) & 3] = 1;
+    }
+
     // Now that we have endpoints and weights, we can interpolate and generate
     // the proper decoding...
-    for (u32 j = 0; j < blockHeight; j++)
+    const bool smallBlock = (blockHeight * blockWidth) < 32;
+    for (u32 j = 0; j < blockHeight; j++) {
         for (u32 i = 0; i < blockWidth; i++) {
-            u32 partition = Select2DPartition(partitionIndex, i, j, nPartitions,
-                                              (blockHeight * blockWidth) < 32);
+            const u32 texel = j * blockWidth + i;
+            const u32 partition =
+                nPartitions > 1 ? Select2DPartition(partitionIndex, i, j, nPartitions, smallBlock)
+                                : 0;
             assert(partition < nPartitions);
 
-            Pixel p;
+            u32 channels[4];
             for (u32 c = 0; c < 4; c++) {
-                u32 C0 = endpoints[partition][0].Component(c);
-                C0 = ReplicateByteTo16(C0);
-                u32 C1 = endpoints[partition][1].Component(c);
-                C1 = ReplicateByteTo16(C1);
-
-                u32 plane = 0;
-                if (weightParams.m_bDualPlane && (((planeIdx + 1) & 3) == c)) {
-                    plane = 1;
-                }
-
-                u32 weight = weights[plane][j * blockWidth + i];
-                u32 C = (C0 * (64 - weight) + C1 * weight + 32) / 64;
-                if (C == 65535) {
-                    p.Component(c) = 255;
-                } else {
-                    double Cf = static_cast<double>(C);
-                    p.Component(c) = static_cast<u16>(255.0 * (Cf / 65536.0) + 0.5);
-                }
+                const u32 C0 = endpoints16[partition][0][c];
+                const u32 C1 = endpoints16[partition][1][c];
+                const u32 weight = weights[channelPlane[c]][texel];
+                const u32 C = (C0 * (64 - weight) + C1 * weight + 32) / 64;
+                // Same as rounding 255 * C / 65536 to the nearest integer
+                channels[c] = C == 65535 ? 255 : (C * 255 + 32768) >> 16;
             }
-
-            outBuf[j * blockWidth + i] = p.Pack();
+            // Channels are stored as ARGB, pack them as little endian RGBA
+            outBuf[texel] = (channels[0] << 24) | (channels[3] << 16) | (channels[2] << 8) |
+                            channels[1];
         }
+    }
 }
 
 void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height, uint32_t depth,
@@ -1656,38 +1726,50 @@ void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height,
     const u32 rows = Common::DivideUp(height, block_height);
     const u32 cols = Common::DivideUp(width, block_width);
 
-    Common::ThreadWorker& workers{GetThreadWorkers()};
-
-    for (u32 z = 0; z < depth; ++z) {
-        const u32 depth_offset = z * height * width * 4;
-        for (u32 y_index = 0; y_index < rows; ++y_index) {
-            auto decompress_stride = [data, width, height, block_width, block_height, output, rows,
-                                      cols, z, depth_offset, y_index] {
-                const u32 y = y_index * block_height;
-                for (u32 x_index = 0; x_index < cols; ++x_index) {
-                    const u32 block_index = (z * rows * cols) + (y_index * cols) + x_index;
-                    const u32 x = x_index * block_width;
-
-                    const std::span<const u8, 16> blockPtr{data.subspan(block_index * 16, 16)};
-
-                    // Blocks can be at most 12x12
-                    std::array<u32, 12 * 12> uncompData;
-                    DecompressBlock(blockPtr, block_width, block_height, uncompData);
-
-                    u32 decompWidth = std::min(block_width, width - x);
-                    u32 decompHeight = std::min(block_height, height - y);
-
-                    const std::span<u8> outRow = output.subspan(depth_offset + (y * width + x) * 4);
-                    for (u32 h = 0; h < decompHeight; ++h) {
-                        std::memcpy(outRow.data() + h * width * 4,
-                                    uncompData.data() + h * block_width, decompWidth * 4);
-                    }
+    // Decodes the block rows [first_row, last_row) of every slice, counted across slices
+    const auto decompress_rows = [data, width, height, block_width, block_height, output, rows,
+                                  cols](u32 first_row, u32 last_row) {
+        // Blocks can be at most 12x12
+        std::array<u32, 12 * 12> uncompData;
+        for (u32 row = first_row; row < last_row; ++row) {
+            const u32 z = row / rows;
+            const u32 y_index = row % rows;
+            const u32 y = y_index * block_height;
+            const u32 depth_offset = z * height * width * 4;
+            const u32 decompHeight = std::min(block_height, height - y);
+            for (u32 x_index = 0; x_index < cols; ++x_index) {
+                const u32 block_index = row * cols + x_index;
+                const u32 x = x_index * block_width;
+
+                const std::span<const u8, 16> blockPtr{data.subspan(block_index * 16, 16)};
+                DecompressBlock(blockPtr, block_width, block_height, uncompData);
+
+                const u32 decompWidth = std::min(block_width, width - x);
+                u8* const outRow = output.data() + depth_offset + (y * width + x) * 4;
+                for (u32 h = 0; h < decompHeight; ++h) {
+                    std::memcpy(outRow + h * width * 4, uncompData.data() + h * block_width,
+                                decompWidth * 4);
                 }
-            };
-            workers.QueueWork(std::move(decompress_stride));
+            }
         }
-        workers.WaitForRequests();
+    };
+
+    // Split the image in tiles of whole block rows big enough to hide the cost of queueing them
+    static constexpr u32 BLOCKS_PER_TILE = 1024;
+    const u32 total_rows = rows * depth;
+    const u32 rows_per_tile = std::max(BLOCKS_PER_TILE / std::max(cols, 1U), 1U);
+    if (total_rows <= rows_per_tile) {
+        decompress_rows(0, total_rows);
+        return;
+    }
+    Common::TaskGroup& workers{GetThreadWorkers()};
+    for (u32 first_row = 0; first_row < total_rows; first_row += rows_per_tile) {
+        const u32 last_row = std::min(first_row + rows_per_tile, total_rows);
+        workers.QueueWork([decompress_rows, first_row, last_row] {
+            decompress_rows(first_row, last_row);
+        });
     }
+    workers.WaitForRequests();
 }
 
 } // namespace Tegra::Texture::ASTC
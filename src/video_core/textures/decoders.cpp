@@ -33,6 +33,62 @@ void incrpdep(u32& value) {
     value = ((value | ~mask) + swizzled_incr) & mask;
 }
 
+/// Swizzled offsets of the 16 byte runs that make up a row of a GOB
+constexpr std::array<u32, 4> GOB_CHUNK_OFFSETS{
+    pdep<SWIZZLE_X_BITS>(0),
+    pdep<SWIZZLE_X_BITS>(16),
+    pdep<SWIZZLE_X_BITS>(32),
+    pdep<SWIZZLE_X_BITS>(48),
+};
+
+/**
+ * Copies the bytes [x_begin, x_end) of a row between its linear and block linear layouts.
+ * Within a GOB row only the lower 4 bits of x are kept contiguous, so every GOB the run fully
+ * covers is moved as four 16 byte copies instead of pixel by pixel.
+ */
+template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
+void SwizzleRow(std::span<u8> output, std::span<const u8> input, u32 x_begin, u32 x_end,
+                u32 swizzled_base, u32 swizzled_y, u32 x_shift, u32 unswizzled_base) {
+    const auto copy_pixels = [&](u32 begin, u32 end) {
+        u32 swizzled_x = pdep<SWIZZLE_X_BITS>(begin);
+        for (u32 x = begin; x < end;
+             x += BYTES_PER_PIXEL, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
+            const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
+            const u32 swizzled_offset = swizzled_base + offset_x + (swizzled_x | swizzled_y);
+            const u32 unswizzled_offset = unswizzled_base + x - x_begin;
+
+            u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
+            const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
+
+            std::memcpy(dst, src, BYTES_PER_PIXEL);
+        }
+    };
+    if constexpr (GOB_SIZE_X % BYTES_PER_PIXEL == 0) {
+        const u32 gob_begin = Common::AlignUpLog2(x_begin, GOB_SIZE_X_SHIFT);
+        const u32 gob_end = Common::AlignDown(x_end, GOB_SIZE_X);
+        if (gob_begin < gob_end) {
+            copy_pixels(x_begin, gob_begin);
+            for (u32 x = gob_begin; x < gob_end; x += GOB_SIZE_X) {
+                const u32 swizzled_offset =
+                    swizzled_base + ((x >> GOB_SIZE_X_SHIFT) << x_shift) + swizzled_y;
+                const u32 unswizzled_offset = unswizzled_base + x - x_begin;
+                for (u32 chunk = 0; chunk < GOB_CHUNK_OFFSETS.size(); ++chunk) {
+                    const u32 swizzled_chunk = swizzled_offset + GOB_CHUNK_OFFSETS[chunk];
+                    const u32 unswizzled_chunk = unswizzled_offset + chunk * 16;
+
+                    u8* const dst = &output[TO_LINEAR ? swizzled_chunk : unswizzled_chunk];
+                    const u8* const src = &input[TO_LINEAR ? unswizzled_chunk : swizzled_chunk];
+
+                    std::memcpy(dst, src, 16);
+                }
+            }
+            copy_pixels(gob_end, x_end);
+            return;
+        }
+    }
+    copy_pixels(x_begin, x_end);
+}
+
 template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
 void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32 height, u32 depth,
                  u32 block_height, u32 block_depth, u32 stride) {
@@ -67,23 +123,10 @@ void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32
             const u32 offset_y = (block_y >> block_height) * block_size +
                                  ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
 
-            u32 swizzled_x = pdep<SWIZZLE_X_BITS>(origin_x * BYTES_PER_PIXEL);
-            for (u32 column = 0; column < width;
-                 ++column, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
-                const u32 x = (column + origin_x) * BYTES_PER_PIXEL;
-                const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
-
-                const u32 base_swizzled_offset = offset_z + offset_y + offset_x;
-                const u32 swizzled_offset = base_swizzled_offset + (swizzled_x | swizzled_y);
-
-                const u32 unswizzled_offset =
-                    slice * pitch * height + line * pitch + column * BYTES_PER_PIXEL;
-
-                u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
-                const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
-
-                std::memcpy(dst, src, BYTES_PER_PIXEL);
-            }
+            const u32 x_begin = origin_x * BYTES_PER_PIXEL;
+            SwizzleRow<TO_LINEAR, BYTES_PER_PIXEL>(
+                output, input, x_begin, x_begin + width * BYTES_PER_PIXEL, offset_z + offset_y,
+                swizzled_y, x_shift, slice * pitch * height + line * pitch);
         }
     }
 }
@@ -126,23 +169,10 @@ void SwizzleSubrectImpl(std::span<u8> output, std::span<const u8> input, u32 wid
             const u32 offset_y = (block_y >> block_height) * block_size +
                                  ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
 
-            u32 swizzled_x = pdep<SWIZZLE_X_BITS>(origin_x * BYTES_PER_PIXEL);
-            for (u32 column = 0; column < extent_x;
-                 ++column, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
-                const u32 x = (column + origin_x) * BYTES_PER_PIXEL;
-                const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
-
-                const u32 base_swizzled_offset = offset_z + offset_y + offset_x;
-                const u32 swizzled_offset = base_swizzled_offset + (swizzled_x | swizzled_y);
-
-                const u32 unswizzled_offset =
-                    slice * pitch * height + line * pitch + column * BYTES_PER_PIXEL;
-
-                u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
-                const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
-
-                std::memcpy(dst, src, BYTES_PER_PIXEL);
-            }
+            const u32 x_begin = origin_x * BYTES_PER_PIXEL;
+            SwizzleRow<TO_LINEAR, BYTES_PER_PIXEL>(
+                output, input, x_begin, x_begin + extent_x * BYTES_PER_PIXEL, offset_z + offset_y,
+                swizzled_y, x_shift, slice * pitch * height + line * pitch);
         }
         unprocessed_lines -= lines_in_y;
         if (unprocessed_lines == 0) {
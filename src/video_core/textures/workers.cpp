@@ -5,9 +5,9 @@
 
 namespace Tegra::Texture {
 
-Common::ThreadWorker& GetThreadWorkers() {
-    static Common::ThreadWorker workers{std::max(std::thread::hardware_concurrency(), 2U) / 2,
-                                        "ImageTranscode"};
+Common::TaskGroup& GetThreadWorkers() {
+    // The GPU thread waits for the transcode to finish
+    static Common::TaskGroup workers{Common::TaskPriority::LatencyCritical};
 
     return workers;
 }
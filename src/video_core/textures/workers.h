@@ -3,10 +3,10 @@
 
 #pragma once
 
-#include "common/thread_worker.h"
+#include "common/task_pool.h"
 
 namespace Tegra::Texture {
 
-Common::ThreadWorker& GetThreadWorkers();
+Common::TaskGroup& GetThreadWorkers();
 
 }
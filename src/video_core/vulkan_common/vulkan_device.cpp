@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <chrono>
 #include <optional>
@@ -721,13 +722,23 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
 
     graphics_queue = logical.GetQueue(graphics_family);
     present_queue = logical.GetQueue(present_family);
+    if (transfer_family) {
+        transfer_queue = logical.GetQueue(*transfer_family);
+    }
+    if (has_async_present_queue) {
+        async_present_queue = logical.GetQueue(graphics_family, 1);
+    }
 
     VmaVulkanFunctions functions{};
     functions.vkGetInstanceProcAddr = dld.vkGetInstanceProcAddr;
     functions.vkGetDeviceProcAddr = dld.vkGetDeviceProcAddr;
 
+    VmaAllocatorCreateFlags allocator_flags = VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT;
+    if (IsBufferDeviceAddressEnabled()) {
+        allocator_flags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+    }
     const VmaAllocatorCreateInfo allocator_info = {
-        .flags = VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT,
+        .flags = allocator_flags,
         .physicalDevice = physical,
         .device = *logical,
         .preferredLargeHeapBlockSize = 0,
@@ -1096,6 +1107,21 @@ bool Device::GetSuitability(bool requires_swapchain) {
             VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT;
         SetNext(next, properties.transform_feedback);
     }
+    if (extensions.external_memory_host) {
+        properties.external_memory_host.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT;
+        SetNext(next, properties.external_memory_host);
+    }
+    if (extensions.graphics_pipeline_library) {
+        properties.graphics_pipeline_library.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        SetNext(next, properties.graphics_pipeline_library);
+    }
+    if (extensions.descriptor_buffer) {
+        properties.descriptor_buffer.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        SetNext(next, properties.descriptor_buffer);
+    }
 
     // Perform the property fetch.
     physical.GetProperties2(properties2);
@@ -1197,6 +1223,13 @@ void Device::RemoveUnsuitableExtensions() {
                                        features.shader_demote_to_helper_invocation,
                                        VK_EXT_SHADER_DEMOTE_TO_HELPER_INVOCATION_EXTENSION_NAME);
 
+    // VK_KHR_dynamic_rendering
+    // The extension depends on render pass 2 and depth stencil resolve from Vulkan 1.2
+    extensions.dynamic_rendering = features.dynamic_rendering.dynamicRendering &&
+                                   instance_version >= VK_API_VERSION_1_2;
+    RemoveExtensionFeatureIfUnsuitable(extensions.dynamic_rendering, features.dynamic_rendering,
+                                       VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+
     // VK_EXT_subgroup_size_control
     extensions.subgroup_size_control =
         features.subgroup_size_control.subgroupSizeControl &&
@@ -1217,6 +1250,38 @@ void Device::RemoveUnsuitableExtensions() {
     RemoveExtensionFeatureIfUnsuitable(extensions.transform_feedback, features.transform_feedback,
                                        VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME);
 
+    // VK_EXT_graphics_pipeline_library
+    // Only worth using when linking libraries is fast, otherwise it just adds a compile step
+    extensions.graphics_pipeline_library =
+        extensions.pipeline_library && features.graphics_pipeline_library.graphicsPipelineLibrary &&
+        properties.graphics_pipeline_library.graphicsPipelineLibraryFastLinking;
+    RemoveExtensionFeatureIfUnsuitable(extensions.graphics_pipeline_library,
+                                       features.graphics_pipeline_library,
+                                       VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+
+    // VK_EXT_descriptor_buffer
+    // Buffer descriptors are built from device addresses and unbound ones are null descriptors
+    extensions.descriptor_buffer = features.descriptor_buffer.descriptorBuffer &&
+                                   features.buffer_device_address.bufferDeviceAddress &&
+                                   features.robustness2.nullDescriptor;
+    RemoveExtensionFeatureIfUnsuitable(extensions.descriptor_buffer, features.descriptor_buffer,
+                                       VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    features.descriptor_buffer.descriptorBufferCaptureReplay = false;
+
+    // Storage buffer pointers read 64-bit addresses from a table and access buffers through
+    // atomics, so 64-bit integers and storage buffer atomics are required
+    storage_buffer_pointers = Settings::values.use_storage_buffer_pointers.GetValue() &&
+                              features.buffer_device_address.bufferDeviceAddress &&
+                              features.features.shaderInt64 &&
+                              features.features.vertexPipelineStoresAndAtomics &&
+                              features.features.fragmentStoresAndAtomics;
+
+    // Device addresses are only needed by descriptor buffers and storage buffer pointers
+    features.buffer_device_address.bufferDeviceAddress =
+        extensions.descriptor_buffer || storage_buffer_pointers;
+    features.buffer_device_address.bufferDeviceAddressCaptureReplay = false;
+    features.buffer_device_address.bufferDeviceAddressMultiDevice = false;
+
     // VK_EXT_vertex_input_dynamic_state
     extensions.vertex_input_dynamic_state =
         features.vertex_input_dynamic_state.vertexInputDynamicState;
@@ -1237,6 +1302,16 @@ void Device::RemoveUnsuitableExtensions() {
                                VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME);
     }
 
+    // VK_KHR_present_id
+    extensions.present_id = extensions.swapchain && features.present_id.presentId;
+    RemoveExtensionFeatureIfUnsuitable(extensions.present_id, features.present_id,
+                                       VK_KHR_PRESENT_ID_EXTENSION_NAME);
+
+    // VK_KHR_present_wait
+    extensions.present_wait = extensions.present_id && features.present_wait.presentWait;
+    RemoveExtensionFeatureIfUnsuitable(extensions.present_wait, features.present_wait,
+                                       VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+
     // VK_KHR_workgroup_memory_explicit_layout
     extensions.workgroup_memory_explicit_layout =
         features.features.shaderInt16 &&
@@ -1253,14 +1328,24 @@ void Device::SetupFamilies(VkSurfaceKHR surface) {
     const std::vector queue_family_properties = physical.GetQueueFamilyProperties();
     std::optional<u32> graphics;
     std::optional<u32> present;
+    std::optional<u32> transfer;
     for (u32 index = 0; index < static_cast<u32>(queue_family_properties.size()); ++index) {
-        if (graphics && (present || !surface)) {
-            break;
-        }
         const VkQueueFamilyProperties& queue_family = queue_family_properties[index];
         if (queue_family.queueCount == 0) {
             continue;
         }
+        // Only take transfer families without granularity restrictions, so partial copies of any
+        // mip level can be issued on them like on the graphics queue
+        static constexpr VkQueueFlags QUEUE_TYPES = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT;
+        const VkExtent3D granularity = queue_family.minImageTransferGranularity;
+        if (!transfer && (queue_family.queueFlags & VK_QUEUE_TRANSFER_BIT) &&
+            (queue_family.queueFlags & QUEUE_TYPES) == 0 && granularity.width == 1 &&
+            granularity.height == 1 && granularity.depth == 1) {
+            transfer = index;
+        }
+        if (graphics && (present || !surface)) {
+            continue;
+        }
         if (queue_family.queueFlags & VK_QUEUE_GRAPHICS_BIT) {
             graphics = index;
         }
@@ -1278,10 +1363,18 @@ void Device::SetupFamilies(VkSurfaceKHR surface) {
     }
     if (graphics) {
         graphics_family = *graphics;
+        graphics_sparse_binding =
+            (queue_family_properties[*graphics].queueFlags & VK_QUEUE_SPARSE_BINDING_BIT) != 0;
+        // Presentation passes are fragment work, so they need a second queue of the same family
+        has_async_present_queue = queue_family_properties[*graphics].queueCount > 1 &&
+                                  Settings::values.use_async_present_queue.GetValue();
     }
     if (present) {
         present_family = *present;
     }
+    if (transfer) {
+        transfer_family = *transfer;
+    }
 }
 
 u64 Device::GetDeviceMemoryUsage() const {
@@ -1296,6 +1389,23 @@ u64 Device::GetDeviceMemoryUsage() const {
     return result;
 }
 
+u64 Device::GetDeviceMemoryBudget() const {
+    if (!extensions.memory_budget) {
+        return device_access_memory;
+    }
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budget;
+    budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+    budget.pNext = nullptr;
+    physical.GetMemoryProperties(&budget);
+    u64 heap_budget{};
+    for (const size_t heap : valid_heap_memory) {
+        heap_budget += budget.heapBudget[heap];
+    }
+    // Leave the driver some headroom, and never go above the limits computed at startup
+    const u64 reserve_memory = std::min<u64>(heap_budget / 8, 1_GiB);
+    return std::min(heap_budget - reserve_memory, device_access_memory);
+}
+
 void Device::CollectPhysicalMemoryInfo() {
     // Calculate limits using memory budget
     VkPhysicalDeviceMemoryBudgetPropertiesEXT budget{};
@@ -1357,9 +1467,12 @@ void Device::CollectToolingInfo() {
 }
 
 std::vector<VkDeviceQueueCreateInfo> Device::GetDeviceQueueCreateInfos() const {
-    static constexpr float QUEUE_PRIORITY = 1.0f;
+    static constexpr std::array<float, 2> QUEUE_PRIORITIES{1.0f, 1.0f};
 
     std::unordered_set<u32> unique_queue_families{graphics_family, present_family};
+    if (transfer_family) {
+        unique_queue_families.insert(*transfer_family);
+    }
     std::vector<VkDeviceQueueCreateInfo> queue_cis;
     queue_cis.reserve(unique_queue_families.size());
 
@@ -1369,10 +1482,10 @@ std::vector<VkDeviceQueueCreateInfo> Device::GetDeviceQueueCreateInfos() const {
             .pNext = nullptr,
             .flags = 0,
             .queueFamilyIndex = queue_family,
-            .queueCount = 1,
+            .queueCount = queue_family == graphics_family && has_async_present_queue ? 2U : 1U,
             .pQueuePriorities = nullptr,
         });
-        ci.pQueuePriorities = &QUEUE_PRIORITY;
+        ci.pQueuePriorities = QUEUE_PRIORITIES.data();
     }
 
     return queue_cis;
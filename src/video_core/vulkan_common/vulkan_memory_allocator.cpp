@@ -3,7 +3,10 @@
 
 #include <algorithm>
 #include <bit>
+#include <map>
 #include <optional>
+#include <set>
+#include <utility>
 #include <vector>
 
 #include "common/alignment.h"
@@ -19,15 +22,6 @@
 
 namespace Vulkan {
 namespace {
-struct Range {
-    u64 begin;
-    u64 end;
-
-    [[nodiscard]] bool Contains(u64 iterator, u64 size) const noexcept {
-        return iterator < end && begin < iterator + size;
-    }
-};
-
 [[nodiscard]] u64 AllocationChunkSize(u64 required_size) {
     static constexpr std::array sizes{
         0x1000ULL << 10,  0x1400ULL << 10,  0x1800ULL << 10,  0x1c00ULL << 10, 0x2000ULL << 10,
@@ -88,6 +82,26 @@ struct Range {
     return VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
 }
 
+/// Descriptor buffers and storage buffer pointers reference buffers by device address, so every
+/// buffer has to expose one
+[[nodiscard]] VkBufferCreateInfo BufferCreateInfo(const Device& device, VkBufferCreateInfo ci) {
+    if (device.IsBufferDeviceAddressEnabled()) {
+        ci.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+    return ci;
+}
+
+[[nodiscard]] VkMemoryAllocateFlagsInfo MemoryAllocateFlags(const Device& device,
+                                                            const void* next) {
+    return VkMemoryAllocateFlagsInfo{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO,
+        .pNext = next,
+        .flags = device.IsBufferDeviceAddressEnabled()
+                     ? static_cast<VkMemoryAllocateFlags>(VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT)
+                     : 0U,
+        .deviceMask = 0,
+    };
+}
 } // Anonymous namespace
 
 class MemoryAllocation {
@@ -95,7 +109,9 @@ public:
     explicit MemoryAllocation(MemoryAllocator* const allocator_, vk::DeviceMemory memory_,
                               VkMemoryPropertyFlags properties, u64 allocation_size_, u32 type)
         : allocator{allocator_}, memory{std::move(memory_)}, allocation_size{allocation_size_},
-          property_flags{properties}, shifted_memory_type{1U << type} {}
+          property_flags{properties}, shifted_memory_type{1U << type} {
+        InsertFreeRange(0, allocation_size);
+    }
 
     MemoryAllocation& operator=(const MemoryAllocation&) = delete;
     MemoryAllocation(const MemoryAllocation&) = delete;
@@ -109,24 +125,45 @@ public:
             // Signal out of memory, it'll try to do more allocations.
             return std::nullopt;
         }
-        const Range range{
-            .begin = *alloc,
-            .end = *alloc + size,
-        };
-        commits.insert(std::ranges::upper_bound(commits, *alloc, {}, &Range::begin), range);
+        ++num_commits;
         return std::make_optional<MemoryCommit>(this, *memory, *alloc, *alloc + size);
     }
 
-    void Free(u64 begin) {
-        const auto it = std::ranges::find(commits, begin, &Range::begin);
-        ASSERT_MSG(it != commits.end(), "Invalid commit");
-        commits.erase(it);
-        if (commits.empty()) {
+    void Free(u64 begin, u64 end) {
+        ASSERT_MSG(num_commits > 0, "Invalid commit");
+        u64 free_begin = begin;
+        u64 free_end = end;
+        // Join the released range with the free ranges around it
+        const auto next = free_ranges.lower_bound(begin);
+        if (next != free_ranges.end() && next->first == end) {
+            free_end = next->second;
+            EraseFreeRange(next);
+        }
+        const auto after = free_ranges.lower_bound(begin);
+        if (after != free_ranges.begin()) {
+            const auto previous = std::prev(after);
+            if (previous->second == begin) {
+                free_begin = previous->first;
+                EraseFreeRange(previous);
+            }
+        }
+        InsertFreeRange(free_begin, free_end);
+        if (--num_commits == 0) {
             // Do not call any code involving 'this' after this call, the object will be destroyed
             allocator->ReleaseMemory(this);
         }
     }
 
+    /// Returns the bytes that are not committed
+    [[nodiscard]] u64 FreeBytes() const noexcept {
+        return free_bytes;
+    }
+
+    /// Returns the size of the largest free range
+    [[nodiscard]] u64 LargestFreeRange() const noexcept {
+        return free_sizes.empty() ? 0 : free_sizes.rbegin()->first;
+    }
+
     [[nodiscard]] std::span<u8> Map() {
         if (memory_mapped_span.empty()) {
             u8* const raw_pointer = memory.Map(0, allocation_size);
@@ -145,24 +182,42 @@ private:
         return 1U << type;
     }
 
-    [[nodiscard]] std::optional<u64> FindFreeRegion(u64 size, u64 alignment) noexcept {
+    /// Takes the smallest free range that fits, the rest of the range stays free. Best fit keeps
+    /// large ranges whole for large commits, first fit split them up over long sessions.
+    [[nodiscard]] std::optional<u64> FindFreeRegion(u64 size, u64 alignment) {
         ASSERT(std::has_single_bit(alignment));
         const u64 alignment_log2 = std::countr_zero(alignment);
-        std::optional<u64> candidate;
-        u64 iterator = 0;
-        auto commit = commits.begin();
-        while (iterator + size <= allocation_size) {
-            candidate = candidate.value_or(iterator);
-            if (commit == commits.end()) {
-                break;
+        const auto smallest = free_sizes.lower_bound(std::make_pair(size, u64{0}));
+        for (auto it = smallest; it != free_sizes.end(); ++it) {
+            const auto [range_size, range_begin] = *it;
+            const u64 range_end = range_begin + range_size;
+            const u64 aligned_begin = Common::AlignUpLog2(range_begin, alignment_log2);
+            if (aligned_begin + size > range_end) {
+                continue;
             }
-            if (commit->Contains(*candidate, size)) {
-                candidate = std::nullopt;
+            EraseFreeRange(free_ranges.find(range_begin));
+            if (aligned_begin != range_begin) {
+                InsertFreeRange(range_begin, aligned_begin);
             }
-            iterator = Common::AlignUpLog2(commit->end, alignment_log2);
-            ++commit;
+            if (aligned_begin + size != range_end) {
+                InsertFreeRange(aligned_begin + size, range_end);
+            }
+            return aligned_begin;
         }
-        return candidate;
+        return std::nullopt;
+    }
+
+    void InsertFreeRange(u64 begin, u64 end) {
+        free_ranges.emplace(begin, end);
+        free_sizes.emplace(end - begin, begin);
+        free_bytes += end - begin;
+    }
+
+    void EraseFreeRange(std::map<u64, u64>::iterator it) {
+        const u64 size = it->second - it->first;
+        free_sizes.erase(std::make_pair(size, it->first));
+        free_bytes -= size;
+        free_ranges.erase(it);
     }
 
     MemoryAllocator* const allocator;           ///< Parent memory allocation.
@@ -170,7 +225,10 @@ private:
     const u64 allocation_size;                  ///< Size of this allocation.
     const VkMemoryPropertyFlags property_flags; ///< Vulkan memory property flags.
     const u32 shifted_memory_type;              ///< Shifted Vulkan memory type.
-    std::vector<Range> commits;                 ///< All commit ranges done from this allocation.
+    std::map<u64, u64> free_ranges;             ///< Free ranges, from begin to end offset.
+    std::set<std::pair<u64, u64>> free_sizes;   ///< Free ranges by size and begin offset.
+    u64 free_bytes{};                           ///< Bytes in all free ranges.
+    size_t num_commits{};                       ///< Commits alive in this allocation.
     std::span<u8> memory_mapped_span; ///< Memory mapped span. Empty if not queried before.
 };
 
@@ -205,7 +263,7 @@ std::span<u8> MemoryCommit::Map() {
 
 void MemoryCommit::Release() {
     if (allocation) {
-        allocation->Free(begin);
+        allocation->Free(begin, end);
     }
 }
 
@@ -251,6 +309,26 @@ vk::Image MemoryAllocator::CreateImage(const VkImageCreateInfo& ci) const {
                      device.GetDispatchLoader());
 }
 
+vk::Image MemoryAllocator::CreateSparseImage(const VkImageCreateInfo& ci) const {
+    VkImage handle{};
+    vk::Check(
+        device.GetDispatchLoader().vkCreateImage(*device.GetLogical(), &ci, nullptr, &handle));
+
+    // Without an allocation, destroying the image leaves the memory bound to it untouched
+    return vk::Image(handle, *device.GetLogical(), allocator, nullptr, device.GetDispatchLoader());
+}
+
+vk::Buffer MemoryAllocator::CreateSparseBuffer(const VkBufferCreateInfo& ci) const {
+    const VkBufferCreateInfo buffer_ci = BufferCreateInfo(device, ci);
+    VkBuffer handle{};
+    vk::Check(device.GetDispatchLoader().vkCreateBuffer(*device.GetLogical(), &buffer_ci, nullptr,
+                                                        &handle));
+
+    // Without an allocation, destroying the buffer leaves the memory bound to it untouched
+    return vk::Buffer(handle, *device.GetLogical(), allocator, nullptr, {}, true,
+                      device.GetDispatchLoader());
+}
+
 vk::Buffer MemoryAllocator::CreateBuffer(const VkBufferCreateInfo& ci, MemoryUsage usage) const {
     const VmaAllocationCreateInfo alloc_ci = {
         .flags = VMA_ALLOCATION_CREATE_WITHIN_BUDGET_BIT | MemoryUsageVmaFlags(usage),
@@ -268,7 +346,9 @@ vk::Buffer MemoryAllocator::CreateBuffer(const VkBufferCreateInfo& ci, MemoryUsa
     VmaAllocation allocation{};
     VkMemoryPropertyFlags property_flags{};
 
-    vk::Check(vmaCreateBuffer(allocator, &ci, &alloc_ci, &handle, &allocation, &alloc_info));
+    const VkBufferCreateInfo buffer_ci = BufferCreateInfo(device, ci);
+    vk::Check(
+        vmaCreateBuffer(allocator, &buffer_ci, &alloc_ci, &handle, &allocation, &alloc_info));
     vmaGetAllocationMemoryProperties(allocator, allocation, &property_flags);
 
     u8* data = reinterpret_cast<u8*>(alloc_info.pMappedData);
@@ -279,6 +359,58 @@ vk::Buffer MemoryAllocator::CreateBuffer(const VkBufferCreateInfo& ci, MemoryUsa
                       device.GetDispatchLoader());
 }
 
+vk::Buffer MemoryAllocator::ImportHostBuffer(const VkBufferCreateInfo& ci, void* host_pointer,
+                                             vk::DeviceMemory& memory) const {
+    const vk::Device& logical = device.GetLogical();
+    const vk::DeviceDispatch& dld = device.GetDispatchLoader();
+    const u32 host_types = logical.GetMemoryHostPointerTypeBitsEXT(host_pointer);
+    if (host_types == 0) {
+        return {};
+    }
+    const VkExternalMemoryBufferCreateInfo external_ci{
+        .sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO,
+        .pNext = ci.pNext,
+        .handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT,
+    };
+    VkBufferCreateInfo import_ci = BufferCreateInfo(device, ci);
+    import_ci.pNext = &external_ci;
+
+    VkBuffer handle{};
+    if (dld.vkCreateBuffer(*logical, &import_ci, nullptr, &handle) != VK_SUCCESS) {
+        return {};
+    }
+    // Without an allocation, destroying the buffer leaves the imported memory untouched
+    vk::Buffer buffer(handle, *logical, allocator, nullptr, {}, true, dld);
+
+    const VkMemoryRequirements requirements = logical.GetBufferMemoryRequirements(handle);
+    const std::optional<u32> type = FindType(0, host_types & requirements.memoryTypeBits);
+    if (!type || requirements.size > ci.size) {
+        return {};
+    }
+    const VkImportMemoryHostPointerInfoEXT import_info{
+        .sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT,
+        .pNext = nullptr,
+        .handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT,
+        .pHostPointer = host_pointer,
+    };
+    const VkMemoryAllocateFlagsInfo flags_info = MemoryAllocateFlags(device, &import_info);
+    memory = logical.TryAllocateMemory(VkMemoryAllocateInfo{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .pNext = &flags_info,
+        .allocationSize = ci.size,
+        .memoryTypeIndex = *type,
+    });
+    if (!memory) {
+        return {};
+    }
+    if (dld.vkBindBufferMemory(*logical, handle, *memory, 0) != VK_SUCCESS) {
+        buffer.reset();
+        memory.reset();
+        return {};
+    }
+    return buffer;
+}
+
 MemoryCommit MemoryAllocator::Commit(const VkMemoryRequirements& requirements, MemoryUsage usage) {
     // Find the fastest memory flags we can afford with the current requirements
     const u32 type_mask = requirements.memoryTypeBits;
@@ -289,6 +421,7 @@ MemoryCommit MemoryAllocator::Commit(const VkMemoryRequirements& requirements, M
     }
     // Commit has failed, allocate more memory.
     const u64 chunk_size = AllocationChunkSize(requirements.size);
+    LogFragmentation(requirements.size);
     if (!TryAllocMemory(flags, type_mask, chunk_size)) {
         // TODO(Rodrigo): Handle out of memory situations in some way like flushing to guest memory.
         throw vk::Exception(VK_ERROR_OUT_OF_DEVICE_MEMORY);
@@ -300,9 +433,10 @@ MemoryCommit MemoryAllocator::Commit(const VkMemoryRequirements& requirements, M
 
 bool MemoryAllocator::TryAllocMemory(VkMemoryPropertyFlags flags, u32 type_mask, u64 size) {
     const u32 type = FindType(flags, type_mask).value();
+    const VkMemoryAllocateFlagsInfo flags_info = MemoryAllocateFlags(device, nullptr);
     vk::DeviceMemory memory = device.GetLogical().TryAllocateMemory({
         .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-        .pNext = nullptr,
+        .pNext = &flags_info,
         .allocationSize = size,
         .memoryTypeIndex = type,
     });
@@ -320,6 +454,25 @@ bool MemoryAllocator::TryAllocMemory(VkMemoryPropertyFlags flags, u32 type_mask,
     return true;
 }
 
+void MemoryAllocator::LogFragmentation(u64 required_size) const {
+    u64 free_bytes = 0;
+    u64 largest_free = 0;
+    for (const auto& allocation : allocations) {
+        free_bytes += allocation->FreeBytes();
+        largest_free = std::max(largest_free, allocation->LargestFreeRange());
+    }
+    if (free_bytes == 0) {
+        return;
+    }
+    // Share of the free memory that is not in the largest free range, near 1 when a new chunk is
+    // only needed because the free memory is split in small pieces
+    const double fragmentation =
+        1.0 - static_cast<double>(largest_free) / static_cast<double>(free_bytes);
+    LOG_DEBUG(Render_Vulkan,
+              "Allocating a new chunk for {} bytes, {} KiB free in {} chunks, {:.0f}% fragmented",
+              required_size, free_bytes >> 10, allocations.size(), fragmentation * 100.0);
+}
+
 void MemoryAllocator::ReleaseMemory(MemoryAllocation* alloc) {
     const auto it = std::ranges::find(allocations, alloc, &std::unique_ptr<MemoryAllocation>::get);
     ASSERT(it != allocations.end());
@@ -99,8 +99,26 @@ public:
 
     vk::Image CreateImage(const VkImageCreateInfo& ci) const;
 
+    /// Creates an image without backing memory, for sparse images bound with Commit.
+    vk::Image CreateSparseImage(const VkImageCreateInfo& ci) const;
+
+    /// Creates a buffer without backing memory, for sparse buffers bound with Commit.
+    vk::Buffer CreateSparseBuffer(const VkBufferCreateInfo& ci) const;
+
     vk::Buffer CreateBuffer(const VkBufferCreateInfo& ci, MemoryUsage usage) const;
 
+    /**
+     * Creates a buffer backed by host memory imported through VK_EXT_external_memory_host.
+     *
+     * @param ci           Buffer create info, the size must be aligned to the import alignment.
+     * @param host_pointer Host allocation to import, aligned to the import alignment.
+     * @param memory       Receives the imported memory, it has to outlive the returned buffer.
+     *
+     * @returns The imported buffer, or a null buffer when the host pointer can't be imported.
+     */
+    vk::Buffer ImportHostBuffer(const VkBufferCreateInfo& ci, void* host_pointer,
+                                vk::DeviceMemory& memory) const;
+
     /**
      * Commits a memory with the specified requirements.
      *
@@ -121,6 +139,9 @@ private:
     /// Releases a chunk of memory.
     void ReleaseMemory(MemoryAllocation* alloc);
 
+    /// Logs how fragmented the free memory of the current allocations is.
+    void LogFragmentation(u64 required_size) const;
+
     /// Tries to allocate a memory commit.
     std::optional<MemoryCommit> TryCommit(const VkMemoryRequirements& requirements,
                                           VkMemoryPropertyFlags flags);
@@ -45,14 +45,29 @@ void ConfigureDebug::SetConfiguration() {
     ui->fs_access_log->setChecked(Settings::values.enable_fs_access_log.GetValue());
     ui->reporting_services->setChecked(Settings::values.reporting_services.GetValue());
     ui->dump_audio_commands->setChecked(Settings::values.dump_audio_commands.GetValue());
+    ui->capture_audio_renderer->setEnabled(runtime_lock);
+    ui->capture_audio_renderer->setChecked(Settings::values.capture_audio_renderer.GetValue());
     ui->quest_flag->setChecked(Settings::values.quest_flag.GetValue());
     ui->use_debug_asserts->setChecked(Settings::values.use_debug_asserts.GetValue());
+    ui->record_scheduler_lock_stats->setEnabled(runtime_lock);
+    ui->record_scheduler_lock_stats->setChecked(
+        Settings::values.record_scheduler_lock_stats.GetValue());
+    ui->record_svc_stats->setEnabled(runtime_lock);
+    ui->record_svc_stats->setChecked(Settings::values.record_svc_stats.GetValue());
+    ui->record_kernel_trace->setEnabled(runtime_lock);
+    ui->record_kernel_trace->setChecked(Settings::values.record_kernel_trace.GetValue());
+    ui->record_microprofile_trace->setEnabled(runtime_lock);
+    ui->record_microprofile_trace->setChecked(
+        Settings::values.record_microprofile_trace.GetValue());
+    ui->record_input_latency->setChecked(Settings::values.record_input_latency.GetValue());
     ui->use_auto_stub->setChecked(Settings::values.use_auto_stub.GetValue());
     ui->enable_all_controllers->setChecked(Settings::values.enable_all_controllers.GetValue());
     ui->enable_renderdoc_hotkey->setEnabled(runtime_lock);
     ui->enable_renderdoc_hotkey->setChecked(Settings::values.enable_renderdoc_hotkey.GetValue());
     ui->disable_buffer_reorder->setEnabled(runtime_lock);
     ui->disable_buffer_reorder->setChecked(Settings::values.disable_buffer_reorder.GetValue());
+    ui->gpu_pass_timestamps->setEnabled(runtime_lock);
+    ui->gpu_pass_timestamps->setChecked(Settings::values.gpu_pass_timestamps.GetValue());
     ui->enable_graphics_debugging->setEnabled(runtime_lock);
     ui->enable_graphics_debugging->setChecked(Settings::values.renderer_debug.GetValue());
     ui->enable_shader_feedback->setEnabled(runtime_lock);
@@ -65,6 +80,13 @@ void ConfigureDebug::SetConfiguration() {
     ui->dump_shaders->setChecked(Settings::values.dump_shaders.GetValue());
     ui->dump_macros->setEnabled(runtime_lock);
     ui->dump_macros->setChecked(Settings::values.dump_macros.GetValue());
+    ui->profile_macros->setEnabled(runtime_lock);
+    ui->profile_macros->setChecked(Settings::values.profile_macros.GetValue());
+    ui->dump_texture_cache_stats->setEnabled(runtime_lock);
+    ui->dump_texture_cache_stats->setChecked(
+        Settings::values.dump_texture_cache_stats.GetValue());
+    ui->capture_gpu_commands->setEnabled(runtime_lock);
+    ui->capture_gpu_commands->setChecked(Settings::values.capture_gpu_commands.GetValue());
     ui->disable_macro_jit->setEnabled(runtime_lock);
     ui->disable_macro_jit->setChecked(Settings::values.disable_macro_jit.GetValue());
     ui->disable_macro_hle->setEnabled(runtime_lock);
@@ -92,18 +114,28 @@ void ConfigureDebug::ApplyConfiguration() {
     Settings::values.enable_fs_access_log = ui->fs_access_log->isChecked();
     Settings::values.reporting_services = ui->reporting_services->isChecked();
     Settings::values.dump_audio_commands = ui->dump_audio_commands->isChecked();
+    Settings::values.capture_audio_renderer = ui->capture_audio_renderer->isChecked();
     Settings::values.quest_flag = ui->quest_flag->isChecked();
     Settings::values.use_debug_asserts = ui->use_debug_asserts->isChecked();
+    Settings::values.record_scheduler_lock_stats = ui->record_scheduler_lock_stats->isChecked();
+    Settings::values.record_svc_stats = ui->record_svc_stats->isChecked();
+    Settings::values.record_kernel_trace = ui->record_kernel_trace->isChecked();
+    Settings::values.record_microprofile_trace = ui->record_microprofile_trace->isChecked();
+    Settings::values.record_input_latency = ui->record_input_latency->isChecked();
     Settings::values.use_auto_stub = ui->use_auto_stub->isChecked();
     Settings::values.enable_all_controllers = ui->enable_all_controllers->isChecked();
     Settings::values.renderer_debug = ui->enable_graphics_debugging->isChecked();
     Settings::values.enable_renderdoc_hotkey = ui->enable_renderdoc_hotkey->isChecked();
     Settings::values.disable_buffer_reorder = ui->disable_buffer_reorder->isChecked();
+    Settings::values.gpu_pass_timestamps = ui->gpu_pass_timestamps->isChecked();
     Settings::values.renderer_shader_feedback = ui->enable_shader_feedback->isChecked();
     Settings::values.cpu_debug_mode = ui->enable_cpu_debugging->isChecked();
     Settings::values.enable_nsight_aftermath = ui->enable_nsight_aftermath->isChecked();
     Settings::values.dump_shaders = ui->dump_shaders->isChecked();
     Settings::values.dump_macros = ui->dump_macros->isChecked();
+    Settings::values.profile_macros = ui->profile_macros->isChecked();
+    Settings::values.dump_texture_cache_stats = ui->dump_texture_cache_stats->isChecked();
+    Settings::values.capture_gpu_commands = ui->capture_gpu_commands->isChecked();
     Settings::values.disable_shader_loop_safety_checks =
         ui->disable_loop_safety_checks->isChecked();
     Settings::values.disable_macro_jit = ui->disable_macro_jit->isChecked();
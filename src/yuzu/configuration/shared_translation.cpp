@@ -50,6 +50,23 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     INSERT(Settings, audio_muted, tr("Mute audio"), QStringLiteral());
     INSERT(Settings, volume, tr("Volume:"), QStringLiteral());
     INSERT(Settings, dump_audio_commands, QStringLiteral(), QStringLiteral());
+    INSERT(Settings, capture_audio_renderer, QStringLiteral(), QStringLiteral());
+    INSERT(Settings, audio_low_latency, tr("Low latency audio"),
+           tr("Requests the smallest buffer the audio backend can play back reliably and keeps as "
+              "few buffers queued as possible, adding more when the audio crackles.\nLowers the "
+              "delay of sounds at the cost of more underruns on slow systems."));
+    INSERT(Settings, parallel_voice_decoding, tr("Decode voices on multiple threads"),
+           tr("Decodes and resamples the voices of a frame on worker threads before mixing "
+              "them.\nLowers the audio renderer's time per frame in games that play many "
+              "sounds at once."));
+    INSERT(Settings, adpcm_decode_cache, tr("Cache decoded ADPCM audio"),
+           tr("Keeps the decoded samples of ADPCM sounds, so looping and repeated sounds are only "
+              "decoded once.\nUses up to 64 MB of memory."));
+    INSERT(Settings, measured_voice_drop, tr("Drop voices by measured processing time"),
+           tr("When a game lets the audio renderer drop voices to stay within its time budget, "
+              "decides which ones by how long this computer takes to process them, rather than "
+              "the console's estimates.\nKeeps more voices playing on fast systems, and drops "
+              "them sooner on slow ones."));
     INSERT(UISettings, mute_when_in_background, tr("Mute audio when in background"),
            QStringLiteral());
 
@@ -65,6 +82,11 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
            "to let big texture mods fit in emulated RAM.\nEnabling it will increase memory "
            "use. It is not recommended to enable unless a specific game with a texture mod needs "
            "it."));
+    INSERT(Settings, use_huge_pages, tr("Use Huge Pages"),
+           tr("Backs emulated RAM with 2MB host pages, reducing TLB misses.\nRequires transparent "
+              "huge pages for shared memory on Linux. When fastmem is disabled, pages reserved "
+              "through vm.nr_hugepages on Linux or the \"Lock pages in memory\" right on Windows "
+              "are used instead.\nTakes effect on the next boot."));
     INSERT(Settings, use_speed_limit, QStringLiteral(), QStringLiteral());
     INSERT(Settings, speed_limit, tr("Limit Speed Percent"),
            tr("Controls the game's maximum rendering speed, but it’s up to each game if it runs "
@@ -123,7 +145,12 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
            tr("Forces the game to render at a different resolution.\nHigher resolutions require "
               "much more VRAM and bandwidth.\n"
               "Options lower than 1X can cause rendering issues."));
-    INSERT(Settings, scaling_filter, tr("Window Adapting Filter:"), QStringLiteral());
+    INSERT(Settings, use_dynamic_resolution, QStringLiteral(), QStringLiteral());
+    INSERT(Settings, dynamic_resolution_target, tr("Dynamic Resolution Target FPS"),
+           tr("Drops back to native resolution while the GPU can't render frames at this rate, "
+              "and returns to the chosen resolution once it can.
+Only applies to resolutions "
+              "above 1X on Vulkan. Takes effect on the next boot."));
     INSERT(Settings, fsr_sharpening_slider, tr("FSR Sharpness:"),
            tr("Determines how sharpened the image will look while using FSR’s dynamic contrast."));
     INSERT(Settings, anti_aliasing, tr("Anti-Aliasing Method:"),
@@ -143,6 +170,10 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
            tr("Allows saving shaders to storage for faster loading on following game "
               "boots.\nDisabling "
               "it is only intended for debugging."));
+    INSERT(Settings, use_disk_texture_cache, tr("Use disk texture cache"),
+           tr("Saves textures decoded on the CPU (ASTC and BCn on GPUs without native "
+              "support) to storage,\nso they are loaded instead of decoded again on following "
+              "game boots."));
     INSERT(
         Settings, use_asynchronous_gpu_emulation, tr("Use asynchronous GPU emulation"),
         tr("Uses an extra CPU thread for rendering.\nThis option should always remain enabled."));
@@ -181,8 +212,19 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     INSERT(Settings, bg_blue, QStringLiteral(), QStringLiteral());
 
     // Renderer (Advanced Graphics)
-    INSERT(Settings, async_presentation, tr("Enable asynchronous presentation (Vulkan only)"),
-           tr("Slightly improves performance by moving presentation to a separate CPU thread."));
+    INSERT(Settings, async_presentation, tr("Enable asynchronous presentation"),
+           tr("Slightly improves performance by moving presentation to a separate CPU thread, so "
+              "rendering doesn't wait for vertical sync."));
+    INSERT(Settings, use_async_present_queue, tr("Use a separate present queue (Vulkan only)"),
+           tr("Renders post-processing and presentation on a second GPU queue when available, so "
+              "the next frame can start rendering while the last one is presented."));
+    INSERT(Settings, use_low_latency_mode, tr("Low latency mode (Vulkan only)"),
+           tr("Waits for frames to be displayed before starting new ones, and delays the start of "
+              "emulated frames by the time spent waiting.\nReduces input latency, especially with "
+              "FIFO (VSync), but can lower performance. Requires VK_KHR_present_wait."));
+    INSERT(Settings, max_frames_in_flight, tr("Maximum frames in flight:"),
+           tr("How many frames can be queued for display in low latency mode.\nLower values "
+              "reduce input latency but are more likely to miss refreshes."));
     INSERT(
         Settings, renderer_force_max_clock, tr("Force maximum clocks (Vulkan only)"),
         tr("Runs work in the background while waiting for graphics commands to keep the GPU from "
@@ -219,8 +261,34 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     INSERT(Settings, use_video_framerate, tr("Sync to framerate of video playback"),
            tr("Run the game at normal speed during video playback, even when the framerate is "
               "unlocked."));
+    INSERT(Settings, use_asynchronous_nvdec, tr("Decode videos asynchronously"),
+           tr("Decodes and converts video frames on their own threads, so the next frame decodes "
+              "while the previous one is converted.
+This can reduce stutter during video "
+              "playback."));
     INSERT(Settings, barrier_feedback_loops, tr("Barrier feedback loops"),
            tr("Improves rendering of transparency effects in specific games."));
+    INSERT(Settings, use_host_memory_import, tr("Import guest memory (Vulkan Only)"),
+           tr("Lets the GPU read buffers straight from guest memory instead of copying them "
+              "first.\nRequires VK_EXT_external_memory_host. It avoids buffer uploads, but "
+              "GPU reads from host memory can be slower on discrete GPUs."));
+    INSERT(Settings, use_reserved_buffers, tr("Grow buffers in place (Vulkan Only)"),
+           tr("Reserves address space for buffers that keep growing, so they can be extended "
+              "without copying their contents.\nRequires sparse buffer support."));
+    INSERT(Settings, use_predicted_queries, tr("Predict query results (Vulkan Only)"),
+           tr("Reads of pending occlusion and transform feedback queries return the last "
+              "written value instead of waiting on the GPU, and unresolved conditional rendering "
+              "passes.\nAvoids GPU thread stalls, but can cause flickering in some games."));
+    INSERT(Settings, use_parallel_command_recording,
+           tr("Record command buffers in parallel (Vulkan Only)"),
+           tr("Spreads the recording of Vulkan command buffers across several worker threads, "
+              "one submission per thread.\nImproves performance in draw heavy games on CPUs "
+              "with many cores."));
+    INSERT(Settings, use_storage_buffer_pointers,
+           tr("Access storage buffers through addresses (Vulkan Only)"),
+           tr("Shaders read storage buffers through device addresses from a table updated once "
+              "per draw, instead of rebinding every storage buffer descriptor.\nRequires buffer "
+              "device address support."));
 
     // Renderer (Debug)
 
@@ -399,6 +467,7 @@ std::unique_ptr<ComboboxTranslationMap> ComboboxEnumeration(QWidget* parent) {
                               PAIR(AntiAliasing, None, tr("None")),
                               PAIR(AntiAliasing, Fxaa, tr("FXAA")),
                               PAIR(AntiAliasing, Smaa, tr("SMAA")),
+                              PAIR(AntiAliasing, Taa, tr("TAA")),
                           }});
     translations->insert({Settings::EnumMetadata<Settings::AspectRatio>::Index(),
                           {
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+#include <QString>
+
+#include "common/common_funcs.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "yuzu/game_list_index.h"
+
+namespace {
+
+constexpr u32 IndexMagic = Common::MakeMagic('Y', 'G', 'L', 'I');
+
+/// Bump when the metadata read from the files or the layout of the index changes
+constexpr u32 IndexVersion = 1;
+
+} // Anonymous namespace
+
+GameListIndex::GameListIndex(std::filesystem::path path_) : path{std::move(path_)} {}
+
+GameListIndex::~GameListIndex() = default;
+
+void GameListIndex::Load() {
+    entries.clear();
+    used_paths.clear();
+    dirty = false;
+
+    QFile file{QString::fromStdString(Common::FS::PathToUTF8String(path))};
+    if (!file.open(QFile::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream{&file};
+    quint32 magic{};
+    quint32 version{};
+    quint64 num_entries{};
+    stream >> magic >> version >> num_entries;
+    if (magic != IndexMagic || version != IndexVersion) {
+        return;
+    }
+
+    for (quint64 i = 0; i < num_entries && stream.status() == QDataStream::Ok; ++i) {
+        QString file_path;
+        quint64 size{};
+        qint64 modified_time{};
+        quint32 file_type{};
+        bool has_program_id{};
+        quint64 program_id{};
+        quint32 num_programs{};
+        stream >> file_path >> size >> modified_time >> file_type >> has_program_id >>
+            program_id >> num_programs;
+
+        Entry entry{
+            .size = size,
+            .modified_time = modified_time,
+            .file_type = static_cast<Loader::FileType>(file_type),
+        };
+        if (has_program_id) {
+            entry.program_id = program_id;
+        }
+        for (quint32 j = 0; j < num_programs && stream.status() == QDataStream::Ok; ++j) {
+            quint64 id{};
+            QString name;
+            QByteArray icon;
+            stream >> id >> name >> icon;
+            entry.programs.push_back({
+                .program_id = id,
+                .name = name.toStdString(),
+                .icon = std::vector<u8>(icon.begin(), icon.end()),
+            });
+        }
+        entries.insert_or_assign(file_path.toStdString(), std::move(entry));
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        LOG_WARNING(Frontend, "Game list index is corrupted, rebuilding it");
+        entries.clear();
+    }
+}
+
+void GameListIndex::Save() {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (used_paths.contains(it->first)) {
+            ++it;
+        } else {
+            it = entries.erase(it);
+            dirty = true;
+        }
+    }
+    if (!dirty) {
+        return;
+    }
+
+    void(Common::FS::CreateParentDirs(path));
+
+    QSaveFile file{QString::fromStdString(Common::FS::PathToUTF8String(path))};
+    if (!file.open(QFile::WriteOnly)) {
+        LOG_ERROR(Frontend, "Failed to open the game list index for writing");
+        return;
+    }
+
+    QDataStream stream{&file};
+    stream << IndexMagic << IndexVersion << static_cast<quint64>(entries.size());
+    for (const auto& [file_path, entry] : entries) {
+        stream << QString::fromStdString(file_path) << static_cast<quint64>(entry.size)
+               << static_cast<qint64>(entry.modified_time) << static_cast<quint32>(entry.file_type)
+               << entry.program_id.has_value() << static_cast<quint64>(entry.program_id.value_or(0))
+               << static_cast<quint32>(entry.programs.size());
+        for (const auto& program : entry.programs) {
+            stream << static_cast<quint64>(program.program_id)
+                   << QString::fromStdString(program.name)
+                   << QByteArray(reinterpret_cast<const char*>(program.icon.data()),
+                                 static_cast<qsizetype>(program.icon.size()));
+        }
+    }
+
+    if (!file.commit()) {
+        LOG_ERROR(Frontend, "Failed to write the game list index");
+        return;
+    }
+    dirty = false;
+}
+
+const GameListIndex::Entry* GameListIndex::Find(const std::string& file_path, u64 size,
+                                                s64 modified_time) {
+    const auto it = entries.find(file_path);
+    if (it == entries.end() || it->second.size != size ||
+        it->second.modified_time != modified_time) {
+        return nullptr;
+    }
+    used_paths.insert(file_path);
+    return &it->second;
+}
+
+void GameListIndex::Insert(const std::string& file_path, Entry entry) {
+    entries.insert_or_assign(file_path, std::move(entry));
+    used_paths.insert(file_path);
+    dirty = true;
+}
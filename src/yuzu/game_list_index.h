@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/loader/loader.h"
+
+/**
+ * Metadata of the files found in the game directories, saved between refreshes of the game list.
+ * A file is only opened and parsed again when its size or modification time changed.
+ */
+class GameListIndex {
+public:
+    struct Program {
+        u64 program_id;
+        std::string name;
+        std::vector<u8> icon;
+    };
+
+    struct Entry {
+        u64 size{};
+        s64 modified_time{};
+        Loader::FileType file_type{Loader::FileType::Unknown};
+
+        /// Result of ReadProgramId on the file, if it succeeded
+        std::optional<u64> program_id;
+
+        /// Programs shown in the game list for the file
+        std::vector<Program> programs;
+    };
+
+    explicit GameListIndex(std::filesystem::path path);
+    ~GameListIndex();
+
+    /// Reads the saved index, does nothing if it doesn't exist or is outdated
+    void Load();
+
+    /// Saves the index if it changed, dropping the files that weren't looked up since Load
+    void Save();
+
+    /// Returns the saved metadata of a file if it's still up to date, nullptr otherwise
+    [[nodiscard]] const Entry* Find(const std::string& file_path, u64 size, s64 modified_time);
+
+    /// Saves the metadata of a file that was parsed
+    void Insert(const std::string& file_path, Entry entry);
+
+private:
+    std::filesystem::path path;
+    std::unordered_map<std::string, Entry> entries;
+    std::unordered_set<std::string> used_paths;
+    bool dirty{};
+};
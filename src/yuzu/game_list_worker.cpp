@@ -1,11 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <QDateTime>
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
@@ -13,6 +17,8 @@
 
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/task_pool.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/content_archive.h"
@@ -25,6 +31,7 @@
 #include "core/loader/loader.h"
 #include "yuzu/compatibility_list.h"
 #include "yuzu/game_list.h"
+#include "yuzu/game_list_index.h"
 #include "yuzu/game_list_p.h"
 #include "yuzu/game_list_worker.h"
 #include "yuzu/uisettings.h"
@@ -191,12 +198,19 @@ QString FormatPatchNameVersions(const FileSys::PatchManager& patch_manager,
     return out;
 }
 
+QString GetPatchVersions(const FileSys::PatchManager& patch, Loader::AppLoader& loader) {
+    return GetGameListCachedObject(
+        fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
+            return FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
+        });
+}
+
 QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::string& name,
                                         const std::size_t size, const std::vector<u8>& icon,
-                                        Loader::AppLoader& loader, u64 program_id,
+                                        Loader::FileType file_type, u64 program_id,
                                         const CompatibilityList& compatibility_list,
                                         const PlayTime::PlayTimeManager& play_time_manager,
-                                        const FileSys::PatchManager& patch) {
+                                        const QString& patch_versions) {
     const auto it = FindMatchingCompatibilityEntry(compatibility_list, program_id);
 
     // The game list uses this as compatibility number for untested games
@@ -205,7 +219,6 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
         compatibility = it->second.first;
     }
 
-    const auto file_type = loader.GetFileType();
     const auto file_type_string = QString::fromStdString(Loader::GetFileTypeString(file_type));
 
     QList<QStandardItem*> list{
@@ -216,15 +229,89 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
         new GameListItemSize(size),
         new GameListItemPlayTime(play_time_manager.GetPlayTime(program_id)),
     };
-
-    const auto patch_versions = GetGameListCachedObject(
-        fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
-            return FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
-        });
     list.insert(2, new GameListItem(patch_versions));
 
     return list;
 }
+
+/// Size and modification time of a file, an index entry is only used while both still match
+std::pair<u64, s64> GetFileStamp(const std::string& physical_name) {
+    const QFileInfo info{QString::fromStdString(physical_name)};
+    return {static_cast<u64>(info.size()), info.lastModified().toMSecsSinceEpoch()};
+}
+
+struct ParsedFile {
+    GameListIndex::Entry entry;
+
+    /// Patch versions of the programs, only filled in when the file was parsed in this scan
+    std::vector<QString> patch_versions;
+
+    /// Whether the entry should be saved. Files that failed to parse, usually because of missing
+    /// keys, are parsed again on the next scan.
+    bool cacheable{};
+    bool parsed{};
+};
+
+/// Reads everything the game list shows about a file. Runs on several threads at once, the
+/// content provider is only read and the containers' tickets were already added while filling it.
+void ParseGameFile(Core::System& system, const FileSys::VirtualFile& file, ParsedFile& out,
+                   std::mutex& patch_versions_mutex) {
+    out.parsed = true;
+
+    auto loader = Loader::GetLoader(system, file);
+    if (!loader) {
+        out.cacheable = true;
+        return;
+    }
+
+    const auto file_type = loader->GetFileType();
+    out.entry.file_type = file_type;
+    if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
+        out.cacheable = file_type == Loader::FileType::Unknown;
+        return;
+    }
+
+    u64 program_id = 0;
+    const auto res2 = loader->ReadProgramId(program_id);
+    if (res2 == Loader::ResultStatus::Success) {
+        out.entry.program_id = program_id;
+    }
+
+    std::vector<u64> program_ids;
+    loader->ReadProgramIds(program_ids);
+
+    bool success = res2 == Loader::ResultStatus::Success;
+    const auto read_program = [&](Loader::AppLoader& program_loader, u64 id) {
+        GameListIndex::Program program{.program_id = id, .name = " "};
+        success &= program_loader.ReadIcon(program.icon) == Loader::ResultStatus::Success;
+        success &= program_loader.ReadTitle(program.name) == Loader::ResultStatus::Success;
+
+        const FileSys::PatchManager patch{id, system.GetFileSystemController(),
+                                          system.GetContentProvider()};
+        {
+            // Files of the same title share the cached patch versions
+            std::scoped_lock lk{patch_versions_mutex};
+            out.patch_versions.push_back(GetPatchVersions(patch, program_loader));
+        }
+        out.entry.programs.push_back(std::move(program));
+    };
+
+    if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
+        (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
+        for (const auto id : program_ids) {
+            const auto program_loader = Loader::GetLoader(system, file, id);
+            if (!program_loader) {
+                success = false;
+                continue;
+            }
+            read_program(*program_loader, id);
+        }
+    } else {
+        read_program(*loader, program_id);
+    }
+
+    out.cacheable = success;
+}
 } // Anonymous namespace
 
 GameListWorker::GameListWorker(FileSys::VirtualFilesystem vfs_,
@@ -328,107 +415,166 @@ void GameListWorker::AddTitlesToGameList(GameListDir* parent_dir) {
             GetMetadataFromControlNCA(patch, *control, icon, name);
         }
 
-        auto entry = MakeGameListEntry(file->GetFullPath(), name, file->GetSize(), icon, *loader,
-                                       program_id, compatibility_list, play_time_manager, patch);
+        auto entry = MakeGameListEntry(file->GetFullPath(), name, file->GetSize(), icon,
+                                       loader->GetFileType(), program_id, compatibility_list,
+                                       play_time_manager, GetPatchVersions(patch, *loader));
         RecordEvent([=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
     }
 }
 
-void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
-                                    GameListDir* parent_dir) {
-    const auto callback = [this, target, parent_dir](const std::filesystem::path& path) -> bool {
+void GameListWorker::AddFilesToProvider(const std::vector<std::string>& files) {
+    for (const auto& physical_name : files) {
         if (stop_requested) {
-            // Breaks the callback loop.
-            return false;
+            return;
         }
 
-        const auto physical_name = Common::FS::PathToUTF8String(path);
-        const auto is_dir = Common::FS::IsDir(path);
-
-        if (!is_dir &&
-            (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name))) {
-            const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
-            if (!file) {
-                return true;
-            }
+        const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
+        if (!file) {
+            continue;
+        }
 
-            auto loader = Loader::GetLoader(system, file);
+        Loader::FileType file_type{};
+        std::optional<u64> program_id;
+        const auto [size, modified_time] = GetFileStamp(physical_name);
+        if (const auto* const entry = index ? index->Find(physical_name, size, modified_time)
+                                            : nullptr) {
+            file_type = entry->file_type;
+            program_id = entry->program_id;
+        } else {
+            const auto loader = Loader::GetLoader(system, file);
             if (!loader) {
-                return true;
+                continue;
             }
 
-            const auto file_type = loader->GetFileType();
-            if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
-                return true;
+            file_type = loader->GetFileType();
+            u64 id = 0;
+            if (loader->ReadProgramId(id) == Loader::ResultStatus::Success) {
+                program_id = id;
             }
+        }
 
-            u64 program_id = 0;
-            const auto res2 = loader->ReadProgramId(program_id);
-
-            if (target == ScanTarget::FillManualContentProvider) {
-                if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
-                    provider->AddEntry(FileSys::TitleType::Application,
-                                       FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
-                                       program_id, file);
-                } else if (res2 == Loader::ResultStatus::Success &&
-                           (file_type == Loader::FileType::XCI ||
-                            file_type == Loader::FileType::NSP)) {
-                    const auto nsp = file_type == Loader::FileType::NSP
-                                         ? std::make_shared<FileSys::NSP>(file)
-                                         : FileSys::XCI{file}.GetSecurePartitionNSP();
-                    for (const auto& title : nsp->GetNCAs()) {
-                        for (const auto& entry : title.second) {
-                            provider->AddEntry(entry.first.first, entry.first.second, title.first,
-                                               entry.second->GetBaseFile());
-                        }
-                    }
+        if (!program_id) {
+            continue;
+        }
+
+        if (file_type == Loader::FileType::NCA) {
+            provider->AddEntry(FileSys::TitleType::Application,
+                               FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
+                               *program_id, file);
+        } else if (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP) {
+            const auto nsp = file_type == Loader::FileType::NSP
+                                 ? std::make_shared<FileSys::NSP>(file)
+                                 : FileSys::XCI{file}.GetSecurePartitionNSP();
+            for (const auto& title : nsp->GetNCAs()) {
+                for (const auto& entry : title.second) {
+                    provider->AddEntry(entry.first.first, entry.first.second, title.first,
+                                       entry.second->GetBaseFile());
                 }
-            } else {
-                std::vector<u64> program_ids;
-                loader->ReadProgramIds(program_ids);
+            }
+        }
+    }
+}
 
-                if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
-                    (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
-                    for (const auto id : program_ids) {
-                        loader = Loader::GetLoader(system, file, id);
-                        if (!loader) {
-                            continue;
-                        }
+void GameListWorker::AddFilesToGameList(const std::vector<std::string>& files,
+                                        GameListDir* parent_dir) {
+    std::vector<ParsedFile> parsed_files(files.size());
+    std::vector<size_t> outdated_files;
+    for (size_t i = 0; i < files.size(); ++i) {
+        auto& parsed_file = parsed_files[i];
+        const auto [size, modified_time] = GetFileStamp(files[i]);
+        if (const auto* const entry = index ? index->Find(files[i], size, modified_time)
+                                            : nullptr) {
+            parsed_file.entry = *entry;
+        } else {
+            parsed_file.entry.size = size;
+            parsed_file.entry.modified_time = modified_time;
+            outdated_files.push_back(i);
+        }
+    }
 
-                        std::vector<u8> icon;
-                        [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
+    std::mutex patch_versions_mutex;
+    const auto parse_file = [&](size_t i) {
+        if (stop_requested) {
+            return;
+        }
+        const size_t file_index = outdated_files[i];
+        const auto file = vfs->OpenFile(files[file_index], FileSys::OpenMode::Read);
+        if (file) {
+            ParseGameFile(system, file, parsed_files[file_index], patch_versions_mutex);
+        }
+    };
+    if (outdated_files.size() > 1) {
+        Common::TaskGroup workers{Common::TaskPriority::Background};
+        Common::ParallelForEach(workers, outdated_files.size(), parse_file);
+    } else if (!outdated_files.empty()) {
+        parse_file(0);
+    }
 
-                        std::string name = " ";
-                        [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
+    if (stop_requested) {
+        return;
+    }
 
-                        const FileSys::PatchManager patch{id, system.GetFileSystemController(),
-                                                          system.GetContentProvider()};
+    for (size_t i = 0; i < files.size(); ++i) {
+        const auto& physical_name = files[i];
+        const auto& parsed_file = parsed_files[i];
+        const auto& entry = parsed_file.entry;
+        const auto& patch_versions = parsed_file.patch_versions;
+        if (parsed_file.parsed && parsed_file.cacheable && index) {
+            index->Insert(physical_name, entry);
+        }
 
-                        auto entry = MakeGameListEntry(
-                            physical_name, name, Common::FS::GetSize(physical_name), icon, *loader,
-                            id, compatibility_list, play_time_manager, patch);
+        if (entry.file_type == Loader::FileType::Unknown ||
+            entry.file_type == Loader::FileType::Error) {
+            continue;
+        }
 
-                        RecordEvent(
-                            [=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
-                    }
-                } else {
-                    std::vector<u8> icon;
-                    [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
+        for (size_t j = 0; j < entry.programs.size(); ++j) {
+            const auto& program = entry.programs[j];
+            const FileSys::PatchManager patch{program.program_id, system.GetFileSystemController(),
+                                              system.GetContentProvider()};
 
-                    std::string name = " ";
-                    [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
+            // Files found in the index are only opened again when their patches aren't cached
+            QString program_patch_versions;
+            if (j < patch_versions.size()) {
+                program_patch_versions = patch_versions[j];
+            } else {
+                program_patch_versions = GetGameListCachedObject(
+                    fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&] {
+                        const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
+                        const u64 loader_program_id =
+                            entry.programs.size() > 1 ? program.program_id : 0;
+                        const auto loader =
+                            file ? Loader::GetLoader(system, file, loader_program_id) : nullptr;
+                        if (!loader) {
+                            return QString{};
+                        }
+                        return FormatPatchNameVersions(patch, *loader, loader->IsRomFSUpdatable());
+                    });
+            }
 
-                    const FileSys::PatchManager patch{program_id, system.GetFileSystemController(),
-                                                      system.GetContentProvider()};
+            auto list_entry = MakeGameListEntry(
+                physical_name, program.name, entry.size, program.icon, entry.file_type,
+                program.program_id, compatibility_list, play_time_manager, program_patch_versions);
+            RecordEvent([=](GameList* game_list) { game_list->AddEntry(list_entry, parent_dir); });
+        }
+    }
+}
 
-                    auto entry = MakeGameListEntry(
-                        physical_name, name, Common::FS::GetSize(physical_name), icon, *loader,
-                        program_id, compatibility_list, play_time_manager, patch);
+void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
+                                    GameListDir* parent_dir) {
+    std::vector<std::string> files;
+    const auto callback = [this, &files](const std::filesystem::path& path) -> bool {
+        if (stop_requested) {
+            // Breaks the callback loop.
+            return false;
+        }
 
-                    RecordEvent(
-                        [=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
-                }
-            }
+        const auto physical_name = Common::FS::PathToUTF8String(path);
+        const auto is_dir = Common::FS::IsDir(path);
+
+        if (!is_dir &&
+            (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name))) {
+            files.push_back(physical_name);
         } else if (is_dir) {
             watch_list.append(QString::fromStdString(physical_name));
         }
@@ -442,12 +588,26 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
     } else {
         Common::FS::IterateDirEntries(dir_path, callback, Common::FS::DirEntryFilter::File);
     }
+
+    if (target == ScanTarget::FillManualContentProvider) {
+        AddFilesToProvider(files);
+    } else {
+        AddFilesToGameList(files, parent_dir);
+    }
 }
 
 void GameListWorker::run() {
     watch_list.clear();
     provider->ClearAllEntries();
 
+    if (UISettings::values.cache_game_list) {
+        index = std::make_unique<GameListIndex>(
+            Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "game_list" / "index.bin");
+        index->Load();
+    } else {
+        index.reset();
+    }
+
     const auto DirEntryReady = [&](GameListDir* game_list_dir) {
         RecordEvent([=](GameList* game_list) { game_list->AddDirEntry(game_list_dir); });
     };
@@ -480,6 +640,11 @@ void GameListWorker::run() {
         }
     }
 
+    // Entries that weren't looked up are dropped when saving, so only save after a full scan
+    if (index && !stop_requested) {
+        index->Save();
+    }
+
     RecordEvent([this](GameList* game_list) { game_list->DonePopulating(watch_list); });
     processing_completed.Set();
 }
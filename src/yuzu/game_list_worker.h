@@ -7,6 +7,7 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <QList>
 #include <QObject>
@@ -22,6 +23,7 @@ class System;
 }
 
 class GameList;
+class GameListIndex;
 class QStandardItem;
 
 namespace FileSys {
@@ -76,6 +78,12 @@ private:
     void ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
                         GameListDir* parent_dir);
 
+    void AddFilesToProvider(const std::vector<std::string>& files);
+
+    /// Adds the programs in files to the game list, parsing the files missing from the index in
+    /// parallel
+    void AddFilesToGameList(const std::vector<std::string>& files, GameListDir* parent_dir);
+
     std::shared_ptr<FileSys::VfsFilesystem> vfs;
     FileSys::ManualContentProvider* provider;
     QVector<UISettings::GameDir>& game_dirs;
@@ -84,6 +92,9 @@ private:
 
     QStringList watch_list;
 
+    /// Metadata saved from previous scans, only used when caching the game list is enabled
+    std::unique_ptr<GameListIndex> index;
+
     std::mutex lock;
     std::condition_variable cv;
     std::deque<std::function<void(GameList*)>> queued_events;
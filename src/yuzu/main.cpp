@@ -137,6 +137,8 @@ static FileSys::VirtualFile VfsDirectoryCreateFileWrapper(const FileSys::Virtual
 #include "ui_main.h"
 #include "util/overlay_dialog.h"
 #include "video_core/gpu.h"
+#include "video_core/memory_stats.h"
+#include "video_core/pipeline_stats.h"
 #include "video_core/renderer_base.h"
 #include "video_core/shader_notify.h"
 #include "yuzu/about_dialog.h"
@@ -1036,6 +1038,14 @@ void GMainWindow::InitializeWidgets() {
 
     shader_building_label = new QLabel();
     shader_building_label->setToolTip(tr("The amount of shaders currently being built"));
+    texture_cache_label = new QLabel();
+    texture_cache_label->setToolTip(
+        tr("How many textures decoded on the CPU were loaded from the disk texture cache, and "
+           "how many had to be decoded."));
+    vram_label = new QLabel();
+    vram_label->setToolTip(
+        tr("Video memory used by the emulator against the budget given by the driver, and how "
+           "fast cached textures and buffers are being evicted to stay within it."));
     res_scale_label = new QLabel();
     res_scale_label->setToolTip(tr("The current selected resolution scaling multiplier."));
     emu_speed_label = new QLabel();
@@ -1050,8 +1060,8 @@ void GMainWindow::InitializeWidgets() {
         tr("Time taken to emulate a Switch frame, not counting framelimiting or v-sync. For "
            "full-speed emulation this should be at most 16.67 ms."));
 
-    for (auto& label : {shader_building_label, res_scale_label, emu_speed_label, game_fps_label,
-                        emu_frametime_label}) {
+    for (auto& label : {shader_building_label, texture_cache_label, vram_label, res_scale_label,
+                        emu_speed_label, game_fps_label, emu_frametime_label}) {
         label->setVisible(false);
         label->setFrameStyle(QFrame::NoFrame);
         label->setContentsMargins(4, 0, 4, 0);
@@ -1593,6 +1603,7 @@ void GMainWindow::ConnectMenuEvents() {
     connect_menu(ui->action_Load_Mii_Edit, &GMainWindow::OnMiiEdit);
     connect_menu(ui->action_Open_Controller_Menu, &GMainWindow::OnOpenControllerMenu);
     connect_menu(ui->action_Capture_Screenshot, &GMainWindow::OnCaptureScreenshot);
+    connect_menu(ui->action_Dump_Pipeline_Statistics, &GMainWindow::OnDumpPipelineStatistics);
 
     // TAS
     connect_menu(ui->action_TAS_Start, &GMainWindow::OnTasStartStop);
@@ -1619,6 +1630,7 @@ void GMainWindow::UpdateMenuState() {
         ui->action_Report_Compatibility,
         ui->action_Load_Amiibo,
         ui->action_Pause,
+        ui->action_Dump_Pipeline_Statistics,
     };
 
     const std::array applet_actions{ui->action_Load_Album,
@@ -2188,6 +2200,8 @@ void GMainWindow::OnEmulationStopped() {
     // Disable status bar updates
     status_bar_update_timer.stop();
     shader_building_label->setVisible(false);
+    texture_cache_label->setVisible(false);
+    vram_label->setVisible(false);
     res_scale_label->setVisible(false);
     emu_speed_label->setVisible(false);
     game_fps_label->setVisible(false);
@@ -4518,6 +4532,37 @@ void GMainWindow::OnCaptureScreenshot() {
     render_window->CaptureScreenshot(filename);
 }
 
+void GMainWindow::OnDumpPipelineStatistics() {
+    if (emu_thread == nullptr) {
+        return;
+    }
+    const auto& pipeline_stats = system->GPU().PipelineStats();
+    if (pipeline_stats.IsEmpty()) {
+        QMessageBox::information(
+            this, tr("Dump Pipeline Statistics"),
+            tr("No pipeline statistics have been collected.\n\nThey are only available with the "
+               "Vulkan renderer when Enable Shader Feedback is checked in the debug settings, "
+               "on drivers supporting VK_KHR_pipeline_executable_properties."));
+        return;
+    }
+    const auto log_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::LogDir);
+    if (!Common::FS::CreateDirs(log_dir)) {
+        return;
+    }
+    const u64 title_id = system->GetApplicationProcessProgramID();
+    const auto date =
+        QDateTime::currentDateTime().toString(QStringLiteral("yyyy-MM-dd_hh-mm-ss")).toStdString();
+    const auto path = log_dir / fmt::format("pipeline_statistics_{:016X}_{}.json", title_id, date);
+    const QString path_string = QString::fromStdString(Common::FS::PathToUTF8String(path));
+    if (!pipeline_stats.DumpJson(path)) {
+        QMessageBox::warning(this, tr("Dump Pipeline Statistics"),
+                             tr("Failed to write pipeline statistics to %1").arg(path_string));
+        return;
+    }
+    QMessageBox::information(this, tr("Dump Pipeline Statistics"),
+                             tr("Pipeline statistics saved to %1").arg(path_string));
+}
+
 // TODO: Written 2020-10-01: Remove per-game config migration code when it is irrelevant
 void GMainWindow::MigrateConfigFiles() {
     const auto config_dir_fs_path = Common::FS::GetYuzuPath(Common::FS::YuzuPath::ConfigDir);
@@ -4640,12 +4685,106 @@ void GMainWindow::UpdateStatusBar() {
     const int shaders_building = shader_notify.ShadersBuilding();
 
     if (shaders_building > 0) {
+        const VideoCore::ShaderBuildStats build_stats = shader_notify.GetBuildStats();
+        u64 built = 0;
+        u64 total_latency_us = 0;
+        u64 max_latency_us = 0;
+        for (size_t queue = 0; queue < VideoCore::ShaderBuildStats::NUM_QUEUES; ++queue) {
+            built += build_stats.completed[queue];
+            total_latency_us += build_stats.total_latency_us[queue];
+            max_latency_us = std::max(max_latency_us, build_stats.max_latency_us[queue]);
+        }
+        const double average_ms =
+            built > 0 ? static_cast<double>(total_latency_us) / static_cast<double>(built) / 1000.0
+                      : 0.0;
         shader_building_label->setText(tr("Building: %n shader(s)", "", shaders_building));
+        shader_building_label->setToolTip(
+            tr("Built: %1 pipelines, %2 ms average, %3 ms longest\n"
+               "Skipped draws: %4\nTime waited for pipelines: %5 ms")
+                .arg(built)
+                .arg(average_ms, 0, 'f', 1)
+                .arg(static_cast<double>(max_latency_us) / 1000.0, 0, 'f', 1)
+                .arg(build_stats.skipped_draws)
+                .arg(static_cast<double>(build_stats.stall_time_us) / 1000.0, 0, 'f', 1));
         shader_building_label->setVisible(true);
     } else {
         shader_building_label->setVisible(false);
     }
 
+    const u64 texture_hits = shader_notify.TranscodeHits();
+    const u64 texture_misses = shader_notify.TranscodeMisses();
+    const auto& texture_stats = results.texture_cache;
+    if (texture_hits + texture_misses > 0) {
+        texture_cache_label->setText(tr("Textures: %1 cached / %2 decoded")
+                                         .arg(texture_hits)
+                                         .arg(texture_misses));
+    } else if (texture_stats.frames > 0) {
+        texture_cache_label->setText(
+            tr("Textures: %1 KiB/frame")
+                .arg(texture_stats.bytes_uploaded / 1024 / texture_stats.frames));
+    }
+    if (texture_stats.frames > 0) {
+        const double frames = static_cast<double>(texture_stats.frames);
+        const auto per_frame = [frames](u64 value) { return static_cast<double>(value) / frames; };
+        const auto kib = [&per_frame](u64 bytes) { return per_frame(bytes) / 1024.0; };
+        texture_cache_label->setToolTip(
+            tr("How many textures decoded on the CPU were loaded from the disk texture cache, and "
+               "how many had to be decoded.\n\n"
+               "Per frame: %1 images created, %2 deleted and %3 collected\n"
+               "%4 KiB uploaded and %5 KiB downloaded\n"
+               "%6 KiB decoded on the CPU and %7 KiB on the GPU\n"
+               "%8 alias syncs, %9 copies and %10 rescales\n"
+               "%11 ms filling image views")
+                .arg(per_frame(texture_stats.images_created), 0, 'f', 1)
+                .arg(per_frame(texture_stats.images_deleted), 0, 'f', 1)
+                .arg(per_frame(texture_stats.images_collected), 0, 'f', 1)
+                .arg(kib(texture_stats.bytes_uploaded), 0, 'f', 0)
+                .arg(kib(texture_stats.bytes_downloaded), 0, 'f', 0)
+                .arg(kib(texture_stats.cpu_decoded_bytes), 0, 'f', 0)
+                .arg(kib(texture_stats.gpu_decoded_bytes), 0, 'f', 0)
+                .arg(per_frame(texture_stats.alias_syncs), 0, 'f', 1)
+                .arg(per_frame(texture_stats.image_copies), 0, 'f', 1)
+                .arg(per_frame(texture_stats.rescales), 0, 'f', 1)
+                .arg(per_frame(texture_stats.fill_image_views_ns) / 1'000'000.0, 0, 'f', 2));
+    }
+    texture_cache_label->setVisible(texture_hits + texture_misses > 0 || texture_stats.frames > 0);
+
+    auto& memory_stats = system->GPU().MemoryStats();
+    const u64 vram_budget = memory_stats.Budget();
+    const double eviction_rate = memory_stats.GetAndResetEvictionRate();
+    if (vram_budget > 0) {
+        static constexpr double MiB = 1024.0 * 1024.0;
+        const u64 vram_usage = memory_stats.Usage();
+        if (eviction_rate >= MiB / 10) {
+            vram_label->setText(tr("VRAM: %1 / %2 MiB (evicting %3 MiB/s)")
+                                    .arg(vram_usage >> 20)
+                                    .arg(vram_budget >> 20)
+                                    .arg(eviction_rate / MiB, 0, 'f', 1));
+        } else {
+            vram_label->setText(
+                tr("VRAM: %1 / %2 MiB").arg(vram_usage >> 20).arg(vram_budget >> 20));
+        }
+        vram_label->setVisible(true);
+    } else {
+        vram_label->setVisible(false);
+    }
+    const VideoCore::BufferCacheStats buffer_stats = memory_stats.GetAndResetBufferCacheStats();
+    if (buffer_stats.frames > 0) {
+        const double frames = static_cast<double>(buffer_stats.frames);
+        vram_label->setToolTip(
+            tr("Video memory used by the emulator against the budget given by the driver, and how "
+               "fast cached textures and buffers are being evicted to stay within it.\n\n"
+               "Per frame: %1 buffer joins copying %2 KiB, %3 buffers grown in place\n"
+               "Per frame: %4 buffer downloads of %5 KiB, %6 ranges merged")
+                .arg(static_cast<double>(buffer_stats.joins) / frames, 0, 'f', 1)
+                .arg(static_cast<double>(buffer_stats.bytes_copied) / frames / 1024.0, 0, 'f', 0)
+                .arg(static_cast<double>(buffer_stats.grows) / frames, 0, 'f', 1)
+                .arg(static_cast<double>(buffer_stats.downloads) / frames, 0, 'f', 1)
+                .arg(static_cast<double>(buffer_stats.bytes_downloaded) / frames / 1024.0, 0, 'f',
+                     0)
+                .arg(static_cast<double>(buffer_stats.downloads_merged) / frames, 0, 'f', 1));
+    }
+
     const auto res_info = Settings::values.resolution_info;
     const auto res_scale = res_info.up_factor;
     res_scale_label->setText(
@@ -4666,6 +4805,154 @@ void GMainWindow::UpdateStatusBar() {
             tr("Game: %1 FPS").arg(std::round(results.average_game_fps), 0, 'f', 0));
     }
     emu_frametime_label->setText(tr("Frame: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
+    QString frametime_tooltip =
+        tr("Time taken to emulate a Switch frame, not counting framelimiting or v-sync. For "
+           "full-speed emulation this should be at most 16.67 ms.");
+    if (results.input_latency > 0.0) {
+        frametime_tooltip += tr("\n\nComposite to display: %1 ms\n"
+                                "Estimated input to display: %2 ms")
+                                 .arg(results.present_latency * 1000.0, 0, 'f', 2)
+                                 .arg(results.input_latency * 1000.0, 0, 'f', 2);
+    }
+    if (results.audio_latency > 0.0) {
+        frametime_tooltip +=
+            tr("\n\nAudio output latency: %1 ms").arg(results.audio_latency * 1000.0, 0, 'f', 1);
+    }
+    const auto& frame_times = results.frame_times;
+    if (frame_times.cpu_bound_frames + frame_times.gpu_bound_frames > 0) {
+        frametime_tooltip += tr("\n\n1% low: %1 ms, 0.1% low: %2 ms, %3 stutter(s)\n"
+                                "%4 CPU bound and %5 GPU bound frames")
+                                 .arg(frame_times.low_1_percent * 1000.0, 0, 'f', 2)
+                                 .arg(frame_times.low_0_1_percent * 1000.0, 0, 'f', 2)
+                                 .arg(frame_times.stutters)
+                                 .arg(frame_times.cpu_bound_frames)
+                                 .arg(frame_times.gpu_bound_frames);
+    }
+    const auto& input_latency = results.measured_input_latency;
+    if (input_latency.samples > 0) {
+        frametime_tooltip += tr("\n\nMeasured input to display: %1 ms median, %2 ms 99th "
+                                "percentile over %3 input(s)\n"
+                                "Input to HID update: %4 ms median")
+                                 .arg(input_latency.present_p50 * 1000.0, 0, 'f', 2)
+                                 .arg(input_latency.present_p99 * 1000.0, 0, 'f', 2)
+                                 .arg(input_latency.samples)
+                                 .arg(input_latency.sampling_p50 * 1000.0, 0, 'f', 2);
+    }
+    const auto& lock_stats = results.scheduler_lock;
+    if (lock_stats.acquisitions > 0) {
+        const double acquisitions = static_cast<double>(lock_stats.acquisitions);
+        frametime_tooltip +=
+            tr("\n\nScheduler lock: %1 acquisitions, %2% contended\n"
+               "%3 ms waiting and %4 ms held, longest hold %5 us")
+                .arg(lock_stats.acquisitions)
+                .arg(static_cast<double>(lock_stats.contended_acquisitions) * 100.0 / acquisitions,
+                     0, 'f', 1)
+                .arg(static_cast<double>(lock_stats.wait_ns) / 1'000'000.0, 0, 'f', 2)
+                .arg(static_cast<double>(lock_stats.hold_ns) / 1'000'000.0, 0, 'f', 2)
+                .arg(static_cast<double>(lock_stats.max_hold_ns) / 1'000.0, 0, 'f', 1);
+    }
+    QString core_idle_tooltip;
+    u64 core_wakeups = 0;
+    for (size_t core = 0; core < results.core_idle.size(); ++core) {
+        const auto& idle = results.core_idle[core];
+        core_wakeups += idle.wakeups;
+        core_idle_tooltip += tr("\nCore %1: %2% idle, %3 wakeups")
+                                 .arg(core)
+                                 .arg(idle.idle_ratio * 100.0, 0, 'f', 1)
+                                 .arg(idle.wakeups);
+    }
+    if (core_wakeups > 0) {
+        frametime_tooltip += tr("\n\nCPU cores:") + core_idle_tooltip;
+    }
+    const auto& wait_stats = results.syncpoint_wait;
+    if (wait_stats.waits > 0) {
+        frametime_tooltip +=
+            tr("\n\nSyncpoint waits: %1, average %2 us, longest %3 us")
+                .arg(wait_stats.waits)
+                .arg(static_cast<double>(wait_stats.wait_ns) / 1'000.0 /
+                         static_cast<double>(wait_stats.waits),
+                     0, 'f', 1)
+                .arg(static_cast<double>(wait_stats.max_wait_ns) / 1'000.0, 0, 'f', 1);
+    }
+    const auto& semaphore_wait = results.semaphore_wait;
+    if (semaphore_wait.waits > 0) {
+        frametime_tooltip +=
+            tr("\n\nSemaphore acquire waits: %1, %2 ms blocked, longest %3 us")
+                .arg(semaphore_wait.waits)
+                .arg(static_cast<double>(semaphore_wait.wait_ns) / 1'000'000.0, 0, 'f', 2)
+                .arg(static_cast<double>(semaphore_wait.max_wait_ns) / 1'000.0, 0, 'f', 1);
+    }
+    const auto& gpu_queue = results.gpu_thread_queue;
+    if (gpu_queue.published_batches > 0) {
+        frametime_tooltip +=
+            tr("
+
+GPU thread queue: %1 commands in %2 wakeups, %3 merged
+"
+               "Largest batch %4, deepest queue %5, %6 region syncs")
+                .arg(gpu_queue.published_commands)
+                .arg(gpu_queue.published_batches)
+                .arg(gpu_queue.coalesced_commands)
+                .arg(gpu_queue.max_batch_size)
+                .arg(gpu_queue.max_depth)
+                .arg(gpu_queue.region_syncs);
+    }
+    const auto& video = results.video_pipeline;
+    if (video.frames_submitted > 0 || video.frames_written > 0) {
+        const auto per_frame_ms = [](u64 ns, u64 frames) {
+            return frames > 0 ? static_cast<double>(ns) / 1'000'000.0 / static_cast<double>(frames)
+                              : 0.0;
+        };
+        frametime_tooltip +=
+            tr("\n\nVideo: %1 frames decoded (%2 on hardware), %3 dropped\n"
+               "Per frame: %4 ms composing, %5 ms decoding, %6 ms converting\n"
+               "%7 MiB written, up to %8 frames and %9 command lists queued")
+                .arg(video.frames_decoded)
+                .arg(video.hardware_frames)
+                .arg(video.dropped_frames)
+                .arg(per_frame_ms(video.parse_ns, video.frames_submitted), 0, 'f', 2)
+                .arg(per_frame_ms(video.decode_ns, video.frames_submitted), 0, 'f', 2)
+                .arg(per_frame_ms(video.conversion_ns, video.frames_written), 0, 'f', 2)
+                .arg(static_cast<double>(video.bytes_written) / (1024.0 * 1024.0), 0, 'f', 1)
+                .arg(video.max_frame_queue)
+                .arg(video.max_command_queue);
+    }
+    const auto& read_ahead = results.read_ahead;
+    if (const u64 lookups = read_ahead.hits + read_ahead.misses; lookups > 0) {
+        frametime_tooltip +=
+            tr("\n\nRomFS read ahead: %1% hit rate, %2 blocks prefetched\n"
+               "%3 ms waiting on storage")
+                .arg(static_cast<double>(read_ahead.hits) * 100.0 / static_cast<double>(lookups),
+                     0, 'f', 1)
+                .arg(read_ahead.prefetches)
+                .arg(static_cast<double>(read_ahead.wait_ns) / 1'000'000.0, 0, 'f', 2);
+    }
+    const auto& block_cache = results.compressed_block_cache;
+    if (const u64 lookups = block_cache.hits + block_cache.misses;
+        lookups > 0 || block_cache.parallel_blocks > 0) {
+        frametime_tooltip +=
+            tr("\n\nCompressed blocks: %1% cache hit rate, %2 decompressed in parallel")
+                .arg(lookups > 0 ? static_cast<double>(block_cache.hits) * 100.0 /
+                                       static_cast<double>(lookups)
+                                 : 0.0,
+                     0, 'f', 1)
+                .arg(block_cache.parallel_blocks);
+    }
+    const auto& jit_cache = results.jit_cache;
+    if (jit_cache.translated_instructions > 0 || jit_cache.invalidations > 0 ||
+        jit_cache.cache_clears > 0) {
+        frametime_tooltip +=
+            tr("\n\nJIT code cache: %1 MiB per core\n"
+               "%2 blocks (%3 instructions) translated\n"
+               "%4 ranges (%5 KiB) invalidated, %6 full clears")
+                .arg(jit_cache.code_cache_size / (1024 * 1024))
+                .arg(jit_cache.translated_blocks)
+                .arg(jit_cache.translated_instructions)
+                .arg(jit_cache.invalidations)
+                .arg(static_cast<double>(jit_cache.invalidated_bytes) / 1024.0, 0, 'f', 1)
+                .arg(jit_cache.cache_clears);
+    }
+    emu_frametime_label->setToolTip(frametime_tooltip);
 
     res_scale_label->setVisible(true);
     emu_speed_label->setVisible(!Settings::values.use_multi_core.GetValue());
@@ -166,7 +166,30 @@ void EmuWindow_SDL2::WaitEvent() {
         LOG_CRITICAL(Frontend, "SDL_WaitEvent failed: {}", error);
         exit(1);
     }
+    HandleEvent(event);
+}
+
+void EmuWindow_SDL2::WaitEvent(std::chrono::milliseconds timeout) {
+    // Called on main thread
+    SDL_Event event;
+    if (SDL_WaitEventTimeout(&event, static_cast<int>(timeout.count()))) {
+        HandleEvent(event);
+    }
+}
+
+void EmuWindow_SDL2::DisablePerfStatsSampling() {
+    sample_perf_stats = false;
+}
+
+void EmuWindow_SDL2::ShowPerfStats(const Core::PerfStatsResults& results) {
+    const auto title =
+        fmt::format("yuzu {} | {}-{} | FPS: {:.0f} ({:.0f}%)", Common::g_build_fullname,
+                    Common::g_scm_branch, Common::g_scm_desc, results.average_game_fps,
+                    results.emulation_speed * 100.0);
+    SDL_SetWindowTitle(render_window, title.c_str());
+}
 
+void EmuWindow_SDL2::HandleEvent(const SDL_Event& event) {
     switch (event.type) {
     case SDL_WINDOWEVENT:
         switch (event.window.event) {
@@ -221,13 +244,8 @@ void EmuWindow_SDL2::WaitEvent() {
     }
 
     const u32 current_time = SDL_GetTicks();
-    if (current_time > last_time + 2000) {
-        const auto results = system.GetAndResetPerfStats();
-        const auto title =
-            fmt::format("yuzu {} | {}-{} | FPS: {:.0f} ({:.0f}%)", Common::g_build_fullname,
-                        Common::g_scm_branch, Common::g_scm_desc, results.average_game_fps,
-                        results.emulation_speed * 100.0);
-        SDL_SetWindowTitle(render_window, title.c_str());
+    if (sample_perf_stats && current_time > last_time + 2000) {
+        ShowPerfStats(system.GetAndResetPerfStats());
         last_time = current_time;
     }
 }
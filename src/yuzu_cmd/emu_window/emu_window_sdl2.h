@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <utility>
 
 #include "core/frontend/emu_window.h"
@@ -10,9 +11,12 @@
 
 struct SDL_Window;
 
+union SDL_Event;
+
 namespace Core {
 class System;
-}
+struct PerfStatsResults;
+} // namespace Core
 
 namespace InputCommon {
 class InputSubsystem;
@@ -33,10 +37,22 @@ public:
     /// Wait for the next event on the main thread.
     void WaitEvent();
 
+    /// Wait for the next event on the main thread, returns after the timeout when none arrives.
+    void WaitEvent(std::chrono::milliseconds timeout);
+
+    /// Stops WaitEvent from sampling the performance statistics, for callers sampling them
+    void DisablePerfStatsSampling();
+
+    /// Shows performance statistics in the title bar
+    void ShowPerfStats(const Core::PerfStatsResults& results);
+
     // Sets the window icon from yuzu.bmp
     void SetWindowIcon();
 
 protected:
+    /// Dispatches an event received by WaitEvent
+    void HandleEvent(const SDL_Event& event);
+
     /// Called by WaitEvent when a key is pressed or released.
     void OnKeyEvent(int key, u8 state);
 
@@ -85,6 +101,9 @@ protected:
     /// Keeps track of how often to update the title bar during gameplay
     u32 last_time = 0;
 
+    /// Whether WaitEvent samples the performance statistics for the title bar
+    bool sample_perf_stats = true;
+
     /// Input subsystem to use with this window.
     InputCommon::InputSubsystem* input_subsystem;
 
@@ -52,6 +52,13 @@ SdlConfig::SdlConfig(const std::optional<std::string> config_path) {
     SaveSdlValues();
 }
 
+SdlConfig::SdlConfig(const std::string& config_name, ConfigType config_type)
+    : Config(config_type) {
+    Initialize(config_name);
+    ReadSdlValues();
+    SaveSdlValues();
+}
+
 SdlConfig::~SdlConfig() {
     if (global) {
         SdlConfig::SaveAllValues();
@@ -1,18 +1,28 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <thread>
 
 #include <fmt/ostream.h>
+#include <nlohmann/json.hpp>
 
 #include "common/detached_tasks.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
 #include "common/logging/backend.h"
 #include "common/logging/log.h"
+#include "common/memory_detect.h"
 #include "common/microprofile.h"
 #include "common/nvidia_flags.h"
 #include "common/scm_rev.h"
@@ -29,12 +39,18 @@
 #include "core/hle/service/am/applet_manager.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/loader/loader.h"
+#include "core/perf_profile.h"
+#include "core/perf_stats.h"
 #include "core/telemetry_session.h"
 #include "frontend_common/config.h"
+#include "input_common/drivers/tas_input.h"
 #include "input_common/main.h"
 #include "network/network.h"
 #include "sdl_config.h"
+#include "video_core/gpu.h"
+#include "video_core/gpu_capture.h"
 #include "video_core/renderer_base.h"
+#include "video_core/shader_notify.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2_gl.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2_null.h"
@@ -68,18 +84,42 @@ __declspec(dllexport) int AmdPowerXpressRequestHighPerformance = 1;
 #include "common/linux/gamemode.h"
 #endif
 
+#ifdef YUZU_USE_EXTERNAL_SDL2
+// Include this before SDL.h to prevent the external from including a dummy
+#define USING_GENERATED_CONFIG_H
+#include <SDL_config.h>
+#endif
+
+#include <SDL.h>
+
 static void PrintHelp(const char* argv0) {
     std::cout << "Usage: " << argv0
               << " [options] <filename>\n"
+                 "-b, --benchmark=secs  Benchmark the game under candidate settings for the given\n"
+                 "                      seconds each and save the fastest ones as its settings\n"
                  "-c, --config          Load the specified configuration file\n"
+                 "-d, --device=index    Use the Vulkan device with the given index\n"
                  "-f, --fullscreen      Start in fullscreen mode\n"
                  "-g, --game            File path of the game to load\n"
                  "-h, --help            Display this help and exit\n"
+                 "-i, --iterations=count\n"
+                 "                      Replay the GPU capture the given number of times\n"
                  "-m, --multiplayer=nick:password@address:port"
                  " Nickname, password, address and port for multiplayer\n"
+                 "-n, --frames=count    Exit after the game presents the given number of frames\n"
                  "-p, --program         Pass following string as arguments to executable\n"
+                 "-P, --precompile[=file]\n"
+                 "                      Build every pipeline of the shader cache of the game for\n"
+                 "                      this GPU and exit, after installing the transferable\n"
+                 "                      cache file when one is given\n"
+                 "-r, --report=path     Write a JSON performance report on exit, - for stdout\n"
+                 "-R, --replay=file     Replay a GPU capture on the configured renderer, or the\n"
+                 "                      null renderer when headless, and exit\n"
+                 "-s, --seconds=secs    Exit after running the game for the given seconds\n"
+                 "-t, --tas             Play the TAS scripts from the start of the game\n"
                  "-u, --user            Select a specific user profile from 0 to 7\n"
-                 "-v, --version         Output version information and exit\n";
+                 "-v, --version         Output version information and exit\n"
+                 "-x, --headless        Run without a window on the null renderer\n";
 }
 
 static void PrintVersion() {
@@ -183,6 +223,313 @@ static void OnStatusMessageReceived(const Network::StatusMessageEntry& msg) {
         std::cout << std::endl << "* " << message << std::endl << std::endl;
 }
 
+/// Time a profile runs before its statistics are sampled, shader compilation and loading screens
+/// would otherwise dominate short runs
+constexpr std::chrono::seconds BenchmarkWarmUp{15};
+constexpr std::chrono::seconds BenchmarkSampleInterval{1};
+
+/// Limits and report of a run that exits on its own, for performance regression testing
+struct TimedRun {
+    std::optional<u64> frames;
+    std::optional<std::chrono::seconds> duration;
+    /// Path of the JSON report, - writes it to stdout and empty skips it
+    std::string report_path;
+};
+
+static bool WriteTimedRunReport(const std::string& path, const nlohmann::json& report) {
+    if (path == "-") {
+        std::cout << report.dump(4) << std::endl;
+        return true;
+    }
+    std::ofstream file(std::filesystem::path{path}, std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << report.dump(4) << std::endl;
+    return file.good();
+}
+
+static nlohmann::json ShaderBuildReport(const VideoCore::ShaderBuildStats& stats) {
+    static constexpr std::array<const char*, VideoCore::ShaderBuildStats::NUM_QUEUES> names{
+        "blocking",
+        "worker",
+    };
+    constexpr auto& buckets_ms = VideoCore::ShaderBuildStats::LATENCY_BUCKETS_MS;
+    const auto to_ms = [](u64 us) { return static_cast<double>(us) / 1000.0; };
+
+    nlohmann::json queues = nlohmann::json::object();
+    for (size_t queue = 0; queue < names.size(); ++queue) {
+        const u64 completed = stats.completed[queue];
+        const u64 average_us = completed > 0 ? stats.total_latency_us[queue] / completed : 0;
+        queues[names[queue]] = {
+            {"pending", stats.pending[queue]},
+            {"completed", completed},
+            {"average_latency_ms", to_ms(average_us)},
+            {"max_latency_ms", to_ms(stats.max_latency_us[queue])},
+        };
+    }
+    // The last bucket has no upper bound and is written with a null max_ms
+    nlohmann::json histogram = nlohmann::json::array();
+    for (size_t bucket = 0; bucket < stats.latency_histogram.size(); ++bucket) {
+        const nlohmann::json max_ms =
+            bucket < buckets_ms.size() ? nlohmann::json(buckets_ms[bucket]) : nlohmann::json();
+        histogram.push_back({{"max_ms", max_ms}, {"count", stats.latency_histogram[bucket]}});
+    }
+    return {
+        {"queues", std::move(queues)},
+        {"latency_histogram", std::move(histogram)},
+        {"skipped_draws", stats.skipped_draws},
+        {"stall_time_ms", to_ms(stats.stall_time_us)},
+    };
+}
+
+/// Runs the loaded game until a limit of the run is reached or the window is closed
+static int RunTimed(Core::System& system, EmuWindow_SDL2& emu_window, const TimedRun& run) {
+    using Clock = std::chrono::steady_clock;
+
+    // Boot and shader cache loading are left out of the statistics
+    emu_window.DisablePerfStatsSampling();
+    void(system.GetAndResetPerfStats());
+    const u64 first_frame = system.GetPerfStats().GetGameFrameCount();
+    const int first_shader = system.GPU().ShaderNotify().ShadersBuilt();
+    system.GPU().ShaderNotify().ResetBuildStats();
+
+    Core::PerfProfileRecorder recorder;
+    const auto start = Clock::now();
+    auto next_sample = start + BenchmarkSampleInterval;
+    bool completed = false;
+    u64 frames = 0;
+    while (emu_window.IsOpen()) {
+        emu_window.WaitEvent(std::chrono::milliseconds{100});
+        const auto now = Clock::now();
+        frames = system.GetPerfStats().GetGameFrameCount() - first_frame;
+        completed = (run.frames && frames >= *run.frames) ||
+                    (run.duration && now - start >= *run.duration);
+        if (now >= next_sample || completed) {
+            const Core::PerfStatsResults results = system.GetAndResetPerfStats();
+            emu_window.ShowPerfStats(results);
+            recorder.AddSample(results);
+            next_sample = now + BenchmarkSampleInterval;
+        }
+        if (completed) {
+            break;
+        }
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    const int shaders_built = system.GPU().ShaderNotify().ShadersBuilt() - first_shader;
+    const auto to_ms = [](std::chrono::nanoseconds time) {
+        return std::chrono::duration<double, std::milli>(time).count();
+    };
+    const Core::PerfStats& perf_stats = system.GetPerfStats();
+    const double frame_time_p50 = to_ms(perf_stats.GetFrameTimePercentile(0.5));
+    const double frame_time_p99 = to_ms(perf_stats.GetFrameTimePercentile(0.99));
+
+    void(system.Pause());
+    const Core::PerfProfileMetrics metrics = recorder.GetMetrics();
+    LOG_INFO(Frontend,
+             "Ran {} frames in {:.1f} s: {:.1f} FPS, {:.0f}% speed, {:.2f} ms frame time, "
+             "{} shaders built",
+             frames, seconds, metrics.average_game_fps, metrics.emulation_speed * 100.0,
+             metrics.frametime * 1000.0, shaders_built);
+
+    if (!run.report_path.empty()) {
+        const nlohmann::json report{
+            {"title_id", fmt::format("{:016X}", system.GetApplicationProcessProgramID())},
+            {"build", fmt::format("{}-{}", Common::g_scm_branch, Common::g_scm_desc)},
+            {"renderer", Settings::values.renderer_backend.ToString()},
+            {"completed", completed},
+            {"seconds", seconds},
+            {"game_frames", frames},
+            {"average_game_fps", metrics.average_game_fps},
+            {"emulation_speed", metrics.emulation_speed},
+            {"frametime_ms", metrics.frametime * 1000.0},
+            {"low_1_percent_ms", metrics.low_1_percent * 1000.0},
+            {"frame_time_p50_ms", frame_time_p50},
+            {"frame_time_p99_ms", frame_time_p99},
+            {"stutters", metrics.stutters},
+            {"shaders_built", shaders_built},
+            {"shader_builds", ShaderBuildReport(system.GPU().ShaderNotify().GetBuildStats())},
+            {"peak_memory_bytes", Common::GetPeakResidentMemory()},
+        };
+        if (!WriteTimedRunReport(run.report_path, report)) {
+            LOG_ERROR(Frontend, "Failed to write the report to {}", run.report_path);
+            return -1;
+        }
+    }
+    // Closing the window early is reported as a failure, the limits were not reached
+    return completed ? 0 : 1;
+}
+
+/// Builds the pipelines of the transferable shader cache of a game into the Vulkan driver
+/// pipeline cache without running it, so its first session doesn't compile them
+static int RunPipelinePrecompile(Core::System& system, EmuWindow_SDL2& emu_window,
+                                 const std::string& filepath, const std::string& cache_path) {
+    Service::AM::FrontendAppletParameters load_parameters{
+        .applet_id = Service::AM::AppletId::Application,
+    };
+    if (system.Load(emu_window, filepath, load_parameters) != Core::SystemResultStatus::Success) {
+        LOG_CRITICAL(Frontend, "Failed to load {}", filepath);
+        return -1;
+    }
+    SCOPE_EXIT {
+        system.ShutdownMainProcess();
+    };
+    const u64 title_id = system.GetApplicationProcessProgramID();
+    if (!cache_path.empty()) {
+        // The pipeline cache reads the transferable cache from the shader directory of the title
+        const auto target = Common::FS::GetYuzuPath(Common::FS::YuzuPath::ShaderDir) /
+                            fmt::format("{:016x}", title_id) / "vulkan.bin";
+        std::error_code ec;
+        if (!Common::FS::CreateParentDirs(target) ||
+            !std::filesystem::copy_file(std::filesystem::path{cache_path}, target,
+                                        std::filesystem::copy_options::overwrite_existing, ec)) {
+            LOG_CRITICAL(Frontend, "Failed to install the shader cache {}: {}", cache_path,
+                         ec.message());
+            return -1;
+        }
+    }
+
+    system.GPU().Start();
+    system.GetCpuManager().OnGpuReady();
+
+    // Called with the lock of the loader held, so the progress needs no synchronization
+    size_t reported_percent = 0;
+    const auto start = std::chrono::steady_clock::now();
+    system.Renderer().ReadRasterizer()->PrecompileDiskResources(
+        title_id, std::stop_token{},
+        [&](VideoCore::LoadCallbackStage stage, size_t built, size_t total) {
+            if (stage != VideoCore::LoadCallbackStage::Build || total == 0) {
+                return;
+            }
+            const size_t percent = built * 100 / total;
+            if (built == 0 || percent >= reported_percent + 5 || built == total) {
+                LOG_INFO(Frontend, "Built {} of {} pipelines ({}%)", built, total, percent);
+                reported_percent = percent;
+            }
+        });
+    const auto seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    LOG_INFO(Frontend, "Precompiled {} pipelines of {:016X} in {:.1f} s",
+             system.GPU().ShaderNotify().ShadersBuilt(), title_id, seconds);
+    return 0;
+}
+
+/// Replays a GPU capture without running its game and reports how long its frames took
+static int RunGpuReplay(Core::System& system, EmuWindow_SDL2& emu_window,
+                        const std::string& capture_path, size_t iterations) {
+    const auto capture = VideoCommon::LoadGpuCapture(std::filesystem::path{capture_path});
+    if (!capture) {
+        LOG_CRITICAL(Frontend, "Failed to load the GPU capture {}", capture_path);
+        return -1;
+    }
+    if (system.CreateGpuOffline(emu_window) != Core::SystemResultStatus::Success) {
+        LOG_CRITICAL(Frontend, "Failed to initialize the renderer");
+        return -1;
+    }
+    SCOPE_EXIT {
+        system.ShutdownGpuOffline();
+    };
+    system.GPU().Start();
+
+    const auto stats = VideoCommon::ReplayGpuCapture(system, *capture, iterations);
+    if (!stats) {
+        LOG_CRITICAL(Frontend, "Failed to replay the GPU capture {}", capture_path);
+        return -1;
+    }
+    return 0;
+}
+
+/// Runs the game once per candidate performance profile and saves the fastest one to its per-game
+/// configuration
+static int RunPerfProfileBenchmark(Core::System& system, EmuWindow_SDL2& emu_window,
+                                   const std::string& filepath, std::chrono::seconds duration) {
+    u64 program_id{};
+    const auto loader =
+        Loader::GetLoader(system, Core::GetGameFileFromPath(system.GetFilesystem(), filepath));
+    if (!loader || loader->ReadProgramId(program_id) != Loader::ResultStatus::Success) {
+        LOG_CRITICAL(Frontend, "Failed to read the program ID of {}", filepath);
+        return -1;
+    }
+    const auto config_name =
+        program_id == 0 ? Common::FS::PathToUTF8String(std::filesystem::path{filepath}.filename())
+                        : fmt::format("{:016X}", program_id);
+    SdlConfig per_game_config{config_name, Config::ConfigType::PerGameConfig};
+
+    Core::PerfProfileTuner tuner{Core::GetPerfProfileDimensions()};
+    emu_window.DisablePerfStatsSampling();
+    while (const std::optional<Core::PerfProfile> profile = tuner.Next()) {
+        per_game_config.ReloadAllValues();
+        Core::ApplyPerfProfile(*profile);
+        LOG_INFO(Frontend, "Benchmarking {}", profile->Describe());
+
+        Service::AM::FrontendAppletParameters load_parameters{
+            .applet_id = Service::AM::AppletId::Application,
+        };
+        const Core::SystemResultStatus load_result{
+            system.Load(emu_window, filepath, load_parameters)};
+        if (load_result != Core::SystemResultStatus::Success) {
+            LOG_CRITICAL(Frontend, "Failed to load {}", filepath);
+            return -1;
+        }
+        system.GPU().Start();
+        system.GetCpuManager().OnGpuReady();
+        if (Settings::values.use_disk_shader_cache.GetValue()) {
+            system.Renderer().ReadRasterizer()->LoadDiskResources(
+                system.GetApplicationProcessProgramID(), std::stop_token{},
+                [](VideoCore::LoadCallbackStage, size_t value, size_t total) {});
+        }
+        system.Run();
+
+        Core::PerfProfileRecorder recorder;
+        const auto start = std::chrono::steady_clock::now();
+        auto next_sample = start + BenchmarkWarmUp;
+        bool warmed_up = false;
+        while (emu_window.IsOpen()) {
+            emu_window.WaitEvent(std::chrono::milliseconds{100});
+            const auto now = std::chrono::steady_clock::now();
+            if (now < next_sample) {
+                continue;
+            }
+            // The first sample covers the warm up and is dropped
+            const Core::PerfStatsResults results = system.GetAndResetPerfStats();
+            emu_window.ShowPerfStats(results);
+            if (warmed_up) {
+                recorder.AddSample(results);
+            }
+            warmed_up = true;
+            next_sample = now + BenchmarkSampleInterval;
+            if (now - start >= BenchmarkWarmUp + duration) {
+                break;
+            }
+        }
+        void(system.Pause());
+        system.ShutdownMainProcess();
+        if (!emu_window.IsOpen()) {
+            LOG_INFO(Frontend, "Benchmark cancelled");
+            return 0;
+        }
+
+        const Core::PerfProfileMetrics metrics = recorder.GetMetrics();
+        LOG_INFO(Frontend,
+                 "{}: {:.1f} FPS, {:.0f}% speed, {:.2f} ms frame time, {:.2f} ms 1% low, "
+                 "{} stutters",
+                 profile->Describe(), metrics.average_game_fps, metrics.emulation_speed * 100.0,
+                 metrics.frametime * 1000.0, metrics.low_1_percent * 1000.0, metrics.stutters);
+        tuner.Report(metrics);
+    }
+
+    const Core::PerfProfile& best = tuner.Best();
+    if (best.values.empty()) {
+        LOG_INFO(Frontend, "The current settings are the fastest, nothing to save");
+        return 0;
+    }
+    per_game_config.ReloadAllValues();
+    Core::ApplyPerfProfile(best);
+    per_game_config.SaveAllValues();
+    LOG_INFO(Frontend, "Saved {} to the settings of the game", best.Describe());
+    return 0;
+}
+
 /// Application entry point
 int main(int argc, char** argv) {
 #ifdef _WIN32
@@ -211,6 +558,14 @@ int main(int argc, char** argv) {
     std::optional<std::string> config_path;
     std::string program_args;
     std::optional<int> selected_user;
+    std::optional<std::chrono::seconds> benchmark_duration;
+    TimedRun timed_run;
+    bool headless = false;
+    std::optional<std::string> precompile_cache;
+    std::optional<std::string> replay_path;
+    size_t replay_iterations = 1;
+    std::optional<int> vulkan_device;
+    bool play_tas = false;
 
     bool use_multiplayer = false;
     bool fullscreen = false;
@@ -221,12 +576,22 @@ int main(int argc, char** argv) {
 
     static struct option long_options[] = {
         // clang-format off
+        {"benchmark", required_argument, 0, 'b'},
         {"config", required_argument, 0, 'c'},
+        {"device", required_argument, 0, 'd'},
         {"fullscreen", no_argument, 0, 'f'},
+        {"frames", required_argument, 0, 'n'},
         {"help", no_argument, 0, 'h'},
+        {"headless", no_argument, 0, 'x'},
         {"game", required_argument, 0, 'g'},
+        {"iterations", required_argument, 0, 'i'},
         {"multiplayer", required_argument, 0, 'm'},
+        {"precompile", optional_argument, 0, 'P'},
         {"program", optional_argument, 0, 'p'},
+        {"replay", required_argument, 0, 'R'},
+        {"report", required_argument, 0, 'r'},
+        {"seconds", required_argument, 0, 's'},
+        {"tas", no_argument, 0, 't'},
         {"user", required_argument, 0, 'u'},
         {"version", no_argument, 0, 'v'},
         {0, 0, 0, 0},
@@ -234,12 +599,19 @@ int main(int argc, char** argv) {
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "g:fhvp::c:u:", long_options, &option_index);
+        int arg =
+            getopt_long(argc, argv, "b:g:fhi:vp::c:u:n:r:R:s:txd:P::", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
+            case 'b':
+                benchmark_duration = std::chrono::seconds{std::max(std::atoi(optarg), 1)};
+                break;
             case 'c':
                 config_path = optarg;
                 break;
+            case 'd':
+                vulkan_device = std::atoi(optarg);
+                break;
             case 'f':
                 fullscreen = true;
                 LOG_INFO(Frontend, "Starting in fullscreen mode...");
@@ -252,6 +624,9 @@ int main(int argc, char** argv) {
                 filepath = str_arg;
                 break;
             }
+            case 'i':
+                replay_iterations = std::max<size_t>(std::strtoull(optarg, nullptr, 0), 1);
+                break;
             case 'm': {
                 use_multiplayer = true;
                 const std::string str_arg(optarg);
@@ -285,16 +660,37 @@ int main(int argc, char** argv) {
                 }
                 break;
             }
+            case 'n':
+                timed_run.frames = std::max<u64>(std::strtoull(optarg, nullptr, 0), 1);
+                break;
             case 'p':
                 program_args = argv[optind];
                 ++optind;
                 break;
+            case 'P':
+                precompile_cache = optarg != nullptr ? optarg : "";
+                break;
+            case 'r':
+                timed_run.report_path = optarg;
+                break;
+            case 'R':
+                replay_path = optarg;
+                break;
+            case 's':
+                timed_run.duration = std::chrono::seconds{std::max(std::atoi(optarg), 1)};
+                break;
+            case 't':
+                play_tas = true;
+                break;
             case 'u':
                 selected_user = atoi(optarg);
                 break;
             case 'v':
                 PrintVersion();
                 return 0;
+            case 'x':
+                headless = true;
+                break;
             }
         } else {
 #ifdef _WIN32
@@ -322,6 +718,45 @@ int main(int argc, char** argv) {
         Settings::values.current_user = std::clamp(*selected_user, 0, 7);
     }
 
+    if (headless) {
+        // The null renderer needs no surface, so the window can come from SDL's dummy driver
+        // that works without a display
+        Settings::values.renderer_backend = Settings::RendererBackend::Null;
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+    }
+
+    if (vulkan_device) {
+        Settings::values.vulkan_device = *vulkan_device;
+    }
+
+    if (precompile_cache) {
+        if (headless) {
+            LOG_CRITICAL(Frontend, "Precompiling needs a Vulkan surface, it can't run headless");
+            return -1;
+        }
+        // Only Vulkan has a driver pipeline cache to fill ahead of time
+        Settings::values.renderer_backend = Settings::RendererBackend::Vulkan;
+        Settings::values.use_disk_shader_cache = true;
+        Settings::values.use_vulkan_driver_pipeline_cache = true;
+    }
+
+    if (replay_path) {
+        // The replay runs no program, and must not capture itself
+        Settings::values.capture_gpu_commands = false;
+        Settings::values.profile_macros = false;
+    }
+
+    if (play_tas) {
+        Settings::values.tas_enable = true;
+        Settings::values.pause_tas_on_load = false;
+    }
+
+    const bool is_timed_run = timed_run.frames || timed_run.duration;
+    if (!is_timed_run && !timed_run.report_path.empty()) {
+        LOG_CRITICAL(Frontend, "A report needs --frames or --seconds to end the run");
+        return -1;
+    }
+
 #ifdef _WIN32
     LocalFree(argv_w);
 #endif
@@ -333,7 +768,7 @@ int main(int argc, char** argv) {
 
     Common::ConfigureNvidiaEnvironmentFlags();
 
-    if (filepath.empty()) {
+    if (filepath.empty() && !replay_path) {
         LOG_CRITICAL(Frontend, "Failed to load ROM: No ROM specified");
         return -1;
     }
@@ -369,6 +804,16 @@ int main(int argc, char** argv) {
     system.GetFileSystemController().CreateFactories(*system.GetFilesystem());
     system.GetUserChannel().clear();
 
+    if (replay_path) {
+        return RunGpuReplay(system, *emu_window, *replay_path, replay_iterations);
+    }
+    if (benchmark_duration) {
+        return RunPerfProfileBenchmark(system, *emu_window, filepath, *benchmark_duration);
+    }
+    if (precompile_cache) {
+        return RunPipelinePrecompile(system, *emu_window, filepath, *precompile_cache);
+    }
+
     Service::AM::FrontendAppletParameters load_parameters{
         .applet_id = Service::AM::AppletId::Application,
     };
@@ -440,14 +885,22 @@ int main(int argc, char** argv) {
 #endif
 
     void(system.Run());
-    if (system.DebuggerEnabled()) {
-        system.InitializeDebugger();
+    if (play_tas) {
+        input_subsystem.GetTas()->StartStop();
     }
-    while (emu_window->IsOpen()) {
-        emu_window->WaitEvent();
+    int result = 0;
+    if (is_timed_run) {
+        result = RunTimed(system, *emu_window, timed_run);
+    } else {
+        if (system.DebuggerEnabled()) {
+            system.InitializeDebugger();
+        }
+        while (emu_window->IsOpen()) {
+            emu_window->WaitEvent();
+        }
+        system.DetachDebugger();
+        void(system.Pause());
     }
-    system.DetachDebugger();
-    void(system.Pause());
     system.ShutdownMainProcess();
 
 #ifdef __unix__
@@ -455,5 +908,5 @@ int main(int argc, char** argv) {
 #endif
 
     detached_tasks.WaitForAllTasks();
-    return 0;
+    return result;
 }